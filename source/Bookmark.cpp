@@ -29,6 +29,8 @@ bool Bookmark::Definition::Matches(font_family* family, font_style* style, float
 
 Bookmark::Bookmark(PDFWriter* writer)
 	: fWriter(writer)
+	, fDefinitionOfFont(NULL)
+	, fFontCount(0)
 {
 	for (int i = 0; i < kMaxBookmarkLevels; i ++) {
 		fLevels[i] = 0;
@@ -36,6 +38,12 @@ Bookmark::Bookmark(PDFWriter* writer)
 }
 
 
+Bookmark::~Bookmark()
+{
+	delete[] fDefinitionOfFont;
+}
+
+
 Bookmark::Definition* Bookmark::Find(BFont* font) const
 {
 	font_family family;
@@ -60,13 +68,47 @@ void Bookmark::AddDefinition(int level, BFont* font, bool expanded)
 	ASSERT(1 <= level && level <= kMaxBookmarkLevels);
 	if (Find(font) == NULL) {
 		fDefinitions.AddItem(new Definition(level, font, expanded));
+		// forget the fonts looked up so far
+		fFontCount = 0;
+	}
+}
+
+
+// Find() with the result remembered per font id
+Bookmark::Definition* Bookmark::FindByFontId(int32 fontId)
+{
+	const int32 kUnknown = -2;
+	const int32 kNone = -1;
+
+	if (fontId >= fFontCount) {
+		int32 count = fFontCount == 0 ? 16 : fFontCount;
+		while (count <= fontId) count *= 2;
+		int32* definitionOfFont = new int32[count];
+		for (int32 i = 0; i < count; i++) {
+			definitionOfFont[i] = i < fFontCount ? fDefinitionOfFont[i] : kUnknown;
+		}
+		delete[] fDefinitionOfFont;
+		fDefinitionOfFont = definitionOfFont;
+		fFontCount = count;
+	}
+
+	int32 index = fDefinitionOfFont[fontId];
+	if (index == kUnknown) {
+		BFont font(fWriter->fFontTable.FontAt(fontId));
+		Definition* definition = Find(&font);
+		index = kNone;
+		for (int32 i = 0; definition != NULL && index == kNone; i++) {
+			if (fDefinitions.ItemAt(i) == definition) index = i;
+		}
+		fDefinitionOfFont[fontId] = index;
 	}
+	return index >= 0 ? fDefinitions.ItemAt(index) : NULL;
 }
 
 
-void Bookmark::AddBookmark(BPoint start, float height, const char* text, BFont* font)
+void Bookmark::AddBookmark(BPoint start, float height, const char* text, int32 fontId)
 {
-	Definition* definition = Find(font);
+	Definition* definition = FindByFontId(fontId);
 	if (definition != NULL) {
 		fOutlines.AddItem(new Outline(start, height, text, definition));
 	}
@@ -42,18 +42,24 @@ class Bookmark {
 
 	int                fLevels[kMaxBookmarkLevels+1];
 
+	// definition index per interned font id, see FindByFontId()
+	int32*             fDefinitionOfFont;
+	int32              fFontCount;
+
 	bool Exists(const char* family, const char* style) const;
 	Definition* Find(BFont* font) const;
+	Definition* FindByFontId(int32 fontId);
 
 	static int AscendingByStart(const Outline** a, const Outline** b);
 
 public:
 	
 	Bookmark(PDFWriter* writer);
+	~Bookmark();
 
 	// level starts with 1	
 	void AddDefinition(int level, BFont* font, bool expanded);
-	void AddBookmark(BPoint start, float height, const char* text, BFont* font);
+	void AddBookmark(BPoint start, float height, const char* text, int32 fontId);
 	bool Read(const char* name); // adds definitions from file
 	void CreateBookmarks();
 };
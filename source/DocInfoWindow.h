@@ -46,9 +46,6 @@ class BTextControl;
 class BView;
 
 
-#define HAVE_FULLVERSION_PDF_LIB 0
-
-
 #if HAVE_FULLVERSION_PDF_LIB
 
 class PermissionLabels {
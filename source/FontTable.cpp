@@ -0,0 +1,277 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include "FontTable.h"
+
+#include <string.h>
+
+
+static const uint64 kNoAdvance = ~(uint64)0;
+
+
+//! Appends \a codePoint in UTF-8 to \a string.
+static void
+append_utf8(BString& string, uint16 codePoint)
+{
+	char buffer[3];
+	int32 length;
+	if (codePoint < 0x80) {
+		buffer[0] = codePoint;
+		length = 1;
+	} else if (codePoint < 0x800) {
+		buffer[0] = 0xc0 | (codePoint >> 6);
+		buffer[1] = 0x80 | (codePoint & 0x3f);
+		length = 2;
+	} else {
+		buffer[0] = 0xe0 | (codePoint >> 12);
+		buffer[1] = 0x80 | ((codePoint >> 6) & 0x3f);
+		buffer[2] = 0x80 | (codePoint & 0x3f);
+		length = 3;
+	}
+	string.Append(buffer, length);
+}
+
+
+static inline uint32
+hash_advance(uint64 key)
+{
+	return (uint32)((key ^ (key >> 29)) * 2654435761U);
+}
+
+
+FontTable::Entry::Entry(const BFont& font, uint32 hash)
+	:
+	font(font),
+	hash(hash),
+	used(false),
+	utf8Font(-1),
+	pdfFont(-1),
+	embed(-1)
+{
+	this->font.GetHeight(&height);
+	spaceWidth = this->font.StringWidth(" ", 1);
+
+	font_family family;
+	font_style style;
+	this->font.GetFamilyAndStyle(&family, &style);
+	name << family << "-" << style;
+}
+
+
+FontTable::FontTable()
+	:
+	fSlots(NULL),
+	fSize(0),
+	fAdvanceKeys(NULL),
+	fAdvanceWidths(NULL),
+	fAdvanceSize(0),
+	fAdvanceCount(0),
+	fAdvances(NULL),
+	fAdvancesSize(0)
+{
+	Intern(BFont());
+}
+
+
+FontTable::~FontTable()
+{
+	delete[] fSlots;
+	delete[] fAdvanceKeys;
+	delete[] fAdvanceWidths;
+	delete[] fAdvances;
+}
+
+
+//! Returns the id of \a font, adding it to the table if necessary.
+int32
+FontTable::Intern(const BFont& font)
+{
+	const uint32 hash = HashFont(font);
+	if (fSize > 0) {
+		int32 index = fSlots[SlotOf(font, hash)];
+		if (index >= 0)
+			return index;
+	}
+
+	// keep the load factor at or below one half
+	if (2 * (fEntries.CountItems() + 1) > fSize)
+		Grow();
+
+	const int32 id = fEntries.CountItems();
+	fEntries.AddItem(new Entry(font, hash));
+	fSlots[SlotOf(font, hash)] = id;
+	return id;
+}
+
+
+//! Returns the id of the font \a id with B_UNICODE_UTF8 encoding.
+int32
+FontTable::UTF8Font(int32 id)
+{
+	Entry* entry = fEntries.ItemAt(id);
+	if (entry->utf8Font < 0) {
+		if (entry->font.Encoding() == B_UNICODE_UTF8)
+			entry->utf8Font = id;
+		else {
+			BFont font(entry->font);
+			font.SetEncoding(B_UNICODE_UTF8);
+			const int32 utf8Font = Intern(font);
+			// Intern() might have added an entry, but entries never move
+			entry->utf8Font = utf8Font;
+		}
+	}
+	return entry->utf8Font;
+}
+
+
+/*!	Returns the advance widths of the code points \a decoder has
+	decoded from the UTF-8 string \a utf8 in font \a id. Widths that are
+	not cached yet are all measured with a single GetEscapements() call.
+	The result is valid until the next call.
+*/
+const float*
+FontTable::Advances(int32 id, const char* utf8, const UTF8Decoder& decoder)
+{
+	const int32 count = decoder.CountCodePoints();
+	if (count > fAdvancesSize) {
+		delete[] fAdvances;
+		fAdvancesSize = count < 64 ? 64 : count;
+		fAdvances = new float[fAdvancesSize];
+	}
+
+	bool cached = true;
+	for (int32 i = 0; i < count && cached; i++) {
+		const uint64 key = ((uint64)id << 32) | decoder.CodePointAt(i);
+		const int32 slot = fAdvanceSize > 0 ? AdvanceSlotOf(key) : -1;
+		if (slot >= 0 && fAdvanceKeys[slot] == key)
+			fAdvances[i] = fAdvanceWidths[slot];
+		else
+			cached = false;
+	}
+	if (cached)
+		return fAdvances;
+
+	// measure what was decoded, so that malformed sequences yield
+	// exactly one width each
+	BString text;
+	if (decoder.HasReplacements()) {
+		for (int32 i = 0; i < count; i++)
+			append_utf8(text, decoder.CodePointAt(i));
+		utf8 = text.String();
+	}
+
+	const BFont& font = FontAt(id);
+	font.GetEscapements(utf8, count, fAdvances);
+
+	for (int32 i = 0; i < count; i++) {
+		fAdvances[i] *= font.Size();
+		const uint64 key = ((uint64)id << 32) | decoder.CodePointAt(i);
+
+		// keep the load factor at or below one half
+		if (2 * (fAdvanceCount + 1) > fAdvanceSize)
+			GrowAdvances();
+		const int32 slot = AdvanceSlotOf(key);
+		if (fAdvanceKeys[slot] != key) {
+			fAdvanceKeys[slot] = key;
+			fAdvanceCount++;
+		}
+		fAdvanceWidths[slot] = fAdvances[i];
+	}
+	return fAdvances;
+}
+
+
+/*static*/ uint32
+FontTable::HashFont(const BFont& font)
+{
+	float size = font.Size();
+	uint32 sizeBits;
+	memcpy(&sizeBits, &size, sizeof(sizeBits));
+
+	uint32 hash = font.FamilyAndStyle();
+	hash = hash * 31 + sizeBits;
+	hash = hash * 31 + font.Encoding();
+	hash = hash * 31 + font.Face();
+	return hash * 2654435761U;
+}
+
+
+/*static*/ bool
+FontTable::SameFont(const BFont& a, const BFont& b)
+{
+	return a.FamilyAndStyle() == b.FamilyAndStyle()
+		&& a.Size() == b.Size()
+		&& a.Rotation() == b.Rotation()
+		&& a.Shear() == b.Shear()
+		&& a.Flags() == b.Flags()
+		&& a.Spacing() == b.Spacing()
+		&& a.Encoding() == b.Encoding()
+		&& a.Face() == b.Face();
+}
+
+
+int32
+FontTable::SlotOf(const BFont& font, uint32 hash) const
+{
+	int32 i = hash & (fSize - 1);
+	while (fSlots[i] >= 0) {
+		const Entry* entry = fEntries.ItemAt(fSlots[i]);
+		if (entry->hash == hash && SameFont(entry->font, font))
+			break;
+		i = (i + 1) & (fSize - 1);
+	}
+	return i;
+}
+
+
+void
+FontTable::Grow()
+{
+	delete[] fSlots;
+	fSize = fSize == 0 ? 64 : 2 * fSize;
+	fSlots = new int32[fSize];
+	memset(fSlots, 0xff, fSize * sizeof(int32));
+
+	const int32 count = fEntries.CountItems();
+	for (int32 id = 0; id < count; id++) {
+		const Entry* entry = fEntries.ItemAt(id);
+		fSlots[SlotOf(entry->font, entry->hash)] = id;
+	}
+}
+
+
+int32
+FontTable::AdvanceSlotOf(uint64 key) const
+{
+	int32 i = hash_advance(key) & (fAdvanceSize - 1);
+	while (fAdvanceKeys[i] != kNoAdvance && fAdvanceKeys[i] != key)
+		i = (i + 1) & (fAdvanceSize - 1);
+	return i;
+}
+
+
+void
+FontTable::GrowAdvances()
+{
+	uint64* keys = fAdvanceKeys;
+	float* widths = fAdvanceWidths;
+	const int32 size = fAdvanceSize;
+
+	fAdvanceSize = size == 0 ? 1024 : 2 * size;
+	fAdvanceKeys = new uint64[fAdvanceSize];
+	fAdvanceWidths = new float[fAdvanceSize];
+	memset(fAdvanceKeys, 0xff, fAdvanceSize * sizeof(uint64));
+
+	for (int32 i = 0; i < size; i++) {
+		if (keys[i] == kNoAdvance)
+			continue;
+		const int32 slot = AdvanceSlotOf(keys[i]);
+		fAdvanceKeys[slot] = keys[i];
+		fAdvanceWidths[slot] = widths[i];
+	}
+	delete[] keys;
+	delete[] widths;
+}
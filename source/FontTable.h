@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+#ifndef FONT_TABLE_H
+#define FONT_TABLE_H
+
+#include <Font.h>
+#include <String.h>
+
+#include "PrintUtils.h"
+#include "UTF8Decoder.h"
+
+
+/*!	Interns the fonts of a job. Every distinct font gets a small id that
+	states, text segments and bookmarks carry instead of a BFont copy.
+	Metrics are computed once per font, advance widths once per font and
+	code point. Id 0 is the default font.
+*/
+class FontTable {
+public:
+	enum {
+		kDefaultFont = 0
+	};
+
+							FontTable();
+							~FontTable();
+
+			int32			Intern(const BFont& font);
+
+			const BFont&	FontAt(int32 id) const
+								{ return fEntries.ItemAt(id)->font; }
+			const font_height& Height(int32 id) const
+								{ return fEntries.ItemAt(id)->height; }
+			float			SpaceWidth(int32 id) const
+								{ return fEntries.ItemAt(id)->spaceWidth; }
+			// "family-style", the name PDFlib knows the font by
+			const char*		Name(int32 id) const
+								{ return fEntries.ItemAt(id)->name.String(); }
+
+			// whether text has been drawn in the font
+			bool			IsUsed(int32 id) const
+								{ return fEntries.ItemAt(id)->used; }
+			void			SetUsed(int32 id)
+								{ fEntries.ItemAt(id)->used = true; }
+
+			int32			UTF8Font(int32 id);
+
+			const float*	Advances(int32 id, const char* utf8,
+								const UTF8Decoder& decoder);
+
+			// PDF font handle for the MacRoman encoding, -1 if not known
+			int				PDFFont(int32 id) const
+								{ return fEntries.ItemAt(id)->pdfFont; }
+			void			SetPDFFont(int32 id, int font)
+								{ fEntries.ItemAt(id)->pdfFont = font; }
+
+			// whether the font file is embedded, -1 if not known
+			int8			Embed(int32 id) const
+								{ return fEntries.ItemAt(id)->embed; }
+			void			SetEmbed(int32 id, bool embed)
+								{ fEntries.ItemAt(id)->embed = embed; }
+
+private:
+	class Entry {
+	public:
+							Entry(const BFont& font, uint32 hash);
+
+			BFont			font;
+			uint32			hash;
+			font_height		height;
+			float			spaceWidth;
+			BString			name;
+			bool			used;
+			int32			utf8Font;
+			int				pdfFont;
+			int8			embed;
+	};
+
+	static	uint32			HashFont(const BFont& font);
+	static	bool			SameFont(const BFont& a, const BFont& b);
+			int32			SlotOf(const BFont& font, uint32 hash) const;
+			void			Grow();
+
+			int32			AdvanceSlotOf(uint64 key) const;
+			void			GrowAdvances();
+
+			TList<Entry>	fEntries;
+			int32*			fSlots;		// indices into fEntries or -1
+			int32			fSize;		// power of two
+
+			// advance widths keyed by font id and code point
+			uint64*			fAdvanceKeys;
+			float*			fAdvanceWidths;
+			int32			fAdvanceSize;	// power of two
+			int32			fAdvanceCount;
+
+			float*			fAdvances;		// returned by Advances()
+			int32			fAdvancesSize;
+};
+
+#endif	// FONT_TABLE_H
@@ -29,6 +29,8 @@ THE SOFTWARE.
 
 #include <stdio.h>
 #include <malloc.h>
+#include <time.h>
+#include <OS.h>
 #include <StorageKit.h>
 #include "Fonts.h"
 #include "Report.h"
@@ -94,13 +96,79 @@ static status_t ttf_get_fontname(const char * path, char * fontname, size_t fn_s
 static status_t psf_get_fontname(const char * path, char * fontname, size_t fn_size);
 
 
+// --------------------------------------------------
+static uint32
+hash_name(const char* name)
+{
+	// FNV-1a
+	uint32 hash = 2166136261U;
+	for (; *name != 0; name++)
+		hash = (hash ^ (uint8)*name) * 16777619U;
+	return hash;
+}
+
+
 // --------------------------------------------------
 Fonts::Fonts()
+	: fIndex(NULL)
+	, fIndexSize(0)
 {
 	SetDefaultCJKOrder();
 }
 
 
+// --------------------------------------------------
+Fonts::~Fonts()
+{
+	delete[] fIndex;
+}
+
+
+// --------------------------------------------------
+// Indexes the font files by name, the first file of a name is found.
+void
+Fonts::BuildIndex()
+{
+	delete[] fIndex;
+	const int32 n = Length();
+	// keep the load factor at or below one half
+	fIndexSize = 64;
+	while (fIndexSize < 2 * n)
+		fIndexSize *= 2;
+	fIndex = new FontFile*[fIndexSize];
+	memset(fIndex, 0, fIndexSize * sizeof(FontFile*));
+
+	for (int32 i = 0; i < n; i++) {
+		FontFile* f = At(i);
+		int32 slot = hash_name(f->Name()) & (fIndexSize - 1);
+		while (fIndex[slot] != NULL) {
+			if (strcmp(fIndex[slot]->Name(), f->Name()) == 0)
+				break;
+			slot = (slot + 1) & (fIndexSize - 1);
+		}
+		if (fIndex[slot] == NULL)
+			fIndex[slot] = f;
+	}
+}
+
+
+// --------------------------------------------------
+FontFile*
+Fonts::Find(const char* name) const
+{
+	if (fIndex == NULL)
+		return NULL;
+
+	int32 slot = hash_name(name) & (fIndexSize - 1);
+	while (fIndex[slot] != NULL) {
+		if (strcmp(fIndex[slot]->Name(), name) == 0)
+			return fIndex[slot];
+		slot = (slot + 1) & (fIndexSize - 1);
+	}
+	return NULL;
+}
+
+
 void
 Fonts::SetDefaultCJKOrder()
 {
@@ -143,6 +211,8 @@ Fonts::GetCJKOrder(int i, font_encoding& enc, bool& active) const
 
 // --------------------------------------------------
 Fonts::Fonts(BMessage *archive)
+	: fIndex(NULL)
+	, fIndexSize(0)
 {
 	BMessage m;
 	for (int i = 0; archive->FindMessage("fontfile", i, &m) == B_OK; i++) {
@@ -153,6 +223,7 @@ Fonts::Fonts(BMessage *archive)
 			else delete f;
 		}
 	}
+	BuildIndex();
 	if (archive->FindMessage("cjk_order", &m) == B_OK) {
 		for (int i = 0; i < no_of_cjk_encodings; i++) {
 			bool active; int32 encoding;
@@ -205,6 +276,250 @@ status_t Fonts::Archive(BMessage *archive, bool deep) const
 }
 
 
+// --------------------------------------------------
+// The fonts found in the font directories by the last CollectFonts(),
+// keyed by path, so that only new or modified files have to be parsed
+// and unmodified directories need not be read at all.
+class FontCatalog {
+public:
+	class File {
+	public:
+		BString   path;
+		int64     size;
+		int64     modified;
+		BString   name;
+		font_type type; // unknown_type if the file is not a font
+	};
+
+	class Directory {
+	public:
+		BString        path;
+		int64          modified;
+		TList<File>    files;
+		TList<BString> subdirectories;
+
+		Directory() : fIndex(NULL), fIndexSize(0) {}
+		~Directory() { delete[] fIndex; }
+
+		void  BuildIndex();
+		File* Find(const char* path) const;
+
+	private:
+		File** fIndex; // files by path, open addressing
+		int32  fIndexSize;
+	};
+
+	TList<Directory> directories;
+
+	FontCatalog() : fIndex(NULL), fIndexSize(0) {}
+	~FontCatalog() { delete[] fIndex; }
+
+	Directory* Find(const char* path) const;
+	void       Load();
+	void       Save() const;
+
+private:
+	enum { kVersion = 1 };
+
+	void BuildIndex();
+
+	Directory** fIndex; // directories by path, open addressing
+	int32       fIndexSize;
+
+	static status_t GetPath(BPath &path);
+};
+
+
+// --------------------------------------------------
+// Indexes the files by path, Find() only works after this.
+void
+FontCatalog::Directory::BuildIndex()
+{
+	delete[] fIndex;
+	const int32 n = files.CountItems();
+	// keep the load factor at or below one half
+	fIndexSize = 16;
+	while (fIndexSize < 2 * n)
+		fIndexSize *= 2;
+	fIndex = new File*[fIndexSize];
+	memset(fIndex, 0, fIndexSize * sizeof(File*));
+
+	for (int32 i = 0; i < n; i++) {
+		File* file = files.ItemAt(i);
+		int32 slot = hash_name(file->path.String()) & (fIndexSize - 1);
+		while (fIndex[slot] != NULL
+			&& fIndex[slot]->path != file->path.String())
+			slot = (slot + 1) & (fIndexSize - 1);
+		if (fIndex[slot] == NULL)
+			fIndex[slot] = file;
+	}
+}
+
+
+// --------------------------------------------------
+FontCatalog::File*
+FontCatalog::Directory::Find(const char* path) const
+{
+	if (fIndex == NULL)
+		return NULL;
+
+	int32 slot = hash_name(path) & (fIndexSize - 1);
+	while (fIndex[slot] != NULL) {
+		if (fIndex[slot]->path == path)
+			return fIndex[slot];
+		slot = (slot + 1) & (fIndexSize - 1);
+	}
+	return NULL;
+}
+
+
+// --------------------------------------------------
+// Indexes the directories and their files by path.
+void
+FontCatalog::BuildIndex()
+{
+	delete[] fIndex;
+	const int32 n = directories.CountItems();
+	// keep the load factor at or below one half
+	fIndexSize = 16;
+	while (fIndexSize < 2 * n)
+		fIndexSize *= 2;
+	fIndex = new Directory*[fIndexSize];
+	memset(fIndex, 0, fIndexSize * sizeof(Directory*));
+
+	for (int32 i = 0; i < n; i++) {
+		Directory* directory = directories.ItemAt(i);
+		directory->BuildIndex();
+		int32 slot = hash_name(directory->path.String()) & (fIndexSize - 1);
+		while (fIndex[slot] != NULL
+			&& fIndex[slot]->path != directory->path.String())
+			slot = (slot + 1) & (fIndexSize - 1);
+		if (fIndex[slot] == NULL)
+			fIndex[slot] = directory;
+	}
+}
+
+
+// --------------------------------------------------
+FontCatalog::Directory*
+FontCatalog::Find(const char* path) const
+{
+	if (fIndex == NULL)
+		return NULL;
+
+	int32 slot = hash_name(path) & (fIndexSize - 1);
+	while (fIndex[slot] != NULL) {
+		if (fIndex[slot]->path == path)
+			return fIndex[slot];
+		slot = (slot + 1) & (fIndexSize - 1);
+	}
+	return NULL;
+}
+
+
+// --------------------------------------------------
+status_t
+FontCatalog::GetPath(BPath &path)
+{
+	status_t status = find_directory(B_USER_SETTINGS_DIRECTORY, &path);
+	if (status != B_OK)
+		return status;
+	path.Append("PDF Writer");
+	create_directory(path.Path(), 0755);
+	return path.Append("font_catalog");
+}
+
+
+// --------------------------------------------------
+void
+FontCatalog::Load()
+{
+	BPath path;
+	if (GetPath(path) != B_OK)
+		return;
+
+	BFile file(path.Path(), B_READ_ONLY);
+	BMessage catalog;
+	int32 version;
+	if (file.InitCheck() != B_OK || catalog.Unflatten(&file) != B_OK
+		|| catalog.FindInt32("version", &version) != B_OK
+		|| version != kVersion)
+		return;
+
+	BMessage m;
+	for (int32 i = 0; catalog.FindMessage("directory", i, &m) == B_OK; i++) {
+		Directory* directory = new Directory();
+		m.FindString("path", &directory->path);
+		m.FindInt64("modified", &directory->modified);
+
+		BString subdirectory;
+		for (int32 j = 0; m.FindString("subdirectory", j, &subdirectory) == B_OK;
+				j++) {
+			directory->subdirectories.AddItem(new BString(subdirectory));
+		}
+
+		File f;
+		int8 type;
+		for (int32 j = 0; m.FindString("file_path", j, &f.path) == B_OK; j++) {
+			if (m.FindInt64("file_size", j, &f.size) != B_OK
+				|| m.FindInt64("file_modified", j, &f.modified) != B_OK
+				|| m.FindString("file_name", j, &f.name) != B_OK
+				|| m.FindInt8("file_type", j, &type) != B_OK)
+				break;
+			f.type = (font_type)type;
+			directory->files.AddItem(new File(f));
+		}
+		directories.AddItem(directory);
+	}
+	BuildIndex();
+}
+
+
+// --------------------------------------------------
+void
+FontCatalog::Save() const
+{
+	BPath path;
+	if (GetPath(path) != B_OK)
+		return;
+
+	BMessage catalog;
+	catalog.AddInt32("version", kVersion);
+	const int32 n = directories.CountItems();
+	for (int32 i = 0; i < n; i++) {
+		const Directory* directory = directories.ItemAt(i);
+		BMessage m;
+		m.AddString("path", directory->path);
+		m.AddInt64("modified", directory->modified);
+		for (int32 j = 0; j < directory->subdirectories.CountItems(); j++)
+			m.AddString("subdirectory", *directory->subdirectories.ItemAt(j));
+		for (int32 j = 0; j < directory->files.CountItems(); j++) {
+			const File* f = directory->files.ItemAt(j);
+			m.AddString("file_path", f->path);
+			m.AddInt64("file_size", f->size);
+			m.AddInt64("file_modified", f->modified);
+			m.AddString("file_name", f->name);
+			m.AddInt8("file_type", (int8)f->type);
+		}
+		catalog.AddMessage("directory", &m);
+	}
+
+	// Replace the catalog at once, another job might read it meanwhile.
+	// Thread ids are unique system wide, so concurrent writers do not
+	// share the temporary file.
+	BString temporary(path.Path());
+	temporary << "~" << find_thread(NULL);
+	BFile file(temporary.String(), B_WRITE_ONLY | B_CREATE_FILE | B_ERASE_FILE);
+	if (file.InitCheck() != B_OK)
+		return;
+
+	BEntry entry(temporary.String());
+	if (catalog.Flatten(&file) != B_OK
+		|| entry.Rename(path.Leaf(), true) != B_OK)
+		entry.Remove();
+}
+
+
 // --------------------------------------------------
 status_t 
 Fonts::CollectFonts()
@@ -219,28 +534,70 @@ Fonts::CollectFonts()
 		(directory_which) -1
 	};
 
+	FontCatalog catalog;
+	FontCatalog updated;
+	catalog.Load();
+
+	bool modified = false;
 	which_dir = lookup_dirs;
 	while (*which_dir >= 0) {
 		if ( find_directory(*which_dir, &path) == B_OK )
-			LookupFontFiles(path);
+			LookupFontFiles(path, catalog, updated, modified);
 
 		which_dir++;
 	};
-		
+
+	if (modified || updated.directories.CountItems()
+			!= catalog.directories.CountItems())
+		updated.Save();
+
+	BuildIndex();
 	return B_OK;
 }
 
 
 // --------------------------------------------------
+// Adds the fonts in path and its sub-directories. A directory that has
+// not been modified since the catalog was saved is taken from the
+// catalog, otherwise only its new or modified files are parsed.
 status_t
-Fonts::LookupFontFiles(BPath path)
+Fonts::LookupFontFiles(BPath path, const FontCatalog &catalog,
+	FontCatalog &updated, bool &modified)
 {
 	BDirectory 	dir(path.Path());
 	BEntry 		entry;
+	time_t		mtime;
 
-	if (dir.InitCheck() != B_OK)
+	if (dir.InitCheck() != B_OK || dir.GetModificationTime(&mtime) != B_OK)
 		return B_ERROR;
 
+	const FontCatalog::Directory* cached = catalog.Find(path.Path());
+	FontCatalog::Directory* directory = new FontCatalog::Directory();
+	directory->path = path.Path();
+	// a directory modified within this second might change again
+	// unnoticed, read it again next time
+	directory->modified = mtime < time(NULL) ? mtime : -1;
+	updated.directories.AddItem(directory);
+
+	if (cached != NULL && cached->modified == mtime) {
+		for (int32 i = 0; i < cached->files.CountItems(); i++) {
+			const FontCatalog::File* f = cached->files.ItemAt(i);
+			directory->files.AddItem(new FontCatalog::File(*f));
+			if (f->type != unknown_type) {
+				fFontFiles.AddItem(new FontFile(f->name.String(),
+					f->path.String(), f->size, f->type, f->size < 100*1024));
+			}
+		}
+		for (int32 i = 0; i < cached->subdirectories.CountItems(); i++) {
+			const BString* subdirectory = cached->subdirectories.ItemAt(i);
+			directory->subdirectories.AddItem(new BString(*subdirectory));
+			LookupFontFiles(BPath(subdirectory->String()), catalog, updated,
+				modified);
+		}
+		return B_OK;
+	}
+	modified = true;
+
 	dir.Rewind();
 	while (dir.GetNextEntry(&entry) >= 0) {
 		BPath 		name;
@@ -250,34 +607,55 @@ Fonts::LookupFontFiles(BPath path)
 		status_t	status;
 		
 		entry.GetPath(&name);
-		if (entry.IsDirectory())
+		if (entry.IsDirectory()) {
 			// recursivly lookup in sub-directories...
-			LookupFontFiles(name);
+			directory->subdirectories.AddItem(new BString(name.Path()));
+			LookupFontFiles(name, catalog, updated, modified);
+		}
 
 		if (! entry.IsFile())
 			continue;
 
+		if (entry.GetSize(&size) != B_OK)
+			size = 1024*1024*1024;
+		if (entry.GetModificationTime(&mtime) != B_OK)
+			mtime = 0;
+
 		fn[0] = 0;
 		ft = unknown_type;
-				
-		// is it a truetype file?
-		status = ttf_get_fontname(name.Path(), fn, sizeof(fn));
-		if (status == B_OK ) {
-			ft = true_type_type;
+
+		const FontCatalog::File* known = cached != NULL
+			? cached->Find(name.Path()) : NULL;
+		if (known != NULL && known->size == size && known->modified == mtime) {
+			strncpy(fn, known->name.String(), sizeof(fn));
+			fn[sizeof(fn) - 1] = 0;
+			ft = known->type;
 		} else {
-			// okay, maybe it's a postscript type file?
-			status = psf_get_fontname(name.Path(), fn, sizeof(fn));
-			if (status == B_OK) {
-				ft = type1_type;
+			// is it a truetype file?
+			status = ttf_get_fontname(name.Path(), fn, sizeof(fn));
+			if (status == B_OK ) {
+				ft = true_type_type;
+			} else {
+				// okay, maybe it's a postscript type file?
+				status = psf_get_fontname(name.Path(), fn, sizeof(fn));
+				if (status == B_OK) {
+					ft = type1_type;
+				}
 			}
-		} 
+		}
+
+		// remember files that are not fonts too, to not parse them again
+		FontCatalog::File* f = new FontCatalog::File();
+		f->path = name.Path();
+		f->size = size;
+		f->modified = mtime;
+		f->name = fn;
+		f->type = ft;
+		directory->files.AddItem(f);
 
 		if (ft == unknown_type)
 			// not a font file...
 			continue;
-										
-		if (entry.GetSize(&size) != B_OK)
-			size = 1024*1024*1024;
 		
 		REPORT(kDebug, -1, "Installed font %s -> %s", fn, name.Path());			
 		fFontFiles.AddItem(new FontFile(fn, name.Path(), size, ft, size < 100*1024));
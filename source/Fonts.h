@@ -105,20 +105,29 @@ public:
 };
 
 
+class FontCatalog;
+
 class Fonts : public BArchivable {
 private:
 	TList<FontFile>  fFontFiles;
 
+	// open addressing hash table of fFontFiles by name, see BuildIndex()
+	FontFile**       fIndex;
+	int32            fIndexSize; // power of two
+
 	struct {
 		font_encoding encoding;
 		bool          active;
 	} fCJKOrder[no_of_cjk_encodings];
 
-	status_t	LookupFontFiles(BPath path);	
+	status_t	LookupFontFiles(BPath path, const FontCatalog &catalog,
+					FontCatalog &updated, bool &modified);
+	void        BuildIndex();
 
 public:
 	Fonts();
 	Fonts(BMessage *archive);
+	~Fonts();
 	
 	static BArchivable* Instantiate(BMessage *archive);
 	status_t Archive(BMessage *archive, bool deep = true) const;
@@ -128,6 +137,7 @@ public:
 
 	FontFile*	At(int i) const { return fFontFiles.ItemAt(i); }
 	int32		Length() const  { return fFontFiles.CountItems(); }
+	FontFile*   Find(const char* name) const;
 
 	void        SetDefaultCJKOrder();
 	bool        SetCJKOrder(int i, font_encoding  enc, bool  active);
@@ -27,6 +27,8 @@ THE SOFTWARE.
 
 */
 
+#include <setjmp.h>
+#include <stdio.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <File.h>
@@ -40,13 +42,22 @@ THE SOFTWARE.
 #include "Report.h"
 #include "Image.h"
 #include "ImageCache.h"
+#include "PNGWriter.h"
+
+extern "C" {
+#include <jpeglib.h>
+}
 
 // Implementation of ImageDescription
 
-ImageDescription::ImageDescription(PDF* pdf, BBitmap* bitmap, int mask)
+ImageDescription::ImageDescription(PDF* pdf, BBitmap* bitmap, int mask, const rgb_color* palette, int32 paletteSize, int jpegQuality, int compression)
 	: fPDF(pdf)
 	, fBitmap(bitmap)
 	, fMask(mask)
+	, fPalette(palette)
+	, fPaletteSize(paletteSize)
+	, fJPEGQuality(jpegQuality)
+	, fCompression(compression)
 {
 	bitmap->Lock();
 	fWidth = bitmap->Bounds().IntegerWidth()+1;
@@ -70,9 +81,11 @@ Image* ImageDescription::Store(PDF* pdf, int id, BBitmap* bitmap, int mask) {
 	int w, h;
 	color_space cs;
 
+	const bool jpeg = fJPEGQuality > 0;
+
 	fileName << id;
 	pdfFileName = fileName;
-	pdfFileName << ".png";
+	pdfFileName << (jpeg ? ".jpg" : ".png");
 
 	bitmap->Lock();
 	w = bitmap->Bounds().IntegerWidth()+1;
@@ -85,7 +98,13 @@ Image* ImageDescription::Store(PDF* pdf, int id, BBitmap* bitmap, int mask) {
 #else
 	fileName << ".png";
 #endif
-	if (!StorePNG(pdfFileName.String(), bitmap)) {
+	if (jpeg) {
+		if (!StoreJPEG(pdfFileName.String(), bitmap, fJPEGQuality)) {
+			REPORT(kError, -1, "Image cache could not store image as JPEG file.");
+			unlink(pdfFileName.String());
+			return NULL;
+		}
+	} else if (!StorePNG(pdfFileName.String(), bitmap)) {
 		REPORT(kError, -1, "Image cache could not store image as PNG file.");
 		return NULL;
 	}
@@ -97,7 +116,7 @@ Image* ImageDescription::Store(PDF* pdf, int id, BBitmap* bitmap, int mask) {
 	}
 
 	int image;
-	image = PDF_open_image_file(pdf, "png", pdfFileName.String(),
+	image = PDF_open_image_file(pdf, jpeg ? "jpeg" : "png", pdfFileName.String(),
 		mask == -1 ? "" : "masked", mask == -1 ? 0 : mask);
 
 #if STORE_AS_BBITMAP
@@ -109,20 +128,96 @@ Image* ImageDescription::Store(PDF* pdf, int id, BBitmap* bitmap, int mask) {
 		return NULL;
 	}
 
-	return new Image(pdf, image, fileName.String(), w, h, cs, mask);
+	return new Image(pdf, image, fileName.String(), w, h, cs, mask, fPalette, fPaletteSize, fJPEGQuality);
 }
 
+// Writes the bitmap at its own depth: B_GRAY8 and B_GRAY1 as gray scale,
+// B_CMAP8 as indexed image and B_RGB32 as RGB image.
 bool ImageDescription::StorePNG(const char* fileName, BBitmap* bitmap) {
-	bool ok = true;
-	BTranslatorRoster *roster = BTranslatorRoster::Default();
-	BBitmapStream stream(bitmap); // init with contents of bitmap
-	BFile file(fileName, B_CREATE_FILE | B_WRITE_ONLY | B_ERASE_FILE);
-	ok = roster->Translate(&stream, NULL, NULL, &file, B_PNG_FORMAT) == B_OK;
-	BBitmap *bm = NULL; stream.DetachBitmap(&bm); // otherwise bitmap destructor crashes here!
-	ASSERT(bm == bitmap);
+	int colorType;
+	int bitDepth;
+	if (!PNGWriter::FormatFor(bitmap->ColorSpace(), fPaletteSize, &colorType, &bitDepth)
+		|| (colorType == PNGWriter::kIndexed && fPalette == NULL)) return false;
+
+	bitmap->Lock();
+	const int width = bitmap->Bounds().IntegerWidth()+1;
+	const int height = bitmap->Bounds().IntegerHeight()+1;
+
+	PNGWriter png;
+	bool ok = png.Begin(fileName, width, height, colorType, bitDepth,
+		fPalette, fPaletteSize, fCompression) == B_OK &&
+		png.WriteBitmap(bitmap) == B_OK &&
+		png.End() == B_OK;
+
+	bitmap->Unlock();
 	return ok;
 }
 
+// libjpeg calls exit() on errors by default, jump back to StoreJPEG instead
+struct jpeg_error_handler {
+	struct jpeg_error_mgr pub;
+	jmp_buf               setjmp_buffer;
+};
+
+static void jpeg_error_exit(j_common_ptr cinfo) {
+	jpeg_error_handler* handler = (jpeg_error_handler*)cinfo->err;
+	longjmp(handler->setjmp_buffer, 1);
+}
+
+bool ImageDescription::StoreJPEG(const char* fileName, BBitmap* bitmap, int quality) {
+	FILE* file = fopen(fileName, "wb");
+	if (file == NULL) return false;
+
+	bitmap->Lock();
+	const int width = bitmap->Bounds().IntegerWidth()+1;
+	const int height = bitmap->Bounds().IntegerHeight()+1;
+	const int32 bytesPerRow = bitmap->BytesPerRow();
+	const uint8* bits = (const uint8*)bitmap->Bits();
+
+	// B_RGB32 is stored as BGRA, libjpeg expects packed RGB
+	JSAMPLE* row = new JSAMPLE[width * 3];
+
+	struct jpeg_compress_struct cinfo;
+	jpeg_error_handler jerr;
+	cinfo.err = jpeg_std_error(&jerr.pub);
+	jerr.pub.error_exit = jpeg_error_exit;
+
+	if (setjmp(jerr.setjmp_buffer)) {
+		jpeg_destroy_compress(&cinfo);
+		delete[] row;
+		bitmap->Unlock();
+		fclose(file);
+		return false;
+	}
+
+	jpeg_create_compress(&cinfo);
+	jpeg_stdio_dest(&cinfo, file);
+	cinfo.image_width = width;
+	cinfo.image_height = height;
+	cinfo.input_components = 3;
+	cinfo.in_color_space = JCS_RGB;
+	jpeg_set_defaults(&cinfo);
+	jpeg_set_quality(&cinfo, quality, TRUE);
+	jpeg_start_compress(&cinfo, TRUE);
+
+	while (cinfo.next_scanline < cinfo.image_height) {
+		const uint8* in = bits + cinfo.next_scanline * bytesPerRow;
+		JSAMPLE* out = row;
+		for (int x = 0; x < width; x ++, in += 4, out += 3) {
+			out[0] = in[2];
+			out[1] = in[1];
+			out[2] = in[0];
+		}
+		jpeg_write_scanlines(&cinfo, &row, 1);
+	}
+
+	jpeg_finish_compress(&cinfo);
+	jpeg_destroy_compress(&cinfo);
+	delete[] row;
+	bitmap->Unlock();
+	return fclose(file) == 0;
+}
+
 bool ImageDescription::StoreBitmap(const char* fileName, BBitmap* bitmap) {
 	bool ok = true;
 #if STORE_AS_BBITMAP
@@ -135,7 +230,7 @@ bool ImageDescription::StoreBitmap(const char* fileName, BBitmap* bitmap) {
 
 // Implementation of Image
 
-Image::Image(PDF* pdf, int imageID, const char* fileName, int width, int height, color_space colorSpace, int mask)
+Image::Image(PDF* pdf, int imageID, const char* fileName, int width, int height, color_space colorSpace, int mask, const rgb_color* palette, int32 paletteSize, int jpegQuality)
 	: fPDF(pdf)
 	, fImageID(imageID)
 	, fFileName(fileName)
@@ -143,12 +238,20 @@ Image::Image(PDF* pdf, int imageID, const char* fileName, int width, int height,
 	, fHeight(height)
 	, fColorSpace(colorSpace)
 	, fMask(mask)
+	, fPalette(NULL)
+	, fPaletteSize(palette != NULL ? paletteSize : 0)
+	, fJPEGQuality(jpegQuality)
 {
+	if (fPaletteSize > 0) {
+		fPalette = new rgb_color[fPaletteSize];
+		memcpy(fPalette, palette, fPaletteSize * sizeof(rgb_color));
+	}
 }
 
 Image::~Image() {
 	PDF_close_image(fPDF, ImageID());
 	unlink(FileName());
+	delete[] fPalette;
 }
 
 bool Image::Equals(CIDescription* description) const {
@@ -157,7 +260,11 @@ bool Image::Equals(CIDescription* description) const {
 	ASSERT(desc != NULL);
 	if (desc->Width() != Width() || desc->Height() != Height() ||
 		desc->ColorSpace() != ColorSpace() ||
-		desc->Mask() != Mask()) return false;
+		desc->Mask() != Mask() ||
+		desc->JPEGQuality() != JPEGQuality()) return false;
+	if (desc->Palette() == NULL ? PaletteSize() != 0 :
+		desc->PaletteSize() != PaletteSize() ||
+		memcmp(desc->Palette(), Palette(), PaletteSize() * sizeof(rgb_color)) != 0) return false;
 	return Equals(desc->Bitmap());
 }
 
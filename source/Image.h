@@ -41,7 +41,9 @@ class Image;
 
 class ImageDescription : public CIDescription {
 public:
-	ImageDescription(PDF* pdf, BBitmap* bitmap, int mask);
+	ImageDescription(PDF* pdf, BBitmap* bitmap, int mask,
+		const rgb_color* palette = NULL, int32 paletteSize = 0,
+		int jpegQuality = 0, int compression = -1);
 
 	CacheItem* NewItem(int id);
 
@@ -50,22 +52,30 @@ public:
 	int Height() const { return fHeight; }
 	color_space ColorSpace() const { return fColorSpace; }
 	int Mask() const { return fMask; }
+	const rgb_color* Palette() const { return fPalette; }
+	int32 PaletteSize() const { return fPaletteSize; }
+	int JPEGQuality() const { return fJPEGQuality; }
 	
 private:
 	Image* Store(PDF* pdf, int id, BBitmap* bitmap, int mask);
 	bool StoreBitmap(const char* fileName, BBitmap* bitmap);
 	bool StorePNG(const char* fileName, BBitmap* bitmap);
+	bool StoreJPEG(const char* fileName, BBitmap* bitmap, int quality);
 
 	PDF*        fPDF;
 	BBitmap*    fBitmap;
 	int         fWidth, fHeight;
 	color_space fColorSpace;
 	int         fMask;
+	const rgb_color* fPalette; // B_CMAP8 only
+	int32       fPaletteSize;
+	int         fJPEGQuality; // 0 = lossless (PNG)
+	int         fCompression; // zlib level of the PNG data
 };
 
 class Image : public CacheItem {
 public:
-	Image(PDF* pdf, int imageID, const char* fileName, int width, int height, color_space colorSpace, int mask);
+	Image(PDF* pdf, int imageID, const char* fileName, int width, int height, color_space colorSpace, int mask, const rgb_color* palette, int32 paletteSize, int jpegQuality);
 	~Image();
 	
 	int ImageID() const { return fImageID; };
@@ -74,6 +84,9 @@ public:
 	int Height() const { return fHeight; };	
 	color_space ColorSpace() const { return fColorSpace; };
 	int Mask() const { return fMask; };
+	const rgb_color* Palette() const { return fPalette; };
+	int32 PaletteSize() const { return fPaletteSize; };
+	int JPEGQuality() const { return fJPEGQuality; };
 	bool Equals(CIDescription* desc) const;
 	bool Equals(BBitmap* bitmap) const;
 
@@ -84,6 +97,9 @@ private:
 	int         fWidth, fHeight;
 	color_space fColorSpace;
 	int         fMask;
+	rgb_color*  fPalette;
+	int32       fPaletteSize;
+	int         fJPEGQuality;
 };
 
 
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include "ImageAnalyzer.h"
+
+#include <string.h>
+
+
+static inline uint32
+hash_color(uint32 color)
+{
+	// the upper 9 bits of the product index the 512 slots
+	return (uint32)(color * 2654435761U) >> 23;
+}
+
+
+ImageAnalyzer::ImageAnalyzer()
+	:
+	fGray(true),
+	fBilevel(true),
+	fIndexed(true),
+	fPrevious(kEmpty),
+	fCount(0)
+{
+	memset(fKeys, 0xff, sizeof(fKeys));
+}
+
+
+/*!	Analyzes a row of B_RGB32 pixels. Only the color is taken into
+	account, transparency is handled by the image mask.
+*/
+void
+ImageAnalyzer::AnalyzeRow(const uint32* row, int32 width)
+{
+	if (IsFullColor())
+		return;
+
+	for (int32 x = 0; x < width; x++) {
+		const uint32 color = row[x] & 0x00ffffff;
+		if (color == fPrevious)
+			continue;
+		fPrevious = color;
+
+		if (fGray) {
+			const uint8 gray = color & 0xff;
+			if (color != gray * 0x010101U)
+				fGray = fBilevel = false;
+			else if (gray != 0 && gray != 255)
+				fBilevel = false;
+		}
+		if (fIndexed && !Insert(color))
+			fIndexed = false;
+
+		if (IsFullColor())
+			return;
+	}
+}
+
+
+/*!	Returns the smallest color space that holds the image without loss.
+	Images of a single color always become B_CMAP8 with a palette of
+	one entry, which makes them easy to spot.
+*/
+color_space
+ImageAnalyzer::ReducedColorSpace() const
+{
+	if (fIndexed && fCount == 1)
+		return B_CMAP8;
+	if (fBilevel)
+		return B_GRAY1;
+	if (fGray)
+		return B_GRAY8;
+	if (fIndexed)
+		return B_CMAP8;
+	return B_RGB32;
+}
+
+
+/*!	Returns a copy of the analyzed B_RGB32 \a bitmap in the reduced
+	color space, or NULL if it cannot be reduced. A B_CMAP8 result
+	refers to Palette() rather than to the system palette.
+*/
+BBitmap*
+ImageAnalyzer::Reduce(BBitmap* bitmap)
+{
+	const color_space colorSpace = ReducedColorSpace();
+	if (colorSpace == B_RGB32)
+		return NULL;
+
+	BBitmap* reduced = new BBitmap(bitmap->Bounds(), colorSpace);
+	if (!reduced->IsValid()) {
+		delete reduced;
+		return NULL;
+	}
+
+	// keep the row padding defined, Image::Equals() compares it
+	memset(reduced->Bits(), 0, reduced->BitsLength());
+
+	const int32 width = bitmap->Bounds().IntegerWidth() + 1;
+	const int32 height = bitmap->Bounds().IntegerHeight() + 1;
+	const uint8* inRow = (const uint8*)bitmap->Bits();
+	uint8* out = (uint8*)reduced->Bits();
+	for (int32 y = 0; y < height; y++) {
+		const uint32* in = (const uint32*)inRow;
+		switch (colorSpace) {
+			case B_GRAY1:
+				// a set bit is black
+				for (int32 x = 0; x < width; x++) {
+					if ((in[x] & 0xff) == 0)
+						out[x >> 3] |= 0x80 >> (x & 7);
+				}
+				break;
+			case B_GRAY8:
+				for (int32 x = 0; x < width; x++)
+					out[x] = in[x] & 0xff;
+				break;
+			default:
+			{
+				uint32 previous = kEmpty;
+				uint8 index = 0;
+				for (int32 x = 0; x < width; x++) {
+					const uint32 color = in[x] & 0x00ffffff;
+					if (color != previous) {
+						previous = color;
+						index = IndexOf(color);
+					}
+					out[x] = index;
+				}
+				break;
+			}
+		}
+		inRow += bitmap->BytesPerRow();
+		out += reduced->BytesPerRow();
+	}
+	return reduced;
+}
+
+
+//! Adds \a color to the palette, returns false if the palette is full.
+bool
+ImageAnalyzer::Insert(uint32 color)
+{
+	uint32 i = hash_color(color);
+	while (fKeys[i] != kEmpty) {
+		if (fKeys[i] == color)
+			return true;
+		i = (i + 1) & (kHashSize - 1);
+	}
+	if (fCount == kMaxColors)
+		return false;
+
+	fKeys[i] = color;
+	fIndices[i] = fCount;
+	rgb_color& entry = fPalette[fCount++];
+	entry.red = color >> 16;
+	entry.green = color >> 8;
+	entry.blue = color;
+	entry.alpha = 255;
+	return true;
+}
+
+
+uint8
+ImageAnalyzer::IndexOf(uint32 color) const
+{
+	uint32 i = hash_color(color);
+	while (fKeys[i] != color)
+		i = (i + 1) & (kHashSize - 1);
+	return fIndices[i];
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+#ifndef IMAGE_ANALYZER_H
+#define IMAGE_ANALYZER_H
+
+#include <Bitmap.h>
+#include <InterfaceDefs.h>
+
+
+/*!	Collects the colors of a B_RGB32 image while it is being converted
+	and tells whether it can be stored as 1-bit, gray scale or indexed
+	image instead. The analysis stops as soon as the image turns out to
+	be neither gray nor limited to 256 colors.
+*/
+class ImageAnalyzer {
+public:
+						ImageAnalyzer();
+
+	void				AnalyzeRow(const uint32* row, int32 width);
+
+	bool				IsFullColor() const
+							{ return !fGray && !fIndexed; }
+	color_space			ReducedColorSpace() const;
+
+	const rgb_color*	Palette() const { return fPalette; }
+	int32				PaletteSize() const { return fCount; }
+
+	BBitmap*			Reduce(BBitmap* bitmap);
+
+private:
+	bool				Insert(uint32 color);
+	uint8				IndexOf(uint32 color) const;
+
+	enum {
+		kMaxColors = 256,
+		kHashSize = 2 * kMaxColors,
+		kEmpty = 0xffffffff
+	};
+
+	bool				fGray;
+	bool				fBilevel;
+	bool				fIndexed;
+	uint32				fPrevious;
+	int32				fCount;
+	uint32				fKeys[kHashSize];
+	uint8				fIndices[kHashSize];
+	rgb_color			fPalette[kMaxColors];
+};
+
+#endif	// IMAGE_ANALYZER_H
@@ -35,6 +35,7 @@ THE SOFTWARE.
 #include "ImageCache.h"
 #include "Image.h"
 #include "Mask.h"
+#include "StreamedImage.h"
 
 const char* kTemporaryPath =   "/tmp/PDFWriter";
 const char* kCachePath =  NULL;
@@ -44,6 +45,7 @@ const char* kMaskPathPrefix = NULL;
 // Implementation of ImageCache
 
 ImageCache::ImageCache() 
+	: fCompression(-1)
 {
 	BString path(kTemporaryPath);
 	path << "/Cache" << (int)find_thread(NULL);
@@ -67,15 +69,17 @@ ImageCache::~ImageCache() {
 void ImageCache::Flush() {
 	fImageCache.MakeEmpty();
 	fMaskCache.MakeEmpty();
+	fStreamCache.MakeEmpty();
 }
 
 void ImageCache::NextPass() {
 	fImageCache.NextPass();
 	fMaskCache.NextPass();
+	fStreamCache.NextPass();
 }
 
-int ImageCache::GetImage(PDF* pdf, BBitmap* bitmap, int mask) {
-	ImageDescription desc(pdf, bitmap, mask);
+int ImageCache::GetImage(PDF* pdf, BBitmap* bitmap, int mask, const rgb_color* palette, int32 paletteSize, int jpegQuality) {
+	ImageDescription desc(pdf, bitmap, mask, palette, paletteSize, jpegQuality, fCompression);
 	CacheItem* item = fImageCache.Find(&desc);
 	Image* image = dynamic_cast<Image*>(item);
 	if (image) {
@@ -96,4 +100,17 @@ int ImageCache::GetMask(PDF* pdf, const char* mask, int length, int width, int h
 	return -1;
 }
 
-
+// The image is only converted when it is stored in the first pass,
+// in the second pass the item is looked up by its sequence number.
+int ImageCache::GetStreamedImage(PDF* pdf, BandedImage* image, int* mask) {
+	StreamedImageDescription desc(pdf, image);
+	CacheItem* item = fStreamCache.Find(&desc);
+	StreamedImage* streamed = dynamic_cast<StreamedImage*>(item);
+	if (streamed) {
+		*mask = streamed->MaskID();
+		return streamed->ImageID();
+	}
+	REPORT(kError, -1, "Image cache could not find image. Please make sure to have enough disk space available.");
+	*mask = -1;
+	return -1;
+}
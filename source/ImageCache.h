@@ -45,6 +45,8 @@ extern const char* kMaskPathPrefix;
 
 #define STORE_AS_BBITMAP 1
 
+class BandedImage;
+
 class ImageCache {
 public:
 	ImageCache();
@@ -52,12 +54,17 @@ public:
 	void Flush();
 	
 	void NextPass();
-	int GetImage(PDF* pdf, BBitmap* bitmap, int mask);
+	void SetCompression(int level) { fCompression = level; }
+	int Compression() const { return fCompression; }
+	int GetImage(PDF* pdf, BBitmap* bitmap, int mask, const rgb_color* palette = NULL, int32 paletteSize = 0, int jpegQuality = 0);
 	int GetMask(PDF* pdf, const char* mask, int length, int width, int height, int bpc);
+	int GetStreamedImage(PDF* pdf, BandedImage* image, int* mask);
 
 private:
 	Cache fImageCache;
 	Cache fMaskCache;
+	Cache fStreamCache;
+	int   fCompression;
 };
 
 #endif
@@ -34,6 +34,7 @@ THE SOFTWARE.
 #include "Bookmark.h"
 #include "PDFSystem.h"
 #include "PDFWriter.h"
+#include "UTF8Decoder.h"
 #include "Log.h"
 #include "Report.h"
 
@@ -290,13 +291,13 @@ WebLink::WebLink(PDFWriter* writer, BString* utf8)
 
 // TextSegment
 
-TextSegment::TextSegment(const char* text, BPoint start, float escpSpace, float escpNoSpace, BRect* bounds, BFont* font, PDFSystem* system)
+TextSegment::TextSegment(const char* text, BPoint start, float escpSpace, float escpNoSpace, BRect* bounds, int32 fontId, PDFSystem* system)
 	: fText(text)
 	, fStart(start)
 	, fEscpSpace(escpSpace)
 	, fEscpNoSpace(escpNoSpace)
 	, fBounds(*bounds)
-	, fFont(*font)
+	, fFontId(fontId)
 	, fSystem(*system)
 	, fSpaces(0)
 {
@@ -322,7 +323,7 @@ TextLine::TextLine(PDFWriter* writer)
 
 void TextLine::Add(TextSegment* segment) {
 	// simply skip rotated text
-	if (segment->Font()->Rotation() != 0.0) {
+	if (fWriter->fFontTable.FontAt(segment->FontId()).Rotation() != 0.0) {
 		delete segment; return;
 	}
 
@@ -346,7 +347,7 @@ bool TextLine::Follows(TextSegment* segment) const {
 	// follows the new segment the latest one?	
 	BPoint start = segment->Start();
 	BRect  b = s->Bounds();
-	float w = segment->Font()->StringWidth(" ", 1);
+	float w = fWriter->fFontTable.SpaceWidth(segment->FontId());
 	if (b.top <= start.y && start.y <= b.bottom && (b.right-w/2.0) <= start.x) {
 		// insert spaces
 		if (w > 0.0) {
@@ -375,32 +376,34 @@ bool TextLine::BoundingBox(int startPos, int endPos, BRect* bounds) {
 	const char* pStart = &c[startPos];
 	const char* pEnd = &c[endPos];	 
 
+	UTF8Decoder decoder;
 	for (int32 i = 0; i < n; i ++) {
 	
 		TextSegment* seg         = fSegments.ItemAt(i);
 		BPoint       pos         = seg->Start();
-		BFont*       font        = seg->Font();
+		const font_height& height = fWriter->fFontTable.Height(seg->FontId());
 		const char*  sc          = seg->Text();
 		float        escpSpace   = seg->EscpSpace();
 		float        escpNoSpace = seg->EscpNoSpace();
 		int32        spaces      = seg->Spaces();
 		PDFSystem*   system      = seg->System();
-		
-		
-		while (*sc != 0) {
+
+		const int32 count = decoder.Decode(sc, strlen(sc));
+		const float* advances = fWriter->fFontTable.Advances(seg->FontId(),
+			sc, decoder);
+
+		for (int32 index = 0; index < count; index ++) {
 			ASSERT(*sc == *c);
 			
-			int s = fWriter->CodePointSize((char*)c);
+			int s = decoder.SizeAt(index);
 	
-			float w = font->StringWidth(c, s);
+			float w = advances[index];
 	
 			if (c == pStart) {
 				bounds->left = bounds->right = system->tx(pos.x);
 				bounds->top = bounds->bottom = system->ty(pos.y);
 			}
 			if (pStart <= c && c < pEnd) {		
-				font_height height;
-				font->GetHeight(&height);
 				float top = system->ty(pos.y - height.ascent);
 				float bottom = system->ty(pos.y + height.descent);
 				
@@ -460,15 +463,14 @@ void TextLine::Flush() {
 		// simple bookmark adding
 		if (fWriter->fCreateBookmarks) {
 			TextSegment* s = fSegments.ItemAt(0);
-			BFont* f = s->Font();
 			PDFSystem* system = s->System();
 			BPoint start(system->tx(s->Start().x), system->ty(s->Start().y));
 
-			font_height height;
-			f->GetHeight(&height);
+			const font_height& height
+				= fWriter->fFontTable.Height(s->FontId());
 			float h = system->scale(height.ascent);
 
-			fWriter->fBookmark->AddBookmark(start, h, c, f);
+			fWriter->fBookmark->AddBookmark(start, h, c, s->FontId());
 		}
 	}
 	fSegments.MakeEmpty();
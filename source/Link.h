@@ -96,12 +96,12 @@ class TextSegment {
 	float        fEscpSpace;   // escapement space
 	float        fEscpNoSpace; // escapement no space
 	BRect        fBounds;
-	BFont        fFont;
+	int32        fFontId;
 	PDFSystem    fSystem;
 	int32        fSpaces;
 		
 public:
-	TextSegment(const char* text, BPoint start, float escpSpace, float escpNoSpace, BRect* bounds, BFont* font, PDFSystem* system);
+	TextSegment(const char* text, BPoint start, float escpSpace, float escpNoSpace, BRect* bounds, int32 fontId, PDFSystem* system);
 
 	void        PrependSpaces(int32 n);
 
@@ -110,7 +110,7 @@ public:
 	float       EscpSpace() const   { return fEscpSpace; }
 	float       EscpNoSpace() const { return fEscpNoSpace; }
 	BRect       Bounds() const      { return fBounds; }
-	BFont*      Font()              { return &fFont; }
+	int32       FontId() const      { return fFontId; }
 	PDFSystem*  System()            { return &fSystem; }
 	int32       Spaces() const      { return fSpaces; }
 };
@@ -57,6 +57,12 @@ public:
 	inline float tx(float x)    { return fX + fScale*x; }
 	inline float ty(float y)    { return fHeight - (fY + fScale * y); }
 	inline float scale(float f) { return fScale * f; }
+
+	// page coordinates with the y axis pointing down and back
+	inline float px(float x)    { return fX + fScale * x; }
+	inline float py(float y)    { return fY + fScale * y; }
+	inline float lx(float x)    { return (x - fX) / fScale; }
+	inline float ly(float y)    { return (y - fY) / fScale; }
 };
 
 
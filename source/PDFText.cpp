@@ -35,13 +35,7 @@ typedef struct {
 } unicode_to_encoding;
 
 typedef struct {
-	uint16 unicode;
-	uint16 cid;
-} unicode_to_cid;
-
-typedef struct {
-	uint16         length;
-	unicode_to_cid *table;
+	const uint8 *coverage;	// one bit per code point
 } cid_table;
 
 #ifdef UNICODE5_FROM
@@ -50,6 +44,9 @@ typedef struct {
 
 #define ELEMS(v, e) sizeof(v) / sizeof(e)
 
+// largest misplacement of a glyph in a run, in BFont units
+static const float kMaxGlyphRunDrift = 0.05;
+
 // Adobe Glyph List
 #include "enc_range.h"
 #include "unicode0.h"
@@ -67,7 +64,7 @@ static unicode_to_encoding encodings[] = {
 	{UNICODE4_FROM, UNICODE4_TO, ELEMS(unicode4, uint16), unicode4}
 };
 
-// unicode to cid
+// code points covered by the CID fonts
 #include "japanese.h"
 #include "gb1.h"
 #include "cns1.h"
@@ -75,10 +72,10 @@ static unicode_to_encoding encodings[] = {
 
 
 static cid_table cid_tables[] = {
-	{ELEMS(japanese, unicode_to_cid), japanese},
-	{ELEMS(CNS1,     unicode_to_cid), CNS1},
-	{ELEMS(GB1,      unicode_to_cid), GB1},
-	{ELEMS(korean,   unicode_to_cid), korean}
+	{japanese},
+	{CNS1},
+	{GB1},
+	{korean}
 };
 
 static const char* encoding_names[] = {
@@ -106,6 +103,17 @@ static const char* encoding_names[] = {
 //	#pragma mark -
 
 
+// The kinds of encodings a code point resolves to, stored in the high byte
+// of fCodePointEncoding. The low byte is the code in that encoding.
+enum {
+	kUnresolved = 0,
+	kMacRoman,
+	kGlyphList,					// + table of the Adobe Glyph List
+	kNoEncoding = kGlyphList + ELEMS(encodings, unicode_to_encoding),
+	kCIDTable					// + index into fFontSearchOrder
+};
+
+
 static bool
 find_encoding(uint16 unicode, uint8 &encoding, uint16 &index)
 {
@@ -133,30 +141,52 @@ find_encoding(uint16 unicode, uint8 &encoding, uint16 &index)
 }
 
 
-static bool
-find_in_cid_tables(uint16 unicode, font_encoding &encoding, uint16 &index,
-	font_encoding* order)
+/*!	Returns the index of the first CJK encoding in \a order whose
+	character collection covers \a unicode, or -1 if there is none.
+*/
+static int
+find_in_cid_tables(uint16 unicode, font_encoding* order)
 {
 	for (unsigned int i = 0; i < ELEMS(cid_tables, cid_table); i++) {
-		encoding = order[i];
+		font_encoding encoding = order[i];
 		if (encoding == invalid_encoding) break;
-		int index = encoding - first_cjk_encoding;
-		int32 bottom = 0;
-		int32 top = cid_tables[index].length-1;
-		unicode_to_cid *table = cid_tables[index].table;
-		while (top >= bottom) {
-		    int32 m = (top + bottom) / 2;
-			if (unicode < table[m].unicode) {
-				top = m-1;
-			} else if (unicode > table[m].unicode) {
-				bottom = m+1;
-			} else {
-				index = table[m].cid;
-				return true;
-			}
-		}
+		const uint8* coverage = cid_tables[encoding - first_cjk_encoding].coverage;
+		if ((coverage[unicode / 8] & (1 << (unicode % 8))) != 0)
+			return i;
 	}
-	return false;
+	return -1;
+}
+
+
+/*!	Looks up the encodings that do not depend on the font for \a unicode
+	once and remembers the result in fCodePointEncoding.
+*/
+uint16
+PDFWriter::ResolveCodePoint(uint16 unicode, const char* utf8, int16 size)
+{
+	int32 srcLen  = size;
+	int32 destLen = 1;
+	char dest[3] = "\0\0";
+	int32 state = 0;
+	uint8 enc;
+	uint16 index;
+	int cjk;
+	uint16 resolved;
+
+	if (convert_from_utf8(B_MAC_ROMAN_CONVERSION, utf8, &srcLen, dest, &destLen,
+			&state, 0) == B_OK && dest[0] != 0) {
+		resolved = (kMacRoman << 8) | (uint8)dest[0];
+	} else if (find_encoding(unicode, enc, index)) {
+		resolved = ((kGlyphList + enc) << 8) | (index & 0xff);
+	} else if ((cjk = find_in_cid_tables(unicode, fFontSearchOrder)) >= 0) {
+		resolved = (kCIDTable + cjk) << 8;
+	} else
+		resolved = kNoEncoding << 8;
+
+	REPORT(kDebug, -1, "code point %x resolved to %d %d", (int)unicode,
+		resolved >> 8, resolved & 0xff);
+	fCodePointEncoding[unicode] = resolved;
+	return resolved;
 }
 
 
@@ -187,57 +217,45 @@ PDFWriter::RecordFont(const char* family, const char* style, float size)
 }
 
 
-void
-PDFWriter::GetFontName(BFont *font, char *fontname)
+/*!	Returns the name of the PDF font for the interned font \a fontId in
+	\a encoding. The font is recorded as used the first time.
+*/
+const char*
+PDFWriter::GetFontName(int32 fontId, font_encoding encoding)
 {
-	font_family family;
-	font_style  style;
-
-	font->GetFamilyAndStyle(&family, &style);
-	strcat(strcat(strcpy(fontname, family), "-"), style);
-
-	RecordFont(family, style, font->Size());
-}
-
-
-void
-PDFWriter::GetFontName(BFont *font, char *fontname, bool &embed,
-	font_encoding encoding)
-{
-	GetFontName(font, fontname);
+	if (!fFontTable.IsUsed(fontId)) {
+		fFontTable.SetUsed(fontId);
+
+		const BFont& font = fFontTable.FontAt(fontId);
+		font_family family;
+		font_style  style;
+		font.GetFamilyAndStyle(&family, &style);
+		RecordFont(family, style, font.Size());
+	}
 
 	switch (encoding) {
 		case japanese_encoding:
-			strcpy(fontname, "HeiseiMin-W3"); return;
+			return "HeiseiMin-W3";
 		case chinese_cns1_encoding:
-			strcpy(fontname, "MHei-Medium"); return;
+			return "MHei-Medium";
 		case chinese_gb1_encoding:
-			strcpy(fontname, "STSong-Light"); return;
+			return "STSong-Light";
 		case korean_encoding:
-			strcpy(fontname, "HYGoThic-Medium"); return;
-		default:;
+			return "HYGoThic-Medium";
+		default:
+			return fFontTable.Name(fontId);
 	}
 }
 
 
 int
-PDFWriter::FindFont(char* fontName, bool embed, font_encoding encoding)
+PDFWriter::FindFont(const char* fontName, bool embed, font_encoding encoding)
 {
-	static Font* cache = NULL;
-	if (cache && cache->encoding == encoding
-		&& strcmp(cache->name.String(), fontName) == 0)
-		return cache->font;
+	Font *f = fFontHandles.Find(fontName, encoding);
+	if (f != NULL)
+		return f->font;
 
 	REPORT(kDebug, fPage, "FindFont %s", fontName);
-	Font *f = NULL;
-	const int n = fFontCache.CountItems();
-	for (int i = 0; i < n; i++) {
-		f = fFontCache.ItemAt(i);
-		if (f->encoding == encoding && strcmp(f->name.String(), fontName) == 0) {
-			cache = f;
-			return f->font;
-		}
-	}
 
 	if (embed) embed = EmbedFont(fontName);
 
@@ -255,8 +273,9 @@ PDFWriter::FindFont(char* fontName, bool embed, font_encoding encoding)
 	int font = PDF_findfont(fPdf, fontName, encoding_name, embed);
 	if (font != -1) {
 		REPORT(kDebug, fPage, "font created");
-		cache = new Font(fontName, font, encoding);
-		fFontCache.AddItem(cache);
+		f = new Font(fontName, font, encoding);
+		fFontCache.AddItem(f);
+		fFontHandles.Insert(f);
 	} else {
 		REPORT(kError, fPage, "Could not create font '%s': %s", fontName,
 			PDF_get_errmsg(fPdf));
@@ -269,50 +288,45 @@ void
 PDFWriter::ToUtf8(uint32 encoding, const char *string, BString &utf8)
 {
 	int32 len = strlen(string);
-	int32 srcLen = len, destLen = 255;
+	int32 srcLen = len;
 	int32 state = 0;
-	char buffer[256];
 	int32 srcStart = 0;
+	int32 i = 0;
+
+	utf8 = "";
+	if (len == 0) return;
 
+	// a character takes at most 3 bytes in UTF-8, convert in place
+	int32 capacity = 3 * len;
+	char* buffer = utf8.LockBuffer(capacity);
 	do {
-		convert_to_utf8(encoding, &string[srcStart], &srcLen, buffer, &destLen,
-			&state);
+		int32 destLen = capacity - i;
+		convert_to_utf8(encoding, &string[srcStart], &srcLen, &buffer[i],
+			&destLen, &state);
+		if (srcLen == 0) break;
 		srcStart += srcLen;
 		len -= srcLen;
 		srcLen = len;
-
-		utf8.Append(buffer, destLen);
-		destLen = 255;
+		i += destLen;
 	} while (len > 0);
+	utf8.UnlockBuffer(i);
 };
 
 
 void
 PDFWriter::ToUnicode(const char *string, BString &unicode)
 {
-	int32 len = strlen(string);
-	int32 srcLen = len, destLen = 255;
-	int32 state = 0;
-	char buffer[256];
-	int32 srcStart = 0;
-	int i = 0;
-
-	unicode = "";
-	if (len == 0) return;
-
-	do {
-		convert_from_utf8(B_UNICODE_CONVERSION, &string[srcStart], &srcLen,
-			buffer, &destLen, &state);
-		srcStart += srcLen;
-		len -= srcLen;
-		srcLen = len;
-
-		char *b = unicode.LockBuffer(i + destLen);
-		memcpy(&b[i], buffer, destLen);
-		unicode.UnlockBuffer(i + destLen);
-		i += destLen;
-		destLen = 255;
-	} while (len > 0);
+	UTF8Decoder decoder;
+	const int32 count = decoder.Decode(string, strlen(string));
+
+	// big-endian UCS-2
+	char* b = unicode.LockBuffer(2 * count);
+	for (int32 i = 0; i < count; i++) {
+		const uint16 codePoint = decoder.CodePointAt(i);
+		b[2 * i] = codePoint >> 8;
+		b[2 * i + 1] = codePoint & 0xff;
+	}
+	unicode.UnlockBuffer(2 * count);
 }
 
 
@@ -350,56 +364,58 @@ PDFWriter::RecordDests(const char* s)
 
 
 void
-PDFWriter::DrawChar(uint16 unicode, const char* utf8, int16 size)
+PDFWriter::DrawChar(uint16 unicode, const char* utf8, int16 size,
+	float advance)
 {
-	// try to convert from utf8 to MacRoman encoding schema...
-	int32 srcLen  = size;
 	int32 destLen = 1;
 	char dest[3] = "\0\0";
-	int32 state = 0;
 	bool embed = true;
 	font_encoding encoding = macroman_encoding;
-	char fontName[B_FONT_FAMILY_LENGTH+B_FONT_STYLE_LENGTH+1];
 
-	if (convert_from_utf8(B_MAC_ROMAN_CONVERSION, utf8, &srcLen, dest, &destLen,
-			&state, 0) != B_OK || dest[0] == 0) {
-		// could not convert to MacRoman
-		font_encoding fenc;
-		uint16 index = 0;
-		uint8 enc;
+	uint16 resolved = fCodePointEncoding[unicode];
+	if (resolved == kUnresolved)
+		resolved = ResolveCodePoint(unicode, utf8, size);
+	const uint8 kind = resolved >> 8;
 
-		GetFontName(&fState->beFont, fontName);
-		embed = EmbedFont(fontName);
+	if (kind == kMacRoman) {
+		*dest = resolved & 0xff;
+	} else {
+		// could not convert to MacRoman
+		// the embedding policy is looked up once per interned font
+		int8 fontEmbed = fFontTable.Embed(fState->fontId);
+		if (fontEmbed < 0) {
+			fontEmbed = EmbedFont(fFontTable.Name(fState->fontId));
+			fFontTable.SetEmbed(fState->fontId, fontEmbed);
+		}
+		embed = fontEmbed;
 
-		REPORT(kDebug, -1, "find_encoding unicode %d\n", (int)unicode);
-		if (find_encoding(unicode, enc, index)) {
+		if (kind < kNoEncoding) {
 			// is code point in the Adobe Glyph List?
 			// Note if rendering the glyphs only would be desired, we could
 			// always use the second method below (MakeUserDefinedEncoding),
 			// but extracting text from the generated PDF would be almost
 			// impossible (OCR!)
-			REPORT(kDebug, -1, "encoding for %x -> %d %d", unicode, (int)enc,
-				(int)index);
+			uint8 enc = kind - kGlyphList;
 			// use one of the user pre-defined encodings
-			if (fState->beFont.FileFormat() == B_TRUETYPE_WINDOWS) {
+			if (CurrentFont().FileFormat() == B_TRUETYPE_WINDOWS) {
 				encoding = font_encoding(enc + tt_encoding0);
 			} else {
 				encoding = font_encoding(enc + t1_encoding0);
 			}
-			*dest = index;
+			*dest = resolved & 0xff;
 		} else if (embed) {
 			// if the font is embedded, create a user defined encoding at runtime
+			uint8 enc;
 			uint8 index;
 			MakeUserDefinedEncoding(unicode, enc, index);
 			*dest = index;
 			encoding = font_encoding(user_defined_encoding_start + enc);
-		} else if (find_in_cid_tables(unicode, fenc, index, fFontSearchOrder)) {
+		} else if (kind >= kCIDTable) {
 			// font is not embedded use one of the CJK fonts for substitution
-			REPORT(kDebug, -1, "cid table %d index = %d", (int)fenc, (int)index);
 			dest[0] = unicode / 256;
 			dest[1] = unicode % 256;
 			destLen = 2;
-			encoding = fenc;
+			encoding = fFontSearchOrder[kind - kCIDTable];
 			embed = false;
 		} else {
 			static bool found = false;
@@ -411,61 +427,151 @@ PDFWriter::DrawChar(uint16 unicode, const char* utf8, int16 size)
 					"values.", (int)unicode);
 			}
 			*dest = 0; // paint a box (is 0 a box in MacRoman) or
-			return; // simply skip character
+			// simply skip character, the following glyphs start a new run
+			FlushGlyphRun();
+			return;
 		}
-	} else {
-		REPORT(kDebug, -1, "macroman srcLen=%d destLen=%d dest= %d %d!", srcLen,
-			destLen, (int)dest[0], (int)dest[1]);
 	}
 
 	// Note we have to build the user defined encoding before it is used in
 	// PDF_find_font!
 	if (!MakesPDF()) return;
 
-	int		font;
+	// an unchanged font and encoding keeps the handle of the previous glyph,
+	// the MacRoman font is looked up once per interned font
+	int		font = -1;
+	if (fState->fontHandleId == fState->fontId
+		&& fState->fontHandleEncoding == encoding)
+		font = fState->font;
+	else if (encoding == macroman_encoding)
+		font = fFontTable.PDFFont(fState->fontId);
 
-	GetFontName(&fState->beFont, fontName, embed, encoding);
-	font = FindFont(fontName, embed, encoding);
 	if (font < 0) {
-		REPORT(kWarning, fPage, "**** PDF_findfont(%s) failed, back to default "
-			"font", fontName);
-		font = PDF_findfont(fPdf, "Helvetica", "macroman", 0);
+		const char* fontName = GetFontName(fState->fontId, encoding);
+		font = FindFont(fontName, embed, encoding);
+		if (font < 0) {
+			REPORT(kWarning, fPage, "**** PDF_findfont(%s) failed, back to "
+				"default font", fontName);
+			font = PDF_findfont(fPdf, "Helvetica", "macroman", 0);
+		} else if (encoding == macroman_encoding)
+			fFontTable.SetPDFFont(fState->fontId, font);
 	}
 
 	fState->font = font;
+	fState->fontHandleId = fState->fontId;
+	fState->fontHandleEncoding = encoding;
+
+	// Word spacing applies to every single byte code 32, so a glyph can
+	// only join the run if its code is 32 exactly when it is a space.
+	// Control characters get the space escapement but no word spacing.
+	const bool isSpaceCode = destLen == 1 && dest[0] == ' ';
+	if (destLen != 1 || unicode < 0x20 || isSpaceCode != (unicode == 0x20)) {
+		FlushGlyphRun();
+		ShowGlyphs(font, fState->penX, fState->penY, dest, destLen);
+		return;
+	}
 
-	uint16 face = fState->beFont.Face();
-	PDF_set_parameter(fPdf, "underline", (face & B_UNDERSCORE_FACE) != 0
-		? "true" : "false");
-	PDF_set_parameter(fPdf, "strikeout", (face & B_STRIKEOUT_FACE) != 0
-		? "true" : "false");
-	PDF_set_value(fPdf, "textrendering", (face & B_OUTLINED_FACE) != 0 ? 1 : 0);
+	// PDF places the glyphs of a run by the widths of the PDF font, which
+	// differ from the BFont advances for substituted fonts, so a glyph
+	// only joins the run as long as the glyphs before it add up to its
+	// pen position.
+	if (fGlyphRun.length > 0 && (fGlyphRun.font != font
+			|| fGlyphRun.length == GlyphRun::kMaxLength
+			|| fabs(fGlyphRun.drift) > kMaxGlyphRunDrift)) {
+		FlushGlyphRun();
+	}
+	if (fGlyphRun.length == 0) {
+		fGlyphRun.font = font;
+		fGlyphRun.x = fState->penX;
+		fGlyphRun.y = fState->penY;
+		fGlyphRun.drift = 0;
+	}
+	fGlyphRun.text[fGlyphRun.length++] = dest[0];
+	fGlyphRun.drift += PDFGlyphWidth(font, dest[0]) * CurrentFont().Size()
+		- advance;
+}
 
-	PDF_setfont(fPdf, fState->font, scale(fState->beFont.Size()));
 
-	const float x = tx(fState->penX);
-	const float y = ty(fState->penY);
-	const float rotation = fState->beFont.Rotation();
+//! Returns the width of \a code in the PDF font \a font at size 1.
+float
+PDFWriter::PDFGlyphWidth(int font, uint8 code)
+{
+	if (font < 0)
+		return 0;
+	if (font >= fPDFGlyphWidthFonts) {
+		const int32 fonts = max_c(font + 1, 2 * fPDFGlyphWidthFonts);
+		float* widths = new float[fonts * 256];
+		if (fPDFGlyphWidthFonts > 0) {
+			memcpy(widths, fPDFGlyphWidths,
+				fPDFGlyphWidthFonts * 256 * sizeof(float));
+		}
+		for (int32 i = fPDFGlyphWidthFonts * 256; i < fonts * 256; i++)
+			widths[i] = -1;
+		delete[] fPDFGlyphWidths;
+		fPDFGlyphWidths = widths;
+		fPDFGlyphWidthFonts = fonts;
+	}
+
+	float& width = fPDFGlyphWidths[font * 256 + code];
+	if (width < 0)
+		width = PDF_stringwidth2(fPdf, (const char*)&code, 1, font, 1);
+	return width;
+}
+
+
+/*!	Shows \a text in \a font starting at the pen position \a x, \a y.
+	The glyphs are advanced by their widths plus the escapements of the
+	current string.
+*/
+void
+PDFWriter::ShowGlyphs(int font, float x, float y, const char* text,
+	int32 length)
+{
+	const BFont& beFont = CurrentFont();
+	uint16 face = beFont.Face();
+	SetUnderline((face & B_UNDERSCORE_FACE) != 0);
+	SetStrikeout((face & B_STRIKEOUT_FACE) != 0);
+	SetTextRendering((face & B_OUTLINED_FACE) != 0 ? 1 : 0);
+
+	SetFont(font, scale(beFont.Size()));
+	SetCharSpacing(scale(fGlyphRun.charSpacing));
+	SetWordSpacing(scale(fGlyphRun.wordSpacing));
+
+	x = tx(x);
+	y = ty(y);
+	const float rotation = beFont.Rotation();
 	const bool rotate = rotation != 0.0;
 
 	if (rotate) {
-		PDF_save(fPdf);
+		SaveGState();
 		PDF_translate(fPdf, x, y);
 		PDF_rotate(fPdf, rotation);
 	    PDF_set_text_pos(fPdf, 0, 0);
 	} else
 	    PDF_set_text_pos(fPdf, x, y);
 
-	PDF_show2(fPdf, dest, destLen);
+	PDF_show2(fPdf, text, length);
 
 	if (rotate) {
-		PDF_restore(fPdf);
+		RestoreGState();
 	}
 }
 
 
 void
-PDFWriter::ClipChar(BFont* font, const char* unicode, const char* utf8,
+PDFWriter::FlushGlyphRun()
+{
+	if (fGlyphRun.length == 0)
+		return;
+
+	ShowGlyphs(fGlyphRun.font, fGlyphRun.x, fGlyphRun.y, fGlyphRun.text,
+		fGlyphRun.length);
+	fGlyphRun.length = 0;
+}
+
+
+void
+PDFWriter::ClipChar(const BFont* font, const char* unicode, const char* utf8,
 	int16 size, float width)
 {
 	BShape glyph;
@@ -478,8 +584,7 @@ PDFWriter::ClipChar(BFont* font, const char* unicode, const char* utf8,
 	} else {
 		REPORT(kWarning, fPage, "glyph for %*.*s not found!", size, size, utf8);
 		// create a rectangle instead
-		font_height height;
-		fState->beFont.GetHeight(&height);
+		const font_height& height = fFontTable.Height(fState->fontId);
 		BRect r(0, 0, width, height.ascent);
 		float w = r.Width() < r.Height() ? r.Width()*0.1 : r.Height()*0.1;
 		BRect o = r; o.InsetBy(w, w);
@@ -526,40 +631,45 @@ PDFWriter::DrawString(char *string, float escapementNoSpace,
 	}
 	// convert string to UTF8
 	BString utf8;
-	if (fState->beFont.Encoding() == B_UNICODE_UTF8) {
+	if (CurrentFont().Encoding() == B_UNICODE_UTF8) {
 		utf8 = string;
 	} else {
-		ToUtf8(fState->beFont.Encoding()-1, string, utf8);
+		ToUtf8(CurrentFont().Encoding()-1, string, utf8);
 	}
 
 	// convert string in UTF8 to unicode UCS2
-	BString unicode;
-	ToUnicode(utf8.String(), unicode);
+	const int32 count = fTextDecoder.Decode(utf8.String(), utf8.Length());
 	// need font object to calculate width of utf8 code point
-	BFont font = fState->beFont;
-	font.SetEncoding(B_UNICODE_UTF8);
+	const int32 fontId = fFontTable.UTF8Font(fState->fontId);
+	const BFont& font = fFontTable.FontAt(fontId);
+	const float* advances = fFontTable.Advances(fontId, utf8.String(),
+		fTextDecoder);
 	// constants to calculate position of next character
-	const double rotation = DEGREE2RAD(fState->beFont.Rotation());
+	const double rotation = DEGREE2RAD(font.Rotation());
 	const bool rotate = rotation != 0.0;
 	const double cos1 = rotate ? cos(rotation) : 1;
 	const double sin1 = rotate ? -sin(rotation) : 0;
 
 	BPoint start(fState->penX, fState->penY);
 
+	fGlyphRun.charSpacing = escapementNoSpace;
+	fGlyphRun.wordSpacing = escapementSpace - escapementNoSpace;
+
 	BeginTransparency();
 	// If !MakesPDF() all the effort below just for the bounding box!
 	// draw each character
-	const char *c = utf8.String();
-	const unsigned char *u = (unsigned char*)unicode.String();
-	for (int i = 0; i < unicode.Length(); i += 2) {
-		int s = CodePointSize((char*)c);
+	for (int32 i = 0; i < count; i++) {
+		const char *c = utf8.String() + fTextDecoder.OffsetAt(i);
+		const int s = fTextDecoder.SizeAt(i);
+		const uint16 unicode = fTextDecoder.CodePointAt(i);
 
-		float w = font.StringWidth(c, s);
+		float w = advances[i];
 
 		if (MakesPDF() && IsClipping()) {
-			ClipChar(&font, (char*)u, c, s, w);
+			const char u[2] = { (char)(unicode >> 8), (char)(unicode & 0xff) };
+			ClipChar(&font, u, c, s, w);
 		} else {
-			DrawChar(u[0]*256+u[1], c, s);
+			DrawChar(unicode, c, s, w);
 		}
 
 		// position of next character
@@ -571,18 +681,14 @@ PDFWriter::DrawString(char *string, float escapementNoSpace,
 
 		fState->penX += w * cos1;
 		fState->penY += w * sin1;
-
-		// next character
-		c += s; u += 2;
 	}
+	FlushGlyphRun();
 	EndTransparency();
 
 	// text line processing (for non rotated text only!)
 	BPoint end(fState->penX, fState->penY);
 	BRect bounds;
-	font_height height;
-
-	font.GetHeight(&height);
+	const font_height& height = fFontTable.Height(fontId);
 
 	bounds.left = start.x;
 	bounds.right = end.x;
@@ -590,7 +696,7 @@ PDFWriter::DrawString(char *string, float escapementNoSpace,
 	bounds.bottom = end.y   + height.descent;
 
 	TextSegment* segment = new TextSegment(utf8.String(), start, escapementSpace,
-		escapementNoSpace, &bounds, &font, pdfSystem());
+		escapementNoSpace, &bounds, fontId, pdfSystem());
 
 	fTextLine.Add(segment);
 }
@@ -599,16 +705,6 @@ PDFWriter::DrawString(char *string, float escapementNoSpace,
 bool
 PDFWriter::EmbedFont(const char* name)
 {
-	static FontFile* cache = NULL;
-	if (cache && strcmp(cache->Name(), name) == 0) return cache->Embed();
-
-	const int n = fFonts->Length();
-	for (int i = 0; i < n; i++) {
-		FontFile* f = fFonts->At(i);
-		if (strcmp(f->Name(), name) == 0) {
-			cache = f;
-			return f->Embed();
-		}
-	}
-	return false;
+	FontFile* f = fFonts->Find(name);
+	return f != NULL && f->Embed();
 }
@@ -28,6 +28,10 @@
 #include "Bezier.h"
 #include "LinePathBuilder.h"
 #include "DrawShape.h"
+#include "ImageAnalyzer.h"
+#include "PNGWriter.h"
+#include "StreamedImage.h"
+#include "SystemPalette.h"
 #include "Log.h"
 #include "pdflib.h"
 #include "Bookmark.h"
@@ -40,6 +44,18 @@ static const char* kSettingsDirectory = "PDF Writer";
 static const char* kBookmarksDirectory = "bookmarks";
 static const char* kCrossReferencesDirectory = "xrefs";
 
+// images with more distinct colors are considered photographic
+static const int32 kPhotographicColors = 1024;
+// smaller images are always stored lossless
+static const int32 kMinPhotographicPixels = 32 * 32;
+// larger images are converted and compressed in bands
+static const int64 kMaxBufferedPixels = 4096 * 4096;
+static const int32 kImageBandHeight = 64;
+// source pixels kept around the visible part of a clipped image
+static const float kClipMargin = 2;
+// grids of fewer images are not drawn as tiling pattern
+static const int32 kMinPatternTiles = 4;
+
 
 PDFWriter::PDFWriter()
 	:
@@ -52,8 +68,22 @@ PDFWriter::PDFWriter()
 	fFontSearchOrder[3]	= korean_encoding;
 
 	fPage = 0;
+	fJPEGQuality = 0;
 	fEmbedMaxFontSize = 250 * 1024;
-	fScreen = new BScreen();
+	for (int32 i = 0; i < 256; i++) {
+		const rgb_color c = kSystemPalette[i];
+		uint8 *entry = (uint8*)&fCMAP8ToRGB32[i];
+		entry[0] = c.blue;
+		entry[1] = c.green;
+		entry[2] = c.red;
+		entry[3] = c.alpha;
+	}
+	memset(fTransparencyTable, 0, sizeof(fTransparencyTable));
+	memset(fCodePointEncoding, 0, sizeof(fCodePointEncoding));
+	fGStateDepth = 0;
+	fSuppressedOps = 0;
+	fPDFGlyphWidths = NULL;
+	fPDFGlyphWidthFonts = 0;
 	fFonts = NULL;
 	fBookmark = new Bookmark(this);
 	fXRefs = new XRefDefs();
@@ -63,11 +93,11 @@ PDFWriter::PDFWriter()
 
 PDFWriter::~PDFWriter()
 {
-	delete fScreen;
 	delete fFonts;
 	delete fBookmark;
 	delete fXRefs;
 	delete fXRefDests;
+	delete[] fPDFGlyphWidths;
 }
 
 
@@ -136,6 +166,7 @@ PDFWriter::PrintPage(int32	pageNumber, int32 pageCount)
 		SetOrigin(picPoints[i]);
 		PushInternalState();
 		Iterate(pictures[i]);
+		FlushTiles();
 		delete pictures[i];
 		PopInternalState();
 	}
@@ -343,13 +374,30 @@ PDFWriter::InitWriter()
 	int32 compression;
 	if (JobMsg()->FindInt32("pdf_compression", &compression) == B_OK) {
 	    PDF_set_value(fPdf, "compress", compression);
+	    fImageCache.SetCompression(compression);
 	}
 
+	if (JobMsg()->FindInt32("pdf_jpeg_quality", &fJPEGQuality) != B_OK
+		|| fJPEGQuality < 0)
+		fJPEGQuality = 0;
+	else if (fJPEGQuality > 100)
+		fJPEGQuality = 100;
+
     // PDF_set_parameter(fPdf, "warning", "false");
 
 	PDF_set_parameter(fPdf, "fontwarning", "false");
 	// PDF_set_parameter(fPdf, "native-unicode", "true");
 
+#if HAVE_FULLVERSION_PDF_LIB
+	// Embed only the glyphs shown with an embedded font. PDFlib records
+	// them per font handle for the whole document and writes the subsets
+	// when the document is closed, a font with nearly all glyphs used is
+	// embedded completely.
+	PDF_set_parameter(fPdf, "autosubsetting", "true");
+	PDF_set_value(fPdf, "subsetminsize", 0);
+	PDF_set_value(fPdf, "subsetlimit", 75);
+#endif
+
 	REPORT(kDebug, 0, "Start of declarations:");
 
 	DeclareEncodingFiles();
@@ -515,6 +563,12 @@ PDFWriter::BeginPage(BRect paperRect, BRect printRect)
 	if (MakesPDF())
 		PDF_initgraphics(fPdf);
 
+	// a new page starts with the default graphics state
+	fGState.Reset();
+	fGState.alpha = 255;
+	fGStateDepth = 0;
+	fSuppressedOps = 0;
+
 	fState->penX = 0;
 	fState->penY = 0;
 
@@ -529,13 +583,17 @@ PDFWriter::BeginPage(BRect paperRect, BRect printRect)
 status_t
 PDFWriter::EndPage()
 {
+	FlushTiles();
 	fTextLine.Flush();
 	if (fCreateBookmarks) fBookmark->CreateBookmarks();
 
 	while (fState->prev != NULL) PopState();
 
-	if (MakesPDF())
+	if (MakesPDF()) {
+		REPORT(kInfo, fPage, "%ld redundant state operators suppressed",
+			fSuppressedOps);
 		PDF_end_page(fPdf);
+	}
 	REPORT(kDebug, fPage, ">>>> PDF_end_page");
 
 	delete fState; fState = NULL;
@@ -570,7 +628,16 @@ void
 PDFWriter::PushInternalState()
 {
 	REPORT(kDebug, fPage, "PushInternalState");
-	fState = new State(fState); fStateDepth ++;
+	// frames are kept for reuse, a push only copies the current state
+	State* s = fStateFrames.ItemAt(fStateDepth);
+	if (s == NULL) {
+		s = new State(fState);
+		fStateFrames.AddItem(s);
+	} else {
+		*s = *fState;
+		s->prev = fState;
+	}
+	fState = s; fStateDepth ++;
 }
 
 
@@ -579,9 +646,8 @@ PDFWriter::PopInternalState()
 {
 	REPORT(kDebug, fPage, "PopInternalState");
 	if (fStateDepth != 0) {
-		State* s = fState; fStateDepth --;
+		fStateDepth --;
 		fState = fState->prev;
-		delete s;
 		return true;
 	} else {
 		REPORT(kDebug, fPage, "State stack underflow!");
@@ -593,14 +659,9 @@ PDFWriter::PopInternalState()
 PDFWriter::Transparency*
 PDFWriter::FindTransparency(uint8 alpha)
 {
-	const int n = fTransparencyCache.CountItems();
-	for (int i = 0; i < n; i ++) {
-		Transparency* t = fTransparencyCache.ItemAt(i);
-		if (t->Matches(alpha)) {
-			// return handle for existing gstate
-			return t;
-		}
-	}
+	// return handle for existing gstate
+	if (fTransparencyTable[alpha] != NULL)
+		return fTransparencyTable[alpha];
 
 	// create new handle for gstate
 	char trans[256];
@@ -619,6 +680,7 @@ PDFWriter::FindTransparency(uint8 alpha)
 		// store in cache
 		Transparency* t = new Transparency(alpha, handle);
 		fTransparencyCache.AddItem(t);
+		fTransparencyTable[alpha] = t;
 		return t;
 	}
 
@@ -626,6 +688,11 @@ PDFWriter::FindTransparency(uint8 alpha)
 }
 
 
+/*!	Makes the opacity of the content stream match the current drawing
+	mode and color. The gstate is only switched if the opacity differs
+	from the one set last, so that a series of primitives with the same
+	alpha needs no operators at all.
+*/
 void
 PDFWriter::BeginTransparency()
 {
@@ -639,36 +706,180 @@ PDFWriter::BeginTransparency()
 	REPORT(kDebug, fPage, "drawing_mode %d alpha %d", (int)fState->drawingMode,
 		(int)fState->currentColor.alpha);
 
-	uint8 alpha = fState->currentColor.alpha;
-	if (fState->drawingMode == B_OP_ALPHA && alpha < 255) {
-		PDF_save(fPdf);
-		Transparency* t = FindTransparency(alpha);
-		if (t != NULL) {
-			PDF_TRY(fPdf) {
-				PDF_set_gstate(fPdf, t->Handle());
-			} PDF_CATCH(fPdf) {
-				REPORT(kError, 0, PDF_get_errmsg(fPdf));
-			}
-			fTransparencyStack.AddItem(t);
-			return;
-		}
+	uint8 alpha = 255;
+	if (fState->drawingMode == B_OP_ALPHA)
+		alpha = fState->currentColor.alpha;
+
+	if (fGState.alpha == alpha)
+		return;
+
+	Transparency* t = FindTransparency(alpha);
+	if (t == NULL)
+		return;
+
+	PDF_TRY(fPdf) {
+		PDF_set_gstate(fPdf, t->Handle());
+		fGState.alpha = alpha;
+	} PDF_CATCH(fPdf) {
+		REPORT(kError, 0, PDF_get_errmsg(fPdf));
 	}
-	// if transparency is not set then push NULL to transparency stack
-	fTransparencyStack.AddItem(NULL);
 }
 
 
 void
 PDFWriter::EndTransparency()
 {
-	if (!SupportsOpacity() || !MakesPDF() || !IsDrawing()) return;
+	// the opacity stays set until a primitive needs another one
 	REPORT(kDebug, fPage, "<<< EndTransparency");
-	int lastItem = fTransparencyStack.CountItems()-1;
-	Transparency* t = fTransparencyStack.RemoveItem(lastItem);
+}
 
-	if (t != NULL) {
-		PDF_restore(fPdf);
+
+//! PDF_save() that also saves the tracked graphics state.
+void
+PDFWriter::SaveGState()
+{
+	if (fGStateDepth < kMaxGStateDepth)
+		fGStateStack[fGStateDepth] = fGState;
+	fGStateDepth ++;
+	PDF_save(fPdf);
+}
+
+
+/*!	PDF_restore() that also restores the tracked graphics state.
+	Underline and strikeout are PDFlib parameters and not part of the
+	PDF graphics state, so they are set again after a restore.
+*/
+void
+PDFWriter::RestoreGState()
+{
+	PDF_restore(fPdf);
+	fGStateDepth --;
+	if (fGStateDepth >= 0 && fGStateDepth < kMaxGStateDepth) {
+		fGState = fGStateStack[fGStateDepth];
+		fGState.underline = fGState.strikeout = kUnknown;
+	} else
+		fGState.Reset();
+}
+
+
+void
+PDFWriter::SetLineCap(int cap)
+{
+	if (fGState.lineCap == cap) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.lineCap = cap;
+	PDF_setlinecap(fPdf, cap);
+}
+
+
+void
+PDFWriter::SetLineJoin(int join)
+{
+	if (fGState.lineJoin == join) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.lineJoin = join;
+	PDF_setlinejoin(fPdf, join);
+}
+
+
+void
+PDFWriter::SetMiterLimit(float limit)
+{
+	if (fGState.miterLimit == limit) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.miterLimit = limit;
+	PDF_setmiterlimit(fPdf, limit);
+}
+
+
+void
+PDFWriter::SetLineWidth(float width)
+{
+	if (fGState.lineWidth == width) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.lineWidth = width;
+	PDF_setlinewidth(fPdf, width);
+}
+
+
+void
+PDFWriter::SetFont(int font, float size)
+{
+	if (fGState.font == font && fGState.fontSize == size) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.font = font;
+	fGState.fontSize = size;
+	PDF_setfont(fPdf, font, size);
+}
+
+
+void
+PDFWriter::SetTextRendering(int mode)
+{
+	if (fGState.textRendering == mode) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.textRendering = mode;
+	PDF_set_value(fPdf, "textrendering", mode);
+}
+
+
+void
+PDFWriter::SetUnderline(bool underline)
+{
+	if (fGState.underline == underline) {
+		fSuppressedOps ++;
+		return;
 	}
+	fGState.underline = underline;
+	PDF_set_parameter(fPdf, "underline", underline ? "true" : "false");
+}
+
+
+void
+PDFWriter::SetCharSpacing(float spacing)
+{
+	if (fGState.charSpacing == spacing) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.charSpacing = spacing;
+	PDF_set_value(fPdf, "charspacing", spacing);
+}
+
+
+void
+PDFWriter::SetWordSpacing(float spacing)
+{
+	if (fGState.wordSpacing == spacing) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.wordSpacing = spacing;
+	PDF_set_value(fPdf, "wordspacing", spacing);
+}
+
+
+void
+PDFWriter::SetStrikeout(bool strikeout)
+{
+	if (fGState.strikeout == strikeout) {
+		fSuppressedOps ++;
+		return;
+	}
+	fGState.strikeout = strikeout;
+	PDF_set_parameter(fPdf, "strikeout", strikeout ? "true" : "false");
 }
 
 
@@ -680,6 +891,8 @@ PDFWriter::SetColor(rgb_color color)
 		if (SupportsOpacity() && fState->currentColor.alpha != color.alpha
 			&& color.alpha < 255) {
 			FindTransparency(color.alpha);
+			// to switch back to opaque drawing
+			FindTransparency(255);
 		}
 	} else if (fState->currentColor.red != color.red ||
 		fState->currentColor.blue != color.blue ||
@@ -699,15 +912,9 @@ PDFWriter::SetColor(rgb_color color)
 int
 PDFWriter::FindPattern()
 {
-	// TODO: use hashtable instead of BList for fPatterns
-	const int n = fPatterns.CountItems();
-	for (int i = 0; i < n; i ++) {
-		Pattern* p = fPatterns.ItemAt(i);
-		if (p->Matches(fState->pattern0, fState->backgroundColor,
-				fState->foregroundColor))
-			return p->patternId;
-	}
-	return -1;
+	Pattern* p = fPatternTable.Find(PatternKey(fState->pattern0,
+		fState->backgroundColor, fState->foregroundColor));
+	return p != NULL ? p->patternId : -1;
 }
 
 
@@ -750,26 +957,37 @@ PDFWriter::CreatePattern()
 
 		if (is_transparent) continue;
 
-		uint8* data = (uint8*)fState->pattern0.data;
-		for (int8 y = 0; y <= 7; y ++, data ++) {
-			uint8  d = *data;
-			for (int8 x = 0; x <= 7; x ++, d >>= 1) {
-				if ((d & 1) == 1) { // foreground
-					if (pass != kPassForeground) continue;
-				} else { // background
-					if (pass != kPassBackground) continue;
+		// bit x of row y is set if pixel (x, y) has the color of this pass
+		uint8 rows[8];
+		const uint8* data = (const uint8*)fState->pattern0.data;
+		for (int y = 0; y <= 7; y ++) {
+			rows[y] = pass == kPassForeground ? data[y] : ~data[y];
+		}
+
+		// cover the pixels with rectangles built from horizontal runs
+		// that are extended downwards as far as possible, and fill them
+		// as one path
+		bool empty = true;
+		for (int y = 0; y <= 7; y ++) {
+			while (rows[y] != 0) {
+				int x = 0;
+				while ((rows[y] & (1 << x)) == 0) x ++;
+				int width = 0;
+				while (x + width <= 7 && (rows[y] & (1 << (x + width))) != 0)
+					width ++;
+
+				const uint8 run = (uint8)(((1 << width) - 1) << x);
+				int height = 0;
+				while (y + height <= 7 && (rows[y + height] & run) == run) {
+					rows[y + height] &= ~run;
+					height ++;
 				}
 
-				// create rectangle for pixel
-				float x1 = x + 1, y1 = y + 1;
-				PDF_moveto(fPdf, x, y);
-				PDF_lineto(fPdf, x, y1);
-				PDF_lineto(fPdf, x1, y1);
-				PDF_lineto(fPdf, x1, y);
-				PDF_closepath(fPdf);
-				PDF_fill(fPdf);
+				PDF_rect(fPdf, x, y, width, height);
+				empty = false;
 			}
 		}
+		if (!empty) PDF_fill(fPdf);
 	}
 
 	PDF_end_pattern(fPdf);
@@ -837,6 +1055,7 @@ PDFWriter::CreatePattern()
 	Pattern* p = new Pattern(fState->pattern0, fState->backgroundColor,
 		fState->foregroundColor, pattern);
 	fPatterns.AddItem(p);
+	fPatternTable.Insert(p);
 }
 
 
@@ -1305,13 +1524,11 @@ PDFWriter::ConvertFromRGBA15(uint8* in, uint8 *out)
 
 
 void
-PDFWriter::ConvertFromCMAP8(uint8* in, uint8 *out)
+PDFWriter::ConvertRowFromCMAP8(uint8* in, uint8 *out, int32 width)
 {
-	rgb_color c = fScreen->ColorForIndex(in[0]);
-	out[0] = c.blue;
-	out[1] = c.green;
-	out[2] = c.red;
-	out[3] = c.alpha;
+	uint32 *pixel = (uint32*)out;
+	for (int32 x = 0; x < width; x++)
+		pixel[x] = fCMAP8ToRGB32[in[x]];
 }
 
 
@@ -1328,7 +1545,8 @@ PDFWriter::ConvertFromGRAY8(uint8* in, uint8 *out)
 void
 PDFWriter::ConvertFromGRAY1(uint8* in, uint8 *out, int8 bit)
 {
-	uint8 gray = (in[0] & (1 << bit)) ? 255 : 0;
+	// most significant bit first, a set bit is black
+	uint8 gray = (in[0] & (0x80 >> bit)) ? 0 : 255;
 	out[0] = gray;
 	out[1] = gray;
 	out[2] = gray;
@@ -1405,10 +1623,79 @@ PDFWriter::ConvertFromRGBA15_BIG(uint8* in, uint8 *out)
 }
 
 
-//! Convert and clip bits to colorspace B_RGBA32
+/*!	Returns the color space ConvertBitmap() produces for \a pixelFormat.
+	Gray scale and indexed images keep their depth, everything else is
+	expanded to B_RGB32.
+*/
+color_space
+PDFWriter::ImageColorSpace(int32 pixelFormat)
+{
+#if USE_IMAGE_CACHE
+	switch (pixelFormat) {
+		case B_GRAY1:  // fall through
+		case B_GRAY8:  // fall through
+		case B_CMAP8:
+			return (color_space)pixelFormat;
+		default:
+			break;
+	}
+#endif
+	return B_RGB32;
+}
+
+
+//! Copies and clips the rows of an image ConvertBitmap() does not expand.
+void
+PDFWriter::CopyBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat,
+	void *data, BBitmap *bm)
+{
+	const int32 width = src.IntegerWidth() + 1;
+	const int32 height = src.IntegerHeight() + 1;
+	const int32 left = (int32)src.left;
+	uint8 *in = (uint8*)data + bytesPerRow * (int32)src.top;
+	uint8 *out = (uint8*)bm->Bits();
+
+	// keep the row padding defined, Image::Equals() compares it
+	memset(out, 0, bm->BitsLength());
+
+	for (int32 y = 0; y < height; y++) {
+		if (pixelFormat != B_GRAY1) {
+			memcpy(out, in + left, width);
+		} else {
+			const int32 length = (width + 7) / 8;
+			const int32 shift = left & 7;
+			const uint8 *bits = in + left / 8;
+			if (shift == 0) {
+				memcpy(out, bits, length);
+			} else {
+				// the last source byte must not be read beyond the row
+				const int32 last = (left + width - 1) / 8 - left / 8;
+				for (int32 i = 0; i < length; i++) {
+					uint8 next = i + 1 <= last ? bits[i + 1] : 0;
+					out[i] = (bits[i] << shift) | (next >> (8 - shift));
+				}
+			}
+			if ((width & 7) != 0)
+				out[length - 1] &= 0xff << (8 - (width & 7));
+		}
+		in += bytesPerRow;
+		out += bm->BytesPerRow();
+	}
+}
+
+
+/*!	Convert and clip bits to the colorspace returned by ImageColorSpace(),
+	which is B_RGB32 for all formats with more than 8 bits per pixel.
+	The converted rows are analyzed on the fly, and images that are
+	gray, black and white or have at most 256 colors are reduced to
+	B_GRAY8, B_GRAY1 or B_CMAP8. For B_CMAP8 results \a palette (256
+	entries) and \a paletteSize are set. Without \a reduce the result
+	only depends on \a pixelFormat.
+*/
 BBitmap *
 PDFWriter::ConvertBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat,
-	int32 flags, void *data)
+	int32 flags, void *data, rgb_color *palette, int32 *paletteSize,
+	bool reduce)
 {
 	uint8	*in;
 	uint8   *inLeft;
@@ -1424,13 +1711,28 @@ PDFWriter::ConvertBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat,
 
 	int32 width  = src.IntegerWidth();
 	int32 height = src.IntegerHeight();
-	BBitmap *bm = new BBitmap(BRect(0, 0, width, height), B_RGB32);
+	color_space colorSpace = ImageColorSpace(pixelFormat);
+	BBitmap *bm = new BBitmap(BRect(0, 0, width, height), colorSpace);
 	if (!bm->IsValid()) {
 		delete bm;
 		REPORT(kError, fPage, "BBitmap constructor failed");
 		return NULL;
 	}
 
+	*paletteSize = 0;
+	if (colorSpace != B_RGB32) {
+		CopyBitmap(src, bytesPerRow, pixelFormat, data, bm);
+		if (colorSpace == B_CMAP8) {
+			memcpy(palette, kSystemPalette, sizeof(kSystemPalette));
+			*paletteSize = 256;
+		}
+		return bm;
+	}
+
+#if USE_IMAGE_CACHE
+	ImageAnalyzer analyzer;
+#endif
+
 	inLeft  = (uint8 *)data;
 	inLeft += bytesPerRow * (int)src.top + bpp * (int)src.left;
 	outLeft	= (uint8*)bm->Bits();
@@ -1439,39 +1741,62 @@ PDFWriter::ConvertBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat,
 		in = inLeft;
 		out = outLeft;
 
-		for (x = 0; x <= width; x++) {
-			// For each pixel
-			switch (pixelFormat) {
-				case B_RGB32:      ConvertFromRGB32(in, out); break;
-				case B_RGBA32:     ConvertFromRGBA32(in, out); break;
-				case B_RGB24:      ConvertFromRGB24(in, out); break;
-				case B_RGB16:      ConvertFromRGB16(in, out); break;
-				case B_RGB15:      ConvertFromRGB15(in, out); break;
-				case B_RGBA15:     ConvertFromRGBA15(in, out); break;
-				case B_CMAP8:      ConvertFromCMAP8(in, out); break;
-				case B_GRAY8:      ConvertFromGRAY8(in, out); break;
-				case B_GRAY1:
-					bit = x & 7;
-					ConvertFromGRAY1(in, out, bit);
-					if (bit == 7) in ++;
-					break;
-				case B_RGB32_BIG:  ConvertFromRGB32_BIG(in, out); break;
-				case B_RGBA32_BIG: ConvertFromRGBA32_BIG(in, out); break;
-				case B_RGB24_BIG:  ConvertFromRGB24_BIG(in, out); break;
-				case B_RGB16_BIG:  ConvertFromRGB16_BIG(in, out); break;
-				case B_RGB15_BIG:  ConvertFromRGB15_BIG(in, out); break;
-				case B_RGBA15_BIG: ConvertFromRGBA15_BIG(in, out); break;
-				default:; // should not reach here
+		if (pixelFormat == B_CMAP8) {
+			ConvertRowFromCMAP8(in, out, width + 1);
+		} else {
+			for (x = 0; x <= width; x++) {
+				// For each pixel
+				switch (pixelFormat) {
+					case B_RGB32:      ConvertFromRGB32(in, out); break;
+					case B_RGBA32:     ConvertFromRGBA32(in, out); break;
+					case B_RGB24:      ConvertFromRGB24(in, out); break;
+					case B_RGB16:      ConvertFromRGB16(in, out); break;
+					case B_RGB15:      ConvertFromRGB15(in, out); break;
+					case B_RGBA15:     ConvertFromRGBA15(in, out); break;
+					case B_GRAY8:      ConvertFromGRAY8(in, out); break;
+					case B_GRAY1:
+						bit = x & 7;
+						ConvertFromGRAY1(in, out, bit);
+						if (bit == 7) in ++;
+						break;
+					case B_RGB32_BIG:  ConvertFromRGB32_BIG(in, out); break;
+					case B_RGBA32_BIG: ConvertFromRGBA32_BIG(in, out); break;
+					case B_RGB24_BIG:  ConvertFromRGB24_BIG(in, out); break;
+					case B_RGB16_BIG:  ConvertFromRGB16_BIG(in, out); break;
+					case B_RGB15_BIG:  ConvertFromRGB15_BIG(in, out); break;
+					case B_RGBA15_BIG: ConvertFromRGBA15_BIG(in, out); break;
+					default:; // should not reach here
+				}
+				in += bpp;	// next pixel
+				out += 4;
 			}
-			in += bpp;	// next pixel
-			out += 4;
 		}
 
+#if USE_IMAGE_CACHE
+		if (reduce)
+			analyzer.AnalyzeRow((uint32*)outLeft, width + 1);
+#endif
+
 		// next row
 		inLeft += bytesPerRow;
 		outLeft += bm->BytesPerRow();
 	}
 
+#if USE_IMAGE_CACHE
+	BBitmap *reduced = reduce ? analyzer.Reduce(bm) : NULL;
+	if (reduced != NULL) {
+		REPORT(kDebug, fPage, "Image reduced to color space %d",
+			(int)reduced->ColorSpace());
+		delete bm;
+		bm = reduced;
+		if (bm->ColorSpace() == B_CMAP8) {
+			memcpy(palette, analyzer.Palette(),
+				analyzer.PaletteSize() * sizeof(rgb_color));
+			*paletteSize = analyzer.PaletteSize();
+		}
+	}
+#endif
+
 	return bm;
 }
 
@@ -1544,10 +1869,273 @@ PDFWriter::StoreTranslatorBitmap(BBitmap *bitmap, const char *filename,
 }
 
 
+/*!	Counts the distinct colors of the B_RGB32 \a bitmap and returns true
+	as soon as there are more than kPhotographicColors of them.
+	Line art and screen shots have much fewer colors and should not
+	suffer from JPEG artifacts.
+*/
+bool
+PDFWriter::IsPhotographic(BBitmap* bitmap)
+{
+	const int32 width = bitmap->Bounds().IntegerWidth() + 1;
+	const int32 height = bitmap->Bounds().IntegerHeight() + 1;
+	if (width * height < kMinPhotographicPixels)
+		return false;
+
+	// open addressing hash set, load factor stays below 25%
+	const int32 kSize = kPhotographicColors * 4;
+	const uint32 kEmpty = 0xffffffff;
+	uint32 *colors = new uint32[kSize];
+	memset(colors, 0xff, kSize * sizeof(uint32));
+
+	int32 count = 0;
+	uint32 previous = kEmpty;
+	uint8 *row = (uint8*)bitmap->Bits();
+	for (int32 y = 0; y < height; y++, row += bitmap->BytesPerRow()) {
+		uint32 *in = (uint32*)row;
+		for (int32 x = 0; x < width; x++) {
+			const uint32 color = in[x] & 0x00ffffff;
+			if (color == previous)
+				continue;
+			previous = color;
+
+			uint32 i = (uint32)(color * 2654435761U) >> 20;
+				// kSize is 4096, use the upper 12 bits of the product
+			while (colors[i] != kEmpty && colors[i] != color)
+				i = (i + 1) & (kSize - 1);
+			if (colors[i] == kEmpty) {
+				colors[i] = color;
+				if (++count > kPhotographicColors) {
+					delete[] colors;
+					return true;
+				}
+			}
+		}
+	}
+
+	delete[] colors;
+	return false;
+}
+
+
+/*!	Returns true if the converted \a bitmap has only one color and
+	stores it in \a color. Reduced B_RGB32 images of one color are
+	B_CMAP8 images with a single palette entry, images that kept their
+	source depth are scanned until the first differing pixel.
+*/
+bool
+PDFWriter::IsUniform(BBitmap* bitmap, const rgb_color* palette,
+	int32 paletteSize, rgb_color* color)
+{
+	const color_space colorSpace = bitmap->ColorSpace();
+	if (colorSpace == B_CMAP8 && paletteSize == 1) {
+		*color = palette[0];
+		return true;
+	}
+	if (colorSpace != B_CMAP8 && colorSpace != B_GRAY8
+		&& colorSpace != B_GRAY1)
+		return false;
+
+	const int32 width = bitmap->Bounds().IntegerWidth() + 1;
+	const int32 height = bitmap->Bounds().IntegerHeight() + 1;
+	const uint8 *row = (const uint8*)bitmap->Bits();
+	uint8 first = row[0];
+	int32 length = width;
+	uint8 lastMask = 0xff;
+	if (colorSpace == B_GRAY1) {
+		first = (first & 0x80) ? 0xff : 0;
+		length = width / 8;
+		if ((width & 7) != 0)
+			lastMask = 0xff << (8 - (width & 7));
+	}
+
+	for (int32 y = 0; y < height; y++, row += bitmap->BytesPerRow()) {
+		for (int32 x = 0; x < length; x++) {
+			if (row[x] != first)
+				return false;
+		}
+		if (length < (width + 7) / 8
+			&& (row[length] & lastMask) != (first & lastMask))
+			return false;
+	}
+
+	switch (colorSpace) {
+		case B_CMAP8:
+			*color = palette[first];
+			break;
+		case B_GRAY1:
+			// a set bit is black
+			first = ~first;
+			// fall through
+		default:
+			color->red = color->green = color->blue = first;
+			color->alpha = 255;
+			break;
+	}
+	return true;
+}
+
+
+#if USE_IMAGE_CACHE
+/*!	Source of an image that exceeds kMaxBufferedPixels. The bitmap is
+	converted kImageBandHeight rows at a time, so neither the converted
+	image nor its mask is ever held in memory completely.
+*/
+class BitmapBands : public BandedImage {
+public:
+	BitmapBands(PDFWriter *writer, BRect src, int32 bytesPerRow,
+		int32 pixelFormat, int32 flags, void *data, int compression)
+		:
+		fWriter(writer),
+		fSource(src),
+		fBytesPerRow(bytesPerRow),
+		fPixelFormat(pixelFormat),
+		fFlags(flags),
+		fData(data),
+		fCompression(compression),
+		fHasFingerprint(false)
+	{
+	}
+
+	int32 Width() const { return fSource.IntegerWidth() + 1; }
+	int32 Height() const { return fSource.IntegerHeight() + 1; }
+	int32 PixelFormat() const { return fPixelFormat; }
+
+	uint64 Fingerprint()
+	{
+		if (fHasFingerprint)
+			return fFingerprint;
+
+		// checksums of the clipped source rows
+		const int32 left = (int32)fSource.left;
+		int32 bpp = fWriter->BytesPerPixel(fPixelFormat);
+		int32 offset = bpp * left;
+		int32 length = bpp * Width();
+		if (bpp == 0) {
+			offset = left / 8;
+			length = (left + Width() - 1) / 8 - offset + 1;
+		}
+
+		const uint8 *row = (uint8*)fData
+			+ fBytesPerRow * (int32)fSource.top + offset;
+		uLong crc = crc32(0, NULL, 0);
+		uLong adler = adler32(0, NULL, 0);
+		for (int32 y = 0; y < Height(); y++, row += fBytesPerRow) {
+			crc = crc32(crc, row, length);
+			adler = adler32(adler, row, length);
+		}
+		fFingerprint = ((uint64)crc << 32) | (uint32)adler;
+		fHasFingerprint = true;
+		return fFingerprint;
+	}
+
+	bool Store(const char *imageFile, const char *maskFile, int *maskBPC)
+	{
+		const int32 width = Width();
+		const int32 height = Height();
+		const color_space colorSpace
+			= fWriter->ImageColorSpace(fPixelFormat);
+
+		int colorType;
+		int bitDepth;
+		PNGWriter::FormatFor(colorSpace, 256, &colorType, &bitDepth);
+
+		const rgb_color *palette = NULL;
+		if (colorSpace == B_CMAP8)
+			palette = kSystemPalette;
+
+		PNGWriter image;
+		if (image.Begin(imageFile, width, height, colorType, bitDepth,
+				palette, palette != NULL ? 256 : 0, fCompression) != B_OK)
+			return false;
+
+		// the mask is written as 1 or 8 bit gray image, its samples are
+		// the same as in the raw masks of the image cache
+		const bool hasAlpha = fWriter->HasAlphaChannel(fPixelFormat);
+		const bool softMask = !fWriter->NeedsBPC1Mask(fPixelFormat)
+			&& fWriter->SupportsSoftMask();
+		*maskBPC = softMask ? 8 : 1;
+		const int32 maskBytesPerRow = softMask ? width : (width + 7) / 8;
+		PNGWriter mask;
+		if (hasAlpha && mask.Begin(maskFile, width, height, PNGWriter::kGray,
+				*maskBPC, NULL, 0, fCompression) != B_OK)
+			return false;
+
+		uint8 *opaque = NULL;
+		if (hasAlpha) {
+			opaque = new uint8[maskBytesPerRow];
+			memset(opaque, softMask ? 255 : 0, maskBytesPerRow);
+		}
+
+		bool transparent = false;
+		bool ok = true;
+		for (int32 top = 0; ok && top < height; top += kImageBandHeight) {
+			BRect band(fSource);
+			band.top = fSource.top + top;
+			band.bottom = min_c(band.top + kImageBandHeight, fSource.bottom + 1)
+				- 1;
+			const int32 rows = band.IntegerHeight() + 1;
+
+			rgb_color bandPalette[256];
+			int32 bandPaletteSize;
+			BBitmap *bm = fWriter->ConvertBitmap(band, fBytesPerRow,
+				fPixelFormat, fFlags, fData, bandPalette, &bandPaletteSize,
+				false);
+			ok = bm != NULL && image.WriteBitmap(bm) == B_OK;
+			delete bm;
+
+			if (!ok || !hasAlpha)
+				continue;
+
+			uint8 *bandMask = softMask
+				? fWriter->CreateSoftMask(band, fBytesPerRow, fPixelFormat,
+					fFlags, fData)
+				: fWriter->CreateMask(band, fBytesPerRow, fPixelFormat, fFlags,
+					fData);
+			if (bandMask != NULL)
+				transparent = true;
+			for (int32 y = 0; ok && y < rows; y++) {
+				ok = mask.WriteRow(bandMask != NULL
+					? bandMask + y * maskBytesPerRow : opaque) == B_OK;
+			}
+			delete[] bandMask;
+		}
+		delete[] opaque;
+
+		ok = ok && image.End() == B_OK;
+		if (hasAlpha)
+			ok = ok && mask.End() == B_OK;
+
+		if (!transparent) {
+			*maskBPC = 0;
+			unlink(maskFile);
+		}
+		return ok;
+	}
+
+private:
+	PDFWriter	*fWriter;
+	BRect		fSource;
+	int32		fBytesPerRow;
+	int32		fPixelFormat;
+	int32		fFlags;
+	void		*fData;
+	int			fCompression;
+	bool		fHasFingerprint;
+	uint64		fFingerprint;
+};
+#endif	// USE_IMAGE_CACHE
+
+
+/*!	Returns the image and mask of \a src in \a image and \a maskId.
+	If \a solidColor is given and the image turns out to be one opaque
+	color, no image is created, \a image is set to -1 and the color
+	is returned in \a solidColor instead.
+*/
 bool
 PDFWriter::GetImages(BRect src, int32 /*width*/, int32 /*height*/,
 	int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data, int* maskId,
-	int* image)
+	int* image, rgb_color* solidColor)
 {
 	uint8 *mask = NULL;
 	*maskId = -1;
@@ -1558,6 +2146,15 @@ PDFWriter::GetImages(BRect src, int32 /*width*/, int32 /*height*/,
 	int length = 0;
 	int bpc = 0;
 
+#if USE_IMAGE_CACHE
+	if ((int64)width * height > kMaxBufferedPixels) {
+		BitmapBands bands(this, src, bytesPerRow, pixelFormat, flags, data,
+			fImageCache.Compression());
+		*image = fImageCache.GetStreamedImage(fPdf, &bands, maskId);
+		return *image >= 0;
+	}
+#endif
+
 	if (HasAlphaChannel(pixelFormat)) {
 		if (NeedsBPC1Mask(pixelFormat) || !SupportsSoftMask()) {
 			int32 w = (width+7)/8;
@@ -1588,7 +2185,10 @@ PDFWriter::GetImages(BRect src, int32 /*width*/, int32 /*height*/,
 		delete []mask;
 	}
 
-	BBitmap * bm = ConvertBitmap(src, bytesPerRow, pixelFormat, flags, data);
+	rgb_color palette[256];
+	int32 paletteSize;
+	BBitmap * bm = ConvertBitmap(src, bytesPerRow, pixelFormat, flags, data,
+		palette, &paletteSize);
 	if (!bm) {
 		REPORT(kError, fPage, "ConvertBitmap failed!");
 #if !USE_IMAGE_CACHE
@@ -1598,7 +2198,20 @@ PDFWriter::GetImages(BRect src, int32 /*width*/, int32 /*height*/,
 	}
 
 #if USE_IMAGE_CACHE
-	*image = fImageCache.GetImage(fPdf, bm, *maskId);
+	if (solidColor != NULL && *maskId == -1
+		&& IsUniform(bm, palette, paletteSize, solidColor)) {
+		delete bm;
+		*image = -1;
+		return true;
+	}
+
+	// photographic images without transparency can be stored lossy
+	int quality = 0;
+	if (fJPEGQuality > 0 && *maskId == -1 && bm->ColorSpace() == B_RGB32
+		&& IsPhotographic(bm))
+		quality = fJPEGQuality;
+	*image = fImageCache.GetImage(fPdf, bm, *maskId,
+		paletteSize > 0 ? palette : NULL, paletteSize, quality);
 	delete bm;
 #else
 	char *pdfLibFormat   = "png";
@@ -1845,13 +2458,13 @@ PDFWriter::PaintArc(BPoint center, BPoint radii, float startTheta,
 	if (!MakesPDF()) return;
 	if (IsClipping()); // TODO clip to line path
 
-	PDF_save(fPdf);
+	SaveGState();
 	PDF_scale(fPdf, sx, sy);
-	PDF_setlinewidth(fPdf, fState->penSize / smax);
+	SetLineWidth(fState->penSize / smax);
 	PDF_arc(fPdf, tx(center.x) / sx, ty(center.y) / sy, 1, startTheta,
 		startTheta + arcTheta);
 	Paint(stroke);
-	PDF_restore(fPdf);
+	RestoreGState();
 }
 
 
@@ -2104,21 +2717,62 @@ PDFWriter::DrawPixels(BRect src, BRect dest, int32 width, int32 height,
 		return;
 	}
 
+	// clipping bounds are tracked in both passes, so both get the
+	// same images
+	if (!CropToClipBounds(src, dest)) {
+		REPORT(kDebug, fPage, "DrawPixels outside of clipping region");
+		return;
+	}
+
 	int maskId, image;
+	rgb_color solidColor;
 
 	if (!GetImages(src, width, height, bytesPerRow, pixelFormat, flags, data,
-			&maskId, &image)) {
+			&maskId, &image, &solidColor)) {
+		return;
+	}
+
+	if (image == -1) {
+		FlushTiles();
+		if (!MakesPDF()) return;
+
+		// the image has one opaque color, fill its area instead
+		REPORT(kDebug, fPage, "DrawPixels as rectangle of color (%d, %d, %d)",
+			solidColor.red, solidColor.green, solidColor.blue);
+		BeginTransparency();
+		SaveGState();
+		PDF_setcolor(fPdf, "fill", "rgb", solidColor.red / 255.0,
+			solidColor.green / 255.0, solidColor.blue / 255.0, 0.0);
+		PDF_rect(fPdf, tx(dest.left), ty(dest.bottom), scale(dest.Width() + 1),
+			scale(dest.Height() + 1));
+		PDF_fill(fPdf);
+		RestoreGState();
+		EndTransparency();
 		return;
 	}
-	if (!MakesPDF()) return;
 
 	const float scaleX = (dest.Width()+1) / (src.Width()+1);
 	const float scaleY = (dest.Height()+1) / (src.Height()+1);
 
+#if USE_IMAGE_CACHE
+	AddTile(image, tx(dest.left), ty(dest.bottom), scale(dest.Width() + 1),
+		scale(dest.Height() + 1), scaleX, scaleY);
+#else
+	if (!MakesPDF()) return;
+	PlaceImage(image, maskId, tx(dest.left), ty(dest.bottom), scaleX, scaleY);
+#endif
+}
+
+
+//! Places \a image with its lower left corner at \a x, \a y.
+void
+PDFWriter::PlaceImage(int image, int maskId, float x, float y, float scaleX,
+	float scaleY)
+{
 	const bool needs_scaling = scaleX != 1.0 || scaleY != 1.0;
 
 	if (needs_scaling) {
-		PDF_save(fPdf);
+		SaveGState();
 		PDF_scale(fPdf, scaleX, scaleY);
 	}
 
@@ -2129,24 +2783,169 @@ PDFWriter::DrawPixels(BRect src, BRect dest, int32 width, int32 height,
 	// supports them.
 	BeginTransparency();
 
-	float x = tx(dest.left)   / scaleX;
-	float y = ty(dest.bottom) / scaleY;
-
-	if ( image >= 0 ) {
-		PDF_place_image(fPdf, image, x, y, scale(1.0));
-#if !USE_IMAGE_CACHE
-		PDF_close_image(fPdf, image);
-#endif
-	} else {
-		REPORT(kError, fPage, "PDF_open_image_file failed!");
-	}
-
+	PDF_place_image(fPdf, image, x / scaleX, y / scaleY, scale(1.0));
 #if !USE_IMAGE_CACHE
+	PDF_close_image(fPdf, image);
 	if (maskId != -1) PDF_close_image(fPdf, maskId);
 #endif
+
 	EndTransparency();
 
-	if (needs_scaling) PDF_restore(fPdf);
+	if (needs_scaling) RestoreGState();
+}
+
+
+/*!	Defers the placement of \a image, so that a series of placements
+	on a regular grid can be drawn as one tiling pattern. The pending
+	tiles are flushed before any other drawing operation or state
+	change. \a width and \a height are the size of the image on the
+	page.
+*/
+void
+PDFWriter::AddTile(int image, float x, float y, float width, float height,
+	float scaleX, float scaleY)
+{
+	TileRun &run = fTileRun;
+	if (run.count > 0 && run.Matches(image, width, height, scaleX, scaleY)) {
+		if (run.columns == 0 && run.count > 1
+			&& TileRun::Same(x, run.left)
+			&& TileRun::Same(fabs(y - run.bottom), height)) {
+			// first tile of the second row
+			run.columns = run.count;
+			run.rowStep = y - run.bottom;
+		}
+		BPoint next = run.Position(run.count);
+		if (TileRun::Same(x, next.x) && TileRun::Same(y, next.y)) {
+			run.count++;
+			return;
+		}
+	}
+
+	FlushTiles();
+
+	run.image = image;
+	run.left = x;
+	run.bottom = y;
+	run.width = width;
+	run.height = height;
+	run.scaleX = scaleX;
+	run.scaleY = scaleY;
+	run.scale = scale(1.0);
+	run.rowStep = 0;
+	run.columns = 0;
+	run.count = 1;
+}
+
+
+/*!	Draws the pending tiles. The complete rows of a run with at least
+	kMinPatternTiles tiles are filled with a tiling pattern, which is
+	created in the first pass, the remaining tiles are placed one by
+	one.
+*/
+void
+PDFWriter::FlushTiles()
+{
+	TileRun &run = fTileRun;
+	if (run.count == 0)
+		return;
+
+	const int32 columns = run.columns > 0 ? run.columns : run.count;
+	const int32 rows = run.count / columns;
+	int32 placed = 0;
+
+	if (rows * columns >= kMinPatternTiles) {
+		// the lowest row is the last one if rows are added downwards
+		const float bottom = min_c(run.bottom,
+			run.bottom + (rows - 1) * run.rowStep);
+		float phaseX = fmodf(run.left, run.width);
+		if (phaseX < 0)
+			phaseX += run.width;
+		float phaseY = fmodf(bottom, run.height);
+		if (phaseY < 0)
+			phaseY += run.height;
+
+		int pattern = FindTilePattern(run.image, run.width, run.height,
+			phaseX, phaseY);
+		if (MakesPattern()) {
+			if (pattern == -1)
+				CreateTilePattern(phaseX, phaseY);
+			placed = rows * columns;
+		} else if (pattern != -1) {
+			REPORT(kDebug, fPage, "Tiling pattern for %ld x %ld images",
+				columns, rows);
+			BeginTransparency();
+			SaveGState();
+			PDF_setcolor(fPdf, "fill", "pattern", pattern, 0, 0, 0);
+			PDF_rect(fPdf, run.left, bottom, columns * run.width,
+				rows * run.height);
+			PDF_fill(fPdf);
+			RestoreGState();
+			EndTransparency();
+			placed = rows * columns;
+		} else {
+			REPORT(kError, fPage, "tiling pattern missing!");
+		}
+	}
+
+	if (MakesPDF()) {
+		for (int32 i = placed; i < run.count; i++) {
+			BPoint p = run.Position(i);
+			PlaceImage(run.image, -1, p.x, p.y, run.scaleX, run.scaleY);
+		}
+	}
+	run.count = 0;
+}
+
+
+int
+PDFWriter::FindTilePattern(int image, float width, float height,
+	float phaseX, float phaseY)
+{
+	const int n = fTilePatterns.CountItems();
+	for (int i = 0; i < n; i++) {
+		TilePattern* p = fTilePatterns.ItemAt(i);
+		if (p->Matches(image, width, height, phaseX, phaseY))
+			return p->patternId;
+	}
+	return -1;
+}
+
+
+/*!	Creates a pattern cell of the size of one tile. Pattern space is the
+	default page space, so the image is shifted by the phase of the grid
+	and drawn together with the neighbours that reach into the cell.
+*/
+void
+PDFWriter::CreateTilePattern(float phaseX, float phaseY)
+{
+	const TileRun &run = fTileRun;
+	int pattern = PDF_begin_pattern(fPdf, run.width, run.height, run.width,
+		run.height, 1);
+	if (pattern == -1) {
+		REPORT(kError, fPage, "CreateTilePattern could not create pattern");
+		return;
+	}
+
+	PDF_scale(fPdf, run.scaleX, run.scaleY);
+	for (int dy = 0; dy <= 1; dy++) {
+		for (int dx = 0; dx <= 1; dx++) {
+			const float x = phaseX - dx * run.width;
+			const float y = phaseY - dy * run.height;
+			PDF_place_image(fPdf, run.image, x / run.scaleX, y / run.scaleY,
+				run.scale);
+		}
+	}
+	PDF_end_pattern(fPdf);
+
+	fTilePatterns.AddItem(new TilePattern(run.image, run.width, run.height,
+		phaseX, phaseY, pattern));
+}
+
+
+void
+PDFWriter::BeginOp()
+{
+	FlushTiles();
 }
 
 
@@ -2158,6 +2957,16 @@ PDFWriter::SetClippingRects(BRect *rects, uint32 numRects)
 	REPORT(kDebug, fPage, "SetClippingRects numRects=%ld\nrects=", \
 			numRects);
 
+	if (numRects > 0) {
+		BRect bounds = rects[0];
+		for (i = 1; i < numRects; i++)
+			bounds = bounds | rects[i];
+		PDFSystem *system = pdfSystem();
+		IntersectClipBounds(BRect(system->px(bounds.left),
+			system->py(bounds.top), system->px(bounds.right + 1),
+			system->py(bounds.bottom + 1)));
+	}
+
 	if (!MakesPDF()) return;
 
 	for ( i = 0; i < numRects; i++, rects++ ) {
@@ -2173,6 +2982,73 @@ PDFWriter::SetClippingRects(BRect *rects, uint32 numRects)
 }
 
 
+/*!	Narrows the tracked clipping bounds like PDF_clip() narrows the
+	clipping path. As the bounds live in the State and not in the PDF
+	graphics state they can only get larger than the real clipping
+	region, never smaller.
+*/
+void
+PDFWriter::IntersectClipBounds(BRect bounds)
+{
+	if (fState->clipped)
+		bounds = bounds & fState->clipBounds;
+	fState->clipBounds = bounds;
+	fState->clipped = true;
+}
+
+
+/*!	Reduces \a src and \a dest to the part of an image that is inside
+	the clipping bounds, plus a margin of kClipMargin source pixels
+	for resampling. Returns false if no part of the image is visible.
+*/
+bool
+PDFWriter::CropToClipBounds(BRect &src, BRect &dest)
+{
+	if (!fState->clipped)
+		return true;
+
+	const BRect clip = fState->clipBounds;
+	if (!clip.IsValid())
+		return false;
+
+	// visible part of dest as pixel edges in view coordinates
+	PDFSystem *system = pdfSystem();
+	const float left = max_c(dest.left, system->lx(clip.left));
+	const float top = max_c(dest.top, system->ly(clip.top));
+	const float right = min_c(dest.right + 1, system->lx(clip.right));
+	const float bottom = min_c(dest.bottom + 1, system->ly(clip.bottom));
+	if (left >= right || top >= bottom)
+		return false;
+
+	const float scaleX = (dest.Width() + 1) / (src.Width() + 1);
+	const float scaleY = (dest.Height() + 1) / (src.Height() + 1);
+
+	BRect visible;
+	visible.left = max_c(src.left,
+		floorf(src.left + (left - dest.left) / scaleX) - kClipMargin);
+	visible.top = max_c(src.top,
+		floorf(src.top + (top - dest.top) / scaleY) - kClipMargin);
+	visible.right = min_c(src.right,
+		ceilf(src.left + (right - dest.left) / scaleX) - 1 + kClipMargin);
+	visible.bottom = min_c(src.bottom,
+		ceilf(src.top + (bottom - dest.top) / scaleY) - 1 + kClipMargin);
+
+	if (visible.left == src.left && visible.top == src.top
+		&& visible.right == src.right && visible.bottom == src.bottom)
+		return true;
+
+	REPORT(kDebug, fPage, "Image cropped to [%f, %f, %f, %f]",
+		visible.left, visible.top, visible.right, visible.bottom);
+
+	dest.Set(dest.left + (visible.left - src.left) * scaleX,
+		dest.top + (visible.top - src.top) * scaleY,
+		dest.left + (visible.right + 1 - src.left) * scaleX - 1,
+		dest.top + (visible.bottom + 1 - src.top) * scaleY - 1);
+	src = visible;
+	return true;
+}
+
+
 void
 PDFWriter::PushState()
 {
@@ -2180,7 +3056,7 @@ PDFWriter::PushState()
 	PushInternalState();
 //	LOG((fLog, "height = %f x0 = %f y0 = %f", fState->height, fState->x0, fState->y0));
 	if (!MakesPDF()) return;
-	PDF_save(fPdf);
+	SaveGState();
 }
 
 
@@ -2190,7 +3066,7 @@ PDFWriter::PopState()
 	REPORT(kDebug, fPage, "PopState");
 	if (PopInternalState()) {
 		if (!MakesPDF()) return;
-		PDF_restore(fPdf);
+		RestoreGState();
 	}
 }
 
@@ -2274,7 +3150,7 @@ PDFWriter::SetLineMode(cap_mode capMode, join_mode joinMode, float miterLimit)
 		case B_ROUND_CAP:  m = 1; break;
 		case B_SQUARE_CAP: m = 2; break;
 	}
-	PDF_setlinecap(fPdf, m);
+	SetLineCap(m);
 
 	m = 0;
 	switch (joinMode) {
@@ -2284,9 +3160,9 @@ PDFWriter::SetLineMode(cap_mode capMode, join_mode joinMode, float miterLimit)
 		case B_SQUARE_JOIN: // fall through TODO: check this too
 		case B_BEVEL_JOIN: m = 2; break;
 	}
-	PDF_setlinejoin(fPdf, m);
+	SetLineJoin(m);
 
-	PDF_setmiterlimit(fPdf, miterLimit);
+	SetMiterLimit(miterLimit);
 
 }
 
@@ -2303,7 +3179,7 @@ PDFWriter::SetPenSize(float size)
 	if (!MakesPDF())
 		return;
 
-	PDF_setlinewidth(fPdf, size);
+	SetLineWidth(size);
 }
 
 
@@ -2362,7 +3238,9 @@ PDFWriter::SetFontFamily(char *family)
 {
 	REPORT(kDebug, fPage, "SetFontFamily family=\"%s\"", family);
 
-	fState->beFont.SetFamilyAndStyle(family, NULL);
+	BFont font(CurrentFont());
+	font.SetFamilyAndStyle(family, NULL);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2371,7 +3249,9 @@ PDFWriter::SetFontStyle(char *style)
 {
 	REPORT(kDebug, fPage, "SetFontStyle style=\"%s\"", style);
 
-	fState->beFont.SetFamilyAndStyle(NULL, style);
+	BFont font(CurrentFont());
+	font.SetFamilyAndStyle(NULL, style);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2381,7 +3261,9 @@ PDFWriter::SetFontSpacing(int32 spacing)
 	REPORT(kDebug, fPage, "SetFontSpacing spacing=%ld", spacing);
 	// XXX scaling required?
 	// if it is, do it when the font is used...
-	fState->beFont.SetSpacing(spacing);
+	BFont font(CurrentFont());
+	font.SetSpacing(spacing);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2390,7 +3272,9 @@ PDFWriter::SetFontSize(float size)
 {
 	REPORT(kDebug, fPage, "SetFontSize size=%f", size);
 
-	fState->beFont.SetSize(size);
+	BFont font(CurrentFont());
+	font.SetSize(size);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2398,7 +3282,9 @@ void
 PDFWriter::SetFontRotate(float rotation)
 {
 	REPORT(kDebug, fPage, "SetFontRotate rotation=%f", rotation);
-	fState->beFont.SetRotation(RAD2DEGREE(rotation));
+	BFont font(CurrentFont());
+	font.SetRotation(RAD2DEGREE(rotation));
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2406,7 +3292,9 @@ void
 PDFWriter::SetFontEncoding(int32 encoding)
 {
 	REPORT(kDebug, fPage, "SetFontEncoding encoding=%ld", encoding);
-	fState->beFont.SetEncoding(encoding);
+	BFont font(CurrentFont());
+	font.SetEncoding(encoding);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2414,7 +3302,9 @@ void
 PDFWriter::SetFontFlags(int32 flags)
 {
 	REPORT(kDebug, fPage, "SetFontFlags flags=%ld (0x%lx)", flags, flags);
-	fState->beFont.SetFlags(flags);
+	BFont font(CurrentFont());
+	font.SetFlags(flags);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
@@ -2422,7 +3312,9 @@ void
 PDFWriter::SetFontShear(float shear)
 {
 	REPORT(kDebug, fPage, "SetFontShear shear=%f", shear);
-	fState->beFont.SetShear(shear);
+	BFont font(CurrentFont());
+	font.SetShear(shear);
+	fState->fontId = fFontTable.Intern(font);
 }
 
 
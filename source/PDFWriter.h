@@ -20,6 +20,8 @@
 #include "PrinterDriver.h"
 #include "PictureIterator.h"
 #include "Fonts.h"
+#include "FontTable.h"
+#include "UTF8Decoder.h"
 #include "SubPath.h"
 #include "PrintUtils.h"
 #include "Link.h"
@@ -47,6 +49,7 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 	friend class Bookmark;
 	friend class LocalLink;
 	friend class TextLine;
+	friend class BitmapBands;
 
 	public:
 		// constructors / destructor
@@ -107,14 +110,29 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 		inline void ConvertFromRGBA15_BIG(uint8* in, uint8* out);
 		inline void ConvertFromRGB15_BIG(uint8* in, uint8* out);
 		inline void ConvertFromRGBA15(uint8* in, uint8* out);
-		inline void ConvertFromCMAP8(uint8* in, uint8* out);
+		inline void ConvertRowFromCMAP8(uint8* in, uint8* out, int32 width);
 		inline void ConvertFromGRAY8(uint8* in, uint8* out);
 		inline void ConvertFromGRAY1(uint8* in, uint8* out, int8 bit);
 
 		uint8		*CreateMask(BRect src, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data);
 		uint8		*CreateSoftMask(BRect src, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data);
-		BBitmap		*ConvertBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data);
-		bool		GetImages(BRect src, int32 width, int32 height, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data, int* mask, int* image);
+		color_space	ImageColorSpace(int32 pixelFormat);
+		void		CopyBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat, void *data, BBitmap *bm);
+		BBitmap		*ConvertBitmap(BRect src, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data, rgb_color *palette, int32 *paletteSize, bool reduce = true);
+		bool		IsPhotographic(BBitmap* bitmap);
+		bool		IsUniform(BBitmap* bitmap, const rgb_color* palette, int32 paletteSize, rgb_color* color);
+		bool		GetImages(BRect src, int32 width, int32 height, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data, int* mask, int* image, rgb_color* solidColor = NULL);
+
+		// Image tiling
+		void		PlaceImage(int image, int maskId, float x, float y, float scaleX, float scaleY);
+		void		AddTile(int image, float x, float y, float width, float height, float scaleX, float scaleY);
+		void		FlushTiles();
+		int			FindTilePattern(int image, float width, float height, float phaseX, float phaseY);
+		void		CreateTilePattern(float phaseX, float phaseY);
+
+		// Clipping bounds
+		void		IntersectClipBounds(BRect bounds);
+		bool		CropToClipBounds(BRect &src, BRect &dest);
 
 		// String handling
 		bool		BeginsChar(char byte) { return BEGINS_CHAR(byte); }
@@ -122,8 +140,13 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 		void		ToUnicode(const char *string, BString &unicode);
 		void		ToPDFUnicode(const char *string, BString &unicode);
 		uint16		CodePointSize(const char *s);
-		void		DrawChar(uint16 unicode, const char *utf8, int16 size);
-		void		ClipChar(BFont* font, const char* unicode, const char *utf8, int16 size, float width);
+		void		DrawChar(uint16 unicode, const char *utf8, int16 size,
+						float advance);
+		float		PDFGlyphWidth(int font, uint8 code);
+		uint16		ResolveCodePoint(uint16 unicode, const char *utf8, int16 size);
+		void		ShowGlyphs(int font, float x, float y, const char *text, int32 length);
+		void		FlushGlyphRun();
+		void		ClipChar(const BFont* font, const char* unicode, const char *utf8, int16 size, float width);
 		bool   		EmbedFont(const char* n);
 		void		DeclareEncodingFiles();
 		void		DeclareEncodingFile(BPath* path, const char* id,
@@ -152,6 +175,7 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 		void		DrawString(char *string, float deltax, float deltay);
 		void		DrawPixels(BRect src, BRect dest, int32 width, int32 height, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data);
 		void		SetClippingRects(BRect *rects, uint32 numRects);
+		void		BeginOp();
 		void    	ClipToPicture(BPicture *picture, BPoint point, bool clip_to_inverse_picture);
 		void		PushState();
 		void		PopState();
@@ -193,8 +217,11 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 		{
 		public:
 			State			*prev;
-			BFont           beFont;
+			int32           fontId;     // in fFontTable
 			int				font;
+			// font and encoding the PDF font handle font was found for
+			int32           fontHandleId;
+			font_encoding   fontHandleEncoding;
 			PDFSystem       pdfSystem;
 			float			penX;
 			float			penY;
@@ -208,6 +235,10 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 			float           penSize;
 			pattern         pattern0;
 			int32           fontSpacing;
+			// bounds of the clipping region in page coordinates,
+			// pixel edges; only valid if clipped is set
+			bool            clipped;
+			BRect           clipBounds;
 
 			// initialize with defalt values
 			State(float h = a4_height, float x = 0, float y = 0)
@@ -215,7 +246,10 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 				static rgb_color white    = {255, 255, 255, 255};
 				static rgb_color black    = {0, 0, 0, 255};
 				prev = NULL;
+				fontId           = FontTable::kDefaultFont;
 				font             = 0;
+				fontHandleId     = -1;
+				fontHandleEncoding = macroman_encoding;
 				pdfSystem.SetHeight(h);
 				pdfSystem.SetOrigin(x, y);
 				penX             = 0;
@@ -230,6 +264,7 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 				penSize          = 1;
 				pattern0         = B_SOLID_HIGH;
 				fontSpacing      = B_STRING_SPACING;
+				clipped          = false;
 			}
 
 			State(State *prev)
@@ -242,28 +277,158 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 		class Font
 		{
 		public:
-			Font(char *n, int f, font_encoding e) : name(n), font(f), encoding(e) { }
+			Font(const char *n, int f, font_encoding e)
+				: name(n), font(f), encoding(e), hash(Hash(n, e)) { }
 			BString name;
 			int     font;
 			font_encoding encoding;
+			uint32  hash;
+
+			inline bool Matches(const char *n, font_encoding e, uint32 h) const {
+				return hash == h && encoding == e && strcmp(name.String(), n) == 0;
+			};
+
+			// FNV-1a of the name followed by the encoding
+			static uint32 Hash(const char *n, font_encoding e) {
+				uint32 h = 2166136261U;
+				for (; *n != 0; n++)
+					h = (h ^ (uint8)*n) * 16777619U;
+				return (h ^ (uint32)e) * 16777619U;
+			};
+		};
+
+		// open addressing hash table of the PDF fonts in fFontCache
+		class FontHandleTable
+		{
+			Font      **fSlots;
+			int32       fSize;  // power of two
+			int32       fCount;
+
+			inline int32 SlotOf(const char *name, font_encoding encoding,
+				uint32 hash) const {
+				int32 i = hash & (fSize - 1);
+				while (fSlots[i] != NULL
+					&& !fSlots[i]->Matches(name, encoding, hash))
+					i = (i + 1) & (fSize - 1);
+				return i;
+			};
+
+		public:
+			FontHandleTable()
+				: fSlots(NULL)
+				, fSize(0)
+				, fCount(0)
+			{};
+
+			~FontHandleTable() { delete[] fSlots; };
+
+			inline Font* Find(const char *name, font_encoding encoding) const {
+				if (fSize == 0)
+					return NULL;
+				return fSlots[SlotOf(name, encoding, Font::Hash(name, encoding))];
+			};
+
+			void Insert(Font* font) {
+				// keep the load factor at or below one half
+				if (2 * (fCount + 1) > fSize) {
+					Font** slots = fSlots;
+					const int32 size = fSize;
+					fSize = size == 0 ? 64 : 2 * size;
+					fSlots = new Font*[fSize];
+					memset(fSlots, 0, fSize * sizeof(Font*));
+					for (int32 i = 0; i < size; i++) {
+						Font* f = slots[i];
+						if (f != NULL)
+							fSlots[SlotOf(f->name.String(), f->encoding, f->hash)] = f;
+					}
+					delete[] slots;
+				}
+				fSlots[SlotOf(font->name.String(), font->encoding, font->hash)] = font;
+				fCount++;
+			};
+		};
+
+		// pattern bits and low and high color packed into 16 bytes
+		class PatternKey
+		{
+		public:
+			uint32      words[4];
+
+			PatternKey(const pattern &p, rgb_color low, rgb_color high) {
+				memcpy(words, p.data, 8);
+				memcpy(&words[2], &low, sizeof(rgb_color));
+				memcpy(&words[3], &high, sizeof(rgb_color));
+			};
+
+			inline bool operator==(const PatternKey &key) const {
+				return words[0] == key.words[0] && words[1] == key.words[1]
+					&& words[2] == key.words[2] && words[3] == key.words[3];
+			};
+
+			inline uint32 Hash() const {
+				uint32 hash = words[0];
+				hash = hash * 31 + words[1];
+				hash = hash * 31 + words[2];
+				hash = hash * 31 + words[3];
+				return hash * 2654435761U;
+			};
 		};
 
 		class Pattern
 		{
 		public:
-			pattern     pat;
-			rgb_color   lowColor, highColor;
+			PatternKey  key;
 			int         patternId;
 
 			Pattern(const pattern &p, rgb_color low, rgb_color high, int id)
-				: pat(p)
-				, lowColor(low)
-				, highColor(high)
+				: key(p, low, high)
 				, patternId(id)
 			{};
+		};
+
+		// open addressing hash table of the patterns in fPatterns
+		class PatternTable
+		{
+			Pattern   **fSlots;
+			int32       fSize;  // power of two
+			int32       fCount;
+
+			inline int32 SlotOf(const PatternKey &key) const {
+				int32 i = key.Hash() & (fSize - 1);
+				while (fSlots[i] != NULL && !(fSlots[i]->key == key))
+					i = (i + 1) & (fSize - 1);
+				return i;
+			};
+
+		public:
+			PatternTable()
+				: fSlots(NULL)
+				, fSize(0)
+				, fCount(0)
+			{};
+
+			~PatternTable() { delete[] fSlots; };
+
+			inline Pattern* Find(const PatternKey &key) const {
+				return fSize == 0 ? NULL : fSlots[SlotOf(key)];
+			};
 
-			inline bool Matches(const pattern &p, rgb_color low, rgb_color high) const {
-				return IsSame(pat, p) && IsSame(lowColor, low) && IsSame(highColor, high);
+			void Insert(Pattern* pattern) {
+				// keep the load factor at or below one half
+				if (2 * (fCount + 1) > fSize) {
+					Pattern** slots = fSlots;
+					const int32 size = fSize;
+					fSize = size == 0 ? 64 : 2 * size;
+					fSlots = new Pattern*[fSize];
+					memset(fSlots, 0, fSize * sizeof(Pattern*));
+					for (int32 i = 0; i < size; i++) {
+						if (slots[i] != NULL)
+							fSlots[SlotOf(slots[i]->key)] = slots[i];
+					}
+					delete[] slots;
+				}
+				fSlots[SlotOf(pattern->key)] = pattern;
+				fCount++;
 			};
 		};
 
@@ -284,19 +449,153 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 			inline int Handle() const { return handle; }
 		};
 
+		enum
+		{
+			kMaxGStateDepth = 32,  // depth up to which the state is tracked
+			kUnknown        = -1
+		};
+
+		// shadow of the graphics and text state set in the content stream,
+		// kUnknown marks values that have to be set before they are used
+		class GraphicsState
+		{
+		public:
+			int16   alpha;
+			int8    lineCap;
+			int8    lineJoin;
+			float   miterLimit;
+			float   lineWidth;
+			int     font;
+			float   fontSize;
+			int8    textRendering;
+			int8    underline;
+			int8    strikeout;
+			float   charSpacing;
+			float   wordSpacing;
+
+			GraphicsState() { Reset(); }
+
+			void Reset() {
+				alpha = kUnknown;
+				lineCap = lineJoin = kUnknown;
+				miterLimit = lineWidth = kUnknown;
+				font = kUnknown;
+				fontSize = kUnknown;
+				textRendering = underline = strikeout = kUnknown;
+				charSpacing = wordSpacing = kUnknown;
+			};
+		};
+
+		// consecutive glyphs of a string that are shown at once
+		class GlyphRun
+		{
+		public:
+			enum { kMaxLength = 256 };
+
+			int     font;
+			float   x, y;         // pen position of the first glyph
+			float   charSpacing;  // escapement of every glyph
+			float   wordSpacing;  // additional escapement of spaces
+			// difference between the PDF widths and the BFont advances
+			// of the glyphs in the run
+			float   drift;
+			int32   length;
+			char    text[kMaxLength];
+
+			GlyphRun() : length(0) {}
+		};
+
+		// consecutive placements of an image on a regular grid
+		class TileRun
+		{
+		public:
+			int     image;
+			float   left, bottom;   // position of the first tile
+			float   width, height;  // size of a tile on the page
+			float   scaleX, scaleY;
+			float   scale;
+			float   rowStep;        // vertical distance of the rows
+			int32   columns;        // 0 while in the first row
+			int32   count;
+
+			TileRun() : count(0) {}
+
+			static inline bool Same(float a, float b) {
+				return fabs(a - b) < 0.01;
+			}
+
+			inline bool Matches(int image, float width, float height,
+				float scaleX, float scaleY) const {
+				return this->image == image && Same(this->width, width)
+					&& Same(this->height, height) && this->scaleX == scaleX
+					&& this->scaleY == scaleY;
+			}
+
+			inline BPoint Position(int32 index) const {
+				if (columns == 0)
+					return BPoint(left + index * width, bottom);
+				return BPoint(left + (index % columns) * width,
+					bottom + (index / columns) * rowStep);
+			}
+		};
+
+		class TilePattern
+		{
+		public:
+			int     image;
+			float   width, height;
+			float   phaseX, phaseY;
+			int     patternId;
+
+			TilePattern(int image, float width, float height, float phaseX,
+					float phaseY, int id)
+				: image(image)
+				, width(width)
+				, height(height)
+				, phaseX(phaseX)
+				, phaseY(phaseY)
+				, patternId(id)
+			{};
+
+			inline bool Matches(int image, float width, float height,
+					float phaseX, float phaseY) const {
+				return this->image == image && TileRun::Same(this->width, width)
+					&& TileRun::Same(this->height, height)
+					&& TileRun::Same(this->phaseX, phaseX)
+					&& TileRun::Same(this->phaseY, phaseY);
+			};
+		};
+
 		PDFVersion      fPDFVersion;
 		FILE			*fLog;
 		PDF				*fPdf;
 		int32           fPage;
 		State			*fState;
 		int32           fStateDepth;
+		TList<State>    fStateFrames;  // reused for depth 1, 2, ...
 		TList<Font>     fFontCache;
+		FontHandleTable fFontHandles;
+		FontTable       fFontTable;
+		UTF8Decoder     fTextDecoder; // code points of the drawn string
 		TList<Pattern>  fPatterns;
+		PatternTable    fPatternTable;
+		TileRun         fTileRun;
+		GlyphRun        fGlyphRun;
+		// PDF widths of the 256 codes per font handle at size 1,
+		// negative if not known yet
+		float*          fPDFGlyphWidths;
+		int32           fPDFGlyphWidthFonts;
+		TList<TilePattern> fTilePatterns;
 		TList<Transparency> fTransparencyCache;
-		TList<Transparency> fTransparencyStack;
+		Transparency*   fTransparencyTable[256];  // indexed by alpha
+		GraphicsState   fGState;
+		GraphicsState   fGStateStack[kMaxGStateDepth];
+		int32           fGStateDepth;
+		int32           fSuppressedOps;  // on the current page
 		ImageCache      fImageCache;
+		int32           fJPEGQuality;
 		int64           fEmbedMaxFontSize;
-		BScreen         *fScreen;
+		uint32          fCMAP8ToRGB32[256];
 		Fonts           *fFonts;
 		bool            fCreateWebLinks;
 		bool            fCreateBookmarks;
@@ -308,6 +607,8 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 		TextLine        fTextLine;
 		TList<UsedFont> fUsedFonts;
 		UserDefinedEncodings fUserDefinedEncodings;
+		// encoding kind and code per code point, see ResolveCodePoint()
+		uint16          fCodePointEncoding[65536];
 
 		enum
 		{
@@ -321,6 +622,9 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 
 		PDFSystem* pdfSystem() const { return &fState->pdfSystem; }
 
+		inline const BFont& CurrentFont() const
+			{ return fFontTable.FontAt(fState->fontId); }
+
 		enum
 		{
 			kStroke = true,
@@ -344,15 +648,26 @@ class PDFWriter : public PrinterDriver, public PictureIterator {
 
 		bool StoreTranslatorBitmap(BBitmap *bitmap, const char *filename, uint32 type);
 
-		void GetFontName(BFont *font, char *fontname);
-		void GetFontName(BFont *font, char *fontname, bool &embed, font_encoding encoding);
-		int FindFont(char *fontname, bool embed, font_encoding encoding);
+		const char* GetFontName(int32 fontId, font_encoding encoding);
+		int FindFont(const char *fontname, bool embed, font_encoding encoding);
 		void MakeUserDefinedEncoding(uint16 unicode, uint8 &enc, uint8 &index);
 
 		// alpha transparency
 		Transparency* FindTransparency(uint8 alpha);
 		void BeginTransparency();
 		void EndTransparency();
+		void SaveGState();
+		void RestoreGState();
+		void SetLineCap(int cap);
+		void SetLineJoin(int join);
+		void SetMiterLimit(float limit);
+		void SetLineWidth(float width);
+		void SetFont(int font, float size);
+		void SetTextRendering(int mode);
+		void SetUnderline(bool underline);
+		void SetStrikeout(bool strikeout);
+		void SetCharSpacing(float spacing);
+		void SetWordSpacing(float spacing);
 
 		void PushInternalState();
 		bool PopInternalState();
@@ -386,7 +701,7 @@ inline bool
 PDFWriter::IsSame(const rgb_color &c1, const rgb_color &c2)
 {
 	char *a = (char*)&c1;
-	char *b = (char*)&c1;
+	char *b = (char*)&c2;
 	return memcmp(a, b, sizeof(rgb_color)) == 0;
 }
 
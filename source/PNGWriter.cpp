@@ -0,0 +1,451 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include "PNGWriter.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+static const uint8 kSignature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+
+static inline void
+write_uint32(uint8* buffer, uint32 value)
+{
+	buffer[0] = value >> 24;
+	buffer[1] = value >> 16;
+	buffer[2] = value >> 8;
+	buffer[3] = value;
+}
+
+
+PNGWriter::PNGWriter()
+	:
+	fStreamInitialized(false),
+	fColorType(kRGB),
+	fBitDepth(8),
+	fWidth(0),
+	fBytesPerRow(0),
+	fRowsLeft(0),
+	fBytesPerPixel(1),
+	fFiltered(false),
+	fRow(NULL),
+	fPrior(NULL),
+	fCandidates(NULL)
+{
+}
+
+
+PNGWriter::~PNGWriter()
+{
+	if (fStreamInitialized)
+		deflateEnd(&fStream);
+	delete[] fRow;
+	delete[] fPrior;
+	delete[] fCandidates;
+}
+
+
+status_t
+PNGWriter::Begin(const char* fileName, int32 width, int32 height,
+	int colorType, int bitDepth, const rgb_color* palette, int32 paletteSize,
+	int level)
+{
+	if (width <= 0 || height <= 0)
+		return B_BAD_VALUE;
+
+	status_t status = fFile.SetTo(fileName,
+		B_WRITE_ONLY | B_CREATE_FILE | B_ERASE_FILE);
+	if (status != B_OK)
+		return status;
+
+	int channels = colorType == kRGB ? 3 : 1;
+	fColorType = colorType;
+	fBitDepth = bitDepth;
+	fWidth = width;
+	fBytesPerRow = (width * channels * bitDepth + 7) / 8;
+	fRowsLeft = height;
+
+	// every row is preceded by its filter type
+	delete[] fRow;
+	fRow = new uint8[fBytesPerRow + 1];
+	fRow[0] = kFilterNone;
+
+	// filters work on whole bytes, they do not pay off for packed
+	// samples or palette indices
+	delete[] fPrior;
+	delete[] fCandidates;
+	fPrior = NULL;
+	fCandidates = NULL;
+	fFiltered = bitDepth >= 8 && colorType != kIndexed;
+	fBytesPerPixel = channels * bitDepth / 8;
+	if (fFiltered) {
+		fPrior = new uint8[fBytesPerRow + 1];
+		memset(fPrior, 0, fBytesPerRow + 1);
+		fCandidates = new uint8[(kFilterCount - 1) * (fBytesPerRow + 1)];
+	}
+
+	memset(&fStream, 0, sizeof(fStream));
+	if (deflateInit(&fStream, level) != Z_OK)
+		return B_NO_MEMORY;
+	fStreamInitialized = true;
+	fStream.next_out = fBuffer;
+	fStream.avail_out = kBufferSize;
+
+	if (fFile.Write(kSignature, sizeof(kSignature)) != sizeof(kSignature))
+		return B_IO_ERROR;
+
+	uint8 header[13];
+	write_uint32(header, width);
+	write_uint32(header + 4, height);
+	header[8] = bitDepth;
+	header[9] = colorType;
+	header[10] = 0;	// deflate
+	header[11] = 0;	// adaptive filtering
+	header[12] = 0;	// no interlace
+	status = WriteChunk("IHDR", header, sizeof(header));
+
+	if (status == B_OK && colorType == kIndexed) {
+		if (palette == NULL || paletteSize <= 0 || paletteSize > 256)
+			return B_BAD_VALUE;
+		uint8 entries[3 * 256];
+		for (int32 i = 0; i < paletteSize; i++) {
+			entries[3 * i] = palette[i].red;
+			entries[3 * i + 1] = palette[i].green;
+			entries[3 * i + 2] = palette[i].blue;
+		}
+		status = WriteChunk("PLTE", entries, 3 * paletteSize);
+	}
+	return status;
+}
+
+
+status_t
+PNGWriter::WriteRow(const uint8* row)
+{
+	if (!fStreamInitialized || fRowsLeft <= 0)
+		return B_ERROR;
+
+	memcpy(fRow + 1, row, fBytesPerRow);
+	return FlushRow();
+}
+
+
+/*!	Writes all rows of \a bitmap, which must match the format passed
+	to Begin() as returned by FormatFor(). B_RGB32 pixels are stored as
+	RGB, the palette indices of B_CMAP8 bitmaps are packed to the bit
+	depth.
+*/
+status_t
+PNGWriter::WriteBitmap(const BBitmap* bitmap)
+{
+	const int32 height = bitmap->Bounds().IntegerHeight() + 1;
+	const uint8* bits = (const uint8*)bitmap->Bits();
+	status_t status = B_OK;
+
+	for (int32 y = 0; status == B_OK && y < height; y++) {
+		if (!fStreamInitialized || fRowsLeft <= 0)
+			return B_ERROR;
+
+		const uint8* in = bits + y * bitmap->BytesPerRow();
+		uint8* out = fRow + 1;
+		if (fColorType == kRGB) {
+			// B_RGB32 is stored as BGRA
+			for (int32 x = 0; x < fWidth; x++, in += 4, out += 3) {
+				out[0] = in[2];
+				out[1] = in[1];
+				out[2] = in[0];
+			}
+		} else if (fColorType == kGray && fBitDepth == 1) {
+			// in B_GRAY1 a set bit is black, in PNG it is white
+			for (int32 i = 0; i < fBytesPerRow; i++)
+				out[i] = ~in[i];
+		} else if (fBitDepth < 8) {
+			// pack the palette indices, leftmost pixel in the high bits
+			const int perByte = 8 / fBitDepth;
+			memset(out, 0, fBytesPerRow);
+			for (int32 x = 0; x < fWidth; x++) {
+				const int shift = 8 - fBitDepth * (x % perByte + 1);
+				out[x / perByte] |= in[x] << shift;
+			}
+		} else
+			memcpy(out, in, fBytesPerRow);
+
+		status = FlushRow();
+	}
+	return status;
+}
+
+
+status_t
+PNGWriter::End()
+{
+	if (!fStreamInitialized || fRowsLeft != 0)
+		return B_ERROR;
+
+	status_t status = Deflate(Z_FINISH);
+	if (status == B_OK)
+		status = WriteChunk("IEND", NULL, 0);
+
+	deflateEnd(&fStream);
+	fStreamInitialized = false;
+	fFile.Unset();
+	return status;
+}
+
+
+/*!	Returns the PNG color type and bit depth WriteBitmap() uses for
+	bitmaps of \a colorSpace. Indexed images with a small palette get
+	fewer bits per pixel.
+*/
+/*static*/ bool
+PNGWriter::FormatFor(color_space colorSpace, int32 paletteSize,
+	int* colorType, int* bitDepth)
+{
+	*bitDepth = 8;
+	switch (colorSpace) {
+		case B_RGB32:
+			*colorType = kRGB;
+			return true;
+		case B_GRAY8:
+			*colorType = kGray;
+			return true;
+		case B_GRAY1:
+			*colorType = kGray;
+			*bitDepth = 1;
+			return true;
+		case B_CMAP8:
+			if (paletteSize <= 0)
+				return false;
+			*colorType = kIndexed;
+			if (paletteSize <= 2)
+				*bitDepth = 1;
+			else if (paletteSize <= 4)
+				*bitDepth = 2;
+			else if (paletteSize <= 16)
+				*bitDepth = 4;
+			return true;
+		default:
+			return false;
+	}
+}
+
+
+status_t
+PNGWriter::FlushRow()
+{
+	const uint8* row = fFiltered ? FilterRow() : fRow;
+
+	// deflate() consumes all input, the buffers can be reused afterwards
+	fStream.next_in = (Bytef*)row;
+	fStream.avail_in = fBytesPerRow + 1;
+	fRowsLeft--;
+	status_t status = Deflate(Z_NO_FLUSH);
+
+	if (fFiltered) {
+		// the unfiltered row is the prior row of the next one
+		uint8* prior = fPrior;
+		fPrior = fRow;
+		fRow = prior;
+	}
+	return status;
+}
+
+
+//! Returns the sum of the filtered bytes taken as signed values.
+static inline uint32
+filter_cost(const uint8* data, int32 length)
+{
+	uint32 cost = 0;
+	int32 i = 0;
+#ifdef __SSE2__
+	const __m128i zero = _mm_setzero_si128();
+	__m128i sum = zero;
+	for (; i + 16 <= length; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+		// |v| of a signed byte is min(v, 256 - v) taken unsigned
+		v = _mm_min_epu8(v, _mm_sub_epi8(zero, v));
+		sum = _mm_add_epi64(sum, _mm_sad_epu8(v, zero));
+	}
+	cost = _mm_cvtsi128_si32(sum)
+		+ _mm_cvtsi128_si32(_mm_unpackhi_epi64(sum, sum));
+#endif
+	for (; i < length; i++)
+		cost += data[i] < 128 ? data[i] : 256 - data[i];
+	return cost;
+}
+
+
+static inline uint8
+paeth_predictor(int a, int b, int c)
+{
+	const int pa = abs(b - c);
+	const int pb = abs(a - c);
+	const int pc = abs(a + b - 2 * c);
+	if (pa <= pb && pa <= pc)
+		return a;
+	return pb <= pc ? b : c;
+}
+
+
+#ifdef __SSE2__
+//! Paeth predictor of 8 pixels widened to 16 bits.
+static inline __m128i
+paeth_predictor(__m128i a, __m128i b, __m128i c)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i pa = _mm_sub_epi16(b, c);
+	__m128i pb = _mm_sub_epi16(a, c);
+	__m128i pc = _mm_add_epi16(pa, pb);
+	pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+	pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+	pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+	const __m128i notA = _mm_or_si128(_mm_cmpgt_epi16(pa, pb),
+		_mm_cmpgt_epi16(pa, pc));
+	const __m128i notB = _mm_cmpgt_epi16(pb, pc);
+	const __m128i bOrC = _mm_or_si128(_mm_and_si128(notB, c),
+		_mm_andnot_si128(notB, b));
+	return _mm_or_si128(_mm_and_si128(notA, bOrC),
+		_mm_andnot_si128(notA, a));
+}
+#endif
+
+
+/*!	Applies the Sub, Up, Average and Paeth filters to the current row
+	and returns the one with the smallest sum of absolute differences,
+	which is the heuristic recommended by the PNG specification. The
+	unfiltered row is used if it is smaller still.
+*/
+const uint8*
+PNGWriter::FilterRow()
+{
+	const int32 length = fBytesPerRow;
+	const int32 bpp = fBytesPerPixel;
+	const uint8* raw = fRow + 1;
+	const uint8* prior = fPrior + 1;
+	uint8* sub = fCandidates + 1;
+	uint8* up = sub + length + 1;
+	uint8* average = up + length + 1;
+	uint8* paeth = average + length + 1;
+	sub[-1] = kFilterSub;
+	up[-1] = kFilterUp;
+	average[-1] = kFilterAverage;
+	paeth[-1] = kFilterPaeth;
+
+	// the first pixel has no left neighbour
+	int32 x = 0;
+	for (; x < bpp && x < length; x++) {
+		sub[x] = raw[x];
+		up[x] = raw[x] - prior[x];
+		average[x] = raw[x] - (prior[x] >> 1);
+		paeth[x] = raw[x] - prior[x];
+	}
+
+#ifdef __SSE2__
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set1_epi8(1);
+	for (; x + 16 <= length; x += 16) {
+		const __m128i r = _mm_loadu_si128((const __m128i*)(raw + x));
+		const __m128i a = _mm_loadu_si128((const __m128i*)(raw + x - bpp));
+		const __m128i b = _mm_loadu_si128((const __m128i*)(prior + x));
+		const __m128i c = _mm_loadu_si128((const __m128i*)(prior + x - bpp));
+
+		_mm_storeu_si128((__m128i*)(sub + x), _mm_sub_epi8(r, a));
+		_mm_storeu_si128((__m128i*)(up + x), _mm_sub_epi8(r, b));
+
+		// _mm_avg_epu8() rounds up, PNG rounds down
+		const __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b),
+			_mm_and_si128(_mm_xor_si128(a, b), one));
+		_mm_storeu_si128((__m128i*)(average + x), _mm_sub_epi8(r, avg));
+
+		const __m128i low = paeth_predictor(_mm_unpacklo_epi8(a, zero),
+			_mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(c, zero));
+		const __m128i high = paeth_predictor(_mm_unpackhi_epi8(a, zero),
+			_mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(c, zero));
+		_mm_storeu_si128((__m128i*)(paeth + x),
+			_mm_sub_epi8(r, _mm_packus_epi16(low, high)));
+	}
+#endif
+
+	for (; x < length; x++) {
+		const uint8 a = raw[x - bpp];
+		const uint8 b = prior[x];
+		const uint8 c = prior[x - bpp];
+		sub[x] = raw[x] - a;
+		up[x] = raw[x] - b;
+		average[x] = raw[x] - ((a + b) >> 1);
+		paeth[x] = raw[x] - paeth_predictor(a, b, c);
+	}
+
+	fRow[0] = kFilterNone;
+	const uint8* best = fRow;
+	uint32 bestCost = filter_cost(raw, length);
+	for (int type = kFilterSub; type < kFilterCount; type++) {
+		const uint8* candidate = fCandidates + (type - 1) * (length + 1);
+		uint32 cost = filter_cost(candidate + 1, length);
+		if (cost < bestCost) {
+			bestCost = cost;
+			best = candidate;
+		}
+	}
+	return best;
+}
+
+
+status_t
+PNGWriter::WriteChunk(const char* type, const uint8* data, uint32 length)
+{
+	uint8 header[8];
+	write_uint32(header, length);
+	memcpy(header + 4, type, 4);
+
+	uLong crc = crc32(0, header + 4, 4);
+	if (length > 0)
+		crc = crc32(crc, data, length);
+	uint8 trailer[4];
+	write_uint32(trailer, crc);
+
+	if (fFile.Write(header, 8) != 8
+		|| (length > 0 && fFile.Write(data, length) != (ssize_t)length)
+		|| fFile.Write(trailer, 4) != 4)
+		return B_IO_ERROR;
+	return B_OK;
+}
+
+
+/*!	Runs the compressor over the pending input and writes every
+	filled output buffer as its own IDAT chunk.
+*/
+status_t
+PNGWriter::Deflate(int flush)
+{
+	while (true) {
+		int result = deflate(&fStream, flush);
+		if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR)
+			return B_ERROR;
+
+		bool done = flush == Z_FINISH
+			? result == Z_STREAM_END : fStream.avail_in == 0;
+		if (fStream.avail_out == 0 || (done && flush == Z_FINISH)) {
+			uint32 length = kBufferSize - fStream.avail_out;
+			if (length > 0) {
+				status_t status = WriteChunk("IDAT", fBuffer, length);
+				if (status != B_OK)
+					return status;
+			}
+			fStream.next_out = fBuffer;
+			fStream.avail_out = kBufferSize;
+		}
+		if (done)
+			return B_OK;
+	}
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <Bitmap.h>
+#include <File.h>
+#include <InterfaceDefs.h>
+
+#include <zlib.h>
+
+
+/*!	Minimal PNG encoder for the image cache.
+	Rows are handed over one at a time in PNG sample layout, so images
+	can be written without holding more than a single row in memory.
+	PDFlib embeds the deflated IDAT data as is, with the predictor
+	set in the decode parameters, so rows are filtered adaptively.
+*/
+class PNGWriter {
+public:
+	enum {
+		kGray    = 0,
+		kRGB     = 2,
+		kIndexed = 3
+	};
+
+					PNGWriter();
+					~PNGWriter();
+
+	status_t		Begin(const char* fileName, int32 width, int32 height,
+						int colorType, int bitDepth,
+						const rgb_color* palette = NULL, int32 paletteSize = 0,
+						int level = Z_DEFAULT_COMPRESSION);
+	status_t		WriteRow(const uint8* row);
+	status_t		WriteBitmap(const BBitmap* bitmap);
+	status_t		End();
+
+	int32			BytesPerRow() const { return fBytesPerRow; }
+
+	static bool		FormatFor(color_space colorSpace, int32 paletteSize,
+						int* colorType, int* bitDepth);
+
+private:
+	status_t		FlushRow();
+	const uint8*	FilterRow();
+	status_t		WriteChunk(const char* type, const uint8* data,
+						uint32 length);
+	status_t		Deflate(int flush);
+
+	enum {
+		kBufferSize = 32 * 1024
+	};
+
+	// PNG row filter types
+	enum {
+		kFilterNone = 0,
+		kFilterSub,
+		kFilterUp,
+		kFilterAverage,
+		kFilterPaeth,
+		kFilterCount
+	};
+
+	BFile			fFile;
+	z_stream		fStream;
+	bool			fStreamInitialized;
+	int				fColorType;
+	int				fBitDepth;
+	int32			fWidth;
+	int32			fBytesPerRow;
+	int32			fRowsLeft;
+	int32			fBytesPerPixel;
+	bool			fFiltered;
+	uint8*			fRow;
+	uint8*			fPrior;
+	uint8*			fCandidates;
+	uint8			fBuffer[kBufferSize];
+};
+
+#endif	// PNG_WRITER_H
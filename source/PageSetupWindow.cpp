@@ -39,6 +39,7 @@ THE SOFTWARE.
 #include "BlockingWindow.h"
 #include "MarginView.h"
 #include "PrinterDriver.h"
+#include "PrinterSettings.h"
 #include "pdflib.h"				// for pageFormat constants
 #include "PrintUtils.h"
 
@@ -127,6 +128,10 @@ PageSetupWindow::PageSetupWindow(BMessage *msg, const char *printerName)
 	int32 compression;
 	fSetupMsg->FindInt32("pdf_compression", &compression);
 
+	int32 jpegQuality;
+	if (fSetupMsg->FindInt32("pdf_jpeg_quality", &jpegQuality) != B_OK)
+		jpegQuality = kPDFJPEGQuality;
+
 	int32 units;
 	if (fSetupMsg->FindInt32("units", &units) != B_OK)
 		units = kUnitInch;
@@ -210,6 +215,13 @@ PageSetupWindow::PageSetupWindow(BMessage *msg, const char *printerName)
 	fPDFCompressionSlider->SetHashMarks(B_HASH_MARKS_BOTTOM);
 	fPDFCompressionSlider->SetValue(compression);
 
+	fPDFJPEGQualitySlider = new BSlider("pdf_jpeg_quality",
+		"Photo quality (JPEG):", NULL, 0, 100, B_HORIZONTAL);
+	fPDFJPEGQualitySlider->SetLimitLabels("Lossless", "Best");
+	fPDFJPEGQualitySlider->SetHashMarks(B_HASH_MARKS_BOTTOM);
+	fPDFJPEGQualitySlider->SetHashMarkCount(11);
+	fPDFJPEGQualitySlider->SetValue(jpegQuality);
+
 	BButton *cancel = new BButton("cancel", "Cancel", new BMessage(CANCEL_MSG));
 
 	BButton *ok = new BButton("ok", "OK", new BMessage(OK_MSG));
@@ -239,6 +251,7 @@ PageSetupWindow::PageSetupWindow(BMessage *msg, const char *printerName)
 				.Add(fPDFCompatibilityMenu->CreateLabelLayoutItem(), 0, 2)
 				.Add(fPDFCompatibilityMenu->CreateMenuBarLayoutItem(), 1, 2)
 				.Add(fPDFCompressionSlider, 0, 3, 2)
+				.Add(fPDFJPEGQualitySlider, 0, 4, 2)
 			.End()
 		.End()
 		.Add(new BSeparatorView(B_HORIZONTAL, B_FANCY_BORDER))
@@ -354,6 +367,7 @@ PageSetupWindow::_UpdateSetupMessage()
 		SetString(fSetupMsg, "pdf_compatibility", item->Label());
 
 	SetInt32(fSetupMsg, "pdf_compression", fPDFCompressionSlider->Value());
+	SetInt32(fSetupMsg, "pdf_jpeg_quality", fPDFJPEGQualitySlider->Value());
 
 	item = fPageSizeMenu->Menu()->FindMarked();
 	if (item) {
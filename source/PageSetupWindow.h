@@ -79,6 +79,7 @@ private:
 	BMenuField*		fOrientationMenu;
 	BMenuField*		fPDFCompatibilityMenu;
 	BSlider*		fPDFCompressionSlider;
+	BSlider*		fPDFJPEGQualitySlider;
 	Fonts*			fFonts;
 	BMessage		fAdvancedSettings;
 	MarginView * 	fMarginView;
@@ -31,60 +31,68 @@ THE SOFTWARE.
 
 #include "PictureIterator.h"
 
+// Tells the iterator that an operation other than DrawPixels follows
+static inline PictureIterator* _Next(void *p)
+{
+	PictureIterator* iterator = (PictureIterator *) p;
+	iterator->BeginOp();
+	return iterator;
+}
+
 // BPicture playback handlers class instance redirectors
-static void	_MovePenBy(void *p, BPoint delta) 														{ return ((PictureIterator *) p)->MovePenBy(delta); }
-static void	_StrokeLine(void *p, BPoint start, BPoint end) 											{ return ((PictureIterator *) p)->StrokeLine(start, end); }
-static void	_StrokeRect(void *p, BRect rect) 														{ return ((PictureIterator *) p)->StrokeRect(rect); }
-static void	_FillRect(void *p, BRect rect) 															{ return ((PictureIterator *) p)->FillRect(rect); }
-static void	_StrokeRoundRect(void *p, BRect rect, BPoint radii) 									{ return ((PictureIterator *) p)->StrokeRoundRect(rect, radii); }
-static void	_FillRoundRect(void *p, BRect rect, BPoint radii)  										{ return ((PictureIterator *) p)->FillRoundRect(rect, radii); }
-static void	_StrokeBezier(void *p, BPoint *control)  												{ return ((PictureIterator *) p)->StrokeBezier(control); }
-static void	_FillBezier(void *p, BPoint *control)  													{ return ((PictureIterator *) p)->FillBezier(control); }
-static void	_StrokeArc(void *p, BPoint center, BPoint radii, float startTheta, float arcTheta)		{ return ((PictureIterator *) p)->StrokeArc(center, radii, startTheta, arcTheta); }
-static void	_FillArc(void *p, BPoint center, BPoint radii, float startTheta, float arcTheta)		{ return ((PictureIterator *) p)->FillArc(center, radii, startTheta, arcTheta); }
-static void	_StrokeEllipse(void *p, BPoint center, BPoint radii)									{ return ((PictureIterator *) p)->StrokeEllipse(center, radii); }
-static void	_FillEllipse(void *p, BPoint center, BPoint radii)										{ return ((PictureIterator *) p)->FillEllipse(center, radii); }
-static void	_StrokePolygon(void *p, int32 numPoints, BPoint *points, bool isClosed) 				{ return ((PictureIterator *) p)->StrokePolygon(numPoints, points, isClosed); }
-static void	_FillPolygon(void *p, int32 numPoints, BPoint *points, bool isClosed)					{ return ((PictureIterator *) p)->FillPolygon(numPoints, points, isClosed); }
-static void	_StrokeShape(void * p, BShape *shape)													{ return ((PictureIterator *) p)->StrokeShape(shape); }
-static void	_FillShape(void * p, BShape *shape)														{ return ((PictureIterator *) p)->FillShape(shape); }
-static void	_DrawString(void *p, char *string, float deltax, float deltay)							{ return ((PictureIterator *) p)->DrawString(string, deltax, deltay); }
+static void	_MovePenBy(void *p, BPoint delta) 														{ return _Next(p)->MovePenBy(delta); }
+static void	_StrokeLine(void *p, BPoint start, BPoint end) 											{ return _Next(p)->StrokeLine(start, end); }
+static void	_StrokeRect(void *p, BRect rect) 														{ return _Next(p)->StrokeRect(rect); }
+static void	_FillRect(void *p, BRect rect) 															{ return _Next(p)->FillRect(rect); }
+static void	_StrokeRoundRect(void *p, BRect rect, BPoint radii) 									{ return _Next(p)->StrokeRoundRect(rect, radii); }
+static void	_FillRoundRect(void *p, BRect rect, BPoint radii)  										{ return _Next(p)->FillRoundRect(rect, radii); }
+static void	_StrokeBezier(void *p, BPoint *control)  												{ return _Next(p)->StrokeBezier(control); }
+static void	_FillBezier(void *p, BPoint *control)  													{ return _Next(p)->FillBezier(control); }
+static void	_StrokeArc(void *p, BPoint center, BPoint radii, float startTheta, float arcTheta)		{ return _Next(p)->StrokeArc(center, radii, startTheta, arcTheta); }
+static void	_FillArc(void *p, BPoint center, BPoint radii, float startTheta, float arcTheta)		{ return _Next(p)->FillArc(center, radii, startTheta, arcTheta); }
+static void	_StrokeEllipse(void *p, BPoint center, BPoint radii)									{ return _Next(p)->StrokeEllipse(center, radii); }
+static void	_FillEllipse(void *p, BPoint center, BPoint radii)										{ return _Next(p)->FillEllipse(center, radii); }
+static void	_StrokePolygon(void *p, int32 numPoints, BPoint *points, bool isClosed) 				{ return _Next(p)->StrokePolygon(numPoints, points, isClosed); }
+static void	_FillPolygon(void *p, int32 numPoints, BPoint *points, bool isClosed)					{ return _Next(p)->FillPolygon(numPoints, points, isClosed); }
+static void	_StrokeShape(void * p, BShape *shape)													{ return _Next(p)->StrokeShape(shape); }
+static void	_FillShape(void * p, BShape *shape)														{ return _Next(p)->FillShape(shape); }
+static void	_DrawString(void *p, char *string, float deltax, float deltay)							{ return _Next(p)->DrawString(string, deltax, deltay); }
 static void	_DrawPixels(void *p, BRect src, BRect dest, int32 width, int32 height, int32 bytesPerRow, int32 pixelFormat, int32 flags, void *data)
 						{ return ((PictureIterator *) p)->DrawPixels(src, dest, width, height, bytesPerRow, pixelFormat, flags, data); }
-static void	_SetClippingRects(void *p, BRect *rects, uint32 numRects)								{ return ((PictureIterator *) p)->SetClippingRects(rects, numRects); }
-static void	_ClipToPicture(void * p, BPicture *picture, BPoint point, bool clip_to_inverse_picture)	{ return ((PictureIterator *) p)->ClipToPicture(picture, point, clip_to_inverse_picture); }
-static void	_PushState(void *p)  																	{ return ((PictureIterator *) p)->PushState(); }
-static void	_PopState(void *p)  																	{ return ((PictureIterator *) p)->PopState(); }
-static void	_EnterStateChange(void *p) 																{ return ((PictureIterator *) p)->EnterStateChange(); }
-static void	_ExitStateChange(void *p) 																{ return ((PictureIterator *) p)->ExitStateChange(); }
-static void	_EnterFontState(void *p) 																{ return ((PictureIterator *) p)->EnterFontState(); }
-static void	_ExitFontState(void *p) 																{ return ((PictureIterator *) p)->ExitFontState(); }
-static void	_SetOrigin(void *p, BPoint pt)															{ return ((PictureIterator *) p)->SetOrigin(pt); }
-static void	_SetPenLocation(void *p, BPoint pt)														{ return ((PictureIterator *) p)->SetPenLocation(pt); }
-static void	_SetDrawingMode(void *p, drawing_mode mode)												{ return ((PictureIterator *) p)->SetDrawingMode(mode); }
-static void	_SetLineMode(void *p, cap_mode capMode, join_mode joinMode, float miterLimit)			{ return ((PictureIterator *) p)->SetLineMode(capMode, joinMode, miterLimit); }
-static void	_SetPenSize(void *p, float size)														{ return ((PictureIterator *) p)->SetPenSize(size); }
-static void	_SetForeColor(void *p, rgb_color color)													{ return ((PictureIterator *) p)->SetForeColor(color); }
-static void	_SetBackColor(void *p, rgb_color color)													{ return ((PictureIterator *) p)->SetBackColor(color); }
-static void	_SetStipplePattern(void *p, pattern pat)												{ return ((PictureIterator *) p)->SetStipplePattern(pat); }
-static void	_SetScale(void *p, float scale)															{ return ((PictureIterator *) p)->SetScale(scale); }
-static void	_SetFontFamily(void *p, char *family)													{ return ((PictureIterator *) p)->SetFontFamily(family); }
-static void	_SetFontStyle(void *p, char *style)														{ return ((PictureIterator *) p)->SetFontStyle(style); }
-static void	_SetFontSpacing(void *p, int32 spacing)													{ return ((PictureIterator *) p)->SetFontSpacing(spacing); }
-static void	_SetFontSize(void *p, float size)														{ return ((PictureIterator *) p)->SetFontSize(size); }
-static void	_SetFontRotate(void *p, float rotation)													{ return ((PictureIterator *) p)->SetFontRotate(rotation); }
-static void	_SetFontEncoding(void *p, int32 encoding)												{ return ((PictureIterator *) p)->SetFontEncoding(encoding); }
-static void	_SetFontFlags(void *p, int32 flags)														{ return ((PictureIterator *) p)->SetFontFlags(flags); }
-static void	_SetFontShear(void *p, float shear)														{ return ((PictureIterator *) p)->SetFontShear(shear); }
-static void	_SetFontFace(void * p, int32 flags)														{ return ((PictureIterator *) p)->SetFontFace(flags); }
+static void	_SetClippingRects(void *p, BRect *rects, uint32 numRects)								{ return _Next(p)->SetClippingRects(rects, numRects); }
+static void	_ClipToPicture(void * p, BPicture *picture, BPoint point, bool clip_to_inverse_picture)	{ return _Next(p)->ClipToPicture(picture, point, clip_to_inverse_picture); }
+static void	_PushState(void *p)  																	{ return _Next(p)->PushState(); }
+static void	_PopState(void *p)  																	{ return _Next(p)->PopState(); }
+static void	_EnterStateChange(void *p) 																{ return _Next(p)->EnterStateChange(); }
+static void	_ExitStateChange(void *p) 																{ return _Next(p)->ExitStateChange(); }
+static void	_EnterFontState(void *p) 																{ return _Next(p)->EnterFontState(); }
+static void	_ExitFontState(void *p) 																{ return _Next(p)->ExitFontState(); }
+static void	_SetOrigin(void *p, BPoint pt)															{ return _Next(p)->SetOrigin(pt); }
+static void	_SetPenLocation(void *p, BPoint pt)														{ return _Next(p)->SetPenLocation(pt); }
+static void	_SetDrawingMode(void *p, drawing_mode mode)												{ return _Next(p)->SetDrawingMode(mode); }
+static void	_SetLineMode(void *p, cap_mode capMode, join_mode joinMode, float miterLimit)			{ return _Next(p)->SetLineMode(capMode, joinMode, miterLimit); }
+static void	_SetPenSize(void *p, float size)														{ return _Next(p)->SetPenSize(size); }
+static void	_SetForeColor(void *p, rgb_color color)													{ return _Next(p)->SetForeColor(color); }
+static void	_SetBackColor(void *p, rgb_color color)													{ return _Next(p)->SetBackColor(color); }
+static void	_SetStipplePattern(void *p, pattern pat)												{ return _Next(p)->SetStipplePattern(pat); }
+static void	_SetScale(void *p, float scale)															{ return _Next(p)->SetScale(scale); }
+static void	_SetFontFamily(void *p, char *family)													{ return _Next(p)->SetFontFamily(family); }
+static void	_SetFontStyle(void *p, char *style)														{ return _Next(p)->SetFontStyle(style); }
+static void	_SetFontSpacing(void *p, int32 spacing)													{ return _Next(p)->SetFontSpacing(spacing); }
+static void	_SetFontSize(void *p, float size)														{ return _Next(p)->SetFontSize(size); }
+static void	_SetFontRotate(void *p, float rotation)													{ return _Next(p)->SetFontRotate(rotation); }
+static void	_SetFontEncoding(void *p, int32 encoding)												{ return _Next(p)->SetFontEncoding(encoding); }
+static void	_SetFontFlags(void *p, int32 flags)														{ return _Next(p)->SetFontFlags(flags); }
+static void	_SetFontShear(void *p, float shear)														{ return _Next(p)->SetFontShear(shear); }
+static void	_SetFontFace(void * p, int32 flags)														{ return _Next(p)->SetFontFace(flags); }
 
 // undefined or undocumented operation handlers...
-static void	_op0(void * p)	{ return ((PictureIterator *) p)->Op(0); }
-static void	_op19(void * p)	{ return ((PictureIterator *) p)->Op(19); }
-static void	_op45(void * p)	{ return ((PictureIterator *) p)->Op(45); }
-static void	_op47(void * p)	{ return ((PictureIterator *) p)->Op(47); }
-static void	_op48(void * p)	{ return ((PictureIterator *) p)->Op(48); }
-static void	_op49(void * p)	{ return ((PictureIterator *) p)->Op(49); }
+static void	_op0(void * p)	{ return _Next(p)->Op(0); }
+static void	_op19(void * p)	{ return _Next(p)->Op(19); }
+static void	_op45(void * p)	{ return _Next(p)->Op(45); }
+static void	_op47(void * p)	{ return _Next(p)->Op(47); }
+static void	_op48(void * p)	{ return _Next(p)->Op(48); }
+static void	_op49(void * p)	{ return _Next(p)->Op(49); }
 
 // Private Variables
 // -----------------
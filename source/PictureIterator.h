@@ -40,6 +40,9 @@ class PictureIterator
 public:
 		virtual ~PictureIterator() { }
 		
+		// called before every operation except DrawPixels
+		virtual void		BeginOp() { }
+
 		// BPicture playback handlers
 		virtual void		Op(int number) { }
 		virtual void		MovePenBy(BPoint delta) { }
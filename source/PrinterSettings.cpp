@@ -163,6 +163,7 @@ PrinterSettings::GetDefaults(BMessage *msg)
 		msg->AddFloat("scaling", kRes);
 		msg->AddString("pdf_compatibility", kPDFCompatibilty);
 		msg->AddInt32("pdf_compression", kPDFCompression);
+		msg->AddInt32("pdf_jpeg_quality", kPDFJPEGQuality);
 		msg->AddInt32("units", kUnits);
 		msg->AddBool("create_web_links", kCreateWebLinks);
 		msg->AddFloat("link_border_width", kLinkBorderWidth);
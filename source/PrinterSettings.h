@@ -47,6 +47,7 @@ const int64 kYRes = 360;
 const int32 kOrientation = PrinterDriver::PORTRAIT_ORIENTATION;
 const float kRes = 72.0f;
 const int32 kPDFCompression = 3;
+const int32 kPDFJPEGQuality = 0; // 0 = photographic images stay lossless
 const int32 kUnits = 1;
 const float kLetterW = 8.5f * kRes;
 const float kLetterH = 11.0f * kRes;
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include "StreamedImage.h"
+
+#include <unistd.h>
+
+#include <String.h>
+
+#include "ImageCache.h"
+#include "Report.h"
+
+
+StreamedImageDescription::StreamedImageDescription(PDF* pdf,
+	BandedImage* image)
+	:
+	fPDF(pdf),
+	fImage(image)
+{
+}
+
+
+CacheItem*
+StreamedImageDescription::NewItem(int id)
+{
+	BString imageFile(kImagePathPrefix);
+	imageFile << "Band" << id << ".png";
+	BString maskFile(kMaskPathPrefix);
+	maskFile << "Band" << id << ".png";
+
+	int maskBPC = 0;
+	if (!fImage->Store(imageFile.String(), maskFile.String(), &maskBPC)) {
+		REPORT(kError, -1, "Could not store streamed image.");
+		unlink(imageFile.String());
+		unlink(maskFile.String());
+		return NULL;
+	}
+
+	// PDFlib reads the files completely while loading them
+	int maskID = -1;
+	if (maskBPC > 0) {
+		maskID = PDF_load_image(fPDF, "png", maskFile.String(), 0, "mask");
+		unlink(maskFile.String());
+		if (maskID < 0) {
+			REPORT(kError, -1, "Could not embed mask of streamed image.");
+			unlink(imageFile.String());
+			return NULL;
+		}
+	}
+
+	BString options;
+	if (maskID != -1)
+		options << "masked " << maskID;
+	int imageID = PDF_load_image(fPDF, "png", imageFile.String(), 0,
+		options.String());
+	unlink(imageFile.String());
+	if (imageID < 0) {
+		REPORT(kError, -1, "Could not embed streamed image.");
+		if (maskID != -1)
+			PDF_close_image(fPDF, maskID);
+		return NULL;
+	}
+
+	return new StreamedImage(fPDF, imageID, maskID, fImage->Width(),
+		fImage->Height(), fImage->PixelFormat(), fImage->Fingerprint());
+}
+
+
+StreamedImage::StreamedImage(PDF* pdf, int imageID, int maskID,
+	int32 width, int32 height, int32 pixelFormat, uint64 fingerprint)
+	:
+	fPDF(pdf),
+	fImageID(imageID),
+	fMaskID(maskID),
+	fWidth(width),
+	fHeight(height),
+	fPixelFormat(pixelFormat),
+	fFingerprint(fingerprint)
+{
+}
+
+
+StreamedImage::~StreamedImage()
+{
+	PDF_close_image(fPDF, fImageID);
+	if (fMaskID != -1)
+		PDF_close_image(fPDF, fMaskID);
+}
+
+
+bool
+StreamedImage::Equals(CIDescription* description) const
+{
+	StreamedImageDescription* desc
+		= dynamic_cast<StreamedImageDescription*>(description);
+	if (desc == NULL)
+		return false;
+
+	BandedImage* image = desc->Image();
+	return image->Width() == fWidth && image->Height() == fHeight
+		&& image->PixelFormat() == fPixelFormat
+		&& image->Fingerprint() == fFingerprint;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+#ifndef STREAMED_IMAGE_H
+#define STREAMED_IMAGE_H
+
+#include <SupportDefs.h>
+
+#include "pdflib.h"
+#include "Cache.h"
+
+
+/*!	An image that is too large to be converted in one piece. It writes
+	itself band by band to a PNG file and optionally a PNG mask file.
+*/
+class BandedImage {
+public:
+	virtual				~BandedImage() {}
+
+	virtual int32		Width() const = 0;
+	virtual int32		Height() const = 0;
+	virtual int32		PixelFormat() const = 0;
+	virtual uint64		Fingerprint() = 0;
+
+	// maskBPC is set to 0 if the image has no transparent pixels
+	virtual bool		Store(const char* imageFile, const char* maskFile,
+							int* maskBPC) = 0;
+};
+
+
+class StreamedImageDescription : public CIDescription {
+public:
+						StreamedImageDescription(PDF* pdf,
+							BandedImage* image);
+
+	CacheItem*			NewItem(int id);
+
+	BandedImage*		Image() const { return fImage; }
+
+private:
+	PDF*				fPDF;
+	BandedImage*		fImage;
+};
+
+
+/*!	Cache item of a streamed image. Unlike Image it keeps no copy of
+	the pixels, two images are considered equal if their size, format
+	and fingerprint match.
+*/
+class StreamedImage : public CacheItem {
+public:
+						StreamedImage(PDF* pdf, int imageID, int maskID,
+							int32 width, int32 height, int32 pixelFormat,
+							uint64 fingerprint);
+						~StreamedImage();
+
+	int					ImageID() const { return fImageID; }
+	int					MaskID() const { return fMaskID; }
+
+	bool				Equals(CIDescription* description) const;
+
+private:
+	PDF*				fPDF;
+	int					fImageID;
+	int					fMaskID;
+	int32				fWidth;
+	int32				fHeight;
+	int32				fPixelFormat;
+	uint64				fFingerprint;
+};
+
+#endif	// STREAMED_IMAGE_H
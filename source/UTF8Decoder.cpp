@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+
+
+#include "UTF8Decoder.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+UTF8Decoder::UTF8Decoder()
+	:
+	fCodePoints(NULL),
+	fOffsets(NULL),
+	fCapacity(0),
+	fCount(0),
+	fReplaced(false)
+{
+}
+
+
+UTF8Decoder::~UTF8Decoder()
+{
+	delete[] fCodePoints;
+	delete[] fOffsets;
+}
+
+
+/*!	Decodes the \a length bytes at \a utf8 and returns the number of
+	code points.
+*/
+int32
+UTF8Decoder::Decode(const char* utf8, int32 length)
+{
+	// there are at most as many code points as bytes
+	Reserve(length + 1);
+
+	const uint8* in = (const uint8*)utf8;
+	int32 offset = 0;
+	int32 count = 0;
+	fReplaced = false;
+
+	while (offset < length) {
+#ifdef __SSE2__
+		// copy runs of 16 ASCII characters at once
+		while (offset + 16 <= length) {
+			__m128i bytes = _mm_loadu_si128((const __m128i*)(in + offset));
+			if (_mm_movemask_epi8(bytes) != 0)
+				break;
+
+			const __m128i zero = _mm_setzero_si128();
+			_mm_storeu_si128((__m128i*)(fCodePoints + count),
+				_mm_unpacklo_epi8(bytes, zero));
+			_mm_storeu_si128((__m128i*)(fCodePoints + count + 8),
+				_mm_unpackhi_epi8(bytes, zero));
+
+			__m128i offsets = _mm_add_epi32(_mm_set1_epi32(offset),
+				_mm_set_epi32(3, 2, 1, 0));
+			const __m128i four = _mm_set1_epi32(4);
+			for (int i = 0; i < 16; i += 4) {
+				_mm_storeu_si128((__m128i*)(fOffsets + count + i), offsets);
+				offsets = _mm_add_epi32(offsets, four);
+			}
+
+			offset += 16;
+			count += 16;
+		}
+		if (offset >= length)
+			break;
+#endif
+
+		const uint8 c = in[offset];
+		fOffsets[count] = offset;
+
+		if (c < 0x80) {
+			fCodePoints[count++] = c;
+			offset++;
+			continue;
+		}
+
+		uint32 codePoint;
+		uint32 minimum;
+		int32 size;
+		if ((c & 0xe0) == 0xc0) {
+			codePoint = c & 0x1f;
+			minimum = 0x80;
+			size = 2;
+		} else if ((c & 0xf0) == 0xe0) {
+			codePoint = c & 0x0f;
+			minimum = 0x800;
+			size = 3;
+		} else if ((c & 0xf8) == 0xf0) {
+			codePoint = c & 0x07;
+			minimum = 0x10000;
+			size = 4;
+		} else {
+			// stray continuation byte or invalid lead byte
+			fCodePoints[count++] = kReplacementCharacter;
+			fReplaced = true;
+			offset++;
+			continue;
+		}
+
+		int32 i = 1;
+		for (; i < size && offset + i < length; i++) {
+			if ((in[offset + i] & 0xc0) != 0x80)
+				break;
+			codePoint = (codePoint << 6) | (in[offset + i] & 0x3f);
+		}
+
+		if (i < size || codePoint < minimum
+			|| (codePoint >= 0xd800 && codePoint <= 0xdfff)
+			|| codePoint > 0xffff) {
+			// truncated, overlong, surrogate or not representable in UCS-2
+			fCodePoints[count++] = kReplacementCharacter;
+			fReplaced = true;
+			offset += i;
+			continue;
+		}
+
+		fCodePoints[count++] = codePoint;
+		offset += size;
+	}
+
+	fOffsets[count] = offset;
+	fCount = count;
+	return count;
+}
+
+
+void
+UTF8Decoder::Reserve(int32 count)
+{
+	// the ASCII loop stores 16 code points at once
+	count += 16;
+	if (count <= fCapacity)
+		return;
+
+	delete[] fCodePoints;
+	delete[] fOffsets;
+	fCapacity = count < 256 ? 256 : count;
+	fCodePoints = new uint16[fCapacity];
+	fOffsets = new int32[fCapacity];
+}
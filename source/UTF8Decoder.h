@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026, Haiku, Inc. All Rights Reserved.
+ * Distributed under the terms of the MIT License.
+ */
+#ifndef UTF8_DECODER_H
+#define UTF8_DECODER_H
+
+#include <SupportDefs.h>
+
+
+/*!	Decodes a UTF-8 string in one pass into its UCS-2 code points and
+	their byte offsets. Malformed sequences and code points outside the
+	Basic Multilingual Plane become U+FFFD. The buffers are kept between
+	calls, so decoding does not allocate once they are large enough.
+*/
+class UTF8Decoder {
+public:
+	enum {
+		kReplacementCharacter = 0xfffd
+	};
+
+							UTF8Decoder();
+							~UTF8Decoder();
+
+			int32			Decode(const char* utf8, int32 length);
+
+			int32			CountCodePoints() const { return fCount; }
+			// whether a byte sequence was decoded as U+FFFD
+			bool			HasReplacements() const { return fReplaced; }
+			uint16			CodePointAt(int32 index) const
+								{ return fCodePoints[index]; }
+			// offset of the code point in bytes, index may be the count
+			int32			OffsetAt(int32 index) const
+								{ return fOffsets[index]; }
+			int32			SizeAt(int32 index) const
+								{ return fOffsets[index + 1]
+									- fOffsets[index]; }
+
+private:
+			void			Reserve(int32 count);
+
+			uint16*			fCodePoints;
+			int32*			fOffsets;
+			int32			fCapacity;
+			int32			fCount;
+			bool			fReplaced;
+};
+
+#endif	// UTF8_DECODER_H
@@ -1,11120 +1,516 @@
 // WARNING: MACHINE GENERATED, DON'T CHANGE!
-static unicode_to_cid CNS1[] = {
-	{0x20, 1},
-	{0x21, 2},
-	{0x22, 3},
-	{0x23, 4},
-	{0x24, 5},
-	{0x25, 6},
-	{0x26, 7},
-	{0x27, 8},
-	{0x28, 9},
-	{0x29, 10},
-	{0x2a, 11},
-	{0x2b, 12},
-	{0x2c, 13},
-	{0x2d, 14},
-	{0x2e, 15},
-	{0x2f, 16},
-	{0x30, 17},
-	{0x31, 18},
-	{0x32, 19},
-	{0x33, 20},
-	{0x34, 21},
-	{0x35, 22},
-	{0x36, 23},
-	{0x37, 24},
-	{0x38, 25},
-	{0x39, 26},
-	{0x3a, 27},
-	{0x3b, 28},
-	{0x3c, 29},
-	{0x3d, 30},
-	{0x3e, 31},
-	{0x3f, 32},
-	{0x40, 33},
-	{0x41, 34},
-	{0x42, 35},
-	{0x43, 36},
-	{0x44, 37},
-	{0x45, 38},
-	{0x46, 39},
-	{0x47, 40},
-	{0x48, 41},
-	{0x49, 42},
-	{0x4a, 43},
-	{0x4b, 44},
-	{0x4c, 45},
-	{0x4d, 46},
-	{0x4e, 47},
-	{0x4f, 48},
-	{0x50, 49},
-	{0x51, 50},
-	{0x52, 51},
-	{0x53, 52},
-	{0x54, 53},
-	{0x55, 54},
-	{0x56, 55},
-	{0x57, 56},
-	{0x58, 57},
-	{0x59, 58},
-	{0x5a, 59},
-	{0x5b, 60},
-	{0x5c, 61},
-	{0x5d, 62},
-	{0x5e, 63},
-	{0x5f, 64},
-	{0x60, 65},
-	{0x61, 66},
-	{0x62, 67},
-	{0x63, 68},
-	{0x64, 69},
-	{0x65, 70},
-	{0x66, 71},
-	{0x67, 72},
-	{0x68, 73},
-	{0x69, 74},
-	{0x6a, 75},
-	{0x6b, 76},
-	{0x6c, 77},
-	{0x6d, 78},
-	{0x6e, 79},
-	{0x6f, 80},
-	{0x70, 81},
-	{0x71, 82},
-	{0x72, 83},
-	{0x73, 84},
-	{0x74, 85},
-	{0x75, 86},
-	{0x76, 87},
-	{0x77, 88},
-	{0x78, 89},
-	{0x79, 90},
-	{0x7a, 91},
-	{0x7b, 92},
-	{0x7c, 93},
-	{0x7d, 94},
-	{0x7e, 95},
-	{0xa2, 262},
-	{0xa3, 263},
-	{0xa5, 260},
-	{0xa7, 178},
-	{0xb0, 280},
-	{0xb1, 212},
-	{0xb7, 115},
-	{0xd7, 210},
-	{0xf7, 211},
-	{0x2c7, 504},
-	{0x2ca, 503},
-	{0x2cb, 505},
-	{0x2d9, 502},
-	{0x391, 417},
-	{0x392, 418},
-	{0x393, 419},
-	{0x394, 420},
-	{0x395, 421},
-	{0x396, 422},
-	{0x397, 423},
-	{0x398, 424},
-	{0x399, 425},
-	{0x39a, 426},
-	{0x39b, 427},
-	{0x39c, 428},
-	{0x39d, 429},
-	{0x39e, 430},
-	{0x39f, 431},
-	{0x3a0, 432},
-	{0x3a1, 433},
-	{0x3a3, 434},
-	{0x3a4, 435},
-	{0x3a5, 436},
-	{0x3a6, 437},
-	{0x3a7, 438},
-	{0x3a8, 439},
-	{0x3a9, 440},
-	{0x3b1, 441},
-	{0x3b2, 442},
-	{0x3b3, 443},
-	{0x3b4, 444},
-	{0x3b5, 445},
-	{0x3b6, 446},
-	{0x3b7, 447},
-	{0x3b8, 448},
-	{0x3b9, 449},
-	{0x3ba, 450},
-	{0x3bb, 451},
-	{0x3bc, 452},
-	{0x3bd, 453},
-	{0x3be, 454},
-	{0x3bf, 455},
-	{0x3c0, 456},
-	{0x3c1, 457},
-	{0x3c3, 458},
-	{0x3c4, 459},
-	{0x3c5, 460},
-	{0x3c6, 461},
-	{0x3c7, 462},
-	{0x3c8, 463},
-	{0x3c9, 464},
-	{0x411, 0},
-	{0x412, 1},
-	{0x413, 2},
-	{0x414, 3},
-	{0x415, 4},
-	{0x417, 0},
-	{0x418, 1},
-	{0x419, 2},
-	{0x41a, 3},
-	{0x41b, 4},
-	{0x41c, 5},
-	{0x41d, 6},
-	{0x41e, 7},
-	{0x41f, 8},
-	{0x420, 9},
-	{0x421, 10},
-	{0x422, 11},
-	{0x423, 12},
-	{0x424, 13},
-	{0x425, 14},
-	{0x426, 15},
-	{0x427, 16},
-	{0x428, 17},
-	{0x429, 18},
-	{0x42a, 19},
-	{0x42b, 20},
-	{0x42c, 21},
-	{0x42d, 22},
-	{0x42e, 23},
-	{0x42f, 24},
-	{0x430, 25},
-	{0x431, 26},
-	{0x432, 27},
-	{0x433, 28},
-	{0x434, 29},
-	{0x435, 30},
-	{0x437, 0},
-	{0x438, 1},
-	{0x439, 2},
-	{0x43a, 3},
-	{0x43b, 4},
-	{0x43c, 5},
-	{0x43d, 6},
-	{0x43e, 7},
-	{0x43f, 8},
-	{0x440, 9},
-	{0x441, 10},
-	{0x442, 11},
-	{0x443, 12},
-	{0x444, 13},
-	{0x445, 14},
-	{0x446, 15},
-	{0x447, 16},
-	{0x448, 17},
-	{0x449, 18},
-	{0x44a, 19},
-	{0x44b, 20},
-	{0x44c, 21},
-	{0x44d, 22},
-	{0x44e, 23},
-	{0x44f, 24},
-	{0x2013, 121},
-	{0x2014, 123},
-	{0x2018, 166},
-	{0x2019, 167},
-	{0x201c, 168},
-	{0x201d, 169},
-	{0x2022, 104},
-	{0x2025, 111},
-	{0x2026, 110},
-	{0x2032, 173},
-	{0x2035, 172},
-	{0x203b, 177},
-	{0x203e, 195},
-	{0x2103, 266},
-	{0x2105, 194},
-	{0x2109, 267},
-	{0x2160, 343},
-	{0x2161, 344},
-	{0x2162, 345},
-	{0x2163, 346},
-	{0x2164, 347},
-	{0x2165, 348},
-	{0x2166, 349},
-	{0x2167, 350},
-	{0x2168, 351},
-	{0x2169, 352},
-	{0x2170, 526},
-	{0x2171, 527},
-	{0x2172, 528},
-	{0x2173, 529},
-	{0x2174, 530},
-	{0x2175, 531},
-	{0x2176, 532},
-	{0x2177, 533},
-	{0x2178, 534},
-	{0x2179, 535},
-	{0x2190, 248},
-	{0x2191, 245},
-	{0x2192, 247},
-	{0x2193, 246},
-	{0x2196, 249},
-	{0x2197, 250},
-	{0x2198, 252},
-	{0x2199, 251},
-	{0x21b9, 0},
-	{0x221a, 213},
-	{0x221e, 220},
-	{0x221f, 233},
-	{0x2220, 232},
-	{0x2223, 254},
-	{0x2225, 253},
-	{0x2229, 229},
-	{0x222a, 230},
-	{0x222b, 237},
-	{0x222e, 238},
-	{0x2234, 240},
-	{0x2235, 239},
-	{0x223c, 228},
-	{0x2252, 221},
-	{0x2260, 219},
-	{0x2261, 222},
-	{0x2266, 217},
-	{0x2267, 218},
-	{0x22a5, 231},
-	{0x22bf, 234},
-	{0x2400, 562},
-	{0x2401, 563},
-	{0x2402, 564},
-	{0x2403, 565},
-	{0x2404, 566},
-	{0x2405, 567},
-	{0x2406, 568},
-	{0x2407, 569},
-	{0x2408, 570},
-	{0x2409, 571},
-	{0x240a, 572},
-	{0x240b, 573},
-	{0x240c, 574},
-	{0x240d, 575},
-	{0x240e, 576},
-	{0x240f, 577},
-	{0x2410, 578},
-	{0x2411, 579},
-	{0x2412, 580},
-	{0x2413, 581},
-	{0x2414, 582},
-	{0x2415, 583},
-	{0x2416, 584},
-	{0x2417, 585},
-	{0x2418, 586},
-	{0x2419, 587},
-	{0x241a, 588},
-	{0x241b, 589},
-	{0x241c, 590},
-	{0x241d, 591},
-	{0x241e, 592},
-	{0x241f, 593},
-	{0x2421, 594},
-	{0x2460, 506},
-	{0x2461, 507},
-	{0x2462, 508},
-	{0x2463, 509},
-	{0x2464, 510},
-	{0x2465, 511},
-	{0x2466, 512},
-	{0x2467, 513},
-	{0x2468, 514},
-	{0x2469, 515},
-	{0x2474, 516},
-	{0x2475, 517},
-	{0x2476, 518},
-	{0x2477, 519},
-	{0x2478, 520},
-	{0x2479, 521},
-	{0x247a, 522},
-	{0x247b, 523},
-	{0x247c, 524},
-	{0x247d, 525},
-	{0x2500, 311},
-	{0x2502, 312},
-	{0x250c, 314},
-	{0x2510, 315},
-	{0x2514, 316},
-	{0x2518, 317},
-	{0x251c, 309},
-	{0x2524, 308},
-	{0x252c, 307},
-	{0x2534, 306},
-	{0x253c, 305},
-	{0x2550, 322},
-	{0x255e, 323},
-	{0x2561, 325},
-	{0x256a, 324},
-	{0x256d, 318},
-	{0x256e, 319},
-	{0x256f, 321},
-	{0x2570, 320},
-	{0x2571, 330},
-	{0x2572, 331},
-	{0x2573, 332},
-	{0x2581, 290},
-	{0x2582, 291},
-	{0x2583, 292},
-	{0x2584, 293},
-	{0x2585, 294},
-	{0x2586, 295},
-	{0x2587, 296},
-	{0x2588, 297},
-	{0x2589, 304},
-	{0x258a, 303},
-	{0x258b, 302},
-	{0x258c, 301},
-	{0x258d, 300},
-	{0x258e, 299},
-	{0x258f, 298},
-	{0x2594, 310},
-	{0x2595, 313},
-	{0x25a0, 190},
-	{0x25a1, 189},
-	{0x25b2, 183},
-	{0x25b3, 182},
-	{0x25bc, 192},
-	{0x25bd, 191},
-	{0x25c6, 188},
-	{0x25c7, 187},
-	{0x25cb, 180},
-	{0x25ce, 184},
-	{0x25cf, 181},
-	{0x25e2, 326},
-	{0x25e3, 327},
-	{0x25e4, 329},
-	{0x25e5, 328},
-	{0x2605, 186},
-	{0x2606, 185},
-	{0x2609, 244},
-	{0x2640, 241},
-	{0x2641, 243},
-	{0x2642, 242},
-	{0x2e87, 0},
-	{0x2e88, 1},
-	{0x2e8d, 0},
-	{0x2e9d, 732},
-	{0x2ec6, 1289},
-	{0x2ecd, 0},
-	{0x2ed7, 0},
-	{0x2ee3, 2550},
-	{0x2f33, 551},
-	{0x3000, 99},
-	{0x3001, 101},
-	{0x3002, 102},
-	{0x3003, 179},
-	{0x3006, 0},
-	{0x3007, 1},
-	{0x3008, 148},
-	{0x3009, 149},
-	{0x300a, 144},
-	{0x300b, 145},
-	{0x300c, 152},
-	{0x300d, 153},
-	{0x300e, 156},
-	{0x300f, 157},
-	{0x3010, 140},
-	{0x3011, 141},
-	{0x3012, 261},
-	{0x3014, 136},
-	{0x3015, 137},
-	{0x301d, 170},
-	{0x301e, 171},
-	{0x3021, 353},
-	{0x3022, 354},
-	{0x3023, 355},
-	{0x3024, 356},
-	{0x3025, 357},
-	{0x3026, 358},
-	{0x3027, 359},
-	{0x3028, 360},
-	{0x3029, 361},
-	{0x3042, 0},
-	{0x3043, 1},
-	{0x3044, 2},
-	{0x3045, 3},
-	{0x3046, 4},
-	{0x3047, 5},
-	{0x3048, 6},
-	{0x3049, 7},
-	{0x304a, 8},
-	{0x304b, 9},
-	{0x304c, 10},
-	{0x304d, 11},
-	{0x304e, 12},
-	{0x304f, 13},
-	{0x3050, 14},
-	{0x3051, 15},
-	{0x3052, 16},
-	{0x3053, 17},
-	{0x3054, 18},
-	{0x3055, 19},
-	{0x3056, 20},
-	{0x3057, 21},
-	{0x3058, 22},
-	{0x3059, 23},
-	{0x305a, 24},
-	{0x305b, 25},
-	{0x305c, 26},
-	{0x305d, 27},
-	{0x305e, 28},
-	{0x305f, 29},
-	{0x3060, 30},
-	{0x3061, 31},
-	{0x3062, 32},
-	{0x3063, 33},
-	{0x3064, 34},
-	{0x3065, 35},
-	{0x3066, 36},
-	{0x3067, 37},
-	{0x3068, 38},
-	{0x3069, 39},
-	{0x306a, 40},
-	{0x306b, 41},
-	{0x306c, 42},
-	{0x306d, 43},
-	{0x306e, 44},
-	{0x306f, 45},
-	{0x3070, 46},
-	{0x3071, 47},
-	{0x3072, 48},
-	{0x3073, 49},
-	{0x3074, 50},
-	{0x3075, 51},
-	{0x3076, 52},
-	{0x3077, 53},
-	{0x3078, 54},
-	{0x3079, 55},
-	{0x307a, 56},
-	{0x307b, 57},
-	{0x307c, 58},
-	{0x307d, 59},
-	{0x307e, 60},
-	{0x307f, 61},
-	{0x3080, 62},
-	{0x3081, 63},
-	{0x3082, 64},
-	{0x3083, 65},
-	{0x3084, 66},
-	{0x3085, 67},
-	{0x3086, 68},
-	{0x3087, 69},
-	{0x3088, 70},
-	{0x3089, 71},
-	{0x308a, 72},
-	{0x308b, 73},
-	{0x308c, 74},
-	{0x308d, 75},
-	{0x308e, 76},
-	{0x308f, 77},
-	{0x3090, 78},
-	{0x3091, 79},
-	{0x3092, 80},
-	{0x3093, 81},
-	{0x309c, 0},
-	{0x309e, 0},
-	{0x30a2, 0},
-	{0x30a3, 1},
-	{0x30a4, 2},
-	{0x30a5, 3},
-	{0x30a6, 4},
-	{0x30a7, 5},
-	{0x30a8, 6},
-	{0x30a9, 7},
-	{0x30aa, 8},
-	{0x30ab, 9},
-	{0x30ac, 10},
-	{0x30ad, 11},
-	{0x30ae, 12},
-	{0x30af, 13},
-	{0x30b0, 14},
-	{0x30b1, 15},
-	{0x30b2, 16},
-	{0x30b3, 17},
-	{0x30b4, 18},
-	{0x30b5, 19},
-	{0x30b6, 20},
-	{0x30b7, 21},
-	{0x30b8, 22},
-	{0x30b9, 23},
-	{0x30ba, 24},
-	{0x30bb, 25},
-	{0x30bc, 26},
-	{0x30bd, 27},
-	{0x30be, 28},
-	{0x30bf, 29},
-	{0x30c0, 30},
-	{0x30c1, 31},
-	{0x30c2, 32},
-	{0x30c3, 33},
-	{0x30c4, 34},
-	{0x30c5, 35},
-	{0x30c6, 36},
-	{0x30c7, 37},
-	{0x30c8, 38},
-	{0x30c9, 39},
-	{0x30ca, 40},
-	{0x30cb, 41},
-	{0x30cc, 42},
-	{0x30cd, 43},
-	{0x30ce, 44},
-	{0x30cf, 45},
-	{0x30d0, 46},
-	{0x30d1, 47},
-	{0x30d2, 48},
-	{0x30d3, 49},
-	{0x30d4, 50},
-	{0x30d5, 51},
-	{0x30d6, 52},
-	{0x30d7, 53},
-	{0x30d8, 54},
-	{0x30d9, 55},
-	{0x30da, 56},
-	{0x30db, 57},
-	{0x30dc, 58},
-	{0x30dd, 59},
-	{0x30de, 60},
-	{0x30df, 61},
-	{0x30e0, 62},
-	{0x30e1, 63},
-	{0x30e2, 64},
-	{0x30e3, 65},
-	{0x30e4, 66},
-	{0x30e5, 67},
-	{0x30e6, 68},
-	{0x30e7, 69},
-	{0x30e8, 70},
-	{0x30e9, 71},
-	{0x30ea, 72},
-	{0x30eb, 73},
-	{0x30ec, 74},
-	{0x30ed, 75},
-	{0x30ee, 76},
-	{0x30ef, 77},
-	{0x30f0, 78},
-	{0x30f1, 79},
-	{0x30f2, 80},
-	{0x30f3, 81},
-	{0x30f4, 82},
-	{0x30f5, 83},
-	{0x30f6, 84},
-	{0x30fe, 0},
-	{0x3105, 465},
-	{0x3106, 466},
-	{0x3107, 467},
-	{0x3108, 468},
-	{0x3109, 469},
-	{0x310a, 470},
-	{0x310b, 471},
-	{0x310c, 472},
-	{0x310d, 473},
-	{0x310e, 474},
-	{0x310f, 475},
-	{0x3110, 476},
-	{0x3111, 477},
-	{0x3112, 478},
-	{0x3113, 479},
-	{0x3114, 480},
-	{0x3115, 481},
-	{0x3116, 482},
-	{0x3117, 483},
-	{0x3118, 484},
-	{0x3119, 485},
-	{0x311a, 486},
-	{0x311b, 487},
-	{0x311c, 488},
-	{0x311d, 489},
-	{0x311e, 490},
-	{0x311f, 491},
-	{0x3120, 492},
-	{0x3121, 493},
-	{0x3122, 494},
-	{0x3123, 495},
-	{0x3124, 496},
-	{0x3125, 497},
-	{0x3126, 498},
-	{0x3127, 499},
-	{0x3128, 500},
-	{0x3129, 501},
-	{0x32a3, 193},
-	{0x338e, 277},
-	{0x338f, 278},
-	{0x339c, 272},
-	{0x339d, 273},
-	{0x339e, 274},
-	{0x33a1, 276},
-	{0x33c4, 279},
-	{0x33ce, 275},
-	{0x33d1, 236},
-	{0x33d2, 235},
-	{0x33d5, 271},
-	{0x4e00, 595},
-	{0x4e01, 597},
-	{0x4e03, 598},
-	{0x4e07, 6001},
-	{0x4e08, 617},
-	{0x4e09, 615},
-	{0x4e0a, 618},
-	{0x4e0b, 616},
-	{0x4e0c, 6002},
-	{0x4e0d, 660},
-	{0x4e0e, 6010},
-	{0x4e0f, 6008},
-	{0x4e10, 659},
-	{0x4e11, 658},
-	{0x4e14, 754},
-	{0x4e15, 753},
-	{0x4e16, 752},
-	{0x4e18, 755},
-	{0x4e19, 751},
-	{0x4e1e, 878},
-	{0x4e1f, 879},
-	{0x4e26, 1320},
-	{0x4e28, 536},
-	{0x4e2b, 619},
-	{0x4e2d, 661},
-	{0x4e2e, 6011},
-	{0x4e30, 662},
-	{0x4e31, 6030},
-	{0x4e32, 1045},
-	{0x4e33, 6388},
-	{0x4e36, 537},
-	{0x4e38, 620},
-	{0x4e39, 663},
-	{0x4e3b, 756},
-	{0x4e3c, 6031},
-	{0x4e3f, 538},
-	{0x4e42, 5996},
-	{0x4e43, 599},
-	{0x4e45, 622},
-	{0x4e47, 6003},
-	{0x4e48, 623},
-	{0x4e4b, 664},
-	{0x4e4d, 757},
-	{0x4e4e, 759},
-	{0x4e4f, 758},
-	{0x4e52, 880},
-	{0x4e53, 881},
-	{0x4e56, 1321},
-	{0x4e58, 2097},
-	{0x4e59, 596},
-	{0x4e5c, 5997},
-	{0x4e5d, 600},
-	{0x4e5e, 625},
-	{0x4e5f, 624},
-	{0x4e69, 882},
-	{0x4e73, 1322},
-	{0x4e7e, 2555},
-	{0x4e7f, 7733},
-	{0x4e82, 3518},
-	{0x4e83, 9057},
-	{0x4e84, 9058},
-	{0x4e85, 539},
-	{0x4e86, 601},
-	{0x4e88, 666},
-	{0x4e8b, 1323},
-	{0x4e8c, 602},
-	{0x4e8d, 6004},
-	{0x4e8e, 626},
-	{0x4e91, 667},
-	{0x4e92, 669},
-	{0x4e93, 6012},
-	{0x4e94, 670},
-	{0x4e95, 668},
-	{0x4e99, 883},
-	{0x4e9b, 1324},
-	{0x4e9e, 1325},
-	{0x4e9f, 1699},
-	{0x4ea0, 540},
-	{0x4ea1, 627},
-	{0x4ea2, 671},
-	{0x4ea4, 884},
-	{0x4ea5, 886},
-	{0x4ea6, 885},
-	{0x4ea8, 1046},
-	{0x4eab, 1326},
-	{0x4eac, 1327},
-	{0x4ead, 1700},
-	{0x4eae, 1701},
-	{0x4eb3, 2098},
-	{0x4eb6, 9059},
-	{0x4eba, 603},
-	{0x4ec0, 673},
-	{0x4ec1, 672},
-	{0x4ec2, 6013},
-	{0x4ec3, 674},
-	{0x4ec4, 680},
-	{0x4ec6, 675},
-	{0x4ec7, 676},
-	{0x4ec8, 6015},
-	{0x4ec9, 6014},
-	{0x4eca, 678},
-	{0x4ecb, 679},
-	{0x4ecd, 677},
-	{0x4ed4, 762},
-	{0x4ed5, 763},
-	{0x4ed6, 764},
-	{0x4ed7, 765},
-	{0x4ed8, 761},
-	{0x4ed9, 768},
-	{0x4eda, 6037},
-	{0x4edc, 6033},
-	{0x4edd, 6036},
-	{0x4ede, 769},
-	{0x4edf, 785},
-	{0x4ee1, 6035},
-	{0x4ee3, 766},
-	{0x4ee4, 767},
-	{0x4ee5, 760},
-	{0x4ee8, 6032},
-	{0x4ee9, 6034},
-	{0x4ef0, 899},
-	{0x4ef1, 6074},
-	{0x4ef2, 896},
-	{0x4ef3, 900},
-	{0x4ef4, 6084},
-	{0x4ef5, 6072},
-	{0x4ef6, 897},
-	{0x4ef7, 6076},
-	{0x4efb, 898},
-	{0x4efd, 901},
-	{0x4eff, 887},
-	{0x4f00, 6075},
-	{0x4f01, 902},
-	{0x4f02, 6079},
-	{0x4f04, 6083},
-	{0x4f05, 6080},
-	{0x4f08, 6077},
-	{0x4f09, 888},
-	{0x4f0a, 890},
-	{0x4f0b, 903},
-	{0x4f0d, 892},
-	{0x4f0e, 6069},
-	{0x4f0f, 895},
-	{0x4f10, 893},
-	{0x4f11, 894},
-	{0x4f12, 6085},
-	{0x4f13, 6082},
-	{0x4f14, 6073},
-	{0x4f15, 891},
-	{0x4f18, 6070},
-	{0x4f19, 889},
-	{0x4f1d, 6078},
-	{0x4f22, 6081},
-	{0x4f2c, 6071},
-	{0x4f2d, 6191},
-	{0x4f2f, 1068},
-	{0x4f30, 1055},
-	{0x4f33, 6192},
-	{0x4f34, 1052},
-	{0x4f36, 1070},
-	{0x4f38, 1060},
-	{0x4f3a, 1059},
-	{0x4f3b, 6180},
-	{0x4f3c, 1063},
-	{0x4f3d, 1058},
-	{0x4f3e, 6185},
-	{0x4f3f, 6193},
-	{0x4f41, 6189},
-	{0x4f43, 1061},
-	{0x4f46, 1064},
-	{0x4f47, 1049},
-	{0x4f48, 1073},
-	{0x4f49, 6182},
-	{0x4f4c, 6400},
-	{0x4f4d, 1047},
-	{0x4f4e, 1069},
-	{0x4f4f, 1048},
-	{0x4f50, 1056},
-	{0x4f51, 1057},
-	{0x4f52, 6187},
-	{0x4f53, 6183},
-	{0x4f54, 1062},
-	{0x4f55, 1054},
-	{0x4f56, 6179},
-	{0x4f57, 1050},
-	{0x4f58, 6190},
-	{0x4f59, 1071},
-	{0x4f5a, 1074},
-	{0x4f5b, 1053},
-	{0x4f5c, 1066},
-	{0x4f5d, 1072},
-	{0x4f5e, 1051},
-	{0x4f5f, 6188},
-	{0x4f60, 1067},
-	{0x4f61, 6194},
-	{0x4f62, 6181},
-	{0x4f63, 1065},
-	{0x4f64, 6184},
-	{0x4f67, 6186},
-	{0x4f69, 1341},
-	{0x4f6a, 6402},
-	{0x4f6b, 6414},
-	{0x4f6c, 1333},
-	{0x4f6e, 6415},
-	{0x4f6f, 1328},
-	{0x4f70, 1338},
-	{0x4f73, 1331},
-	{0x4f74, 6396},
-	{0x4f75, 1339},
-	{0x4f76, 6395},
-	{0x4f77, 6399},
-	{0x4f78, 6406},
-	{0x4f79, 6404},
-	{0x4f7a, 1347},
-	{0x4f7b, 1342},
-	{0x4f7c, 6390},
-	{0x4f7d, 6392},
-	{0x4f7e, 1344},
-	{0x4f7f, 1332},
-	{0x4f80, 6393},
-	{0x4f81, 6405},
-	{0x4f82, 6412},
-	{0x4f83, 1337},
-	{0x4f84, 6398},
-	{0x4f85, 6391},
-	{0x4f86, 1336},
-	{0x4f87, 6394},
-	{0x4f88, 1340},
-	{0x4f89, 6397},
-	{0x4f8b, 1335},
-	{0x4f8d, 1330},
-	{0x4f8f, 1345},
-	{0x4f90, 6407},
-	{0x4f91, 1346},
-	{0x4f92, 6411},
-	{0x4f94, 6409},
-	{0x4f95, 6413},
-	{0x4f96, 1343},
-	{0x4f97, 6401},
-	{0x4f98, 6389},
-	{0x4f9a, 6403},
-	{0x4f9b, 1334},
-	{0x4f9c, 6408},
-	{0x4f9d, 1329},
-	{0x4f9e, 6410},
-	{0x4fae, 1716},
-	{0x4faf, 1704},
-	{0x4fb2, 6749},
-	{0x4fb3, 6757},
-	{0x4fb5, 1703},
-	{0x4fb6, 1711},
-	{0x4fb7, 1723},
-	{0x4fb9, 6763},
-	{0x4fba, 6761},
-	{0x4fbb, 6756},
-	{0x4fbf, 1705},
-	{0x4fc0, 6762},
-	{0x4fc1, 6752},
-	{0x4fc2, 1719},
-	{0x4fc3, 1710},
-	{0x4fc4, 1718},
-	{0x4fc5, 6747},
-	{0x4fc7, 6759},
-	{0x4fc9, 6750},
-	{0x4fca, 1714},
-	{0x4fcb, 6751},
-	{0x4fcd, 6746},
-	{0x4fce, 1721},
-	{0x4fcf, 1708},
-	{0x4fd0, 1717},
-	{0x4fd1, 1707},
-	{0x4fd3, 6748},
-	{0x4fd4, 6753},
-	{0x4fd6, 6760},
-	{0x4fd7, 1715},
-	{0x4fd8, 1712},
-	{0x4fd9, 6755},
-	{0x4fda, 1720},
-	{0x4fdb, 6758},
-	{0x4fdc, 6754},
-	{0x4fdd, 1709},
-	{0x4fde, 1722},
-	{0x4fdf, 1713},
-	{0x4fe0, 1706},
-	{0x4fe1, 1702},
-	{0x4fec, 6764},
-	{0x4fee, 2124},
-	{0x4fef, 2102},
-	{0x4ff1, 2118},
-	{0x4ff3, 2123},
-	{0x4ff4, 7204},
-	{0x4ff5, 7203},
-	{0x4ff6, 7208},
-	{0x4ff7, 7209},
-	{0x4ff8, 2105},
-	{0x4ffa, 2114},
-	{0x4ffe, 2127},
-	{0x5000, 2115},
-	{0x5005, 7197},
-	{0x5006, 2108},
-	{0x5007, 7198},
-	{0x5009, 2129},
-	{0x500b, 2120},
-	{0x500c, 2099},
-	{0x500d, 2100},
-	{0x500e, 7217},
-	{0x500f, 2572},
-	{0x5011, 2113},
-	{0x5012, 2112},
-	{0x5013, 7199},
-	{0x5014, 2116},
-	{0x5015, 7749},
-	{0x5016, 2107},
-	{0x5017, 7210},
-	{0x5018, 2122},
-	{0x5019, 2121},
-	{0x501a, 2111},
-	{0x501b, 7202},
-	{0x501c, 7211},
-	{0x501e, 7196},
-	{0x501f, 2110},
-	{0x5020, 7212},
-	{0x5021, 2119},
-	{0x5022, 7200},
-	{0x5023, 2101},
-	{0x5025, 2104},
-	{0x5026, 2103},
-	{0x5027, 7213},
-	{0x5028, 2117},
-	{0x5029, 2106},
-	{0x502a, 2126},
-	{0x502b, 2128},
-	{0x502c, 7207},
-	{0x502d, 2125},
-	{0x502f, 7215},
-	{0x5030, 7201},
-	{0x5031, 7216},
-	{0x5033, 7205},
-	{0x5035, 7214},
-	{0x5037, 7206},
-	{0x503c, 2109},
-	{0x5040, 7757},
-	{0x5041, 7745},
-	{0x5043, 2560},
-	{0x5045, 7750},
-	{0x5046, 7756},
-	{0x5047, 2559},
-	{0x5048, 7743},
-	{0x5049, 2563},
-	{0x504a, 7747},
-	{0x504b, 7740},
-	{0x504c, 2561},
-	{0x504d, 7744},
-	{0x504e, 2566},
-	{0x504f, 2571},
-	{0x5051, 7761},
-	{0x5053, 7739},
-	{0x5055, 2567},
-	{0x5057, 7760},
-	{0x505a, 2562},
-	{0x505b, 7746},
-	{0x505c, 2558},
-	{0x505d, 7741},
-	{0x505e, 7737},
-	{0x505f, 7751},
-	{0x5060, 7738},
-	{0x5061, 7736},
-	{0x5062, 7748},
-	{0x5063, 7754},
-	{0x5064, 7755},
-	{0x5065, 2564},
-	{0x5068, 8376},
-	{0x5069, 7752},
-	{0x506a, 7735},
-	{0x506b, 7753},
-	{0x506d, 2574},
-	{0x506e, 7758},
-	{0x506f, 2573},
-	{0x5070, 7734},
-	{0x5072, 7742},
-	{0x5073, 7759},
-	{0x5074, 2569},
-	{0x5075, 2568},
-	{0x5076, 2565},
-	{0x5077, 2570},
-	{0x507a, 2556},
-	{0x507d, 2557},
-	{0x5080, 3052},
-	{0x5082, 8379},
-	{0x5083, 8372},
-	{0x5085, 3049},
-	{0x5087, 8380},
-	{0x508b, 8370},
-	{0x508c, 8373},
-	{0x508d, 3048},
-	{0x508e, 8374},
-	{0x5091, 3051},
-	{0x5092, 8378},
-	{0x5094, 8368},
-	{0x5095, 8367},
-	{0x5096, 3053},
-	{0x5098, 3054},
-	{0x5099, 3050},
-	{0x509a, 3055},
-	{0x509b, 8366},
-	{0x509c, 8377},
-	{0x509d, 8375},
-	{0x509e, 8369},
-	{0x50a2, 3047},
-	{0x50a3, 8371},
-	{0x50ac, 3525},
-	{0x50ad, 3519},
-	{0x50ae, 9063},
-	{0x50af, 3528},
-	{0x50b0, 9069},
-	{0x50b1, 9072},
-	{0x50b2, 3521},
-	{0x50b3, 3522},
-	{0x50b4, 9066},
-	{0x50b5, 3520},
-	{0x50b6, 9075},
-	{0x50b7, 3526},
-	{0x50b8, 9076},
-	{0x50ba, 9071},
-	{0x50bb, 3527},
-	{0x50bd, 9060},
-	{0x50be, 3524},
-	{0x50bf, 9061},
-	{0x50c1, 9070},
-	{0x50c2, 9068},
-	{0x50c4, 9064},
-	{0x50c5, 3523},
-	{0x50c6, 9062},
-	{0x50c7, 3529},
-	{0x50c8, 9067},
-	{0x50c9, 9074},
-	{0x50ca, 9065},
-	{0x50cb, 9073},
-	{0x50ce, 3976},
-	{0x50cf, 3973},
-	{0x50d1, 3974},
-	{0x50d3, 9756},
-	{0x50d4, 9748},
-	{0x50d5, 3972},
-	{0x50d6, 3969},
-	{0x50d7, 9749},
-	{0x50da, 3971},
-	{0x50db, 9752},
-	{0x50dd, 9754},
-	{0x50e0, 9761},
-	{0x50e3, 9760},
-	{0x50e4, 9755},
-	{0x50e5, 3968},
-	{0x50e6, 9747},
-	{0x50e7, 3966},
-	{0x50e8, 9750},
-	{0x50e9, 3977},
-	{0x50ea, 9753},
-	{0x50ec, 9757},
-	{0x50ed, 3970},
-	{0x50ee, 3967},
-	{0x50ef, 9759},
-	{0x50f0, 9758},
-	{0x50f1, 3975},
-	{0x50f3, 9751},
-	{0x50f5, 4357},
-	{0x50f9, 4358},
-	{0x50fb, 4356},
-	{0x5100, 4355},
-	{0x5102, 4359},
-	{0x5104, 4354},
-	{0x5105, 4362},
-	{0x5107, 0},
-	{0x5108, 4360},
-	{0x5109, 4361},
-	{0x510c, 0},
-	{0x5110, 4749},
-	{0x5112, 4746},
-	{0x5114, 4748},
-	{0x5115, 4750},
-	{0x5118, 4747},
-	{0x511f, 5045},
-	{0x5121, 5046},
-	{0x512a, 5044},
-	{0x512e, 0},
-	{0x5132, 5047},
-	{0x5133, 5493},
-	{0x5135, 0},
-	{0x5137, 5736},
-	{0x5138, 5737},
-	{0x513b, 5820},
-	{0x513c, 5819},
-	{0x513f, 604},
-	{0x5140, 628},
-	{0x5141, 682},
-	{0x5143, 681},
-	{0x5144, 771},
-	{0x5145, 770},
-	{0x5146, 906},
-	{0x5147, 905},
-	{0x5148, 907},
-	{0x5149, 904},
-	{0x514b, 1076},
-	{0x514c, 1075},
-	{0x514d, 1077},
-	{0x5152, 1349},
-	{0x5154, 1348},
-	{0x5155, 1350},
-	{0x5157, 1724},
-	{0x5159, 281},
-	{0x515a, 7218},
-	{0x515b, 282},
-	{0x515c, 2575},
-	{0x515d, 284},
-	{0x515e, 283},
-	{0x515f, 8381},
-	{0x5161, 285},
-	{0x5162, 3978},
-	{0x5163, 286},
-	{0x5165, 605},
-	{0x5167, 683},
-	{0x5168, 908},
-	{0x5169, 1351},
-	{0x516b, 606},
-	{0x516c, 686},
-	{0x516d, 684},
-	{0x516e, 685},
-	{0x5171, 909},
-	{0x5175, 1078},
-	{0x5176, 1353},
-	{0x5177, 1352},
-	{0x5178, 1354},
-	{0x517c, 2130},
-	{0x5180, 4751},
-	{0x5182, 541},
-	{0x5187, 6009},
-	{0x5189, 772},
-	{0x518a, 773},
-	{0x518d, 910},
-	{0x518f, 6195},
-	{0x5191, 1726},
-	{0x5192, 1725},
-	{0x5193, 7220},
-	{0x5194, 7219},
-	{0x5195, 2576},
-	{0x5196, 542},
-	{0x5197, 687},
-	{0x5198, 6016},
-	{0x519e, 6416},
-	{0x51a0, 1727},
-	{0x51a2, 2133},
-	{0x51a4, 2131},
-	{0x51a5, 2132},
-	{0x51aa, 4752},
-	{0x51ab, 543},
-	{0x51ac, 774},
-	{0x51b0, 911},
-	{0x51b1, 6086},
-	{0x51b6, 1079},
-	{0x51b7, 1080},
-	{0x51b9, 6196},
-	{0x51bc, 6417},
-	{0x51bd, 1355},
-	{0x51be, 6418},
-	{0x51c4, 7222},
-	{0x51c5, 7223},
-	{0x51c6, 2136},
-	{0x51c8, 7224},
-	{0x51ca, 7221},
-	{0x51cb, 2137},
-	{0x51cc, 2135},
-	{0x51cd, 2134},
-	{0x51ce, 7225},
-	{0x51d0, 7762},
-	{0x51d4, 8382},
-	{0x51d7, 9077},
-	{0x51d8, 9762},
-	{0x51dc, 4363},
-	{0x51dd, 4753},
-	{0x51e0, 607},
-	{0x51e1, 621},
-	{0x51f0, 2577},
-	{0x51f1, 3057},
-	{0x51f3, 3979},
-	{0x51f5, 5998},
-	{0x51f6, 688},
-	{0x51f8, 777},
-	{0x51f9, 775},
-	{0x51fa, 776},
-	{0x51fd, 1356},
-	{0x5200, 608},
-	{0x5201, 609},
-	{0x5203, 629},
-	{0x5206, 689},
-	{0x5207, 690},
-	{0x5208, 691},
-	{0x5209, 6039},
-	{0x520a, 778},
-	{0x520c, 6038},
-	{0x520e, 915},
-	{0x5210, 6088},
-	{0x5211, 913},
-	{0x5212, 914},
-	{0x5213, 6087},
-	{0x5216, 916},
-	{0x5217, 912},
-	{0x521c, 6197},
-	{0x521d, 1675},
-	{0x521e, 6198},
-	{0x5221, 6199},
-	{0x5224, 1082},
-	{0x5225, 1081},
-	{0x5228, 1085},
-	{0x5229, 1083},
-	{0x522a, 1084},
-	{0x522e, 1362},
-	{0x5230, 1361},
-	{0x5231, 6423},
-	{0x5232, 6420},
-	{0x5233, 6421},
-	{0x5235, 6419},
-	{0x5236, 1363},
-	{0x5237, 1359},
-	{0x5238, 1358},
-	{0x523a, 1360},
-	{0x523b, 1357},
-	{0x5241, 1364},
-	{0x5243, 1729},
-	{0x5244, 6765},
-	{0x5246, 6422},
-	{0x5247, 1734},
-	{0x5249, 6766},
-	{0x524a, 1730},
-	{0x524b, 1733},
-	{0x524c, 1732},
-	{0x524d, 1731},
-	{0x524e, 1728},
-	{0x5252, 7228},
-	{0x5254, 2140},
-	{0x5255, 7231},
-	{0x5256, 2138},
-	{0x525a, 7227},
-	{0x525b, 2141},
-	{0x525c, 2139},
-	{0x525d, 2142},
-	{0x525e, 7229},
-	{0x525f, 7230},
-	{0x5261, 7226},
-	{0x5262, 7232},
-	{0x5269, 3061},
-	{0x526a, 2578},
-	{0x526b, 7763},
-	{0x526c, 7765},
-	{0x526d, 7764},
-	{0x526e, 7766},
-	{0x526f, 2579},
-	{0x5272, 3058},
-	{0x5274, 3059},
-	{0x5275, 3060},
-	{0x5277, 3531},
-	{0x5278, 9079},
-	{0x527a, 9078},
-	{0x527b, 9080},
-	{0x527c, 9081},
-	{0x527d, 3532},
-	{0x527f, 3530},
-	{0x5280, 9763},
-	{0x5281, 9764},
-	{0x5282, 3981},
-	{0x5283, 3980},
-	{0x5287, 4364},
-	{0x5288, 4365},
-	{0x5289, 4366},
-	{0x528a, 4368},
-	{0x528c, 0},
-	{0x528d, 4367},
-	{0x5291, 4754},
-	{0x5293, 4755},
-	{0x529b, 610},
-	{0x529f, 780},
-	{0x52a0, 779},
-	{0x52a3, 917},
-	{0x52a6, 6089},
-	{0x52a9, 1087},
-	{0x52aa, 1088},
-	{0x52ab, 1086},
-	{0x52ac, 1089},
-	{0x52ad, 6200},
-	{0x52ae, 6201},
-	{0x52bb, 1366},
-	{0x52bc, 6424},
-	{0x52be, 1365},
-	{0x52c0, 6767},
-	{0x52c1, 1738},
-	{0x52c2, 6768},
-	{0x52c3, 1737},
-	{0x52c7, 1735},
-	{0x52c9, 1736},
-	{0x52cd, 7233},
-	{0x52d2, 2580},
-	{0x52d3, 7768},
-	{0x52d5, 2583},
-	{0x52d6, 7767},
-	{0x52d7, 2767},
-	{0x52d8, 2582},
-	{0x52d9, 2581},
-	{0x52db, 3064},
-	{0x52dd, 3063},
-	{0x52de, 3062},
-	{0x52df, 3533},
-	{0x52e2, 3536},
-	{0x52e3, 3537},
-	{0x52e4, 3535},
-	{0x52e6, 3534},
-	{0x52e9, 9765},
-	{0x52eb, 9766},
-	{0x52f0, 4369},
-	{0x52f3, 4756},
-	{0x52f5, 5048},
-	{0x52f8, 5641},
-	{0x52f9, 544},
-	{0x52fa, 630},
-	{0x52fb, 692},
-	{0x52fc, 6017},
-	{0x52fe, 693},
-	{0x52ff, 694},
-	{0x5305, 781},
-	{0x5306, 782},
-	{0x5308, 918},
-	{0x5309, 6202},
-	{0x530a, 6425},
-	{0x530b, 6426},
-	{0x530d, 1739},
-	{0x530e, 7234},
-	{0x530f, 2585},
-	{0x5310, 2584},
-	{0x5311, 8384},
-	{0x5312, 8383},
-	{0x5315, 611},
-	{0x5316, 695},
-	{0x5317, 783},
-	{0x5319, 2586},
-	{0x531a, 5999},
-	{0x531c, 6040},
-	{0x531d, 784},
-	{0x531f, 6091},
-	{0x5320, 920},
-	{0x5321, 919},
-	{0x5322, 6090},
-	{0x5323, 1090},
-	{0x532a, 2143},
-	{0x532d, 7769},
-	{0x532f, 3538},
-	{0x5330, 9767},
-	{0x5331, 3982},
-	{0x5338, 545},
-	{0x5339, 696},
-	{0x533c, 6427},
-	{0x533d, 6769},
-	{0x533e, 2589},
-	{0x533f, 2587},
-	{0x5340, 2588},
-	{0x5341, 612},
-	{0x5343, 631},
-	{0x5344, 363},
-	{0x5345, 699},
-	{0x5347, 698},
-	{0x5348, 697},
-	{0x5349, 787},
-	{0x534a, 786},
-	{0x534c, 6041},
-	{0x534d, 6092},
-	{0x5351, 1370},
-	{0x5352, 1367},
-	{0x5353, 1369},
-	{0x5354, 1368},
-	{0x5357, 1740},
-	{0x535a, 3065},
-	{0x535c, 613},
-	{0x535e, 700},
-	{0x5360, 789},
-	{0x5361, 788},
-	{0x5363, 6203},
-	{0x5366, 1371},
-	{0x5369, 546},
-	{0x536c, 6018},
-	{0x536e, 791},
-	{0x536f, 790},
-	{0x5370, 921},
-	{0x5371, 922},
-	{0x5372, 6204},
-	{0x5373, 1091},
-	{0x5375, 1092},
-	{0x5377, 1372},
-	{0x5378, 1373},
-	{0x5379, 1374},
-	{0x537b, 1741},
-	{0x537c, 6770},
-	{0x537f, 2144},
-	{0x5382, 6000},
-	{0x5384, 701},
-	{0x538a, 6093},
-	{0x538e, 6205},
-	{0x538f, 6206},
-	{0x5392, 6428},
-	{0x5394, 6429},
-	{0x5396, 6772},
-	{0x5397, 6771},
-	{0x5398, 6774},
-	{0x5399, 6773},
-	{0x539a, 1742},
-	{0x539c, 7770},
-	{0x539d, 2146},
-	{0x539e, 7235},
-	{0x539f, 2145},
-	{0x53a4, 8385},
-	{0x53a5, 3066},
-	{0x53a7, 8386},
-	{0x53ac, 9768},
-	{0x53ad, 3983},
-	{0x53b2, 4370},
-	{0x53b6, 547},
-	{0x53b9, 6019},
-	{0x53bb, 792},
-	{0x53c3, 2590},
-	{0x53c8, 614},
-	{0x53c9, 632},
-	{0x53ca, 703},
-	{0x53cb, 702},
-	{0x53cd, 704},
-	{0x53d4, 1376},
-	{0x53d6, 1375},
-	{0x53d7, 1377},
-	{0x53db, 1743},
-	{0x53df, 2147},
-	{0x53e2, 5321},
-	{0x53e3, 633},
-	{0x53e4, 794},
-	{0x53e5, 809},
-	{0x53e6, 804},
-	{0x53e8, 799},
-	{0x53e9, 798},
-	{0x53ea, 805},
-	{0x53eb, 803},
-	{0x53ec, 796},
-	{0x53ed, 810},
-	{0x53ee, 797},
-	{0x53ef, 793},
-	{0x53f0, 808},
-	{0x53f1, 807},
-	{0x53f2, 806},
-	{0x53f3, 795},
-	{0x53f5, 802},
-	{0x53f8, 801},
-	{0x53fb, 811},
-	{0x53fc, 800},
-	{0x5401, 928},
-	{0x5403, 934},
-	{0x5404, 930},
-	{0x5406, 936},
-	{0x5407, 6094},
-	{0x5408, 933},
-	{0x5409, 923},
-	{0x540a, 926},
-	{0x540b, 929},
-	{0x540c, 925},
-	{0x540d, 932},
-	{0x540e, 935},
-	{0x540f, 924},
-	{0x5410, 927},
-	{0x5411, 931},
-	{0x5412, 937},
-	{0x5418, 6215},
-	{0x5419, 6212},
-	{0x541b, 1105},
-	{0x541c, 6213},
-	{0x541d, 1093},
-	{0x541e, 1095},
-	{0x541f, 1119},
-	{0x5420, 1114},
-	{0x5424, 6220},
-	{0x5425, 6214},
-	{0x5426, 1097},
-	{0x5427, 1099},
-	{0x5428, 6219},
-	{0x5429, 1106},
-	{0x542a, 6209},
-	{0x542b, 1118},
-	{0x542c, 1120},
-	{0x542d, 1094},
-	{0x542e, 1111},
-	{0x5430, 6207},
-	{0x5431, 1117},
-	{0x5433, 1102},
-	{0x5435, 1112},
-	{0x5436, 1113},
-	{0x5437, 6208},
-	{0x5438, 1110},
-	{0x5439, 1108},
-	{0x543b, 1109},
-	{0x543c, 1115},
-	{0x543d, 6216},
-	{0x543e, 1096},
-	{0x5440, 1116},
-	{0x5441, 6218},
-	{0x5442, 1104},
-	{0x5443, 1101},
-	{0x5445, 6211},
-	{0x5446, 1100},
-	{0x5447, 6221},
-	{0x5448, 1103},
-	{0x544a, 1107},
-	{0x544e, 1098},
-	{0x544f, 6217},
-	{0x5454, 6210},
-	{0x5460, 6446},
-	{0x5461, 6445},
-	{0x5462, 1395},
-	{0x5463, 6448},
-	{0x5464, 6450},
-	{0x5465, 6439},
-	{0x5466, 6442},
-	{0x5467, 6449},
-	{0x5468, 1396},
-	{0x546b, 6436},
-	{0x546c, 6440},
-	{0x546f, 6444},
-	{0x5470, 6789},
-	{0x5471, 1391},
-	{0x5472, 6793},
-	{0x5473, 1378},
-	{0x5474, 6441},
-	{0x5475, 1379},
-	{0x5476, 1392},
-	{0x5477, 1385},
-	{0x5478, 1381},
-	{0x547a, 6437},
-	{0x547b, 1384},
-	{0x547c, 1389},
-	{0x547d, 1398},
-	{0x547e, 6438},
-	{0x547f, 6431},
-	{0x5480, 1383},
-	{0x5481, 6432},
-	{0x5482, 6434},
-	{0x5484, 1386},
-	{0x5486, 1388},
-	{0x5487, 6430},
-	{0x5488, 6435},
-	{0x548b, 1397},
-	{0x548c, 1393},
-	{0x548d, 6443},
-	{0x548e, 1399},
-	{0x5490, 1390},
-	{0x5491, 6433},
-	{0x5492, 1387},
-	{0x5495, 1382},
-	{0x5496, 1380},
-	{0x5498, 6447},
-	{0x549a, 1394},
-	{0x54a0, 6788},
-	{0x54a1, 6776},
-	{0x54a2, 6791},
-	{0x54a5, 6778},
-	{0x54a6, 1750},
-	{0x54a7, 1764},
-	{0x54a8, 1746},
-	{0x54a9, 1763},
-	{0x54aa, 1755},
-	{0x54ab, 1760},
-	{0x54ac, 1744},
-	{0x54ad, 6777},
-	{0x54ae, 6783},
-	{0x54af, 1759},
-	{0x54b0, 6795},
-	{0x54b1, 1761},
-	{0x54b3, 1751},
-	{0x54b6, 6785},
-	{0x54b7, 6782},
-	{0x54b8, 1749},
-	{0x54ba, 6775},
-	{0x54bb, 1762},
-	{0x54bc, 6790},
-	{0x54bd, 1754},
-	{0x54be, 6792},
-	{0x54bf, 1765},
-	{0x54c0, 1745},
-	{0x54c1, 1756},
-	{0x54c2, 1753},
-	{0x54c3, 6780},
-	{0x54c4, 1757},
-	{0x54c5, 6786},
-	{0x54c6, 6787},
-	{0x54c7, 1752},
-	{0x54c8, 1758},
-	{0x54c9, 1748},
-	{0x54ce, 1747},
-	{0x54cf, 6779},
-	{0x54d6, 6784},
-	{0x54de, 6794},
-	{0x54e0, 7255},
-	{0x54e1, 2160},
-	{0x54e2, 7237},
-	{0x54e4, 7242},
-	{0x54e5, 2153},
-	{0x54e6, 2164},
-	{0x54e7, 7240},
-	{0x54e8, 2148},
-	{0x54e9, 2158},
-	{0x54ea, 2163},
-	{0x54eb, 7247},
-	{0x54ed, 2159},
-	{0x54ee, 2162},
-	{0x54f1, 7250},
-	{0x54f2, 2154},
-	{0x54f3, 7241},
-	{0x54f7, 7253},
-	{0x54f8, 7254},
-	{0x54fa, 2156},
-	{0x54fb, 7252},
-	{0x54fc, 2152},
-	{0x54fd, 2167},
-	{0x54ff, 7244},
-	{0x5501, 2150},
-	{0x5503, 7257},
-	{0x5504, 7245},
-	{0x5505, 7249},
-	{0x5506, 2155},
-	{0x5507, 2166},
-	{0x5508, 7246},
-	{0x5509, 2161},
-	{0x550a, 7251},
-	{0x550b, 7258},
-	{0x550c, 7785},
-	{0x550e, 7256},
-	{0x550f, 2168},
-	{0x5510, 2149},
-	{0x5511, 7248},
-	{0x5512, 7239},
-	{0x5514, 2157},
-	{0x5517, 7238},
-	{0x551a, 7243},
-	{0x5526, 7236},
-	{0x5527, 2165},
-	{0x552a, 7777},
-	{0x552c, 2609},
-	{0x552d, 7791},
-	{0x552e, 2607},
-	{0x552f, 2604},
-	{0x5530, 7782},
-	{0x5531, 2600},
-	{0x5532, 7786},
-	{0x5533, 2611},
-	{0x5534, 7776},
-	{0x5535, 7781},
-	{0x5536, 7780},
-	{0x5537, 2151},
-	{0x5538, 2606},
-	{0x5539, 7789},
-	{0x553b, 7792},
-	{0x553c, 7773},
-	{0x553e, 3084},
-	{0x5540, 7793},
-	{0x5541, 2612},
-	{0x5543, 2598},
-	{0x5544, 2595},
-	{0x5545, 7784},
-	{0x5546, 2592},
-	{0x5548, 7790},
-	{0x554a, 2599},
-	{0x554b, 7794},
-	{0x554d, 7774},
-	{0x554e, 7788},
-	{0x554f, 2602},
-	{0x5550, 7775},
-	{0x5551, 7778},
-	{0x5552, 7783},
-	{0x5555, 2603},
-	{0x5556, 2601},
-	{0x5557, 2613},
-	{0x555c, 2608},
-	{0x555e, 2596},
-	{0x555f, 2748},
-	{0x5561, 2597},
-	{0x5562, 7779},
-	{0x5563, 2610},
-	{0x5564, 2605},
-	{0x5565, 7787},
-	{0x5566, 2594},
-	{0x556a, 2593},
-	{0x5575, 7771},
-	{0x5576, 7772},
-	{0x5577, 8391},
-	{0x557b, 3067},
-	{0x557c, 3070},
-	{0x557d, 8402},
-	{0x557e, 3090},
-	{0x557f, 8405},
-	{0x5580, 3068},
-	{0x5581, 8398},
-	{0x5582, 3074},
-	{0x5583, 3080},
-	{0x5584, 3355},
-	{0x5587, 3078},
-	{0x5588, 8395},
-	{0x5589, 3091},
-	{0x558a, 3071},
-	{0x558b, 3079},
-	{0x558c, 8403},
-	{0x558d, 9095},
-	{0x558e, 8408},
-	{0x558f, 8396},
-	{0x5591, 8387},
-	{0x5592, 8400},
-	{0x5593, 8394},
-	{0x5594, 3077},
-	{0x5595, 8406},
-	{0x5598, 3073},
-	{0x5599, 3093},
-	{0x559a, 3086},
-	{0x559c, 3075},
-	{0x559d, 3072},
-	{0x559f, 3083},
-	{0x55a1, 8407},
-	{0x55a2, 8393},
-	{0x55a3, 8399},
-	{0x55a4, 8401},
-	{0x55a5, 8389},
-	{0x55a6, 8404},
-	{0x55a7, 3069},
-	{0x55a8, 8388},
-	{0x55aa, 3076},
-	{0x55ab, 3092},
-	{0x55ac, 3088},
-	{0x55ad, 8390},
-	{0x55ae, 3082},
-	{0x55b1, 3089},
-	{0x55b2, 3085},
-	{0x55b3, 3081},
-	{0x55b5, 8397},
-	{0x55bb, 3087},
-	{0x55bf, 9093},
-	{0x55c0, 9089},
-	{0x55c2, 9104},
-	{0x55c3, 9082},
-	{0x55c4, 9091},
-	{0x55c5, 3552},
-	{0x55c6, 3553},
-	{0x55c7, 3545},
-	{0x55c8, 9100},
-	{0x55c9, 3555},
-	{0x55ca, 9087},
-	{0x55cb, 9086},
-	{0x55cc, 9084},
-	{0x55cd, 9102},
-	{0x55ce, 3543},
-	{0x55cf, 9096},
-	{0x55d0, 9085},
-	{0x55d1, 3546},
-	{0x55d2, 9094},
-	{0x55d3, 3541},
-	{0x55d4, 9090},
-	{0x55d5, 9097},
-	{0x55d6, 9099},
-	{0x55d9, 9103},
-	{0x55da, 3550},
-	{0x55db, 9083},
-	{0x55dc, 3544},
-	{0x55dd, 9088},
-	{0x55df, 3539},
-	{0x55e1, 3551},
-	{0x55e2, 9098},
-	{0x55e3, 3547},
-	{0x55e4, 3548},
-	{0x55e5, 3554},
-	{0x55e6, 3542},
-	{0x55e7, 287},
-	{0x55e8, 3540},
-	{0x55e9, 9092},
-	{0x55ef, 3549},
-	{0x55f2, 9101},
-	{0x55f6, 3999},
-	{0x55f7, 3994},
-	{0x55f9, 9783},
-	{0x55fa, 9779},
-	{0x55fc, 9773},
-	{0x55fd, 3988},
-	{0x55fe, 3984},
-	{0x55ff, 9782},
-	{0x5600, 3985},
-	{0x5601, 9776},
-	{0x5602, 9778},
-	{0x5604, 9781},
-	{0x5606, 3990},
-	{0x5608, 3997},
-	{0x5609, 3991},
-	{0x560c, 9771},
-	{0x560d, 3992},
-	{0x560e, 3993},
-	{0x560f, 9774},
-	{0x5610, 3998},
-	{0x5612, 9772},
-	{0x5613, 9777},
-	{0x5614, 3989},
-	{0x5615, 9770},
-	{0x5616, 3995},
-	{0x5617, 3987},
-	{0x561b, 3986},
-	{0x561c, 9775},
-	{0x561d, 9780},
-	{0x561f, 3996},
-	{0x5627, 9769},
-	{0x5629, 4377},
-	{0x562e, 4371},
-	{0x562f, 4383},
-	{0x5630, 4384},
-	{0x5632, 4374},
-	{0x5634, 4376},
-	{0x5636, 4382},
-	{0x5639, 4373},
-	{0x563b, 4372},
-	{0x563f, 4375},
-	{0x5645, 8392},
-	{0x564e, 4379},
-	{0x5653, 4378},
-	{0x5657, 4380},
-	{0x5659, 4757},
-	{0x5662, 4769},
-	{0x5664, 4761},
-	{0x5665, 4765},
-	{0x5668, 4764},
-	{0x5669, 4760},
-	{0x566a, 4763},
-	{0x566b, 4758},
-	{0x566c, 4768},
-	{0x566f, 4767},
-	{0x5671, 4766},
-	{0x5674, 4381},
-	{0x5676, 4770},
-	{0x5678, 4762},
-	{0x5679, 4759},
-	{0x5680, 5050},
-	{0x5685, 5052},
-	{0x5687, 5053},
-	{0x568d, 0},
-	{0x568e, 5049},
-	{0x568f, 5054},
-	{0x5690, 5051},
-	{0x5695, 5322},
-	{0x56a5, 5494},
-	{0x56a7, 0},
-	{0x56a8, 5495},
-	{0x56ae, 5323},
-	{0x56b4, 5644},
-	{0x56b6, 5643},
-	{0x56b7, 5642},
-	{0x56bc, 5645},
-	{0x56be, 0},
-	{0x56c0, 5739},
-	{0x56c1, 5738},
-	{0x56c2, 5740},
-	{0x56c8, 5821},
-	{0x56c9, 5823},
-	{0x56ca, 5822},
-	{0x56cc, 5878},
-	{0x56d1, 5919},
-	{0x56d7, 6005},
-	{0x56da, 813},
-	{0x56db, 812},
-	{0x56dd, 940},
-	{0x56de, 939},
-	{0x56df, 6096},
-	{0x56e0, 938},
-	{0x56e1, 6095},
-	{0x56e4, 1123},
-	{0x56e5, 6224},
-	{0x56e7, 6223},
-	{0x56ea, 1121},
-	{0x56eb, 1124},
-	{0x56ee, 6222},
-	{0x56f0, 1122},
-	{0x56f7, 6451},
-	{0x56f9, 6452},
-	{0x56fa, 1400},
-	{0x56ff, 1766},
-	{0x5701, 7259},
-	{0x5702, 7260},
-	{0x5703, 2169},
-	{0x5704, 2170},
-	{0x5707, 7796},
-	{0x5708, 2614},
-	{0x5709, 2616},
-	{0x570a, 7795},
-	{0x570b, 2615},
-	{0x570c, 8409},
-	{0x570d, 3094},
-	{0x5712, 3556},
-	{0x5713, 3557},
-	{0x5714, 9105},
-	{0x5716, 4001},
-	{0x5718, 4000},
-	{0x571f, 634},
-	{0x5720, 6020},
-	{0x5722, 6042},
-	{0x5723, 6043},
-	{0x5728, 943},
-	{0x5729, 947},
-	{0x572a, 6098},
-	{0x572c, 945},
-	{0x572d, 944},
-	{0x572e, 6097},
-	{0x572f, 946},
-	{0x5730, 942},
-	{0x5733, 941},
-	{0x5734, 6099},
-	{0x573b, 1134},
-	{0x573e, 1131},
-	{0x5740, 1127},
-	{0x5741, 6225},
-	{0x5745, 6226},
-	{0x5747, 1129},
-	{0x5749, 6228},
-	{0x574a, 1125},
-	{0x574b, 6229},
-	{0x574c, 6227},
-	{0x574d, 1128},
-	{0x574e, 1130},
-	{0x574f, 1133},
-	{0x5750, 1132},
-	{0x5751, 1126},
-	{0x5752, 6230},
-	{0x5761, 1405},
-	{0x5762, 6465},
-	{0x5764, 1407},
-	{0x5766, 1406},
-	{0x5768, 6466},
-	{0x5769, 1404},
-	{0x576a, 1403},
-	{0x576b, 6456},
-	{0x576d, 6455},
-	{0x576f, 6453},
-	{0x5770, 6458},
-	{0x5771, 6457},
-	{0x5772, 6454},
-	{0x5773, 6463},
-	{0x5774, 6464},
-	{0x5775, 6461},
-	{0x5776, 6459},
-	{0x5777, 1402},
-	{0x577b, 6462},
-	{0x577c, 1408},
-	{0x577d, 6467},
-	{0x5780, 6460},
-	{0x5782, 1767},
-	{0x5783, 1401},
-	{0x578b, 1768},
-	{0x578c, 6800},
-	{0x578f, 6806},
-	{0x5793, 1774},
-	{0x5794, 6804},
-	{0x5795, 6810},
-	{0x5797, 6801},
-	{0x5798, 6805},
-	{0x5799, 6807},
-	{0x579a, 6809},
-	{0x579b, 6803},
-	{0x579d, 6802},
-	{0x579e, 6797},
-	{0x579f, 6798},
-	{0x57a0, 1769},
-	{0x57a2, 1771},
-	{0x57a3, 1770},
-	{0x57a4, 6799},
-	{0x57a5, 6808},
-	{0x57ae, 1773},
-	{0x57b5, 6796},
-	{0x57b6, 7270},
-	{0x57b8, 7269},
-	{0x57b9, 7274},
-	{0x57ba, 7265},
-	{0x57bc, 7268},
-	{0x57bd, 7267},
-	{0x57bf, 7271},
-	{0x57c1, 7275},
-	{0x57c2, 2171},
-	{0x57c3, 2174},
-	{0x57c6, 7266},
-	{0x57c7, 7272},
-	{0x57cb, 2173},
-	{0x57cc, 7261},
-	{0x57ce, 1772},
-	{0x57cf, 7810},
-	{0x57d0, 7273},
-	{0x57d2, 7264},
-	{0x57d4, 2172},
-	{0x57d5, 7263},
-	{0x57dc, 7801},
-	{0x57df, 2617},
-	{0x57e0, 2621},
-	{0x57e1, 7817},
-	{0x57e2, 7799},
-	{0x57e3, 7813},
-	{0x57e4, 2622},
-	{0x57e5, 7815},
-	{0x57e7, 7821},
-	{0x57e9, 7825},
-	{0x57ec, 7816},
-	{0x57ed, 7804},
-	{0x57ee, 7812},
-	{0x57f0, 7826},
-	{0x57f1, 7824},
-	{0x57f2, 7814},
-	{0x57f3, 7809},
-	{0x57f4, 7802},
-	{0x57f5, 8417},
-	{0x57f6, 7800},
-	{0x57f7, 2626},
-	{0x57f8, 7807},
-	{0x57f9, 2627},
-	{0x57fa, 2623},
-	{0x57fb, 7797},
-	{0x57fc, 7819},
-	{0x57fd, 7805},
-	{0x5800, 7803},
-	{0x5801, 7822},
-	{0x5802, 2624},
-	{0x5804, 7828},
-	{0x5805, 2618},
-	{0x5806, 2620},
-	{0x5807, 7811},
-	{0x5808, 7806},
-	{0x5809, 2175},
-	{0x580a, 2619},
-	{0x580b, 7808},
-	{0x580c, 7823},
-	{0x580d, 7827},
-	{0x580e, 7818},
-	{0x5810, 7820},
-	{0x5814, 7798},
-	{0x5819, 8412},
-	{0x581b, 8421},
-	{0x581c, 8420},
-	{0x581d, 3102},
-	{0x581e, 8413},
-	{0x5820, 3103},
-	{0x5821, 3101},
-	{0x5823, 8415},
-	{0x5824, 3098},
-	{0x5825, 8419},
-	{0x5827, 8414},
-	{0x5828, 8416},
-	{0x5829, 8410},
-	{0x582a, 3096},
-	{0x582c, 8429},
-	{0x582d, 8428},
-	{0x582e, 8425},
-	{0x582f, 3095},
-	{0x5830, 3099},
-	{0x5831, 3100},
-	{0x5832, 7262},
-	{0x5833, 8422},
-	{0x5834, 3097},
-	{0x5835, 2625},
-	{0x5836, 8424},
-	{0x5837, 8411},
-	{0x5838, 8427},
-	{0x5839, 8426},
-	{0x583b, 8430},
-	{0x583d, 9119},
-	{0x583f, 8423},
-	{0x5848, 8418},
-	{0x5849, 9111},
-	{0x584a, 3567},
-	{0x584b, 3570},
-	{0x584c, 3565},
-	{0x584d, 9110},
-	{0x584e, 9114},
-	{0x584f, 9109},
-	{0x5851, 3559},
-	{0x5852, 3569},
-	{0x5853, 9106},
-	{0x5854, 3563},
-	{0x5855, 9113},
-	{0x5857, 3561},
-	{0x5858, 3560},
-	{0x5859, 9116},
-	{0x585a, 3562},
-	{0x585b, 9118},
-	{0x585d, 9115},
-	{0x585e, 3558},
-	{0x5862, 3568},
-	{0x5863, 9120},
-	{0x5864, 9108},
-	{0x5865, 9117},
-	{0x5868, 9107},
-	{0x586b, 3564},
-	{0x586d, 3566},
-	{0x586f, 9112},
-	{0x5871, 9121},
-	{0x5874, 9791},
-	{0x5875, 4002},
-	{0x5876, 9797},
-	{0x5879, 4007},
-	{0x587a, 9793},
-	{0x587b, 9800},
-	{0x587c, 9785},
-	{0x587d, 4009},
-	{0x587e, 4003},
-	{0x587f, 9790},
-	{0x5880, 4385},
-	{0x5881, 9789},
-	{0x5882, 9798},
-	{0x5883, 4004},
-	{0x5885, 4008},
-	{0x5886, 9788},
-	{0x5887, 9794},
-	{0x5888, 9799},
-	{0x5889, 9784},
-	{0x588a, 4006},
-	{0x588b, 9792},
-	{0x588e, 9796},
-	{0x588f, 9802},
-	{0x5890, 9786},
-	{0x5891, 9795},
-	{0x5893, 4005},
-	{0x5894, 9801},
-	{0x5898, 9787},
-	{0x589c, 4389},
-	{0x589e, 4387},
-	{0x589f, 4386},
-	{0x58a6, 4392},
-	{0x58a8, 4744},
-	{0x58a9, 4391},
-	{0x58ae, 4390},
-	{0x58b3, 4388},
-	{0x58be, 4772},
-	{0x58c1, 4771},
-	{0x58c5, 4774},
-	{0x58c7, 4773},
-	{0x58ce, 5058},
-	{0x58d1, 5057},
-	{0x58d3, 5056},
-	{0x58d5, 5055},
-	{0x58d8, 5325},
-	{0x58d9, 5324},
-	{0x58de, 5496},
-	{0x58df, 5497},
-	{0x58e2, 5498},
-	{0x58e4, 5646},
-	{0x58e9, 5920},
-	{0x58eb, 635},
-	{0x58ec, 705},
-	{0x58ef, 1135},
-	{0x58f4, 6811},
-	{0x58f9, 3104},
-	{0x58fa, 3105},
-	{0x58fc, 9122},
-	{0x58fd, 4010},
-	{0x58fe, 9803},
-	{0x5902, 548},
-	{0x5903, 6021},
-	{0x5906, 6231},
-	{0x590a, 548},
-	{0x590c, 6468},
-	{0x590d, 6812},
-	{0x590e, 7276},
-	{0x590f, 2176},
-	{0x5914, 5741},
-	{0x5915, 636},
-	{0x5916, 814},
-	{0x5917, 6044},
-	{0x5919, 948},
-	{0x591a, 949},
-	{0x591c, 1409},
-	{0x5920, 2628},
-	{0x5922, 4012},
-	{0x5924, 4013},
-	{0x5925, 4011},
-	{0x5927, 637},
-	{0x5929, 706},
-	{0x592a, 708},
-	{0x592b, 707},
-	{0x592c, 6022},
-	{0x592d, 709},
-	{0x592e, 815},
-	{0x592f, 6045},
-	{0x5931, 816},
-	{0x5937, 950},
-	{0x5938, 951},
-	{0x593c, 6100},
-	{0x593e, 1136},
-	{0x5940, 6232},
-	{0x5944, 1413},
-	{0x5945, 6469},
-	{0x5947, 1411},
-	{0x5948, 1412},
-	{0x5949, 1410},
-	{0x594a, 7277},
-	{0x594e, 1778},
-	{0x594f, 1777},
-	{0x5950, 1779},
-	{0x5951, 1776},
-	{0x5953, 6813},
-	{0x5954, 1414},
-	{0x5955, 1775},
-	{0x5957, 2177},
-	{0x5958, 2178},
-	{0x595a, 2179},
-	{0x595c, 7829},
-	{0x5960, 3106},
-	{0x5961, 8431},
-	{0x5962, 2629},
-	{0x5967, 3571},
-	{0x5969, 4015},
-	{0x596a, 4014},
-	{0x596b, 9804},
-	{0x596d, 4393},
-	{0x596e, 4775},
-	{0x5973, 638},
-	{0x5974, 817},
-	{0x5976, 818},
-	{0x5977, 6106},
-	{0x5978, 953},
-	{0x5979, 956},
-	{0x597b, 6104},
-	{0x597c, 6102},
-	{0x597d, 955},
-	{0x597e, 6105},
-	{0x597f, 6107},
-	{0x5980, 6101},
-	{0x5981, 958},
-	{0x5982, 957},
-	{0x5983, 954},
-	{0x5984, 952},
-	{0x5985, 6103},
-	{0x598a, 1147},
-	{0x598d, 1144},
-	{0x598e, 6237},
-	{0x598f, 6240},
-	{0x5990, 6239},
-	{0x5992, 1138},
-	{0x5993, 1146},
-	{0x5996, 1143},
-	{0x5997, 6236},
-	{0x5998, 6234},
-	{0x5999, 1142},
-	{0x599d, 1137},
-	{0x599e, 1140},
-	{0x59a0, 6235},
-	{0x59a1, 6242},
-	{0x59a2, 6238},
-	{0x59a3, 1141},
-	{0x59a4, 1145},
-	{0x59a5, 1148},
-	{0x59a6, 6233},
-	{0x59a7, 6241},
-	{0x59a8, 1139},
-	{0x59ae, 1419},
-	{0x59af, 1427},
-	{0x59b1, 6481},
-	{0x59b2, 6474},
-	{0x59b3, 1428},
-	{0x59b4, 6485},
-	{0x59b5, 6470},
-	{0x59b6, 6477},
-	{0x59b9, 1418},
-	{0x59ba, 6471},
-	{0x59bb, 1416},
-	{0x59bc, 6478},
-	{0x59bd, 6482},
-	{0x59be, 1415},
-	{0x59c0, 6483},
-	{0x59c1, 6476},
-	{0x59c3, 6479},
-	{0x59c5, 1430},
-	{0x59c6, 1421},
-	{0x59c7, 6486},
-	{0x59c8, 6484},
-	{0x59ca, 1426},
-	{0x59cb, 1424},
-	{0x59cc, 6475},
-	{0x59cd, 1423},
-	{0x59ce, 6473},
-	{0x59cf, 6472},
-	{0x59d0, 1422},
-	{0x59d1, 1420},
-	{0x59d2, 1429},
-	{0x59d3, 1425},
-	{0x59d4, 1417},
-	{0x59d6, 6480},
-	{0x59d8, 1781},
-	{0x59da, 1788},
-	{0x59db, 6827},
-	{0x59dc, 1780},
-	{0x59dd, 6819},
-	{0x59de, 6815},
-	{0x59e0, 6831},
-	{0x59e1, 6814},
-	{0x59e3, 1783},
-	{0x59e4, 6824},
-	{0x59e5, 1786},
-	{0x59e6, 1789},
-	{0x59e8, 1784},
-	{0x59e9, 6828},
-	{0x59ea, 1787},
-	{0x59ec, 2186},
-	{0x59ed, 6834},
-	{0x59ee, 6816},
-	{0x59f1, 6818},
-	{0x59f2, 6825},
-	{0x59f3, 6829},
-	{0x59f4, 6833},
-	{0x59f5, 6830},
-	{0x59f6, 6823},
-	{0x59f7, 6826},
-	{0x59fa, 6820},
-	{0x59fb, 1791},
-	{0x59fc, 6822},
-	{0x59fd, 6821},
-	{0x59fe, 6832},
-	{0x59ff, 1782},
-	{0x5a00, 6817},
-	{0x5a01, 1790},
-	{0x5a03, 1785},
-	{0x5a09, 2192},
-	{0x5a0a, 7285},
-	{0x5a0c, 2191},
-	{0x5a0f, 7283},
-	{0x5a11, 2180},
-	{0x5a13, 2185},
-	{0x5a15, 7282},
-	{0x5a16, 7279},
-	{0x5a17, 7284},
-	{0x5a18, 2181},
-	{0x5a19, 7278},
-	{0x5a1b, 2184},
-	{0x5a1c, 2182},
-	{0x5a1e, 7286},
-	{0x5a1f, 2183},
-	{0x5a20, 2187},
-	{0x5a23, 2188},
-	{0x5a25, 2190},
-	{0x5a29, 2189},
-	{0x5a2d, 7280},
-	{0x5a2e, 7281},
-	{0x5a33, 7287},
-	{0x5a35, 7836},
-	{0x5a36, 2630},
-	{0x5a37, 8445},
-	{0x5a38, 7835},
-	{0x5a39, 7854},
-	{0x5a3c, 2636},
-	{0x5a3e, 7852},
-	{0x5a40, 2635},
-	{0x5a41, 2631},
-	{0x5a42, 7861},
-	{0x5a43, 7845},
-	{0x5a44, 7848},
-	{0x5a46, 2639},
-	{0x5a47, 7858},
-	{0x5a48, 7850},
-	{0x5a49, 2632},
-	{0x5a4a, 2640},
-	{0x5a4c, 7855},
-	{0x5a4d, 7853},
-	{0x5a50, 7838},
-	{0x5a51, 7859},
-	{0x5a52, 7847},
-	{0x5a53, 7842},
-	{0x5a55, 7832},
-	{0x5a56, 7860},
-	{0x5a57, 7844},
-	{0x5a58, 7831},
-	{0x5a5a, 2638},
-	{0x5a5b, 7849},
-	{0x5a5c, 7862},
-	{0x5a5d, 7846},
-	{0x5a5e, 7834},
-	{0x5a5f, 7839},
-	{0x5a60, 7830},
-	{0x5a62, 2637},
-	{0x5a64, 7843},
-	{0x5a65, 7840},
-	{0x5a66, 2633},
-	{0x5a67, 7833},
-	{0x5a69, 7857},
-	{0x5a6a, 2634},
-	{0x5a6c, 7841},
-	{0x5a6d, 7837},
-	{0x5a70, 7856},
-	{0x5a77, 3107},
-	{0x5a78, 8438},
-	{0x5a7a, 8435},
-	{0x5a7b, 8452},
-	{0x5a7c, 8440},
-	{0x5a7d, 8453},
-	{0x5a7f, 3109},
-	{0x5a83, 8449},
-	{0x5a84, 8446},
-	{0x5a8a, 8447},
-	{0x5a8b, 8450},
-	{0x5a8c, 8454},
-	{0x5a8e, 7851},
-	{0x5a8f, 8456},
-	{0x5a90, 9142},
-	{0x5a92, 3110},
-	{0x5a93, 8457},
-	{0x5a94, 8433},
-	{0x5a95, 8443},
-	{0x5a97, 8448},
-	{0x5a9a, 3108},
-	{0x5a9b, 3111},
-	{0x5a9c, 8455},
-	{0x5a9d, 8458},
-	{0x5a9e, 8437},
-	{0x5a9f, 8434},
-	{0x5aa2, 8436},
-	{0x5aa5, 8441},
-	{0x5aa6, 8439},
-	{0x5aa7, 3112},
-	{0x5aa9, 8451},
-	{0x5aac, 8442},
-	{0x5aae, 8444},
-	{0x5aaf, 8432},
-	{0x5ab0, 9130},
-	{0x5ab1, 9128},
-	{0x5ab2, 3580},
-	{0x5ab3, 3578},
-	{0x5ab4, 9138},
-	{0x5ab5, 9129},
-	{0x5ab6, 9139},
-	{0x5ab7, 9135},
-	{0x5ab8, 9127},
-	{0x5ab9, 9141},
-	{0x5aba, 9126},
-	{0x5abb, 9133},
-	{0x5abc, 3577},
-	{0x5abd, 3576},
-	{0x5abe, 3575},
-	{0x5abf, 9131},
-	{0x5ac0, 9136},
-	{0x5ac1, 3572},
-	{0x5ac2, 3579},
-	{0x5ac4, 9124},
-	{0x5ac6, 9134},
-	{0x5ac7, 9123},
-	{0x5ac8, 9132},
-	{0x5ac9, 3573},
-	{0x5aca, 9137},
-	{0x5acb, 9125},
-	{0x5acc, 3574},
-	{0x5acd, 9140},
-	{0x5ad5, 9808},
-	{0x5ad6, 4020},
-	{0x5ad7, 4019},
-	{0x5ad8, 4021},
-	{0x5ad9, 9820},
-	{0x5ada, 9810},
-	{0x5adb, 9816},
-	{0x5adc, 9805},
-	{0x5add, 9819},
-	{0x5ade, 9818},
-	{0x5adf, 9822},
-	{0x5ae0, 9815},
-	{0x5ae1, 4016},
-	{0x5ae2, 9814},
-	{0x5ae3, 4022},
-	{0x5ae5, 9807},
-	{0x5ae6, 4017},
-	{0x5ae8, 9821},
-	{0x5ae9, 4018},
-	{0x5aea, 9809},
-	{0x5aeb, 9812},
-	{0x5aec, 9817},
-	{0x5aed, 9811},
-	{0x5aee, 9806},
-	{0x5af3, 9813},
-	{0x5af5, 4397},
-	{0x5afb, 4395},
-	{0x5b08, 4399},
-	{0x5b09, 4394},
-	{0x5b0b, 4396},
-	{0x5b0c, 4398},
-	{0x5b1d, 4776},
-	{0x5b24, 5061},
-	{0x5b2a, 5060},
-	{0x5b30, 5059},
-	{0x5b34, 4777},
-	{0x5b38, 5326},
-	{0x5b3e, 0},
-	{0x5b3f, 1},
-	{0x5b40, 5647},
-	{0x5b43, 5648},
-	{0x5b4c, 0},
-	{0x5b50, 639},
-	{0x5b51, 640},
-	{0x5b53, 641},
-	{0x5b54, 710},
-	{0x5b55, 819},
-	{0x5b56, 6108},
-	{0x5b57, 959},
-	{0x5b58, 960},
-	{0x5b5a, 1151},
-	{0x5b5b, 1152},
-	{0x5b5c, 1150},
-	{0x5b5d, 1149},
-	{0x5b5f, 1431},
-	{0x5b62, 6487},
-	{0x5b63, 1433},
-	{0x5b64, 1432},
-	{0x5b65, 6488},
-	{0x5b69, 1792},
-	{0x5b6b, 2193},
-	{0x5b6c, 7288},
-	{0x5b6e, 7864},
-	{0x5b70, 2641},
-	{0x5b71, 3114},
-	{0x5b72, 7863},
-	{0x5b73, 3113},
-	{0x5b75, 4023},
-	{0x5b77, 9823},
-	{0x5b78, 4778},
-	{0x5b7a, 5062},
-	{0x5b7d, 5649},
-	{0x5b7f, 5824},
-	{0x5b80, 549},
-	{0x5b81, 6046},
-	{0x5b83, 820},
-	{0x5b84, 6047},
-	{0x5b85, 963},
-	{0x5b87, 961},
-	{0x5b88, 962},
-	{0x5b89, 964},
-	{0x5b8b, 1154},
-	{0x5b8c, 1153},
-	{0x5b8e, 6243},
-	{0x5b8f, 1155},
-	{0x5b92, 6244},
-	{0x5b93, 6489},
-	{0x5b95, 6490},
-	{0x5b97, 1434},
-	{0x5b98, 1436},
-	{0x5b99, 1438},
-	{0x5b9a, 1435},
-	{0x5b9b, 1439},
-	{0x5b9c, 1437},
-	{0x5b9f, 0},
-	{0x5ba2, 1796},
-	{0x5ba3, 1793},
-	{0x5ba4, 1795},
-	{0x5ba5, 1797},
-	{0x5ba6, 1794},
-	{0x5ba7, 7289},
-	{0x5ba8, 6835},
-	{0x5bac, 7291},
-	{0x5bad, 7290},
-	{0x5bae, 2199},
-	{0x5bb0, 2195},
-	{0x5bb3, 2196},
-	{0x5bb4, 2198},
-	{0x5bb5, 2200},
-	{0x5bb6, 2197},
-	{0x5bb8, 2202},
-	{0x5bb9, 2201},
-	{0x5bbf, 2646},
-	{0x5bc0, 7866},
-	{0x5bc1, 7865},
-	{0x5bc2, 2645},
-	{0x5bc4, 2644},
-	{0x5bc5, 2643},
-	{0x5bc6, 2647},
-	{0x5bc7, 2642},
-	{0x5bca, 8464},
-	{0x5bcb, 8461},
-	{0x5bcc, 3116},
-	{0x5bcd, 8460},
-	{0x5bce, 8465},
-	{0x5bd0, 3118},
-	{0x5bd1, 8463},
-	{0x5bd2, 3115},
-	{0x5bd3, 3117},
-	{0x5bd4, 8462},
-	{0x5bd6, 9143},
-	{0x5bd8, 9144},
-	{0x5bd9, 9145},
-	{0x5bde, 4024},
-	{0x5bdf, 4032},
-	{0x5be0, 9824},
-	{0x5be1, 4026},
-	{0x5be2, 4030},
-	{0x5be3, 9825},
-	{0x5be4, 4031},
-	{0x5be5, 4027},
-	{0x5be6, 4028},
-	{0x5be7, 4025},
-	{0x5be8, 4029},
-	{0x5be9, 4402},
-	{0x5bea, 8459},
-	{0x5beb, 4403},
-	{0x5bec, 4401},
-	{0x5bee, 4400},
-	{0x5bf0, 4779},
-	{0x5bf2, 0},
-	{0x5bf5, 5499},
-	{0x5bf6, 5650},
-	{0x5bf8, 642},
-	{0x5bfa, 965},
-	{0x5c01, 1798},
-	{0x5c03, 7292},
-	{0x5c04, 2203},
-	{0x5c07, 2650},
-	{0x5c08, 2649},
-	{0x5c09, 2648},
-	{0x5c0a, 3119},
-	{0x5c0b, 3120},
-	{0x5c0c, 8466},
-	{0x5c0d, 4033},
-	{0x5c0e, 4780},
-	{0x5c0f, 643},
-	{0x5c10, 6023},
-	{0x5c11, 711},
-	{0x5c12, 6048},
-	{0x5c15, 6109},
-	{0x5c16, 966},
-	{0x5c1a, 1440},
-	{0x5c1f, 9146},
-	{0x5c22, 644},
-	{0x5c24, 712},
-	{0x5c25, 6110},
-	{0x5c28, 6245},
-	{0x5c2a, 6246},
-	{0x5c2c, 1156},
-	{0x5c30, 8467},
-	{0x5c31, 3121},
-	{0x5c33, 9147},
-	{0x5c37, 5063},
-	{0x5c38, 645},
-	{0x5c39, 665},
-	{0x5c3a, 713},
-	{0x5c3b, 6049},
-	{0x5c3c, 821},
-	{0x5c3e, 1160},
-	{0x5c3f, 1159},
-	{0x5c40, 1157},
-	{0x5c41, 1158},
-	{0x5c44, 6491},
-	{0x5c45, 1442},
-	{0x5c46, 1443},
-	{0x5c47, 6492},
-	{0x5c48, 1441},
-	{0x5c4b, 1802},
-	{0x5c4c, 6836},
-	{0x5c4d, 1801},
-	{0x5c4e, 1799},
-	{0x5c4f, 1800},
-	{0x5c50, 2206},
-	{0x5c51, 2204},
-	{0x5c54, 7294},
-	{0x5c55, 2205},
-	{0x5c56, 7293},
-	{0x5c58, 2194},
-	{0x5c59, 7867},
-	{0x5c5c, 2652},
-	{0x5c5d, 2653},
-	{0x5c60, 2651},
-	{0x5c62, 4034},
-	{0x5c63, 9826},
-	{0x5c64, 4404},
-	{0x5c65, 4405},
-	{0x5c68, 5064},
-	{0x5c6a, 0},
-	{0x5c6c, 5742},
-	{0x5c6e, 6006},
-	{0x5c6f, 714},
-	{0x5c71, 646},
-	{0x5c73, 6051},
-	{0x5c74, 6050},
-	{0x5c79, 967},
-	{0x5c7a, 6112},
-	{0x5c7b, 6113},
-	{0x5c7c, 6111},
-	{0x5c7e, 6114},
-	{0x5c86, 6254},
-	{0x5c88, 6249},
-	{0x5c89, 6251},
-	{0x5c8a, 6253},
-	{0x5c8b, 6250},
-	{0x5c8c, 1164},
-	{0x5c8d, 6247},
-	{0x5c8f, 6248},
-	{0x5c90, 1161},
-	{0x5c91, 1162},
-	{0x5c92, 6252},
-	{0x5c93, 6255},
-	{0x5c94, 1163},
-	{0x5c95, 6256},
-	{0x5c9d, 6506},
-	{0x5c9f, 6500},
-	{0x5ca0, 6495},
-	{0x5ca1, 1445},
-	{0x5ca2, 6503},
-	{0x5ca3, 6501},
-	{0x5ca4, 6494},
-	{0x5ca5, 6507},
-	{0x5ca6, 6510},
-	{0x5ca7, 6505},
-	{0x5ca8, 6498},
-	{0x5ca9, 1447},
-	{0x5caa, 6504},
-	{0x5cab, 1448},
-	{0x5cac, 6499},
-	{0x5cad, 6502},
-	{0x5cae, 6493},
-	{0x5caf, 6497},
-	{0x5cb0, 6509},
-	{0x5cb1, 1449},
-	{0x5cb3, 1450},
-	{0x5cb5, 6496},
-	{0x5cb6, 6508},
-	{0x5cb7, 1444},
-	{0x5cb8, 1446},
-	{0x5cc6, 6853},
-	{0x5cc7, 6846},
-	{0x5cc8, 6852},
-	{0x5cc9, 6845},
-	{0x5cca, 6847},
-	{0x5ccb, 6841},
-	{0x5ccc, 6839},
-	{0x5cce, 6854},
-	{0x5ccf, 6851},
-	{0x5cd0, 6837},
-	{0x5cd2, 1804},
-	{0x5cd3, 6849},
-	{0x5cd4, 6850},
-	{0x5cd6, 6848},
-	{0x5cd7, 6840},
-	{0x5cd8, 6838},
-	{0x5cd9, 1803},
-	{0x5cda, 6844},
-	{0x5cdb, 6842},
-	{0x5cde, 6843},
-	{0x5cdf, 6855},
-	{0x5ce8, 2211},
-	{0x5cea, 2210},
-	{0x5cec, 7295},
-	{0x5ced, 2207},
-	{0x5cee, 7297},
-	{0x5cf0, 2212},
-	{0x5cf1, 7298},
-	{0x5cf4, 2215},
-	{0x5cf6, 2213},
-	{0x5cf7, 7299},
-	{0x5cf8, 6856},
-	{0x5cf9, 7301},
-	{0x5cfb, 2209},
-	{0x5cfd, 2208},
-	{0x5cff, 7296},
-	{0x5d00, 7300},
-	{0x5d01, 2214},
-	{0x5d06, 2655},
-	{0x5d07, 2654},
-	{0x5d0b, 7869},
-	{0x5d0c, 7873},
-	{0x5d0d, 7875},
-	{0x5d0e, 2656},
-	{0x5d0f, 7878},
-	{0x5d11, 2660},
-	{0x5d12, 7880},
-	{0x5d14, 2662},
-	{0x5d16, 2658},
-	{0x5d17, 2666},
-	{0x5d19, 2663},
-	{0x5d1a, 7871},
-	{0x5d1b, 2657},
-	{0x5d1d, 7870},
-	{0x5d1e, 7868},
-	{0x5d1f, 7882},
-	{0x5d20, 7872},
-	{0x5d22, 2659},
-	{0x5d23, 7881},
-	{0x5d24, 2664},
-	{0x5d25, 7877},
-	{0x5d26, 7876},
-	{0x5d27, 2665},
-	{0x5d28, 7874},
-	{0x5d29, 2661},
-	{0x5d2e, 7883},
-	{0x5d30, 7879},
-	{0x5d31, 8482},
-	{0x5d32, 8489},
-	{0x5d33, 8478},
-	{0x5d34, 3124},
-	{0x5d35, 8474},
-	{0x5d36, 8490},
-	{0x5d37, 8468},
-	{0x5d38, 8487},
-	{0x5d39, 8485},
-	{0x5d3a, 8479},
-	{0x5d3c, 8488},
-	{0x5d3d, 8481},
-	{0x5d3f, 8473},
-	{0x5d40, 8491},
-	{0x5d41, 8471},
-	{0x5d42, 8484},
-	{0x5d43, 8469},
-	{0x5d45, 8492},
-	{0x5d47, 3125},
-	{0x5d49, 8486},
-	{0x5d4a, 9150},
-	{0x5d4b, 8472},
-	{0x5d4c, 3122},
-	{0x5d4e, 8476},
-	{0x5d50, 3123},
-	{0x5d51, 8475},
-	{0x5d52, 8480},
-	{0x5d55, 8477},
-	{0x5d59, 8483},
-	{0x5d5e, 9154},
-	{0x5d62, 9157},
-	{0x5d63, 9149},
-	{0x5d65, 9151},
-	{0x5d67, 9156},
-	{0x5d68, 9155},
-	{0x5d69, 3581},
-	{0x5d6b, 8470},
-	{0x5d6c, 9153},
-	{0x5d6f, 3582},
-	{0x5d71, 9148},
-	{0x5d72, 9152},
-	{0x5d77, 9833},
-	{0x5d79, 9840},
-	{0x5d7a, 9831},
-	{0x5d7c, 9838},
-	{0x5d7d, 9829},
-	{0x5d7e, 9837},
-	{0x5d7f, 9841},
-	{0x5d80, 9828},
-	{0x5d81, 9832},
-	{0x5d82, 9827},
-	{0x5d84, 4035},
-	{0x5d86, 9830},
-	{0x5d87, 4036},
-	{0x5d88, 9836},
-	{0x5d89, 9835},
-	{0x5d8a, 9834},
-	{0x5d8d, 9839},
-	{0x5d94, 4407},
-	{0x5d9d, 4406},
-	{0x5db8, 5068},
-	{0x5dba, 5066},
-	{0x5dbc, 5065},
-	{0x5dbd, 5067},
-	{0x5dc7, 0},
-	{0x5dc9, 5651},
-	{0x5dcd, 5743},
-	{0x5dd2, 5826},
-	{0x5dd4, 5825},
-	{0x5dd6, 5879},
-	{0x5ddb, 550},
-	{0x5ddd, 647},
-	{0x5dde, 968},
-	{0x5ddf, 6115},
-	{0x5de0, 6257},
-	{0x5de1, 1306},
-	{0x5de2, 2667},
-	{0x5de5, 648},
-	{0x5de6, 824},
-	{0x5de7, 823},
-	{0x5de8, 822},
-	{0x5deb, 1165},
-	{0x5dee, 2216},
-	{0x5df0, 9158},
-	{0x5df1, 649},
-	{0x5df2, 650},
-	{0x5df3, 651},
-	{0x5df4, 715},
-	{0x5df7, 1805},
-	{0x5df9, 6857},
-	{0x5dfd, 3126},
-	{0x5dfe, 652},
-	{0x5dff, 6024},
-	{0x5e02, 825},
-	{0x5e03, 826},
-	{0x5e04, 6052},
-	{0x5e06, 969},
-	{0x5e0a, 6258},
-	{0x5e0c, 1166},
-	{0x5e0e, 6259},
-	{0x5e11, 1456},
-	{0x5e14, 6512},
-	{0x5e15, 1454},
-	{0x5e16, 1453},
-	{0x5e17, 6511},
-	{0x5e18, 1451},
-	{0x5e19, 6513},
-	{0x5e1a, 1452},
-	{0x5e1b, 1455},
-	{0x5e1d, 1806},
-	{0x5e1f, 1808},
-	{0x5e20, 6861},
-	{0x5e21, 6858},
-	{0x5e22, 6859},
-	{0x5e23, 6860},
-	{0x5e24, 6862},
-	{0x5e25, 1807},
-	{0x5e28, 7303},
-	{0x5e29, 7302},
-	{0x5e2b, 2218},
-	{0x5e2d, 2217},
-	{0x5e33, 2670},
-	{0x5e34, 7885},
-	{0x5e36, 2669},
-	{0x5e37, 2671},
-	{0x5e38, 2668},
-	{0x5e3d, 3128},
-	{0x5e3e, 7884},
-	{0x5e40, 3129},
-	{0x5e41, 8494},
-	{0x5e43, 3130},
-	{0x5e44, 8493},
-	{0x5e45, 3127},
-	{0x5e4a, 9161},
-	{0x5e4b, 9163},
-	{0x5e4c, 3583},
-	{0x5e4d, 9162},
-	{0x5e4e, 9160},
-	{0x5e4f, 9159},
-	{0x5e53, 9844},
-	{0x5e54, 4041},
-	{0x5e55, 4039},
-	{0x5e57, 4040},
-	{0x5e58, 9842},
-	{0x5e59, 9843},
-	{0x5e5b, 4037},
-	{0x5e5f, 4409},
-	{0x5e61, 4410},
-	{0x5e62, 4408},
-	{0x5e63, 4038},
-	{0x5e68, 0},
-	{0x5e6b, 5069},
-	{0x5e6e, 0},
-	{0x5e72, 653},
-	{0x5e73, 827},
-	{0x5e74, 971},
-	{0x5e75, 6116},
-	{0x5e76, 970},
-	{0x5e78, 1457},
-	{0x5e79, 3584},
-	{0x5e7a, 551},
-	{0x5e7b, 716},
-	{0x5e7c, 828},
-	{0x5e7d, 1809},
-	{0x5e7e, 3131},
-	{0x5e7f, 552},
-	{0x5e80, 6053},
-	{0x5e82, 6054},
-	{0x5e84, 6117},
-	{0x5e87, 1168},
-	{0x5e88, 6263},
-	{0x5e89, 6261},
-	{0x5e8a, 1169},
-	{0x5e8b, 6260},
-	{0x5e8c, 6262},
-	{0x5e8d, 6264},
-	{0x5e8f, 1167},
-	{0x5e95, 1461},
-	{0x5e96, 1462},
-	{0x5e97, 1459},
-	{0x5e9a, 1458},
-	{0x5e9b, 6866},
-	{0x5e9c, 1460},
-	{0x5ea0, 1810},
-	{0x5ea2, 6865},
-	{0x5ea3, 6867},
-	{0x5ea4, 6864},
-	{0x5ea5, 6868},
-	{0x5ea6, 1811},
-	{0x5ea7, 2221},
-	{0x5ea8, 7304},
-	{0x5eaa, 7306},
-	{0x5eab, 2219},
-	{0x5eac, 7307},
-	{0x5ead, 2220},
-	{0x5eae, 7305},
-	{0x5eb0, 6863},
-	{0x5eb1, 7886},
-	{0x5eb2, 7889},
-	{0x5eb3, 7890},
-	{0x5eb4, 7887},
-	{0x5eb5, 2675},
-	{0x5eb6, 2674},
-	{0x5eb7, 2672},
-	{0x5eb8, 2673},
-	{0x5eb9, 7888},
-	{0x5ebe, 2676},
-	{0x5ec1, 3133},
-	{0x5ec2, 3134},
-	{0x5ec4, 3135},
-	{0x5ec5, 9164},
-	{0x5ec6, 9166},
-	{0x5ec7, 9168},
-	{0x5ec8, 3586},
-	{0x5ec9, 3585},
-	{0x5eca, 3132},
-	{0x5ecb, 9167},
-	{0x5ecc, 9165},
-	{0x5ece, 9848},
-	{0x5ed1, 9846},
-	{0x5ed2, 9852},
-	{0x5ed3, 4042},
-	{0x5ed4, 9853},
-	{0x5ed5, 9850},
-	{0x5ed6, 4043},
-	{0x5ed7, 9847},
-	{0x5ed8, 9845},
-	{0x5ed9, 9851},
-	{0x5eda, 4412},
-	{0x5edc, 9849},
-	{0x5edd, 4414},
-	{0x5edf, 4413},
-	{0x5ee0, 4416},
-	{0x5ee2, 4411},
-	{0x5ee3, 4415},
-	{0x5eec, 5501},
-	{0x5eef, 0},
-	{0x5ef3, 5954},
-	{0x5ef4, 553},
-	{0x5ef6, 1463},
-	{0x5ef7, 1170},
-	{0x5efa, 1812},
-	{0x5efe, 654},
-	{0x5eff, 717},
-	{0x5f01, 829},
-	{0x5f02, 6118},
-	{0x5f04, 1171},
-	{0x5f05, 6265},
-	{0x5f07, 6869},
-	{0x5f08, 1813},
-	{0x5f0a, 4044},
-	{0x5f0b, 655},
-	{0x5f0f, 972},
-	{0x5f12, 3587},
-	{0x5f13, 656},
-	{0x5f14, 718},
-	{0x5f15, 719},
-	{0x5f17, 831},
-	{0x5f18, 830},
-	{0x5f1a, 6119},
-	{0x5f1b, 973},
-	{0x5f1d, 6266},
-	{0x5f1f, 1172},
-	{0x5f22, 6515},
-	{0x5f23, 6516},
-	{0x5f24, 6517},
-	{0x5f26, 1464},
-	{0x5f27, 1465},
-	{0x5f28, 6514},
-	{0x5f29, 1466},
-	{0x5f2d, 1814},
-	{0x5f2e, 6870},
-	{0x5f30, 7309},
-	{0x5f31, 2222},
-	{0x5f33, 7308},
-	{0x5f35, 2677},
-	{0x5f36, 7891},
-	{0x5f37, 2678},
-	{0x5f38, 7892},
-	{0x5f3c, 3136},
-	{0x5f40, 9169},
-	{0x5f43, 9855},
-	{0x5f44, 9854},
-	{0x5f46, 4045},
-	{0x5f48, 4417},
-	{0x5f4a, 4781},
-	{0x5f4c, 5070},
-	{0x5f4e, 5827},
-	{0x5f50, 554},
-	{0x5f54, 6518},
-	{0x5f56, 6871},
-	{0x5f57, 2679},
-	{0x5f58, 8495},
-	{0x5f59, 3588},
-	{0x5f5d, 5327},
-	{0x5f61, 555},
-	{0x5f62, 1174},
-	{0x5f64, 1173},
-	{0x5f65, 1815},
-	{0x5f67, 7310},
-	{0x5f69, 2681},
-	{0x5f6a, 2953},
-	{0x5f6b, 2682},
-	{0x5f6c, 2680},
-	{0x5f6d, 3137},
-	{0x5f6f, 9856},
-	{0x5f70, 4046},
-	{0x5f71, 4418},
-	{0x5f73, 6007},
-	{0x5f74, 6120},
-	{0x5f76, 6268},
-	{0x5f77, 1175},
-	{0x5f78, 6267},
-	{0x5f79, 1176},
-	{0x5f7c, 1470},
-	{0x5f7d, 6521},
-	{0x5f7e, 6520},
-	{0x5f7f, 1469},
-	{0x5f80, 1467},
-	{0x5f81, 1468},
-	{0x5f82, 6519},
-	{0x5f85, 1817},
-	{0x5f86, 6872},
-	{0x5f87, 1820},
-	{0x5f88, 1816},
-	{0x5f89, 1822},
-	{0x5f8a, 1818},
-	{0x5f8b, 1819},
-	{0x5f8c, 1821},
-	{0x5f90, 2225},
-	{0x5f91, 2224},
-	{0x5f92, 2223},
-	{0x5f96, 7894},
-	{0x5f97, 2683},
-	{0x5f98, 2686},
-	{0x5f99, 2684},
-	{0x5f9b, 7893},
-	{0x5f9c, 2689},
-	{0x5f9e, 2685},
-	{0x5f9f, 7895},
-	{0x5fa0, 2688},
-	{0x5fa1, 2687},
-	{0x5fa5, 8497},
-	{0x5fa6, 8496},
-	{0x5fa8, 3140},
-	{0x5fa9, 3138},
-	{0x5faa, 3139},
-	{0x5fab, 8498},
-	{0x5fac, 3589},
-	{0x5fad, 9171},
-	{0x5fae, 3590},
-	{0x5faf, 9170},
-	{0x5fb5, 4420},
-	{0x5fb6, 9857},
-	{0x5fb7, 4419},
-	{0x5fb9, 4047},
-	{0x5fbd, 5071},
-	{0x5fc1, 0},
-	{0x5fc3, 720},
-	{0x5fc5, 832},
-	{0x5fc9, 6055},
-	{0x5fcc, 1178},
-	{0x5fcd, 1180},
-	{0x5fcf, 6123},
-	{0x5fd0, 6271},
-	{0x5fd1, 6270},
-	{0x5fd2, 6269},
-	{0x5fd4, 6122},
-	{0x5fd5, 6121},
-	{0x5fd6, 975},
-	{0x5fd7, 1179},
-	{0x5fd8, 1177},
-	{0x5fd9, 974},
-	{0x5fdd, 1471},
-	{0x5fde, 6522},
-	{0x5fe0, 1472},
-	{0x5fe1, 6276},
-	{0x5fe3, 6278},
-	{0x5fe4, 6277},
-	{0x5fe5, 6523},
-	{0x5fe8, 6273},
-	{0x5fea, 1184},
-	{0x5feb, 1182},
-	{0x5fed, 6272},
-	{0x5fee, 6274},
-	{0x5fef, 6280},
-	{0x5ff1, 1181},
-	{0x5ff3, 6275},
-	{0x5ff4, 6284},
-	{0x5ff5, 1474},
-	{0x5ff7, 6281},
-	{0x5ff8, 1183},
-	{0x5ffa, 6279},
-	{0x5ffb, 6282},
-	{0x5ffd, 1473},
-	{0x5fff, 1475},
-	{0x6000, 6283},
-	{0x6009, 6543},
-	{0x600a, 6530},
-	{0x600b, 6528},
-	{0x600c, 6542},
-	{0x600d, 6537},
-	{0x600e, 1827},
-	{0x600f, 1476},
-	{0x6010, 6538},
-	{0x6011, 6541},
-	{0x6012, 1823},
-	{0x6013, 6540},
-	{0x6014, 1477},
-	{0x6015, 1482},
-	{0x6016, 1480},
-	{0x6017, 6531},
-	{0x6019, 6526},
-	{0x601a, 6533},
-	{0x601b, 1487},
-	{0x601c, 6544},
-	{0x601d, 1824},
-	{0x601e, 6534},
-	{0x6020, 1825},
-	{0x6021, 1483},
-	{0x6022, 6536},
-	{0x6024, 6887},
-	{0x6025, 1826},
-	{0x6026, 6525},
-	{0x6027, 1484},
-	{0x6028, 1828},
-	{0x6029, 1485},
-	{0x602a, 1481},
-	{0x602b, 1486},
-	{0x602c, 6535},
-	{0x602d, 6524},
-	{0x602e, 6539},
-	{0x602f, 1478},
-	{0x6032, 6527},
-	{0x6033, 6532},
-	{0x6034, 6529},
-	{0x6035, 1479},
-	{0x6037, 6873},
-	{0x6039, 6874},
-	{0x6040, 6884},
-	{0x6041, 7314},
-	{0x6042, 6885},
-	{0x6043, 1834},
-	{0x6044, 6888},
-	{0x6045, 6878},
-	{0x6046, 1833},
-	{0x6047, 6880},
-	{0x6049, 6881},
-	{0x604c, 6883},
-	{0x604d, 1829},
-	{0x6050, 2229},
-	{0x6053, 6879},
-	{0x6054, 6875},
-	{0x6055, 2230},
-	{0x6058, 6889},
-	{0x6059, 2226},
-	{0x605a, 7312},
-	{0x605b, 6882},
-	{0x605d, 7311},
-	{0x605e, 6877},
-	{0x605f, 6886},
-	{0x6062, 1832},
-	{0x6063, 2227},
-	{0x6064, 1838},
-	{0x6065, 2228},
-	{0x6066, 6890},
-	{0x6067, 7313},
-	{0x6068, 1831},
-	{0x6069, 2232},
-	{0x606a, 1837},
-	{0x606b, 1836},
-	{0x606c, 1835},
-	{0x606d, 2231},
-	{0x606e, 6891},
-	{0x606f, 2233},
-	{0x6070, 1830},
-	{0x6072, 6876},
-	{0x607f, 2690},
-	{0x6080, 7317},
-	{0x6081, 7319},
-	{0x6083, 7321},
-	{0x6084, 2234},
-	{0x6085, 2240},
-	{0x6086, 7898},
-	{0x6087, 7325},
-	{0x6088, 7316},
-	{0x6089, 2692},
-	{0x608a, 7896},
-	{0x608c, 2239},
-	{0x608d, 2237},
-	{0x608e, 7327},
-	{0x6090, 7897},
-	{0x6092, 7318},
-	{0x6094, 2238},
-	{0x6095, 7322},
-	{0x6096, 2241},
-	{0x6097, 7324},
-	{0x609a, 2236},
-	{0x609b, 7323},
-	{0x609c, 7326},
-	{0x609d, 7320},
-	{0x609f, 2235},
-	{0x60a0, 2693},
-	{0x60a2, 7315},
-	{0x60a3, 2691},
-	{0x60a8, 2694},
-	{0x60b0, 7900},
-	{0x60b1, 7909},
-	{0x60b2, 3143},
-	{0x60b4, 2696},
-	{0x60b5, 2701},
-	{0x60b6, 3144},
-	{0x60b7, 7911},
-	{0x60b8, 2708},
-	{0x60b9, 8500},
-	{0x60ba, 7901},
-	{0x60bb, 2700},
-	{0x60bc, 2703},
-	{0x60bd, 2698},
-	{0x60be, 7899},
-	{0x60bf, 7913},
-	{0x60c0, 7916},
-	{0x60c1, 8515},
-	{0x60c3, 7914},
-	{0x60c4, 8504},
-	{0x60c5, 2699},
-	{0x60c6, 2706},
-	{0x60c7, 2710},
-	{0x60c8, 7908},
-	{0x60c9, 8499},
-	{0x60ca, 7912},
-	{0x60cb, 2695},
-	{0x60cc, 8501},
-	{0x60cd, 7915},
-	{0x60ce, 8503},
-	{0x60cf, 7904},
-	{0x60d1, 3141},
-	{0x60d3, 7902},
-	{0x60d4, 7903},
-	{0x60d5, 2705},
-	{0x60d8, 2704},
-	{0x60d9, 7906},
-	{0x60da, 2709},
-	{0x60db, 7910},
-	{0x60dc, 2702},
-	{0x60dd, 7907},
-	{0x60df, 2707},
-	{0x60e0, 3145},
-	{0x60e1, 3142},
-	{0x60e2, 8502},
-	{0x60e4, 7905},
-	{0x60e6, 2697},
-	{0x60f0, 3150},
-	{0x60f1, 3154},
-	{0x60f2, 8506},
-	{0x60f3, 3595},
-	{0x60f4, 3152},
-	{0x60f5, 8510},
-	{0x60f6, 3156},
-	{0x60f7, 9172},
-	{0x60f8, 8512},
-	{0x60f9, 3597},
-	{0x60fa, 3148},
-	{0x60fb, 3151},
-	{0x60fc, 8513},
-	{0x60fe, 8514},
-	{0x60ff, 8520},
-	{0x6100, 3158},
-	{0x6101, 3598},
-	{0x6103, 8516},
-	{0x6104, 8521},
-	{0x6105, 8509},
-	{0x6106, 3608},
-	{0x6108, 3599},
-	{0x6109, 3157},
-	{0x610a, 8507},
-	{0x610b, 8522},
-	{0x610d, 3607},
-	{0x610e, 3155},
-	{0x610f, 3592},
-	{0x6110, 8519},
-	{0x6112, 3159},
-	{0x6113, 8511},
-	{0x6114, 8505},
-	{0x6115, 3149},
-	{0x6116, 8508},
-	{0x6118, 8517},
-	{0x611a, 3591},
-	{0x611b, 3596},
-	{0x611c, 3146},
-	{0x611d, 8518},
-	{0x611f, 3594},
-	{0x6123, 3147},
-	{0x6127, 3606},
-	{0x6128, 9859},
-	{0x6129, 9183},
-	{0x612b, 9175},
-	{0x612c, 9858},
-	{0x612e, 9179},
-	{0x612f, 9181},
-	{0x6132, 9178},
-	{0x6134, 3605},
-	{0x6136, 9177},
-	{0x6137, 3609},
-	{0x613b, 9874},
-	{0x613e, 3604},
-	{0x613f, 4049},
-	{0x6140, 9184},
-	{0x6141, 9860},
-	{0x6144, 3602},
-	{0x6145, 9176},
-	{0x6146, 9180},
-	{0x6147, 4048},
-	{0x6148, 3593},
-	{0x6149, 9173},
-	{0x614a, 9174},
-	{0x614b, 4050},
-	{0x614c, 3601},
-	{0x614d, 3603},
-	{0x614e, 3600},
-	{0x614f, 9182},
-	{0x6152, 9864},
-	{0x6153, 9865},
-	{0x6154, 9870},
-	{0x6155, 4425},
-	{0x6156, 9877},
-	{0x6158, 4056},
-	{0x615a, 4055},
-	{0x615b, 9872},
-	{0x615d, 4424},
-	{0x615e, 9861},
-	{0x615f, 4054},
-	{0x6161, 9876},
-	{0x6162, 4052},
-	{0x6163, 4053},
-	{0x6165, 9873},
-	{0x6167, 4422},
-	{0x6168, 3153},
-	{0x616a, 9875},
-	{0x616b, 4429},
-	{0x616c, 9867},
-	{0x616e, 4423},
-	{0x6170, 4428},
-	{0x6171, 9862},
-	{0x6172, 9866},
-	{0x6173, 9863},
-	{0x6174, 9869},
-	{0x6175, 4057},
-	{0x6176, 4421},
-	{0x6177, 4051},
-	{0x617a, 9871},
-	{0x617c, 4427},
-	{0x617e, 4430},
-	{0x6180, 9868},
-	{0x6182, 4426},
-	{0x618a, 4785},
-	{0x618e, 4434},
-	{0x6190, 4432},
-	{0x6191, 4783},
-	{0x6194, 4438},
-	{0x619a, 4436},
-	{0x61a4, 4437},
-	{0x61a7, 4431},
-	{0x61a9, 4784},
-	{0x61ab, 4433},
-	{0x61ac, 4435},
-	{0x61ae, 4439},
-	{0x61b2, 4782},
-	{0x61b6, 4787},
-	{0x61be, 4788},
-	{0x61c2, 5073},
-	{0x61c7, 5074},
-	{0x61c8, 4790},
-	{0x61c9, 5072},
-	{0x61ca, 4789},
-	{0x61cb, 5076},
-	{0x61cd, 4786},
-	{0x61e3, 5328},
-	{0x61e6, 5075},
-	{0x61ee, 0},
-	{0x61f2, 5502},
-	{0x61f5, 5505},
-	{0x61f6, 5504},
-	{0x61f7, 5503},
-	{0x61f8, 5652},
-	{0x61fa, 5653},
-	{0x61fc, 5744},
-	{0x61fe, 5745},
-	{0x61ff, 5828},
-	{0x6200, 5880},
-	{0x6204, 0},
-	{0x6208, 721},
-	{0x6209, 6056},
-	{0x620a, 833},
-	{0x620c, 977},
-	{0x620d, 978},
-	{0x620e, 976},
-	{0x6210, 979},
-	{0x6211, 1186},
-	{0x6212, 1185},
-	{0x6214, 6545},
-	{0x6215, 1489},
-	{0x6216, 1488},
-	{0x6219, 7328},
-	{0x621a, 2711},
-	{0x621b, 2712},
-	{0x621f, 3160},
-	{0x6220, 9185},
-	{0x6221, 3610},
-	{0x6222, 3611},
-	{0x6223, 9187},
-	{0x6224, 9189},
-	{0x6225, 9188},
-	{0x6227, 9879},
-	{0x6229, 9878},
-	{0x622a, 4058},
-	{0x622b, 9880},
-	{0x622e, 4440},
-	{0x6230, 4791},
-	{0x6232, 5077},
-	{0x6233, 5329},
-	{0x6234, 5078},
-	{0x6236, 722},
-	{0x623a, 6285},
-	{0x623d, 6546},
-	{0x623e, 1491},
-	{0x623f, 1490},
-	{0x6240, 1492},
-	{0x6241, 1839},
-	{0x6242, 6892},
-	{0x6243, 6893},
-	{0x6246, 7329},
-	{0x6247, 2242},
-	{0x6248, 2713},
-	{0x6249, 3161},
-	{0x624a, 8523},
-	{0x624b, 723},
-	{0x624d, 657},
-	{0x624e, 724},
-	{0x6250, 6057},
-	{0x6251, 837},
-	{0x6252, 836},
-	{0x6253, 834},
-	{0x6254, 835},
-	{0x6258, 982},
-	{0x6259, 6130},
-	{0x625a, 6132},
-	{0x625b, 981},
-	{0x625c, 6124},
-	{0x625e, 6125},
-	{0x6260, 6131},
-	{0x6261, 6127},
-	{0x6262, 6129},
-	{0x6263, 980},
-	{0x6264, 6126},
-	{0x6265, 6133},
-	{0x6266, 6128},
-	{0x626d, 1193},
-	{0x626e, 1202},
-	{0x626f, 1200},
-	{0x6270, 6295},
-	{0x6271, 6292},
-	{0x6272, 6300},
-	{0x6273, 1198},
-	{0x6274, 6301},
-	{0x6276, 1191},
-	{0x6277, 6298},
-	{0x6279, 1197},
-	{0x627a, 6294},
-	{0x627b, 6293},
-	{0x627c, 1195},
-	{0x627d, 6299},
-	{0x627e, 1196},
-	{0x627f, 1493},
-	{0x6280, 1190},
-	{0x6281, 6296},
-	{0x6283, 6286},
-	{0x6284, 1187},
-	{0x6286, 1206},
-	{0x6287, 6291},
-	{0x6288, 6297},
-	{0x6289, 1192},
-	{0x628a, 1194},
-	{0x628c, 6287},
-	{0x628e, 6288},
-	{0x628f, 6289},
-	{0x6291, 1205},
-	{0x6292, 1199},
-	{0x6293, 1204},
-	{0x6294, 6290},
-	{0x6295, 1203},
-	{0x6296, 1189},
-	{0x6297, 1188},
-	{0x6298, 1201},
-	{0x62a8, 1507},
-	{0x62a9, 6558},
-	{0x62aa, 6551},
-	{0x62ab, 1502},
-	{0x62ac, 1521},
-	{0x62ad, 6547},
-	{0x62ae, 6554},
-	{0x62af, 6556},
-	{0x62b0, 6559},
-	{0x62b1, 1516},
-	{0x62b3, 6555},
-	{0x62b4, 6548},
-	{0x62b5, 1514},
-	{0x62b6, 6552},
-	{0x62b8, 6560},
-	{0x62b9, 1499},
-	{0x62bb, 6557},
-	{0x62bc, 1509},
-	{0x62bd, 1508},
-	{0x62be, 6550},
-	{0x62bf, 1497},
-	{0x62c2, 1498},
-	{0x62c4, 1496},
-	{0x62c6, 1520},
-	{0x62c7, 1512},
-	{0x62c8, 1506},
-	{0x62c9, 1494},
-	{0x62ca, 6553},
-	{0x62cb, 1505},
-	{0x62cc, 1495},
-	{0x62cd, 1513},
-	{0x62ce, 1522},
-	{0x62cf, 6894},
-	{0x62d0, 1510},
-	{0x62d1, 6549},
-	{0x62d2, 1500},
-	{0x62d3, 1503},
-	{0x62d4, 1504},
-	{0x62d6, 1518},
-	{0x62d7, 1519},
-	{0x62d8, 1517},
-	{0x62d9, 1511},
-	{0x62da, 1515},
-	{0x62db, 1501},
-	{0x62dc, 1840},
-	{0x62eb, 6900},
-	{0x62ec, 1852},
-	{0x62ed, 1844},
-	{0x62ee, 1846},
-	{0x62ef, 1851},
-	{0x62f0, 6912},
-	{0x62f1, 1849},
-	{0x62f2, 7330},
-	{0x62f3, 2243},
-	{0x62f4, 1854},
-	{0x62f5, 6897},
-	{0x62f6, 6905},
-	{0x62f7, 1850},
-	{0x62f8, 6904},
-	{0x62f9, 6901},
-	{0x62fa, 6909},
-	{0x62fb, 6911},
-	{0x62fc, 1843},
-	{0x62fd, 1847},
-	{0x62fe, 1853},
-	{0x62ff, 2245},
-	{0x6300, 6906},
-	{0x6301, 1845},
-	{0x6302, 1856},
-	{0x6303, 6899},
-	{0x6307, 1848},
-	{0x6308, 2244},
-	{0x6309, 1842},
-	{0x630b, 6896},
-	{0x630c, 6903},
-	{0x630d, 6895},
-	{0x630e, 6898},
-	{0x630f, 6902},
-	{0x6310, 7331},
-	{0x6311, 1855},
-	{0x6313, 6907},
-	{0x6314, 6908},
-	{0x6315, 6910},
-	{0x6316, 1841},
-	{0x6328, 2259},
-	{0x6329, 7343},
-	{0x632a, 2257},
-	{0x632b, 2258},
-	{0x632c, 7333},
-	{0x632d, 7349},
-	{0x632f, 2248},
-	{0x6332, 7917},
-	{0x6333, 7351},
-	{0x6334, 7345},
-	{0x6336, 7336},
-	{0x6338, 7354},
-	{0x6339, 7339},
-	{0x633a, 2254},
-	{0x633b, 7940},
-	{0x633c, 7342},
-	{0x633d, 2256},
-	{0x633e, 2247},
-	{0x6340, 7356},
-	{0x6341, 7344},
-	{0x6342, 2250},
-	{0x6343, 7337},
-	{0x6344, 7334},
-	{0x6345, 7335},
-	{0x6346, 2251},
-	{0x6347, 7350},
-	{0x6348, 7357},
-	{0x6349, 2253},
-	{0x634a, 7341},
-	{0x634b, 7340},
-	{0x634c, 2261},
-	{0x634d, 2260},
-	{0x634e, 2246},
-	{0x634f, 2252},
-	{0x6350, 2255},
-	{0x6351, 7353},
-	{0x6354, 7347},
-	{0x6355, 2249},
-	{0x6356, 7332},
-	{0x6357, 7355},
-	{0x6358, 7346},
-	{0x6359, 7348},
-	{0x635a, 7352},
-	{0x6365, 7918},
-	{0x6367, 2721},
-	{0x6368, 2741},
-	{0x6369, 2740},
-	{0x636b, 2729},
-	{0x636d, 7936},
-	{0x636e, 7932},
-	{0x636f, 7929},
-	{0x6370, 7947},
-	{0x6371, 2724},
-	{0x6372, 2716},
-	{0x6375, 7934},
-	{0x6376, 3177},
-	{0x6377, 2720},
-	{0x6378, 7942},
-	{0x637a, 2742},
-	{0x637b, 2739},
-	{0x637c, 7938},
-	{0x637d, 7921},
-	{0x6380, 2738},
-	{0x6381, 7944},
-	{0x6382, 7920},
-	{0x6383, 2727},
-	{0x6384, 2731},
-	{0x6385, 7943},
-	{0x6387, 7930},
-	{0x6388, 2732},
-	{0x6389, 2726},
-	{0x638a, 7919},
-	{0x638c, 3163},
-	{0x638d, 7946},
-	{0x638e, 7928},
-	{0x638f, 2737},
-	{0x6390, 7931},
-	{0x6391, 7945},
-	{0x6392, 2736},
-	{0x6394, 8524},
-	{0x6396, 2717},
-	{0x6397, 7926},
-	{0x6398, 2722},
-	{0x6399, 2733},
-	{0x639b, 2728},
-	{0x639c, 7935},
-	{0x639d, 7925},
-	{0x639e, 7923},
-	{0x639f, 7941},
-	{0x63a0, 2714},
-	{0x63a1, 2734},
-	{0x63a2, 2718},
-	{0x63a3, 3162},
-	{0x63a4, 7939},
-	{0x63a5, 2719},
-	{0x63a7, 2715},
-	{0x63a8, 2730},
-	{0x63a9, 2725},
-	{0x63aa, 2723},
-	{0x63ab, 7927},
-	{0x63ac, 2735},
-	{0x63ad, 7924},
-	{0x63ae, 7937},
-	{0x63af, 7933},
-	{0x63b0, 8526},
-	{0x63b1, 8525},
-	{0x63bd, 7922},
-	{0x63be, 8542},
-	{0x63c0, 3165},
-	{0x63c2, 8548},
-	{0x63c3, 8531},
-	{0x63c4, 8545},
-	{0x63c5, 9190},
-	{0x63c6, 3168},
-	{0x63c7, 8549},
-	{0x63c8, 8552},
-	{0x63c9, 3167},
-	{0x63ca, 8534},
-	{0x63cb, 8551},
-	{0x63cc, 8550},
-	{0x63cd, 3169},
-	{0x63ce, 8527},
-	{0x63cf, 3164},
-	{0x63d0, 3172},
-	{0x63d2, 3170},
-	{0x63d3, 8547},
-	{0x63d5, 8537},
-	{0x63d6, 3174},
-	{0x63d7, 8554},
-	{0x63d8, 8546},
-	{0x63d9, 8555},
-	{0x63da, 3182},
-	{0x63db, 3180},
-	{0x63dc, 8544},
-	{0x63dd, 8543},
-	{0x63df, 8541},
-	{0x63e0, 8535},
-	{0x63e1, 3173},
-	{0x63e3, 3171},
-	{0x63e4, 7338},
-	{0x63e5, 8528},
-	{0x63e7, 9220},
-	{0x63e8, 8529},
-	{0x63e9, 3166},
-	{0x63ea, 3179},
-	{0x63eb, 9192},
-	{0x63ed, 3175},
-	{0x63ee, 3176},
-	{0x63ef, 8530},
-	{0x63f0, 8553},
-	{0x63f1, 9191},
-	{0x63f2, 8538},
-	{0x63f3, 8533},
-	{0x63f4, 3178},
-	{0x63f5, 8539},
-	{0x63f6, 8536},
-	{0x63f9, 3183},
-	{0x6406, 3626},
-	{0x6409, 9195},
-	{0x640a, 9214},
-	{0x640b, 9219},
-	{0x640c, 9207},
-	{0x640d, 3622},
-	{0x640e, 9224},
-	{0x640f, 3619},
-	{0x6410, 9193},
-	{0x6412, 9194},
-	{0x6413, 3612},
-	{0x6414, 3621},
-	{0x6415, 9201},
-	{0x6416, 3624},
-	{0x6417, 3625},
-	{0x6418, 9202},
-	{0x641a, 9215},
-	{0x641b, 9221},
-	{0x641c, 3620},
-	{0x641e, 3614},
-	{0x641f, 9200},
-	{0x6420, 9196},
-	{0x6421, 9223},
-	{0x6422, 9205},
-	{0x6423, 9206},
-	{0x6424, 9197},
-	{0x6425, 9217},
-	{0x6426, 9208},
-	{0x6427, 9218},
-	{0x6428, 9210},
-	{0x642a, 3615},
-	{0x642b, 9881},
-	{0x642c, 3618},
-	{0x642d, 3616},
-	{0x642e, 9222},
-	{0x642f, 9213},
-	{0x6430, 9209},
-	{0x6433, 9198},
-	{0x6434, 4068},
-	{0x6435, 9212},
-	{0x6436, 3623},
-	{0x6437, 9204},
-	{0x6439, 9203},
-	{0x643d, 3617},
-	{0x643e, 3613},
-	{0x643f, 9902},
-	{0x6440, 9216},
-	{0x6441, 9211},
-	{0x6443, 9199},
-	{0x644b, 9897},
-	{0x644d, 9882},
-	{0x644e, 9893},
-	{0x6450, 9900},
-	{0x6451, 4066},
-	{0x6452, 3181},
-	{0x6453, 9898},
-	{0x6454, 4061},
-	{0x6458, 4060},
-	{0x6459, 9905},
-	{0x645b, 9883},
-	{0x645c, 9896},
-	{0x645d, 9884},
-	{0x645e, 9895},
-	{0x645f, 4064},
-	{0x6460, 9899},
-	{0x6461, 8540},
-	{0x6465, 9906},
-	{0x6466, 9891},
-	{0x6467, 4067},
-	{0x6469, 4441},
-	{0x646b, 9904},
-	{0x646c, 9903},
-	{0x646d, 4069},
-	{0x646f, 4442},
-	{0x6472, 9887},
-	{0x6473, 9888},
-	{0x6474, 9885},
-	{0x6475, 9890},
-	{0x6476, 9886},
-	{0x6477, 9907},
-	{0x6478, 4063},
-	{0x6479, 4443},
-	{0x647a, 4065},
-	{0x647b, 4070},
-	{0x647d, 9889},
-	{0x647f, 9901},
-	{0x6482, 9894},
-	{0x6487, 4059},
-	{0x6488, 4446},
-	{0x6490, 4447},
-	{0x6492, 4453},
-	{0x6493, 4450},
-	{0x6495, 4451},
-	{0x6499, 4459},
-	{0x649a, 4457},
-	{0x649d, 8532},
-	{0x649e, 4444},
-	{0x64a2, 4460},
-	{0x64a4, 4062},
-	{0x64a5, 4449},
-	{0x64a6, 9892},
-	{0x64a9, 4452},
-	{0x64ab, 4456},
-	{0x64ac, 4458},
-	{0x64ad, 4455},
-	{0x64ae, 4454},
-	{0x64b0, 4448},
-	{0x64b2, 4445},
-	{0x64b3, 4461},
-	{0x64bb, 4795},
-	{0x64bc, 4796},
-	{0x64be, 4805},
-	{0x64bf, 4802},
-	{0x64c1, 4793},
-	{0x64c2, 4800},
-	{0x64c4, 4798},
-	{0x64c5, 4792},
-	{0x64c7, 4799},
-	{0x64ca, 5080},
-	{0x64cb, 4794},
-	{0x64cd, 4801},
-	{0x64ce, 5079},
-	{0x64d2, 4803},
-	{0x64d4, 4804},
-	{0x64d8, 5081},
-	{0x64da, 4797},
-	{0x64e0, 5082},
-	{0x64e2, 5087},
-	{0x64e6, 5084},
-	{0x64ec, 5085},
-	{0x64ed, 5088},
-	{0x64f0, 5083},
-	{0x64f1, 5086},
-	{0x64f2, 5331},
-	{0x64f4, 5330},
-	{0x64f7, 5336},
-	{0x64fa, 5334},
-	{0x64fb, 5335},
-	{0x64fe, 5332},
-	{0x6500, 5506},
-	{0x6506, 5333},
-	{0x650f, 5507},
-	{0x6514, 5655},
-	{0x6518, 5654},
-	{0x6519, 5656},
-	{0x651c, 5747},
-	{0x651d, 5746},
-	{0x6523, 5881},
-	{0x6524, 5829},
-	{0x652a, 5883},
-	{0x652b, 5882},
-	{0x652c, 5921},
-	{0x652f, 725},
-	{0x6532, 8556},
-	{0x6534, 556},
-	{0x6536, 983},
-	{0x6537, 6134},
-	{0x6538, 1209},
-	{0x6539, 1207},
-	{0x653b, 1208},
-	{0x653d, 6561},
-	{0x653e, 1523},
-	{0x653f, 1857},
-	{0x6541, 6913},
-	{0x6543, 6914},
-	{0x6545, 1858},
-	{0x6546, 7359},
-	{0x6548, 2262},
-	{0x6549, 2263},
-	{0x654a, 7358},
-	{0x654f, 2749},
-	{0x6551, 2745},
-	{0x6553, 7948},
-	{0x6554, 2752},
-	{0x6555, 2751},
-	{0x6556, 2744},
-	{0x6557, 2747},
-	{0x6558, 2750},
-	{0x6559, 2746},
-	{0x655c, 8560},
-	{0x655d, 2743},
-	{0x655e, 3184},
-	{0x6562, 3186},
-	{0x6563, 3187},
-	{0x6564, 8559},
-	{0x6565, 8562},
-	{0x6566, 3185},
-	{0x6567, 8557},
-	{0x6568, 8561},
-	{0x656a, 8558},
-	{0x656c, 3627},
-	{0x656f, 9225},
-	{0x6572, 4071},
-	{0x6573, 9908},
-	{0x6574, 4806},
-	{0x6575, 4462},
-	{0x6577, 4463},
-	{0x6578, 4464},
-	{0x6582, 5089},
-	{0x6583, 5090},
-	{0x6587, 726},
-	{0x658c, 8563},
-	{0x6590, 3189},
-	{0x6591, 3188},
-	{0x6592, 9226},
-	{0x6595, 5748},
-	{0x6597, 727},
-	{0x6599, 2264},
-	{0x659b, 2754},
-	{0x659c, 2753},
-	{0x659d, 8564},
-	{0x659e, 8565},
-	{0x659f, 3628},
-	{0x65a0, 9909},
-	{0x65a1, 4072},
-	{0x65a4, 728},
-	{0x65a5, 838},
-	{0x65a7, 1524},
-	{0x65a8, 6562},
-	{0x65aa, 6915},
-	{0x65ab, 1859},
-	{0x65ac, 2755},
-	{0x65ae, 8566},
-	{0x65af, 3190},
-	{0x65b0, 3629},
-	{0x65b3, 0},
-	{0x65b7, 5337},
-	{0x65b9, 729},
-	{0x65bb, 6563},
-	{0x65bc, 1525},
-	{0x65bd, 1860},
-	{0x65bf, 6916},
-	{0x65c1, 2265},
-	{0x65c2, 7363},
-	{0x65c3, 7361},
-	{0x65c4, 7362},
-	{0x65c5, 2266},
-	{0x65c6, 7360},
-	{0x65cb, 2757},
-	{0x65cc, 2758},
-	{0x65cd, 7949},
-	{0x65ce, 2759},
-	{0x65cf, 2756},
-	{0x65d0, 8567},
-	{0x65d2, 8568},
-	{0x65d3, 9227},
-	{0x65d6, 4074},
-	{0x65d7, 4073},
-	{0x65e0, 557},
-	{0x65e1, 6025},
-	{0x65e2, 1861},
-	{0x65e5, 730},
-	{0x65e6, 839},
-	{0x65e8, 985},
-	{0x65e9, 984},
-	{0x65ec, 986},
-	{0x65ed, 987},
-	{0x65ee, 6136},
-	{0x65ef, 6135},
-	{0x65f0, 6302},
-	{0x65f1, 1210},
-	{0x65f2, 6305},
-	{0x65f3, 6304},
-	{0x65f4, 6303},
-	{0x65f5, 6306},
-	{0x65fa, 1526},
-	{0x65fb, 6569},
-	{0x65fc, 6565},
-	{0x65fd, 6574},
-	{0x6600, 1533},
-	{0x6602, 1531},
-	{0x6603, 6570},
-	{0x6604, 6566},
-	{0x6605, 6573},
-	{0x6606, 1530},
-	{0x6607, 1537},
-	{0x6608, 6568},
-	{0x6609, 6564},
-	{0x660a, 1536},
-	{0x660b, 6571},
-	{0x660c, 1529},
-	{0x660d, 6572},
-	{0x660e, 1532},
-	{0x660f, 1534},
-	{0x6610, 6576},
-	{0x6611, 6575},
-	{0x6612, 6567},
-	{0x6613, 1528},
-	{0x6614, 1527},
-	{0x6615, 1535},
-	{0x661c, 6921},
-	{0x661d, 6927},
-	{0x661f, 1867},
-	{0x6620, 1864},
-	{0x6621, 6918},
-	{0x6622, 6923},
-	{0x6624, 1870},
-	{0x6625, 1862},
-	{0x6626, 6922},
-	{0x6627, 1865},
-	{0x6628, 1868},
-	{0x662b, 6925},
-	{0x662d, 1863},
-	{0x662e, 6930},
-	{0x662f, 1866},
-	{0x6631, 1869},
-	{0x6632, 6919},
-	{0x6633, 6924},
-	{0x6634, 6928},
-	{0x6635, 6920},
-	{0x6636, 6917},
-	{0x6639, 6929},
-	{0x663a, 6926},
-	{0x6641, 2274},
-	{0x6642, 2267},
-	{0x6643, 2270},
-	{0x6645, 2273},
-	{0x6647, 7366},
-	{0x6649, 2268},
-	{0x664a, 7364},
-	{0x664c, 2272},
-	{0x664f, 2269},
-	{0x6651, 7367},
-	{0x6652, 2271},
-	{0x6659, 7953},
-	{0x665a, 2761},
-	{0x665b, 7952},
-	{0x665c, 7954},
-	{0x665d, 2760},
-	{0x665e, 2765},
-	{0x665f, 7365},
-	{0x6661, 7951},
-	{0x6662, 7955},
-	{0x6664, 2762},
-	{0x6665, 7950},
-	{0x6666, 2764},
-	{0x6668, 2763},
-	{0x666a, 8575},
-	{0x666c, 8570},
-	{0x666e, 3191},
-	{0x666f, 3195},
-	{0x6670, 3192},
-	{0x6671, 8573},
-	{0x6672, 8576},
-	{0x6674, 3193},
-	{0x6676, 3194},
-	{0x6677, 3199},
-	{0x6678, 9236},
-	{0x6679, 8574},
-	{0x667a, 3197},
-	{0x667b, 8571},
-	{0x667c, 8569},
-	{0x667e, 3198},
-	{0x6680, 8572},
-	{0x6684, 3635},
-	{0x6686, 9228},
-	{0x6687, 3632},
-	{0x6688, 3633},
-	{0x6689, 3631},
-	{0x668a, 9233},
-	{0x668b, 9232},
-	{0x668c, 9229},
-	{0x668d, 3637},
-	{0x6690, 9231},
-	{0x6691, 3196},
-	{0x6694, 9235},
-	{0x6695, 9230},
-	{0x6696, 3634},
-	{0x6697, 3630},
-	{0x6698, 3636},
-	{0x6699, 9234},
-	{0x669d, 4077},
-	{0x669f, 9912},
-	{0x66a0, 9911},
-	{0x66a1, 9910},
-	{0x66a2, 4075},
-	{0x66a8, 4076},
-	{0x66ab, 4466},
-	{0x66ae, 4465},
-	{0x66b1, 4468},
-	{0x66b4, 4467},
-	{0x66b8, 4812},
-	{0x66b9, 4809},
-	{0x66c4, 4810},
-	{0x66c6, 4807},
-	{0x66c7, 4811},
-	{0x66c9, 4808},
-	{0x66cb, 0},
-	{0x66d6, 5092},
-	{0x66d9, 5091},
-	{0x66db, 0},
-	{0x66dc, 5338},
-	{0x66dd, 5509},
-	{0x66e0, 5508},
-	{0x66e4, 0},
-	{0x66e6, 5657},
-	{0x66e9, 5749},
-	{0x66ec, 5884},
-	{0x66ee, 0},
-	{0x66f0, 731},
-	{0x66f2, 988},
-	{0x66f3, 989},
-	{0x66f4, 1211},
-	{0x66f6, 6577},
-	{0x66f7, 1871},
-	{0x66f8, 2275},
-	{0x66f9, 2766},
-	{0x66fc, 2591},
-	{0x66fe, 3200},
-	{0x66ff, 3201},
-	{0x6700, 3056},
-	{0x6701, 8577},
-	{0x6703, 3638},
-	{0x6704, 9914},
-	{0x6705, 9913},
-	{0x6708, 732},
-	{0x6709, 990},
-	{0x670a, 6578},
-	{0x670b, 1539},
-	{0x670d, 1538},
-	{0x670f, 6931},
-	{0x6710, 6932},
-	{0x6712, 7368},
-	{0x6713, 7369},
-	{0x6714, 2276},
-	{0x6715, 2277},
-	{0x6717, 2278},
-	{0x6718, 7956},
-	{0x671b, 2768},
-	{0x671d, 3203},
-	{0x671f, 3202},
-	{0x6720, 9237},
-	{0x6721, 9506},
-	{0x6722, 9915},
-	{0x6726, 5339},
-	{0x6727, 5658},
-	{0x6728, 733},
-	{0x672a, 842},
-	{0x672b, 843},
-	{0x672c, 841},
-	{0x672d, 844},
-	{0x672e, 840},
-	{0x6731, 993},
-	{0x6733, 6144},
-	{0x6734, 992},
-	{0x6735, 994},
-	{0x6738, 6139},
-	{0x6739, 6138},
-	{0x673a, 6141},
-	{0x673b, 6140},
-	{0x673c, 6143},
-	{0x673d, 991},
-	{0x673e, 6137},
-	{0x673f, 6142},
-	{0x6745, 6307},
-	{0x6746, 1221},
-	{0x6747, 6308},
-	{0x6748, 6312},
-	{0x6749, 1220},
-	{0x674b, 6316},
-	{0x674c, 6311},
-	{0x674d, 6314},
-	{0x674e, 1213},
-	{0x674f, 1214},
-	{0x6750, 1215},
-	{0x6751, 1216},
-	{0x6753, 1223},
-	{0x6755, 6310},
-	{0x6756, 1218},
-	{0x6757, 1224},
-	{0x6759, 6309},
-	{0x675a, 6315},
-	{0x675c, 1217},
-	{0x675d, 6313},
-	{0x675e, 1219},
-	{0x675f, 1212},
-	{0x6760, 1222},
-	{0x676a, 1560},
-	{0x676c, 6580},
-	{0x676d, 1540},
-	{0x676f, 1550},
-	{0x6770, 1551},
-	{0x6771, 1543},
-	{0x6772, 1561},
-	{0x6773, 1545},
-	{0x6774, 6588},
-	{0x6775, 1556},
-	{0x6776, 6583},
-	{0x6777, 1546},
-	{0x6778, 6598},
-	{0x6779, 6599},
-	{0x677a, 6591},
-	{0x677b, 6584},
-	{0x677c, 1559},
-	{0x677d, 6596},
-	{0x677e, 1554},
-	{0x677f, 1552},
-	{0x6781, 6597},
-	{0x6783, 6595},
-	{0x6784, 6587},
-	{0x6785, 6579},
-	{0x6786, 6586},
-	{0x6787, 1547},
-	{0x6789, 1553},
-	{0x678b, 1541},
-	{0x678c, 6590},
-	{0x678d, 6589},
-	{0x678e, 6581},
-	{0x6790, 1555},
-	{0x6791, 6593},
-	{0x6792, 6582},
-	{0x6793, 1558},
-	{0x6794, 6600},
-	{0x6795, 1542},
-	{0x6797, 1549},
-	{0x6798, 6585},
-	{0x6799, 6594},
-	{0x679a, 1557},
-	{0x679c, 1544},
-	{0x679d, 1548},
-	{0x679f, 6592},
-	{0x67ae, 6964},
-	{0x67af, 1879},
-	{0x67b0, 1892},
-	{0x67b2, 6959},
-	{0x67b3, 6949},
-	{0x67b4, 1885},
-	{0x67b5, 6947},
-	{0x67b6, 1878},
-	{0x67b7, 6942},
-	{0x67b8, 1888},
-	{0x67b9, 6955},
-	{0x67ba, 6936},
-	{0x67bb, 6938},
-	{0x67c0, 6941},
-	{0x67c1, 6933},
-	{0x67c2, 6954},
-	{0x67c3, 6970},
-	{0x67c4, 1883},
-	{0x67c5, 6943},
-	{0x67c6, 6961},
-	{0x67c8, 6935},
-	{0x67c9, 6968},
-	{0x67ca, 6969},
-	{0x67cb, 6972},
-	{0x67cc, 6963},
-	{0x67cd, 6948},
-	{0x67ce, 6956},
-	{0x67cf, 1889},
-	{0x67d0, 1876},
-	{0x67d1, 1884},
-	{0x67d2, 1896},
-	{0x67d3, 1873},
-	{0x67d4, 1875},
-	{0x67d8, 6940},
-	{0x67d9, 1893},
-	{0x67da, 1886},
-	{0x67db, 6966},
-	{0x67dc, 6937},
-	{0x67dd, 1895},
-	{0x67de, 1890},
-	{0x67df, 6946},
-	{0x67e2, 1894},
-	{0x67e3, 6953},
-	{0x67e4, 6945},
-	{0x67e5, 1887},
-	{0x67e6, 6965},
-	{0x67e7, 6957},
-	{0x67e9, 1881},
-	{0x67ea, 6971},
-	{0x67eb, 6944},
-	{0x67ec, 1877},
-	{0x67ed, 6962},
-	{0x67ee, 6952},
-	{0x67ef, 1882},
-	{0x67f0, 6958},
-	{0x67f1, 1874},
-	{0x67f2, 6934},
-	{0x67f3, 1891},
-	{0x67f4, 2293},
-	{0x67f5, 1880},
-	{0x67f6, 6951},
-	{0x67f7, 6950},
-	{0x67f8, 6939},
-	{0x67fa, 6967},
-	{0x67fc, 6960},
-	{0x67ff, 1872},
-	{0x6812, 7389},
-	{0x6813, 2300},
-	{0x6814, 7390},
-	{0x6816, 7378},
-	{0x6817, 2289},
-	{0x6818, 2301},
-	{0x681a, 7371},
-	{0x681c, 7380},
-	{0x681d, 7388},
-	{0x681f, 7370},
-	{0x6820, 7397},
-	{0x6821, 2279},
-	{0x6825, 7396},
-	{0x6826, 7391},
-	{0x6828, 7392},
-	{0x6829, 2287},
-	{0x682a, 2298},
-	{0x682b, 7382},
-	{0x682d, 7383},
-	{0x682e, 7393},
-	{0x682f, 7384},
-	{0x6831, 7379},
-	{0x6832, 7373},
-	{0x6833, 7374},
-	{0x6834, 7387},
-	{0x6835, 7381},
-	{0x6838, 2280},
-	{0x6839, 2284},
-	{0x683a, 7395},
-	{0x683b, 7375},
-	{0x683c, 2296},
-	{0x683d, 2292},
-	{0x6840, 2295},
-	{0x6841, 2302},
-	{0x6842, 2285},
-	{0x6843, 2297},
-	{0x6844, 7386},
-	{0x6845, 2299},
-	{0x6846, 2282},
-	{0x6848, 2281},
-	{0x6849, 7372},
-	{0x684b, 7376},
-	{0x684c, 2290},
-	{0x684d, 7394},
-	{0x684e, 7385},
-	{0x684f, 7377},
-	{0x6850, 2294},
-	{0x6851, 2291},
-	{0x6853, 2283},
-	{0x6854, 2286},
-	{0x686b, 7977},
-	{0x686d, 7961},
-	{0x686e, 7962},
-	{0x686f, 7966},
-	{0x6871, 7981},
-	{0x6872, 7978},
-	{0x6874, 7971},
-	{0x6875, 7970},
-	{0x6876, 2775},
-	{0x6877, 7974},
-	{0x6878, 7989},
-	{0x6879, 7957},
-	{0x687b, 7990},
-	{0x687c, 7976},
-	{0x687d, 7994},
-	{0x687e, 7982},
-	{0x687f, 2774},
-	{0x6880, 7980},
-	{0x6881, 2769},
-	{0x6882, 2790},
-	{0x6883, 2780},
-	{0x6885, 2784},
-	{0x6886, 2783},
-	{0x6887, 7958},
-	{0x6889, 7987},
-	{0x688a, 7993},
-	{0x688b, 7985},
-	{0x688c, 7992},
-	{0x688f, 7973},
-	{0x6890, 7959},
-	{0x6891, 7991},
-	{0x6892, 7975},
-	{0x6893, 2772},
-	{0x6894, 2785},
-	{0x6896, 7984},
-	{0x6897, 2778},
-	{0x689b, 7983},
-	{0x689c, 7960},
-	{0x689d, 2786},
-	{0x689f, 2788},
-	{0x68a0, 7986},
-	{0x68a1, 2789},
-	{0x68a2, 2771},
-	{0x68a3, 7967},
-	{0x68a4, 7988},
-	{0x68a7, 2777},
-	{0x68a8, 2787},
-	{0x68a9, 7969},
-	{0x68aa, 7979},
-	{0x68ab, 7964},
-	{0x68ac, 7968},
-	{0x68ad, 2782},
-	{0x68ae, 7963},
-	{0x68af, 2770},
-	{0x68b0, 2779},
-	{0x68b1, 2776},
-	{0x68b2, 7972},
-	{0x68b3, 2288},
-	{0x68b4, 8600},
-	{0x68b5, 2773},
-	{0x68c4, 2781},
-	{0x68c6, 8603},
-	{0x68c7, 8625},
-	{0x68c8, 8614},
-	{0x68c9, 3223},
-	{0x68cb, 3218},
-	{0x68cc, 8597},
-	{0x68cd, 3219},
-	{0x68ce, 8613},
-	{0x68d0, 8606},
-	{0x68d1, 8619},
-	{0x68d2, 3215},
-	{0x68d3, 8579},
-	{0x68d4, 8621},
-	{0x68d5, 3205},
-	{0x68d6, 8587},
-	{0x68d7, 3208},
-	{0x68d8, 3207},
-	{0x68da, 3224},
-	{0x68dc, 8581},
-	{0x68dd, 8615},
-	{0x68de, 8616},
-	{0x68df, 3210},
-	{0x68e0, 3206},
-	{0x68e1, 8595},
-	{0x68e3, 3217},
-	{0x68e4, 8590},
-	{0x68e6, 8617},
-	{0x68e7, 3213},
-	{0x68e8, 8609},
-	{0x68e9, 8622},
-	{0x68ea, 8584},
-	{0x68eb, 8589},
-	{0x68ec, 8583},
-	{0x68ee, 3212},
-	{0x68ef, 8602},
-	{0x68f0, 9259},
-	{0x68f1, 8585},
-	{0x68f2, 3216},
-	{0x68f3, 8594},
-	{0x68f4, 8618},
-	{0x68f5, 3211},
-	{0x68f6, 8591},
-	{0x68f7, 8588},
-	{0x68f8, 8605},
-	{0x68f9, 3214},
-	{0x68fa, 3204},
-	{0x68fb, 3226},
-	{0x68fc, 8608},
-	{0x68fd, 8607},
-	{0x6904, 8580},
-	{0x6905, 3209},
-	{0x6906, 8620},
-	{0x6907, 8596},
-	{0x6908, 8598},
-	{0x690a, 8611},
-	{0x690b, 8610},
-	{0x690c, 8578},
-	{0x690d, 3220},
-	{0x690e, 3222},
-	{0x690f, 8586},
-	{0x6910, 8593},
-	{0x6911, 8601},
-	{0x6912, 3221},
-	{0x6913, 8592},
-	{0x6914, 8604},
-	{0x6915, 8623},
-	{0x6917, 8612},
-	{0x6925, 8624},
-	{0x692a, 8582},
-	{0x692f, 9279},
-	{0x6930, 3646},
-	{0x6932, 9277},
-	{0x6933, 9256},
-	{0x6934, 9261},
-	{0x6935, 9254},
-	{0x6937, 9273},
-	{0x6938, 9240},
-	{0x6939, 9247},
-	{0x693b, 9271},
-	{0x693c, 9281},
-	{0x693d, 9257},
-	{0x693f, 9244},
-	{0x6940, 9263},
-	{0x6941, 9268},
-	{0x6942, 9248},
-	{0x6944, 9265},
-	{0x6945, 9245},
-	{0x6948, 9252},
-	{0x6949, 9253},
-	{0x694a, 3648},
-	{0x694b, 9272},
-	{0x694c, 9270},
-	{0x694e, 9241},
-	{0x694f, 9275},
-	{0x6951, 9276},
-	{0x6952, 9278},
-	{0x6953, 3652},
-	{0x6954, 3644},
-	{0x6956, 7965},
-	{0x6957, 9249},
-	{0x6958, 9267},
-	{0x6959, 9250},
-	{0x695a, 3641},
-	{0x695b, 3657},
-	{0x695c, 9274},
-	{0x695d, 3655},
-	{0x695e, 3651},
-	{0x695f, 9239},
-	{0x6960, 3643},
-	{0x6962, 9242},
-	{0x6963, 3656},
-	{0x6965, 9258},
-	{0x6966, 9238},
-	{0x6968, 3649},
-	{0x6969, 9262},
-	{0x696a, 9246},
-	{0x696b, 3650},
-	{0x696c, 9255},
-	{0x696d, 3640},
-	{0x696e, 3225},
-	{0x696f, 9264},
-	{0x6970, 8599},
-	{0x6971, 9243},
-	{0x6974, 9269},
-	{0x6975, 3645},
-	{0x6976, 9266},
-	{0x6977, 3642},
-	{0x6978, 9260},
-	{0x6979, 3653},
-	{0x697a, 9251},
-	{0x697b, 9280},
-	{0x6982, 3647},
-	{0x6983, 9391},
-	{0x6986, 3654},
-	{0x698d, 9929},
-	{0x698e, 9927},
-	{0x6990, 9949},
-	{0x6991, 9925},
-	{0x6993, 9943},
-	{0x6994, 3639},
-	{0x6995, 4080},
-	{0x6996, 9921},
-	{0x6997, 9948},
-	{0x6999, 9926},
-	{0x699a, 9940},
-	{0x699b, 4085},
-	{0x699c, 4078},
-	{0x699e, 9946},
-	{0x69a0, 9919},
-	{0x69a1, 9945},
-	{0x69a3, 4096},
-	{0x69a4, 9936},
-	{0x69a5, 9952},
-	{0x69a6, 4094},
-	{0x69a7, 9928},
-	{0x69a8, 4079},
-	{0x69a9, 9930},
-	{0x69aa, 9944},
-	{0x69ab, 4088},
-	{0x69ac, 9923},
-	{0x69ad, 4092},
-	{0x69ae, 4082},
-	{0x69af, 9932},
-	{0x69b0, 9922},
-	{0x69b1, 9916},
-	{0x69b3, 9942},
-	{0x69b4, 4089},
-	{0x69b5, 9951},
-	{0x69b6, 9917},
-	{0x69b7, 4086},
-	{0x69b9, 9938},
-	{0x69bb, 4087},
-	{0x69bc, 9924},
-	{0x69bd, 9935},
-	{0x69be, 9931},
-	{0x69bf, 9933},
-	{0x69c1, 4081},
-	{0x69c2, 9950},
-	{0x69c3, 4095},
-	{0x69c4, 9934},
-	{0x69c6, 9953},
-	{0x69c9, 9918},
-	{0x69ca, 9939},
-	{0x69cb, 4084},
-	{0x69cc, 4093},
-	{0x69cd, 4091},
-	{0x69ce, 9920},
-	{0x69cf, 9941},
-	{0x69d0, 4090},
-	{0x69d3, 4083},
-	{0x69d4, 9937},
-	{0x69d9, 9947},
-	{0x69e8, 4471},
-	{0x69ed, 4482},
-	{0x69f3, 4479},
-	{0x69fd, 4475},
-	{0x6a01, 4472},
-	{0x6a02, 4480},
-	{0x6a05, 4481},
-	{0x6a0a, 4478},
-	{0x6a11, 4483},
-	{0x6a13, 4477},
-	{0x6a19, 4474},
-	{0x6a1e, 4473},
-	{0x6a1f, 4470},
-	{0x6a21, 4476},
-	{0x6a23, 4469},
-	{0x6a35, 4825},
-	{0x6a38, 4814},
-	{0x6a39, 4819},
-	{0x6a3a, 4815},
-	{0x6a3d, 4813},
-	{0x6a44, 4820},
-	{0x6a47, 4824},
-	{0x6a48, 4827},
-	{0x6a4b, 4823},
-	{0x6a4e, 0},
-	{0x6a58, 4818},
-	{0x6a59, 4816},
-	{0x6a5f, 4826},
-	{0x6a61, 4822},
-	{0x6a62, 4821},
-	{0x6a6b, 4817},
-	{0x6a7e, 5100},
-	{0x6a80, 5093},
-	{0x6a84, 5095},
-	{0x6a90, 5102},
-	{0x6a94, 5094},
-	{0x6a97, 5101},
-	{0x6a9c, 5097},
-	{0x6aa0, 5103},
-	{0x6aa2, 5096},
-	{0x6aa3, 5099},
-	{0x6aac, 5341},
-	{0x6aae, 5346},
-	{0x6aaf, 5347},
-	{0x6ab3, 5340},
-	{0x6ab7, 0},
-	{0x6ab8, 5344},
-	{0x6abb, 5343},
-	{0x6ac2, 5345},
-	{0x6ac3, 5342},
-	{0x6ad3, 5513},
-	{0x6ada, 5512},
-	{0x6adb, 5098},
-	{0x6add, 5511},
-	{0x6ae5, 5510},
-	{0x6aec, 5659},
-	{0x6aef, 0},
-	{0x6afa, 5752},
-	{0x6afb, 5750},
-	{0x6b04, 5751},
-	{0x6b09, 0},
-	{0x6b0a, 5830},
-	{0x6b10, 5885},
-	{0x6b12, 0},
-	{0x6b16, 5955},
-	{0x6b19, 0},
-	{0x6b20, 734},
-	{0x6b21, 995},
-	{0x6b23, 1562},
-	{0x6b25, 6601},
-	{0x6b28, 6973},
-	{0x6b2c, 7398},
-	{0x6b2d, 7400},
-	{0x6b2f, 7399},
-	{0x6b31, 7401},
-	{0x6b32, 2791},
-	{0x6b33, 7996},
-	{0x6b34, 7402},
-	{0x6b36, 7995},
-	{0x6b37, 7997},
-	{0x6b38, 7998},
-	{0x6b39, 8626},
-	{0x6b3a, 3228},
-	{0x6b3b, 8627},
-	{0x6b3c, 8629},
-	{0x6b3d, 3229},
-	{0x6b3e, 3227},
-	{0x6b3f, 8628},
-	{0x6b41, 9287},
-	{0x6b42, 9285},
-	{0x6b43, 9284},
-	{0x6b45, 9283},
-	{0x6b46, 9282},
-	{0x6b47, 3658},
-	{0x6b48, 9286},
-	{0x6b49, 4097},
-	{0x6b4a, 9954},
-	{0x6b4b, 9956},
-	{0x6b4c, 4098},
-	{0x6b4d, 9955},
-	{0x6b4e, 4485},
-	{0x6b50, 4484},
-	{0x6b59, 4828},
-	{0x6b5c, 5104},
-	{0x6b5f, 5348},
-	{0x6b61, 5831},
-	{0x6b62, 735},
-	{0x6b63, 845},
-	{0x6b64, 996},
-	{0x6b65, 1225},
-	{0x6b66, 1563},
-	{0x6b67, 1564},
-	{0x6b6a, 1897},
-	{0x6b6d, 7403},
-	{0x6b72, 3659},
-	{0x6b77, 4829},
-	{0x6b78, 5349},
-	{0x6b79, 736},
-	{0x6b7b, 997},
-	{0x6b7e, 6603},
-	{0x6b7f, 1565},
-	{0x6b80, 6602},
-	{0x6b82, 6974},
-	{0x6b83, 1898},
-	{0x6b84, 6975},
-	{0x6b86, 1899},
-	{0x6b88, 7405},
-	{0x6b89, 2304},
-	{0x6b8a, 2303},
-	{0x6b8c, 8003},
-	{0x6b8d, 8001},
-	{0x6b8e, 8002},
-	{0x6b8f, 8000},
-	{0x6b91, 7999},
-	{0x6b94, 8630},
-	{0x6b95, 8633},
-	{0x6b96, 3231},
-	{0x6b97, 8631},
-	{0x6b98, 3230},
-	{0x6b99, 8632},
-	{0x6b9b, 9288},
-	{0x6b9e, 9957},
-	{0x6b9f, 9958},
-	{0x6ba0, 9959},
-	{0x6ba4, 4486},
-	{0x6bab, 0},
-	{0x6bae, 5105},
-	{0x6baf, 5350},
-	{0x6bb2, 5753},
-	{0x6bb3, 6026},
-	{0x6bb5, 1900},
-	{0x6bb6, 6976},
-	{0x6bb7, 2305},
-	{0x6bba, 2792},
-	{0x6bbc, 3232},
-	{0x6bbd, 8634},
-	{0x6bbf, 3661},
-	{0x6bc0, 3660},
-	{0x6bc3, 9960},
-	{0x6bc4, 9961},
-	{0x6bc5, 4487},
-	{0x6bc6, 4488},
-	{0x6bcb, 737},
-	{0x6bcc, 6027},
-	{0x6bcd, 846},
-	{0x6bcf, 1226},
-	{0x6bd0, 6317},
-	{0x6bd2, 1901},
-	{0x6bd3, 3662},
-	{0x6bd4, 738},
-	{0x6bd6, 6977},
-	{0x6bd7, 1902},
-	{0x6bd8, 6978},
-	{0x6bda, 5106},
-	{0x6bdb, 739},
-	{0x6bde, 6604},
-	{0x6be0, 6979},
-	{0x6be2, 7410},
-	{0x6be3, 7409},
-	{0x6be4, 7407},
-	{0x6be6, 7406},
-	{0x6be7, 7411},
-	{0x6be8, 7408},
-	{0x6beb, 2793},
-	{0x6bec, 2794},
-	{0x6bef, 3233},
-	{0x6bf0, 8635},
-	{0x6bf2, 8636},
-	{0x6bf3, 8637},
-	{0x6bf7, 9292},
-	{0x6bf8, 9293},
-	{0x6bf9, 9291},
-	{0x6bfb, 9289},
-	{0x6bfc, 9290},
-	{0x6bfd, 3663},
-	{0x6bfe, 9962},
-	{0x6c05, 4830},
-	{0x6c08, 5107},
-	{0x6c0f, 740},
-	{0x6c10, 848},
-	{0x6c11, 847},
-	{0x6c13, 1566},
-	{0x6c14, 6028},
-	{0x6c15, 6058},
-	{0x6c16, 998},
-	{0x6c18, 6145},
-	{0x6c19, 6318},
-	{0x6c1a, 6319},
-	{0x6c1b, 1567},
-	{0x6c1d, 6605},
-	{0x6c1f, 1903},
-	{0x6c20, 6980},
-	{0x6c21, 6981},
-	{0x6c23, 2306},
-	{0x6c24, 2310},
-	{0x6c25, 7412},
-	{0x6c26, 2309},
-	{0x6c27, 2307},
-	{0x6c28, 2308},
-	{0x6c2a, 8004},
-	{0x6c2b, 2795},
-	{0x6c2c, 3236},
-	{0x6c2e, 3234},
-	{0x6c2f, 3235},
-	{0x6c30, 8638},
-	{0x6c33, 4099},
-	{0x6c34, 741},
-	{0x6c36, 6059},
-	{0x6c38, 849},
-	{0x6c3b, 6062},
-	{0x6c3e, 852},
-	{0x6c3f, 6061},
-	{0x6c40, 851},
-	{0x6c41, 850},
-	{0x6c42, 1227},
-	{0x6c43, 6060},
-	{0x6c46, 6146},
-	{0x6c4a, 6150},
-	{0x6c4b, 6152},
-	{0x6c4c, 6153},
-	{0x6c4d, 1008},
-	{0x6c4e, 1009},
-	{0x6c4f, 6149},
-	{0x6c50, 1004},
-	{0x6c52, 6147},
-	{0x6c54, 6151},
-	{0x6c55, 1005},
-	{0x6c57, 1000},
-	{0x6c59, 1001},
-	{0x6c5b, 1007},
-	{0x6c5c, 6148},
-	{0x6c5d, 999},
-	{0x6c5e, 1228},
-	{0x6c5f, 1002},
-	{0x6c60, 1003},
-	{0x6c61, 1006},
-	{0x6c65, 6336},
-	{0x6c66, 6334},
-	{0x6c67, 6321},
-	{0x6c68, 1240},
-	{0x6c69, 6328},
-	{0x6c6a, 1235},
-	{0x6c6b, 6322},
-	{0x6c6d, 6330},
-	{0x6c6f, 6327},
-	{0x6c70, 1238},
-	{0x6c71, 6326},
-	{0x6c72, 1245},
-	{0x6c73, 6335},
-	{0x6c74, 1247},
-	{0x6c76, 1249},
-	{0x6c78, 6320},
-	{0x6c7a, 1236},
-	{0x6c7b, 6337},
-	{0x6c7d, 1243},
-	{0x6c7e, 1246},
-	{0x6c80, 6628},
-	{0x6c81, 1230},
-	{0x6c82, 1253},
-	{0x6c83, 1244},
-	{0x6c84, 6323},
-	{0x6c85, 1233},
-	{0x6c86, 1248},
-	{0x6c87, 6331},
-	{0x6c88, 1231},
-	{0x6c89, 1232},
-	{0x6c8a, 6626},
-	{0x6c8b, 6324},
-	{0x6c8c, 1239},
-	{0x6c8d, 1250},
-	{0x6c8e, 6338},
-	{0x6c8f, 6325},
-	{0x6c90, 1237},
-	{0x6c92, 1242},
-	{0x6c93, 6606},
-	{0x6c94, 1251},
-	{0x6c95, 6332},
-	{0x6c96, 1241},
-	{0x6c98, 1252},
-	{0x6c99, 1229},
-	{0x6c9a, 6329},
-	{0x6c9b, 1234},
-	{0x6c9c, 6333},
-	{0x6c9d, 6627},
-	{0x6cab, 1579},
-	{0x6cac, 1595},
-	{0x6cad, 6613},
-	{0x6cae, 1586},
-	{0x6cb0, 6634},
-	{0x6cb1, 1571},
-	{0x6cb3, 1574},
-	{0x6cb4, 6625},
-	{0x6cb6, 6611},
-	{0x6cb7, 6615},
-	{0x6cb8, 1582},
-	{0x6cb9, 1584},
-	{0x6cba, 6618},
-	{0x6cbb, 1591},
-	{0x6cbc, 1577},
-	{0x6cbd, 1575},
-	{0x6cbe, 1576},
-	{0x6cbf, 1590},
-	{0x6cc0, 6630},
-	{0x6cc1, 1585},
-	{0x6cc2, 6617},
-	{0x6cc3, 6619},
-	{0x6cc4, 1583},
-	{0x6cc5, 1588},
-	{0x6cc6, 6620},
-	{0x6cc7, 6633},
-	{0x6cc9, 1904},
-	{0x6cca, 1594},
-	{0x6ccc, 1572},
-	{0x6ccd, 6632},
-	{0x6ccf, 6636},
-	{0x6cd0, 6616},
-	{0x6cd1, 6638},
-	{0x6cd2, 6623},
-	{0x6cd3, 1581},
-	{0x6cd4, 6612},
-	{0x6cd5, 1580},
-	{0x6cd6, 1598},
-	{0x6cd7, 1587},
-	{0x6cd9, 6610},
-	{0x6cda, 6990},
-	{0x6cdb, 1593},
-	{0x6cdc, 1597},
-	{0x6cdd, 6624},
-	{0x6cde, 6629},
-	{0x6ce0, 1599},
-	{0x6ce1, 1592},
-	{0x6ce2, 1578},
-	{0x6ce3, 1568},
-	{0x6ce5, 1573},
-	{0x6ce7, 6614},
-	{0x6ce8, 1569},
-	{0x6ce9, 6637},
-	{0x6ceb, 6608},
-	{0x6cec, 6607},
-	{0x6ced, 6621},
-	{0x6cee, 6609},
-	{0x6cef, 1596},
-	{0x6cf0, 2311},
-	{0x6cf1, 1589},
-	{0x6cf2, 6622},
-	{0x6cf3, 1570},
-	{0x6cf5, 1919},
-	{0x6cf9, 6635},
-	{0x6d00, 6997},
-	{0x6d01, 7000},
-	{0x6d03, 7003},
-	{0x6d04, 6992},
-	{0x6d07, 7006},
-	{0x6d08, 7009},
-	{0x6d09, 7011},
-	{0x6d0a, 6989},
-	{0x6d0b, 1905},
-	{0x6d0c, 1910},
-	{0x6d0d, 7417},
-	{0x6d0e, 1926},
-	{0x6d0f, 7004},
-	{0x6d10, 7012},
-	{0x6d11, 6996},
-	{0x6d12, 6988},
-	{0x6d16, 7444},
-	{0x6d17, 1913},
-	{0x6d18, 7001},
-	{0x6d19, 6993},
-	{0x6d1a, 6995},
-	{0x6d1b, 1918},
-	{0x6d1d, 6998},
-	{0x6d1e, 1912},
-	{0x6d1f, 6985},
-	{0x6d20, 7007},
-	{0x6d22, 7010},
-	{0x6d25, 1909},
-	{0x6d27, 1921},
-	{0x6d28, 6982},
-	{0x6d29, 1923},
-	{0x6d2a, 1907},
-	{0x6d2b, 1927},
-	{0x6d2c, 7008},
-	{0x6d2d, 6984},
-	{0x6d2e, 1924},
-	{0x6d2f, 7438},
-	{0x6d30, 6631},
-	{0x6d31, 1911},
-	{0x6d32, 1906},
-	{0x6d33, 6991},
-	{0x6d34, 6983},
-	{0x6d35, 1925},
-	{0x6d36, 1917},
-	{0x6d37, 7002},
-	{0x6d38, 1922},
-	{0x6d39, 1920},
-	{0x6d3a, 6994},
-	{0x6d3b, 1914},
-	{0x6d3c, 6986},
-	{0x6d3d, 1915},
-	{0x6d3e, 1916},
-	{0x6d3f, 6987},
-	{0x6d40, 7005},
-	{0x6d41, 1908},
-	{0x6d42, 6999},
-	{0x6d58, 7420},
-	{0x6d59, 2319},
-	{0x6d5a, 2324},
-	{0x6d5e, 7429},
-	{0x6d5f, 7435},
-	{0x6d60, 7431},
-	{0x6d61, 7418},
-	{0x6d62, 7421},
-	{0x6d63, 7414},
-	{0x6d64, 7415},
-	{0x6d65, 2331},
-	{0x6d66, 2316},
-	{0x6d67, 7430},
-	{0x6d68, 7439},
-	{0x6d69, 2326},
-	{0x6d6a, 2312},
-	{0x6d6c, 2321},
-	{0x6d6d, 7422},
-	{0x6d6e, 2323},
-	{0x6d6f, 7423},
-	{0x6d70, 7433},
-	{0x6d74, 2325},
-	{0x6d75, 7448},
-	{0x6d76, 7416},
-	{0x6d77, 2318},
-	{0x6d78, 2317},
-	{0x6d79, 2329},
-	{0x6d7a, 7413},
-	{0x6d7b, 7446},
-	{0x6d7c, 7434},
-	{0x6d7d, 7447},
-	{0x6d7e, 7441},
-	{0x6d7f, 7427},
-	{0x6d80, 7442},
-	{0x6d82, 7436},
-	{0x6d83, 7445},
-	{0x6d84, 7443},
-	{0x6d85, 2330},
-	{0x6d86, 7428},
-	{0x6d87, 2315},
-	{0x6d88, 2314},
-	{0x6d89, 2322},
-	{0x6d8a, 2328},
-	{0x6d8b, 7440},
-	{0x6d8c, 2327},
-	{0x6d8d, 7425},
-	{0x6d8e, 2796},
-	{0x6d90, 7449},
-	{0x6d91, 7424},
-	{0x6d92, 7419},
-	{0x6d93, 2320},
-	{0x6d94, 2332},
-	{0x6d95, 2313},
-	{0x6d97, 7432},
-	{0x6d98, 7437},
-	{0x6daa, 2830},
-	{0x6dab, 8006},
-	{0x6dac, 8010},
-	{0x6dae, 2811},
-	{0x6daf, 2809},
-	{0x6db2, 2800},
-	{0x6db3, 8008},
-	{0x6db4, 8007},
-	{0x6db5, 2820},
-	{0x6db7, 8013},
-	{0x6db8, 2814},
-	{0x6dba, 8031},
-	{0x6dbb, 8043},
-	{0x6dbc, 2797},
-	{0x6dbd, 8028},
-	{0x6dbe, 8021},
-	{0x6dbf, 2832},
-	{0x6dc0, 8005},
-	{0x6dc2, 8033},
-	{0x6dc4, 2829},
-	{0x6dc5, 2817},
-	{0x6dc6, 2828},
-	{0x6dc7, 2807},
-	{0x6dc8, 8017},
-	{0x6dc9, 8035},
-	{0x6dca, 8027},
-	{0x6dcb, 2808},
-	{0x6dcc, 2802},
-	{0x6dcd, 8041},
-	{0x6dcf, 8034},
-	{0x6dd0, 8036},
-	{0x6dd1, 2810},
-	{0x6dd2, 2818},
-	{0x6dd3, 8038},
-	{0x6dd4, 8015},
-	{0x6dd5, 8032},
-	{0x6dd6, 8020},
-	{0x6dd7, 8040},
-	{0x6dd8, 2823},
-	{0x6dd9, 2799},
-	{0x6dda, 2821},
-	{0x6ddb, 8025},
-	{0x6ddc, 8023},
-	{0x6ddd, 8024},
-	{0x6dde, 2812},
-	{0x6ddf, 8019},
-	{0x6de0, 8018},
-	{0x6de1, 2801},
-	{0x6de2, 8012},
-	{0x6de3, 8042},
-	{0x6de4, 2803},
-	{0x6de5, 8022},
-	{0x6de6, 2833},
-	{0x6de8, 2827},
-	{0x6de9, 8011},
-	{0x6dea, 2824},
-	{0x6deb, 2822},
-	{0x6dec, 2831},
-	{0x6ded, 8029},
-	{0x6dee, 2826},
-	{0x6def, 7426},
-	{0x6df0, 8030},
-	{0x6df1, 2825},
-	{0x6df2, 8037},
-	{0x6df3, 2798},
-	{0x6df4, 8026},
-	{0x6df5, 2816},
-	{0x6df6, 8014},
-	{0x6df7, 2815},
-	{0x6df9, 2813},
-	{0x6dfa, 2805},
-	{0x6dfb, 2804},
-	{0x6dfc, 8639},
-	{0x6dfd, 8039},
-	{0x6e00, 8016},
-	{0x6e03, 8660},
-	{0x6e05, 2806},
-	{0x6e19, 3265},
-	{0x6e1a, 2819},
-	{0x6e1b, 3247},
-	{0x6e1c, 8654},
-	{0x6e1d, 3261},
-	{0x6e1f, 8642},
-	{0x6e20, 3244},
-	{0x6e21, 3240},
-	{0x6e22, 8672},
-	{0x6e23, 3246},
-	{0x6e24, 3250},
-	{0x6e25, 3245},
-	{0x6e26, 3254},
-	{0x6e27, 8676},
-	{0x6e28, 8667},
-	{0x6e2b, 8649},
-	{0x6e2c, 3259},
-	{0x6e2d, 3253},
-	{0x6e2e, 8661},
-	{0x6e2f, 3237},
-	{0x6e30, 8673},
-	{0x6e31, 8666},
-	{0x6e32, 3241},
-	{0x6e33, 8655},
-	{0x6e34, 3256},
-	{0x6e35, 8684},
-	{0x6e36, 8685},
-	{0x6e38, 3238},
-	{0x6e39, 8671},
-	{0x6e3a, 3258},
-	{0x6e3b, 8659},
-	{0x6e3c, 8645},
-	{0x6e3d, 8646},
-	{0x6e3e, 3262},
-	{0x6e3f, 8650},
-	{0x6e40, 8657},
-	{0x6e41, 8651},
-	{0x6e43, 3260},
-	{0x6e44, 3268},
-	{0x6e45, 8647},
-	{0x6e46, 8640},
-	{0x6e47, 8641},
-	{0x6e49, 8643},
-	{0x6e4a, 3243},
-	{0x6e4b, 8656},
-	{0x6e4d, 3257},
-	{0x6e4e, 3266},
-	{0x6e51, 8658},
-	{0x6e52, 8682},
-	{0x6e53, 8674},
-	{0x6e54, 3239},
-	{0x6e55, 8680},
-	{0x6e56, 3251},
-	{0x6e58, 3249},
-	{0x6e5a, 8686},
-	{0x6e5b, 3248},
-	{0x6e5c, 8664},
-	{0x6e5d, 8652},
-	{0x6e5e, 8662},
-	{0x6e5f, 3271},
-	{0x6e60, 8668},
-	{0x6e61, 8665},
-	{0x6e62, 8648},
-	{0x6e63, 3267},
-	{0x6e64, 8678},
-	{0x6e65, 8675},
-	{0x6e66, 8683},
-	{0x6e67, 3242},
-	{0x6e68, 8663},
-	{0x6e69, 3270},
-	{0x6e6b, 8670},
-	{0x6e6e, 3252},
-	{0x6e6f, 3255},
-	{0x6e71, 8669},
-	{0x6e72, 3269},
-	{0x6e73, 8653},
-	{0x6e74, 8009},
-	{0x6e77, 8679},
-	{0x6e78, 8677},
-	{0x6e79, 8681},
-	{0x6e88, 8644},
-	{0x6e89, 3264},
-	{0x6e8d, 9324},
-	{0x6e8e, 9323},
-	{0x6e8f, 9297},
-	{0x6e90, 3669},
-	{0x6e92, 9322},
-	{0x6e93, 9300},
-	{0x6e94, 9301},
-	{0x6e96, 3679},
-	{0x6e97, 9331},
-	{0x6e98, 3674},
-	{0x6e99, 9321},
-	{0x6e9b, 9294},
-	{0x6e9c, 3680},
-	{0x6e9d, 3670},
-	{0x6e9e, 9309},
-	{0x6e9f, 9299},
-	{0x6ea0, 9302},
-	{0x6ea1, 9326},
-	{0x6ea2, 3664},
-	{0x6ea3, 9333},
-	{0x6ea4, 9325},
-	{0x6ea5, 3673},
-	{0x6ea6, 9314},
-	{0x6ea7, 3684},
-	{0x6eaa, 3683},
-	{0x6eab, 3677},
-	{0x6eae, 9332},
-	{0x6eaf, 3665},
-	{0x6eb0, 9312},
-	{0x6eb1, 9303},
-	{0x6eb2, 9316},
-	{0x6eb3, 9328},
-	{0x6eb4, 3685},
-	{0x6eb6, 3667},
-	{0x6eb7, 9311},
-	{0x6eb9, 9304},
-	{0x6eba, 3676},
-	{0x6ebc, 3675},
-	{0x6ebd, 9307},
-	{0x6ebe, 9317},
-	{0x6ebf, 9327},
-	{0x6ec0, 9298},
-	{0x6ec1, 9308},
-	{0x6ec2, 3668},
-	{0x6ec3, 9318},
-	{0x6ec4, 3681},
-	{0x6ec5, 3672},
-	{0x6ec6, 9305},
-	{0x6ec7, 3671},
-	{0x6ec8, 9296},
-	{0x6ec9, 9310},
-	{0x6eca, 9330},
-	{0x6ecb, 3263},
-	{0x6ecc, 4127},
-	{0x6ecd, 9313},
-	{0x6ece, 9963},
-	{0x6ecf, 9315},
-	{0x6ed0, 9329},
-	{0x6ed1, 3678},
-	{0x6ed2, 9306},
-	{0x6ed3, 3666},
-	{0x6ed4, 3682},
-	{0x6ed5, 4506},
-	{0x6ed6, 9295},
-	{0x6ed8, 9320},
-	{0x6edc, 9319},
-	{0x6ee9, 0},
-	{0x6eeb, 9991},
-	{0x6eec, 4124},
-	{0x6eed, 9980},
-	{0x6eee, 9985},
-	{0x6eef, 4113},
-	{0x6ef1, 9965},
-	{0x6ef2, 4126},
-	{0x6ef4, 4104},
-	{0x6ef5, 9964},
-	{0x6ef6, 9997},
-	{0x6ef7, 4128},
-	{0x6ef8, 9968},
-	{0x6ef9, 9984},
-	{0x6efb, 9970},
-	{0x6efd, 9996},
-	{0x6efe, 4102},
-	{0x6eff, 4112},
-	{0x6f01, 4125},
-	{0x6f02, 4110},
-	{0x6f03, 9966},
-	{0x6f05, 9995},
-	{0x6f06, 4114},
-	{0x6f07, 9992},
-	{0x6f09, 9972},
-	{0x6f0a, 9981},
-	{0x6f0e, 9993},
-	{0x6f0f, 4109},
-	{0x6f12, 9979},
-	{0x6f13, 4103},
-	{0x6f14, 4101},
-	{0x6f15, 4119},
-	{0x6f18, 9977},
-	{0x6f19, 9974},
-	{0x6f1a, 9975},
-	{0x6f1c, 9999},
-	{0x6f20, 4107},
-	{0x6f22, 4111},
-	{0x6f23, 4118},
-	{0x6f25, 9967},
-	{0x6f27, 9976},
-	{0x6f29, 4105},
-	{0x6f2a, 4123},
-	{0x6f2b, 4120},
-	{0x6f2c, 4108},
-	{0x6f2d, 9986},
-	{0x6f2e, 9971},
-	{0x6f2f, 4121},
-	{0x6f30, 9988},
-	{0x6f31, 4115},
-	{0x6f32, 4117},
-	{0x6f33, 4100},
-	{0x6f35, 9990},
-	{0x6f36, 9982},
-	{0x6f37, 9969},
-	{0x6f38, 4116},
-	{0x6f39, 9998},
-	{0x6f3b, 9978},
-	{0x6f3c, 9989},
-	{0x6f3e, 4106},
-	{0x6f3f, 4489},
-	{0x6f40, 9987},
-	{0x6f43, 9994},
-	{0x6f4e, 9973},
-	{0x6f51, 4492},
-	{0x6f54, 4494},
-	{0x6f58, 4505},
-	{0x6f5b, 4497},
-	{0x6f5f, 4509},
-	{0x6f60, 4508},
-	{0x6f64, 4503},
-	{0x6f66, 4493},
-	{0x6f6d, 4496},
-	{0x6f6e, 4499},
-	{0x6f6f, 4507},
-	{0x6f70, 4502},
-	{0x6f73, 9983},
-	{0x6f78, 4498},
-	{0x6f7a, 4501},
-	{0x6f7c, 4490},
-	{0x6f80, 5116},
-	{0x6f84, 4491},
-	{0x6f86, 4495},
-	{0x6f88, 4122},
-	{0x6f8e, 4500},
-	{0x6f97, 4504},
-	{0x6fa0, 4843},
-	{0x6fa1, 4833},
-	{0x6fa4, 4835},
-	{0x6fa6, 4842},
-	{0x6fa7, 4837},
-	{0x6fb1, 4832},
-	{0x6fb3, 4838},
-	{0x6fb4, 4844},
-	{0x6fb6, 4841},
-	{0x6fb9, 4840},
-	{0x6fc0, 4839},
-	{0x6fc1, 4836},
-	{0x6fc2, 4831},
-	{0x6fc3, 4834},
-	{0x6fd5, 5120},
-	{0x6fd8, 5108},
-	{0x6fdb, 5112},
-	{0x6fdf, 5110},
-	{0x6fe0, 5111},
-	{0x6fe1, 5118},
-	{0x6fe4, 5113},
-	{0x6fe9, 5119},
-	{0x6feb, 5114},
-	{0x6fec, 5117},
-	{0x6fee, 5121},
-	{0x6fef, 5115},
-	{0x6ff0, 5122},
-	{0x6ff1, 5109},
-	{0x6ffa, 5355},
-	{0x6ffe, 5353},
-	{0x7006, 5354},
-	{0x7009, 5351},
-	{0x700b, 5352},
-	{0x700d, 0},
-	{0x700f, 5357},
-	{0x7011, 5356},
-	{0x7015, 5519},
-	{0x7018, 5520},
-	{0x701a, 5517},
-	{0x701b, 5514},
-	{0x701d, 5518},
-	{0x701f, 5515},
-	{0x7022, 0},
-	{0x7023, 1},
-	{0x7028, 5516},
-	{0x7030, 5661},
-	{0x7032, 5662},
-	{0x703e, 5660},
-	{0x7044, 0},
-	{0x7046, 0},
-	{0x7049, 0},
-	{0x704c, 5754},
-	{0x7051, 5832},
-	{0x7056, 0},
-	{0x7057, 1},
-	{0x7058, 5833},
-	{0x705e, 5922},
-	{0x7063, 5956},
-	{0x7064, 5970},
-	{0x706a, 0},
-	{0x706b, 742},
-	{0x7070, 1010},
-	{0x7071, 6154},
-	{0x7074, 6339},
-	{0x7076, 1254},
-	{0x7078, 1257},
-	{0x707a, 6340},
-	{0x707c, 1255},
-	{0x707d, 1256},
-	{0x7082, 6647},
-	{0x7083, 6649},
-	{0x7084, 6644},
-	{0x7085, 6641},
-	{0x7086, 6643},
-	{0x708a, 1603},
-	{0x708e, 1601},
-	{0x7091, 6645},
-	{0x7092, 1602},
-	{0x7093, 6642},
-	{0x7094, 6639},
-	{0x7095, 1600},
-	{0x7096, 6646},
-	{0x7098, 6640},
-	{0x7099, 1604},
-	{0x709a, 6648},
-	{0x709f, 7014},
-	{0x70a1, 7018},
-	{0x70a4, 1936},
-	{0x70a9, 7021},
-	{0x70ab, 1928},
-	{0x70ac, 1931},
-	{0x70ad, 1933},
-	{0x70ae, 1935},
-	{0x70af, 1932},
-	{0x70b0, 7017},
-	{0x70b1, 7016},
-	{0x70b3, 1930},
-	{0x70b4, 7019},
-	{0x70b5, 7020},
-	{0x70b7, 7013},
-	{0x70b8, 1934},
-	{0x70ba, 1929},
-	{0x70be, 7015},
-	{0x70c5, 7463},
-	{0x70c6, 7464},
-	{0x70c7, 7465},
-	{0x70c8, 2337},
-	{0x70ca, 2333},
-	{0x70cb, 7454},
-	{0x70cd, 7462},
-	{0x70ce, 7467},
-	{0x70cf, 2338},
-	{0x70d1, 7452},
-	{0x70d2, 7458},
-	{0x70d3, 7451},
-	{0x70d4, 7461},
-	{0x70d6, 0},
-	{0x70d7, 7457},
-	{0x70d8, 2334},
-	{0x70d9, 2336},
-	{0x70da, 7466},
-	{0x70dc, 7450},
-	{0x70dd, 7453},
-	{0x70de, 7459},
-	{0x70e0, 7460},
-	{0x70e1, 7468},
-	{0x70e2, 7456},
-	{0x70e4, 2335},
-	{0x70ef, 2838},
-	{0x70f0, 8050},
-	{0x70f3, 8052},
-	{0x70f4, 8048},
-	{0x70f6, 8060},
-	{0x70f7, 8046},
-	{0x70f8, 8059},
-	{0x70f9, 2834},
-	{0x70fa, 8044},
-	{0x70fb, 8690},
-	{0x70fc, 8054},
-	{0x70fd, 2837},
-	{0x70ff, 8055},
-	{0x7100, 8058},
-	{0x7102, 8062},
-	{0x7104, 8051},
-	{0x7106, 8056},
-	{0x7109, 2835},
-	{0x710a, 2836},
-	{0x710b, 8061},
-	{0x710c, 8049},
-	{0x710d, 8045},
-	{0x710e, 8063},
-	{0x7110, 8053},
-	{0x7113, 8057},
-	{0x7117, 8047},
-	{0x7119, 3272},
-	{0x711a, 3273},
-	{0x711b, 8700},
-	{0x711c, 3279},
-	{0x711e, 8688},
-	{0x711f, 8697},
-	{0x7120, 8687},
-	{0x7121, 3276},
-	{0x7122, 8695},
-	{0x7123, 8693},
-	{0x7125, 8694},
-	{0x7126, 3274},
-	{0x7128, 8698},
-	{0x712e, 8691},
-	{0x712f, 8689},
-	{0x7130, 3275},
-	{0x7131, 8692},
-	{0x7132, 8696},
-	{0x7136, 3277},
-	{0x713a, 8699},
-	{0x7141, 9339},
-	{0x7142, 9346},
-	{0x7143, 9348},
-	{0x7144, 9354},
-	{0x7146, 3698},
-	{0x7147, 9334},
-	{0x7149, 3690},
-	{0x714b, 9349},
-	{0x714c, 3695},
-	{0x714d, 9355},
-	{0x714e, 3686},
-	{0x7150, 9352},
-	{0x7152, 9336},
-	{0x7153, 9353},
-	{0x7154, 9335},
-	{0x7156, 3700},
-	{0x7158, 9347},
-	{0x7159, 3687},
-	{0x715a, 9356},
-	{0x715c, 3692},
-	{0x715d, 9340},
-	{0x715e, 3697},
-	{0x715f, 9351},
-	{0x7160, 9338},
-	{0x7161, 9345},
-	{0x7162, 9341},
-	{0x7163, 9337},
-	{0x7164, 3689},
-	{0x7165, 3696},
-	{0x7166, 3694},
-	{0x7167, 3691},
-	{0x7168, 3699},
-	{0x7169, 3688},
-	{0x716a, 9344},
-	{0x716c, 3693},
-	{0x716e, 3278},
-	{0x7170, 9350},
-	{0x7172, 9342},
-	{0x7178, 9343},
-	{0x717d, 4131},
-	{0x7184, 4133},
-	{0x718a, 4132},
-	{0x7192, 4134},
-	{0x7194, 4129},
-	{0x7199, 4130},
-	{0x719f, 4510},
-	{0x71a8, 4513},
-	{0x71ac, 4511},
-	{0x71b1, 4512},
-	{0x71b9, 4851},
-	{0x71be, 4845},
-	{0x71c1, 0},
-	{0x71c3, 4855},
-	{0x71c4, 4856},
-	{0x71c8, 4849},
-	{0x71c9, 4846},
-	{0x71ce, 4852},
-	{0x71d0, 4847},
-	{0x71d2, 4848},
-	{0x71d5, 4850},
-	{0x71d9, 4853},
-	{0x71db, 0},
-	{0x71dc, 4854},
-	{0x71df, 5124},
-	{0x71e0, 5131},
-	{0x71e5, 5127},
-	{0x71e6, 5126},
-	{0x71e7, 5123},
-	{0x71ec, 5129},
-	{0x71ed, 5128},
-	{0x71ee, 5125},
-	{0x71f4, 5130},
-	{0x71f8, 5361},
-	{0x71fb, 5358},
-	{0x71fc, 5359},
-	{0x71fe, 5360},
-	{0x7206, 5521},
-	{0x720d, 5522},
-	{0x7210, 5663},
-	{0x7214, 0},
-	{0x721b, 5755},
-	{0x721f, 0},
-	{0x7228, 5990},
-	{0x722a, 743},
-	{0x722c, 1605},
-	{0x722d, 1606},
-	{0x7230, 1937},
-	{0x7235, 5132},
-	{0x7236, 744},
-	{0x7238, 1607},
-	{0x7239, 2339},
-	{0x723a, 3701},
-	{0x723b, 745},
-	{0x723d, 2839},
-	{0x723e, 4135},
-	{0x723f, 6029},
-	{0x7241, 7022},
-	{0x7242, 7469},
-	{0x7246, 5133},
-	{0x7247, 746},
-	{0x7248, 1608},
-	{0x7249, 7023},
-	{0x724a, 7024},
-	{0x724b, 8701},
-	{0x724c, 3280},
-	{0x724f, 9357},
-	{0x7252, 3702},
-	{0x7256, 4514},
-	{0x7258, 5523},
-	{0x7259, 747},
-	{0x725a, 8702},
-	{0x725b, 748},
-	{0x725d, 1012},
-	{0x725e, 6155},
-	{0x725f, 1011},
-	{0x7260, 1260},
-	{0x7261, 1259},
-	{0x7262, 1258},
-	{0x7263, 6341},
-	{0x7267, 1609},
-	{0x7269, 1610},
-	{0x726a, 6650},
-	{0x726c, 7025},
-	{0x726e, 7028},
-	{0x726f, 1939},
-	{0x7270, 7026},
-	{0x7272, 1938},
-	{0x7273, 7027},
-	{0x7274, 1940},
-	{0x7276, 7472},
-	{0x7277, 7471},
-	{0x7278, 7470},
-	{0x7279, 2340},
-	{0x727b, 8065},
-	{0x727c, 8066},
-	{0x727d, 2840},
-	{0x727e, 8064},
-	{0x727f, 8067},
-	{0x7280, 3282},
-	{0x7281, 2841},
-	{0x7284, 3281},
-	{0x7285, 8706},
-	{0x7286, 8705},
-	{0x7288, 8703},
-	{0x7289, 8704},
-	{0x728b, 8707},
-	{0x728c, 9359},
-	{0x728d, 9358},
-	{0x728e, 9362},
-	{0x7290, 9361},
-	{0x7291, 9360},
-	{0x7292, 4136},
-	{0x7296, 4137},
-	{0x729b, 4515},
-	{0x729e, 0},
-	{0x72a2, 5524},
-	{0x72a6, 0},
-	{0x72a7, 5756},
-	{0x72ac, 749},
-	{0x72ae, 6063},
-	{0x72af, 853},
-	{0x72b0, 6064},
-	{0x72b4, 6156},
-	{0x72b5, 6157},
-	{0x72ba, 6347},
-	{0x72bd, 6343},
-	{0x72bf, 6342},
-	{0x72c0, 1611},
-	{0x72c1, 6346},
-	{0x72c2, 1262},
-	{0x72c3, 6344},
-	{0x72c4, 1261},
-	{0x72c5, 6348},
-	{0x72c6, 6345},
-	{0x72c9, 6654},
-	{0x72ca, 7029},
-	{0x72cb, 6652},
-	{0x72cc, 6659},
-	{0x72ce, 1612},
-	{0x72d0, 1615},
-	{0x72d1, 6660},
-	{0x72d2, 6656},
-	{0x72d4, 6657},
-	{0x72d6, 6651},
-	{0x72d7, 1614},
-	{0x72d8, 6653},
-	{0x72d9, 1613},
-	{0x72da, 6658},
-	{0x72dc, 6655},
-	{0x72df, 7033},
-	{0x72e0, 1942},
-	{0x72e1, 1943},
-	{0x72e3, 7036},
-	{0x72e4, 7030},
-	{0x72e6, 7035},
-	{0x72e8, 7031},
-	{0x72e9, 1941},
-	{0x72ea, 7034},
-	{0x72eb, 7032},
-	{0x72f3, 7478},
-	{0x72f4, 7475},
-	{0x72f6, 7477},
-	{0x72f7, 2345},
-	{0x72f8, 2344},
-	{0x72f9, 2342},
-	{0x72fa, 7474},
-	{0x72fb, 7479},
-	{0x72fc, 2341},
-	{0x72fd, 2343},
-	{0x72fe, 7476},
-	{0x72ff, 8075},
-	{0x7300, 7473},
-	{0x7301, 7480},
-	{0x7307, 8070},
-	{0x7308, 8074},
-	{0x730a, 8073},
-	{0x730b, 8709},
-	{0x730c, 8720},
-	{0x730f, 8076},
-	{0x7311, 8071},
-	{0x7312, 8708},
-	{0x7313, 2845},
-	{0x7316, 2844},
-	{0x7317, 8069},
-	{0x7318, 8072},
-	{0x7319, 2846},
-	{0x731b, 2843},
-	{0x731c, 2842},
-	{0x731d, 8068},
-	{0x731e, 8077},
-	{0x7322, 8711},
-	{0x7323, 8718},
-	{0x7325, 3284},
-	{0x7326, 8717},
-	{0x7327, 8714},
-	{0x7329, 3286},
-	{0x732d, 8716},
-	{0x7330, 8710},
-	{0x7331, 8712},
-	{0x7332, 8715},
-	{0x7333, 8713},
-	{0x7334, 3285},
-	{0x7335, 8719},
-	{0x7336, 3283},
-	{0x7337, 3703},
-	{0x733a, 9366},
-	{0x733b, 9365},
-	{0x733c, 9363},
-	{0x733e, 3706},
-	{0x733f, 3705},
-	{0x7340, 9367},
-	{0x7342, 9364},
-	{0x7344, 4138},
-	{0x7345, 3704},
-	{0x7349, 9369},
-	{0x734a, 9368},
-	{0x734e, 4516},
-	{0x7350, 4139},
-	{0x7357, 4517},
-	{0x735f, 0},
-	{0x7360, 1},
-	{0x7367, 0},
-	{0x7368, 4857},
-	{0x736f, 0},
-	{0x7370, 5134},
-	{0x7372, 5135},
-	{0x7375, 5363},
-	{0x7377, 5362},
-	{0x7378, 5525},
-	{0x737a, 5526},
-	{0x737b, 5664},
-	{0x7380, 5834},
-	{0x7384, 854},
-	{0x7385, 7037},
-	{0x7386, 2346},
-	{0x7387, 2847},
-	{0x7388, 8078},
-	{0x7389, 855},
-	{0x738a, 6065},
-	{0x738b, 750},
-	{0x738e, 6158},
-	{0x7392, 6353},
-	{0x7393, 6351},
-	{0x7394, 6352},
-	{0x7395, 6349},
-	{0x7396, 1263},
-	{0x7397, 6350},
-	{0x739d, 6668},
-	{0x739f, 1618},
-	{0x73a0, 6666},
-	{0x73a1, 6662},
-	{0x73a2, 6665},
-	{0x73a4, 6661},
-	{0x73a5, 1620},
-	{0x73a6, 6664},
-	{0x73a8, 1617},
-	{0x73a9, 1616},
-	{0x73ab, 1619},
-	{0x73ac, 6667},
-	{0x73ad, 6663},
-	{0x73b2, 1947},
-	{0x73b3, 1950},
-	{0x73b4, 7045},
-	{0x73b5, 7044},
-	{0x73b6, 7043},
-	{0x73b7, 1944},
-	{0x73b8, 7052},
-	{0x73b9, 7042},
-	{0x73bb, 1946},
-	{0x73bc, 7485},
-	{0x73be, 7049},
-	{0x73bf, 7047},
-	{0x73c0, 1949},
-	{0x73c2, 7039},
-	{0x73c3, 7050},
-	{0x73c5, 7041},
-	{0x73c6, 7051},
-	{0x73c7, 7048},
-	{0x73c8, 7040},
-	{0x73ca, 1945},
-	{0x73cb, 7053},
-	{0x73cc, 7038},
-	{0x73cd, 1948},
-	{0x73d2, 7490},
-	{0x73d3, 7481},
-	{0x73d4, 7492},
-	{0x73d6, 7484},
-	{0x73d7, 7495},
-	{0x73d8, 7496},
-	{0x73d9, 7482},
-	{0x73da, 7494},
-	{0x73db, 7491},
-	{0x73dc, 7489},
-	{0x73dd, 7493},
-	{0x73de, 2352},
-	{0x73e0, 2350},
-	{0x73e3, 7487},
-	{0x73e5, 7483},
-	{0x73e7, 7486},
-	{0x73e8, 7497},
-	{0x73e9, 7488},
-	{0x73ea, 2351},
-	{0x73eb, 7046},
-	{0x73ed, 2347},
-	{0x73ee, 2349},
-	{0x73f4, 8092},
-	{0x73f5, 8081},
-	{0x73f6, 8079},
-	{0x73f8, 8080},
-	{0x73fa, 8087},
-	{0x73fc, 8088},
-	{0x73fd, 8084},
-	{0x73fe, 2852},
-	{0x73ff, 8089},
-	{0x7400, 8086},
-	{0x7401, 8083},
-	{0x7403, 2850},
-	{0x7404, 8082},
-	{0x7405, 2848},
-	{0x7406, 2851},
-	{0x7407, 8085},
-	{0x7408, 8093},
-	{0x7409, 2348},
-	{0x740a, 2849},
-	{0x740b, 8091},
-	{0x740c, 8090},
-	{0x740d, 2853},
-	{0x7416, 8725},
-	{0x741a, 8726},
-	{0x741b, 3296},
-	{0x741d, 8732},
-	{0x741f, 0},
-	{0x7420, 8734},
-	{0x7421, 8727},
-	{0x7422, 3290},
-	{0x7423, 8731},
-	{0x7424, 8730},
-	{0x7425, 3291},
-	{0x7426, 3297},
-	{0x7428, 3298},
-	{0x7429, 8733},
-	{0x742a, 3288},
-	{0x742b, 8724},
-	{0x742c, 8722},
-	{0x742d, 8728},
-	{0x742e, 8721},
-	{0x742f, 3295},
-	{0x7430, 8723},
-	{0x7431, 8729},
-	{0x7432, 8735},
-	{0x7433, 3289},
-	{0x7434, 3294},
-	{0x7435, 3292},
-	{0x7436, 3293},
-	{0x743a, 3287},
-	{0x743f, 3713},
-	{0x7440, 9376},
-	{0x7441, 3712},
-	{0x7442, 9380},
-	{0x7444, 9370},
-	{0x7446, 9381},
-	{0x744a, 9371},
-	{0x744b, 9372},
-	{0x744d, 9382},
-	{0x744e, 9379},
-	{0x744f, 9377},
-	{0x7450, 9378},
-	{0x7451, 9374},
-	{0x7452, 9373},
-	{0x7454, 9383},
-	{0x7455, 3709},
-	{0x7457, 9375},
-	{0x7459, 3714},
-	{0x745a, 3708},
-	{0x745b, 3715},
-	{0x745c, 3716},
-	{0x745e, 3711},
-	{0x745f, 3710},
-	{0x7463, 4141},
-	{0x7464, 4140},
-	{0x7469, 4518},
-	{0x746a, 4142},
-	{0x746d, 4144},
-	{0x746f, 3707},
-	{0x7470, 4143},
-	{0x747e, 4521},
-	{0x7480, 4522},
-	{0x7483, 4520},
-	{0x748a, 0},
-	{0x748b, 4519},
-	{0x7498, 4860},
-	{0x749c, 4858},
-	{0x749e, 4862},
-	{0x749f, 4861},
-	{0x74a3, 4859},
-	{0x74a6, 5138},
-	{0x74a7, 5364},
-	{0x74a8, 5139},
-	{0x74a9, 5136},
-	{0x74b0, 5137},
-	{0x74bd, 5527},
-	{0x74bf, 5365},
-	{0x74ca, 5528},
-	{0x74cf, 5665},
-	{0x74d4, 5758},
-	{0x74d6, 5757},
-	{0x74da, 5886},
-	{0x74dc, 856},
-	{0x74dd, 6669},
-	{0x74de, 7498},
-	{0x74df, 7499},
-	{0x74e0, 2854},
-	{0x74e1, 9384},
-	{0x74e2, 4863},
-	{0x74e3, 5529},
-	{0x74e4, 5835},
-	{0x74e6, 857},
-	{0x74e8, 6670},
-	{0x74e9, 288},
-	{0x74ec, 7054},
-	{0x74ee, 7055},
-	{0x74f4, 7500},
-	{0x74f5, 7501},
-	{0x74f6, 2855},
-	{0x74f7, 2856},
-	{0x74fb, 8736},
-	{0x74fd, 9387},
-	{0x74fe, 9386},
-	{0x74ff, 9385},
-	{0x7503, 0},
-	{0x7504, 4145},
-	{0x750c, 4864},
-	{0x750d, 4865},
-	{0x7511, 0},
-	{0x7512, 1},
-	{0x7515, 5366},
-	{0x7518, 858},
-	{0x751a, 1951},
-	{0x751c, 2857},
-	{0x751d, 9388},
-	{0x751f, 859},
-	{0x7521, 7502},
-	{0x7522, 2858},
-	{0x7525, 3299},
-	{0x7526, 3300},
-	{0x7528, 860},
-	{0x7529, 861},
-	{0x752a, 6159},
-	{0x752b, 1265},
-	{0x752c, 1264},
-	{0x752d, 1952},
-	{0x752e, 7056},
-	{0x752f, 8737},
-	{0x7530, 862},
-	{0x7531, 863},
-	{0x7532, 864},
-	{0x7533, 865},
-	{0x7537, 1266},
-	{0x7538, 1267},
-	{0x7539, 6355},
-	{0x753a, 6354},
-	{0x753d, 1621},
-	{0x753e, 6673},
-	{0x753f, 6671},
-	{0x7540, 6672},
-	{0x7547, 7057},
-	{0x7548, 7058},
-	{0x754b, 1956},
-	{0x754c, 1954},
-	{0x754e, 1955},
-	{0x754f, 1953},
-	{0x7554, 2353},
-	{0x7559, 2357},
-	{0x755a, 2356},
-	{0x755b, 7503},
-	{0x755c, 2355},
-	{0x755d, 2354},
-	{0x755f, 7504},
-	{0x7562, 2861},
-	{0x7563, 8095},
-	{0x7564, 8094},
-	{0x7565, 2859},
-	{0x7566, 2860},
-	{0x756a, 3302},
-	{0x756b, 3301},
-	{0x756c, 8739},
-	{0x756f, 8738},
-	{0x7570, 2862},
-	{0x7576, 3717},
-	{0x7577, 9390},
-	{0x7578, 3718},
-	{0x7579, 9389},
-	{0x757f, 4523},
-	{0x7586, 5531},
-	{0x7587, 5530},
-	{0x758a, 5836},
-	{0x758b, 866},
-	{0x758c, 6674},
-	{0x758f, 2863},
-	{0x7591, 4146},
-	{0x7592, 558},
-	{0x7594, 6356},
-	{0x7595, 6357},
-	{0x7598, 6675},
-	{0x7599, 1623},
-	{0x759a, 1624},
-	{0x759d, 1622},
-	{0x75a2, 1960},
-	{0x75a3, 1961},
-	{0x75a4, 1958},
-	{0x75a5, 1959},
-	{0x75a7, 7059},
-	{0x75aa, 7060},
-	{0x75ab, 1957},
-	{0x75b0, 7505},
-	{0x75b2, 2361},
-	{0x75b3, 2362},
-	{0x75b5, 2866},
-	{0x75b6, 7511},
-	{0x75b8, 2367},
-	{0x75b9, 2365},
-	{0x75ba, 7512},
-	{0x75bb, 7507},
-	{0x75bc, 2364},
-	{0x75bd, 2363},
-	{0x75be, 2358},
-	{0x75bf, 7510},
-	{0x75c0, 7509},
-	{0x75c1, 7506},
-	{0x75c2, 2366},
-	{0x75c4, 7508},
-	{0x75c5, 2359},
-	{0x75c7, 2360},
-	{0x75ca, 2867},
-	{0x75cb, 8099},
-	{0x75cc, 8100},
-	{0x75cd, 2868},
-	{0x75ce, 8096},
-	{0x75cf, 8098},
-	{0x75d0, 8102},
-	{0x75d1, 8101},
-	{0x75d2, 8097},
-	{0x75d4, 2864},
-	{0x75d5, 2865},
-	{0x75d7, 8747},
-	{0x75d8, 3307},
-	{0x75d9, 3306},
-	{0x75da, 8741},
-	{0x75db, 3304},
-	{0x75dd, 8744},
-	{0x75de, 3308},
-	{0x75df, 8745},
-	{0x75e0, 3309},
-	{0x75e1, 8742},
-	{0x75e2, 3303},
-	{0x75e3, 3305},
-	{0x75e4, 8746},
-	{0x75e6, 8743},
-	{0x75e7, 8740},
-	{0x75ed, 9403},
-	{0x75ef, 9392},
-	{0x75f0, 3720},
-	{0x75f1, 3723},
-	{0x75f2, 3722},
-	{0x75f3, 3727},
-	{0x75f4, 3726},
-	{0x75f5, 9404},
-	{0x75f6, 9402},
-	{0x75f7, 9395},
-	{0x75f8, 9399},
-	{0x75f9, 9398},
-	{0x75fa, 3724},
-	{0x75fb, 9401},
-	{0x75fc, 9397},
-	{0x75fd, 9405},
-	{0x75fe, 9396},
-	{0x75ff, 3725},
-	{0x7600, 3719},
-	{0x7601, 3721},
-	{0x7603, 9394},
-	{0x7609, 4150},
-	{0x760b, 4149},
-	{0x760d, 4148},
-	{0x760f, 9393},
-	{0x7610, 9400},
-	{0x7613, 4151},
-	{0x761f, 4526},
-	{0x7620, 4524},
-	{0x7621, 4529},
-	{0x7622, 4530},
-	{0x7624, 4527},
-	{0x7626, 4528},
-	{0x7627, 4147},
-	{0x7629, 4525},
-	{0x7634, 4866},
-	{0x7638, 4867},
-	{0x763a, 4868},
-	{0x7642, 5141},
-	{0x7646, 5140},
-	{0x7649, 0},
-	{0x764c, 5142},
-	{0x7652, 5369},
-	{0x7656, 5367},
-	{0x7658, 5368},
-	{0x765f, 5532},
-	{0x7661, 5533},
-	{0x7662, 5666},
-	{0x7665, 5667},
-	{0x7669, 5759},
-	{0x766c, 5838},
-	{0x766e, 5837},
-	{0x7671, 5923},
-	{0x7672, 5924},
-	{0x7676, 559},
-	{0x7678, 1962},
-	{0x7679, 7061},
-	{0x767b, 3310},
-	{0x767c, 3311},
-	{0x767d, 867},
-	{0x767e, 1013},
-	{0x767f, 6160},
-	{0x7681, 6358},
-	{0x7682, 1268},
-	{0x7684, 1625},
-	{0x7686, 1963},
-	{0x7687, 1964},
-	{0x7688, 1965},
-	{0x7689, 8104},
-	{0x768a, 7513},
-	{0x768b, 2368},
-	{0x768e, 2869},
-	{0x768f, 8103},
-	{0x7692, 8749},
-	{0x7693, 3313},
-	{0x7695, 8748},
-	{0x7696, 3312},
-	{0x7699, 9406},
-	{0x769a, 4531},
-	{0x769d, 0},
-	{0x769e, 1},
-	{0x76ae, 868},
-	{0x76af, 6676},
-	{0x76b0, 2369},
-	{0x76b4, 3314},
-	{0x76b5, 9407},
-	{0x76ba, 4532},
-	{0x76bf, 869},
-	{0x76c2, 1626},
-	{0x76c3, 1968},
-	{0x76c4, 7062},
-	{0x76c5, 1969},
-	{0x76c6, 1967},
-	{0x76c8, 1966},
-	{0x76c9, 7514},
-	{0x76ca, 2370},
-	{0x76cd, 2371},
-	{0x76ce, 2372},
-	{0x76d2, 2871},
-	{0x76d3, 8105},
-	{0x76d4, 2870},
-	{0x76da, 8750},
-	{0x76db, 2872},
-	{0x76dc, 3315},
-	{0x76dd, 9408},
-	{0x76de, 3728},
-	{0x76df, 3729},
-	{0x76e1, 4152},
-	{0x76e3, 4153},
-	{0x76e4, 4533},
-	{0x76e5, 4870},
-	{0x76e7, 4869},
-	{0x76ea, 5143},
-	{0x76ee, 870},
-	{0x76ef, 1269},
-	{0x76f0, 6679},
-	{0x76f1, 6678},
-	{0x76f2, 1627},
-	{0x76f3, 6677},
-	{0x76f4, 1628},
-	{0x76f5, 6680},
-	{0x76f7, 7068},
-	{0x76f8, 1972},
-	{0x76f9, 1971},
-	{0x76fa, 7070},
-	{0x76fb, 7069},
-	{0x76fc, 1976},
-	{0x76fe, 1975},
-	{0x7701, 1970},
-	{0x7703, 7064},
-	{0x7704, 7065},
-	{0x7705, 7066},
-	{0x7707, 1977},
-	{0x7708, 7063},
-	{0x7709, 1973},
-	{0x770a, 7067},
-	{0x770b, 1974},
-	{0x770f, 0},
-	{0x7710, 7517},
-	{0x7711, 7521},
-	{0x7712, 7519},
-	{0x7713, 7518},
-	{0x7715, 7522},
-	{0x7719, 7523},
-	{0x771a, 7524},
-	{0x771b, 7516},
-	{0x771d, 7515},
-	{0x771f, 2374},
-	{0x7720, 2375},
-	{0x7722, 7525},
-	{0x7723, 7520},
-	{0x7725, 8114},
-	{0x7727, 7526},
-	{0x7728, 2376},
-	{0x7729, 2373},
-	{0x772d, 8108},
-	{0x772f, 8107},
-	{0x7731, 8109},
-	{0x7732, 8110},
-	{0x7733, 8112},
-	{0x7734, 8111},
-	{0x7735, 8116},
-	{0x7736, 2876},
-	{0x7737, 2873},
-	{0x7738, 2877},
-	{0x7739, 8106},
-	{0x773a, 2878},
-	{0x773b, 8115},
-	{0x773c, 2875},
-	{0x773d, 8113},
-	{0x773e, 2874},
-	{0x7744, 8753},
-	{0x7745, 8755},
-	{0x7746, 8751},
-	{0x7747, 8752},
-	{0x774a, 8756},
-	{0x774b, 8758},
-	{0x774c, 8759},
-	{0x774d, 8754},
-	{0x774e, 8757},
-	{0x774f, 3316},
-	{0x7752, 9412},
-	{0x7754, 9417},
-	{0x7755, 9409},
-	{0x7756, 9413},
-	{0x7759, 9418},
-	{0x775a, 9414},
-	{0x775b, 3730},
-	{0x775c, 3738},
-	{0x775e, 3733},
-	{0x775f, 9410},
-	{0x7760, 9411},
-	{0x7761, 4157},
-	{0x7762, 3741},
-	{0x7763, 3734},
-	{0x7765, 3739},
-	{0x7766, 3732},
-	{0x7767, 9416},
-	{0x7768, 3740},
-	{0x7769, 9415},
-	{0x776a, 3736},
-	{0x776b, 3731},
-	{0x776c, 3737},
-	{0x776d, 9419},
-	{0x7779, 3735},
-	{0x777d, 4155},
-	{0x777f, 4156},
-	{0x7784, 4154},
-	{0x7787, 4535},
-	{0x778b, 4538},
-	{0x778c, 4536},
-	{0x778e, 4534},
-	{0x7791, 4537},
-	{0x779e, 4872},
-	{0x779f, 4873},
-	{0x77a0, 4871},
-	{0x77a3, 0},
-	{0x77a5, 4874},
-	{0x77a7, 5148},
-	{0x77aa, 5145},
-	{0x77ac, 5147},
-	{0x77ad, 5149},
-	{0x77b0, 5146},
-	{0x77b3, 5144},
-	{0x77bb, 5372},
-	{0x77bc, 5373},
-	{0x77bd, 5370},
-	{0x77bf, 5371},
-	{0x77c7, 5534},
-	{0x77ca, 0},
-	{0x77cf, 0},
-	{0x77d3, 5760},
-	{0x77d7, 5925},
-	{0x77d9, 0},
-	{0x77da, 5971},
-	{0x77db, 871},
-	{0x77dc, 1978},
-	{0x77de, 8760},
-	{0x77e0, 9420},
-	{0x77e2, 872},
-	{0x77e3, 1270},
-	{0x77e5, 1629},
-	{0x77e7, 7071},
-	{0x77e8, 7072},
-	{0x77e9, 2377},
-	{0x77ec, 8761},
-	{0x77ed, 3317},
-	{0x77ee, 3742},
-	{0x77ef, 5150},
-	{0x77f3, 873},
-	{0x77f7, 6686},
-	{0x77f8, 6681},
-	{0x77f9, 6683},
-	{0x77fa, 6685},
-	{0x77fb, 6684},
-	{0x77fc, 6682},
-	{0x77fd, 1630},
-	{0x7802, 1979},
-	{0x7803, 7081},
-	{0x7805, 7076},
-	{0x7806, 7073},
-	{0x7809, 7080},
-	{0x780c, 1981},
-	{0x780d, 1982},
-	{0x780e, 7079},
-	{0x780f, 7078},
-	{0x7810, 7077},
-	{0x7811, 7074},
-	{0x7812, 7075},
-	{0x7813, 7082},
-	{0x7814, 1980},
-	{0x781d, 2381},
-	{0x781f, 2387},
-	{0x7820, 2386},
-	{0x7821, 7535},
-	{0x7822, 7529},
-	{0x7823, 7527},
-	{0x7825, 2384},
-	{0x7826, 8123},
-	{0x7827, 2379},
-	{0x7828, 7532},
-	{0x7829, 7536},
-	{0x782a, 7538},
-	{0x782b, 7534},
-	{0x782c, 7528},
-	{0x782d, 2385},
-	{0x782e, 7533},
-	{0x782f, 7531},
-	{0x7830, 2378},
-	{0x7831, 7539},
-	{0x7832, 2388},
-	{0x7833, 7537},
-	{0x7834, 2382},
-	{0x7835, 7530},
-	{0x7837, 2383},
-	{0x7838, 2380},
-	{0x7843, 2880},
-	{0x7845, 8124},
-	{0x7848, 8117},
-	{0x7849, 8119},
-	{0x784a, 8121},
-	{0x784c, 8122},
-	{0x784d, 8120},
-	{0x784e, 2881},
-	{0x7850, 8125},
-	{0x7852, 8118},
-	{0x785c, 8765},
-	{0x785d, 3318},
-	{0x785e, 8773},
-	{0x7860, 8762},
-	{0x7862, 8774},
-	{0x7864, 8763},
-	{0x7865, 8764},
-	{0x7868, 8772},
-	{0x7869, 8771},
-	{0x786a, 8768},
-	{0x786b, 2879},
-	{0x786c, 3319},
-	{0x786d, 8766},
-	{0x786e, 8769},
-	{0x786f, 3320},
-	{0x7870, 8770},
-	{0x7871, 8767},
-	{0x7879, 9431},
-	{0x787b, 9435},
-	{0x787c, 3749},
-	{0x787f, 3752},
-	{0x7880, 9433},
-	{0x7883, 9430},
-	{0x7884, 9425},
-	{0x7885, 9427},
-	{0x7886, 9428},
-	{0x7887, 9421},
-	{0x7889, 3748},
-	{0x788c, 3747},
-	{0x788e, 3743},
-	{0x788f, 9424},
-	{0x7891, 3750},
-	{0x7893, 3751},
-	{0x7894, 9423},
-	{0x7895, 9426},
-	{0x7896, 9434},
-	{0x7897, 3745},
-	{0x7898, 3746},
-	{0x7899, 9432},
-	{0x789a, 9422},
-	{0x789f, 4159},
-	{0x78a1, 9429},
-	{0x78a3, 4163},
-	{0x78a7, 4160},
-	{0x78a9, 4162},
-	{0x78b0, 3744},
-	{0x78b3, 4161},
-	{0x78ba, 4541},
-	{0x78bc, 4545},
-	{0x78be, 4543},
-	{0x78c1, 4158},
-	{0x78c4, 0},
-	{0x78c5, 4540},
-	{0x78ca, 4542},
-	{0x78cb, 4539},
-	{0x78d0, 4546},
-	{0x78d5, 4544},
-	{0x78da, 4876},
-	{0x78e0, 0},
-	{0x78e2, 0},
-	{0x78e7, 4878},
-	{0x78e8, 4875},
-	{0x78ec, 4877},
-	{0x78ef, 5154},
-	{0x78f4, 5153},
-	{0x78f7, 5151},
-	{0x78fa, 5152},
-	{0x78fc, 0},
-	{0x7901, 5155},
-	{0x790e, 5374},
-	{0x7914, 0},
-	{0x7919, 5535},
-	{0x7926, 5668},
-	{0x7928, 0},
-	{0x792a, 5669},
-	{0x792b, 5671},
-	{0x792c, 5670},
-	{0x793a, 874},
-	{0x793d, 6359},
-	{0x793e, 1631},
-	{0x793f, 6688},
-	{0x7940, 1632},
-	{0x7941, 1633},
-	{0x7942, 6687},
-	{0x7944, 7087},
-	{0x7945, 7086},
-	{0x7946, 1983},
-	{0x7947, 1986},
-	{0x7948, 1985},
-	{0x7949, 1984},
-	{0x794a, 7083},
-	{0x794b, 7085},
-	{0x794c, 7084},
-	{0x794f, 7542},
-	{0x7950, 2390},
-	{0x7951, 7546},
-	{0x7952, 7545},
-	{0x7953, 7544},
-	{0x7954, 7540},
-	{0x7955, 2389},
-	{0x7956, 2393},
-	{0x7957, 2396},
-	{0x795a, 2397},
-	{0x795b, 7541},
-	{0x795c, 7543},
-	{0x795d, 2395},
-	{0x795e, 2394},
-	{0x795f, 2392},
-	{0x7960, 2391},
-	{0x7961, 8132},
-	{0x7963, 8130},
-	{0x7964, 8126},
-	{0x7965, 2882},
-	{0x7967, 8127},
-	{0x7968, 2883},
-	{0x7969, 8128},
-	{0x796a, 8129},
-	{0x796b, 8131},
-	{0x796d, 2884},
-	{0x7970, 8778},
-	{0x7972, 8777},
-	{0x7973, 8776},
-	{0x7974, 8775},
-	{0x7979, 9439},
-	{0x797a, 3753},
-	{0x797c, 9436},
-	{0x797d, 9438},
-	{0x797f, 3754},
-	{0x7981, 3755},
-	{0x7982, 9437},
-	{0x798b, 0},
-	{0x798d, 4166},
-	{0x798e, 4164},
-	{0x798f, 4165},
-	{0x79a6, 4879},
-	{0x79a7, 5156},
-	{0x79aa, 5157},
-	{0x79ae, 5375},
-	{0x79b1, 5536},
-	{0x79b3, 5839},
-	{0x79b8, 6066},
-	{0x79b9, 1987},
-	{0x79ba, 1988},
-	{0x79bb, 8133},
-	{0x79bd, 3757},
-	{0x79be, 875},
-	{0x79bf, 1273},
-	{0x79c0, 1272},
-	{0x79c1, 1271},
-	{0x79c5, 6689},
-	{0x79c8, 1635},
-	{0x79c9, 1634},
-	{0x79cb, 1991},
-	{0x79cd, 7089},
-	{0x79ce, 7092},
-	{0x79cf, 7090},
-	{0x79d1, 1989},
-	{0x79d2, 1990},
-	{0x79d5, 7088},
-	{0x79d6, 7091},
-	{0x79d8, 2404},
-	{0x79dc, 7553},
-	{0x79dd, 7555},
-	{0x79de, 7554},
-	{0x79df, 2401},
-	{0x79e0, 7549},
-	{0x79e3, 2399},
-	{0x79e4, 2398},
-	{0x79e6, 2402},
-	{0x79e7, 2400},
-	{0x79e9, 2403},
-	{0x79ea, 7552},
-	{0x79eb, 7547},
-	{0x79ec, 7548},
-	{0x79ed, 7551},
-	{0x79ee, 7550},
-	{0x79f6, 8136},
-	{0x79f7, 8137},
-	{0x79f8, 8135},
-	{0x79fa, 8134},
-	{0x79fb, 2885},
-	{0x7a00, 3325},
-	{0x7a02, 8779},
-	{0x7a03, 8781},
-	{0x7a04, 8783},
-	{0x7a05, 3324},
-	{0x7a08, 3322},
-	{0x7a0a, 8780},
-	{0x7a0b, 3323},
-	{0x7a0c, 8782},
-	{0x7a0d, 3321},
-	{0x7a10, 9449},
-	{0x7a11, 9440},
-	{0x7a12, 9443},
-	{0x7a13, 9447},
-	{0x7a14, 3761},
-	{0x7a15, 9445},
-	{0x7a17, 9444},
-	{0x7a18, 9441},
-	{0x7a19, 9442},
-	{0x7a1a, 3759},
-	{0x7a1b, 9448},
-	{0x7a1c, 3758},
-	{0x7a1e, 3763},
-	{0x7a1f, 3762},
-	{0x7a20, 3760},
-	{0x7a22, 9446},
-	{0x7a2e, 4167},
-	{0x7a31, 4168},
-	{0x7a37, 4551},
-	{0x7a3b, 4552},
-	{0x7a3c, 4548},
-	{0x7a3d, 4550},
-	{0x7a3f, 4547},
-	{0x7a40, 4549},
-	{0x7a46, 4882},
-	{0x7a4b, 4884},
-	{0x7a4c, 4883},
-	{0x7a4d, 4880},
-	{0x7a4e, 4881},
-	{0x7a57, 5158},
-	{0x7a60, 5378},
-	{0x7a61, 5376},
-	{0x7a62, 5377},
-	{0x7a68, 0},
-	{0x7a69, 5538},
-	{0x7a6b, 5537},
-	{0x7a6d, 0},
-	{0x7a71, 0},
-	{0x7a74, 876},
-	{0x7a75, 6161},
-	{0x7a76, 1274},
-	{0x7a78, 6690},
-	{0x7a79, 1637},
-	{0x7a7a, 1636},
-	{0x7a7b, 6691},
-	{0x7a7e, 7094},
-	{0x7a7f, 1992},
-	{0x7a80, 7093},
-	{0x7a81, 1993},
-	{0x7a84, 2405},
-	{0x7a85, 7558},
-	{0x7a86, 7556},
-	{0x7a87, 7562},
-	{0x7a88, 2406},
-	{0x7a89, 7557},
-	{0x7a8a, 7561},
-	{0x7a8b, 7559},
-	{0x7a8c, 7560},
-	{0x7a8f, 8138},
-	{0x7a90, 8140},
-	{0x7a92, 2886},
-	{0x7a94, 8139},
-	{0x7a95, 2887},
-	{0x7a96, 3328},
-	{0x7a97, 3327},
-	{0x7a98, 3326},
-	{0x7a99, 8784},
-	{0x7a9e, 9452},
-	{0x7a9f, 3764},
-	{0x7aa0, 3765},
-	{0x7aa2, 9451},
-	{0x7aa3, 9450},
-	{0x7aa9, 4170},
-	{0x7aaa, 4169},
-	{0x7aac, 0},
-	{0x7aae, 4554},
-	{0x7aaf, 4553},
-	{0x7aba, 4885},
-	{0x7abf, 5159},
-	{0x7ac1, 0},
-	{0x7ac3, 0},
-	{0x7ac4, 5379},
-	{0x7ac5, 5380},
-	{0x7ac7, 5672},
-	{0x7aca, 5887},
-	{0x7acb, 877},
-	{0x7ad1, 7095},
-	{0x7ad8, 7563},
-	{0x7ad9, 2407},
-	{0x7adf, 3038},
-	{0x7ae0, 3037},
-	{0x7ae3, 3330},
-	{0x7ae4, 8786},
-	{0x7ae5, 3329},
-	{0x7ae6, 8785},
-	{0x7aeb, 9453},
-	{0x7aed, 4171},
-	{0x7aef, 4172},
-	{0x7af6, 5673},
-	{0x7af9, 1014},
-	{0x7afa, 1638},
-	{0x7afb, 6692},
-	{0x7afd, 1995},
-	{0x7aff, 1994},
-	{0x7b00, 7096},
-	{0x7b01, 7097},
-	{0x7b04, 7565},
-	{0x7b05, 7567},
-	{0x7b06, 2408},
-	{0x7b08, 7569},
-	{0x7b09, 7572},
-	{0x7b0a, 7570},
-	{0x7b0e, 7571},
-	{0x7b0f, 7568},
-	{0x7b10, 7564},
-	{0x7b11, 2409},
-	{0x7b12, 7573},
-	{0x7b13, 7566},
-	{0x7b18, 8149},
-	{0x7b19, 2893},
-	{0x7b1a, 8158},
-	{0x7b1b, 2890},
-	{0x7b1d, 8151},
-	{0x7b1e, 2894},
-	{0x7b20, 2888},
-	{0x7b22, 8146},
-	{0x7b23, 8159},
-	{0x7b24, 8147},
-	{0x7b25, 8144},
-	{0x7b26, 2892},
-	{0x7b28, 2889},
-	{0x7b2a, 8150},
-	{0x7b2b, 8153},
-	{0x7b2c, 2891},
-	{0x7b2d, 8154},
-	{0x7b2e, 2895},
-	{0x7b2f, 8155},
-	{0x7b30, 8145},
-	{0x7b31, 8152},
-	{0x7b32, 8156},
-	{0x7b33, 8148},
-	{0x7b34, 8143},
-	{0x7b35, 8141},
-	{0x7b38, 8157},
-	{0x7b3b, 8142},
-	{0x7b40, 8793},
-	{0x7b44, 8789},
-	{0x7b45, 8795},
-	{0x7b46, 3333},
-	{0x7b47, 8788},
-	{0x7b48, 8790},
-	{0x7b49, 3331},
-	{0x7b4a, 8787},
-	{0x7b4b, 3338},
-	{0x7b4c, 8791},
-	{0x7b4d, 3337},
-	{0x7b4e, 8792},
-	{0x7b4f, 3339},
-	{0x7b50, 3334},
-	{0x7b51, 3340},
-	{0x7b52, 3335},
-	{0x7b54, 3336},
-	{0x7b56, 3332},
-	{0x7b58, 8794},
-	{0x7b60, 3768},
-	{0x7b61, 9464},
-	{0x7b63, 9467},
-	{0x7b64, 9455},
-	{0x7b65, 9460},
-	{0x7b66, 9454},
-	{0x7b67, 3770},
-	{0x7b69, 9458},
-	{0x7b6d, 9456},
-	{0x7b6e, 3769},
-	{0x7b70, 9463},
-	{0x7b71, 9462},
-	{0x7b72, 9459},
-	{0x7b73, 9461},
-	{0x7b74, 9457},
-	{0x7b75, 4176},
-	{0x7b76, 9466},
-	{0x7b77, 3766},
-	{0x7b78, 9465},
-	{0x7b84, 4183},
-	{0x7b87, 4182},
-	{0x7b8b, 4175},
-	{0x7b8f, 4180},
-	{0x7b94, 4179},
-	{0x7b95, 4174},
-	{0x7b97, 4177},
-	{0x7b9d, 4178},
-	{0x7ba0, 4562},
-	{0x7ba1, 4173},
-	{0x7bad, 4555},
-	{0x7bb1, 4556},
-	{0x7bb4, 4558},
-	{0x7bb8, 4181},
-	{0x7bc0, 3767},
-	{0x7bc1, 4561},
-	{0x7bc4, 4557},
-	{0x7bc6, 4559},
-	{0x7bc7, 4560},
-	{0x7bc9, 4888},
-	{0x7bcc, 4563},
-	{0x7bd9, 4886},
-	{0x7bdb, 4890},
-	{0x7be0, 5165},
-	{0x7be1, 4891},
-	{0x7be4, 4889},
-	{0x7be6, 4893},
-	{0x7be9, 4892},
-	{0x7bf1, 0},
-	{0x7bf7, 5163},
-	{0x7bfe, 5162},
-	{0x7c07, 5160},
-	{0x7c0c, 5164},
-	{0x7c0d, 5161},
-	{0x7c11, 4887},
-	{0x7c1e, 5384},
-	{0x7c21, 5386},
-	{0x7c23, 5385},
-	{0x7c27, 5382},
-	{0x7c2a, 5383},
-	{0x7c2b, 5381},
-	{0x7c37, 5543},
-	{0x7c38, 5541},
-	{0x7c3d, 5542},
-	{0x7c3e, 5539},
-	{0x7c3f, 5540},
-	{0x7c40, 5544},
-	{0x7c43, 5675},
-	{0x7c4c, 5674},
-	{0x7c4d, 5676},
-	{0x7c50, 5761},
-	{0x7c5f, 5841},
-	{0x7c60, 5840},
-	{0x7c63, 5889},
-	{0x7c64, 5888},
-	{0x7c65, 5890},
-	{0x7c6c, 5957},
-	{0x7c6e, 5958},
-	{0x7c72, 5995},
-	{0x7c73, 1015},
-	{0x7c75, 6693},
-	{0x7c78, 7099},
-	{0x7c79, 7100},
-	{0x7c7a, 7098},
-	{0x7c7d, 1996},
-	{0x7c7f, 7101},
-	{0x7c80, 7102},
-	{0x7c81, 7103},
-	{0x7c84, 7574},
-	{0x7c85, 7580},
-	{0x7c88, 7578},
-	{0x7c89, 2410},
-	{0x7c8a, 7576},
-	{0x7c8c, 7577},
-	{0x7c8d, 7579},
-	{0x7c91, 7575},
-	{0x7c92, 2896},
-	{0x7c94, 8160},
-	{0x7c95, 2898},
-	{0x7c96, 8162},
-	{0x7c97, 2897},
-	{0x7c98, 8161},
-	{0x7c9e, 8797},
-	{0x7c9f, 3341},
-	{0x7ca1, 8799},
-	{0x7ca2, 8796},
-	{0x7ca3, 8163},
-	{0x7ca5, 3342},
-	{0x7ca8, 8798},
-	{0x7caf, 9470},
-	{0x7cb1, 3771},
-	{0x7cb2, 9468},
-	{0x7cb3, 3772},
-	{0x7cb4, 9469},
-	{0x7cb5, 3773},
-	{0x7cb9, 4184},
-	{0x7cbd, 4185},
-	{0x7cbe, 4186},
-	{0x7cca, 4564},
-	{0x7cce, 289},
-	{0x7cd1, 0},
-	{0x7cd5, 4894},
-	{0x7cd6, 4895},
-	{0x7cd9, 5171},
-	{0x7cdc, 5167},
-	{0x7cdd, 5172},
-	{0x7cde, 5168},
-	{0x7cdf, 5170},
-	{0x7ce0, 5166},
-	{0x7ce2, 5169},
-	{0x7ce7, 5387},
-	{0x7cef, 5677},
-	{0x7cf0, 5678},
-	{0x7cf8, 1016},
-	{0x7cfb, 1275},
-	{0x7cfd, 6694},
-	{0x7cfe, 1639},
-	{0x7d00, 1999},
-	{0x7d01, 7106},
-	{0x7d02, 1997},
-	{0x7d03, 7104},
-	{0x7d04, 2002},
-	{0x7d05, 1998},
-	{0x7d06, 2003},
-	{0x7d07, 2001},
-	{0x7d08, 7105},
-	{0x7d09, 2000},
-	{0x7d0a, 2414},
-	{0x7d0b, 2413},
-	{0x7d0c, 7591},
-	{0x7d0d, 2422},
-	{0x7d0e, 7584},
-	{0x7d0f, 7590},
-	{0x7d10, 2418},
-	{0x7d11, 7583},
-	{0x7d12, 7589},
-	{0x7d13, 7587},
-	{0x7d14, 2417},
-	{0x7d15, 2419},
-	{0x7d16, 7586},
-	{0x7d17, 2412},
-	{0x7d18, 7585},
-	{0x7d19, 2423},
-	{0x7d1a, 2420},
-	{0x7d1b, 2424},
-	{0x7d1c, 2421},
-	{0x7d1d, 7582},
-	{0x7d1e, 7581},
-	{0x7d1f, 7588},
-	{0x7d20, 2415},
-	{0x7d21, 2411},
-	{0x7d22, 2416},
-	{0x7d28, 8178},
-	{0x7d29, 8171},
-	{0x7d2b, 3347},
-	{0x7d2c, 8170},
-	{0x7d2e, 2902},
-	{0x7d2f, 2909},
-	{0x7d30, 2906},
-	{0x7d31, 2912},
-	{0x7d32, 2911},
-	{0x7d33, 2907},
-	{0x7d35, 8164},
-	{0x7d36, 8167},
-	{0x7d38, 8166},
-	{0x7d39, 2903},
-	{0x7d3a, 8168},
-	{0x7d3b, 8177},
-	{0x7d3c, 2904},
-	{0x7d3d, 8165},
-	{0x7d3e, 8174},
-	{0x7d3f, 8175},
-	{0x7d40, 2905},
-	{0x7d41, 8172},
-	{0x7d42, 2910},
-	{0x7d43, 2900},
-	{0x7d44, 2908},
-	{0x7d45, 8169},
-	{0x7d46, 2899},
-	{0x7d47, 8173},
-	{0x7d4a, 8176},
-	{0x7d4e, 8816},
-	{0x7d4f, 8807},
-	{0x7d50, 3344},
-	{0x7d51, 8814},
-	{0x7d52, 8811},
-	{0x7d53, 8803},
-	{0x7d54, 8812},
-	{0x7d55, 3346},
-	{0x7d56, 8804},
-	{0x7d58, 8800},
-	{0x7d5b, 3779},
-	{0x7d5c, 8809},
-	{0x7d5e, 3343},
-	{0x7d5f, 8815},
-	{0x7d61, 3350},
-	{0x7d62, 3352},
-	{0x7d63, 8802},
-	{0x7d66, 3351},
-	{0x7d67, 8805},
-	{0x7d68, 3345},
-	{0x7d69, 8813},
-	{0x7d6a, 8806},
-	{0x7d6b, 8810},
-	{0x7d6d, 8808},
-	{0x7d6e, 3348},
-	{0x7d6f, 8801},
-	{0x7d70, 3353},
-	{0x7d71, 2901},
-	{0x7d72, 3349},
-	{0x7d73, 3354},
-	{0x7d79, 3775},
-	{0x7d7a, 9477},
-	{0x7d7b, 9479},
-	{0x7d7c, 9481},
-	{0x7d7d, 9485},
-	{0x7d7f, 9475},
-	{0x7d80, 9473},
-	{0x7d81, 3777},
-	{0x7d83, 9480},
-	{0x7d84, 9484},
-	{0x7d85, 9476},
-	{0x7d86, 9472},
-	{0x7d88, 9471},
-	{0x7d8c, 9482},
-	{0x7d8d, 9474},
-	{0x7d8e, 9478},
-	{0x7d8f, 3778},
-	{0x7d91, 3776},
-	{0x7d92, 9486},
-	{0x7d93, 3774},
-	{0x7d94, 9483},
-	{0x7d9c, 4189},
-	{0x7d9e, 4577},
-	{0x7da0, 4192},
-	{0x7da2, 4198},
-	{0x7dac, 4205},
-	{0x7dad, 4202},
-	{0x7db0, 4188},
-	{0x7db1, 4196},
-	{0x7db2, 4195},
-	{0x7db4, 4194},
-	{0x7db5, 4200},
-	{0x7db8, 4201},
-	{0x7dba, 4197},
-	{0x7dbb, 4187},
-	{0x7dbd, 4190},
-	{0x7dbe, 4191},
-	{0x7dbf, 4199},
-	{0x7dc7, 4204},
-	{0x7dca, 4193},
-	{0x7dcc, 0},
-	{0x7dd2, 4203},
-	{0x7dd8, 4569},
-	{0x7dd9, 4578},
-	{0x7dda, 4574},
-	{0x7ddd, 4571},
-	{0x7dde, 4575},
-	{0x7de0, 4565},
-	{0x7de3, 4573},
-	{0x7de8, 4572},
-	{0x7de9, 4576},
-	{0x7dec, 4570},
-	{0x7def, 4567},
-	{0x7df2, 4579},
-	{0x7df4, 4566},
-	{0x7df9, 4580},
-	{0x7dfb, 4568},
-	{0x7e08, 4898},
-	{0x7e09, 4903},
-	{0x7e0a, 4896},
-	{0x7e10, 4904},
-	{0x7e11, 4897},
-	{0x7e1b, 4899},
-	{0x7e1d, 4902},
-	{0x7e1e, 4901},
-	{0x7e20, 0},
-	{0x7e23, 4900},
-	{0x7e2b, 5179},
-	{0x7e2e, 5173},
-	{0x7e2f, 5189},
-	{0x7e31, 5181},
-	{0x7e32, 5177},
-	{0x7e34, 5184},
-	{0x7e35, 5187},
-	{0x7e37, 5176},
-	{0x7e39, 5185},
-	{0x7e3d, 5180},
-	{0x7e3e, 5174},
-	{0x7e3f, 5188},
-	{0x7e41, 5183},
-	{0x7e43, 5178},
-	{0x7e45, 5182},
-	{0x7e46, 5175},
-	{0x7e48, 5186},
-	{0x7e52, 5393},
-	{0x7e54, 5388},
-	{0x7e55, 5389},
-	{0x7e59, 5394},
-	{0x7e5a, 5391},
-	{0x7e5e, 5390},
-	{0x7e61, 5392},
-	{0x7e69, 5548},
-	{0x7e6a, 5549},
-	{0x7e6b, 5545},
-	{0x7e6d, 5546},
-	{0x7e73, 5550},
-	{0x7e79, 5547},
-	{0x7e7c, 5681},
-	{0x7e7d, 5680},
-	{0x7e82, 5682},
-	{0x7e88, 0},
-	{0x7e8c, 5763},
-	{0x7e8f, 5762},
-	{0x7e93, 5891},
-	{0x7e94, 5893},
-	{0x7e96, 5892},
-	{0x7e9c, 5977},
-	{0x7f36, 1017},
-	{0x7f38, 2004},
-	{0x7f39, 7455},
-	{0x7f3a, 2425},
-	{0x7f3d, 2913},
-	{0x7f3e, 8817},
-	{0x7f3f, 8818},
-	{0x7f41, 0},
-	{0x7f44, 5190},
-	{0x7f48, 5395},
-	{0x7f4c, 5683},
-	{0x7f50, 5926},
-	{0x7f51, 6162},
-	{0x7f54, 1640},
-	{0x7f55, 1276},
-	{0x7f58, 7107},
-	{0x7f5b, 7597},
-	{0x7f5c, 7592},
-	{0x7f5d, 7596},
-	{0x7f5e, 7594},
-	{0x7f5f, 2426},
-	{0x7f60, 7595},
-	{0x7f61, 7593},
-	{0x7f63, 8179},
-	{0x7f65, 8819},
-	{0x7f66, 8820},
-	{0x7f67, 9489},
-	{0x7f68, 9490},
-	{0x7f69, 3781},
-	{0x7f6a, 3782},
-	{0x7f6b, 9488},
-	{0x7f6c, 9491},
-	{0x7f6d, 9487},
-	{0x7f6e, 3780},
-	{0x7f70, 4206},
-	{0x7f72, 3783},
-	{0x7f75, 4581},
-	{0x7f77, 4582},
-	{0x7f79, 4905},
-	{0x7f7c, 0},
-	{0x7f85, 5551},
-	{0x7f88, 5927},
-	{0x7f8a, 1018},
-	{0x7f8b, 1642},
-	{0x7f8c, 1641},
-	{0x7f8d, 7109},
-	{0x7f8e, 2005},
-	{0x7f91, 7108},
-	{0x7f92, 7599},
-	{0x7f94, 2427},
-	{0x7f95, 8180},
-	{0x7f96, 7598},
-	{0x7f9a, 2915},
-	{0x7f9b, 8183},
-	{0x7f9c, 8181},
-	{0x7f9d, 8182},
-	{0x7f9e, 2914},
-	{0x7fa0, 8822},
-	{0x7fa1, 8823},
-	{0x7fa2, 8821},
-	{0x7fa4, 3786},
-	{0x7fa5, 9493},
-	{0x7fa6, 9492},
-	{0x7fa7, 9494},
-	{0x7fa8, 3785},
-	{0x7fa9, 3784},
-	{0x7faf, 4583},
-	{0x7fb2, 4906},
-	{0x7fb6, 5552},
-	{0x7fb8, 5554},
-	{0x7fb9, 5553},
-	{0x7fbc, 5764},
-	{0x7fbd, 1019},
-	{0x7fbe, 7110},
-	{0x7fbf, 2006},
-	{0x7fc0, 7602},
-	{0x7fc1, 2429},
-	{0x7fc2, 7601},
-	{0x7fc3, 7600},
-	{0x7fc5, 2428},
-	{0x7fc7, 8189},
-	{0x7fc9, 8191},
-	{0x7fca, 8184},
-	{0x7fcb, 8185},
-	{0x7fcc, 2916},
-	{0x7fcd, 8186},
-	{0x7fce, 2917},
-	{0x7fcf, 8190},
-	{0x7fd0, 8187},
-	{0x7fd1, 8188},
-	{0x7fd2, 2918},
-	{0x7fd4, 3356},
-	{0x7fd5, 3357},
-	{0x7fd7, 8824},
-	{0x7fdb, 9495},
-	{0x7fdc, 9496},
-	{0x7fdf, 4209},
-	{0x7fe0, 4207},
-	{0x7fe1, 4208},
-	{0x7fe3, 0},
-	{0x7fe9, 4584},
-	{0x7fee, 4909},
-	{0x7ff0, 4907},
-	{0x7ff1, 4908},
-	{0x7ff3, 5191},
-	{0x7ff8, 0},
-	{0x7ff9, 5396},
-	{0x7ffb, 5397},
-	{0x7ffc, 5192},
-	{0x7ffe, 0},
-	{0x8000, 5684},
-	{0x8001, 1020},
-	{0x8003, 1021},
-	{0x8004, 2431},
-	{0x8005, 1643},
-	{0x8006, 2430},
-	{0x8007, 7111},
-	{0x800b, 3358},
-	{0x800c, 1022},
-	{0x800d, 2008},
-	{0x800e, 7112},
-	{0x800f, 7113},
-	{0x8010, 2007},
-	{0x8011, 2009},
-	{0x8012, 1023},
-	{0x8014, 7114},
-	{0x8015, 2433},
-	{0x8016, 7603},
-	{0x8017, 2435},
-	{0x8018, 2432},
-	{0x8019, 2434},
-	{0x801b, 8194},
-	{0x801c, 2919},
-	{0x801e, 8193},
-	{0x801f, 8192},
-	{0x8021, 9497},
-	{0x8026, 4585},
-	{0x8028, 4910},
-	{0x8033, 1024},
-	{0x8034, 6360},
-	{0x8035, 6695},
-	{0x8036, 2010},
-	{0x8037, 7115},
-	{0x8039, 7605},
-	{0x803c, 0},
-	{0x803d, 2436},
-	{0x803e, 7604},
-	{0x803f, 2437},
-	{0x8043, 8196},
-	{0x8046, 2921},
-	{0x8047, 8195},
-	{0x8048, 8197},
-	{0x804a, 2920},
-	{0x804f, 8826},
-	{0x8050, 8827},
-	{0x8051, 8825},
-	{0x8052, 3359},
-	{0x8056, 3787},
-	{0x8058, 3788},
-	{0x805a, 4211},
-	{0x805e, 4210},
-	{0x806f, 5196},
-	{0x8070, 5195},
-	{0x8071, 5193},
-	{0x8072, 5194},
-	{0x8073, 5197},
-	{0x8076, 5399},
-	{0x8077, 5398},
-	{0x807d, 5843},
-	{0x807e, 5842},
-	{0x807f, 1025},
-	{0x8082, 7404},
-	{0x8084, 3790},
-	{0x8085, 3360},
-	{0x8086, 3789},
-	{0x8087, 4212},
-	{0x8089, 1026},
-	{0x808a, 6067},
-	{0x808b, 1027},
-	{0x808c, 1028},
-	{0x808f, 6696},
-	{0x8090, 6363},
-	{0x8092, 6364},
-	{0x8093, 1278},
-	{0x8095, 6361},
-	{0x8096, 1277},
-	{0x8098, 1280},
-	{0x8099, 6362},
-	{0x809a, 1282},
-	{0x809b, 1281},
-	{0x809c, 6365},
-	{0x809d, 1279},
-	{0x80a1, 1648},
-	{0x80a2, 1646},
-	{0x80a3, 6698},
-	{0x80a5, 1645},
-	{0x80a9, 1650},
-	{0x80aa, 1652},
-	{0x80ab, 1649},
-	{0x80ad, 6701},
-	{0x80ae, 6697},
-	{0x80af, 1653},
-	{0x80b1, 1647},
-	{0x80b2, 1283},
-	{0x80b4, 1651},
-	{0x80b5, 6700},
-	{0x80b8, 6699},
-	{0x80ba, 1644},
-	{0x80c2, 7121},
-	{0x80c3, 2014},
-	{0x80c4, 2015},
-	{0x80c5, 7123},
-	{0x80c7, 7117},
-	{0x80c8, 7120},
-	{0x80c9, 7129},
-	{0x80ca, 7127},
-	{0x80cc, 2016},
-	{0x80cd, 7133},
-	{0x80ce, 2019},
-	{0x80cf, 7130},
-	{0x80d0, 7122},
-	{0x80d1, 7119},
-	{0x80d4, 8829},
-	{0x80d5, 7128},
-	{0x80d6, 2011},
-	{0x80d7, 7131},
-	{0x80d8, 7116},
-	{0x80d9, 7125},
-	{0x80da, 2013},
-	{0x80db, 2018},
-	{0x80dc, 7126},
-	{0x80dd, 2022},
-	{0x80de, 2020},
-	{0x80e0, 7118},
-	{0x80e1, 2017},
-	{0x80e3, 7124},
-	{0x80e4, 2021},
-	{0x80e5, 2012},
-	{0x80e6, 7132},
-	{0x80ed, 2442},
-	{0x80ef, 2451},
-	{0x80f0, 2440},
-	{0x80f1, 2438},
-	{0x80f2, 7607},
-	{0x80f3, 2446},
-	{0x80f4, 2443},
-	{0x80f5, 7609},
-	{0x80f8, 2445},
-	{0x80f9, 7608},
-	{0x80fa, 7606},
-	{0x80fb, 7611},
-	{0x80fc, 2450},
-	{0x80fd, 2448},
-	{0x80fe, 8828},
-	{0x8100, 7612},
-	{0x8101, 7610},
-	{0x8102, 2439},
-	{0x8105, 2441},
-	{0x8106, 2444},
-	{0x8108, 2447},
-	{0x810a, 2449},
-	{0x8115, 8207},
-	{0x8116, 2923},
-	{0x8118, 8198},
-	{0x8119, 8200},
-	{0x811b, 8201},
-	{0x811d, 8209},
-	{0x811e, 8205},
-	{0x811f, 8203},
-	{0x8121, 8206},
-	{0x8122, 8210},
-	{0x8123, 2924},
-	{0x8124, 2928},
-	{0x8125, 8199},
-	{0x8127, 8208},
-	{0x8129, 2926},
-	{0x812b, 2925},
-	{0x812c, 8204},
-	{0x812d, 8202},
-	{0x812f, 2922},
-	{0x8130, 2927},
-	{0x8139, 3366},
-	{0x813a, 8837},
-	{0x813d, 8835},
-	{0x813e, 3368},
-	{0x8143, 8830},
-	{0x8144, 9511},
-	{0x8146, 3367},
-	{0x8147, 8834},
-	{0x814a, 8831},
-	{0x814b, 3363},
-	{0x814c, 3369},
-	{0x814d, 8836},
-	{0x814e, 3365},
-	{0x814f, 8833},
-	{0x8150, 4213},
-	{0x8151, 3364},
-	{0x8152, 8832},
-	{0x8153, 3370},
-	{0x8154, 3362},
-	{0x8155, 3361},
-	{0x815a, 0},
-	{0x815b, 9503},
-	{0x815c, 9501},
-	{0x815e, 9507},
-	{0x8160, 9499},
-	{0x8161, 9512},
-	{0x8162, 9504},
-	{0x8164, 9498},
-	{0x8165, 3794},
-	{0x8166, 3800},
-	{0x8167, 9509},
-	{0x8169, 9502},
-	{0x816b, 3797},
-	{0x816e, 3795},
-	{0x816f, 9510},
-	{0x8170, 3792},
-	{0x8171, 3791},
-	{0x8172, 9505},
-	{0x8173, 3796},
-	{0x8174, 3371},
-	{0x8176, 9508},
-	{0x8177, 9500},
-	{0x8178, 3793},
-	{0x8179, 3798},
-	{0x817a, 3799},
-	{0x817f, 4218},
-	{0x8180, 4214},
-	{0x8182, 4219},
-	{0x8188, 4216},
-	{0x818a, 4217},
-	{0x818f, 4215},
-	{0x8198, 4591},
-	{0x819a, 4590},
-	{0x819b, 4586},
-	{0x819c, 4587},
-	{0x819d, 4588},
-	{0x81a0, 4589},
-	{0x81a8, 4913},
-	{0x81a9, 4912},
-	{0x81b3, 4911},
-	{0x81ba, 5200},
-	{0x81bd, 5204},
-	{0x81be, 5206},
-	{0x81bf, 5203},
-	{0x81c0, 5202},
-	{0x81c2, 5201},
-	{0x81c3, 5199},
-	{0x81c6, 5198},
-	{0x81c9, 5205},
-	{0x81cd, 5400},
-	{0x81cf, 5401},
-	{0x81d2, 0},
-	{0x81d8, 5555},
-	{0x81da, 5685},
-	{0x81df, 5844},
-	{0x81e1, 0},
-	{0x81e2, 5894},
-	{0x81e3, 1029},
-	{0x81e5, 1654},
-	{0x81e6, 8838},
-	{0x81e7, 4220},
-	{0x81e8, 5207},
-	{0x81ea, 1030},
-	{0x81ec, 2453},
-	{0x81ed, 2452},
-	{0x81ee, 8839},
-	{0x81f3, 1031},
-	{0x81f4, 2023},
-	{0x81f7, 8840},
-	{0x81f8, 8841},
-	{0x81f9, 8842},
-	{0x81fa, 4221},
-	{0x81fb, 4914},
-	{0x81fc, 1032},
-	{0x81fe, 1655},
-	{0x81ff, 7134},
-	{0x8200, 2454},
-	{0x8201, 7613},
-	{0x8202, 2929},
-	{0x8204, 8843},
-	{0x8205, 3801},
-	{0x8207, 4222},
-	{0x8208, 4915},
-	{0x8209, 5208},
-	{0x820a, 5402},
-	{0x820c, 1033},
-	{0x820d, 1656},
-	{0x8210, 2455},
-	{0x8211, 8211},
-	{0x8212, 3372},
-	{0x8214, 4223},
-	{0x821b, 1034},
-	{0x821c, 3373},
-	{0x821d, 9513},
-	{0x821e, 4224},
-	{0x821f, 1035},
-	{0x8220, 6702},
-	{0x8221, 7135},
-	{0x8222, 2024},
-	{0x8225, 7615},
-	{0x8228, 2458},
-	{0x822a, 2456},
-	{0x822b, 2457},
-	{0x822c, 2459},
-	{0x822f, 7614},
-	{0x8232, 8216},
-	{0x8233, 8213},
-	{0x8234, 8215},
-	{0x8235, 2930},
-	{0x8236, 2932},
-	{0x8237, 2931},
-	{0x8238, 8212},
-	{0x8239, 2933},
-	{0x823a, 8214},
-	{0x823c, 8844},
-	{0x823d, 8845},
-	{0x823f, 8846},
-	{0x8240, 9516},
-	{0x8242, 9517},
-	{0x8244, 9515},
-	{0x8245, 9518},
-	{0x8247, 3802},
-	{0x8249, 9514},
-	{0x824b, 4225},
-	{0x8256, 0},
-	{0x8257, 1},
-	{0x8258, 4916},
-	{0x8259, 4917},
-	{0x8266, 5686},
-	{0x8269, 0},
-	{0x826e, 1036},
-	{0x826f, 1284},
-	{0x8271, 5209},
-	{0x8272, 1037},
-	{0x8274, 8217},
-	{0x8275, 8847},
-	{0x8277, 5934},
-	{0x8278, 6163},
-	{0x827c, 6164},
-	{0x827d, 6166},
-	{0x827e, 1038},
-	{0x827f, 6167},
-	{0x8280, 6165},
-	{0x8283, 6373},
-	{0x8284, 6374},
-	{0x8285, 6368},
-	{0x828a, 6372},
-	{0x828b, 1286},
-	{0x828d, 1287},
-	{0x828e, 6369},
-	{0x828f, 6367},
-	{0x8290, 6366},
-	{0x8291, 6370},
-	{0x8292, 1285},
-	{0x8293, 6371},
-	{0x8294, 7136},
-	{0x8298, 6707},
-	{0x8299, 1659},
-	{0x829a, 6706},
-	{0x829b, 6708},
-	{0x829d, 1658},
-	{0x829e, 6713},
-	{0x829f, 1662},
-	{0x82a0, 6703},
-	{0x82a1, 6717},
-	{0x82a2, 6723},
-	{0x82a3, 1669},
-	{0x82a4, 6720},
-	{0x82a5, 1666},
-	{0x82a7, 6710},
-	{0x82a8, 6716},
-	{0x82a9, 6718},
-	{0x82ab, 6705},
-	{0x82ac, 1665},
-	{0x82ad, 1660},
-	{0x82ae, 6711},
-	{0x82af, 1667},
-	{0x82b0, 1670},
-	{0x82b1, 1664},
-	{0x82b3, 1657},
-	{0x82b4, 6715},
-	{0x82b5, 6709},
-	{0x82b6, 6722},
-	{0x82b7, 1672},
-	{0x82b8, 1668},
-	{0x82b9, 1663},
-	{0x82ba, 6714},
-	{0x82bb, 2460},
-	{0x82bc, 6712},
-	{0x82bd, 1661},
-	{0x82be, 1671},
-	{0x82c0, 6704},
-	{0x82c2, 6719},
-	{0x82c3, 6721},
-	{0x82d1, 2041},
-	{0x82d2, 2035},
-	{0x82d3, 2043},
-	{0x82d4, 2040},
-	{0x82d5, 7143},
-	{0x82d6, 7146},
-	{0x82d7, 2036},
-	{0x82d9, 7137},
-	{0x82db, 2029},
-	{0x82dc, 2039},
-	{0x82de, 2042},
-	{0x82df, 2044},
-	{0x82e0, 7158},
-	{0x82e1, 7149},
-	{0x82e3, 2028},
-	{0x82e4, 7157},
-	{0x82e5, 2032},
-	{0x82e6, 2030},
-	{0x82e7, 2025},
-	{0x82e8, 7141},
-	{0x82ea, 7156},
-	{0x82eb, 7145},
-	{0x82ec, 7148},
-	{0x82ed, 7161},
-	{0x82ef, 2045},
-	{0x82f0, 7155},
-	{0x82f1, 2037},
-	{0x82f2, 7150},
-	{0x82f3, 7160},
-	{0x82f4, 7147},
-	{0x82f5, 7151},
-	{0x82f6, 7154},
-	{0x82f9, 7139},
-	{0x82fa, 7159},
-	{0x82fb, 7153},
-	{0x82fe, 7138},
-	{0x8300, 7142},
-	{0x8301, 2038},
-	{0x8302, 2033},
-	{0x8303, 2026},
-	{0x8304, 2031},
-	{0x8305, 2027},
-	{0x8306, 2046},
-	{0x8307, 7140},
-	{0x8308, 7632},
-	{0x8309, 2034},
-	{0x830c, 7152},
-	{0x830d, 6781},
-	{0x8316, 7635},
-	{0x8317, 2474},
-	{0x8319, 7619},
-	{0x831b, 7630},
-	{0x831c, 7626},
-	{0x831e, 7645},
-	{0x8320, 7637},
-	{0x8322, 7627},
-	{0x8324, 7636},
-	{0x8325, 7621},
-	{0x8326, 7625},
-	{0x8327, 7648},
-	{0x8328, 2477},
-	{0x8329, 7640},
-	{0x832a, 7631},
-	{0x832b, 2461},
-	{0x832c, 7646},
-	{0x832d, 7617},
-	{0x832f, 7639},
-	{0x8331, 2476},
-	{0x8332, 2471},
-	{0x8333, 7616},
-	{0x8334, 2469},
-	{0x8335, 2468},
-	{0x8336, 2473},
-	{0x8337, 7638},
-	{0x8338, 2465},
-	{0x8339, 2472},
-	{0x833a, 7144},
-	{0x833b, 8848},
-	{0x833c, 7633},
-	{0x833f, 7623},
-	{0x8340, 2475},
-	{0x8341, 7624},
-	{0x8342, 7628},
-	{0x8343, 2478},
-	{0x8344, 7618},
-	{0x8345, 7642},
-	{0x8347, 7641},
-	{0x8348, 7649},
-	{0x8349, 2467},
-	{0x834a, 2464},
-	{0x834b, 7647},
-	{0x834c, 7643},
-	{0x834d, 7634},
-	{0x834e, 7629},
-	{0x834f, 2470},
-	{0x8350, 2466},
-	{0x8351, 7620},
-	{0x8352, 2462},
-	{0x8353, 7644},
-	{0x8354, 2463},
-	{0x8356, 7622},
-	{0x8373, 8223},
-	{0x8374, 8225},
-	{0x8375, 8230},
-	{0x8376, 8250},
-	{0x8377, 2947},
-	{0x8378, 2937},
-	{0x837a, 8222},
-	{0x837b, 2948},
-	{0x837c, 2949},
-	{0x837d, 8233},
-	{0x837e, 8240},
-	{0x837f, 8246},
-	{0x8381, 8227},
-	{0x8383, 8234},
-	{0x8386, 2950},
-	{0x8387, 8248},
-	{0x8388, 8243},
-	{0x8389, 2945},
-	{0x838a, 2943},
-	{0x838b, 8239},
-	{0x838c, 8235},
-	{0x838d, 8221},
-	{0x838e, 2934},
-	{0x838f, 8226},
-	{0x8390, 8218},
-	{0x8392, 2942},
-	{0x8393, 2944},
-	{0x8394, 8231},
-	{0x8395, 8228},
-	{0x8396, 2939},
-	{0x8397, 8244},
-	{0x8398, 2936},
-	{0x8399, 8229},
-	{0x839a, 8889},
-	{0x839b, 8237},
-	{0x839d, 8236},
-	{0x839e, 2935},
-	{0x83a0, 2946},
-	{0x83a2, 2938},
-	{0x83a3, 8219},
-	{0x83a4, 8224},
-	{0x83a5, 8241},
-	{0x83a6, 8247},
-	{0x83a7, 2951},
-	{0x83a8, 8220},
-	{0x83a9, 8232},
-	{0x83aa, 8238},
-	{0x83ab, 2941},
-	{0x83ae, 8249},
-	{0x83af, 8242},
-	{0x83b0, 8245},
-	{0x83bd, 2940},
-	{0x83bf, 8864},
-	{0x83c0, 8852},
-	{0x83c1, 3381},
-	{0x83c2, 8881},
-	{0x83c3, 8890},
-	{0x83c4, 8893},
-	{0x83c5, 3379},
-	{0x83c6, 8860},
-	{0x83c7, 8885},
-	{0x83c8, 8861},
-	{0x83c9, 8875},
-	{0x83ca, 3392},
-	{0x83cb, 8871},
-	{0x83cc, 3389},
-	{0x83ce, 8872},
-	{0x83cf, 8849},
-	{0x83d1, 8886},
-	{0x83d4, 3398},
-	{0x83d5, 8883},
-	{0x83d6, 8873},
-	{0x83d7, 8895},
-	{0x83d8, 8868},
-	{0x83d9, 9550},
-	{0x83db, 8898},
-	{0x83dc, 3396},
-	{0x83dd, 8866},
-	{0x83de, 8878},
-	{0x83df, 3399},
-	{0x83e0, 3378},
-	{0x83e1, 8870},
-	{0x83e2, 8896},
-	{0x83e3, 8863},
-	{0x83e4, 8856},
-	{0x83e5, 8867},
-	{0x83e7, 8855},
-	{0x83e8, 8853},
-	{0x83e9, 3374},
-	{0x83ea, 8887},
-	{0x83eb, 8862},
-	{0x83ec, 8891},
-	{0x83ee, 8892},
-	{0x83ef, 3382},
-	{0x83f0, 3387},
-	{0x83f1, 3383},
-	{0x83f2, 3391},
-	{0x83f3, 8882},
-	{0x83f4, 3384},
-	{0x83f5, 8874},
-	{0x83f6, 8858},
-	{0x83f8, 3376},
-	{0x83f9, 8850},
-	{0x83fa, 8884},
-	{0x83fb, 8894},
-	{0x83fc, 8857},
-	{0x83fd, 3390},
-	{0x83fe, 8899},
-	{0x83ff, 8869},
-	{0x8401, 8865},
-	{0x8403, 3375},
-	{0x8404, 3395},
-	{0x8406, 8880},
-	{0x8407, 3397},
-	{0x8409, 8876},
-	{0x840a, 3386},
-	{0x840b, 3380},
-	{0x840c, 3388},
-	{0x840d, 3377},
-	{0x840e, 3394},
-	{0x840f, 8877},
-	{0x8410, 8859},
-	{0x8411, 8879},
-	{0x8412, 8854},
-	{0x8413, 8888},
-	{0x841b, 8897},
-	{0x8423, 8851},
-	{0x8429, 9549},
-	{0x842b, 9571},
-	{0x842c, 3756},
-	{0x842d, 9554},
-	{0x842f, 9552},
-	{0x8430, 9531},
-	{0x8431, 3806},
-	{0x8432, 9547},
-	{0x8433, 9567},
-	{0x8434, 9543},
-	{0x8435, 3814},
-	{0x8436, 9566},
-	{0x8437, 9541},
-	{0x8438, 3393},
-	{0x8439, 9557},
-	{0x843a, 9542},
-	{0x843b, 9564},
-	{0x843c, 3813},
-	{0x843d, 3805},
-	{0x843f, 9520},
-	{0x8440, 9528},
-	{0x8442, 9553},
-	{0x8443, 9545},
-	{0x8444, 9570},
-	{0x8445, 9548},
-	{0x8446, 3819},
-	{0x8447, 9565},
-	{0x8449, 3810},
-	{0x844b, 9551},
-	{0x844c, 9559},
-	{0x844d, 9532},
-	{0x844e, 9558},
-	{0x8450, 9575},
-	{0x8451, 9527},
-	{0x8452, 9560},
-	{0x8454, 9573},
-	{0x8456, 9521},
-	{0x8457, 3385},
-	{0x8459, 9535},
-	{0x845a, 9534},
-	{0x845b, 3812},
-	{0x845d, 9538},
-	{0x845e, 9540},
-	{0x845f, 9555},
-	{0x8460, 9572},
-	{0x8461, 3815},
-	{0x8463, 3816},
-	{0x8465, 9526},
-	{0x8466, 3808},
-	{0x8467, 9530},
-	{0x8468, 9568},
-	{0x8469, 3817},
-	{0x846b, 3809},
-	{0x846c, 3811},
-	{0x846d, 3818},
-	{0x846e, 9574},
-	{0x846f, 9561},
-	{0x8470, 9556},
-	{0x8473, 9537},
-	{0x8474, 9536},
-	{0x8475, 3807},
-	{0x8476, 9522},
-	{0x8477, 3804},
-	{0x8478, 9546},
-	{0x8479, 9523},
-	{0x847a, 9544},
-	{0x847d, 9533},
-	{0x847e, 9569},
-	{0x8482, 3803},
-	{0x8486, 9529},
-	{0x848d, 9525},
-	{0x848e, 9563},
-	{0x848f, 9524},
-	{0x8490, 4238},
-	{0x8499, 4230},
-	{0x849c, 4233},
-	{0x849e, 4231},
-	{0x84b2, 4232},
-	{0x84b8, 4235},
-	{0x84bc, 4239},
-	{0x84bf, 4227},
-	{0x84c0, 4236},
-	{0x84c4, 4229},
-	{0x84c5, 9562},
-	{0x84c6, 4228},
-	{0x84c9, 4226},
-	{0x84ca, 4241},
-	{0x84cb, 4234},
-	{0x84d1, 4240},
-	{0x84d3, 4237},
-	{0x84e8, 0},
-	{0x84ec, 4603},
-	{0x84ee, 4595},
-	{0x84f1, 9519},
-	{0x84ff, 4605},
-	{0x8506, 4606},
-	{0x8507, 9539},
-	{0x8511, 4599},
-	{0x8513, 4598},
-	{0x8514, 4602},
-	{0x8517, 4592},
-	{0x851a, 4594},
-	{0x8521, 4601},
-	{0x8523, 4600},
-	{0x8525, 4604},
-	{0x852c, 4596},
-	{0x852d, 4597},
-	{0x853d, 4593},
-	{0x8543, 4923},
-	{0x8548, 4920},
-	{0x8549, 4924},
-	{0x854a, 4918},
-	{0x8559, 4919},
-	{0x855e, 4927},
-	{0x8568, 4921},
-	{0x8569, 4922},
-	{0x856a, 4926},
-	{0x856d, 4925},
-	{0x8570, 0},
-	{0x857e, 5212},
-	{0x8584, 5211},
-	{0x8587, 5218},
-	{0x858a, 5220},
-	{0x8591, 5214},
-	{0x8594, 5215},
-	{0x859b, 5217},
-	{0x859c, 5213},
-	{0x85a6, 5221},
-	{0x85a8, 5219},
-	{0x85a9, 5404},
-	{0x85aa, 5210},
-	{0x85af, 5216},
-	{0x85b0, 5408},
-	{0x85b9, 5410},
-	{0x85ba, 5409},
-	{0x85c9, 5407},
-	{0x85cd, 5405},
-	{0x85cf, 5403},
-	{0x85d0, 5406},
-	{0x85d5, 5559},
-	{0x85dd, 5557},
-	{0x85e4, 5560},
-	{0x85e5, 5561},
-	{0x85e9, 5556},
-	{0x85ea, 5558},
-	{0x85f7, 5562},
-	{0x85f9, 5688},
-	{0x85fa, 5690},
-	{0x85fb, 5687},
-	{0x8606, 5691},
-	{0x8607, 5693},
-	{0x860a, 5694},
-	{0x860b, 5692},
-	{0x8611, 5689},
-	{0x8617, 5765},
-	{0x861a, 5767},
-	{0x862d, 5766},
-	{0x8635, 0},
-	{0x8638, 5895},
-	{0x863f, 5896},
-	{0x8647, 0},
-	{0x8648, 1},
-	{0x864d, 6168},
-	{0x864e, 1673},
-	{0x8650, 2047},
-	{0x8652, 7651},
-	{0x8653, 7650},
-	{0x8654, 2479},
-	{0x8655, 2952},
-	{0x8656, 8252},
-	{0x8659, 8251},
-	{0x865b, 3400},
-	{0x865c, 3821},
-	{0x865e, 3820},
-	{0x865f, 3822},
-	{0x8667, 5222},
-	{0x866b, 1039},
-	{0x866d, 6726},
-	{0x866e, 6727},
-	{0x866f, 6725},
-	{0x8670, 6724},
-	{0x8671, 1674},
-	{0x8673, 7165},
-	{0x8674, 7163},
-	{0x8677, 7162},
-	{0x8679, 2048},
-	{0x867a, 2050},
-	{0x867b, 2049},
-	{0x867c, 7164},
-	{0x8685, 7663},
-	{0x8686, 7660},
-	{0x8687, 7658},
-	{0x868a, 2480},
-	{0x868b, 7661},
-	{0x868c, 2485},
-	{0x868d, 7655},
-	{0x868e, 7670},
-	{0x8690, 7672},
-	{0x8691, 7656},
-	{0x8693, 2482},
-	{0x8694, 7673},
-	{0x8695, 7668},
-	{0x8696, 7654},
-	{0x8697, 7659},
-	{0x8698, 7669},
-	{0x8699, 7665},
-	{0x869a, 7662},
-	{0x869c, 2487},
-	{0x869d, 7671},
-	{0x869e, 7657},
-	{0x86a1, 7666},
-	{0x86a2, 7652},
-	{0x86a3, 2486},
-	{0x86a4, 2483},
-	{0x86a5, 7664},
-	{0x86a7, 7667},
-	{0x86a8, 7653},
-	{0x86a9, 2484},
-	{0x86aa, 2481},
-	{0x86af, 2962},
-	{0x86b0, 8259},
-	{0x86b1, 2961},
-	{0x86b3, 8262},
-	{0x86b4, 8265},
-	{0x86b5, 2958},
-	{0x86b6, 2956},
-	{0x86b7, 8254},
-	{0x86b8, 8263},
-	{0x86b9, 8261},
-	{0x86ba, 8258},
-	{0x86bb, 8266},
-	{0x86bc, 8267},
-	{0x86bd, 8269},
-	{0x86be, 8270},
-	{0x86bf, 8253},
-	{0x86c0, 2955},
-	{0x86c1, 8256},
-	{0x86c2, 8255},
-	{0x86c3, 8268},
-	{0x86c4, 2957},
-	{0x86c5, 8257},
-	{0x86c6, 2959},
-	{0x86c7, 2954},
-	{0x86c8, 8260},
-	{0x86c9, 2963},
-	{0x86cb, 2960},
-	{0x86cc, 8264},
-	{0x86d0, 3407},
-	{0x86d1, 8914},
-	{0x86d3, 8903},
-	{0x86d4, 3404},
-	{0x86d6, 9581},
-	{0x86d7, 8912},
-	{0x86d8, 8900},
-	{0x86d9, 3402},
-	{0x86da, 8905},
-	{0x86db, 3405},
-	{0x86dc, 8909},
-	{0x86dd, 8907},
-	{0x86de, 3408},
-	{0x86df, 3401},
-	{0x86e2, 8901},
-	{0x86e3, 8904},
-	{0x86e4, 3406},
-	{0x86e6, 8902},
-	{0x86e8, 8913},
-	{0x86e9, 8911},
-	{0x86ea, 8906},
-	{0x86eb, 8908},
-	{0x86ec, 8910},
-	{0x86ed, 3403},
-	{0x86f5, 9582},
-	{0x86f6, 9588},
-	{0x86f7, 9578},
-	{0x86f8, 9584},
-	{0x86f9, 3823},
-	{0x86fa, 9580},
-	{0x86fb, 3829},
-	{0x86fe, 3828},
-	{0x8700, 3827},
-	{0x8701, 9587},
-	{0x8702, 3830},
-	{0x8703, 3831},
-	{0x8704, 9577},
-	{0x8705, 9590},
-	{0x8706, 3832},
-	{0x8707, 3826},
-	{0x8708, 3825},
-	{0x8709, 9586},
-	{0x870a, 3833},
-	{0x870b, 9576},
-	{0x870c, 9579},
-	{0x870d, 9589},
-	{0x870e, 9585},
-	{0x8713, 3824},
-	{0x8718, 4248},
-	{0x871c, 4243},
-	{0x8722, 4245},
-	{0x8725, 4246},
-	{0x8727, 0},
-	{0x8729, 4251},
-	{0x8734, 4247},
-	{0x8737, 4250},
-	{0x873b, 4244},
-	{0x873f, 4242},
-	{0x874c, 4616},
-	{0x874d, 9583},
-	{0x8753, 4617},
-	{0x8755, 4249},
-	{0x8757, 4615},
-	{0x8759, 4614},
-	{0x8760, 4610},
-	{0x8764, 0},
-	{0x8766, 4611},
-	{0x8768, 4613},
-	{0x8774, 4608},
-	{0x8776, 4609},
-	{0x8778, 4612},
-	{0x8782, 4607},
-	{0x8783, 4928},
-	{0x878d, 4932},
-	{0x8791, 0},
-	{0x879e, 4930},
-	{0x879f, 4929},
-	{0x87a2, 4931},
-	{0x87ab, 5228},
-	{0x87b3, 5225},
-	{0x87ba, 5230},
-	{0x87bb, 5229},
-	{0x87c0, 5223},
-	{0x87c6, 5227},
-	{0x87c8, 5231},
-	{0x87cb, 5232},
-	{0x87d1, 5224},
-	{0x87d2, 5226},
-	{0x87e0, 5414},
-	{0x87ec, 5412},
-	{0x87ef, 5411},
-	{0x87f2, 5413},
-	{0x87f7, 0},
-	{0x87f9, 5566},
-	{0x87fb, 5563},
-	{0x87fe, 5567},
-	{0x8805, 5564},
-	{0x880d, 5565},
-	{0x8811, 0},
-	{0x8814, 5695},
-	{0x8815, 5696},
-	{0x881f, 5771},
-	{0x8821, 5770},
-	{0x8822, 5769},
-	{0x8823, 5768},
-	{0x8831, 5897},
-	{0x8836, 5928},
-	{0x8839, 5929},
-	{0x883b, 5959},
-	{0x8840, 1040},
-	{0x8841, 7166},
-	{0x8843, 7674},
-	{0x8844, 7675},
-	{0x8846, 0},
-	{0x8848, 8915},
-	{0x884c, 1041},
-	{0x884d, 2051},
-	{0x884e, 7167},
-	{0x8852, 8271},
-	{0x8853, 2964},
-	{0x8855, 8917},
-	{0x8856, 8916},
-	{0x8857, 3409},
-	{0x8859, 3834},
-	{0x885b, 4618},
-	{0x885d, 4619},
-	{0x8861, 4933},
-	{0x8862, 5930},
-	{0x8863, 1042},
-	{0x8867, 7168},
-	{0x8868, 1676},
-	{0x8869, 7170},
-	{0x886a, 7169},
-	{0x886b, 2052},
-	{0x886d, 7676},
-	{0x886f, 7683},
-	{0x8870, 2488},
-	{0x8871, 7681},
-	{0x8872, 7679},
-	{0x8874, 7686},
-	{0x8875, 7677},
-	{0x8876, 7678},
-	{0x8877, 2489},
-	{0x8879, 2493},
-	{0x887c, 7687},
-	{0x887d, 2492},
-	{0x887e, 7685},
-	{0x887f, 7682},
-	{0x8880, 7680},
-	{0x8881, 2490},
-	{0x8882, 2491},
-	{0x8883, 7684},
-	{0x8888, 2966},
-	{0x8889, 8272},
-	{0x888b, 2971},
-	{0x888c, 8288},
-	{0x888d, 2970},
-	{0x888e, 8290},
-	{0x8891, 8278},
-	{0x8892, 2968},
-	{0x8893, 8289},
-	{0x8895, 8273},
-	{0x8896, 2969},
-	{0x8897, 8285},
-	{0x8898, 8281},
-	{0x8899, 8283},
-	{0x889a, 8277},
-	{0x889b, 8284},
-	{0x889e, 2965},
-	{0x889f, 8280},
-	{0x88a1, 8279},
-	{0x88a2, 8275},
-	{0x88a4, 8286},
-	{0x88a7, 8282},
-	{0x88a8, 8274},
-	{0x88aa, 8276},
-	{0x88ab, 2967},
-	{0x88ac, 8287},
-	{0x88b1, 3412},
-	{0x88b2, 8928},
-	{0x88b5, 0},
-	{0x88b6, 8924},
-	{0x88b7, 8926},
-	{0x88b8, 8921},
-	{0x88b9, 8920},
-	{0x88ba, 8918},
-	{0x88bc, 8925},
-	{0x88bd, 8927},
-	{0x88be, 8923},
-	{0x88c0, 8922},
-	{0x88c1, 3410},
-	{0x88c2, 3411},
-	{0x88c9, 8930},
-	{0x88ca, 3842},
-	{0x88cb, 9592},
-	{0x88cc, 9598},
-	{0x88cd, 9593},
-	{0x88ce, 9594},
-	{0x88d0, 9599},
-	{0x88d2, 3844},
-	{0x88d4, 3836},
-	{0x88d5, 3843},
-	{0x88d6, 9591},
-	{0x88d7, 8919},
-	{0x88d8, 3839},
-	{0x88d9, 3837},
-	{0x88da, 9597},
-	{0x88db, 9596},
-	{0x88dc, 3838},
-	{0x88dd, 3840},
-	{0x88de, 9595},
-	{0x88df, 3835},
-	{0x88e1, 3841},
-	{0x88e8, 4258},
-	{0x88ef, 4260},
-	{0x88f2, 0},
-	{0x88f3, 4252},
-	{0x88f4, 4254},
-	{0x88f8, 4256},
-	{0x88f9, 4255},
-	{0x88fd, 4257},
-	{0x8901, 8929},
-	{0x8902, 4253},
-	{0x8907, 4621},
-	{0x890a, 4625},
-	{0x8910, 4620},
-	{0x8912, 4622},
-	{0x8913, 4623},
-	{0x8915, 4624},
-	{0x8918, 0},
-	{0x8919, 1},
-	{0x891a, 4259},
-	{0x8921, 4938},
-	{0x8925, 4936},
-	{0x892a, 4934},
-	{0x892b, 4937},
-	{0x892e, 0},
-	{0x8932, 4935},
-	{0x8936, 5234},
-	{0x8938, 5236},
-	{0x893b, 5233},
-	{0x893d, 5237},
-	{0x8944, 5235},
-	{0x8951, 0},
-	{0x8956, 5570},
-	{0x895b, 0},
-	{0x895e, 5571},
-	{0x895f, 5569},
-	{0x8960, 5568},
-	{0x8964, 5697},
-	{0x896a, 5772},
-	{0x896c, 5773},
-	{0x896f, 5846},
-	{0x8972, 5845},
-	{0x897a, 0},
-	{0x897e, 6169},
-	{0x897f, 1043},
-	{0x8981, 2053},
-	{0x8982, 8291},
-	{0x8983, 3413},
-	{0x8985, 9600},
-	{0x8986, 5415},
-	{0x898b, 1288},
-	{0x898f, 2973},
-	{0x8993, 2972},
-	{0x8995, 8931},
-	{0x8996, 3414},
-	{0x8997, 8933},
-	{0x8998, 8932},
-	{0x899b, 9601},
-	{0x899c, 3845},
-	{0x89a6, 4940},
-	{0x89aa, 4939},
-	{0x89ac, 5238},
-	{0x89b2, 5416},
-	{0x89ba, 5698},
-	{0x89bd, 5774},
-	{0x89c0, 5960},
-	{0x89d2, 1289},
-	{0x89d3, 7171},
-	{0x89d4, 2054},
-	{0x89d5, 8294},
-	{0x89d6, 8292},
-	{0x89d9, 8293},
-	{0x89da, 8935},
-	{0x89db, 8936},
-	{0x89dc, 9608},
-	{0x89dd, 8934},
-	{0x89df, 9602},
-	{0x89e0, 9606},
-	{0x89e1, 9605},
-	{0x89e2, 9607},
-	{0x89e3, 3846},
-	{0x89e4, 9604},
-	{0x89e5, 9603},
-	{0x89e6, 9609},
-	{0x89f3, 0},
-	{0x89f4, 5417},
-	{0x89f8, 5699},
-	{0x89fc, 5847},
-	{0x8a00, 1290},
-	{0x8a02, 2056},
-	{0x8a03, 2057},
-	{0x8a04, 7172},
-	{0x8a07, 7173},
-	{0x8a08, 2055},
-	{0x8a0a, 2499},
-	{0x8a0c, 2497},
-	{0x8a0e, 2496},
-	{0x8a0f, 2503},
-	{0x8a10, 2495},
-	{0x8a11, 2504},
-	{0x8a12, 7688},
-	{0x8a13, 2501},
-	{0x8a15, 2498},
-	{0x8a16, 2502},
-	{0x8a17, 2500},
-	{0x8a18, 2494},
-	{0x8a1b, 2981},
-	{0x8a1d, 2975},
-	{0x8a1e, 8298},
-	{0x8a1f, 2980},
-	{0x8a22, 2982},
-	{0x8a23, 2976},
-	{0x8a25, 2977},
-	{0x8a27, 8296},
-	{0x8a2a, 2974},
-	{0x8a2c, 8297},
-	{0x8a2d, 2979},
-	{0x8a30, 8295},
-	{0x8a31, 2978},
-	{0x8a34, 3425},
-	{0x8a36, 3427},
-	{0x8a39, 8939},
-	{0x8a3a, 3426},
-	{0x8a3b, 3415},
-	{0x8a3c, 3419},
-	{0x8a3e, 3865},
-	{0x8a3f, 9614},
-	{0x8a40, 8941},
-	{0x8a41, 3420},
-	{0x8a44, 8944},
-	{0x8a45, 8945},
-	{0x8a46, 3424},
-	{0x8a48, 8947},
-	{0x8a4a, 8949},
-	{0x8a4c, 8950},
-	{0x8a4d, 8938},
-	{0x8a4e, 8937},
-	{0x8a4f, 8951},
-	{0x8a50, 3423},
-	{0x8a51, 8948},
-	{0x8a52, 8946},
-	{0x8a54, 3421},
-	{0x8a55, 3417},
-	{0x8a56, 3428},
-	{0x8a57, 8942},
-	{0x8a58, 8943},
-	{0x8a59, 8940},
-	{0x8a5b, 3422},
-	{0x8a5e, 3418},
-	{0x8a60, 3416},
-	{0x8a61, 9613},
-	{0x8a62, 3860},
-	{0x8a63, 3855},
-	{0x8a66, 3850},
-	{0x8a68, 3866},
-	{0x8a69, 3851},
-	{0x8a6b, 3847},
-	{0x8a6c, 3862},
-	{0x8a6d, 3859},
-	{0x8a6e, 3861},
-	{0x8a70, 3852},
-	{0x8a71, 3857},
-	{0x8a72, 3848},
-	{0x8a73, 3849},
-	{0x8a74, 9621},
-	{0x8a75, 9618},
-	{0x8a76, 9610},
-	{0x8a77, 9615},
-	{0x8a79, 3863},
-	{0x8a7a, 9622},
-	{0x8a7b, 3864},
-	{0x8a7c, 3854},
-	{0x8a7f, 9612},
-	{0x8a81, 9620},
-	{0x8a82, 9616},
-	{0x8a83, 9619},
-	{0x8a84, 9617},
-	{0x8a85, 3858},
-	{0x8a86, 9611},
-	{0x8a87, 3853},
-	{0x8a8c, 4262},
-	{0x8a8d, 4265},
-	{0x8a91, 4273},
-	{0x8a93, 4267},
-	{0x8a95, 4630},
-	{0x8a98, 4272},
-	{0x8a9a, 4274},
-	{0x8a9e, 4263},
-	{0x8aa0, 3856},
-	{0x8aa1, 4266},
-	{0x8aa3, 4264},
-	{0x8aa4, 4268},
-	{0x8aa5, 4270},
-	{0x8aa6, 4261},
-	{0x8aa7, 4275},
-	{0x8aa8, 4271},
-	{0x8aaa, 4269},
-	{0x8ab0, 4637},
-	{0x8ab2, 4633},
-	{0x8ab6, 4640},
-	{0x8ab9, 4641},
-	{0x8abc, 4626},
-	{0x8abf, 4636},
-	{0x8ac2, 4635},
-	{0x8ac4, 4629},
-	{0x8ac7, 4628},
-	{0x8ac9, 4634},
-	{0x8acb, 4631},
-	{0x8acd, 4639},
-	{0x8ad2, 4627},
-	{0x8ad5, 0},
-	{0x8ad6, 4638},
-	{0x8adb, 4642},
-	{0x8adc, 4946},
-	{0x8ae6, 4941},
-	{0x8ae7, 4947},
-	{0x8aeb, 4943},
-	{0x8aed, 4953},
-	{0x8aee, 4948},
-	{0x8af1, 4944},
-	{0x8af3, 4954},
-	{0x8af5, 0},
-	{0x8af6, 4955},
-	{0x8af7, 4952},
-	{0x8af8, 4632},
-	{0x8afa, 4942},
-	{0x8afc, 4956},
-	{0x8afe, 4949},
-	{0x8b00, 4945},
-	{0x8b01, 4950},
-	{0x8b02, 4951},
-	{0x8b04, 5246},
-	{0x8b0a, 5243},
-	{0x8b0e, 5239},
-	{0x8b10, 5247},
-	{0x8b17, 5240},
-	{0x8b19, 5241},
-	{0x8b1b, 5242},
-	{0x8b1d, 5245},
-	{0x8b20, 5244},
-	{0x8b28, 5418},
-	{0x8b2b, 5421},
-	{0x8b2c, 5420},
-	{0x8b39, 5419},
-	{0x8b41, 5572},
-	{0x8b46, 5579},
-	{0x8b49, 5575},
-	{0x8b4d, 0},
-	{0x8b4e, 5577},
-	{0x8b4f, 5578},
-	{0x8b58, 5574},
-	{0x8b59, 5580},
-	{0x8b5a, 5576},
-	{0x8b5c, 5573},
-	{0x8b5f, 5704},
-	{0x8b66, 5702},
-	{0x8b6b, 5705},
-	{0x8b6c, 5701},
-	{0x8b6f, 5703},
-	{0x8b70, 5700},
-	{0x8b74, 5775},
-	{0x8b77, 5776},
-	{0x8b7b, 0},
-	{0x8b7d, 5777},
-	{0x8b80, 5848},
-	{0x8b8a, 5898},
-	{0x8b92, 5932},
-	{0x8b93, 5931},
-	{0x8b95, 0},
-	{0x8b96, 5933},
-	{0x8b99, 0},
-	{0x8b9a, 5972},
-	{0x8b9c, 5978},
-	{0x8c37, 1291},
-	{0x8c39, 8299},
-	{0x8c3b, 8300},
-	{0x8c3c, 9623},
-	{0x8c3f, 5249},
-	{0x8c41, 5248},
-	{0x8c46, 1292},
-	{0x8c47, 7689},
-	{0x8c48, 2505},
-	{0x8c49, 2983},
-	{0x8c4a, 9625},
-	{0x8c4b, 9624},
-	{0x8c4c, 4643},
-	{0x8c4e, 4644},
-	{0x8c50, 5422},
-	{0x8c54, 5987},
-	{0x8c55, 1293},
-	{0x8c56, 6728},
-	{0x8c57, 7690},
-	{0x8c5a, 2984},
-	{0x8c5c, 8301},
-	{0x8c5d, 8302},
-	{0x8c5f, 8952},
-	{0x8c61, 3429},
-	{0x8c62, 3867},
-	{0x8c64, 9627},
-	{0x8c65, 9626},
-	{0x8c66, 9628},
-	{0x8c69, 0},
-	{0x8c6a, 4276},
-	{0x8c6b, 4957},
-	{0x8c6c, 4645},
-	{0x8c6d, 4958},
-	{0x8c73, 5250},
-	{0x8c78, 6375},
-	{0x8c79, 2507},
-	{0x8c7a, 2506},
-	{0x8c7b, 7691},
-	{0x8c7d, 8303},
-	{0x8c80, 8954},
-	{0x8c81, 8953},
-	{0x8c82, 3430},
-	{0x8c84, 9630},
-	{0x8c85, 9631},
-	{0x8c86, 9629},
-	{0x8c89, 3869},
-	{0x8c8a, 3868},
-	{0x8c8c, 4278},
-	{0x8c8d, 4277},
-	{0x8c92, 0},
-	{0x8c93, 4959},
-	{0x8c9d, 1294},
-	{0x8c9e, 2058},
-	{0x8ca0, 2059},
-	{0x8ca1, 2508},
-	{0x8ca2, 2509},
-	{0x8ca3, 7693},
-	{0x8ca4, 7692},
-	{0x8ca5, 8304},
-	{0x8ca7, 2990},
-	{0x8ca8, 2988},
-	{0x8ca9, 2985},
-	{0x8caa, 2989},
-	{0x8cab, 2987},
-	{0x8cac, 2986},
-	{0x8caf, 3431},
-	{0x8cb0, 8957},
-	{0x8cb2, 3874},
-	{0x8cb3, 3433},
-	{0x8cb4, 3438},
-	{0x8cb5, 8959},
-	{0x8cb6, 3440},
-	{0x8cb7, 3439},
-	{0x8cb8, 3442},
-	{0x8cb9, 8958},
-	{0x8cba, 8955},
-	{0x8cbb, 3436},
-	{0x8cbc, 3432},
-	{0x8cbd, 3434},
-	{0x8cbe, 8956},
-	{0x8cbf, 3441},
-	{0x8cc0, 3437},
-	{0x8cc1, 3435},
-	{0x8cc2, 3876},
-	{0x8cc3, 3875},
-	{0x8cc4, 3873},
-	{0x8cc5, 3877},
-	{0x8cc7, 3871},
-	{0x8cc8, 3872},
-	{0x8cca, 3870},
-	{0x8ccc, 9632},
-	{0x8cd1, 4280},
-	{0x8cd2, 4281},
-	{0x8cd3, 4279},
-	{0x8cdc, 4654},
-	{0x8cde, 4647},
-	{0x8ce0, 4646},
-	{0x8ce1, 4656},
-	{0x8ce2, 4652},
-	{0x8ce3, 4653},
-	{0x8ce4, 4649},
-	{0x8ce6, 4648},
-	{0x8cea, 4655},
-	{0x8cec, 4650},
-	{0x8ced, 4651},
-	{0x8cf4, 4960},
-	{0x8cf8, 5254},
-	{0x8cfa, 5251},
-	{0x8cfb, 5255},
-	{0x8cfc, 5253},
-	{0x8cfd, 5252},
-	{0x8d05, 5423},
-	{0x8d07, 0},
-	{0x8d08, 5581},
-	{0x8d0a, 5582},
-	{0x8d0d, 5707},
-	{0x8d0f, 5706},
-	{0x8d13, 5778},
-	{0x8d16, 5849},
-	{0x8d17, 5850},
-	{0x8d1b, 5935},
-	{0x8d64, 1295},
-	{0x8d66, 2992},
-	{0x8d67, 2991},
-	{0x8d68, 9633},
-	{0x8d69, 9634},
-	{0x8d6b, 4282},
-	{0x8d6d, 4657},
-	{0x8d70, 1296},
-	{0x8d72, 7174},
-	{0x8d73, 2061},
-	{0x8d74, 2060},
-	{0x8d76, 7694},
-	{0x8d77, 2510},
-	{0x8d78, 7695},
-	{0x8d79, 8307},
-	{0x8d7b, 8306},
-	{0x8d7d, 8305},
-	{0x8d80, 8961},
-	{0x8d81, 3445},
-	{0x8d84, 8960},
-	{0x8d85, 3444},
-	{0x8d89, 8962},
-	{0x8d8a, 3443},
-	{0x8d8c, 9636},
-	{0x8d8d, 9639},
-	{0x8d8e, 9637},
-	{0x8d8f, 9638},
-	{0x8d90, 9642},
-	{0x8d91, 9635},
-	{0x8d92, 9643},
-	{0x8d93, 9640},
-	{0x8d94, 9641},
-	{0x8d95, 4284},
-	{0x8d99, 4283},
-	{0x8d9f, 4658},
-	{0x8da3, 4659},
-	{0x8da8, 5256},
-	{0x8db3, 1297},
-	{0x8db4, 2062},
-	{0x8db5, 7696},
-	{0x8db6, 7698},
-	{0x8db7, 7697},
-	{0x8db9, 8310},
-	{0x8dba, 2994},
-	{0x8dbc, 8308},
-	{0x8dbe, 2993},
-	{0x8dbf, 8311},
-	{0x8dc1, 8312},
-	{0x8dc2, 8309},
-	{0x8dc5, 8974},
-	{0x8dc6, 3453},
-	{0x8dc7, 8966},
-	{0x8dc8, 8972},
-	{0x8dcb, 3448},
-	{0x8dcc, 3451},
-	{0x8dcd, 8965},
-	{0x8dce, 3446},
-	{0x8dcf, 8969},
-	{0x8dd0, 9649},
-	{0x8dd1, 3450},
-	{0x8dd3, 8964},
-	{0x8dd5, 8970},
-	{0x8dd6, 8967},
-	{0x8dd7, 8973},
-	{0x8dd8, 8963},
-	{0x8dd9, 8971},
-	{0x8dda, 3449},
-	{0x8ddb, 3452},
-	{0x8ddc, 8968},
-	{0x8ddd, 3447},
-	{0x8ddf, 3879},
-	{0x8de0, 9645},
-	{0x8de1, 3878},
-	{0x8de2, 9652},
-	{0x8de3, 9651},
-	{0x8de4, 3885},
-	{0x8de6, 3886},
-	{0x8de7, 9653},
-	{0x8de8, 3880},
-	{0x8de9, 9650},
-	{0x8dea, 3884},
-	{0x8deb, 9655},
-	{0x8dec, 9646},
-	{0x8dee, 9648},
-	{0x8def, 3881},
-	{0x8df0, 9644},
-	{0x8df1, 9647},
-	{0x8df2, 9654},
-	{0x8df3, 3882},
-	{0x8df4, 9656},
-	{0x8dfa, 3883},
-	{0x8dfc, 4285},
-	{0x8e0f, 4664},
-	{0x8e10, 4661},
-	{0x8e1d, 4662},
-	{0x8e1e, 4668},
-	{0x8e1f, 4666},
-	{0x8e21, 4667},
-	{0x8e22, 4663},
-	{0x8e27, 0},
-	{0x8e29, 4665},
-	{0x8e2b, 4660},
-	{0x8e31, 4962},
-	{0x8e34, 4963},
-	{0x8e35, 4966},
-	{0x8e39, 4965},
-	{0x8e3d, 0},
-	{0x8e42, 4964},
-	{0x8e44, 4961},
-	{0x8e48, 5259},
-	{0x8e49, 5257},
-	{0x8e4a, 5260},
-	{0x8e4b, 5258},
-	{0x8e55, 5429},
-	{0x8e59, 5424},
-	{0x8e5f, 5428},
-	{0x8e63, 5425},
-	{0x8e64, 5427},
-	{0x8e66, 5426},
-	{0x8e6c, 5587},
-	{0x8e72, 5584},
-	{0x8e74, 5589},
-	{0x8e76, 5586},
-	{0x8e7a, 5588},
-	{0x8e7c, 5583},
-	{0x8e81, 5709},
-	{0x8e82, 5711},
-	{0x8e85, 5710},
-	{0x8e87, 5585},
-	{0x8e89, 5708},
-	{0x8e8a, 5779},
-	{0x8e8b, 5781},
-	{0x8e8d, 5780},
-	{0x8e91, 5851},
-	{0x8e93, 5852},
-	{0x8e97, 0},
-	{0x8e9f, 0},
-	{0x8ea0, 1},
-	{0x8ea1, 5961},
-	{0x8eaa, 5979},
-	{0x8eab, 1298},
-	{0x8eac, 2511},
-	{0x8eb2, 3887},
-	{0x8eba, 4669},
-	{0x8ec0, 5430},
-	{0x8eca, 1299},
-	{0x8ecb, 1677},
-	{0x8ecc, 2064},
-	{0x8ecd, 2063},
-	{0x8ecf, 2514},
-	{0x8ed1, 7699},
-	{0x8ed2, 2512},
-	{0x8ed3, 7700},
-	{0x8ed4, 2513},
-	{0x8ed7, 8317},
-	{0x8ed8, 8313},
-	{0x8edb, 2995},
-	{0x8edc, 8316},
-	{0x8edd, 8315},
-	{0x8ede, 8314},
-	{0x8edf, 2996},
-	{0x8ee0, 8318},
-	{0x8ee1, 8319},
-	{0x8ee5, 8981},
-	{0x8ee6, 8979},
-	{0x8ee7, 8983},
-	{0x8ee8, 8984},
-	{0x8ee9, 8990},
-	{0x8eeb, 8986},
-	{0x8eec, 8988},
-	{0x8eee, 8980},
-	{0x8eef, 8975},
-	{0x8ef1, 8987},
-	{0x8ef4, 8989},
-	{0x8ef5, 8982},
-	{0x8ef6, 8985},
-	{0x8ef7, 8976},
-	{0x8ef8, 3455},
-	{0x8ef9, 8978},
-	{0x8efa, 8977},
-	{0x8efb, 3454},
-	{0x8efc, 3456},
-	{0x8efe, 3890},
-	{0x8eff, 9658},
-	{0x8f00, 9660},
-	{0x8f01, 9659},
-	{0x8f02, 9664},
-	{0x8f03, 3888},
-	{0x8f05, 9661},
-	{0x8f06, 9657},
-	{0x8f07, 9662},
-	{0x8f08, 9663},
-	{0x8f09, 3889},
-	{0x8f0a, 3891},
-	{0x8f0b, 9665},
-	{0x8f11, 0},
-	{0x8f12, 4287},
-	{0x8f13, 4289},
-	{0x8f14, 4286},
-	{0x8f15, 4288},
-	{0x8f17, 0},
-	{0x8f1b, 4671},
-	{0x8f1c, 4676},
-	{0x8f1d, 4670},
-	{0x8f1e, 4677},
-	{0x8f1f, 4672},
-	{0x8f25, 4678},
-	{0x8f26, 4674},
-	{0x8f29, 4673},
-	{0x8f2a, 4675},
-	{0x8f2f, 4968},
-	{0x8f33, 4970},
-	{0x8f38, 4969},
-	{0x8f3b, 4967},
-	{0x8f3e, 5262},
-	{0x8f3f, 5265},
-	{0x8f42, 5263},
-	{0x8f44, 5261},
-	{0x8f45, 5264},
-	{0x8f47, 0},
-	{0x8f48, 1},
-	{0x8f49, 5431},
-	{0x8f4d, 5432},
-	{0x8f4e, 5591},
-	{0x8f50, 0},
-	{0x8f54, 5590},
-	{0x8f57, 0},
-	{0x8f5f, 5782},
-	{0x8f61, 5853},
-	{0x8f67, 0},
-	{0x8f9b, 1300},
-	{0x8f9c, 3457},
-	{0x8f9f, 3892},
-	{0x8fa3, 4290},
-	{0x8fa6, 4972},
-	{0x8fa8, 4971},
-	{0x8fad, 5592},
-	{0x8fae, 5679},
-	{0x8faf, 5783},
-	{0x8fb0, 1301},
-	{0x8fb1, 2515},
-	{0x8fb2, 3893},
-	{0x8fb5, 560},
-	{0x8fbc, 0},
-	{0x8fbf, 6377},
-	{0x8fc2, 1302},
-	{0x8fc4, 1305},
-	{0x8fc5, 1304},
-	{0x8fc6, 1303},
-	{0x8fc9, 6376},
-	{0x8fcb, 6730},
-	{0x8fcd, 6732},
-	{0x8fce, 1678},
-	{0x8fd1, 1680},
-	{0x8fd2, 6729},
-	{0x8fd3, 6731},
-	{0x8fd4, 1679},
-	{0x8fd5, 6734},
-	{0x8fd6, 6733},
-	{0x8fd7, 6735},
-	{0x8fe0, 7178},
-	{0x8fe1, 7176},
-	{0x8fe2, 2067},
-	{0x8fe3, 7175},
-	{0x8fe4, 2072},
-	{0x8fe5, 2069},
-	{0x8fe6, 2066},
-	{0x8fe8, 2073},
-	{0x8fea, 2068},
-	{0x8feb, 2071},
-	{0x8fed, 2070},
-	{0x8fee, 7177},
-	{0x8ff0, 2065},
-	{0x8ff4, 2521},
-	{0x8ff5, 7702},
-	{0x8ff6, 7708},
-	{0x8ff7, 2518},
-	{0x8ff8, 2525},
-	{0x8ffa, 2520},
-	{0x8ffb, 7705},
-	{0x8ffc, 7707},
-	{0x8ffd, 2523},
-	{0x8ffe, 7701},
-	{0x8fff, 7704},
-	{0x9000, 2519},
-	{0x9001, 2516},
-	{0x9002, 7703},
-	{0x9003, 2522},
-	{0x9004, 7706},
-	{0x9005, 2524},
-	{0x9006, 2517},
-	{0x900b, 8321},
-	{0x900c, 8324},
-	{0x900d, 2998},
-	{0x900f, 3008},
-	{0x9010, 3004},
-	{0x9011, 8322},
-	{0x9014, 3012},
-	{0x9015, 3005},
-	{0x9016, 3010},
-	{0x9017, 3000},
-	{0x9019, 2997},
-	{0x901a, 2999},
-	{0x901b, 3011},
-	{0x901c, 8323},
-	{0x901d, 3003},
-	{0x901e, 3006},
-	{0x901f, 3002},
-	{0x9020, 3007},
-	{0x9021, 8325},
-	{0x9022, 3009},
-	{0x9023, 3001},
-	{0x9024, 8320},
-	{0x902d, 8991},
-	{0x902e, 3458},
-	{0x902f, 8993},
-	{0x9031, 3460},
-	{0x9032, 3462},
-	{0x9034, 8992},
-	{0x9035, 3459},
-	{0x9036, 3463},
-	{0x9038, 3461},
-	{0x903c, 3899},
-	{0x903d, 9670},
-	{0x903e, 3907},
-	{0x903f, 9667},
-	{0x9041, 3908},
-	{0x9042, 3897},
-	{0x9044, 9668},
-	{0x9047, 3902},
-	{0x9049, 9669},
-	{0x904a, 3895},
-	{0x904b, 3894},
-	{0x904d, 3905},
-	{0x904e, 3904},
-	{0x904f, 3903},
-	{0x9050, 3901},
-	{0x9051, 3906},
-	{0x9052, 9666},
-	{0x9053, 3896},
-	{0x9054, 3898},
-	{0x9055, 3900},
-	{0x9058, 4292},
-	{0x9059, 4295},
-	{0x905b, 4299},
-	{0x905c, 4293},
-	{0x905d, 4298},
-	{0x905e, 4296},
-	{0x9060, 4291},
-	{0x9062, 4297},
-	{0x9063, 4294},
-	{0x9068, 4681},
-	{0x9069, 4679},
-	{0x906d, 4682},
-	{0x906e, 4680},
-	{0x9072, 4976},
-	{0x9074, 4974},
-	{0x9075, 4973},
-	{0x9077, 4683},
-	{0x9078, 4975},
-	{0x907a, 4978},
-	{0x907c, 4977},
-	{0x907d, 5267},
-	{0x907f, 5266},
-	{0x9080, 5271},
-	{0x9081, 5269},
-	{0x9082, 5270},
-	{0x9083, 5434},
-	{0x9084, 5268},
-	{0x9087, 5433},
-	{0x9088, 5435},
-	{0x908a, 5593},
-	{0x908b, 5594},
-	{0x908f, 5900},
-	{0x9090, 5899},
-	{0x9091, 1307},
-	{0x9094, 6174},
-	{0x9095, 2526},
-	{0x9097, 6171},
-	{0x9098, 6172},
-	{0x9099, 6170},
-	{0x909b, 6173},
-	{0x909e, 6381},
-	{0x909f, 6378},
-	{0x90a0, 6383},
-	{0x90a1, 6379},
-	{0x90a2, 1308},
-	{0x90a3, 1311},
-	{0x90a5, 6380},
-	{0x90a6, 1310},
-	{0x90a7, 6382},
-	{0x90aa, 1309},
-	{0x90af, 6738},
-	{0x90b0, 6740},
-	{0x90b1, 1683},
-	{0x90b2, 6736},
-	{0x90b3, 6739},
-	{0x90b4, 6737},
-	{0x90b5, 1681},
-	{0x90b6, 1684},
-	{0x90b8, 1682},
-	{0x90bd, 7180},
-	{0x90be, 7184},
-	{0x90bf, 7181},
-	{0x90c1, 2076},
-	{0x90c3, 2077},
-	{0x90c5, 7183},
-	{0x90c7, 7185},
-	{0x90c8, 7187},
-	{0x90ca, 2074},
-	{0x90cb, 7186},
-	{0x90ce, 2075},
-	{0x90d4, 8332},
-	{0x90d5, 7182},
-	{0x90d6, 7709},
-	{0x90d7, 7718},
-	{0x90d8, 7716},
-	{0x90d9, 7711},
-	{0x90da, 7712},
-	{0x90db, 7717},
-	{0x90dc, 7719},
-	{0x90dd, 2528},
-	{0x90df, 7714},
-	{0x90e0, 7710},
-	{0x90e1, 2527},
-	{0x90e2, 2529},
-	{0x90e3, 7713},
-	{0x90e4, 7720},
-	{0x90e5, 7715},
-	{0x90e8, 3013},
-	{0x90e9, 8335},
-	{0x90ea, 8327},
-	{0x90eb, 8333},
-	{0x90ec, 8334},
-	{0x90ed, 3014},
-	{0x90ef, 8326},
-	{0x90f0, 8328},
-	{0x90f1, 7179},
-	{0x90f2, 8330},
-	{0x90f3, 8331},
-	{0x90f4, 8329},
-	{0x90f5, 3465},
-	{0x90f9, 9000},
-	{0x90fb, 9001},
-	{0x90fc, 8998},
-	{0x90fd, 3015},
-	{0x90fe, 3467},
-	{0x90ff, 8997},
-	{0x9100, 9003},
-	{0x9101, 9002},
-	{0x9102, 3464},
-	{0x9103, 9006},
-	{0x9104, 8996},
-	{0x9105, 9005},
-	{0x9106, 8994},
-	{0x9107, 9004},
-	{0x9108, 8999},
-	{0x9109, 3466},
-	{0x910b, 9677},
-	{0x910d, 9672},
-	{0x910e, 9678},
-	{0x910f, 9673},
-	{0x9110, 9671},
-	{0x9111, 9674},
-	{0x9112, 3909},
-	{0x9114, 9676},
-	{0x9116, 9675},
-	{0x9117, 3910},
-	{0x9118, 4301},
-	{0x9119, 4300},
-	{0x911e, 4302},
-	{0x9127, 4686},
-	{0x912a, 0},
-	{0x912c, 8995},
-	{0x912d, 4685},
-	{0x9130, 4684},
-	{0x9131, 4687},
-	{0x9134, 4979},
-	{0x9136, 0},
-	{0x9139, 5272},
-	{0x913b, 0},
-	{0x9145, 0},
-	{0x9148, 5854},
-	{0x9149, 1312},
-	{0x914a, 2079},
-	{0x914b, 2078},
-	{0x914c, 2532},
-	{0x914d, 2531},
-	{0x914e, 7722},
-	{0x914f, 7723},
-	{0x9150, 7721},
-	{0x9152, 2530},
-	{0x9153, 8339},
-	{0x9155, 8340},
-	{0x9156, 8336},
-	{0x9157, 3016},
-	{0x9158, 8337},
-	{0x915a, 8338},
-	{0x915f, 9009},
-	{0x9160, 9011},
-	{0x9161, 9007},
-	{0x9162, 9010},
-	{0x9163, 3468},
-	{0x9164, 9008},
-	{0x9165, 3469},
-	{0x9168, 9186},
-	{0x9169, 3913},
-	{0x916a, 3912},
-	{0x916c, 3911},
-	{0x916e, 9679},
-	{0x916f, 9680},
-	{0x9174, 4306},
-	{0x9175, 4303},
-	{0x9177, 4305},
-	{0x9178, 4304},
-	{0x9182, 0},
-	{0x9183, 4691},
-	{0x9186, 0},
-	{0x9187, 4688},
-	{0x9189, 4689},
-	{0x918b, 4690},
-	{0x9191, 0},
-	{0x9192, 4980},
-	{0x919c, 5275},
-	{0x919e, 5274},
-	{0x91a3, 5273},
-	{0x91ab, 5436},
-	{0x91ac, 5437},
-	{0x91ae, 5596},
-	{0x91b1, 5595},
-	{0x91b3, 0},
-	{0x91b4, 5712},
-	{0x91ba, 5784},
-	{0x91c0, 5936},
-	{0x91c1, 5962},
-	{0x91c5, 5980},
-	{0x91c6, 1313},
-	{0x91c7, 1685},
-	{0x91c9, 3914},
-	{0x91cb, 5713},
-	{0x91cc, 1314},
-	{0x91cd, 2080},
-	{0x91ce, 3017},
-	{0x91cf, 3470},
-	{0x91d0, 5438},
-	{0x91d1, 1686},
-	{0x91d3, 7189},
-	{0x91d4, 7188},
-	{0x91d5, 7724},
-	{0x91d7, 2535},
-	{0x91d8, 2533},
-	{0x91d9, 2537},
-	{0x91da, 7726},
-	{0x91dc, 2536},
-	{0x91dd, 2534},
-	{0x91e2, 7725},
-	{0x91e3, 3020},
-	{0x91e4, 8346},
-	{0x91e6, 3019},
-	{0x91e7, 3021},
-	{0x91e8, 8351},
-	{0x91e9, 3023},
-	{0x91ea, 8348},
-	{0x91eb, 8349},
-	{0x91ec, 8341},
-	{0x91ed, 3022},
-	{0x91ee, 8352},
-	{0x91f1, 8343},
-	{0x91f3, 8344},
-	{0x91f4, 8342},
-	{0x91f5, 3018},
-	{0x91f7, 8350},
-	{0x91f8, 8345},
-	{0x91f9, 8347},
-	{0x91fd, 9023},
-	{0x91ff, 9022},
-	{0x9200, 9020},
-	{0x9201, 9012},
-	{0x9202, 9027},
-	{0x9203, 9015},
-	{0x9204, 9025},
-	{0x9205, 9032},
-	{0x9206, 9024},
-	{0x9207, 3478},
-	{0x9209, 3474},
-	{0x920a, 9013},
-	{0x920c, 9019},
-	{0x920d, 3476},
-	{0x920f, 9018},
-	{0x9210, 3477},
-	{0x9211, 3479},
-	{0x9212, 9021},
-	{0x9214, 3471},
-	{0x9215, 3472},
-	{0x9216, 9033},
-	{0x9217, 9031},
-	{0x9219, 9030},
-	{0x921a, 9016},
-	{0x921c, 9028},
-	{0x921e, 3475},
-	{0x9223, 3473},
-	{0x9224, 9029},
-	{0x9225, 9014},
-	{0x9226, 9017},
-	{0x9227, 9026},
-	{0x922e, 9690},
-	{0x9230, 9683},
-	{0x9231, 9702},
-	{0x9232, 9711},
-	{0x9233, 9686},
-	{0x9234, 3925},
-	{0x9236, 9699},
-	{0x9237, 3915},
-	{0x9238, 3917},
-	{0x9239, 3929},
-	{0x923a, 9684},
-	{0x923d, 3918},
-	{0x923e, 3920},
-	{0x923f, 3930},
-	{0x9240, 3919},
-	{0x9245, 3928},
-	{0x9246, 9692},
-	{0x9248, 9681},
-	{0x9249, 3926},
-	{0x924a, 9691},
-	{0x924b, 3922},
-	{0x924c, 9709},
-	{0x924d, 3927},
-	{0x924e, 9707},
-	{0x924f, 9695},
-	{0x9250, 9705},
-	{0x9251, 3924},
-	{0x9252, 9682},
-	{0x9253, 9708},
-	{0x9254, 9703},
-	{0x9256, 9710},
-	{0x9257, 3916},
-	{0x925a, 3931},
-	{0x925b, 3921},
-	{0x925e, 9688},
-	{0x9260, 9696},
-	{0x9261, 9700},
-	{0x9263, 9704},
-	{0x9264, 3923},
-	{0x9265, 9687},
-	{0x9266, 9685},
-	{0x9267, 9697},
-	{0x926c, 9694},
-	{0x926d, 9693},
-	{0x926f, 9698},
-	{0x9270, 9701},
-	{0x9272, 9706},
-	{0x9278, 4307},
-	{0x927b, 4313},
-	{0x927c, 4317},
-	{0x9280, 4309},
-	{0x9283, 9689},
-	{0x9285, 4310},
-	{0x9291, 4318},
-	{0x9293, 4314},
-	{0x9296, 4312},
-	{0x9298, 4311},
-	{0x929c, 4315},
-	{0x92a8, 4316},
-	{0x92ac, 4308},
-	{0x92b2, 4703},
-	{0x92b3, 4698},
-	{0x92b7, 4694},
-	{0x92bb, 4693},
-	{0x92bc, 4699},
-	{0x92c1, 4697},
-	{0x92c4, 0},
-	{0x92c5, 4692},
-	{0x92c7, 4701},
-	{0x92d2, 4700},
-	{0x92e4, 4696},
-	{0x92ea, 4695},
-	{0x92f0, 4702},
-	{0x92f4, 0},
-	{0x92f8, 4983},
-	{0x92fc, 4987},
-	{0x9304, 4989},
-	{0x9310, 4991},
-	{0x9315, 4994},
-	{0x9318, 5283},
-	{0x9319, 4996},
-	{0x931a, 4990},
-	{0x9320, 4981},
-	{0x9321, 4993},
-	{0x9322, 4986},
-	{0x9326, 4992},
-	{0x9328, 5278},
-	{0x932b, 4988},
-	{0x932e, 4995},
-	{0x932f, 4985},
-	{0x9333, 4984},
-	{0x9336, 4982},
-	{0x934a, 5280},
-	{0x934b, 5282},
-	{0x934d, 5276},
-	{0x9351, 0},
-	{0x9354, 5289},
-	{0x935a, 5288},
-	{0x935b, 5286},
-	{0x9365, 5281},
-	{0x936c, 5285},
-	{0x9370, 5287},
-	{0x9375, 5279},
-	{0x937e, 5284},
-	{0x9382, 5277},
-	{0x938a, 5440},
-	{0x9394, 5439},
-	{0x9396, 5441},
-	{0x9397, 5449},
-	{0x9398, 5447},
-	{0x939a, 5448},
-	{0x93a2, 5442},
-	{0x93ac, 5445},
-	{0x93ae, 5444},
-	{0x93b0, 5446},
-	{0x93b3, 5443},
-	{0x93c3, 5600},
-	{0x93c8, 5601},
-	{0x93cd, 5606},
-	{0x93d1, 5598},
-	{0x93d6, 5604},
-	{0x93d7, 5609},
-	{0x93d8, 5607},
-	{0x93dc, 5602},
-	{0x93dd, 5603},
-	{0x93df, 5599},
-	{0x93e1, 5597},
-	{0x93e2, 5605},
-	{0x93e4, 5608},
-	{0x93e8, 5610},
-	{0x93fd, 5716},
-	{0x9403, 5715},
-	{0x9418, 5714},
-	{0x942b, 5791},
-	{0x942e, 5785},
-	{0x9432, 5790},
-	{0x9433, 5786},
-	{0x9435, 5787},
-	{0x9438, 5789},
-	{0x943a, 5788},
-	{0x9444, 5855},
-	{0x9449, 0},
-	{0x944b, 0},
-	{0x9451, 5856},
-	{0x9452, 5857},
-	{0x9460, 5902},
-	{0x9463, 5901},
-	{0x9464, 5903},
-	{0x9469, 0},
-	{0x946a, 5937},
-	{0x9470, 5964},
-	{0x9472, 5963},
-	{0x9477, 5973},
-	{0x947c, 5983},
-	{0x947d, 5981},
-	{0x947e, 5982},
-	{0x947f, 5988},
-	{0x9481, 0},
-	{0x9577, 1687},
-	{0x957a, 8353},
-	{0x957b, 9034},
-	{0x9580, 1688},
-	{0x9582, 2081},
-	{0x9583, 2538},
-	{0x9586, 8354},
-	{0x9588, 8355},
-	{0x9589, 3024},
-	{0x958b, 3482},
-	{0x958c, 9036},
-	{0x958d, 9035},
-	{0x958e, 3486},
-	{0x958f, 3481},
-	{0x9590, 9037},
-	{0x9591, 3483},
-	{0x9592, 3485},
-	{0x9593, 3484},
-	{0x9594, 3480},
-	{0x9598, 3932},
-	{0x959b, 9715},
-	{0x959c, 9713},
-	{0x959e, 9714},
-	{0x959f, 9712},
-	{0x95a1, 4319},
-	{0x95a3, 4322},
-	{0x95a4, 4324},
-	{0x95a5, 4323},
-	{0x95a8, 4320},
-	{0x95a9, 4321},
-	{0x95ad, 4704},
-	{0x95b1, 4705},
-	{0x95ba, 0},
-	{0x95bb, 4997},
-	{0x95c6, 5294},
-	{0x95c8, 5293},
-	{0x95ca, 5290},
-	{0x95cb, 5291},
-	{0x95cc, 5292},
-	{0x95d0, 5452},
-	{0x95d3, 0},
-	{0x95d4, 5450},
-	{0x95d5, 5453},
-	{0x95d6, 5451},
-	{0x95db, 0},
-	{0x95dc, 5611},
-	{0x95e1, 5717},
-	{0x95e2, 5792},
-	{0x961c, 1689},
-	{0x961e, 6068},
-	{0x9620, 6177},
-	{0x9621, 1044},
-	{0x9622, 6175},
-	{0x9623, 6178},
-	{0x9624, 6176},
-	{0x9628, 6385},
-	{0x962a, 1318},
-	{0x962c, 1319},
-	{0x962d, 6387},
-	{0x962e, 1316},
-	{0x962f, 6386},
-	{0x9630, 6384},
-	{0x9631, 1317},
-	{0x9632, 1315},
-	{0x9639, 6741},
-	{0x963a, 6744},
-	{0x963b, 1692},
-	{0x963c, 6743},
-	{0x963d, 6742},
-	{0x963f, 1691},
-	{0x9640, 1690},
-	{0x9642, 1694},
-	{0x9643, 6745},
-	{0x9644, 1693},
-	{0x964a, 7194},
-	{0x964b, 2083},
-	{0x964c, 2084},
-	{0x964d, 2085},
-	{0x964e, 7195},
-	{0x964f, 7191},
-	{0x9650, 2082},
-	{0x9651, 7192},
-	{0x9653, 7193},
-	{0x9654, 7190},
-	{0x9658, 2545},
-	{0x965b, 2542},
-	{0x965c, 7727},
-	{0x965d, 2543},
-	{0x965e, 2546},
-	{0x965f, 7728},
-	{0x9661, 2541},
-	{0x9662, 2539},
-	{0x9663, 2540},
-	{0x9664, 2544},
-	{0x966a, 3025},
-	{0x966b, 8358},
-	{0x966c, 3033},
-	{0x966d, 8357},
-	{0x966f, 8360},
-	{0x9670, 3029},
-	{0x9671, 8359},
-	{0x9672, 3494},
-	{0x9673, 3027},
-	{0x9674, 3030},
-	{0x9675, 3026},
-	{0x9676, 3031},
-	{0x9677, 3032},
-	{0x9678, 3028},
-	{0x967c, 8356},
-	{0x967d, 3490},
-	{0x967e, 9039},
-	{0x9680, 9043},
-	{0x9683, 9042},
-	{0x9684, 3495},
-	{0x9685, 3491},
-	{0x9686, 3492},
-	{0x9687, 9038},
-	{0x9688, 9040},
-	{0x9689, 9041},
-	{0x968a, 3487},
-	{0x968b, 3489},
-	{0x968d, 3493},
-	{0x968e, 3488},
-	{0x9691, 9718},
-	{0x9692, 9716},
-	{0x9693, 9717},
-	{0x9694, 3934},
-	{0x9695, 3935},
-	{0x9697, 9719},
-	{0x9698, 3933},
-	{0x9699, 4325},
-	{0x969b, 4327},
-	{0x969c, 4326},
-	{0x96a7, 4998},
-	{0x96a8, 4999},
-	{0x96aa, 5000},
-	{0x96b1, 5295},
-	{0x96b4, 5612},
-	{0x96b6, 561},
-	{0x96b8, 5296},
-	{0x96b9, 1695},
-	{0x96bb, 2547},
-	{0x96bc, 7729},
-	{0x96bf, 8361},
-	{0x96c0, 3034},
-	{0x96c1, 3496},
-	{0x96c2, 9044},
-	{0x96c3, 9046},
-	{0x96c4, 3498},
-	{0x96c5, 3497},
-	{0x96c6, 3499},
-	{0x96c7, 3500},
-	{0x96c8, 9045},
-	{0x96c9, 3938},
-	{0x96ca, 3939},
-	{0x96cb, 3937},
-	{0x96cc, 4328},
-	{0x96cd, 3936},
-	{0x96ce, 9720},
-	{0x96d2, 4329},
-	{0x96d5, 5001},
-	{0x96d6, 5297},
-	{0x96d9, 5456},
-	{0x96db, 5457},
-	{0x96dc, 5455},
-	{0x96de, 5458},
-	{0x96e2, 5454},
-	{0x96e3, 5613},
-	{0x96e8, 1696},
-	{0x96e9, 3036},
-	{0x96ea, 3035},
-	{0x96ef, 3501},
-	{0x96f0, 9048},
-	{0x96f1, 9047},
-	{0x96f2, 3502},
-	{0x96f5, 9724},
-	{0x96f6, 3943},
-	{0x96f7, 3940},
-	{0x96f8, 9723},
-	{0x96f9, 3942},
-	{0x96fa, 9721},
-	{0x96fb, 3941},
-	{0x96fd, 9722},
-	{0x9700, 4330},
-	{0x9704, 4706},
-	{0x9706, 4707},
-	{0x9707, 4708},
-	{0x9709, 4709},
-	{0x970d, 5005},
-	{0x970e, 5002},
-	{0x970f, 5007},
-	{0x9711, 5003},
-	{0x9713, 5006},
-	{0x9716, 5004},
-	{0x971c, 5298},
-	{0x971e, 5299},
-	{0x9724, 5459},
-	{0x9727, 5615},
-	{0x972a, 5614},
-	{0x972c, 0},
-	{0x972f, 0},
-	{0x9730, 5718},
-	{0x9732, 5795},
-	{0x9738, 5793},
-	{0x9739, 5794},
-	{0x973d, 5858},
-	{0x973e, 5859},
-	{0x9742, 5938},
-	{0x9744, 5940},
-	{0x9748, 5939},
-	{0x9752, 1697},
-	{0x9756, 3944},
-	{0x975b, 5008},
-	{0x975c, 5009},
-	{0x975e, 1698},
-	{0x9760, 4710},
-	{0x9761, 5616},
-	{0x9762, 2086},
-	{0x9766, 5010},
-	{0x9768, 5904},
-	{0x9769, 2087},
-	{0x976a, 8362},
-	{0x976c, 9049},
-	{0x976e, 9051},
-	{0x9770, 9050},
-	{0x9772, 9728},
-	{0x9773, 9725},
-	{0x9774, 3945},
-	{0x9776, 3946},
-	{0x9777, 9726},
-	{0x9778, 9727},
-	{0x977c, 4331},
-	{0x9785, 4332},
-	{0x978b, 4712},
-	{0x978d, 4711},
-	{0x978f, 4713},
-	{0x9798, 5011},
-	{0x97a0, 5300},
-	{0x97a3, 5460},
-	{0x97a6, 5461},
-	{0x97ad, 5462},
-	{0x97c1, 5861},
-	{0x97c3, 5860},
-	{0x97c5, 0},
-	{0x97c6, 5941},
-	{0x97c9, 5974},
-	{0x97cb, 2088},
-	{0x97cc, 3503},
-	{0x97d3, 5301},
-	{0x97dc, 5617},
-	{0x97de, 0},
-	{0x97df, 1},
-	{0x97ed, 2089},
-	{0x97f3, 2090},
-	{0x97f6, 4333},
-	{0x97f9, 5463},
-	{0x97fb, 5618},
-	{0x97fe, 0},
-	{0x97ff, 5796},
-	{0x9801, 2091},
-	{0x9802, 3039},
-	{0x9803, 3040},
-	{0x9804, 8363},
-	{0x9805, 3504},
-	{0x9806, 3505},
-	{0x9807, 9052},
-	{0x9808, 3506},
-	{0x980a, 3950},
-	{0x980c, 3952},
-	{0x980d, 9730},
-	{0x980e, 9731},
-	{0x980f, 9729},
-	{0x9810, 3947},
-	{0x9811, 3948},
-	{0x9812, 3951},
-	{0x9813, 3949},
-	{0x9817, 4334},
-	{0x9818, 4335},
-	{0x981c, 4716},
-	{0x9821, 4714},
-	{0x9824, 5018},
-	{0x982b, 4715},
-	{0x982d, 5016},
-	{0x9830, 5012},
-	{0x9837, 5015},
-	{0x9838, 5013},
-	{0x9839, 5017},
-	{0x983b, 5014},
-	{0x9846, 5302},
-	{0x984c, 5466},
-	{0x984d, 5464},
-	{0x984e, 5467},
-	{0x984f, 5465},
-	{0x9851, 0},
-	{0x9852, 1},
-	{0x9853, 5468},
-	{0x9858, 5620},
-	{0x985b, 5621},
-	{0x985e, 5619},
-	{0x9863, 0},
-	{0x9865, 5798},
-	{0x9867, 5797},
-	{0x986b, 5862},
-	{0x986f, 5905},
-	{0x9870, 5942},
-	{0x9871, 5965},
-	{0x9874, 0},
-	{0x98a8, 2092},
-	{0x98a9, 9053},
-	{0x98ac, 9732},
-	{0x98ae, 0},
-	{0x98af, 4336},
-	{0x98b1, 4337},
-	{0x98b3, 4717},
-	{0x98b6, 5303},
-	{0x98ba, 5469},
-	{0x98bc, 5622},
-	{0x98c2, 0},
-	{0x98c4, 5719},
-	{0x98db, 2093},
-	{0x98df, 2094},
-	{0x98e2, 2548},
-	{0x98e3, 7730},
-	{0x98e5, 8364},
-	{0x98e7, 3507},
-	{0x98e9, 3510},
-	{0x98ea, 3508},
-	{0x98eb, 9054},
-	{0x98ed, 3512},
-	{0x98ef, 3509},
-	{0x98f2, 3511},
-	{0x98f4, 3954},
-	{0x98f6, 9733},
-	{0x98f9, 9734},
-	{0x98fc, 3953},
-	{0x98fd, 3955},
-	{0x98fe, 3956},
-	{0x9903, 4338},
-	{0x9905, 4339},
-	{0x9909, 4341},
-	{0x990a, 4718},
-	{0x990c, 4340},
-	{0x9910, 5019},
-	{0x9912, 4720},
-	{0x9913, 4719},
-	{0x9917, 0},
-	{0x9918, 4721},
-	{0x991a, 5024},
-	{0x991b, 5022},
-	{0x991e, 5021},
-	{0x9921, 5023},
-	{0x9928, 5020},
-	{0x992c, 0},
-	{0x992e, 5473},
-	{0x9935, 5304},
-	{0x993d, 5472},
-	{0x993e, 5470},
-	{0x993f, 5471},
-	{0x9945, 5623},
-	{0x9949, 5624},
-	{0x9951, 5721},
-	{0x9952, 5720},
-	{0x9955, 5863},
-	{0x9957, 5799},
-	{0x995c, 5906},
-	{0x995e, 5966},
-	{0x9996, 2095},
-	{0x9997, 8365},
-	{0x9999, 2096},
-	{0x99a5, 5474},
-	{0x99a7, 0},
-	{0x99a8, 5722},
-	{0x99ac, 2549},
-	{0x99ad, 3514},
-	{0x99ae, 3513},
-	{0x99af, 9735},
-	{0x99b0, 9737},
-	{0x99b1, 3958},
-	{0x99b2, 9736},
-	{0x99b3, 3957},
-	{0x99b4, 3959},
-	{0x99b5, 9738},
-	{0x99c1, 4342},
-	{0x99d0, 4723},
-	{0x99d1, 4726},
-	{0x99d2, 4728},
-	{0x99d4, 0},
-	{0x99d5, 4727},
-	{0x99d9, 4729},
-	{0x99db, 4725},
-	{0x99dd, 4722},
-	{0x99df, 4724},
-	{0x99e2, 5026},
-	{0x99ed, 5025},
-	{0x99f1, 5027},
-	{0x99fe, 0},
-	{0x99ff, 5306},
-	{0x9a01, 5305},
-	{0x9a0e, 5475},
-	{0x9a16, 5625},
-	{0x9a19, 5626},
-	{0x9a2b, 5723},
-	{0x9a30, 5724},
-	{0x9a35, 5726},
-	{0x9a37, 5725},
-	{0x9a3e, 5803},
-	{0x9a40, 5802},
-	{0x9a43, 5801},
-	{0x9a45, 5800},
-	{0x9a4d, 5865},
-	{0x9a54, 0},
-	{0x9a55, 5864},
-	{0x9a57, 5909},
-	{0x9a5a, 5907},
-	{0x9a5b, 5908},
-	{0x9a5f, 5943},
-	{0x9a62, 5975},
-	{0x9a65, 5976},
-	{0x9a67, 0},
-	{0x9a6a, 5991},
-	{0x9aa8, 2550},
-	{0x9aab, 9740},
-	{0x9aad, 9739},
-	{0x9aaf, 4343},
-	{0x9ab0, 4344},
-	{0x9ab7, 4730},
-	{0x9ab8, 5028},
-	{0x9abc, 5029},
-	{0x9ac1, 5476},
-	{0x9acf, 5804},
-	{0x9ad1, 5912},
-	{0x9ad2, 5866},
-	{0x9ad3, 5910},
-	{0x9ad4, 5911},
-	{0x9ad6, 5967},
-	{0x9ad8, 2551},
-	{0x9adf, 7731},
-	{0x9ae1, 3960},
-	{0x9ae6, 4345},
-	{0x9aed, 5031},
-	{0x9aee, 4731},
-	{0x9aef, 4732},
-	{0x9afb, 5030},
-	{0x9b03, 5477},
-	{0x9b05, 0},
-	{0x9b06, 5478},
-	{0x9b0d, 5627},
-	{0x9b18, 0},
-	{0x9b1a, 5867},
-	{0x9b1f, 0},
-	{0x9b20, 1},
-	{0x9b22, 5944},
-	{0x9b23, 5968},
-	{0x9b25, 2552},
-	{0x9b27, 4733},
-	{0x9b28, 5032},
-	{0x9b2f, 7732},
-	{0x9b31, 5992},
-	{0x9b32, 2553},
-	{0x9b3c, 2554},
-	{0x9b3f, 0},
-	{0x9b41, 4346},
-	{0x9b42, 4347},
-	{0x9b44, 4735},
-	{0x9b45, 4734},
-	{0x9b4d, 5481},
-	{0x9b4e, 5480},
-	{0x9b4f, 5479},
-	{0x9b51, 5806},
-	{0x9b54, 5805},
-	{0x9b58, 5945},
-	{0x9b5a, 3041},
-	{0x9b5b, 9741},
-	{0x9b61, 0},
-	{0x9b6f, 4737},
-	{0x9b77, 4736},
-	{0x9b91, 5033},
-	{0x9baa, 5309},
-	{0x9bab, 5308},
-	{0x9bad, 5310},
-	{0x9bae, 5307},
-	{0x9bc0, 5486},
-	{0x9bc8, 5485},
-	{0x9bc9, 5483},
-	{0x9bca, 5482},
-	{0x9bd6, 5630},
-	{0x9bdb, 5631},
-	{0x9be7, 5629},
-	{0x9be8, 5628},
-	{0x9beb, 0},
-	{0x9bfd, 5484},
-	{0x9c0d, 5728},
-	{0x9c13, 5727},
-	{0x9c25, 5808},
-	{0x9c29, 0},
-	{0x9c2d, 5807},
-	{0x9c31, 5869},
-	{0x9c3b, 5871},
-	{0x9c3e, 5870},
-	{0x9c49, 5868},
-	{0x9c54, 5913},
-	{0x9c56, 5915},
-	{0x9c57, 5914},
-	{0x9c5f, 5946},
-	{0x9c77, 5984},
-	{0x9c78, 5985},
-	{0x9ce5, 3042},
-	{0x9ce6, 9055},
-	{0x9ce7, 9744},
-	{0x9ce9, 3961},
-	{0x9cea, 9742},
-	{0x9ced, 9743},
-	{0x9cf2, 0},
-	{0x9cf3, 4350},
-	{0x9cf4, 4348},
-	{0x9cf6, 4349},
-	{0x9d03, 4740},
-	{0x9d06, 4738},
-	{0x9d09, 4739},
-	{0x9d12, 5038},
-	{0x9d15, 5034},
-	{0x9d1b, 5039},
-	{0x9d23, 5035},
-	{0x9d26, 5036},
-	{0x9d28, 5037},
-	{0x9d2f, 0},
-	{0x9d3b, 5311},
-	{0x9d3f, 5312},
-	{0x9d43, 0},
-	{0x9d51, 5487},
-	{0x9d5d, 5488},
-	{0x9d60, 5489},
-	{0x9d61, 5633},
-	{0x9d6a, 5635},
-	{0x9d6c, 5636},
-	{0x9d72, 5634},
-	{0x9d75, 0},
-	{0x9d89, 5632},
-	{0x9d8c, 0},
-	{0x9da7, 0},
-	{0x9daf, 5809},
-	{0x9db4, 5810},
-	{0x9db8, 5812},
-	{0x9dba, 0},
-	{0x9dc2, 5811},
-	{0x9dd3, 5872},
-	{0x9dd7, 5873},
-	{0x9de5, 5916},
-	{0x9df9, 5947},
-	{0x9dfa, 5948},
-	{0x9e01, 0},
-	{0x9e1a, 5989},
-	{0x9e1b, 5993},
-	{0x9e1e, 5994},
-	{0x9e75, 3043},
-	{0x9e79, 5729},
-	{0x9e7c, 5949},
-	{0x9e7d, 5950},
-	{0x9e7f, 3044},
-	{0x9e80, 9745},
-	{0x9e82, 3962},
-	{0x9e87, 0},
-	{0x9e8b, 5313},
-	{0x9e92, 5637},
-	{0x9e93, 5639},
-	{0x9e97, 5638},
-	{0x9e9d, 5813},
-	{0x9e9f, 5917},
-	{0x9ea5, 3045},
-	{0x9ea9, 4741},
-	{0x9eb4, 5640},
-	{0x9eb5, 5730},
-	{0x9ebb, 3046},
-	{0x9ebc, 4351},
-	{0x9ebe, 4742},
-	{0x9ec3, 3515},
-	{0x9ecc, 5969},
-	{0x9ecd, 3516},
-	{0x9ece, 4743},
-	{0x9ecf, 5314},
-	{0x9ed1, 3517},
-	{0x9ed4, 5041},
-	{0x9ed6, 0},
-	{0x9ed8, 5040},
-	{0x9edb, 5318},
-	{0x9edc, 5316},
-	{0x9edd, 5317},
-	{0x9ede, 5315},
-	{0x9ee0, 5490},
-	{0x9ee8, 5731},
-	{0x9eef, 5814},
-	{0x9ef3, 0},
-	{0x9ef4, 5918},
-	{0x9ef7, 5986},
-	{0x9ef9, 9056},
-	{0x9efd, 9746},
-	{0x9f07, 5951},
-	{0x9f0e, 3963},
-	{0x9f10, 0},
-	{0x9f13, 3964},
-	{0x9f15, 5491},
-	{0x9f19, 5815},
-	{0x9f20, 3965},
-	{0x9f2c, 5492},
-	{0x9f2f, 5732},
-	{0x9f34, 5874},
-	{0x9f3b, 4352},
-	{0x9f3e, 5319},
-	{0x9f41, 0},
-	{0x9f4a, 4353},
-	{0x9f4b, 5320},
-	{0x9f52, 4745},
-	{0x9f57, 0},
-	{0x9f58, 1},
-	{0x9f5c, 5816},
-	{0x9f5f, 5733},
-	{0x9f61, 5735},
-	{0x9f63, 5734},
-	{0x9f66, 5817},
-	{0x9f67, 5818},
-	{0x9f6a, 5876},
-	{0x9f6c, 5875},
-	{0x9f6f, 0},
-	{0x9f72, 5953},
-	{0x9f75, 0},
-	{0x9f76, 1},
-	{0x9f77, 5952},
-	{0x9f8d, 5042},
-	{0x9f90, 5500},
-	{0x9f94, 5877},
-	{0x9f9c, 5043},
-	{0xe003, 0},
-	{0xe00a, 0},
-	{0xe013, 0},
-	{0xe014, 1},
-	{0xe015, 2},
-	{0xe016, 3},
-	{0xe01b, 0},
-	{0xe01c, 1},
-	{0xe01d, 2},
-	{0xe01e, 3},
-	{0xe023, 0},
-	{0xe02e, 0},
-	{0xe033, 0},
-	{0xe034, 1},
-	{0xe035, 2},
-	{0xe036, 3},
-	{0xe037, 4},
-	{0xe038, 5},
-	{0xe03c, 0},
-	{0xe060, 0},
-	{0xe061, 1},
-	{0xe075, 0},
-	{0xe08a, 0},
-	{0xe094, 0},
-	{0xe09a, 0},
-	{0xe09d, 0},
-	{0xe09e, 1},
-	{0xe0a7, 0},
-	{0xe0c8, 0},
-	{0xe0d5, 0},
-	{0xe0e3, 0},
-	{0xe0e4, 1},
-	{0xe0e5, 2},
-	{0xe0e8, 0},
-	{0xe0e9, 1},
-	{0xe0ec, 0},
-	{0xe0f9, 0},
-	{0xe10a, 0},
-	{0xe10b, 1},
-	{0xe115, 0},
-	{0xe11d, 0},
-	{0xe127, 0},
-	{0xe128, 1},
-	{0xe131, 0},
-	{0xe142, 0},
-	{0xe148, 0},
-	{0xe155, 0},
-	{0xe156, 1},
-	{0xe157, 2},
-	{0xe15a, 0},
-	{0xe169, 0},
-	{0xe16a, 1},
-	{0xe172, 0},
-	{0xe179, 0},
-	{0xe17c, 0},
-	{0xe180, 0},
-	{0xe190, 0},
-	{0xe1a0, 0},
-	{0xe1b1, 0},
-	{0xe1b4, 0},
-	{0xe1bd, 0},
-	{0xe1be, 1},
-	{0xe1bf, 2},
-	{0xe1c5, 0},
-	{0xe1cd, 0},
-	{0xe1d5, 0},
-	{0xe1f0, 0},
-	{0xe20b, 0},
-	{0xe20c, 1},
-	{0xe213, 0},
-	{0xe214, 1},
-	{0xe215, 2},
-	{0xe216, 3},
-	{0xe21c, 0},
-	{0xe220, 0},
-	{0xe221, 1},
-	{0xe227, 0},
-	{0xe228, 1},
-	{0xe23e, 0},
-	{0xe24b, 0},
-	{0xe24c, 1},
-	{0xe24d, 2},
-	{0xe24e, 3},
-	{0xe24f, 4},
-	{0xe252, 0},
-	{0xe253, 1},
-	{0xe254, 2},
-	{0xe26e, 0},
-	{0xe26f, 1},
-	{0xe289, 0},
-	{0xe291, 0},
-	{0xe295, 0},
-	{0xe296, 1},
-	{0xe29a, 0},
-	{0xe29b, 1},
-	{0xe2b3, 0},
-	{0xe2b4, 1},
-	{0xe2b5, 2},
-	{0xe2b8, 0},
-	{0xe2bf, 0},
-	{0xe2d9, 0},
-	{0xe2e1, 0},
-	{0xe2e2, 1},
-	{0xe2ec, 0},
-	{0xe2ed, 1},
-	{0xe2f1, 0},
-	{0xe31c, 0},
-	{0xe331, 0},
-	{0xe336, 0},
-	{0xe35c, 0},
-	{0xe365, 0},
-	{0xe375, 0},
-	{0xe382, 0},
-	{0xe389, 0},
-	{0xe38a, 1},
-	{0xe39b, 0},
-	{0xe3a0, 0},
-	{0xe3a7, 0},
-	{0xe3a8, 1},
-	{0xe3a9, 2},
-	{0xe3b2, 0},
-	{0xe3b5, 0},
-	{0xe3ba, 0},
-	{0xe3bb, 1},
-	{0xe3bc, 2},
-	{0xe3bd, 3},
-	{0xe3d9, 0},
-	{0xe3da, 1},
-	{0xe3ee, 0},
-	{0xe3f3, 0},
-	{0xe3f4, 1},
-	{0xe40a, 0},
-	{0xe40b, 1},
-	{0xe41e, 0},
-	{0xe42d, 0},
-	{0xe43b, 0},
-	{0xe43c, 1},
-	{0xe441, 0},
-	{0xe44d, 0},
-	{0xe44e, 1},
-	{0xe451, 0},
-	{0xe45a, 0},
-	{0xe45e, 0},
-	{0xe462, 0},
-	{0xe463, 1},
-	{0xe468, 0},
-	{0xe469, 1},
-	{0xe46f, 0},
-	{0xe472, 0},
-	{0xe47f, 0},
-	{0xe487, 0},
-	{0xe488, 1},
-	{0xe489, 2},
-	{0xe48a, 3},
-	{0xe48e, 0},
-	{0xe492, 0},
-	{0xe496, 0},
-	{0xe497, 1},
-	{0xe4a3, 0},
-	{0xe4a4, 1},
-	{0xe4b4, 0},
-	{0xe4b5, 1},
-	{0xe4b6, 2},
-	{0xe4b7, 3},
-	{0xe4b8, 4},
-	{0xe4b9, 5},
-	{0xe4ba, 6},
-	{0xe4ce, 0},
-	{0xe4dd, 0},
-	{0xe4e7, 0},
-	{0xe4e8, 1},
-	{0xe4ef, 0},
-	{0xe4f9, 0},
-	{0xe502, 0},
-	{0xe51d, 0},
-	{0xe51e, 1},
-	{0xe51f, 2},
-	{0xe520, 3},
-	{0xe521, 4},
-	{0xe52a, 0},
-	{0xe52b, 1},
-	{0xe52c, 2},
-	{0xe52f, 0},
-	{0xe555, 0},
-	{0xe558, 0},
-	{0xe559, 1},
-	{0xe55c, 0},
-	{0xe55f, 0},
-	{0xe567, 0},
-	{0xe56e, 0},
-	{0xe573, 0},
-	{0xe576, 0},
-	{0xe577, 1},
-	{0xe57a, 0},
-	{0xe57d, 0},
-	{0xe57e, 1},
-	{0xe583, 0},
-	{0xe584, 1},
-	{0xe585, 2},
-	{0xe586, 3},
-	{0xe58c, 0},
-	{0xe58d, 1},
-	{0xe58e, 2},
-	{0xe58f, 3},
-	{0xe590, 4},
-	{0xe593, 0},
-	{0xe594, 1},
-	{0xe59e, 0},
-	{0xe59f, 1},
-	{0xe5a0, 2},
-	{0xe5a1, 3},
-	{0xe5a7, 0},
-	{0xe5a8, 1},
-	{0xe5b8, 0},
-	{0xe5bb, 0},
-	{0xe5bf, 0},
-	{0xe5c0, 1},
-	{0xe5c9, 0},
-	{0xe5d8, 0},
-	{0xe5d9, 1},
-	{0xe5dc, 0},
-	{0xe5e2, 0},
-	{0xe5e3, 1},
-	{0xe5e6, 0},
-	{0xe5ef, 0},
-	{0xe5f0, 1},
-	{0xe5f1, 2},
-	{0xe5fc, 0},
-	{0xe610, 0},
-	{0xe611, 1},
-	{0xe612, 2},
-	{0xe61a, 0},
-	{0xe61b, 1},
-	{0xe61c, 2},
-	{0xe624, 0},
-	{0xe633, 0},
-	{0xe634, 1},
-	{0xe638, 0},
-	{0xe640, 0},
-	{0xe641, 1},
-	{0xe642, 2},
-	{0xe646, 0},
-	{0xe64f, 0},
-	{0xe653, 0},
-	{0xe654, 1},
-	{0xe655, 2},
-	{0xe658, 0},
-	{0xe659, 1},
-	{0xe65e, 0},
-	{0xe65f, 1},
-	{0xe660, 2},
-	{0xe663, 0},
-	{0xe666, 0},
-	{0xe667, 1},
-	{0xe668, 2},
-	{0xe66f, 0},
-	{0xe677, 0},
-	{0xe678, 1},
-	{0xe679, 2},
-	{0xe67c, 0},
-	{0xe67d, 1},
-	{0xe680, 0},
-	{0xe684, 0},
-	{0xe685, 1},
-	{0xe686, 2},
-	{0xe687, 3},
-	{0xe688, 4},
-	{0xe68b, 0},
-	{0xe68c, 1},
-	{0xe68f, 0},
-	{0xe690, 1},
-	{0xe697, 0},
-	{0xe69a, 0},
-	{0xe69f, 0},
-	{0xe6a2, 0},
-	{0xe6ad, 0},
-	{0xe6ba, 0},
-	{0xe6be, 0},
-	{0xe6c1, 0},
-	{0xe6d2, 0},
-	{0xe6d8, 0},
-	{0xe6db, 0},
-	{0xe6de, 0},
-	{0xe6df, 1},
-	{0xe6e0, 2},
-	{0xe6e1, 3},
-	{0xe6e5, 0},
-	{0xe6e6, 1},
-	{0xe6f3, 0},
-	{0xe6fb, 0},
-	{0xe6fc, 1},
-	{0xe702, 0},
-	{0xe707, 0},
-	{0xe70a, 0},
-	{0xe711, 0},
-	{0xe718, 0},
-	{0xe71b, 0},
-	{0xe725, 0},
-	{0xe734, 0},
-	{0xe735, 1},
-	{0xe736, 2},
-	{0xe737, 3},
-	{0xe73d, 0},
-	{0xe741, 0},
-	{0xe742, 1},
-	{0xe74e, 0},
-	{0xe74f, 1},
-	{0xe752, 0},
-	{0xe75c, 0},
-	{0xe75d, 1},
-	{0xe762, 0},
-	{0xe765, 0},
-	{0xe768, 0},
-	{0xe76d, 0},
-	{0xe76e, 1},
-	{0xe778, 0},
-	{0xe77d, 0},
-	{0xe797, 0},
-	{0xe7a5, 0},
-	{0xe7a6, 1},
-	{0xe7a7, 2},
-	{0xe7a8, 3},
-	{0xe7a9, 4},
-	{0xe7dd, 0},
-	{0xe7e8, 0},
-	{0xe7e9, 1},
-	{0xe7ee, 0},
-	{0xe7ef, 1},
-	{0xe7f2, 0},
-	{0xe7f3, 1},
-	{0xe7fc, 0},
-	{0xe801, 0},
-	{0xe802, 1},
-	{0xe80f, 0},
-	{0xe817, 0},
-	{0xe818, 1},
-	{0xe828, 0},
-	{0xe838, 0},
-	{0xe83b, 0},
-	{0xe842, 0},
-	{0xe84e, 0},
-	{0xe856, 0},
-	{0xe857, 1},
-	{0xe858, 2},
-	{0xe85c, 0},
-	{0xe85d, 1},
-	{0xe861, 0},
-	{0xe862, 1},
-	{0xe866, 0},
-	{0xe867, 1},
-	{0xe86a, 0},
-	{0xe87e, 0},
-	{0xe87f, 1},
-	{0xe892, 0},
-	{0xe895, 0},
-	{0xe8a1, 0},
-	{0xe8a4, 0},
-	{0xe8a5, 1},
-	{0xe8a6, 2},
-	{0xe8a7, 3},
-	{0xe8aa, 0},
-	{0xe8ad, 0},
-	{0xe8ae, 1},
-	{0xe8af, 2},
-	{0xe8b0, 3},
-	{0xe8b6, 0},
-	{0xe8be, 0},
-	{0xe8bf, 1},
-	{0xe8c0, 2},
-	{0xe8c1, 3},
-	{0xe8c2, 4},
-	{0xe8c3, 5},
-	{0xe8ce, 0},
-	{0xe8d1, 0},
-	{0xe8d6, 0},
-	{0xe8d9, 0},
-	{0xe8da, 1},
-	{0xe8e0, 0},
-	{0xe8e1, 1},
-	{0xe8e6, 0},
-	{0xe8e9, 0},
-	{0xe8ea, 1},
-	{0xe8f2, 0},
-	{0xe908, 0},
-	{0xe918, 0},
-	{0xe91f, 0},
-	{0xe920, 1},
-	{0xe921, 2},
-	{0xe922, 3},
-	{0xe926, 0},
-	{0xe927, 1},
-	{0xe928, 2},
-	{0xe929, 3},
-	{0xe92a, 4},
-	{0xe92b, 5},
-	{0xe92c, 6},
-	{0xe92f, 0},
-	{0xe934, 0},
-	{0xe935, 1},
-	{0xe936, 2},
-	{0xe93d, 0},
-	{0xe93e, 1},
-	{0xe945, 0},
-	{0xe953, 0},
-	{0xe954, 1},
-	{0xe955, 2},
-	{0xe958, 0},
-	{0xe95d, 0},
-	{0xe95e, 1},
-	{0xe961, 0},
-	{0xe96f, 0},
-	{0xe978, 0},
-	{0xe97b, 0},
-	{0xe982, 0},
-	{0xeac0, 0},
-	{0xeac1, 1},
-	{0xeaca, 0},
-	{0xeacb, 1},
-	{0xeacc, 2},
-	{0xead0, 0},
-	{0xead1, 1},
-	{0xead4, 0},
-	{0xead7, 0},
-	{0xead8, 1},
-	{0xead9, 2},
-	{0xeada, 3},
-	{0xeadf, 0},
-	{0xeae0, 1},
-	{0xeae1, 2},
-	{0xeae2, 3},
-	{0xeae3, 4},
-	{0xeae8, 0},
-	{0xeae9, 1},
-	{0xeaea, 2},
-	{0xeaeb, 3},
-	{0xeaec, 4},
-	{0xeaf1, 0},
-	{0xeaf2, 1},
-	{0xeaf6, 0},
-	{0xeafb, 0},
-	{0xeaff, 0},
-	{0xeb03, 0},
-	{0xeb04, 1},
-	{0xeb05, 2},
-	{0xeb09, 0},
-	{0xeb0a, 1},
-	{0xeb0b, 2},
-	{0xeb0c, 3},
-	{0xeb0d, 4},
-	{0xeb0e, 5},
-	{0xeb0f, 6},
-	{0xeb12, 0},
-	{0xeb19, 0},
-	{0xeb1a, 1},
-	{0xeb1b, 2},
-	{0xeb1c, 3},
-	{0xeb1d, 4},
-	{0xeb20, 0},
-	{0xeb21, 1},
-	{0xeb2d, 0},
-	{0xeb2e, 1},
-	{0xeb2f, 2},
-	{0xeb30, 3},
-	{0xeb31, 4},
-	{0xeb32, 5},
-	{0xeb33, 6},
-	{0xeb34, 7},
-	{0xeb35, 8},
-	{0xeb36, 9},
-	{0xeb37, 10},
-	{0xeb38, 11},
-	{0xeb39, 12},
-	{0xeb3f, 0},
-	{0xeb44, 0},
-	{0xeb4c, 0},
-	{0xeb4e, 0},
-	{0xeb50, 0},
-	{0xeb56, 0},
-	{0xeb59, 0},
-	{0xeb5b, 0},
-	{0xeb63, 0},
-	{0xeb69, 0},
-	{0xeb70, 0},
-	{0xeb71, 1},
-	{0xeb7f, 0},
-	{0xeb81, 0},
-	{0xeb84, 0},
-	{0xeb8d, 0},
-	{0xeb8e, 1},
-	{0xeb99, 0},
-	{0xeb9a, 1},
-	{0xeba6, 0},
-	{0xebb3, 0},
-	{0xebc6, 0},
-	{0xebcd, 0},
-	{0xebd8, 0},
-	{0xebdb, 0},
-	{0xebe9, 0},
-	{0xebec, 0},
-	{0xebfa, 0},
-	{0xebfb, 1},
-	{0xebfe, 0},
-	{0xec06, 0},
-	{0xec09, 0},
-	{0xec0f, 0},
-	{0xec10, 1},
-	{0xec18, 0},
-	{0xec1a, 0},
-	{0xec1b, 1},
-	{0xec1c, 2},
-	{0xec2d, 0},
-	{0xec2e, 1},
-	{0xec3c, 0},
-	{0xec40, 0},
-	{0xec41, 1},
-	{0xec46, 0},
-	{0xec47, 1},
-	{0xec48, 2},
-	{0xec49, 3},
-	{0xec4c, 0},
-	{0xec57, 0},
-	{0xec58, 1},
-	{0xec5d, 0},
-	{0xec60, 0},
-	{0xec63, 0},
-	{0xec6a, 0},
-	{0xec6b, 1},
-	{0xec6c, 2},
-	{0xec6d, 3},
-	{0xec6e, 4},
-	{0xec6f, 5},
-	{0xec70, 6},
-	{0xec71, 7},
-	{0xec72, 8},
-	{0xec73, 9},
-	{0xec76, 0},
-	{0xec94, 0},
-	{0xec9b, 0},
-	{0xeca4, 0},
-	{0xeca8, 0},
-	{0xecba, 0},
-	{0xecbb, 1},
-	{0xecdc, 0},
-	{0xece0, 0},
-	{0xece1, 1},
-	{0xed0d, 0},
-	{0xed0e, 1},
-	{0xed0f, 2},
-	{0xed10, 3},
-	{0xed11, 4},
-	{0xed16, 0},
-	{0xed17, 1},
-	{0xed25, 0},
-	{0xed27, 0},
-	{0xed42, 0},
-	{0xed4b, 0},
-	{0xed4e, 0},
-	{0xed54, 0},
-	{0xed58, 0},
-	{0xed85, 0},
-	{0xed8a, 0},
-	{0xeea2, 0},
-	{0xeea3, 1},
-	{0xeea4, 2},
-	{0xeea5, 3},
-	{0xeea6, 4},
-	{0xeea9, 0},
-	{0xeeaa, 1},
-	{0xeead, 0},
-	{0xeeae, 1},
-	{0xeeaf, 2},
-	{0xeeb0, 3},
-	{0xeeb1, 4},
-	{0xf304, 0},
-	{0xf305, 1},
-	{0xf306, 2},
-	{0xf307, 3},
-	{0xf308, 4},
-	{0xf309, 5},
-	{0xf30a, 6},
-	{0xf30b, 7},
-	{0xf30c, 8},
-	{0xf30d, 9},
-	{0xf30e, 10},
-	{0xf30f, 11},
-	{0xf310, 12},
-	{0xf311, 13},
-	{0xf312, 14},
-	{0xf313, 15},
-	{0xf314, 16},
-	{0xf315, 17},
-	{0xf316, 18},
-	{0xf317, 19},
-	{0xf318, 20},
-	{0xf34b, 0},
-	{0xf3a1, 0},
-	{0xf3fa, 0},
-	{0xf409, 0},
-	{0xf40a, 1},
-	{0xf40b, 2},
-	{0xf441, 0},
-	{0xf442, 1},
-	{0xf449, 0},
-	{0xf451, 0},
-	{0xf452, 1},
-	{0xf455, 0},
-	{0xf456, 1},
-	{0xf45d, 0},
-	{0xf45e, 1},
-	{0xf45f, 2},
-	{0xf462, 0},
-	{0xf463, 1},
-	{0xf466, 0},
-	{0xf46d, 0},
-	{0xf47d, 0},
-	{0xf47e, 1},
-	{0xf481, 0},
-	{0xf485, 0},
-	{0xf48e, 0},
-	{0xf48f, 1},
-	{0xf490, 2},
-	{0xf498, 0},
-	{0xf4a5, 0},
-	{0xf4a6, 1},
-	{0xf4aa, 0},
-	{0xf4b0, 0},
-	{0xf4b4, 0},
-	{0xf4bb, 0},
-	{0xf4bc, 1},
-	{0xf4bd, 2},
-	{0xf4be, 3},
-	{0xf4bf, 4},
-	{0xf4c0, 5},
-	{0xf4c4, 0},
-	{0xf4c5, 1},
-	{0xf4c8, 0},
-	{0xf4c9, 1},
-	{0xf4ca, 2},
-	{0xf4cd, 0},
-	{0xf4ce, 1},
-	{0xf4cf, 2},
-	{0xf4d2, 0},
-	{0xf4d3, 1},
-	{0xf4d4, 2},
-	{0xf4d5, 3},
-	{0xf4da, 0},
-	{0xf4dc, 0},
-	{0xf4de, 0},
-	{0xf4e8, 0},
-	{0xf4e9, 1},
-	{0xf4ff, 0},
-	{0xf501, 0},
-	{0xf508, 0},
-	{0xf509, 1},
-	{0xf50a, 2},
-	{0xf50b, 3},
-	{0xf50c, 4},
-	{0xf50d, 5},
-	{0xf50e, 6},
-	{0xf50f, 7},
-	{0xf510, 8},
-	{0xf511, 9},
-	{0xf514, 0},
-	{0xf515, 1},
-	{0xf516, 2},
-	{0xf519, 0},
-	{0xf51a, 1},
-	{0xf51b, 2},
-	{0xf51c, 3},
-	{0xf51d, 4},
-	{0xf520, 0},
-	{0xf521, 1},
-	{0xf522, 2},
-	{0xf523, 3},
-	{0xf524, 4},
-	{0xf525, 5},
-	{0xf526, 6},
-	{0xf534, 0},
-	{0xf53b, 0},
-	{0xf55a, 0},
-	{0xf7e6, 0},
-	{0xf7eb, 0},
-	{0xf7ee, 0},
-	{0xfa0c, 628},
-	{0xfa0d, 9089},
-	{0xfe30, 109},
-	{0xfe31, 122},
-	{0xfe35, 130},
-	{0xfe36, 131},
-	{0xfe37, 134},
-	{0xfe38, 135},
-	{0xfe39, 138},
-	{0xfe3a, 139},
-	{0xfe3b, 142},
-	{0xfe3c, 143},
-	{0xfe3d, 146},
-	{0xfe3e, 147},
-	{0xfe3f, 150},
-	{0xfe40, 151},
-	{0xfe41, 154},
-	{0xfe42, 155},
-	{0xfe43, 158},
-	{0xfe44, 159},
-	{0xfe49, 199},
-	{0xfe4a, 200},
-	{0xfe4b, 203},
-	{0xfe4c, 204},
-	{0xfe4d, 201},
-	{0xfe4e, 202},
-	{0xfe50, 112},
-	{0xfe52, 114},
-	{0xfe54, 116},
-	{0xfe55, 117},
-	{0xfe56, 118},
-	{0xfe57, 119},
-	{0xfe59, 160},
-	{0xfe5a, 161},
-	{0xfe5b, 162},
-	{0xfe5c, 163},
-	{0xfe5d, 164},
-	{0xfe5e, 165},
-	{0xfe5f, 205},
-	{0xfe60, 206},
-	{0xfe61, 207},
-	{0xfe62, 223},
-	{0xfe63, 224},
-	{0xfe64, 225},
-	{0xfe65, 226},
-	{0xfe66, 227},
-	{0xfe69, 268},
-	{0xfe6a, 269},
-	{0xfe6b, 270},
-	{0xff01, 108},
-	{0xff03, 174},
-	{0xff04, 259},
-	{0xff05, 264},
-	{0xff06, 175},
-	{0xff08, 128},
-	{0xff09, 129},
-	{0xff0a, 176},
-	{0xff0b, 208},
-	{0xff0c, 100},
-	{0xff0d, 209},
-	{0xff0e, 103},
-	{0xff0f, 257},
-	{0xff10, 333},
-	{0xff11, 334},
-	{0xff12, 335},
-	{0xff13, 336},
-	{0xff14, 337},
-	{0xff15, 338},
-	{0xff16, 339},
-	{0xff17, 340},
-	{0xff18, 341},
-	{0xff19, 342},
-	{0xff1a, 106},
-	{0xff1b, 105},
-	{0xff1c, 214},
-	{0xff1d, 216},
-	{0xff1e, 215},
-	{0xff1f, 107},
-	{0xff20, 265},
-	{0xff21, 365},
-	{0xff22, 366},
-	{0xff23, 367},
-	{0xff24, 368},
-	{0xff25, 369},
-	{0xff26, 370},
-	{0xff27, 371},
-	{0xff28, 372},
-	{0xff29, 373},
-	{0xff2a, 374},
-	{0xff2b, 375},
-	{0xff2c, 376},
-	{0xff2d, 377},
-	{0xff2e, 378},
-	{0xff2f, 379},
-	{0xff30, 380},
-	{0xff31, 381},
-	{0xff32, 382},
-	{0xff33, 383},
-	{0xff34, 384},
-	{0xff35, 385},
-	{0xff36, 386},
-	{0xff37, 387},
-	{0xff38, 388},
-	{0xff39, 389},
-	{0xff3a, 390},
-	{0xff3c, 258},
-	{0xff3f, 197},
-	{0xff41, 391},
-	{0xff42, 392},
-	{0xff43, 393},
-	{0xff44, 394},
-	{0xff45, 395},
-	{0xff46, 396},
-	{0xff47, 397},
-	{0xff48, 398},
-	{0xff49, 399},
-	{0xff4a, 400},
-	{0xff4b, 401},
-	{0xff4c, 402},
-	{0xff4d, 403},
-	{0xff4e, 404},
-	{0xff4f, 405},
-	{0xff50, 406},
-	{0xff51, 407},
-	{0xff52, 408},
-	{0xff53, 409},
-	{0xff54, 410},
-	{0xff55, 411},
-	{0xff56, 412},
-	{0xff57, 413},
-	{0xff58, 414},
-	{0xff59, 415},
-	{0xff5a, 416},
-	{0xff5b, 132},
-	{0xff5c, 120},
-	{0xff5d, 133},
-	{0xff64, 113}};
-
+// Coverage of the CNS1 character collection: bit (u % 8) of byte
+// u / 8 is set if the Unicode code point u has a CID (11117 code points).
+static const uint8 CNS1[8192] = {
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x83, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0xff, 0xfb, 0x03, 0xfe, 0xff, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x33, 0x64, 0x00, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03,
+	0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xc4, 0x29, 0x4e, 0x30, 0x10, 0x00, 0x00, 0x04, 0x00, 0xc3, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xf0, 0x3f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x01, 0x40, 0x02, 0xe4, 0x0f, 0x00,
+	0xfe, 0xff, 0x30, 0x00, 0x03, 0x00, 0x0c, 0x30, 0xc0, 0xc8, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x21, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xcf, 0xff, 0x37, 0x60, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x50, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40,
+	0xe0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc0, 0x00, 0x70, 0x02, 0x00, 0x00, 0x00, 0x10, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8b, 0xff, 0x73, 0xc3, 0x40, 0x69, 0x4f, 0x9b, 0xac, 0xe9, 0x4c, 0xf3, 0x00, 0x02, 0x08, 0xc0,
+	0x7c, 0x79, 0x3e, 0xca, 0x77, 0x79, 0x48, 0x04, 0xdf, 0x2f, 0xf0, 0xf7, 0x3a, 0x03, 0xff, 0xa8,
+	0x37, 0xef, 0x3f, 0x23, 0x04, 0xb0, 0x59, 0xfd, 0xca, 0xf3, 0xff, 0xff, 0x9f, 0xde, 0xf9, 0xff,
+	0xff, 0xab, 0xf7, 0x7d, 0x00, 0xc0, 0xec, 0x8e, 0xbf, 0xee, 0xdb, 0xff, 0x03, 0xd0, 0xfa, 0x45,
+	0xe1, 0xfa, 0xfe, 0xdf, 0xef, 0xbf, 0xab, 0x10, 0xeb, 0xff, 0xaa, 0xfc, 0x3f, 0xef, 0xfd, 0x24,
+	0xad, 0x78, 0x76, 0x7f, 0x0c, 0xf0, 0xff, 0xed, 0xf6, 0xcf, 0xfa, 0x2c, 0xf9, 0xf7, 0x2b, 0x0a,
+	0xb5, 0x13, 0x35, 0x81, 0x02, 0x44, 0xac, 0x99, 0xfb, 0x3b, 0xb4, 0xfe, 0xae, 0x7b, 0xe2, 0x11,
+	0x85, 0xa6, 0xfe, 0x41, 0x35, 0x1c, 0xc3, 0x72, 0x70, 0x7d, 0x91, 0x31, 0x03, 0x00, 0x6b, 0x27,
+	0xcb, 0x57, 0xcf, 0x70, 0x32, 0x47, 0xef, 0x0d, 0xda, 0x7e, 0x74, 0xfc, 0x06, 0xfe, 0xb4, 0xbd,
+	0x8f, 0x37, 0x0a, 0x88, 0x49, 0x7e, 0x00, 0x58, 0x8f, 0x22, 0xec, 0xeb, 0x5c, 0x0a, 0x29, 0xdf,
+	0x60, 0xef, 0xe7, 0xb6, 0x0f, 0xa4, 0x03, 0xf3, 0xbb, 0x37, 0x9e, 0x54, 0x4b, 0xd2, 0xaf, 0x9b,
+	0x14, 0xc4, 0xd4, 0xf7, 0xb0, 0x30, 0x44, 0x0a, 0x08, 0x2f, 0xd0, 0x88, 0x7c, 0xff, 0x2f, 0x19,
+	0xda, 0xff, 0x07, 0xfb, 0xf1, 0x7f, 0xeb, 0x7b, 0xef, 0xc5, 0x10, 0x00, 0xff, 0x99, 0xff, 0xfd,
+	0xd7, 0x79, 0x67, 0x05, 0xe7, 0xff, 0xcb, 0xfd, 0xff, 0xc3, 0x40, 0x40, 0xf7, 0x6f, 0x8e, 0xbd,
+	0xfa, 0xdf, 0x97, 0x04, 0xc0, 0xf4, 0xff, 0x5b, 0x7b, 0xed, 0xe7, 0xd0, 0x7e, 0x04, 0xe0, 0xf8,
+	0x9f, 0xff, 0x3e, 0xb7, 0xfe, 0x7d, 0x2e, 0x88, 0xfd, 0xff, 0x7f, 0xbe, 0xfe, 0x83, 0xc4, 0xf6,
+	0x57, 0xf3, 0xfd, 0xb8, 0x80, 0xc2, 0x55, 0x8a, 0x20, 0x40, 0x88, 0x02, 0x34, 0x9f, 0x52, 0x03,
+	0xa1, 0xe0, 0x21, 0x00, 0xa0, 0x41, 0xd0, 0x50, 0x07, 0x17, 0x82, 0xec, 0xb3, 0x4c, 0x81, 0x86,
+	0x9e, 0x3f, 0x5c, 0x81, 0x0d, 0xf7, 0x19, 0x48, 0xa3, 0xfe, 0x07, 0x00, 0x56, 0xaf, 0xff, 0x38,
+	0x0d, 0x98, 0xb8, 0xef, 0x3d, 0x40, 0x60, 0xb7, 0xce, 0xd8, 0x35, 0x90, 0xbf, 0x72, 0xff, 0x3f,
+	0xf7, 0x7f, 0x11, 0x7a, 0xbb, 0xf7, 0xff, 0xab, 0x00, 0xff, 0xbe, 0x6f, 0x3c, 0xa9, 0x72, 0xfe,
+	0xef, 0xcf, 0x1b, 0xd1, 0x40, 0x43, 0x08, 0x40, 0xa2, 0x40, 0x2a, 0xc3, 0x14, 0x9a, 0x10, 0x76,
+	0x4c, 0xf4, 0xf0, 0x16, 0xb5, 0xfe, 0x82, 0x51, 0xb1, 0xc7, 0xbb, 0x15, 0x87, 0x6e, 0xd8, 0xfb,
+	0x3f, 0xe4, 0xcd, 0x63, 0xff, 0xc1, 0x7e, 0x7e, 0xeb, 0xfd, 0x5f, 0x7d, 0x7b, 0x77, 0xfe, 0xfc,
+	0x0b, 0x96, 0xea, 0xdb, 0x29, 0x62, 0xe8, 0x53, 0xdf, 0x37, 0xef, 0xfd, 0xf5, 0x36, 0x81, 0xbd,
+	0x18, 0xdc, 0xbd, 0xfc, 0xe4, 0xd2, 0xff, 0xff, 0xd7, 0x3f, 0xe0, 0xff, 0x6f, 0x7f, 0x28, 0x08,
+	0x00, 0x1b, 0x00, 0x20, 0x10, 0x04, 0x11, 0xc1, 0x09, 0x10, 0xfb, 0xbd, 0x3c, 0x5a, 0xaf, 0xa5,
+	0xbb, 0xdb, 0xac, 0x9f, 0xfc, 0x71, 0x79, 0x83, 0xf7, 0x7c, 0x5f, 0xc3, 0xff, 0x5f, 0x65, 0x05,
+	0x9a, 0xff, 0x67, 0x84, 0x34, 0x15, 0x8b, 0xdf, 0xf3, 0xf9, 0x73, 0x33, 0x3d, 0xd5, 0x1a, 0x5e,
+	0x40, 0xbf, 0x3f, 0xa0, 0xff, 0xff, 0xeb, 0x01, 0xc0, 0xdf, 0xdd, 0xcf, 0x00, 0x75, 0xd3, 0xab,
+	0xc3, 0xf8, 0xd6, 0xee, 0xfd, 0x43, 0xff, 0xb7, 0xaf, 0x5e, 0x27, 0x42, 0xac, 0x9b, 0x86, 0xf6,
+	0xd7, 0x27, 0x10, 0x20, 0x00, 0x00, 0x00, 0x35, 0x80, 0x22, 0x54, 0xe8, 0xe7, 0x49, 0x9f, 0xe2,
+	0x5c, 0x54, 0xf2, 0xaf, 0x3f, 0x2b, 0xd8, 0x61, 0x3b, 0xfc, 0xb8, 0x8b, 0x0e, 0x49, 0x7c, 0xff,
+	0x95, 0xbf, 0xe0, 0x1c, 0xfd, 0x7d, 0xff, 0x43, 0xf6, 0x5f, 0xfe, 0xb7, 0x0d, 0x90, 0xd8, 0xc4,
+	0xb6, 0x8d, 0xbc, 0xad, 0xdc, 0x63, 0xeb, 0x11, 0x59, 0x55, 0xd1, 0x23, 0xb6, 0xbe, 0xdb, 0xf3,
+	0xe7, 0x1f, 0xc7, 0xdb, 0x63, 0xff, 0xe0, 0x22, 0x2a, 0xb2, 0xf7, 0x63, 0x3b, 0xed, 0xba, 0xad,
+	0x01, 0xfe, 0xff, 0x7e, 0xf7, 0xff, 0xbc, 0x02, 0xff, 0x32, 0x39, 0xef, 0xfc, 0xff, 0x05, 0x80,
+	0xfb, 0x77, 0xf5, 0xbc, 0x0d, 0x01, 0xf7, 0xff, 0xfb, 0xff, 0x3a, 0xbf, 0x57, 0x00, 0xff, 0xdf,
+	0x7b, 0xef, 0x7d, 0xbd, 0x88, 0xdb, 0xd4, 0xc8, 0xf3, 0xff, 0x7c, 0xed, 0xae, 0x5d, 0xff, 0x54,
+	0x05, 0x44, 0x13, 0x04, 0x90, 0x5a, 0x44, 0x40, 0x84, 0x2f, 0x00, 0x00, 0x48, 0x40, 0xe4, 0xd5,
+	0x11, 0x77, 0x77, 0x8e, 0xbf, 0x4e, 0x5d, 0xe4, 0xcf, 0x6f, 0x1f, 0x5f, 0x7f, 0xe0, 0xdf, 0xfe,
+	0xdb, 0xd7, 0xfe, 0x01, 0x00, 0xff, 0x7b, 0xfb, 0xd4, 0xff, 0xdf, 0x1f, 0x00, 0xf8, 0xff, 0xff,
+	0x8f, 0xfb, 0x7b, 0x00, 0x00, 0xbf, 0x5c, 0x7f, 0xff, 0xff, 0xf3, 0x07, 0xa0, 0xeb, 0xe7, 0x3d,
+	0xbf, 0xf7, 0xd7, 0xfb, 0xbf, 0xff, 0x03, 0x60, 0xfd, 0xff, 0xed, 0xbf, 0xbb, 0xef, 0x7f, 0x02,
+	0x40, 0xfe, 0xfd, 0xdd, 0xff, 0xfd, 0xf9, 0xe2, 0x0b, 0x68, 0x1f, 0xfb, 0xe3, 0xba, 0xfc, 0xaf,
+	0x84, 0x01, 0x2d, 0x66, 0x74, 0x7a, 0x0d, 0xd8, 0xb6, 0x6c, 0x14, 0x05, 0x45, 0x30, 0x97, 0x4c,
+	0x41, 0x80, 0x10, 0x33, 0x18, 0x9c, 0xd4, 0xeb, 0x6a, 0x87, 0xfa, 0x73, 0xfc, 0x95, 0xbc, 0x01,
+	0x8c, 0x10, 0xa7, 0xfa, 0xb3, 0xdd, 0x89, 0xba, 0x7e, 0xf8, 0xcd, 0x00, 0x67, 0xf3, 0x3f, 0x3c,
+	0xfd, 0xff, 0x3f, 0xb0, 0xf7, 0xe9, 0x7e, 0x06, 0xae, 0x96, 0x06, 0xfe, 0x76, 0xd5, 0xd7, 0x5f,
+	0xd1, 0x3f, 0xf3, 0xa3, 0x07, 0x49, 0x12, 0x03, 0xd0, 0x0a, 0x40, 0x3a, 0x51, 0x52, 0xdd, 0xd3,
+	0x3b, 0xaf, 0xbd, 0xa9, 0xc7, 0x7d, 0x3a, 0xff, 0xe0, 0xfb, 0xeb, 0xf6, 0x01, 0xb4, 0xff, 0xff,
+	0xfa, 0x7a, 0xbf, 0xb7, 0x00, 0xc0, 0xfd, 0x0f, 0x7f, 0xff, 0x1f, 0xff, 0xfc, 0xfe, 0xff, 0x95,
+	0x00, 0x00, 0xdc, 0xb5, 0x63, 0xef, 0x3e, 0x3f, 0x7f, 0xfb, 0x1b, 0x00, 0x00, 0xe8, 0xf6, 0xfb,
+	0xef, 0x9e, 0xdf, 0xb8, 0x9f, 0xff, 0x3f, 0x00, 0xd0, 0x7b, 0xff, 0xf5, 0xdb, 0xdf, 0xff, 0x3f,
+	0xf0, 0xfd, 0xbf, 0x00, 0x20, 0x84, 0xbd, 0xbb, 0x37, 0xdf, 0xde, 0xff, 0x6d, 0xff, 0xf3, 0x0f,
+	0x4c, 0x60, 0xfb, 0x5e, 0xfb, 0xff, 0xfb, 0xfa, 0x5e, 0xfe, 0x19, 0x02, 0x00, 0x21, 0x08, 0x20,
+	0x26, 0x04, 0x0a, 0xc2, 0x0a, 0x00, 0x20, 0x27, 0x90, 0x49, 0x00, 0x83, 0x06, 0x08, 0x00, 0x40,
+	0x11, 0x00, 0x91, 0x10, 0x0d, 0xd0, 0x88, 0x09, 0x0c, 0x00, 0x08, 0x2c, 0x20, 0x90, 0x00, 0x0c,
+	0x10, 0x06, 0x45, 0x02, 0x2b, 0xb1, 0xde, 0xff, 0xee, 0x7f, 0x01, 0x92, 0xfe, 0x24, 0x84, 0xcb,
+	0x5d, 0xf7, 0xf2, 0xcb, 0x11, 0xc8, 0xec, 0xb4, 0x79, 0xb8, 0xdd, 0x4d, 0xdd, 0x99, 0x8d, 0x7b,
+	0x20, 0x81, 0x7b, 0xaf, 0xfb, 0xdd, 0x59, 0xc9, 0x4f, 0xfc, 0xb5, 0xfa, 0xe3, 0xaf, 0x5f, 0x6d,
+	0xff, 0xff, 0x7d, 0x3f, 0x00, 0x78, 0xdb, 0xff, 0xff, 0xb6, 0xff, 0x7e, 0xaf, 0xfb, 0x2f, 0x02,
+	0x9b, 0xff, 0xc7, 0xef, 0xa5, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0xc7, 0xff, 0xf7, 0xf1, 0xff,
+	0xfd, 0x7f, 0xbf, 0x01, 0x00, 0xdc, 0xbc, 0xfd, 0xf5, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x3e,
+	0x29, 0x00, 0x00, 0xbe, 0xff, 0xf9, 0x7f, 0xff, 0xfb, 0x6e, 0x7e, 0xfd, 0xff, 0xcb, 0x9e, 0x03,
+	0x00, 0xe3, 0xdd, 0xfb, 0xff, 0xcc, 0xdf, 0xf6, 0xff, 0xff, 0x7f, 0x11, 0x00, 0xfa, 0xf6, 0xeb,
+	0xee, 0xc6, 0x3c, 0x17, 0xad, 0xfe, 0xef, 0xdb, 0x09, 0x40, 0x12, 0x89, 0x51, 0xe0, 0x09, 0x15,
+	0x51, 0x41, 0x80, 0x00, 0xd3, 0x00, 0x5a, 0x02, 0x0f, 0x00, 0x20, 0x89, 0x13, 0xda, 0x03, 0x44,
+	0x40, 0xaa, 0x22, 0xad, 0x0c, 0x01, 0x05, 0x40, 0x50, 0x12, 0xc2, 0x41, 0x18, 0x0c, 0x53, 0x35,
+	0x7c, 0x44, 0x7e, 0x87, 0x12, 0xfa, 0xbb, 0x45, 0xe0, 0xed, 0xde, 0x77, 0x17, 0x80, 0xd9, 0xbf,
+	0x55, 0x7e, 0x89, 0xde, 0x6f, 0xc1, 0x47, 0x04, 0xde, 0x7a, 0x5d, 0xf7, 0xff, 0x57, 0x05, 0x21,
+	0x10, 0x04, 0x14, 0x82, 0x00, 0x11, 0x02, 0x42, 0x1a, 0x43, 0x25, 0x9a, 0xe1, 0x70, 0x10, 0x59,
+	0x40, 0x20, 0x11, 0x88, 0x00, 0x35, 0x61, 0xef, 0xc6, 0x9f, 0x44, 0xef, 0x8f, 0xd6, 0xdd, 0xfb,
+	0x73, 0x7b, 0x47, 0x48, 0xc4, 0xd0, 0x31, 0xa4, 0x7f, 0x5e, 0xd7, 0x97, 0x5b, 0x0f, 0xd8, 0xff,
+	0x83, 0x9d, 0xce, 0x7b, 0xec, 0x22, 0xff, 0xdc, 0x35, 0x46, 0x81, 0x80, 0x81, 0x81, 0xa5, 0x0d,
+	0xf1, 0x4f, 0xfc, 0xa0, 0x77, 0x3b, 0xfc, 0xdb, 0xed, 0x3d, 0xdc, 0x7f, 0xa9, 0x6f, 0x70, 0xf5,
+	0xfb, 0x3f, 0x40, 0xac, 0x7f, 0xff, 0x7f, 0x84, 0x57, 0xec, 0xb7, 0xde, 0x18, 0xa6, 0x01, 0x40,
+	0x09, 0x0c, 0x00, 0xd1, 0xc8, 0x03, 0x01, 0xa0, 0x00, 0x84, 0x50, 0xf4, 0x5f, 0x53, 0xf0, 0xe8,
+	0x18, 0x30, 0x26, 0xb5, 0x66, 0xff, 0x8f, 0xe7, 0x81, 0xd9, 0x10, 0xbe, 0x7c, 0x9c, 0xc1, 0x83,
+	0xc0, 0x9c, 0x36, 0x27, 0xbc, 0x0c, 0x6d, 0xff, 0xb7, 0xfc, 0xb7, 0xef, 0xdf, 0xa0, 0xff, 0xff,
+	0x0b, 0xaa, 0x09, 0x80, 0xd7, 0x02, 0x10, 0x05, 0x44, 0x12, 0x44, 0x81, 0x26, 0x52, 0x46, 0xfb,
+	0xd6, 0xcf, 0x6c, 0x66, 0x00, 0xc0, 0x31, 0x84, 0x7c, 0x67, 0x1c, 0xfc, 0xba, 0xc4, 0xbf, 0x5f,
+	0xba, 0x8f, 0x2f, 0xae, 0xad, 0xa3, 0xfe, 0x7f, 0xf0, 0xfc, 0x74, 0xde, 0xef, 0x3f, 0x00, 0xa2,
+	0x90, 0x58, 0x02, 0xc0, 0xa9, 0x34, 0x09, 0xb8, 0x80, 0x84, 0x88, 0x5e, 0xad, 0xf3, 0x88, 0x3f,
+	0x6c, 0xf2, 0x1f, 0xa0, 0xef, 0xff, 0xbf, 0x01, 0x28, 0x77, 0x05, 0x70, 0x35, 0xff, 0x03, 0x9a,
+	0xf9, 0xd2, 0xfa, 0x87, 0x8a, 0x02, 0x09, 0x54, 0x32, 0x0c, 0x21, 0x04, 0x85, 0x91, 0x90, 0x14,
+	0x02, 0x40, 0x10, 0x02, 0x40, 0x1d, 0x00, 0xe4, 0xf7, 0x9f, 0xff, 0xfc, 0xbb, 0x2f, 0x1d, 0xb6,
+	0x06, 0xe8, 0x00, 0x00, 0xc0, 0x44, 0x0a, 0xef, 0x23, 0xeb, 0x66, 0xf1, 0xd9, 0x7e, 0xc0, 0x0d,
+	0x3d, 0x3d, 0xbf, 0xdf, 0x05, 0x40, 0x82, 0xb8, 0x41, 0x78, 0x80, 0x00, 0x07, 0x2b, 0x72, 0xcf,
+	0xf3, 0x9f, 0xf5, 0xc3, 0x0d, 0xd6, 0x00, 0x84, 0xba, 0x0c, 0x02, 0x83, 0x79, 0xa8, 0x40, 0xae,
+	0x73, 0xc7, 0x0f, 0x6f, 0x7d, 0xfd, 0x3f, 0x09, 0xf1, 0xff, 0x57, 0x01, 0xfb, 0x62, 0xff, 0x01,
+	0x90, 0x88, 0xb0, 0x20, 0x03, 0x20, 0x12, 0x01, 0xd3, 0x12, 0x00, 0x0a, 0x53, 0x02, 0x82, 0x40,
+	0x80, 0x30, 0x02, 0x40, 0x8a, 0x0c, 0x80, 0xe1, 0x09, 0x30, 0x01, 0x80, 0x39, 0x50, 0x2c, 0xa7,
+	0x33, 0x37, 0xf6, 0xc1, 0x2e, 0x81, 0x3e, 0x62, 0x00, 0x44, 0x62, 0xf2, 0x85, 0x80, 0x01, 0x69,
+	0xff, 0xff, 0xff, 0xff, 0x07, 0xdb, 0x6f, 0xff, 0xff, 0xc4, 0x7f, 0xd9, 0xce, 0xef, 0x0f, 0xbe,
+	0x7b, 0xf1, 0x1e, 0x50, 0x05, 0x30, 0x37, 0xed, 0x80, 0x14, 0x04, 0x67, 0x09, 0x93, 0x14, 0x0a,
+	0x00, 0x07, 0x03, 0x68, 0x09, 0xc8, 0xb6, 0xe2, 0x6a, 0x01, 0x34, 0x46, 0x02, 0x2e, 0x08, 0x32,
+	0x04, 0x91, 0x58, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe7, 0x12, 0x11, 0x33, 0xf9, 0xeb, 0x7f, 0xa5, 0x12,
+	0x20, 0x7d, 0x76, 0x7c, 0xf7, 0x83, 0x44, 0xf3, 0xaf, 0xfe, 0xb7, 0x98, 0x0b, 0x42, 0x0b, 0x5b,
+	0xfb, 0xf8, 0xf7, 0xdb, 0x42, 0x01, 0xf8, 0xf2, 0xc8, 0x85, 0x47, 0x45, 0x00, 0x80, 0xcf, 0xe0,
+	0xf4, 0x9e, 0x6d, 0x3f, 0x2e, 0xee, 0x36, 0x05, 0xbc, 0xf7, 0xf3, 0x7f, 0x7b, 0xa0, 0x3f, 0x7f,
+	0x67, 0x05, 0x60, 0xeb, 0xbe, 0xba, 0x01, 0x66, 0xd8, 0xfc, 0x3f, 0x5c, 0xf7, 0xca, 0xdf, 0x87,
+	0x05, 0x85, 0x00, 0x3d, 0x01, 0x03, 0x08, 0xe4, 0x4d, 0xa2, 0x04, 0x85, 0xee, 0x75, 0x98, 0xdf,
+	0xb7, 0x37, 0x17, 0xf8, 0x27, 0x9d, 0xfc, 0xb7, 0xb5, 0x0a, 0xc0, 0x03, 0x40, 0xc2, 0xb6, 0xf1,
+	0x39, 0xec, 0x1f, 0xef, 0xbf, 0xfb, 0xfb, 0x7f, 0x0d, 0x00, 0xfe, 0xda, 0xfb, 0xbd, 0x7f, 0x4e,
+	0xff, 0x33, 0xc0, 0x5a, 0xf5, 0xbf, 0xfe, 0x9f, 0xbf, 0xff, 0x5f, 0x00, 0x00, 0x00, 0xf8, 0xfd,
+	0xca, 0xff, 0xfd, 0x6f, 0xfd, 0xcf, 0x01, 0xa0, 0xff, 0xdf, 0xf2, 0xfb, 0xbf, 0xdf, 0x7f, 0xff,
+	0xda, 0xfe, 0x0f, 0x08, 0x08, 0xba, 0xff, 0xbf, 0xfd, 0x7a, 0xd7, 0xee, 0xeb, 0xfb, 0xf9, 0x67,
+	0x44, 0xe0, 0x01, 0x52, 0x00, 0x00, 0x04, 0x91, 0x71, 0x0e, 0x0a, 0x00, 0x00, 0x51, 0x02, 0x80,
+	0xc0, 0x00, 0x9a, 0x04, 0x2a, 0x30, 0x00, 0x20, 0x08, 0x07, 0x00, 0x42, 0x00, 0x27, 0x01, 0x40,
+	0x90, 0x04, 0x12, 0x18, 0x40, 0x87, 0x01, 0x06, 0x00, 0xa2, 0x21, 0x20, 0x30, 0x06, 0x80, 0x0e,
+	0xc0, 0x0c, 0x82, 0x04, 0x00, 0x20, 0x20, 0x81, 0x80, 0x61, 0x7d, 0xda, 0x80, 0xe8, 0x9b, 0x1e,
+	0xe0, 0x7c, 0xfb, 0x77, 0xbe, 0x87, 0xfb, 0xff, 0xff, 0x1b, 0xdb, 0xff, 0x5c, 0x3f, 0xe0, 0x4f,
+	0xff, 0x7f, 0x08, 0x11, 0xa4, 0x02, 0x90, 0x88, 0x00, 0x30, 0xa8, 0x02, 0x51, 0x01, 0x50, 0x01,
+	0x0c, 0x20, 0x02, 0xc0, 0x04, 0x08, 0x08, 0x0c, 0x41, 0x09, 0x06, 0x00, 0x01, 0x90, 0x84, 0x4a,
+	0x20, 0x20, 0x32, 0x80, 0x0e, 0x00, 0x42, 0x0a, 0x5b, 0x71, 0xec, 0x2a, 0x8e, 0xaf, 0xf7, 0xf2,
+	0x0f, 0x7b, 0xee, 0xcf, 0x96, 0x1d, 0xe6, 0x77, 0x07, 0x7e, 0xf5, 0xff, 0x02, 0x81, 0x1c, 0x23,
+	0x86, 0x04, 0x2d, 0x07, 0x22, 0x4c, 0x44, 0x29, 0x10, 0x00, 0x42, 0xc8, 0x11, 0x94, 0x04, 0xc4,
+	0x6e, 0x88, 0xe8, 0x19, 0x40, 0x14, 0x04, 0x24, 0x01, 0x00, 0x7c, 0xbe, 0x7f, 0x00, 0x18, 0x11,
+	0x9d, 0xd5, 0xef, 0xe9, 0xac, 0x34, 0x53, 0xde, 0x73, 0xf5, 0xf7, 0x4b, 0x4f, 0x7b, 0xff, 0x9e,
+	0xfe, 0x30, 0x2a, 0x45, 0xfb, 0x05, 0x45, 0x92, 0x94, 0x2a, 0x64, 0x18, 0xc0, 0x68, 0xea, 0x55,
+	0x17, 0x44, 0x81, 0x2a, 0x01, 0x19, 0x00, 0x02, 0x42, 0xe2, 0x00, 0x97, 0x40, 0x98, 0x91, 0x28,
+	0x01, 0x04, 0x6c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9a, 0xc2, 0x5f, 0xf1, 0xb4, 0x76, 0x3e, 0x08, 0x2f,
+	0x77, 0x36, 0x0c, 0x60, 0xbf, 0x9f, 0xfd, 0xff, 0xbf, 0x15, 0x0e, 0x50, 0x5f, 0x34, 0x10, 0x3d,
+	0xa0, 0xa5, 0xc8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x2b, 0xdd, 0x2b,
+	0x33, 0xf6, 0x3f, 0x82, 0x08, 0x01, 0xf8, 0xd6, 0xe6, 0xf9, 0xeb, 0xbf, 0xdf, 0xdf, 0x1f, 0x14,
+	0x00, 0x80, 0x01, 0xe0, 0x86, 0x0a, 0x32, 0x22, 0x14, 0x0f, 0x20, 0x82, 0x58, 0x10, 0x54, 0x14,
+	0xa6, 0x2e, 0x8a, 0x80, 0x03, 0x1c, 0x04, 0x04, 0x01, 0xbc, 0x9e, 0xf9, 0xe3, 0xdb, 0xf2, 0xdf,
+	0xef, 0x0f, 0xbe, 0xf8, 0x60, 0x86, 0x08, 0xc9, 0xb4, 0x63, 0x91, 0x80, 0x82, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x98, 0x48, 0xe1, 0x27, 0x90, 0x74, 0x6a, 0xfe, 0x00, 0x7f, 0x6d, 0xf1, 0xfd,
+	0x7f, 0xb8, 0xf3, 0xfe, 0x1f, 0xe0, 0x76, 0xf1, 0x96, 0xee, 0x3f, 0x7b, 0x0d, 0x63, 0xb4, 0xb5,
+	0x9f, 0x8d, 0xb3, 0xcb, 0xef, 0x84, 0x7f, 0xe1, 0xaa, 0x4d, 0xf0, 0xbf, 0x3f, 0xbf, 0x3f, 0xfa,
+	0xff, 0xeb, 0xd7, 0x43, 0x80, 0x34, 0x53, 0x0a, 0x20, 0xff, 0xed, 0x85, 0x3f, 0xd7, 0xb0, 0x01,
+	0xcc, 0x0a, 0x06, 0x50, 0x08, 0x58, 0x1a, 0x04, 0xe3, 0xfa, 0xbb, 0x37, 0xdc, 0x7f, 0xba, 0xa3,
+	0xff, 0xb6, 0xf7, 0x56, 0xf8, 0x40, 0xdf, 0xe7, 0x61, 0xff, 0xdf, 0x4c, 0xfb, 0xb0, 0x05, 0x19,
+	0x29, 0x00, 0x4a, 0x11, 0x00, 0x11, 0x8c, 0x18, 0xb2, 0x00, 0x04, 0x00, 0x10, 0x04, 0x11, 0x11,
+	0x10, 0x00, 0x21, 0x07, 0x47, 0xc9, 0x48, 0x00, 0x00, 0x2c, 0x12, 0x0c, 0x20, 0x10, 0x21, 0x40,
+	0x04, 0x04, 0xd0, 0x05, 0x04, 0x50, 0x09, 0x00, 0x08, 0x21, 0xc2, 0xb1, 0x16, 0x01, 0x00, 0x20,
+	0x08, 0x00, 0x00, 0x01, 0x00, 0x48, 0x2c, 0x05, 0x10, 0x0a, 0x06, 0x00, 0x19, 0x06, 0x85, 0xf0,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0c,
+	0x4d, 0xfb, 0x1f, 0xd9, 0x3a, 0x23, 0x02, 0x0c, 0x40, 0x1d, 0x79, 0x18, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x50, 0x1f, 0xf5, 0x07, 0xbe, 0x1d, 0xfc, 0x1b, 0xf9, 0x1e, 0xbc, 0xff, 0x71,
+	0xf9, 0x6f, 0xbe, 0x1b, 0x80, 0x05, 0x52, 0x9b, 0xff, 0x7f, 0x64, 0x5a, 0x0c, 0x87, 0xe7, 0x2f,
+	0xd1, 0xe2, 0x4a, 0x50, 0x90, 0x94, 0x05, 0x63, 0x14, 0x01, 0x44, 0x58, 0x47, 0x57, 0xdd, 0x11,
+	0x20, 0xa8, 0x00, 0x01, 0x49, 0x20, 0x00, 0x00, 0x6a, 0x1a, 0x08, 0xd0, 0x00, 0x20, 0x48, 0xca,
+	0xfe, 0xf5, 0x8f, 0x11, 0x12, 0x28, 0x81, 0x0b, 0x40, 0xf0, 0x0e, 0x49, 0xa8, 0x88, 0x13, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x4a, 0x14, 0x14, 0x00, 0x00, 0x88, 0xac, 0xae, 0x54, 0x72,
+	0x28, 0x16, 0x8d, 0x4d, 0x02, 0x51, 0x20, 0xe0, 0x20, 0x02, 0xa6, 0x50, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0x02, 0xa0, 0xf1, 0x3f, 0x00, 0x02, 0x00, 0x37, 0xaa, 0x04, 0x20, 0x02, 0xc0,
+	0x02, 0x40, 0x40, 0x02, 0x00, 0x08, 0xa1, 0x40, 0x29, 0x20, 0xb0, 0x8c, 0xa4, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x81, 0x11, 0x02, 0x80, 0x5e, 0x81, 0x42, 0xe0, 0x00, 0x08,
+	0x68, 0x20, 0x00, 0x85, 0xad, 0x81, 0x06, 0x90, 0x36, 0xe0, 0x12, 0x0d, 0x02, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x01, 0x07, 0x40, 0x08, 0x80, 0x09, 0x00, 0x20,
+	0x00, 0x20, 0x08, 0x00, 0x20, 0x22, 0x02, 0x48, 0x00, 0x02, 0xd0, 0x80, 0x00, 0x00, 0x80, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x26, 0x5c, 0x00,
+	0x48, 0x02, 0x24, 0x08, 0x48, 0x81, 0x00, 0x88, 0x08, 0x00, 0x02, 0x20, 0x03, 0x14, 0x24, 0x00,
+	0x00, 0x12, 0x00, 0x00, 0x80, 0x80, 0x10, 0x05, 0x04, 0x00, 0x88, 0x00, 0x20, 0x00, 0x00, 0x06,
+	0x02, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb2,
+	0x85, 0x08, 0x8c, 0xa0, 0x20, 0x02, 0x30, 0x58, 0x08, 0xf0, 0x52, 0x79, 0x01, 0x81, 0x98, 0x22,
+	0x80, 0x40, 0x29, 0x02, 0x01, 0x90, 0x10, 0x48, 0x02, 0x0c, 0x84, 0x91, 0xca, 0x94, 0xe4, 0x00,
+	0x00, 0x20, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x04, 0x78, 0x78, 0x08, 0x40, 0xf8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00,
+	0x00, 0x04, 0x10, 0x64, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x38, 0x13, 0x00, 0x02,
+	0x00, 0x0c, 0x20, 0x20, 0x80, 0x01, 0x02, 0x00, 0x04, 0x01, 0xe0, 0x04, 0x00, 0x06, 0x04, 0x12,
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x12, 0xe0, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x18, 0x78, 0x10, 0x83, 0x01, 0x00, 0x40, 0x00, 0xf8, 0x1c, 0x00, 0x00, 0xc0, 0x00, 0x00,
+	0x00, 0x02, 0x62, 0x0c, 0x00, 0x00, 0x38, 0x81, 0x00, 0x00, 0x00, 0x02, 0x06, 0x30, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x20, 0x00,
+	0x04, 0x06, 0x00, 0x08, 0x81, 0x03, 0x24, 0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x18, 0x00,
+	0x00, 0x0c, 0x00, 0x40, 0x00, 0x20, 0x00, 0x18, 0x02, 0x60, 0x02, 0x44, 0x0c, 0x83, 0x04, 0x80,
+	0x80, 0x47, 0xc4, 0x00, 0x18, 0x00, 0xf0, 0x07, 0x00, 0x40, 0x00, 0x20, 0x80, 0x81, 0x00, 0x02,
+	0x04, 0x00, 0x00, 0xe0, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x20, 0x93, 0x80, 0x40, 0xc8, 0x64,
+	0x78, 0xf0, 0x19, 0xc0, 0x83, 0x01, 0x00, 0x89, 0x01, 0x02, 0x00, 0x13, 0x4c, 0x80, 0x03, 0x10,
+	0x00, 0x00, 0x07, 0x1c, 0x10, 0x00, 0x18, 0x01, 0x47, 0x80, 0x38, 0xc3, 0xc9, 0x81, 0x80, 0x33,
+	0xf1, 0x99, 0x81, 0x84, 0x04, 0x20, 0x00, 0x44, 0x02, 0x00, 0x04, 0xc9, 0x63, 0x00, 0x08, 0x18,
+	0x84, 0x04, 0x02, 0x09, 0x20, 0x00, 0xf0, 0x20, 0x06, 0xc0, 0x04, 0x30, 0x24, 0x61, 0x00, 0x21,
+	0x00, 0x00, 0x80, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xc3, 0x0c, 0x10,
+	0x06, 0x80, 0x80, 0x01, 0x00, 0x01, 0x00, 0x09, 0x04, 0x40, 0xc0, 0x31, 0xc6, 0x04, 0x00, 0xc0,
+	0x00, 0x00, 0x24, 0x00, 0xf2, 0xe4, 0x41, 0xc0, 0x0f, 0x40, 0x42, 0x06, 0x43, 0x06, 0x04, 0x00,
+	0x00, 0x01, 0x00, 0x81, 0xc7, 0x9f, 0x70, 0x60, 0x20, 0x00, 0x38, 0x61, 0x02, 0x80, 0x00, 0x09,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x93, 0x87, 0x0f, 0x1f, 0x46, 0x88,
+	0x38, 0xfe, 0x04, 0x3e, 0x03, 0xe0, 0xff, 0x83, 0x10, 0x50, 0x41, 0x0a, 0x08, 0x02, 0x03, 0x80,
+	0x12, 0x60, 0x00, 0x06, 0x40, 0x00, 0x08, 0x00, 0x40, 0x20, 0x00, 0x09, 0x00, 0x12, 0x00, 0x4c,
+	0x40, 0x82, 0x01, 0x1d, 0x00, 0x60, 0x00, 0x10, 0xc3, 0x13, 0x80, 0x21, 0x09, 0xfc, 0x4f, 0x00,
+	0x00, 0x00, 0x10, 0x08, 0x10, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xe0, 0xc3, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x04, 0x48, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7c, 0xe6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x66, 0xe0, 0x4c, 0x20, 0x00, 0x60,
+	0x22, 0xc0, 0x01, 0x01, 0x60, 0x04, 0x11, 0xf8, 0x31, 0xe7, 0x3c, 0x54, 0x00, 0x03, 0x00, 0x80,
+	0x02, 0xff, 0x73, 0x3e, 0x7f, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x1f, 0x7e, 0xf5, 0xfe, 0x7f, 0x0e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xfe, 0xff, 0xff, 0x3f, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
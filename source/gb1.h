@@ -1,23963 +1,516 @@
 // WARNING: MACHINE GENERATED, DON'T CHANGE!
-static unicode_to_cid GB1[] = {
-	{0x20, 1},
-	{0x21, 2},
-	{0x22, 3},
-	{0x23, 4},
-	{0x24, 5},
-	{0x25, 6},
-	{0x26, 7},
-	{0x27, 8},
-	{0x28, 9},
-	{0x29, 10},
-	{0x2a, 11},
-	{0x2b, 12},
-	{0x2c, 13},
-	{0x2d, 14},
-	{0x2e, 15},
-	{0x2f, 16},
-	{0x30, 17},
-	{0x31, 18},
-	{0x32, 19},
-	{0x33, 20},
-	{0x34, 21},
-	{0x35, 22},
-	{0x36, 23},
-	{0x37, 24},
-	{0x38, 25},
-	{0x39, 26},
-	{0x3a, 27},
-	{0x3b, 28},
-	{0x3c, 29},
-	{0x3d, 30},
-	{0x3e, 31},
-	{0x3f, 32},
-	{0x40, 33},
-	{0x41, 34},
-	{0x42, 35},
-	{0x43, 36},
-	{0x44, 37},
-	{0x45, 38},
-	{0x46, 39},
-	{0x47, 40},
-	{0x48, 41},
-	{0x49, 42},
-	{0x4a, 43},
-	{0x4b, 44},
-	{0x4c, 45},
-	{0x4d, 46},
-	{0x4e, 47},
-	{0x4f, 48},
-	{0x50, 49},
-	{0x51, 50},
-	{0x52, 51},
-	{0x53, 52},
-	{0x54, 53},
-	{0x55, 54},
-	{0x56, 55},
-	{0x57, 56},
-	{0x58, 57},
-	{0x59, 58},
-	{0x5a, 59},
-	{0x5b, 60},
-	{0x5c, 61},
-	{0x5d, 62},
-	{0x5e, 63},
-	{0x5f, 64},
-	{0x60, 65},
-	{0x61, 66},
-	{0x62, 67},
-	{0x63, 68},
-	{0x64, 69},
-	{0x65, 70},
-	{0x66, 71},
-	{0x67, 72},
-	{0x68, 73},
-	{0x69, 74},
-	{0x6a, 75},
-	{0x6b, 76},
-	{0x6c, 77},
-	{0x6d, 78},
-	{0x6e, 79},
-	{0x6f, 80},
-	{0x70, 81},
-	{0x71, 82},
-	{0x72, 83},
-	{0x73, 84},
-	{0x74, 85},
-	{0x75, 86},
-	{0x76, 87},
-	{0x77, 88},
-	{0x78, 89},
-	{0x79, 90},
-	{0x7a, 91},
-	{0x7b, 92},
-	{0x7c, 93},
-	{0x7d, 94},
-	{0x7e, 95},
-	{0xa4, 167},
-	{0xa7, 171},
-	{0xa8, 102},
-	{0xb0, 162},
-	{0xb1, 127},
-	{0xd7, 128},
-	{0xe0, 671},
-	{0xe1, 669},
-	{0xe8, 675},
-	{0xe9, 673},
-	{0xea, 693},
-	{0xec, 679},
-	{0xed, 677},
-	{0xf2, 683},
-	{0xf3, 681},
-	{0xf7, 129},
-	{0xf9, 687},
-	{0xfa, 685},
-	{0xfc, 692},
-	{0x101, 668},
-	{0x113, 672},
-	{0x11b, 674},
-	{0x12b, 676},
-	{0x14d, 680},
-	{0x16b, 684},
-	{0x1ce, 670},
-	{0x1d0, 678},
-	{0x1d2, 682},
-	{0x1d4, 686},
-	{0x1d6, 688},
-	{0x1d8, 689},
-	{0x1da, 690},
-	{0x1dc, 691},
-	{0x1f9, 698},
-	{0x2c7, 101},
-	{0x2c9, 100},
-	{0x2ca, 9907},
-	{0x2cb, 9908},
-	{0x2d9, 9909},
-	{0x391, 525},
-	{0x392, 526},
-	{0x393, 527},
-	{0x394, 528},
-	{0x395, 529},
-	{0x396, 530},
-	{0x397, 531},
-	{0x398, 532},
-	{0x399, 533},
-	{0x39a, 534},
-	{0x39b, 535},
-	{0x39c, 536},
-	{0x39d, 537},
-	{0x39e, 538},
-	{0x39f, 539},
-	{0x3a0, 540},
-	{0x3a1, 541},
-	{0x3a3, 542},
-	{0x3a4, 543},
-	{0x3a5, 544},
-	{0x3a6, 545},
-	{0x3a7, 546},
-	{0x3a8, 547},
-	{0x3a9, 548},
-	{0x3b1, 549},
-	{0x3b2, 550},
-	{0x3b3, 551},
-	{0x3b4, 552},
-	{0x3b5, 553},
-	{0x3b6, 554},
-	{0x3b7, 555},
-	{0x3b8, 556},
-	{0x3b9, 557},
-	{0x3ba, 558},
-	{0x3bb, 559},
-	{0x3bc, 560},
-	{0x3bd, 561},
-	{0x3be, 562},
-	{0x3bf, 563},
-	{0x3c0, 564},
-	{0x3c1, 565},
-	{0x3c3, 566},
-	{0x3c4, 567},
-	{0x3c5, 568},
-	{0x3c6, 569},
-	{0x3c7, 570},
-	{0x3c8, 571},
-	{0x3c9, 572},
-	{0x401, 608},
-	{0x410, 602},
-	{0x411, 603},
-	{0x412, 604},
-	{0x413, 605},
-	{0x414, 606},
-	{0x415, 607},
-	{0x416, 609},
-	{0x417, 610},
-	{0x418, 611},
-	{0x419, 612},
-	{0x41a, 613},
-	{0x41b, 614},
-	{0x41c, 615},
-	{0x41d, 616},
-	{0x41e, 617},
-	{0x41f, 618},
-	{0x420, 619},
-	{0x421, 620},
-	{0x422, 621},
-	{0x423, 622},
-	{0x424, 623},
-	{0x425, 624},
-	{0x426, 625},
-	{0x427, 626},
-	{0x428, 627},
-	{0x429, 628},
-	{0x42a, 629},
-	{0x42b, 630},
-	{0x42c, 631},
-	{0x42d, 632},
-	{0x42e, 633},
-	{0x42f, 634},
-	{0x430, 635},
-	{0x431, 636},
-	{0x432, 637},
-	{0x433, 638},
-	{0x434, 639},
-	{0x435, 640},
-	{0x436, 642},
-	{0x437, 643},
-	{0x438, 644},
-	{0x439, 645},
-	{0x43a, 646},
-	{0x43b, 647},
-	{0x43c, 648},
-	{0x43d, 649},
-	{0x43e, 650},
-	{0x43f, 651},
-	{0x440, 652},
-	{0x441, 653},
-	{0x442, 654},
-	{0x443, 655},
-	{0x444, 656},
-	{0x445, 657},
-	{0x446, 658},
-	{0x447, 659},
-	{0x448, 660},
-	{0x449, 661},
-	{0x44a, 662},
-	{0x44b, 663},
-	{0x44c, 664},
-	{0x44d, 665},
-	{0x44e, 666},
-	{0x44f, 667},
-	{0x451, 641},
-	{0x1e3f, 695},
-	{0x2013, 9910},
-	{0x2014, 105},
-	{0x2015, 9911},
-	{0x2016, 107},
-	{0x2018, 109},
-	{0x2019, 110},
-	{0x201c, 111},
-	{0x201d, 112},
-	{0x2025, 9912},
-	{0x2026, 108},
-	{0x2030, 170},
-	{0x2032, 163},
-	{0x2033, 164},
-	{0x2035, 9913},
-	{0x203b, 184},
-	{0x2103, 165},
-	{0x2105, 9914},
-	{0x2109, 9915},
-	{0x2116, 172},
-	{0x2160, 250},
-	{0x2161, 251},
-	{0x2162, 252},
-	{0x2163, 253},
-	{0x2164, 254},
-	{0x2165, 255},
-	{0x2166, 256},
-	{0x2167, 257},
-	{0x2168, 258},
-	{0x2169, 259},
-	{0x216a, 260},
-	{0x216b, 261},
-	{0x2170, 9897},
-	{0x2171, 9898},
-	{0x2172, 9899},
-	{0x2173, 9900},
-	{0x2174, 9901},
-	{0x2175, 9902},
-	{0x2176, 9903},
-	{0x2177, 9904},
-	{0x2178, 9905},
-	{0x2179, 9906},
-	{0x2190, 186},
-	{0x2191, 187},
-	{0x2192, 185},
-	{0x2193, 188},
-	{0x2196, 9916},
-	{0x2197, 9917},
-	{0x2198, 9918},
-	{0x2199, 9919},
-	{0x2208, 137},
-	{0x220f, 134},
-	{0x2211, 133},
-	{0x2215, 9920},
-	{0x221a, 139},
-	{0x221d, 151},
-	{0x221e, 157},
-	{0x221f, 9921},
-	{0x2220, 142},
-	{0x2223, 9922},
-	{0x2225, 141},
-	{0x2227, 131},
-	{0x2228, 132},
-	{0x2229, 136},
-	{0x222a, 135},
-	{0x222b, 145},
-	{0x222e, 146},
-	{0x2234, 159},
-	{0x2235, 158},
-	{0x2236, 130},
-	{0x2237, 138},
-	{0x223d, 150},
-	{0x2248, 149},
-	{0x224c, 148},
-	{0x2252, 9923},
-	{0x2260, 152},
-	{0x2261, 147},
-	{0x2264, 155},
-	{0x2265, 156},
-	{0x2266, 9924},
-	{0x2267, 9925},
-	{0x226e, 153},
-	{0x226f, 154},
-	{0x2295, 9988},
-	{0x2299, 144},
-	{0x22a5, 140},
-	{0x22bf, 9926},
-	{0x22ef, 108},
-	{0x2312, 143},
-	{0x2460, 230},
-	{0x2461, 231},
-	{0x2462, 232},
-	{0x2463, 233},
-	{0x2464, 234},
-	{0x2465, 235},
-	{0x2466, 236},
-	{0x2467, 237},
-	{0x2468, 238},
-	{0x2469, 239},
-	{0x2474, 210},
-	{0x2475, 211},
-	{0x2476, 212},
-	{0x2477, 213},
-	{0x2478, 214},
-	{0x2479, 215},
-	{0x247a, 216},
-	{0x247b, 217},
-	{0x247c, 218},
-	{0x247d, 219},
-	{0x247e, 220},
-	{0x247f, 221},
-	{0x2480, 222},
-	{0x2481, 223},
-	{0x2482, 224},
-	{0x2483, 225},
-	{0x2484, 226},
-	{0x2485, 227},
-	{0x2486, 228},
-	{0x2487, 229},
-	{0x2488, 190},
-	{0x2489, 191},
-	{0x248a, 192},
-	{0x248b, 193},
-	{0x248c, 194},
-	{0x248d, 195},
-	{0x248e, 196},
-	{0x248f, 197},
-	{0x2490, 198},
-	{0x2491, 199},
-	{0x2492, 200},
-	{0x2493, 201},
-	{0x2494, 202},
-	{0x2495, 203},
-	{0x2496, 204},
-	{0x2497, 205},
-	{0x2498, 206},
-	{0x2499, 207},
-	{0x249a, 208},
-	{0x249b, 209},
-	{0x2500, 738},
-	{0x2501, 739},
-	{0x2502, 740},
-	{0x2503, 741},
-	{0x2504, 742},
-	{0x2505, 743},
-	{0x2506, 744},
-	{0x2507, 745},
-	{0x2508, 746},
-	{0x2509, 747},
-	{0x250a, 748},
-	{0x250b, 749},
-	{0x250c, 750},
-	{0x250d, 751},
-	{0x250e, 752},
-	{0x250f, 753},
-	{0x2510, 754},
-	{0x2511, 755},
-	{0x2512, 756},
-	{0x2513, 757},
-	{0x2514, 758},
-	{0x2515, 759},
-	{0x2516, 760},
-	{0x2517, 761},
-	{0x2518, 762},
-	{0x2519, 763},
-	{0x251a, 764},
-	{0x251b, 765},
-	{0x251c, 766},
-	{0x251d, 767},
-	{0x251e, 768},
-	{0x251f, 769},
-	{0x2520, 770},
-	{0x2521, 771},
-	{0x2522, 772},
-	{0x2523, 773},
-	{0x2524, 774},
-	{0x2525, 775},
-	{0x2526, 776},
-	{0x2527, 777},
-	{0x2528, 778},
-	{0x2529, 779},
-	{0x252a, 780},
-	{0x252b, 781},
-	{0x252c, 782},
-	{0x252d, 783},
-	{0x252e, 784},
-	{0x252f, 785},
-	{0x2530, 786},
-	{0x2531, 787},
-	{0x2532, 788},
-	{0x2533, 789},
-	{0x2534, 790},
-	{0x2535, 791},
-	{0x2536, 792},
-	{0x2537, 793},
-	{0x2538, 794},
-	{0x2539, 795},
-	{0x253a, 796},
-	{0x253b, 797},
-	{0x253c, 798},
-	{0x253d, 799},
-	{0x253e, 800},
-	{0x253f, 801},
-	{0x2540, 802},
-	{0x2541, 803},
-	{0x2542, 804},
-	{0x2543, 805},
-	{0x2544, 806},
-	{0x2545, 807},
-	{0x2546, 808},
-	{0x2547, 809},
-	{0x2548, 810},
-	{0x2549, 811},
-	{0x254a, 812},
-	{0x254b, 813},
-	{0x2550, 9927},
-	{0x2551, 9928},
-	{0x2552, 9929},
-	{0x2553, 9930},
-	{0x2554, 9931},
-	{0x2555, 9932},
-	{0x2556, 9933},
-	{0x2557, 9934},
-	{0x2558, 9935},
-	{0x2559, 9936},
-	{0x255a, 9937},
-	{0x255b, 9938},
-	{0x255c, 9939},
-	{0x255d, 9940},
-	{0x255e, 9941},
-	{0x255f, 9942},
-	{0x2560, 9943},
-	{0x2561, 9944},
-	{0x2562, 9945},
-	{0x2563, 9946},
-	{0x2564, 9947},
-	{0x2565, 9948},
-	{0x2566, 9949},
-	{0x2567, 9950},
-	{0x2568, 9951},
-	{0x2569, 9952},
-	{0x256a, 9953},
-	{0x256b, 9954},
-	{0x256c, 9955},
-	{0x256d, 9956},
-	{0x256e, 9957},
-	{0x256f, 9958},
-	{0x2570, 9959},
-	{0x2571, 9960},
-	{0x2572, 9961},
-	{0x2573, 9962},
-	{0x2581, 9963},
-	{0x2582, 9964},
-	{0x2583, 9965},
-	{0x2584, 9966},
-	{0x2585, 9967},
-	{0x2586, 9968},
-	{0x2587, 9969},
-	{0x2588, 9970},
-	{0x2589, 9971},
-	{0x258a, 9972},
-	{0x258b, 9973},
-	{0x258c, 9974},
-	{0x258d, 9975},
-	{0x258e, 9976},
-	{0x258f, 9977},
-	{0x2593, 9978},
-	{0x2594, 9979},
-	{0x2595, 9980},
-	{0x25a0, 181},
-	{0x25a1, 180},
-	{0x25b2, 183},
-	{0x25b3, 182},
-	{0x25bc, 9981},
-	{0x25bd, 9982},
-	{0x25c6, 179},
-	{0x25c7, 178},
-	{0x25cb, 175},
-	{0x25ce, 177},
-	{0x25cf, 176},
-	{0x25e2, 9983},
-	{0x25e3, 9984},
-	{0x25e4, 9985},
-	{0x25e5, 9986},
-	{0x2605, 174},
-	{0x2606, 173},
-	{0x2609, 9987},
-	{0x2640, 161},
-	{0x2642, 160},
-	{0x2e83, 0},
-	{0x2e86, 0},
-	{0x2e87, 1},
-	{0x2e8a, 0},
-	{0x2e8e, 0},
-	{0x2e8f, 1},
-	{0x2e90, 2},
-	{0x2e91, 3},
-	{0x2e92, 4},
-	{0x2e93, 5},
-	{0x2e94, 6},
-	{0x2e95, 7},
-	{0x2e96, 8},
-	{0x2e99, 0},
-	{0x2e9c, 0},
-	{0x2e9d, 1},
-	{0x2e9e, 2},
-	{0x2e9f, 3},
-	{0x2ea0, 4},
-	{0x2ea1, 5},
-	{0x2ea2, 6},
-	{0x2ea3, 7},
-	{0x2ea4, 8},
-	{0x2ea5, 9},
-	{0x2ea6, 10},
-	{0x2ea9, 0},
-	{0x2eac, 0},
-	{0x2ead, 1},
-	{0x2eb0, 0},
-	{0x2eb1, 1},
-	{0x2eb2, 2},
-	{0x2eb5, 0},
-	{0x2eb7, 0},
-	{0x2eb9, 0},
-	{0x2eba, 1},
-	{0x2ebd, 0},
-	{0x2ebe, 1},
-	{0x2ebf, 2},
-	{0x2ec0, 3},
-	{0x2ec1, 4},
-	{0x2ec2, 5},
-	{0x2ec3, 6},
-	{0x2ec4, 7},
-	{0x2ec5, 8},
-	{0x2ec6, 9},
-	{0x2ec7, 10},
-	{0x2ec8, 11},
-	{0x2ec9, 12},
-	{0x2ecc, 0},
-	{0x2ecd, 1},
-	{0x2ece, 2},
-	{0x2ecf, 3},
-	{0x2ed0, 4},
-	{0x2ed1, 5},
-	{0x2ed2, 6},
-	{0x2ed3, 7},
-	{0x2ed4, 8},
-	{0x2ed5, 9},
-	{0x2ed6, 10},
-	{0x2ed7, 11},
-	{0x2ed8, 12},
-	{0x2ed9, 13},
-	{0x2eda, 14},
-	{0x2edb, 15},
-	{0x2edc, 16},
-	{0x2edd, 17},
-	{0x2ede, 18},
-	{0x2edf, 19},
-	{0x2ee0, 20},
-	{0x2ee1, 21},
-	{0x2ee2, 22},
-	{0x2ee3, 23},
-	{0x2ee4, 24},
-	{0x2ee5, 25},
-	{0x2ee6, 26},
-	{0x2ee7, 27},
-	{0x2ee8, 28},
-	{0x2ee9, 29},
-	{0x2eea, 30},
-	{0x2eeb, 31},
-	{0x2eec, 32},
-	{0x2eed, 33},
-	{0x2eee, 34},
-	{0x2eef, 35},
-	{0x2ef0, 36},
-	{0x2ef1, 37},
-	{0x2ef2, 38},
-	{0x2ef3, 39},
-	{0x2f00, 4162},
-	{0x2f01, 4707},
-	{0x2f02, 4722},
-	{0x2f03, 4709},
-	{0x2f04, 4185},
-	{0x2f06, 1597},
-	{0x2f07, 4867},
-	{0x2f08, 3238},
-	{0x2f09, 1592},
-	{0x2f0a, 3270},
-	{0x2f0b, 982},
-	{0x2f0c, 4765},
-	{0x2f0d, 4884},
-	{0x2f0e, 4879},
-	{0x2f0f, 2091},
-	{0x2f10, 5017},
-	{0x2f11, 1431},
-	{0x2f12, 2543},
-	{0x2f13, 4860},
-	{0x2f14, 4710},
-	{0x2f15, 4740},
-	{0x2f17, 3397},
-	{0x2f18, 1150},
-	{0x2f19, 4946},
-	{0x2f1a, 1228},
-	{0x2f1b, 5020},
-	{0x2f1c, 4283},
-	{0x2f1d, 2407},
-	{0x2f1e, 5523},
-	{0x2f1f, 3698},
-	{0x2f20, 3414},
-	{0x2f21, 5660},
-	{0x2f23, 3859},
-	{0x2f24, 1398},
-	{0x2f25, 2927},
-	{0x2f26, 4656},
-	{0x2f27, 5934},
-	{0x2f28, 1386},
-	{0x2f29, 3948},
-	{0x2f2a, 5302},
-	{0x2f2b, 3395},
-	{0x2f2c, 6004},
-	{0x2f2d, 3318},
-	{0x2f2e, 6165},
-	{0x2f2f, 1789},
-	{0x2f30, 2093},
-	{0x2f31, 2238},
-	{0x2f32, 1732},
-	{0x2f33, 6163},
-	{0x2f34, 1852},
-	{0x2f35, 5016},
-	{0x2f36, 5293},
-	{0x2f37, 5366},
-	{0x2f38, 1798},
-	{0x2f39, 5986},
-	{0x2f3a, 5614},
-	{0x2f3b, 5600},
-	{0x2f3c, 3983},
-	{0x2f3d, 1765},
-	{0x2f3f, 3437},
-	{0x2f40, 4518},
-	{0x2f41, 6409},
-	{0x2f42, 3795},
-	{0x2f43, 1526},
-	{0x2f44, 2240},
-	{0x2f45, 1626},
-	{0x2f46, 3821},
-	{0x2f47, 3248},
-	{0x2f48, 4350},
-	{0x2f49, 4357},
-	{0x2f4a, 2849},
-	{0x2f4b, 3124},
-	{0x2f4c, 4536},
-	{0x2f4d, 1400},
-	{0x2f4e, 6589},
-	{0x2f4f, 3826},
-	{0x2f50, 1073},
-	{0x2f51, 2736},
-	{0x2f52, 3430},
-	{0x2f53, 3095},
-	{0x2f54, 3491},
-	{0x2f55, 2053},
-	{0x2f56, 4611},
-	{0x2f57, 1715},
-	{0x2f58, 4713},
-	{0x2f59, 5789},
-	{0x2f5a, 3019},
-	{0x2f5b, 4073},
-	{0x2f5c, 2916},
-	{0x2f5d, 3209},
-	{0x2f5e, 4041},
-	{0x2f5f, 4310},
-	{0x2f60, 1832},
-	{0x2f61, 3728},
-	{0x2f62, 1733},
-	{0x2f63, 3379},
-	{0x2f64, 4264},
-	{0x2f65, 3650},
-	{0x2f66, 7110},
-	{0x2f67, 7008},
-	{0x2f69, 994},
-	{0x2f6a, 3011},
-	{0x2f6b, 2808},
-	{0x2f6c, 2850},
-	{0x2f6d, 2737},
-	{0x2f6e, 3407},
-	{0x2f6f, 3398},
-	{0x2f70, 3413},
-	{0x2f72, 1923},
-	{0x2f73, 4049},
-	{0x2f74, 2539},
-	{0x2f75, 4592},
-	{0x2f76, 2780},
-	{0x2f77, 7399},
-	{0x2f78, 7262},
-	{0x2f79, 3753},
-	{0x2f7a, 4123},
-	{0x2f7b, 4309},
-	{0x2f7c, 2490},
-	{0x2f7d, 1591},
-	{0x2f7e, 7115},
-	{0x2f7f, 1593},
-	{0x2f80, 6686},
-	{0x2f81, 3261},
-	{0x2f82, 1249},
-	{0x2f83, 4657},
-	{0x2f84, 4544},
-	{0x2f85, 2297},
-	{0x2f86, 3353},
-	{0x2f87, 5656},
-	{0x2f88, 4570},
-	{0x2f89, 7388},
-	{0x2f8a, 3300},
-	{0x2f8c, 7152},
-	{0x2f8d, 1291},
-	{0x2f8e, 4051},
-	{0x2f8f, 3995},
-	{0x2f90, 4169},
-	{0x2f92, 8086},
-	{0x2f93, 2200},
-	{0x2f94, 4093},
-	{0x2f95, 1825},
-	{0x2f96, 1528},
-	{0x2f97, 7445},
-	{0x2f98, 7504},
-	{0x2f99, 7739},
-	{0x2f9a, 1285},
-	{0x2f9b, 4668},
-	{0x2f9c, 4672},
-	{0x2f9d, 3366},
-	{0x2f9e, 7803},
-	{0x2f9f, 3980},
-	{0x2fa0, 1250},
-	{0x2fa2, 4191},
-	{0x2fa3, 4276},
-	{0x2fa5, 2522},
-	{0x2fa6, 2241},
-	{0x2fa7, 7797},
-	{0x2fa8, 8317},
-	{0x2fa9, 1714},
-	{0x2faa, 2542},
-	{0x2fab, 7545},
-	{0x2fac, 4303},
-	{0x2fae, 1636},
-	{0x2faf, 2795},
-	{0x2fb0, 1770},
-	{0x2fb1, 8589},
-	{0x2fb2, 2289},
-	{0x2fb3, 4219},
-	{0x2fb4, 8713},
-	{0x2fb5, 7936},
-	{0x2fb6, 7924},
-	{0x2fb7, 3402},
-	{0x2fb8, 3438},
-	{0x2fb9, 3920},
-	{0x2fba, 8301},
-	{0x2fbb, 1824},
-	{0x2fbc, 1754},
-	{0x2fbd, 7660},
-	{0x2fbe, 7888},
-	{0x2fbf, 5019},
-	{0x2fc0, 4704},
-	{0x2fc1, 1862},
-	{0x2fc2, 8761},
-	{0x2fc3, 8348},
-	{0x2fc4, 9864},
-	{0x2fc5, 2656},
-	{0x2fc6, 8305},
-	{0x2fc7, 2704},
-	{0x2fc9, 3465},
-	{0x2fca, 1937},
-	{0x2fcb, 6741},
-	{0x2fcc, 9752},
-	{0x2fcd, 1509},
-	{0x2fce, 1821},
-	{0x2fcf, 3466},
-	{0x2fd0, 1072},
-	{0x2fd1, 8390},
-	{0x2fd2, 7814},
-	{0x2fd3, 8247},
-	{0x2fd4, 7988},
-	{0x2fd5, 4851},
-	{0x2ff1, 0},
-	{0x2ff2, 1},
-	{0x2ff3, 2},
-	{0x2ff4, 3},
-	{0x2ff5, 4},
-	{0x2ff6, 5},
-	{0x2ff7, 6},
-	{0x2ff8, 7},
-	{0x2ff9, 8},
-	{0x2ffa, 9},
-	{0x2ffb, 10},
-	{0x3000, 96},
-	{0x3001, 97},
-	{0x3002, 98},
-	{0x3003, 103},
-	{0x3005, 104},
-	{0x3007, 7703},
-	{0x3008, 115},
-	{0x3009, 116},
-	{0x300a, 117},
-	{0x300b, 118},
-	{0x300c, 119},
-	{0x300d, 120},
-	{0x300e, 121},
-	{0x300f, 122},
-	{0x3010, 125},
-	{0x3011, 126},
-	{0x3012, 9989},
-	{0x3013, 189},
-	{0x3014, 113},
-	{0x3015, 114},
-	{0x3016, 123},
-	{0x3017, 124},
-	{0x301d, 9990},
-	{0x301e, 9991},
-	{0x3021, 9992},
-	{0x3022, 9993},
-	{0x3023, 9994},
-	{0x3024, 9995},
-	{0x3025, 9996},
-	{0x3026, 9997},
-	{0x3027, 9998},
-	{0x3028, 9999},
-	{0x3029, 10000},
-	{0x3034, 0},
-	{0x3035, 1},
-	{0x3039, 0},
-	{0x303a, 1},
-	{0x3041, 356},
-	{0x3042, 357},
-	{0x3043, 358},
-	{0x3044, 359},
-	{0x3045, 360},
-	{0x3046, 361},
-	{0x3047, 362},
-	{0x3048, 363},
-	{0x3049, 364},
-	{0x304a, 365},
-	{0x304b, 366},
-	{0x304c, 367},
-	{0x304d, 368},
-	{0x304e, 369},
-	{0x304f, 370},
-	{0x3050, 371},
-	{0x3051, 372},
-	{0x3052, 373},
-	{0x3053, 374},
-	{0x3054, 375},
-	{0x3055, 376},
-	{0x3056, 377},
-	{0x3057, 378},
-	{0x3058, 379},
-	{0x3059, 380},
-	{0x305a, 381},
-	{0x305b, 382},
-	{0x305c, 383},
-	{0x305d, 384},
-	{0x305e, 385},
-	{0x305f, 386},
-	{0x3060, 387},
-	{0x3061, 388},
-	{0x3062, 389},
-	{0x3063, 390},
-	{0x3064, 391},
-	{0x3065, 392},
-	{0x3066, 393},
-	{0x3067, 394},
-	{0x3068, 395},
-	{0x3069, 396},
-	{0x306a, 397},
-	{0x306b, 398},
-	{0x306c, 399},
-	{0x306d, 400},
-	{0x306e, 401},
-	{0x306f, 402},
-	{0x3070, 403},
-	{0x3071, 404},
-	{0x3072, 405},
-	{0x3073, 406},
-	{0x3074, 407},
-	{0x3075, 408},
-	{0x3076, 409},
-	{0x3077, 410},
-	{0x3078, 411},
-	{0x3079, 412},
-	{0x307a, 413},
-	{0x307b, 414},
-	{0x307c, 415},
-	{0x307d, 416},
-	{0x307e, 417},
-	{0x307f, 418},
-	{0x3080, 419},
-	{0x3081, 420},
-	{0x3082, 421},
-	{0x3083, 422},
-	{0x3084, 423},
-	{0x3085, 424},
-	{0x3086, 425},
-	{0x3087, 426},
-	{0x3088, 427},
-	{0x3089, 428},
-	{0x308a, 429},
-	{0x308b, 430},
-	{0x308c, 431},
-	{0x308d, 432},
-	{0x308e, 433},
-	{0x308f, 434},
-	{0x3090, 435},
-	{0x3091, 436},
-	{0x3092, 437},
-	{0x3093, 438},
-	{0x309c, 0},
-	{0x309e, 0},
-	{0x30a1, 439},
-	{0x30a2, 440},
-	{0x30a3, 441},
-	{0x30a4, 442},
-	{0x30a5, 443},
-	{0x30a6, 444},
-	{0x30a7, 445},
-	{0x30a8, 446},
-	{0x30a9, 447},
-	{0x30aa, 448},
-	{0x30ab, 449},
-	{0x30ac, 450},
-	{0x30ad, 451},
-	{0x30ae, 452},
-	{0x30af, 453},
-	{0x30b0, 454},
-	{0x30b1, 455},
-	{0x30b2, 456},
-	{0x30b3, 457},
-	{0x30b4, 458},
-	{0x30b5, 459},
-	{0x30b6, 460},
-	{0x30b7, 461},
-	{0x30b8, 462},
-	{0x30b9, 463},
-	{0x30ba, 464},
-	{0x30bb, 465},
-	{0x30bc, 466},
-	{0x30bd, 467},
-	{0x30be, 468},
-	{0x30bf, 469},
-	{0x30c0, 470},
-	{0x30c1, 471},
-	{0x30c2, 472},
-	{0x30c3, 473},
-	{0x30c4, 474},
-	{0x30c5, 475},
-	{0x30c6, 476},
-	{0x30c7, 477},
-	{0x30c8, 478},
-	{0x30c9, 479},
-	{0x30ca, 480},
-	{0x30cb, 481},
-	{0x30cc, 482},
-	{0x30cd, 483},
-	{0x30ce, 484},
-	{0x30cf, 485},
-	{0x30d0, 486},
-	{0x30d1, 487},
-	{0x30d2, 488},
-	{0x30d3, 489},
-	{0x30d4, 490},
-	{0x30d5, 491},
-	{0x30d6, 492},
-	{0x30d7, 493},
-	{0x30d8, 494},
-	{0x30d9, 495},
-	{0x30da, 496},
-	{0x30db, 497},
-	{0x30dc, 498},
-	{0x30dd, 499},
-	{0x30de, 500},
-	{0x30df, 501},
-	{0x30e0, 502},
-	{0x30e1, 503},
-	{0x30e2, 504},
-	{0x30e3, 505},
-	{0x30e4, 506},
-	{0x30e5, 507},
-	{0x30e6, 508},
-	{0x30e7, 509},
-	{0x30e8, 510},
-	{0x30e9, 511},
-	{0x30ea, 512},
-	{0x30eb, 513},
-	{0x30ec, 514},
-	{0x30ed, 515},
-	{0x30ee, 516},
-	{0x30ef, 517},
-	{0x30f0, 518},
-	{0x30f1, 519},
-	{0x30f2, 520},
-	{0x30f3, 521},
-	{0x30f4, 522},
-	{0x30f5, 523},
-	{0x30f6, 524},
-	{0x30f8, 0},
-	{0x30f9, 1},
-	{0x30fa, 2},
-	{0x30fb, 99},
-	{0x30fe, 0},
-	{0x3105, 700},
-	{0x3106, 701},
-	{0x3107, 702},
-	{0x3108, 703},
-	{0x3109, 704},
-	{0x310a, 705},
-	{0x310b, 706},
-	{0x310c, 707},
-	{0x310d, 708},
-	{0x310e, 709},
-	{0x310f, 710},
-	{0x3110, 711},
-	{0x3111, 712},
-	{0x3112, 713},
-	{0x3113, 714},
-	{0x3114, 715},
-	{0x3115, 716},
-	{0x3116, 717},
-	{0x3117, 718},
-	{0x3118, 719},
-	{0x3119, 720},
-	{0x311a, 721},
-	{0x311b, 722},
-	{0x311c, 723},
-	{0x311d, 724},
-	{0x311e, 725},
-	{0x311f, 726},
-	{0x3120, 727},
-	{0x3121, 728},
-	{0x3122, 729},
-	{0x3123, 730},
-	{0x3124, 731},
-	{0x3125, 732},
-	{0x3126, 733},
-	{0x3127, 734},
-	{0x3128, 735},
-	{0x3129, 736},
-	{0x312b, 0},
-	{0x312c, 1},
-	{0x31a1, 0},
-	{0x31a2, 1},
-	{0x31a3, 2},
-	{0x31a4, 3},
-	{0x31a5, 4},
-	{0x31a6, 5},
-	{0x31a7, 6},
-	{0x31a8, 7},
-	{0x31a9, 8},
-	{0x31aa, 9},
-	{0x31ab, 10},
-	{0x31ac, 11},
-	{0x31ad, 12},
-	{0x31ae, 13},
-	{0x31af, 14},
-	{0x31b0, 15},
-	{0x31b1, 16},
-	{0x31b2, 17},
-	{0x31b3, 18},
-	{0x31b4, 19},
-	{0x31b5, 20},
-	{0x31b6, 21},
-	{0x31b7, 22},
-	{0x3220, 240},
-	{0x3221, 241},
-	{0x3222, 242},
-	{0x3223, 243},
-	{0x3224, 244},
-	{0x3225, 245},
-	{0x3226, 246},
-	{0x3227, 247},
-	{0x3228, 248},
-	{0x3229, 249},
-	{0x338f, 0},
-	{0x339d, 0},
-	{0x339e, 1},
-	{0x33d2, 0},
-	{0x3401, 0},
-	{0x3402, 1},
-	{0x3403, 2},
-	{0x3404, 3},
-	{0x3405, 4},
-	{0x3406, 5},
-	{0x3407, 6},
-	{0x3408, 7},
-	{0x3409, 8},
-	{0x340a, 9},
-	{0x340b, 10},
-	{0x340c, 11},
-	{0x340d, 12},
-	{0x340e, 13},
-	{0x340f, 14},
-	{0x3410, 15},
-	{0x3411, 16},
-	{0x3412, 17},
-	{0x3413, 18},
-	{0x3414, 19},
-	{0x3415, 20},
-	{0x3416, 21},
-	{0x3417, 22},
-	{0x3418, 23},
-	{0x3419, 24},
-	{0x341a, 25},
-	{0x341b, 26},
-	{0x341c, 27},
-	{0x341d, 28},
-	{0x341e, 29},
-	{0x341f, 30},
-	{0x3420, 31},
-	{0x3421, 32},
-	{0x3422, 33},
-	{0x3423, 34},
-	{0x3424, 35},
-	{0x3425, 36},
-	{0x3426, 37},
-	{0x3427, 38},
-	{0x3428, 39},
-	{0x3429, 40},
-	{0x342a, 41},
-	{0x342b, 42},
-	{0x342c, 43},
-	{0x342d, 44},
-	{0x342e, 45},
-	{0x342f, 46},
-	{0x3430, 47},
-	{0x3431, 48},
-	{0x3432, 49},
-	{0x3433, 50},
-	{0x3434, 51},
-	{0x3435, 52},
-	{0x3436, 53},
-	{0x3437, 54},
-	{0x3438, 55},
-	{0x3439, 56},
-	{0x343a, 57},
-	{0x343b, 58},
-	{0x343c, 59},
-	{0x343d, 60},
-	{0x343e, 61},
-	{0x343f, 62},
-	{0x3440, 63},
-	{0x3441, 64},
-	{0x3442, 65},
-	{0x3443, 66},
-	{0x3444, 67},
-	{0x3445, 68},
-	{0x3446, 69},
-	{0x3449, 0},
-	{0x344a, 1},
-	{0x344b, 2},
-	{0x344c, 3},
-	{0x344d, 4},
-	{0x344e, 5},
-	{0x344f, 6},
-	{0x3450, 7},
-	{0x3451, 8},
-	{0x3452, 9},
-	{0x3453, 10},
-	{0x3454, 11},
-	{0x3455, 12},
-	{0x3456, 13},
-	{0x3457, 14},
-	{0x3458, 15},
-	{0x3459, 16},
-	{0x345a, 17},
-	{0x345b, 18},
-	{0x345c, 19},
-	{0x345d, 20},
-	{0x345e, 21},
-	{0x345f, 22},
-	{0x3460, 23},
-	{0x3461, 24},
-	{0x3462, 25},
-	{0x3463, 26},
-	{0x3464, 27},
-	{0x3465, 28},
-	{0x3466, 29},
-	{0x3467, 30},
-	{0x3468, 31},
-	{0x3469, 32},
-	{0x346a, 33},
-	{0x346b, 34},
-	{0x346c, 35},
-	{0x346d, 36},
-	{0x346e, 37},
-	{0x346f, 38},
-	{0x3470, 39},
-	{0x3471, 40},
-	{0x3472, 41},
-	{0x3475, 0},
-	{0x3476, 1},
-	{0x3477, 2},
-	{0x3478, 3},
-	{0x3479, 4},
-	{0x347a, 5},
-	{0x347b, 6},
-	{0x347c, 7},
-	{0x347d, 8},
-	{0x347e, 9},
-	{0x347f, 10},
-	{0x3480, 11},
-	{0x3481, 12},
-	{0x3482, 13},
-	{0x3483, 14},
-	{0x3484, 15},
-	{0x3485, 16},
-	{0x3486, 17},
-	{0x3487, 18},
-	{0x3488, 19},
-	{0x3489, 20},
-	{0x348a, 21},
-	{0x348b, 22},
-	{0x348c, 23},
-	{0x348d, 24},
-	{0x348e, 25},
-	{0x348f, 26},
-	{0x3490, 27},
-	{0x3491, 28},
-	{0x3492, 29},
-	{0x3493, 30},
-	{0x3494, 31},
-	{0x3495, 32},
-	{0x3496, 33},
-	{0x3497, 34},
-	{0x3498, 35},
-	{0x3499, 36},
-	{0x349a, 37},
-	{0x349b, 38},
-	{0x349c, 39},
-	{0x349d, 40},
-	{0x349e, 41},
-	{0x349f, 42},
-	{0x34a0, 43},
-	{0x34a1, 44},
-	{0x34a2, 45},
-	{0x34a3, 46},
-	{0x34a4, 47},
-	{0x34a5, 48},
-	{0x34a6, 49},
-	{0x34a7, 50},
-	{0x34a8, 51},
-	{0x34a9, 52},
-	{0x34aa, 53},
-	{0x34ab, 54},
-	{0x34ac, 55},
-	{0x34ad, 56},
-	{0x34ae, 57},
-	{0x34af, 58},
-	{0x34b0, 59},
-	{0x34b1, 60},
-	{0x34b2, 61},
-	{0x34b3, 62},
-	{0x34b4, 63},
-	{0x34b5, 64},
-	{0x34b6, 65},
-	{0x34b7, 66},
-	{0x34b8, 67},
-	{0x34b9, 68},
-	{0x34ba, 69},
-	{0x34bb, 70},
-	{0x34bc, 71},
-	{0x34bd, 72},
-	{0x34be, 73},
-	{0x34bf, 74},
-	{0x34c0, 75},
-	{0x34c1, 76},
-	{0x34c2, 77},
-	{0x34c3, 78},
-	{0x34c4, 79},
-	{0x34c5, 80},
-	{0x34c6, 81},
-	{0x34c7, 82},
-	{0x34c8, 83},
-	{0x34c9, 84},
-	{0x34ca, 85},
-	{0x34cb, 86},
-	{0x34cc, 87},
-	{0x34cd, 88},
-	{0x34ce, 89},
-	{0x34cf, 90},
-	{0x34d0, 91},
-	{0x34d1, 92},
-	{0x34d2, 93},
-	{0x34d3, 94},
-	{0x34d4, 95},
-	{0x34d5, 96},
-	{0x34d6, 97},
-	{0x34d7, 98},
-	{0x34d8, 99},
-	{0x34d9, 100},
-	{0x34da, 101},
-	{0x34db, 102},
-	{0x34dc, 103},
-	{0x34dd, 104},
-	{0x34de, 105},
-	{0x34df, 106},
-	{0x34e0, 107},
-	{0x34e1, 108},
-	{0x34e2, 109},
-	{0x34e3, 110},
-	{0x34e4, 111},
-	{0x34e5, 112},
-	{0x34e6, 113},
-	{0x34e7, 114},
-	{0x34e8, 115},
-	{0x34e9, 116},
-	{0x34ea, 117},
-	{0x34eb, 118},
-	{0x34ec, 119},
-	{0x34ed, 120},
-	{0x34ee, 121},
-	{0x34ef, 122},
-	{0x34f0, 123},
-	{0x34f1, 124},
-	{0x34f2, 125},
-	{0x34f3, 126},
-	{0x34f4, 127},
-	{0x34f5, 128},
-	{0x34f6, 129},
-	{0x34f7, 130},
-	{0x34f8, 131},
-	{0x34f9, 132},
-	{0x34fa, 133},
-	{0x34fb, 134},
-	{0x34fc, 135},
-	{0x34fd, 136},
-	{0x34fe, 137},
-	{0x34ff, 138},
-	{0x3501, 0},
-	{0x3502, 1},
-	{0x3503, 2},
-	{0x3504, 3},
-	{0x3505, 4},
-	{0x3506, 5},
-	{0x3507, 6},
-	{0x3508, 7},
-	{0x3509, 8},
-	{0x350a, 9},
-	{0x350b, 10},
-	{0x350c, 11},
-	{0x350d, 12},
-	{0x350e, 13},
-	{0x350f, 14},
-	{0x3510, 15},
-	{0x3511, 16},
-	{0x3512, 17},
-	{0x3513, 18},
-	{0x3514, 19},
-	{0x3515, 20},
-	{0x3516, 21},
-	{0x3517, 22},
-	{0x3518, 23},
-	{0x3519, 24},
-	{0x351a, 25},
-	{0x351b, 26},
-	{0x351c, 27},
-	{0x351d, 28},
-	{0x351e, 29},
-	{0x351f, 30},
-	{0x3520, 31},
-	{0x3521, 32},
-	{0x3522, 33},
-	{0x3523, 34},
-	{0x3524, 35},
-	{0x3525, 36},
-	{0x3526, 37},
-	{0x3527, 38},
-	{0x3528, 39},
-	{0x3529, 40},
-	{0x352a, 41},
-	{0x352b, 42},
-	{0x352c, 43},
-	{0x352d, 44},
-	{0x352e, 45},
-	{0x352f, 46},
-	{0x3530, 47},
-	{0x3531, 48},
-	{0x3532, 49},
-	{0x3533, 50},
-	{0x3534, 51},
-	{0x3535, 52},
-	{0x3536, 53},
-	{0x3537, 54},
-	{0x3538, 55},
-	{0x3539, 56},
-	{0x353a, 57},
-	{0x353b, 58},
-	{0x353c, 59},
-	{0x353d, 60},
-	{0x353e, 61},
-	{0x353f, 62},
-	{0x3540, 63},
-	{0x3541, 64},
-	{0x3542, 65},
-	{0x3543, 66},
-	{0x3544, 67},
-	{0x3545, 68},
-	{0x3546, 69},
-	{0x3547, 70},
-	{0x3548, 71},
-	{0x3549, 72},
-	{0x354a, 73},
-	{0x354b, 74},
-	{0x354c, 75},
-	{0x354d, 76},
-	{0x354e, 77},
-	{0x354f, 78},
-	{0x3550, 79},
-	{0x3551, 80},
-	{0x3552, 81},
-	{0x3553, 82},
-	{0x3554, 83},
-	{0x3555, 84},
-	{0x3556, 85},
-	{0x3557, 86},
-	{0x3558, 87},
-	{0x3559, 88},
-	{0x355a, 89},
-	{0x355b, 90},
-	{0x355c, 91},
-	{0x355d, 92},
-	{0x355e, 93},
-	{0x355f, 94},
-	{0x3560, 95},
-	{0x3561, 96},
-	{0x3562, 97},
-	{0x3563, 98},
-	{0x3564, 99},
-	{0x3565, 100},
-	{0x3566, 101},
-	{0x3567, 102},
-	{0x3568, 103},
-	{0x3569, 104},
-	{0x356a, 105},
-	{0x356b, 106},
-	{0x356c, 107},
-	{0x356d, 108},
-	{0x356e, 109},
-	{0x356f, 110},
-	{0x3570, 111},
-	{0x3571, 112},
-	{0x3572, 113},
-	{0x3573, 114},
-	{0x3574, 115},
-	{0x3575, 116},
-	{0x3576, 117},
-	{0x3577, 118},
-	{0x3578, 119},
-	{0x3579, 120},
-	{0x357a, 121},
-	{0x357b, 122},
-	{0x357c, 123},
-	{0x357d, 124},
-	{0x357e, 125},
-	{0x357f, 126},
-	{0x3580, 127},
-	{0x3581, 128},
-	{0x3582, 129},
-	{0x3583, 130},
-	{0x3584, 131},
-	{0x3585, 132},
-	{0x3586, 133},
-	{0x3587, 134},
-	{0x3588, 135},
-	{0x3589, 136},
-	{0x358a, 137},
-	{0x358b, 138},
-	{0x358c, 139},
-	{0x358d, 140},
-	{0x358e, 141},
-	{0x358f, 142},
-	{0x3590, 143},
-	{0x3591, 144},
-	{0x3592, 145},
-	{0x3593, 146},
-	{0x3594, 147},
-	{0x3595, 148},
-	{0x3596, 149},
-	{0x3597, 150},
-	{0x3598, 151},
-	{0x3599, 152},
-	{0x359a, 153},
-	{0x359b, 154},
-	{0x359c, 155},
-	{0x359d, 156},
-	{0x35a0, 0},
-	{0x35a1, 1},
-	{0x35a2, 2},
-	{0x35a3, 3},
-	{0x35a4, 4},
-	{0x35a5, 5},
-	{0x35a6, 6},
-	{0x35a7, 7},
-	{0x35a8, 8},
-	{0x35a9, 9},
-	{0x35aa, 10},
-	{0x35ab, 11},
-	{0x35ac, 12},
-	{0x35ad, 13},
-	{0x35ae, 14},
-	{0x35af, 15},
-	{0x35b0, 16},
-	{0x35b1, 17},
-	{0x35b2, 18},
-	{0x35b3, 19},
-	{0x35b4, 20},
-	{0x35b5, 21},
-	{0x35b6, 22},
-	{0x35b7, 23},
-	{0x35b8, 24},
-	{0x35b9, 25},
-	{0x35ba, 26},
-	{0x35bb, 27},
-	{0x35bc, 28},
-	{0x35bd, 29},
-	{0x35be, 30},
-	{0x35bf, 31},
-	{0x35c0, 32},
-	{0x35c1, 33},
-	{0x35c2, 34},
-	{0x35c3, 35},
-	{0x35c4, 36},
-	{0x35c5, 37},
-	{0x35c6, 38},
-	{0x35c7, 39},
-	{0x35c8, 40},
-	{0x35c9, 41},
-	{0x35ca, 42},
-	{0x35cb, 43},
-	{0x35cc, 44},
-	{0x35cd, 45},
-	{0x35ce, 46},
-	{0x35cf, 47},
-	{0x35d0, 48},
-	{0x35d1, 49},
-	{0x35d2, 50},
-	{0x35d3, 51},
-	{0x35d4, 52},
-	{0x35d5, 53},
-	{0x35d6, 54},
-	{0x35d7, 55},
-	{0x35d8, 56},
-	{0x35d9, 57},
-	{0x35da, 58},
-	{0x35db, 59},
-	{0x35dc, 60},
-	{0x35dd, 61},
-	{0x35de, 62},
-	{0x35df, 63},
-	{0x35e0, 64},
-	{0x35e1, 65},
-	{0x35e2, 66},
-	{0x35e3, 67},
-	{0x35e4, 68},
-	{0x35e5, 69},
-	{0x35e6, 70},
-	{0x35e7, 71},
-	{0x35e8, 72},
-	{0x35e9, 73},
-	{0x35ea, 74},
-	{0x35eb, 75},
-	{0x35ec, 76},
-	{0x35ed, 77},
-	{0x35ee, 78},
-	{0x35ef, 79},
-	{0x35f0, 80},
-	{0x35f1, 81},
-	{0x35f2, 82},
-	{0x35f3, 83},
-	{0x35f4, 84},
-	{0x35f5, 85},
-	{0x35f6, 86},
-	{0x35f7, 87},
-	{0x35f8, 88},
-	{0x35f9, 89},
-	{0x35fa, 90},
-	{0x35fb, 91},
-	{0x35fc, 92},
-	{0x35fd, 93},
-	{0x35fe, 94},
-	{0x35ff, 95},
-	{0x3601, 0},
-	{0x3602, 1},
-	{0x3603, 2},
-	{0x3604, 3},
-	{0x3605, 4},
-	{0x3606, 5},
-	{0x3607, 6},
-	{0x3608, 7},
-	{0x3609, 8},
-	{0x360a, 9},
-	{0x360b, 10},
-	{0x360c, 11},
-	{0x360d, 12},
-	{0x3610, 0},
-	{0x3611, 1},
-	{0x3612, 2},
-	{0x3613, 3},
-	{0x3614, 4},
-	{0x3615, 5},
-	{0x3616, 6},
-	{0x3617, 7},
-	{0x3618, 8},
-	{0x3619, 9},
-	{0x361c, 0},
-	{0x361d, 1},
-	{0x361e, 2},
-	{0x361f, 3},
-	{0x3620, 4},
-	{0x3621, 5},
-	{0x3622, 6},
-	{0x3623, 7},
-	{0x3624, 8},
-	{0x3625, 9},
-	{0x3626, 10},
-	{0x3627, 11},
-	{0x3628, 12},
-	{0x3629, 13},
-	{0x362a, 14},
-	{0x362b, 15},
-	{0x362c, 16},
-	{0x362d, 17},
-	{0x362e, 18},
-	{0x362f, 19},
-	{0x3630, 20},
-	{0x3631, 21},
-	{0x3632, 22},
-	{0x3633, 23},
-	{0x3634, 24},
-	{0x3635, 25},
-	{0x3636, 26},
-	{0x3637, 27},
-	{0x3638, 28},
-	{0x3639, 29},
-	{0x363a, 30},
-	{0x363b, 31},
-	{0x363c, 32},
-	{0x363d, 33},
-	{0x363e, 34},
-	{0x363f, 35},
-	{0x3640, 36},
-	{0x3641, 37},
-	{0x3642, 38},
-	{0x3643, 39},
-	{0x3644, 40},
-	{0x3645, 41},
-	{0x3646, 42},
-	{0x3647, 43},
-	{0x3648, 44},
-	{0x3649, 45},
-	{0x364a, 46},
-	{0x364b, 47},
-	{0x364c, 48},
-	{0x364d, 49},
-	{0x364e, 50},
-	{0x364f, 51},
-	{0x3650, 52},
-	{0x3651, 53},
-	{0x3652, 54},
-	{0x3653, 55},
-	{0x3654, 56},
-	{0x3655, 57},
-	{0x3656, 58},
-	{0x3657, 59},
-	{0x3658, 60},
-	{0x3659, 61},
-	{0x365a, 62},
-	{0x365b, 63},
-	{0x365c, 64},
-	{0x365d, 65},
-	{0x365e, 66},
-	{0x365f, 67},
-	{0x3660, 68},
-	{0x3661, 69},
-	{0x3662, 70},
-	{0x3663, 71},
-	{0x3664, 72},
-	{0x3665, 73},
-	{0x3666, 74},
-	{0x3667, 75},
-	{0x3668, 76},
-	{0x3669, 77},
-	{0x366a, 78},
-	{0x366b, 79},
-	{0x366c, 80},
-	{0x366d, 81},
-	{0x366e, 82},
-	{0x366f, 83},
-	{0x3670, 84},
-	{0x3671, 85},
-	{0x3672, 86},
-	{0x3673, 87},
-	{0x3674, 88},
-	{0x3675, 89},
-	{0x3676, 90},
-	{0x3677, 91},
-	{0x3678, 92},
-	{0x3679, 93},
-	{0x367a, 94},
-	{0x367b, 95},
-	{0x367c, 96},
-	{0x367d, 97},
-	{0x367e, 98},
-	{0x367f, 99},
-	{0x3680, 100},
-	{0x3681, 101},
-	{0x3682, 102},
-	{0x3683, 103},
-	{0x3684, 104},
-	{0x3685, 105},
-	{0x3686, 106},
-	{0x3687, 107},
-	{0x3688, 108},
-	{0x3689, 109},
-	{0x368a, 110},
-	{0x368b, 111},
-	{0x368c, 112},
-	{0x368d, 113},
-	{0x368e, 114},
-	{0x368f, 115},
-	{0x3690, 116},
-	{0x3691, 117},
-	{0x3692, 118},
-	{0x3693, 119},
-	{0x3694, 120},
-	{0x3695, 121},
-	{0x3696, 122},
-	{0x3697, 123},
-	{0x3698, 124},
-	{0x3699, 125},
-	{0x369a, 126},
-	{0x369b, 127},
-	{0x369c, 128},
-	{0x369d, 129},
-	{0x369e, 130},
-	{0x369f, 131},
-	{0x36a0, 132},
-	{0x36a1, 133},
-	{0x36a2, 134},
-	{0x36a3, 135},
-	{0x36a4, 136},
-	{0x36a5, 137},
-	{0x36a6, 138},
-	{0x36a7, 139},
-	{0x36a8, 140},
-	{0x36a9, 141},
-	{0x36aa, 142},
-	{0x36ab, 143},
-	{0x36ac, 144},
-	{0x36ad, 145},
-	{0x36ae, 146},
-	{0x36af, 147},
-	{0x36b0, 148},
-	{0x36b1, 149},
-	{0x36b2, 150},
-	{0x36b3, 151},
-	{0x36b4, 152},
-	{0x36b5, 153},
-	{0x36b6, 154},
-	{0x36b7, 155},
-	{0x36b8, 156},
-	{0x36b9, 157},
-	{0x36ba, 158},
-	{0x36bb, 159},
-	{0x36bc, 160},
-	{0x36bd, 161},
-	{0x36be, 162},
-	{0x36bf, 163},
-	{0x36c0, 164},
-	{0x36c1, 165},
-	{0x36c2, 166},
-	{0x36c3, 167},
-	{0x36c4, 168},
-	{0x36c5, 169},
-	{0x36c6, 170},
-	{0x36c7, 171},
-	{0x36c8, 172},
-	{0x36c9, 173},
-	{0x36ca, 174},
-	{0x36cb, 175},
-	{0x36cc, 176},
-	{0x36cd, 177},
-	{0x36ce, 178},
-	{0x36cf, 179},
-	{0x36d0, 180},
-	{0x36d1, 181},
-	{0x36d2, 182},
-	{0x36d3, 183},
-	{0x36d4, 184},
-	{0x36d5, 185},
-	{0x36d6, 186},
-	{0x36d7, 187},
-	{0x36d8, 188},
-	{0x36d9, 189},
-	{0x36da, 190},
-	{0x36db, 191},
-	{0x36dc, 192},
-	{0x36dd, 193},
-	{0x36de, 194},
-	{0x36df, 195},
-	{0x36e0, 196},
-	{0x36e1, 197},
-	{0x36e2, 198},
-	{0x36e3, 199},
-	{0x36e4, 200},
-	{0x36e5, 201},
-	{0x36e6, 202},
-	{0x36e7, 203},
-	{0x36e8, 204},
-	{0x36e9, 205},
-	{0x36ea, 206},
-	{0x36eb, 207},
-	{0x36ec, 208},
-	{0x36ed, 209},
-	{0x36ee, 210},
-	{0x36ef, 211},
-	{0x36f0, 212},
-	{0x36f1, 213},
-	{0x36f2, 214},
-	{0x36f3, 215},
-	{0x36f4, 216},
-	{0x36f5, 217},
-	{0x36f6, 218},
-	{0x36f7, 219},
-	{0x36f8, 220},
-	{0x36f9, 221},
-	{0x36fa, 222},
-	{0x36fb, 223},
-	{0x36fc, 224},
-	{0x36fd, 225},
-	{0x36fe, 226},
-	{0x36ff, 227},
-	{0x3701, 0},
-	{0x3702, 1},
-	{0x3703, 2},
-	{0x3704, 3},
-	{0x3705, 4},
-	{0x3706, 5},
-	{0x3707, 6},
-	{0x3708, 7},
-	{0x3709, 8},
-	{0x370a, 9},
-	{0x370b, 10},
-	{0x370c, 11},
-	{0x370d, 12},
-	{0x370e, 13},
-	{0x370f, 14},
-	{0x3710, 15},
-	{0x3711, 16},
-	{0x3712, 17},
-	{0x3713, 18},
-	{0x3714, 19},
-	{0x3715, 20},
-	{0x3716, 21},
-	{0x3717, 22},
-	{0x3718, 23},
-	{0x3719, 24},
-	{0x371a, 25},
-	{0x371b, 26},
-	{0x371c, 27},
-	{0x371d, 28},
-	{0x371e, 29},
-	{0x371f, 30},
-	{0x3720, 31},
-	{0x3721, 32},
-	{0x3722, 33},
-	{0x3723, 34},
-	{0x3724, 35},
-	{0x3725, 36},
-	{0x3726, 37},
-	{0x3727, 38},
-	{0x3728, 39},
-	{0x3729, 40},
-	{0x372a, 41},
-	{0x372b, 42},
-	{0x372c, 43},
-	{0x372d, 44},
-	{0x372e, 45},
-	{0x372f, 46},
-	{0x3730, 47},
-	{0x3731, 48},
-	{0x3732, 49},
-	{0x3733, 50},
-	{0x3734, 51},
-	{0x3735, 52},
-	{0x3736, 53},
-	{0x3737, 54},
-	{0x3738, 55},
-	{0x3739, 56},
-	{0x373a, 57},
-	{0x373b, 58},
-	{0x373c, 59},
-	{0x373d, 60},
-	{0x373e, 61},
-	{0x373f, 62},
-	{0x3740, 63},
-	{0x3741, 64},
-	{0x3742, 65},
-	{0x3743, 66},
-	{0x3744, 67},
-	{0x3745, 68},
-	{0x3746, 69},
-	{0x3747, 70},
-	{0x3748, 71},
-	{0x3749, 72},
-	{0x374a, 73},
-	{0x374b, 74},
-	{0x374c, 75},
-	{0x374d, 76},
-	{0x374e, 77},
-	{0x374f, 78},
-	{0x3750, 79},
-	{0x3751, 80},
-	{0x3752, 81},
-	{0x3753, 82},
-	{0x3754, 83},
-	{0x3755, 84},
-	{0x3756, 85},
-	{0x3757, 86},
-	{0x3758, 87},
-	{0x3759, 88},
-	{0x375a, 89},
-	{0x375b, 90},
-	{0x375c, 91},
-	{0x375d, 92},
-	{0x375e, 93},
-	{0x375f, 94},
-	{0x3760, 95},
-	{0x3761, 96},
-	{0x3762, 97},
-	{0x3763, 98},
-	{0x3764, 99},
-	{0x3765, 100},
-	{0x3766, 101},
-	{0x3767, 102},
-	{0x3768, 103},
-	{0x3769, 104},
-	{0x376a, 105},
-	{0x376b, 106},
-	{0x376c, 107},
-	{0x376d, 108},
-	{0x376e, 109},
-	{0x376f, 110},
-	{0x3770, 111},
-	{0x3771, 112},
-	{0x3772, 113},
-	{0x3773, 114},
-	{0x3774, 115},
-	{0x3775, 116},
-	{0x3776, 117},
-	{0x3777, 118},
-	{0x3778, 119},
-	{0x3779, 120},
-	{0x377a, 121},
-	{0x377b, 122},
-	{0x377c, 123},
-	{0x377d, 124},
-	{0x377e, 125},
-	{0x377f, 126},
-	{0x3780, 127},
-	{0x3781, 128},
-	{0x3782, 129},
-	{0x3783, 130},
-	{0x3784, 131},
-	{0x3785, 132},
-	{0x3786, 133},
-	{0x3787, 134},
-	{0x3788, 135},
-	{0x3789, 136},
-	{0x378a, 137},
-	{0x378b, 138},
-	{0x378c, 139},
-	{0x378d, 140},
-	{0x378e, 141},
-	{0x378f, 142},
-	{0x3790, 143},
-	{0x3791, 144},
-	{0x3792, 145},
-	{0x3793, 146},
-	{0x3794, 147},
-	{0x3795, 148},
-	{0x3796, 149},
-	{0x3797, 150},
-	{0x3798, 151},
-	{0x3799, 152},
-	{0x379a, 153},
-	{0x379b, 154},
-	{0x379c, 155},
-	{0x379d, 156},
-	{0x379e, 157},
-	{0x379f, 158},
-	{0x37a0, 159},
-	{0x37a1, 160},
-	{0x37a2, 161},
-	{0x37a3, 162},
-	{0x37a4, 163},
-	{0x37a5, 164},
-	{0x37a6, 165},
-	{0x37a7, 166},
-	{0x37a8, 167},
-	{0x37a9, 168},
-	{0x37aa, 169},
-	{0x37ab, 170},
-	{0x37ac, 171},
-	{0x37ad, 172},
-	{0x37ae, 173},
-	{0x37af, 174},
-	{0x37b0, 175},
-	{0x37b1, 176},
-	{0x37b2, 177},
-	{0x37b3, 178},
-	{0x37b4, 179},
-	{0x37b5, 180},
-	{0x37b6, 181},
-	{0x37b7, 182},
-	{0x37b8, 183},
-	{0x37b9, 184},
-	{0x37ba, 185},
-	{0x37bb, 186},
-	{0x37bc, 187},
-	{0x37bd, 188},
-	{0x37be, 189},
-	{0x37bf, 190},
-	{0x37c0, 191},
-	{0x37c1, 192},
-	{0x37c2, 193},
-	{0x37c3, 194},
-	{0x37c4, 195},
-	{0x37c5, 196},
-	{0x37c6, 197},
-	{0x37c7, 198},
-	{0x37c8, 199},
-	{0x37c9, 200},
-	{0x37ca, 201},
-	{0x37cb, 202},
-	{0x37cc, 203},
-	{0x37cd, 204},
-	{0x37ce, 205},
-	{0x37cf, 206},
-	{0x37d0, 207},
-	{0x37d1, 208},
-	{0x37d2, 209},
-	{0x37d3, 210},
-	{0x37d4, 211},
-	{0x37d5, 212},
-	{0x37d6, 213},
-	{0x37d7, 214},
-	{0x37d8, 215},
-	{0x37d9, 216},
-	{0x37da, 217},
-	{0x37db, 218},
-	{0x37dc, 219},
-	{0x37dd, 220},
-	{0x37de, 221},
-	{0x37df, 222},
-	{0x37e0, 223},
-	{0x37e1, 224},
-	{0x37e2, 225},
-	{0x37e3, 226},
-	{0x37e4, 227},
-	{0x37e5, 228},
-	{0x37e6, 229},
-	{0x37e7, 230},
-	{0x37e8, 231},
-	{0x37e9, 232},
-	{0x37ea, 233},
-	{0x37eb, 234},
-	{0x37ec, 235},
-	{0x37ed, 236},
-	{0x37ee, 237},
-	{0x37ef, 238},
-	{0x37f0, 239},
-	{0x37f1, 240},
-	{0x37f2, 241},
-	{0x37f3, 242},
-	{0x37f4, 243},
-	{0x37f5, 244},
-	{0x37f6, 245},
-	{0x37f7, 246},
-	{0x37f8, 247},
-	{0x37f9, 248},
-	{0x37fa, 249},
-	{0x37fb, 250},
-	{0x37fc, 251},
-	{0x37fd, 252},
-	{0x37fe, 253},
-	{0x37ff, 254},
-	{0x3801, 0},
-	{0x3802, 1},
-	{0x3803, 2},
-	{0x3804, 3},
-	{0x3805, 4},
-	{0x3806, 5},
-	{0x3807, 6},
-	{0x3808, 7},
-	{0x3809, 8},
-	{0x380a, 9},
-	{0x380b, 10},
-	{0x380c, 11},
-	{0x380d, 12},
-	{0x380e, 13},
-	{0x380f, 14},
-	{0x3810, 15},
-	{0x3811, 16},
-	{0x3812, 17},
-	{0x3813, 18},
-	{0x3814, 19},
-	{0x3815, 20},
-	{0x3816, 21},
-	{0x3817, 22},
-	{0x3818, 23},
-	{0x3819, 24},
-	{0x381a, 25},
-	{0x381b, 26},
-	{0x381c, 27},
-	{0x381d, 28},
-	{0x381e, 29},
-	{0x381f, 30},
-	{0x3820, 31},
-	{0x3821, 32},
-	{0x3822, 33},
-	{0x3823, 34},
-	{0x3824, 35},
-	{0x3825, 36},
-	{0x3826, 37},
-	{0x3827, 38},
-	{0x3828, 39},
-	{0x3829, 40},
-	{0x382a, 41},
-	{0x382b, 42},
-	{0x382c, 43},
-	{0x382d, 44},
-	{0x382e, 45},
-	{0x382f, 46},
-	{0x3830, 47},
-	{0x3831, 48},
-	{0x3832, 49},
-	{0x3833, 50},
-	{0x3834, 51},
-	{0x3835, 52},
-	{0x3836, 53},
-	{0x3837, 54},
-	{0x3838, 55},
-	{0x3839, 56},
-	{0x383a, 57},
-	{0x383b, 58},
-	{0x383c, 59},
-	{0x383d, 60},
-	{0x383e, 61},
-	{0x383f, 62},
-	{0x3840, 63},
-	{0x3841, 64},
-	{0x3842, 65},
-	{0x3843, 66},
-	{0x3844, 67},
-	{0x3845, 68},
-	{0x3846, 69},
-	{0x3847, 70},
-	{0x3848, 71},
-	{0x3849, 72},
-	{0x384a, 73},
-	{0x384b, 74},
-	{0x384c, 75},
-	{0x384d, 76},
-	{0x384e, 77},
-	{0x384f, 78},
-	{0x3850, 79},
-	{0x3851, 80},
-	{0x3852, 81},
-	{0x3853, 82},
-	{0x3854, 83},
-	{0x3855, 84},
-	{0x3856, 85},
-	{0x3857, 86},
-	{0x3858, 87},
-	{0x3859, 88},
-	{0x385a, 89},
-	{0x385b, 90},
-	{0x385c, 91},
-	{0x385d, 92},
-	{0x385e, 93},
-	{0x385f, 94},
-	{0x3860, 95},
-	{0x3861, 96},
-	{0x3862, 97},
-	{0x3863, 98},
-	{0x3864, 99},
-	{0x3865, 100},
-	{0x3866, 101},
-	{0x3867, 102},
-	{0x3868, 103},
-	{0x3869, 104},
-	{0x386a, 105},
-	{0x386b, 106},
-	{0x386c, 107},
-	{0x386d, 108},
-	{0x386e, 109},
-	{0x386f, 110},
-	{0x3870, 111},
-	{0x3871, 112},
-	{0x3872, 113},
-	{0x3873, 114},
-	{0x3874, 115},
-	{0x3875, 116},
-	{0x3876, 117},
-	{0x3877, 118},
-	{0x3878, 119},
-	{0x3879, 120},
-	{0x387a, 121},
-	{0x387b, 122},
-	{0x387c, 123},
-	{0x387d, 124},
-	{0x387e, 125},
-	{0x387f, 126},
-	{0x3880, 127},
-	{0x3881, 128},
-	{0x3882, 129},
-	{0x3883, 130},
-	{0x3884, 131},
-	{0x3885, 132},
-	{0x3886, 133},
-	{0x3887, 134},
-	{0x3888, 135},
-	{0x3889, 136},
-	{0x388a, 137},
-	{0x388b, 138},
-	{0x388c, 139},
-	{0x388d, 140},
-	{0x388e, 141},
-	{0x388f, 142},
-	{0x3890, 143},
-	{0x3891, 144},
-	{0x3892, 145},
-	{0x3893, 146},
-	{0x3894, 147},
-	{0x3895, 148},
-	{0x3896, 149},
-	{0x3897, 150},
-	{0x3898, 151},
-	{0x3899, 152},
-	{0x389a, 153},
-	{0x389b, 154},
-	{0x389c, 155},
-	{0x389d, 156},
-	{0x389e, 157},
-	{0x389f, 158},
-	{0x38a0, 159},
-	{0x38a1, 160},
-	{0x38a2, 161},
-	{0x38a3, 162},
-	{0x38a4, 163},
-	{0x38a5, 164},
-	{0x38a6, 165},
-	{0x38a7, 166},
-	{0x38a8, 167},
-	{0x38a9, 168},
-	{0x38aa, 169},
-	{0x38ab, 170},
-	{0x38ac, 171},
-	{0x38ad, 172},
-	{0x38ae, 173},
-	{0x38af, 174},
-	{0x38b0, 175},
-	{0x38b1, 176},
-	{0x38b2, 177},
-	{0x38b3, 178},
-	{0x38b4, 179},
-	{0x38b5, 180},
-	{0x38b6, 181},
-	{0x38b7, 182},
-	{0x38b8, 183},
-	{0x38b9, 184},
-	{0x38ba, 185},
-	{0x38bb, 186},
-	{0x38bc, 187},
-	{0x38bd, 188},
-	{0x38be, 189},
-	{0x38bf, 190},
-	{0x38c0, 191},
-	{0x38c1, 192},
-	{0x38c2, 193},
-	{0x38c3, 194},
-	{0x38c4, 195},
-	{0x38c5, 196},
-	{0x38c6, 197},
-	{0x38c7, 198},
-	{0x38c8, 199},
-	{0x38c9, 200},
-	{0x38ca, 201},
-	{0x38cb, 202},
-	{0x38cc, 203},
-	{0x38cd, 204},
-	{0x38ce, 205},
-	{0x38cf, 206},
-	{0x38d0, 207},
-	{0x38d1, 208},
-	{0x38d2, 209},
-	{0x38d3, 210},
-	{0x38d4, 211},
-	{0x38d5, 212},
-	{0x38d6, 213},
-	{0x38d7, 214},
-	{0x38d8, 215},
-	{0x38d9, 216},
-	{0x38da, 217},
-	{0x38db, 218},
-	{0x38dc, 219},
-	{0x38dd, 220},
-	{0x38de, 221},
-	{0x38df, 222},
-	{0x38e0, 223},
-	{0x38e1, 224},
-	{0x38e2, 225},
-	{0x38e3, 226},
-	{0x38e4, 227},
-	{0x38e5, 228},
-	{0x38e6, 229},
-	{0x38e7, 230},
-	{0x38e8, 231},
-	{0x38e9, 232},
-	{0x38ea, 233},
-	{0x38eb, 234},
-	{0x38ec, 235},
-	{0x38ed, 236},
-	{0x38ee, 237},
-	{0x38ef, 238},
-	{0x38f0, 239},
-	{0x38f1, 240},
-	{0x38f2, 241},
-	{0x38f3, 242},
-	{0x38f4, 243},
-	{0x38f5, 244},
-	{0x38f6, 245},
-	{0x38f7, 246},
-	{0x38f8, 247},
-	{0x38f9, 248},
-	{0x38fa, 249},
-	{0x38fb, 250},
-	{0x38fc, 251},
-	{0x38fd, 252},
-	{0x38fe, 253},
-	{0x38ff, 254},
-	{0x3901, 0},
-	{0x3902, 1},
-	{0x3903, 2},
-	{0x3904, 3},
-	{0x3905, 4},
-	{0x3906, 5},
-	{0x3907, 6},
-	{0x3908, 7},
-	{0x3909, 8},
-	{0x390a, 9},
-	{0x390b, 10},
-	{0x390c, 11},
-	{0x390d, 12},
-	{0x390e, 13},
-	{0x390f, 14},
-	{0x3910, 15},
-	{0x3911, 16},
-	{0x3912, 17},
-	{0x3913, 18},
-	{0x3914, 19},
-	{0x3915, 20},
-	{0x3916, 21},
-	{0x3917, 22},
-	{0x391a, 0},
-	{0x391b, 1},
-	{0x391c, 2},
-	{0x391d, 3},
-	{0x391e, 4},
-	{0x391f, 5},
-	{0x3920, 6},
-	{0x3921, 7},
-	{0x3922, 8},
-	{0x3923, 9},
-	{0x3924, 10},
-	{0x3925, 11},
-	{0x3926, 12},
-	{0x3927, 13},
-	{0x3928, 14},
-	{0x3929, 15},
-	{0x392a, 16},
-	{0x392b, 17},
-	{0x392c, 18},
-	{0x392d, 19},
-	{0x392e, 20},
-	{0x392f, 21},
-	{0x3930, 22},
-	{0x3931, 23},
-	{0x3932, 24},
-	{0x3933, 25},
-	{0x3934, 26},
-	{0x3935, 27},
-	{0x3936, 28},
-	{0x3937, 29},
-	{0x3938, 30},
-	{0x3939, 31},
-	{0x393a, 32},
-	{0x393b, 33},
-	{0x393c, 34},
-	{0x393d, 35},
-	{0x393e, 36},
-	{0x393f, 37},
-	{0x3940, 38},
-	{0x3941, 39},
-	{0x3942, 40},
-	{0x3943, 41},
-	{0x3944, 42},
-	{0x3945, 43},
-	{0x3946, 44},
-	{0x3947, 45},
-	{0x3948, 46},
-	{0x3949, 47},
-	{0x394a, 48},
-	{0x394b, 49},
-	{0x394c, 50},
-	{0x394d, 51},
-	{0x394e, 52},
-	{0x394f, 53},
-	{0x3950, 54},
-	{0x3951, 55},
-	{0x3952, 56},
-	{0x3953, 57},
-	{0x3954, 58},
-	{0x3955, 59},
-	{0x3956, 60},
-	{0x3957, 61},
-	{0x3958, 62},
-	{0x3959, 63},
-	{0x395a, 64},
-	{0x395b, 65},
-	{0x395c, 66},
-	{0x395d, 67},
-	{0x395e, 68},
-	{0x395f, 69},
-	{0x3960, 70},
-	{0x3961, 71},
-	{0x3962, 72},
-	{0x3963, 73},
-	{0x3964, 74},
-	{0x3965, 75},
-	{0x3966, 76},
-	{0x3967, 77},
-	{0x3968, 78},
-	{0x3969, 79},
-	{0x396a, 80},
-	{0x396b, 81},
-	{0x396c, 82},
-	{0x396d, 83},
-	{0x3970, 0},
-	{0x3971, 1},
-	{0x3972, 2},
-	{0x3973, 3},
-	{0x3974, 4},
-	{0x3975, 5},
-	{0x3976, 6},
-	{0x3977, 7},
-	{0x3978, 8},
-	{0x3979, 9},
-	{0x397a, 10},
-	{0x397b, 11},
-	{0x397c, 12},
-	{0x397d, 13},
-	{0x397e, 14},
-	{0x397f, 15},
-	{0x3980, 16},
-	{0x3981, 17},
-	{0x3982, 18},
-	{0x3983, 19},
-	{0x3984, 20},
-	{0x3985, 21},
-	{0x3986, 22},
-	{0x3987, 23},
-	{0x3988, 24},
-	{0x3989, 25},
-	{0x398a, 26},
-	{0x398b, 27},
-	{0x398c, 28},
-	{0x398d, 29},
-	{0x398e, 30},
-	{0x398f, 31},
-	{0x3990, 32},
-	{0x3991, 33},
-	{0x3992, 34},
-	{0x3993, 35},
-	{0x3994, 36},
-	{0x3995, 37},
-	{0x3996, 38},
-	{0x3997, 39},
-	{0x3998, 40},
-	{0x3999, 41},
-	{0x399a, 42},
-	{0x399b, 43},
-	{0x399c, 44},
-	{0x399d, 45},
-	{0x399e, 46},
-	{0x399f, 47},
-	{0x39a0, 48},
-	{0x39a1, 49},
-	{0x39a2, 50},
-	{0x39a3, 51},
-	{0x39a4, 52},
-	{0x39a5, 53},
-	{0x39a6, 54},
-	{0x39a7, 55},
-	{0x39a8, 56},
-	{0x39a9, 57},
-	{0x39aa, 58},
-	{0x39ab, 59},
-	{0x39ac, 60},
-	{0x39ad, 61},
-	{0x39ae, 62},
-	{0x39af, 63},
-	{0x39b0, 64},
-	{0x39b1, 65},
-	{0x39b2, 66},
-	{0x39b3, 67},
-	{0x39b4, 68},
-	{0x39b5, 69},
-	{0x39b6, 70},
-	{0x39b7, 71},
-	{0x39b8, 72},
-	{0x39b9, 73},
-	{0x39ba, 74},
-	{0x39bb, 75},
-	{0x39bc, 76},
-	{0x39bd, 77},
-	{0x39be, 78},
-	{0x39bf, 79},
-	{0x39c0, 80},
-	{0x39c1, 81},
-	{0x39c2, 82},
-	{0x39c3, 83},
-	{0x39c4, 84},
-	{0x39c5, 85},
-	{0x39c6, 86},
-	{0x39c7, 87},
-	{0x39c8, 88},
-	{0x39c9, 89},
-	{0x39ca, 90},
-	{0x39cb, 91},
-	{0x39cc, 92},
-	{0x39cd, 93},
-	{0x39ce, 94},
-	{0x39d2, 0},
-	{0x39d3, 1},
-	{0x39d4, 2},
-	{0x39d5, 3},
-	{0x39d6, 4},
-	{0x39d7, 5},
-	{0x39d8, 6},
-	{0x39d9, 7},
-	{0x39da, 8},
-	{0x39db, 9},
-	{0x39dc, 10},
-	{0x39dd, 11},
-	{0x39de, 12},
-	{0x39e1, 0},
-	{0x39e2, 1},
-	{0x39e3, 2},
-	{0x39e4, 3},
-	{0x39e5, 4},
-	{0x39e6, 5},
-	{0x39e7, 6},
-	{0x39e8, 7},
-	{0x39e9, 8},
-	{0x39ea, 9},
-	{0x39eb, 10},
-	{0x39ec, 11},
-	{0x39ed, 12},
-	{0x39ee, 13},
-	{0x39ef, 14},
-	{0x39f0, 15},
-	{0x39f1, 16},
-	{0x39f2, 17},
-	{0x39f3, 18},
-	{0x39f4, 19},
-	{0x39f5, 20},
-	{0x39f6, 21},
-	{0x39f7, 22},
-	{0x39f8, 23},
-	{0x39f9, 24},
-	{0x39fa, 25},
-	{0x39fb, 26},
-	{0x39fc, 27},
-	{0x39fd, 28},
-	{0x39fe, 29},
-	{0x39ff, 30},
-	{0x3a01, 0},
-	{0x3a02, 1},
-	{0x3a03, 2},
-	{0x3a04, 3},
-	{0x3a05, 4},
-	{0x3a06, 5},
-	{0x3a07, 6},
-	{0x3a08, 7},
-	{0x3a09, 8},
-	{0x3a0a, 9},
-	{0x3a0b, 10},
-	{0x3a0c, 11},
-	{0x3a0d, 12},
-	{0x3a0e, 13},
-	{0x3a0f, 14},
-	{0x3a10, 15},
-	{0x3a11, 16},
-	{0x3a12, 17},
-	{0x3a13, 18},
-	{0x3a14, 19},
-	{0x3a15, 20},
-	{0x3a16, 21},
-	{0x3a17, 22},
-	{0x3a18, 23},
-	{0x3a19, 24},
-	{0x3a1a, 25},
-	{0x3a1b, 26},
-	{0x3a1c, 27},
-	{0x3a1d, 28},
-	{0x3a1e, 29},
-	{0x3a1f, 30},
-	{0x3a20, 31},
-	{0x3a21, 32},
-	{0x3a22, 33},
-	{0x3a23, 34},
-	{0x3a24, 35},
-	{0x3a25, 36},
-	{0x3a26, 37},
-	{0x3a27, 38},
-	{0x3a28, 39},
-	{0x3a29, 40},
-	{0x3a2a, 41},
-	{0x3a2b, 42},
-	{0x3a2c, 43},
-	{0x3a2d, 44},
-	{0x3a2e, 45},
-	{0x3a2f, 46},
-	{0x3a30, 47},
-	{0x3a31, 48},
-	{0x3a32, 49},
-	{0x3a33, 50},
-	{0x3a34, 51},
-	{0x3a35, 52},
-	{0x3a36, 53},
-	{0x3a37, 54},
-	{0x3a38, 55},
-	{0x3a39, 56},
-	{0x3a3a, 57},
-	{0x3a3b, 58},
-	{0x3a3c, 59},
-	{0x3a3d, 60},
-	{0x3a3e, 61},
-	{0x3a3f, 62},
-	{0x3a40, 63},
-	{0x3a41, 64},
-	{0x3a42, 65},
-	{0x3a43, 66},
-	{0x3a44, 67},
-	{0x3a45, 68},
-	{0x3a46, 69},
-	{0x3a47, 70},
-	{0x3a48, 71},
-	{0x3a49, 72},
-	{0x3a4a, 73},
-	{0x3a4b, 74},
-	{0x3a4c, 75},
-	{0x3a4d, 76},
-	{0x3a4e, 77},
-	{0x3a4f, 78},
-	{0x3a50, 79},
-	{0x3a51, 80},
-	{0x3a52, 81},
-	{0x3a53, 82},
-	{0x3a54, 83},
-	{0x3a55, 84},
-	{0x3a56, 85},
-	{0x3a57, 86},
-	{0x3a58, 87},
-	{0x3a59, 88},
-	{0x3a5a, 89},
-	{0x3a5b, 90},
-	{0x3a5c, 91},
-	{0x3a5d, 92},
-	{0x3a5e, 93},
-	{0x3a5f, 94},
-	{0x3a60, 95},
-	{0x3a61, 96},
-	{0x3a62, 97},
-	{0x3a63, 98},
-	{0x3a64, 99},
-	{0x3a65, 100},
-	{0x3a66, 101},
-	{0x3a67, 102},
-	{0x3a68, 103},
-	{0x3a69, 104},
-	{0x3a6a, 105},
-	{0x3a6b, 106},
-	{0x3a6c, 107},
-	{0x3a6d, 108},
-	{0x3a6e, 109},
-	{0x3a6f, 110},
-	{0x3a70, 111},
-	{0x3a71, 112},
-	{0x3a72, 113},
-	{0x3a75, 0},
-	{0x3a76, 1},
-	{0x3a77, 2},
-	{0x3a78, 3},
-	{0x3a79, 4},
-	{0x3a7a, 5},
-	{0x3a7b, 6},
-	{0x3a7c, 7},
-	{0x3a7d, 8},
-	{0x3a7e, 9},
-	{0x3a7f, 10},
-	{0x3a80, 11},
-	{0x3a81, 12},
-	{0x3a82, 13},
-	{0x3a83, 14},
-	{0x3a84, 15},
-	{0x3a85, 16},
-	{0x3a86, 17},
-	{0x3a87, 18},
-	{0x3a88, 19},
-	{0x3a89, 20},
-	{0x3a8a, 21},
-	{0x3a8b, 22},
-	{0x3a8c, 23},
-	{0x3a8d, 24},
-	{0x3a8e, 25},
-	{0x3a8f, 26},
-	{0x3a90, 27},
-	{0x3a91, 28},
-	{0x3a92, 29},
-	{0x3a93, 30},
-	{0x3a94, 31},
-	{0x3a95, 32},
-	{0x3a96, 33},
-	{0x3a97, 34},
-	{0x3a98, 35},
-	{0x3a99, 36},
-	{0x3a9a, 37},
-	{0x3a9b, 38},
-	{0x3a9c, 39},
-	{0x3a9d, 40},
-	{0x3a9e, 41},
-	{0x3a9f, 42},
-	{0x3aa0, 43},
-	{0x3aa1, 44},
-	{0x3aa2, 45},
-	{0x3aa3, 46},
-	{0x3aa4, 47},
-	{0x3aa5, 48},
-	{0x3aa6, 49},
-	{0x3aa7, 50},
-	{0x3aa8, 51},
-	{0x3aa9, 52},
-	{0x3aaa, 53},
-	{0x3aab, 54},
-	{0x3aac, 55},
-	{0x3aad, 56},
-	{0x3aae, 57},
-	{0x3aaf, 58},
-	{0x3ab0, 59},
-	{0x3ab1, 60},
-	{0x3ab2, 61},
-	{0x3ab3, 62},
-	{0x3ab4, 63},
-	{0x3ab5, 64},
-	{0x3ab6, 65},
-	{0x3ab7, 66},
-	{0x3ab8, 67},
-	{0x3ab9, 68},
-	{0x3aba, 69},
-	{0x3abb, 70},
-	{0x3abc, 71},
-	{0x3abd, 72},
-	{0x3abe, 73},
-	{0x3abf, 74},
-	{0x3ac0, 75},
-	{0x3ac1, 76},
-	{0x3ac2, 77},
-	{0x3ac3, 78},
-	{0x3ac4, 79},
-	{0x3ac5, 80},
-	{0x3ac6, 81},
-	{0x3ac7, 82},
-	{0x3ac8, 83},
-	{0x3ac9, 84},
-	{0x3aca, 85},
-	{0x3acb, 86},
-	{0x3acc, 87},
-	{0x3acd, 88},
-	{0x3ace, 89},
-	{0x3acf, 90},
-	{0x3ad0, 91},
-	{0x3ad1, 92},
-	{0x3ad2, 93},
-	{0x3ad3, 94},
-	{0x3ad4, 95},
-	{0x3ad5, 96},
-	{0x3ad6, 97},
-	{0x3ad7, 98},
-	{0x3ad8, 99},
-	{0x3ad9, 100},
-	{0x3ada, 101},
-	{0x3adb, 102},
-	{0x3adc, 103},
-	{0x3add, 104},
-	{0x3ade, 105},
-	{0x3adf, 106},
-	{0x3ae0, 107},
-	{0x3ae1, 108},
-	{0x3ae2, 109},
-	{0x3ae3, 110},
-	{0x3ae4, 111},
-	{0x3ae5, 112},
-	{0x3ae6, 113},
-	{0x3ae7, 114},
-	{0x3ae8, 115},
-	{0x3ae9, 116},
-	{0x3aea, 117},
-	{0x3aeb, 118},
-	{0x3aec, 119},
-	{0x3aed, 120},
-	{0x3aee, 121},
-	{0x3aef, 122},
-	{0x3af0, 123},
-	{0x3af1, 124},
-	{0x3af2, 125},
-	{0x3af3, 126},
-	{0x3af4, 127},
-	{0x3af5, 128},
-	{0x3af6, 129},
-	{0x3af7, 130},
-	{0x3af8, 131},
-	{0x3af9, 132},
-	{0x3afa, 133},
-	{0x3afb, 134},
-	{0x3afc, 135},
-	{0x3afd, 136},
-	{0x3afe, 137},
-	{0x3aff, 138},
-	{0x3b01, 0},
-	{0x3b02, 1},
-	{0x3b03, 2},
-	{0x3b04, 3},
-	{0x3b05, 4},
-	{0x3b06, 5},
-	{0x3b07, 6},
-	{0x3b08, 7},
-	{0x3b09, 8},
-	{0x3b0a, 9},
-	{0x3b0b, 10},
-	{0x3b0c, 11},
-	{0x3b0d, 12},
-	{0x3b0e, 13},
-	{0x3b0f, 14},
-	{0x3b10, 15},
-	{0x3b11, 16},
-	{0x3b12, 17},
-	{0x3b13, 18},
-	{0x3b14, 19},
-	{0x3b15, 20},
-	{0x3b16, 21},
-	{0x3b17, 22},
-	{0x3b18, 23},
-	{0x3b19, 24},
-	{0x3b1a, 25},
-	{0x3b1b, 26},
-	{0x3b1c, 27},
-	{0x3b1d, 28},
-	{0x3b1e, 29},
-	{0x3b1f, 30},
-	{0x3b20, 31},
-	{0x3b21, 32},
-	{0x3b22, 33},
-	{0x3b23, 34},
-	{0x3b24, 35},
-	{0x3b25, 36},
-	{0x3b26, 37},
-	{0x3b27, 38},
-	{0x3b28, 39},
-	{0x3b29, 40},
-	{0x3b2a, 41},
-	{0x3b2b, 42},
-	{0x3b2c, 43},
-	{0x3b2d, 44},
-	{0x3b2e, 45},
-	{0x3b2f, 46},
-	{0x3b30, 47},
-	{0x3b31, 48},
-	{0x3b32, 49},
-	{0x3b33, 50},
-	{0x3b34, 51},
-	{0x3b35, 52},
-	{0x3b36, 53},
-	{0x3b37, 54},
-	{0x3b38, 55},
-	{0x3b39, 56},
-	{0x3b3a, 57},
-	{0x3b3b, 58},
-	{0x3b3c, 59},
-	{0x3b3d, 60},
-	{0x3b3e, 61},
-	{0x3b3f, 62},
-	{0x3b40, 63},
-	{0x3b41, 64},
-	{0x3b42, 65},
-	{0x3b43, 66},
-	{0x3b44, 67},
-	{0x3b45, 68},
-	{0x3b46, 69},
-	{0x3b47, 70},
-	{0x3b48, 71},
-	{0x3b49, 72},
-	{0x3b4a, 73},
-	{0x3b4b, 74},
-	{0x3b4c, 75},
-	{0x3b4d, 76},
-	{0x3b50, 0},
-	{0x3b51, 1},
-	{0x3b52, 2},
-	{0x3b53, 3},
-	{0x3b54, 4},
-	{0x3b55, 5},
-	{0x3b56, 6},
-	{0x3b57, 7},
-	{0x3b58, 8},
-	{0x3b59, 9},
-	{0x3b5a, 10},
-	{0x3b5b, 11},
-	{0x3b5c, 12},
-	{0x3b5d, 13},
-	{0x3b5e, 14},
-	{0x3b5f, 15},
-	{0x3b60, 16},
-	{0x3b61, 17},
-	{0x3b62, 18},
-	{0x3b63, 19},
-	{0x3b64, 20},
-	{0x3b65, 21},
-	{0x3b66, 22},
-	{0x3b67, 23},
-	{0x3b68, 24},
-	{0x3b69, 25},
-	{0x3b6a, 26},
-	{0x3b6b, 27},
-	{0x3b6c, 28},
-	{0x3b6d, 29},
-	{0x3b6e, 30},
-	{0x3b6f, 31},
-	{0x3b70, 32},
-	{0x3b71, 33},
-	{0x3b72, 34},
-	{0x3b73, 35},
-	{0x3b74, 36},
-	{0x3b75, 37},
-	{0x3b76, 38},
-	{0x3b77, 39},
-	{0x3b78, 40},
-	{0x3b79, 41},
-	{0x3b7a, 42},
-	{0x3b7b, 43},
-	{0x3b7c, 44},
-	{0x3b7d, 45},
-	{0x3b7e, 46},
-	{0x3b7f, 47},
-	{0x3b80, 48},
-	{0x3b81, 49},
-	{0x3b82, 50},
-	{0x3b83, 51},
-	{0x3b84, 52},
-	{0x3b85, 53},
-	{0x3b86, 54},
-	{0x3b87, 55},
-	{0x3b88, 56},
-	{0x3b89, 57},
-	{0x3b8a, 58},
-	{0x3b8b, 59},
-	{0x3b8c, 60},
-	{0x3b8d, 61},
-	{0x3b8e, 62},
-	{0x3b8f, 63},
-	{0x3b90, 64},
-	{0x3b91, 65},
-	{0x3b92, 66},
-	{0x3b93, 67},
-	{0x3b94, 68},
-	{0x3b95, 69},
-	{0x3b96, 70},
-	{0x3b97, 71},
-	{0x3b98, 72},
-	{0x3b99, 73},
-	{0x3b9a, 74},
-	{0x3b9b, 75},
-	{0x3b9c, 76},
-	{0x3b9d, 77},
-	{0x3b9e, 78},
-	{0x3b9f, 79},
-	{0x3ba0, 80},
-	{0x3ba1, 81},
-	{0x3ba2, 82},
-	{0x3ba3, 83},
-	{0x3ba4, 84},
-	{0x3ba5, 85},
-	{0x3ba6, 86},
-	{0x3ba7, 87},
-	{0x3ba8, 88},
-	{0x3ba9, 89},
-	{0x3baa, 90},
-	{0x3bab, 91},
-	{0x3bac, 92},
-	{0x3bad, 93},
-	{0x3bae, 94},
-	{0x3baf, 95},
-	{0x3bb0, 96},
-	{0x3bb1, 97},
-	{0x3bb2, 98},
-	{0x3bb3, 99},
-	{0x3bb4, 100},
-	{0x3bb5, 101},
-	{0x3bb6, 102},
-	{0x3bb7, 103},
-	{0x3bb8, 104},
-	{0x3bb9, 105},
-	{0x3bba, 106},
-	{0x3bbb, 107},
-	{0x3bbc, 108},
-	{0x3bbd, 109},
-	{0x3bbe, 110},
-	{0x3bbf, 111},
-	{0x3bc0, 112},
-	{0x3bc1, 113},
-	{0x3bc2, 114},
-	{0x3bc3, 115},
-	{0x3bc4, 116},
-	{0x3bc5, 117},
-	{0x3bc6, 118},
-	{0x3bc7, 119},
-	{0x3bc8, 120},
-	{0x3bc9, 121},
-	{0x3bca, 122},
-	{0x3bcb, 123},
-	{0x3bcc, 124},
-	{0x3bcd, 125},
-	{0x3bce, 126},
-	{0x3bcf, 127},
-	{0x3bd0, 128},
-	{0x3bd1, 129},
-	{0x3bd2, 130},
-	{0x3bd3, 131},
-	{0x3bd4, 132},
-	{0x3bd5, 133},
-	{0x3bd6, 134},
-	{0x3bd7, 135},
-	{0x3bd8, 136},
-	{0x3bd9, 137},
-	{0x3bda, 138},
-	{0x3bdb, 139},
-	{0x3bdc, 140},
-	{0x3bdd, 141},
-	{0x3bde, 142},
-	{0x3bdf, 143},
-	{0x3be0, 144},
-	{0x3be1, 145},
-	{0x3be2, 146},
-	{0x3be3, 147},
-	{0x3be4, 148},
-	{0x3be5, 149},
-	{0x3be6, 150},
-	{0x3be7, 151},
-	{0x3be8, 152},
-	{0x3be9, 153},
-	{0x3bea, 154},
-	{0x3beb, 155},
-	{0x3bec, 156},
-	{0x3bed, 157},
-	{0x3bee, 158},
-	{0x3bef, 159},
-	{0x3bf0, 160},
-	{0x3bf1, 161},
-	{0x3bf2, 162},
-	{0x3bf3, 163},
-	{0x3bf4, 164},
-	{0x3bf5, 165},
-	{0x3bf6, 166},
-	{0x3bf7, 167},
-	{0x3bf8, 168},
-	{0x3bf9, 169},
-	{0x3bfa, 170},
-	{0x3bfb, 171},
-	{0x3bfc, 172},
-	{0x3bfd, 173},
-	{0x3bfe, 174},
-	{0x3bff, 175},
-	{0x3c01, 0},
-	{0x3c02, 1},
-	{0x3c03, 2},
-	{0x3c04, 3},
-	{0x3c05, 4},
-	{0x3c06, 5},
-	{0x3c07, 6},
-	{0x3c08, 7},
-	{0x3c09, 8},
-	{0x3c0a, 9},
-	{0x3c0b, 10},
-	{0x3c0c, 11},
-	{0x3c0d, 12},
-	{0x3c0e, 13},
-	{0x3c0f, 14},
-	{0x3c10, 15},
-	{0x3c11, 16},
-	{0x3c12, 17},
-	{0x3c13, 18},
-	{0x3c14, 19},
-	{0x3c15, 20},
-	{0x3c16, 21},
-	{0x3c17, 22},
-	{0x3c18, 23},
-	{0x3c19, 24},
-	{0x3c1a, 25},
-	{0x3c1b, 26},
-	{0x3c1c, 27},
-	{0x3c1d, 28},
-	{0x3c1e, 29},
-	{0x3c1f, 30},
-	{0x3c20, 31},
-	{0x3c21, 32},
-	{0x3c22, 33},
-	{0x3c23, 34},
-	{0x3c24, 35},
-	{0x3c25, 36},
-	{0x3c26, 37},
-	{0x3c27, 38},
-	{0x3c28, 39},
-	{0x3c29, 40},
-	{0x3c2a, 41},
-	{0x3c2b, 42},
-	{0x3c2c, 43},
-	{0x3c2d, 44},
-	{0x3c2e, 45},
-	{0x3c2f, 46},
-	{0x3c30, 47},
-	{0x3c31, 48},
-	{0x3c32, 49},
-	{0x3c33, 50},
-	{0x3c34, 51},
-	{0x3c35, 52},
-	{0x3c36, 53},
-	{0x3c37, 54},
-	{0x3c38, 55},
-	{0x3c39, 56},
-	{0x3c3a, 57},
-	{0x3c3b, 58},
-	{0x3c3c, 59},
-	{0x3c3d, 60},
-	{0x3c3e, 61},
-	{0x3c3f, 62},
-	{0x3c40, 63},
-	{0x3c41, 64},
-	{0x3c42, 65},
-	{0x3c43, 66},
-	{0x3c44, 67},
-	{0x3c45, 68},
-	{0x3c46, 69},
-	{0x3c47, 70},
-	{0x3c48, 71},
-	{0x3c49, 72},
-	{0x3c4a, 73},
-	{0x3c4b, 74},
-	{0x3c4c, 75},
-	{0x3c4d, 76},
-	{0x3c4e, 77},
-	{0x3c4f, 78},
-	{0x3c50, 79},
-	{0x3c51, 80},
-	{0x3c52, 81},
-	{0x3c53, 82},
-	{0x3c54, 83},
-	{0x3c55, 84},
-	{0x3c56, 85},
-	{0x3c57, 86},
-	{0x3c58, 87},
-	{0x3c59, 88},
-	{0x3c5a, 89},
-	{0x3c5b, 90},
-	{0x3c5c, 91},
-	{0x3c5d, 92},
-	{0x3c5e, 93},
-	{0x3c5f, 94},
-	{0x3c60, 95},
-	{0x3c61, 96},
-	{0x3c62, 97},
-	{0x3c63, 98},
-	{0x3c64, 99},
-	{0x3c65, 100},
-	{0x3c66, 101},
-	{0x3c67, 102},
-	{0x3c68, 103},
-	{0x3c69, 104},
-	{0x3c6a, 105},
-	{0x3c6b, 106},
-	{0x3c6c, 107},
-	{0x3c6d, 108},
-	{0x3c70, 0},
-	{0x3c71, 1},
-	{0x3c72, 2},
-	{0x3c73, 3},
-	{0x3c74, 4},
-	{0x3c75, 5},
-	{0x3c76, 6},
-	{0x3c77, 7},
-	{0x3c78, 8},
-	{0x3c79, 9},
-	{0x3c7a, 10},
-	{0x3c7b, 11},
-	{0x3c7c, 12},
-	{0x3c7d, 13},
-	{0x3c7e, 14},
-	{0x3c7f, 15},
-	{0x3c80, 16},
-	{0x3c81, 17},
-	{0x3c82, 18},
-	{0x3c83, 19},
-	{0x3c84, 20},
-	{0x3c85, 21},
-	{0x3c86, 22},
-	{0x3c87, 23},
-	{0x3c88, 24},
-	{0x3c89, 25},
-	{0x3c8a, 26},
-	{0x3c8b, 27},
-	{0x3c8c, 28},
-	{0x3c8d, 29},
-	{0x3c8e, 30},
-	{0x3c8f, 31},
-	{0x3c90, 32},
-	{0x3c91, 33},
-	{0x3c92, 34},
-	{0x3c93, 35},
-	{0x3c94, 36},
-	{0x3c95, 37},
-	{0x3c96, 38},
-	{0x3c97, 39},
-	{0x3c98, 40},
-	{0x3c99, 41},
-	{0x3c9a, 42},
-	{0x3c9b, 43},
-	{0x3c9c, 44},
-	{0x3c9d, 45},
-	{0x3c9e, 46},
-	{0x3c9f, 47},
-	{0x3ca0, 48},
-	{0x3ca1, 49},
-	{0x3ca2, 50},
-	{0x3ca3, 51},
-	{0x3ca4, 52},
-	{0x3ca5, 53},
-	{0x3ca6, 54},
-	{0x3ca7, 55},
-	{0x3ca8, 56},
-	{0x3ca9, 57},
-	{0x3caa, 58},
-	{0x3cab, 59},
-	{0x3cac, 60},
-	{0x3cad, 61},
-	{0x3cae, 62},
-	{0x3caf, 63},
-	{0x3cb0, 64},
-	{0x3cb1, 65},
-	{0x3cb2, 66},
-	{0x3cb3, 67},
-	{0x3cb4, 68},
-	{0x3cb5, 69},
-	{0x3cb6, 70},
-	{0x3cb7, 71},
-	{0x3cb8, 72},
-	{0x3cb9, 73},
-	{0x3cba, 74},
-	{0x3cbb, 75},
-	{0x3cbc, 76},
-	{0x3cbd, 77},
-	{0x3cbe, 78},
-	{0x3cbf, 79},
-	{0x3cc0, 80},
-	{0x3cc1, 81},
-	{0x3cc2, 82},
-	{0x3cc3, 83},
-	{0x3cc4, 84},
-	{0x3cc5, 85},
-	{0x3cc6, 86},
-	{0x3cc7, 87},
-	{0x3cc8, 88},
-	{0x3cc9, 89},
-	{0x3cca, 90},
-	{0x3ccb, 91},
-	{0x3ccc, 92},
-	{0x3ccd, 93},
-	{0x3cce, 94},
-	{0x3ccf, 95},
-	{0x3cd0, 96},
-	{0x3cd1, 97},
-	{0x3cd2, 98},
-	{0x3cd3, 99},
-	{0x3cd4, 100},
-	{0x3cd5, 101},
-	{0x3cd6, 102},
-	{0x3cd7, 103},
-	{0x3cd8, 104},
-	{0x3cd9, 105},
-	{0x3cda, 106},
-	{0x3cdb, 107},
-	{0x3cdc, 108},
-	{0x3cdd, 109},
-	{0x3cde, 110},
-	{0x3cdf, 111},
-	{0x3ce2, 0},
-	{0x3ce3, 1},
-	{0x3ce4, 2},
-	{0x3ce5, 3},
-	{0x3ce6, 4},
-	{0x3ce7, 5},
-	{0x3ce8, 6},
-	{0x3ce9, 7},
-	{0x3cea, 8},
-	{0x3ceb, 9},
-	{0x3cec, 10},
-	{0x3ced, 11},
-	{0x3cee, 12},
-	{0x3cef, 13},
-	{0x3cf0, 14},
-	{0x3cf1, 15},
-	{0x3cf2, 16},
-	{0x3cf3, 17},
-	{0x3cf4, 18},
-	{0x3cf5, 19},
-	{0x3cf6, 20},
-	{0x3cf7, 21},
-	{0x3cf8, 22},
-	{0x3cf9, 23},
-	{0x3cfa, 24},
-	{0x3cfb, 25},
-	{0x3cfc, 26},
-	{0x3cfd, 27},
-	{0x3cfe, 28},
-	{0x3cff, 29},
-	{0x3d01, 0},
-	{0x3d02, 1},
-	{0x3d03, 2},
-	{0x3d04, 3},
-	{0x3d05, 4},
-	{0x3d06, 5},
-	{0x3d07, 6},
-	{0x3d08, 7},
-	{0x3d09, 8},
-	{0x3d0a, 9},
-	{0x3d0b, 10},
-	{0x3d0c, 11},
-	{0x3d0d, 12},
-	{0x3d0e, 13},
-	{0x3d0f, 14},
-	{0x3d10, 15},
-	{0x3d11, 16},
-	{0x3d12, 17},
-	{0x3d13, 18},
-	{0x3d14, 19},
-	{0x3d15, 20},
-	{0x3d16, 21},
-	{0x3d17, 22},
-	{0x3d18, 23},
-	{0x3d19, 24},
-	{0x3d1a, 25},
-	{0x3d1b, 26},
-	{0x3d1c, 27},
-	{0x3d1d, 28},
-	{0x3d1e, 29},
-	{0x3d1f, 30},
-	{0x3d20, 31},
-	{0x3d21, 32},
-	{0x3d22, 33},
-	{0x3d23, 34},
-	{0x3d24, 35},
-	{0x3d25, 36},
-	{0x3d26, 37},
-	{0x3d27, 38},
-	{0x3d28, 39},
-	{0x3d29, 40},
-	{0x3d2a, 41},
-	{0x3d2b, 42},
-	{0x3d2c, 43},
-	{0x3d2d, 44},
-	{0x3d2e, 45},
-	{0x3d2f, 46},
-	{0x3d30, 47},
-	{0x3d31, 48},
-	{0x3d32, 49},
-	{0x3d33, 50},
-	{0x3d34, 51},
-	{0x3d35, 52},
-	{0x3d36, 53},
-	{0x3d37, 54},
-	{0x3d38, 55},
-	{0x3d39, 56},
-	{0x3d3a, 57},
-	{0x3d3b, 58},
-	{0x3d3c, 59},
-	{0x3d3d, 60},
-	{0x3d3e, 61},
-	{0x3d3f, 62},
-	{0x3d40, 63},
-	{0x3d41, 64},
-	{0x3d42, 65},
-	{0x3d43, 66},
-	{0x3d44, 67},
-	{0x3d45, 68},
-	{0x3d46, 69},
-	{0x3d47, 70},
-	{0x3d48, 71},
-	{0x3d49, 72},
-	{0x3d4a, 73},
-	{0x3d4b, 74},
-	{0x3d4c, 75},
-	{0x3d4d, 76},
-	{0x3d4e, 77},
-	{0x3d4f, 78},
-	{0x3d50, 79},
-	{0x3d51, 80},
-	{0x3d52, 81},
-	{0x3d53, 82},
-	{0x3d54, 83},
-	{0x3d55, 84},
-	{0x3d56, 85},
-	{0x3d57, 86},
-	{0x3d58, 87},
-	{0x3d59, 88},
-	{0x3d5a, 89},
-	{0x3d5b, 90},
-	{0x3d5c, 91},
-	{0x3d5d, 92},
-	{0x3d5e, 93},
-	{0x3d5f, 94},
-	{0x3d60, 95},
-	{0x3d61, 96},
-	{0x3d62, 97},
-	{0x3d63, 98},
-	{0x3d64, 99},
-	{0x3d65, 100},
-	{0x3d66, 101},
-	{0x3d67, 102},
-	{0x3d68, 103},
-	{0x3d69, 104},
-	{0x3d6a, 105},
-	{0x3d6b, 106},
-	{0x3d6c, 107},
-	{0x3d6d, 108},
-	{0x3d6e, 109},
-	{0x3d6f, 110},
-	{0x3d70, 111},
-	{0x3d71, 112},
-	{0x3d72, 113},
-	{0x3d73, 114},
-	{0x3d74, 115},
-	{0x3d75, 116},
-	{0x3d76, 117},
-	{0x3d77, 118},
-	{0x3d78, 119},
-	{0x3d79, 120},
-	{0x3d7a, 121},
-	{0x3d7b, 122},
-	{0x3d7c, 123},
-	{0x3d7d, 124},
-	{0x3d7e, 125},
-	{0x3d7f, 126},
-	{0x3d80, 127},
-	{0x3d81, 128},
-	{0x3d82, 129},
-	{0x3d83, 130},
-	{0x3d84, 131},
-	{0x3d85, 132},
-	{0x3d86, 133},
-	{0x3d87, 134},
-	{0x3d88, 135},
-	{0x3d89, 136},
-	{0x3d8a, 137},
-	{0x3d8b, 138},
-	{0x3d8c, 139},
-	{0x3d8d, 140},
-	{0x3d8e, 141},
-	{0x3d8f, 142},
-	{0x3d90, 143},
-	{0x3d91, 144},
-	{0x3d92, 145},
-	{0x3d93, 146},
-	{0x3d94, 147},
-	{0x3d95, 148},
-	{0x3d96, 149},
-	{0x3d97, 150},
-	{0x3d98, 151},
-	{0x3d99, 152},
-	{0x3d9a, 153},
-	{0x3d9b, 154},
-	{0x3d9c, 155},
-	{0x3d9d, 156},
-	{0x3d9e, 157},
-	{0x3d9f, 158},
-	{0x3da0, 159},
-	{0x3da1, 160},
-	{0x3da2, 161},
-	{0x3da3, 162},
-	{0x3da4, 163},
-	{0x3da5, 164},
-	{0x3da6, 165},
-	{0x3da7, 166},
-	{0x3da8, 167},
-	{0x3da9, 168},
-	{0x3daa, 169},
-	{0x3dab, 170},
-	{0x3dac, 171},
-	{0x3dad, 172},
-	{0x3dae, 173},
-	{0x3daf, 174},
-	{0x3db0, 175},
-	{0x3db1, 176},
-	{0x3db2, 177},
-	{0x3db3, 178},
-	{0x3db4, 179},
-	{0x3db5, 180},
-	{0x3db6, 181},
-	{0x3db7, 182},
-	{0x3db8, 183},
-	{0x3db9, 184},
-	{0x3dba, 185},
-	{0x3dbb, 186},
-	{0x3dbc, 187},
-	{0x3dbd, 188},
-	{0x3dbe, 189},
-	{0x3dbf, 190},
-	{0x3dc0, 191},
-	{0x3dc1, 192},
-	{0x3dc2, 193},
-	{0x3dc3, 194},
-	{0x3dc4, 195},
-	{0x3dc5, 196},
-	{0x3dc6, 197},
-	{0x3dc7, 198},
-	{0x3dc8, 199},
-	{0x3dc9, 200},
-	{0x3dca, 201},
-	{0x3dcb, 202},
-	{0x3dcc, 203},
-	{0x3dcd, 204},
-	{0x3dce, 205},
-	{0x3dcf, 206},
-	{0x3dd0, 207},
-	{0x3dd1, 208},
-	{0x3dd2, 209},
-	{0x3dd3, 210},
-	{0x3dd4, 211},
-	{0x3dd5, 212},
-	{0x3dd6, 213},
-	{0x3dd7, 214},
-	{0x3dd8, 215},
-	{0x3dd9, 216},
-	{0x3dda, 217},
-	{0x3ddb, 218},
-	{0x3ddc, 219},
-	{0x3ddd, 220},
-	{0x3dde, 221},
-	{0x3ddf, 222},
-	{0x3de0, 223},
-	{0x3de1, 224},
-	{0x3de2, 225},
-	{0x3de3, 226},
-	{0x3de4, 227},
-	{0x3de5, 228},
-	{0x3de6, 229},
-	{0x3de7, 230},
-	{0x3de8, 231},
-	{0x3de9, 232},
-	{0x3dea, 233},
-	{0x3deb, 234},
-	{0x3dec, 235},
-	{0x3ded, 236},
-	{0x3dee, 237},
-	{0x3def, 238},
-	{0x3df0, 239},
-	{0x3df1, 240},
-	{0x3df2, 241},
-	{0x3df3, 242},
-	{0x3df4, 243},
-	{0x3df5, 244},
-	{0x3df6, 245},
-	{0x3df7, 246},
-	{0x3df8, 247},
-	{0x3df9, 248},
-	{0x3dfa, 249},
-	{0x3dfb, 250},
-	{0x3dfc, 251},
-	{0x3dfd, 252},
-	{0x3dfe, 253},
-	{0x3dff, 254},
-	{0x3e01, 0},
-	{0x3e02, 1},
-	{0x3e03, 2},
-	{0x3e04, 3},
-	{0x3e05, 4},
-	{0x3e06, 5},
-	{0x3e07, 6},
-	{0x3e08, 7},
-	{0x3e09, 8},
-	{0x3e0a, 9},
-	{0x3e0b, 10},
-	{0x3e0c, 11},
-	{0x3e0d, 12},
-	{0x3e0e, 13},
-	{0x3e0f, 14},
-	{0x3e10, 15},
-	{0x3e11, 16},
-	{0x3e12, 17},
-	{0x3e13, 18},
-	{0x3e14, 19},
-	{0x3e15, 20},
-	{0x3e16, 21},
-	{0x3e17, 22},
-	{0x3e18, 23},
-	{0x3e19, 24},
-	{0x3e1a, 25},
-	{0x3e1b, 26},
-	{0x3e1c, 27},
-	{0x3e1d, 28},
-	{0x3e1e, 29},
-	{0x3e1f, 30},
-	{0x3e20, 31},
-	{0x3e21, 32},
-	{0x3e22, 33},
-	{0x3e23, 34},
-	{0x3e24, 35},
-	{0x3e25, 36},
-	{0x3e26, 37},
-	{0x3e27, 38},
-	{0x3e28, 39},
-	{0x3e29, 40},
-	{0x3e2a, 41},
-	{0x3e2b, 42},
-	{0x3e2c, 43},
-	{0x3e2d, 44},
-	{0x3e2e, 45},
-	{0x3e2f, 46},
-	{0x3e30, 47},
-	{0x3e31, 48},
-	{0x3e32, 49},
-	{0x3e33, 50},
-	{0x3e34, 51},
-	{0x3e35, 52},
-	{0x3e36, 53},
-	{0x3e37, 54},
-	{0x3e38, 55},
-	{0x3e39, 56},
-	{0x3e3a, 57},
-	{0x3e3b, 58},
-	{0x3e3c, 59},
-	{0x3e3d, 60},
-	{0x3e3e, 61},
-	{0x3e3f, 62},
-	{0x3e40, 63},
-	{0x3e41, 64},
-	{0x3e42, 65},
-	{0x3e43, 66},
-	{0x3e44, 67},
-	{0x3e45, 68},
-	{0x3e46, 69},
-	{0x3e47, 70},
-	{0x3e48, 71},
-	{0x3e49, 72},
-	{0x3e4a, 73},
-	{0x3e4b, 74},
-	{0x3e4c, 75},
-	{0x3e4d, 76},
-	{0x3e4e, 77},
-	{0x3e4f, 78},
-	{0x3e50, 79},
-	{0x3e51, 80},
-	{0x3e52, 81},
-	{0x3e53, 82},
-	{0x3e54, 83},
-	{0x3e55, 84},
-	{0x3e56, 85},
-	{0x3e57, 86},
-	{0x3e58, 87},
-	{0x3e59, 88},
-	{0x3e5a, 89},
-	{0x3e5b, 90},
-	{0x3e5c, 91},
-	{0x3e5d, 92},
-	{0x3e5e, 93},
-	{0x3e5f, 94},
-	{0x3e60, 95},
-	{0x3e61, 96},
-	{0x3e62, 97},
-	{0x3e63, 98},
-	{0x3e64, 99},
-	{0x3e65, 100},
-	{0x3e66, 101},
-	{0x3e67, 102},
-	{0x3e68, 103},
-	{0x3e69, 104},
-	{0x3e6a, 105},
-	{0x3e6b, 106},
-	{0x3e6c, 107},
-	{0x3e6d, 108},
-	{0x3e6e, 109},
-	{0x3e6f, 110},
-	{0x3e70, 111},
-	{0x3e71, 112},
-	{0x3e72, 113},
-	{0x3e73, 114},
-	{0x3e74, 115},
-	{0x3e75, 116},
-	{0x3e76, 117},
-	{0x3e77, 118},
-	{0x3e78, 119},
-	{0x3e79, 120},
-	{0x3e7a, 121},
-	{0x3e7b, 122},
-	{0x3e7c, 123},
-	{0x3e7d, 124},
-	{0x3e7e, 125},
-	{0x3e7f, 126},
-	{0x3e80, 127},
-	{0x3e81, 128},
-	{0x3e82, 129},
-	{0x3e83, 130},
-	{0x3e84, 131},
-	{0x3e85, 132},
-	{0x3e86, 133},
-	{0x3e87, 134},
-	{0x3e88, 135},
-	{0x3e89, 136},
-	{0x3e8a, 137},
-	{0x3e8b, 138},
-	{0x3e8c, 139},
-	{0x3e8d, 140},
-	{0x3e8e, 141},
-	{0x3e8f, 142},
-	{0x3e90, 143},
-	{0x3e91, 144},
-	{0x3e92, 145},
-	{0x3e93, 146},
-	{0x3e94, 147},
-	{0x3e95, 148},
-	{0x3e96, 149},
-	{0x3e97, 150},
-	{0x3e98, 151},
-	{0x3e99, 152},
-	{0x3e9a, 153},
-	{0x3e9b, 154},
-	{0x3e9c, 155},
-	{0x3e9d, 156},
-	{0x3e9e, 157},
-	{0x3e9f, 158},
-	{0x3ea0, 159},
-	{0x3ea1, 160},
-	{0x3ea2, 161},
-	{0x3ea3, 162},
-	{0x3ea4, 163},
-	{0x3ea5, 164},
-	{0x3ea6, 165},
-	{0x3ea7, 166},
-	{0x3ea8, 167},
-	{0x3ea9, 168},
-	{0x3eaa, 169},
-	{0x3eab, 170},
-	{0x3eac, 171},
-	{0x3ead, 172},
-	{0x3eae, 173},
-	{0x3eaf, 174},
-	{0x3eb0, 175},
-	{0x3eb1, 176},
-	{0x3eb2, 177},
-	{0x3eb3, 178},
-	{0x3eb4, 179},
-	{0x3eb5, 180},
-	{0x3eb6, 181},
-	{0x3eb7, 182},
-	{0x3eb8, 183},
-	{0x3eb9, 184},
-	{0x3eba, 185},
-	{0x3ebb, 186},
-	{0x3ebc, 187},
-	{0x3ebd, 188},
-	{0x3ebe, 189},
-	{0x3ebf, 190},
-	{0x3ec0, 191},
-	{0x3ec1, 192},
-	{0x3ec2, 193},
-	{0x3ec3, 194},
-	{0x3ec4, 195},
-	{0x3ec5, 196},
-	{0x3ec6, 197},
-	{0x3ec7, 198},
-	{0x3ec8, 199},
-	{0x3ec9, 200},
-	{0x3eca, 201},
-	{0x3ecb, 202},
-	{0x3ecc, 203},
-	{0x3ecd, 204},
-	{0x3ece, 205},
-	{0x3ecf, 206},
-	{0x3ed0, 207},
-	{0x3ed1, 208},
-	{0x3ed2, 209},
-	{0x3ed3, 210},
-	{0x3ed4, 211},
-	{0x3ed5, 212},
-	{0x3ed6, 213},
-	{0x3ed7, 214},
-	{0x3ed8, 215},
-	{0x3ed9, 216},
-	{0x3eda, 217},
-	{0x3edb, 218},
-	{0x3edc, 219},
-	{0x3edd, 220},
-	{0x3ede, 221},
-	{0x3edf, 222},
-	{0x3ee0, 223},
-	{0x3ee1, 224},
-	{0x3ee2, 225},
-	{0x3ee3, 226},
-	{0x3ee4, 227},
-	{0x3ee5, 228},
-	{0x3ee6, 229},
-	{0x3ee7, 230},
-	{0x3ee8, 231},
-	{0x3ee9, 232},
-	{0x3eea, 233},
-	{0x3eeb, 234},
-	{0x3eec, 235},
-	{0x3eed, 236},
-	{0x3eee, 237},
-	{0x3eef, 238},
-	{0x3ef0, 239},
-	{0x3ef1, 240},
-	{0x3ef2, 241},
-	{0x3ef3, 242},
-	{0x3ef4, 243},
-	{0x3ef5, 244},
-	{0x3ef6, 245},
-	{0x3ef7, 246},
-	{0x3ef8, 247},
-	{0x3ef9, 248},
-	{0x3efa, 249},
-	{0x3efb, 250},
-	{0x3efc, 251},
-	{0x3efd, 252},
-	{0x3efe, 253},
-	{0x3eff, 254},
-	{0x3f01, 0},
-	{0x3f02, 1},
-	{0x3f03, 2},
-	{0x3f04, 3},
-	{0x3f05, 4},
-	{0x3f06, 5},
-	{0x3f07, 6},
-	{0x3f08, 7},
-	{0x3f09, 8},
-	{0x3f0a, 9},
-	{0x3f0b, 10},
-	{0x3f0c, 11},
-	{0x3f0d, 12},
-	{0x3f0e, 13},
-	{0x3f0f, 14},
-	{0x3f10, 15},
-	{0x3f11, 16},
-	{0x3f12, 17},
-	{0x3f13, 18},
-	{0x3f14, 19},
-	{0x3f15, 20},
-	{0x3f16, 21},
-	{0x3f17, 22},
-	{0x3f18, 23},
-	{0x3f19, 24},
-	{0x3f1a, 25},
-	{0x3f1b, 26},
-	{0x3f1c, 27},
-	{0x3f1d, 28},
-	{0x3f1e, 29},
-	{0x3f1f, 30},
-	{0x3f20, 31},
-	{0x3f21, 32},
-	{0x3f22, 33},
-	{0x3f23, 34},
-	{0x3f24, 35},
-	{0x3f25, 36},
-	{0x3f26, 37},
-	{0x3f27, 38},
-	{0x3f28, 39},
-	{0x3f29, 40},
-	{0x3f2a, 41},
-	{0x3f2b, 42},
-	{0x3f2c, 43},
-	{0x3f2d, 44},
-	{0x3f2e, 45},
-	{0x3f2f, 46},
-	{0x3f30, 47},
-	{0x3f31, 48},
-	{0x3f32, 49},
-	{0x3f33, 50},
-	{0x3f34, 51},
-	{0x3f35, 52},
-	{0x3f36, 53},
-	{0x3f37, 54},
-	{0x3f38, 55},
-	{0x3f39, 56},
-	{0x3f3a, 57},
-	{0x3f3b, 58},
-	{0x3f3c, 59},
-	{0x3f3d, 60},
-	{0x3f3e, 61},
-	{0x3f3f, 62},
-	{0x3f40, 63},
-	{0x3f41, 64},
-	{0x3f42, 65},
-	{0x3f43, 66},
-	{0x3f44, 67},
-	{0x3f45, 68},
-	{0x3f46, 69},
-	{0x3f47, 70},
-	{0x3f48, 71},
-	{0x3f49, 72},
-	{0x3f4a, 73},
-	{0x3f4b, 74},
-	{0x3f4c, 75},
-	{0x3f4d, 76},
-	{0x3f4e, 77},
-	{0x3f4f, 78},
-	{0x3f50, 79},
-	{0x3f51, 80},
-	{0x3f52, 81},
-	{0x3f53, 82},
-	{0x3f54, 83},
-	{0x3f55, 84},
-	{0x3f56, 85},
-	{0x3f57, 86},
-	{0x3f58, 87},
-	{0x3f59, 88},
-	{0x3f5a, 89},
-	{0x3f5b, 90},
-	{0x3f5c, 91},
-	{0x3f5d, 92},
-	{0x3f5e, 93},
-	{0x3f5f, 94},
-	{0x3f60, 95},
-	{0x3f61, 96},
-	{0x3f62, 97},
-	{0x3f63, 98},
-	{0x3f64, 99},
-	{0x3f65, 100},
-	{0x3f66, 101},
-	{0x3f67, 102},
-	{0x3f68, 103},
-	{0x3f69, 104},
-	{0x3f6a, 105},
-	{0x3f6b, 106},
-	{0x3f6c, 107},
-	{0x3f6d, 108},
-	{0x3f6e, 109},
-	{0x3f6f, 110},
-	{0x3f70, 111},
-	{0x3f71, 112},
-	{0x3f72, 113},
-	{0x3f73, 114},
-	{0x3f74, 115},
-	{0x3f75, 116},
-	{0x3f76, 117},
-	{0x3f77, 118},
-	{0x3f78, 119},
-	{0x3f79, 120},
-	{0x3f7a, 121},
-	{0x3f7b, 122},
-	{0x3f7c, 123},
-	{0x3f7d, 124},
-	{0x3f7e, 125},
-	{0x3f7f, 126},
-	{0x3f80, 127},
-	{0x3f81, 128},
-	{0x3f82, 129},
-	{0x3f83, 130},
-	{0x3f84, 131},
-	{0x3f85, 132},
-	{0x3f86, 133},
-	{0x3f87, 134},
-	{0x3f88, 135},
-	{0x3f89, 136},
-	{0x3f8a, 137},
-	{0x3f8b, 138},
-	{0x3f8c, 139},
-	{0x3f8d, 140},
-	{0x3f8e, 141},
-	{0x3f8f, 142},
-	{0x3f90, 143},
-	{0x3f91, 144},
-	{0x3f92, 145},
-	{0x3f93, 146},
-	{0x3f94, 147},
-	{0x3f95, 148},
-	{0x3f96, 149},
-	{0x3f97, 150},
-	{0x3f98, 151},
-	{0x3f99, 152},
-	{0x3f9a, 153},
-	{0x3f9b, 154},
-	{0x3f9c, 155},
-	{0x3f9d, 156},
-	{0x3f9e, 157},
-	{0x3f9f, 158},
-	{0x3fa0, 159},
-	{0x3fa1, 160},
-	{0x3fa2, 161},
-	{0x3fa3, 162},
-	{0x3fa4, 163},
-	{0x3fa5, 164},
-	{0x3fa6, 165},
-	{0x3fa7, 166},
-	{0x3fa8, 167},
-	{0x3fa9, 168},
-	{0x3faa, 169},
-	{0x3fab, 170},
-	{0x3fac, 171},
-	{0x3fad, 172},
-	{0x3fae, 173},
-	{0x3faf, 174},
-	{0x3fb0, 175},
-	{0x3fb1, 176},
-	{0x3fb2, 177},
-	{0x3fb3, 178},
-	{0x3fb4, 179},
-	{0x3fb5, 180},
-	{0x3fb6, 181},
-	{0x3fb7, 182},
-	{0x3fb8, 183},
-	{0x3fb9, 184},
-	{0x3fba, 185},
-	{0x3fbb, 186},
-	{0x3fbc, 187},
-	{0x3fbd, 188},
-	{0x3fbe, 189},
-	{0x3fbf, 190},
-	{0x3fc0, 191},
-	{0x3fc1, 192},
-	{0x3fc2, 193},
-	{0x3fc3, 194},
-	{0x3fc4, 195},
-	{0x3fc5, 196},
-	{0x3fc6, 197},
-	{0x3fc7, 198},
-	{0x3fc8, 199},
-	{0x3fc9, 200},
-	{0x3fca, 201},
-	{0x3fcb, 202},
-	{0x3fcc, 203},
-	{0x3fcd, 204},
-	{0x3fce, 205},
-	{0x3fcf, 206},
-	{0x3fd0, 207},
-	{0x3fd1, 208},
-	{0x3fd2, 209},
-	{0x3fd3, 210},
-	{0x3fd4, 211},
-	{0x3fd5, 212},
-	{0x3fd6, 213},
-	{0x3fd7, 214},
-	{0x3fd8, 215},
-	{0x3fd9, 216},
-	{0x3fda, 217},
-	{0x3fdb, 218},
-	{0x3fdc, 219},
-	{0x3fdd, 220},
-	{0x3fde, 221},
-	{0x3fdf, 222},
-	{0x3fe0, 223},
-	{0x3fe1, 224},
-	{0x3fe2, 225},
-	{0x3fe3, 226},
-	{0x3fe4, 227},
-	{0x3fe5, 228},
-	{0x3fe6, 229},
-	{0x3fe7, 230},
-	{0x3fe8, 231},
-	{0x3fe9, 232},
-	{0x3fea, 233},
-	{0x3feb, 234},
-	{0x3fec, 235},
-	{0x3fed, 236},
-	{0x3fee, 237},
-	{0x3fef, 238},
-	{0x3ff0, 239},
-	{0x3ff1, 240},
-	{0x3ff2, 241},
-	{0x3ff3, 242},
-	{0x3ff4, 243},
-	{0x3ff5, 244},
-	{0x3ff6, 245},
-	{0x3ff7, 246},
-	{0x3ff8, 247},
-	{0x3ff9, 248},
-	{0x3ffa, 249},
-	{0x3ffb, 250},
-	{0x3ffc, 251},
-	{0x3ffd, 252},
-	{0x3ffe, 253},
-	{0x3fff, 254},
-	{0x4001, 0},
-	{0x4002, 1},
-	{0x4003, 2},
-	{0x4004, 3},
-	{0x4005, 4},
-	{0x4006, 5},
-	{0x4007, 6},
-	{0x4008, 7},
-	{0x4009, 8},
-	{0x400a, 9},
-	{0x400b, 10},
-	{0x400c, 11},
-	{0x400d, 12},
-	{0x400e, 13},
-	{0x400f, 14},
-	{0x4010, 15},
-	{0x4011, 16},
-	{0x4012, 17},
-	{0x4013, 18},
-	{0x4014, 19},
-	{0x4015, 20},
-	{0x4016, 21},
-	{0x4017, 22},
-	{0x4018, 23},
-	{0x4019, 24},
-	{0x401a, 25},
-	{0x401b, 26},
-	{0x401c, 27},
-	{0x401d, 28},
-	{0x401e, 29},
-	{0x401f, 30},
-	{0x4020, 31},
-	{0x4021, 32},
-	{0x4022, 33},
-	{0x4023, 34},
-	{0x4024, 35},
-	{0x4025, 36},
-	{0x4026, 37},
-	{0x4027, 38},
-	{0x4028, 39},
-	{0x4029, 40},
-	{0x402a, 41},
-	{0x402b, 42},
-	{0x402c, 43},
-	{0x402d, 44},
-	{0x402e, 45},
-	{0x402f, 46},
-	{0x4030, 47},
-	{0x4031, 48},
-	{0x4032, 49},
-	{0x4033, 50},
-	{0x4034, 51},
-	{0x4035, 52},
-	{0x4036, 53},
-	{0x4037, 54},
-	{0x4038, 55},
-	{0x4039, 56},
-	{0x403a, 57},
-	{0x403b, 58},
-	{0x403c, 59},
-	{0x403d, 60},
-	{0x403e, 61},
-	{0x403f, 62},
-	{0x4040, 63},
-	{0x4041, 64},
-	{0x4042, 65},
-	{0x4043, 66},
-	{0x4044, 67},
-	{0x4045, 68},
-	{0x4046, 69},
-	{0x4047, 70},
-	{0x4048, 71},
-	{0x4049, 72},
-	{0x404a, 73},
-	{0x404b, 74},
-	{0x404c, 75},
-	{0x404d, 76},
-	{0x404e, 77},
-	{0x404f, 78},
-	{0x4050, 79},
-	{0x4051, 80},
-	{0x4052, 81},
-	{0x4053, 82},
-	{0x4054, 83},
-	{0x4055, 84},
-	{0x4058, 0},
-	{0x4059, 1},
-	{0x405a, 2},
-	{0x405b, 3},
-	{0x405c, 4},
-	{0x405d, 5},
-	{0x405e, 6},
-	{0x405f, 7},
-	{0x4060, 8},
-	{0x4061, 9},
-	{0x4062, 10},
-	{0x4063, 11},
-	{0x4064, 12},
-	{0x4065, 13},
-	{0x4066, 14},
-	{0x4067, 15},
-	{0x4068, 16},
-	{0x4069, 17},
-	{0x406a, 18},
-	{0x406b, 19},
-	{0x406c, 20},
-	{0x406d, 21},
-	{0x406e, 22},
-	{0x406f, 23},
-	{0x4070, 24},
-	{0x4071, 25},
-	{0x4072, 26},
-	{0x4073, 27},
-	{0x4074, 28},
-	{0x4075, 29},
-	{0x4076, 30},
-	{0x4077, 31},
-	{0x4078, 32},
-	{0x4079, 33},
-	{0x407a, 34},
-	{0x407b, 35},
-	{0x407c, 36},
-	{0x407d, 37},
-	{0x407e, 38},
-	{0x407f, 39},
-	{0x4080, 40},
-	{0x4081, 41},
-	{0x4082, 42},
-	{0x4083, 43},
-	{0x4084, 44},
-	{0x4085, 45},
-	{0x4086, 46},
-	{0x4087, 47},
-	{0x4088, 48},
-	{0x4089, 49},
-	{0x408a, 50},
-	{0x408b, 51},
-	{0x408c, 52},
-	{0x408d, 53},
-	{0x408e, 54},
-	{0x408f, 55},
-	{0x4090, 56},
-	{0x4091, 57},
-	{0x4092, 58},
-	{0x4093, 59},
-	{0x4094, 60},
-	{0x4095, 61},
-	{0x4096, 62},
-	{0x4097, 63},
-	{0x4098, 64},
-	{0x4099, 65},
-	{0x409a, 66},
-	{0x409b, 67},
-	{0x409c, 68},
-	{0x409d, 69},
-	{0x409e, 70},
-	{0x409f, 71},
-	{0x40a0, 72},
-	{0x40a1, 73},
-	{0x40a2, 74},
-	{0x40a3, 75},
-	{0x40a4, 76},
-	{0x40a5, 77},
-	{0x40a6, 78},
-	{0x40a7, 79},
-	{0x40a8, 80},
-	{0x40a9, 81},
-	{0x40aa, 82},
-	{0x40ab, 83},
-	{0x40ac, 84},
-	{0x40ad, 85},
-	{0x40ae, 86},
-	{0x40af, 87},
-	{0x40b0, 88},
-	{0x40b1, 89},
-	{0x40b2, 90},
-	{0x40b3, 91},
-	{0x40b4, 92},
-	{0x40b5, 93},
-	{0x40b6, 94},
-	{0x40b7, 95},
-	{0x40b8, 96},
-	{0x40b9, 97},
-	{0x40ba, 98},
-	{0x40bb, 99},
-	{0x40bc, 100},
-	{0x40bd, 101},
-	{0x40be, 102},
-	{0x40bf, 103},
-	{0x40c0, 104},
-	{0x40c1, 105},
-	{0x40c2, 106},
-	{0x40c3, 107},
-	{0x40c4, 108},
-	{0x40c5, 109},
-	{0x40c6, 110},
-	{0x40c7, 111},
-	{0x40c8, 112},
-	{0x40c9, 113},
-	{0x40ca, 114},
-	{0x40cb, 115},
-	{0x40cc, 116},
-	{0x40cd, 117},
-	{0x40ce, 118},
-	{0x40cf, 119},
-	{0x40d0, 120},
-	{0x40d1, 121},
-	{0x40d2, 122},
-	{0x40d3, 123},
-	{0x40d4, 124},
-	{0x40d5, 125},
-	{0x40d6, 126},
-	{0x40d7, 127},
-	{0x40d8, 128},
-	{0x40d9, 129},
-	{0x40da, 130},
-	{0x40db, 131},
-	{0x40dc, 132},
-	{0x40dd, 133},
-	{0x40de, 134},
-	{0x40df, 135},
-	{0x40e0, 136},
-	{0x40e1, 137},
-	{0x40e2, 138},
-	{0x40e3, 139},
-	{0x40e4, 140},
-	{0x40e5, 141},
-	{0x40e6, 142},
-	{0x40e7, 143},
-	{0x40e8, 144},
-	{0x40e9, 145},
-	{0x40ea, 146},
-	{0x40eb, 147},
-	{0x40ec, 148},
-	{0x40ed, 149},
-	{0x40ee, 150},
-	{0x40ef, 151},
-	{0x40f0, 152},
-	{0x40f1, 153},
-	{0x40f2, 154},
-	{0x40f3, 155},
-	{0x40f4, 156},
-	{0x40f5, 157},
-	{0x40f6, 158},
-	{0x40f7, 159},
-	{0x40f8, 160},
-	{0x40f9, 161},
-	{0x40fa, 162},
-	{0x40fb, 163},
-	{0x40fc, 164},
-	{0x40fd, 165},
-	{0x40fe, 166},
-	{0x40ff, 167},
-	{0x4101, 0},
-	{0x4102, 1},
-	{0x4103, 2},
-	{0x4104, 3},
-	{0x4105, 4},
-	{0x4106, 5},
-	{0x4107, 6},
-	{0x4108, 7},
-	{0x4109, 8},
-	{0x410a, 9},
-	{0x410b, 10},
-	{0x410c, 11},
-	{0x410d, 12},
-	{0x410e, 13},
-	{0x410f, 14},
-	{0x4110, 15},
-	{0x4111, 16},
-	{0x4112, 17},
-	{0x4113, 18},
-	{0x4114, 19},
-	{0x4115, 20},
-	{0x4116, 21},
-	{0x4117, 22},
-	{0x4118, 23},
-	{0x4119, 24},
-	{0x411a, 25},
-	{0x411b, 26},
-	{0x411c, 27},
-	{0x411d, 28},
-	{0x411e, 29},
-	{0x411f, 30},
-	{0x4120, 31},
-	{0x4121, 32},
-	{0x4122, 33},
-	{0x4123, 34},
-	{0x4124, 35},
-	{0x4125, 36},
-	{0x4126, 37},
-	{0x4127, 38},
-	{0x4128, 39},
-	{0x4129, 40},
-	{0x412a, 41},
-	{0x412b, 42},
-	{0x412c, 43},
-	{0x412d, 44},
-	{0x412e, 45},
-	{0x412f, 46},
-	{0x4130, 47},
-	{0x4131, 48},
-	{0x4132, 49},
-	{0x4133, 50},
-	{0x4134, 51},
-	{0x4135, 52},
-	{0x4136, 53},
-	{0x4137, 54},
-	{0x4138, 55},
-	{0x4139, 56},
-	{0x413a, 57},
-	{0x413b, 58},
-	{0x413c, 59},
-	{0x413d, 60},
-	{0x413e, 61},
-	{0x413f, 62},
-	{0x4140, 63},
-	{0x4141, 64},
-	{0x4142, 65},
-	{0x4143, 66},
-	{0x4144, 67},
-	{0x4145, 68},
-	{0x4146, 69},
-	{0x4147, 70},
-	{0x4148, 71},
-	{0x4149, 72},
-	{0x414a, 73},
-	{0x414b, 74},
-	{0x414c, 75},
-	{0x414d, 76},
-	{0x414e, 77},
-	{0x414f, 78},
-	{0x4150, 79},
-	{0x4151, 80},
-	{0x4152, 81},
-	{0x4153, 82},
-	{0x4154, 83},
-	{0x4155, 84},
-	{0x4156, 85},
-	{0x4157, 86},
-	{0x4158, 87},
-	{0x4159, 88},
-	{0x415a, 89},
-	{0x415b, 90},
-	{0x415c, 91},
-	{0x415d, 92},
-	{0x415e, 93},
-	{0x4161, 0},
-	{0x4162, 1},
-	{0x4163, 2},
-	{0x4164, 3},
-	{0x4165, 4},
-	{0x4166, 5},
-	{0x4167, 6},
-	{0x4168, 7},
-	{0x4169, 8},
-	{0x416a, 9},
-	{0x416b, 10},
-	{0x416c, 11},
-	{0x416d, 12},
-	{0x416e, 13},
-	{0x416f, 14},
-	{0x4170, 15},
-	{0x4171, 16},
-	{0x4172, 17},
-	{0x4173, 18},
-	{0x4174, 19},
-	{0x4175, 20},
-	{0x4176, 21},
-	{0x4177, 22},
-	{0x4178, 23},
-	{0x4179, 24},
-	{0x417a, 25},
-	{0x417b, 26},
-	{0x417c, 27},
-	{0x417d, 28},
-	{0x417e, 29},
-	{0x417f, 30},
-	{0x4180, 31},
-	{0x4181, 32},
-	{0x4182, 33},
-	{0x4183, 34},
-	{0x4184, 35},
-	{0x4185, 36},
-	{0x4186, 37},
-	{0x4187, 38},
-	{0x4188, 39},
-	{0x4189, 40},
-	{0x418a, 41},
-	{0x418b, 42},
-	{0x418c, 43},
-	{0x418d, 44},
-	{0x418e, 45},
-	{0x418f, 46},
-	{0x4190, 47},
-	{0x4191, 48},
-	{0x4192, 49},
-	{0x4193, 50},
-	{0x4194, 51},
-	{0x4195, 52},
-	{0x4196, 53},
-	{0x4197, 54},
-	{0x4198, 55},
-	{0x4199, 56},
-	{0x419a, 57},
-	{0x419b, 58},
-	{0x419c, 59},
-	{0x419d, 60},
-	{0x419e, 61},
-	{0x419f, 62},
-	{0x41a0, 63},
-	{0x41a1, 64},
-	{0x41a2, 65},
-	{0x41a3, 66},
-	{0x41a4, 67},
-	{0x41a5, 68},
-	{0x41a6, 69},
-	{0x41a7, 70},
-	{0x41a8, 71},
-	{0x41a9, 72},
-	{0x41aa, 73},
-	{0x41ab, 74},
-	{0x41ac, 75},
-	{0x41ad, 76},
-	{0x41ae, 77},
-	{0x41af, 78},
-	{0x41b0, 79},
-	{0x41b1, 80},
-	{0x41b2, 81},
-	{0x41b3, 82},
-	{0x41b4, 83},
-	{0x41b5, 84},
-	{0x41b6, 85},
-	{0x41b7, 86},
-	{0x41b8, 87},
-	{0x41b9, 88},
-	{0x41ba, 89},
-	{0x41bb, 90},
-	{0x41bc, 91},
-	{0x41bd, 92},
-	{0x41be, 93},
-	{0x41bf, 94},
-	{0x41c0, 95},
-	{0x41c1, 96},
-	{0x41c2, 97},
-	{0x41c3, 98},
-	{0x41c4, 99},
-	{0x41c5, 100},
-	{0x41c6, 101},
-	{0x41c7, 102},
-	{0x41c8, 103},
-	{0x41c9, 104},
-	{0x41ca, 105},
-	{0x41cb, 106},
-	{0x41cc, 107},
-	{0x41cd, 108},
-	{0x41ce, 109},
-	{0x41cf, 110},
-	{0x41d0, 111},
-	{0x41d1, 112},
-	{0x41d2, 113},
-	{0x41d3, 114},
-	{0x41d4, 115},
-	{0x41d5, 116},
-	{0x41d6, 117},
-	{0x41d7, 118},
-	{0x41d8, 119},
-	{0x41d9, 120},
-	{0x41da, 121},
-	{0x41db, 122},
-	{0x41dc, 123},
-	{0x41dd, 124},
-	{0x41de, 125},
-	{0x41df, 126},
-	{0x41e0, 127},
-	{0x41e1, 128},
-	{0x41e2, 129},
-	{0x41e3, 130},
-	{0x41e4, 131},
-	{0x41e5, 132},
-	{0x41e6, 133},
-	{0x41e7, 134},
-	{0x41e8, 135},
-	{0x41e9, 136},
-	{0x41ea, 137},
-	{0x41eb, 138},
-	{0x41ec, 139},
-	{0x41ed, 140},
-	{0x41ee, 141},
-	{0x41ef, 142},
-	{0x41f0, 143},
-	{0x41f1, 144},
-	{0x41f2, 145},
-	{0x41f3, 146},
-	{0x41f4, 147},
-	{0x41f5, 148},
-	{0x41f6, 149},
-	{0x41f7, 150},
-	{0x41f8, 151},
-	{0x41f9, 152},
-	{0x41fa, 153},
-	{0x41fb, 154},
-	{0x41fc, 155},
-	{0x41fd, 156},
-	{0x41fe, 157},
-	{0x41ff, 158},
-	{0x4201, 0},
-	{0x4202, 1},
-	{0x4203, 2},
-	{0x4204, 3},
-	{0x4205, 4},
-	{0x4206, 5},
-	{0x4207, 6},
-	{0x4208, 7},
-	{0x4209, 8},
-	{0x420a, 9},
-	{0x420b, 10},
-	{0x420c, 11},
-	{0x420d, 12},
-	{0x420e, 13},
-	{0x420f, 14},
-	{0x4210, 15},
-	{0x4211, 16},
-	{0x4212, 17},
-	{0x4213, 18},
-	{0x4214, 19},
-	{0x4215, 20},
-	{0x4216, 21},
-	{0x4217, 22},
-	{0x4218, 23},
-	{0x4219, 24},
-	{0x421a, 25},
-	{0x421b, 26},
-	{0x421c, 27},
-	{0x421d, 28},
-	{0x421e, 29},
-	{0x421f, 30},
-	{0x4220, 31},
-	{0x4221, 32},
-	{0x4222, 33},
-	{0x4223, 34},
-	{0x4224, 35},
-	{0x4225, 36},
-	{0x4226, 37},
-	{0x4227, 38},
-	{0x4228, 39},
-	{0x4229, 40},
-	{0x422a, 41},
-	{0x422b, 42},
-	{0x422c, 43},
-	{0x422d, 44},
-	{0x422e, 45},
-	{0x422f, 46},
-	{0x4230, 47},
-	{0x4231, 48},
-	{0x4232, 49},
-	{0x4233, 50},
-	{0x4234, 51},
-	{0x4235, 52},
-	{0x4236, 53},
-	{0x4237, 54},
-	{0x4238, 55},
-	{0x4239, 56},
-	{0x423a, 57},
-	{0x423b, 58},
-	{0x423c, 59},
-	{0x423d, 60},
-	{0x423e, 61},
-	{0x423f, 62},
-	{0x4240, 63},
-	{0x4241, 64},
-	{0x4242, 65},
-	{0x4243, 66},
-	{0x4244, 67},
-	{0x4245, 68},
-	{0x4246, 69},
-	{0x4247, 70},
-	{0x4248, 71},
-	{0x4249, 72},
-	{0x424a, 73},
-	{0x424b, 74},
-	{0x424c, 75},
-	{0x424d, 76},
-	{0x424e, 77},
-	{0x424f, 78},
-	{0x4250, 79},
-	{0x4251, 80},
-	{0x4252, 81},
-	{0x4253, 82},
-	{0x4254, 83},
-	{0x4255, 84},
-	{0x4256, 85},
-	{0x4257, 86},
-	{0x4258, 87},
-	{0x4259, 88},
-	{0x425a, 89},
-	{0x425b, 90},
-	{0x425c, 91},
-	{0x425d, 92},
-	{0x425e, 93},
-	{0x425f, 94},
-	{0x4260, 95},
-	{0x4261, 96},
-	{0x4262, 97},
-	{0x4263, 98},
-	{0x4264, 99},
-	{0x4265, 100},
-	{0x4266, 101},
-	{0x4267, 102},
-	{0x4268, 103},
-	{0x4269, 104},
-	{0x426a, 105},
-	{0x426b, 106},
-	{0x426c, 107},
-	{0x426d, 108},
-	{0x426e, 109},
-	{0x426f, 110},
-	{0x4270, 111},
-	{0x4271, 112},
-	{0x4272, 113},
-	{0x4273, 114},
-	{0x4274, 115},
-	{0x4275, 116},
-	{0x4276, 117},
-	{0x4277, 118},
-	{0x4278, 119},
-	{0x4279, 120},
-	{0x427a, 121},
-	{0x427b, 122},
-	{0x427c, 123},
-	{0x427d, 124},
-	{0x427e, 125},
-	{0x427f, 126},
-	{0x4280, 127},
-	{0x4281, 128},
-	{0x4282, 129},
-	{0x4283, 130},
-	{0x4284, 131},
-	{0x4285, 132},
-	{0x4286, 133},
-	{0x4287, 134},
-	{0x4288, 135},
-	{0x4289, 136},
-	{0x428a, 137},
-	{0x428b, 138},
-	{0x428c, 139},
-	{0x428d, 140},
-	{0x428e, 141},
-	{0x428f, 142},
-	{0x4290, 143},
-	{0x4291, 144},
-	{0x4292, 145},
-	{0x4293, 146},
-	{0x4294, 147},
-	{0x4295, 148},
-	{0x4296, 149},
-	{0x4297, 150},
-	{0x4298, 151},
-	{0x4299, 152},
-	{0x429a, 153},
-	{0x429b, 154},
-	{0x429c, 155},
-	{0x429d, 156},
-	{0x429e, 157},
-	{0x429f, 158},
-	{0x42a0, 159},
-	{0x42a1, 160},
-	{0x42a2, 161},
-	{0x42a3, 162},
-	{0x42a4, 163},
-	{0x42a5, 164},
-	{0x42a6, 165},
-	{0x42a7, 166},
-	{0x42a8, 167},
-	{0x42a9, 168},
-	{0x42aa, 169},
-	{0x42ab, 170},
-	{0x42ac, 171},
-	{0x42ad, 172},
-	{0x42ae, 173},
-	{0x42af, 174},
-	{0x42b0, 175},
-	{0x42b1, 176},
-	{0x42b2, 177},
-	{0x42b3, 178},
-	{0x42b4, 179},
-	{0x42b5, 180},
-	{0x42b6, 181},
-	{0x42b7, 182},
-	{0x42b8, 183},
-	{0x42b9, 184},
-	{0x42ba, 185},
-	{0x42bb, 186},
-	{0x42bc, 187},
-	{0x42bd, 188},
-	{0x42be, 189},
-	{0x42bf, 190},
-	{0x42c0, 191},
-	{0x42c1, 192},
-	{0x42c2, 193},
-	{0x42c3, 194},
-	{0x42c4, 195},
-	{0x42c5, 196},
-	{0x42c6, 197},
-	{0x42c7, 198},
-	{0x42c8, 199},
-	{0x42c9, 200},
-	{0x42ca, 201},
-	{0x42cb, 202},
-	{0x42cc, 203},
-	{0x42cd, 204},
-	{0x42ce, 205},
-	{0x42cf, 206},
-	{0x42d0, 207},
-	{0x42d1, 208},
-	{0x42d2, 209},
-	{0x42d3, 210},
-	{0x42d4, 211},
-	{0x42d5, 212},
-	{0x42d6, 213},
-	{0x42d7, 214},
-	{0x42d8, 215},
-	{0x42d9, 216},
-	{0x42da, 217},
-	{0x42db, 218},
-	{0x42dc, 219},
-	{0x42dd, 220},
-	{0x42de, 221},
-	{0x42df, 222},
-	{0x42e0, 223},
-	{0x42e1, 224},
-	{0x42e2, 225},
-	{0x42e3, 226},
-	{0x42e4, 227},
-	{0x42e5, 228},
-	{0x42e6, 229},
-	{0x42e7, 230},
-	{0x42e8, 231},
-	{0x42e9, 232},
-	{0x42ea, 233},
-	{0x42eb, 234},
-	{0x42ec, 235},
-	{0x42ed, 236},
-	{0x42ee, 237},
-	{0x42ef, 238},
-	{0x42f0, 239},
-	{0x42f1, 240},
-	{0x42f2, 241},
-	{0x42f3, 242},
-	{0x42f4, 243},
-	{0x42f5, 244},
-	{0x42f6, 245},
-	{0x42f7, 246},
-	{0x42f8, 247},
-	{0x42f9, 248},
-	{0x42fa, 249},
-	{0x42fb, 250},
-	{0x42fc, 251},
-	{0x42fd, 252},
-	{0x42fe, 253},
-	{0x42ff, 254},
-	{0x4301, 0},
-	{0x4302, 1},
-	{0x4303, 2},
-	{0x4304, 3},
-	{0x4305, 4},
-	{0x4306, 5},
-	{0x4307, 6},
-	{0x4308, 7},
-	{0x4309, 8},
-	{0x430a, 9},
-	{0x430b, 10},
-	{0x430c, 11},
-	{0x430d, 12},
-	{0x430e, 13},
-	{0x430f, 14},
-	{0x4310, 15},
-	{0x4311, 16},
-	{0x4312, 17},
-	{0x4313, 18},
-	{0x4314, 19},
-	{0x4315, 20},
-	{0x4316, 21},
-	{0x4317, 22},
-	{0x4318, 23},
-	{0x4319, 24},
-	{0x431a, 25},
-	{0x431b, 26},
-	{0x431c, 27},
-	{0x431d, 28},
-	{0x431e, 29},
-	{0x431f, 30},
-	{0x4320, 31},
-	{0x4321, 32},
-	{0x4322, 33},
-	{0x4323, 34},
-	{0x4324, 35},
-	{0x4325, 36},
-	{0x4326, 37},
-	{0x4327, 38},
-	{0x4328, 39},
-	{0x4329, 40},
-	{0x432a, 41},
-	{0x432b, 42},
-	{0x432c, 43},
-	{0x432d, 44},
-	{0x432e, 45},
-	{0x432f, 46},
-	{0x4330, 47},
-	{0x4331, 48},
-	{0x4332, 49},
-	{0x4333, 50},
-	{0x4334, 51},
-	{0x4335, 52},
-	{0x4336, 53},
-	{0x4339, 0},
-	{0x433a, 1},
-	{0x433b, 2},
-	{0x433c, 3},
-	{0x433d, 4},
-	{0x433e, 5},
-	{0x433f, 6},
-	{0x4340, 7},
-	{0x4341, 8},
-	{0x4342, 9},
-	{0x4343, 10},
-	{0x4344, 11},
-	{0x4345, 12},
-	{0x4346, 13},
-	{0x4347, 14},
-	{0x4348, 15},
-	{0x4349, 16},
-	{0x434a, 17},
-	{0x434b, 18},
-	{0x434c, 19},
-	{0x434d, 20},
-	{0x434e, 21},
-	{0x434f, 22},
-	{0x4350, 23},
-	{0x4351, 24},
-	{0x4352, 25},
-	{0x4353, 26},
-	{0x4354, 27},
-	{0x4355, 28},
-	{0x4356, 29},
-	{0x4357, 30},
-	{0x4358, 31},
-	{0x4359, 32},
-	{0x435a, 33},
-	{0x435b, 34},
-	{0x435c, 35},
-	{0x435d, 36},
-	{0x435e, 37},
-	{0x435f, 38},
-	{0x4360, 39},
-	{0x4361, 40},
-	{0x4362, 41},
-	{0x4363, 42},
-	{0x4364, 43},
-	{0x4365, 44},
-	{0x4366, 45},
-	{0x4367, 46},
-	{0x4368, 47},
-	{0x4369, 48},
-	{0x436a, 49},
-	{0x436b, 50},
-	{0x436c, 51},
-	{0x436d, 52},
-	{0x436e, 53},
-	{0x436f, 54},
-	{0x4370, 55},
-	{0x4371, 56},
-	{0x4372, 57},
-	{0x4373, 58},
-	{0x4374, 59},
-	{0x4375, 60},
-	{0x4376, 61},
-	{0x4377, 62},
-	{0x4378, 63},
-	{0x4379, 64},
-	{0x437a, 65},
-	{0x437b, 66},
-	{0x437c, 67},
-	{0x437d, 68},
-	{0x437e, 69},
-	{0x437f, 70},
-	{0x4380, 71},
-	{0x4381, 72},
-	{0x4382, 73},
-	{0x4383, 74},
-	{0x4384, 75},
-	{0x4385, 76},
-	{0x4386, 77},
-	{0x4387, 78},
-	{0x4388, 79},
-	{0x4389, 80},
-	{0x438a, 81},
-	{0x438b, 82},
-	{0x438c, 83},
-	{0x438d, 84},
-	{0x438e, 85},
-	{0x438f, 86},
-	{0x4390, 87},
-	{0x4391, 88},
-	{0x4392, 89},
-	{0x4393, 90},
-	{0x4394, 91},
-	{0x4395, 92},
-	{0x4396, 93},
-	{0x4397, 94},
-	{0x4398, 95},
-	{0x4399, 96},
-	{0x439a, 97},
-	{0x439b, 98},
-	{0x439c, 99},
-	{0x439d, 100},
-	{0x439e, 101},
-	{0x439f, 102},
-	{0x43a0, 103},
-	{0x43a1, 104},
-	{0x43a2, 105},
-	{0x43a3, 106},
-	{0x43a4, 107},
-	{0x43a5, 108},
-	{0x43a6, 109},
-	{0x43a7, 110},
-	{0x43a8, 111},
-	{0x43a9, 112},
-	{0x43aa, 113},
-	{0x43ab, 114},
-	{0x43ae, 0},
-	{0x43af, 1},
-	{0x43b0, 2},
-	{0x43b3, 0},
-	{0x43b4, 1},
-	{0x43b5, 2},
-	{0x43b6, 3},
-	{0x43b7, 4},
-	{0x43b8, 5},
-	{0x43b9, 6},
-	{0x43ba, 7},
-	{0x43bb, 8},
-	{0x43bc, 9},
-	{0x43bd, 10},
-	{0x43be, 11},
-	{0x43bf, 12},
-	{0x43c0, 13},
-	{0x43c1, 14},
-	{0x43c2, 15},
-	{0x43c3, 16},
-	{0x43c4, 17},
-	{0x43c5, 18},
-	{0x43c6, 19},
-	{0x43c7, 20},
-	{0x43c8, 21},
-	{0x43c9, 22},
-	{0x43ca, 23},
-	{0x43cb, 24},
-	{0x43cc, 25},
-	{0x43cd, 26},
-	{0x43ce, 27},
-	{0x43cf, 28},
-	{0x43d0, 29},
-	{0x43d1, 30},
-	{0x43d2, 31},
-	{0x43d3, 32},
-	{0x43d4, 33},
-	{0x43d5, 34},
-	{0x43d6, 35},
-	{0x43d7, 36},
-	{0x43d8, 37},
-	{0x43d9, 38},
-	{0x43da, 39},
-	{0x43db, 40},
-	{0x43dc, 41},
-	{0x43df, 0},
-	{0x43e0, 1},
-	{0x43e1, 2},
-	{0x43e2, 3},
-	{0x43e3, 4},
-	{0x43e4, 5},
-	{0x43e5, 6},
-	{0x43e6, 7},
-	{0x43e7, 8},
-	{0x43e8, 9},
-	{0x43e9, 10},
-	{0x43ea, 11},
-	{0x43eb, 12},
-	{0x43ec, 13},
-	{0x43ed, 14},
-	{0x43ee, 15},
-	{0x43ef, 16},
-	{0x43f0, 17},
-	{0x43f1, 18},
-	{0x43f2, 19},
-	{0x43f3, 20},
-	{0x43f4, 21},
-	{0x43f5, 22},
-	{0x43f6, 23},
-	{0x43f7, 24},
-	{0x43f8, 25},
-	{0x43f9, 26},
-	{0x43fa, 27},
-	{0x43fb, 28},
-	{0x43fc, 29},
-	{0x43fd, 30},
-	{0x43fe, 31},
-	{0x43ff, 32},
-	{0x4401, 0},
-	{0x4402, 1},
-	{0x4403, 2},
-	{0x4404, 3},
-	{0x4405, 4},
-	{0x4406, 5},
-	{0x4407, 6},
-	{0x4408, 7},
-	{0x4409, 8},
-	{0x440a, 9},
-	{0x440b, 10},
-	{0x440c, 11},
-	{0x440d, 12},
-	{0x440e, 13},
-	{0x440f, 14},
-	{0x4410, 15},
-	{0x4411, 16},
-	{0x4412, 17},
-	{0x4413, 18},
-	{0x4414, 19},
-	{0x4415, 20},
-	{0x4416, 21},
-	{0x4417, 22},
-	{0x4418, 23},
-	{0x4419, 24},
-	{0x441a, 25},
-	{0x441b, 26},
-	{0x441c, 27},
-	{0x441d, 28},
-	{0x441e, 29},
-	{0x441f, 30},
-	{0x4420, 31},
-	{0x4421, 32},
-	{0x4422, 33},
-	{0x4423, 34},
-	{0x4424, 35},
-	{0x4425, 36},
-	{0x4426, 37},
-	{0x4427, 38},
-	{0x4428, 39},
-	{0x4429, 40},
-	{0x442a, 41},
-	{0x442b, 42},
-	{0x442c, 43},
-	{0x442d, 44},
-	{0x442e, 45},
-	{0x442f, 46},
-	{0x4430, 47},
-	{0x4431, 48},
-	{0x4432, 49},
-	{0x4433, 50},
-	{0x4434, 51},
-	{0x4435, 52},
-	{0x4436, 53},
-	{0x4437, 54},
-	{0x4438, 55},
-	{0x4439, 56},
-	{0x443a, 57},
-	{0x443b, 58},
-	{0x443c, 59},
-	{0x443d, 60},
-	{0x443e, 61},
-	{0x443f, 62},
-	{0x4440, 63},
-	{0x4441, 64},
-	{0x4442, 65},
-	{0x4443, 66},
-	{0x4444, 67},
-	{0x4445, 68},
-	{0x4446, 69},
-	{0x4447, 70},
-	{0x4448, 71},
-	{0x4449, 72},
-	{0x444a, 73},
-	{0x444b, 74},
-	{0x444c, 75},
-	{0x444d, 76},
-	{0x444e, 77},
-	{0x444f, 78},
-	{0x4450, 79},
-	{0x4451, 80},
-	{0x4452, 81},
-	{0x4453, 82},
-	{0x4454, 83},
-	{0x4455, 84},
-	{0x4456, 85},
-	{0x4457, 86},
-	{0x4458, 87},
-	{0x4459, 88},
-	{0x445a, 89},
-	{0x445b, 90},
-	{0x445c, 91},
-	{0x445d, 92},
-	{0x445e, 93},
-	{0x445f, 94},
-	{0x4460, 95},
-	{0x4461, 96},
-	{0x4462, 97},
-	{0x4463, 98},
-	{0x4464, 99},
-	{0x4465, 100},
-	{0x4466, 101},
-	{0x4467, 102},
-	{0x4468, 103},
-	{0x4469, 104},
-	{0x446a, 105},
-	{0x446b, 106},
-	{0x446c, 107},
-	{0x446d, 108},
-	{0x446e, 109},
-	{0x446f, 110},
-	{0x4470, 111},
-	{0x4471, 112},
-	{0x4472, 113},
-	{0x4473, 114},
-	{0x4474, 115},
-	{0x4475, 116},
-	{0x4476, 117},
-	{0x4477, 118},
-	{0x4478, 119},
-	{0x4479, 120},
-	{0x447a, 121},
-	{0x447b, 122},
-	{0x447c, 123},
-	{0x447d, 124},
-	{0x447e, 125},
-	{0x447f, 126},
-	{0x4480, 127},
-	{0x4481, 128},
-	{0x4482, 129},
-	{0x4483, 130},
-	{0x4484, 131},
-	{0x4485, 132},
-	{0x4486, 133},
-	{0x4487, 134},
-	{0x4488, 135},
-	{0x4489, 136},
-	{0x448a, 137},
-	{0x448b, 138},
-	{0x448c, 139},
-	{0x448d, 140},
-	{0x448e, 141},
-	{0x448f, 142},
-	{0x4490, 143},
-	{0x4491, 144},
-	{0x4492, 145},
-	{0x4493, 146},
-	{0x4494, 147},
-	{0x4495, 148},
-	{0x4496, 149},
-	{0x4497, 150},
-	{0x4498, 151},
-	{0x4499, 152},
-	{0x449a, 153},
-	{0x449b, 154},
-	{0x449c, 155},
-	{0x449d, 156},
-	{0x449e, 157},
-	{0x449f, 158},
-	{0x44a0, 159},
-	{0x44a1, 160},
-	{0x44a2, 161},
-	{0x44a3, 162},
-	{0x44a4, 163},
-	{0x44a5, 164},
-	{0x44a6, 165},
-	{0x44a7, 166},
-	{0x44a8, 167},
-	{0x44a9, 168},
-	{0x44aa, 169},
-	{0x44ab, 170},
-	{0x44ac, 171},
-	{0x44ad, 172},
-	{0x44ae, 173},
-	{0x44af, 174},
-	{0x44b0, 175},
-	{0x44b1, 176},
-	{0x44b2, 177},
-	{0x44b3, 178},
-	{0x44b4, 179},
-	{0x44b5, 180},
-	{0x44b6, 181},
-	{0x44b7, 182},
-	{0x44b8, 183},
-	{0x44b9, 184},
-	{0x44ba, 185},
-	{0x44bb, 186},
-	{0x44bc, 187},
-	{0x44bd, 188},
-	{0x44be, 189},
-	{0x44bf, 190},
-	{0x44c0, 191},
-	{0x44c1, 192},
-	{0x44c2, 193},
-	{0x44c3, 194},
-	{0x44c4, 195},
-	{0x44c5, 196},
-	{0x44c6, 197},
-	{0x44c7, 198},
-	{0x44c8, 199},
-	{0x44c9, 200},
-	{0x44ca, 201},
-	{0x44cb, 202},
-	{0x44cc, 203},
-	{0x44cd, 204},
-	{0x44ce, 205},
-	{0x44cf, 206},
-	{0x44d0, 207},
-	{0x44d1, 208},
-	{0x44d2, 209},
-	{0x44d3, 210},
-	{0x44d4, 211},
-	{0x44d5, 212},
-	{0x44d8, 0},
-	{0x44d9, 1},
-	{0x44da, 2},
-	{0x44db, 3},
-	{0x44dc, 4},
-	{0x44dd, 5},
-	{0x44de, 6},
-	{0x44df, 7},
-	{0x44e0, 8},
-	{0x44e1, 9},
-	{0x44e2, 10},
-	{0x44e3, 11},
-	{0x44e4, 12},
-	{0x44e5, 13},
-	{0x44e6, 14},
-	{0x44e7, 15},
-	{0x44e8, 16},
-	{0x44e9, 17},
-	{0x44ea, 18},
-	{0x44eb, 19},
-	{0x44ec, 20},
-	{0x44ed, 21},
-	{0x44ee, 22},
-	{0x44ef, 23},
-	{0x44f0, 24},
-	{0x44f1, 25},
-	{0x44f2, 26},
-	{0x44f3, 27},
-	{0x44f4, 28},
-	{0x44f5, 29},
-	{0x44f6, 30},
-	{0x44f7, 31},
-	{0x44f8, 32},
-	{0x44f9, 33},
-	{0x44fa, 34},
-	{0x44fb, 35},
-	{0x44fc, 36},
-	{0x44fd, 37},
-	{0x44fe, 38},
-	{0x44ff, 39},
-	{0x4501, 0},
-	{0x4502, 1},
-	{0x4503, 2},
-	{0x4504, 3},
-	{0x4505, 4},
-	{0x4506, 5},
-	{0x4507, 6},
-	{0x4508, 7},
-	{0x4509, 8},
-	{0x450a, 9},
-	{0x450b, 10},
-	{0x450c, 11},
-	{0x450d, 12},
-	{0x450e, 13},
-	{0x450f, 14},
-	{0x4510, 15},
-	{0x4511, 16},
-	{0x4512, 17},
-	{0x4513, 18},
-	{0x4514, 19},
-	{0x4515, 20},
-	{0x4516, 21},
-	{0x4517, 22},
-	{0x4518, 23},
-	{0x4519, 24},
-	{0x451a, 25},
-	{0x451b, 26},
-	{0x451c, 27},
-	{0x451d, 28},
-	{0x451e, 29},
-	{0x451f, 30},
-	{0x4520, 31},
-	{0x4521, 32},
-	{0x4522, 33},
-	{0x4523, 34},
-	{0x4524, 35},
-	{0x4525, 36},
-	{0x4526, 37},
-	{0x4527, 38},
-	{0x4528, 39},
-	{0x4529, 40},
-	{0x452a, 41},
-	{0x452b, 42},
-	{0x452c, 43},
-	{0x452d, 44},
-	{0x452e, 45},
-	{0x452f, 46},
-	{0x4530, 47},
-	{0x4531, 48},
-	{0x4532, 49},
-	{0x4533, 50},
-	{0x4534, 51},
-	{0x4535, 52},
-	{0x4536, 53},
-	{0x4537, 54},
-	{0x4538, 55},
-	{0x4539, 56},
-	{0x453a, 57},
-	{0x453b, 58},
-	{0x453c, 59},
-	{0x453d, 60},
-	{0x453e, 61},
-	{0x453f, 62},
-	{0x4540, 63},
-	{0x4541, 64},
-	{0x4542, 65},
-	{0x4543, 66},
-	{0x4544, 67},
-	{0x4545, 68},
-	{0x4546, 69},
-	{0x4547, 70},
-	{0x4548, 71},
-	{0x4549, 72},
-	{0x454a, 73},
-	{0x454b, 74},
-	{0x454c, 75},
-	{0x454d, 76},
-	{0x454e, 77},
-	{0x454f, 78},
-	{0x4550, 79},
-	{0x4551, 80},
-	{0x4552, 81},
-	{0x4553, 82},
-	{0x4554, 83},
-	{0x4555, 84},
-	{0x4556, 85},
-	{0x4557, 86},
-	{0x4558, 87},
-	{0x4559, 88},
-	{0x455a, 89},
-	{0x455b, 90},
-	{0x455c, 91},
-	{0x455d, 92},
-	{0x455e, 93},
-	{0x455f, 94},
-	{0x4560, 95},
-	{0x4561, 96},
-	{0x4562, 97},
-	{0x4563, 98},
-	{0x4564, 99},
-	{0x4565, 100},
-	{0x4566, 101},
-	{0x4567, 102},
-	{0x4568, 103},
-	{0x4569, 104},
-	{0x456a, 105},
-	{0x456b, 106},
-	{0x456c, 107},
-	{0x456d, 108},
-	{0x456e, 109},
-	{0x456f, 110},
-	{0x4570, 111},
-	{0x4571, 112},
-	{0x4572, 113},
-	{0x4573, 114},
-	{0x4574, 115},
-	{0x4575, 116},
-	{0x4576, 117},
-	{0x4577, 118},
-	{0x4578, 119},
-	{0x4579, 120},
-	{0x457a, 121},
-	{0x457b, 122},
-	{0x457c, 123},
-	{0x457d, 124},
-	{0x457e, 125},
-	{0x457f, 126},
-	{0x4580, 127},
-	{0x4581, 128},
-	{0x4582, 129},
-	{0x4583, 130},
-	{0x4584, 131},
-	{0x4585, 132},
-	{0x4586, 133},
-	{0x4587, 134},
-	{0x4588, 135},
-	{0x4589, 136},
-	{0x458a, 137},
-	{0x458b, 138},
-	{0x458c, 139},
-	{0x458d, 140},
-	{0x458e, 141},
-	{0x458f, 142},
-	{0x4590, 143},
-	{0x4591, 144},
-	{0x4592, 145},
-	{0x4593, 146},
-	{0x4594, 147},
-	{0x4595, 148},
-	{0x4596, 149},
-	{0x4597, 150},
-	{0x4598, 151},
-	{0x4599, 152},
-	{0x459a, 153},
-	{0x459b, 154},
-	{0x459c, 155},
-	{0x459d, 156},
-	{0x459e, 157},
-	{0x459f, 158},
-	{0x45a0, 159},
-	{0x45a1, 160},
-	{0x45a2, 161},
-	{0x45a3, 162},
-	{0x45a4, 163},
-	{0x45a5, 164},
-	{0x45a6, 165},
-	{0x45a7, 166},
-	{0x45a8, 167},
-	{0x45a9, 168},
-	{0x45aa, 169},
-	{0x45ab, 170},
-	{0x45ac, 171},
-	{0x45ad, 172},
-	{0x45ae, 173},
-	{0x45af, 174},
-	{0x45b0, 175},
-	{0x45b1, 176},
-	{0x45b2, 177},
-	{0x45b3, 178},
-	{0x45b4, 179},
-	{0x45b5, 180},
-	{0x45b6, 181},
-	{0x45b7, 182},
-	{0x45b8, 183},
-	{0x45b9, 184},
-	{0x45ba, 185},
-	{0x45bb, 186},
-	{0x45bc, 187},
-	{0x45bd, 188},
-	{0x45be, 189},
-	{0x45bf, 190},
-	{0x45c0, 191},
-	{0x45c1, 192},
-	{0x45c2, 193},
-	{0x45c3, 194},
-	{0x45c4, 195},
-	{0x45c5, 196},
-	{0x45c6, 197},
-	{0x45c7, 198},
-	{0x45c8, 199},
-	{0x45c9, 200},
-	{0x45ca, 201},
-	{0x45cb, 202},
-	{0x45cc, 203},
-	{0x45cd, 204},
-	{0x45ce, 205},
-	{0x45cf, 206},
-	{0x45d0, 207},
-	{0x45d1, 208},
-	{0x45d2, 209},
-	{0x45d3, 210},
-	{0x45d4, 211},
-	{0x45d5, 212},
-	{0x45d6, 213},
-	{0x45d7, 214},
-	{0x45d8, 215},
-	{0x45d9, 216},
-	{0x45da, 217},
-	{0x45db, 218},
-	{0x45dc, 219},
-	{0x45dd, 220},
-	{0x45de, 221},
-	{0x45df, 222},
-	{0x45e0, 223},
-	{0x45e1, 224},
-	{0x45e2, 225},
-	{0x45e3, 226},
-	{0x45e4, 227},
-	{0x45e5, 228},
-	{0x45e6, 229},
-	{0x45e7, 230},
-	{0x45e8, 231},
-	{0x45e9, 232},
-	{0x45ea, 233},
-	{0x45eb, 234},
-	{0x45ec, 235},
-	{0x45ed, 236},
-	{0x45ee, 237},
-	{0x45ef, 238},
-	{0x45f0, 239},
-	{0x45f1, 240},
-	{0x45f2, 241},
-	{0x45f3, 242},
-	{0x45f4, 243},
-	{0x45f5, 244},
-	{0x45f6, 245},
-	{0x45f7, 246},
-	{0x45f8, 247},
-	{0x45f9, 248},
-	{0x45fa, 249},
-	{0x45fb, 250},
-	{0x45fc, 251},
-	{0x45fd, 252},
-	{0x45fe, 253},
-	{0x45ff, 254},
-	{0x4601, 0},
-	{0x4602, 1},
-	{0x4603, 2},
-	{0x4604, 3},
-	{0x4605, 4},
-	{0x4606, 5},
-	{0x4607, 6},
-	{0x4608, 7},
-	{0x4609, 8},
-	{0x460a, 9},
-	{0x460b, 10},
-	{0x460c, 11},
-	{0x460d, 12},
-	{0x460e, 13},
-	{0x460f, 14},
-	{0x4610, 15},
-	{0x4611, 16},
-	{0x4612, 17},
-	{0x4613, 18},
-	{0x4614, 19},
-	{0x4615, 20},
-	{0x4616, 21},
-	{0x4617, 22},
-	{0x4618, 23},
-	{0x4619, 24},
-	{0x461a, 25},
-	{0x461b, 26},
-	{0x461c, 27},
-	{0x461d, 28},
-	{0x461e, 29},
-	{0x461f, 30},
-	{0x4620, 31},
-	{0x4621, 32},
-	{0x4622, 33},
-	{0x4623, 34},
-	{0x4624, 35},
-	{0x4625, 36},
-	{0x4626, 37},
-	{0x4627, 38},
-	{0x4628, 39},
-	{0x4629, 40},
-	{0x462a, 41},
-	{0x462b, 42},
-	{0x462c, 43},
-	{0x462d, 44},
-	{0x462e, 45},
-	{0x462f, 46},
-	{0x4630, 47},
-	{0x4631, 48},
-	{0x4632, 49},
-	{0x4633, 50},
-	{0x4634, 51},
-	{0x4635, 52},
-	{0x4636, 53},
-	{0x4637, 54},
-	{0x4638, 55},
-	{0x4639, 56},
-	{0x463a, 57},
-	{0x463b, 58},
-	{0x463c, 59},
-	{0x463d, 60},
-	{0x463e, 61},
-	{0x463f, 62},
-	{0x4640, 63},
-	{0x4641, 64},
-	{0x4642, 65},
-	{0x4643, 66},
-	{0x4644, 67},
-	{0x4645, 68},
-	{0x4646, 69},
-	{0x4647, 70},
-	{0x4648, 71},
-	{0x4649, 72},
-	{0x464a, 73},
-	{0x464b, 74},
-	{0x464e, 0},
-	{0x464f, 1},
-	{0x4650, 2},
-	{0x4651, 3},
-	{0x4652, 4},
-	{0x4653, 5},
-	{0x4654, 6},
-	{0x4655, 7},
-	{0x4656, 8},
-	{0x4657, 9},
-	{0x4658, 10},
-	{0x4659, 11},
-	{0x465a, 12},
-	{0x465b, 13},
-	{0x465c, 14},
-	{0x465d, 15},
-	{0x465e, 16},
-	{0x465f, 17},
-	{0x4660, 18},
-	{0x4663, 0},
-	{0x4664, 1},
-	{0x4665, 2},
-	{0x4666, 3},
-	{0x4667, 4},
-	{0x4668, 5},
-	{0x4669, 6},
-	{0x466a, 7},
-	{0x466b, 8},
-	{0x466c, 9},
-	{0x466d, 10},
-	{0x466e, 11},
-	{0x466f, 12},
-	{0x4670, 13},
-	{0x4671, 14},
-	{0x4672, 15},
-	{0x4673, 16},
-	{0x4674, 17},
-	{0x4675, 18},
-	{0x4676, 19},
-	{0x4677, 20},
-	{0x4678, 21},
-	{0x4679, 22},
-	{0x467a, 23},
-	{0x467b, 24},
-	{0x467c, 25},
-	{0x467d, 26},
-	{0x467e, 27},
-	{0x467f, 28},
-	{0x4680, 29},
-	{0x4681, 30},
-	{0x4682, 31},
-	{0x4683, 32},
-	{0x4684, 33},
-	{0x4685, 34},
-	{0x4686, 35},
-	{0x4687, 36},
-	{0x4688, 37},
-	{0x4689, 38},
-	{0x468a, 39},
-	{0x468b, 40},
-	{0x468c, 41},
-	{0x468d, 42},
-	{0x468e, 43},
-	{0x468f, 44},
-	{0x4690, 45},
-	{0x4691, 46},
-	{0x4692, 47},
-	{0x4693, 48},
-	{0x4694, 49},
-	{0x4695, 50},
-	{0x4696, 51},
-	{0x4697, 52},
-	{0x4698, 53},
-	{0x4699, 54},
-	{0x469a, 55},
-	{0x469b, 56},
-	{0x469c, 57},
-	{0x469d, 58},
-	{0x469e, 59},
-	{0x469f, 60},
-	{0x46a0, 61},
-	{0x46a1, 62},
-	{0x46a2, 63},
-	{0x46a3, 64},
-	{0x46a4, 65},
-	{0x46a5, 66},
-	{0x46a6, 67},
-	{0x46a7, 68},
-	{0x46a8, 69},
-	{0x46a9, 70},
-	{0x46aa, 71},
-	{0x46ab, 72},
-	{0x46ac, 73},
-	{0x46ad, 74},
-	{0x46ae, 75},
-	{0x46af, 76},
-	{0x46b0, 77},
-	{0x46b1, 78},
-	{0x46b2, 79},
-	{0x46b3, 80},
-	{0x46b4, 81},
-	{0x46b5, 82},
-	{0x46b6, 83},
-	{0x46b7, 84},
-	{0x46b8, 85},
-	{0x46b9, 86},
-	{0x46ba, 87},
-	{0x46bb, 88},
-	{0x46bc, 89},
-	{0x46bd, 90},
-	{0x46be, 91},
-	{0x46bf, 92},
-	{0x46c0, 93},
-	{0x46c1, 94},
-	{0x46c2, 95},
-	{0x46c3, 96},
-	{0x46c4, 97},
-	{0x46c5, 98},
-	{0x46c6, 99},
-	{0x46c7, 100},
-	{0x46c8, 101},
-	{0x46c9, 102},
-	{0x46ca, 103},
-	{0x46cb, 104},
-	{0x46cc, 105},
-	{0x46cd, 106},
-	{0x46ce, 107},
-	{0x46cf, 108},
-	{0x46d0, 109},
-	{0x46d1, 110},
-	{0x46d2, 111},
-	{0x46d3, 112},
-	{0x46d4, 113},
-	{0x46d5, 114},
-	{0x46d6, 115},
-	{0x46d7, 116},
-	{0x46d8, 117},
-	{0x46d9, 118},
-	{0x46da, 119},
-	{0x46db, 120},
-	{0x46dc, 121},
-	{0x46dd, 122},
-	{0x46de, 123},
-	{0x46df, 124},
-	{0x46e0, 125},
-	{0x46e1, 126},
-	{0x46e2, 127},
-	{0x46e3, 128},
-	{0x46e4, 129},
-	{0x46e5, 130},
-	{0x46e6, 131},
-	{0x46e7, 132},
-	{0x46e8, 133},
-	{0x46e9, 134},
-	{0x46ea, 135},
-	{0x46eb, 136},
-	{0x46ec, 137},
-	{0x46ed, 138},
-	{0x46ee, 139},
-	{0x46ef, 140},
-	{0x46f0, 141},
-	{0x46f1, 142},
-	{0x46f2, 143},
-	{0x46f3, 144},
-	{0x46f4, 145},
-	{0x46f5, 146},
-	{0x46f6, 147},
-	{0x46f7, 148},
-	{0x46f8, 149},
-	{0x46f9, 150},
-	{0x46fa, 151},
-	{0x46fb, 152},
-	{0x46fc, 153},
-	{0x46fd, 154},
-	{0x46fe, 155},
-	{0x46ff, 156},
-	{0x4701, 0},
-	{0x4702, 1},
-	{0x4703, 2},
-	{0x4704, 3},
-	{0x4705, 4},
-	{0x4706, 5},
-	{0x4707, 6},
-	{0x4708, 7},
-	{0x4709, 8},
-	{0x470a, 9},
-	{0x470b, 10},
-	{0x470c, 11},
-	{0x470d, 12},
-	{0x470e, 13},
-	{0x470f, 14},
-	{0x4710, 15},
-	{0x4711, 16},
-	{0x4712, 17},
-	{0x4713, 18},
-	{0x4714, 19},
-	{0x4715, 20},
-	{0x4716, 21},
-	{0x4717, 22},
-	{0x4718, 23},
-	{0x4719, 24},
-	{0x471a, 25},
-	{0x471b, 26},
-	{0x471c, 27},
-	{0x471d, 28},
-	{0x471e, 29},
-	{0x471f, 30},
-	{0x4720, 31},
-	{0x4721, 32},
-	{0x4722, 33},
-	{0x4725, 0},
-	{0x4726, 1},
-	{0x4727, 2},
-	{0x4728, 3},
-	{0x472b, 0},
-	{0x472c, 1},
-	{0x472d, 2},
-	{0x472e, 3},
-	{0x472f, 4},
-	{0x4730, 5},
-	{0x4731, 6},
-	{0x4732, 7},
-	{0x4733, 8},
-	{0x4734, 9},
-	{0x4735, 10},
-	{0x4736, 11},
-	{0x4737, 12},
-	{0x4738, 13},
-	{0x4739, 14},
-	{0x473a, 15},
-	{0x473b, 16},
-	{0x473c, 17},
-	{0x473d, 18},
-	{0x473e, 19},
-	{0x473f, 20},
-	{0x4740, 21},
-	{0x4741, 22},
-	{0x4742, 23},
-	{0x4743, 24},
-	{0x4744, 25},
-	{0x4745, 26},
-	{0x4746, 27},
-	{0x4747, 28},
-	{0x4748, 29},
-	{0x4749, 30},
-	{0x474a, 31},
-	{0x474b, 32},
-	{0x474c, 33},
-	{0x474d, 34},
-	{0x474e, 35},
-	{0x474f, 36},
-	{0x4750, 37},
-	{0x4751, 38},
-	{0x4752, 39},
-	{0x4753, 40},
-	{0x4754, 41},
-	{0x4755, 42},
-	{0x4756, 43},
-	{0x4757, 44},
-	{0x4758, 45},
-	{0x4759, 46},
-	{0x475a, 47},
-	{0x475b, 48},
-	{0x475c, 49},
-	{0x475d, 50},
-	{0x475e, 51},
-	{0x475f, 52},
-	{0x4760, 53},
-	{0x4761, 54},
-	{0x4762, 55},
-	{0x4763, 56},
-	{0x4764, 57},
-	{0x4765, 58},
-	{0x4766, 59},
-	{0x4767, 60},
-	{0x4768, 61},
-	{0x4769, 62},
-	{0x476a, 63},
-	{0x476b, 64},
-	{0x476c, 65},
-	{0x476d, 66},
-	{0x476e, 67},
-	{0x476f, 68},
-	{0x4770, 69},
-	{0x4771, 70},
-	{0x4772, 71},
-	{0x4773, 72},
-	{0x4774, 73},
-	{0x4775, 74},
-	{0x4776, 75},
-	{0x4777, 76},
-	{0x4778, 77},
-	{0x4779, 78},
-	{0x477a, 79},
-	{0x477b, 80},
-	{0x477e, 0},
-	{0x477f, 1},
-	{0x4780, 2},
-	{0x4781, 3},
-	{0x4782, 4},
-	{0x4783, 5},
-	{0x4784, 6},
-	{0x4785, 7},
-	{0x4786, 8},
-	{0x4787, 9},
-	{0x4788, 10},
-	{0x4789, 11},
-	{0x478a, 12},
-	{0x478b, 13},
-	{0x478c, 14},
-	{0x478f, 0},
-	{0x4790, 1},
-	{0x4791, 2},
-	{0x4792, 3},
-	{0x4793, 4},
-	{0x4794, 5},
-	{0x4795, 6},
-	{0x4796, 7},
-	{0x4797, 8},
-	{0x4798, 9},
-	{0x4799, 10},
-	{0x479a, 11},
-	{0x479b, 12},
-	{0x479c, 13},
-	{0x479d, 14},
-	{0x479e, 15},
-	{0x479f, 16},
-	{0x47a0, 17},
-	{0x47a1, 18},
-	{0x47a2, 19},
-	{0x47a3, 20},
-	{0x47a4, 21},
-	{0x47a5, 22},
-	{0x47a6, 23},
-	{0x47a7, 24},
-	{0x47a8, 25},
-	{0x47a9, 26},
-	{0x47aa, 27},
-	{0x47ab, 28},
-	{0x47ac, 29},
-	{0x47ad, 30},
-	{0x47ae, 31},
-	{0x47af, 32},
-	{0x47b0, 33},
-	{0x47b1, 34},
-	{0x47b2, 35},
-	{0x47b3, 36},
-	{0x47b4, 37},
-	{0x47b5, 38},
-	{0x47b6, 39},
-	{0x47b7, 40},
-	{0x47b8, 41},
-	{0x47b9, 42},
-	{0x47ba, 43},
-	{0x47bb, 44},
-	{0x47bc, 45},
-	{0x47bd, 46},
-	{0x47be, 47},
-	{0x47bf, 48},
-	{0x47c0, 49},
-	{0x47c1, 50},
-	{0x47c2, 51},
-	{0x47c3, 52},
-	{0x47c4, 53},
-	{0x47c5, 54},
-	{0x47c6, 55},
-	{0x47c7, 56},
-	{0x47c8, 57},
-	{0x47c9, 58},
-	{0x47ca, 59},
-	{0x47cb, 60},
-	{0x47cc, 61},
-	{0x47cd, 62},
-	{0x47ce, 63},
-	{0x47cf, 64},
-	{0x47d0, 65},
-	{0x47d1, 66},
-	{0x47d2, 67},
-	{0x47d3, 68},
-	{0x47d4, 69},
-	{0x47d5, 70},
-	{0x47d6, 71},
-	{0x47d7, 72},
-	{0x47d8, 73},
-	{0x47d9, 74},
-	{0x47da, 75},
-	{0x47db, 76},
-	{0x47dc, 77},
-	{0x47dd, 78},
-	{0x47de, 79},
-	{0x47df, 80},
-	{0x47e0, 81},
-	{0x47e1, 82},
-	{0x47e2, 83},
-	{0x47e3, 84},
-	{0x47e4, 85},
-	{0x47e5, 86},
-	{0x47e6, 87},
-	{0x47e7, 88},
-	{0x47e8, 89},
-	{0x47e9, 90},
-	{0x47ea, 91},
-	{0x47eb, 92},
-	{0x47ec, 93},
-	{0x47ed, 94},
-	{0x47ee, 95},
-	{0x47ef, 96},
-	{0x47f0, 97},
-	{0x47f1, 98},
-	{0x47f2, 99},
-	{0x47f3, 100},
-	{0x47f4, 101},
-	{0x47f5, 102},
-	{0x47f6, 103},
-	{0x47f7, 104},
-	{0x47f8, 105},
-	{0x47f9, 106},
-	{0x47fa, 107},
-	{0x47fb, 108},
-	{0x47fc, 109},
-	{0x47fd, 110},
-	{0x47fe, 111},
-	{0x47ff, 112},
-	{0x4801, 0},
-	{0x4802, 1},
-	{0x4803, 2},
-	{0x4804, 3},
-	{0x4805, 4},
-	{0x4806, 5},
-	{0x4807, 6},
-	{0x4808, 7},
-	{0x4809, 8},
-	{0x480a, 9},
-	{0x480b, 10},
-	{0x480c, 11},
-	{0x480d, 12},
-	{0x480e, 13},
-	{0x480f, 14},
-	{0x4810, 15},
-	{0x4811, 16},
-	{0x4812, 17},
-	{0x4813, 18},
-	{0x4814, 19},
-	{0x4815, 20},
-	{0x4816, 21},
-	{0x4817, 22},
-	{0x4818, 23},
-	{0x4819, 24},
-	{0x481a, 25},
-	{0x481b, 26},
-	{0x481c, 27},
-	{0x481d, 28},
-	{0x481e, 29},
-	{0x481f, 30},
-	{0x4820, 31},
-	{0x4821, 32},
-	{0x4822, 33},
-	{0x4823, 34},
-	{0x4824, 35},
-	{0x4825, 36},
-	{0x4826, 37},
-	{0x4827, 38},
-	{0x4828, 39},
-	{0x4829, 40},
-	{0x482a, 41},
-	{0x482b, 42},
-	{0x482c, 43},
-	{0x482d, 44},
-	{0x482e, 45},
-	{0x482f, 46},
-	{0x4830, 47},
-	{0x4831, 48},
-	{0x4832, 49},
-	{0x4833, 50},
-	{0x4834, 51},
-	{0x4835, 52},
-	{0x4836, 53},
-	{0x4837, 54},
-	{0x4838, 55},
-	{0x4839, 56},
-	{0x483a, 57},
-	{0x483b, 58},
-	{0x483c, 59},
-	{0x483d, 60},
-	{0x483e, 61},
-	{0x483f, 62},
-	{0x4840, 63},
-	{0x4841, 64},
-	{0x4842, 65},
-	{0x4843, 66},
-	{0x4844, 67},
-	{0x4845, 68},
-	{0x4846, 69},
-	{0x4847, 70},
-	{0x4848, 71},
-	{0x4849, 72},
-	{0x484a, 73},
-	{0x484b, 74},
-	{0x484c, 75},
-	{0x484d, 76},
-	{0x484e, 77},
-	{0x484f, 78},
-	{0x4850, 79},
-	{0x4851, 80},
-	{0x4852, 81},
-	{0x4853, 82},
-	{0x4854, 83},
-	{0x4855, 84},
-	{0x4856, 85},
-	{0x4857, 86},
-	{0x4858, 87},
-	{0x4859, 88},
-	{0x485a, 89},
-	{0x485b, 90},
-	{0x485c, 91},
-	{0x485d, 92},
-	{0x485e, 93},
-	{0x485f, 94},
-	{0x4860, 95},
-	{0x4861, 96},
-	{0x4862, 97},
-	{0x4863, 98},
-	{0x4864, 99},
-	{0x4865, 100},
-	{0x4866, 101},
-	{0x4867, 102},
-	{0x4868, 103},
-	{0x4869, 104},
-	{0x486a, 105},
-	{0x486b, 106},
-	{0x486c, 107},
-	{0x486d, 108},
-	{0x486e, 109},
-	{0x486f, 110},
-	{0x4870, 111},
-	{0x4871, 112},
-	{0x4872, 113},
-	{0x4873, 114},
-	{0x4874, 115},
-	{0x4875, 116},
-	{0x4876, 117},
-	{0x4877, 118},
-	{0x4878, 119},
-	{0x4879, 120},
-	{0x487a, 121},
-	{0x487b, 122},
-	{0x487c, 123},
-	{0x487d, 124},
-	{0x487e, 125},
-	{0x487f, 126},
-	{0x4880, 127},
-	{0x4881, 128},
-	{0x4882, 129},
-	{0x4883, 130},
-	{0x4884, 131},
-	{0x4885, 132},
-	{0x4886, 133},
-	{0x4887, 134},
-	{0x4888, 135},
-	{0x4889, 136},
-	{0x488a, 137},
-	{0x488b, 138},
-	{0x488c, 139},
-	{0x488d, 140},
-	{0x488e, 141},
-	{0x488f, 142},
-	{0x4890, 143},
-	{0x4891, 144},
-	{0x4892, 145},
-	{0x4893, 146},
-	{0x4894, 147},
-	{0x4895, 148},
-	{0x4896, 149},
-	{0x4897, 150},
-	{0x4898, 151},
-	{0x4899, 152},
-	{0x489a, 153},
-	{0x489b, 154},
-	{0x489c, 155},
-	{0x489d, 156},
-	{0x489e, 157},
-	{0x489f, 158},
-	{0x48a0, 159},
-	{0x48a1, 160},
-	{0x48a2, 161},
-	{0x48a3, 162},
-	{0x48a4, 163},
-	{0x48a5, 164},
-	{0x48a6, 165},
-	{0x48a7, 166},
-	{0x48a8, 167},
-	{0x48a9, 168},
-	{0x48aa, 169},
-	{0x48ab, 170},
-	{0x48ac, 171},
-	{0x48ad, 172},
-	{0x48ae, 173},
-	{0x48af, 174},
-	{0x48b0, 175},
-	{0x48b1, 176},
-	{0x48b2, 177},
-	{0x48b3, 178},
-	{0x48b4, 179},
-	{0x48b5, 180},
-	{0x48b6, 181},
-	{0x48b7, 182},
-	{0x48b8, 183},
-	{0x48b9, 184},
-	{0x48ba, 185},
-	{0x48bb, 186},
-	{0x48bc, 187},
-	{0x48bd, 188},
-	{0x48be, 189},
-	{0x48bf, 190},
-	{0x48c0, 191},
-	{0x48c1, 192},
-	{0x48c2, 193},
-	{0x48c3, 194},
-	{0x48c4, 195},
-	{0x48c5, 196},
-	{0x48c6, 197},
-	{0x48c7, 198},
-	{0x48c8, 199},
-	{0x48c9, 200},
-	{0x48ca, 201},
-	{0x48cb, 202},
-	{0x48cc, 203},
-	{0x48cd, 204},
-	{0x48ce, 205},
-	{0x48cf, 206},
-	{0x48d0, 207},
-	{0x48d1, 208},
-	{0x48d2, 209},
-	{0x48d3, 210},
-	{0x48d4, 211},
-	{0x48d5, 212},
-	{0x48d6, 213},
-	{0x48d7, 214},
-	{0x48d8, 215},
-	{0x48d9, 216},
-	{0x48da, 217},
-	{0x48db, 218},
-	{0x48dc, 219},
-	{0x48dd, 220},
-	{0x48de, 221},
-	{0x48df, 222},
-	{0x48e0, 223},
-	{0x48e1, 224},
-	{0x48e2, 225},
-	{0x48e3, 226},
-	{0x48e4, 227},
-	{0x48e5, 228},
-	{0x48e6, 229},
-	{0x48e7, 230},
-	{0x48e8, 231},
-	{0x48e9, 232},
-	{0x48ea, 233},
-	{0x48eb, 234},
-	{0x48ec, 235},
-	{0x48ed, 236},
-	{0x48ee, 237},
-	{0x48ef, 238},
-	{0x48f0, 239},
-	{0x48f1, 240},
-	{0x48f2, 241},
-	{0x48f3, 242},
-	{0x48f4, 243},
-	{0x48f5, 244},
-	{0x48f6, 245},
-	{0x48f7, 246},
-	{0x48f8, 247},
-	{0x48f9, 248},
-	{0x48fa, 249},
-	{0x48fb, 250},
-	{0x48fc, 251},
-	{0x48fd, 252},
-	{0x48fe, 253},
-	{0x48ff, 254},
-	{0x4901, 0},
-	{0x4902, 1},
-	{0x4903, 2},
-	{0x4904, 3},
-	{0x4905, 4},
-	{0x4906, 5},
-	{0x4907, 6},
-	{0x4908, 7},
-	{0x4909, 8},
-	{0x490a, 9},
-	{0x490b, 10},
-	{0x490c, 11},
-	{0x490d, 12},
-	{0x490e, 13},
-	{0x490f, 14},
-	{0x4910, 15},
-	{0x4911, 16},
-	{0x4912, 17},
-	{0x4913, 18},
-	{0x4914, 19},
-	{0x4915, 20},
-	{0x4916, 21},
-	{0x4917, 22},
-	{0x4918, 23},
-	{0x4919, 24},
-	{0x491a, 25},
-	{0x491b, 26},
-	{0x491c, 27},
-	{0x491d, 28},
-	{0x491e, 29},
-	{0x491f, 30},
-	{0x4920, 31},
-	{0x4921, 32},
-	{0x4922, 33},
-	{0x4923, 34},
-	{0x4924, 35},
-	{0x4925, 36},
-	{0x4926, 37},
-	{0x4927, 38},
-	{0x4928, 39},
-	{0x4929, 40},
-	{0x492a, 41},
-	{0x492b, 42},
-	{0x492c, 43},
-	{0x492d, 44},
-	{0x492e, 45},
-	{0x492f, 46},
-	{0x4930, 47},
-	{0x4931, 48},
-	{0x4932, 49},
-	{0x4933, 50},
-	{0x4934, 51},
-	{0x4935, 52},
-	{0x4936, 53},
-	{0x4937, 54},
-	{0x4938, 55},
-	{0x4939, 56},
-	{0x493a, 57},
-	{0x493b, 58},
-	{0x493c, 59},
-	{0x493d, 60},
-	{0x493e, 61},
-	{0x493f, 62},
-	{0x4940, 63},
-	{0x4941, 64},
-	{0x4942, 65},
-	{0x4943, 66},
-	{0x4944, 67},
-	{0x4945, 68},
-	{0x4946, 69},
-	{0x4949, 0},
-	{0x494a, 1},
-	{0x494b, 2},
-	{0x494c, 3},
-	{0x494d, 4},
-	{0x494e, 5},
-	{0x494f, 6},
-	{0x4950, 7},
-	{0x4951, 8},
-	{0x4952, 9},
-	{0x4953, 10},
-	{0x4954, 11},
-	{0x4955, 12},
-	{0x4956, 13},
-	{0x4957, 14},
-	{0x4958, 15},
-	{0x4959, 16},
-	{0x495a, 17},
-	{0x495b, 18},
-	{0x495c, 19},
-	{0x495d, 20},
-	{0x495e, 21},
-	{0x495f, 22},
-	{0x4960, 23},
-	{0x4961, 24},
-	{0x4962, 25},
-	{0x4963, 26},
-	{0x4964, 27},
-	{0x4965, 28},
-	{0x4966, 29},
-	{0x4967, 30},
-	{0x4968, 31},
-	{0x4969, 32},
-	{0x496a, 33},
-	{0x496b, 34},
-	{0x496c, 35},
-	{0x496d, 36},
-	{0x496e, 37},
-	{0x496f, 38},
-	{0x4970, 39},
-	{0x4971, 40},
-	{0x4972, 41},
-	{0x4973, 42},
-	{0x4974, 43},
-	{0x4975, 44},
-	{0x4976, 45},
-	{0x4977, 46},
-	{0x4978, 47},
-	{0x4979, 48},
-	{0x497c, 0},
-	{0x497f, 0},
-	{0x4980, 1},
-	{0x4981, 2},
-	{0x4983, 0},
-	{0x4986, 0},
-	{0x4988, 0},
-	{0x4989, 1},
-	{0x498a, 2},
-	{0x498b, 3},
-	{0x498c, 4},
-	{0x498d, 5},
-	{0x498e, 6},
-	{0x498f, 7},
-	{0x4990, 8},
-	{0x4991, 9},
-	{0x4992, 10},
-	{0x4993, 11},
-	{0x4994, 12},
-	{0x4995, 13},
-	{0x4996, 14},
-	{0x4997, 15},
-	{0x4998, 16},
-	{0x4999, 17},
-	{0x499a, 18},
-	{0x499d, 0},
-	{0x499e, 1},
-	{0x49a1, 0},
-	{0x49a2, 1},
-	{0x49a3, 2},
-	{0x49a4, 3},
-	{0x49a5, 4},
-	{0x49a6, 5},
-	{0x49a7, 6},
-	{0x49a8, 7},
-	{0x49a9, 8},
-	{0x49aa, 9},
-	{0x49ab, 10},
-	{0x49ac, 11},
-	{0x49ad, 12},
-	{0x49ae, 13},
-	{0x49af, 14},
-	{0x49b0, 15},
-	{0x49b1, 16},
-	{0x49b2, 17},
-	{0x49b3, 18},
-	{0x49b4, 19},
-	{0x49b5, 20},
-	{0x49b9, 0},
-	{0x49ba, 1},
-	{0x49bb, 2},
-	{0x49bc, 3},
-	{0x49bd, 4},
-	{0x49be, 5},
-	{0x49bf, 6},
-	{0x49c0, 7},
-	{0x49c1, 8},
-	{0x49c2, 9},
-	{0x49c3, 10},
-	{0x49c4, 11},
-	{0x49c5, 12},
-	{0x49c6, 13},
-	{0x49c7, 14},
-	{0x49c8, 15},
-	{0x49c9, 16},
-	{0x49ca, 17},
-	{0x49cb, 18},
-	{0x49cc, 19},
-	{0x49cd, 20},
-	{0x49ce, 21},
-	{0x49cf, 22},
-	{0x49d0, 23},
-	{0x49d1, 24},
-	{0x49d2, 25},
-	{0x49d3, 26},
-	{0x49d4, 27},
-	{0x49d5, 28},
-	{0x49d6, 29},
-	{0x49d7, 30},
-	{0x49d8, 31},
-	{0x49d9, 32},
-	{0x49da, 33},
-	{0x49db, 34},
-	{0x49dc, 35},
-	{0x49dd, 36},
-	{0x49de, 37},
-	{0x49df, 38},
-	{0x49e0, 39},
-	{0x49e1, 40},
-	{0x49e2, 41},
-	{0x49e3, 42},
-	{0x49e4, 43},
-	{0x49e5, 44},
-	{0x49e6, 45},
-	{0x49e7, 46},
-	{0x49e8, 47},
-	{0x49e9, 48},
-	{0x49ea, 49},
-	{0x49eb, 50},
-	{0x49ec, 51},
-	{0x49ed, 52},
-	{0x49ee, 53},
-	{0x49ef, 54},
-	{0x49f0, 55},
-	{0x49f1, 56},
-	{0x49f2, 57},
-	{0x49f3, 58},
-	{0x49f4, 59},
-	{0x49f5, 60},
-	{0x49f6, 61},
-	{0x49f7, 62},
-	{0x49f8, 63},
-	{0x49f9, 64},
-	{0x49fa, 65},
-	{0x49fb, 66},
-	{0x49fc, 67},
-	{0x49fd, 68},
-	{0x49fe, 69},
-	{0x49ff, 70},
-	{0x4a01, 0},
-	{0x4a02, 1},
-	{0x4a03, 2},
-	{0x4a04, 3},
-	{0x4a05, 4},
-	{0x4a06, 5},
-	{0x4a07, 6},
-	{0x4a08, 7},
-	{0x4a09, 8},
-	{0x4a0a, 9},
-	{0x4a0b, 10},
-	{0x4a0c, 11},
-	{0x4a0d, 12},
-	{0x4a0e, 13},
-	{0x4a0f, 14},
-	{0x4a10, 15},
-	{0x4a11, 16},
-	{0x4a12, 17},
-	{0x4a13, 18},
-	{0x4a14, 19},
-	{0x4a15, 20},
-	{0x4a16, 21},
-	{0x4a17, 22},
-	{0x4a18, 23},
-	{0x4a19, 24},
-	{0x4a1a, 25},
-	{0x4a1b, 26},
-	{0x4a1c, 27},
-	{0x4a1d, 28},
-	{0x4a1e, 29},
-	{0x4a1f, 30},
-	{0x4a20, 31},
-	{0x4a21, 32},
-	{0x4a22, 33},
-	{0x4a23, 34},
-	{0x4a24, 35},
-	{0x4a25, 36},
-	{0x4a26, 37},
-	{0x4a27, 38},
-	{0x4a28, 39},
-	{0x4a29, 40},
-	{0x4a2a, 41},
-	{0x4a2b, 42},
-	{0x4a2c, 43},
-	{0x4a2d, 44},
-	{0x4a2e, 45},
-	{0x4a2f, 46},
-	{0x4a30, 47},
-	{0x4a31, 48},
-	{0x4a32, 49},
-	{0x4a33, 50},
-	{0x4a34, 51},
-	{0x4a35, 52},
-	{0x4a36, 53},
-	{0x4a37, 54},
-	{0x4a38, 55},
-	{0x4a39, 56},
-	{0x4a3a, 57},
-	{0x4a3b, 58},
-	{0x4a3c, 59},
-	{0x4a3d, 60},
-	{0x4a3e, 61},
-	{0x4a3f, 62},
-	{0x4a40, 63},
-	{0x4a41, 64},
-	{0x4a42, 65},
-	{0x4a43, 66},
-	{0x4a44, 67},
-	{0x4a45, 68},
-	{0x4a46, 69},
-	{0x4a47, 70},
-	{0x4a48, 71},
-	{0x4a49, 72},
-	{0x4a4a, 73},
-	{0x4a4b, 74},
-	{0x4a4c, 75},
-	{0x4a4d, 76},
-	{0x4a4e, 77},
-	{0x4a4f, 78},
-	{0x4a50, 79},
-	{0x4a51, 80},
-	{0x4a52, 81},
-	{0x4a53, 82},
-	{0x4a54, 83},
-	{0x4a55, 84},
-	{0x4a56, 85},
-	{0x4a57, 86},
-	{0x4a58, 87},
-	{0x4a59, 88},
-	{0x4a5a, 89},
-	{0x4a5b, 90},
-	{0x4a5c, 91},
-	{0x4a5d, 92},
-	{0x4a5e, 93},
-	{0x4a5f, 94},
-	{0x4a60, 95},
-	{0x4a61, 96},
-	{0x4a62, 97},
-	{0x4a63, 98},
-	{0x4a64, 99},
-	{0x4a65, 100},
-	{0x4a66, 101},
-	{0x4a67, 102},
-	{0x4a68, 103},
-	{0x4a69, 104},
-	{0x4a6a, 105},
-	{0x4a6b, 106},
-	{0x4a6c, 107},
-	{0x4a6d, 108},
-	{0x4a6e, 109},
-	{0x4a6f, 110},
-	{0x4a70, 111},
-	{0x4a71, 112},
-	{0x4a72, 113},
-	{0x4a73, 114},
-	{0x4a74, 115},
-	{0x4a75, 116},
-	{0x4a76, 117},
-	{0x4a77, 118},
-	{0x4a78, 119},
-	{0x4a79, 120},
-	{0x4a7a, 121},
-	{0x4a7b, 122},
-	{0x4a7c, 123},
-	{0x4a7d, 124},
-	{0x4a7e, 125},
-	{0x4a7f, 126},
-	{0x4a80, 127},
-	{0x4a81, 128},
-	{0x4a82, 129},
-	{0x4a83, 130},
-	{0x4a84, 131},
-	{0x4a85, 132},
-	{0x4a86, 133},
-	{0x4a87, 134},
-	{0x4a88, 135},
-	{0x4a89, 136},
-	{0x4a8a, 137},
-	{0x4a8b, 138},
-	{0x4a8c, 139},
-	{0x4a8d, 140},
-	{0x4a8e, 141},
-	{0x4a8f, 142},
-	{0x4a90, 143},
-	{0x4a91, 144},
-	{0x4a92, 145},
-	{0x4a93, 146},
-	{0x4a94, 147},
-	{0x4a95, 148},
-	{0x4a96, 149},
-	{0x4a97, 150},
-	{0x4a98, 151},
-	{0x4a99, 152},
-	{0x4a9a, 153},
-	{0x4a9b, 154},
-	{0x4a9c, 155},
-	{0x4a9d, 156},
-	{0x4a9e, 157},
-	{0x4a9f, 158},
-	{0x4aa0, 159},
-	{0x4aa1, 160},
-	{0x4aa2, 161},
-	{0x4aa3, 162},
-	{0x4aa4, 163},
-	{0x4aa5, 164},
-	{0x4aa6, 165},
-	{0x4aa7, 166},
-	{0x4aa8, 167},
-	{0x4aa9, 168},
-	{0x4aaa, 169},
-	{0x4aab, 170},
-	{0x4aac, 171},
-	{0x4aad, 172},
-	{0x4aae, 173},
-	{0x4aaf, 174},
-	{0x4ab0, 175},
-	{0x4ab1, 176},
-	{0x4ab2, 177},
-	{0x4ab3, 178},
-	{0x4ab4, 179},
-	{0x4ab5, 180},
-	{0x4ab6, 181},
-	{0x4ab7, 182},
-	{0x4ab8, 183},
-	{0x4ab9, 184},
-	{0x4aba, 185},
-	{0x4abb, 186},
-	{0x4abc, 187},
-	{0x4abd, 188},
-	{0x4abe, 189},
-	{0x4abf, 190},
-	{0x4ac0, 191},
-	{0x4ac1, 192},
-	{0x4ac2, 193},
-	{0x4ac3, 194},
-	{0x4ac4, 195},
-	{0x4ac5, 196},
-	{0x4ac6, 197},
-	{0x4ac7, 198},
-	{0x4ac8, 199},
-	{0x4ac9, 200},
-	{0x4aca, 201},
-	{0x4acb, 202},
-	{0x4acc, 203},
-	{0x4acd, 204},
-	{0x4ace, 205},
-	{0x4acf, 206},
-	{0x4ad0, 207},
-	{0x4ad1, 208},
-	{0x4ad2, 209},
-	{0x4ad3, 210},
-	{0x4ad4, 211},
-	{0x4ad5, 212},
-	{0x4ad6, 213},
-	{0x4ad7, 214},
-	{0x4ad8, 215},
-	{0x4ad9, 216},
-	{0x4ada, 217},
-	{0x4adb, 218},
-	{0x4adc, 219},
-	{0x4add, 220},
-	{0x4ade, 221},
-	{0x4adf, 222},
-	{0x4ae0, 223},
-	{0x4ae1, 224},
-	{0x4ae2, 225},
-	{0x4ae3, 226},
-	{0x4ae4, 227},
-	{0x4ae5, 228},
-	{0x4ae6, 229},
-	{0x4ae7, 230},
-	{0x4ae8, 231},
-	{0x4ae9, 232},
-	{0x4aea, 233},
-	{0x4aeb, 234},
-	{0x4aec, 235},
-	{0x4aed, 236},
-	{0x4aee, 237},
-	{0x4aef, 238},
-	{0x4af0, 239},
-	{0x4af1, 240},
-	{0x4af2, 241},
-	{0x4af3, 242},
-	{0x4af4, 243},
-	{0x4af5, 244},
-	{0x4af6, 245},
-	{0x4af7, 246},
-	{0x4af8, 247},
-	{0x4af9, 248},
-	{0x4afa, 249},
-	{0x4afb, 250},
-	{0x4afc, 251},
-	{0x4afd, 252},
-	{0x4afe, 253},
-	{0x4aff, 254},
-	{0x4b01, 0},
-	{0x4b02, 1},
-	{0x4b03, 2},
-	{0x4b04, 3},
-	{0x4b05, 4},
-	{0x4b06, 5},
-	{0x4b07, 6},
-	{0x4b08, 7},
-	{0x4b09, 8},
-	{0x4b0a, 9},
-	{0x4b0b, 10},
-	{0x4b0c, 11},
-	{0x4b0d, 12},
-	{0x4b0e, 13},
-	{0x4b0f, 14},
-	{0x4b10, 15},
-	{0x4b11, 16},
-	{0x4b12, 17},
-	{0x4b13, 18},
-	{0x4b14, 19},
-	{0x4b15, 20},
-	{0x4b16, 21},
-	{0x4b17, 22},
-	{0x4b18, 23},
-	{0x4b19, 24},
-	{0x4b1a, 25},
-	{0x4b1b, 26},
-	{0x4b1c, 27},
-	{0x4b1d, 28},
-	{0x4b1e, 29},
-	{0x4b1f, 30},
-	{0x4b20, 31},
-	{0x4b21, 32},
-	{0x4b22, 33},
-	{0x4b23, 34},
-	{0x4b24, 35},
-	{0x4b25, 36},
-	{0x4b26, 37},
-	{0x4b27, 38},
-	{0x4b28, 39},
-	{0x4b29, 40},
-	{0x4b2a, 41},
-	{0x4b2b, 42},
-	{0x4b2c, 43},
-	{0x4b2d, 44},
-	{0x4b2e, 45},
-	{0x4b2f, 46},
-	{0x4b30, 47},
-	{0x4b31, 48},
-	{0x4b32, 49},
-	{0x4b33, 50},
-	{0x4b34, 51},
-	{0x4b35, 52},
-	{0x4b36, 53},
-	{0x4b37, 54},
-	{0x4b38, 55},
-	{0x4b39, 56},
-	{0x4b3a, 57},
-	{0x4b3b, 58},
-	{0x4b3c, 59},
-	{0x4b3d, 60},
-	{0x4b3e, 61},
-	{0x4b3f, 62},
-	{0x4b40, 63},
-	{0x4b41, 64},
-	{0x4b42, 65},
-	{0x4b43, 66},
-	{0x4b44, 67},
-	{0x4b45, 68},
-	{0x4b46, 69},
-	{0x4b47, 70},
-	{0x4b48, 71},
-	{0x4b49, 72},
-	{0x4b4a, 73},
-	{0x4b4b, 74},
-	{0x4b4c, 75},
-	{0x4b4d, 76},
-	{0x4b4e, 77},
-	{0x4b4f, 78},
-	{0x4b50, 79},
-	{0x4b51, 80},
-	{0x4b52, 81},
-	{0x4b53, 82},
-	{0x4b54, 83},
-	{0x4b55, 84},
-	{0x4b56, 85},
-	{0x4b57, 86},
-	{0x4b58, 87},
-	{0x4b59, 88},
-	{0x4b5a, 89},
-	{0x4b5b, 90},
-	{0x4b5c, 91},
-	{0x4b5d, 92},
-	{0x4b5e, 93},
-	{0x4b5f, 94},
-	{0x4b60, 95},
-	{0x4b61, 96},
-	{0x4b62, 97},
-	{0x4b63, 98},
-	{0x4b64, 99},
-	{0x4b65, 100},
-	{0x4b66, 101},
-	{0x4b67, 102},
-	{0x4b68, 103},
-	{0x4b69, 104},
-	{0x4b6a, 105},
-	{0x4b6b, 106},
-	{0x4b6c, 107},
-	{0x4b6d, 108},
-	{0x4b6e, 109},
-	{0x4b6f, 110},
-	{0x4b70, 111},
-	{0x4b71, 112},
-	{0x4b72, 113},
-	{0x4b73, 114},
-	{0x4b74, 115},
-	{0x4b75, 116},
-	{0x4b76, 117},
-	{0x4b77, 118},
-	{0x4b78, 119},
-	{0x4b79, 120},
-	{0x4b7a, 121},
-	{0x4b7b, 122},
-	{0x4b7c, 123},
-	{0x4b7d, 124},
-	{0x4b7e, 125},
-	{0x4b7f, 126},
-	{0x4b80, 127},
-	{0x4b81, 128},
-	{0x4b82, 129},
-	{0x4b83, 130},
-	{0x4b84, 131},
-	{0x4b85, 132},
-	{0x4b86, 133},
-	{0x4b87, 134},
-	{0x4b88, 135},
-	{0x4b89, 136},
-	{0x4b8a, 137},
-	{0x4b8b, 138},
-	{0x4b8c, 139},
-	{0x4b8d, 140},
-	{0x4b8e, 141},
-	{0x4b8f, 142},
-	{0x4b90, 143},
-	{0x4b91, 144},
-	{0x4b92, 145},
-	{0x4b93, 146},
-	{0x4b94, 147},
-	{0x4b95, 148},
-	{0x4b96, 149},
-	{0x4b97, 150},
-	{0x4b98, 151},
-	{0x4b99, 152},
-	{0x4b9a, 153},
-	{0x4b9b, 154},
-	{0x4b9c, 155},
-	{0x4b9d, 156},
-	{0x4b9e, 157},
-	{0x4b9f, 158},
-	{0x4ba0, 159},
-	{0x4ba1, 160},
-	{0x4ba2, 161},
-	{0x4ba3, 162},
-	{0x4ba4, 163},
-	{0x4ba5, 164},
-	{0x4ba6, 165},
-	{0x4ba7, 166},
-	{0x4ba8, 167},
-	{0x4ba9, 168},
-	{0x4baa, 169},
-	{0x4bab, 170},
-	{0x4bac, 171},
-	{0x4bad, 172},
-	{0x4bae, 173},
-	{0x4baf, 174},
-	{0x4bb0, 175},
-	{0x4bb1, 176},
-	{0x4bb2, 177},
-	{0x4bb3, 178},
-	{0x4bb4, 179},
-	{0x4bb5, 180},
-	{0x4bb6, 181},
-	{0x4bb7, 182},
-	{0x4bb8, 183},
-	{0x4bb9, 184},
-	{0x4bba, 185},
-	{0x4bbb, 186},
-	{0x4bbc, 187},
-	{0x4bbd, 188},
-	{0x4bbe, 189},
-	{0x4bbf, 190},
-	{0x4bc0, 191},
-	{0x4bc1, 192},
-	{0x4bc2, 193},
-	{0x4bc3, 194},
-	{0x4bc4, 195},
-	{0x4bc5, 196},
-	{0x4bc6, 197},
-	{0x4bc7, 198},
-	{0x4bc8, 199},
-	{0x4bc9, 200},
-	{0x4bca, 201},
-	{0x4bcb, 202},
-	{0x4bcc, 203},
-	{0x4bcd, 204},
-	{0x4bce, 205},
-	{0x4bcf, 206},
-	{0x4bd0, 207},
-	{0x4bd1, 208},
-	{0x4bd2, 209},
-	{0x4bd3, 210},
-	{0x4bd4, 211},
-	{0x4bd5, 212},
-	{0x4bd6, 213},
-	{0x4bd7, 214},
-	{0x4bd8, 215},
-	{0x4bd9, 216},
-	{0x4bda, 217},
-	{0x4bdb, 218},
-	{0x4bdc, 219},
-	{0x4bdd, 220},
-	{0x4bde, 221},
-	{0x4bdf, 222},
-	{0x4be0, 223},
-	{0x4be1, 224},
-	{0x4be2, 225},
-	{0x4be3, 226},
-	{0x4be4, 227},
-	{0x4be5, 228},
-	{0x4be6, 229},
-	{0x4be7, 230},
-	{0x4be8, 231},
-	{0x4be9, 232},
-	{0x4bea, 233},
-	{0x4beb, 234},
-	{0x4bec, 235},
-	{0x4bed, 236},
-	{0x4bee, 237},
-	{0x4bef, 238},
-	{0x4bf0, 239},
-	{0x4bf1, 240},
-	{0x4bf2, 241},
-	{0x4bf3, 242},
-	{0x4bf4, 243},
-	{0x4bf5, 244},
-	{0x4bf6, 245},
-	{0x4bf7, 246},
-	{0x4bf8, 247},
-	{0x4bf9, 248},
-	{0x4bfa, 249},
-	{0x4bfb, 250},
-	{0x4bfc, 251},
-	{0x4bfd, 252},
-	{0x4bfe, 253},
-	{0x4bff, 254},
-	{0x4c01, 0},
-	{0x4c02, 1},
-	{0x4c03, 2},
-	{0x4c04, 3},
-	{0x4c05, 4},
-	{0x4c06, 5},
-	{0x4c07, 6},
-	{0x4c08, 7},
-	{0x4c09, 8},
-	{0x4c0a, 9},
-	{0x4c0b, 10},
-	{0x4c0c, 11},
-	{0x4c0d, 12},
-	{0x4c0e, 13},
-	{0x4c0f, 14},
-	{0x4c10, 15},
-	{0x4c11, 16},
-	{0x4c12, 17},
-	{0x4c13, 18},
-	{0x4c14, 19},
-	{0x4c15, 20},
-	{0x4c16, 21},
-	{0x4c17, 22},
-	{0x4c18, 23},
-	{0x4c19, 24},
-	{0x4c1a, 25},
-	{0x4c1b, 26},
-	{0x4c1c, 27},
-	{0x4c1d, 28},
-	{0x4c1e, 29},
-	{0x4c1f, 30},
-	{0x4c20, 31},
-	{0x4c21, 32},
-	{0x4c22, 33},
-	{0x4c23, 34},
-	{0x4c24, 35},
-	{0x4c25, 36},
-	{0x4c26, 37},
-	{0x4c27, 38},
-	{0x4c28, 39},
-	{0x4c29, 40},
-	{0x4c2a, 41},
-	{0x4c2b, 42},
-	{0x4c2c, 43},
-	{0x4c2d, 44},
-	{0x4c2e, 45},
-	{0x4c2f, 46},
-	{0x4c30, 47},
-	{0x4c31, 48},
-	{0x4c32, 49},
-	{0x4c33, 50},
-	{0x4c34, 51},
-	{0x4c35, 52},
-	{0x4c36, 53},
-	{0x4c37, 54},
-	{0x4c38, 55},
-	{0x4c39, 56},
-	{0x4c3a, 57},
-	{0x4c3b, 58},
-	{0x4c3c, 59},
-	{0x4c3d, 60},
-	{0x4c3e, 61},
-	{0x4c3f, 62},
-	{0x4c40, 63},
-	{0x4c41, 64},
-	{0x4c42, 65},
-	{0x4c43, 66},
-	{0x4c44, 67},
-	{0x4c45, 68},
-	{0x4c46, 69},
-	{0x4c47, 70},
-	{0x4c48, 71},
-	{0x4c49, 72},
-	{0x4c4a, 73},
-	{0x4c4b, 74},
-	{0x4c4c, 75},
-	{0x4c4d, 76},
-	{0x4c4e, 77},
-	{0x4c4f, 78},
-	{0x4c50, 79},
-	{0x4c51, 80},
-	{0x4c52, 81},
-	{0x4c53, 82},
-	{0x4c54, 83},
-	{0x4c55, 84},
-	{0x4c56, 85},
-	{0x4c57, 86},
-	{0x4c58, 87},
-	{0x4c59, 88},
-	{0x4c5a, 89},
-	{0x4c5b, 90},
-	{0x4c5c, 91},
-	{0x4c5d, 92},
-	{0x4c5e, 93},
-	{0x4c5f, 94},
-	{0x4c60, 95},
-	{0x4c61, 96},
-	{0x4c62, 97},
-	{0x4c63, 98},
-	{0x4c64, 99},
-	{0x4c65, 100},
-	{0x4c66, 101},
-	{0x4c67, 102},
-	{0x4c68, 103},
-	{0x4c69, 104},
-	{0x4c6a, 105},
-	{0x4c6b, 106},
-	{0x4c6c, 107},
-	{0x4c6d, 108},
-	{0x4c6e, 109},
-	{0x4c6f, 110},
-	{0x4c70, 111},
-	{0x4c71, 112},
-	{0x4c72, 113},
-	{0x4c73, 114},
-	{0x4c74, 115},
-	{0x4c75, 116},
-	{0x4c76, 117},
-	{0x4c79, 0},
-	{0x4c7a, 1},
-	{0x4c7b, 2},
-	{0x4c7c, 3},
-	{0x4c7d, 4},
-	{0x4c7e, 5},
-	{0x4c7f, 6},
-	{0x4c80, 7},
-	{0x4c81, 8},
-	{0x4c82, 9},
-	{0x4c83, 10},
-	{0x4c84, 11},
-	{0x4c85, 12},
-	{0x4c86, 13},
-	{0x4c87, 14},
-	{0x4c88, 15},
-	{0x4c89, 16},
-	{0x4c8a, 17},
-	{0x4c8b, 18},
-	{0x4c8c, 19},
-	{0x4c8d, 20},
-	{0x4c8e, 21},
-	{0x4c8f, 22},
-	{0x4c90, 23},
-	{0x4c91, 24},
-	{0x4c92, 25},
-	{0x4c93, 26},
-	{0x4c94, 27},
-	{0x4c95, 28},
-	{0x4c96, 29},
-	{0x4c97, 30},
-	{0x4c98, 31},
-	{0x4c99, 32},
-	{0x4c9a, 33},
-	{0x4c9b, 34},
-	{0x4c9c, 35},
-	{0x4c9d, 36},
-	{0x4c9e, 37},
-	{0x4ca0, 0},
-	{0x4ca1, 1},
-	{0x4ca5, 0},
-	{0x4ca6, 1},
-	{0x4ca7, 2},
-	{0x4ca8, 3},
-	{0x4ca9, 4},
-	{0x4caa, 5},
-	{0x4cab, 6},
-	{0x4cac, 7},
-	{0x4cad, 8},
-	{0x4cae, 9},
-	{0x4caf, 10},
-	{0x4cb0, 11},
-	{0x4cb1, 12},
-	{0x4cb2, 13},
-	{0x4cb3, 14},
-	{0x4cb4, 15},
-	{0x4cb5, 16},
-	{0x4cb6, 17},
-	{0x4cb7, 18},
-	{0x4cb8, 19},
-	{0x4cb9, 20},
-	{0x4cba, 21},
-	{0x4cbb, 22},
-	{0x4cbc, 23},
-	{0x4cbd, 24},
-	{0x4cbe, 25},
-	{0x4cbf, 26},
-	{0x4cc0, 27},
-	{0x4cc1, 28},
-	{0x4cc2, 29},
-	{0x4cc3, 30},
-	{0x4cc4, 31},
-	{0x4cc5, 32},
-	{0x4cc6, 33},
-	{0x4cc7, 34},
-	{0x4cc8, 35},
-	{0x4cc9, 36},
-	{0x4cca, 37},
-	{0x4ccb, 38},
-	{0x4ccc, 39},
-	{0x4ccd, 40},
-	{0x4cce, 41},
-	{0x4ccf, 42},
-	{0x4cd0, 43},
-	{0x4cd1, 44},
-	{0x4cd2, 45},
-	{0x4cd3, 46},
-	{0x4cd4, 47},
-	{0x4cd5, 48},
-	{0x4cd6, 49},
-	{0x4cd7, 50},
-	{0x4cd8, 51},
-	{0x4cd9, 52},
-	{0x4cda, 53},
-	{0x4cdb, 54},
-	{0x4cdc, 55},
-	{0x4cdd, 56},
-	{0x4cde, 57},
-	{0x4cdf, 58},
-	{0x4ce0, 59},
-	{0x4ce1, 60},
-	{0x4ce2, 61},
-	{0x4ce3, 62},
-	{0x4ce4, 63},
-	{0x4ce5, 64},
-	{0x4ce6, 65},
-	{0x4ce7, 66},
-	{0x4ce8, 67},
-	{0x4ce9, 68},
-	{0x4cea, 69},
-	{0x4ceb, 70},
-	{0x4cec, 71},
-	{0x4ced, 72},
-	{0x4cee, 73},
-	{0x4cef, 74},
-	{0x4cf0, 75},
-	{0x4cf1, 76},
-	{0x4cf2, 77},
-	{0x4cf3, 78},
-	{0x4cf4, 79},
-	{0x4cf5, 80},
-	{0x4cf6, 81},
-	{0x4cf7, 82},
-	{0x4cf8, 83},
-	{0x4cf9, 84},
-	{0x4cfa, 85},
-	{0x4cfb, 86},
-	{0x4cfc, 87},
-	{0x4cfd, 88},
-	{0x4cfe, 89},
-	{0x4cff, 90},
-	{0x4d01, 0},
-	{0x4d02, 1},
-	{0x4d03, 2},
-	{0x4d04, 3},
-	{0x4d05, 4},
-	{0x4d06, 5},
-	{0x4d07, 6},
-	{0x4d08, 7},
-	{0x4d09, 8},
-	{0x4d0a, 9},
-	{0x4d0b, 10},
-	{0x4d0c, 11},
-	{0x4d0d, 12},
-	{0x4d0e, 13},
-	{0x4d0f, 14},
-	{0x4d10, 15},
-	{0x4d11, 16},
-	{0x4d12, 17},
-	{0x4d14, 0},
-	{0x4d15, 1},
-	{0x4d16, 2},
-	{0x4d17, 3},
-	{0x4d18, 4},
-	{0x4d19, 5},
-	{0x4d1b, 0},
-	{0x4d1c, 1},
-	{0x4d1d, 2},
-	{0x4d1e, 3},
-	{0x4d1f, 4},
-	{0x4d20, 5},
-	{0x4d21, 6},
-	{0x4d22, 7},
-	{0x4d23, 8},
-	{0x4d24, 9},
-	{0x4d25, 10},
-	{0x4d26, 11},
-	{0x4d27, 12},
-	{0x4d28, 13},
-	{0x4d29, 14},
-	{0x4d2a, 15},
-	{0x4d2b, 16},
-	{0x4d2c, 17},
-	{0x4d2d, 18},
-	{0x4d2e, 19},
-	{0x4d2f, 20},
-	{0x4d30, 21},
-	{0x4d31, 22},
-	{0x4d32, 23},
-	{0x4d33, 24},
-	{0x4d34, 25},
-	{0x4d35, 26},
-	{0x4d36, 27},
-	{0x4d37, 28},
-	{0x4d38, 29},
-	{0x4d39, 30},
-	{0x4d3a, 31},
-	{0x4d3b, 32},
-	{0x4d3c, 33},
-	{0x4d3d, 34},
-	{0x4d3e, 35},
-	{0x4d3f, 36},
-	{0x4d40, 37},
-	{0x4d41, 38},
-	{0x4d42, 39},
-	{0x4d43, 40},
-	{0x4d44, 41},
-	{0x4d45, 42},
-	{0x4d46, 43},
-	{0x4d47, 44},
-	{0x4d48, 45},
-	{0x4d49, 46},
-	{0x4d4a, 47},
-	{0x4d4b, 48},
-	{0x4d4c, 49},
-	{0x4d4d, 50},
-	{0x4d4e, 51},
-	{0x4d4f, 52},
-	{0x4d50, 53},
-	{0x4d51, 54},
-	{0x4d52, 55},
-	{0x4d53, 56},
-	{0x4d54, 57},
-	{0x4d55, 58},
-	{0x4d56, 59},
-	{0x4d57, 60},
-	{0x4d58, 61},
-	{0x4d59, 62},
-	{0x4d5a, 63},
-	{0x4d5b, 64},
-	{0x4d5c, 65},
-	{0x4d5d, 66},
-	{0x4d5e, 67},
-	{0x4d5f, 68},
-	{0x4d60, 69},
-	{0x4d61, 70},
-	{0x4d62, 71},
-	{0x4d63, 72},
-	{0x4d64, 73},
-	{0x4d65, 74},
-	{0x4d66, 75},
-	{0x4d67, 76},
-	{0x4d68, 77},
-	{0x4d69, 78},
-	{0x4d6a, 79},
-	{0x4d6b, 80},
-	{0x4d6c, 81},
-	{0x4d6d, 82},
-	{0x4d6e, 83},
-	{0x4d6f, 84},
-	{0x4d70, 85},
-	{0x4d71, 86},
-	{0x4d72, 87},
-	{0x4d73, 88},
-	{0x4d74, 89},
-	{0x4d75, 90},
-	{0x4d76, 91},
-	{0x4d77, 92},
-	{0x4d78, 93},
-	{0x4d79, 94},
-	{0x4d7a, 95},
-	{0x4d7b, 96},
-	{0x4d7c, 97},
-	{0x4d7d, 98},
-	{0x4d7e, 99},
-	{0x4d7f, 100},
-	{0x4d80, 101},
-	{0x4d81, 102},
-	{0x4d82, 103},
-	{0x4d83, 104},
-	{0x4d84, 105},
-	{0x4d85, 106},
-	{0x4d86, 107},
-	{0x4d87, 108},
-	{0x4d88, 109},
-	{0x4d89, 110},
-	{0x4d8a, 111},
-	{0x4d8b, 112},
-	{0x4d8c, 113},
-	{0x4d8d, 114},
-	{0x4d8e, 115},
-	{0x4d8f, 116},
-	{0x4d90, 117},
-	{0x4d91, 118},
-	{0x4d92, 119},
-	{0x4d93, 120},
-	{0x4d94, 121},
-	{0x4d95, 122},
-	{0x4d96, 123},
-	{0x4d97, 124},
-	{0x4d98, 125},
-	{0x4d99, 126},
-	{0x4d9a, 127},
-	{0x4d9b, 128},
-	{0x4d9c, 129},
-	{0x4d9d, 130},
-	{0x4d9e, 131},
-	{0x4d9f, 132},
-	{0x4da0, 133},
-	{0x4da1, 134},
-	{0x4da2, 135},
-	{0x4da3, 136},
-	{0x4da4, 137},
-	{0x4da5, 138},
-	{0x4da6, 139},
-	{0x4da7, 140},
-	{0x4da8, 141},
-	{0x4da9, 142},
-	{0x4daa, 143},
-	{0x4dab, 144},
-	{0x4dac, 145},
-	{0x4dad, 146},
-	{0x4db0, 0},
-	{0x4db1, 1},
-	{0x4db2, 2},
-	{0x4db3, 3},
-	{0x4db4, 4},
-	{0x4db5, 5},
-	{0x4e00, 4162},
-	{0x4e01, 1504},
-	{0x4e03, 3070},
-	{0x4e05, 0},
-	{0x4e06, 1},
-	{0x4e07, 3747},
-	{0x4e08, 4458},
-	{0x4e09, 3288},
-	{0x4e0a, 3336},
-	{0x4e0b, 3887},
-	{0x4e0c, 4696},
-	{0x4e0d, 1154},
-	{0x4e0e, 4304},
-	{0x4e10, 4698},
-	{0x4e11, 1304},
-	{0x4e13, 4613},
-	{0x4e14, 3151},
-	{0x4e15, 4701},
-	{0x4e16, 3415},
-	{0x4e18, 3181},
-	{0x4e19, 1124},
-	{0x4e1a, 4156},
-	{0x4e1b, 1367},
-	{0x4e1c, 1514},
-	{0x4e1d, 3508},
-	{0x4e1e, 4703},
-	{0x4e20, 0},
-	{0x4e21, 1},
-	{0x4e22, 1513},
-	{0x4e24, 2566},
-	{0x4e25, 4088},
-	{0x4e27, 3294},
-	{0x4e28, 4707},
-	{0x4e2a, 1777},
-	{0x4e2b, 4071},
-	{0x4e2c, 5788},
-	{0x4e2d, 4559},
-	{0x4e2f, 0},
-	{0x4e30, 1662},
-	{0x4e32, 1329},
-	{0x4e34, 2594},
-	{0x4e36, 4722},
-	{0x4e38, 3737},
-	{0x4e39, 1413},
-	{0x4e3a, 3769},
-	{0x4e3b, 4598},
-	{0x4e3d, 2529},
-	{0x4e3e, 2312},
-	{0x4e3f, 4709},
-	{0x4e41, 0},
-	{0x4e42, 1},
-	{0x4e43, 2862},
-	{0x4e45, 2290},
-	{0x4e47, 4711},
-	{0x4e48, 2745},
-	{0x4e49, 4204},
-	{0x4e4b, 4525},
-	{0x4e4c, 3817},
-	{0x4e4d, 4424},
-	{0x4e4e, 1964},
-	{0x4e4f, 1603},
-	{0x4e50, 2497},
-	{0x4e52, 3032},
-	{0x4e53, 2963},
-	{0x4e54, 3140},
-	{0x4e56, 1837},
-	{0x4e58, 1264},
-	{0x4e59, 4185},
-	{0x4e5b, 0},
-	{0x4e5c, 4725},
-	{0x4e5d, 2292},
-	{0x4e5e, 3089},
-	{0x4e5f, 4153},
-	{0x4e60, 3869},
-	{0x4e61, 3924},
-	{0x4e63, 0},
-	{0x4e64, 1},
-	{0x4e65, 2},
-	{0x4e66, 3456},
-	{0x4e68, 0},
-	{0x4e69, 4726},
-	{0x4e6b, 0},
-	{0x4e6c, 1},
-	{0x4e6d, 2},
-	{0x4e6e, 3},
-	{0x4e6f, 4},
-	{0x4e70, 2713},
-	{0x4e71, 2681},
-	{0x4e73, 3268},
-	{0x4e75, 0},
-	{0x4e76, 1},
-	{0x4e77, 2},
-	{0x4e78, 3},
-	{0x4e79, 4},
-	{0x4e7a, 5},
-	{0x4e7b, 6},
-	{0x4e7c, 7},
-	{0x4e7d, 8},
-	{0x4e7e, 3113},
-	{0x4e80, 0},
-	{0x4e81, 1},
-	{0x4e82, 8281},
-	{0x4e84, 0},
-	{0x4e85, 1},
-	{0x4e86, 2580},
-	{0x4e88, 4301},
-	{0x4e89, 4506},
-	{0x4e8b, 3417},
-	{0x4e8c, 1597},
-	{0x4e8d, 4695},
-	{0x4e8e, 4287},
-	{0x4e8f, 2436},
-	{0x4e91, 4361},
-	{0x4e92, 1978},
-	{0x4e93, 4727},
-	{0x4e94, 3828},
-	{0x4e95, 2269},
-	{0x4e97, 0},
-	{0x4e98, 4702},
-	{0x4e9a, 4080},
-	{0x4e9b, 3956},
-	{0x4e9d, 0},
-	{0x4e9e, 8689},
-	{0x4e9f, 4723},
-	{0x4ea0, 4867},
-	{0x4ea1, 3751},
-	{0x4ea2, 2375},
-	{0x4ea4, 2188},
-	{0x4ea5, 1884},
-	{0x4ea6, 4199},
-	{0x4ea7, 1217},
-	{0x4ea8, 1943},
-	{0x4ea9, 2841},
-	{0x4eab, 3930},
-	{0x4eac, 2264},
-	{0x4ead, 3669},
-	{0x4eae, 2570},
-	{0x4eb0, 0},
-	{0x4eb1, 1},
-	{0x4eb2, 3156},
-	{0x4eb3, 4869},
-	{0x4eb5, 4872},
-	{0x4eb7, 0},
-	{0x4eb8, 1},
-	{0x4eb9, 2},
-	{0x4eba, 3238},
-	{0x4ebb, 4767},
-	{0x4ebd, 0},
-	{0x4ebe, 1},
-	{0x4ebf, 4193},
-	{0x4ec0, 3401},
-	{0x4ec1, 3237},
-	{0x4ec2, 4770},
-	{0x4ec3, 4768},
-	{0x4ec4, 4732},
-	{0x4ec5, 2247},
-	{0x4ec6, 3052},
-	{0x4ec7, 1301},
-	{0x4ec9, 4769},
-	{0x4eca, 2242},
-	{0x4ecb, 2234},
-	{0x4ecd, 3247},
-	{0x4ece, 1366},
-	{0x4ed0, 0},
-	{0x4ed1, 2687},
-	{0x4ed3, 1181},
-	{0x4ed4, 4653},
-	{0x4ed5, 3426},
-	{0x4ed6, 3568},
-	{0x4ed7, 4461},
-	{0x4ed8, 1713},
-	{0x4ed9, 3894},
-	{0x4edb, 0},
-	{0x4edc, 1},
-	{0x4edd, 4846},
-	{0x4ede, 4774},
-	{0x4edf, 3111},
-	{0x4ee1, 4772},
-	{0x4ee3, 1405},
-	{0x4ee4, 2615},
-	{0x4ee5, 4187},
-	{0x4ee7, 0},
-	{0x4ee8, 4771},
-	{0x4eea, 4174},
-	{0x4eeb, 4773},
-	{0x4eec, 2764},
-	{0x4eee, 0},
-	{0x4eef, 1},
-	{0x4ef0, 4127},
-	{0x4ef2, 4568},
-	{0x4ef3, 4776},
-	{0x4ef5, 4779},
-	{0x4ef6, 2161},
-	{0x4ef7, 2126},
-	{0x4ef9, 0},
-	{0x4efa, 1},
-	{0x4efb, 3241},
-	{0x4efd, 1658},
-	{0x4eff, 1631},
-	{0x4f01, 3090},
-	{0x4f03, 0},
-	{0x4f04, 1},
-	{0x4f05, 2},
-	{0x4f06, 3},
-	{0x4f07, 4},
-	{0x4f08, 5},
-	{0x4f09, 4782},
-	{0x4f0a, 4168},
-	{0x4f0c, 0},
-	{0x4f0d, 3832},
-	{0x4f0e, 2098},
-	{0x4f0f, 1689},
-	{0x4f10, 1602},
-	{0x4f11, 4008},
-	{0x4f13, 0},
-	{0x4f14, 1},
-	{0x4f15, 2},
-	{0x4f16, 3},
-	{0x4f17, 4569},
-	{0x4f18, 4266},
-	{0x4f19, 2052},
-	{0x4f1a, 2038},
-	{0x4f1b, 4775},
-	{0x4f1d, 0},
-	{0x4f1e, 3290},
-	{0x4f1f, 3775},
-	{0x4f20, 1326},
-	{0x4f22, 4777},
-	{0x4f24, 3332},
-	{0x4f25, 4780},
-	{0x4f26, 2686},
-	{0x4f27, 4781},
-	{0x4f29, 0},
-	{0x4f2a, 3776},
-	{0x4f2b, 4783},
-	{0x4f2d, 0},
-	{0x4f2e, 1},
-	{0x4f2f, 1141},
-	{0x4f30, 1817},
-	{0x4f32, 4791},
-	{0x4f34, 1012},
-	{0x4f36, 2607},
-	{0x4f38, 3365},
-	{0x4f3a, 3514},
-	{0x4f3c, 3515},
-	{0x4f3d, 4792},
-	{0x4f3f, 0},
-	{0x4f40, 1},
-	{0x4f41, 2},
-	{0x4f42, 3},
-	{0x4f43, 1481},
-	{0x4f45, 0},
-	{0x4f46, 1420},
-	{0x4f48, 0},
-	{0x4f49, 1},
-	{0x4f4a, 2},
-	{0x4f4b, 3},
-	{0x4f4c, 4},
-	{0x4f4d, 3786},
-	{0x4f4e, 1454},
-	{0x4f4f, 4606},
-	{0x4f50, 4689},
-	{0x4f51, 4280},
-	{0x4f53, 3640},
-	{0x4f55, 1925},
-	{0x4f57, 4790},
-	{0x4f58, 4848},
-	{0x4f59, 4293},
-	{0x4f5a, 4787},
-	{0x4f5b, 1677},
-	{0x4f5c, 4692},
-	{0x4f5d, 4788},
-	{0x4f5e, 4784},
-	{0x4f5f, 4789},
-	{0x4f60, 2886},
-	{0x4f62, 0},
-	{0x4f63, 4251},
-	{0x4f64, 4778},
-	{0x4f65, 4849},
-	{0x4f67, 4785},
-	{0x4f69, 2982},
-	{0x4f6b, 0},
-	{0x4f6c, 2491},
-	{0x4f6e, 0},
-	{0x4f6f, 4121},
-	{0x4f70, 998},
-	{0x4f72, 0},
-	{0x4f73, 2116},
-	{0x4f74, 4794},
-	{0x4f76, 4793},
-	{0x4f78, 0},
-	{0x4f79, 1},
-	{0x4f7a, 2},
-	{0x4f7b, 4800},
-	{0x4f7c, 4802},
-	{0x4f7e, 4799},
-	{0x4f7f, 3408},
-	{0x4f81, 0},
-	{0x4f82, 1},
-	{0x4f83, 4797},
-	{0x4f84, 4533},
-	{0x4f86, 8178},
-	{0x4f88, 1283},
-	{0x4f89, 4796},
-	{0x4f8b, 2536},
-	{0x4f8d, 3427},
-	{0x4f8f, 4798},
-	{0x4f91, 4795},
-	{0x4f93, 0},
-	{0x4f94, 4804},
-	{0x4f96, 8285},
-	{0x4f97, 1520},
-	{0x4f99, 0},
-	{0x4f9a, 1},
-	{0x4f9b, 1794},
-	{0x4f9d, 4167},
-	{0x4f9f, 0},
-	{0x4fa0, 3885},
-	{0x4fa2, 0},
-	{0x4fa3, 2665},
-	{0x4fa5, 2197},
-	{0x4fa6, 4493},
-	{0x4fa7, 1191},
-	{0x4fa8, 3141},
-	{0x4fa9, 2424},
-	{0x4faa, 4801},
-	{0x4fac, 4803},
-	{0x4fae, 3833},
-	{0x4faf, 1957},
-	{0x4fb1, 0},
-	{0x4fb2, 1},
-	{0x4fb3, 2},
-	{0x4fb4, 3},
-	{0x4fb5, 3155},
-	{0x4fb7, 0},
-	{0x4fb8, 1},
-	{0x4fb9, 2},
-	{0x4fba, 3},
-	{0x4fbb, 4},
-	{0x4fbc, 5},
-	{0x4fbd, 6},
-	{0x4fbe, 7},
-	{0x4fbf, 1100},
-	{0x4fc1, 0},
-	{0x4fc2, 9884},
-	{0x4fc3, 1372},
-	{0x4fc4, 1580},
-	{0x4fc5, 4808},
-	{0x4fc7, 0},
-	{0x4fc8, 1},
-	{0x4fc9, 2},
-	{0x4fca, 2350},
-	{0x4fcc, 0},
-	{0x4fcd, 1},
-	{0x4fce, 4850},
-	{0x4fcf, 3147},
-	{0x4fd0, 2537},
-	{0x4fd1, 4812},
-	{0x4fd3, 0},
-	{0x4fd4, 1},
-	{0x4fd5, 2},
-	{0x4fd6, 3},
-	{0x4fd7, 3532},
-	{0x4fd8, 1690},
-	{0x4fda, 4809},
-	{0x4fdc, 4811},
-	{0x4fdd, 1036},
-	{0x4fde, 4294},
-	{0x4fdf, 4813},
-	{0x4fe0, 8629},
-	{0x4fe1, 3984},
-	{0x4fe3, 4810},
-	{0x4fe5, 0},
-	{0x4fe6, 4805},
-	{0x4fe8, 4806},
-	{0x4fe9, 2546},
-	{0x4fea, 4807},
-	{0x4fec, 0},
-	{0x4fed, 2150},
-	{0x4fee, 4009},
-	{0x4fef, 1700},
-	{0x4ff1, 2322},
-	{0x4ff3, 4817},
-	{0x4ff5, 0},
-	{0x4ff6, 1},
-	{0x4ff7, 2},
-	{0x4ff8, 4814},
-	{0x4ffa, 958},
-	{0x4ffc, 0},
-	{0x4ffd, 1},
-	{0x4ffe, 4822},
-	{0x5000, 8908},
-	{0x5002, 0},
-	{0x5003, 1},
-	{0x5004, 2},
-	{0x5005, 3},
-	{0x5006, 8214},
-	{0x5008, 0},
-	{0x5009, 7778},
-	{0x500b, 7968},
-	{0x500c, 4824},
-	{0x500d, 1055},
-	{0x500f, 4819},
-	{0x5011, 8319},
-	{0x5012, 1434},
-	{0x5014, 2338},
-	{0x5016, 0},
-	{0x5017, 1},
-	{0x5018, 3611},
-	{0x5019, 1961},
-	{0x501a, 4183},
-	{0x501c, 4823},
-	{0x501e, 0},
-	{0x501f, 2233},
-	{0x5021, 1232},
-	{0x5023, 0},
-	{0x5024, 1},
-	{0x5025, 4825},
-	{0x5026, 2330},
-	{0x5028, 4826},
-	{0x5029, 4815},
-	{0x502a, 2882},
-	{0x502b, 8284},
-	{0x502c, 4818},
-	{0x502d, 4821},
-	{0x502e, 4820},
-	{0x5030, 0},
-	{0x5031, 1},
-	{0x5032, 2},
-	{0x5033, 3},
-	{0x5034, 4},
-	{0x5035, 5},
-	{0x5036, 6},
-	{0x5037, 7},
-	{0x5038, 8},
-	{0x5039, 9},
-	{0x503a, 4431},
-	{0x503c, 4532},
-	{0x503e, 3168},
-	{0x5040, 0},
-	{0x5041, 1},
-	{0x5042, 2},
-	{0x5043, 4828},
-	{0x5045, 0},
-	{0x5046, 1},
-	{0x5047, 2124},
-	{0x5048, 4830},
-	{0x5049, 8596},
-	{0x504b, 0},
-	{0x504c, 4816},
-	{0x504e, 4831},
-	{0x504f, 3018},
-	{0x5051, 0},
-	{0x5052, 1},
-	{0x5053, 2},
-	{0x5054, 3},
-	{0x5055, 4829},
-	{0x5057, 0},
-	{0x5058, 1},
-	{0x5059, 2},
-	{0x505a, 4691},
-	{0x505c, 3668},
-	{0x505e, 0},
-	{0x505f, 1},
-	{0x5060, 2},
-	{0x5061, 3},
-	{0x5062, 4},
-	{0x5063, 5},
-	{0x5064, 6},
-	{0x5065, 2162},
-	{0x5067, 0},
-	{0x5068, 1},
-	{0x5069, 2},
-	{0x506a, 3},
-	{0x506b, 4},
-	{0x506c, 4832},
-	{0x506e, 0},
-	{0x506f, 1},
-	{0x5070, 2},
-	{0x5071, 3},
-	{0x5072, 4},
-	{0x5073, 5},
-	{0x5074, 7781},
-	{0x5075, 8833},
-	{0x5076, 2941},
-	{0x5077, 3686},
-	{0x5079, 0},
-	{0x507a, 1},
-	{0x507b, 4833},
-	{0x507d, 0},
-	{0x507e, 4827},
-	{0x507f, 1226},
-	{0x5080, 2443},
-	{0x5082, 0},
-	{0x5083, 1},
-	{0x5084, 2},
-	{0x5085, 1712},
-	{0x5087, 0},
-	{0x5088, 2535},
-	{0x508a, 0},
-	{0x508b, 1},
-	{0x508c, 2},
-	{0x508d, 1027},
-	{0x508f, 0},
-	{0x5090, 1},
-	{0x5091, 2},
-	{0x5092, 3},
-	{0x5093, 4},
-	{0x5094, 5},
-	{0x5095, 6},
-	{0x5096, 8909},
-	{0x5098, 8458},
-	{0x5099, 7742},
-	{0x509b, 0},
-	{0x509c, 1},
-	{0x509d, 2},
-	{0x509e, 3},
-	{0x509f, 4},
-	{0x50a0, 5},
-	{0x50a1, 6},
-	{0x50a2, 9855},
-	{0x50a3, 1401},
-	{0x50a5, 4834},
-	{0x50a7, 4835},
-	{0x50a8, 1317},
-	{0x50a9, 4836},
-	{0x50ab, 0},
-	{0x50ac, 1378},
-	{0x50ad, 8750},
-	{0x50af, 0},
-	{0x50b0, 1},
-	{0x50b1, 2},
-	{0x50b2, 972},
-	{0x50b3, 7830},
-	{0x50b4, 8907},
-	{0x50b5, 8812},
-	{0x50b7, 8471},
-	{0x50b9, 0},
-	{0x50ba, 4837},
-	{0x50bb, 3310},
-	{0x50bd, 0},
-	{0x50be, 8424},
-	{0x50c0, 0},
-	{0x50c1, 1},
-	{0x50c2, 8916},
-	{0x50c4, 0},
-	{0x50c5, 8121},
-	{0x50c7, 0},
-	{0x50c8, 1},
-	{0x50c9, 8920},
-	{0x50cb, 0},
-	{0x50cc, 1},
-	{0x50cd, 2},
-	{0x50ce, 3},
-	{0x50cf, 3934},
-	{0x50d1, 8415},
-	{0x50d3, 0},
-	{0x50d4, 1},
-	{0x50d5, 8386},
-	{0x50d6, 4838},
-	{0x50d8, 0},
-	{0x50d9, 1},
-	{0x50da, 2574},
-	{0x50dc, 0},
-	{0x50dd, 1},
-	{0x50de, 8597},
-	{0x50e0, 0},
-	{0x50e1, 1},
-	{0x50e2, 2},
-	{0x50e3, 3},
-	{0x50e4, 4},
-	{0x50e5, 8108},
-	{0x50e6, 4842},
-	{0x50e7, 3303},
-	{0x50e8, 8915},
-	{0x50ea, 0},
-	{0x50eb, 1},
-	{0x50ec, 4841},
-	{0x50ed, 4840},
-	{0x50ee, 4843},
-	{0x50f0, 0},
-	{0x50f1, 1},
-	{0x50f2, 2},
-	{0x50f3, 3536},
-	{0x50f5, 2170},
-	{0x50f7, 0},
-	{0x50f8, 1},
-	{0x50f9, 8065},
-	{0x50fb, 3014},
-	{0x50fd, 0},
-	{0x50fe, 1},
-	{0x50ff, 2},
-	{0x5100, 8720},
-	{0x5102, 8911},
-	{0x5104, 8723},
-	{0x5106, 4839},
-	{0x5107, 4844},
-	{0x5108, 8164},
-	{0x5109, 8080},
-	{0x510b, 4845},
-	{0x510d, 0},
-	{0x510e, 1},
-	{0x510f, 2},
-	{0x5110, 8918},
-	{0x5112, 3264},
-	{0x5114, 8912},
-	{0x5115, 8910},
-	{0x5117, 0},
-	{0x5118, 9857},
-	{0x511a, 0},
-	{0x511b, 1},
-	{0x511c, 2},
-	{0x511d, 3},
-	{0x511e, 4},
-	{0x511f, 7798},
-	{0x5121, 2503},
-	{0x5123, 0},
-	{0x5124, 1},
-	{0x5125, 2},
-	{0x5126, 3},
-	{0x5127, 4},
-	{0x5128, 5},
-	{0x5129, 6},
-	{0x512a, 8753},
-	{0x512c, 0},
-	{0x512d, 1},
-	{0x512e, 2},
-	{0x512f, 3},
-	{0x5130, 4},
-	{0x5131, 5},
-	{0x5132, 7827},
-	{0x5134, 0},
-	{0x5135, 1},
-	{0x5136, 2},
-	{0x5137, 8914},
-	{0x5139, 0},
-	{0x513a, 8919},
-	{0x513b, 8917},
-	{0x513c, 8913},
-	{0x513e, 0},
-	{0x513f, 1592},
-	{0x5140, 4697},
-	{0x5141, 4365},
-	{0x5143, 4333},
-	{0x5144, 4001},
-	{0x5145, 1289},
-	{0x5146, 4472},
-	{0x5148, 3893},
-	{0x5149, 1851},
-	{0x514b, 2392},
-	{0x514d, 2791},
-	{0x514f, 0},
-	{0x5150, 1},
-	{0x5151, 1553},
-	{0x5152, 7909},
-	{0x5154, 3700},
-	{0x5155, 4866},
-	{0x5156, 4868},
-	{0x5158, 0},
-	{0x5159, 1},
-	{0x515a, 1428},
-	{0x515c, 1524},
-	{0x515e, 0},
-	{0x515f, 1},
-	{0x5160, 2},
-	{0x5161, 3},
-	{0x5162, 2259},
-	{0x5164, 0},
-	{0x5165, 3270},
-	{0x5167, 0},
-	{0x5168, 3206},
-	{0x5169, 8229},
-	{0x516b, 982},
-	{0x516c, 1796},
-	{0x516d, 2626},
-	{0x516e, 4854},
-	{0x5170, 2471},
-	{0x5171, 1803},
-	{0x5173, 1841},
-	{0x5174, 3990},
-	{0x5175, 1121},
-	{0x5176, 3075},
-	{0x5177, 2318},
-	{0x5178, 1477},
-	{0x5179, 4645},
-	{0x517b, 4129},
-	{0x517c, 2137},
-	{0x517d, 3445},
-	{0x517f, 0},
-	{0x5180, 2096},
-	{0x5181, 4858},
-	{0x5182, 4765},
-	{0x5184, 0},
-	{0x5185, 2877},
-	{0x5187, 0},
-	{0x5188, 1743},
-	{0x5189, 3224},
-	{0x518b, 0},
-	{0x518c, 1192},
-	{0x518d, 4380},
-	{0x518f, 0},
-	{0x5190, 1},
-	{0x5191, 2},
-	{0x5192, 2741},
-	{0x5194, 0},
-	{0x5195, 2790},
-	{0x5196, 4884},
-	{0x5197, 3258},
-	{0x5199, 3967},
-	{0x519b, 2347},
-	{0x519c, 2922},
-	{0x519e, 0},
-	{0x519f, 1},
-	{0x51a0, 1843},
-	{0x51a2, 4885},
-	{0x51a4, 4332},
-	{0x51a5, 4886},
-	{0x51a7, 0},
-	{0x51a8, 1},
-	{0x51a9, 2},
-	{0x51aa, 3},
-	{0x51ab, 4879},
-	{0x51ac, 1515},
-	{0x51ae, 0},
-	{0x51af, 1672},
-	{0x51b0, 1122},
-	{0x51b1, 4880},
-	{0x51b2, 1290},
-	{0x51b3, 2341},
-	{0x51b5, 2435},
-	{0x51b6, 4152},
-	{0x51b7, 2511},
-	{0x51b9, 0},
-	{0x51ba, 1},
-	{0x51bb, 1522},
-	{0x51bc, 4882},
-	{0x51bd, 4881},
-	{0x51bf, 0},
-	{0x51c0, 2282},
-	{0x51c2, 0},
-	{0x51c3, 1},
-	{0x51c4, 3071},
-	{0x51c6, 4633},
-	{0x51c7, 4883},
-	{0x51c9, 2562},
-	{0x51cb, 1491},
-	{0x51cc, 2609},
-	{0x51cd, 7887},
-	{0x51cf, 2152},
-	{0x51d1, 1368},
-	{0x51d3, 0},
-	{0x51d4, 1},
-	{0x51d5, 2},
-	{0x51d6, 3},
-	{0x51d7, 4},
-	{0x51d8, 5},
-	{0x51d9, 6},
-	{0x51da, 7},
-	{0x51db, 2598},
-	{0x51dd, 2912},
-	{0x51df, 0},
-	{0x51e0, 2091},
-	{0x51e1, 1615},
-	{0x51e3, 0},
-	{0x51e4, 1676},
-	{0x51e6, 0},
-	{0x51e7, 1},
-	{0x51e8, 2},
-	{0x51e9, 3},
-	{0x51ea, 4},
-	{0x51eb, 4864},
-	{0x51ed, 3037},
-	{0x51ef, 2362},
-	{0x51f0, 2016},
-	{0x51f1, 8153},
-	{0x51f3, 1451},
-	{0x51f5, 5017},
-	{0x51f6, 4002},
-	{0x51f8, 3690},
-	{0x51f9, 967},
-	{0x51fa, 1307},
-	{0x51fb, 2060},
-	{0x51fc, 5018},
-	{0x51fd, 1894},
-	{0x51ff, 4391},
-	{0x5200, 1431},
-	{0x5201, 1492},
-	{0x5202, 4748},
-	{0x5203, 3243},
-	{0x5205, 0},
-	{0x5206, 1651},
-	{0x5207, 3149},
-	{0x5208, 4749},
-	{0x520a, 2364},
-	{0x520c, 0},
-	{0x520d, 5003},
-	{0x520e, 4750},
-	{0x5210, 0},
-	{0x5211, 3991},
-	{0x5212, 1987},
-	{0x5214, 0},
-	{0x5215, 1},
-	{0x5216, 6510},
-	{0x5217, 2585},
-	{0x5218, 2622},
-	{0x5219, 4405},
-	{0x521a, 1744},
-	{0x521b, 1335},
-	{0x521d, 1306},
-	{0x521f, 0},
-	{0x5220, 3319},
-	{0x5222, 0},
-	{0x5223, 1},
-	{0x5224, 2961},
-	{0x5226, 0},
-	{0x5227, 1},
-	{0x5228, 2970},
-	{0x5229, 2534},
-	{0x522b, 1113},
-	{0x522d, 4751},
-	{0x522e, 1831},
-	{0x5230, 1438},
-	{0x5232, 0},
-	{0x5233, 4752},
-	{0x5235, 0},
-	{0x5236, 4549},
-	{0x5237, 3479},
-	{0x5238, 3210},
-	{0x5239, 3307},
-	{0x523a, 1359},
-	{0x523b, 2393},
-	{0x523d, 1869},
-	{0x523f, 4753},
-	{0x5240, 4754},
-	{0x5241, 1574},
-	{0x5242, 2100},
-	{0x5243, 3645},
-	{0x5244, 8904},
-	{0x5246, 0},
-	{0x5247, 8803},
-	{0x5249, 0},
-	{0x524a, 3940},
-	{0x524b, 9859},
-	{0x524c, 4755},
-	{0x524d, 3117},
-	{0x524f, 0},
-	{0x5250, 1833},
-	{0x5251, 2164},
-	{0x5253, 0},
-	{0x5254, 3633},
-	{0x5256, 3049},
-	{0x5258, 0},
-	{0x5259, 1},
-	{0x525a, 2},
-	{0x525b, 7959},
-	{0x525c, 4758},
-	{0x525e, 4756},
-	{0x5260, 0},
-	{0x5261, 4757},
-	{0x5263, 0},
-	{0x5264, 1},
-	{0x5265, 1033},
-	{0x5267, 2326},
-	{0x5269, 3386},
-	{0x526a, 2151},
-	{0x526c, 0},
-	{0x526d, 1},
-	{0x526e, 7979},
-	{0x526f, 1708},
-	{0x5271, 0},
-	{0x5272, 1769},
-	{0x5274, 8906},
-	{0x5275, 7833},
-	{0x5277, 0},
-	{0x5278, 1},
-	{0x5279, 2},
-	{0x527a, 3},
-	{0x527b, 4},
-	{0x527c, 5},
-	{0x527d, 4760},
-	{0x527f, 2204},
-	{0x5281, 4762},
-	{0x5282, 4761},
-	{0x5283, 8015},
-	{0x5285, 0},
-	{0x5286, 1},
-	{0x5287, 8143},
-	{0x5288, 3005},
-	{0x5289, 8246},
-	{0x528a, 7994},
-	{0x528c, 8905},
-	{0x528d, 8089},
-	{0x528f, 0},
-	{0x5290, 4763},
-	{0x5291, 8053},
-	{0x5293, 4764},
-	{0x5295, 0},
-	{0x5296, 1},
-	{0x5297, 2},
-	{0x5298, 3},
-	{0x5299, 4},
-	{0x529a, 5},
-	{0x529b, 2543},
-	{0x529d, 3211},
-	{0x529e, 1015},
-	{0x529f, 1791},
-	{0x52a0, 2118},
-	{0x52a1, 3840},
-	{0x52a2, 5005},
-	{0x52a3, 2588},
-	{0x52a5, 0},
-	{0x52a6, 1},
-	{0x52a7, 2},
-	{0x52a8, 1518},
-	{0x52a9, 4601},
-	{0x52aa, 2925},
-	{0x52ab, 2218},
-	{0x52ac, 5006},
-	{0x52ad, 5007},
-	{0x52af, 0},
-	{0x52b0, 1},
-	{0x52b1, 2531},
-	{0x52b2, 2257},
-	{0x52b3, 2488},
-	{0x52b5, 0},
-	{0x52b6, 1},
-	{0x52b7, 2},
-	{0x52b8, 3},
-	{0x52b9, 4},
-	{0x52ba, 5},
-	{0x52bb, 6},
-	{0x52bc, 7},
-	{0x52bd, 8},
-	{0x52be, 5008},
-	{0x52bf, 3421},
-	{0x52c1, 8126},
-	{0x52c3, 1137},
-	{0x52c5, 0},
-	{0x52c6, 1},
-	{0x52c7, 4263},
-	{0x52c9, 2792},
-	{0x52cb, 4052},
-	{0x52cd, 0},
-	{0x52ce, 1},
-	{0x52cf, 2},
-	{0x52d0, 5010},
-	{0x52d2, 2496},
-	{0x52d4, 0},
-	{0x52d5, 7885},
-	{0x52d6, 5011},
-	{0x52d8, 2366},
-	{0x52d9, 8617},
-	{0x52db, 8678},
-	{0x52dd, 8487},
-	{0x52de, 8195},
-	{0x52df, 2847},
-	{0x52e1, 0},
-	{0x52e2, 8498},
-	{0x52e4, 3159},
-	{0x52e6, 0},
-	{0x52e7, 1},
-	{0x52e8, 2},
-	{0x52e9, 3},
-	{0x52ea, 4},
-	{0x52eb, 5},
-	{0x52ec, 6},
-	{0x52ed, 7},
-	{0x52ee, 8},
-	{0x52ef, 9},
-	{0x52f0, 5012},
-	{0x52f1, 8995},
-	{0x52f3, 0},
-	{0x52f4, 1},
-	{0x52f5, 8209},
-	{0x52f7, 0},
-	{0x52f8, 8437},
-	{0x52f9, 4860},
-	{0x52fa, 3344},
-	{0x52fc, 0},
-	{0x52fd, 1},
-	{0x52fe, 1805},
-	{0x52ff, 3839},
-	{0x5300, 4363},
-	{0x5302, 0},
-	{0x5303, 1},
-	{0x5304, 2},
-	{0x5305, 1031},
-	{0x5306, 1365},
-	{0x5308, 4004},
-	{0x530a, 0},
-	{0x530b, 1},
-	{0x530c, 2},
-	{0x530d, 4861},
-	{0x530f, 5301},
-	{0x5310, 4863},
-	{0x5312, 0},
-	{0x5313, 1},
-	{0x5314, 2},
-	{0x5315, 4710},
-	{0x5316, 1988},
-	{0x5317, 1050},
-	{0x5319, 1276},
-	{0x531a, 4740},
-	{0x531c, 0},
-	{0x531d, 4372},
-	{0x531f, 0},
-	{0x5320, 2180},
-	{0x5321, 2428},
-	{0x5323, 3880},
-	{0x5325, 0},
-	{0x5326, 4742},
-	{0x5328, 0},
-	{0x5329, 1},
-	{0x532a, 1640},
-	{0x532c, 0},
-	{0x532d, 8901},
-	{0x532e, 4743},
-	{0x532f, 8030},
-	{0x5331, 8902},
-	{0x5333, 0},
-	{0x5334, 1},
-	{0x5335, 2},
-	{0x5336, 3},
-	{0x5337, 4},
-	{0x5338, 5},
-	{0x5339, 3012},
-	{0x533a, 3189},
-	{0x533b, 4164},
-	{0x533d, 0},
-	{0x533e, 4744},
-	{0x533f, 2887},
-	{0x5340, 8431},
-	{0x5341, 3397},
-	{0x5343, 3108},
-	{0x5345, 4700},
-	{0x5347, 3382},
-	{0x5348, 3830},
-	{0x5349, 2033},
-	{0x534a, 1014},
-	{0x534c, 0},
-	{0x534d, 1},
-	{0x534e, 1983},
-	{0x534f, 3960},
-	{0x5351, 1049},
-	{0x5352, 4673},
-	{0x5353, 4636},
-	{0x5354, 8656},
-	{0x5355, 1414},
-	{0x5356, 2715},
-	{0x5357, 2866},
-	{0x5359, 0},
-	{0x535a, 1136},
-	{0x535c, 1150},
-	{0x535e, 1102},
-	{0x535f, 5370},
-	{0x5360, 4445},
-	{0x5361, 2357},
-	{0x5362, 2643},
-	{0x5363, 4747},
-	{0x5364, 2648},
-	{0x5366, 4746},
-	{0x5367, 3811},
-	{0x5369, 4946},
-	{0x536b, 3791},
-	{0x536d, 0},
-	{0x536e, 4714},
-	{0x536f, 2739},
-	{0x5370, 4230},
-	{0x5371, 3762},
-	{0x5373, 2087},
-	{0x5374, 3215},
-	{0x5375, 2680},
-	{0x5377, 2332},
-	{0x5378, 3969},
-	{0x537a, 4947},
-	{0x537c, 0},
-	{0x537d, 1},
-	{0x537e, 2},
-	{0x537f, 3169},
-	{0x5381, 0},
-	{0x5382, 1228},
-	{0x5384, 1585},
-	{0x5385, 3663},
-	{0x5386, 2533},
-	{0x5388, 0},
-	{0x5389, 2530},
-	{0x538b, 4066},
-	{0x538c, 4106},
-	{0x538d, 4733},
-	{0x538f, 0},
-	{0x5390, 1},
-	{0x5391, 2},
-	{0x5392, 3},
-	{0x5393, 4},
-	{0x5394, 5},
-	{0x5395, 1189},
-	{0x5397, 0},
-	{0x5398, 2512},
-	{0x5399, 8897},
-	{0x539a, 1960},
-	{0x539c, 0},
-	{0x539d, 4734},
-	{0x539f, 4336},
-	{0x53a0, 7780},
-	{0x53a2, 3918},
-	{0x53a3, 4735},
-	{0x53a5, 4736},
-	{0x53a6, 3888},
-	{0x53a8, 1309},
-	{0x53a9, 2294},
-	{0x53ab, 0},
-	{0x53ac, 1},
-	{0x53ad, 8697},
-	{0x53ae, 4737},
-	{0x53b0, 0},
-	{0x53b1, 1},
-	{0x53b2, 8208},
-	{0x53b4, 8898},
-	{0x53b6, 5020},
-	{0x53b8, 0},
-	{0x53b9, 1},
-	{0x53ba, 2},
-	{0x53bb, 3200},
-	{0x53bd, 0},
-	{0x53be, 1},
-	{0x53bf, 3909},
-	{0x53c1, 3289},
-	{0x53c2, 1173},
-	{0x53c3, 7770},
-	{0x53c5, 0},
-	{0x53c6, 1},
-	{0x53c7, 2},
-	{0x53c8, 4283},
-	{0x53c9, 1197},
-	{0x53ca, 2083},
-	{0x53cb, 4278},
-	{0x53cc, 3488},
-	{0x53cd, 1617},
-	{0x53cf, 0},
-	{0x53d0, 1},
-	{0x53d1, 1599},
-	{0x53d3, 0},
-	{0x53d4, 3452},
-	{0x53d6, 3196},
-	{0x53d7, 3443},
-	{0x53d8, 1101},
-	{0x53d9, 4027},
-	{0x53db, 2962},
-	{0x53dd, 0},
-	{0x53de, 1},
-	{0x53df, 5013},
-	{0x53e0, 1503},
-	{0x53e2, 7842},
-	{0x53e3, 2407},
-	{0x53e4, 1822},
-	{0x53e5, 2323},
-	{0x53e6, 2614},
-	{0x53e8, 5374},
-	{0x53e9, 5373},
-	{0x53ea, 4538},
-	{0x53eb, 2209},
-	{0x53ec, 4474},
-	{0x53ed, 979},
-	{0x53ee, 1506},
-	{0x53ef, 2390},
-	{0x53f0, 3579},
-	{0x53f1, 5371},
-	{0x53f2, 3406},
-	{0x53f3, 4279},
-	{0x53f5, 4741},
-	{0x53f6, 4157},
-	{0x53f7, 1916},
-	{0x53f8, 3507},
-	{0x53f9, 3601},
-	{0x53fb, 5375},
-	{0x53fc, 1489},
-	{0x53fd, 5372},
-	{0x53ff, 0},
-	{0x5401, 4314},
-	{0x5403, 1273},
-	{0x5404, 1778},
-	{0x5406, 5378},
-	{0x5408, 1926},
-	{0x5409, 2077},
-	{0x540a, 1494},
-	{0x540c, 3677},
-	{0x540d, 2816},
-	{0x540e, 1962},
-	{0x540f, 2527},
-	{0x5410, 3699},
-	{0x5411, 3935},
-	{0x5412, 5376},
-	{0x5413, 3890},
-	{0x5415, 2663},
-	{0x5416, 5377},
-	{0x5417, 2711},
-	{0x5419, 0},
-	{0x541a, 1},
-	{0x541b, 2348},
-	{0x541d, 2600},
-	{0x541e, 3709},
-	{0x541f, 4222},
-	{0x5420, 1642},
-	{0x5421, 5385},
-	{0x5423, 5388},
-	{0x5425, 0},
-	{0x5426, 1678},
-	{0x5427, 980},
-	{0x5428, 1557},
-	{0x5429, 1649},
-	{0x542b, 1891},
-	{0x542c, 3664},
-	{0x542d, 2401},
-	{0x542e, 3494},
-	{0x542f, 3091},
-	{0x5431, 4519},
-	{0x5432, 5389},
-	{0x5434, 3825},
-	{0x5435, 1240},
-	{0x5437, 0},
-	{0x5438, 3851},
-	{0x5439, 1336},
-	{0x543b, 3798},
-	{0x543c, 1959},
-	{0x543e, 3824},
-	{0x5440, 4070},
-	{0x5442, 0},
-	{0x5443, 5384},
-	{0x5445, 0},
-	{0x5446, 1399},
-	{0x5448, 1263},
-	{0x544a, 1761},
-	{0x544b, 5379},
-	{0x544d, 0},
-	{0x544e, 1},
-	{0x544f, 2},
-	{0x5450, 2856},
-	{0x5452, 5380},
-	{0x5453, 5381},
-	{0x5454, 5382},
-	{0x5455, 2940},
-	{0x5456, 5383},
-	{0x5457, 5386},
-	{0x5458, 4340},
-	{0x5459, 5387},
-	{0x545b, 3127},
-	{0x545c, 3815},
-	{0x545e, 0},
-	{0x545f, 1},
-	{0x5460, 2},
-	{0x5461, 3},
-	{0x5462, 2875},
-	{0x5464, 5394},
-	{0x5466, 5399},
-	{0x5468, 4571},
-	{0x546a, 0},
-	{0x546b, 1},
-	{0x546c, 2},
-	{0x546d, 3},
-	{0x546e, 4},
-	{0x546f, 5},
-	{0x5470, 6},
-	{0x5471, 5393},
-	{0x5472, 5410},
-	{0x5473, 3781},
-	{0x5475, 1918},
-	{0x5476, 5398},
-	{0x5477, 5392},
-	{0x5478, 2975},
-	{0x547a, 0},
-	{0x547b, 3364},
-	{0x547c, 1963},
-	{0x547d, 2817},
-	{0x547f, 0},
-	{0x5480, 2310},
-	{0x5482, 5390},
-	{0x5484, 5397},
-	{0x5486, 2969},
-	{0x5488, 0},
-	{0x5489, 1},
-	{0x548a, 2},
-	{0x548b, 4423},
-	{0x548c, 1924},
-	{0x548e, 2299},
-	{0x548f, 4258},
-	{0x5490, 1723},
-	{0x5492, 4579},
-	{0x5494, 5391},
-	{0x5495, 1815},
-	{0x5496, 2356},
-	{0x5498, 0},
-	{0x5499, 2629},
-	{0x549a, 5395},
-	{0x549b, 5396},
-	{0x549d, 5400},
-	{0x549f, 0},
-	{0x54a0, 1},
-	{0x54a1, 2},
-	{0x54a2, 3},
-	{0x54a3, 5411},
-	{0x54a4, 5421},
-	{0x54a6, 5407},
-	{0x54a7, 5406},
-	{0x54a8, 4646},
-	{0x54a9, 5419},
-	{0x54aa, 5420},
-	{0x54ab, 5991},
-	{0x54ac, 4142},
-	{0x54ad, 5402},
-	{0x54af, 2358},
-	{0x54b1, 4382},
-	{0x54b3, 2389},
-	{0x54b4, 5404},
-	{0x54b6, 0},
-	{0x54b7, 1},
-	{0x54b8, 3897},
-	{0x54ba, 0},
-	{0x54bb, 5413},
-	{0x54bc, 9069},
-	{0x54bd, 4083},
-	{0x54bf, 5414},
-	{0x54c0, 946},
-	{0x54c1, 3030},
-	{0x54c2, 5403},
-	{0x54c4, 1948},
-	{0x54c6, 1566},
-	{0x54c7, 3724},
-	{0x54c8, 1879},
-	{0x54c9, 4376},
-	{0x54cb, 0},
-	{0x54cc, 5415},
-	{0x54cd, 3929},
-	{0x54ce, 944},
-	{0x54cf, 5423},
-	{0x54d0, 5401},
-	{0x54d1, 4079},
-	{0x54d2, 5405},
-	{0x54d3, 5408},
-	{0x54d4, 5409},
-	{0x54d5, 5412},
-	{0x54d7, 1982},
-	{0x54d9, 5416},
-	{0x54da, 5417},
-	{0x54dc, 5418},
-	{0x54dd, 5422},
-	{0x54de, 5424},
-	{0x54df, 4249},
-	{0x54e1, 8775},
-	{0x54e3, 0},
-	{0x54e4, 1},
-	{0x54e5, 1762},
-	{0x54e6, 2935},
-	{0x54e7, 5426},
-	{0x54e8, 3347},
-	{0x54e9, 2545},
-	{0x54ea, 2855},
-	{0x54ec, 0},
-	{0x54ed, 2411},
-	{0x54ee, 3941},
-	{0x54f0, 0},
-	{0x54f1, 1},
-	{0x54f2, 4477},
-	{0x54f3, 5430},
-	{0x54f5, 0},
-	{0x54f6, 1},
-	{0x54f7, 2},
-	{0x54f8, 3},
-	{0x54f9, 4},
-	{0x54fa, 1151},
-	{0x54fc, 1942},
-	{0x54fd, 5428},
-	{0x54ff, 5009},
-	{0x5501, 4109},
-	{0x5503, 0},
-	{0x5504, 9068},
-	{0x5506, 3561},
-	{0x5507, 1344},
-	{0x5509, 945},
-	{0x550b, 0},
-	{0x550c, 1},
-	{0x550d, 2},
-	{0x550e, 3},
-	{0x550f, 5433},
-	{0x5510, 3609},
-	{0x5511, 5434},
-	{0x5513, 0},
-	{0x5514, 5429},
-	{0x5516, 0},
-	{0x5517, 1},
-	{0x5518, 2},
-	{0x5519, 3},
-	{0x551a, 4},
-	{0x551b, 5425},
-	{0x551d, 0},
-	{0x551e, 1},
-	{0x551f, 2},
-	{0x5520, 5427},
-	{0x5522, 5431},
-	{0x5523, 5432},
-	{0x5524, 2002},
-	{0x5526, 0},
-	{0x5527, 5435},
-	{0x5529, 0},
-	{0x552a, 5436},
-	{0x552c, 1976},
-	{0x552e, 3442},
-	{0x552f, 3767},
-	{0x5530, 5453},
-	{0x5531, 1231},
-	{0x5533, 5452},
-	{0x5535, 0},
-	{0x5536, 1},
-	{0x5537, 5447},
-	{0x5539, 0},
-	{0x553a, 1},
-	{0x553b, 2},
-	{0x553c, 5446},
-	{0x553e, 3722},
-	{0x553f, 5444},
-	{0x5541, 5442},
-	{0x5543, 2397},
-	{0x5544, 4641},
-	{0x5546, 3333},
-	{0x5548, 0},
-	{0x5549, 5440},
-	{0x554a, 940},
-	{0x554c, 0},
-	{0x554d, 1},
-	{0x554e, 2},
-	{0x554f, 8604},
-	{0x5550, 5445},
-	{0x5552, 0},
-	{0x5553, 8393},
-	{0x5555, 5443},
-	{0x5556, 5448},
-	{0x5558, 0},
-	{0x5559, 1},
-	{0x555a, 2},
-	{0x555b, 3},
-	{0x555c, 5454},
-	{0x555e, 8688},
-	{0x5560, 0},
-	{0x5561, 1637},
-	{0x5563, 0},
-	{0x5564, 3008},
-	{0x5565, 3311},
-	{0x5566, 2461},
-	{0x5567, 5437},
-	{0x5569, 0},
-	{0x556a, 2943},
-	{0x556c, 4730},
-	{0x556d, 5441},
-	{0x556e, 2905},
-	{0x5570, 0},
-	{0x5571, 1},
-	{0x5572, 2},
-	{0x5573, 3},
-	{0x5574, 4},
-	{0x5575, 5449},
-	{0x5576, 5450},
-	{0x5577, 5451},
-	{0x5578, 3952},
-	{0x557a, 0},
-	{0x557b, 5466},
-	{0x557c, 3639},
-	{0x557e, 5463},
-	{0x5580, 2355},
-	{0x5581, 5461},
-	{0x5582, 3784},
-	{0x5583, 5457},
-	{0x5584, 3327},
-	{0x5586, 0},
-	{0x5587, 2457},
-	{0x5588, 5460},
-	{0x5589, 1956},
-	{0x558a, 1895},
-	{0x558b, 5455},
-	{0x558d, 0},
-	{0x558e, 1},
-	{0x558f, 5438},
-	{0x5591, 5465},
-	{0x5593, 0},
-	{0x5594, 5470},
-	{0x5596, 0},
-	{0x5597, 1},
-	{0x5598, 1328},
-	{0x5599, 5471},
-	{0x559b, 0},
-	{0x559c, 3871},
-	{0x559d, 1919},
-	{0x559f, 5462},
-	{0x55a1, 0},
-	{0x55a2, 1},
-	{0x55a3, 2},
-	{0x55a4, 3},
-	{0x55a5, 4},
-	{0x55a6, 5},
-	{0x55a7, 4037},
-	{0x55a9, 0},
-	{0x55aa, 8459},
-	{0x55ac, 8414},
-	{0x55ae, 7850},
-	{0x55b0, 0},
-	{0x55b1, 5458},
-	{0x55b2, 8748},
-	{0x55b3, 4414},
-	{0x55b5, 5439},
-	{0x55b7, 2984},
-	{0x55b9, 5459},
-	{0x55bb, 4316},
-	{0x55bd, 5468},
-	{0x55be, 5469},
-	{0x55c0, 0},
-	{0x55c1, 1},
-	{0x55c2, 2},
-	{0x55c3, 3},
-	{0x55c4, 5482},
-	{0x55c5, 4012},
-	{0x55c6, 8408},
-	{0x55c7, 8896},
-	{0x55c9, 5474},
-	{0x55cb, 0},
-	{0x55cc, 5487},
-	{0x55cd, 5488},
-	{0x55ce, 8303},
-	{0x55d0, 0},
-	{0x55d1, 5476},
-	{0x55d2, 5456},
-	{0x55d3, 3293},
-	{0x55d4, 5479},
-	{0x55d6, 5464},
-	{0x55d8, 0},
-	{0x55d9, 1},
-	{0x55da, 8609},
-	{0x55dc, 3423},
-	{0x55dd, 5481},
-	{0x55df, 5467},
-	{0x55e1, 3802},
-	{0x55e3, 3512},
-	{0x55e4, 5491},
-	{0x55e5, 5484},
-	{0x55e6, 5480},
-	{0x55e8, 5489},
-	{0x55e9, 9081},
-	{0x55ea, 5472},
-	{0x55eb, 5477},
-	{0x55ec, 5478},
-	{0x55ee, 0},
-	{0x55ef, 5483},
-	{0x55f1, 0},
-	{0x55f2, 5485},
-	{0x55f3, 5486},
-	{0x55f5, 5490},
-	{0x55f6, 9074},
-	{0x55f7, 5473},
-	{0x55f9, 0},
-	{0x55fa, 1},
-	{0x55fb, 2},
-	{0x55fc, 3},
-	{0x55fd, 3529},
-	{0x55fe, 5499},
-	{0x5600, 5500},
-	{0x5601, 5496},
-	{0x5603, 0},
-	{0x5604, 1},
-	{0x5605, 2},
-	{0x5606, 8554},
-	{0x5608, 5494},
-	{0x5609, 2113},
-	{0x560b, 0},
-	{0x560c, 5495},
-	{0x560d, 9084},
-	{0x560e, 1725},
-	{0x560f, 4731},
-	{0x5611, 0},
-	{0x5612, 1},
-	{0x5613, 2},
-	{0x5614, 8368},
-	{0x5616, 9082},
-	{0x5617, 7796},
-	{0x5618, 4021},
-	{0x561a, 0},
-	{0x561b, 2710},
-	{0x561c, 9079},
-	{0x561e, 5493},
-	{0x561f, 5475},
-	{0x5621, 0},
-	{0x5622, 1},
-	{0x5623, 5498},
-	{0x5624, 5497},
-	{0x5626, 0},
-	{0x5627, 5501},
-	{0x5629, 8012},
-	{0x562b, 0},
-	{0x562c, 5506},
-	{0x562d, 5502},
-	{0x562e, 9080},
-	{0x562f, 8655},
-	{0x5630, 9064},
-	{0x5631, 4597},
-	{0x5632, 1237},
-	{0x5634, 4681},
-	{0x5635, 9073},
-	{0x5636, 3504},
-	{0x5638, 9065},
-	{0x5639, 5504},
-	{0x563b, 3850},
-	{0x563d, 0},
-	{0x563e, 1},
-	{0x563f, 1936},
-	{0x5641, 9844},
-	{0x5643, 0},
-	{0x5644, 1},
-	{0x5645, 2},
-	{0x5646, 3},
-	{0x5647, 4},
-	{0x5648, 5},
-	{0x5649, 6},
-	{0x564a, 7},
-	{0x564b, 8},
-	{0x564c, 5511},
-	{0x564d, 5507},
-	{0x564e, 4148},
-	{0x5650, 0},
-	{0x5651, 1},
-	{0x5652, 2},
-	{0x5653, 3},
-	{0x5654, 5512},
-	{0x5656, 0},
-	{0x5657, 5505},
-	{0x5658, 5503},
-	{0x5659, 5509},
-	{0x565b, 0},
-	{0x565c, 5510},
-	{0x565d, 9071},
-	{0x565f, 0},
-	{0x5660, 9072},
-	{0x5662, 5508},
-	{0x5664, 5514},
-	{0x5665, 9078},
-	{0x5666, 9075},
-	{0x5668, 3094},
-	{0x5669, 4706},
-	{0x566a, 4398},
-	{0x566b, 5516},
-	{0x566c, 3424},
-	{0x566e, 0},
-	{0x566f, 9087},
-	{0x5671, 5515},
-	{0x5672, 9076},
-	{0x5674, 8373},
-	{0x5676, 1724},
-	{0x5678, 7899},
-	{0x5679, 9842},
-	{0x567b, 5517},
-	{0x567c, 5518},
-	{0x567e, 0},
-	{0x567f, 1},
-	{0x5680, 9070},
-	{0x5682, 0},
-	{0x5683, 1},
-	{0x5684, 2},
-	{0x5685, 5519},
-	{0x5686, 5513},
-	{0x5687, 8631},
-	{0x5689, 0},
-	{0x568a, 1},
-	{0x568b, 2},
-	{0x568c, 9077},
-	{0x568e, 1910},
-	{0x568f, 3642},
-	{0x5691, 0},
-	{0x5692, 1},
-	{0x5693, 5520},
-	{0x5695, 9090},
-	{0x5697, 0},
-	{0x5698, 1},
-	{0x5699, 8350},
-	{0x569b, 0},
-	{0x569c, 1},
-	{0x569d, 2},
-	{0x569e, 3},
-	{0x569f, 4},
-	{0x56a0, 5},
-	{0x56a1, 6},
-	{0x56a2, 7},
-	{0x56a3, 3942},
-	{0x56a5, 0},
-	{0x56a6, 9067},
-	{0x56a8, 8249},
-	{0x56aa, 0},
-	{0x56ab, 1},
-	{0x56ac, 2},
-	{0x56ad, 3},
-	{0x56ae, 9887},
-	{0x56af, 5521},
-	{0x56b1, 0},
-	{0x56b2, 1},
-	{0x56b3, 9085},
-	{0x56b4, 8693},
-	{0x56b6, 9089},
-	{0x56b7, 3229},
-	{0x56b9, 0},
-	{0x56ba, 1},
-	{0x56bb, 2},
-	{0x56bc, 2193},
-	{0x56be, 0},
-	{0x56bf, 1},
-	{0x56c0, 9083},
-	{0x56c1, 9086},
-	{0x56c2, 8652},
-	{0x56c4, 0},
-	{0x56c5, 8923},
-	{0x56c7, 0},
-	{0x56c8, 9066},
-	{0x56c9, 9865},
-	{0x56ca, 2869},
-	{0x56cc, 9879},
-	{0x56ce, 0},
-	{0x56cf, 1},
-	{0x56d0, 2},
-	{0x56d1, 8865},
-	{0x56d3, 0},
-	{0x56d4, 5522},
-	{0x56d6, 0},
-	{0x56d7, 5523},
-	{0x56d9, 0},
-	{0x56da, 3185},
-	{0x56db, 3513},
-	{0x56dd, 5524},
-	{0x56de, 2029},
-	{0x56df, 4716},
-	{0x56e0, 4217},
-	{0x56e1, 5525},
-	{0x56e2, 3702},
-	{0x56e4, 1561},
-	{0x56e6, 0},
-	{0x56e7, 1},
-	{0x56e8, 2},
-	{0x56e9, 3},
-	{0x56ea, 4},
-	{0x56eb, 5527},
-	{0x56ed, 4339},
-	{0x56ef, 0},
-	{0x56f0, 2450},
-	{0x56f1, 1364},
-	{0x56f3, 0},
-	{0x56f4, 3766},
-	{0x56f5, 5526},
-	{0x56f7, 0},
-	{0x56f8, 1},
-	{0x56f9, 5528},
-	{0x56fa, 1829},
-	{0x56fc, 0},
-	{0x56fd, 1875},
-	{0x56fe, 3693},
-	{0x56ff, 5529},
-	{0x5701, 0},
-	{0x5702, 1},
-	{0x5703, 3059},
-	{0x5704, 5530},
-	{0x5706, 4341},
-	{0x5707, 9091},
-	{0x5708, 3201},
-	{0x5709, 5532},
-	{0x570a, 5531},
-	{0x570b, 7997},
-	{0x570d, 8591},
-	{0x570f, 0},
-	{0x5710, 1},
-	{0x5711, 2},
-	{0x5712, 8774},
-	{0x5713, 8776},
-	{0x5715, 0},
-	{0x5716, 8574},
-	{0x5718, 8576},
-	{0x571a, 0},
-	{0x571b, 1},
-	{0x571c, 5533},
-	{0x571e, 0},
-	{0x571f, 3698},
-	{0x5721, 0},
-	{0x5722, 1},
-	{0x5723, 3388},
-	{0x5725, 0},
-	{0x5726, 1},
-	{0x5727, 2},
-	{0x5728, 4381},
-	{0x5729, 5031},
-	{0x572a, 5033},
-	{0x572c, 5032},
-	{0x572d, 1856},
-	{0x572e, 5036},
-	{0x572f, 5037},
-	{0x5730, 1465},
-	{0x5732, 0},
-	{0x5733, 5034},
-	{0x5735, 0},
-	{0x5736, 1},
-	{0x5737, 2},
-	{0x5738, 3},
-	{0x5739, 5035},
-	{0x573a, 1222},
-	{0x573b, 5039},
-	{0x573d, 0},
-	{0x573e, 2061},
-	{0x5740, 4534},
-	{0x5742, 5040},
-	{0x5744, 0},
-	{0x5745, 1},
-	{0x5746, 2},
-	{0x5747, 2344},
-	{0x5749, 0},
-	{0x574a, 1624},
-	{0x574c, 5024},
-	{0x574d, 3585},
-	{0x574e, 2367},
-	{0x574f, 1994},
-	{0x5750, 4693},
-	{0x5751, 2400},
-	{0x5753, 0},
-	{0x5754, 1},
-	{0x5755, 2},
-	{0x5756, 3},
-	{0x5757, 2422},
-	{0x5759, 0},
-	{0x575a, 2132},
-	{0x575b, 3590},
-	{0x575c, 5038},
-	{0x575d, 990},
-	{0x575e, 3834},
-	{0x575f, 1653},
-	{0x5760, 4630},
-	{0x5761, 3041},
-	{0x5763, 0},
-	{0x5764, 2447},
-	{0x5766, 3596},
-	{0x5768, 5047},
-	{0x5769, 5041},
-	{0x576a, 3033},
-	{0x576b, 5043},
-	{0x576d, 5048},
-	{0x576f, 3000},
-	{0x5771, 0},
-	{0x5772, 1},
-	{0x5773, 5050},
-	{0x5775, 0},
-	{0x5776, 5049},
-	{0x5777, 2381},
-	{0x5779, 0},
-	{0x577a, 1},
-	{0x577b, 5046},
-	{0x577c, 5045},
-	{0x577e, 0},
-	{0x577f, 1},
-	{0x5780, 2},
-	{0x5781, 3},
-	{0x5782, 1340},
-	{0x5783, 2455},
-	{0x5784, 2633},
-	{0x5785, 5042},
-	{0x5786, 5044},
-	{0x5788, 0},
-	{0x5789, 1},
-	{0x578a, 2},
-	{0x578b, 3992},
-	{0x578c, 5053},
-	{0x578e, 0},
-	{0x578f, 1},
-	{0x5790, 2},
-	{0x5791, 3},
-	{0x5792, 2504},
-	{0x5793, 5058},
-	{0x5795, 0},
-	{0x5796, 1},
-	{0x5797, 2},
-	{0x5798, 3},
-	{0x5799, 4},
-	{0x579a, 5},
-	{0x579b, 1569},
-	{0x579d, 0},
-	{0x579e, 1},
-	{0x579f, 2},
-	{0x57a0, 5059},
-	{0x57a1, 5026},
-	{0x57a2, 1809},
-	{0x57a3, 4334},
-	{0x57a4, 5052},
-	{0x57a6, 2398},
-	{0x57a7, 5056},
-	{0x57a9, 5025},
-	{0x57ab, 1479},
-	{0x57ad, 5051},
-	{0x57ae, 2418},
-	{0x57b0, 0},
-	{0x57b1, 1},
-	{0x57b2, 5054},
-	{0x57b4, 5057},
-	{0x57b6, 0},
-	{0x57b7, 1},
-	{0x57b8, 5065},
-	{0x57ba, 0},
-	{0x57bb, 1},
-	{0x57bc, 2},
-	{0x57bd, 3},
-	{0x57be, 4},
-	{0x57bf, 5},
-	{0x57c0, 6},
-	{0x57c1, 7},
-	{0x57c2, 1786},
-	{0x57c3, 942},
-	{0x57c5, 0},
-	{0x57c6, 1},
-	{0x57c7, 2},
-	{0x57c8, 3},
-	{0x57c9, 4},
-	{0x57ca, 5},
-	{0x57cb, 2712},
-	{0x57cd, 0},
-	{0x57ce, 1260},
-	{0x57cf, 5055},
-	{0x57d1, 0},
-	{0x57d2, 5064},
-	{0x57d4, 3057},
-	{0x57d5, 5060},
-	{0x57d7, 0},
-	{0x57d8, 5061},
-	{0x57d9, 5063},
-	{0x57da, 5062},
-	{0x57dc, 0},
-	{0x57dd, 5070},
-	{0x57df, 4311},
-	{0x57e0, 1153},
-	{0x57e1, 9002},
-	{0x57e3, 0},
-	{0x57e4, 5069},
-	{0x57e6, 0},
-	{0x57e7, 1},
-	{0x57e8, 2},
-	{0x57e9, 3},
-	{0x57ea, 4},
-	{0x57eb, 5},
-	{0x57ec, 6},
-	{0x57ed, 5074},
-	{0x57ef, 5067},
-	{0x57f1, 0},
-	{0x57f2, 1},
-	{0x57f3, 2},
-	{0x57f4, 5066},
-	{0x57f6, 0},
-	{0x57f7, 8843},
-	{0x57f8, 5068},
-	{0x57f9, 2977},
-	{0x57fa, 2062},
-	{0x57fc, 0},
-	{0x57fd, 5073},
-	{0x57ff, 0},
-	{0x5800, 5075},
-	{0x5802, 3606},
-	{0x5804, 0},
-	{0x5805, 8069},
-	{0x5806, 1552},
-	{0x5807, 5196},
-	{0x5809, 0},
-	{0x580a, 8997},
-	{0x580b, 5071},
-	{0x580d, 5072},
-	{0x580f, 0},
-	{0x5810, 1},
-	{0x5811, 3122},
-	{0x5813, 0},
-	{0x5814, 1},
-	{0x5815, 1576},
-	{0x5816, 9004},
-	{0x5818, 0},
-	{0x5819, 5077},
-	{0x581b, 0},
-	{0x581c, 1},
-	{0x581d, 9006},
-	{0x581e, 5076},
-	{0x5820, 5079},
-	{0x5821, 1037},
-	{0x5823, 0},
-	{0x5824, 1453},
-	{0x5826, 0},
-	{0x5827, 1},
-	{0x5828, 2},
-	{0x5829, 3},
-	{0x582a, 2365},
-	{0x582c, 0},
-	{0x582d, 1},
-	{0x582e, 2},
-	{0x582f, 8709},
-	{0x5830, 4104},
-	{0x5831, 7736},
-	{0x5833, 0},
-	{0x5834, 7795},
-	{0x5835, 1537},
-	{0x5837, 0},
-	{0x5838, 1},
-	{0x5839, 2},
-	{0x583a, 3},
-	{0x583b, 4},
-	{0x583c, 5},
-	{0x583d, 6},
-	{0x583e, 7},
-	{0x583f, 8},
-	{0x5840, 9},
-	{0x5841, 10},
-	{0x5842, 11},
-	{0x5843, 12},
-	{0x5844, 5078},
-	{0x5846, 0},
-	{0x5847, 1},
-	{0x5848, 2},
-	{0x5849, 3},
-	{0x584a, 8163},
-	{0x584b, 9017},
-	{0x584c, 3567},
-	{0x584d, 6563},
-	{0x584f, 9003},
-	{0x5851, 3537},
-	{0x5852, 9005},
-	{0x5854, 3571},
-	{0x5856, 0},
-	{0x5857, 8575},
-	{0x5858, 3604},
-	{0x585a, 0},
-	{0x585b, 1},
-	{0x585c, 2},
-	{0x585d, 3},
-	{0x585e, 3286},
-	{0x5860, 0},
-	{0x5861, 1},
-	{0x5862, 8615},
-	{0x5864, 9007},
-	{0x5865, 5080},
-	{0x5867, 0},
-	{0x5868, 1},
-	{0x5869, 2},
-	{0x586a, 3},
-	{0x586b, 3649},
-	{0x586c, 5081},
-	{0x586e, 0},
-	{0x586f, 1},
-	{0x5870, 2},
-	{0x5871, 3},
-	{0x5872, 4},
-	{0x5873, 5},
-	{0x5874, 6},
-	{0x5875, 7805},
-	{0x5877, 0},
-	{0x5878, 1},
-	{0x5879, 8406},
-	{0x587b, 0},
-	{0x587c, 1},
-	{0x587d, 2},
-	{0x587e, 5027},
-	{0x5880, 5085},
-	{0x5881, 5082},
-	{0x5883, 2274},
-	{0x5885, 3474},
-	{0x5887, 0},
-	{0x5888, 1},
-	{0x5889, 5083},
-	{0x588a, 7874},
-	{0x588c, 0},
-	{0x588d, 1},
-	{0x588e, 2},
-	{0x588f, 3},
-	{0x5890, 4},
-	{0x5891, 5},
-	{0x5892, 3331},
-	{0x5893, 2844},
-	{0x5895, 0},
-	{0x5896, 1},
-	{0x5897, 2},
-	{0x5898, 3},
-	{0x5899, 3130},
-	{0x589a, 5084},
-	{0x589c, 8882},
-	{0x589e, 4409},
-	{0x589f, 4017},
-	{0x58a1, 0},
-	{0x58a2, 1},
-	{0x58a3, 2},
-	{0x58a4, 3},
-	{0x58a5, 4},
-	{0x58a6, 5},
-	{0x58a7, 6},
-	{0x58a8, 2830},
-	{0x58a9, 1556},
-	{0x58ab, 0},
-	{0x58ac, 1},
-	{0x58ad, 2},
-	{0x58ae, 7903},
-	{0x58b0, 0},
-	{0x58b1, 1},
-	{0x58b2, 2},
-	{0x58b3, 7929},
-	{0x58b5, 0},
-	{0x58b6, 1},
-	{0x58b7, 2},
-	{0x58b8, 3},
-	{0x58b9, 4},
-	{0x58ba, 5},
-	{0x58bb, 8409},
-	{0x58bc, 5028},
-	{0x58be, 8157},
-	{0x58c0, 0},
-	{0x58c1, 1091},
-	{0x58c3, 0},
-	{0x58c4, 1},
-	{0x58c5, 5029},
-	{0x58c7, 8551},
-	{0x58c9, 0},
-	{0x58ca, 1},
-	{0x58cb, 2},
-	{0x58cc, 3},
-	{0x58cd, 4},
-	{0x58ce, 5},
-	{0x58cf, 6},
-	{0x58d0, 7},
-	{0x58d1, 5030},
-	{0x58d3, 8685},
-	{0x58d5, 1909},
-	{0x58d7, 0},
-	{0x58d8, 8199},
-	{0x58d9, 8998},
-	{0x58da, 9001},
-	{0x58dc, 0},
-	{0x58dd, 1},
-	{0x58de, 8018},
-	{0x58df, 8251},
-	{0x58e0, 9000},
-	{0x58e2, 8999},
-	{0x58e4, 3227},
-	{0x58e6, 0},
-	{0x58e7, 1},
-	{0x58e8, 2},
-	{0x58e9, 7723},
-	{0x58eb, 3414},
-	{0x58ec, 3236},
-	{0x58ee, 4624},
-	{0x58ef, 8878},
-	{0x58f0, 3378},
-	{0x58f2, 0},
-	{0x58f3, 2388},
-	{0x58f5, 0},
-	{0x58f6, 1967},
-	{0x58f8, 0},
-	{0x58f9, 4163},
-	{0x58fa, 8009},
-	{0x58fc, 0},
-	{0x58fd, 8504},
-	{0x58ff, 0},
-	{0x5901, 0},
-	{0x5902, 5660},
-	{0x5904, 1321},
-	{0x5906, 0},
-	{0x5907, 1057},
-	{0x5909, 0},
-	{0x590a, 1},
-	{0x590b, 2},
-	{0x590c, 3},
-	{0x590d, 1711},
-	{0x590f, 3889},
-	{0x5911, 0},
-	{0x5912, 1},
-	{0x5913, 2},
-	{0x5914, 4859},
-	{0x5915, 3859},
-	{0x5916, 3731},
-	{0x5918, 0},
-	{0x5919, 4865},
-	{0x591a, 1567},
-	{0x591c, 4160},
-	{0x591e, 0},
-	{0x591f, 1812},
-	{0x5921, 0},
-	{0x5922, 8321},
-	{0x5924, 5659},
-	{0x5925, 5657},
-	{0x5927, 1398},
-	{0x5929, 3647},
-	{0x592a, 3582},
-	{0x592b, 1679},
-	{0x592d, 4712},
-	{0x592e, 4116},
-	{0x592f, 1906},
-	{0x5931, 3390},
-	{0x5933, 0},
-	{0x5934, 3688},
-	{0x5936, 0},
-	{0x5937, 4171},
-	{0x5938, 2417},
-	{0x5939, 2115},
-	{0x593a, 1568},
-	{0x593c, 5295},
-	{0x593e, 8060},
-	{0x5940, 0},
-	{0x5941, 5296},
-	{0x5942, 5004},
-	{0x5944, 4098},
-	{0x5946, 0},
-	{0x5947, 3077},
-	{0x5948, 2865},
-	{0x5949, 1675},
-	{0x594b, 1657},
-	{0x594d, 0},
-	{0x594e, 2441},
-	{0x594f, 4669},
-	{0x5951, 3092},
-	{0x5953, 0},
-	{0x5954, 1061},
-	{0x5955, 5298},
-	{0x5956, 2178},
-	{0x5957, 3626},
-	{0x5958, 5300},
-	{0x595a, 5299},
-	{0x595c, 0},
-	{0x595d, 1},
-	{0x595e, 2},
-	{0x595f, 3},
-	{0x5960, 1485},
-	{0x5962, 3350},
-	{0x5964, 0},
-	{0x5965, 973},
-	{0x5967, 0},
-	{0x5968, 1},
-	{0x5969, 9051},
-	{0x596a, 7902},
-	{0x596c, 8098},
-	{0x596e, 7930},
-	{0x5970, 0},
-	{0x5971, 1},
-	{0x5972, 2},
-	{0x5973, 2927},
-	{0x5974, 2924},
-	{0x5976, 2863},
-	{0x5978, 2140},
-	{0x5979, 3570},
-	{0x597b, 0},
-	{0x597c, 1},
-	{0x597d, 1914},
-	{0x597f, 0},
-	{0x5980, 1},
-	{0x5981, 6005},
-	{0x5982, 3266},
-	{0x5983, 6006},
-	{0x5984, 3758},
-	{0x5986, 4622},
-	{0x5987, 1721},
-	{0x5988, 2703},
-	{0x598a, 3244},
-	{0x598c, 0},
-	{0x598d, 6007},
-	{0x598f, 0},
-	{0x5990, 1},
-	{0x5991, 2},
-	{0x5992, 1545},
-	{0x5993, 2110},
-	{0x5995, 0},
-	{0x5996, 4134},
-	{0x5997, 6011},
-	{0x5999, 2803},
-	{0x599b, 0},
-	{0x599c, 1},
-	{0x599d, 8877},
-	{0x599e, 6014},
-	{0x59a0, 0},
-	{0x59a1, 1},
-	{0x59a2, 2},
-	{0x59a3, 6010},
-	{0x59a4, 6015},
-	{0x59a5, 3720},
-	{0x59a7, 0},
-	{0x59a8, 1630},
-	{0x59a9, 6008},
-	{0x59aa, 6009},
-	{0x59ab, 6013},
-	{0x59ad, 0},
-	{0x59ae, 2880},
-	{0x59af, 6018},
-	{0x59b1, 0},
-	{0x59b2, 6017},
-	{0x59b4, 0},
-	{0x59b5, 1},
-	{0x59b6, 2},
-	{0x59b7, 3},
-	{0x59b8, 4},
-	{0x59b9, 2760},
-	{0x59bb, 3069},
-	{0x59bd, 0},
-	{0x59be, 6020},
-	{0x59c0, 0},
-	{0x59c1, 1},
-	{0x59c2, 2},
-	{0x59c3, 3},
-	{0x59c4, 4},
-	{0x59c5, 5},
-	{0x59c6, 2842},
-	{0x59c8, 0},
-	{0x59c9, 1},
-	{0x59ca, 6012},
-	{0x59cb, 3411},
-	{0x59cd, 0},
-	{0x59ce, 1},
-	{0x59cf, 2},
-	{0x59d0, 2228},
-	{0x59d1, 1820},
-	{0x59d2, 6016},
-	{0x59d3, 4000},
-	{0x59d4, 3774},
-	{0x59d6, 0},
-	{0x59d7, 6019},
-	{0x59d8, 6026},
-	{0x59da, 4141},
-	{0x59dc, 2171},
-	{0x59dd, 6023},
-	{0x59df, 0},
-	{0x59e0, 1},
-	{0x59e1, 2},
-	{0x59e2, 3},
-	{0x59e3, 6025},
-	{0x59e5, 2492},
-	{0x59e7, 0},
-	{0x59e8, 4179},
-	{0x59ea, 0},
-	{0x59eb, 1},
-	{0x59ec, 2074},
-	{0x59ee, 0},
-	{0x59ef, 1},
-	{0x59f0, 2},
-	{0x59f1, 3},
-	{0x59f2, 4},
-	{0x59f3, 5},
-	{0x59f4, 6},
-	{0x59f5, 7},
-	{0x59f6, 8},
-	{0x59f7, 9},
-	{0x59f8, 10},
-	{0x59f9, 6027},
-	{0x59fb, 4221},
-	{0x59fd, 0},
-	{0x59fe, 1},
-	{0x59ff, 4648},
-	{0x5a01, 3759},
-	{0x5a03, 3727},
-	{0x5a04, 2637},
-	{0x5a05, 6021},
-	{0x5a06, 6022},
-	{0x5a07, 2192},
-	{0x5a08, 6024},
-	{0x5a09, 6029},
-	{0x5a0b, 0},
-	{0x5a0c, 6028},
-	{0x5a0e, 0},
-	{0x5a0f, 1},
-	{0x5a10, 2},
-	{0x5a11, 6032},
-	{0x5a13, 6034},
-	{0x5a15, 0},
-	{0x5a16, 1},
-	{0x5a17, 2},
-	{0x5a18, 2898},
-	{0x5a1a, 0},
-	{0x5a1b, 1},
-	{0x5a1c, 2859},
-	{0x5a1e, 0},
-	{0x5a1f, 2329},
-	{0x5a20, 3368},
-	{0x5a22, 0},
-	{0x5a23, 6033},
-	{0x5a25, 1583},
-	{0x5a27, 0},
-	{0x5a28, 1},
-	{0x5a29, 2793},
-	{0x5a2b, 0},
-	{0x5a2c, 1},
-	{0x5a2d, 2},
-	{0x5a2e, 3},
-	{0x5a2f, 4},
-	{0x5a30, 5},
-	{0x5a31, 4302},
-	{0x5a32, 6030},
-	{0x5a34, 6031},
-	{0x5a36, 3197},
-	{0x5a38, 0},
-	{0x5a39, 1},
-	{0x5a3a, 2},
-	{0x5a3b, 3},
-	{0x5a3c, 6039},
-	{0x5a3e, 0},
-	{0x5a3f, 1},
-	{0x5a40, 6035},
-	{0x5a41, 8255},
-	{0x5a43, 0},
-	{0x5a44, 1},
-	{0x5a45, 2},
-	{0x5a46, 3044},
-	{0x5a48, 0},
-	{0x5a49, 3746},
-	{0x5a4a, 6037},
-	{0x5a4c, 0},
-	{0x5a4d, 1},
-	{0x5a4e, 2},
-	{0x5a4f, 3},
-	{0x5a50, 4},
-	{0x5a51, 5},
-	{0x5a52, 6},
-	{0x5a53, 7},
-	{0x5a54, 8},
-	{0x5a55, 6038},
-	{0x5a57, 0},
-	{0x5a58, 1},
-	{0x5a59, 2},
-	{0x5a5a, 2046},
-	{0x5a5c, 0},
-	{0x5a5d, 1},
-	{0x5a5e, 2},
-	{0x5a5f, 3},
-	{0x5a60, 4},
-	{0x5a61, 5},
-	{0x5a62, 6040},
-	{0x5a64, 0},
-	{0x5a65, 1},
-	{0x5a66, 7950},
-	{0x5a67, 6036},
-	{0x5a69, 0},
-	{0x5a6a, 2466},
-	{0x5a6c, 0},
-	{0x5a6d, 9209},
-	{0x5a6f, 0},
-	{0x5a70, 1},
-	{0x5a71, 2},
-	{0x5a72, 3},
-	{0x5a73, 4},
-	{0x5a74, 4233},
-	{0x5a75, 6041},
-	{0x5a76, 3373},
-	{0x5a77, 6045},
-	{0x5a79, 0},
-	{0x5a7a, 6046},
-	{0x5a7c, 0},
-	{0x5a7d, 1},
-	{0x5a7e, 2},
-	{0x5a7f, 4033},
-	{0x5a81, 0},
-	{0x5a82, 1},
-	{0x5a83, 2},
-	{0x5a84, 3},
-	{0x5a85, 4},
-	{0x5a86, 5},
-	{0x5a87, 6},
-	{0x5a88, 7},
-	{0x5a89, 8},
-	{0x5a8a, 9},
-	{0x5a8b, 10},
-	{0x5a8c, 11},
-	{0x5a8d, 12},
-	{0x5a8e, 13},
-	{0x5a8f, 14},
-	{0x5a90, 15},
-	{0x5a91, 16},
-	{0x5a92, 2754},
-	{0x5a94, 0},
-	{0x5a95, 1},
-	{0x5a96, 2},
-	{0x5a97, 3},
-	{0x5a98, 4},
-	{0x5a99, 5},
-	{0x5a9a, 2761},
-	{0x5a9b, 6044},
-	{0x5a9d, 0},
-	{0x5a9e, 1},
-	{0x5a9f, 2},
-	{0x5aa0, 3},
-	{0x5aa1, 4},
-	{0x5aa2, 5},
-	{0x5aa3, 6},
-	{0x5aa4, 7},
-	{0x5aa5, 8},
-	{0x5aa6, 9},
-	{0x5aa7, 9212},
-	{0x5aa9, 0},
-	{0x5aaa, 6043},
-	{0x5aac, 0},
-	{0x5aad, 1},
-	{0x5aae, 2},
-	{0x5aaf, 3},
-	{0x5ab0, 4},
-	{0x5ab1, 5},
-	{0x5ab2, 6049},
-	{0x5ab3, 3870},
-	{0x5ab5, 6564},
-	{0x5ab7, 0},
-	{0x5ab8, 6052},
-	{0x5aba, 0},
-	{0x5abb, 1},
-	{0x5abc, 2},
-	{0x5abd, 8297},
-	{0x5abe, 6047},
-	{0x5ac0, 0},
-	{0x5ac1, 2129},
-	{0x5ac2, 3298},
-	{0x5ac4, 0},
-	{0x5ac5, 1},
-	{0x5ac6, 2},
-	{0x5ac7, 3},
-	{0x5ac8, 4},
-	{0x5ac9, 2088},
-	{0x5acb, 0},
-	{0x5acc, 3904},
-	{0x5ace, 0},
-	{0x5acf, 1},
-	{0x5ad0, 2},
-	{0x5ad1, 3},
-	{0x5ad2, 6050},
-	{0x5ad4, 6051},
-	{0x5ad6, 6056},
-	{0x5ad7, 9207},
-	{0x5ad8, 6058},
-	{0x5ada, 0},
-	{0x5adb, 1},
-	{0x5adc, 6059},
-	{0x5ade, 0},
-	{0x5adf, 1},
-	{0x5ae0, 6053},
-	{0x5ae1, 1462},
-	{0x5ae3, 6054},
-	{0x5ae5, 0},
-	{0x5ae6, 6057},
-	{0x5ae8, 0},
-	{0x5ae9, 2878},
-	{0x5aeb, 6048},
-	{0x5aed, 0},
-	{0x5aee, 1},
-	{0x5aef, 2},
-	{0x5af0, 3},
-	{0x5af1, 6055},
-	{0x5af3, 0},
-	{0x5af4, 1},
-	{0x5af5, 9206},
-	{0x5af7, 0},
-	{0x5af8, 1},
-	{0x5af9, 2},
-	{0x5afa, 3},
-	{0x5afb, 9213},
-	{0x5afd, 0},
-	{0x5afe, 1},
-	{0x5aff, 2},
-	{0x5b00, 9208},
-	{0x5b02, 0},
-	{0x5b03, 1},
-	{0x5b04, 2},
-	{0x5b05, 3},
-	{0x5b06, 4},
-	{0x5b07, 5},
-	{0x5b08, 9210},
-	{0x5b09, 6060},
-	{0x5b0b, 9214},
-	{0x5b0c, 8104},
-	{0x5b0e, 0},
-	{0x5b0f, 1},
-	{0x5b10, 2},
-	{0x5b11, 3},
-	{0x5b12, 4},
-	{0x5b13, 5},
-	{0x5b14, 6},
-	{0x5b15, 7},
-	{0x5b16, 6062},
-	{0x5b17, 6061},
-	{0x5b19, 9217},
-	{0x5b1b, 0},
-	{0x5b1c, 1},
-	{0x5b1d, 2},
-	{0x5b1e, 3},
-	{0x5b1f, 4},
-	{0x5b20, 5},
-	{0x5b21, 9215},
-	{0x5b23, 0},
-	{0x5b24, 1},
-	{0x5b25, 2},
-	{0x5b26, 3},
-	{0x5b27, 4},
-	{0x5b28, 5},
-	{0x5b29, 6},
-	{0x5b2a, 9216},
-	{0x5b2c, 0},
-	{0x5b2d, 1},
-	{0x5b2e, 2},
-	{0x5b2f, 3},
-	{0x5b30, 8737},
-	{0x5b32, 6063},
-	{0x5b34, 4876},
-	{0x5b36, 0},
-	{0x5b37, 6064},
-	{0x5b38, 8482},
-	{0x5b3a, 0},
-	{0x5b3b, 1},
-	{0x5b3c, 2},
-	{0x5b3d, 3},
-	{0x5b3e, 4},
-	{0x5b3f, 5},
-	{0x5b40, 6065},
-	{0x5b42, 0},
-	{0x5b43, 1},
-	{0x5b44, 2},
-	{0x5b45, 3},
-	{0x5b46, 4},
-	{0x5b47, 5},
-	{0x5b48, 6},
-	{0x5b49, 7},
-	{0x5b4a, 8},
-	{0x5b4b, 9},
-	{0x5b4c, 9211},
-	{0x5b4e, 0},
-	{0x5b4f, 1},
-	{0x5b50, 4656},
-	{0x5b51, 6071},
-	{0x5b53, 6072},
-	{0x5b54, 2404},
-	{0x5b55, 4371},
-	{0x5b57, 4659},
-	{0x5b58, 1385},
-	{0x5b59, 3556},
-	{0x5b5a, 6068},
-	{0x5b5b, 4729},
-	{0x5b5c, 4651},
-	{0x5b5d, 3949},
-	{0x5b5f, 2772},
-	{0x5b61, 0},
-	{0x5b62, 6073},
-	{0x5b63, 2097},
-	{0x5b64, 1819},
-	{0x5b65, 6069},
-	{0x5b66, 4048},
-	{0x5b68, 0},
-	{0x5b69, 1881},
-	{0x5b6a, 2678},
-	{0x5b6b, 8538},
-	{0x5b6c, 4705},
-	{0x5b6e, 0},
-	{0x5b6f, 1},
-	{0x5b70, 3458},
-	{0x5b71, 5994},
-	{0x5b73, 6070},
-	{0x5b75, 1682},
-	{0x5b77, 0},
-	{0x5b78, 8677},
-	{0x5b7a, 3265},
-	{0x5b7c, 0},
-	{0x5b7d, 2904},
-	{0x5b7f, 8279},
-	{0x5b80, 5934},
-	{0x5b81, 2913},
-	{0x5b83, 3569},
-	{0x5b84, 5935},
-	{0x5b85, 4429},
-	{0x5b87, 4307},
-	{0x5b88, 3439},
-	{0x5b89, 957},
-	{0x5b8b, 3523},
-	{0x5b8c, 3739},
-	{0x5b8e, 0},
-	{0x5b8f, 1953},
-	{0x5b91, 0},
-	{0x5b92, 1},
-	{0x5b93, 5937},
-	{0x5b95, 5936},
-	{0x5b97, 4663},
-	{0x5b98, 1842},
-	{0x5b99, 4581},
-	{0x5b9a, 1511},
-	{0x5b9b, 3745},
-	{0x5b9c, 4178},
-	{0x5b9d, 1039},
-	{0x5b9e, 3404},
-	{0x5ba0, 1293},
-	{0x5ba1, 3372},
-	{0x5ba2, 2394},
-	{0x5ba3, 4038},
-	{0x5ba4, 3433},
-	{0x5ba5, 5938},
-	{0x5ba6, 2007},
-	{0x5ba8, 0},
-	{0x5ba9, 1},
-	{0x5baa, 3913},
-	{0x5bab, 1797},
-	{0x5bad, 0},
-	{0x5bae, 1},
-	{0x5baf, 2},
-	{0x5bb0, 4378},
-	{0x5bb2, 0},
-	{0x5bb3, 1885},
-	{0x5bb4, 4112},
-	{0x5bb5, 3945},
-	{0x5bb6, 2117},
-	{0x5bb8, 5939},
-	{0x5bb9, 3256},
-	{0x5bbb, 0},
-	{0x5bbc, 1},
-	{0x5bbd, 2426},
-	{0x5bbe, 1119},
-	{0x5bbf, 3539},
-	{0x5bc1, 0},
-	{0x5bc2, 2104},
-	{0x5bc4, 2103},
-	{0x5bc5, 4225},
-	{0x5bc6, 2785},
-	{0x5bc7, 2409},
-	{0x5bc9, 0},
-	{0x5bca, 1},
-	{0x5bcb, 2},
-	{0x5bcc, 1718},
-	{0x5bce, 0},
-	{0x5bcf, 1},
-	{0x5bd0, 2759},
-	{0x5bd2, 1893},
-	{0x5bd3, 4325},
-	{0x5bd5, 0},
-	{0x5bd6, 1},
-	{0x5bd7, 2},
-	{0x5bd8, 3},
-	{0x5bd9, 4},
-	{0x5bda, 5},
-	{0x5bdb, 6},
-	{0x5bdc, 7},
-	{0x5bdd, 3163},
-	{0x5bde, 2834},
-	{0x5bdf, 1203},
-	{0x5be1, 1834},
-	{0x5be2, 8421},
-	{0x5be4, 5943},
-	{0x5be5, 2577},
-	{0x5be6, 8495},
-	{0x5be7, 8355},
-	{0x5be8, 4432},
-	{0x5be9, 8481},
-	{0x5beb, 8660},
-	{0x5bec, 8165},
-	{0x5bee, 5944},
-	{0x5bf0, 5946},
-	{0x5bf2, 0},
-	{0x5bf3, 1},
-	{0x5bf4, 2},
-	{0x5bf5, 7818},
-	{0x5bf6, 7735},
-	{0x5bf8, 1386},
-	{0x5bf9, 1555},
-	{0x5bfa, 3511},
-	{0x5bfb, 4057},
-	{0x5bfc, 1437},
-	{0x5bfe, 0},
-	{0x5bff, 3440},
-	{0x5c01, 1663},
-	{0x5c03, 0},
-	{0x5c04, 3357},
-	{0x5c06, 2172},
-	{0x5c07, 8094},
-	{0x5c08, 8870},
-	{0x5c09, 3789},
-	{0x5c0a, 4685},
-	{0x5c0b, 8680},
-	{0x5c0d, 7898},
-	{0x5c0e, 7865},
-	{0x5c0f, 3948},
-	{0x5c11, 3346},
-	{0x5c13, 0},
-	{0x5c14, 1594},
-	{0x5c15, 6066},
-	{0x5c16, 2133},
-	{0x5c18, 1251},
-	{0x5c1a, 3337},
-	{0x5c1c, 6067},
-	{0x5c1d, 1223},
-	{0x5c1f, 0},
-	{0x5c20, 1},
-	{0x5c21, 2},
-	{0x5c22, 5302},
-	{0x5c24, 4269},
-	{0x5c25, 5303},
-	{0x5c27, 4137},
-	{0x5c29, 0},
-	{0x5c2a, 1},
-	{0x5c2b, 2},
-	{0x5c2c, 5304},
-	{0x5c2e, 0},
-	{0x5c2f, 1},
-	{0x5c30, 2},
-	{0x5c31, 2300},
-	{0x5c33, 0},
-	{0x5c34, 5305},
-	{0x5c36, 0},
-	{0x5c37, 9052},
-	{0x5c38, 3395},
-	{0x5c39, 4227},
-	{0x5c3a, 1284},
-	{0x5c3b, 5990},
-	{0x5c3c, 2884},
-	{0x5c3d, 2256},
-	{0x5c3e, 3777},
-	{0x5c3f, 2901},
-	{0x5c40, 2309},
-	{0x5c41, 3015},
-	{0x5c42, 1194},
-	{0x5c44, 0},
-	{0x5c45, 2306},
-	{0x5c47, 0},
-	{0x5c48, 3193},
-	{0x5c49, 3646},
-	{0x5c4a, 2237},
-	{0x5c4b, 3820},
-	{0x5c4d, 0},
-	{0x5c4e, 3409},
-	{0x5c4f, 3040},
-	{0x5c50, 5992},
-	{0x5c51, 3975},
-	{0x5c53, 0},
-	{0x5c54, 1},
-	{0x5c55, 4442},
-	{0x5c57, 0},
-	{0x5c58, 1},
-	{0x5c59, 5993},
-	{0x5c5b, 0},
-	{0x5c5c, 1},
-	{0x5c5d, 2},
-	{0x5c5e, 3467},
-	{0x5c60, 3697},
-	{0x5c61, 2668},
-	{0x5c62, 8272},
-	{0x5c63, 5995},
-	{0x5c64, 7783},
-	{0x5c65, 2667},
-	{0x5c66, 5996},
-	{0x5c68, 9204},
-	{0x5c6a, 0},
-	{0x5c6b, 1},
-	{0x5c6c, 8510},
-	{0x5c6e, 6004},
-	{0x5c6f, 3710},
-	{0x5c71, 3318},
-	{0x5c73, 0},
-	{0x5c74, 1},
-	{0x5c75, 2},
-	{0x5c76, 3},
-	{0x5c77, 4},
-	{0x5c78, 5},
-	{0x5c79, 4192},
-	{0x5c7a, 5548},
-	{0x5c7c, 0},
-	{0x5c7d, 1},
-	{0x5c7e, 2},
-	{0x5c7f, 4305},
-	{0x5c81, 3551},
-	{0x5c82, 3088},
-	{0x5c84, 0},
-	{0x5c85, 1},
-	{0x5c86, 2},
-	{0x5c87, 3},
-	{0x5c88, 5552},
-	{0x5c8a, 0},
-	{0x5c8b, 1},
-	{0x5c8c, 5547},
-	{0x5c8d, 5549},
-	{0x5c8f, 0},
-	{0x5c90, 5550},
-	{0x5c91, 5555},
-	{0x5c93, 0},
-	{0x5c94, 1204},
-	{0x5c96, 5551},
-	{0x5c97, 1749},
-	{0x5c98, 5553},
-	{0x5c99, 5554},
-	{0x5c9a, 5556},
-	{0x5c9b, 1435},
-	{0x5c9c, 5557},
-	{0x5c9e, 0},
-	{0x5c9f, 1},
-	{0x5ca0, 2},
-	{0x5ca1, 7958},
-	{0x5ca2, 5559},
-	{0x5ca3, 5564},
-	{0x5ca5, 0},
-	{0x5ca6, 1},
-	{0x5ca7, 2},
-	{0x5ca8, 3},
-	{0x5ca9, 4091},
-	{0x5cab, 5562},
-	{0x5cac, 5561},
-	{0x5cad, 2612},
-	{0x5caf, 0},
-	{0x5cb0, 1},
-	{0x5cb1, 5563},
-	{0x5cb3, 4355},
-	{0x5cb5, 5558},
-	{0x5cb7, 5566},
-	{0x5cb8, 961},
-	{0x5cba, 0},
-	{0x5cbb, 1},
-	{0x5cbc, 2},
-	{0x5cbd, 5560},
-	{0x5cbf, 2438},
-	{0x5cc1, 5565},
-	{0x5cc3, 0},
-	{0x5cc4, 5567},
-	{0x5cc6, 0},
-	{0x5cc7, 1},
-	{0x5cc8, 2},
-	{0x5cc9, 3},
-	{0x5cca, 4},
-	{0x5ccb, 5570},
-	{0x5ccd, 0},
-	{0x5cce, 1},
-	{0x5ccf, 2},
-	{0x5cd0, 3},
-	{0x5cd1, 4},
-	{0x5cd2, 5568},
-	{0x5cd4, 0},
-	{0x5cd5, 1},
-	{0x5cd6, 2},
-	{0x5cd7, 3},
-	{0x5cd8, 4},
-	{0x5cd9, 4548},
-	{0x5cdb, 0},
-	{0x5cdc, 1},
-	{0x5cdd, 2},
-	{0x5cde, 3},
-	{0x5cdf, 4},
-	{0x5ce0, 5},
-	{0x5ce1, 3884},
-	{0x5ce3, 0},
-	{0x5ce4, 5569},
-	{0x5ce5, 5571},
-	{0x5ce6, 2676},
-	{0x5ce8, 1578},
-	{0x5cea, 4317},
-	{0x5cec, 0},
-	{0x5ced, 3146},
-	{0x5cef, 0},
-	{0x5cf0, 1666},
-	{0x5cf2, 0},
-	{0x5cf3, 1},
-	{0x5cf4, 9097},
-	{0x5cf6, 7863},
-	{0x5cf8, 0},
-	{0x5cf9, 1},
-	{0x5cfa, 2},
-	{0x5cfb, 2349},
-	{0x5cfd, 8628},
-	{0x5cff, 0},
-	{0x5d01, 0},
-	{0x5d02, 5572},
-	{0x5d03, 5573},
-	{0x5d05, 0},
-	{0x5d06, 5579},
-	{0x5d07, 1292},
-	{0x5d09, 0},
-	{0x5d0a, 1},
-	{0x5d0b, 2},
-	{0x5d0c, 3},
-	{0x5d0d, 9103},
-	{0x5d0e, 3080},
-	{0x5d10, 0},
-	{0x5d11, 1},
-	{0x5d12, 2},
-	{0x5d13, 3},
-	{0x5d14, 1377},
-	{0x5d16, 4075},
-	{0x5d17, 7962},
-	{0x5d19, 0},
-	{0x5d1a, 1},
-	{0x5d1b, 5580},
-	{0x5d1d, 0},
-	{0x5d1e, 5578},
-	{0x5d20, 0},
-	{0x5d21, 1},
-	{0x5d22, 2},
-	{0x5d23, 3},
-	{0x5d24, 5577},
-	{0x5d26, 5575},
-	{0x5d27, 5574},
-	{0x5d29, 1065},
-	{0x5d2b, 0},
-	{0x5d2c, 9099},
-	{0x5d2d, 4441},
-	{0x5d2e, 5576},
-	{0x5d30, 0},
-	{0x5d31, 1},
-	{0x5d32, 2},
-	{0x5d33, 3},
-	{0x5d34, 5583},
-	{0x5d36, 0},
-	{0x5d37, 1},
-	{0x5d38, 2},
-	{0x5d39, 3},
-	{0x5d3a, 4},
-	{0x5d3b, 5},
-	{0x5d3c, 6},
-	{0x5d3d, 5584},
-	{0x5d3e, 5582},
-	{0x5d40, 0},
-	{0x5d41, 1},
-	{0x5d42, 2},
-	{0x5d43, 3},
-	{0x5d44, 4},
-	{0x5d45, 5},
-	{0x5d46, 6},
-	{0x5d47, 6946},
-	{0x5d49, 0},
-	{0x5d4a, 5591},
-	{0x5d4b, 5590},
-	{0x5d4c, 3123},
-	{0x5d4e, 0},
-	{0x5d4f, 1},
-	{0x5d50, 9098},
-	{0x5d52, 0},
-	{0x5d53, 1},
-	{0x5d54, 2},
-	{0x5d55, 3},
-	{0x5d56, 4},
-	{0x5d57, 5},
-	{0x5d58, 5581},
-	{0x5d5a, 0},
-	{0x5d5b, 5586},
-	{0x5d5d, 5588},
-	{0x5d5f, 0},
-	{0x5d60, 1},
-	{0x5d61, 2},
-	{0x5d62, 3},
-	{0x5d63, 4},
-	{0x5d64, 5},
-	{0x5d65, 6},
-	{0x5d66, 7},
-	{0x5d67, 8},
-	{0x5d68, 9},
-	{0x5d69, 5592},
-	{0x5d6b, 5589},
-	{0x5d6c, 5585},
-	{0x5d6e, 0},
-	{0x5d6f, 5587},
-	{0x5d71, 0},
-	{0x5d72, 1},
-	{0x5d73, 2},
-	{0x5d74, 5593},
-	{0x5d76, 0},
-	{0x5d77, 1},
-	{0x5d78, 2},
-	{0x5d79, 3},
-	{0x5d7a, 4},
-	{0x5d7b, 5},
-	{0x5d7c, 6},
-	{0x5d7d, 7},
-	{0x5d7e, 8},
-	{0x5d7f, 9},
-	{0x5d80, 10},
-	{0x5d81, 9105},
-	{0x5d82, 5594},
-	{0x5d84, 8817},
-	{0x5d86, 0},
-	{0x5d87, 9096},
-	{0x5d89, 0},
-	{0x5d8a, 1},
-	{0x5d8b, 2},
-	{0x5d8c, 3},
-	{0x5d8d, 4},
-	{0x5d8e, 5},
-	{0x5d8f, 6},
-	{0x5d90, 7},
-	{0x5d91, 8},
-	{0x5d92, 9},
-	{0x5d93, 10},
-	{0x5d94, 11},
-	{0x5d95, 12},
-	{0x5d96, 13},
-	{0x5d97, 9102},
-	{0x5d99, 5595},
-	{0x5d9b, 0},
-	{0x5d9c, 1},
-	{0x5d9d, 5596},
-	{0x5d9f, 0},
-	{0x5da0, 9101},
-	{0x5da2, 0},
-	{0x5da3, 1},
-	{0x5da4, 2},
-	{0x5da5, 3},
-	{0x5da6, 4},
-	{0x5da7, 9100},
-	{0x5da9, 0},
-	{0x5daa, 1},
-	{0x5dab, 2},
-	{0x5dac, 3},
-	{0x5dad, 4},
-	{0x5dae, 5},
-	{0x5daf, 6},
-	{0x5db0, 7},
-	{0x5db1, 8},
-	{0x5db2, 9},
-	{0x5db3, 10},
-	{0x5db4, 11},
-	{0x5db5, 12},
-	{0x5db6, 13},
-	{0x5db7, 5598},
-	{0x5db8, 9104},
-	{0x5dba, 8243},
-	{0x5dbc, 8764},
-	{0x5dbe, 0},
-	{0x5dbf, 1},
-	{0x5dc0, 2},
-	{0x5dc1, 3},
-	{0x5dc2, 4},
-	{0x5dc3, 5},
-	{0x5dc4, 6},
-	{0x5dc5, 5599},
-	{0x5dc7, 0},
-	{0x5dc8, 1},
-	{0x5dc9, 2},
-	{0x5dca, 3},
-	{0x5dcb, 8169},
-	{0x5dcd, 3760},
-	{0x5dcf, 0},
-	{0x5dd0, 1},
-	{0x5dd1, 2},
-	{0x5dd2, 8277},
-	{0x5dd4, 9106},
-	{0x5dd6, 0},
-	{0x5dd7, 1},
-	{0x5dd8, 2},
-	{0x5dd9, 3},
-	{0x5dda, 4},
-	{0x5ddb, 6165},
-	{0x5ddd, 1323},
-	{0x5dde, 4572},
-	{0x5de0, 0},
-	{0x5de1, 4059},
-	{0x5de2, 1239},
-	{0x5de4, 0},
-	{0x5de5, 1789},
-	{0x5de6, 4688},
-	{0x5de7, 3142},
-	{0x5de8, 2317},
-	{0x5de9, 1799},
-	{0x5deb, 3814},
-	{0x5ded, 0},
-	{0x5dee, 1205},
-	{0x5def, 5023},
-	{0x5df0, 8996},
-	{0x5df1, 2093},
-	{0x5df2, 4184},
-	{0x5df3, 3517},
-	{0x5df4, 984},
-	{0x5df6, 0},
-	{0x5df7, 3932},
-	{0x5df9, 0},
-	{0x5dfa, 1},
-	{0x5dfb, 2},
-	{0x5dfc, 3},
-	{0x5dfd, 4855},
-	{0x5dfe, 2238},
-	{0x5e01, 1083},
-	{0x5e02, 3431},
-	{0x5e03, 1155},
-	{0x5e05, 3484},
-	{0x5e06, 1608},
-	{0x5e08, 3389},
-	{0x5e0a, 0},
-	{0x5e0b, 1},
-	{0x5e0c, 3856},
-	{0x5e0e, 0},
-	{0x5e0f, 5534},
-	{0x5e10, 4459},
-	{0x5e11, 5537},
-	{0x5e13, 0},
-	{0x5e14, 5536},
-	{0x5e15, 2946},
-	{0x5e16, 3662},
-	{0x5e18, 2554},
-	{0x5e19, 5535},
-	{0x5e1a, 4578},
-	{0x5e1b, 1142},
-	{0x5e1c, 4547},
-	{0x5e1d, 1468},
-	{0x5e1f, 0},
-	{0x5e20, 1},
-	{0x5e21, 2},
-	{0x5e22, 3},
-	{0x5e23, 4},
-	{0x5e24, 5},
-	{0x5e25, 8515},
-	{0x5e26, 1403},
-	{0x5e27, 4512},
-	{0x5e29, 0},
-	{0x5e2a, 1},
-	{0x5e2b, 8489},
-	{0x5e2d, 3868},
-	{0x5e2e, 1018},
-	{0x5e30, 0},
-	{0x5e31, 5538},
-	{0x5e33, 8823},
-	{0x5e35, 0},
-	{0x5e36, 7847},
-	{0x5e37, 5541},
-	{0x5e38, 1224},
-	{0x5e3a, 0},
-	{0x5e3b, 5539},
-	{0x5e3c, 5540},
-	{0x5e3d, 2742},
-	{0x5e3f, 0},
-	{0x5e40, 8837},
-	{0x5e42, 2786},
-	{0x5e43, 9092},
-	{0x5e44, 5542},
-	{0x5e45, 1686},
-	{0x5e47, 0},
-	{0x5e48, 1},
-	{0x5e49, 2},
-	{0x5e4a, 3},
-	{0x5e4b, 4},
-	{0x5e4c, 2020},
-	{0x5e4e, 0},
-	{0x5e4f, 1},
-	{0x5e50, 2},
-	{0x5e51, 3},
-	{0x5e52, 4},
-	{0x5e53, 5},
-	{0x5e54, 5543},
-	{0x5e55, 2846},
-	{0x5e57, 9095},
-	{0x5e58, 9094},
-	{0x5e5a, 0},
-	{0x5e5b, 5544},
-	{0x5e5d, 0},
-	{0x5e5e, 5545},
-	{0x5e5f, 8848},
-	{0x5e61, 5546},
-	{0x5e62, 1332},
-	{0x5e63, 7748},
-	{0x5e65, 0},
-	{0x5e66, 1},
-	{0x5e67, 2},
-	{0x5e68, 3},
-	{0x5e69, 4},
-	{0x5e6a, 5},
-	{0x5e6b, 7730},
-	{0x5e6c, 9093},
-	{0x5e6e, 0},
-	{0x5e6f, 1},
-	{0x5e70, 2},
-	{0x5e71, 3},
-	{0x5e72, 1732},
-	{0x5e73, 3036},
-	{0x5e74, 2893},
-	{0x5e76, 1129},
-	{0x5e78, 3997},
-	{0x5e79, 7955},
-	{0x5e7a, 6163},
-	{0x5e7b, 2008},
-	{0x5e7c, 4284},
-	{0x5e7d, 4265},
-	{0x5e7e, 8051},
-	{0x5e7f, 1852},
-	{0x5e80, 5681},
-	{0x5e82, 0},
-	{0x5e83, 1},
-	{0x5e84, 4620},
-	{0x5e86, 3177},
-	{0x5e87, 1084},
-	{0x5e89, 0},
-	{0x5e8a, 1333},
-	{0x5e8b, 5683},
-	{0x5e8d, 0},
-	{0x5e8e, 1},
-	{0x5e8f, 4029},
-	{0x5e90, 2645},
-	{0x5e91, 5682},
-	{0x5e93, 2415},
-	{0x5e94, 4235},
-	{0x5e95, 1464},
-	{0x5e96, 5684},
-	{0x5e97, 1483},
-	{0x5e99, 2802},
-	{0x5e9a, 1784},
-	{0x5e9c, 1705},
-	{0x5e9e, 2964},
-	{0x5e9f, 1644},
-	{0x5ea0, 5686},
-	{0x5ea2, 0},
-	{0x5ea3, 1},
-	{0x5ea4, 2},
-	{0x5ea5, 5685},
-	{0x5ea6, 1543},
-	{0x5ea7, 4694},
-	{0x5ea9, 0},
-	{0x5eaa, 1},
-	{0x5eab, 8160},
-	{0x5ead, 3670},
-	{0x5eaf, 0},
-	{0x5eb0, 1},
-	{0x5eb1, 2},
-	{0x5eb2, 3},
-	{0x5eb3, 5690},
-	{0x5eb5, 5688},
-	{0x5eb6, 3475},
-	{0x5eb7, 2370},
-	{0x5eb8, 4254},
-	{0x5eb9, 5687},
-	{0x5ebb, 0},
-	{0x5ebc, 1},
-	{0x5ebd, 2},
-	{0x5ebe, 5689},
-	{0x5ec0, 0},
-	{0x5ec1, 1},
-	{0x5ec2, 2},
-	{0x5ec3, 3},
-	{0x5ec4, 4},
-	{0x5ec5, 5},
-	{0x5ec6, 6},
-	{0x5ec7, 7},
-	{0x5ec8, 8},
-	{0x5ec9, 2551},
-	{0x5eca, 2483},
-	{0x5ecc, 0},
-	{0x5ecd, 1},
-	{0x5ece, 2},
-	{0x5ecf, 3},
-	{0x5ed0, 4},
-	{0x5ed1, 5693},
-	{0x5ed2, 5692},
-	{0x5ed3, 2453},
-	{0x5ed5, 0},
-	{0x5ed6, 2583},
-	{0x5ed8, 0},
-	{0x5ed9, 1},
-	{0x5eda, 2},
-	{0x5edb, 5694},
-	{0x5edd, 0},
-	{0x5ede, 1},
-	{0x5edf, 8327},
-	{0x5ee0, 7800},
-	{0x5ee1, 9134},
-	{0x5ee2, 7926},
-	{0x5ee3, 7985},
-	{0x5ee5, 0},
-	{0x5ee6, 1},
-	{0x5ee7, 2},
-	{0x5ee8, 5695},
-	{0x5eea, 5696},
-	{0x5eec, 8261},
-	{0x5eee, 0},
-	{0x5eef, 1},
-	{0x5ef0, 2},
-	{0x5ef1, 3},
-	{0x5ef2, 4},
-	{0x5ef3, 8568},
-	{0x5ef4, 5016},
-	{0x5ef6, 4092},
-	{0x5ef7, 3667},
-	{0x5ef9, 0},
-	{0x5efa, 2169},
-	{0x5efc, 0},
-	{0x5efd, 1},
-	{0x5efe, 5293},
-	{0x5eff, 4699},
-	{0x5f00, 2359},
-	{0x5f01, 5021},
-	{0x5f02, 4211},
-	{0x5f03, 3097},
-	{0x5f04, 2923},
-	{0x5f06, 0},
-	{0x5f07, 1},
-	{0x5f08, 5294},
-	{0x5f0a, 1088},
-	{0x5f0b, 5366},
-	{0x5f0d, 0},
-	{0x5f0e, 1},
-	{0x5f0f, 3412},
-	{0x5f11, 5369},
-	{0x5f13, 1798},
-	{0x5f15, 4228},
-	{0x5f17, 1696},
-	{0x5f18, 1954},
-	{0x5f1a, 0},
-	{0x5f1b, 1279},
-	{0x5f1d, 0},
-	{0x5f1e, 1},
-	{0x5f1f, 1469},
-	{0x5f20, 4454},
-	{0x5f22, 0},
-	{0x5f23, 1},
-	{0x5f24, 2},
-	{0x5f25, 2779},
-	{0x5f26, 3903},
-	{0x5f27, 1974},
-	{0x5f29, 5999},
-	{0x5f2a, 5998},
-	{0x5f2c, 0},
-	{0x5f2d, 6000},
-	{0x5f2f, 3733},
-	{0x5f31, 3280},
-	{0x5f33, 9205},
-	{0x5f35, 8821},
-	{0x5f37, 0},
-	{0x5f38, 1},
-	{0x5f39, 1424},
-	{0x5f3a, 3132},
-	{0x5f3c, 6002},
-	{0x5f3e, 0},
-	{0x5f3f, 1},
-	{0x5f40, 6590},
-	{0x5f42, 0},
-	{0x5f43, 1},
-	{0x5f44, 2},
-	{0x5f45, 3},
-	{0x5f46, 9838},
-	{0x5f48, 7856},
-	{0x5f4a, 0},
-	{0x5f4b, 1},
-	{0x5f4c, 8323},
-	{0x5f4e, 8584},
-	{0x5f50, 5986},
-	{0x5f52, 1858},
-	{0x5f53, 1426},
-	{0x5f55, 2659},
-	{0x5f56, 5988},
-	{0x5f57, 5987},
-	{0x5f58, 5989},
-	{0x5f59, 9852},
-	{0x5f5b, 0},
-	{0x5f5c, 1},
-	{0x5f5d, 4180},
-	{0x5f5f, 0},
-	{0x5f60, 1},
-	{0x5f61, 5614},
-	{0x5f62, 3993},
-	{0x5f64, 3679},
-	{0x5f66, 4110},
-	{0x5f68, 0},
-	{0x5f69, 1169},
-	{0x5f6a, 1108},
-	{0x5f6c, 1115},
-	{0x5f6d, 2990},
-	{0x5f6f, 0},
-	{0x5f70, 4452},
-	{0x5f71, 4245},
-	{0x5f73, 5600},
-	{0x5f75, 0},
-	{0x5f76, 1},
-	{0x5f77, 5601},
-	{0x5f79, 4194},
-	{0x5f7b, 1246},
-	{0x5f7c, 1076},
-	{0x5f7e, 0},
-	{0x5f7f, 1},
-	{0x5f80, 3754},
-	{0x5f81, 4504},
-	{0x5f82, 5602},
-	{0x5f84, 2277},
-	{0x5f85, 1408},
-	{0x5f87, 5603},
-	{0x5f88, 1939},
-	{0x5f89, 5604},
-	{0x5f8a, 1991},
-	{0x5f8b, 2672},
-	{0x5f8c, 5605},
-	{0x5f8e, 0},
-	{0x5f8f, 1},
-	{0x5f90, 4023},
-	{0x5f91, 8133},
-	{0x5f92, 3694},
-	{0x5f94, 0},
-	{0x5f95, 5606},
-	{0x5f97, 1444},
-	{0x5f98, 2952},
-	{0x5f99, 5607},
-	{0x5f9b, 0},
-	{0x5f9c, 5608},
-	{0x5f9e, 7841},
-	{0x5fa0, 9107},
-	{0x5fa1, 4318},
-	{0x5fa3, 0},
-	{0x5fa4, 1},
-	{0x5fa5, 2},
-	{0x5fa6, 3},
-	{0x5fa7, 4},
-	{0x5fa8, 5609},
-	{0x5fa9, 7947},
-	{0x5faa, 4054},
-	{0x5fac, 0},
-	{0x5fad, 5610},
-	{0x5fae, 3761},
-	{0x5fb0, 0},
-	{0x5fb1, 1},
-	{0x5fb2, 2},
-	{0x5fb3, 3},
-	{0x5fb4, 4},
-	{0x5fb5, 5611},
-	{0x5fb7, 1443},
-	{0x5fb9, 7804},
-	{0x5fbb, 0},
-	{0x5fbc, 5612},
-	{0x5fbd, 2026},
-	{0x5fbf, 0},
-	{0x5fc0, 1},
-	{0x5fc1, 2},
-	{0x5fc2, 3},
-	{0x5fc3, 3983},
-	{0x5fc4, 5698},
-	{0x5fc5, 1089},
-	{0x5fc6, 4203},
-	{0x5fc8, 0},
-	{0x5fc9, 5699},
-	{0x5fcb, 0},
-	{0x5fcc, 2108},
-	{0x5fcd, 3239},
-	{0x5fcf, 5701},
-	{0x5fd0, 6668},
-	{0x5fd1, 6667},
-	{0x5fd2, 5367},
-	{0x5fd4, 0},
-	{0x5fd5, 1},
-	{0x5fd6, 5700},
-	{0x5fd7, 4541},
-	{0x5fd8, 3757},
-	{0x5fd9, 2731},
-	{0x5fdb, 0},
-	{0x5fdc, 1},
-	{0x5fdd, 5763},
-	{0x5fdf, 0},
-	{0x5fe0, 4561},
-	{0x5fe1, 5705},
-	{0x5fe3, 0},
-	{0x5fe4, 5706},
-	{0x5fe6, 0},
-	{0x5fe7, 4268},
-	{0x5fe9, 0},
-	{0x5fea, 5710},
-	{0x5feb, 2425},
-	{0x5fed, 5711},
-	{0x5fee, 5703},
-	{0x5ff0, 0},
-	{0x5ff1, 1253},
-	{0x5ff3, 0},
-	{0x5ff4, 1},
-	{0x5ff5, 2897},
-	{0x5ff7, 0},
-	{0x5ff8, 5712},
-	{0x5ffa, 0},
-	{0x5ffb, 3982},
-	{0x5ffd, 1965},
-	{0x5ffe, 5707},
-	{0x5fff, 1659},
-	{0x6000, 1992},
-	{0x6001, 3583},
-	{0x6002, 3520},
-	{0x6003, 5702},
-	{0x6004, 5704},
-	{0x6005, 5708},
-	{0x6006, 5709},
-	{0x6008, 0},
-	{0x6009, 1},
-	{0x600a, 5721},
-	{0x600c, 0},
-	{0x600d, 5718},
-	{0x600e, 4408},
-	{0x600f, 5717},
-	{0x6011, 0},
-	{0x6012, 2926},
-	{0x6014, 4507},
-	{0x6015, 2947},
-	{0x6016, 1159},
-	{0x6018, 0},
-	{0x6019, 5713},
-	{0x601b, 5716},
-	{0x601c, 2552},
-	{0x601d, 3505},
-	{0x601f, 0},
-	{0x6020, 1410},
-	{0x6021, 5723},
-	{0x6023, 0},
-	{0x6024, 1},
-	{0x6025, 2084},
-	{0x6026, 5715},
-	{0x6027, 3999},
-	{0x6028, 4348},
-	{0x6029, 5719},
-	{0x602a, 1839},
-	{0x602b, 5720},
-	{0x602d, 0},
-	{0x602e, 1},
-	{0x602f, 3152},
-	{0x6031, 0},
-	{0x6032, 1},
-	{0x6033, 2},
-	{0x6034, 3},
-	{0x6035, 5714},
-	{0x6037, 0},
-	{0x6038, 1},
-	{0x6039, 2},
-	{0x603a, 3},
-	{0x603b, 4665},
-	{0x603c, 6669},
-	{0x603e, 0},
-	{0x603f, 5722},
-	{0x6041, 6673},
-	{0x6042, 5728},
-	{0x6043, 3432},
-	{0x6045, 0},
-	{0x6046, 1},
-	{0x6047, 2},
-	{0x6048, 3},
-	{0x6049, 4},
-	{0x604a, 5},
-	{0x604b, 2558},
-	{0x604d, 2021},
-	{0x604f, 0},
-	{0x6050, 2403},
-	{0x6052, 1946},
-	{0x6054, 0},
-	{0x6055, 3478},
-	{0x6057, 0},
-	{0x6058, 1},
-	{0x6059, 6674},
-	{0x605a, 6671},
-	{0x605c, 0},
-	{0x605d, 6670},
-	{0x605f, 0},
-	{0x6060, 1},
-	{0x6061, 2},
-	{0x6062, 2027},
-	{0x6063, 6675},
-	{0x6064, 4031},
-	{0x6066, 0},
-	{0x6067, 6672},
-	{0x6068, 1941},
-	{0x6069, 1590},
-	{0x606a, 5729},
-	{0x606b, 1521},
-	{0x606c, 3652},
-	{0x606d, 1792},
-	{0x606f, 3855},
-	{0x6070, 3102},
-	{0x6072, 0},
-	{0x6073, 2399},
-	{0x6075, 0},
-	{0x6076, 1584},
-	{0x6078, 5724},
-	{0x6079, 5725},
-	{0x607a, 5727},
-	{0x607b, 5726},
-	{0x607c, 2872},
-	{0x607d, 5730},
-	{0x607f, 4262},
-	{0x6081, 0},
-	{0x6082, 1},
-	{0x6083, 5735},
-	{0x6084, 3137},
-	{0x6086, 0},
-	{0x6087, 1},
-	{0x6088, 2},
-	{0x6089, 3857},
-	{0x608b, 0},
-	{0x608c, 5737},
-	{0x608d, 1902},
-	{0x608f, 0},
-	{0x6090, 1},
-	{0x6091, 2},
-	{0x6092, 5736},
-	{0x6094, 2031},
-	{0x6096, 5731},
-	{0x6098, 0},
-	{0x6099, 1},
-	{0x609a, 5732},
-	{0x609b, 5738},
-	{0x609d, 5734},
-	{0x609f, 3841},
-	{0x60a0, 4267},
-	{0x60a2, 0},
-	{0x60a3, 2001},
-	{0x60a5, 0},
-	{0x60a6, 4358},
-	{0x60a8, 2909},
-	{0x60aa, 0},
-	{0x60ab, 6676},
-	{0x60ac, 4039},
-	{0x60ad, 5733},
-	{0x60af, 2810},
-	{0x60b1, 5741},
-	{0x60b2, 1048},
-	{0x60b4, 5746},
-	{0x60b5, 9140},
-	{0x60b6, 8318},
-	{0x60b8, 2101},
-	{0x60ba, 0},
-	{0x60bb, 5740},
-	{0x60bc, 1440},
-	{0x60be, 0},
-	{0x60bf, 1},
-	{0x60c0, 2},
-	{0x60c1, 3},
-	{0x60c2, 4},
-	{0x60c3, 5},
-	{0x60c4, 6},
-	{0x60c5, 3174},
-	{0x60c6, 5744},
-	{0x60c8, 0},
-	{0x60c9, 1},
-	{0x60ca, 2265},
-	{0x60cb, 3744},
-	{0x60cd, 0},
-	{0x60ce, 1},
-	{0x60cf, 2},
-	{0x60d0, 3},
-	{0x60d1, 2056},
-	{0x60d3, 0},
-	{0x60d4, 1},
-	{0x60d5, 3643},
-	{0x60d7, 0},
-	{0x60d8, 5743},
-	{0x60da, 5745},
-	{0x60dc, 3860},
-	{0x60dd, 5742},
-	{0x60df, 3768},
-	{0x60e0, 2034},
-	{0x60e1, 7907},
-	{0x60e3, 0},
-	{0x60e4, 1},
-	{0x60e5, 2},
-	{0x60e6, 1484},
-	{0x60e7, 2324},
-	{0x60e8, 1177},
-	{0x60e9, 1266},
-	{0x60eb, 1058},
-	{0x60ec, 5739},
-	{0x60ed, 1176},
-	{0x60ee, 1421},
-	{0x60ef, 1848},
-	{0x60f0, 1575},
-	{0x60f1, 8341},
-	{0x60f2, 9147},
-	{0x60f3, 3928},
-	{0x60f4, 5751},
-	{0x60f6, 2017},
-	{0x60f8, 0},
-	{0x60f9, 3234},
-	{0x60fa, 3989},
-	{0x60fb, 9145},
-	{0x60fd, 0},
-	{0x60fe, 1},
-	{0x60ff, 2},
-	{0x6100, 5752},
-	{0x6101, 1299},
-	{0x6103, 0},
-	{0x6104, 1},
-	{0x6105, 2},
-	{0x6106, 6677},
-	{0x6108, 4319},
-	{0x6109, 4297},
-	{0x610b, 0},
-	{0x610c, 1},
-	{0x610d, 6678},
-	{0x610e, 5753},
-	{0x610f, 4201},
-	{0x6111, 0},
-	{0x6112, 1},
-	{0x6113, 2},
-	{0x6114, 3},
-	{0x6115, 5749},
-	{0x6117, 0},
-	{0x6118, 1},
-	{0x6119, 2},
-	{0x611a, 4291},
-	{0x611b, 7720},
-	{0x611c, 9149},
-	{0x611e, 0},
-	{0x611f, 1739},
-	{0x6120, 5747},
-	{0x6122, 0},
-	{0x6123, 5750},
-	{0x6124, 1660},
-	{0x6126, 5748},
-	{0x6127, 2445},
-	{0x6129, 0},
-	{0x612a, 1},
-	{0x612b, 5754},
-	{0x612d, 0},
-	{0x612e, 1},
-	{0x612f, 2},
-	{0x6130, 3},
-	{0x6131, 4},
-	{0x6132, 5},
-	{0x6133, 6},
-	{0x6134, 9141},
-	{0x6136, 0},
-	{0x6137, 9146},
-	{0x6139, 0},
-	{0x613a, 1},
-	{0x613b, 2},
-	{0x613c, 3},
-	{0x613d, 4},
-	{0x613e, 9139},
-	{0x613f, 4347},
-	{0x6141, 0},
-	{0x6142, 1},
-	{0x6143, 2},
-	{0x6144, 3},
-	{0x6145, 4},
-	{0x6146, 5},
-	{0x6147, 6},
-	{0x6148, 1355},
-	{0x614a, 5755},
-	{0x614b, 8546},
-	{0x614c, 2010},
-	{0x614e, 3376},
-	{0x6150, 0},
-	{0x6151, 3358},
-	{0x6153, 0},
-	{0x6154, 1},
-	{0x6155, 2848},
-	{0x6157, 0},
-	{0x6158, 7774},
-	{0x615a, 7773},
-	{0x615c, 0},
-	{0x615d, 6679},
-	{0x615f, 9143},
-	{0x6161, 0},
-	{0x6162, 2724},
-	{0x6163, 7983},
-	{0x6164, 9439},
-	{0x6166, 0},
-	{0x6167, 2032},
-	{0x6168, 2363},
-	{0x616a, 9138},
-	{0x616b, 8526},
-	{0x616d, 0},
-	{0x616e, 8274},
-	{0x6170, 3790},
-	{0x6172, 0},
-	{0x6173, 9148},
-	{0x6175, 5756},
-	{0x6176, 8427},
-	{0x6177, 2371},
-	{0x6179, 0},
-	{0x617a, 1},
-	{0x617b, 2},
-	{0x617c, 3},
-	{0x617d, 4},
-	{0x617e, 5},
-	{0x617f, 6},
-	{0x6180, 7},
-	{0x6181, 8},
-	{0x6182, 8754},
-	{0x6184, 0},
-	{0x6185, 1},
-	{0x6186, 2},
-	{0x6187, 3},
-	{0x6188, 4},
-	{0x6189, 5},
-	{0x618a, 7743},
-	{0x618b, 1112},
-	{0x618d, 0},
-	{0x618e, 4410},
-	{0x6190, 8219},
-	{0x6191, 8380},
-	{0x6192, 9150},
-	{0x6194, 5758},
-	{0x6196, 0},
-	{0x6197, 1},
-	{0x6198, 2},
-	{0x6199, 3},
-	{0x619a, 7854},
-	{0x619c, 0},
-	{0x619d, 6681},
-	{0x619f, 0},
-	{0x61a0, 1},
-	{0x61a1, 2},
-	{0x61a2, 3},
-	{0x61a3, 4},
-	{0x61a4, 7931},
-	{0x61a6, 0},
-	{0x61a7, 5759},
-	{0x61a8, 1888},
-	{0x61a9, 6680},
-	{0x61ab, 8329},
-	{0x61ac, 5757},
-	{0x61ae, 9137},
-	{0x61b0, 0},
-	{0x61b1, 1},
-	{0x61b2, 8644},
-	{0x61b4, 0},
-	{0x61b5, 1},
-	{0x61b6, 8724},
-	{0x61b7, 5760},
-	{0x61b9, 0},
-	{0x61ba, 1},
-	{0x61bb, 2},
-	{0x61bc, 3},
-	{0x61bd, 4},
-	{0x61be, 1901},
-	{0x61c0, 0},
-	{0x61c1, 1},
-	{0x61c2, 1517},
-	{0x61c4, 0},
-	{0x61c5, 1},
-	{0x61c6, 2},
-	{0x61c7, 8158},
-	{0x61c8, 3971},
-	{0x61c9, 8739},
-	{0x61ca, 974},
-	{0x61cb, 6682},
-	{0x61cc, 9142},
-	{0x61ce, 0},
-	{0x61cf, 1},
-	{0x61d0, 2},
-	{0x61d1, 6683},
-	{0x61d2, 2476},
-	{0x61d4, 5761},
-	{0x61d6, 0},
-	{0x61d7, 1},
-	{0x61d8, 2},
-	{0x61d9, 3},
-	{0x61da, 4},
-	{0x61db, 5},
-	{0x61dc, 6},
-	{0x61dd, 7},
-	{0x61de, 9868},
-	{0x61df, 9438},
-	{0x61e1, 0},
-	{0x61e2, 1},
-	{0x61e3, 9440},
-	{0x61e5, 0},
-	{0x61e6, 2932},
-	{0x61e8, 9144},
-	{0x61ea, 0},
-	{0x61eb, 1},
-	{0x61ec, 2},
-	{0x61ed, 3},
-	{0x61ee, 4},
-	{0x61ef, 5},
-	{0x61f0, 6},
-	{0x61f1, 7},
-	{0x61f2, 7809},
-	{0x61f4, 0},
-	{0x61f5, 5762},
-	{0x61f6, 8190},
-	{0x61f7, 8017},
-	{0x61f8, 8673},
-	{0x61fa, 9136},
-	{0x61fc, 8142},
-	{0x61fe, 8478},
-	{0x61ff, 5088},
-	{0x6200, 8225},
-	{0x6202, 0},
-	{0x6203, 1},
-	{0x6204, 2},
-	{0x6205, 3},
-	{0x6206, 6684},
-	{0x6207, 9441},
-	{0x6208, 1765},
-	{0x620a, 3835},
-	{0x620b, 6393},
-	{0x620c, 4018},
-	{0x620d, 3472},
-	{0x620e, 3249},
-	{0x620f, 3876},
-	{0x6210, 1262},
-	{0x6211, 3809},
-	{0x6212, 2229},
-	{0x6214, 9379},
-	{0x6215, 5790},
-	{0x6216, 2055},
-	{0x6217, 6394},
-	{0x6218, 4446},
-	{0x621a, 3068},
-	{0x621b, 6395},
-	{0x621d, 0},
-	{0x621e, 1},
-	{0x621f, 6396},
-	{0x6221, 6398},
-	{0x6222, 6397},
-	{0x6224, 6400},
-	{0x6225, 6399},
-	{0x6227, 9380},
-	{0x6229, 0},
-	{0x622a, 2217},
-	{0x622c, 6401},
-	{0x622e, 2661},
-	{0x6230, 8819},
-	{0x6232, 8624},
-	{0x6233, 1348},
-	{0x6234, 1402},
-	{0x6236, 0},
-	{0x6237, 1980},
-	{0x6239, 0},
-	{0x623a, 1},
-	{0x623b, 2},
-	{0x623c, 3},
-	{0x623d, 6644},
-	{0x623e, 6643},
-	{0x623f, 1628},
-	{0x6240, 3566},
-	{0x6241, 1099},
-	{0x6243, 6645},
-	{0x6245, 0},
-	{0x6246, 1},
-	{0x6247, 3329},
-	{0x6248, 6646},
-	{0x6249, 6647},
-	{0x624b, 3437},
-	{0x624c, 5306},
-	{0x624d, 1164},
-	{0x624e, 4413},
-	{0x6250, 0},
-	{0x6251, 3050},
-	{0x6252, 978},
-	{0x6253, 1397},
-	{0x6254, 3246},
-	{0x6256, 0},
-	{0x6257, 1},
-	{0x6258, 3713},
-	{0x625a, 0},
-	{0x625b, 2373},
-	{0x625d, 0},
-	{0x625e, 1},
-	{0x625f, 2},
-	{0x6260, 3},
-	{0x6261, 4},
-	{0x6262, 5},
-	{0x6263, 2408},
-	{0x6265, 0},
-	{0x6266, 3105},
-	{0x6267, 4531},
-	{0x6269, 2452},
-	{0x626a, 5307},
-	{0x626b, 3297},
-	{0x626c, 4120},
-	{0x626d, 2917},
-	{0x626e, 1010},
-	{0x626f, 1243},
-	{0x6270, 3232},
-	{0x6272, 0},
-	{0x6273, 1005},
-	{0x6275, 0},
-	{0x6276, 1683},
-	{0x6278, 0},
-	{0x6279, 3003},
-	{0x627b, 0},
-	{0x627c, 1586},
-	{0x627e, 4467},
-	{0x627f, 1269},
-	{0x6280, 2095},
-	{0x6282, 0},
-	{0x6283, 1},
-	{0x6284, 1234},
-	{0x6286, 0},
-	{0x6287, 1},
-	{0x6288, 2},
-	{0x6289, 2336},
-	{0x628a, 988},
-	{0x628c, 0},
-	{0x628d, 1},
-	{0x628e, 2},
-	{0x628f, 3},
-	{0x6290, 4},
-	{0x6291, 4189},
-	{0x6292, 3450},
-	{0x6293, 4610},
-	{0x6295, 3687},
-	{0x6296, 1525},
-	{0x6297, 2374},
-	{0x6298, 4476},
-	{0x629a, 1698},
-	{0x629b, 2968},
-	{0x629d, 0},
-	{0x629e, 1},
-	{0x629f, 5308},
-	{0x62a0, 2406},
-	{0x62a1, 2684},
-	{0x62a2, 3133},
-	{0x62a4, 1977},
-	{0x62a5, 1041},
-	{0x62a7, 0},
-	{0x62a8, 2987},
-	{0x62aa, 0},
-	{0x62ab, 3004},
-	{0x62ac, 3578},
-	{0x62ae, 0},
-	{0x62af, 1},
-	{0x62b0, 2},
-	{0x62b1, 1040},
-	{0x62b3, 0},
-	{0x62b4, 1},
-	{0x62b5, 1463},
-	{0x62b7, 0},
-	{0x62b8, 1},
-	{0x62b9, 2827},
-	{0x62bb, 5309},
-	{0x62bc, 4067},
-	{0x62bd, 1294},
-	{0x62bf, 2807},
-	{0x62c1, 0},
-	{0x62c2, 1684},
-	{0x62c4, 4595},
-	{0x62c5, 1412},
-	{0x62c6, 1207},
-	{0x62c7, 2839},
-	{0x62c8, 2892},
-	{0x62c9, 2456},
-	{0x62ca, 5310},
-	{0x62cc, 1011},
-	{0x62cd, 2949},
-	{0x62ce, 2601},
-	{0x62d0, 1838},
-	{0x62d2, 2315},
-	{0x62d3, 3721},
-	{0x62d4, 985},
-	{0x62d6, 3712},
-	{0x62d7, 5312},
-	{0x62d8, 2303},
-	{0x62d9, 4635},
-	{0x62da, 5311},
-	{0x62db, 4465},
-	{0x62dc, 1000},
-	{0x62de, 0},
-	{0x62df, 2885},
-	{0x62e1, 0},
-	{0x62e2, 2634},
-	{0x62e3, 2147},
-	{0x62e5, 4250},
-	{0x62e6, 2468},
-	{0x62e7, 2914},
-	{0x62e8, 1133},
-	{0x62e9, 4404},
-	{0x62eb, 0},
-	{0x62ec, 2451},
-	{0x62ed, 3418},
-	{0x62ee, 5313},
-	{0x62ef, 4509},
-	{0x62f1, 1801},
-	{0x62f3, 3208},
-	{0x62f4, 3486},
-	{0x62f6, 5315},
-	{0x62f7, 2378},
-	{0x62f9, 0},
-	{0x62fa, 1},
-	{0x62fb, 2},
-	{0x62fc, 3027},
-	{0x62fd, 4612},
-	{0x62fe, 3399},
-	{0x62ff, 2854},
-	{0x6301, 1275},
-	{0x6302, 1835},
-	{0x6304, 0},
-	{0x6305, 1},
-	{0x6306, 2},
-	{0x6307, 4535},
-	{0x6308, 6478},
-	{0x6309, 959},
-	{0x630b, 0},
-	{0x630c, 1},
-	{0x630d, 2},
-	{0x630e, 2419},
-	{0x6310, 0},
-	{0x6311, 3655},
-	{0x6313, 0},
-	{0x6314, 1},
-	{0x6315, 2},
-	{0x6316, 3723},
-	{0x6318, 0},
-	{0x6319, 1},
-	{0x631a, 4542},
-	{0x631b, 2677},
-	{0x631d, 3805},
-	{0x631e, 3573},
-	{0x631f, 3961},
-	{0x6320, 2870},
-	{0x6321, 1427},
-	{0x6322, 5314},
-	{0x6323, 4502},
-	{0x6324, 2090},
-	{0x6325, 2024},
-	{0x6327, 0},
-	{0x6328, 943},
-	{0x632a, 2931},
-	{0x632b, 1391},
-	{0x632d, 0},
-	{0x632e, 1},
-	{0x632f, 4498},
-	{0x6331, 0},
-	{0x6332, 6479},
-	{0x6334, 0},
-	{0x6335, 1},
-	{0x6336, 2},
-	{0x6337, 3},
-	{0x6338, 4},
-	{0x6339, 5316},
-	{0x633a, 3671},
-	{0x633c, 0},
-	{0x633d, 3741},
-	{0x633e, 8657},
-	{0x6340, 0},
-	{0x6341, 1},
-	{0x6342, 3829},
-	{0x6343, 5318},
-	{0x6345, 3682},
-	{0x6346, 2449},
-	{0x6348, 0},
-	{0x6349, 4634},
-	{0x634b, 5317},
-	{0x634c, 977},
-	{0x634d, 1899},
-	{0x634e, 3340},
-	{0x634f, 2902},
-	{0x6350, 2327},
-	{0x6352, 0},
-	{0x6353, 1},
-	{0x6354, 2},
-	{0x6355, 1149},
-	{0x6357, 0},
-	{0x6358, 1},
-	{0x6359, 2},
-	{0x635a, 3},
-	{0x635b, 4},
-	{0x635c, 5},
-	{0x635d, 6},
-	{0x635e, 2487},
-	{0x635f, 3557},
-	{0x6361, 2148},
-	{0x6362, 2000},
-	{0x6363, 1432},
-	{0x6365, 0},
-	{0x6366, 1},
-	{0x6367, 2998},
-	{0x6368, 8476},
-	{0x6369, 5328},
-	{0x636b, 9053},
-	{0x636d, 5325},
-	{0x636e, 2316},
-	{0x6370, 0},
-	{0x6371, 5321},
-	{0x6372, 9858},
-	{0x6374, 0},
-	{0x6375, 1},
-	{0x6376, 1338},
-	{0x6377, 2222},
-	{0x6379, 0},
-	{0x637a, 5322},
-	{0x637b, 2896},
-	{0x637d, 0},
-	{0x637e, 1},
-	{0x637f, 2},
-	{0x6380, 3891},
-	{0x6382, 1473},
-	{0x6383, 8461},
-	{0x6384, 8282},
-	{0x6386, 0},
-	{0x6387, 1565},
-	{0x6388, 3441},
-	{0x6389, 1493},
-	{0x638a, 5327},
-	{0x638c, 4455},
-	{0x638e, 5323},
-	{0x638f, 3616},
-	{0x6390, 3101},
-	{0x6392, 2950},
-	{0x6394, 0},
-	{0x6395, 1},
-	{0x6396, 4155},
-	{0x6398, 2337},
-	{0x639a, 0},
-	{0x639b, 1},
-	{0x639c, 2},
-	{0x639d, 3},
-	{0x639e, 4},
-	{0x639f, 5},
-	{0x63a0, 2682},
-	{0x63a2, 3600},
-	{0x63a3, 1245},
-	{0x63a5, 2212},
-	{0x63a7, 2405},
-	{0x63a8, 3703},
-	{0x63a9, 4099},
-	{0x63aa, 1390},
-	{0x63ac, 5326},
-	{0x63ad, 5319},
-	{0x63ae, 5329},
-	{0x63b0, 6480},
-	{0x63b2, 0},
-	{0x63b3, 2647},
-	{0x63b4, 5324},
-	{0x63b6, 0},
-	{0x63b7, 4543},
-	{0x63b8, 1416},
-	{0x63ba, 1211},
-	{0x63bc, 5330},
-	{0x63be, 5340},
-	{0x63c0, 8077},
-	{0x63c2, 0},
-	{0x63c3, 1},
-	{0x63c4, 5335},
-	{0x63c6, 5339},
-	{0x63c8, 0},
-	{0x63c9, 3259},
-	{0x63cb, 0},
-	{0x63cc, 1},
-	{0x63cd, 4670},
-	{0x63ce, 5337},
-	{0x63cf, 2797},
-	{0x63d0, 3636},
-	{0x63d2, 1196},
-	{0x63d4, 0},
-	{0x63d5, 1},
-	{0x63d6, 4165},
-	{0x63d8, 0},
-	{0x63d9, 1},
-	{0x63da, 8703},
-	{0x63dc, 0},
-	{0x63dd, 1},
-	{0x63de, 5336},
-	{0x63e0, 5333},
-	{0x63e1, 3812},
-	{0x63e3, 1322},
-	{0x63e5, 0},
-	{0x63e6, 1},
-	{0x63e7, 2},
-	{0x63e8, 3},
-	{0x63e9, 2360},
-	{0x63ea, 2285},
-	{0x63ec, 0},
-	{0x63ed, 2211},
-	{0x63ee, 8024},
-	{0x63f0, 0},
-	{0x63f1, 1},
-	{0x63f2, 5331},
-	{0x63f4, 4337},
-	{0x63f6, 5320},
-	{0x63f8, 5332},
-	{0x63fa, 0},
-	{0x63fb, 1},
-	{0x63fc, 2},
-	{0x63fd, 2474},
-	{0x63ff, 5334},
-	{0x6400, 1210},
-	{0x6401, 1764},
-	{0x6402, 2638},
-	{0x6404, 0},
-	{0x6405, 2194},
-	{0x6407, 0},
-	{0x6408, 1},
-	{0x6409, 2},
-	{0x640a, 3},
-	{0x640b, 5343},
-	{0x640c, 5346},
-	{0x640d, 8539},
-	{0x640f, 1138},
-	{0x6410, 1319},
-	{0x6412, 0},
-	{0x6413, 1389},
-	{0x6414, 3295},
-	{0x6416, 0},
-	{0x6417, 7862},
-	{0x6419, 0},
-	{0x641a, 1},
-	{0x641b, 5344},
-	{0x641c, 3526},
-	{0x641e, 1758},
-	{0x6420, 5345},
-	{0x6421, 5348},
-	{0x6423, 0},
-	{0x6424, 1},
-	{0x6425, 2},
-	{0x6426, 5347},
-	{0x6428, 0},
-	{0x6429, 1},
-	{0x642a, 3605},
-	{0x642c, 1004},
-	{0x642d, 1393},
-	{0x642f, 0},
-	{0x6430, 1},
-	{0x6431, 2},
-	{0x6432, 3},
-	{0x6433, 4},
-	{0x6434, 5942},
-	{0x6436, 8411},
-	{0x6438, 0},
-	{0x6439, 1},
-	{0x643a, 3962},
-	{0x643c, 0},
-	{0x643d, 1202},
-	{0x643f, 6481},
-	{0x6441, 5342},
-	{0x6443, 0},
-	{0x6444, 3356},
-	{0x6445, 5341},
-	{0x6446, 997},
-	{0x6447, 4136},
-	{0x6448, 1120},
-	{0x644a, 3586},
-	{0x644c, 0},
-	{0x644d, 1},
-	{0x644e, 2},
-	{0x644f, 3},
-	{0x6450, 4},
-	{0x6451, 9056},
-	{0x6452, 5338},
-	{0x6454, 3481},
-	{0x6456, 0},
-	{0x6457, 1},
-	{0x6458, 4427},
-	{0x645a, 0},
-	{0x645b, 1},
-	{0x645c, 9057},
-	{0x645e, 5349},
-	{0x645f, 8256},
-	{0x6461, 0},
-	{0x6462, 1},
-	{0x6463, 2},
-	{0x6464, 3},
-	{0x6465, 4},
-	{0x6466, 5},
-	{0x6467, 1376},
-	{0x6469, 2825},
-	{0x646b, 0},
-	{0x646c, 1},
-	{0x646d, 5351},
-	{0x646f, 8846},
-	{0x6471, 0},
-	{0x6472, 1},
-	{0x6473, 8159},
-	{0x6475, 0},
-	{0x6476, 9054},
-	{0x6478, 2819},
-	{0x6479, 2820},
-	{0x647a, 5353},
-	{0x647b, 7786},
-	{0x647d, 0},
-	{0x647e, 1},
-	{0x647f, 2},
-	{0x6480, 3},
-	{0x6481, 4},
-	{0x6482, 2581},
-	{0x6484, 5350},
-	{0x6485, 2334},
-	{0x6487, 3025},
-	{0x6488, 8194},
-	{0x648a, 0},
-	{0x648b, 1},
-	{0x648c, 2},
-	{0x648d, 3},
-	{0x648e, 4},
-	{0x648f, 5},
-	{0x6490, 6},
-	{0x6491, 1258},
-	{0x6492, 3281},
-	{0x6493, 8339},
-	{0x6495, 3503},
-	{0x6496, 5352},
-	{0x6498, 0},
-	{0x6499, 5356},
-	{0x649b, 0},
-	{0x649c, 1},
-	{0x649d, 2},
-	{0x649e, 4623},
-	{0x649f, 9055},
-	{0x64a1, 0},
-	{0x64a2, 1},
-	{0x64a3, 7852},
-	{0x64a4, 1244},
-	{0x64a5, 7764},
-	{0x64a7, 0},
-	{0x64a8, 1},
-	{0x64a9, 2572},
-	{0x64ab, 7944},
-	{0x64ac, 3144},
-	{0x64ad, 1132},
-	{0x64ae, 1388},
-	{0x64b0, 4616},
-	{0x64b2, 8384},
-	{0x64b3, 9058},
-	{0x64b5, 2895},
-	{0x64b7, 5354},
-	{0x64b8, 5355},
-	{0x64ba, 5357},
-	{0x64bb, 8544},
-	{0x64bc, 1898},
-	{0x64be, 8605},
-	{0x64bf, 8078},
-	{0x64c0, 5358},
-	{0x64c1, 8749},
-	{0x64c2, 2505},
-	{0x64c4, 8263},
-	{0x64c5, 3324},
-	{0x64c7, 8802},
-	{0x64c9, 0},
-	{0x64ca, 8039},
-	{0x64cb, 7858},
-	{0x64cd, 1184},
-	{0x64ce, 3171},
-	{0x64d0, 5359},
-	{0x64d2, 3161},
-	{0x64d4, 7849},
-	{0x64d6, 0},
-	{0x64d7, 5360},
-	{0x64d8, 6482},
-	{0x64da, 8140},
-	{0x64dc, 0},
-	{0x64dd, 1},
-	{0x64de, 3528},
-	{0x64e0, 8050},
-	{0x64e2, 5362},
-	{0x64e4, 5361},
-	{0x64e6, 1160},
-	{0x64e8, 0},
-	{0x64e9, 1},
-	{0x64ea, 2},
-	{0x64eb, 3},
-	{0x64ec, 8344},
-	{0x64ee, 0},
-	{0x64ef, 7762},
-	{0x64f0, 8356},
-	{0x64f1, 7964},
-	{0x64f2, 8847},
-	{0x64f4, 8173},
-	{0x64f6, 0},
-	{0x64f7, 9061},
-	{0x64f9, 0},
-	{0x64fa, 7725},
-	{0x64fb, 8530},
-	{0x64fc, 9062},
-	{0x64fe, 8442},
-	{0x6500, 2955},
-	{0x6502, 0},
-	{0x6503, 1},
-	{0x6504, 9059},
-	{0x6506, 8346},
-	{0x6508, 0},
-	{0x6509, 5363},
-	{0x650b, 0},
-	{0x650c, 1},
-	{0x650d, 2},
-	{0x650e, 3},
-	{0x650f, 8252},
-	{0x6511, 0},
-	{0x6512, 4383},
-	{0x6514, 8182},
-	{0x6516, 9060},
-	{0x6518, 3228},
-	{0x6519, 7785},
-	{0x651b, 9063},
-	{0x651d, 8477},
-	{0x651f, 0},
-	{0x6520, 1},
-	{0x6521, 2},
-	{0x6522, 8793},
-	{0x6523, 8278},
-	{0x6524, 8547},
-	{0x6525, 5364},
-	{0x6527, 0},
-	{0x6528, 1},
-	{0x6529, 2},
-	{0x652a, 8105},
-	{0x652b, 2335},
-	{0x652c, 8188},
-	{0x652e, 5365},
-	{0x652f, 4518},
-	{0x6531, 0},
-	{0x6532, 1},
-	{0x6533, 2},
-	{0x6534, 6409},
-	{0x6535, 6502},
-	{0x6536, 3436},
-	{0x6538, 4786},
-	{0x6539, 1727},
-	{0x653b, 1790},
-	{0x653d, 0},
-	{0x653e, 1634},
-	{0x653f, 4511},
-	{0x6541, 0},
-	{0x6542, 1},
-	{0x6543, 2},
-	{0x6544, 3},
-	{0x6545, 1827},
-	{0x6547, 0},
-	{0x6548, 3954},
-	{0x6549, 7371},
-	{0x654b, 0},
-	{0x654c, 1457},
-	{0x654e, 0},
-	{0x654f, 2809},
-	{0x6551, 2295},
-	{0x6553, 0},
-	{0x6554, 1},
-	{0x6555, 6503},
-	{0x6556, 968},
-	{0x6557, 7726},
-	{0x6559, 2205},
-	{0x655b, 2555},
-	{0x655d, 1087},
-	{0x655e, 1229},
-	{0x6560, 0},
-	{0x6561, 1},
-	{0x6562, 1741},
-	{0x6563, 3291},
-	{0x6565, 0},
-	{0x6566, 1559},
-	{0x6568, 0},
-	{0x6569, 1},
-	{0x656a, 2},
-	{0x656b, 6504},
-	{0x656c, 2275},
-	{0x656e, 0},
-	{0x656f, 1},
-	{0x6570, 3476},
-	{0x6572, 3136},
-	{0x6574, 4508},
-	{0x6575, 7868},
-	{0x6577, 1680},
-	{0x6578, 8514},
-	{0x657a, 0},
-	{0x657b, 1},
-	{0x657c, 2},
-	{0x657d, 3},
-	{0x657e, 4},
-	{0x657f, 5},
-	{0x6580, 6},
-	{0x6581, 7},
-	{0x6582, 8222},
-	{0x6583, 7747},
-	{0x6585, 0},
-	{0x6586, 1},
-	{0x6587, 3795},
-	{0x6589, 0},
-	{0x658a, 1},
-	{0x658b, 4428},
-	{0x658c, 1116},
-	{0x658e, 0},
-	{0x658f, 1},
-	{0x6590, 6593},
-	{0x6591, 1002},
-	{0x6593, 6595},
-	{0x6595, 9428},
-	{0x6597, 1526},
-	{0x6599, 2584},
-	{0x659b, 7510},
-	{0x659c, 3964},
-	{0x659e, 0},
-	{0x659f, 4486},
-	{0x65a1, 3810},
-	{0x65a3, 0},
-	{0x65a4, 2240},
-	{0x65a5, 1287},
-	{0x65a7, 1702},
-	{0x65a9, 4439},
-	{0x65ab, 6697},
-	{0x65ac, 8815},
-	{0x65ad, 1550},
-	{0x65af, 3502},
-	{0x65b0, 3981},
-	{0x65b2, 0},
-	{0x65b3, 1},
-	{0x65b4, 2},
-	{0x65b5, 3},
-	{0x65b6, 4},
-	{0x65b7, 7895},
-	{0x65b9, 1626},
-	{0x65bb, 0},
-	{0x65bc, 6596},
-	{0x65bd, 3392},
-	{0x65bf, 0},
-	{0x65c0, 1},
-	{0x65c1, 2965},
-	{0x65c3, 6599},
-	{0x65c4, 6598},
-	{0x65c5, 2666},
-	{0x65c6, 6597},
-	{0x65c8, 0},
-	{0x65c9, 1},
-	{0x65ca, 2},
-	{0x65cb, 4040},
-	{0x65cc, 6600},
-	{0x65ce, 6601},
-	{0x65cf, 4674},
-	{0x65d1, 0},
-	{0x65d2, 6602},
-	{0x65d4, 0},
-	{0x65d5, 1},
-	{0x65d6, 6603},
-	{0x65d7, 3083},
-	{0x65d9, 0},
-	{0x65da, 1},
-	{0x65db, 2},
-	{0x65dc, 3},
-	{0x65dd, 4},
-	{0x65de, 5},
-	{0x65df, 6},
-	{0x65e0, 3821},
-	{0x65e2, 2107},
-	{0x65e4, 0},
-	{0x65e5, 3248},
-	{0x65e6, 1418},
-	{0x65e7, 2296},
-	{0x65e8, 4539},
-	{0x65e9, 4394},
-	{0x65eb, 0},
-	{0x65ec, 4055},
-	{0x65ed, 4028},
-	{0x65ee, 6410},
-	{0x65ef, 6411},
-	{0x65f0, 6412},
-	{0x65f1, 1900},
-	{0x65f3, 0},
-	{0x65f4, 1},
-	{0x65f5, 2},
-	{0x65f6, 3400},
-	{0x65f7, 2434},
-	{0x65f9, 0},
-	{0x65fa, 3755},
-	{0x65fc, 0},
-	{0x65fd, 1},
-	{0x65fe, 2},
-	{0x65ff, 3},
-	{0x6600, 6418},
-	{0x6602, 965},
-	{0x6603, 6416},
-	{0x6605, 0},
-	{0x6606, 2448},
-	{0x6608, 0},
-	{0x6609, 1},
-	{0x660a, 6413},
-	{0x660c, 1220},
-	{0x660e, 2812},
-	{0x660f, 2045},
-	{0x6611, 0},
-	{0x6612, 1},
-	{0x6613, 4190},
-	{0x6614, 3843},
-	{0x6615, 6417},
-	{0x6617, 0},
-	{0x6618, 1},
-	{0x6619, 6414},
-	{0x661b, 0},
-	{0x661c, 1},
-	{0x661d, 6421},
-	{0x661f, 3986},
-	{0x6620, 4248},
-	{0x6622, 0},
-	{0x6623, 1},
-	{0x6624, 2},
-	{0x6625, 1341},
-	{0x6627, 2758},
-	{0x6628, 4687},
-	{0x662a, 0},
-	{0x662b, 1},
-	{0x662c, 2},
-	{0x662d, 4466},
-	{0x662f, 3422},
-	{0x6631, 6423},
-	{0x6633, 0},
-	{0x6634, 6422},
-	{0x6635, 6425},
-	{0x6636, 6424},
-	{0x6638, 0},
-	{0x6639, 1},
-	{0x663a, 2},
-	{0x663b, 3},
-	{0x663c, 4582},
-	{0x663e, 3905},
-	{0x6640, 0},
-	{0x6641, 6429},
-	{0x6642, 8493},
-	{0x6643, 2019},
-	{0x6645, 0},
-	{0x6646, 1},
-	{0x6647, 2},
-	{0x6648, 3},
-	{0x6649, 4},
-	{0x664a, 5},
-	{0x664b, 2251},
-	{0x664c, 3335},
-	{0x664e, 0},
-	{0x664f, 6430},
-	{0x6651, 0},
-	{0x6652, 3314},
-	{0x6653, 3947},
-	{0x6654, 6428},
-	{0x6655, 4369},
-	{0x6656, 6431},
-	{0x6657, 6433},
-	{0x6659, 0},
-	{0x665a, 3742},
-	{0x665c, 0},
-	{0x665d, 8859},
-	{0x665f, 6427},
-	{0x6661, 6432},
-	{0x6663, 0},
-	{0x6664, 3837},
-	{0x6666, 2035},
-	{0x6668, 1252},
-	{0x666a, 0},
-	{0x666b, 1},
-	{0x666c, 2},
-	{0x666d, 3},
-	{0x666e, 3060},
-	{0x666f, 2271},
-	{0x6670, 3849},
-	{0x6672, 0},
-	{0x6673, 1},
-	{0x6674, 3172},
-	{0x6676, 2262},
-	{0x6677, 6434},
-	{0x6679, 0},
-	{0x667a, 4550},
-	{0x667c, 0},
-	{0x667d, 1},
-	{0x667e, 2569},
-	{0x6680, 0},
-	{0x6681, 1},
-	{0x6682, 4384},
-	{0x6684, 6435},
-	{0x6686, 0},
-	{0x6687, 3883},
-	{0x6688, 8790},
-	{0x6689, 9384},
-	{0x668b, 0},
-	{0x668c, 6436},
-	{0x668e, 0},
-	{0x668f, 1},
-	{0x6690, 2},
-	{0x6691, 3461},
-	{0x6693, 0},
-	{0x6694, 1},
-	{0x6695, 2},
-	{0x6696, 2928},
-	{0x6697, 960},
-	{0x6699, 0},
-	{0x669a, 1},
-	{0x669b, 2},
-	{0x669c, 3},
-	{0x669d, 6438},
-	{0x669f, 0},
-	{0x66a0, 1},
-	{0x66a1, 2},
-	{0x66a2, 7801},
-	{0x66a4, 0},
-	{0x66a5, 1},
-	{0x66a6, 2},
-	{0x66a7, 6437},
-	{0x66a8, 7389},
-	{0x66aa, 0},
-	{0x66ab, 8794},
-	{0x66ad, 0},
-	{0x66ae, 2845},
-	{0x66b0, 0},
-	{0x66b1, 1},
-	{0x66b2, 2},
-	{0x66b3, 3},
-	{0x66b4, 1042},
-	{0x66b6, 0},
-	{0x66b7, 1},
-	{0x66b8, 2},
-	{0x66b9, 5979},
-	{0x66bb, 0},
-	{0x66bc, 1},
-	{0x66bd, 2},
-	{0x66be, 6439},
-	{0x66c0, 0},
-	{0x66c1, 1},
-	{0x66c2, 2},
-	{0x66c3, 3},
-	{0x66c4, 9383},
-	{0x66c6, 9862},
-	{0x66c7, 9382},
-	{0x66c9, 8654},
-	{0x66cb, 0},
-	{0x66cc, 1},
-	{0x66cd, 2},
-	{0x66ce, 3},
-	{0x66cf, 4},
-	{0x66d0, 5},
-	{0x66d1, 6},
-	{0x66d2, 7},
-	{0x66d3, 8},
-	{0x66d4, 9},
-	{0x66d5, 10},
-	{0x66d6, 9385},
-	{0x66d8, 0},
-	{0x66d9, 3462},
-	{0x66db, 6440},
-	{0x66dc, 6441},
-	{0x66dd, 3063},
-	{0x66df, 0},
-	{0x66e0, 8167},
-	{0x66e2, 0},
-	{0x66e3, 1},
-	{0x66e4, 2},
-	{0x66e5, 3},
-	{0x66e6, 6442},
-	{0x66e8, 0},
-	{0x66e9, 6443},
-	{0x66eb, 0},
-	{0x66ec, 8466},
-	{0x66ee, 0},
-	{0x66ef, 1},
-	{0x66f0, 4350},
-	{0x66f2, 3191},
-	{0x66f3, 4158},
-	{0x66f4, 1783},
-	{0x66f6, 0},
-	{0x66f7, 6420},
-	{0x66f8, 8508},
-	{0x66f9, 1187},
-	{0x66fb, 0},
-	{0x66fc, 2723},
-	{0x66fe, 4411},
-	{0x66ff, 3641},
-	{0x6700, 4683},
-	{0x6702, 0},
-	{0x6703, 8028},
-	{0x6705, 0},
-	{0x6706, 1},
-	{0x6707, 2},
-	{0x6708, 4357},
-	{0x6709, 4277},
-	{0x670a, 6515},
-	{0x670b, 2996},
-	{0x670d, 1691},
-	{0x670f, 0},
-	{0x6710, 6532},
-	{0x6712, 0},
-	{0x6713, 1},
-	{0x6714, 3500},
-	{0x6715, 6542},
-	{0x6717, 2485},
-	{0x6719, 0},
-	{0x671a, 1},
-	{0x671b, 3756},
-	{0x671d, 1236},
-	{0x671f, 3065},
-	{0x6721, 0},
-	{0x6722, 1},
-	{0x6723, 2},
-	{0x6724, 3},
-	{0x6725, 4},
-	{0x6726, 6572},
-	{0x6727, 9412},
-	{0x6728, 2849},
-	{0x672a, 3779},
-	{0x672b, 2828},
-	{0x672c, 1063},
-	{0x672d, 4416},
-	{0x672f, 3468},
-	{0x6731, 4587},
-	{0x6733, 0},
-	{0x6734, 3058},
-	{0x6735, 1571},
-	{0x6737, 0},
-	{0x6738, 1},
-	{0x6739, 2},
-	{0x673a, 2063},
-	{0x673c, 0},
-	{0x673d, 4011},
-	{0x673f, 0},
-	{0x6740, 3306},
-	{0x6742, 4374},
-	{0x6743, 3203},
-	{0x6745, 0},
-	{0x6746, 1734},
-	{0x6748, 6228},
-	{0x6749, 3317},
-	{0x674b, 0},
-	{0x674c, 6225},
-	{0x674e, 2521},
-	{0x674f, 3998},
-	{0x6750, 1163},
-	{0x6751, 1384},
-	{0x6753, 6226},
-	{0x6755, 0},
-	{0x6756, 4457},
-	{0x6758, 0},
-	{0x6759, 1},
-	{0x675a, 2},
-	{0x675b, 3},
-	{0x675c, 1540},
-	{0x675e, 6227},
-	{0x675f, 3471},
-	{0x6760, 1751},
-	{0x6761, 3656},
-	{0x6763, 0},
-	{0x6764, 1},
-	{0x6765, 2463},
-	{0x6767, 0},
-	{0x6768, 4119},
-	{0x6769, 6229},
-	{0x676a, 6232},
-	{0x676c, 0},
-	{0x676d, 1907},
-	{0x676f, 1046},
-	{0x6770, 2221},
-	{0x6771, 7884},
-	{0x6772, 6415},
-	{0x6773, 6233},
-	{0x6775, 6236},
-	{0x6777, 6241},
-	{0x6779, 0},
-	{0x677a, 1},
-	{0x677b, 2},
-	{0x677c, 6242},
-	{0x677e, 3518},
-	{0x677f, 1008},
-	{0x6781, 2078},
-	{0x6783, 0},
-	{0x6784, 1810},
-	{0x6786, 0},
-	{0x6787, 6231},
-	{0x6789, 3752},
-	{0x678b, 6240},
-	{0x678d, 0},
-	{0x678e, 1},
-	{0x678f, 2},
-	{0x6790, 3845},
-	{0x6792, 0},
-	{0x6793, 1},
-	{0x6794, 2},
-	{0x6795, 4494},
-	{0x6797, 2591},
-	{0x6798, 6234},
-	{0x679a, 2747},
-	{0x679c, 1876},
-	{0x679d, 4517},
-	{0x679e, 6238},
-	{0x67a0, 0},
-	{0x67a1, 1},
-	{0x67a2, 3447},
-	{0x67a3, 4393},
-	{0x67a5, 6230},
-	{0x67a7, 6235},
-	{0x67a8, 6237},
-	{0x67aa, 3126},
-	{0x67ab, 1664},
-	{0x67ad, 6239},
-	{0x67af, 2410},
-	{0x67b0, 6248},
-	{0x67b2, 0},
-	{0x67b3, 6253},
-	{0x67b5, 6251},
-	{0x67b6, 2127},
-	{0x67b7, 2114},
-	{0x67b8, 6257},
-	{0x67ba, 0},
-	{0x67bb, 1},
-	{0x67bc, 2},
-	{0x67bd, 3},
-	{0x67be, 4},
-	{0x67bf, 5},
-	{0x67c0, 6},
-	{0x67c1, 6260},
-	{0x67c3, 6256},
-	{0x67c4, 1123},
-	{0x67c6, 0},
-	{0x67c7, 1},
-	{0x67c8, 2},
-	{0x67c9, 3},
-	{0x67ca, 4},
-	{0x67cb, 5},
-	{0x67cc, 6},
-	{0x67cd, 7},
-	{0x67ce, 8},
-	{0x67cf, 995},
-	{0x67d0, 2838},
-	{0x67d1, 1735},
-	{0x67d2, 3073},
-	{0x67d3, 3225},
-	{0x67d4, 3260},
-	{0x67d6, 0},
-	{0x67d7, 1},
-	{0x67d8, 6245},
-	{0x67d9, 6250},
-	{0x67da, 6252},
-	{0x67dc, 1866},
-	{0x67dd, 6254},
-	{0x67de, 4690},
-	{0x67e0, 2910},
-	{0x67e2, 6258},
-	{0x67e4, 0},
-	{0x67e5, 1200},
-	{0x67e7, 0},
-	{0x67e8, 1},
-	{0x67e9, 6247},
-	{0x67eb, 0},
-	{0x67ec, 2144},
-	{0x67ee, 0},
-	{0x67ef, 2383},
-	{0x67f0, 6243},
-	{0x67f1, 4600},
-	{0x67f3, 2625},
-	{0x67f4, 1208},
-	{0x67f6, 0},
-	{0x67f7, 1},
-	{0x67f8, 2},
-	{0x67f9, 3},
-	{0x67fa, 4},
-	{0x67fb, 5},
-	{0x67fc, 6},
-	{0x67fd, 6261},
-	{0x67ff, 3416},
-	{0x6800, 6255},
-	{0x6802, 0},
-	{0x6803, 1},
-	{0x6804, 2},
-	{0x6805, 4421},
-	{0x6807, 1107},
-	{0x6808, 4444},
-	{0x6809, 6244},
-	{0x680a, 6246},
-	{0x680b, 1519},
-	{0x680c, 6249},
-	{0x680e, 6259},
-	{0x680f, 2467},
-	{0x6811, 3470},
-	{0x6813, 3485},
-	{0x6815, 0},
-	{0x6816, 3067},
-	{0x6817, 2528},
-	{0x6819, 0},
-	{0x681a, 1},
-	{0x681b, 2},
-	{0x681c, 3},
-	{0x681d, 6271},
-	{0x681f, 0},
-	{0x6820, 1},
-	{0x6821, 3950},
-	{0x6823, 0},
-	{0x6824, 1},
-	{0x6825, 2},
-	{0x6826, 3},
-	{0x6827, 4},
-	{0x6828, 5},
-	{0x6829, 6280},
-	{0x682a, 4585},
-	{0x682c, 0},
-	{0x682d, 1},
-	{0x682e, 2},
-	{0x682f, 3},
-	{0x6830, 4},
-	{0x6831, 5},
-	{0x6832, 6262},
-	{0x6833, 6263},
-	{0x6835, 0},
-	{0x6836, 1},
-	{0x6837, 4130},
-	{0x6838, 1922},
-	{0x6839, 1780},
-	{0x683b, 0},
-	{0x683c, 1772},
-	{0x683d, 4375},
-	{0x683e, 6277},
-	{0x6840, 6276},
-	{0x6841, 6274},
-	{0x6842, 1865},
-	{0x6843, 3621},
-	{0x6844, 6268},
-	{0x6845, 3765},
-	{0x6846, 2431},
-	{0x6848, 963},
-	{0x6849, 6279},
-	{0x684a, 6278},
-	{0x684c, 4637},
-	{0x684e, 6266},
-	{0x6850, 3674},
-	{0x6851, 3292},
-	{0x6853, 1997},
-	{0x6854, 2220},
-	{0x6855, 6272},
-	{0x6857, 0},
-	{0x6858, 1},
-	{0x6859, 2},
-	{0x685a, 3},
-	{0x685b, 4},
-	{0x685c, 5},
-	{0x685d, 6},
-	{0x685e, 7},
-	{0x685f, 8},
-	{0x6860, 6264},
-	{0x6861, 6265},
-	{0x6862, 6267},
-	{0x6863, 1430},
-	{0x6864, 6269},
-	{0x6865, 3138},
-	{0x6866, 6273},
-	{0x6867, 6275},
-	{0x6868, 2177},
-	{0x6869, 4619},
-	{0x686b, 6286},
-	{0x686d, 0},
-	{0x686e, 1},
-	{0x686f, 2},
-	{0x6870, 3},
-	{0x6871, 4},
-	{0x6872, 5},
-	{0x6873, 6},
-	{0x6874, 6283},
-	{0x6876, 3681},
-	{0x6877, 6284},
-	{0x6879, 0},
-	{0x687a, 1},
-	{0x687b, 2},
-	{0x687c, 3},
-	{0x687d, 4},
-	{0x687e, 5},
-	{0x687f, 6},
-	{0x6880, 7},
-	{0x6881, 2563},
-	{0x6883, 6270},
-	{0x6885, 2748},
-	{0x6886, 1019},
-	{0x6888, 0},
-	{0x6889, 1},
-	{0x688a, 2},
-	{0x688b, 3},
-	{0x688c, 4},
-	{0x688d, 5},
-	{0x688e, 6},
-	{0x688f, 6282},
-	{0x6891, 0},
-	{0x6892, 1},
-	{0x6893, 6285},
-	{0x6895, 0},
-	{0x6896, 1},
-	{0x6897, 1788},
-	{0x6898, 9322},
-	{0x689a, 0},
-	{0x689b, 1},
-	{0x689c, 2},
-	{0x689d, 8565},
-	{0x689f, 9325},
-	{0x68a1, 0},
-	{0x68a2, 3339},
-	{0x68a4, 0},
-	{0x68a5, 1},
-	{0x68a6, 2771},
-	{0x68a7, 3823},
-	{0x68a8, 2513},
-	{0x68aa, 0},
-	{0x68ab, 1},
-	{0x68ac, 2},
-	{0x68ad, 3560},
-	{0x68af, 3632},
-	{0x68b0, 3968},
-	{0x68b2, 0},
-	{0x68b3, 3448},
-	{0x68b5, 6281},
-	{0x68b7, 0},
-	{0x68b8, 1},
-	{0x68b9, 2},
-	{0x68ba, 3},
-	{0x68bb, 4},
-	{0x68bc, 5},
-	{0x68bd, 6},
-	{0x68be, 7},
-	{0x68bf, 8},
-	{0x68c0, 2143},
-	{0x68c2, 6287},
-	{0x68c4, 0},
-	{0x68c5, 1},
-	{0x68c6, 2},
-	{0x68c7, 3},
-	{0x68c8, 4},
-	{0x68c9, 2787},
-	{0x68cb, 3076},
-	{0x68cd, 1872},
-	{0x68cf, 0},
-	{0x68d0, 1},
-	{0x68d1, 2},
-	{0x68d2, 1023},
-	{0x68d4, 0},
-	{0x68d5, 4661},
-	{0x68d6, 9323},
-	{0x68d7, 8799},
-	{0x68d8, 2079},
-	{0x68da, 2992},
-	{0x68dc, 0},
-	{0x68dd, 1},
-	{0x68de, 2},
-	{0x68df, 7886},
-	{0x68e0, 3607},
-	{0x68e2, 0},
-	{0x68e3, 6298},
-	{0x68e5, 0},
-	{0x68e6, 1},
-	{0x68e7, 8818},
-	{0x68e9, 0},
-	{0x68ea, 1},
-	{0x68eb, 2},
-	{0x68ec, 3},
-	{0x68ed, 4},
-	{0x68ee, 3302},
-	{0x68f0, 6294},
-	{0x68f1, 2509},
-	{0x68f3, 0},
-	{0x68f4, 1},
-	{0x68f5, 2384},
-	{0x68f7, 0},
-	{0x68f8, 1},
-	{0x68f9, 6292},
-	{0x68fa, 1840},
-	{0x68fc, 6289},
-	{0x68fe, 0},
-	{0x68ff, 1},
-	{0x6901, 6296},
-	{0x6903, 0},
-	{0x6904, 1},
-	{0x6905, 4181},
-	{0x6907, 0},
-	{0x6908, 1},
-	{0x6909, 2},
-	{0x690a, 3},
-	{0x690b, 6295},
-	{0x690d, 4529},
-	{0x690e, 4626},
-	{0x690f, 9331},
-	{0x6910, 6299},
-	{0x6912, 2184},
-	{0x6914, 0},
-	{0x6915, 1},
-	{0x6916, 2},
-	{0x6917, 3},
-	{0x6918, 4},
-	{0x6919, 5},
-	{0x691a, 6},
-	{0x691b, 7},
-	{0x691c, 8},
-	{0x691d, 9},
-	{0x691e, 10},
-	{0x691f, 6290},
-	{0x6920, 6291},
-	{0x6922, 0},
-	{0x6923, 1},
-	{0x6924, 6293},
-	{0x6926, 0},
-	{0x6927, 1},
-	{0x6928, 2},
-	{0x6929, 3},
-	{0x692a, 4},
-	{0x692b, 5},
-	{0x692c, 6},
-	{0x692d, 3719},
-	{0x692f, 0},
-	{0x6930, 4147},
-	{0x6932, 0},
-	{0x6933, 1},
-	{0x6934, 6310},
-	{0x6936, 0},
-	{0x6937, 1},
-	{0x6938, 2},
-	{0x6939, 6301},
-	{0x693b, 0},
-	{0x693c, 1},
-	{0x693d, 1325},
-	{0x693f, 1342},
-	{0x6941, 0},
-	{0x6942, 6303},
-	{0x6944, 0},
-	{0x6945, 1},
-	{0x6946, 2},
-	{0x6947, 3},
-	{0x6948, 4},
-	{0x6949, 5},
-	{0x694a, 8702},
-	{0x694c, 0},
-	{0x694d, 1},
-	{0x694e, 2},
-	{0x694f, 3},
-	{0x6950, 4},
-	{0x6951, 5},
-	{0x6952, 6},
-	{0x6953, 7934},
-	{0x6954, 3955},
-	{0x6956, 0},
-	{0x6957, 6297},
-	{0x6959, 0},
-	{0x695a, 1315},
-	{0x695c, 0},
-	{0x695d, 6304},
-	{0x695e, 2510},
-	{0x6960, 6302},
-	{0x6962, 0},
-	{0x6963, 6317},
-	{0x6965, 0},
-	{0x6966, 6316},
-	{0x6968, 9333},
-	{0x696a, 0},
-	{0x696b, 6306},
-	{0x696d, 8714},
-	{0x696e, 6288},
-	{0x6970, 0},
-	{0x6971, 6300},
-	{0x6973, 0},
-	{0x6974, 1},
-	{0x6975, 8047},
-	{0x6977, 2361},
-	{0x6978, 6309},
-	{0x6979, 6318},
-	{0x697b, 0},
-	{0x697c, 2636},
-	{0x697e, 0},
-	{0x697f, 1},
-	{0x6980, 6307},
-	{0x6982, 1728},
-	{0x6984, 6305},
-	{0x6986, 4289},
-	{0x6987, 6312},
-	{0x6988, 6313},
-	{0x6989, 6315},
-	{0x698b, 0},
-	{0x698c, 1},
-	{0x698d, 6331},
-	{0x698f, 0},
-	{0x6990, 1},
-	{0x6991, 2},
-	{0x6992, 3},
-	{0x6993, 4},
-	{0x6994, 2481},
-	{0x6995, 6329},
-	{0x6997, 0},
-	{0x6998, 6308},
-	{0x699a, 0},
-	{0x699b, 6319},
-	{0x699c, 1020},
-	{0x699e, 0},
-	{0x699f, 1},
-	{0x69a0, 2},
-	{0x69a1, 3},
-	{0x69a2, 4},
-	{0x69a3, 5},
-	{0x69a4, 6},
-	{0x69a5, 7},
-	{0x69a6, 8},
-	{0x69a7, 6320},
-	{0x69a8, 4422},
-	{0x69aa, 9320},
-	{0x69ab, 6322},
-	{0x69ad, 6323},
-	{0x69ae, 8448},
-	{0x69b0, 0},
-	{0x69b1, 6325},
-	{0x69b3, 0},
-	{0x69b4, 2618},
-	{0x69b6, 0},
-	{0x69b7, 3217},
-	{0x69b9, 0},
-	{0x69ba, 1},
-	{0x69bb, 6321},
-	{0x69bd, 0},
-	{0x69be, 1},
-	{0x69bf, 9334},
-	{0x69c1, 6326},
-	{0x69c3, 0},
-	{0x69c4, 1},
-	{0x69c5, 2},
-	{0x69c6, 3},
-	{0x69c7, 4},
-	{0x69c8, 5},
-	{0x69c9, 6},
-	{0x69ca, 6327},
-	{0x69cb, 7975},
-	{0x69cc, 6311},
-	{0x69cd, 8407},
-	{0x69ce, 6314},
-	{0x69d0, 1990},
-	{0x69d2, 0},
-	{0x69d3, 1},
-	{0x69d4, 6324},
-	{0x69d6, 0},
-	{0x69d7, 1},
-	{0x69d8, 2},
-	{0x69d9, 3},
-	{0x69da, 4},
-	{0x69db, 2154},
-	{0x69dd, 0},
-	{0x69de, 1},
-	{0x69df, 6328},
-	{0x69e0, 6330},
-	{0x69e2, 0},
-	{0x69e3, 1},
-	{0x69e4, 2},
-	{0x69e5, 3},
-	{0x69e6, 4},
-	{0x69e7, 9340},
-	{0x69e9, 0},
-	{0x69ea, 1},
-	{0x69eb, 2},
-	{0x69ec, 3},
-	{0x69ed, 6334},
-	{0x69ef, 0},
-	{0x69f0, 1},
-	{0x69f1, 2},
-	{0x69f2, 6338},
-	{0x69f3, 8097},
-	{0x69f5, 0},
-	{0x69f6, 1},
-	{0x69f7, 2},
-	{0x69f8, 3},
-	{0x69f9, 4},
-	{0x69fa, 5},
-	{0x69fb, 6},
-	{0x69fc, 7},
-	{0x69fd, 1186},
-	{0x69ff, 6332},
-	{0x6a01, 8874},
-	{0x6a02, 8197},
-	{0x6a04, 0},
-	{0x6a05, 9324},
-	{0x6a07, 0},
-	{0x6a08, 1},
-	{0x6a09, 2},
-	{0x6a0a, 1611},
-	{0x6a0c, 0},
-	{0x6a0d, 1},
-	{0x6a0e, 2},
-	{0x6a0f, 3},
-	{0x6a10, 4},
-	{0x6a11, 5},
-	{0x6a12, 6},
-	{0x6a13, 8254},
-	{0x6a15, 0},
-	{0x6a16, 1},
-	{0x6a17, 6335},
-	{0x6a18, 6336},
-	{0x6a19, 7756},
-	{0x6a1b, 0},
-	{0x6a1c, 1},
-	{0x6a1d, 2},
-	{0x6a1e, 8506},
-	{0x6a1f, 4450},
-	{0x6a21, 2822},
-	{0x6a23, 8708},
-	{0x6a25, 0},
-	{0x6a26, 1},
-	{0x6a27, 2},
-	{0x6a28, 6348},
-	{0x6a2a, 1944},
-	{0x6a2c, 0},
-	{0x6a2d, 1},
-	{0x6a2e, 2},
-	{0x6a2f, 6333},
-	{0x6a31, 4232},
-	{0x6a33, 0},
-	{0x6a34, 1},
-	{0x6a35, 6344},
-	{0x6a37, 0},
-	{0x6a38, 8387},
-	{0x6a39, 8512},
-	{0x6a3a, 9335},
-	{0x6a3c, 0},
-	{0x6a3d, 6347},
-	{0x6a3e, 6340},
-	{0x6a40, 0},
-	{0x6a41, 1},
-	{0x6a42, 2},
-	{0x6a43, 3},
-	{0x6a44, 6339},
-	{0x6a46, 0},
-	{0x6a47, 3134},
-	{0x6a48, 9332},
-	{0x6a4a, 0},
-	{0x6a4b, 8413},
-	{0x6a4d, 0},
-	{0x6a4e, 1},
-	{0x6a4f, 2},
-	{0x6a50, 6342},
-	{0x6a52, 0},
-	{0x6a53, 1},
-	{0x6a54, 2},
-	{0x6a55, 3},
-	{0x6a56, 4},
-	{0x6a57, 5},
-	{0x6a58, 6349},
-	{0x6a59, 1261},
-	{0x6a5b, 6343},
-	{0x6a5d, 0},
-	{0x6a5e, 1},
-	{0x6a5f, 8040},
-	{0x6a61, 3933},
-	{0x6a62, 8581},
-	{0x6a64, 0},
-	{0x6a65, 6337},
-	{0x6a67, 0},
-	{0x6a68, 1},
-	{0x6a69, 2},
-	{0x6a6a, 3},
-	{0x6a6b, 4},
-	{0x6a6c, 5},
-	{0x6a6d, 6},
-	{0x6a6e, 7},
-	{0x6a6f, 8},
-	{0x6a70, 9},
-	{0x6a71, 1308},
-	{0x6a73, 0},
-	{0x6a74, 1},
-	{0x6a75, 2},
-	{0x6a76, 3},
-	{0x6a77, 4},
-	{0x6a78, 5},
-	{0x6a79, 6346},
-	{0x6a7b, 0},
-	{0x6a7c, 6350},
-	{0x6a7e, 0},
-	{0x6a7f, 1},
-	{0x6a80, 3591},
-	{0x6a82, 0},
-	{0x6a83, 1},
-	{0x6a84, 3866},
-	{0x6a86, 0},
-	{0x6a87, 1},
-	{0x6a88, 2},
-	{0x6a89, 9330},
-	{0x6a8b, 0},
-	{0x6a8c, 1},
-	{0x6a8d, 2},
-	{0x6a8e, 6345},
-	{0x6a90, 6352},
-	{0x6a91, 6351},
-	{0x6a93, 0},
-	{0x6a94, 7861},
-	{0x6a96, 0},
-	{0x6a97, 6354},
-	{0x6a99, 0},
-	{0x6a9a, 1},
-	{0x6a9b, 2},
-	{0x6a9c, 9336},
-	{0x6a9e, 0},
-	{0x6a9f, 1},
-	{0x6aa0, 6341},
-	{0x6aa2, 8075},
-	{0x6aa3, 9348},
-	{0x6aa5, 0},
-	{0x6aa6, 1},
-	{0x6aa7, 2},
-	{0x6aa8, 3},
-	{0x6aa9, 6353},
-	{0x6aab, 6355},
-	{0x6aac, 2767},
-	{0x6aae, 0},
-	{0x6aaf, 9881},
-	{0x6ab1, 0},
-	{0x6ab2, 1},
-	{0x6ab3, 9346},
-	{0x6ab5, 0},
-	{0x6ab6, 1},
-	{0x6ab7, 2},
-	{0x6ab8, 8353},
-	{0x6aba, 0},
-	{0x6abb, 8082},
-	{0x6abd, 0},
-	{0x6abe, 1},
-	{0x6abf, 2},
-	{0x6ac0, 3},
-	{0x6ac1, 4},
-	{0x6ac2, 5},
-	{0x6ac3, 7992},
-	{0x6ac5, 0},
-	{0x6ac6, 1},
-	{0x6ac7, 2},
-	{0x6ac8, 3},
-	{0x6ac9, 4},
-	{0x6aca, 5},
-	{0x6acb, 6},
-	{0x6acc, 7},
-	{0x6acd, 8},
-	{0x6ace, 9},
-	{0x6acf, 10},
-	{0x6ad0, 11},
-	{0x6ad1, 12},
-	{0x6ad2, 13},
-	{0x6ad3, 9349},
-	{0x6ad5, 0},
-	{0x6ad6, 1},
-	{0x6ad7, 2},
-	{0x6ad8, 3},
-	{0x6ad9, 4},
-	{0x6ada, 9344},
-	{0x6adb, 9326},
-	{0x6add, 9339},
-	{0x6ade, 9350},
-	{0x6adf, 9329},
-	{0x6ae1, 0},
-	{0x6ae2, 1},
-	{0x6ae3, 2},
-	{0x6ae4, 3},
-	{0x6ae5, 4},
-	{0x6ae6, 5},
-	{0x6ae7, 9347},
-	{0x6ae8, 9328},
-	{0x6aea, 9321},
-	{0x6aec, 9343},
-	{0x6aee, 0},
-	{0x6aef, 1},
-	{0x6af0, 2},
-	{0x6af1, 3},
-	{0x6af2, 4},
-	{0x6af3, 9327},
-	{0x6af5, 0},
-	{0x6af6, 1},
-	{0x6af7, 2},
-	{0x6af8, 9345},
-	{0x6afa, 0},
-	{0x6afb, 8736},
-	{0x6afd, 0},
-	{0x6afe, 1},
-	{0x6aff, 2},
-	{0x6b01, 0},
-	{0x6b02, 1},
-	{0x6b03, 2},
-	{0x6b04, 8181},
-	{0x6b06, 0},
-	{0x6b07, 1},
-	{0x6b08, 2},
-	{0x6b09, 3},
-	{0x6b0a, 8436},
-	{0x6b0c, 0},
-	{0x6b0d, 1},
-	{0x6b0e, 2},
-	{0x6b0f, 9341},
-	{0x6b11, 0},
-	{0x6b12, 9337},
-	{0x6b14, 0},
-	{0x6b15, 1},
-	{0x6b16, 9342},
-	{0x6b18, 0},
-	{0x6b19, 1},
-	{0x6b1a, 2},
-	{0x6b1b, 3},
-	{0x6b1c, 4},
-	{0x6b1d, 5},
-	{0x6b1e, 9338},
-	{0x6b20, 3124},
-	{0x6b21, 1361},
-	{0x6b22, 1995},
-	{0x6b23, 3979},
-	{0x6b24, 6577},
-	{0x6b26, 0},
-	{0x6b27, 2936},
-	{0x6b29, 0},
-	{0x6b2a, 1},
-	{0x6b2b, 2},
-	{0x6b2c, 3},
-	{0x6b2d, 4},
-	{0x6b2e, 5},
-	{0x6b2f, 6},
-	{0x6b30, 7},
-	{0x6b31, 8},
-	{0x6b32, 4320},
-	{0x6b34, 0},
-	{0x6b35, 1},
-	{0x6b36, 2},
-	{0x6b37, 6578},
-	{0x6b39, 6579},
-	{0x6b3a, 3066},
-	{0x6b3c, 0},
-	{0x6b3d, 8419},
-	{0x6b3e, 2427},
-	{0x6b40, 0},
-	{0x6b41, 1},
-	{0x6b42, 2},
-	{0x6b43, 6580},
-	{0x6b45, 0},
-	{0x6b46, 6581},
-	{0x6b47, 3957},
-	{0x6b49, 3125},
-	{0x6b4b, 0},
-	{0x6b4c, 1763},
-	{0x6b4e, 0},
-	{0x6b4f, 1},
-	{0x6b50, 8365},
-	{0x6b52, 0},
-	{0x6b53, 1},
-	{0x6b54, 2},
-	{0x6b55, 3},
-	{0x6b56, 4},
-	{0x6b57, 5},
-	{0x6b58, 6},
-	{0x6b59, 6582},
-	{0x6b5b, 0},
-	{0x6b5c, 1},
-	{0x6b5d, 2},
-	{0x6b5e, 3},
-	{0x6b5f, 9419},
-	{0x6b61, 8019},
-	{0x6b62, 4536},
-	{0x6b63, 4510},
-	{0x6b64, 1358},
-	{0x6b65, 1156},
-	{0x6b66, 3827},
-	{0x6b67, 3078},
-	{0x6b69, 0},
-	{0x6b6a, 3730},
-	{0x6b6c, 0},
-	{0x6b6d, 1},
-	{0x6b6e, 2},
-	{0x6b6f, 3},
-	{0x6b70, 4},
-	{0x6b71, 5},
-	{0x6b72, 8537},
-	{0x6b74, 0},
-	{0x6b75, 1},
-	{0x6b76, 2},
-	{0x6b77, 8211},
-	{0x6b78, 7987},
-	{0x6b79, 1400},
-	{0x6b7b, 3509},
-	{0x6b7c, 2130},
-	{0x6b7e, 0},
-	{0x6b7f, 1},
-	{0x6b80, 2},
-	{0x6b81, 6358},
-	{0x6b82, 6359},
-	{0x6b83, 4115},
-	{0x6b84, 6361},
-	{0x6b86, 1404},
-	{0x6b87, 6360},
-	{0x6b89, 4060},
-	{0x6b8a, 3449},
-	{0x6b8b, 1175},
-	{0x6b8d, 6364},
-	{0x6b8f, 0},
-	{0x6b90, 1},
-	{0x6b91, 2},
-	{0x6b92, 6362},
-	{0x6b93, 6363},
-	{0x6b95, 0},
-	{0x6b96, 4530},
-	{0x6b98, 7772},
-	{0x6b9a, 6365},
-	{0x6b9b, 6366},
-	{0x6b9d, 0},
-	{0x6b9e, 9352},
-	{0x6ba0, 0},
-	{0x6ba1, 6367},
-	{0x6ba3, 0},
-	{0x6ba4, 9351},
-	{0x6ba6, 0},
-	{0x6ba7, 1},
-	{0x6ba8, 2},
-	{0x6ba9, 3},
-	{0x6baa, 6368},
-	{0x6bab, 9354},
-	{0x6bad, 0},
-	{0x6bae, 9353},
-	{0x6baf, 9355},
-	{0x6bb1, 0},
-	{0x6bb2, 8067},
-	{0x6bb3, 6589},
-	{0x6bb4, 2938},
-	{0x6bb5, 1549},
-	{0x6bb7, 4218},
-	{0x6bb9, 0},
-	{0x6bba, 8463},
-	{0x6bbb, 8155},
-	{0x6bbd, 0},
-	{0x6bbe, 1},
-	{0x6bbf, 1487},
-	{0x6bc1, 2030},
-	{0x6bc2, 6591},
-	{0x6bc4, 0},
-	{0x6bc5, 4202},
-	{0x6bc6, 8367},
-	{0x6bc8, 0},
-	{0x6bc9, 1},
-	{0x6bca, 2},
-	{0x6bcb, 3826},
-	{0x6bcd, 2843},
-	{0x6bcf, 2756},
-	{0x6bd1, 0},
-	{0x6bd2, 1533},
-	{0x6bd3, 4719},
-	{0x6bd4, 1073},
-	{0x6bd5, 1080},
-	{0x6bd6, 1082},
-	{0x6bd7, 3007},
-	{0x6bd9, 1081},
-	{0x6bdb, 2736},
-	{0x6bdd, 0},
-	{0x6bde, 1},
-	{0x6bdf, 2},
-	{0x6be0, 3},
-	{0x6be1, 4434},
-	{0x6be3, 0},
-	{0x6be4, 1},
-	{0x6be5, 2},
-	{0x6be6, 3},
-	{0x6be7, 4},
-	{0x6be8, 5},
-	{0x6be9, 6},
-	{0x6bea, 6484},
-	{0x6beb, 1912},
-	{0x6bed, 0},
-	{0x6bee, 1},
-	{0x6bef, 3597},
-	{0x6bf1, 0},
-	{0x6bf2, 1},
-	{0x6bf3, 6485},
-	{0x6bf5, 6487},
-	{0x6bf7, 0},
-	{0x6bf8, 1},
-	{0x6bf9, 6488},
-	{0x6bfb, 0},
-	{0x6bfc, 1},
-	{0x6bfd, 6486},
-	{0x6bff, 9408},
-	{0x6c01, 0},
-	{0x6c02, 1},
-	{0x6c03, 2},
-	{0x6c04, 3},
-	{0x6c05, 6489},
-	{0x6c06, 6491},
-	{0x6c07, 6490},
-	{0x6c08, 8813},
-	{0x6c0a, 0},
-	{0x6c0b, 1},
-	{0x6c0c, 9409},
-	{0x6c0d, 6492},
-	{0x6c0f, 3430},
-	{0x6c10, 4715},
-	{0x6c11, 2806},
-	{0x6c13, 2730},
-	{0x6c14, 3095},
-	{0x6c15, 6493},
-	{0x6c16, 2861},
-	{0x6c18, 6494},
-	{0x6c19, 6495},
-	{0x6c1a, 6496},
-	{0x6c1b, 1650},
-	{0x6c1d, 0},
-	{0x6c1e, 1},
-	{0x6c1f, 1687},
-	{0x6c21, 6497},
-	{0x6c22, 3167},
-	{0x6c23, 8394},
-	{0x6c24, 6499},
-	{0x6c26, 1883},
-	{0x6c27, 4126},
-	{0x6c28, 956},
-	{0x6c29, 6498},
-	{0x6c2a, 6500},
-	{0x6c2b, 8423},
-	{0x6c2c, 9410},
-	{0x6c2e, 1419},
-	{0x6c2f, 2671},
-	{0x6c30, 3173},
-	{0x6c32, 6501},
-	{0x6c34, 3491},
-	{0x6c35, 5791},
-	{0x6c37, 0},
-	{0x6c38, 4261},
-	{0x6c3a, 0},
-	{0x6c3b, 1},
-	{0x6c3c, 2},
-	{0x6c3d, 4847},
-	{0x6c3f, 0},
-	{0x6c40, 3666},
-	{0x6c41, 4524},
-	{0x6c42, 3184},
-	{0x6c44, 0},
-	{0x6c45, 1},
-	{0x6c46, 4852},
-	{0x6c47, 2040},
-	{0x6c49, 1905},
-	{0x6c4a, 5794},
-	{0x6c4c, 0},
-	{0x6c4d, 1},
-	{0x6c4e, 2},
-	{0x6c4f, 3},
-	{0x6c50, 3864},
-	{0x6c52, 0},
-	{0x6c53, 1},
-	{0x6c54, 5792},
-	{0x6c55, 3328},
-	{0x6c57, 1904},
-	{0x6c59, 0},
-	{0x6c5a, 1},
-	{0x6c5b, 4061},
-	{0x6c5c, 5793},
-	{0x6c5d, 3269},
-	{0x6c5e, 1800},
-	{0x6c5f, 2174},
-	{0x6c60, 1277},
-	{0x6c61, 3818},
-	{0x6c63, 0},
-	{0x6c64, 3603},
-	{0x6c66, 0},
-	{0x6c67, 1},
-	{0x6c68, 5800},
-	{0x6c69, 5801},
-	{0x6c6a, 3749},
-	{0x6c6c, 0},
-	{0x6c6d, 1},
-	{0x6c6e, 2},
-	{0x6c6f, 3},
-	{0x6c70, 3584},
-	{0x6c72, 2086},
-	{0x6c74, 5802},
-	{0x6c76, 5803},
-	{0x6c78, 0},
-	{0x6c79, 4005},
-	{0x6c7b, 0},
-	{0x6c7c, 1},
-	{0x6c7d, 3098},
-	{0x6c7e, 1655},
-	{0x6c80, 0},
-	{0x6c81, 3164},
-	{0x6c82, 4177},
-	{0x6c83, 3813},
-	{0x6c85, 5796},
-	{0x6c86, 5804},
-	{0x6c88, 3371},
-	{0x6c89, 1254},
-	{0x6c8b, 0},
-	{0x6c8c, 5799},
-	{0x6c8e, 0},
-	{0x6c8f, 3074},
-	{0x6c90, 5797},
-	{0x6c92, 0},
-	{0x6c93, 6687},
-	{0x6c94, 5798},
-	{0x6c96, 0},
-	{0x6c97, 1},
-	{0x6c98, 2},
-	{0x6c99, 3308},
-	{0x6c9b, 2983},
-	{0x6c9d, 0},
-	{0x6c9e, 1},
-	{0x6c9f, 1806},
-	{0x6ca1, 2752},
-	{0x6ca3, 5795},
-	{0x6ca4, 2942},
-	{0x6ca5, 2541},
-	{0x6ca6, 2688},
-	{0x6ca7, 1182},
-	{0x6ca9, 5805},
-	{0x6caa, 1979},
-	{0x6cab, 2832},
-	{0x6cad, 5808},
-	{0x6cae, 2313},
-	{0x6cb0, 0},
-	{0x6cb1, 5819},
-	{0x6cb2, 5813},
-	{0x6cb3, 1930},
-	{0x6cb5, 0},
-	{0x6cb6, 1},
-	{0x6cb7, 2},
-	{0x6cb8, 1645},
-	{0x6cb9, 4274},
-	{0x6cbb, 4557},
-	{0x6cbc, 4468},
-	{0x6cbd, 1818},
-	{0x6cbe, 4437},
-	{0x6cbf, 4097},
-	{0x6cc1, 0},
-	{0x6cc2, 1},
-	{0x6cc3, 2},
-	{0x6cc4, 3972},
-	{0x6cc5, 3187},
-	{0x6cc7, 0},
-	{0x6cc8, 1},
-	{0x6cc9, 3205},
-	{0x6cca, 1147},
-	{0x6ccc, 2783},
-	{0x6cce, 0},
-	{0x6ccf, 1},
-	{0x6cd0, 5806},
-	{0x6cd2, 0},
-	{0x6cd3, 5820},
-	{0x6cd4, 5807},
-	{0x6cd5, 1605},
-	{0x6cd6, 5815},
-	{0x6cd7, 5812},
-	{0x6cd9, 0},
-	{0x6cda, 1},
-	{0x6cdb, 1623},
-	{0x6cdd, 0},
-	{0x6cde, 2915},
-	{0x6ce0, 5814},
-	{0x6ce1, 2974},
-	{0x6ce2, 1135},
-	{0x6ce3, 3099},
-	{0x6ce5, 2883},
-	{0x6ce7, 0},
-	{0x6ce8, 4607},
-	{0x6cea, 2508},
-	{0x6ceb, 5817},
-	{0x6ced, 0},
-	{0x6cee, 5818},
-	{0x6cef, 5821},
-	{0x6cf0, 3580},
-	{0x6cf1, 5811},
-	{0x6cf3, 4259},
-	{0x6cf5, 1068},
-	{0x6cf6, 6688},
-	{0x6cf7, 5809},
-	{0x6cf8, 5810},
-	{0x6cfa, 5816},
-	{0x6cfb, 3973},
-	{0x6cfc, 3042},
-	{0x6cfd, 4406},
-	{0x6cfe, 5822},
-	{0x6d01, 2225},
-	{0x6d03, 0},
-	{0x6d04, 5829},
-	{0x6d06, 0},
-	{0x6d07, 5828},
-	{0x6d09, 0},
-	{0x6d0a, 1},
-	{0x6d0b, 4124},
-	{0x6d0c, 5825},
-	{0x6d0e, 5831},
-	{0x6d10, 0},
-	{0x6d11, 1},
-	{0x6d12, 3282},
-	{0x6d14, 0},
-	{0x6d15, 1},
-	{0x6d16, 2},
-	{0x6d17, 3873},
-	{0x6d19, 5830},
-	{0x6d1a, 5836},
-	{0x6d1b, 2700},
-	{0x6d1d, 0},
-	{0x6d1e, 1523},
-	{0x6d20, 0},
-	{0x6d21, 1},
-	{0x6d22, 2},
-	{0x6d23, 3},
-	{0x6d24, 4},
-	{0x6d25, 2243},
-	{0x6d27, 5824},
-	{0x6d29, 0},
-	{0x6d2a, 1952},
-	{0x6d2b, 5832},
-	{0x6d2d, 0},
-	{0x6d2e, 5834},
-	{0x6d30, 0},
-	{0x6d31, 1596},
-	{0x6d32, 4573},
-	{0x6d33, 5840},
-	{0x6d35, 5835},
-	{0x6d37, 0},
-	{0x6d38, 1},
-	{0x6d39, 5823},
-	{0x6d3b, 2051},
-	{0x6d3c, 3726},
-	{0x6d3d, 3103},
-	{0x6d3e, 2954},
-	{0x6d40, 0},
-	{0x6d41, 2624},
-	{0x6d43, 5826},
-	{0x6d45, 3120},
-	{0x6d46, 2173},
-	{0x6d47, 2190},
-	{0x6d48, 5827},
-	{0x6d4a, 4644},
-	{0x6d4b, 1193},
-	{0x6d4d, 5833},
-	{0x6d4e, 2102},
-	{0x6d4f, 5837},
-	{0x6d51, 2048},
-	{0x6d52, 5838},
-	{0x6d53, 2921},
-	{0x6d54, 5839},
-	{0x6d56, 0},
-	{0x6d57, 1},
-	{0x6d58, 2},
-	{0x6d59, 4484},
-	{0x6d5a, 2352},
-	{0x6d5c, 5848},
-	{0x6d5e, 5845},
-	{0x6d60, 5849},
-	{0x6d62, 0},
-	{0x6d63, 5851},
-	{0x6d65, 0},
-	{0x6d66, 3061},
-	{0x6d68, 0},
-	{0x6d69, 1917},
-	{0x6d6a, 2486},
-	{0x6d6c, 0},
-	{0x6d6d, 1},
-	{0x6d6e, 1692},
-	{0x6d6f, 5842},
-	{0x6d71, 0},
-	{0x6d72, 1},
-	{0x6d73, 2},
-	{0x6d74, 4324},
-	{0x6d76, 0},
-	{0x6d77, 1882},
-	{0x6d78, 2255},
-	{0x6d79, 9180},
-	{0x6d7b, 0},
-	{0x6d7c, 5850},
-	{0x6d7e, 0},
-	{0x6d7f, 1},
-	{0x6d80, 2},
-	{0x6d81, 3},
-	{0x6d82, 3696},
-	{0x6d84, 0},
-	{0x6d85, 2908},
-	{0x6d87, 9179},
-	{0x6d88, 3944},
-	{0x6d89, 3359},
-	{0x6d8b, 0},
-	{0x6d8c, 4260},
-	{0x6d8e, 3902},
-	{0x6d90, 0},
-	{0x6d91, 5841},
-	{0x6d93, 5846},
-	{0x6d94, 5847},
-	{0x6d95, 3644},
-	{0x6d97, 0},
-	{0x6d98, 1},
-	{0x6d99, 2},
-	{0x6d9a, 3},
-	{0x6d9b, 3617},
-	{0x6d9d, 2495},
-	{0x6d9e, 5843},
-	{0x6d9f, 2553},
-	{0x6da0, 5844},
-	{0x6da1, 3807},
-	{0x6da3, 2006},
-	{0x6da4, 1460},
-	{0x6da6, 3278},
-	{0x6da7, 2168},
-	{0x6da8, 4456},
-	{0x6da9, 3301},
-	{0x6daa, 1693},
-	{0x6dab, 5864},
-	{0x6dad, 0},
-	{0x6dae, 5866},
-	{0x6daf, 4077},
-	{0x6db1, 0},
-	{0x6db2, 4161},
-	{0x6db4, 0},
-	{0x6db5, 1892},
-	{0x6db7, 0},
-	{0x6db8, 1931},
-	{0x6dba, 0},
-	{0x6dbb, 1},
-	{0x6dbc, 2},
-	{0x6dbd, 3},
-	{0x6dbe, 4},
-	{0x6dbf, 5857},
-	{0x6dc0, 1486},
-	{0x6dc2, 0},
-	{0x6dc3, 1},
-	{0x6dc4, 4650},
-	{0x6dc5, 5854},
-	{0x6dc6, 3946},
-	{0x6dc7, 5853},
-	{0x6dc9, 0},
-	{0x6dca, 1},
-	{0x6dcb, 2597},
-	{0x6dcc, 3613},
-	{0x6dce, 0},
-	{0x6dcf, 1},
-	{0x6dd0, 2},
-	{0x6dd1, 3454},
-	{0x6dd3, 0},
-	{0x6dd4, 1},
-	{0x6dd5, 2},
-	{0x6dd6, 2874},
-	{0x6dd8, 3623},
-	{0x6dd9, 5862},
-	{0x6ddb, 0},
-	{0x6ddc, 1},
-	{0x6ddd, 5861},
-	{0x6dde, 5855},
-	{0x6de0, 5858},
-	{0x6de1, 1422},
-	{0x6de3, 0},
-	{0x6de4, 4286},
-	{0x6de6, 5860},
-	{0x6de8, 0},
-	{0x6de9, 1},
-	{0x6dea, 8286},
-	{0x6deb, 4224},
-	{0x6dec, 1382},
-	{0x6dee, 1993},
-	{0x6df0, 0},
-	{0x6df1, 3367},
-	{0x6df3, 1345},
-	{0x6df5, 8772},
-	{0x6df6, 9186},
-	{0x6df7, 2049},
-	{0x6df9, 4086},
-	{0x6dfa, 8404},
-	{0x6dfb, 3648},
-	{0x6dfc, 6689},
-	{0x6dfe, 0},
-	{0x6dff, 1},
-	{0x6e01, 0},
-	{0x6e02, 1},
-	{0x6e03, 2},
-	{0x6e04, 3},
-	{0x6e05, 3170},
-	{0x6e07, 0},
-	{0x6e08, 1},
-	{0x6e09, 2},
-	{0x6e0a, 4331},
-	{0x6e0c, 5865},
-	{0x6e0d, 4658},
-	{0x6e0e, 5856},
-	{0x6e10, 2166},
-	{0x6e11, 5859},
-	{0x6e13, 0},
-	{0x6e14, 4299},
-	{0x6e16, 5863},
-	{0x6e17, 3377},
-	{0x6e19, 0},
-	{0x6e1a, 5852},
-	{0x6e1c, 0},
-	{0x6e1d, 4298},
-	{0x6e1f, 0},
-	{0x6e20, 3195},
-	{0x6e21, 1544},
-	{0x6e23, 4415},
-	{0x6e24, 1146},
-	{0x6e25, 5877},
-	{0x6e26, 8607},
-	{0x6e28, 0},
-	{0x6e29, 3793},
-	{0x6e2b, 5867},
-	{0x6e2c, 7782},
-	{0x6e2d, 3787},
-	{0x6e2f, 1750},
-	{0x6e31, 0},
-	{0x6e32, 5876},
-	{0x6e34, 2391},
-	{0x6e36, 0},
-	{0x6e37, 1},
-	{0x6e38, 4275},
-	{0x6e3a, 2801},
-	{0x6e3c, 0},
-	{0x6e3d, 1},
-	{0x6e3e, 8035},
-	{0x6e40, 0},
-	{0x6e41, 1},
-	{0x6e42, 2},
-	{0x6e43, 2953},
-	{0x6e44, 5878},
-	{0x6e46, 0},
-	{0x6e47, 1},
-	{0x6e48, 2},
-	{0x6e49, 3},
-	{0x6e4a, 4},
-	{0x6e4b, 5},
-	{0x6e4c, 6},
-	{0x6e4d, 3701},
-	{0x6e4e, 5869},
-	{0x6e50, 0},
-	{0x6e51, 1},
-	{0x6e52, 2},
-	{0x6e53, 5874},
-	{0x6e54, 5875},
-	{0x6e56, 1973},
-	{0x6e58, 3923},
-	{0x6e5a, 0},
-	{0x6e5b, 4448},
-	{0x6e5d, 0},
-	{0x6e5e, 9181},
-	{0x6e5f, 5872},
-	{0x6e61, 0},
-	{0x6e62, 1},
-	{0x6e63, 2},
-	{0x6e64, 3},
-	{0x6e65, 4},
-	{0x6e66, 5},
-	{0x6e67, 6},
-	{0x6e68, 7},
-	{0x6e69, 8},
-	{0x6e6a, 9},
-	{0x6e6b, 5870},
-	{0x6e6d, 0},
-	{0x6e6e, 5868},
-	{0x6e6f, 8555},
-	{0x6e71, 0},
-	{0x6e72, 1},
-	{0x6e73, 2},
-	{0x6e74, 3},
-	{0x6e75, 4},
-	{0x6e76, 5},
-	{0x6e77, 6},
-	{0x6e78, 7},
-	{0x6e79, 8},
-	{0x6e7a, 9},
-	{0x6e7b, 10},
-	{0x6e7c, 11},
-	{0x6e7d, 12},
-	{0x6e7e, 3734},
-	{0x6e7f, 3393},
-	{0x6e81, 0},
-	{0x6e82, 1},
-	{0x6e83, 2446},
-	{0x6e85, 2167},
-	{0x6e86, 5873},
-	{0x6e88, 0},
-	{0x6e89, 1731},
-	{0x6e8b, 0},
-	{0x6e8c, 1},
-	{0x6e8d, 2},
-	{0x6e8e, 3},
-	{0x6e8f, 5893},
-	{0x6e90, 4343},
-	{0x6e92, 0},
-	{0x6e93, 1},
-	{0x6e94, 2},
-	{0x6e95, 3},
-	{0x6e96, 8885},
-	{0x6e98, 5881},
-	{0x6e9a, 0},
-	{0x6e9b, 1},
-	{0x6e9c, 2616},
-	{0x6e9d, 7974},
-	{0x6e9f, 5895},
-	{0x6ea1, 0},
-	{0x6ea2, 4206},
-	{0x6ea4, 0},
-	{0x6ea5, 5885},
-	{0x6ea7, 5886},
-	{0x6ea9, 0},
-	{0x6eaa, 3863},
-	{0x6eac, 0},
-	{0x6ead, 1},
-	{0x6eae, 2},
-	{0x6eaf, 3538},
-	{0x6eb1, 5880},
-	{0x6eb2, 5871},
-	{0x6eb4, 5891},
-	{0x6eb6, 3255},
-	{0x6eb7, 5889},
-	{0x6eb9, 0},
-	{0x6eba, 2890},
-	{0x6ebb, 5888},
-	{0x6ebd, 5887},
-	{0x6ebf, 0},
-	{0x6ec0, 1},
-	{0x6ec1, 1313},
-	{0x6ec2, 5894},
-	{0x6ec4, 7779},
-	{0x6ec5, 8328},
-	{0x6ec7, 1474},
-	{0x6ec9, 0},
-	{0x6eca, 1},
-	{0x6ecb, 4649},
-	{0x6ecc, 7869},
-	{0x6ece, 9025},
-	{0x6ecf, 5892},
-	{0x6ed1, 1985},
-	{0x6ed3, 4655},
-	{0x6ed4, 3618},
-	{0x6ed5, 6568},
-	{0x6ed7, 5890},
-	{0x6ed9, 0},
-	{0x6eda, 1871},
-	{0x6edc, 0},
-	{0x6edd, 1},
-	{0x6ede, 4556},
-	{0x6edf, 5879},
-	{0x6ee0, 5882},
-	{0x6ee1, 2721},
-	{0x6ee2, 5884},
-	{0x6ee4, 2674},
-	{0x6ee5, 2479},
-	{0x6ee6, 2679},
-	{0x6ee8, 1118},
-	{0x6ee9, 3589},
-	{0x6eeb, 0},
-	{0x6eec, 8011},
-	{0x6eee, 0},
-	{0x6eef, 8850},
-	{0x6ef1, 0},
-	{0x6ef2, 8484},
-	{0x6ef4, 1455},
-	{0x6ef6, 0},
-	{0x6ef7, 8264},
-	{0x6ef8, 9184},
-	{0x6ef9, 5901},
-	{0x6efb, 0},
-	{0x6efc, 1},
-	{0x6efd, 2},
-	{0x6efe, 3},
-	{0x6eff, 8311},
-	{0x6f01, 8762},
-	{0x6f02, 3022},
-	{0x6f04, 0},
-	{0x6f05, 1},
-	{0x6f06, 3072},
-	{0x6f08, 0},
-	{0x6f09, 5907},
-	{0x6f0b, 0},
-	{0x6f0c, 1},
-	{0x6f0d, 2},
-	{0x6f0e, 3},
-	{0x6f0f, 2640},
-	{0x6f11, 0},
-	{0x6f12, 1},
-	{0x6f13, 2519},
-	{0x6f14, 4102},
-	{0x6f15, 5900},
-	{0x6f17, 0},
-	{0x6f18, 1},
-	{0x6f19, 2},
-	{0x6f1a, 8369},
-	{0x6f1c, 0},
-	{0x6f1d, 1},
-	{0x6f1e, 2},
-	{0x6f1f, 3},
-	{0x6f20, 2833},
-	{0x6f22, 8001},
-	{0x6f23, 8220},
-	{0x6f24, 5899},
-	{0x6f26, 0},
-	{0x6f27, 1},
-	{0x6f28, 2},
-	{0x6f29, 5908},
-	{0x6f2a, 5906},
-	{0x6f2b, 2725},
-	{0x6f2c, 8888},
-	{0x6f2d, 5883},
-	{0x6f2f, 5902},
-	{0x6f31, 3477},
-	{0x6f32, 8822},
-	{0x6f33, 4453},
-	{0x6f35, 0},
-	{0x6f36, 5903},
-	{0x6f38, 8091},
-	{0x6f3a, 0},
-	{0x6f3b, 1},
-	{0x6f3c, 2},
-	{0x6f3d, 3},
-	{0x6f3e, 4131},
-	{0x6f3f, 8095},
-	{0x6f41, 9674},
-	{0x6f43, 0},
-	{0x6f44, 1},
-	{0x6f45, 2},
-	{0x6f46, 5897},
-	{0x6f47, 5898},
-	{0x6f49, 0},
-	{0x6f4a, 1},
-	{0x6f4b, 5904},
-	{0x6f4d, 3770},
-	{0x6f4f, 0},
-	{0x6f50, 1},
-	{0x6f51, 8382},
-	{0x6f53, 0},
-	{0x6f54, 8116},
-	{0x6f56, 0},
-	{0x6f57, 1},
-	{0x6f58, 2956},
-	{0x6f59, 9175},
-	{0x6f5b, 0},
-	{0x6f5c, 3118},
-	{0x6f5e, 2657},
-	{0x6f60, 0},
-	{0x6f61, 1},
-	{0x6f62, 5896},
-	{0x6f64, 8453},
-	{0x6f66, 2579},
-	{0x6f68, 0},
-	{0x6f69, 1},
-	{0x6f6a, 2},
-	{0x6f6b, 3},
-	{0x6f6c, 4},
-	{0x6f6d, 3593},
-	{0x6f6e, 1238},
-	{0x6f6f, 9185},
-	{0x6f70, 8172},
-	{0x6f72, 5913},
-	{0x6f74, 5905},
-	{0x6f76, 0},
-	{0x6f77, 9194},
-	{0x6f78, 5912},
-	{0x6f7a, 5915},
-	{0x6f7c, 5914},
-	{0x6f7e, 0},
-	{0x6f7f, 9187},
-	{0x6f80, 8462},
-	{0x6f82, 0},
-	{0x6f83, 1},
-	{0x6f84, 1267},
-	{0x6f86, 8102},
-	{0x6f87, 8196},
-	{0x6f88, 1247},
-	{0x6f89, 5909},
-	{0x6f8b, 0},
-	{0x6f8c, 5911},
-	{0x6f8d, 5910},
-	{0x6f8e, 2989},
-	{0x6f90, 0},
-	{0x6f91, 1},
-	{0x6f92, 2},
-	{0x6f93, 3},
-	{0x6f94, 4},
-	{0x6f95, 5},
-	{0x6f96, 6},
-	{0x6f97, 8093},
-	{0x6f99, 0},
-	{0x6f9a, 1},
-	{0x6f9b, 2},
-	{0x6f9c, 2472},
-	{0x6f9e, 0},
-	{0x6f9f, 1},
-	{0x6fa0, 9189},
-	{0x6fa1, 4395},
-	{0x6fa3, 0},
-	{0x6fa4, 8804},
-	{0x6fa6, 0},
-	{0x6fa7, 5918},
-	{0x6fa9, 9442},
-	{0x6fab, 0},
-	{0x6fac, 1},
-	{0x6fad, 2},
-	{0x6fae, 9182},
-	{0x6fb0, 0},
-	{0x6fb1, 7876},
-	{0x6fb3, 975},
-	{0x6fb5, 0},
-	{0x6fb6, 5920},
-	{0x6fb8, 0},
-	{0x6fb9, 5919},
-	{0x6fbb, 0},
-	{0x6fbc, 1},
-	{0x6fbd, 2},
-	{0x6fbe, 3},
-	{0x6fbf, 4},
-	{0x6fc0, 2071},
-	{0x6fc1, 8886},
-	{0x6fc2, 5921},
-	{0x6fc3, 8361},
-	{0x6fc5, 0},
-	{0x6fc6, 1},
-	{0x6fc7, 2},
-	{0x6fc8, 3},
-	{0x6fc9, 5917},
-	{0x6fcb, 0},
-	{0x6fcc, 1},
-	{0x6fcd, 2},
-	{0x6fce, 3},
-	{0x6fcf, 4},
-	{0x6fd0, 5},
-	{0x6fd1, 5916},
-	{0x6fd2, 1117},
-	{0x6fd4, 0},
-	{0x6fd5, 8491},
-	{0x6fd7, 0},
-	{0x6fd8, 8357},
-	{0x6fda, 0},
-	{0x6fdb, 9867},
-	{0x6fdd, 0},
-	{0x6fde, 5924},
-	{0x6fdf, 8054},
-	{0x6fe0, 5925},
-	{0x6fe1, 5922},
-	{0x6fe3, 0},
-	{0x6fe4, 8557},
-	{0x6fe6, 0},
-	{0x6fe7, 1},
-	{0x6fe8, 2},
-	{0x6fe9, 3},
-	{0x6fea, 4},
-	{0x6feb, 8193},
-	{0x6fed, 0},
-	{0x6fee, 5923},
-	{0x6fef, 5926},
-	{0x6ff0, 8593},
-	{0x6ff1, 7760},
-	{0x6ff3, 0},
-	{0x6ff4, 1},
-	{0x6ff5, 2},
-	{0x6ff6, 3},
-	{0x6ff7, 4},
-	{0x6ff8, 5},
-	{0x6ff9, 6},
-	{0x6ffa, 8092},
-	{0x6ffc, 9178},
-	{0x6ffe, 8275},
-	{0x7001, 0},
-	{0x7002, 1},
-	{0x7003, 2},
-	{0x7004, 3},
-	{0x7005, 9193},
-	{0x7006, 9188},
-	{0x7008, 0},
-	{0x7009, 8661},
-	{0x700b, 9190},
-	{0x700d, 0},
-	{0x700e, 1},
-	{0x700f, 9183},
-	{0x7011, 3064},
-	{0x7013, 0},
-	{0x7014, 1},
-	{0x7015, 7759},
-	{0x7017, 0},
-	{0x7018, 9177},
-	{0x701a, 5927},
-	{0x701b, 5929},
-	{0x701d, 8212},
-	{0x701f, 9196},
-	{0x7020, 9195},
-	{0x7022, 0},
-	{0x7023, 5928},
-	{0x7025, 0},
-	{0x7026, 1},
-	{0x7027, 9176},
-	{0x7028, 9198},
-	{0x702a, 0},
-	{0x702b, 1},
-	{0x702c, 2},
-	{0x702d, 3},
-	{0x702e, 4},
-	{0x702f, 5},
-	{0x7030, 9870},
-	{0x7032, 9197},
-	{0x7034, 0},
-	{0x7035, 5931},
-	{0x7037, 0},
-	{0x7038, 1},
-	{0x7039, 5930},
-	{0x703b, 0},
-	{0x703c, 1},
-	{0x703d, 2},
-	{0x703e, 8186},
-	{0x7040, 0},
-	{0x7041, 1},
-	{0x7042, 2},
-	{0x7043, 9174},
-	{0x7044, 9192},
-	{0x7046, 0},
-	{0x7047, 1},
-	{0x7048, 2},
-	{0x7049, 3},
-	{0x704a, 4},
-	{0x704b, 5},
-	{0x704c, 1849},
-	{0x704e, 0},
-	{0x704f, 5932},
-	{0x7051, 8454},
-	{0x7053, 0},
-	{0x7054, 1},
-	{0x7055, 8203},
-	{0x7057, 0},
-	{0x7058, 8550},
-	{0x705a, 0},
-	{0x705b, 1},
-	{0x705c, 2},
-	{0x705d, 9199},
-	{0x705e, 5933},
-	{0x7060, 0},
-	{0x7061, 1},
-	{0x7062, 2},
-	{0x7063, 8585},
-	{0x7064, 8280},
-	{0x7066, 0},
-	{0x7067, 9191},
-	{0x7069, 0},
-	{0x706a, 1},
-	{0x706b, 2053},
-	{0x706c, 6639},
-	{0x706d, 2805},
-	{0x706f, 1447},
-	{0x7070, 2023},
-	{0x7072, 0},
-	{0x7073, 1},
-	{0x7074, 2},
-	{0x7075, 2610},
-	{0x7076, 4401},
-	{0x7078, 2291},
-	{0x707a, 0},
-	{0x707b, 1},
-	{0x707c, 4643},
-	{0x707e, 4377},
-	{0x707f, 1178},
-	{0x7080, 6604},
-	{0x7082, 0},
-	{0x7083, 1},
-	{0x7084, 2},
-	{0x7085, 6419},
-	{0x7087, 0},
-	{0x7088, 1},
-	{0x7089, 2646},
-	{0x708a, 1337},
-	{0x708c, 0},
-	{0x708d, 1},
-	{0x708e, 4096},
-	{0x7090, 0},
-	{0x7091, 1},
-	{0x7092, 1241},
-	{0x7094, 3213},
-	{0x7095, 2376},
-	{0x7096, 6606},
-	{0x7098, 0},
-	{0x7099, 4554},
-	{0x709b, 0},
-	{0x709c, 6605},
-	{0x709d, 6607},
-	{0x709f, 0},
-	{0x70a0, 1},
-	{0x70a1, 2},
-	{0x70a2, 3},
-	{0x70a3, 4},
-	{0x70a4, 5},
-	{0x70a5, 6},
-	{0x70a6, 7},
-	{0x70a7, 8},
-	{0x70a8, 9},
-	{0x70a9, 10},
-	{0x70aa, 11},
-	{0x70ab, 6611},
-	{0x70ac, 2325},
-	{0x70ad, 3602},
-	{0x70ae, 2971},
-	{0x70af, 2283},
-	{0x70b1, 6612},
-	{0x70b3, 1127},
-	{0x70b5, 0},
-	{0x70b6, 1},
-	{0x70b7, 6610},
-	{0x70b8, 4425},
-	{0x70b9, 1476},
-	{0x70bb, 6608},
-	{0x70bc, 2559},
-	{0x70bd, 1288},
-	{0x70bf, 0},
-	{0x70c0, 6609},
-	{0x70c1, 3501},
-	{0x70c2, 2478},
-	{0x70c3, 3665},
-	{0x70c5, 0},
-	{0x70c6, 1},
-	{0x70c7, 2},
-	{0x70c8, 2587},
-	{0x70ca, 6614},
-	{0x70cc, 0},
-	{0x70cd, 1},
-	{0x70ce, 2},
-	{0x70cf, 8611},
-	{0x70d1, 0},
-	{0x70d2, 1},
-	{0x70d3, 2},
-	{0x70d4, 3},
-	{0x70d5, 4},
-	{0x70d6, 5},
-	{0x70d7, 6},
-	{0x70d8, 1949},
-	{0x70d9, 2494},
-	{0x70db, 4593},
-	{0x70dd, 0},
-	{0x70de, 1},
-	{0x70df, 4085},
-	{0x70e1, 0},
-	{0x70e2, 1},
-	{0x70e3, 2},
-	{0x70e4, 2379},
-	{0x70e6, 1616},
-	{0x70e7, 3342},
-	{0x70e8, 6613},
-	{0x70e9, 2039},
-	{0x70eb, 3615},
-	{0x70ec, 2254},
-	{0x70ed, 3235},
-	{0x70ef, 3862},
-	{0x70f1, 0},
-	{0x70f2, 1},
-	{0x70f3, 2},
-	{0x70f4, 8570},
-	{0x70f6, 0},
-	{0x70f7, 3738},
-	{0x70f9, 2988},
-	{0x70fb, 0},
-	{0x70fc, 1},
-	{0x70fd, 1670},
-	{0x70ff, 0},
-	{0x7101, 0},
-	{0x7102, 1},
-	{0x7103, 2},
-	{0x7104, 3},
-	{0x7105, 4},
-	{0x7106, 5},
-	{0x7107, 6},
-	{0x7108, 7},
-	{0x7109, 4082},
-	{0x710a, 1903},
-	{0x710c, 0},
-	{0x710d, 1},
-	{0x710e, 2},
-	{0x710f, 3},
-	{0x7110, 6615},
-	{0x7112, 0},
-	{0x7113, 6616},
-	{0x7115, 2005},
-	{0x7116, 6617},
-	{0x7118, 6640},
-	{0x7119, 1059},
-	{0x711a, 1654},
-	{0x711c, 0},
-	{0x711d, 1},
-	{0x711e, 2},
-	{0x711f, 3},
-	{0x7120, 4},
-	{0x7121, 8613},
-	{0x7123, 0},
-	{0x7124, 1},
-	{0x7125, 2},
-	{0x7126, 2186},
-	{0x7128, 0},
-	{0x7129, 1},
-	{0x712a, 2},
-	{0x712b, 3},
-	{0x712c, 4},
-	{0x712d, 5},
-	{0x712e, 6},
-	{0x712f, 6618},
-	{0x7130, 4111},
-	{0x7131, 6619},
-	{0x7133, 0},
-	{0x7134, 1},
-	{0x7135, 2},
-	{0x7136, 3222},
-	{0x7138, 0},
-	{0x7139, 1},
-	{0x713a, 2},
-	{0x713b, 3},
-	{0x713c, 4},
-	{0x713d, 5},
-	{0x713e, 6},
-	{0x713f, 7},
-	{0x7140, 8},
-	{0x7141, 9},
-	{0x7142, 10},
-	{0x7143, 11},
-	{0x7144, 12},
-	{0x7145, 6623},
-	{0x7147, 0},
-	{0x7148, 1},
-	{0x7149, 8226},
-	{0x714a, 6625},
-	{0x714c, 2018},
-	{0x714e, 2136},
-	{0x7150, 0},
-	{0x7151, 1},
-	{0x7152, 9430},
-	{0x7154, 0},
-	{0x7155, 1},
-	{0x7156, 2},
-	{0x7157, 3},
-	{0x7158, 4},
-	{0x7159, 5},
-	{0x715a, 6},
-	{0x715b, 7},
-	{0x715c, 6621},
-	{0x715e, 3312},
-	{0x7160, 0},
-	{0x7161, 1},
-	{0x7162, 9018},
-	{0x7164, 2751},
-	{0x7166, 6641},
-	{0x7167, 4470},
-	{0x7168, 6622},
-	{0x7169, 7918},
-	{0x716b, 0},
-	{0x716c, 9429},
-	{0x716e, 4594},
-	{0x7170, 0},
-	{0x7171, 1},
-	{0x7172, 6624},
-	{0x7173, 6620},
-	{0x7175, 0},
-	{0x7176, 1},
-	{0x7177, 2},
-	{0x7178, 6626},
-	{0x717a, 6627},
-	{0x717c, 0},
-	{0x717d, 3320},
-	{0x717f, 0},
-	{0x7180, 1},
-	{0x7181, 2},
-	{0x7182, 3},
-	{0x7183, 4},
-	{0x7184, 3861},
-	{0x7186, 0},
-	{0x7187, 1},
-	{0x7188, 2},
-	{0x7189, 3},
-	{0x718a, 4007},
-	{0x718c, 0},
-	{0x718d, 1},
-	{0x718e, 2},
-	{0x718f, 4053},
-	{0x7191, 0},
-	{0x7192, 8744},
-	{0x7194, 3254},
-	{0x7196, 0},
-	{0x7197, 9431},
-	{0x7198, 6628},
-	{0x7199, 3844},
-	{0x719b, 0},
-	{0x719c, 1},
-	{0x719d, 2},
-	{0x719e, 3},
-	{0x719f, 3459},
-	{0x71a0, 6632},
-	{0x71a2, 0},
-	{0x71a3, 1},
-	{0x71a4, 2},
-	{0x71a5, 3},
-	{0x71a6, 4},
-	{0x71a7, 5},
-	{0x71a8, 6631},
-	{0x71aa, 0},
-	{0x71ab, 1},
-	{0x71ac, 969},
-	{0x71ae, 0},
-	{0x71af, 1},
-	{0x71b0, 2},
-	{0x71b1, 8444},
-	{0x71b3, 6629},
-	{0x71b5, 6630},
-	{0x71b7, 0},
-	{0x71b8, 1},
-	{0x71b9, 6642},
-	{0x71bb, 0},
-	{0x71bc, 1},
-	{0x71bd, 2},
-	{0x71be, 7815},
-	{0x71c0, 0},
-	{0x71c1, 9432},
-	{0x71c3, 3223},
-	{0x71c5, 0},
-	{0x71c6, 1},
-	{0x71c7, 2},
-	{0x71c8, 7866},
-	{0x71ca, 0},
-	{0x71cb, 1},
-	{0x71cc, 2},
-	{0x71cd, 3},
-	{0x71ce, 2576},
-	{0x71d0, 0},
-	{0x71d1, 1},
-	{0x71d2, 8473},
-	{0x71d4, 6634},
-	{0x71d5, 4105},
-	{0x71d7, 0},
-	{0x71d8, 1},
-	{0x71d9, 8556},
-	{0x71db, 0},
-	{0x71dc, 9433},
-	{0x71de, 0},
-	{0x71df, 8743},
-	{0x71e0, 6633},
-	{0x71e2, 0},
-	{0x71e3, 1},
-	{0x71e4, 2},
-	{0x71e5, 4402},
-	{0x71e6, 7775},
-	{0x71e7, 6635},
-	{0x71e9, 0},
-	{0x71ea, 1},
-	{0x71eb, 2},
-	{0x71ec, 3},
-	{0x71ed, 8863},
-	{0x71ee, 5014},
-	{0x71f0, 0},
-	{0x71f1, 1},
-	{0x71f2, 2},
-	{0x71f3, 3},
-	{0x71f4, 8029},
-	{0x71f6, 0},
-	{0x71f7, 1},
-	{0x71f8, 2},
-	{0x71f9, 6636},
-	{0x71fb, 0},
-	{0x71fc, 8124},
-	{0x71fe, 9434},
-	{0x7201, 0},
-	{0x7202, 1},
-	{0x7203, 2},
-	{0x7204, 3},
-	{0x7205, 4},
-	{0x7206, 1045},
-	{0x7208, 0},
-	{0x7209, 1},
-	{0x720a, 2},
-	{0x720b, 3},
-	{0x720c, 4},
-	{0x720d, 8521},
-	{0x720f, 0},
-	{0x7210, 8262},
-	{0x7212, 0},
-	{0x7213, 1},
-	{0x7214, 2},
-	{0x7215, 3},
-	{0x7216, 4},
-	{0x7217, 5},
-	{0x7218, 6},
-	{0x7219, 7},
-	{0x721a, 8},
-	{0x721b, 8192},
-	{0x721d, 6637},
-	{0x721f, 0},
-	{0x7220, 1},
-	{0x7221, 2},
-	{0x7222, 3},
-	{0x7223, 4},
-	{0x7224, 5},
-	{0x7225, 6},
-	{0x7226, 7},
-	{0x7227, 8},
-	{0x7228, 6638},
-	{0x722a, 4611},
-	{0x722c, 2945},
-	{0x722e, 0},
-	{0x722f, 1},
-	{0x7230, 6508},
-	{0x7231, 953},
-	{0x7232, 8592},
-	{0x7234, 0},
-	{0x7235, 2339},
-	{0x7236, 1715},
-	{0x7237, 4150},
-	{0x7238, 993},
-	{0x7239, 1498},
-	{0x723a, 8712},
-	{0x723b, 4713},
-	{0x723d, 3489},
-	{0x723e, 7910},
-	{0x723f, 5789},
-	{0x7241, 0},
-	{0x7242, 1},
-	{0x7243, 2},
-	{0x7244, 3},
-	{0x7245, 4},
-	{0x7246, 5},
-	{0x7247, 3019},
-	{0x7248, 1009},
-	{0x724a, 0},
-	{0x724b, 1},
-	{0x724c, 2951},
-	{0x724d, 6505},
-	{0x724f, 0},
-	{0x7250, 1},
-	{0x7251, 2},
-	{0x7252, 6506},
-	{0x7254, 0},
-	{0x7255, 1},
-	{0x7256, 6507},
-	{0x7258, 9411},
-	{0x7259, 4073},
-	{0x725b, 2916},
-	{0x725d, 6468},
-	{0x725f, 2837},
-	{0x7261, 2840},
-	{0x7262, 2489},
-	{0x7264, 0},
-	{0x7265, 1},
-	{0x7266, 6469},
-	{0x7267, 2852},
-	{0x7269, 3838},
-	{0x726b, 0},
-	{0x726c, 1},
-	{0x726d, 2},
-	{0x726e, 6466},
-	{0x726f, 6470},
-	{0x7271, 0},
-	{0x7272, 3381},
-	{0x7274, 0},
-	{0x7275, 3104},
-	{0x7277, 0},
-	{0x7278, 1},
-	{0x7279, 3627},
-	{0x727a, 3853},
-	{0x727c, 0},
-	{0x727d, 8396},
-	{0x727e, 6471},
-	{0x727f, 6472},
-	{0x7280, 3865},
-	{0x7281, 2514},
-	{0x7283, 0},
-	{0x7284, 6473},
-	{0x7286, 0},
-	{0x7287, 1},
-	{0x7288, 2},
-	{0x7289, 3},
-	{0x728a, 1534},
-	{0x728b, 6474},
-	{0x728d, 6475},
-	{0x728f, 6476},
-	{0x7291, 0},
-	{0x7292, 6477},
-	{0x7294, 0},
-	{0x7295, 1},
-	{0x7296, 9024},
-	{0x7298, 0},
-	{0x7299, 1},
-	{0x729a, 2},
-	{0x729b, 3},
-	{0x729c, 4},
-	{0x729d, 5},
-	{0x729e, 6},
-	{0x729f, 6467},
-	{0x72a1, 0},
-	{0x72a2, 7889},
-	{0x72a4, 0},
-	{0x72a5, 1},
-	{0x72a6, 2},
-	{0x72a7, 8620},
-	{0x72a9, 0},
-	{0x72aa, 1},
-	{0x72ab, 2},
-	{0x72ac, 3209},
-	{0x72ad, 5615},
-	{0x72af, 1621},
-	{0x72b0, 5616},
-	{0x72b2, 0},
-	{0x72b3, 1},
-	{0x72b4, 5617},
-	{0x72b6, 4625},
-	{0x72b7, 5618},
-	{0x72b8, 5619},
-	{0x72b9, 4273},
-	{0x72bb, 0},
-	{0x72bc, 1},
-	{0x72bd, 2},
-	{0x72be, 3},
-	{0x72bf, 4},
-	{0x72c0, 8879},
-	{0x72c1, 5621},
-	{0x72c2, 2430},
-	{0x72c3, 5620},
-	{0x72c4, 1459},
-	{0x72c6, 0},
-	{0x72c7, 1},
-	{0x72c8, 1056},
-	{0x72ca, 0},
-	{0x72cb, 1},
-	{0x72cc, 2},
-	{0x72cd, 5623},
-	{0x72ce, 5622},
-	{0x72d0, 1971},
-	{0x72d2, 5624},
-	{0x72d4, 0},
-	{0x72d5, 1},
-	{0x72d6, 2},
-	{0x72d7, 1808},
-	{0x72d9, 2304},
-	{0x72db, 0},
-	{0x72dc, 1},
-	{0x72dd, 2},
-	{0x72de, 2911},
-	{0x72e0, 1940},
-	{0x72e1, 2199},
-	{0x72e3, 0},
-	{0x72e4, 1},
-	{0x72e5, 2},
-	{0x72e6, 3},
-	{0x72e7, 4},
-	{0x72e8, 5625},
-	{0x72e9, 5627},
-	{0x72eb, 0},
-	{0x72ec, 1535},
-	{0x72ed, 3886},
-	{0x72ee, 3391},
-	{0x72ef, 5626},
-	{0x72f0, 4505},
-	{0x72f1, 4321},
-	{0x72f2, 5628},
-	{0x72f3, 5632},
-	{0x72f4, 5629},
-	{0x72f6, 0},
-	{0x72f7, 5630},
-	{0x72f8, 2517},
-	{0x72f9, 8630},
-	{0x72fa, 5634},
-	{0x72fb, 5635},
-	{0x72fc, 2482},
-	{0x72fd, 7741},
-	{0x72ff, 0},
-	{0x7301, 5631},
-	{0x7303, 5633},
-	{0x7305, 0},
-	{0x7306, 1},
-	{0x7307, 2},
-	{0x7308, 3},
-	{0x7309, 4},
-	{0x730a, 5639},
-	{0x730c, 0},
-	{0x730d, 1},
-	{0x730e, 2589},
-	{0x7310, 0},
-	{0x7311, 1},
-	{0x7312, 2},
-	{0x7313, 5637},
-	{0x7315, 5642},
-	{0x7316, 1221},
-	{0x7317, 5636},
-	{0x7319, 0},
-	{0x731a, 1},
-	{0x731b, 2770},
-	{0x731c, 1161},
-	{0x731d, 5641},
-	{0x731e, 5640},
-	{0x7320, 0},
-	{0x7321, 5638},
-	{0x7322, 5643},
-	{0x7324, 0},
-	{0x7325, 5645},
-	{0x7327, 0},
-	{0x7328, 1},
-	{0x7329, 3988},
-	{0x732a, 4588},
-	{0x732b, 2733},
-	{0x732c, 5646},
-	{0x732e, 3908},
-	{0x7330, 0},
-	{0x7331, 5648},
-	{0x7333, 0},
-	{0x7334, 1958},
-	{0x7336, 8757},
-	{0x7337, 6356},
-	{0x7338, 5647},
-	{0x7339, 5644},
-	{0x733b, 9111},
-	{0x733d, 0},
-	{0x733e, 1984},
-	{0x733f, 4342},
-	{0x7341, 9109},
-	{0x7343, 0},
-	{0x7344, 8767},
-	{0x7345, 8490},
-	{0x7347, 0},
-	{0x7348, 1},
-	{0x7349, 2},
-	{0x734a, 3},
-	{0x734b, 4},
-	{0x734c, 5},
-	{0x734d, 5650},
-	{0x734f, 0},
-	{0x7350, 5649},
-	{0x7352, 6357},
-	{0x7354, 0},
-	{0x7355, 1},
-	{0x7356, 2},
-	{0x7357, 5651},
-	{0x7359, 0},
-	{0x735a, 1},
-	{0x735b, 2},
-	{0x735c, 3},
-	{0x735d, 4},
-	{0x735e, 5},
-	{0x735f, 6},
-	{0x7360, 5652},
-	{0x7362, 0},
-	{0x7363, 1},
-	{0x7364, 2},
-	{0x7365, 3},
-	{0x7366, 4},
-	{0x7367, 5},
-	{0x7368, 7890},
-	{0x736a, 9110},
-	{0x736b, 9112},
-	{0x736c, 5653},
-	{0x736d, 3572},
-	{0x736f, 5654},
-	{0x7370, 8354},
-	{0x7372, 8036},
-	{0x7374, 0},
-	{0x7375, 8235},
-	{0x7377, 9108},
-	{0x7378, 8505},
-	{0x737a, 8543},
-	{0x737b, 8641},
-	{0x737c, 9114},
-	{0x737e, 5655},
-	{0x7380, 9113},
-	{0x7382, 0},
-	{0x7383, 1},
-	{0x7384, 4041},
-	{0x7386, 0},
-	{0x7387, 2673},
-	{0x7389, 4310},
-	{0x738b, 3750},
-	{0x738d, 0},
-	{0x738e, 6168},
-	{0x7390, 0},
-	{0x7391, 6169},
-	{0x7393, 0},
-	{0x7394, 1},
-	{0x7395, 2},
-	{0x7396, 2288},
-	{0x7398, 0},
-	{0x7399, 1},
-	{0x739a, 2},
-	{0x739b, 2705},
-	{0x739d, 0},
-	{0x739e, 1},
-	{0x739f, 6172},
-	{0x73a1, 0},
-	{0x73a2, 6171},
-	{0x73a4, 0},
-	{0x73a5, 1},
-	{0x73a6, 2},
-	{0x73a7, 3},
-	{0x73a8, 4},
-	{0x73a9, 3735},
-	{0x73ab, 2746},
-	{0x73ad, 0},
-	{0x73ae, 6170},
-	{0x73af, 1996},
-	{0x73b0, 3907},
-	{0x73b2, 2602},
-	{0x73b3, 6177},
-	{0x73b5, 0},
-	{0x73b6, 1},
-	{0x73b7, 6176},
-	{0x73b9, 0},
-	{0x73ba, 6188},
-	{0x73bb, 1130},
-	{0x73bd, 0},
-	{0x73be, 1},
-	{0x73bf, 2},
-	{0x73c0, 6178},
-	{0x73c2, 6174},
-	{0x73c4, 0},
-	{0x73c5, 1},
-	{0x73c6, 2},
-	{0x73c7, 3},
-	{0x73c8, 6180},
-	{0x73c9, 6179},
-	{0x73ca, 3315},
-	{0x73cc, 0},
-	{0x73cd, 4485},
-	{0x73cf, 6173},
-	{0x73d0, 1606},
-	{0x73d1, 6175},
-	{0x73d3, 0},
-	{0x73d4, 1},
-	{0x73d5, 2},
-	{0x73d6, 3},
-	{0x73d7, 4},
-	{0x73d8, 5},
-	{0x73d9, 6182},
-	{0x73db, 0},
-	{0x73dc, 1},
-	{0x73dd, 2},
-	{0x73de, 6187},
-	{0x73e0, 4584},
-	{0x73e2, 0},
-	{0x73e3, 1},
-	{0x73e4, 2},
-	{0x73e5, 6181},
-	{0x73e7, 6186},
-	{0x73e9, 6185},
-	{0x73eb, 0},
-	{0x73ec, 1},
-	{0x73ed, 1003},
-	{0x73ef, 0},
-	{0x73f0, 1},
-	{0x73f1, 2},
-	{0x73f2, 6189},
-	{0x73f4, 0},
-	{0x73f5, 1},
-	{0x73f6, 2},
-	{0x73f7, 3},
-	{0x73f8, 4},
-	{0x73f9, 5},
-	{0x73fa, 6},
-	{0x73fb, 7},
-	{0x73fc, 8},
-	{0x73fd, 9},
-	{0x73fe, 8640},
-	{0x7401, 0},
-	{0x7402, 1},
-	{0x7403, 3183},
-	{0x7405, 2480},
-	{0x7406, 2520},
-	{0x7408, 0},
-	{0x7409, 2617},
-	{0x740a, 6184},
-	{0x740c, 0},
-	{0x740d, 1},
-	{0x740e, 2},
-	{0x740f, 6190},
-	{0x7410, 3563},
-	{0x7412, 0},
-	{0x7413, 1},
-	{0x7414, 2},
-	{0x7415, 3},
-	{0x7416, 4},
-	{0x7417, 5},
-	{0x7418, 6},
-	{0x7419, 7},
-	{0x741a, 6200},
-	{0x741b, 6199},
-	{0x741d, 0},
-	{0x741e, 1},
-	{0x741f, 2},
-	{0x7420, 3},
-	{0x7421, 4},
-	{0x7422, 4638},
-	{0x7424, 0},
-	{0x7425, 6194},
-	{0x7426, 6193},
-	{0x7428, 6195},
-	{0x742a, 6191},
-	{0x742c, 6198},
-	{0x742e, 6197},
-	{0x7430, 6196},
-	{0x7432, 0},
-	{0x7433, 2590},
-	{0x7434, 3158},
-	{0x7435, 3006},
-	{0x7436, 2948},
-	{0x7438, 0},
-	{0x7439, 1},
-	{0x743a, 2},
-	{0x743b, 3},
-	{0x743c, 3178},
-	{0x743e, 0},
-	{0x743f, 9312},
-	{0x7441, 6201},
-	{0x7443, 0},
-	{0x7444, 1},
-	{0x7445, 2},
-	{0x7446, 3},
-	{0x7447, 4},
-	{0x7448, 5},
-	{0x7449, 6},
-	{0x744a, 7},
-	{0x744b, 9308},
-	{0x744d, 0},
-	{0x744e, 1},
-	{0x744f, 2},
-	{0x7450, 3},
-	{0x7451, 4},
-	{0x7452, 5},
-	{0x7453, 6},
-	{0x7454, 7},
-	{0x7455, 6204},
-	{0x7457, 6203},
-	{0x7459, 6205},
-	{0x745a, 1966},
-	{0x745b, 6192},
-	{0x745c, 6202},
-	{0x745e, 3275},
-	{0x745f, 3299},
-	{0x7461, 0},
-	{0x7462, 1},
-	{0x7463, 8541},
-	{0x7465, 0},
-	{0x7466, 1},
-	{0x7467, 2},
-	{0x7468, 3},
-	{0x7469, 8741},
-	{0x746a, 8298},
-	{0x746c, 0},
-	{0x746d, 6207},
-	{0x746f, 0},
-	{0x7470, 1854},
-	{0x7472, 0},
-	{0x7473, 1},
-	{0x7474, 2},
-	{0x7475, 3},
-	{0x7476, 4135},
-	{0x7477, 6206},
-	{0x7479, 0},
-	{0x747a, 1},
-	{0x747b, 2},
-	{0x747c, 3},
-	{0x747d, 4},
-	{0x747e, 6208},
-	{0x7480, 6211},
-	{0x7481, 6212},
-	{0x7483, 2544},
-	{0x7485, 0},
-	{0x7486, 1},
-	{0x7487, 6213},
-	{0x7489, 9313},
-	{0x748b, 6214},
-	{0x748d, 0},
-	{0x748e, 6210},
-	{0x7490, 6218},
-	{0x7492, 0},
-	{0x7493, 1},
-	{0x7494, 2},
-	{0x7495, 3},
-	{0x7496, 4},
-	{0x7497, 5},
-	{0x7498, 6},
-	{0x7499, 7},
-	{0x749a, 8},
-	{0x749b, 9},
-	{0x749c, 6209},
-	{0x749e, 6215},
-	{0x74a0, 0},
-	{0x74a1, 1},
-	{0x74a2, 2},
-	{0x74a3, 9307},
-	{0x74a5, 0},
-	{0x74a6, 9314},
-	{0x74a7, 6219},
-	{0x74a8, 6216},
-	{0x74a9, 6217},
-	{0x74ab, 0},
-	{0x74ac, 1},
-	{0x74ad, 2},
-	{0x74ae, 3},
-	{0x74af, 4},
-	{0x74b0, 8020},
-	{0x74b2, 0},
-	{0x74b3, 1},
-	{0x74b4, 2},
-	{0x74b5, 3},
-	{0x74b6, 4},
-	{0x74b7, 5},
-	{0x74b8, 6},
-	{0x74b9, 7},
-	{0x74ba, 6221},
-	{0x74bc, 0},
-	{0x74bd, 9311},
-	{0x74bf, 0},
-	{0x74c0, 1},
-	{0x74c1, 2},
-	{0x74c2, 3},
-	{0x74c3, 4},
-	{0x74c4, 5},
-	{0x74c5, 6},
-	{0x74c6, 7},
-	{0x74c7, 8},
-	{0x74c8, 9},
-	{0x74c9, 10},
-	{0x74ca, 8428},
-	{0x74cc, 0},
-	{0x74cd, 1},
-	{0x74ce, 2},
-	{0x74cf, 9309},
-	{0x74d1, 0},
-	{0x74d2, 6220},
-	{0x74d4, 9315},
-	{0x74d6, 0},
-	{0x74d7, 1},
-	{0x74d8, 2},
-	{0x74d9, 3},
-	{0x74da, 9316},
-	{0x74dc, 1832},
-	{0x74de, 6962},
-	{0x74e0, 6963},
-	{0x74e2, 3023},
-	{0x74e3, 1013},
-	{0x74e4, 3226},
-	{0x74e6, 3728},
-	{0x74e8, 0},
-	{0x74e9, 1},
-	{0x74ea, 2},
-	{0x74eb, 3},
-	{0x74ec, 4},
-	{0x74ed, 5},
-	{0x74ee, 3804},
-	{0x74ef, 6403},
-	{0x74f1, 0},
-	{0x74f2, 1},
-	{0x74f3, 2},
-	{0x74f4, 6404},
-	{0x74f6, 3038},
-	{0x74f7, 1356},
-	{0x74f9, 0},
-	{0x74fa, 1},
-	{0x74fb, 2},
-	{0x74fc, 3},
-	{0x74fd, 4},
-	{0x74fe, 5},
-	{0x74ff, 6405},
-	{0x7501, 0},
-	{0x7502, 1},
-	{0x7503, 2},
-	{0x7504, 4488},
-	{0x7506, 0},
-	{0x7507, 1},
-	{0x7508, 2},
-	{0x7509, 3},
-	{0x750a, 4},
-	{0x750b, 5},
-	{0x750c, 9381},
-	{0x750d, 5253},
-	{0x750f, 6406},
-	{0x7511, 6407},
-	{0x7513, 6408},
-	{0x7515, 0},
-	{0x7516, 1},
-	{0x7517, 2},
-	{0x7518, 1733},
-	{0x7519, 5368},
-	{0x751a, 3374},
-	{0x751c, 3651},
-	{0x751e, 0},
-	{0x751f, 3379},
-	{0x7521, 0},
-	{0x7522, 1},
-	{0x7523, 7792},
-	{0x7525, 3380},
-	{0x7527, 0},
-	{0x7528, 4264},
-	{0x7529, 3483},
-	{0x752b, 1697},
-	{0x752c, 6964},
-	{0x752d, 1067},
-	{0x752f, 5940},
-	{0x7530, 3650},
-	{0x7531, 4270},
-	{0x7532, 2122},
-	{0x7533, 3363},
-	{0x7535, 1480},
-	{0x7537, 2867},
-	{0x7538, 1482},
-	{0x753a, 6776},
-	{0x753b, 1986},
-	{0x753d, 0},
-	{0x753e, 6166},
-	{0x7540, 6777},
-	{0x7542, 0},
-	{0x7543, 1},
-	{0x7544, 2},
-	{0x7545, 1230},
-	{0x7547, 0},
-	{0x7548, 6780},
-	{0x754a, 0},
-	{0x754b, 6779},
-	{0x754c, 2232},
-	{0x754e, 6778},
-	{0x754f, 3782},
-	{0x7551, 0},
-	{0x7552, 1},
-	{0x7553, 2},
-	{0x7554, 2960},
-	{0x7556, 0},
-	{0x7557, 1},
-	{0x7558, 2},
-	{0x7559, 2621},
-	{0x755a, 5022},
-	{0x755b, 6781},
-	{0x755c, 4030},
-	{0x755d, 8335},
-	{0x755f, 0},
-	{0x7560, 1},
-	{0x7561, 2},
-	{0x7562, 7746},
-	{0x7564, 0},
-	{0x7565, 2683},
-	{0x7566, 3079},
-	{0x7568, 0},
-	{0x7569, 1},
-	{0x756a, 1609},
-	{0x756b, 8014},
-	{0x756d, 0},
-	{0x756e, 1},
-	{0x756f, 2},
-	{0x7570, 3},
-	{0x7571, 4},
-	{0x7572, 6782},
-	{0x7574, 1296},
-	{0x7576, 7857},
-	{0x7578, 2064},
-	{0x7579, 6783},
-	{0x757b, 0},
-	{0x757c, 1},
-	{0x757d, 2},
-	{0x757e, 3},
-	{0x757f, 6164},
-	{0x7581, 0},
-	{0x7582, 1},
-	{0x7583, 6784},
-	{0x7585, 0},
-	{0x7586, 2175},
-	{0x7587, 7819},
-	{0x7589, 0},
-	{0x758a, 1},
-	{0x758b, 7110},
-	{0x758d, 0},
-	{0x758e, 1},
-	{0x758f, 3455},
-	{0x7591, 4176},
-	{0x7592, 7008},
-	{0x7594, 7009},
-	{0x7596, 7010},
-	{0x7597, 2575},
-	{0x7599, 1768},
-	{0x759a, 2301},
-	{0x759c, 0},
-	{0x759d, 7012},
-	{0x759f, 2930},
-	{0x75a0, 7011},
-	{0x75a1, 4122},
-	{0x75a3, 7014},
-	{0x75a4, 983},
-	{0x75a5, 2235},
-	{0x75a7, 0},
-	{0x75a8, 1},
-	{0x75a9, 2},
-	{0x75aa, 3},
-	{0x75ab, 4198},
-	{0x75ac, 7013},
-	{0x75ae, 1330},
-	{0x75af, 1669},
-	{0x75b0, 7020},
-	{0x75b1, 7019},
-	{0x75b2, 3010},
-	{0x75b3, 7015},
-	{0x75b4, 7016},
-	{0x75b5, 1350},
-	{0x75b7, 0},
-	{0x75b8, 7017},
-	{0x75b9, 4495},
-	{0x75bb, 0},
-	{0x75bc, 3630},
-	{0x75bd, 2305},
-	{0x75be, 2085},
-	{0x75c0, 0},
-	{0x75c1, 1},
-	{0x75c2, 7022},
-	{0x75c3, 7021},
-	{0x75c4, 7018},
-	{0x75c5, 1128},
-	{0x75c7, 4513},
-	{0x75c8, 4253},
-	{0x75c9, 2278},
-	{0x75ca, 3207},
-	{0x75cc, 0},
-	{0x75cd, 7024},
-	{0x75cf, 0},
-	{0x75d0, 1},
-	{0x75d1, 2},
-	{0x75d2, 4128},
-	{0x75d4, 4555},
-	{0x75d5, 1938},
-	{0x75d6, 7023},
-	{0x75d8, 1530},
-	{0x75d9, 8134},
-	{0x75db, 3685},
-	{0x75dd, 0},
-	{0x75de, 3013},
-	{0x75e0, 0},
-	{0x75e1, 1},
-	{0x75e2, 2538},
-	{0x75e3, 7025},
-	{0x75e4, 7028},
-	{0x75e6, 7027},
-	{0x75e7, 7030},
-	{0x75e8, 7026},
-	{0x75ea, 2003},
-	{0x75eb, 7029},
-	{0x75ed, 0},
-	{0x75ee, 1},
-	{0x75ef, 2},
-	{0x75f0, 3592},
-	{0x75f1, 7032},
-	{0x75f3, 0},
-	{0x75f4, 1274},
-	{0x75f6, 0},
-	{0x75f7, 1},
-	{0x75f8, 2},
-	{0x75f9, 1085},
-	{0x75fb, 0},
-	{0x75fc, 7033},
-	{0x75fe, 0},
-	{0x75ff, 7034},
-	{0x7600, 7036},
-	{0x7601, 1380},
-	{0x7602, 9646},
-	{0x7603, 7031},
-	{0x7605, 7037},
-	{0x7607, 0},
-	{0x7608, 1},
-	{0x7609, 2},
-	{0x760a, 7040},
-	{0x760b, 7937},
-	{0x760c, 7038},
-	{0x760d, 8704},
-	{0x760f, 0},
-	{0x7610, 7035},
-	{0x7612, 0},
-	{0x7613, 1},
-	{0x7614, 2},
-	{0x7615, 7043},
-	{0x7617, 7039},
-	{0x7618, 7042},
-	{0x7619, 7044},
-	{0x761b, 7045},
-	{0x761d, 0},
-	{0x761e, 9650},
-	{0x761f, 3792},
-	{0x7620, 7048},
-	{0x7621, 7831},
-	{0x7622, 7047},
-	{0x7624, 2623},
-	{0x7625, 7041},
-	{0x7626, 3444},
-	{0x7627, 8363},
-	{0x7629, 1396},
-	{0x762a, 1114},
-	{0x762b, 3588},
-	{0x762d, 7050},
-	{0x762f, 0},
-	{0x7630, 7051},
-	{0x7632, 0},
-	{0x7633, 7056},
-	{0x7634, 4463},
-	{0x7635, 7053},
-	{0x7637, 0},
-	{0x7638, 3214},
-	{0x763a, 0},
-	{0x763b, 9651},
-	{0x763c, 7046},
-	{0x763e, 7055},
-	{0x763f, 7052},
-	{0x7640, 7049},
-	{0x7642, 8232},
-	{0x7643, 7054},
-	{0x7645, 0},
-	{0x7646, 9647},
-	{0x7647, 9648},
-	{0x7649, 9649},
-	{0x764b, 0},
-	{0x764c, 948},
-	{0x764d, 7057},
-	{0x764f, 0},
-	{0x7650, 1},
-	{0x7651, 2},
-	{0x7652, 3},
-	{0x7653, 4},
-	{0x7654, 7059},
-	{0x7656, 7061},
-	{0x7658, 9644},
-	{0x765a, 0},
-	{0x765b, 1},
-	{0x765c, 7060},
-	{0x765e, 7058},
-	{0x765f, 7758},
-	{0x7661, 0},
-	{0x7662, 8706},
-	{0x7663, 4043},
-	{0x7664, 9643},
-	{0x7665, 8838},
-	{0x7667, 9645},
-	{0x7669, 9654},
-	{0x766b, 7062},
-	{0x766c, 8675},
-	{0x766d, 9652},
-	{0x766e, 9653},
-	{0x766f, 7063},
-	{0x7670, 8751},
-	{0x7671, 8549},
-	{0x7672, 9655},
-	{0x7674, 0},
-	{0x7675, 1},
-	{0x7676, 2},
-	{0x7677, 3},
-	{0x7678, 1864},
-	{0x767a, 0},
-	{0x767b, 1448},
-	{0x767c, 7913},
-	{0x767d, 994},
-	{0x767e, 996},
-	{0x7680, 0},
-	{0x7681, 1},
-	{0x7682, 4400},
-	{0x7684, 1445},
-	{0x7686, 2213},
-	{0x7687, 2015},
-	{0x7688, 6957},
-	{0x768a, 0},
-	{0x768b, 1753},
-	{0x768d, 0},
-	{0x768e, 6958},
-	{0x7690, 0},
-	{0x7691, 947},
-	{0x7693, 6959},
-	{0x7695, 0},
-	{0x7696, 3743},
-	{0x7698, 0},
-	{0x7699, 6960},
-	{0x769a, 7717},
-	{0x769c, 0},
-	{0x769d, 1},
-	{0x769e, 2},
-	{0x769f, 3},
-	{0x76a0, 4},
-	{0x76a1, 5},
-	{0x76a2, 6},
-	{0x76a3, 7},
-	{0x76a4, 6961},
-	{0x76a6, 0},
-	{0x76a7, 1},
-	{0x76a8, 2},
-	{0x76a9, 3},
-	{0x76aa, 4},
-	{0x76ab, 5},
-	{0x76ac, 6},
-	{0x76ad, 7},
-	{0x76ae, 3011},
-	{0x76b0, 0},
-	{0x76b1, 4580},
-	{0x76b2, 7112},
-	{0x76b4, 7113},
-	{0x76b6, 0},
-	{0x76b7, 1},
-	{0x76b8, 9664},
-	{0x76ba, 8858},
-	{0x76bc, 0},
-	{0x76bd, 1},
-	{0x76be, 2},
-	{0x76bf, 2808},
-	{0x76c1, 0},
-	{0x76c2, 4288},
-	{0x76c4, 0},
-	{0x76c5, 4560},
-	{0x76c6, 2985},
-	{0x76c8, 4244},
-	{0x76ca, 4205},
-	{0x76cc, 0},
-	{0x76cd, 6795},
-	{0x76ce, 966},
-	{0x76cf, 4438},
-	{0x76d0, 4087},
-	{0x76d1, 2131},
-	{0x76d2, 1927},
-	{0x76d4, 2437},
-	{0x76d6, 1730},
-	{0x76d7, 1442},
-	{0x76d8, 2957},
-	{0x76da, 0},
-	{0x76db, 3385},
-	{0x76dd, 0},
-	{0x76de, 8814},
-	{0x76df, 2768},
-	{0x76e1, 8125},
-	{0x76e3, 8068},
-	{0x76e4, 8370},
-	{0x76e5, 6796},
-	{0x76e7, 8259},
-	{0x76e9, 0},
-	{0x76ea, 1},
-	{0x76eb, 2},
-	{0x76ec, 3},
-	{0x76ed, 4},
-	{0x76ee, 2850},
-	{0x76ef, 1505},
-	{0x76f1, 6744},
-	{0x76f2, 2729},
-	{0x76f4, 4528},
-	{0x76f6, 0},
-	{0x76f7, 1},
-	{0x76f8, 3917},
-	{0x76f9, 6747},
-	{0x76fb, 0},
-	{0x76fc, 2959},
-	{0x76fe, 1563},
-	{0x7701, 3384},
-	{0x7703, 0},
-	{0x7704, 6745},
-	{0x7706, 0},
-	{0x7707, 6748},
-	{0x7708, 6749},
-	{0x7709, 2753},
-	{0x770b, 2369},
-	{0x770d, 6746},
-	{0x770f, 0},
-	{0x7710, 1},
-	{0x7711, 2},
-	{0x7712, 3},
-	{0x7713, 4},
-	{0x7714, 5},
-	{0x7715, 6},
-	{0x7716, 7},
-	{0x7717, 8},
-	{0x7718, 9},
-	{0x7719, 6752},
-	{0x771a, 6750},
-	{0x771c, 0},
-	{0x771d, 1},
-	{0x771e, 2},
-	{0x771f, 4487},
-	{0x7720, 2788},
-	{0x7722, 6751},
-	{0x7724, 0},
-	{0x7725, 1},
-	{0x7726, 6754},
-	{0x7728, 4420},
-	{0x7729, 4044},
-	{0x772b, 0},
-	{0x772c, 1},
-	{0x772d, 6753},
-	{0x772f, 2773},
-	{0x7731, 0},
-	{0x7732, 1},
-	{0x7733, 2},
-	{0x7734, 3},
-	{0x7735, 6755},
-	{0x7736, 2433},
-	{0x7737, 2331},
-	{0x7738, 6756},
-	{0x773a, 3658},
-	{0x773c, 4100},
-	{0x773e, 0},
-	{0x773f, 1},
-	{0x7740, 4642},
-	{0x7741, 4503},
-	{0x7743, 6760},
-	{0x7745, 0},
-	{0x7746, 1},
-	{0x7747, 6759},
-	{0x7749, 0},
-	{0x774a, 1},
-	{0x774b, 2},
-	{0x774c, 3},
-	{0x774d, 4},
-	{0x774e, 5},
-	{0x774f, 9860},
-	{0x7750, 6757},
-	{0x7751, 6758},
-	{0x7753, 0},
-	{0x7754, 1},
-	{0x7755, 2},
-	{0x7756, 3},
-	{0x7757, 4},
-	{0x7758, 5},
-	{0x7759, 6},
-	{0x775a, 6761},
-	{0x775b, 2261},
-	{0x775d, 0},
-	{0x775e, 9455},
-	{0x7760, 0},
-	{0x7761, 3492},
-	{0x7762, 6763},
-	{0x7763, 1532},
-	{0x7765, 6764},
-	{0x7766, 2851},
-	{0x7768, 6762},
-	{0x776a, 0},
-	{0x776b, 2223},
-	{0x776c, 1166},
-	{0x776e, 0},
-	{0x776f, 1},
-	{0x7770, 2},
-	{0x7771, 3},
-	{0x7772, 4},
-	{0x7773, 5},
-	{0x7774, 6},
-	{0x7775, 7},
-	{0x7776, 8},
-	{0x7777, 9},
-	{0x7778, 10},
-	{0x7779, 1538},
-	{0x777b, 0},
-	{0x777c, 1},
-	{0x777d, 6767},
-	{0x777e, 4720},
-	{0x777f, 6765},
-	{0x7780, 6768},
-	{0x7782, 0},
-	{0x7783, 1},
-	{0x7784, 2798},
-	{0x7785, 1303},
-	{0x7787, 0},
-	{0x7788, 1},
-	{0x7789, 2},
-	{0x778a, 3},
-	{0x778b, 4},
-	{0x778c, 6769},
-	{0x778d, 6766},
-	{0x778e, 3878},
-	{0x7790, 0},
-	{0x7791, 6770},
-	{0x7792, 2718},
-	{0x7794, 0},
-	{0x7795, 1},
-	{0x7796, 2},
-	{0x7797, 3},
-	{0x7798, 9454},
-	{0x779a, 0},
-	{0x779b, 1},
-	{0x779c, 2},
-	{0x779d, 3},
-	{0x779e, 8308},
-	{0x779f, 6771},
-	{0x77a0, 6772},
-	{0x77a2, 5269},
-	{0x77a4, 0},
-	{0x77a5, 3026},
-	{0x77a7, 3139},
-	{0x77a9, 4596},
-	{0x77aa, 1450},
-	{0x77ac, 3495},
-	{0x77ad, 9863},
-	{0x77af, 0},
-	{0x77b0, 6773},
-	{0x77b2, 0},
-	{0x77b3, 3676},
-	{0x77b5, 6774},
-	{0x77b7, 0},
-	{0x77b8, 1},
-	{0x77b9, 2},
-	{0x77ba, 3},
-	{0x77bb, 4433},
-	{0x77bc, 9456},
-	{0x77bd, 6775},
-	{0x77bf, 7550},
-	{0x77c1, 0},
-	{0x77c2, 1},
-	{0x77c3, 2},
-	{0x77c4, 3},
-	{0x77c5, 4},
-	{0x77c6, 5},
-	{0x77c7, 9869},
-	{0x77c9, 0},
-	{0x77ca, 1},
-	{0x77cb, 2},
-	{0x77cc, 3},
-	{0x77cd, 5015},
-	{0x77cf, 0},
-	{0x77d0, 1},
-	{0x77d1, 2},
-	{0x77d2, 3},
-	{0x77d3, 4},
-	{0x77d4, 5},
-	{0x77d5, 6},
-	{0x77d6, 7},
-	{0x77d7, 1318},
-	{0x77d9, 0},
-	{0x77da, 8864},
-	{0x77db, 2737},
-	{0x77dc, 7114},
-	{0x77de, 0},
-	{0x77df, 1},
-	{0x77e0, 2},
-	{0x77e1, 3},
-	{0x77e2, 3407},
-	{0x77e3, 4186},
-	{0x77e5, 4521},
-	{0x77e7, 6938},
-	{0x77e9, 2311},
-	{0x77eb, 2196},
-	{0x77ec, 6939},
-	{0x77ed, 1547},
-	{0x77ee, 950},
-	{0x77ef, 8107},
-	{0x77f1, 0},
-	{0x77f2, 1},
-	{0x77f3, 3398},
-	{0x77f5, 0},
-	{0x77f6, 6690},
-	{0x77f8, 6691},
-	{0x77fa, 0},
-	{0x77fb, 1},
-	{0x77fc, 2},
-	{0x77fd, 3848},
-	{0x77fe, 1612},
-	{0x77ff, 2432},
-	{0x7800, 6692},
-	{0x7801, 2706},
-	{0x7802, 3305},
-	{0x7804, 0},
-	{0x7805, 1},
-	{0x7806, 2},
-	{0x7807, 3},
-	{0x7808, 4},
-	{0x7809, 6693},
-	{0x780b, 0},
-	{0x780c, 3093},
-	{0x780d, 2368},
-	{0x780f, 0},
-	{0x7810, 1},
-	{0x7811, 6696},
-	{0x7812, 3001},
-	{0x7814, 4089},
-	{0x7816, 4614},
-	{0x7817, 6694},
-	{0x7818, 6695},
-	{0x781a, 4107},
-	{0x781c, 6699},
-	{0x781d, 6700},
-	{0x781f, 6704},
-	{0x7821, 0},
-	{0x7822, 1},
-	{0x7823, 6708},
-	{0x7825, 6706},
-	{0x7826, 6714},
-	{0x7827, 4489},
-	{0x7829, 6709},
-	{0x782b, 0},
-	{0x782c, 6707},
-	{0x782d, 6698},
-	{0x782f, 0},
-	{0x7830, 2986},
-	{0x7832, 0},
-	{0x7833, 1},
-	{0x7834, 3045},
-	{0x7836, 0},
-	{0x7837, 3362},
-	{0x7838, 4373},
-	{0x7839, 6701},
-	{0x783a, 6702},
-	{0x783b, 6703},
-	{0x783c, 6705},
-	{0x783e, 2532},
-	{0x7840, 1316},
-	{0x7842, 0},
-	{0x7843, 9896},
-	{0x7845, 1857},
-	{0x7847, 6716},
-	{0x7849, 0},
-	{0x784a, 1},
-	{0x784b, 2},
-	{0x784c, 6717},
-	{0x784e, 6710},
-	{0x7850, 6715},
-	{0x7852, 3847},
-	{0x7854, 0},
-	{0x7855, 3499},
-	{0x7856, 6712},
-	{0x7857, 6713},
-	{0x7859, 0},
-	{0x785a, 1},
-	{0x785b, 2},
-	{0x785c, 3},
-	{0x785d, 3938},
-	{0x785f, 0},
-	{0x7860, 1},
-	{0x7861, 2},
-	{0x7862, 3},
-	{0x7863, 4},
-	{0x7864, 9449},
-	{0x7866, 0},
-	{0x7867, 1},
-	{0x7868, 9445},
-	{0x786a, 6718},
-	{0x786b, 2619},
-	{0x786c, 4247},
-	{0x786d, 6711},
-	{0x786e, 3218},
-	{0x786f, 8698},
-	{0x7871, 0},
-	{0x7872, 1},
-	{0x7873, 2},
-	{0x7874, 3},
-	{0x7875, 4},
-	{0x7876, 5},
-	{0x7877, 2146},
-	{0x7879, 0},
-	{0x787a, 1},
-	{0x787b, 2},
-	{0x787c, 2993},
-	{0x787e, 0},
-	{0x787f, 1},
-	{0x7880, 2},
-	{0x7881, 3},
-	{0x7882, 4},
-	{0x7883, 5},
-	{0x7884, 6},
-	{0x7885, 7},
-	{0x7886, 8},
-	{0x7887, 6722},
-	{0x7889, 1488},
-	{0x788b, 0},
-	{0x788c, 2652},
-	{0x788d, 952},
-	{0x788e, 3550},
-	{0x7890, 0},
-	{0x7891, 1047},
-	{0x7893, 6720},
-	{0x7895, 0},
-	{0x7896, 1},
-	{0x7897, 3740},
-	{0x7898, 1475},
-	{0x789a, 6721},
-	{0x789b, 6719},
-	{0x789c, 6723},
-	{0x789e, 0},
-	{0x789f, 1499},
-	{0x78a1, 6724},
-	{0x78a3, 6725},
-	{0x78a5, 6728},
-	{0x78a7, 1077},
-	{0x78a9, 8520},
-	{0x78ab, 0},
-	{0x78ac, 1},
-	{0x78ad, 9444},
-	{0x78af, 0},
-	{0x78b0, 2999},
-	{0x78b1, 2145},
-	{0x78b2, 6726},
-	{0x78b3, 3599},
-	{0x78b4, 1201},
-	{0x78b6, 0},
-	{0x78b7, 1},
-	{0x78b8, 9446},
-	{0x78b9, 6727},
-	{0x78ba, 8439},
-	{0x78bc, 8299},
-	{0x78be, 2894},
-	{0x78c0, 0},
-	{0x78c1, 1352},
-	{0x78c3, 0},
-	{0x78c4, 1},
-	{0x78c5, 1024},
-	{0x78c7, 0},
-	{0x78c8, 1},
-	{0x78c9, 6731},
-	{0x78ca, 2501},
-	{0x78cb, 1387},
-	{0x78cd, 0},
-	{0x78ce, 1},
-	{0x78cf, 2},
-	{0x78d0, 2958},
-	{0x78d2, 0},
-	{0x78d3, 1},
-	{0x78d4, 6729},
-	{0x78d5, 2385},
-	{0x78d7, 0},
-	{0x78d8, 1},
-	{0x78d9, 6730},
-	{0x78da, 8871},
-	{0x78dc, 0},
-	{0x78dd, 1},
-	{0x78de, 2},
-	{0x78df, 3},
-	{0x78e0, 4},
-	{0x78e1, 5},
-	{0x78e2, 6},
-	{0x78e3, 9452},
-	{0x78e5, 0},
-	{0x78e6, 1},
-	{0x78e7, 9451},
-	{0x78e8, 2824},
-	{0x78ea, 0},
-	{0x78eb, 1},
-	{0x78ec, 6732},
-	{0x78ee, 0},
-	{0x78ef, 9443},
-	{0x78f1, 0},
-	{0x78f2, 6733},
-	{0x78f4, 6735},
-	{0x78f6, 0},
-	{0x78f7, 2592},
-	{0x78f9, 0},
-	{0x78fa, 2012},
-	{0x78fc, 0},
-	{0x78fd, 9450},
-	{0x78ff, 0},
-	{0x7901, 2185},
-	{0x7903, 0},
-	{0x7904, 1},
-	{0x7905, 6734},
-	{0x7907, 0},
-	{0x7908, 1},
-	{0x7909, 2},
-	{0x790a, 3},
-	{0x790b, 4},
-	{0x790c, 5},
-	{0x790d, 6},
-	{0x790e, 7826},
-	{0x7910, 0},
-	{0x7911, 1},
-	{0x7912, 2},
-	{0x7913, 6736},
-	{0x7915, 0},
-	{0x7916, 1},
-	{0x7917, 2},
-	{0x7918, 3},
-	{0x7919, 7719},
-	{0x791b, 0},
-	{0x791c, 1},
-	{0x791d, 2},
-	{0x791e, 6738},
-	{0x7920, 0},
-	{0x7921, 1},
-	{0x7922, 2},
-	{0x7923, 3},
-	{0x7924, 6737},
-	{0x7926, 8166},
-	{0x7928, 0},
-	{0x7929, 1},
-	{0x792a, 9447},
-	{0x792b, 8210},
-	{0x792c, 7916},
-	{0x792e, 0},
-	{0x792f, 1},
-	{0x7930, 2},
-	{0x7931, 9448},
-	{0x7933, 0},
-	{0x7934, 6739},
-	{0x7936, 0},
-	{0x7937, 1},
-	{0x7938, 2},
-	{0x7939, 3},
-	{0x793a, 3413},
-	{0x793b, 6648},
-	{0x793c, 2524},
-	{0x793e, 3360},
-	{0x7940, 6649},
-	{0x7941, 3085},
-	{0x7943, 0},
-	{0x7944, 1},
-	{0x7945, 2},
-	{0x7946, 6650},
-	{0x7948, 3084},
-	{0x7949, 6651},
-	{0x794b, 0},
-	{0x794c, 1},
-	{0x794d, 2},
-	{0x794e, 3},
-	{0x794f, 4},
-	{0x7950, 5},
-	{0x7951, 6},
-	{0x7952, 7},
-	{0x7953, 6654},
-	{0x7955, 0},
-	{0x7956, 4675},
-	{0x7957, 6657},
-	{0x7959, 0},
-	{0x795a, 6655},
-	{0x795b, 6652},
-	{0x795c, 6653},
-	{0x795d, 4608},
-	{0x795e, 3370},
-	{0x795f, 3555},
-	{0x7960, 6658},
-	{0x7962, 6656},
-	{0x7964, 0},
-	{0x7965, 3926},
-	{0x7967, 6660},
-	{0x7968, 3024},
-	{0x796a, 0},
-	{0x796b, 1},
-	{0x796c, 2},
-	{0x796d, 2099},
-	{0x796f, 6659},
-	{0x7971, 0},
-	{0x7972, 1},
-	{0x7973, 2},
-	{0x7974, 3},
-	{0x7975, 4},
-	{0x7976, 5},
-	{0x7977, 1436},
-	{0x7978, 2059},
-	{0x797a, 6661},
-	{0x797c, 0},
-	{0x797d, 1},
-	{0x797e, 2},
-	{0x797f, 3},
-	{0x7980, 4875},
-	{0x7981, 2252},
-	{0x7983, 0},
-	{0x7984, 2658},
-	{0x7985, 6662},
-	{0x7987, 0},
-	{0x7988, 1},
-	{0x7989, 2},
-	{0x798a, 6663},
-	{0x798c, 0},
-	{0x798d, 8038},
-	{0x798e, 9436},
-	{0x798f, 1694},
-	{0x7991, 0},
-	{0x7992, 1},
-	{0x7993, 2},
-	{0x7994, 3},
-	{0x7995, 4},
-	{0x7996, 5},
-	{0x7997, 6},
-	{0x7998, 7},
-	{0x7999, 8},
-	{0x799a, 6664},
-	{0x799c, 0},
-	{0x799d, 1},
-	{0x799e, 2},
-	{0x799f, 3},
-	{0x79a0, 4},
-	{0x79a1, 5},
-	{0x79a2, 6},
-	{0x79a3, 7},
-	{0x79a4, 8},
-	{0x79a5, 9},
-	{0x79a6, 9890},
-	{0x79a7, 6665},
-	{0x79a9, 0},
-	{0x79aa, 9437},
-	{0x79ac, 0},
-	{0x79ad, 1},
-	{0x79ae, 8206},
-	{0x79b0, 9435},
-	{0x79b1, 7864},
-	{0x79b3, 6666},
-	{0x79b5, 0},
-	{0x79b6, 1},
-	{0x79b7, 2},
-	{0x79b8, 3},
-	{0x79b9, 4306},
-	{0x79ba, 4708},
-	{0x79bb, 2518},
-	{0x79bd, 3162},
-	{0x79be, 1923},
-	{0x79c0, 4014},
-	{0x79c1, 3506},
-	{0x79c3, 3691},
-	{0x79c5, 0},
-	{0x79c6, 1740},
-	{0x79c8, 0},
-	{0x79c9, 1125},
-	{0x79cb, 3180},
-	{0x79cd, 4565},
-	{0x79cf, 0},
-	{0x79d0, 1},
-	{0x79d1, 2387},
-	{0x79d2, 2800},
-	{0x79d4, 0},
-	{0x79d5, 6941},
-	{0x79d7, 0},
-	{0x79d8, 2781},
-	{0x79da, 0},
-	{0x79db, 1},
-	{0x79dc, 2},
-	{0x79dd, 3},
-	{0x79de, 4},
-	{0x79df, 4671},
-	{0x79e1, 0},
-	{0x79e2, 1},
-	{0x79e3, 6943},
-	{0x79e4, 1272},
-	{0x79e6, 3157},
-	{0x79e7, 4118},
-	{0x79e9, 4551},
-	{0x79eb, 6944},
-	{0x79ed, 6942},
-	{0x79ef, 2066},
-	{0x79f0, 1259},
-	{0x79f2, 0},
-	{0x79f3, 1},
-	{0x79f4, 2},
-	{0x79f5, 3},
-	{0x79f6, 4},
-	{0x79f7, 5},
-	{0x79f8, 2214},
-	{0x79fa, 0},
-	{0x79fb, 4173},
-	{0x79fd, 2037},
-	{0x79ff, 0},
-	{0x7a00, 3854},
-	{0x7a02, 6948},
-	{0x7a03, 6947},
-	{0x7a05, 0},
-	{0x7a06, 6945},
-	{0x7a08, 0},
-	{0x7a09, 1},
-	{0x7a0a, 2},
-	{0x7a0b, 1265},
-	{0x7a0d, 3341},
-	{0x7a0e, 3493},
-	{0x7a10, 0},
-	{0x7a11, 1},
-	{0x7a12, 2},
-	{0x7a13, 3},
-	{0x7a14, 6950},
-	{0x7a16, 0},
-	{0x7a17, 1001},
-	{0x7a19, 0},
-	{0x7a1a, 4552},
-	{0x7a1c, 0},
-	{0x7a1d, 1},
-	{0x7a1e, 6949},
-	{0x7a20, 1298},
-	{0x7a22, 0},
-	{0x7a23, 7567},
-	{0x7a25, 0},
-	{0x7a26, 1},
-	{0x7a27, 2},
-	{0x7a28, 3},
-	{0x7a29, 4},
-	{0x7a2a, 5},
-	{0x7a2b, 6},
-	{0x7a2c, 7},
-	{0x7a2d, 8},
-	{0x7a2e, 8853},
-	{0x7a30, 0},
-	{0x7a31, 7808},
-	{0x7a33, 3799},
-	{0x7a35, 0},
-	{0x7a36, 1},
-	{0x7a37, 6952},
-	{0x7a39, 6951},
-	{0x7a3b, 1439},
-	{0x7a3c, 2125},
-	{0x7a3d, 2065},
-	{0x7a3f, 1760},
-	{0x7a40, 9847},
-	{0x7a42, 0},
-	{0x7a43, 1},
-	{0x7a44, 2},
-	{0x7a45, 3},
-	{0x7a46, 2853},
-	{0x7a48, 0},
-	{0x7a49, 1},
-	{0x7a4a, 2},
-	{0x7a4b, 3},
-	{0x7a4c, 9764},
-	{0x7a4d, 8041},
-	{0x7a4e, 8747},
-	{0x7a50, 0},
-	{0x7a51, 6953},
-	{0x7a53, 0},
-	{0x7a54, 1},
-	{0x7a55, 2},
-	{0x7a56, 3},
-	{0x7a57, 3552},
-	{0x7a59, 0},
-	{0x7a5a, 1},
-	{0x7a5b, 2},
-	{0x7a5c, 3},
-	{0x7a5d, 4},
-	{0x7a5e, 5},
-	{0x7a5f, 6},
-	{0x7a60, 7},
-	{0x7a61, 9599},
-	{0x7a62, 8027},
-	{0x7a64, 0},
-	{0x7a65, 1},
-	{0x7a66, 2},
-	{0x7a67, 3},
-	{0x7a68, 4},
-	{0x7a69, 8603},
-	{0x7a6b, 9853},
-	{0x7a6d, 0},
-	{0x7a6e, 1},
-	{0x7a6f, 2},
-	{0x7a70, 6956},
-	{0x7a72, 0},
-	{0x7a73, 1},
-	{0x7a74, 4049},
-	{0x7a76, 2286},
-	{0x7a77, 3179},
-	{0x7a78, 7066},
-	{0x7a79, 7067},
-	{0x7a7a, 2402},
-	{0x7a7c, 0},
-	{0x7a7d, 1},
-	{0x7a7e, 2},
-	{0x7a7f, 1324},
-	{0x7a80, 7068},
-	{0x7a81, 3692},
-	{0x7a83, 3153},
-	{0x7a84, 4430},
-	{0x7a86, 7069},
-	{0x7a88, 7070},
-	{0x7a8a, 0},
-	{0x7a8b, 1},
-	{0x7a8c, 2},
-	{0x7a8d, 3148},
-	{0x7a8f, 0},
-	{0x7a90, 1},
-	{0x7a91, 4139},
-	{0x7a92, 4558},
-	{0x7a94, 0},
-	{0x7a95, 7071},
-	{0x7a96, 2210},
-	{0x7a97, 1331},
-	{0x7a98, 2284},
-	{0x7a9a, 0},
-	{0x7a9b, 1},
-	{0x7a9c, 1375},
-	{0x7a9d, 3808},
-	{0x7a9f, 2412},
-	{0x7aa0, 7073},
-	{0x7aa2, 0},
-	{0x7aa3, 1},
-	{0x7aa4, 2},
-	{0x7aa5, 2439},
-	{0x7aa6, 7072},
-	{0x7aa8, 7075},
-	{0x7aa9, 8608},
-	{0x7aaa, 8582},
-	{0x7aac, 7074},
-	{0x7aad, 7076},
-	{0x7aae, 8429},
-	{0x7ab0, 0},
-	{0x7ab1, 1},
-	{0x7ab2, 2},
-	{0x7ab3, 7077},
-	{0x7ab5, 0},
-	{0x7ab6, 9657},
-	{0x7ab8, 0},
-	{0x7ab9, 1},
-	{0x7aba, 8170},
-	{0x7abc, 0},
-	{0x7abd, 1},
-	{0x7abe, 2},
-	{0x7abf, 2631},
-	{0x7ac1, 0},
-	{0x7ac2, 1},
-	{0x7ac3, 2},
-	{0x7ac4, 7844},
-	{0x7ac5, 8417},
-	{0x7ac7, 9656},
-	{0x7ac8, 8800},
-	{0x7aca, 8418},
-	{0x7acb, 2539},
-	{0x7acd, 0},
-	{0x7ace, 1},
-	{0x7acf, 2},
-	{0x7ad0, 3},
-	{0x7ad1, 4},
-	{0x7ad2, 5},
-	{0x7ad3, 6},
-	{0x7ad4, 7},
-	{0x7ad5, 8},
-	{0x7ad6, 3473},
-	{0x7ad8, 0},
-	{0x7ad9, 4447},
-	{0x7adb, 0},
-	{0x7adc, 1},
-	{0x7add, 2},
-	{0x7ade, 2281},
-	{0x7adf, 2280},
-	{0x7ae0, 4451},
-	{0x7ae2, 0},
-	{0x7ae3, 2351},
-	{0x7ae5, 3680},
-	{0x7ae6, 7065},
-	{0x7ae8, 0},
-	{0x7ae9, 1},
-	{0x7aea, 8513},
-	{0x7aec, 0},
-	{0x7aed, 2224},
-	{0x7aef, 1546},
-	{0x7af1, 0},
-	{0x7af2, 1},
-	{0x7af3, 2},
-	{0x7af4, 3},
-	{0x7af5, 4},
-	{0x7af6, 8135},
-	{0x7af8, 0},
-	{0x7af9, 4592},
-	{0x7afa, 7267},
-	{0x7afc, 0},
-	{0x7afd, 7268},
-	{0x7aff, 1736},
-	{0x7b01, 0},
-	{0x7b02, 1},
-	{0x7b03, 7270},
-	{0x7b04, 7271},
-	{0x7b06, 981},
-	{0x7b08, 7269},
-	{0x7b0a, 7273},
-	{0x7b0b, 3558},
-	{0x7b0d, 0},
-	{0x7b0e, 1},
-	{0x7b0f, 7275},
-	{0x7b11, 3953},
-	{0x7b13, 0},
-	{0x7b14, 1075},
-	{0x7b15, 7272},
-	{0x7b17, 0},
-	{0x7b18, 1},
-	{0x7b19, 7279},
-	{0x7b1b, 1458},
-	{0x7b1d, 0},
-	{0x7b1e, 7287},
-	{0x7b20, 7282},
-	{0x7b22, 0},
-	{0x7b23, 1},
-	{0x7b24, 7284},
-	{0x7b25, 7283},
-	{0x7b26, 1688},
-	{0x7b28, 1064},
-	{0x7b2a, 7278},
-	{0x7b2b, 7274},
-	{0x7b2c, 1467},
-	{0x7b2e, 7280},
-	{0x7b30, 0},
-	{0x7b31, 7281},
-	{0x7b33, 7285},
-	{0x7b35, 0},
-	{0x7b36, 1},
-	{0x7b37, 2},
-	{0x7b38, 7277},
-	{0x7b3a, 2134},
-	{0x7b3c, 2630},
-	{0x7b3e, 7286},
-	{0x7b40, 0},
-	{0x7b41, 1},
-	{0x7b42, 2},
-	{0x7b43, 3},
-	{0x7b44, 4},
-	{0x7b45, 7290},
-	{0x7b46, 7745},
-	{0x7b47, 7276},
-	{0x7b49, 1449},
-	{0x7b4b, 2239},
-	{0x7b4c, 7292},
-	{0x7b4e, 0},
-	{0x7b4f, 1601},
-	{0x7b50, 2429},
-	{0x7b51, 4605},
-	{0x7b52, 3683},
-	{0x7b54, 1395},
-	{0x7b56, 1190},
-	{0x7b58, 7288},
-	{0x7b5a, 7289},
-	{0x7b5b, 3313},
-	{0x7b5d, 7293},
-	{0x7b5f, 0},
-	{0x7b60, 7294},
-	{0x7b62, 7297},
-	{0x7b64, 0},
-	{0x7b65, 1},
-	{0x7b66, 2},
-	{0x7b67, 9700},
-	{0x7b69, 0},
-	{0x7b6a, 1},
-	{0x7b6b, 2},
-	{0x7b6c, 3},
-	{0x7b6d, 4},
-	{0x7b6e, 7295},
-	{0x7b70, 0},
-	{0x7b71, 7299},
-	{0x7b72, 7298},
-	{0x7b74, 0},
-	{0x7b75, 7291},
-	{0x7b77, 2423},
-	{0x7b79, 1300},
-	{0x7b7b, 7296},
-	{0x7b7d, 0},
-	{0x7b7e, 3110},
-	{0x7b80, 2149},
-	{0x7b82, 0},
-	{0x7b83, 1},
-	{0x7b84, 2},
-	{0x7b85, 7307},
-	{0x7b87, 0},
-	{0x7b88, 1},
-	{0x7b89, 2},
-	{0x7b8a, 3},
-	{0x7b8b, 8070},
-	{0x7b8d, 1816},
-	{0x7b8f, 0},
-	{0x7b90, 7300},
-	{0x7b92, 0},
-	{0x7b93, 1},
-	{0x7b94, 1140},
-	{0x7b95, 2067},
-	{0x7b97, 3544},
-	{0x7b99, 0},
-	{0x7b9a, 1},
-	{0x7b9b, 2},
-	{0x7b9c, 7309},
-	{0x7b9d, 7305},
-	{0x7b9f, 0},
-	{0x7ba0, 1},
-	{0x7ba1, 1845},
-	{0x7ba2, 7310},
-	{0x7ba4, 0},
-	{0x7ba5, 1},
-	{0x7ba6, 7301},
-	{0x7ba7, 7302},
-	{0x7ba8, 7306},
-	{0x7ba9, 2696},
-	{0x7baa, 7308},
-	{0x7bab, 7311},
-	{0x7bac, 7304},
-	{0x7bad, 2160},
-	{0x7baf, 0},
-	{0x7bb0, 1},
-	{0x7bb1, 3921},
-	{0x7bb3, 0},
-	{0x7bb4, 7312},
-	{0x7bb6, 0},
-	{0x7bb7, 1},
-	{0x7bb8, 7303},
-	{0x7bba, 0},
-	{0x7bbb, 1},
-	{0x7bbc, 2},
-	{0x7bbd, 3},
-	{0x7bbe, 4},
-	{0x7bbf, 5},
-	{0x7bc0, 8115},
-	{0x7bc1, 7314},
-	{0x7bc3, 0},
-	{0x7bc4, 7919},
-	{0x7bc6, 4618},
-	{0x7bc7, 3017},
-	{0x7bc9, 8868},
-	{0x7bcb, 9704},
-	{0x7bcc, 7315},
-	{0x7bce, 0},
-	{0x7bcf, 1},
-	{0x7bd0, 2},
-	{0x7bd1, 7313},
-	{0x7bd3, 2639},
-	{0x7bd5, 0},
-	{0x7bd6, 1},
-	{0x7bd7, 2},
-	{0x7bd8, 3},
-	{0x7bd9, 1752},
-	{0x7bda, 7317},
-	{0x7bdc, 0},
-	{0x7bdd, 7316},
-	{0x7bdf, 0},
-	{0x7be0, 1},
-	{0x7be1, 1374},
-	{0x7be3, 0},
-	{0x7be4, 9699},
-	{0x7be5, 7318},
-	{0x7be6, 7319},
-	{0x7be8, 0},
-	{0x7be9, 8465},
-	{0x7bea, 7320},
-	{0x7bec, 0},
-	{0x7bed, 1},
-	{0x7bee, 2469},
-	{0x7bf0, 0},
-	{0x7bf1, 2516},
-	{0x7bf3, 9702},
-	{0x7bf5, 0},
-	{0x7bf6, 1},
-	{0x7bf7, 2994},
-	{0x7bf9, 0},
-	{0x7bfa, 1},
-	{0x7bfb, 2},
-	{0x7bfc, 7323},
-	{0x7bfe, 7322},
-	{0x7c00, 9703},
-	{0x7c02, 0},
-	{0x7c03, 1},
-	{0x7c04, 2},
-	{0x7c05, 3},
-	{0x7c06, 4},
-	{0x7c07, 1371},
-	{0x7c09, 0},
-	{0x7c0a, 1},
-	{0x7c0b, 7326},
-	{0x7c0c, 7321},
-	{0x7c0d, 8257},
-	{0x7c0f, 7324},
-	{0x7c11, 0},
-	{0x7c12, 1},
-	{0x7c13, 2},
-	{0x7c14, 3},
-	{0x7c15, 4},
-	{0x7c16, 7325},
-	{0x7c18, 0},
-	{0x7c19, 1},
-	{0x7c1a, 2},
-	{0x7c1b, 3},
-	{0x7c1c, 4},
-	{0x7c1d, 5},
-	{0x7c1e, 9706},
-	{0x7c1f, 7327},
-	{0x7c21, 8079},
-	{0x7c23, 9708},
-	{0x7c25, 0},
-	{0x7c26, 7329},
-	{0x7c27, 2014},
-	{0x7c29, 0},
-	{0x7c2a, 7328},
-	{0x7c2b, 9707},
-	{0x7c2d, 0},
-	{0x7c2e, 1},
-	{0x7c2f, 2},
-	{0x7c30, 3},
-	{0x7c31, 4},
-	{0x7c32, 5},
-	{0x7c33, 6},
-	{0x7c34, 7},
-	{0x7c35, 8},
-	{0x7c36, 9},
-	{0x7c37, 10},
-	{0x7c38, 7330},
-	{0x7c3a, 0},
-	{0x7c3b, 1},
-	{0x7c3c, 2},
-	{0x7c3d, 8400},
-	{0x7c3e, 8221},
-	{0x7c3f, 1157},
-	{0x7c40, 7332},
-	{0x7c41, 7331},
-	{0x7c43, 8183},
-	{0x7c45, 0},
-	{0x7c46, 1},
-	{0x7c47, 2},
-	{0x7c48, 3},
-	{0x7c49, 4},
-	{0x7c4a, 5},
-	{0x7c4b, 6},
-	{0x7c4c, 7821},
-	{0x7c4d, 2081},
-	{0x7c4f, 0},
-	{0x7c50, 1},
-	{0x7c51, 2},
-	{0x7c52, 3},
-	{0x7c53, 4},
-	{0x7c54, 5},
-	{0x7c55, 6},
-	{0x7c56, 7},
-	{0x7c57, 8},
-	{0x7c58, 9},
-	{0x7c59, 10},
-	{0x7c5a, 11},
-	{0x7c5b, 12},
-	{0x7c5c, 9705},
-	{0x7c5e, 0},
-	{0x7c5f, 9710},
-	{0x7c60, 8250},
-	{0x7c62, 0},
-	{0x7c63, 1},
-	{0x7c64, 9875},
-	{0x7c66, 0},
-	{0x7c67, 1},
-	{0x7c68, 2},
-	{0x7c69, 9701},
-	{0x7c6a, 9709},
-	{0x7c6c, 8201},
-	{0x7c6e, 8293},
-	{0x7c70, 0},
-	{0x7c71, 1},
-	{0x7c72, 9891},
-	{0x7c73, 2780},
-	{0x7c74, 4853},
-	{0x7c76, 0},
-	{0x7c77, 1},
-	{0x7c78, 2},
-	{0x7c79, 3},
-	{0x7c7a, 4},
-	{0x7c7b, 2507},
-	{0x7c7c, 7370},
-	{0x7c7d, 4654},
-	{0x7c7f, 0},
-	{0x7c80, 1},
-	{0x7c81, 2},
-	{0x7c82, 3},
-	{0x7c83, 4},
-	{0x7c84, 5},
-	{0x7c85, 6},
-	{0x7c86, 7},
-	{0x7c87, 8},
-	{0x7c88, 9},
-	{0x7c89, 1656},
-	{0x7c8b, 0},
-	{0x7c8c, 1},
-	{0x7c8d, 2},
-	{0x7c8e, 3},
-	{0x7c8f, 4},
-	{0x7c90, 5},
-	{0x7c91, 7372},
-	{0x7c92, 2540},
-	{0x7c94, 0},
-	{0x7c95, 3048},
-	{0x7c97, 1369},
-	{0x7c98, 4436},
-	{0x7c9a, 0},
-	{0x7c9b, 1},
-	{0x7c9c, 7374},
-	{0x7c9d, 7373},
-	{0x7c9e, 7375},
-	{0x7c9f, 3535},
-	{0x7ca1, 0},
-	{0x7ca2, 7376},
-	{0x7ca4, 4356},
-	{0x7ca5, 4575},
-	{0x7ca7, 0},
-	{0x7ca8, 1},
-	{0x7ca9, 2},
-	{0x7caa, 1661},
-	{0x7cac, 0},
-	{0x7cad, 1},
-	{0x7cae, 2561},
-	{0x7cb0, 0},
-	{0x7cb1, 2564},
-	{0x7cb2, 7377},
-	{0x7cb3, 2267},
-	{0x7cb5, 0},
-	{0x7cb6, 1},
-	{0x7cb7, 2},
-	{0x7cb8, 3},
-	{0x7cb9, 1381},
-	{0x7cbb, 0},
-	{0x7cbc, 7378},
-	{0x7cbd, 7379},
-	{0x7cbe, 2266},
-	{0x7cc0, 0},
-	{0x7cc1, 7380},
-	{0x7cc3, 0},
-	{0x7cc4, 1},
-	{0x7cc5, 7385},
-	{0x7cc7, 7381},
-	{0x7cc8, 7384},
-	{0x7cca, 1972},
-	{0x7ccc, 7382},
-	{0x7ccd, 7383},
-	{0x7ccf, 0},
-	{0x7cd0, 1},
-	{0x7cd1, 2},
-	{0x7cd2, 3},
-	{0x7cd3, 4},
-	{0x7cd4, 5},
-	{0x7cd5, 1757},
-	{0x7cd6, 3610},
-	{0x7cd7, 7386},
-	{0x7cd9, 1185},
-	{0x7cdb, 0},
-	{0x7cdc, 2776},
-	{0x7cdd, 9717},
-	{0x7cde, 7932},
-	{0x7cdf, 4390},
-	{0x7ce0, 2372},
-	{0x7ce2, 0},
-	{0x7ce3, 1},
-	{0x7ce4, 2},
-	{0x7ce5, 3},
-	{0x7ce6, 4},
-	{0x7ce7, 8228},
-	{0x7ce8, 7387},
-	{0x7cea, 0},
-	{0x7ceb, 1},
-	{0x7cec, 2},
-	{0x7ced, 3},
-	{0x7cee, 4},
-	{0x7cef, 2933},
-	{0x7cf0, 9883},
-	{0x7cf2, 9715},
-	{0x7cf4, 8921},
-	{0x7cf6, 9716},
-	{0x7cf8, 7399},
-	{0x7cf9, 9243},
-	{0x7cfb, 3874},
-	{0x7cfd, 0},
-	{0x7cfe, 8136},
-	{0x7d00, 8059},
-	{0x7d02, 9245},
-	{0x7d04, 8780},
-	{0x7d05, 8008},
-	{0x7d06, 9244},
-	{0x7d07, 9246},
-	{0x7d08, 9247},
-	{0x7d09, 8447},
-	{0x7d0a, 3800},
-	{0x7d0b, 8602},
-	{0x7d0d, 8337},
-	{0x7d0f, 0},
-	{0x7d10, 8359},
-	{0x7d12, 0},
-	{0x7d13, 9251},
-	{0x7d14, 7835},
-	{0x7d15, 9250},
-	{0x7d17, 8464},
-	{0x7d19, 8845},
-	{0x7d1a, 8049},
-	{0x7d1b, 7928},
-	{0x7d1c, 9249},
-	{0x7d1e, 0},
-	{0x7d1f, 1},
-	{0x7d20, 3533},
-	{0x7d21, 7923},
-	{0x7d22, 3564},
-	{0x7d24, 0},
-	{0x7d25, 1},
-	{0x7d26, 2},
-	{0x7d27, 2245},
-	{0x7d29, 0},
-	{0x7d2a, 1},
-	{0x7d2b, 4652},
-	{0x7d2d, 0},
-	{0x7d2e, 1},
-	{0x7d2f, 2502},
-	{0x7d30, 8625},
-	{0x7d31, 9254},
-	{0x7d32, 9253},
-	{0x7d33, 8480},
-	{0x7d35, 0},
-	{0x7d36, 1},
-	{0x7d37, 2},
-	{0x7d38, 3},
-	{0x7d39, 8474},
-	{0x7d3a, 9252},
-	{0x7d3c, 9256},
-	{0x7d3e, 0},
-	{0x7d3f, 9258},
-	{0x7d40, 9257},
-	{0x7d42, 8852},
-	{0x7d44, 8894},
-	{0x7d46, 7729},
-	{0x7d48, 0},
-	{0x7d49, 1},
-	{0x7d4a, 2},
-	{0x7d4b, 3},
-	{0x7d4c, 4},
-	{0x7d4d, 5},
-	{0x7d4e, 9260},
-	{0x7d50, 8117},
-	{0x7d52, 0},
-	{0x7d53, 1},
-	{0x7d54, 2},
-	{0x7d55, 3},
-	{0x7d56, 4},
-	{0x7d57, 5},
-	{0x7d58, 6},
-	{0x7d59, 7},
-	{0x7d5a, 8},
-	{0x7d5b, 9},
-	{0x7d5c, 10},
-	{0x7d5d, 9259},
-	{0x7d5e, 8111},
-	{0x7d60, 0},
-	{0x7d61, 8296},
-	{0x7d62, 8676},
-	{0x7d64, 0},
-	{0x7d65, 1},
-	{0x7d66, 7969},
-	{0x7d68, 8449},
-	{0x7d6a, 0},
-	{0x7d6b, 1},
-	{0x7d6c, 2},
-	{0x7d6d, 3},
-	{0x7d6e, 4032},
-	{0x7d70, 0},
-	{0x7d71, 8572},
-	{0x7d72, 8522},
-	{0x7d73, 9261},
-	{0x7d75, 0},
-	{0x7d76, 8148},
-	{0x7d77, 7400},
-	{0x7d79, 8145},
-	{0x7d7b, 0},
-	{0x7d7c, 1},
-	{0x7d7d, 2},
-	{0x7d7e, 3},
-	{0x7d7f, 4},
-	{0x7d80, 5},
-	{0x7d81, 7731},
-	{0x7d83, 9263},
-	{0x7d85, 0},
-	{0x7d86, 9262},
-	{0x7d88, 9264},
-	{0x7d89, 8667},
-	{0x7d8b, 0},
-	{0x7d8c, 1},
-	{0x7d8d, 2},
-	{0x7d8e, 3},
-	{0x7d8f, 8536},
-	{0x7d91, 0},
-	{0x7d92, 1},
-	{0x7d93, 8130},
-	{0x7d95, 0},
-	{0x7d96, 1},
-	{0x7d97, 2},
-	{0x7d98, 3},
-	{0x7d99, 4},
-	{0x7d9a, 5},
-	{0x7d9b, 6},
-	{0x7d9c, 8889},
-	{0x7d9e, 9270},
-	{0x7da0, 0},
-	{0x7da1, 1},
-	{0x7da2, 7822},
-	{0x7da3, 9273},
-	{0x7da5, 0},
-	{0x7da6, 7401},
-	{0x7da8, 0},
-	{0x7da9, 1},
-	{0x7daa, 2},
-	{0x7dab, 8645},
-	{0x7dac, 9271},
-	{0x7dad, 8594},
-	{0x7dae, 7402},
-	{0x7db0, 9274},
-	{0x7db1, 7961},
-	{0x7db2, 8588},
-	{0x7db3, 7744},
-	{0x7db4, 8883},
-	{0x7db6, 0},
-	{0x7db7, 1},
-	{0x7db8, 8287},
-	{0x7db9, 9272},
-	{0x7dba, 9266},
-	{0x7dbb, 8820},
-	{0x7dbd, 7836},
-	{0x7dbe, 9265},
-	{0x7dbf, 8325},
-	{0x7dc1, 0},
-	{0x7dc2, 1},
-	{0x7dc3, 2},
-	{0x7dc4, 9269},
-	{0x7dc6, 0},
-	{0x7dc7, 9275},
-	{0x7dc9, 0},
-	{0x7dca, 8119},
-	{0x7dcb, 9267},
-	{0x7dcd, 0},
-	{0x7dce, 1},
-	{0x7dcf, 2},
-	{0x7dd0, 3},
-	{0x7dd1, 8276},
-	{0x7dd2, 8670},
-	{0x7dd4, 9268},
-	{0x7dd6, 0},
-	{0x7dd7, 9277},
-	{0x7dd8, 8073},
-	{0x7dd9, 9276},
-	{0x7ddb, 0},
-	{0x7ddc, 1},
-	{0x7ddd, 8046},
-	{0x7dde, 7896},
-	{0x7de0, 7871},
-	{0x7de1, 9285},
-	{0x7de3, 8777},
-	{0x7de5, 0},
-	{0x7de6, 9281},
-	{0x7de8, 7751},
-	{0x7de9, 8022},
-	{0x7deb, 0},
-	{0x7dec, 8326},
-	{0x7dee, 0},
-	{0x7def, 8598},
-	{0x7df1, 9283},
-	{0x7df2, 9279},
-	{0x7df4, 8227},
-	{0x7df6, 9282},
-	{0x7df8, 0},
-	{0x7df9, 9278},
-	{0x7dfb, 9894},
-	{0x7dfd, 0},
-	{0x7dfe, 1},
-	{0x7dff, 2},
-	{0x7e01, 0},
-	{0x7e02, 1},
-	{0x7e03, 2},
-	{0x7e04, 3},
-	{0x7e05, 4},
-	{0x7e06, 5},
-	{0x7e07, 6},
-	{0x7e08, 9038},
-	{0x7e09, 9286},
-	{0x7e0a, 9291},
-	{0x7e0b, 9284},
-	{0x7e0d, 0},
-	{0x7e0e, 1},
-	{0x7e0f, 2},
-	{0x7e10, 9255},
-	{0x7e11, 9292},
-	{0x7e13, 0},
-	{0x7e14, 1},
-	{0x7e15, 2},
-	{0x7e16, 3},
-	{0x7e17, 4},
-	{0x7e18, 5},
-	{0x7e19, 6},
-	{0x7e1a, 7},
-	{0x7e1b, 7951},
-	{0x7e1d, 9287},
-	{0x7e1e, 9289},
-	{0x7e1f, 9288},
-	{0x7e21, 0},
-	{0x7e22, 1},
-	{0x7e23, 8642},
-	{0x7e25, 0},
-	{0x7e26, 1},
-	{0x7e27, 8558},
-	{0x7e29, 0},
-	{0x7e2a, 1},
-	{0x7e2b, 7939},
-	{0x7e2d, 9290},
-	{0x7e2e, 8540},
-	{0x7e30, 0},
-	{0x7e31, 8891},
-	{0x7e32, 9296},
-	{0x7e34, 9876},
-	{0x7e35, 9295},
-	{0x7e36, 9718},
-	{0x7e37, 8273},
-	{0x7e39, 9294},
-	{0x7e3b, 7675},
-	{0x7e3d, 8890},
-	{0x7e3e, 8045},
-	{0x7e40, 0},
-	{0x7e41, 1614},
-	{0x7e43, 0},
-	{0x7e44, 1},
-	{0x7e45, 9298},
-	{0x7e46, 9297},
-	{0x7e47, 7403},
-	{0x7e49, 0},
-	{0x7e4a, 1},
-	{0x7e4b, 2},
-	{0x7e4c, 3},
-	{0x7e4d, 4},
-	{0x7e4e, 5},
-	{0x7e4f, 6},
-	{0x7e50, 7},
-	{0x7e51, 8},
-	{0x7e52, 9301},
-	{0x7e54, 8841},
-	{0x7e55, 8470},
-	{0x7e57, 0},
-	{0x7e58, 1},
-	{0x7e59, 2},
-	{0x7e5a, 9300},
-	{0x7e5c, 0},
-	{0x7e5d, 1},
-	{0x7e5e, 8443},
-	{0x7e60, 0},
-	{0x7e61, 1},
-	{0x7e62, 9280},
-	{0x7e64, 0},
-	{0x7e65, 1},
-	{0x7e66, 2},
-	{0x7e67, 3},
-	{0x7e68, 4},
-	{0x7e69, 8486},
-	{0x7e6a, 8033},
-	{0x7e6b, 9885},
-	{0x7e6d, 8074},
-	{0x7e6e, 9302},
-	{0x7e6f, 9305},
-	{0x7e70, 9304},
-	{0x7e72, 0},
-	{0x7e73, 8110},
-	{0x7e75, 0},
-	{0x7e76, 1},
-	{0x7e77, 2},
-	{0x7e78, 3},
-	{0x7e79, 8730},
-	{0x7e7b, 0},
-	{0x7e7c, 8058},
-	{0x7e7d, 9293},
-	{0x7e7e, 9303},
-	{0x7e80, 0},
-	{0x7e81, 1},
-	{0x7e82, 4680},
-	{0x7e84, 0},
-	{0x7e85, 1},
-	{0x7e86, 2},
-	{0x7e87, 3},
-	{0x7e88, 9299},
-	{0x7e8a, 9248},
-	{0x7e8c, 8671},
-	{0x7e8d, 9861},
-	{0x7e8f, 7790},
-	{0x7e91, 0},
-	{0x7e92, 1},
-	{0x7e93, 8740},
-	{0x7e94, 9840},
-	{0x7e96, 8634},
-	{0x7e98, 9306},
-	{0x7e9a, 0},
-	{0x7e9b, 7404},
-	{0x7e9c, 8191},
-	{0x7e9e, 0},
-	{0x7e9f, 6099},
-	{0x7ea0, 2287},
-	{0x7ea1, 6100},
-	{0x7ea2, 1955},
-	{0x7ea3, 6101},
-	{0x7ea4, 3896},
-	{0x7ea5, 6102},
-	{0x7ea6, 4351},
-	{0x7ea7, 2089},
-	{0x7ea8, 6103},
-	{0x7ea9, 6104},
-	{0x7eaa, 2112},
-	{0x7eab, 3245},
-	{0x7eac, 3778},
-	{0x7ead, 6105},
-	{0x7eaf, 1346},
-	{0x7eb0, 6106},
-	{0x7eb1, 3309},
-	{0x7eb2, 1748},
-	{0x7eb3, 2860},
-	{0x7eb5, 4666},
-	{0x7eb6, 2689},
-	{0x7eb7, 1652},
-	{0x7eb8, 4540},
-	{0x7eb9, 3797},
-	{0x7eba, 1633},
-	{0x7ebc, 0},
-	{0x7ebd, 2919},
-	{0x7ebe, 6107},
-	{0x7ebf, 3916},
-	{0x7ec0, 6108},
-	{0x7ec1, 6109},
-	{0x7ec2, 6110},
-	{0x7ec3, 2560},
-	{0x7ec4, 4678},
-	{0x7ec5, 3369},
-	{0x7ec6, 3877},
-	{0x7ec7, 4526},
-	{0x7ec8, 4564},
-	{0x7ec9, 6111},
-	{0x7eca, 1016},
-	{0x7ecb, 6112},
-	{0x7ecc, 6113},
-	{0x7ecd, 3349},
-	{0x7ece, 4214},
-	{0x7ecf, 2268},
-	{0x7ed0, 6114},
-	{0x7ed1, 1022},
-	{0x7ed2, 3257},
-	{0x7ed3, 2226},
-	{0x7ed4, 6115},
-	{0x7ed5, 3233},
-	{0x7ed7, 6116},
-	{0x7ed8, 2043},
-	{0x7ed9, 1779},
-	{0x7eda, 4045},
-	{0x7edb, 6117},
-	{0x7edc, 2702},
-	{0x7edd, 2343},
-	{0x7ede, 2203},
-	{0x7edf, 3684},
-	{0x7ee0, 6118},
-	{0x7ee1, 6119},
-	{0x7ee2, 2333},
-	{0x7ee3, 4016},
-	{0x7ee5, 3548},
-	{0x7ee6, 3619},
-	{0x7ee7, 2111},
-	{0x7ee8, 6120},
-	{0x7ee9, 2075},
-	{0x7eea, 4034},
-	{0x7eeb, 6121},
-	{0x7eed, 4035},
-	{0x7eee, 6122},
-	{0x7eef, 6123},
-	{0x7ef0, 1349},
-	{0x7ef1, 6124},
-	{0x7ef2, 6125},
-	{0x7ef3, 3383},
-	{0x7ef4, 3771},
-	{0x7ef5, 2789},
-	{0x7ef6, 6127},
-	{0x7ef7, 1066},
-	{0x7ef8, 1302},
-	{0x7efa, 6128},
-	{0x7efb, 6129},
-	{0x7efc, 4664},
-	{0x7efd, 4449},
-	{0x7efe, 6130},
-	{0x7eff, 2675},
-	{0x7f00, 4631},
-	{0x7f01, 6131},
-	{0x7f02, 6132},
-	{0x7f03, 6133},
-	{0x7f04, 2141},
-	{0x7f05, 2794},
-	{0x7f06, 2477},
-	{0x7f07, 6134},
-	{0x7f08, 6135},
-	{0x7f09, 2076},
-	{0x7f0b, 6136},
-	{0x7f0c, 6137},
-	{0x7f0d, 6126},
-	{0x7f0e, 1551},
-	{0x7f0f, 6138},
-	{0x7f11, 6139},
-	{0x7f12, 6140},
-	{0x7f13, 1999},
-	{0x7f14, 1471},
-	{0x7f15, 2669},
-	{0x7f16, 1097},
-	{0x7f17, 6141},
-	{0x7f18, 4344},
-	{0x7f19, 6142},
-	{0x7f1a, 1722},
-	{0x7f1b, 6144},
-	{0x7f1c, 6143},
-	{0x7f1d, 1673},
-	{0x7f1f, 6145},
-	{0x7f20, 1215},
-	{0x7f21, 6146},
-	{0x7f22, 6147},
-	{0x7f23, 6148},
-	{0x7f24, 6149},
-	{0x7f25, 6150},
-	{0x7f26, 6151},
-	{0x7f27, 6152},
-	{0x7f28, 4236},
-	{0x7f29, 3562},
-	{0x7f2a, 6153},
-	{0x7f2b, 6154},
-	{0x7f2c, 6155},
-	{0x7f2d, 6156},
-	{0x7f2e, 3330},
-	{0x7f2f, 6157},
-	{0x7f30, 6158},
-	{0x7f31, 6159},
-	{0x7f32, 6160},
-	{0x7f33, 6161},
-	{0x7f34, 2202},
-	{0x7f35, 6162},
-	{0x7f36, 7262},
-	{0x7f38, 1746},
-	{0x7f3a, 3212},
-	{0x7f3c, 0},
-	{0x7f3d, 1},
-	{0x7f3e, 2},
-	{0x7f3f, 3},
-	{0x7f40, 4},
-	{0x7f41, 5},
-	{0x7f42, 7263},
-	{0x7f44, 7264},
-	{0x7f45, 7265},
-	{0x7f47, 0},
-	{0x7f48, 1},
-	{0x7f49, 2},
-	{0x7f4a, 3},
-	{0x7f4b, 4},
-	{0x7f4c, 9698},
-	{0x7f4e, 9882},
-	{0x7f50, 1847},
-	{0x7f51, 3753},
-	{0x7f53, 0},
-	{0x7f54, 4766},
-	{0x7f55, 1896},
-	{0x7f57, 2693},
-	{0x7f58, 6785},
-	{0x7f5a, 1600},
-	{0x7f5c, 0},
-	{0x7f5d, 1},
-	{0x7f5e, 2},
-	{0x7f5f, 6787},
-	{0x7f61, 6786},
-	{0x7f62, 992},
-	{0x7f64, 0},
-	{0x7f65, 1},
-	{0x7f66, 2},
-	{0x7f67, 3},
-	{0x7f68, 6789},
-	{0x7f69, 4471},
-	{0x7f6a, 4684},
-	{0x7f6c, 0},
-	{0x7f6d, 1},
-	{0x7f6e, 4546},
-	{0x7f70, 7914},
-	{0x7f71, 6791},
-	{0x7f72, 3463},
-	{0x7f74, 6790},
-	{0x7f76, 0},
-	{0x7f77, 7724},
-	{0x7f79, 6792},
-	{0x7f7b, 0},
-	{0x7f7c, 1},
-	{0x7f7d, 2},
-	{0x7f7e, 6794},
-	{0x7f80, 0},
-	{0x7f81, 6793},
-	{0x7f83, 0},
-	{0x7f84, 1},
-	{0x7f85, 8290},
-	{0x7f86, 9457},
-	{0x7f88, 9458},
-	{0x7f8a, 4123},
-	{0x7f8c, 3129},
-	{0x7f8e, 2757},
-	{0x7f90, 0},
-	{0x7f91, 1},
-	{0x7f92, 2},
-	{0x7f93, 3},
-	{0x7f94, 1756},
-	{0x7f96, 0},
-	{0x7f97, 1},
-	{0x7f98, 2},
-	{0x7f99, 3},
-	{0x7f9a, 2608},
-	{0x7f9c, 0},
-	{0x7f9d, 7364},
-	{0x7f9e, 4010},
-	{0x7f9f, 7365},
-	{0x7fa1, 3912},
-	{0x7fa3, 0},
-	{0x7fa4, 3221},
-	{0x7fa5, 9714},
-	{0x7fa7, 7366},
-	{0x7fa9, 8725},
-	{0x7fab, 0},
-	{0x7fac, 1},
-	{0x7fad, 2},
-	{0x7fae, 3},
-	{0x7faf, 7367},
-	{0x7fb0, 7368},
-	{0x7fb2, 7369},
-	{0x7fb4, 0},
-	{0x7fb5, 1},
-	{0x7fb6, 2},
-	{0x7fb7, 3},
-	{0x7fb8, 4878},
-	{0x7fb9, 1785},
-	{0x7fbb, 0},
-	{0x7fbc, 5997},
-	{0x7fbd, 4309},
-	{0x7fbf, 7390},
-	{0x7fc1, 3803},
-	{0x7fc3, 0},
-	{0x7fc4, 1},
-	{0x7fc5, 1286},
-	{0x7fc7, 0},
-	{0x7fc8, 1},
-	{0x7fc9, 2},
-	{0x7fca, 7064},
-	{0x7fcc, 4213},
-	{0x7fce, 7391},
-	{0x7fd0, 0},
-	{0x7fd1, 1},
-	{0x7fd2, 8622},
-	{0x7fd4, 3925},
-	{0x7fd5, 7392},
-	{0x7fd7, 0},
-	{0x7fd8, 3145},
-	{0x7fda, 0},
-	{0x7fdb, 1},
-	{0x7fdc, 2},
-	{0x7fdd, 3},
-	{0x7fde, 4},
-	{0x7fdf, 1461},
-	{0x7fe0, 1383},
-	{0x7fe1, 7394},
-	{0x7fe3, 0},
-	{0x7fe4, 1},
-	{0x7fe5, 7393},
-	{0x7fe6, 7395},
-	{0x7fe8, 0},
-	{0x7fe9, 7396},
-	{0x7feb, 0},
-	{0x7fec, 1},
-	{0x7fed, 2},
-	{0x7fee, 7397},
-	{0x7ff0, 1897},
-	{0x7ff1, 970},
-	{0x7ff3, 7398},
-	{0x7ff5, 0},
-	{0x7ff6, 1},
-	{0x7ff7, 2},
-	{0x7ff8, 3},
-	{0x7ff9, 8416},
-	{0x7ffb, 1610},
-	{0x7ffc, 4212},
-	{0x7ffe, 0},
-	{0x7fff, 1},
-	{0x8000, 4146},
-	{0x8001, 2490},
-	{0x8003, 2377},
-	{0x8004, 6483},
-	{0x8005, 4480},
-	{0x8006, 6426},
-	{0x8008, 0},
-	{0x8009, 1},
-	{0x800a, 2},
-	{0x800b, 7127},
-	{0x800c, 1591},
-	{0x800d, 3480},
-	{0x800f, 0},
-	{0x8010, 2864},
-	{0x8012, 7115},
-	{0x8014, 7116},
-	{0x8015, 1782},
-	{0x8016, 7117},
-	{0x8017, 1915},
-	{0x8018, 4360},
-	{0x8019, 989},
-	{0x801b, 0},
-	{0x801c, 7118},
-	{0x801e, 0},
-	{0x801f, 1},
-	{0x8020, 7119},
-	{0x8022, 7120},
-	{0x8024, 0},
-	{0x8025, 7121},
-	{0x8026, 7122},
-	{0x8027, 7123},
-	{0x8028, 7125},
-	{0x8029, 7124},
-	{0x802a, 2966},
-	{0x802c, 9666},
-	{0x802e, 9665},
-	{0x8030, 0},
-	{0x8031, 7126},
-	{0x8033, 1593},
-	{0x8035, 7128},
-	{0x8036, 4149},
-	{0x8037, 5297},
-	{0x8038, 3519},
-	{0x803a, 0},
-	{0x803b, 1281},
-	{0x803d, 1411},
-	{0x803f, 1787},
-	{0x8041, 0},
-	{0x8042, 2903},
-	{0x8043, 7129},
-	{0x8045, 0},
-	{0x8046, 7130},
-	{0x8048, 0},
-	{0x8049, 1},
-	{0x804a, 2573},
-	{0x804b, 2628},
-	{0x804c, 4527},
-	{0x804d, 7131},
-	{0x804f, 0},
-	{0x8050, 1},
-	{0x8051, 2},
-	{0x8052, 7132},
-	{0x8054, 2547},
-	{0x8056, 8488},
-	{0x8058, 3031},
-	{0x805a, 2314},
-	{0x805c, 0},
-	{0x805d, 1},
-	{0x805e, 8601},
-	{0x8060, 0},
-	{0x8061, 1},
-	{0x8062, 2},
-	{0x8063, 3},
-	{0x8064, 4},
-	{0x8065, 5},
-	{0x8066, 6},
-	{0x8067, 7},
-	{0x8068, 8},
-	{0x8069, 7133},
-	{0x806a, 1362},
-	{0x806c, 0},
-	{0x806d, 1},
-	{0x806e, 2},
-	{0x806f, 8215},
-	{0x8070, 7840},
-	{0x8071, 7134},
-	{0x8072, 8485},
-	{0x8073, 8525},
-	{0x8075, 9668},
-	{0x8076, 8349},
-	{0x8077, 8842},
-	{0x8079, 9667},
-	{0x807b, 0},
-	{0x807c, 1},
-	{0x807d, 8569},
-	{0x807e, 8248},
-	{0x807f, 6686},
-	{0x8080, 6685},
-	{0x8082, 0},
-	{0x8083, 3541},
-	{0x8084, 4197},
-	{0x8085, 8533},
-	{0x8086, 3510},
-	{0x8087, 4473},
-	{0x8089, 3261},
-	{0x808b, 2506},
-	{0x808c, 2068},
-	{0x808e, 0},
-	{0x808f, 1},
-	{0x8090, 2},
-	{0x8091, 3},
-	{0x8092, 4},
-	{0x8093, 6513},
-	{0x8095, 0},
-	{0x8096, 3951},
-	{0x8098, 4577},
-	{0x809a, 1542},
-	{0x809b, 1747},
-	{0x809c, 6512},
-	{0x809d, 1737},
-	{0x809f, 6511},
-	{0x80a0, 1227},
-	{0x80a1, 1826},
-	{0x80a2, 4522},
-	{0x80a4, 1681},
-	{0x80a5, 1639},
-	{0x80a7, 0},
-	{0x80a8, 1},
-	{0x80a9, 2138},
-	{0x80aa, 1627},
-	{0x80ab, 6518},
-	{0x80ad, 6519},
-	{0x80ae, 964},
-	{0x80af, 2396},
-	{0x80b1, 6517},
-	{0x80b2, 4322},
-	{0x80b4, 6520},
-	{0x80b6, 0},
-	{0x80b7, 6521},
-	{0x80b9, 0},
-	{0x80ba, 1643},
-	{0x80bc, 6514},
-	{0x80bd, 6516},
-	{0x80be, 3375},
-	{0x80bf, 4566},
-	{0x80c0, 4462},
-	{0x80c1, 3965},
-	{0x80c2, 6527},
-	{0x80c3, 3783},
-	{0x80c4, 6528},
-	{0x80c6, 1417},
-	{0x80c8, 0},
-	{0x80c9, 1},
-	{0x80ca, 2},
-	{0x80cb, 3},
-	{0x80cc, 1052},
-	{0x80cd, 6530},
-	{0x80ce, 3576},
-	{0x80d0, 0},
-	{0x80d1, 1},
-	{0x80d2, 2},
-	{0x80d3, 3},
-	{0x80d4, 4},
-	{0x80d5, 5},
-	{0x80d6, 2967},
-	{0x80d7, 6531},
-	{0x80d9, 6529},
-	{0x80da, 2976},
-	{0x80db, 6526},
-	{0x80dc, 3387},
-	{0x80dd, 6533},
-	{0x80de, 1030},
-	{0x80e0, 0},
-	{0x80e1, 1969},
-	{0x80e3, 0},
-	{0x80e4, 4717},
-	{0x80e5, 7111},
-	{0x80e7, 6522},
-	{0x80e8, 6523},
-	{0x80e9, 6524},
-	{0x80ea, 6525},
-	{0x80eb, 6534},
-	{0x80ec, 6042},
-	{0x80ed, 6537},
-	{0x80ef, 2421},
-	{0x80f0, 4175},
-	{0x80f1, 6535},
-	{0x80f2, 6540},
-	{0x80f3, 1767},
-	{0x80f4, 6536},
-	{0x80f6, 2187},
-	{0x80f8, 4003},
-	{0x80fa, 962},
-	{0x80fc, 6541},
-	{0x80fd, 2879},
-	{0x80ff, 0},
-	{0x8101, 0},
-	{0x8102, 4523},
-	{0x8104, 0},
-	{0x8105, 8658},
-	{0x8106, 1379},
-	{0x8108, 0},
-	{0x8109, 2717},
-	{0x810a, 2092},
-	{0x810c, 0},
-	{0x810d, 6538},
-	{0x810e, 6539},
-	{0x810f, 4387},
-	{0x8110, 3081},
-	{0x8111, 2871},
-	{0x8112, 6543},
-	{0x8113, 2920},
-	{0x8114, 4873},
-	{0x8116, 1144},
-	{0x8118, 6548},
-	{0x811a, 2198},
-	{0x811b, 9415},
-	{0x811d, 0},
-	{0x811e, 6546},
-	{0x8120, 0},
-	{0x8121, 1},
-	{0x8122, 2},
-	{0x8123, 3},
-	{0x8124, 4},
-	{0x8125, 5},
-	{0x8126, 6},
-	{0x8127, 7},
-	{0x8128, 8},
-	{0x8129, 9},
-	{0x812a, 10},
-	{0x812b, 11},
-	{0x812c, 6547},
-	{0x812e, 0},
-	{0x812f, 1703},
-	{0x8131, 3714},
-	{0x8132, 6549},
-	{0x8134, 0},
-	{0x8135, 1},
-	{0x8136, 6545},
-	{0x8138, 2556},
-	{0x8139, 8825},
-	{0x813b, 0},
-	{0x813c, 1},
-	{0x813d, 2},
-	{0x813e, 3009},
-	{0x8140, 0},
-	{0x8141, 1},
-	{0x8142, 2},
-	{0x8143, 3},
-	{0x8144, 4},
-	{0x8145, 5},
-	{0x8146, 3654},
-	{0x8148, 6550},
-	{0x814a, 2459},
-	{0x814b, 4159},
-	{0x814c, 6551},
-	{0x814e, 8483},
-	{0x8150, 1706},
-	{0x8151, 1704},
-	{0x8153, 6552},
-	{0x8154, 3128},
-	{0x8155, 3748},
-	{0x8156, 9413},
-	{0x8158, 0},
-	{0x8159, 6554},
-	{0x815a, 6555},
-	{0x815c, 0},
-	{0x815d, 1},
-	{0x815e, 2},
-	{0x815f, 3},
-	{0x8160, 6557},
-	{0x8161, 9417},
-	{0x8163, 0},
-	{0x8164, 1},
-	{0x8165, 3987},
-	{0x8166, 8340},
-	{0x8167, 6562},
-	{0x8169, 6558},
-	{0x816b, 8854},
-	{0x816d, 6561},
-	{0x816e, 3284},
-	{0x8170, 4133},
-	{0x8171, 6556},
-	{0x8173, 0},
-	{0x8174, 6553},
-	{0x8176, 0},
-	{0x8177, 1},
-	{0x8178, 7799},
-	{0x8179, 1716},
-	{0x817a, 3910},
-	{0x817b, 2888},
-	{0x817c, 6559},
-	{0x817d, 6560},
-	{0x817e, 3629},
-	{0x817f, 3705},
-	{0x8180, 1021},
-	{0x8182, 6566},
-	{0x8184, 0},
-	{0x8185, 1},
-	{0x8186, 2},
-	{0x8187, 3},
-	{0x8188, 6565},
-	{0x818a, 1145},
-	{0x818c, 0},
-	{0x818d, 1},
-	{0x818e, 2},
-	{0x818f, 1755},
-	{0x8191, 6567},
-	{0x8193, 0},
-	{0x8194, 1},
-	{0x8195, 2},
-	{0x8196, 3},
-	{0x8197, 4},
-	{0x8198, 1109},
-	{0x819a, 7942},
-	{0x819b, 3608},
-	{0x819c, 2823},
-	{0x819d, 3858},
-	{0x819f, 0},
-	{0x81a0, 8101},
-	{0x81a2, 0},
-	{0x81a3, 6569},
-	{0x81a5, 0},
-	{0x81a6, 6576},
-	{0x81a8, 2995},
-	{0x81a9, 8345},
-	{0x81aa, 6570},
-	{0x81ac, 0},
-	{0x81ad, 1},
-	{0x81ae, 2},
-	{0x81af, 3},
-	{0x81b0, 4},
-	{0x81b1, 5},
-	{0x81b2, 6},
-	{0x81b3, 3326},
-	{0x81b5, 0},
-	{0x81b6, 1},
-	{0x81b7, 2},
-	{0x81b8, 3},
-	{0x81b9, 4},
-	{0x81ba, 5697},
-	{0x81bb, 6574},
-	{0x81bd, 7853},
-	{0x81be, 9416},
-	{0x81bf, 8360},
-	{0x81c0, 3711},
-	{0x81c1, 6575},
-	{0x81c2, 1092},
-	{0x81c3, 4252},
-	{0x81c5, 0},
-	{0x81c6, 4195},
-	{0x81c8, 0},
-	{0x81c9, 8223},
-	{0x81ca, 6573},
-	{0x81cc, 6571},
-	{0x81cd, 8389},
-	{0x81cf, 9418},
-	{0x81d1, 0},
-	{0x81d2, 1},
-	{0x81d3, 2},
-	{0x81d4, 3},
-	{0x81d5, 4},
-	{0x81d6, 5},
-	{0x81d7, 6},
-	{0x81d8, 8176},
-	{0x81da, 9414},
-	{0x81dc, 0},
-	{0x81dd, 1},
-	{0x81de, 2},
-	{0x81df, 8797},
-	{0x81e0, 8926},
-	{0x81e2, 0},
-	{0x81e3, 1249},
-	{0x81e5, 0},
-	{0x81e6, 1},
-	{0x81e7, 6402},
-	{0x81e8, 8236},
-	{0x81ea, 4657},
-	{0x81ec, 7337},
-	{0x81ed, 1305},
-	{0x81ef, 0},
-	{0x81f0, 1},
-	{0x81f1, 2},
-	{0x81f2, 3},
-	{0x81f3, 4544},
-	{0x81f4, 4545},
-	{0x81f6, 0},
-	{0x81f7, 1},
-	{0x81f8, 2},
-	{0x81f9, 3},
-	{0x81fa, 8545},
-	{0x81fb, 4490},
-	{0x81fc, 2297},
-	{0x81fe, 7333},
-	{0x8200, 4143},
-	{0x8201, 7334},
-	{0x8202, 7335},
-	{0x8204, 7336},
-	{0x8205, 2298},
-	{0x8206, 4292},
-	{0x8207, 8763},
-	{0x8208, 8665},
-	{0x8209, 8139},
-	{0x820a, 8137},
-	{0x820c, 3353},
-	{0x820d, 3354},
-	{0x820f, 0},
-	{0x8210, 7266},
-	{0x8212, 3453},
-	{0x8214, 3653},
-	{0x8216, 0},
-	{0x8217, 1},
-	{0x8218, 2},
-	{0x8219, 3},
-	{0x821a, 4},
-	{0x821b, 5656},
-	{0x821c, 3497},
-	{0x821e, 3831},
-	{0x821f, 4570},
-	{0x8221, 7339},
-	{0x8222, 7340},
-	{0x8223, 7341},
-	{0x8225, 0},
-	{0x8226, 1},
-	{0x8227, 2},
-	{0x8228, 7344},
-	{0x822a, 1908},
-	{0x822b, 7345},
-	{0x822c, 1006},
-	{0x822d, 7342},
-	{0x822f, 7343},
-	{0x8230, 2163},
-	{0x8231, 1180},
-	{0x8233, 7348},
-	{0x8234, 7349},
-	{0x8235, 1573},
-	{0x8236, 1143},
-	{0x8237, 3900},
-	{0x8238, 7346},
-	{0x8239, 1327},
-	{0x823b, 7347},
-	{0x823d, 0},
-	{0x823e, 7350},
-	{0x8240, 0},
-	{0x8241, 1},
-	{0x8242, 2},
-	{0x8243, 3},
-	{0x8244, 7351},
-	{0x8246, 0},
-	{0x8247, 3672},
-	{0x8249, 7352},
-	{0x824b, 7353},
-	{0x824d, 0},
-	{0x824e, 1},
-	{0x824f, 7354},
-	{0x8251, 0},
-	{0x8252, 1},
-	{0x8253, 2},
-	{0x8254, 3},
-	{0x8255, 4},
-	{0x8256, 5},
-	{0x8257, 6},
-	{0x8258, 3527},
-	{0x8259, 7777},
-	{0x825a, 7355},
-	{0x825c, 0},
-	{0x825d, 1},
-	{0x825e, 2},
-	{0x825f, 7356},
-	{0x8261, 0},
-	{0x8262, 1},
-	{0x8263, 2},
-	{0x8264, 9711},
-	{0x8266, 8088},
-	{0x8268, 7357},
-	{0x826a, 0},
-	{0x826b, 9712},
-	{0x826d, 0},
-	{0x826e, 7388},
-	{0x826f, 2565},
-	{0x8270, 2139},
-	{0x8271, 8072},
-	{0x8272, 3300},
-	{0x8273, 4103},
-	{0x8274, 6001},
-	{0x8276, 0},
-	{0x8277, 8696},
-	{0x8279, 5089},
-	{0x827a, 4188},
-	{0x827c, 0},
-	{0x827d, 5090},
-	{0x827e, 951},
-	{0x827f, 5091},
-	{0x8281, 0},
-	{0x8282, 2219},
-	{0x8284, 5095},
-	{0x8286, 0},
-	{0x8287, 1},
-	{0x8288, 4728},
-	{0x828a, 5093},
-	{0x828b, 4312},
-	{0x828d, 3343},
-	{0x828e, 5096},
-	{0x828f, 5092},
-	{0x8291, 5097},
-	{0x8292, 2727},
-	{0x8294, 0},
-	{0x8295, 1},
-	{0x8296, 2},
-	{0x8297, 5098},
-	{0x8298, 5107},
-	{0x8299, 5099},
-	{0x829b, 0},
-	{0x829c, 3822},
-	{0x829d, 4516},
-	{0x829f, 5117},
-	{0x82a1, 5115},
-	{0x82a3, 0},
-	{0x82a4, 5120},
-	{0x82a5, 2231},
-	{0x82a6, 2642},
-	{0x82a8, 5094},
-	{0x82a9, 5113},
-	{0x82aa, 5116},
-	{0x82ab, 5100},
-	{0x82ac, 1647},
-	{0x82ad, 976},
-	{0x82ae, 5109},
-	{0x82af, 3977},
-	{0x82b0, 5103},
-	{0x82b1, 1981},
-	{0x82b3, 1625},
-	{0x82b4, 5114},
-	{0x82b6, 0},
-	{0x82b7, 5108},
-	{0x82b8, 5101},
-	{0x82b9, 3160},
-	{0x82bb, 8994},
-	{0x82bd, 4072},
-	{0x82be, 5102},
-	{0x82c0, 0},
-	{0x82c1, 5112},
-	{0x82c3, 0},
-	{0x82c4, 5118},
-	{0x82c6, 0},
-	{0x82c7, 3772},
-	{0x82c8, 5104},
-	{0x82ca, 5105},
-	{0x82cb, 5110},
-	{0x82cc, 5111},
-	{0x82cd, 1179},
-	{0x82ce, 5119},
-	{0x82cf, 3530},
-	{0x82d1, 4346},
-	{0x82d2, 5129},
-	{0x82d3, 5133},
-	{0x82d4, 3577},
-	{0x82d5, 5140},
-	{0x82d7, 2796},
-	{0x82d8, 5130},
-	{0x82da, 0},
-	{0x82db, 2382},
-	{0x82dc, 5127},
-	{0x82de, 1029},
-	{0x82df, 1807},
-	{0x82e0, 5139},
-	{0x82e1, 5121},
-	{0x82e3, 5106},
-	{0x82e4, 5124},
-	{0x82e5, 3279},
-	{0x82e6, 2413},
-	{0x82e7, 9014},
-	{0x82e9, 0},
-	{0x82ea, 1},
-	{0x82eb, 3316},
-	{0x82ed, 0},
-	{0x82ee, 1},
-	{0x82ef, 1062},
-	{0x82f1, 4231},
-	{0x82f3, 0},
-	{0x82f4, 5128},
-	{0x82f6, 0},
-	{0x82f7, 5123},
-	{0x82f9, 3034},
-	{0x82fb, 5132},
-	{0x82fd, 0},
-	{0x82fe, 1},
-	{0x82ff, 2},
-	{0x8301, 4639},
-	{0x8302, 2740},
-	{0x8303, 1619},
-	{0x8304, 3150},
-	{0x8305, 2734},
-	{0x8306, 5136},
-	{0x8307, 5126},
-	{0x8308, 5145},
-	{0x8309, 5122},
-	{0x830b, 0},
-	{0x830c, 5131},
-	{0x830e, 2260},
-	{0x830f, 5125},
-	{0x8311, 5134},
-	{0x8313, 0},
-	{0x8314, 5137},
-	{0x8315, 5138},
-	{0x8317, 5158},
-	{0x8319, 0},
-	{0x831a, 5135},
-	{0x831b, 5166},
-	{0x831c, 5141},
-	{0x831e, 0},
-	{0x831f, 1},
-	{0x8320, 2},
-	{0x8321, 3},
-	{0x8322, 4},
-	{0x8323, 5},
-	{0x8324, 6},
-	{0x8325, 7},
-	{0x8326, 8},
-	{0x8327, 2142},
-	{0x8328, 1351},
-	{0x832a, 0},
-	{0x832b, 2728},
-	{0x832c, 1198},
-	{0x832d, 5160},
-	{0x832f, 5152},
-	{0x8331, 5149},
-	{0x8333, 5162},
-	{0x8334, 5148},
-	{0x8335, 4215},
-	{0x8336, 1199},
-	{0x8338, 3250},
-	{0x8339, 3262},
-	{0x833a, 5161},
-	{0x833c, 5147},
-	{0x833e, 0},
-	{0x833f, 1},
-	{0x8340, 5157},
-	{0x8342, 0},
-	{0x8343, 5155},
-	{0x8345, 0},
-	{0x8346, 2258},
-	{0x8347, 5154},
-	{0x8349, 1188},
-	{0x834b, 0},
-	{0x834c, 1},
-	{0x834d, 2},
-	{0x834e, 3},
-	{0x834f, 5153},
-	{0x8350, 2153},
-	{0x8351, 5142},
-	{0x8352, 2009},
-	{0x8354, 2526},
-	{0x8356, 0},
-	{0x8357, 1},
-	{0x8358, 2},
-	{0x8359, 3},
-	{0x835a, 2119},
-	{0x835b, 5143},
-	{0x835c, 5144},
-	{0x835e, 5151},
-	{0x835f, 5156},
-	{0x8360, 5159},
-	{0x8361, 1429},
-	{0x8363, 3252},
-	{0x8364, 2044},
-	{0x8365, 5164},
-	{0x8366, 5163},
-	{0x8367, 4240},
-	{0x8368, 5165},
-	{0x8369, 5167},
-	{0x836a, 5169},
-	{0x836b, 4216},
-	{0x836c, 5168},
-	{0x836d, 5170},
-	{0x836e, 5171},
-	{0x836f, 4144},
-	{0x8371, 0},
-	{0x8372, 1},
-	{0x8373, 2},
-	{0x8374, 3},
-	{0x8375, 4},
-	{0x8376, 5},
-	{0x8377, 1920},
-	{0x8378, 5173},
-	{0x837a, 0},
-	{0x837b, 5186},
-	{0x837c, 5181},
-	{0x837d, 5184},
-	{0x837f, 0},
-	{0x8380, 1},
-	{0x8381, 2},
-	{0x8382, 3},
-	{0x8383, 4},
-	{0x8384, 5},
-	{0x8385, 5180},
-	{0x8386, 3053},
-	{0x8388, 0},
-	{0x8389, 2525},
-	{0x838a, 8875},
-	{0x838c, 0},
-	{0x838d, 1},
-	{0x838e, 3304},
-	{0x8390, 0},
-	{0x8391, 1},
-	{0x8392, 5146},
-	{0x8393, 5178},
-	{0x8395, 0},
-	{0x8396, 8127},
-	{0x8398, 5187},
-	{0x839a, 0},
-	{0x839b, 5150},
-	{0x839c, 5179},
-	{0x839e, 5188},
-	{0x83a0, 5176},
-	{0x83a2, 8061},
-	{0x83a4, 0},
-	{0x83a5, 1},
-	{0x83a6, 2},
-	{0x83a7, 9011},
-	{0x83a8, 5189},
-	{0x83a9, 5183},
-	{0x83aa, 5177},
-	{0x83ab, 2829},
-	{0x83ad, 0},
-	{0x83ae, 1},
-	{0x83af, 2},
-	{0x83b0, 5172},
-	{0x83b1, 2462},
-	{0x83b2, 2548},
-	{0x83b3, 5174},
-	{0x83b4, 5175},
-	{0x83b6, 5182},
-	{0x83b7, 2054},
-	{0x83b8, 5185},
-	{0x83b9, 4237},
-	{0x83ba, 5190},
-	{0x83bc, 5191},
-	{0x83bd, 2732},
-	{0x83bf, 0},
-	{0x83c0, 5214},
-	{0x83c1, 5192},
-	{0x83c3, 0},
-	{0x83c4, 1},
-	{0x83c5, 5213},
-	{0x83c7, 1814},
-	{0x83c9, 0},
-	{0x83ca, 2308},
-	{0x83cc, 2345},
-	{0x83ce, 0},
-	{0x83cf, 1921},
-	{0x83d1, 0},
-	{0x83d2, 1},
-	{0x83d3, 2},
-	{0x83d4, 5206},
-	{0x83d6, 5201},
-	{0x83d8, 5195},
-	{0x83da, 0},
-	{0x83db, 1},
-	{0x83dc, 1170},
-	{0x83dd, 5199},
-	{0x83df, 5207},
-	{0x83e0, 1131},
-	{0x83e1, 5217},
-	{0x83e3, 0},
-	{0x83e4, 1},
-	{0x83e5, 5194},
-	{0x83e7, 0},
-	{0x83e8, 1},
-	{0x83e9, 3055},
-	{0x83ea, 5212},
-	{0x83ec, 0},
-	{0x83ed, 1},
-	{0x83ee, 2},
-	{0x83ef, 8013},
-	{0x83f0, 5216},
-	{0x83f1, 2603},
-	{0x83f2, 1635},
-	{0x83f4, 0},
-	{0x83f5, 1},
-	{0x83f6, 2},
-	{0x83f7, 3},
-	{0x83f8, 5210},
-	{0x83f9, 5211},
-	{0x83fb, 0},
-	{0x83fc, 1},
-	{0x83fd, 5200},
-	{0x83ff, 0},
-	{0x8401, 5193},
-	{0x8403, 5209},
-	{0x8404, 3620},
-	{0x8406, 5205},
-	{0x8407, 9012},
-	{0x8409, 0},
-	{0x840a, 8177},
-	{0x840b, 5198},
-	{0x840c, 2765},
-	{0x840d, 3035},
-	{0x840e, 3773},
-	{0x840f, 5208},
-	{0x8411, 5204},
-	{0x8413, 0},
-	{0x8414, 1},
-	{0x8415, 2},
-	{0x8416, 3},
-	{0x8417, 4},
-	{0x8418, 5197},
-	{0x841a, 0},
-	{0x841b, 1},
-	{0x841c, 5202},
-	{0x841d, 2691},
-	{0x841f, 0},
-	{0x8420, 1},
-	{0x8421, 2},
-	{0x8422, 3},
-	{0x8423, 4},
-	{0x8424, 4238},
-	{0x8425, 4239},
-	{0x8426, 5215},
-	{0x8427, 3937},
-	{0x8428, 3283},
-	{0x842a, 0},
-	{0x842b, 1},
-	{0x842c, 8587},
-	{0x842e, 0},
-	{0x842f, 1},
-	{0x8430, 2},
-	{0x8431, 5234},
-	{0x8433, 0},
-	{0x8434, 1},
-	{0x8435, 9033},
-	{0x8437, 0},
-	{0x8438, 5203},
-	{0x843a, 0},
-	{0x843b, 1},
-	{0x843c, 5228},
-	{0x843d, 2699},
-	{0x843f, 0},
-	{0x8440, 1},
-	{0x8441, 2},
-	{0x8442, 3},
-	{0x8443, 4},
-	{0x8444, 5},
-	{0x8445, 6},
-	{0x8446, 5229},
-	{0x8448, 0},
-	{0x8449, 8715},
-	{0x844b, 0},
-	{0x844c, 1},
-	{0x844d, 2},
-	{0x844e, 3},
-	{0x844f, 4},
-	{0x8450, 5},
-	{0x8451, 5219},
-	{0x8452, 9030},
-	{0x8454, 0},
-	{0x8455, 1},
-	{0x8456, 2},
-	{0x8457, 4599},
-	{0x8459, 5221},
-	{0x845a, 5220},
-	{0x845b, 1771},
-	{0x845c, 5218},
-	{0x845e, 0},
-	{0x845f, 1},
-	{0x8460, 2},
-	{0x8461, 3054},
-	{0x8463, 1516},
-	{0x8464, 9031},
-	{0x8466, 8595},
-	{0x8468, 0},
-	{0x8469, 5230},
-	{0x846b, 1968},
-	{0x846c, 4388},
-	{0x846d, 5235},
-	{0x846f, 9889},
-	{0x8471, 1363},
-	{0x8473, 5222},
-	{0x8475, 2440},
-	{0x8476, 5231},
-	{0x8477, 8034},
-	{0x8478, 5227},
-	{0x847a, 5225},
-	{0x847c, 0},
-	{0x847d, 1},
-	{0x847e, 2},
-	{0x847f, 3},
-	{0x8480, 4},
-	{0x8481, 5},
-	{0x8482, 1466},
-	{0x8484, 0},
-	{0x8485, 1},
-	{0x8486, 2},
-	{0x8487, 5223},
-	{0x8488, 5224},
-	{0x8489, 5226},
-	{0x848b, 2176},
-	{0x848c, 5232},
-	{0x848e, 5233},
-	{0x8490, 0},
-	{0x8491, 1},
-	{0x8492, 2},
-	{0x8493, 9037},
-	{0x8494, 9032},
-	{0x8496, 0},
-	{0x8497, 5249},
-	{0x8499, 2766},
-	{0x849b, 0},
-	{0x849c, 3543},
-	{0x849e, 0},
-	{0x849f, 1},
-	{0x84a0, 2},
-	{0x84a1, 5246},
-	{0x84a3, 0},
-	{0x84a4, 1},
-	{0x84a5, 2},
-	{0x84a6, 3},
-	{0x84a7, 4},
-	{0x84a8, 5},
-	{0x84a9, 6},
-	{0x84aa, 7},
-	{0x84ab, 8},
-	{0x84ac, 9},
-	{0x84ad, 10},
-	{0x84ae, 11},
-	{0x84af, 4759},
-	{0x84b1, 0},
-	{0x84b2, 3056},
-	{0x84b4, 5248},
-	{0x84b6, 0},
-	{0x84b7, 1},
-	{0x84b8, 4501},
-	{0x84b9, 5247},
-	{0x84ba, 5244},
-	{0x84bc, 7776},
-	{0x84bd, 5240},
-	{0x84bf, 5243},
-	{0x84c0, 9029},
-	{0x84c1, 5236},
-	{0x84c3, 0},
-	{0x84c4, 4025},
-	{0x84c6, 0},
-	{0x84c7, 1},
-	{0x84c8, 2},
-	{0x84c9, 3251},
-	{0x84ca, 5242},
-	{0x84cb, 7954},
-	{0x84cd, 5237},
-	{0x84cf, 0},
-	{0x84d0, 5238},
-	{0x84d1, 3559},
-	{0x84d3, 5241},
-	{0x84d5, 0},
-	{0x84d6, 1078},
-	{0x84d8, 0},
-	{0x84d9, 1},
-	{0x84da, 2},
-	{0x84db, 3},
-	{0x84dc, 4},
-	{0x84dd, 2465},
-	{0x84df, 2094},
-	{0x84e0, 5245},
-	{0x84e2, 0},
-	{0x84e3, 5251},
-	{0x84e5, 5250},
-	{0x84e6, 5239},
-	{0x84e8, 0},
-	{0x84e9, 1},
-	{0x84ea, 2},
-	{0x84eb, 3},
-	{0x84ec, 2991},
-	{0x84ee, 8216},
-	{0x84ef, 9013},
-	{0x84f0, 5255},
-	{0x84f2, 0},
-	{0x84f3, 1},
-	{0x84f4, 2},
-	{0x84f5, 3},
-	{0x84f6, 4},
-	{0x84f7, 5},
-	{0x84f8, 6},
-	{0x84f9, 7},
-	{0x84fa, 8},
-	{0x84fb, 9},
-	{0x84fc, 5262},
-	{0x84fd, 9020},
-	{0x84ff, 5261},
-	{0x8501, 0},
-	{0x8502, 1},
-	{0x8503, 2},
-	{0x8504, 3},
-	{0x8505, 4},
-	{0x8506, 5},
-	{0x8507, 6},
-	{0x8508, 7},
-	{0x8509, 8},
-	{0x850a, 9},
-	{0x850b, 10},
-	{0x850c, 5252},
-	{0x850e, 0},
-	{0x850f, 1},
-	{0x8510, 2},
-	{0x8511, 2804},
-	{0x8513, 2722},
-	{0x8514, 9839},
-	{0x8516, 0},
-	{0x8517, 4482},
-	{0x8519, 0},
-	{0x851a, 3780},
-	{0x851c, 0},
-	{0x851d, 1},
-	{0x851e, 9041},
-	{0x851f, 5257},
-	{0x8521, 1171},
-	{0x8523, 8096},
-	{0x8525, 0},
-	{0x8526, 9016},
-	{0x8528, 0},
-	{0x8529, 1},
-	{0x852a, 2},
-	{0x852b, 2891},
-	{0x852c, 3446},
-	{0x852d, 8731},
-	{0x852f, 0},
-	{0x8530, 1},
-	{0x8531, 2},
-	{0x8532, 3},
-	{0x8533, 4},
-	{0x8534, 5},
-	{0x8535, 6},
-	{0x8536, 7},
-	{0x8537, 3131},
-	{0x8538, 5254},
-	{0x8539, 5256},
-	{0x853a, 5258},
-	{0x853b, 5260},
-	{0x853c, 949},
-	{0x853d, 1079},
-	{0x853f, 0},
-	{0x8540, 1},
-	{0x8541, 9026},
-	{0x8543, 5270},
-	{0x8545, 0},
-	{0x8546, 9039},
-	{0x8548, 5264},
-	{0x8549, 2183},
-	{0x854a, 3274},
-	{0x854c, 0},
-	{0x854d, 1},
-	{0x854e, 9021},
-	{0x8550, 0},
-	{0x8551, 1},
-	{0x8552, 9028},
-	{0x8553, 9009},
-	{0x8555, 9035},
-	{0x8556, 5259},
-	{0x8558, 9019},
-	{0x8559, 5263},
-	{0x855b, 0},
-	{0x855c, 1},
-	{0x855d, 2},
-	{0x855e, 5267},
-	{0x8560, 0},
-	{0x8561, 1},
-	{0x8562, 9040},
-	{0x8564, 5266},
-	{0x8566, 0},
-	{0x8567, 1},
-	{0x8568, 5265},
-	{0x8569, 7860},
-	{0x856a, 8614},
-	{0x856c, 0},
-	{0x856d, 8651},
-	{0x856f, 0},
-	{0x8570, 1},
-	{0x8571, 2},
-	{0x8572, 5271},
-	{0x8574, 4367},
-	{0x8576, 0},
-	{0x8577, 9045},
-	{0x8579, 5277},
-	{0x857a, 5268},
-	{0x857b, 5272},
-	{0x857d, 0},
-	{0x857e, 2500},
-	{0x8580, 0},
-	{0x8581, 1},
-	{0x8582, 2},
-	{0x8583, 3},
-	{0x8584, 1034},
-	{0x8585, 5280},
-	{0x8587, 5275},
-	{0x8588, 9022},
-	{0x858a, 8052},
-	{0x858c, 9008},
-	{0x858e, 0},
-	{0x858f, 5276},
-	{0x8591, 9856},
-	{0x8593, 0},
-	{0x8594, 8410},
-	{0x8596, 0},
-	{0x8597, 1},
-	{0x8598, 2},
-	{0x8599, 3},
-	{0x859a, 4},
-	{0x859b, 4047},
-	{0x859c, 5279},
-	{0x859e, 0},
-	{0x859f, 9034},
-	{0x85a1, 0},
-	{0x85a2, 1},
-	{0x85a3, 2},
-	{0x85a4, 5273},
-	{0x85a6, 8081},
-	{0x85a8, 5274},
-	{0x85a9, 8455},
-	{0x85aa, 3976},
-	{0x85ac, 0},
-	{0x85ad, 1},
-	{0x85ae, 5278},
-	{0x85af, 3460},
-	{0x85b0, 5283},
-	{0x85b2, 0},
-	{0x85b3, 1},
-	{0x85b4, 2},
-	{0x85b5, 3},
-	{0x85b6, 4},
-	{0x85b7, 5282},
-	{0x85b9, 5281},
-	{0x85ba, 9023},
-	{0x85bc, 0},
-	{0x85bd, 1},
-	{0x85be, 2},
-	{0x85bf, 3},
-	{0x85c0, 4},
-	{0x85c1, 5285},
-	{0x85c3, 0},
-	{0x85c4, 1},
-	{0x85c5, 2},
-	{0x85c6, 3},
-	{0x85c7, 4},
-	{0x85c8, 5},
-	{0x85c9, 2230},
-	{0x85cb, 0},
-	{0x85cc, 1},
-	{0x85cd, 8180},
-	{0x85ce, 9027},
-	{0x85cf, 1183},
-	{0x85d0, 2799},
-	{0x85d2, 0},
-	{0x85d3, 5284},
-	{0x85d5, 2939},
-	{0x85d7, 0},
-	{0x85d8, 1},
-	{0x85d9, 2},
-	{0x85da, 3},
-	{0x85db, 4},
-	{0x85dc, 5286},
-	{0x85dd, 8722},
-	{0x85df, 0},
-	{0x85e0, 1},
-	{0x85e1, 2},
-	{0x85e2, 3},
-	{0x85e3, 4},
-	{0x85e4, 3628},
-	{0x85e5, 8711},
-	{0x85e7, 0},
-	{0x85e8, 1},
-	{0x85e9, 1607},
-	{0x85ea, 9049},
-	{0x85ec, 0},
-	{0x85ed, 1},
-	{0x85ee, 2},
-	{0x85ef, 3},
-	{0x85f0, 4},
-	{0x85f1, 5},
-	{0x85f2, 6},
-	{0x85f3, 7},
-	{0x85f4, 8788},
-	{0x85f6, 9010},
-	{0x85f8, 0},
-	{0x85f9, 7718},
-	{0x85fa, 9047},
-	{0x85fb, 4392},
-	{0x85fd, 0},
-	{0x85fe, 1},
-	{0x85ff, 5287},
-	{0x8601, 0},
-	{0x8602, 1},
-	{0x8603, 2},
-	{0x8604, 9048},
-	{0x8605, 5289},
-	{0x8606, 8258},
-	{0x8607, 8531},
-	{0x8609, 0},
-	{0x860a, 1},
-	{0x860b, 8379},
-	{0x860d, 0},
-	{0x860e, 1},
-	{0x860f, 2},
-	{0x8610, 3},
-	{0x8611, 2821},
-	{0x8613, 0},
-	{0x8614, 1},
-	{0x8615, 2},
-	{0x8616, 5291},
-	{0x8618, 0},
-	{0x8619, 1},
-	{0x861a, 9050},
-	{0x861c, 0},
-	{0x861d, 1},
-	{0x861e, 9046},
-	{0x8620, 0},
-	{0x8621, 1},
-	{0x8622, 9015},
-	{0x8624, 0},
-	{0x8625, 1},
-	{0x8626, 2},
-	{0x8627, 5288},
-	{0x8629, 5290},
-	{0x862b, 0},
-	{0x862c, 1},
-	{0x862d, 8185},
-	{0x862f, 0},
-	{0x8630, 1},
-	{0x8631, 2},
-	{0x8632, 3},
-	{0x8633, 4},
-	{0x8634, 5},
-	{0x8635, 6},
-	{0x8636, 7},
-	{0x8637, 8},
-	{0x8638, 4443},
-	{0x863a, 9043},
-	{0x863c, 5292},
-	{0x863e, 0},
-	{0x863f, 8289},
-	{0x8641, 0},
-	{0x8642, 1},
-	{0x8643, 2},
-	{0x8644, 3},
-	{0x8645, 4},
-	{0x8646, 5},
-	{0x8647, 6},
-	{0x8648, 7},
-	{0x8649, 8},
-	{0x864a, 9},
-	{0x864b, 10},
-	{0x864c, 11},
-	{0x864d, 7152},
-	{0x864e, 1975},
-	{0x864f, 2649},
-	{0x8650, 2929},
-	{0x8651, 2670},
-	{0x8653, 0},
-	{0x8654, 7153},
-	{0x8655, 7829},
-	{0x8657, 0},
-	{0x8658, 1},
-	{0x8659, 2},
-	{0x865a, 4020},
-	{0x865c, 8265},
-	{0x865e, 4290},
-	{0x865f, 8002},
-	{0x8661, 0},
-	{0x8662, 6509},
-	{0x8664, 0},
-	{0x8665, 1},
-	{0x8666, 2},
-	{0x8667, 8168},
-	{0x8669, 0},
-	{0x866a, 1},
-	{0x866b, 1291},
-	{0x866c, 7154},
-	{0x866e, 7155},
-	{0x8670, 0},
-	{0x8671, 3396},
-	{0x8673, 0},
-	{0x8674, 1},
-	{0x8675, 2},
-	{0x8676, 3},
-	{0x8677, 4},
-	{0x8678, 5},
-	{0x8679, 1950},
-	{0x867a, 7157},
-	{0x867b, 7159},
-	{0x867c, 7158},
-	{0x867d, 3545},
-	{0x867e, 3879},
-	{0x867f, 7156},
-	{0x8680, 3403},
-	{0x8681, 4182},
-	{0x8682, 2707},
-	{0x8684, 0},
-	{0x8685, 1},
-	{0x8686, 2},
-	{0x8687, 3},
-	{0x8688, 4},
-	{0x8689, 5},
-	{0x868a, 3794},
-	{0x868b, 7162},
-	{0x868c, 1025},
-	{0x868d, 7161},
-	{0x868f, 0},
-	{0x8690, 1},
-	{0x8691, 2},
-	{0x8692, 3},
-	{0x8693, 7168},
-	{0x8695, 1174},
-	{0x8697, 0},
-	{0x8698, 1},
-	{0x8699, 2},
-	{0x869a, 3},
-	{0x869b, 4},
-	{0x869c, 4074},
-	{0x869d, 7164},
-	{0x869f, 0},
-	{0x86a0, 1},
-	{0x86a1, 2},
-	{0x86a2, 3},
-	{0x86a3, 7166},
-	{0x86a4, 4396},
-	{0x86a6, 0},
-	{0x86a7, 7165},
-	{0x86a8, 7160},
-	{0x86a9, 7169},
-	{0x86aa, 7167},
-	{0x86ac, 7163},
-	{0x86ae, 0},
-	{0x86af, 7177},
-	{0x86b0, 7174},
-	{0x86b1, 7176},
-	{0x86b3, 0},
-	{0x86b4, 7180},
-	{0x86b5, 7172},
-	{0x86b6, 7170},
-	{0x86b8, 0},
-	{0x86b9, 1},
-	{0x86ba, 7175},
-	{0x86bc, 0},
-	{0x86bd, 1},
-	{0x86be, 2},
-	{0x86bf, 3},
-	{0x86c0, 4602},
-	{0x86c2, 0},
-	{0x86c3, 1},
-	{0x86c4, 7171},
-	{0x86c6, 3190},
-	{0x86c7, 3352},
-	{0x86c9, 7178},
-	{0x86ca, 1823},
-	{0x86cb, 1425},
-	{0x86cd, 0},
-	{0x86ce, 7173},
-	{0x86cf, 7179},
-	{0x86d0, 7186},
-	{0x86d1, 7192},
-	{0x86d3, 0},
-	{0x86d4, 2028},
-	{0x86d6, 0},
-	{0x86d7, 1},
-	{0x86d8, 7191},
-	{0x86d9, 3725},
-	{0x86db, 4586},
-	{0x86dd, 0},
-	{0x86de, 7188},
-	{0x86df, 7190},
-	{0x86e1, 0},
-	{0x86e2, 1},
-	{0x86e3, 2},
-	{0x86e4, 1773},
-	{0x86e6, 0},
-	{0x86e7, 1},
-	{0x86e8, 2},
-	{0x86e9, 7181},
-	{0x86eb, 0},
-	{0x86ec, 1},
-	{0x86ed, 7184},
-	{0x86ee, 2720},
-	{0x86f0, 4478},
-	{0x86f1, 7182},
-	{0x86f2, 7183},
-	{0x86f3, 7185},
-	{0x86f4, 7189},
-	{0x86f6, 0},
-	{0x86f7, 1},
-	{0x86f8, 7195},
-	{0x86f9, 4257},
-	{0x86fa, 9690},
-	{0x86fc, 0},
-	{0x86fd, 1},
-	{0x86fe, 1577},
-	{0x8700, 3464},
-	{0x8702, 1665},
-	{0x8703, 7193},
-	{0x8705, 0},
-	{0x8706, 9687},
-	{0x8707, 7194},
-	{0x8708, 7196},
-	{0x8709, 7199},
-	{0x870a, 7197},
-	{0x870c, 0},
-	{0x870d, 7198},
-	{0x870f, 0},
-	{0x8710, 1},
-	{0x8711, 2},
-	{0x8712, 4090},
-	{0x8713, 7187},
-	{0x8715, 3706},
-	{0x8717, 3806},
-	{0x8718, 4520},
-	{0x871a, 7205},
-	{0x871c, 2784},
-	{0x871e, 7202},
-	{0x8720, 0},
-	{0x8721, 2458},
-	{0x8722, 7214},
-	{0x8723, 7200},
-	{0x8725, 7203},
-	{0x8727, 0},
-	{0x8728, 1},
-	{0x8729, 7210},
-	{0x872b, 0},
-	{0x872c, 1},
-	{0x872d, 2},
-	{0x872e, 7204},
-	{0x8730, 0},
-	{0x8731, 7209},
-	{0x8733, 0},
-	{0x8734, 7208},
-	{0x8736, 0},
-	{0x8737, 7211},
-	{0x8739, 0},
-	{0x873a, 1},
-	{0x873b, 7201},
-	{0x873d, 0},
-	{0x873e, 7206},
-	{0x873f, 7212},
-	{0x8741, 0},
-	{0x8742, 1},
-	{0x8743, 2},
-	{0x8744, 3},
-	{0x8745, 4},
-	{0x8746, 5},
-	{0x8747, 4241},
-	{0x8748, 7207},
-	{0x8749, 1212},
-	{0x874b, 0},
-	{0x874c, 7220},
-	{0x874e, 3958},
-	{0x8750, 0},
-	{0x8751, 1},
-	{0x8752, 2},
-	{0x8753, 7223},
-	{0x8755, 8494},
-	{0x8757, 2013},
-	{0x8759, 7227},
-	{0x875b, 0},
-	{0x875c, 1},
-	{0x875d, 2},
-	{0x875e, 3},
-	{0x875f, 4},
-	{0x8760, 7218},
-	{0x8762, 0},
-	{0x8763, 7224},
-	{0x8764, 7226},
-	{0x8765, 7228},
-	{0x8766, 8626},
-	{0x8768, 0},
-	{0x8769, 1},
-	{0x876a, 2},
-	{0x876b, 3},
-	{0x876c, 4},
-	{0x876d, 5},
-	{0x876e, 7221},
-	{0x8770, 7219},
-	{0x8772, 0},
-	{0x8773, 1},
-	{0x8774, 1970},
-	{0x8776, 1500},
-	{0x8778, 8606},
-	{0x877a, 0},
-	{0x877b, 7217},
-	{0x877c, 7225},
-	{0x877d, 7215},
-	{0x877e, 7216},
-	{0x8780, 0},
-	{0x8781, 1},
-	{0x8782, 7213},
-	{0x8783, 7238},
-	{0x8784, 9692},
-	{0x8785, 7235},
-	{0x8787, 0},
-	{0x8788, 7234},
-	{0x878a, 0},
-	{0x878b, 7222},
-	{0x878d, 3253},
-	{0x878f, 0},
-	{0x8790, 1},
-	{0x8791, 2},
-	{0x8792, 3},
-	{0x8793, 7229},
-	{0x8795, 0},
-	{0x8796, 1},
-	{0x8797, 7237},
-	{0x8799, 0},
-	{0x879a, 1},
-	{0x879b, 2},
-	{0x879c, 3},
-	{0x879d, 4},
-	{0x879e, 8300},
-	{0x879f, 2813},
-	{0x87a1, 0},
-	{0x87a2, 8742},
-	{0x87a4, 0},
-	{0x87a5, 1},
-	{0x87a6, 2},
-	{0x87a7, 3},
-	{0x87a8, 7231},
-	{0x87aa, 0},
-	{0x87ab, 7239},
-	{0x87ac, 7241},
-	{0x87ad, 7236},
-	{0x87af, 7230},
-	{0x87b1, 0},
-	{0x87b2, 1},
-	{0x87b3, 7243},
-	{0x87b5, 7242},
-	{0x87b7, 0},
-	{0x87b8, 1},
-	{0x87b9, 2},
-	{0x87ba, 2692},
-	{0x87bb, 9696},
-	{0x87bd, 7246},
-	{0x87bf, 0},
-	{0x87c0, 7248},
-	{0x87c2, 0},
-	{0x87c3, 1},
-	{0x87c4, 8827},
-	{0x87c6, 7233},
-	{0x87c8, 9694},
-	{0x87ca, 7249},
-	{0x87cb, 7244},
-	{0x87cd, 0},
-	{0x87ce, 9697},
-	{0x87d0, 0},
-	{0x87d1, 7247},
-	{0x87d2, 7232},
-	{0x87d3, 7245},
-	{0x87d5, 0},
-	{0x87d6, 1},
-	{0x87d7, 2},
-	{0x87d8, 3},
-	{0x87d9, 4},
-	{0x87da, 5},
-	{0x87db, 7250},
-	{0x87dd, 0},
-	{0x87de, 1},
-	{0x87df, 2},
-	{0x87e0, 7252},
-	{0x87e2, 0},
-	{0x87e3, 9685},
-	{0x87e5, 7240},
-	{0x87e7, 0},
-	{0x87e8, 1},
-	{0x87e9, 2},
-	{0x87ea, 7251},
-	{0x87ec, 7787},
-	{0x87ee, 7253},
-	{0x87ef, 9691},
-	{0x87f1, 0},
-	{0x87f2, 7817},
-	{0x87f4, 0},
-	{0x87f5, 1},
-	{0x87f6, 9689},
-	{0x87f8, 0},
-	{0x87f9, 3970},
-	{0x87fb, 8721},
-	{0x87fd, 0},
-	{0x87fe, 7256},
-	{0x8801, 0},
-	{0x8802, 1},
-	{0x8803, 4877},
-	{0x8805, 8745},
-	{0x8806, 9686},
-	{0x8808, 0},
-	{0x8809, 1},
-	{0x880a, 7257},
-	{0x880c, 0},
-	{0x880d, 1},
-	{0x880e, 2},
-	{0x880f, 3},
-	{0x8810, 9693},
-	{0x8811, 9695},
-	{0x8813, 7255},
-	{0x8815, 3263},
-	{0x8816, 7254},
-	{0x8818, 0},
-	{0x8819, 1},
-	{0x881a, 2},
-	{0x881b, 7258},
-	{0x881d, 0},
-	{0x881e, 1},
-	{0x881f, 8175},
-	{0x8821, 7259},
-	{0x8822, 1347},
-	{0x8823, 9688},
-	{0x8825, 0},
-	{0x8826, 1},
-	{0x8827, 2},
-	{0x8828, 3},
-	{0x8829, 4},
-	{0x882a, 5},
-	{0x882b, 6},
-	{0x882c, 7},
-	{0x882d, 8},
-	{0x882e, 9},
-	{0x882f, 10},
-	{0x8830, 11},
-	{0x8831, 7977},
-	{0x8832, 6797},
-	{0x8834, 0},
-	{0x8835, 1},
-	{0x8836, 7771},
-	{0x8838, 0},
-	{0x8839, 7260},
-	{0x883b, 8310},
-	{0x883c, 7261},
-	{0x883e, 0},
-	{0x883f, 1},
-	{0x8840, 4051},
-	{0x8842, 0},
-	{0x8843, 1},
-	{0x8844, 7338},
-	{0x8845, 3985},
-	{0x8846, 8855},
-	{0x8848, 0},
-	{0x8849, 1},
-	{0x884a, 9872},
-	{0x884c, 3995},
-	{0x884d, 4101},
-	{0x884f, 0},
-	{0x8850, 1},
-	{0x8851, 2},
-	{0x8852, 3},
-	{0x8853, 8511},
-	{0x8854, 3899},
-	{0x8856, 0},
-	{0x8857, 2215},
-	{0x8859, 4076},
-	{0x885b, 8600},
-	{0x885d, 7816},
-	{0x885f, 0},
-	{0x8860, 1},
-	{0x8861, 1945},
-	{0x8862, 5613},
-	{0x8863, 4169},
-	{0x8864, 7078},
-	{0x8865, 1152},
-	{0x8867, 0},
-	{0x8868, 1110},
-	{0x8869, 7079},
-	{0x886b, 3321},
-	{0x886c, 1257},
-	{0x886e, 4870},
-	{0x8870, 3482},
-	{0x8872, 7080},
-	{0x8874, 0},
-	{0x8875, 1},
-	{0x8876, 2},
-	{0x8877, 4563},
-	{0x8879, 8844},
-	{0x887b, 0},
-	{0x887c, 1},
-	{0x887d, 7081},
-	{0x887e, 7358},
-	{0x887f, 7082},
-	{0x8881, 4335},
-	{0x8882, 7083},
-	{0x8884, 971},
-	{0x8885, 7359},
-	{0x8887, 0},
-	{0x8888, 7360},
-	{0x888a, 0},
-	{0x888b, 1407},
-	{0x888d, 2972},
-	{0x888f, 0},
-	{0x8890, 1},
-	{0x8891, 2},
-	{0x8892, 3598},
-	{0x8894, 0},
-	{0x8895, 1},
-	{0x8896, 4015},
-	{0x8898, 0},
-	{0x8899, 1},
-	{0x889a, 2},
-	{0x889b, 3},
-	{0x889c, 3729},
-	{0x889e, 0},
-	{0x889f, 1},
-	{0x88a0, 2},
-	{0x88a1, 3},
-	{0x88a2, 7084},
-	{0x88a4, 4871},
-	{0x88a6, 0},
-	{0x88a7, 1},
-	{0x88a8, 2},
-	{0x88a9, 3},
-	{0x88aa, 4},
-	{0x88ab, 1060},
-	{0x88ad, 3867},
-	{0x88af, 0},
-	{0x88b0, 1},
-	{0x88b1, 1695},
-	{0x88b3, 0},
-	{0x88b4, 1},
-	{0x88b5, 2},
-	{0x88b6, 3},
-	{0x88b7, 7086},
-	{0x88b9, 0},
-	{0x88ba, 1},
-	{0x88bb, 2},
-	{0x88bc, 7087},
-	{0x88be, 0},
-	{0x88bf, 1},
-	{0x88c0, 2},
-	{0x88c1, 1162},
-	{0x88c2, 2586},
-	{0x88c4, 0},
-	{0x88c5, 4621},
-	{0x88c6, 7085},
-	{0x88c8, 0},
-	{0x88c9, 7088},
-	{0x88ca, 9713},
-	{0x88cc, 0},
-	{0x88cd, 1},
-	{0x88ce, 7090},
-	{0x88cf, 8204},
-	{0x88d1, 0},
-	{0x88d2, 4874},
-	{0x88d4, 4200},
-	{0x88d5, 4326},
-	{0x88d7, 0},
-	{0x88d8, 7361},
-	{0x88d9, 3220},
-	{0x88db, 0},
-	{0x88dc, 7768},
-	{0x88dd, 8876},
-	{0x88df, 7362},
-	{0x88e1, 0},
-	{0x88e2, 7089},
-	{0x88e3, 7091},
-	{0x88e4, 2416},
-	{0x88e5, 7092},
-	{0x88e7, 0},
-	{0x88e8, 7096},
-	{0x88ea, 0},
-	{0x88eb, 1},
-	{0x88ec, 2},
-	{0x88ed, 3},
-	{0x88ee, 4},
-	{0x88ef, 5},
-	{0x88f0, 7098},
-	{0x88f1, 7093},
-	{0x88f3, 3338},
-	{0x88f4, 2978},
-	{0x88f6, 0},
-	{0x88f7, 1},
-	{0x88f8, 2698},
-	{0x88f9, 1877},
-	{0x88fb, 0},
-	{0x88fc, 7095},
-	{0x88fd, 9895},
-	{0x88fe, 7097},
-	{0x8901, 0},
-	{0x8902, 1836},
-	{0x8904, 0},
-	{0x8905, 1},
-	{0x8906, 2},
-	{0x8907, 9846},
-	{0x8909, 0},
-	{0x890a, 7103},
-	{0x890c, 0},
-	{0x890d, 1},
-	{0x890e, 2},
-	{0x890f, 3},
-	{0x8910, 1933},
-	{0x8912, 1032},
-	{0x8913, 7101},
-	{0x8915, 0},
-	{0x8916, 1},
-	{0x8917, 2},
-	{0x8918, 3},
-	{0x8919, 7100},
-	{0x891a, 7094},
-	{0x891b, 7102},
-	{0x891d, 0},
-	{0x891e, 1},
-	{0x891f, 2},
-	{0x8920, 3},
-	{0x8921, 7099},
-	{0x8923, 0},
-	{0x8924, 1},
-	{0x8925, 3271},
-	{0x8927, 0},
-	{0x8928, 1},
-	{0x8929, 2},
-	{0x892a, 3707},
-	{0x892b, 7105},
-	{0x892d, 0},
-	{0x892e, 1},
-	{0x892f, 2},
-	{0x8930, 5945},
-	{0x8932, 8161},
-	{0x8933, 9659},
-	{0x8934, 7104},
-	{0x8936, 7106},
-	{0x8938, 9662},
-	{0x893a, 0},
-	{0x893b, 8925},
-	{0x893d, 0},
-	{0x893e, 1},
-	{0x893f, 2},
-	{0x8940, 3},
-	{0x8941, 7107},
-	{0x8943, 0},
-	{0x8944, 3922},
-	{0x8946, 0},
-	{0x8947, 9661},
-	{0x8949, 0},
-	{0x894a, 1},
-	{0x894b, 2},
-	{0x894c, 3},
-	{0x894d, 4},
-	{0x894e, 5},
-	{0x894f, 6},
-	{0x8950, 7},
-	{0x8951, 8},
-	{0x8952, 9},
-	{0x8953, 10},
-	{0x8954, 11},
-	{0x8955, 12},
-	{0x8956, 7722},
-	{0x8958, 0},
-	{0x8959, 1},
-	{0x895a, 2},
-	{0x895b, 3},
-	{0x895c, 4},
-	{0x895d, 9660},
-	{0x895e, 7363},
-	{0x895f, 2244},
-	{0x8960, 9658},
-	{0x8962, 0},
-	{0x8963, 1},
-	{0x8964, 9663},
-	{0x8966, 7108},
-	{0x8968, 0},
-	{0x8969, 1},
-	{0x896a, 8583},
-	{0x896c, 9835},
-	{0x896e, 0},
-	{0x896f, 7807},
-	{0x8971, 0},
-	{0x8972, 8621},
-	{0x8974, 0},
-	{0x8975, 1},
-	{0x8976, 2},
-	{0x8977, 3},
-	{0x8978, 4},
-	{0x8979, 5},
-	{0x897a, 6},
-	{0x897b, 7109},
-	{0x897d, 0},
-	{0x897e, 1},
-	{0x897f, 3846},
-	{0x8981, 4145},
-	{0x8983, 7135},
-	{0x8985, 0},
-	{0x8986, 1709},
-	{0x8988, 0},
-	{0x8989, 1},
-	{0x898a, 2},
-	{0x898b, 8086},
-	{0x898d, 0},
-	{0x898e, 1},
-	{0x898f, 7986},
-	{0x8991, 0},
-	{0x8992, 1},
-	{0x8993, 8324},
-	{0x8995, 0},
-	{0x8996, 8502},
-	{0x8998, 9400},
-	{0x899a, 0},
-	{0x899b, 1},
-	{0x899c, 2},
-	{0x899d, 3},
-	{0x899e, 4},
-	{0x899f, 5},
-	{0x89a0, 6},
-	{0x89a1, 9402},
-	{0x89a3, 0},
-	{0x89a4, 1},
-	{0x89a5, 2},
-	{0x89a6, 9404},
-	{0x89a8, 0},
-	{0x89a9, 1},
-	{0x89aa, 8420},
-	{0x89ac, 9401},
-	{0x89ae, 0},
-	{0x89af, 9405},
-	{0x89b1, 0},
-	{0x89b2, 9406},
-	{0x89b4, 0},
-	{0x89b5, 1},
-	{0x89b6, 2},
-	{0x89b7, 9407},
-	{0x89b9, 0},
-	{0x89ba, 8146},
-	{0x89bc, 0},
-	{0x89bd, 8189},
-	{0x89bf, 9403},
-	{0x89c0, 7981},
-	{0x89c1, 2158},
-	{0x89c2, 1844},
-	{0x89c4, 1855},
-	{0x89c5, 2782},
-	{0x89c6, 3434},
-	{0x89c7, 6458},
-	{0x89c8, 2475},
-	{0x89c9, 2340},
-	{0x89ca, 6459},
-	{0x89cb, 6460},
-	{0x89cc, 6461},
-	{0x89ce, 6462},
-	{0x89cf, 6463},
-	{0x89d0, 6464},
-	{0x89d1, 6465},
-	{0x89d2, 2200},
-	{0x89d4, 0},
-	{0x89d5, 1},
-	{0x89d6, 7511},
-	{0x89d8, 0},
-	{0x89d9, 1},
-	{0x89da, 7513},
-	{0x89dc, 7514},
-	{0x89de, 7512},
-	{0x89e0, 0},
-	{0x89e1, 1},
-	{0x89e2, 2},
-	{0x89e3, 2227},
-	{0x89e5, 7515},
-	{0x89e6, 1320},
-	{0x89e8, 0},
-	{0x89e9, 1},
-	{0x89ea, 2},
-	{0x89eb, 7516},
-	{0x89ed, 0},
-	{0x89ee, 1},
-	{0x89ef, 7517},
-	{0x89f1, 0},
-	{0x89f2, 1},
-	{0x89f3, 6592},
-	{0x89f4, 9737},
-	{0x89f6, 9738},
-	{0x89f8, 7828},
-	{0x89fa, 0},
-	{0x89fb, 1},
-	{0x89fc, 2},
-	{0x89fd, 3},
-	{0x89fe, 4},
-	{0x89ff, 5},
-	{0x8a00, 4093},
-	{0x8a01, 8927},
-	{0x8a02, 7883},
-	{0x8a03, 7949},
-	{0x8a05, 0},
-	{0x8a06, 1},
-	{0x8a07, 4862},
-	{0x8a08, 8055},
-	{0x8a0a, 8683},
-	{0x8a0c, 8929},
-	{0x8a0e, 8559},
-	{0x8a10, 8928},
-	{0x8a12, 0},
-	{0x8a13, 8682},
-	{0x8a15, 8930},
-	{0x8a16, 8395},
-	{0x8a18, 8056},
-	{0x8a1a, 0},
-	{0x8a1b, 7906},
-	{0x8a1d, 8690},
-	{0x8a1f, 8528},
-	{0x8a21, 0},
-	{0x8a22, 1},
-	{0x8a23, 8147},
-	{0x8a25, 8933},
-	{0x8a27, 0},
-	{0x8a28, 1},
-	{0x8a29, 2},
-	{0x8a2a, 7922},
-	{0x8a2c, 0},
-	{0x8a2d, 8479},
-	{0x8a2f, 0},
-	{0x8a30, 1},
-	{0x8a31, 8669},
-	{0x8a33, 0},
-	{0x8a34, 8532},
-	{0x8a36, 8935},
-	{0x8a38, 0},
-	{0x8a39, 1},
-	{0x8a3a, 8834},
-	{0x8a3c, 0},
-	{0x8a3d, 1},
-	{0x8a3e, 7518},
-	{0x8a40, 0},
-	{0x8a41, 8934},
-	{0x8a43, 0},
-	{0x8a44, 1},
-	{0x8a45, 2},
-	{0x8a46, 8936},
-	{0x8a48, 6788},
-	{0x8a4a, 0},
-	{0x8a4b, 1},
-	{0x8a4c, 2},
-	{0x8a4d, 3},
-	{0x8a4e, 8932},
-	{0x8a50, 8810},
-	{0x8a52, 8939},
-	{0x8a54, 8937},
-	{0x8a55, 8381},
-	{0x8a57, 0},
-	{0x8a58, 8938},
-	{0x8a5a, 0},
-	{0x8a5b, 8893},
-	{0x8a5d, 0},
-	{0x8a5e, 7838},
-	{0x8a60, 0},
-	{0x8a61, 8950},
-	{0x8a62, 8679},
-	{0x8a63, 8726},
-	{0x8a65, 0},
-	{0x8a66, 8503},
-	{0x8a68, 0},
-	{0x8a69, 8492},
-	{0x8a6b, 7784},
-	{0x8a6c, 8946},
-	{0x8a6d, 7991},
-	{0x8a6e, 8947},
-	{0x8a70, 8943},
-	{0x8a71, 8016},
-	{0x8a72, 7952},
-	{0x8a73, 8648},
-	{0x8a75, 8945},
-	{0x8a77, 0},
-	{0x8a78, 1},
-	{0x8a79, 4435},
-	{0x8a7b, 0},
-	{0x8a7c, 8944},
-	{0x8a7e, 0},
-	{0x8a7f, 8942},
-	{0x8a81, 0},
-	{0x8a82, 1},
-	{0x8a83, 2},
-	{0x8a84, 8941},
-	{0x8a85, 8862},
-	{0x8a86, 8940},
-	{0x8a87, 8162},
-	{0x8a89, 4323},
-	{0x8a8a, 3631},
-	{0x8a8c, 0},
-	{0x8a8d, 8446},
-	{0x8a8f, 0},
-	{0x8a90, 1},
-	{0x8a91, 8953},
-	{0x8a92, 8954},
-	{0x8a93, 3419},
-	{0x8a95, 7855},
-	{0x8a97, 0},
-	{0x8a98, 8758},
-	{0x8a9a, 8951},
-	{0x8a9c, 0},
-	{0x8a9d, 1},
-	{0x8a9e, 8765},
-	{0x8aa0, 7810},
-	{0x8aa1, 8118},
-	{0x8aa3, 8612},
-	{0x8aa4, 8618},
-	{0x8aa5, 8952},
-	{0x8aa6, 8529},
-	{0x8aa8, 8032},
-	{0x8aaa, 0},
-	{0x8aab, 1},
-	{0x8aac, 8519},
-	{0x8aae, 0},
-	{0x8aaf, 1},
-	{0x8ab0, 8517},
-	{0x8ab2, 8156},
-	{0x8ab4, 0},
-	{0x8ab5, 1},
-	{0x8ab6, 8961},
-	{0x8ab8, 0},
-	{0x8ab9, 7925},
-	{0x8abb, 0},
-	{0x8abc, 8728},
-	{0x8abe, 0},
-	{0x8abf, 7878},
-	{0x8ac1, 0},
-	{0x8ac2, 8960},
-	{0x8ac4, 8884},
-	{0x8ac6, 0},
-	{0x8ac7, 8553},
-	{0x8ac9, 8957},
-	{0x8acb, 8426},
-	{0x8acd, 8948},
-	{0x8acf, 8955},
-	{0x8ad1, 8956},
-	{0x8ad2, 8231},
-	{0x8ad4, 0},
-	{0x8ad5, 1},
-	{0x8ad6, 8288},
-	{0x8ad7, 8959},
-	{0x8ad9, 0},
-	{0x8ada, 1},
-	{0x8adb, 8958},
-	{0x8adc, 7879},
-	{0x8ade, 8972},
-	{0x8ae0, 0},
-	{0x8ae1, 1},
-	{0x8ae2, 8949},
-	{0x8ae4, 8966},
-	{0x8ae6, 8970},
-	{0x8ae7, 8659},
-	{0x8ae9, 0},
-	{0x8aea, 1},
-	{0x8aeb, 8963},
-	{0x8aed, 8967},
-	{0x8aee, 8971},
-	{0x8af0, 0},
-	{0x8af1, 8031},
-	{0x8af3, 8969},
-	{0x8af5, 0},
-	{0x8af6, 8962},
-	{0x8af7, 7940},
-	{0x8af8, 8861},
-	{0x8afa, 8699},
-	{0x8afc, 8968},
-	{0x8afe, 8364},
-	{0x8b00, 8334},
-	{0x8b01, 8965},
-	{0x8b02, 8599},
-	{0x8b04, 8561},
-	{0x8b05, 8856},
-	{0x8b07, 5948},
-	{0x8b09, 0},
-	{0x8b0a, 8023},
-	{0x8b0c, 0},
-	{0x8b0d, 1},
-	{0x8b0e, 8322},
-	{0x8b10, 8977},
-	{0x8b12, 0},
-	{0x8b13, 1},
-	{0x8b14, 8964},
-	{0x8b16, 8975},
-	{0x8b17, 7733},
-	{0x8b19, 8401},
-	{0x8b1a, 8976},
-	{0x8b1b, 8099},
-	{0x8b1d, 8662},
-	{0x8b1f, 0},
-	{0x8b20, 1},
-	{0x8b21, 8710},
-	{0x8b23, 0},
-	{0x8b24, 1},
-	{0x8b25, 2},
-	{0x8b26, 7519},
-	{0x8b28, 8973},
-	{0x8b2a, 0},
-	{0x8b2b, 8978},
-	{0x8b2c, 8333},
-	{0x8b2d, 8979},
-	{0x8b2f, 0},
-	{0x8b30, 1},
-	{0x8b31, 2},
-	{0x8b32, 3},
-	{0x8b33, 8931},
-	{0x8b35, 0},
-	{0x8b36, 1},
-	{0x8b37, 2},
-	{0x8b38, 3},
-	{0x8b39, 8122},
-	{0x8b3b, 0},
-	{0x8b3c, 1},
-	{0x8b3d, 2},
-	{0x8b3e, 8312},
-	{0x8b40, 0},
-	{0x8b41, 1},
-	{0x8b42, 2},
-	{0x8b43, 3},
-	{0x8b44, 4},
-	{0x8b45, 5},
-	{0x8b46, 6},
-	{0x8b47, 7},
-	{0x8b48, 8},
-	{0x8b49, 8840},
-	{0x8b4b, 0},
-	{0x8b4c, 1},
-	{0x8b4d, 2},
-	{0x8b4e, 8982},
-	{0x8b4f, 8043},
-	{0x8b51, 0},
-	{0x8b52, 1},
-	{0x8b53, 2},
-	{0x8b54, 3},
-	{0x8b55, 4},
-	{0x8b56, 8980},
-	{0x8b58, 8496},
-	{0x8b59, 8981},
-	{0x8b5a, 8552},
-	{0x8b5c, 8388},
-	{0x8b5e, 0},
-	{0x8b5f, 1},
-	{0x8b60, 2},
-	{0x8b61, 3},
-	{0x8b62, 4},
-	{0x8b63, 5},
-	{0x8b64, 6},
-	{0x8b65, 7},
-	{0x8b66, 2270},
-	{0x8b68, 0},
-	{0x8b69, 1},
-	{0x8b6a, 2},
-	{0x8b6b, 8984},
-	{0x8b6c, 3016},
-	{0x8b6e, 0},
-	{0x8b6f, 8729},
-	{0x8b70, 8727},
-	{0x8b72, 0},
-	{0x8b73, 1},
-	{0x8b74, 8405},
-	{0x8b76, 0},
-	{0x8b77, 8010},
-	{0x8b79, 0},
-	{0x8b7a, 1},
-	{0x8b7b, 2},
-	{0x8b7c, 3},
-	{0x8b7d, 8768},
-	{0x8b7f, 0},
-	{0x8b80, 7891},
-	{0x8b82, 0},
-	{0x8b83, 1},
-	{0x8b84, 2},
-	{0x8b85, 3},
-	{0x8b86, 4},
-	{0x8b87, 5},
-	{0x8b88, 6},
-	{0x8b89, 7},
-	{0x8b8a, 7753},
-	{0x8b8c, 0},
-	{0x8b8d, 1},
-	{0x8b8e, 9755},
-	{0x8b90, 0},
-	{0x8b91, 1},
-	{0x8b92, 7789},
-	{0x8b93, 8440},
-	{0x8b95, 8187},
-	{0x8b96, 8985},
-	{0x8b98, 0},
-	{0x8b99, 1},
-	{0x8b9a, 2},
-	{0x8b9b, 3},
-	{0x8b9c, 8974},
-	{0x8b9e, 8983},
-	{0x8ba0, 4887},
-	{0x8ba1, 2105},
-	{0x8ba2, 1512},
-	{0x8ba3, 1719},
-	{0x8ba4, 3242},
-	{0x8ba5, 2072},
-	{0x8ba6, 4888},
-	{0x8ba7, 4889},
-	{0x8ba8, 3625},
-	{0x8ba9, 3230},
-	{0x8baa, 4890},
-	{0x8bab, 3100},
-	{0x8bad, 4062},
-	{0x8bae, 4208},
-	{0x8baf, 4063},
-	{0x8bb0, 2106},
-	{0x8bb2, 2179},
-	{0x8bb3, 2041},
-	{0x8bb4, 4891},
-	{0x8bb5, 4892},
-	{0x8bb6, 4081},
-	{0x8bb7, 4893},
-	{0x8bb8, 4024},
-	{0x8bb9, 1582},
-	{0x8bba, 2690},
-	{0x8bbc, 3524},
-	{0x8bbd, 1674},
-	{0x8bbe, 3361},
-	{0x8bbf, 1632},
-	{0x8bc0, 2342},
-	{0x8bc1, 4515},
-	{0x8bc2, 4894},
-	{0x8bc3, 4895},
-	{0x8bc4, 3039},
-	{0x8bc5, 4676},
-	{0x8bc6, 3405},
-	{0x8bc8, 4426},
-	{0x8bc9, 3540},
-	{0x8bca, 4496},
-	{0x8bcb, 4896},
-	{0x8bcc, 4574},
-	{0x8bcd, 1357},
-	{0x8bce, 4898},
-	{0x8bcf, 4897},
-	{0x8bd1, 4210},
-	{0x8bd2, 4899},
-	{0x8bd3, 4900},
-	{0x8bd4, 4901},
-	{0x8bd5, 3435},
-	{0x8bd6, 4902},
-	{0x8bd7, 3394},
-	{0x8bd8, 4903},
-	{0x8bd9, 4904},
-	{0x8bda, 1268},
-	{0x8bdb, 4590},
-	{0x8bdc, 4905},
-	{0x8bdd, 1989},
-	{0x8bde, 1423},
-	{0x8bdf, 4906},
-	{0x8be0, 4907},
-	{0x8be1, 1863},
-	{0x8be2, 4056},
-	{0x8be3, 4207},
-	{0x8be4, 4908},
-	{0x8be5, 1726},
-	{0x8be6, 3927},
-	{0x8be7, 1206},
-	{0x8be8, 4909},
-	{0x8be9, 4910},
-	{0x8beb, 2236},
-	{0x8bec, 3819},
-	{0x8bed, 4308},
-	{0x8bee, 4911},
-	{0x8bef, 3842},
-	{0x8bf0, 4912},
-	{0x8bf1, 4282},
-	{0x8bf2, 2042},
-	{0x8bf3, 4913},
-	{0x8bf4, 3498},
-	{0x8bf5, 3525},
-	{0x8bf6, 4914},
-	{0x8bf7, 3176},
-	{0x8bf8, 4589},
-	{0x8bf9, 4915},
-	{0x8bfa, 2934},
-	{0x8bfb, 1536},
-	{0x8bfc, 4916},
-	{0x8bfd, 1641},
-	{0x8bfe, 2395},
-	{0x8bff, 4917},
-	{0x8c00, 4918},
-	{0x8c01, 3490},
-	{0x8c02, 4919},
-	{0x8c03, 1496},
-	{0x8c04, 4920},
-	{0x8c05, 2571},
-	{0x8c06, 4632},
-	{0x8c07, 4921},
-	{0x8c08, 3595},
-	{0x8c0a, 4209},
-	{0x8c0b, 2836},
-	{0x8c0c, 4922},
-	{0x8c0d, 1502},
-	{0x8c0e, 2022},
-	{0x8c0f, 4923},
-	{0x8c10, 3966},
-	{0x8c11, 4924},
-	{0x8c12, 4925},
-	{0x8c13, 3788},
-	{0x8c14, 4926},
-	{0x8c15, 4927},
-	{0x8c16, 4928},
-	{0x8c17, 1214},
-	{0x8c18, 4931},
-	{0x8c19, 4929},
-	{0x8c1a, 4113},
-	{0x8c1b, 4930},
-	{0x8c1c, 2778},
-	{0x8c1d, 4932},
-	{0x8c1f, 4933},
-	{0x8c20, 4934},
-	{0x8c21, 4935},
-	{0x8c22, 3974},
-	{0x8c23, 4140},
-	{0x8c24, 1028},
-	{0x8c25, 4936},
-	{0x8c26, 3112},
-	{0x8c27, 4937},
-	{0x8c28, 2248},
-	{0x8c29, 2726},
-	{0x8c2a, 4938},
-	{0x8c2b, 4939},
-	{0x8c2c, 2818},
-	{0x8c2d, 3594},
-	{0x8c2e, 4940},
-	{0x8c2f, 4941},
-	{0x8c30, 2473},
-	{0x8c31, 3062},
-	{0x8c32, 4942},
-	{0x8c33, 4943},
-	{0x8c34, 3121},
-	{0x8c35, 4944},
-	{0x8c36, 4945},
-	{0x8c37, 1825},
-	{0x8c39, 0},
-	{0x8c3a, 1},
-	{0x8c3b, 2},
-	{0x8c3c, 3},
-	{0x8c3d, 4},
-	{0x8c3e, 5},
-	{0x8c3f, 6},
-	{0x8c40, 7},
-	{0x8c41, 2050},
-	{0x8c43, 0},
-	{0x8c44, 1},
-	{0x8c45, 2},
-	{0x8c46, 1528},
-	{0x8c47, 7414},
-	{0x8c48, 8392},
-	{0x8c49, 7415},
-	{0x8c4b, 0},
-	{0x8c4c, 3732},
-	{0x8c4e, 0},
-	{0x8c4f, 1},
-	{0x8c50, 7933},
-	{0x8c52, 0},
-	{0x8c53, 1},
-	{0x8c54, 2},
-	{0x8c55, 7445},
-	{0x8c57, 0},
-	{0x8c58, 1},
-	{0x8c59, 2},
-	{0x8c5a, 6544},
-	{0x8c5c, 0},
-	{0x8c5d, 1},
-	{0x8c5e, 2},
-	{0x8c5f, 3},
-	{0x8c60, 4},
-	{0x8c61, 3936},
-	{0x8c62, 2004},
-	{0x8c64, 0},
-	{0x8c65, 1},
-	{0x8c66, 2},
-	{0x8c67, 3},
-	{0x8c68, 4},
-	{0x8c69, 5},
-	{0x8c6a, 1911},
-	{0x8c6b, 4328},
-	{0x8c6d, 0},
-	{0x8c6e, 1},
-	{0x8c6f, 2},
-	{0x8c70, 3},
-	{0x8c71, 4},
-	{0x8c72, 5},
-	{0x8c73, 5597},
-	{0x8c75, 0},
-	{0x8c76, 1},
-	{0x8c77, 2},
-	{0x8c78, 7504},
-	{0x8c79, 1043},
-	{0x8c7a, 1209},
-	{0x8c7c, 0},
-	{0x8c7d, 1},
-	{0x8c7e, 2},
-	{0x8c7f, 3},
-	{0x8c80, 4},
-	{0x8c81, 5},
-	{0x8c82, 7505},
-	{0x8c84, 0},
-	{0x8c85, 7507},
-	{0x8c87, 0},
-	{0x8c88, 1},
-	{0x8c89, 1928},
-	{0x8c8a, 7506},
-	{0x8c8c, 2743},
-	{0x8c8e, 0},
-	{0x8c8f, 1},
-	{0x8c90, 2},
-	{0x8c91, 3},
-	{0x8c92, 4},
-	{0x8c93, 5},
-	{0x8c94, 7509},
-	{0x8c96, 0},
-	{0x8c97, 1},
-	{0x8c98, 7508},
-	{0x8c9a, 0},
-	{0x8c9b, 1},
-	{0x8c9c, 2},
-	{0x8c9d, 7739},
-	{0x8c9e, 8831},
-	{0x8ca0, 7948},
-	{0x8ca1, 7769},
-	{0x8ca2, 7972},
-	{0x8ca4, 0},
-	{0x8ca5, 1},
-	{0x8ca6, 2},
-	{0x8ca7, 8378},
-	{0x8ca8, 8037},
-	{0x8ca9, 7920},
-	{0x8caa, 8548},
-	{0x8cab, 7984},
-	{0x8cac, 8801},
-	{0x8cae, 0},
-	{0x8caf, 8866},
-	{0x8cb0, 9387},
-	{0x8cb2, 9391},
-	{0x8cb3, 7912},
-	{0x8cb4, 7993},
-	{0x8cb6, 7752},
-	{0x8cb7, 8304},
-	{0x8cb8, 7848},
-	{0x8cba, 9388},
-	{0x8cbb, 7927},
-	{0x8cbc, 8566},
-	{0x8cbd, 9389},
-	{0x8cbf, 8315},
-	{0x8cc0, 8005},
-	{0x8cc1, 9386},
-	{0x8cc2, 8267},
-	{0x8cc3, 8239},
-	{0x8cc4, 8026},
-	{0x8cc5, 9392},
-	{0x8cc7, 8887},
-	{0x8cc8, 8063},
-	{0x8cca, 8805},
-	{0x8ccc, 0},
-	{0x8ccd, 1},
-	{0x8cce, 2},
-	{0x8ccf, 3},
-	{0x8cd0, 4},
-	{0x8cd1, 9394},
-	{0x8cd2, 8475},
-	{0x8cd3, 7761},
-	{0x8cd5, 9396},
-	{0x8cd7, 0},
-	{0x8cd8, 1},
-	{0x8cd9, 2},
-	{0x8cda, 9395},
-	{0x8cdc, 7839},
-	{0x8cde, 8472},
-	{0x8ce0, 8372},
-	{0x8ce1, 9135},
-	{0x8ce2, 8635},
-	{0x8ce3, 8306},
-	{0x8ce4, 8085},
-	{0x8ce6, 7946},
-	{0x8ce7, 9398},
-	{0x8ce9, 0},
-	{0x8cea, 8849},
-	{0x8ceb, 9397},
-	{0x8cec, 8824},
-	{0x8ced, 7892},
-	{0x8cef, 0},
-	{0x8cf0, 1},
-	{0x8cf1, 2},
-	{0x8cf2, 3},
-	{0x8cf3, 4},
-	{0x8cf4, 8179},
-	{0x8cf6, 0},
-	{0x8cf7, 1},
-	{0x8cf8, 2},
-	{0x8cf9, 3},
-	{0x8cfa, 8873},
-	{0x8cfb, 9399},
-	{0x8cfc, 7976},
-	{0x8cfd, 8457},
-	{0x8cfe, 8903},
-	{0x8d01, 0},
-	{0x8d02, 1},
-	{0x8d03, 2},
-	{0x8d04, 9390},
-	{0x8d05, 8881},
-	{0x8d07, 0},
-	{0x8d08, 8806},
-	{0x8d0a, 8795},
-	{0x8d0b, 8900},
-	{0x8d0d, 8469},
-	{0x8d0f, 8746},
-	{0x8d10, 9393},
-	{0x8d12, 0},
-	{0x8d13, 1},
-	{0x8d14, 2},
-	{0x8d15, 3},
-	{0x8d16, 8509},
-	{0x8d18, 0},
-	{0x8d19, 1},
-	{0x8d1a, 2},
-	{0x8d1b, 7957},
-	{0x8d1c, 8796},
-	{0x8d1d, 1053},
-	{0x8d1e, 4491},
-	{0x8d1f, 1717},
-	{0x8d21, 1802},
-	{0x8d22, 1165},
-	{0x8d23, 4403},
-	{0x8d24, 3898},
-	{0x8d25, 999},
-	{0x8d26, 4460},
-	{0x8d27, 2058},
-	{0x8d28, 4553},
-	{0x8d29, 1620},
-	{0x8d2a, 3587},
-	{0x8d2b, 3029},
-	{0x8d2c, 1098},
-	{0x8d2d, 1811},
-	{0x8d2e, 4603},
-	{0x8d2f, 1850},
-	{0x8d30, 1598},
-	{0x8d31, 2157},
-	{0x8d32, 6444},
-	{0x8d33, 6445},
-	{0x8d34, 3660},
-	{0x8d35, 1868},
-	{0x8d36, 6446},
-	{0x8d37, 1406},
-	{0x8d38, 2744},
-	{0x8d39, 1646},
-	{0x8d3a, 1935},
-	{0x8d3b, 6447},
-	{0x8d3c, 4407},
-	{0x8d3d, 6448},
-	{0x8d3e, 2121},
-	{0x8d3f, 2036},
-	{0x8d40, 6449},
-	{0x8d41, 2599},
-	{0x8d42, 2655},
-	{0x8d43, 4386},
-	{0x8d44, 4647},
-	{0x8d45, 6450},
-	{0x8d46, 6451},
-	{0x8d47, 6454},
-	{0x8d48, 6452},
-	{0x8d49, 6453},
-	{0x8d4a, 3351},
-	{0x8d4b, 1710},
-	{0x8d4c, 1539},
-	{0x8d4d, 6455},
-	{0x8d4e, 3457},
-	{0x8d4f, 3334},
-	{0x8d50, 1360},
-	{0x8d52, 0},
-	{0x8d53, 5691},
-	{0x8d54, 2979},
-	{0x8d55, 6456},
-	{0x8d56, 2464},
-	{0x8d58, 4629},
-	{0x8d59, 6457},
-	{0x8d5a, 4617},
-	{0x8d5b, 3287},
-	{0x8d5c, 4745},
-	{0x8d5d, 4739},
-	{0x8d5e, 4385},
-	{0x8d60, 4412},
-	{0x8d61, 3325},
-	{0x8d62, 4243},
-	{0x8d63, 1742},
-	{0x8d64, 1285},
-	{0x8d66, 3355},
-	{0x8d67, 7412},
-	{0x8d69, 0},
-	{0x8d6a, 1},
-	{0x8d6b, 1932},
-	{0x8d6d, 7413},
-	{0x8d6f, 0},
-	{0x8d70, 4668},
-	{0x8d72, 0},
-	{0x8d73, 7407},
-	{0x8d74, 1707},
-	{0x8d75, 4469},
-	{0x8d76, 1738},
-	{0x8d77, 3087},
-	{0x8d79, 0},
-	{0x8d7a, 1},
-	{0x8d7b, 2},
-	{0x8d7c, 3},
-	{0x8d7d, 4},
-	{0x8d7e, 5},
-	{0x8d7f, 6},
-	{0x8d80, 7},
-	{0x8d81, 1256},
-	{0x8d83, 0},
-	{0x8d84, 7408},
-	{0x8d85, 1233},
-	{0x8d87, 0},
-	{0x8d88, 1},
-	{0x8d89, 2},
-	{0x8d8a, 4352},
-	{0x8d8b, 3188},
-	{0x8d8d, 0},
-	{0x8d8e, 1},
-	{0x8d8f, 2},
-	{0x8d90, 3},
-	{0x8d91, 7410},
-	{0x8d93, 0},
-	{0x8d94, 7409},
-	{0x8d95, 7956},
-	{0x8d97, 0},
-	{0x8d98, 1},
-	{0x8d99, 8826},
-	{0x8d9b, 0},
-	{0x8d9c, 1},
-	{0x8d9d, 2},
-	{0x8d9e, 3},
-	{0x8d9f, 3614},
-	{0x8da1, 0},
-	{0x8da2, 1},
-	{0x8da3, 3199},
-	{0x8da5, 0},
-	{0x8da6, 1},
-	{0x8da7, 2},
-	{0x8da8, 8430},
-	{0x8daa, 0},
-	{0x8dab, 1},
-	{0x8dac, 2},
-	{0x8dad, 3},
-	{0x8dae, 4},
-	{0x8daf, 5},
-	{0x8db0, 6},
-	{0x8db1, 7411},
-	{0x8db2, 9720},
-	{0x8db3, 4672},
-	{0x8db4, 2944},
-	{0x8db5, 7452},
-	{0x8db7, 0},
-	{0x8db8, 7447},
-	{0x8dba, 7455},
-	{0x8dbc, 7454},
-	{0x8dbe, 4537},
-	{0x8dbf, 7453},
-	{0x8dc1, 0},
-	{0x8dc2, 1},
-	{0x8dc3, 4353},
-	{0x8dc4, 7456},
-	{0x8dc6, 7464},
-	{0x8dc8, 0},
-	{0x8dc9, 1},
-	{0x8dca, 2},
-	{0x8dcb, 986},
-	{0x8dcc, 1497},
-	{0x8dce, 7461},
-	{0x8dcf, 7462},
-	{0x8dd1, 2973},
-	{0x8dd3, 0},
-	{0x8dd4, 1},
-	{0x8dd5, 2},
-	{0x8dd6, 7457},
-	{0x8dd7, 7458},
-	{0x8dd9, 0},
-	{0x8dda, 7459},
-	{0x8ddb, 7463},
-	{0x8ddd, 2319},
-	{0x8dde, 7460},
-	{0x8ddf, 1781},
-	{0x8de1, 0},
-	{0x8de2, 1},
-	{0x8de3, 7468},
-	{0x8de4, 7471},
-	{0x8de6, 0},
-	{0x8de7, 1},
-	{0x8de8, 2420},
-	{0x8dea, 1867},
-	{0x8deb, 7448},
-	{0x8dec, 7465},
-	{0x8dee, 0},
-	{0x8def, 2654},
-	{0x8df1, 0},
-	{0x8df2, 1},
-	{0x8df3, 3659},
-	{0x8df5, 2156},
-	{0x8df7, 7466},
-	{0x8df8, 7467},
-	{0x8df9, 7469},
-	{0x8dfa, 1572},
-	{0x8dfb, 7470},
-	{0x8dfd, 7473},
-	{0x8dff, 0},
-	{0x8e01, 0},
-	{0x8e02, 1},
-	{0x8e03, 2},
-	{0x8e04, 3},
-	{0x8e05, 7449},
-	{0x8e07, 0},
-	{0x8e08, 1},
-	{0x8e09, 7472},
-	{0x8e0a, 4256},
-	{0x8e0c, 1297},
-	{0x8e0e, 0},
-	{0x8e0f, 3575},
-	{0x8e10, 8084},
-	{0x8e12, 0},
-	{0x8e13, 1},
-	{0x8e14, 7474},
-	{0x8e16, 0},
-	{0x8e17, 1},
-	{0x8e18, 2},
-	{0x8e19, 3},
-	{0x8e1a, 4},
-	{0x8e1b, 5},
-	{0x8e1c, 6},
-	{0x8e1d, 7475},
-	{0x8e1e, 2320},
-	{0x8e1f, 7476},
-	{0x8e21, 0},
-	{0x8e22, 3634},
-	{0x8e23, 7479},
-	{0x8e25, 0},
-	{0x8e26, 1},
-	{0x8e27, 2},
-	{0x8e28, 3},
-	{0x8e29, 1167},
-	{0x8e2a, 4662},
-	{0x8e2c, 7477},
-	{0x8e2e, 7478},
-	{0x8e2f, 7480},
-	{0x8e31, 7486},
-	{0x8e33, 0},
-	{0x8e34, 8752},
-	{0x8e35, 7484},
-	{0x8e37, 0},
-	{0x8e38, 1},
-	{0x8e39, 7483},
-	{0x8e3a, 7481},
-	{0x8e3c, 0},
-	{0x8e3d, 7485},
-	{0x8e3f, 0},
-	{0x8e40, 7482},
-	{0x8e41, 7488},
-	{0x8e42, 7489},
-	{0x8e44, 3638},
-	{0x8e46, 0},
-	{0x8e47, 5947},
-	{0x8e48, 1433},
-	{0x8e49, 7487},
-	{0x8e4a, 7492},
-	{0x8e4b, 3574},
-	{0x8e4c, 9725},
-	{0x8e4e, 0},
-	{0x8e4f, 1},
-	{0x8e50, 2},
-	{0x8e51, 7490},
-	{0x8e52, 7491},
-	{0x8e54, 0},
-	{0x8e55, 9728},
-	{0x8e57, 0},
-	{0x8e58, 1},
-	{0x8e59, 7450},
-	{0x8e5b, 0},
-	{0x8e5c, 1},
-	{0x8e5d, 2},
-	{0x8e5e, 3},
-	{0x8e5f, 4},
-	{0x8e60, 5},
-	{0x8e61, 6},
-	{0x8e62, 7},
-	{0x8e63, 9734},
-	{0x8e65, 0},
-	{0x8e66, 1069},
-	{0x8e68, 0},
-	{0x8e69, 7451},
-	{0x8e6b, 0},
-	{0x8e6c, 1446},
-	{0x8e6d, 1195},
-	{0x8e6f, 7496},
-	{0x8e70, 7493},
-	{0x8e72, 1558},
-	{0x8e74, 7497},
-	{0x8e76, 7494},
-	{0x8e78, 0},
-	{0x8e79, 1},
-	{0x8e7a, 9727},
-	{0x8e7c, 7495},
-	{0x8e7e, 0},
-	{0x8e7f, 1373},
-	{0x8e81, 4397},
-	{0x8e83, 0},
-	{0x8e84, 1},
-	{0x8e85, 7498},
-	{0x8e87, 1310},
-	{0x8e89, 9724},
-	{0x8e8a, 7820},
-	{0x8e8b, 9730},
-	{0x8e8d, 8781},
-	{0x8e8f, 7499},
-	{0x8e90, 7501},
-	{0x8e91, 9732},
-	{0x8e92, 9726},
-	{0x8e93, 9731},
-	{0x8e94, 7500},
-	{0x8e96, 0},
-	{0x8e97, 1},
-	{0x8e98, 2},
-	{0x8e99, 3},
-	{0x8e9a, 9729},
-	{0x8e9c, 7502},
-	{0x8e9e, 7503},
-	{0x8ea0, 0},
-	{0x8ea1, 9733},
-	{0x8ea3, 0},
-	{0x8ea4, 1},
-	{0x8ea5, 7843},
-	{0x8ea6, 9736},
-	{0x8ea8, 0},
-	{0x8ea9, 1},
-	{0x8eaa, 9735},
-	{0x8eab, 3366},
-	{0x8eac, 1795},
-	{0x8eae, 0},
-	{0x8eaf, 3192},
-	{0x8eb1, 0},
-	{0x8eb2, 1570},
-	{0x8eb4, 0},
-	{0x8eb5, 1},
-	{0x8eb6, 2},
-	{0x8eb7, 3},
-	{0x8eb8, 4},
-	{0x8eb9, 5},
-	{0x8eba, 3612},
-	{0x8ebc, 0},
-	{0x8ebd, 1},
-	{0x8ebe, 2},
-	{0x8ebf, 3},
-	{0x8ec0, 8432},
-	{0x8ec2, 0},
-	{0x8ec3, 1},
-	{0x8ec4, 2},
-	{0x8ec5, 3},
-	{0x8ec6, 4},
-	{0x8ec7, 5},
-	{0x8ec8, 6},
-	{0x8ec9, 7},
-	{0x8eca, 7803},
-	{0x8ecb, 8807},
-	{0x8ecc, 7990},
-	{0x8ecd, 8150},
-	{0x8ece, 6392},
-	{0x8ed0, 0},
-	{0x8ed1, 1},
-	{0x8ed2, 8672},
-	{0x8ed4, 9356},
-	{0x8ed6, 0},
-	{0x8ed7, 1},
-	{0x8ed8, 2},
-	{0x8ed9, 3},
-	{0x8eda, 4},
-	{0x8edb, 9357},
-	{0x8edd, 0},
-	{0x8ede, 1},
-	{0x8edf, 8450},
-	{0x8ee1, 0},
-	{0x8ee2, 1},
-	{0x8ee3, 2},
-	{0x8ee4, 9364},
-	{0x8ee6, 0},
-	{0x8ee7, 1},
-	{0x8ee8, 2},
-	{0x8ee9, 3},
-	{0x8eea, 4},
-	{0x8eeb, 9363},
-	{0x8eed, 0},
-	{0x8eee, 1},
-	{0x8eef, 2},
-	{0x8ef0, 3},
-	{0x8ef1, 4},
-	{0x8ef2, 9358},
-	{0x8ef4, 0},
-	{0x8ef5, 1},
-	{0x8ef6, 2},
-	{0x8ef7, 3},
-	{0x8ef8, 8857},
-	{0x8ef9, 9361},
-	{0x8efa, 9366},
-	{0x8efb, 9359},
-	{0x8efc, 9362},
-	{0x8efe, 9367},
-	{0x8f01, 0},
-	{0x8f02, 1},
-	{0x8f03, 8113},
-	{0x8f05, 9370},
-	{0x8f07, 9369},
-	{0x8f09, 8792},
-	{0x8f0a, 9368},
-	{0x8f0c, 0},
-	{0x8f0d, 1},
-	{0x8f0e, 2},
-	{0x8f0f, 3},
-	{0x8f10, 4},
-	{0x8f11, 5},
-	{0x8f12, 9371},
-	{0x8f14, 7945},
-	{0x8f15, 8422},
-	{0x8f17, 0},
-	{0x8f18, 1},
-	{0x8f19, 2},
-	{0x8f1a, 3},
-	{0x8f1b, 8230},
-	{0x8f1c, 9375},
-	{0x8f1d, 8025},
-	{0x8f1e, 9373},
-	{0x8f1f, 9374},
-	{0x8f21, 0},
-	{0x8f22, 1},
-	{0x8f23, 2},
-	{0x8f24, 3},
-	{0x8f25, 7995},
-	{0x8f26, 9372},
-	{0x8f28, 0},
-	{0x8f29, 7738},
-	{0x8f2a, 8283},
-	{0x8f2c, 0},
-	{0x8f2d, 1},
-	{0x8f2e, 2},
-	{0x8f2f, 8048},
-	{0x8f31, 0},
-	{0x8f32, 1},
-	{0x8f33, 9376},
-	{0x8f35, 0},
-	{0x8f36, 1},
-	{0x8f37, 2},
-	{0x8f38, 8507},
-	{0x8f3a, 0},
-	{0x8f3b, 7943},
-	{0x8f3d, 0},
-	{0x8f3e, 8816},
-	{0x8f3f, 8759},
-	{0x8f41, 0},
-	{0x8f42, 9426},
-	{0x8f44, 8627},
-	{0x8f45, 8773},
-	{0x8f46, 9377},
-	{0x8f48, 0},
-	{0x8f49, 8872},
-	{0x8f4b, 0},
-	{0x8f4c, 1},
-	{0x8f4d, 8828},
-	{0x8f4e, 8112},
-	{0x8f50, 0},
-	{0x8f51, 1},
-	{0x8f52, 2},
-	{0x8f53, 3},
-	{0x8f54, 9378},
-	{0x8f56, 0},
-	{0x8f57, 1},
-	{0x8f58, 2},
-	{0x8f59, 3},
-	{0x8f5a, 4},
-	{0x8f5b, 5},
-	{0x8f5c, 6},
-	{0x8f5d, 7},
-	{0x8f5e, 8},
-	{0x8f5f, 8006},
-	{0x8f61, 9088},
-	{0x8f62, 9365},
-	{0x8f64, 9360},
-	{0x8f66, 1242},
-	{0x8f67, 4417},
-	{0x8f68, 1861},
-	{0x8f69, 4036},
-	{0x8f6b, 6369},
-	{0x8f6c, 4615},
-	{0x8f6d, 6370},
-	{0x8f6e, 2685},
-	{0x8f6f, 3272},
-	{0x8f70, 1947},
-	{0x8f71, 6371},
-	{0x8f72, 6372},
-	{0x8f73, 6373},
-	{0x8f74, 4576},
-	{0x8f75, 6374},
-	{0x8f76, 6375},
-	{0x8f77, 6377},
-	{0x8f78, 6376},
-	{0x8f79, 6378},
-	{0x8f7a, 6379},
-	{0x8f7b, 3166},
-	{0x8f7c, 6380},
-	{0x8f7d, 4379},
-	{0x8f7e, 6381},
-	{0x8f7f, 2207},
-	{0x8f81, 6382},
-	{0x8f82, 6383},
-	{0x8f83, 2208},
-	{0x8f84, 6384},
-	{0x8f85, 1699},
-	{0x8f86, 2567},
-	{0x8f87, 6385},
-	{0x8f88, 1051},
-	{0x8f89, 2025},
-	{0x8f8a, 1870},
-	{0x8f8b, 6386},
-	{0x8f8d, 6387},
-	{0x8f8e, 6388},
-	{0x8f8f, 6389},
-	{0x8f90, 1685},
-	{0x8f91, 2080},
-	{0x8f93, 3451},
-	{0x8f94, 5492},
-	{0x8f95, 4338},
-	{0x8f96, 3882},
-	{0x8f97, 4440},
-	{0x8f98, 6390},
-	{0x8f99, 4479},
-	{0x8f9a, 6391},
-	{0x8f9b, 3980},
-	{0x8f9c, 1813},
-	{0x8f9e, 1354},
-	{0x8f9f, 1090},
-	{0x8fa1, 0},
-	{0x8fa2, 1},
-	{0x8fa3, 2460},
-	{0x8fa5, 0},
-	{0x8fa6, 7728},
-	{0x8fa8, 1103},
-	{0x8fa9, 1104},
-	{0x8fab, 1105},
-	{0x8fad, 7837},
-	{0x8fae, 7755},
-	{0x8faf, 7754},
-	{0x8fb0, 1250},
-	{0x8fb1, 3267},
-	{0x8fb2, 8362},
-	{0x8fb4, 0},
-	{0x8fb5, 1},
-	{0x8fb6, 5949},
-	{0x8fb8, 0},
-	{0x8fb9, 1096},
-	{0x8fbb, 0},
-	{0x8fbc, 1},
-	{0x8fbd, 2578},
-	{0x8fbe, 1394},
-	{0x8fc0, 0},
-	{0x8fc1, 3109},
-	{0x8fc2, 4285},
-	{0x8fc4, 3096},
-	{0x8fc5, 4065},
-	{0x8fc7, 1878},
-	{0x8fc8, 2716},
-	{0x8fca, 0},
-	{0x8fcb, 1},
-	{0x8fcc, 2},
-	{0x8fcd, 3},
-	{0x8fce, 4242},
-	{0x8fd0, 4366},
-	{0x8fd1, 2253},
-	{0x8fd3, 5950},
-	{0x8fd4, 1618},
-	{0x8fd5, 5951},
-	{0x8fd7, 0},
-	{0x8fd8, 1998},
-	{0x8fd9, 4483},
-	{0x8fdb, 2249},
-	{0x8fdc, 4345},
-	{0x8fdd, 3764},
-	{0x8fde, 2549},
-	{0x8fdf, 1278},
-	{0x8fe1, 0},
-	{0x8fe2, 3657},
-	{0x8fe4, 5954},
-	{0x8fe5, 5952},
-	{0x8fe6, 5956},
-	{0x8fe8, 5958},
-	{0x8fe9, 5955},
-	{0x8fea, 1456},
-	{0x8feb, 3047},
-	{0x8fed, 1501},
-	{0x8fee, 5953},
-	{0x8ff0, 3469},
-	{0x8ff2, 0},
-	{0x8ff3, 5957},
-	{0x8ff4, 9851},
-	{0x8ff6, 0},
-	{0x8ff7, 2777},
-	{0x8ff8, 1070},
-	{0x8ff9, 2070},
-	{0x8ffb, 0},
-	{0x8ffc, 1},
-	{0x8ffd, 4628},
-	{0x8fff, 0},
-	{0x9000, 3708},
-	{0x9001, 3522},
-	{0x9002, 3425},
-	{0x9003, 3622},
-	{0x9004, 5960},
-	{0x9005, 5959},
-	{0x9006, 2889},
-	{0x9008, 0},
-	{0x9009, 4042},
-	{0x900a, 4064},
-	{0x900b, 5961},
-	{0x900d, 5964},
-	{0x900f, 3689},
-	{0x9010, 4591},
-	{0x9011, 5963},
-	{0x9012, 1470},
-	{0x9014, 3695},
-	{0x9015, 9202},
-	{0x9016, 5965},
-	{0x9017, 1529},
-	{0x9019, 8830},
-	{0x901a, 3673},
-	{0x901b, 1853},
-	{0x901d, 3420},
-	{0x901e, 1270},
-	{0x901f, 3534},
-	{0x9020, 4399},
-	{0x9021, 5966},
-	{0x9022, 1671},
-	{0x9023, 8217},
-	{0x9025, 0},
-	{0x9026, 5962},
-	{0x9028, 0},
-	{0x9029, 1},
-	{0x902a, 2},
-	{0x902b, 3},
-	{0x902c, 4},
-	{0x902d, 5969},
-	{0x902e, 1409},
-	{0x902f, 5970},
-	{0x9031, 0},
-	{0x9032, 8123},
-	{0x9034, 0},
-	{0x9035, 5967},
-	{0x9036, 5968},
-	{0x9038, 4196},
-	{0x903a, 0},
-	{0x903b, 2694},
-	{0x903c, 1071},
-	{0x903e, 4295},
-	{0x9040, 0},
-	{0x9041, 1564},
-	{0x9042, 3553},
-	{0x9044, 5971},
-	{0x9046, 0},
-	{0x9047, 4315},
-	{0x9049, 0},
-	{0x904a, 1},
-	{0x904b, 8787},
-	{0x904d, 1106},
-	{0x904e, 7998},
-	{0x904f, 1587},
-	{0x9050, 5974},
-	{0x9051, 5972},
-	{0x9052, 5973},
-	{0x9053, 1441},
-	{0x9054, 7846},
-	{0x9055, 8590},
-	{0x9057, 4172},
-	{0x9058, 5976},
-	{0x905a, 0},
-	{0x905b, 5978},
-	{0x905c, 8684},
-	{0x905e, 7870},
-	{0x9060, 8778},
-	{0x9062, 5977},
-	{0x9063, 3119},
-	{0x9065, 4138},
-	{0x9067, 0},
-	{0x9068, 5975},
-	{0x9069, 8499},
-	{0x906b, 0},
-	{0x906c, 1},
-	{0x906d, 4389},
-	{0x906e, 4475},
-	{0x9070, 0},
-	{0x9071, 1},
-	{0x9072, 7812},
-	{0x9074, 5980},
-	{0x9075, 4686},
-	{0x9077, 8399},
-	{0x9078, 8674},
-	{0x907a, 8719},
-	{0x907c, 8233},
-	{0x907d, 5981},
-	{0x907f, 1093},
-	{0x9080, 4132},
-	{0x9081, 8307},
-	{0x9082, 5982},
-	{0x9083, 5984},
-	{0x9084, 8021},
-	{0x9086, 0},
-	{0x9087, 9201},
-	{0x9088, 5983},
-	{0x908a, 7750},
-	{0x908b, 5985},
-	{0x908d, 0},
-	{0x908e, 1},
-	{0x908f, 8291},
-	{0x9090, 9203},
-	{0x9091, 4191},
-	{0x9093, 1452},
-	{0x9095, 6167},
-	{0x9097, 4967},
-	{0x9099, 4970},
-	{0x909b, 4968},
-	{0x909d, 4969},
-	{0x909f, 0},
-	{0x90a0, 1},
-	{0x90a1, 4972},
-	{0x90a2, 3994},
-	{0x90a3, 2858},
-	{0x90a5, 0},
-	{0x90a6, 1017},
-	{0x90a8, 0},
-	{0x90a9, 1},
-	{0x90aa, 3963},
-	{0x90ac, 4971},
-	{0x90ae, 4271},
-	{0x90af, 1889},
-	{0x90b0, 4978},
-	{0x90b1, 3182},
-	{0x90b3, 4974},
-	{0x90b4, 4973},
-	{0x90b5, 3348},
-	{0x90b6, 4975},
-	{0x90b8, 4977},
-	{0x90b9, 4667},
-	{0x90ba, 4976},
-	{0x90bb, 2595},
-	{0x90bd, 0},
-	{0x90be, 4981},
-	{0x90c0, 0},
-	{0x90c1, 4313},
-	{0x90c3, 0},
-	{0x90c4, 4983},
-	{0x90c5, 4980},
-	{0x90c7, 4984},
-	{0x90c9, 0},
-	{0x90ca, 2189},
-	{0x90cc, 0},
-	{0x90cd, 1},
-	{0x90ce, 2484},
-	{0x90cf, 4979},
-	{0x90d0, 4982},
-	{0x90d1, 4514},
-	{0x90d3, 4985},
-	{0x90d5, 0},
-	{0x90d6, 1},
-	{0x90d7, 4989},
-	{0x90d9, 0},
-	{0x90da, 1},
-	{0x90db, 4990},
-	{0x90dc, 4988},
-	{0x90dd, 1913},
-	{0x90df, 8990},
-	{0x90e1, 2353},
-	{0x90e2, 4987},
-	{0x90e4, 0},
-	{0x90e5, 1},
-	{0x90e6, 4986},
-	{0x90e7, 4362},
-	{0x90e8, 1158},
-	{0x90ea, 0},
-	{0x90eb, 4991},
-	{0x90ed, 1874},
-	{0x90ef, 4992},
-	{0x90f1, 0},
-	{0x90f2, 1},
-	{0x90f3, 2},
-	{0x90f4, 1248},
-	{0x90f5, 8755},
-	{0x90f7, 0},
-	{0x90f8, 1415},
-	{0x90fa, 0},
-	{0x90fb, 1},
-	{0x90fc, 2},
-	{0x90fd, 1531},
-	{0x90fe, 4993},
-	{0x9101, 0},
-	{0x9102, 1588},
-	{0x9104, 4994},
-	{0x9106, 8992},
-	{0x9108, 0},
-	{0x9109, 8647},
-	{0x910b, 0},
-	{0x910c, 1},
-	{0x910d, 2},
-	{0x910e, 3},
-	{0x910f, 4},
-	{0x9110, 5},
-	{0x9111, 6},
-	{0x9112, 8892},
-	{0x9114, 8988},
-	{0x9116, 8785},
-	{0x9118, 0},
-	{0x9119, 1074},
-	{0x911b, 0},
-	{0x911c, 1},
-	{0x911d, 2},
-	{0x911e, 4996},
-	{0x9120, 0},
-	{0x9121, 1},
-	{0x9122, 4995},
-	{0x9123, 4997},
-	{0x9125, 0},
-	{0x9126, 1},
-	{0x9127, 7867},
-	{0x9129, 0},
-	{0x912a, 1},
-	{0x912b, 2},
-	{0x912c, 3},
-	{0x912d, 8839},
-	{0x912f, 4999},
-	{0x9130, 8237},
-	{0x9131, 4998},
-	{0x9132, 7851},
-	{0x9134, 8989},
-	{0x9136, 8991},
-	{0x9138, 0},
-	{0x9139, 5000},
-	{0x913a, 8987},
-	{0x913c, 0},
-	{0x913d, 1},
-	{0x913e, 2},
-	{0x913f, 3},
-	{0x9140, 4},
-	{0x9141, 5},
-	{0x9142, 6},
-	{0x9143, 5001},
-	{0x9145, 0},
-	{0x9146, 5002},
-	{0x9148, 8993},
-	{0x9149, 4276},
-	{0x914a, 7416},
-	{0x914b, 3186},
-	{0x914c, 4640},
-	{0x914d, 2981},
-	{0x914e, 7418},
-	{0x914f, 7419},
-	{0x9150, 7417},
-	{0x9152, 2293},
-	{0x9154, 0},
-	{0x9155, 1},
-	{0x9156, 2},
-	{0x9157, 4026},
-	{0x9159, 0},
-	{0x915a, 1648},
-	{0x915c, 0},
-	{0x915d, 4368},
-	{0x915e, 3581},
-	{0x9160, 0},
-	{0x9161, 7422},
-	{0x9162, 7421},
-	{0x9163, 1887},
-	{0x9164, 7420},
-	{0x9165, 3531},
-	{0x9167, 0},
-	{0x9168, 1},
-	{0x9169, 7424},
-	{0x916a, 2493},
-	{0x916c, 1295},
-	{0x916e, 3675},
-	{0x916f, 7425},
-	{0x9170, 7423},
-	{0x9171, 2181},
-	{0x9172, 7428},
-	{0x9174, 7429},
-	{0x9175, 2206},
-	{0x9176, 2749},
-	{0x9177, 2414},
-	{0x9178, 3542},
-	{0x9179, 7430},
-	{0x917b, 0},
-	{0x917c, 1},
-	{0x917d, 7426},
-	{0x917e, 7427},
-	{0x917f, 2899},
-	{0x9181, 0},
-	{0x9182, 1},
-	{0x9183, 2},
-	{0x9184, 3},
-	{0x9185, 7432},
-	{0x9187, 1343},
-	{0x9189, 4682},
-	{0x918b, 1370},
-	{0x918c, 7431},
-	{0x918d, 7434},
-	{0x918f, 0},
-	{0x9190, 7433},
-	{0x9191, 7435},
-	{0x9192, 3996},
-	{0x9194, 0},
-	{0x9195, 1},
-	{0x9196, 8789},
-	{0x9198, 0},
-	{0x9199, 1},
-	{0x919a, 2774},
-	{0x919b, 3204},
-	{0x919c, 7823},
-	{0x919e, 0},
-	{0x919f, 1},
-	{0x91a0, 2},
-	{0x91a1, 3},
-	{0x91a2, 7436},
-	{0x91a3, 7437},
-	{0x91a5, 0},
-	{0x91a6, 1},
-	{0x91a7, 2},
-	{0x91a8, 3},
-	{0x91a9, 4},
-	{0x91aa, 7438},
-	{0x91ab, 8716},
-	{0x91ac, 8100},
-	{0x91ad, 7439},
-	{0x91ae, 7440},
-	{0x91af, 7441},
-	{0x91b1, 0},
-	{0x91b2, 1},
-	{0x91b3, 2},
-	{0x91b4, 7443},
-	{0x91b5, 7442},
-	{0x91b7, 0},
-	{0x91b8, 1},
-	{0x91b9, 2},
-	{0x91ba, 7444},
-	{0x91bc, 0},
-	{0x91bd, 1},
-	{0x91be, 2},
-	{0x91bf, 3},
-	{0x91c0, 8347},
-	{0x91c1, 8664},
-	{0x91c3, 9722},
-	{0x91c5, 9721},
-	{0x91c7, 1168},
-	{0x91c9, 4281},
-	{0x91ca, 3428},
-	{0x91cb, 8500},
-	{0x91cc, 2522},
-	{0x91cd, 4567},
-	{0x91ce, 4151},
-	{0x91cf, 2568},
-	{0x91d1, 2241},
-	{0x91d2, 9459},
-	{0x91d3, 9460},
-	{0x91d4, 9461},
-	{0x91d5, 9464},
-	{0x91d7, 9463},
-	{0x91d8, 7880},
-	{0x91d9, 9462},
-	{0x91db, 0},
-	{0x91dc, 1701},
-	{0x91dd, 8832},
-	{0x91df, 0},
-	{0x91e0, 1},
-	{0x91e1, 2},
-	{0x91e2, 3},
-	{0x91e3, 7877},
-	{0x91e4, 9467},
-	{0x91e6, 0},
-	{0x91e7, 9466},
-	{0x91e9, 7917},
-	{0x91eb, 0},
-	{0x91ec, 1},
-	{0x91ed, 2},
-	{0x91ee, 3},
-	{0x91ef, 4},
-	{0x91f0, 5},
-	{0x91f1, 6},
-	{0x91f2, 7},
-	{0x91f3, 8},
-	{0x91f4, 9},
-	{0x91f5, 9469},
-	{0x91f7, 9465},
-	{0x91f9, 9470},
-	{0x91fa, 8397},
-	{0x91fc, 0},
-	{0x91fd, 1},
-	{0x91fe, 2},
-	{0x91ff, 3},
-	{0x9200, 9480},
-	{0x9201, 9476},
-	{0x9203, 0},
-	{0x9204, 9478},
-	{0x9206, 0},
-	{0x9207, 1},
-	{0x9208, 9471},
-	{0x9209, 8336},
-	{0x920b, 0},
-	{0x920c, 1},
-	{0x920d, 7901},
-	{0x920e, 7973},
-	{0x9210, 9475},
-	{0x9211, 9474},
-	{0x9213, 0},
-	{0x9214, 7802},
-	{0x9215, 8358},
-	{0x9217, 0},
-	{0x9218, 1},
-	{0x9219, 2},
-	{0x921a, 3},
-	{0x921b, 4},
-	{0x921c, 5},
-	{0x921d, 6},
-	{0x921e, 8149},
-	{0x9220, 0},
-	{0x9221, 1},
-	{0x9222, 2},
-	{0x9223, 7953},
-	{0x9225, 9479},
-	{0x9226, 9472},
-	{0x9227, 9477},
-	{0x9229, 0},
-	{0x922a, 1},
-	{0x922b, 2},
-	{0x922c, 3},
-	{0x922d, 4},
-	{0x922e, 9497},
-	{0x9230, 9493},
-	{0x9232, 0},
-	{0x9233, 9484},
-	{0x9234, 8241},
-	{0x9236, 0},
-	{0x9237, 9483},
-	{0x9238, 9487},
-	{0x9239, 9498},
-	{0x923a, 9481},
-	{0x923c, 0},
-	{0x923d, 9486},
-	{0x923e, 8756},
-	{0x923f, 9491},
-	{0x9240, 8064},
-	{0x9242, 0},
-	{0x9243, 1},
-	{0x9244, 2},
-	{0x9245, 9473},
-	{0x9247, 0},
-	{0x9248, 9495},
-	{0x9249, 9494},
-	{0x924b, 0},
-	{0x924c, 1},
-	{0x924d, 9496},
-	{0x924f, 0},
-	{0x9250, 1},
-	{0x9251, 7766},
-	{0x9253, 0},
-	{0x9254, 1},
-	{0x9255, 9485},
-	{0x9257, 8403},
-	{0x9259, 0},
-	{0x925a, 8314},
-	{0x925b, 8398},
-	{0x925d, 0},
-	{0x925e, 9488},
-	{0x9260, 0},
-	{0x9261, 1},
-	{0x9262, 7765},
-	{0x9264, 0},
-	{0x9265, 1},
-	{0x9266, 9482},
-	{0x9268, 0},
-	{0x9269, 1},
-	{0x926a, 2},
-	{0x926b, 3},
-	{0x926c, 9489},
-	{0x926d, 9490},
-	{0x926f, 0},
-	{0x9270, 1},
-	{0x9271, 2},
-	{0x9272, 3},
-	{0x9273, 4},
-	{0x9274, 2155},
-	{0x9276, 0},
-	{0x9277, 1},
-	{0x9278, 8106},
-	{0x927a, 9502},
-	{0x927b, 7967},
-	{0x927d, 0},
-	{0x927e, 1},
-	{0x927f, 9517},
-	{0x9280, 8733},
-	{0x9282, 0},
-	{0x9283, 9522},
-	{0x9285, 8571},
-	{0x9287, 0},
-	{0x9288, 1},
-	{0x9289, 2},
-	{0x928a, 3},
-	{0x928b, 4},
-	{0x928c, 5},
-	{0x928d, 6},
-	{0x928e, 7552},
-	{0x9290, 0},
-	{0x9291, 8623},
-	{0x9293, 9516},
-	{0x9295, 0},
-	{0x9296, 9512},
-	{0x9298, 8332},
-	{0x929a, 9519},
-	{0x929c, 8636},
-	{0x929e, 0},
-	{0x929f, 1},
-	{0x92a0, 9501},
-	{0x92a2, 0},
-	{0x92a3, 9525},
-	{0x92a5, 8717},
-	{0x92a6, 9510},
-	{0x92a8, 9524},
-	{0x92a9, 9514},
-	{0x92aa, 9503},
-	{0x92ab, 9521},
-	{0x92ac, 9500},
-	{0x92ae, 7553},
-	{0x92b0, 0},
-	{0x92b1, 9509},
-	{0x92b3, 0},
-	{0x92b4, 1},
-	{0x92b5, 2},
-	{0x92b6, 3},
-	{0x92b7, 8653},
-	{0x92b9, 8666},
-	{0x92bb, 8562},
-	{0x92bc, 9534},
-	{0x92be, 0},
-	{0x92bf, 1},
-	{0x92c0, 2},
-	{0x92c1, 8271},
-	{0x92c3, 9539},
-	{0x92c5, 8663},
-	{0x92c7, 7740},
-	{0x92c8, 7554},
-	{0x92ca, 0},
-	{0x92cb, 1},
-	{0x92cc, 9513},
-	{0x92ce, 0},
-	{0x92cf, 9505},
-	{0x92d1, 0},
-	{0x92d2, 7935},
-	{0x92d4, 0},
-	{0x92d5, 1},
-	{0x92d6, 2},
-	{0x92d7, 3},
-	{0x92d8, 4},
-	{0x92d9, 5},
-	{0x92da, 6},
-	{0x92db, 7},
-	{0x92dc, 8},
-	{0x92dd, 9535},
-	{0x92df, 9540},
-	{0x92e1, 0},
-	{0x92e2, 1},
-	{0x92e3, 9507},
-	{0x92e4, 7824},
-	{0x92e5, 9530},
-	{0x92e6, 9541},
-	{0x92e8, 9533},
-	{0x92ea, 8385},
-	{0x92ec, 0},
-	{0x92ed, 8451},
-	{0x92ee, 9504},
-	{0x92ef, 9532},
-	{0x92f0, 9531},
-	{0x92f1, 9528},
-	{0x92f3, 0},
-	{0x92f4, 1},
-	{0x92f5, 2},
-	{0x92f6, 9536},
-	{0x92f8, 8141},
-	{0x92fa, 0},
-	{0x92fb, 1},
-	{0x92fc, 7960},
-	{0x92fe, 0},
-	{0x92ff, 1},
-	{0x9301, 9547},
-	{0x9303, 0},
-	{0x9304, 1},
-	{0x9305, 2},
-	{0x9306, 9543},
-	{0x9307, 9551},
-	{0x9308, 9552},
-	{0x930a, 0},
-	{0x930b, 1},
-	{0x930c, 2},
-	{0x930d, 3},
-	{0x930e, 4},
-	{0x930f, 5},
-	{0x9310, 8880},
-	{0x9312, 9542},
-	{0x9314, 0},
-	{0x9315, 9548},
-	{0x9317, 0},
-	{0x9318, 7834},
-	{0x9319, 9554},
-	{0x931a, 9520},
-	{0x931b, 9545},
-	{0x931d, 0},
-	{0x931e, 1},
-	{0x931f, 9553},
-	{0x9320, 7882},
-	{0x9322, 8402},
-	{0x9324, 0},
-	{0x9325, 1},
-	{0x9326, 8120},
-	{0x9328, 8313},
-	{0x932a, 0},
-	{0x932b, 8619},
-	{0x932d, 0},
-	{0x932e, 9549},
-	{0x932f, 7845},
-	{0x9331, 0},
-	{0x9332, 8268},
-	{0x9333, 8320},
-	{0x9335, 0},
-	{0x9336, 9837},
-	{0x9338, 9527},
-	{0x933a, 0},
-	{0x933b, 1},
-	{0x933c, 2},
-	{0x933d, 3},
-	{0x933e, 7555},
-	{0x9340, 9546},
-	{0x9341, 8632},
-	{0x9343, 9550},
-	{0x9345, 0},
-	{0x9346, 9468},
-	{0x9347, 9556},
-	{0x9349, 0},
-	{0x934a, 1},
-	{0x934b, 7996},
-	{0x934d, 7893},
-	{0x934f, 0},
-	{0x9350, 1},
-	{0x9351, 2},
-	{0x9352, 3},
-	{0x9353, 4},
-	{0x9354, 9558},
-	{0x9356, 0},
-	{0x9357, 1},
-	{0x9358, 8808},
-	{0x935a, 0},
-	{0x935b, 7894},
-	{0x935d, 0},
-	{0x935e, 1},
-	{0x935f, 2},
-	{0x9360, 3},
-	{0x9361, 4},
-	{0x9362, 5},
-	{0x9363, 6},
-	{0x9364, 9559},
-	{0x9365, 9555},
-	{0x9367, 0},
-	{0x9368, 1},
-	{0x9369, 9544},
-	{0x936a, 7556},
-	{0x936c, 8412},
-	{0x936e, 0},
-	{0x936f, 1},
-	{0x9370, 9561},
-	{0x9372, 0},
-	{0x9373, 1},
-	{0x9374, 2},
-	{0x9375, 8087},
-	{0x9376, 9557},
-	{0x9378, 0},
-	{0x9379, 1},
-	{0x937a, 8829},
-	{0x937c, 0},
-	{0x937d, 1},
-	{0x937e, 9598},
-	{0x9380, 0},
-	{0x9381, 1},
-	{0x9382, 8316},
-	{0x9384, 9562},
-	{0x9386, 0},
-	{0x9387, 9566},
-	{0x9389, 0},
-	{0x938a, 7732},
-	{0x938c, 0},
-	{0x938d, 1},
-	{0x938e, 2},
-	{0x938f, 7558},
-	{0x9391, 0},
-	{0x9392, 1},
-	{0x9393, 2},
-	{0x9394, 3},
-	{0x9395, 4},
-	{0x9396, 8542},
-	{0x9398, 9568},
-	{0x939a, 0},
-	{0x939b, 1},
-	{0x939c, 2},
-	{0x939d, 3},
-	{0x939e, 4},
-	{0x939f, 5},
-	{0x93a0, 6},
-	{0x93a1, 7},
-	{0x93a2, 8610},
-	{0x93a3, 9044},
-	{0x93a5, 0},
-	{0x93a6, 9571},
-	{0x93a7, 9511},
-	{0x93a9, 9518},
-	{0x93aa, 9560},
-	{0x93ac, 7963},
-	{0x93ae, 8835},
-	{0x93b0, 9572},
-	{0x93b2, 0},
-	{0x93b3, 8352},
-	{0x93b5, 9573},
-	{0x93b7, 0},
-	{0x93b8, 9569},
-	{0x93ba, 0},
-	{0x93bb, 1},
-	{0x93bc, 2},
-	{0x93bd, 3},
-	{0x93be, 4},
-	{0x93bf, 9570},
-	{0x93c1, 0},
-	{0x93c2, 1},
-	{0x93c3, 9580},
-	{0x93c5, 0},
-	{0x93c6, 1},
-	{0x93c7, 9581},
-	{0x93c8, 8224},
-	{0x93ca, 7557},
-	{0x93cc, 9567},
-	{0x93cd, 9578},
-	{0x93cf, 0},
-	{0x93d0, 1},
-	{0x93d1, 9582},
-	{0x93d3, 0},
-	{0x93d4, 1},
-	{0x93d5, 2},
-	{0x93d6, 7681},
-	{0x93d7, 9529},
-	{0x93d8, 9564},
-	{0x93da, 0},
-	{0x93db, 1},
-	{0x93dc, 9576},
-	{0x93dd, 9577},
-	{0x93de, 9579},
-	{0x93df, 7791},
-	{0x93e1, 8132},
-	{0x93e2, 9575},
-	{0x93e4, 9563},
-	{0x93e6, 0},
-	{0x93e7, 1},
-	{0x93e8, 9757},
-	{0x93ea, 0},
-	{0x93eb, 1},
-	{0x93ec, 2},
-	{0x93ed, 3},
-	{0x93ee, 4},
-	{0x93ef, 5},
-	{0x93f0, 6},
-	{0x93f1, 7},
-	{0x93f2, 8},
-	{0x93f3, 9},
-	{0x93f4, 10},
-	{0x93f5, 9515},
-	{0x93f7, 9585},
-	{0x93f9, 9591},
-	{0x93fb, 0},
-	{0x93fc, 1},
-	{0x93fd, 2},
-	{0x93fe, 3},
-	{0x93ff, 4},
-	{0x9401, 0},
-	{0x9402, 1},
-	{0x9403, 9506},
-	{0x9405, 0},
-	{0x9406, 1},
-	{0x9407, 2},
-	{0x9408, 3},
-	{0x9409, 4},
-	{0x940a, 5},
-	{0x940b, 9523},
-	{0x940d, 0},
-	{0x940e, 1},
-	{0x940f, 2},
-	{0x9410, 8234},
-	{0x9412, 9526},
-	{0x9413, 9587},
-	{0x9414, 9583},
-	{0x9416, 0},
-	{0x9417, 1},
-	{0x9418, 8851},
-	{0x9419, 9592},
-	{0x941b, 0},
-	{0x941c, 1},
-	{0x941d, 9584},
-	{0x941f, 0},
-	{0x9420, 9589},
-	{0x9422, 0},
-	{0x9423, 1},
-	{0x9424, 2},
-	{0x9425, 3},
-	{0x9426, 9537},
-	{0x9427, 9538},
-	{0x9428, 9565},
-	{0x942a, 0},
-	{0x942b, 1},
-	{0x942c, 2},
-	{0x942d, 3},
-	{0x942e, 8218},
-	{0x9430, 0},
-	{0x9431, 1},
-	{0x9432, 9594},
-	{0x9433, 8198},
-	{0x9435, 8567},
-	{0x9437, 0},
-	{0x9438, 9499},
-	{0x943a, 9508},
-	{0x943c, 0},
-	{0x943d, 1},
-	{0x943e, 7559},
-	{0x943f, 9595},
-	{0x9441, 0},
-	{0x9442, 1},
-	{0x9443, 2},
-	{0x9444, 8867},
-	{0x9446, 0},
-	{0x9447, 1},
-	{0x9448, 2},
-	{0x9449, 3},
-	{0x944a, 9593},
-	{0x944c, 9574},
-	{0x944e, 0},
-	{0x944f, 1},
-	{0x9450, 2},
-	{0x9451, 3},
-	{0x9452, 8083},
-	{0x9454, 9596},
-	{0x9456, 0},
-	{0x9457, 1},
-	{0x9458, 2},
-	{0x9459, 3},
-	{0x945a, 4},
-	{0x945b, 5},
-	{0x945c, 6},
-	{0x945d, 7},
-	{0x945e, 8},
-	{0x945f, 9},
-	{0x9460, 9492},
-	{0x9462, 0},
-	{0x9463, 9597},
-	{0x9465, 9586},
-	{0x9467, 0},
-	{0x9468, 1},
-	{0x9469, 2},
-	{0x946a, 3},
-	{0x946b, 7560},
-	{0x946d, 9588},
-	{0x946f, 0},
-	{0x9470, 8782},
-	{0x9472, 8646},
-	{0x9474, 0},
-	{0x9475, 1},
-	{0x9476, 2},
-	{0x9477, 8351},
-	{0x9479, 9590},
-	{0x947b, 0},
-	{0x947c, 8292},
-	{0x947d, 8895},
-	{0x947e, 9756},
-	{0x947f, 8798},
-	{0x9481, 0},
-	{0x9482, 1},
-	{0x9483, 2},
-	{0x9484, 3},
-	{0x9485, 6798},
-	{0x9486, 6799},
-	{0x9487, 6800},
-	{0x9488, 4492},
-	{0x9489, 1507},
-	{0x948a, 6802},
-	{0x948b, 6801},
-	{0x948c, 6803},
-	{0x948d, 6804},
-	{0x948e, 3106},
-	{0x948f, 6805},
-	{0x9490, 6806},
-	{0x9492, 1613},
-	{0x9493, 1495},
-	{0x9494, 6807},
-	{0x9495, 6809},
-	{0x9497, 6808},
-	{0x9499, 1729},
-	{0x949a, 6810},
-	{0x949b, 6811},
-	{0x949c, 6812},
-	{0x949d, 1562},
-	{0x949e, 1235},
-	{0x949f, 4562},
-	{0x94a0, 2857},
-	{0x94a1, 1054},
-	{0x94a2, 1745},
-	{0x94a3, 6813},
-	{0x94a4, 6814},
-	{0x94a5, 4354},
-	{0x94a6, 3154},
-	{0x94a7, 2346},
-	{0x94a8, 3816},
-	{0x94a9, 1804},
-	{0x94aa, 6816},
-	{0x94ab, 6815},
-	{0x94ac, 6818},
-	{0x94ad, 6817},
-	{0x94ae, 2918},
-	{0x94af, 6819},
-	{0x94b0, 6820},
-	{0x94b1, 3115},
-	{0x94b2, 6821},
-	{0x94b3, 3116},
-	{0x94b4, 6822},
-	{0x94b5, 1134},
-	{0x94b6, 6823},
-	{0x94b7, 6824},
-	{0x94b8, 6825},
-	{0x94b9, 6826},
-	{0x94ba, 6827},
-	{0x94bb, 4679},
-	{0x94bc, 6828},
-	{0x94bd, 6829},
-	{0x94be, 2123},
-	{0x94bf, 6830},
-	{0x94c0, 4272},
-	{0x94c1, 3661},
-	{0x94c2, 1139},
-	{0x94c3, 2606},
-	{0x94c4, 6831},
-	{0x94c5, 3107},
-	{0x94c6, 2738},
-	{0x94c8, 6832},
-	{0x94c9, 6833},
-	{0x94ca, 6834},
-	{0x94cb, 6835},
-	{0x94cc, 6836},
-	{0x94cd, 6837},
-	{0x94ce, 6838},
-	{0x94d0, 6839},
-	{0x94d1, 6840},
-	{0x94d2, 6841},
-	{0x94d4, 0},
-	{0x94d5, 6842},
-	{0x94d6, 6843},
-	{0x94d7, 6844},
-	{0x94d8, 6846},
-	{0x94d9, 6845},
-	{0x94db, 6847},
-	{0x94dc, 3678},
-	{0x94dd, 2664},
-	{0x94de, 6848},
-	{0x94df, 6849},
-	{0x94e0, 6850},
-	{0x94e1, 4418},
-	{0x94e2, 6851},
-	{0x94e3, 3872},
-	{0x94e4, 6852},
-	{0x94e5, 6853},
-	{0x94e7, 6854},
-	{0x94e8, 6855},
-	{0x94e9, 6857},
-	{0x94ea, 6856},
-	{0x94eb, 6858},
-	{0x94ec, 1776},
-	{0x94ed, 2815},
-	{0x94ee, 6859},
-	{0x94ef, 6860},
-	{0x94f0, 2195},
-	{0x94f1, 4166},
-	{0x94f2, 1216},
-	{0x94f3, 6861},
-	{0x94f4, 6862},
-	{0x94f5, 6863},
-	{0x94f6, 4223},
-	{0x94f7, 6864},
-	{0x94f8, 4604},
-	{0x94f9, 6865},
-	{0x94fa, 3051},
-	{0x94fc, 6866},
-	{0x94fd, 6867},
-	{0x94fe, 2557},
-	{0x94ff, 6868},
-	{0x9500, 3943},
-	{0x9501, 3565},
-	{0x9502, 6870},
-	{0x9503, 6869},
-	{0x9504, 1311},
-	{0x9505, 1873},
-	{0x9506, 6871},
-	{0x9507, 6872},
-	{0x9508, 4013},
-	{0x9509, 6873},
-	{0x950a, 6874},
-	{0x950b, 1667},
-	{0x950c, 3978},
-	{0x950d, 6875},
-	{0x950e, 6876},
-	{0x950f, 6877},
-	{0x9510, 3276},
-	{0x9511, 3635},
-	{0x9512, 6878},
-	{0x9513, 6879},
-	{0x9514, 6880},
-	{0x9515, 6881},
-	{0x9516, 6882},
-	{0x9517, 4481},
-	{0x9518, 6883},
-	{0x9519, 1392},
-	{0x951a, 2735},
-	{0x951b, 6884},
-	{0x951d, 6885},
-	{0x951e, 6886},
-	{0x951f, 6887},
-	{0x9521, 3852},
-	{0x9522, 6888},
-	{0x9523, 2695},
-	{0x9524, 1339},
-	{0x9525, 4627},
-	{0x9526, 2246},
-	{0x9528, 3892},
-	{0x9529, 6891},
-	{0x952a, 6889},
-	{0x952b, 6890},
-	{0x952c, 6892},
-	{0x952d, 1510},
-	{0x952e, 2159},
-	{0x952f, 2321},
-	{0x9530, 2769},
-	{0x9531, 6893},
-	{0x9532, 6894},
-	{0x9534, 6895},
-	{0x9535, 6903},
-	{0x9536, 6896},
-	{0x9537, 6897},
-	{0x9538, 6898},
-	{0x9539, 3135},
-	{0x953a, 6937},
-	{0x953b, 1548},
-	{0x953c, 6899},
-	{0x953e, 6900},
-	{0x953f, 6901},
-	{0x9540, 1541},
-	{0x9541, 2755},
-	{0x9542, 6902},
-	{0x9544, 6904},
-	{0x9545, 6905},
-	{0x9546, 6906},
-	{0x9547, 4499},
-	{0x9549, 6907},
-	{0x954a, 2906},
-	{0x954c, 6908},
-	{0x954d, 2907},
-	{0x954e, 6909},
-	{0x954f, 6910},
-	{0x9550, 1759},
-	{0x9551, 1026},
-	{0x9552, 6911},
-	{0x9553, 6912},
-	{0x9554, 6913},
-	{0x9556, 6914},
-	{0x9557, 6915},
-	{0x9558, 6916},
-	{0x9559, 6917},
-	{0x955b, 6918},
-	{0x955c, 2276},
-	{0x955d, 6921},
-	{0x955e, 6919},
-	{0x955f, 6920},
-	{0x9561, 6922},
-	{0x9562, 6923},
-	{0x9563, 2582},
-	{0x9564, 6924},
-	{0x9565, 6925},
-	{0x9566, 6926},
-	{0x9567, 6927},
-	{0x9568, 6928},
-	{0x9569, 6929},
-	{0x956a, 6930},
-	{0x956b, 6931},
-	{0x956c, 6932},
-	{0x956d, 2499},
-	{0x956f, 6933},
-	{0x9570, 2550},
-	{0x9571, 6934},
-	{0x9572, 6935},
-	{0x9573, 6936},
-	{0x9575, 0},
-	{0x9576, 3919},
-	{0x9577, 7797},
-	{0x9579, 0},
-	{0x957a, 1},
-	{0x957b, 2},
-	{0x957c, 3},
-	{0x957d, 4},
-	{0x957e, 5},
-	{0x957f, 1225},
-	{0x9580, 8317},
-	{0x9582, 9151},
-	{0x9583, 8467},
-	{0x9585, 0},
-	{0x9586, 9152},
-	{0x9588, 0},
-	{0x9589, 7749},
-	{0x958b, 8152},
-	{0x958c, 9156},
-	{0x958e, 9154},
-	{0x958f, 8452},
-	{0x9591, 8637},
-	{0x9593, 8071},
-	{0x9594, 9155},
-	{0x9596, 0},
-	{0x9597, 1},
-	{0x9598, 8809},
-	{0x959a, 0},
-	{0x959b, 1},
-	{0x959c, 2},
-	{0x959d, 3},
-	{0x959e, 4},
-	{0x959f, 5},
-	{0x95a0, 6},
-	{0x95a1, 8003},
-	{0x95a3, 7966},
-	{0x95a4, 9849},
-	{0x95a5, 7915},
-	{0x95a7, 0},
-	{0x95a8, 7989},
-	{0x95a9, 8330},
-	{0x95ab, 9159},
-	{0x95ac, 9161},
-	{0x95ad, 9158},
-	{0x95af, 0},
-	{0x95b0, 1},
-	{0x95b1, 2},
-	{0x95b2, 8783},
-	{0x95b4, 0},
-	{0x95b5, 1},
-	{0x95b6, 9163},
-	{0x95b8, 0},
-	{0x95b9, 8691},
-	{0x95bb, 8695},
-	{0x95bc, 9167},
-	{0x95bd, 9166},
-	{0x95be, 9162},
-	{0x95bf, 9165},
-	{0x95c1, 0},
-	{0x95c2, 1},
-	{0x95c3, 9168},
-	{0x95c5, 0},
-	{0x95c6, 9836},
-	{0x95c8, 9153},
-	{0x95ca, 8174},
-	{0x95cb, 9169},
-	{0x95cc, 8184},
-	{0x95ce, 0},
-	{0x95cf, 1},
-	{0x95d0, 9171},
-	{0x95d2, 0},
-	{0x95d3, 1},
-	{0x95d4, 9170},
-	{0x95d5, 9172},
-	{0x95d6, 7832},
-	{0x95d8, 0},
-	{0x95d9, 1},
-	{0x95da, 2},
-	{0x95db, 3},
-	{0x95dc, 7980},
-	{0x95de, 9173},
-	{0x95e0, 0},
-	{0x95e1, 7793},
-	{0x95e2, 9873},
-	{0x95e4, 0},
-	{0x95e5, 9157},
-	{0x95e7, 0},
-	{0x95e8, 2762},
-	{0x95e9, 5765},
-	{0x95ea, 3322},
-	{0x95eb, 5766},
-	{0x95ed, 1086},
-	{0x95ee, 3801},
-	{0x95ef, 1334},
-	{0x95f0, 3277},
-	{0x95f1, 5767},
-	{0x95f2, 3901},
-	{0x95f3, 5768},
-	{0x95f4, 2135},
-	{0x95f5, 5769},
-	{0x95f6, 5770},
-	{0x95f7, 2763},
-	{0x95f8, 4419},
-	{0x95f9, 2873},
-	{0x95fa, 1860},
-	{0x95fb, 3796},
-	{0x95fc, 5771},
-	{0x95fd, 2811},
-	{0x95fe, 5772},
-	{0x9600, 1604},
-	{0x9601, 1774},
-	{0x9602, 1929},
-	{0x9603, 5773},
-	{0x9604, 5774},
-	{0x9605, 4359},
-	{0x9606, 5775},
-	{0x9608, 5776},
-	{0x9609, 4084},
-	{0x960a, 5777},
-	{0x960b, 5778},
-	{0x960c, 5779},
-	{0x960d, 5780},
-	{0x960e, 4095},
-	{0x960f, 5781},
-	{0x9610, 1218},
-	{0x9611, 2470},
-	{0x9612, 5782},
-	{0x9614, 2454},
-	{0x9615, 5783},
-	{0x9616, 5784},
-	{0x9617, 5785},
-	{0x9619, 5786},
-	{0x961a, 5787},
-	{0x961c, 1714},
-	{0x961d, 4948},
-	{0x961f, 1554},
-	{0x9621, 4950},
-	{0x9622, 4949},
-	{0x9624, 0},
-	{0x9625, 1},
-	{0x9626, 2},
-	{0x9627, 3},
-	{0x9628, 4},
-	{0x9629, 5},
-	{0x962a, 4952},
-	{0x962c, 0},
-	{0x962d, 1},
-	{0x962e, 3273},
-	{0x9630, 0},
-	{0x9631, 4951},
-	{0x9632, 1629},
-	{0x9633, 4125},
-	{0x9634, 4220},
-	{0x9635, 4500},
-	{0x9636, 2216},
-	{0x9638, 0},
-	{0x9639, 1},
-	{0x963a, 2},
-	{0x963b, 4677},
-	{0x963c, 4954},
-	{0x963d, 4953},
-	{0x963f, 941},
-	{0x9640, 3716},
-	{0x9642, 4955},
-	{0x9644, 1720},
-	{0x9645, 2109},
-	{0x9646, 2660},
-	{0x9647, 2635},
-	{0x9648, 1255},
-	{0x9649, 4956},
-	{0x964b, 2641},
-	{0x964c, 2835},
-	{0x964d, 2182},
-	{0x964f, 0},
-	{0x9650, 3915},
-	{0x9652, 0},
-	{0x9653, 1},
-	{0x9654, 4957},
-	{0x9655, 3323},
-	{0x9657, 0},
-	{0x9658, 8986},
-	{0x965a, 0},
-	{0x965b, 1094},
-	{0x965d, 8468},
-	{0x965f, 4958},
-	{0x9661, 1527},
-	{0x9662, 4349},
-	{0x9663, 8836},
-	{0x9664, 1314},
-	{0x9666, 0},
-	{0x9667, 4959},
-	{0x9668, 4364},
-	{0x9669, 3906},
-	{0x966a, 2980},
-	{0x966c, 4960},
-	{0x966e, 0},
-	{0x966f, 1},
-	{0x9670, 8732},
-	{0x9672, 4961},
-	{0x9673, 7806},
-	{0x9674, 4962},
-	{0x9675, 2611},
-	{0x9676, 3624},
-	{0x9677, 3914},
-	{0x9678, 8269},
-	{0x967a, 0},
-	{0x967b, 1},
-	{0x967c, 2},
-	{0x967d, 8705},
-	{0x967f, 0},
-	{0x9680, 1},
-	{0x9681, 2},
-	{0x9682, 3},
-	{0x9683, 4},
-	{0x9684, 5},
-	{0x9685, 4300},
-	{0x9686, 2632},
-	{0x9688, 4963},
-	{0x968a, 7897},
-	{0x968b, 3546},
-	{0x968d, 4964},
-	{0x968e, 8114},
-	{0x968f, 3547},
-	{0x9690, 4229},
-	{0x9692, 0},
-	{0x9693, 1},
-	{0x9694, 1775},
-	{0x9695, 8786},
-	{0x9697, 4965},
-	{0x9698, 954},
-	{0x9699, 3875},
-	{0x969b, 8057},
-	{0x969c, 4464},
-	{0x969e, 0},
-	{0x969f, 1},
-	{0x96a0, 2},
-	{0x96a1, 3},
-	{0x96a2, 4},
-	{0x96a3, 5},
-	{0x96a4, 6},
-	{0x96a5, 7},
-	{0x96a6, 8},
-	{0x96a7, 3554},
-	{0x96a8, 8535},
-	{0x96aa, 8639},
-	{0x96ac, 0},
-	{0x96ad, 1},
-	{0x96ae, 2},
-	{0x96af, 3},
-	{0x96b0, 4966},
-	{0x96b1, 8735},
-	{0x96b3, 5764},
-	{0x96b4, 8253},
-	{0x96b6, 2542},
-	{0x96b8, 8213},
-	{0x96b9, 7545},
-	{0x96bb, 9893},
-	{0x96bc, 7546},
-	{0x96bd, 7547},
-	{0x96be, 2868},
-	{0x96c0, 3219},
-	{0x96c1, 4108},
-	{0x96c3, 0},
-	{0x96c4, 4006},
-	{0x96c5, 4078},
-	{0x96c6, 2082},
-	{0x96c7, 1830},
-	{0x96c9, 6940},
-	{0x96cb, 0},
-	{0x96cc, 1353},
-	{0x96cd, 4255},
-	{0x96ce, 7548},
-	{0x96cf, 1312},
-	{0x96d1, 0},
-	{0x96d2, 7549},
-	{0x96d4, 0},
-	{0x96d5, 1490},
-	{0x96d6, 8534},
-	{0x96d8, 0},
-	{0x96d9, 8516},
-	{0x96db, 7825},
-	{0x96dc, 8791},
-	{0x96de, 0},
-	{0x96df, 1},
-	{0x96e0, 7551},
-	{0x96e2, 8202},
-	{0x96e3, 8338},
-	{0x96e5, 0},
-	{0x96e6, 1},
-	{0x96e7, 2},
-	{0x96e8, 4303},
-	{0x96e9, 7521},
-	{0x96ea, 4050},
-	{0x96ec, 0},
-	{0x96ed, 1},
-	{0x96ee, 2},
-	{0x96ef, 7523},
-	{0x96f1, 0},
-	{0x96f2, 8784},
-	{0x96f3, 7522},
-	{0x96f5, 0},
-	{0x96f6, 2604},
-	{0x96f7, 2498},
-	{0x96f9, 1035},
-	{0x96fb, 7875},
-	{0x96fd, 0},
-	{0x96fe, 3836},
-	{0x9700, 4019},
-	{0x9701, 7525},
-	{0x9703, 0},
-	{0x9704, 3939},
-	{0x9706, 7524},
-	{0x9707, 4497},
-	{0x9708, 7526},
-	{0x9709, 2750},
-	{0x970b, 0},
-	{0x970c, 1},
-	{0x970d, 2057},
-	{0x970e, 7528},
-	{0x970f, 7527},
-	{0x9711, 0},
-	{0x9712, 1},
-	{0x9713, 2881},
-	{0x9715, 0},
-	{0x9716, 2593},
-	{0x9718, 0},
-	{0x9719, 1},
-	{0x971a, 2},
-	{0x971b, 3},
-	{0x971c, 3487},
-	{0x971e, 3881},
-	{0x9720, 0},
-	{0x9721, 1},
-	{0x9722, 2},
-	{0x9723, 3},
-	{0x9724, 4},
-	{0x9725, 5},
-	{0x9726, 6},
-	{0x9727, 8616},
-	{0x9729, 0},
-	{0x972a, 7529},
-	{0x972c, 0},
-	{0x972d, 7530},
-	{0x972f, 0},
-	{0x9730, 7531},
-	{0x9732, 2653},
-	{0x9734, 0},
-	{0x9735, 1},
-	{0x9736, 2},
-	{0x9737, 3},
-	{0x9738, 991},
-	{0x9739, 3002},
-	{0x973b, 0},
-	{0x973c, 1},
-	{0x973d, 9741},
-	{0x973e, 7532},
-	{0x9740, 0},
-	{0x9741, 1},
-	{0x9742, 9740},
-	{0x9744, 9742},
-	{0x9746, 0},
-	{0x9747, 1},
-	{0x9748, 8242},
-	{0x974a, 0},
-	{0x974b, 1},
-	{0x974c, 2},
-	{0x974d, 3},
-	{0x974e, 4},
-	{0x974f, 5},
-	{0x9750, 6},
-	{0x9751, 7},
-	{0x9752, 3165},
-	{0x9753, 7520},
-	{0x9755, 0},
-	{0x9756, 2279},
-	{0x9758, 0},
-	{0x9759, 2273},
-	{0x975a, 9739},
-	{0x975b, 1478},
-	{0x975d, 0},
-	{0x975e, 1636},
-	{0x9760, 2380},
-	{0x9761, 2775},
-	{0x9762, 2795},
-	{0x9764, 0},
-	{0x9765, 4738},
-	{0x9767, 0},
-	{0x9768, 8899},
-	{0x9769, 1770},
-	{0x976b, 0},
-	{0x976c, 1},
-	{0x976d, 2},
-	{0x976e, 3},
-	{0x976f, 4},
-	{0x9770, 5},
-	{0x9771, 6},
-	{0x9772, 7},
-	{0x9773, 2250},
-	{0x9774, 4046},
-	{0x9776, 987},
-	{0x9778, 0},
-	{0x9779, 1},
-	{0x977a, 2},
-	{0x977b, 3},
-	{0x977c, 7624},
-	{0x977e, 0},
-	{0x977f, 1},
-	{0x9780, 2},
-	{0x9781, 3},
-	{0x9782, 4},
-	{0x9783, 5},
-	{0x9784, 6},
-	{0x9785, 7625},
-	{0x9787, 0},
-	{0x9788, 1},
-	{0x9789, 2},
-	{0x978a, 3},
-	{0x978b, 3959},
-	{0x978d, 955},
-	{0x978f, 7971},
-	{0x9791, 7626},
-	{0x9792, 7627},
-	{0x9794, 7628},
-	{0x9796, 0},
-	{0x9797, 1},
-	{0x9798, 3143},
-	{0x979a, 0},
-	{0x979b, 1},
-	{0x979c, 2},
-	{0x979d, 3},
-	{0x979e, 4},
-	{0x979f, 5},
-	{0x97a0, 2302},
-	{0x97a2, 0},
-	{0x97a3, 7631},
-	{0x97a5, 0},
-	{0x97a6, 9877},
-	{0x97a8, 0},
-	{0x97a9, 1},
-	{0x97aa, 2},
-	{0x97ab, 7630},
-	{0x97ad, 1095},
-	{0x97af, 7629},
-	{0x97b1, 0},
-	{0x97b2, 7632},
-	{0x97b4, 7633},
-	{0x97b6, 0},
-	{0x97b7, 1},
-	{0x97b8, 2},
-	{0x97b9, 3},
-	{0x97ba, 4},
-	{0x97bb, 5},
-	{0x97bc, 6},
-	{0x97bd, 9822},
-	{0x97bf, 0},
-	{0x97c0, 1},
-	{0x97c1, 2},
-	{0x97c2, 3},
-	{0x97c3, 9821},
-	{0x97c5, 0},
-	{0x97c6, 9874},
-	{0x97c8, 0},
-	{0x97c9, 9823},
-	{0x97cb, 8589},
-	{0x97cc, 8445},
-	{0x97ce, 0},
-	{0x97cf, 1},
-	{0x97d0, 2},
-	{0x97d1, 3},
-	{0x97d2, 4},
-	{0x97d3, 8000},
-	{0x97d5, 0},
-	{0x97d6, 1},
-	{0x97d7, 2},
-	{0x97d8, 3},
-	{0x97d9, 9317},
-	{0x97db, 0},
-	{0x97dc, 9319},
-	{0x97de, 9318},
-	{0x97e0, 0},
-	{0x97e1, 1},
-	{0x97e2, 2},
-	{0x97e3, 3},
-	{0x97e4, 4},
-	{0x97e5, 5},
-	{0x97e6, 3763},
-	{0x97e7, 3240},
-	{0x97e9, 1890},
-	{0x97ea, 6222},
-	{0x97eb, 6223},
-	{0x97ec, 6224},
-	{0x97ed, 2289},
-	{0x97ef, 0},
-	{0x97f0, 1},
-	{0x97f1, 2},
-	{0x97f2, 3},
-	{0x97f3, 4219},
-	{0x97f5, 4370},
-	{0x97f6, 3345},
-	{0x97f8, 0},
-	{0x97f9, 1},
-	{0x97fa, 2},
-	{0x97fb, 3},
-	{0x97fc, 4},
-	{0x97fd, 5},
-	{0x97fe, 6},
-	{0x97ff, 8649},
-	{0x9801, 8713},
-	{0x9802, 7881},
-	{0x9803, 8425},
-	{0x9805, 8650},
-	{0x9806, 8518},
-	{0x9807, 9669},
-	{0x9808, 8668},
-	{0x980a, 9310},
-	{0x980c, 8527},
-	{0x980e, 9670},
-	{0x980f, 9671},
-	{0x9810, 8769},
-	{0x9811, 8586},
-	{0x9812, 7727},
-	{0x9813, 7900},
-	{0x9815, 0},
-	{0x9816, 1},
-	{0x9817, 8383},
-	{0x9818, 8244},
-	{0x981a, 0},
-	{0x981b, 1},
-	{0x981c, 9673},
-	{0x981e, 0},
-	{0x981f, 1},
-	{0x9820, 2},
-	{0x9821, 9672},
-	{0x9823, 0},
-	{0x9824, 8718},
-	{0x9826, 9675},
-	{0x9828, 0},
-	{0x9829, 1},
-	{0x982a, 2},
-	{0x982b, 3},
-	{0x982c, 4},
-	{0x982d, 8573},
-	{0x982f, 0},
-	{0x9830, 8062},
-	{0x9832, 0},
-	{0x9833, 1},
-	{0x9834, 2},
-	{0x9835, 3},
-	{0x9836, 4},
-	{0x9837, 9676},
-	{0x9838, 8131},
-	{0x983a, 0},
-	{0x983b, 8377},
-	{0x983d, 8577},
-	{0x983f, 0},
-	{0x9840, 1},
-	{0x9841, 2},
-	{0x9842, 3},
-	{0x9843, 4},
-	{0x9844, 5},
-	{0x9845, 6},
-	{0x9846, 8154},
-	{0x9848, 0},
-	{0x9849, 1},
-	{0x984a, 2},
-	{0x984b, 3},
-	{0x984c, 8563},
-	{0x984d, 7905},
-	{0x984e, 9677},
-	{0x9850, 0},
-	{0x9851, 1},
-	{0x9852, 2},
-	{0x9853, 9678},
-	{0x9854, 8694},
-	{0x9856, 0},
-	{0x9857, 1},
-	{0x9858, 8779},
-	{0x9859, 9681},
-	{0x985b, 7872},
-	{0x985d, 0},
-	{0x985e, 8200},
-	{0x9860, 0},
-	{0x9861, 1},
-	{0x9862, 9680},
-	{0x9864, 0},
-	{0x9865, 9682},
-	{0x9867, 7978},
-	{0x9869, 0},
-	{0x986a, 1},
-	{0x986b, 7794},
-	{0x986c, 9683},
-	{0x986e, 0},
-	{0x986f, 8638},
-	{0x9870, 9684},
-	{0x9871, 8260},
-	{0x9873, 9679},
-	{0x9874, 8435},
-	{0x9875, 4154},
-	{0x9876, 1508},
-	{0x9877, 3175},
-	{0x9878, 7136},
-	{0x9879, 3931},
-	{0x987a, 3496},
-	{0x987b, 4022},
-	{0x987c, 6183},
-	{0x987d, 3736},
-	{0x987e, 1828},
-	{0x987f, 1560},
-	{0x9880, 7137},
-	{0x9881, 1007},
-	{0x9882, 3521},
-	{0x9883, 7138},
-	{0x9884, 4327},
-	{0x9885, 2644},
-	{0x9886, 2613},
-	{0x9887, 3043},
-	{0x9888, 2272},
-	{0x9889, 7139},
-	{0x988a, 2120},
-	{0x988c, 7140},
-	{0x988d, 7141},
-	{0x988f, 7142},
-	{0x9890, 4170},
-	{0x9891, 3028},
-	{0x9893, 3704},
-	{0x9894, 7143},
-	{0x9896, 4246},
-	{0x9897, 2386},
-	{0x9898, 3637},
-	{0x989a, 7144},
-	{0x989b, 7145},
-	{0x989c, 4094},
-	{0x989d, 1581},
-	{0x989e, 7146},
-	{0x989f, 7147},
-	{0x98a0, 1472},
-	{0x98a1, 7148},
-	{0x98a2, 7149},
-	{0x98a4, 1219},
-	{0x98a5, 7150},
-	{0x98a6, 7151},
-	{0x98a7, 3202},
-	{0x98a8, 7936},
-	{0x98aa, 0},
-	{0x98ab, 1},
-	{0x98ac, 2},
-	{0x98ad, 3},
-	{0x98ae, 9420},
-	{0x98af, 9421},
-	{0x98b1, 9880},
-	{0x98b3, 9848},
-	{0x98b5, 0},
-	{0x98b6, 9422},
-	{0x98b8, 0},
-	{0x98b9, 1},
-	{0x98ba, 2},
-	{0x98bb, 3},
-	{0x98bc, 9423},
-	{0x98be, 0},
-	{0x98bf, 1},
-	{0x98c0, 2},
-	{0x98c1, 3},
-	{0x98c2, 4},
-	{0x98c3, 5},
-	{0x98c4, 8376},
-	{0x98c6, 9424},
-	{0x98c8, 9425},
-	{0x98ca, 0},
-	{0x98cb, 1},
-	{0x98cc, 2},
-	{0x98cd, 3},
-	{0x98ce, 1668},
-	{0x98d0, 0},
-	{0x98d1, 6583},
-	{0x98d2, 6584},
-	{0x98d3, 6585},
-	{0x98d5, 6586},
-	{0x98d7, 0},
-	{0x98d8, 3021},
-	{0x98d9, 6587},
-	{0x98da, 6588},
-	{0x98db, 7924},
-	{0x98dd, 0},
-	{0x98de, 1638},
-	{0x98df, 3402},
-	{0x98e0, 9115},
-	{0x98e2, 9854},
-	{0x98e4, 0},
-	{0x98e5, 1},
-	{0x98e6, 2},
-	{0x98e7, 5658},
-	{0x98e8, 7655},
-	{0x98e9, 9117},
-	{0x98ea, 9119},
-	{0x98eb, 9120},
-	{0x98ed, 9121},
-	{0x98ef, 7921},
-	{0x98f1, 0},
-	{0x98f2, 8734},
-	{0x98f4, 9122},
-	{0x98f6, 0},
-	{0x98f7, 1},
-	{0x98f8, 2},
-	{0x98f9, 3},
-	{0x98fa, 4},
-	{0x98fb, 5},
-	{0x98fc, 8523},
-	{0x98fd, 7734},
-	{0x98fe, 8501},
-	{0x9901, 0},
-	{0x9902, 1},
-	{0x9903, 8109},
-	{0x9905, 7763},
-	{0x9907, 0},
-	{0x9908, 1},
-	{0x9909, 9123},
-	{0x990a, 8707},
-	{0x990c, 7911},
-	{0x990d, 7656},
-	{0x990f, 0},
-	{0x9910, 1172},
-	{0x9911, 9124},
-	{0x9912, 8343},
-	{0x9913, 7908},
-	{0x9915, 0},
-	{0x9916, 1},
-	{0x9917, 2},
-	{0x9918, 8760},
-	{0x991a, 0},
-	{0x991b, 9125},
-	{0x991d, 0},
-	{0x991e, 8090},
-	{0x9920, 0},
-	{0x9921, 8643},
-	{0x9923, 0},
-	{0x9924, 1},
-	{0x9925, 2},
-	{0x9926, 3},
-	{0x9927, 4},
-	{0x9928, 7982},
-	{0x992a, 0},
-	{0x992b, 1},
-	{0x992c, 2},
-	{0x992d, 3},
-	{0x992e, 7657},
-	{0x9930, 0},
-	{0x9931, 1},
-	{0x9932, 2},
-	{0x9933, 9116},
-	{0x9935, 0},
-	{0x9936, 1},
-	{0x9937, 9126},
-	{0x9939, 0},
-	{0x993a, 1},
-	{0x993b, 2},
-	{0x993c, 9118},
-	{0x993e, 8245},
-	{0x993f, 9127},
-	{0x9941, 0},
-	{0x9942, 1},
-	{0x9943, 9128},
-	{0x9945, 8309},
-	{0x9947, 0},
-	{0x9948, 9129},
-	{0x9949, 9130},
-	{0x994a, 9131},
-	{0x994b, 8171},
-	{0x994c, 9132},
-	{0x994e, 0},
-	{0x994f, 1},
-	{0x9950, 2},
-	{0x9951, 8042},
-	{0x9952, 8441},
-	{0x9954, 7659},
-	{0x9955, 7658},
-	{0x9957, 9830},
-	{0x9959, 0},
-	{0x995a, 1},
-	{0x995b, 2},
-	{0x995c, 9831},
-	{0x995e, 7788},
-	{0x9960, 0},
-	{0x9961, 1},
-	{0x9962, 9133},
-	{0x9963, 5661},
-	{0x9965, 2069},
-	{0x9967, 5662},
-	{0x9968, 5663},
-	{0x9969, 5664},
-	{0x996a, 5665},
-	{0x996b, 5666},
-	{0x996c, 5667},
-	{0x996d, 1622},
-	{0x996e, 4226},
-	{0x996f, 2165},
-	{0x9970, 3429},
-	{0x9971, 1038},
-	{0x9972, 3516},
-	{0x9974, 5668},
-	{0x9975, 1595},
-	{0x9976, 3231},
-	{0x9977, 5669},
-	{0x9979, 0},
-	{0x997a, 2201},
-	{0x997c, 1126},
-	{0x997d, 5670},
-	{0x997f, 1589},
-	{0x9980, 5671},
-	{0x9981, 2876},
-	{0x9983, 0},
-	{0x9984, 5672},
-	{0x9985, 3911},
-	{0x9986, 1846},
-	{0x9987, 5673},
-	{0x9988, 2444},
-	{0x998a, 5674},
-	{0x998b, 1213},
-	{0x998d, 5675},
-	{0x998f, 2620},
-	{0x9990, 5676},
-	{0x9991, 5677},
-	{0x9992, 2719},
-	{0x9993, 5678},
-	{0x9994, 5679},
-	{0x9995, 5680},
-	{0x9996, 3438},
-	{0x9997, 4718},
-	{0x9998, 4857},
-	{0x9999, 3920},
-	{0x999b, 0},
-	{0x999c, 1},
-	{0x999d, 2},
-	{0x999e, 3},
-	{0x999f, 4},
-	{0x99a0, 5},
-	{0x99a1, 6},
-	{0x99a2, 7},
-	{0x99a3, 8},
-	{0x99a4, 9},
-	{0x99a5, 6955},
-	{0x99a7, 0},
-	{0x99a8, 5086},
-	{0x99aa, 0},
-	{0x99ab, 1},
-	{0x99ac, 8301},
-	{0x99ad, 8770},
-	{0x99ae, 7938},
-	{0x99b0, 0},
-	{0x99b1, 8579},
-	{0x99b3, 7813},
-	{0x99b4, 8681},
-	{0x99b6, 0},
-	{0x99b7, 1},
-	{0x99b8, 2},
-	{0x99b9, 3},
-	{0x99ba, 4},
-	{0x99bb, 5},
-	{0x99bc, 6},
-	{0x99bd, 7},
-	{0x99be, 8},
-	{0x99bf, 9},
-	{0x99c0, 10},
-	{0x99c1, 7767},
-	{0x99c3, 0},
-	{0x99c4, 1},
-	{0x99c5, 2},
-	{0x99c6, 3},
-	{0x99c7, 4},
-	{0x99c8, 5},
-	{0x99c9, 6},
-	{0x99ca, 7},
-	{0x99cb, 8},
-	{0x99cc, 9},
-	{0x99cd, 10},
-	{0x99ce, 11},
-	{0x99cf, 12},
-	{0x99d0, 8869},
-	{0x99d1, 9223},
-	{0x99d2, 8138},
-	{0x99d4, 9218},
-	{0x99d5, 8066},
-	{0x99d7, 0},
-	{0x99d8, 9224},
-	{0x99d9, 9220},
-	{0x99db, 8497},
-	{0x99dd, 8580},
-	{0x99df, 9219},
-	{0x99e1, 8302},
-	{0x99e2, 9227},
-	{0x99e4, 0},
-	{0x99e5, 1},
-	{0x99e6, 2},
-	{0x99e7, 3},
-	{0x99e8, 4},
-	{0x99e9, 5},
-	{0x99ea, 6},
-	{0x99eb, 7},
-	{0x99ec, 8},
-	{0x99ed, 7999},
-	{0x99ef, 0},
-	{0x99f0, 1},
-	{0x99f1, 8295},
-	{0x99f3, 0},
-	{0x99f4, 1},
-	{0x99f5, 2},
-	{0x99f6, 3},
-	{0x99f7, 4},
-	{0x99f8, 5},
-	{0x99f9, 6},
-	{0x99fa, 7},
-	{0x99fb, 8},
-	{0x99fc, 9},
-	{0x99fd, 10},
-	{0x99fe, 11},
-	{0x99ff, 8151},
-	{0x9a01, 7811},
-	{0x9a03, 0},
-	{0x9a04, 1},
-	{0x9a05, 9231},
-	{0x9a07, 0},
-	{0x9a08, 1},
-	{0x9a09, 2},
-	{0x9a0a, 3},
-	{0x9a0b, 4},
-	{0x9a0c, 5},
-	{0x9a0d, 9230},
-	{0x9a0e, 8391},
-	{0x9a0f, 9229},
-	{0x9a11, 0},
-	{0x9a12, 1},
-	{0x9a13, 2},
-	{0x9a14, 3},
-	{0x9a15, 4},
-	{0x9a16, 9234},
-	{0x9a18, 0},
-	{0x9a19, 8375},
-	{0x9a1b, 0},
-	{0x9a1c, 1},
-	{0x9a1d, 2},
-	{0x9a1e, 3},
-	{0x9a1f, 4},
-	{0x9a20, 5},
-	{0x9a21, 6},
-	{0x9a22, 7},
-	{0x9a23, 8},
-	{0x9a24, 9},
-	{0x9a25, 10},
-	{0x9a26, 11},
-	{0x9a27, 12},
-	{0x9a28, 13},
-	{0x9a29, 14},
-	{0x9a2a, 15},
-	{0x9a2b, 9200},
-	{0x9a2d, 9233},
-	{0x9a2e, 9236},
-	{0x9a30, 8560},
-	{0x9a32, 0},
-	{0x9a33, 1},
-	{0x9a34, 2},
-	{0x9a35, 3},
-	{0x9a36, 9221},
-	{0x9a37, 8460},
-	{0x9a38, 9237},
-	{0x9a3a, 0},
-	{0x9a3b, 1},
-	{0x9a3c, 2},
-	{0x9a3d, 3},
-	{0x9a3e, 8294},
-	{0x9a40, 9042},
-	{0x9a41, 9235},
-	{0x9a42, 9232},
-	{0x9a43, 9238},
-	{0x9a44, 9239},
-	{0x9a45, 8433},
-	{0x9a47, 0},
-	{0x9a48, 1},
-	{0x9a49, 2},
-	{0x9a4a, 9226},
-	{0x9a4c, 0},
-	{0x9a4d, 9225},
-	{0x9a4f, 9240},
-	{0x9a51, 0},
-	{0x9a52, 1},
-	{0x9a53, 2},
-	{0x9a54, 3},
-	{0x9a55, 8103},
-	{0x9a57, 8700},
-	{0x9a59, 0},
-	{0x9a5a, 8129},
-	{0x9a5b, 9222},
-	{0x9a5d, 0},
-	{0x9a5e, 1},
-	{0x9a5f, 8860},
-	{0x9a61, 0},
-	{0x9a62, 8270},
-	{0x9a64, 9242},
-	{0x9a65, 9241},
-	{0x9a67, 0},
-	{0x9a68, 1},
-	{0x9a69, 2},
-	{0x9a6a, 9228},
-	{0x9a6c, 2708},
-	{0x9a6d, 4329},
-	{0x9a6e, 3717},
-	{0x9a6f, 4058},
-	{0x9a70, 1280},
-	{0x9a71, 3194},
-	{0x9a73, 1148},
-	{0x9a74, 2662},
-	{0x9a75, 6074},
-	{0x9a76, 3410},
-	{0x9a77, 6075},
-	{0x9a78, 6076},
-	{0x9a79, 2307},
-	{0x9a7a, 6077},
-	{0x9a7b, 4609},
-	{0x9a7c, 3718},
-	{0x9a7d, 6079},
-	{0x9a7e, 2128},
-	{0x9a7f, 6078},
-	{0x9a80, 6080},
-	{0x9a81, 6081},
-	{0x9a82, 2709},
-	{0x9a84, 2191},
-	{0x9a85, 6082},
-	{0x9a86, 2701},
-	{0x9a87, 1886},
-	{0x9a88, 6083},
-	{0x9a8a, 6084},
-	{0x9a8b, 1271},
-	{0x9a8c, 4114},
-	{0x9a8e, 0},
-	{0x9a8f, 2354},
-	{0x9a90, 6085},
-	{0x9a91, 3086},
-	{0x9a92, 6086},
-	{0x9a93, 6087},
-	{0x9a95, 0},
-	{0x9a96, 6088},
-	{0x9a97, 3020},
-	{0x9a98, 6089},
-	{0x9a9a, 3296},
-	{0x9a9b, 6090},
-	{0x9a9c, 6091},
-	{0x9a9d, 6092},
-	{0x9a9e, 5941},
-	{0x9a9f, 6093},
-	{0x9aa0, 6094},
-	{0x9aa1, 2697},
-	{0x9aa2, 6095},
-	{0x9aa3, 6096},
-	{0x9aa4, 4583},
-	{0x9aa5, 6097},
-	{0x9aa7, 6098},
-	{0x9aa8, 1824},
-	{0x9aaa, 0},
-	{0x9aab, 1},
-	{0x9aac, 2},
-	{0x9aad, 3},
-	{0x9aae, 4},
-	{0x9aaf, 7721},
-	{0x9ab0, 7635},
-	{0x9ab1, 7634},
-	{0x9ab3, 0},
-	{0x9ab4, 1},
-	{0x9ab5, 2},
-	{0x9ab6, 7638},
-	{0x9ab7, 7636},
-	{0x9ab8, 1880},
-	{0x9aba, 7639},
-	{0x9abc, 7640},
-	{0x9abe, 0},
-	{0x9abf, 1},
-	{0x9ac0, 7642},
-	{0x9ac1, 7641},
-	{0x9ac2, 7644},
-	{0x9ac4, 0},
-	{0x9ac5, 7643},
-	{0x9ac7, 0},
-	{0x9ac8, 1},
-	{0x9ac9, 2},
-	{0x9aca, 3},
-	{0x9acb, 7645},
-	{0x9acc, 7646},
-	{0x9ace, 0},
-	{0x9acf, 9825},
-	{0x9ad1, 7647},
-	{0x9ad2, 9892},
-	{0x9ad3, 3549},
-	{0x9ad4, 8564},
-	{0x9ad5, 9827},
-	{0x9ad6, 9826},
-	{0x9ad8, 1754},
-	{0x9ada, 0},
-	{0x9adb, 1},
-	{0x9adc, 2},
-	{0x9add, 3},
-	{0x9ade, 4},
-	{0x9adf, 7660},
-	{0x9ae1, 7661},
-	{0x9ae3, 0},
-	{0x9ae4, 1},
-	{0x9ae5, 2},
-	{0x9ae6, 7662},
-	{0x9ae8, 0},
-	{0x9ae9, 1},
-	{0x9aea, 2},
-	{0x9aeb, 7664},
-	{0x9aed, 7666},
-	{0x9aee, 9845},
-	{0x9aef, 7663},
-	{0x9af1, 0},
-	{0x9af2, 1},
-	{0x9af3, 2},
-	{0x9af4, 3},
-	{0x9af5, 4},
-	{0x9af6, 5},
-	{0x9af7, 6},
-	{0x9af8, 7},
-	{0x9af9, 7667},
-	{0x9afb, 7665},
-	{0x9afd, 0},
-	{0x9afe, 1},
-	{0x9aff, 2},
-	{0x9b01, 0},
-	{0x9b02, 1},
-	{0x9b03, 4660},
-	{0x9b05, 0},
-	{0x9b06, 8524},
-	{0x9b08, 7668},
-	{0x9b0a, 0},
-	{0x9b0b, 1},
-	{0x9b0c, 2},
-	{0x9b0d, 9850},
-	{0x9b0f, 7669},
-	{0x9b11, 0},
-	{0x9b12, 1},
-	{0x9b13, 7670},
-	{0x9b15, 0},
-	{0x9b16, 1},
-	{0x9b17, 2},
-	{0x9b18, 3},
-	{0x9b19, 4},
-	{0x9b1a, 9888},
-	{0x9b1c, 0},
-	{0x9b1d, 1},
-	{0x9b1e, 2},
-	{0x9b1f, 7671},
-	{0x9b21, 0},
-	{0x9b22, 9832},
-	{0x9b23, 7672},
-	{0x9b25, 7888},
-	{0x9b27, 8342},
-	{0x9b29, 9164},
-	{0x9b2b, 0},
-	{0x9b2c, 1},
-	{0x9b2d, 2},
-	{0x9b2e, 9160},
-	{0x9b2f, 5019},
-	{0x9b31, 8766},
-	{0x9b32, 4704},
-	{0x9b34, 0},
-	{0x9b35, 1},
-	{0x9b36, 2},
-	{0x9b37, 3},
-	{0x9b38, 4},
-	{0x9b39, 5},
-	{0x9b3a, 6},
-	{0x9b3b, 6003},
-	{0x9b3c, 1862},
-	{0x9b3e, 0},
-	{0x9b3f, 1},
-	{0x9b40, 2},
-	{0x9b41, 2442},
-	{0x9b42, 2047},
-	{0x9b43, 7649},
-	{0x9b44, 3046},
-	{0x9b45, 7648},
-	{0x9b47, 7650},
-	{0x9b48, 7652},
-	{0x9b49, 7651},
-	{0x9b4b, 0},
-	{0x9b4c, 1},
-	{0x9b4d, 7653},
-	{0x9b4e, 9829},
-	{0x9b4f, 3785},
-	{0x9b51, 7654},
-	{0x9b53, 0},
-	{0x9b54, 2826},
-	{0x9b56, 0},
-	{0x9b57, 1},
-	{0x9b58, 9828},
-	{0x9b5a, 8761},
-	{0x9b5c, 0},
-	{0x9b5d, 1},
-	{0x9b5e, 2},
-	{0x9b5f, 3},
-	{0x9b60, 4},
-	{0x9b61, 5},
-	{0x9b62, 6},
-	{0x9b63, 7},
-	{0x9b64, 8},
-	{0x9b65, 9},
-	{0x9b66, 10},
-	{0x9b67, 11},
-	{0x9b68, 12},
-	{0x9b69, 13},
-	{0x9b6a, 14},
-	{0x9b6b, 15},
-	{0x9b6c, 16},
-	{0x9b6d, 17},
-	{0x9b6e, 18},
-	{0x9b6f, 8266},
-	{0x9b71, 0},
-	{0x9b72, 1},
-	{0x9b73, 2},
-	{0x9b74, 9759},
-	{0x9b76, 0},
-	{0x9b77, 9758},
-	{0x9b79, 0},
-	{0x9b7a, 1},
-	{0x9b7b, 2},
-	{0x9b7c, 3},
-	{0x9b7d, 4},
-	{0x9b7e, 5},
-	{0x9b7f, 6},
-	{0x9b80, 7},
-	{0x9b81, 9760},
-	{0x9b83, 9761},
-	{0x9b85, 0},
-	{0x9b86, 1},
-	{0x9b87, 2},
-	{0x9b88, 3},
-	{0x9b89, 4},
-	{0x9b8a, 5},
-	{0x9b8b, 6},
-	{0x9b8c, 7},
-	{0x9b8d, 8},
-	{0x9b8e, 9762},
-	{0x9b90, 9767},
-	{0x9b91, 7737},
-	{0x9b92, 9765},
-	{0x9b94, 0},
-	{0x9b95, 1},
-	{0x9b96, 2},
-	{0x9b97, 3},
-	{0x9b98, 4},
-	{0x9b99, 5},
-	{0x9b9a, 9769},
-	{0x9b9c, 0},
-	{0x9b9d, 9774},
-	{0x9b9e, 9771},
-	{0x9ba0, 0},
-	{0x9ba1, 1},
-	{0x9ba2, 2},
-	{0x9ba3, 3},
-	{0x9ba4, 4},
-	{0x9ba5, 5},
-	{0x9ba6, 6},
-	{0x9ba7, 7},
-	{0x9ba8, 8},
-	{0x9ba9, 9},
-	{0x9baa, 9770},
-	{0x9bab, 9773},
-	{0x9bad, 9768},
-	{0x9bae, 8633},
-	{0x9bb0, 0},
-	{0x9bb1, 1},
-	{0x9bb2, 2},
-	{0x9bb3, 3},
-	{0x9bb4, 4},
-	{0x9bb5, 5},
-	{0x9bb6, 6},
-	{0x9bb7, 7},
-	{0x9bb8, 8},
-	{0x9bb9, 9},
-	{0x9bba, 10},
-	{0x9bbb, 11},
-	{0x9bbc, 12},
-	{0x9bbd, 13},
-	{0x9bbe, 14},
-	{0x9bbf, 15},
-	{0x9bc0, 9782},
-	{0x9bc1, 9776},
-	{0x9bc3, 0},
-	{0x9bc4, 1},
-	{0x9bc5, 2},
-	{0x9bc6, 3},
-	{0x9bc7, 9784},
-	{0x9bc9, 8205},
-	{0x9bca, 9783},
-	{0x9bcc, 0},
-	{0x9bcd, 1},
-	{0x9bce, 2},
-	{0x9bcf, 3},
-	{0x9bd0, 4},
-	{0x9bd1, 5},
-	{0x9bd2, 6},
-	{0x9bd3, 7},
-	{0x9bd4, 9797},
-	{0x9bd6, 9786},
-	{0x9bd8, 0},
-	{0x9bd9, 1},
-	{0x9bda, 2},
-	{0x9bdb, 9795},
-	{0x9bdd, 9792},
-	{0x9bdf, 0},
-	{0x9be0, 1},
-	{0x9be1, 9789},
-	{0x9be2, 9793},
-	{0x9be4, 9790},
-	{0x9be6, 0},
-	{0x9be7, 9791},
-	{0x9be8, 8128},
-	{0x9bea, 9787},
-	{0x9beb, 9788},
-	{0x9bed, 0},
-	{0x9bee, 1},
-	{0x9bef, 2},
-	{0x9bf0, 9794},
-	{0x9bf2, 0},
-	{0x9bf3, 1},
-	{0x9bf4, 9796},
-	{0x9bf6, 0},
-	{0x9bf7, 1},
-	{0x9bf8, 2},
-	{0x9bf9, 3},
-	{0x9bfa, 4},
-	{0x9bfb, 5},
-	{0x9bfc, 6},
-	{0x9bfd, 9785},
-	{0x9bff, 9804},
-	{0x9c01, 0},
-	{0x9c02, 1},
-	{0x9c03, 2},
-	{0x9c04, 3},
-	{0x9c05, 4},
-	{0x9c06, 5},
-	{0x9c07, 6},
-	{0x9c08, 9799},
-	{0x9c09, 9803},
-	{0x9c0b, 0},
-	{0x9c0c, 1},
-	{0x9c0d, 9801},
-	{0x9c0f, 0},
-	{0x9c10, 9800},
-	{0x9c12, 9802},
-	{0x9c13, 8456},
-	{0x9c15, 0},
-	{0x9c16, 1},
-	{0x9c17, 2},
-	{0x9c18, 3},
-	{0x9c19, 4},
-	{0x9c1a, 5},
-	{0x9c1b, 6},
-	{0x9c1c, 7},
-	{0x9c1d, 8},
-	{0x9c1e, 9},
-	{0x9c1f, 10},
-	{0x9c20, 9805},
-	{0x9c22, 0},
-	{0x9c23, 9780},
-	{0x9c25, 9809},
-	{0x9c27, 0},
-	{0x9c28, 9808},
-	{0x9c29, 9810},
-	{0x9c2b, 0},
-	{0x9c2c, 1},
-	{0x9c2d, 9807},
-	{0x9c2f, 0},
-	{0x9c30, 1},
-	{0x9c31, 9778},
-	{0x9c32, 9806},
-	{0x9c33, 9811},
-	{0x9c35, 9815},
-	{0x9c37, 9781},
-	{0x9c39, 9779},
-	{0x9c3b, 9814},
-	{0x9c3d, 0},
-	{0x9c3e, 9812},
-	{0x9c40, 0},
-	{0x9c41, 1},
-	{0x9c42, 2},
-	{0x9c43, 3},
-	{0x9c44, 4},
-	{0x9c45, 9816},
-	{0x9c47, 0},
-	{0x9c48, 9813},
-	{0x9c49, 7757},
-	{0x9c4b, 0},
-	{0x9c4c, 1},
-	{0x9c4d, 2},
-	{0x9c4e, 3},
-	{0x9c4f, 4},
-	{0x9c50, 5},
-	{0x9c51, 6},
-	{0x9c52, 9819},
-	{0x9c54, 9818},
-	{0x9c56, 9817},
-	{0x9c57, 8238},
-	{0x9c58, 9775},
-	{0x9c5a, 0},
-	{0x9c5b, 1},
-	{0x9c5c, 2},
-	{0x9c5d, 9798},
-	{0x9c5f, 9766},
-	{0x9c61, 0},
-	{0x9c62, 1},
-	{0x9c63, 2},
-	{0x9c64, 3},
-	{0x9c65, 4},
-	{0x9c66, 5},
-	{0x9c67, 9820},
-	{0x9c69, 0},
-	{0x9c6a, 1},
-	{0x9c6b, 2},
-	{0x9c6c, 3},
-	{0x9c6d, 9772},
-	{0x9c6f, 0},
-	{0x9c70, 1},
-	{0x9c71, 2},
-	{0x9c72, 3},
-	{0x9c73, 4},
-	{0x9c74, 5},
-	{0x9c75, 6},
-	{0x9c76, 7},
-	{0x9c77, 8},
-	{0x9c78, 9763},
-	{0x9c7a, 9777},
-	{0x9c7c, 4296},
-	{0x9c7e, 0},
-	{0x9c7f, 7561},
-	{0x9c81, 2650},
-	{0x9c82, 7562},
-	{0x9c84, 0},
-	{0x9c85, 7563},
-	{0x9c86, 7564},
-	{0x9c87, 7565},
-	{0x9c88, 7566},
-	{0x9c8a, 0},
-	{0x9c8b, 7568},
-	{0x9c8d, 1044},
-	{0x9c8e, 7569},
-	{0x9c90, 7570},
-	{0x9c91, 7571},
-	{0x9c92, 7572},
-	{0x9c94, 7573},
-	{0x9c95, 7574},
-	{0x9c97, 0},
-	{0x9c98, 1},
-	{0x9c99, 2},
-	{0x9c9a, 7575},
-	{0x9c9b, 7576},
-	{0x9c9c, 3895},
-	{0x9c9e, 7577},
-	{0x9c9f, 7578},
-	{0x9ca0, 7579},
-	{0x9ca1, 7580},
-	{0x9ca2, 7581},
-	{0x9ca3, 7582},
-	{0x9ca4, 2523},
-	{0x9ca5, 7583},
-	{0x9ca6, 7584},
-	{0x9ca7, 7585},
-	{0x9ca8, 7586},
-	{0x9ca9, 7587},
-	{0x9cab, 7588},
-	{0x9cad, 7589},
-	{0x9cae, 7590},
-	{0x9cb0, 7591},
-	{0x9cb1, 7592},
-	{0x9cb2, 7593},
-	{0x9cb3, 7594},
-	{0x9cb4, 7595},
-	{0x9cb5, 7596},
-	{0x9cb6, 7597},
-	{0x9cb7, 7598},
-	{0x9cb8, 2263},
-	{0x9cba, 7599},
-	{0x9cbb, 7600},
-	{0x9cbc, 7601},
-	{0x9cbd, 7602},
-	{0x9cbf, 0},
-	{0x9cc0, 1},
-	{0x9cc1, 2},
-	{0x9cc2, 3},
-	{0x9cc3, 3285},
-	{0x9cc4, 7603},
-	{0x9cc5, 7604},
-	{0x9cc6, 7605},
-	{0x9cc7, 7606},
-	{0x9cc9, 0},
-	{0x9cca, 7607},
-	{0x9ccb, 7608},
-	{0x9ccc, 7609},
-	{0x9ccd, 7610},
-	{0x9cce, 7611},
-	{0x9ccf, 7612},
-	{0x9cd0, 7613},
-	{0x9cd2, 0},
-	{0x9cd3, 7614},
-	{0x9cd4, 7615},
-	{0x9cd5, 7616},
-	{0x9cd6, 1111},
-	{0x9cd7, 7617},
-	{0x9cd8, 7618},
-	{0x9cd9, 7619},
-	{0x9cdb, 0},
-	{0x9cdc, 7620},
-	{0x9cdd, 7621},
-	{0x9cde, 2596},
-	{0x9cdf, 7622},
-	{0x9ce1, 0},
-	{0x9ce2, 7623},
-	{0x9ce4, 0},
-	{0x9ce5, 8348},
-	{0x9ce7, 0},
-	{0x9ce8, 1},
-	{0x9ce9, 9600},
-	{0x9ceb, 0},
-	{0x9cec, 8924},
-	{0x9cee, 0},
-	{0x9cef, 1},
-	{0x9cf0, 2},
-	{0x9cf1, 3},
-	{0x9cf2, 4},
-	{0x9cf3, 7941},
-	{0x9cf4, 8331},
-	{0x9cf6, 9601},
-	{0x9cf8, 0},
-	{0x9cf9, 1},
-	{0x9cfa, 2},
-	{0x9cfb, 3},
-	{0x9cfc, 4},
-	{0x9cfd, 5},
-	{0x9cfe, 6},
-	{0x9cff, 7},
-	{0x9d01, 0},
-	{0x9d02, 1},
-	{0x9d03, 2},
-	{0x9d04, 3},
-	{0x9d05, 4},
-	{0x9d06, 9603},
-	{0x9d07, 9602},
-	{0x9d09, 8686},
-	{0x9d0b, 0},
-	{0x9d0c, 1},
-	{0x9d0d, 2},
-	{0x9d0e, 3},
-	{0x9d0f, 4},
-	{0x9d10, 5},
-	{0x9d11, 6},
-	{0x9d12, 7},
-	{0x9d13, 8},
-	{0x9d14, 9},
-	{0x9d15, 8578},
-	{0x9d17, 0},
-	{0x9d18, 1},
-	{0x9d19, 2},
-	{0x9d1a, 3},
-	{0x9d1b, 8771},
-	{0x9d1d, 9607},
-	{0x9d1f, 9608},
-	{0x9d21, 0},
-	{0x9d22, 1},
-	{0x9d23, 9604},
-	{0x9d25, 0},
-	{0x9d26, 8701},
-	{0x9d28, 8687},
-	{0x9d2a, 0},
-	{0x9d2b, 1},
-	{0x9d2c, 2},
-	{0x9d2d, 3},
-	{0x9d2e, 4},
-	{0x9d2f, 9610},
-	{0x9d30, 9612},
-	{0x9d32, 0},
-	{0x9d33, 1},
-	{0x9d34, 2},
-	{0x9d35, 3},
-	{0x9d36, 4},
-	{0x9d37, 5},
-	{0x9d38, 6},
-	{0x9d39, 7},
-	{0x9d3a, 8},
-	{0x9d3b, 8007},
-	{0x9d3d, 0},
-	{0x9d3e, 1},
-	{0x9d3f, 7965},
-	{0x9d41, 0},
-	{0x9d42, 9613},
-	{0x9d44, 0},
-	{0x9d45, 1},
-	{0x9d46, 2},
-	{0x9d47, 3},
-	{0x9d48, 4},
-	{0x9d49, 5},
-	{0x9d4a, 6},
-	{0x9d4b, 7},
-	{0x9d4c, 8},
-	{0x9d4d, 9},
-	{0x9d4e, 10},
-	{0x9d4f, 11},
-	{0x9d50, 12},
-	{0x9d51, 8144},
-	{0x9d52, 9618},
-	{0x9d53, 9615},
-	{0x9d55, 0},
-	{0x9d56, 1},
-	{0x9d57, 2},
-	{0x9d58, 3},
-	{0x9d59, 4},
-	{0x9d5a, 5},
-	{0x9d5b, 6},
-	{0x9d5c, 9620},
-	{0x9d5d, 7904},
-	{0x9d5f, 0},
-	{0x9d60, 9617},
-	{0x9d61, 9621},
-	{0x9d63, 0},
-	{0x9d64, 1},
-	{0x9d65, 2},
-	{0x9d66, 3},
-	{0x9d67, 4},
-	{0x9d68, 5},
-	{0x9d69, 6},
-	{0x9d6a, 9623},
-	{0x9d6c, 8374},
-	{0x9d6e, 0},
-	{0x9d6f, 9624},
-	{0x9d71, 0},
-	{0x9d72, 8438},
-	{0x9d74, 0},
-	{0x9d75, 1},
-	{0x9d76, 2},
-	{0x9d77, 3},
-	{0x9d78, 4},
-	{0x9d79, 5},
-	{0x9d7a, 6},
-	{0x9d7b, 7},
-	{0x9d7c, 8},
-	{0x9d7d, 9},
-	{0x9d7e, 10},
-	{0x9d7f, 11},
-	{0x9d80, 12},
-	{0x9d81, 13},
-	{0x9d82, 14},
-	{0x9d83, 15},
-	{0x9d84, 16},
-	{0x9d85, 17},
-	{0x9d86, 18},
-	{0x9d87, 9605},
-	{0x9d89, 9625},
-	{0x9d8b, 0},
-	{0x9d8c, 1},
-	{0x9d8d, 2},
-	{0x9d8e, 3},
-	{0x9d8f, 4},
-	{0x9d90, 5},
-	{0x9d91, 6},
-	{0x9d92, 7},
-	{0x9d93, 9622},
-	{0x9d95, 0},
-	{0x9d96, 1},
-	{0x9d97, 2},
-	{0x9d98, 9626},
-	{0x9d9a, 9627},
-	{0x9d9c, 0},
-	{0x9d9d, 1},
-	{0x9d9e, 2},
-	{0x9d9f, 3},
-	{0x9da0, 4},
-	{0x9da1, 5},
-	{0x9da2, 6},
-	{0x9da3, 7},
-	{0x9da4, 8},
-	{0x9da5, 9629},
-	{0x9da7, 0},
-	{0x9da8, 1},
-	{0x9da9, 9630},
-	{0x9dab, 0},
-	{0x9dac, 1},
-	{0x9dad, 2},
-	{0x9dae, 3},
-	{0x9daf, 9036},
-	{0x9db1, 0},
-	{0x9db2, 1},
-	{0x9db3, 2},
-	{0x9db4, 8004},
-	{0x9db6, 0},
-	{0x9db7, 1},
-	{0x9db8, 2},
-	{0x9db9, 3},
-	{0x9dba, 4},
-	{0x9dbb, 9824},
-	{0x9dbc, 9632},
-	{0x9dbe, 0},
-	{0x9dbf, 1},
-	{0x9dc0, 9628},
-	{0x9dc2, 9631},
-	{0x9dc4, 8044},
-	{0x9dc6, 0},
-	{0x9dc7, 1},
-	{0x9dc8, 2},
-	{0x9dc9, 3},
-	{0x9dca, 4},
-	{0x9dcb, 5},
-	{0x9dcc, 6},
-	{0x9dcd, 7},
-	{0x9dce, 8},
-	{0x9dcf, 9},
-	{0x9dd0, 10},
-	{0x9dd1, 11},
-	{0x9dd2, 12},
-	{0x9dd3, 9634},
-	{0x9dd5, 0},
-	{0x9dd6, 1},
-	{0x9dd7, 8366},
-	{0x9dd9, 9611},
-	{0x9dda, 9635},
-	{0x9ddc, 0},
-	{0x9ddd, 1},
-	{0x9dde, 2},
-	{0x9ddf, 3},
-	{0x9de0, 4},
-	{0x9de1, 5},
-	{0x9de2, 6},
-	{0x9de3, 7},
-	{0x9de4, 8},
-	{0x9de5, 9609},
-	{0x9de6, 9637},
-	{0x9de8, 0},
-	{0x9de9, 1},
-	{0x9dea, 2},
-	{0x9deb, 3},
-	{0x9dec, 4},
-	{0x9ded, 5},
-	{0x9dee, 6},
-	{0x9def, 9636},
-	{0x9df1, 0},
-	{0x9df2, 9638},
-	{0x9df3, 9619},
-	{0x9df5, 0},
-	{0x9df6, 1},
-	{0x9df7, 2},
-	{0x9df8, 9639},
-	{0x9df9, 8738},
-	{0x9dfa, 9641},
-	{0x9dfc, 0},
-	{0x9dfd, 1},
-	{0x9dfe, 2},
-	{0x9dff, 3},
-	{0x9e01, 0},
-	{0x9e02, 1},
-	{0x9e03, 2},
-	{0x9e04, 3},
-	{0x9e05, 4},
-	{0x9e06, 5},
-	{0x9e07, 6},
-	{0x9e08, 7},
-	{0x9e09, 8},
-	{0x9e0a, 9},
-	{0x9e0b, 10},
-	{0x9e0c, 9640},
-	{0x9e0e, 0},
-	{0x9e0f, 1},
-	{0x9e10, 2},
-	{0x9e11, 3},
-	{0x9e12, 4},
-	{0x9e13, 5},
-	{0x9e14, 6},
-	{0x9e15, 9606},
-	{0x9e17, 0},
-	{0x9e18, 1},
-	{0x9e19, 2},
-	{0x9e1a, 9633},
-	{0x9e1b, 9642},
-	{0x9e1d, 9616},
-	{0x9e1e, 9614},
-	{0x9e1f, 2900},
-	{0x9e20, 6965},
-	{0x9e21, 2073},
-	{0x9e22, 6966},
-	{0x9e23, 2814},
-	{0x9e25, 2937},
-	{0x9e26, 4068},
-	{0x9e28, 6967},
-	{0x9e29, 6968},
-	{0x9e2a, 6969},
-	{0x9e2b, 6970},
-	{0x9e2c, 6971},
-	{0x9e2d, 4069},
-	{0x9e2f, 4117},
-	{0x9e31, 6973},
-	{0x9e32, 6972},
-	{0x9e33, 4330},
-	{0x9e35, 3715},
-	{0x9e36, 6974},
-	{0x9e37, 6976},
-	{0x9e38, 6975},
-	{0x9e39, 6977},
-	{0x9e3a, 6978},
-	{0x9e3c, 0},
-	{0x9e3d, 1766},
-	{0x9e3e, 6979},
-	{0x9e3f, 1951},
-	{0x9e41, 6980},
-	{0x9e42, 6981},
-	{0x9e43, 2328},
-	{0x9e44, 6982},
-	{0x9e45, 1579},
-	{0x9e46, 6983},
-	{0x9e47, 6984},
-	{0x9e48, 6985},
-	{0x9e49, 6986},
-	{0x9e4a, 3216},
-	{0x9e4b, 6987},
-	{0x9e4c, 6988},
-	{0x9e4e, 6989},
-	{0x9e4f, 2997},
-	{0x9e51, 6990},
-	{0x9e53, 0},
-	{0x9e54, 1},
-	{0x9e55, 6991},
-	{0x9e57, 6992},
-	{0x9e58, 7637},
-	{0x9e5a, 6993},
-	{0x9e5b, 6994},
-	{0x9e5c, 6995},
-	{0x9e5e, 6996},
-	{0x9e60, 0},
-	{0x9e61, 1},
-	{0x9e62, 2},
-	{0x9e63, 6997},
-	{0x9e64, 1934},
-	{0x9e66, 6998},
-	{0x9e67, 6999},
-	{0x9e68, 7000},
-	{0x9e69, 7001},
-	{0x9e6a, 7002},
-	{0x9e6b, 7003},
-	{0x9e6c, 7004},
-	{0x9e6d, 7006},
-	{0x9e6f, 0},
-	{0x9e70, 4234},
-	{0x9e71, 7005},
-	{0x9e73, 7007},
-	{0x9e75, 9864},
-	{0x9e77, 0},
-	{0x9e78, 1},
-	{0x9e79, 9886},
-	{0x9e7a, 9723},
-	{0x9e7c, 8076},
-	{0x9e7d, 8692},
-	{0x9e7e, 7446},
-	{0x9e7f, 2656},
-	{0x9e81, 0},
-	{0x9e82, 7676},
-	{0x9e84, 0},
-	{0x9e85, 1},
-	{0x9e86, 2},
-	{0x9e87, 7677},
-	{0x9e88, 7678},
-	{0x9e8a, 0},
-	{0x9e8b, 7679},
-	{0x9e8d, 0},
-	{0x9e8e, 1},
-	{0x9e8f, 2},
-	{0x9e90, 3},
-	{0x9e91, 4},
-	{0x9e92, 7680},
-	{0x9e93, 2651},
-	{0x9e95, 0},
-	{0x9e96, 1},
-	{0x9e97, 8207},
-	{0x9e99, 0},
-	{0x9e9a, 1},
-	{0x9e9b, 2},
-	{0x9e9c, 3},
-	{0x9e9d, 7682},
-	{0x9e9f, 7683},
-	{0x9ea1, 0},
-	{0x9ea2, 1},
-	{0x9ea3, 2},
-	{0x9ea4, 3},
-	{0x9ea5, 8305},
-	{0x9ea6, 2714},
-	{0x9ea8, 0},
-	{0x9ea9, 9719},
-	{0x9eab, 0},
-	{0x9eac, 1},
-	{0x9ead, 2},
-	{0x9eae, 3},
-	{0x9eaf, 9878},
-	{0x9eb1, 0},
-	{0x9eb2, 1},
-	{0x9eb3, 2},
-	{0x9eb4, 7406},
-	{0x9eb5, 9871},
-	{0x9eb7, 0},
-	{0x9eb8, 7405},
-	{0x9eba, 0},
-	{0x9ebb, 2704},
-	{0x9ebd, 7673},
-	{0x9ebe, 7674},
-	{0x9ec0, 0},
-	{0x9ec1, 1},
-	{0x9ec2, 2},
-	{0x9ec3, 3},
-	{0x9ec4, 2011},
-	{0x9ec6, 0},
-	{0x9ec7, 1},
-	{0x9ec8, 2},
-	{0x9ec9, 4856},
-	{0x9ecb, 0},
-	{0x9ecc, 8922},
-	{0x9ecd, 3465},
-	{0x9ece, 2515},
-	{0x9ecf, 6954},
-	{0x9ed1, 1937},
-	{0x9ed3, 0},
-	{0x9ed4, 3114},
-	{0x9ed6, 0},
-	{0x9ed7, 1},
-	{0x9ed8, 2831},
-	{0x9eda, 0},
-	{0x9edb, 7684},
-	{0x9edc, 7685},
-	{0x9edd, 7686},
-	{0x9ede, 7873},
-	{0x9edf, 7688},
-	{0x9ee0, 7687},
-	{0x9ee2, 7689},
-	{0x9ee4, 0},
-	{0x9ee5, 7692},
-	{0x9ee7, 7691},
-	{0x9ee8, 7859},
-	{0x9ee9, 7690},
-	{0x9eea, 7693},
-	{0x9eec, 0},
-	{0x9eed, 1},
-	{0x9eee, 2},
-	{0x9eef, 7694},
-	{0x9ef1, 0},
-	{0x9ef2, 9834},
-	{0x9ef4, 9866},
-	{0x9ef6, 0},
-	{0x9ef7, 9833},
-	{0x9ef9, 6741},
-	{0x9efb, 6742},
-	{0x9efc, 6743},
-	{0x9efd, 9752},
-	{0x9efe, 7542},
-	{0x9eff, 9753},
-	{0x9f01, 0},
-	{0x9f02, 1},
-	{0x9f03, 2},
-	{0x9f04, 3},
-	{0x9f05, 4},
-	{0x9f06, 5},
-	{0x9f07, 6},
-	{0x9f08, 7},
-	{0x9f09, 9754},
-	{0x9f0b, 7543},
-	{0x9f0d, 7544},
-	{0x9f0e, 1509},
-	{0x9f10, 4724},
-	{0x9f12, 0},
-	{0x9f13, 1821},
-	{0x9f15, 9843},
-	{0x9f17, 4721},
-	{0x9f19, 5087},
-	{0x9f1b, 0},
-	{0x9f1c, 1},
-	{0x9f1d, 2},
-	{0x9f1e, 3},
-	{0x9f1f, 4},
-	{0x9f20, 3466},
-	{0x9f22, 7695},
-	{0x9f24, 0},
-	{0x9f25, 1},
-	{0x9f26, 2},
-	{0x9f27, 3},
-	{0x9f28, 4},
-	{0x9f29, 5},
-	{0x9f2a, 6},
-	{0x9f2b, 7},
-	{0x9f2c, 7696},
-	{0x9f2e, 0},
-	{0x9f2f, 7697},
-	{0x9f31, 0},
-	{0x9f32, 1},
-	{0x9f33, 2},
-	{0x9f34, 3},
-	{0x9f35, 4},
-	{0x9f36, 5},
-	{0x9f37, 7699},
-	{0x9f39, 7698},
-	{0x9f3b, 1072},
-	{0x9f3d, 7700},
-	{0x9f3e, 7701},
-	{0x9f40, 0},
-	{0x9f41, 1},
-	{0x9f42, 2},
-	{0x9f43, 3},
-	{0x9f44, 7702},
-	{0x9f46, 0},
-	{0x9f47, 1},
-	{0x9f48, 2},
-	{0x9f49, 3},
-	{0x9f4a, 8390},
-	{0x9f4b, 8811},
-	{0x9f4d, 0},
-	{0x9f4e, 1},
-	{0x9f4f, 9427},
-	{0x9f50, 3082},
-	{0x9f51, 6594},
-	{0x9f52, 7814},
-	{0x9f54, 9743},
-	{0x9f56, 0},
-	{0x9f57, 1},
-	{0x9f58, 2},
-	{0x9f59, 9745},
-	{0x9f5b, 0},
-	{0x9f5c, 9747},
-	{0x9f5e, 0},
-	{0x9f5f, 9744},
-	{0x9f60, 9746},
-	{0x9f61, 8240},
-	{0x9f63, 9841},
-	{0x9f65, 0},
-	{0x9f66, 9748},
-	{0x9f68, 0},
-	{0x9f69, 1},
-	{0x9f6a, 9750},
-	{0x9f6c, 9749},
-	{0x9f6e, 0},
-	{0x9f6f, 1},
-	{0x9f70, 2},
-	{0x9f71, 3},
-	{0x9f72, 8434},
-	{0x9f74, 0},
-	{0x9f75, 1},
-	{0x9f76, 2},
-	{0x9f77, 9751},
-	{0x9f79, 0},
-	{0x9f7a, 1},
-	{0x9f7b, 2},
-	{0x9f7c, 3},
-	{0x9f7d, 4},
-	{0x9f7e, 5},
-	{0x9f7f, 1282},
-	{0x9f80, 7533},
-	{0x9f82, 0},
-	{0x9f83, 7534},
-	{0x9f84, 2605},
-	{0x9f85, 7535},
-	{0x9f86, 7536},
-	{0x9f87, 7537},
-	{0x9f88, 7538},
-	{0x9f89, 7539},
-	{0x9f8a, 7540},
-	{0x9f8b, 3198},
-	{0x9f8c, 7541},
-	{0x9f8d, 8247},
-	{0x9f8f, 0},
-	{0x9f90, 8371},
-	{0x9f92, 0},
-	{0x9f93, 1},
-	{0x9f94, 7970},
-	{0x9f95, 9453},
-	{0x9f97, 0},
-	{0x9f98, 1},
-	{0x9f99, 2627},
-	{0x9f9a, 1793},
-	{0x9f9b, 6740},
-	{0x9f9c, 7988},
-	{0x9f9e, 0},
-	{0x9f9f, 1859},
-	{0x9fa0, 4851},
-	{0x9fa2, 0},
-	{0x9fa3, 1},
-	{0x9fa4, 2},
-	{0x9fa5, 3},
-	{0xe817, 0},
-	{0xe818, 1},
-	{0xe82c, 0},
-	{0xe832, 0},
-	{0xe855, 0},
-	{0xfa0e, 0},
-	{0xfa0f, 1},
-	{0xfa14, 0},
-	{0xfa20, 0},
-	{0xfa21, 1},
-	{0xfa24, 0},
-	{0xfa28, 0},
-	{0xfa29, 1},
-	{0xfe4a, 0},
-	{0xfe4b, 1},
-	{0xfe4c, 2},
-	{0xfe4d, 3},
-	{0xfe4e, 4},
-	{0xfe4f, 5},
-	{0xfe50, 6},
-	{0xfe51, 7},
-	{0xfe52, 8},
-	{0xfe55, 0},
-	{0xfe56, 1},
-	{0xfe57, 2},
-	{0xfe5a, 0},
-	{0xfe5b, 1},
-	{0xfe5c, 2},
-	{0xfe5d, 3},
-	{0xfe5e, 4},
-	{0xfe5f, 5},
-	{0xfe60, 6},
-	{0xfe61, 7},
-	{0xfe62, 8},
-	{0xfe63, 9},
-	{0xfe64, 10},
-	{0xfe65, 11},
-	{0xfe66, 12},
-	{0xfe69, 0},
-	{0xfe6a, 1},
-	{0xfe6b, 2},
-	{0xff01, 262},
-	{0xff02, 263},
-	{0xff03, 264},
-	{0xff04, 166},
-	{0xff05, 266},
-	{0xff06, 267},
-	{0xff07, 268},
-	{0xff08, 269},
-	{0xff09, 270},
-	{0xff0a, 271},
-	{0xff0b, 272},
-	{0xff0c, 273},
-	{0xff0d, 274},
-	{0xff0e, 275},
-	{0xff0f, 276},
-	{0xff10, 277},
-	{0xff11, 278},
-	{0xff12, 279},
-	{0xff13, 280},
-	{0xff14, 281},
-	{0xff15, 282},
-	{0xff16, 283},
-	{0xff17, 284},
-	{0xff18, 285},
-	{0xff19, 286},
-	{0xff1a, 287},
-	{0xff1b, 288},
-	{0xff1c, 289},
-	{0xff1d, 290},
-	{0xff1e, 291},
-	{0xff1f, 292},
-	{0xff20, 293},
-	{0xff21, 294},
-	{0xff22, 295},
-	{0xff23, 296},
-	{0xff24, 297},
-	{0xff25, 298},
-	{0xff26, 299},
-	{0xff27, 300},
-	{0xff28, 301},
-	{0xff29, 302},
-	{0xff2a, 303},
-	{0xff2b, 304},
-	{0xff2c, 305},
-	{0xff2d, 306},
-	{0xff2e, 307},
-	{0xff2f, 308},
-	{0xff30, 309},
-	{0xff31, 310},
-	{0xff32, 311},
-	{0xff33, 312},
-	{0xff34, 313},
-	{0xff35, 314},
-	{0xff36, 315},
-	{0xff37, 316},
-	{0xff38, 317},
-	{0xff39, 318},
-	{0xff3a, 319},
-	{0xff3b, 320},
-	{0xff3c, 321},
-	{0xff3d, 322},
-	{0xff3e, 323},
-	{0xff3f, 324},
-	{0xff40, 325},
-	{0xff41, 326},
-	{0xff42, 327},
-	{0xff43, 328},
-	{0xff44, 329},
-	{0xff45, 330},
-	{0xff46, 331},
-	{0xff47, 332},
-	{0xff48, 333},
-	{0xff49, 334},
-	{0xff4a, 335},
-	{0xff4b, 336},
-	{0xff4c, 337},
-	{0xff4d, 338},
-	{0xff4e, 339},
-	{0xff4f, 340},
-	{0xff50, 341},
-	{0xff51, 342},
-	{0xff52, 343},
-	{0xff53, 344},
-	{0xff54, 345},
-	{0xff55, 346},
-	{0xff56, 347},
-	{0xff57, 348},
-	{0xff58, 349},
-	{0xff59, 350},
-	{0xff5a, 351},
-	{0xff5b, 352},
-	{0xff5c, 353},
-	{0xff5d, 354},
-	{0xff5e, 106},
-	{0xffe0, 168},
-	{0xffe1, 169},
-	{0xffe3, 355},
-	{0xffe5, 265}};
-
+// Coverage of the GB1 character collection: bit (u % 8) of byte
+// u / 8 is set if the Unicode code point u has a CID (23960 code points).
+static const uint8 GB1[8192] = {
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x37, 0x8c, 0x16,
+	0x02, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x15, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0xff, 0xfb, 0x03, 0xfe, 0xff, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x78, 0x33, 0x60, 0x00, 0x2d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x03,
+	0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x81, 0x22, 0xe4, 0xa9, 0x4f, 0xf0, 0x20, 0x00, 0x11, 0x04, 0x00, 0xf3, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x02, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xf0, 0xff,
+	0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
+	0xfe, 0xff, 0x38, 0x00, 0x03, 0x00, 0x0c, 0x30, 0xc0, 0xc8, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc8, 0xc4, 0x7f, 0xf2, 0x7f, 0x32, 0xa7, 0xe6, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
+	0xdf, 0xff, 0xbf, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff,
+	0xff, 0xf7, 0xfd, 0xff, 0xed, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0xfe, 0x0f,
+	0xaf, 0xff, 0xff, 0x60, 0xfe, 0x03, 0x30, 0x06, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x50, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x4f,
+	0xe0, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0x3f, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfc, 0x7f, 0xfe, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xe7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
+	0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93,
+	0x4b, 0xff, 0xff, 0x67, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe,
+	0xff, 0xff, 0xff, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xeb, 0x7f, 0x7b, 0x7f, 0xb7, 0xbd, 0x55, 0xef, 0xae, 0xfb, 0x5d, 0xfb, 0x7b, 0xfb, 0xeb, 0x7f,
+	0x77, 0xfb, 0xbe, 0xed, 0xf7, 0x7b, 0xaf, 0xef, 0xff, 0x6e, 0xfb, 0xfb, 0xba, 0xdd, 0xed, 0xae,
+	0xfa, 0xf7, 0xfb, 0xef, 0xf5, 0xee, 0x55, 0xb5, 0x6f, 0xff, 0xab, 0xff, 0xbd, 0xda, 0x5d, 0xdf,
+	0x5e, 0xab, 0xda, 0xae, 0xed, 0xd7, 0xbe, 0xff, 0xbe, 0xf7, 0xfb, 0xf5, 0x6b, 0xf7, 0xea, 0x75,
+	0x7d, 0xbb, 0xd6, 0xd7, 0x7a, 0x7f, 0xff, 0x57, 0xef, 0xdb, 0xbe, 0xd7, 0xbf, 0xdf, 0xff, 0xee,
+	0xbd, 0xbd, 0x7f, 0xfb, 0xaf, 0xbb, 0xbf, 0x6e, 0xb7, 0xfb, 0x7a, 0x77, 0xff, 0x7d, 0xaf, 0xeb,
+	0xd5, 0xeb, 0xb5, 0xfd, 0xfa, 0xf7, 0xf7, 0xde, 0x7b, 0xab, 0x77, 0xd7, 0xb7, 0x7b, 0xfb, 0xbb,
+	0xb7, 0xbb, 0xf7, 0xda, 0xb5, 0xdf, 0xef, 0xbe, 0xdd, 0xba, 0xfa, 0xaf, 0xdb, 0xaf, 0x6b, 0xbf,
+	0xef, 0x75, 0xf7, 0xaf, 0xdd, 0x6b, 0xed, 0xaf, 0xdf, 0xbe, 0x5b, 0x5f, 0xbb, 0xf6, 0xb6, 0xbf,
+	0xee, 0xb7, 0xeb, 0xef, 0xef, 0xbf, 0xef, 0xff, 0xea, 0xea, 0x75, 0xeb, 0xd6, 0xff, 0xbb, 0xf7,
+	0x7d, 0xbd, 0xfd, 0xb6, 0x6b, 0xf7, 0xfa, 0xef, 0xab, 0xf7, 0xfe, 0xd6, 0xdf, 0xea, 0xbb, 0xf5,
+	0x76, 0xbb, 0xbf, 0xb7, 0x6d, 0x7b, 0x57, 0xef, 0xee, 0xbf, 0xdb, 0xeb, 0x7d, 0xff, 0xef, 0xbb,
+	0x5a, 0xf7, 0xef, 0xee, 0xeb, 0xfb, 0xb6, 0x5b, 0x6d, 0xed, 0xfd, 0xdb, 0x57, 0xfd, 0xef, 0xbd,
+	0x55, 0xdf, 0x75, 0xaf, 0xdf, 0xbf, 0xda, 0xbd, 0xd7, 0xfb, 0xbf, 0xf6, 0xfa, 0x77, 0xef, 0xb7,
+	0xda, 0xfa, 0xdb, 0xef, 0xdd, 0xd6, 0xeb, 0xde, 0x5a, 0xf7, 0x6d, 0x5f, 0xfb, 0x76, 0xff, 0x5d,
+	0xdf, 0xef, 0xda, 0xbb, 0xfe, 0x56, 0xaf, 0x6a, 0xff, 0x7a, 0x5f, 0xb7, 0x7a, 0xdf, 0xee, 0x7e,
+	0x7b, 0xfb, 0xde, 0xdd, 0xde, 0xfa, 0x77, 0xeb, 0xfa, 0x7f, 0xdf, 0xbb, 0x75, 0xdf, 0x56, 0xdb,
+	0xfd, 0xde, 0xae, 0xfb, 0x6f, 0xfd, 0xde, 0xde, 0xb7, 0xd7, 0xdb, 0xee, 0xd7, 0xaf, 0xbb, 0xf7,
+	0xde, 0xaf, 0x6f, 0xdd, 0xee, 0xf7, 0xed, 0x6f, 0xf5, 0xf6, 0xfb, 0xfe, 0x5b, 0xaf, 0xee, 0xde,
+	0x7f, 0xdf, 0xef, 0xef, 0xdf, 0x6a, 0xd7, 0xfd, 0xef, 0xef, 0xb6, 0xb7, 0xdb, 0xbf, 0xde, 0xb7,
+	0xf5, 0xae, 0x7b, 0x7b, 0xdb, 0xf7, 0xbb, 0xff, 0xdf, 0xbf, 0xd6, 0x7d, 0xb7, 0xdf, 0xbf, 0x7b,
+	0xab, 0xf7, 0xef, 0xd7, 0xfe, 0x7b, 0xef, 0x5f, 0xbb, 0xfe, 0xab, 0xf7, 0xd5, 0xdb, 0x6d, 0xb7,
+	0xd6, 0xbe, 0x7e, 0xd7, 0xb6, 0xee, 0xda, 0x57, 0xd7, 0xeb, 0xfa, 0xf5, 0xb5, 0x57, 0x5f, 0xbb,
+	0xdf, 0xb5, 0xef, 0x7a, 0xbf, 0xef, 0xf6, 0x6b, 0x7f, 0xef, 0xdf, 0xb5, 0xaf, 0xdd, 0xff, 0xeb,
+	0xfa, 0xdb, 0xeb, 0xdd, 0xad, 0xfb, 0x57, 0xdf, 0x7b, 0xf7, 0xbf, 0xf7, 0xf7, 0xb6, 0xff, 0xf6,
+	0xfe, 0xff, 0xf7, 0xef, 0xff, 0xf6, 0xaf, 0x7d, 0xf7, 0xdb, 0xd7, 0xdd, 0x6b, 0xeb, 0xbb, 0xef,
+	0xfd, 0xdb, 0xff, 0xfa, 0xfb, 0xf7, 0xd5, 0xfd, 0xfd, 0xdf, 0xbb, 0xbf, 0x7e, 0xdf, 0xab, 0xb5,
+	0xbb, 0xdb, 0xae, 0x7f, 0x7f, 0xef, 0x7d, 0xfb, 0xf6, 0xde, 0xed, 0xff, 0xf6, 0x5b, 0x7d, 0xdf,
+	0xda, 0xef, 0x7a, 0xb5, 0xb7, 0xde, 0xdb, 0xff, 0xb7, 0xef, 0xbb, 0x7b, 0x7f, 0xdd, 0xfa, 0xf7,
+	0xf6, 0xbd, 0xdb, 0xdf, 0xef, 0xbb, 0xab, 0xbd, 0xda, 0xef, 0xf7, 0xfb, 0x7b, 0xb5, 0x5d, 0xaf,
+	0xee, 0x7e, 0xdf, 0x6e, 0xdf, 0x7a, 0xdf, 0x7f, 0xff, 0xde, 0xfd, 0xad, 0xff, 0xdb, 0xde, 0xff,
+	0xd7, 0xfe, 0xff, 0xba, 0xfd, 0xfe, 0xff, 0xd5, 0xbf, 0xaf, 0xd7, 0x6f, 0xf7, 0xeb, 0xdf, 0x7e,
+	0x6e, 0xdd, 0x7b, 0xbf, 0xff, 0x6e, 0xeb, 0xbd, 0xbd, 0xdf, 0xbf, 0xed, 0xee, 0xdf, 0x5f, 0xff,
+	0xdd, 0xee, 0xfb, 0xd6, 0xfd, 0xae, 0xef, 0x7b, 0xff, 0xf7, 0x6f, 0xef, 0xef, 0xd5, 0xdf, 0xf6,
+	0xdf, 0xed, 0xaa, 0xed, 0xfd, 0xb6, 0xaa, 0xd7, 0x7d, 0x5d, 0xed, 0xbb, 0x57, 0xb7, 0xeb, 0xda,
+	0xb7, 0xdf, 0xb7, 0x5b, 0xfb, 0x77, 0xbf, 0xba, 0x7f, 0xbb, 0xf7, 0xbb, 0xdb, 0x6e, 0xbb, 0xed,
+	0x7f, 0xf7, 0x76, 0xbb, 0xfb, 0xef, 0xbe, 0xdf, 0xee, 0xaf, 0xb5, 0xb7, 0xdf, 0xbf, 0x6d, 0xbf,
+	0xde, 0xbb, 0x57, 0xaf, 0x6d, 0xbd, 0x76, 0xdd, 0x7f, 0xef, 0xbb, 0xb5, 0xfb, 0xfb, 0x5f, 0xef,
+	0x7b, 0xfb, 0xbe, 0xdf, 0xdd, 0xee, 0xdf, 0xfe, 0xfe, 0x5d, 0xbb, 0xb5, 0xde, 0x6d, 0xed, 0xfe,
+	0xf7, 0x6f, 0xd7, 0xb7, 0xdf, 0x5b, 0xf7, 0x7e, 0xf7, 0xdf, 0xd7, 0xff, 0x6e, 0xfd, 0xf7, 0xd5,
+	0xfd, 0xfd, 0xf7, 0xed, 0xb6, 0x56, 0xdd, 0xfe, 0xeb, 0x7b, 0xdf, 0xed, 0xef, 0xfe, 0x6d, 0xdb,
+	0xdd, 0xf7, 0xef, 0xed, 0xb7, 0xdd, 0xbb, 0xbb, 0xf6, 0x77, 0xdd, 0xdf, 0xee, 0xfb, 0xda, 0xfe,
+	0xf6, 0x7b, 0x7b, 0xef, 0xbf, 0xed, 0xf6, 0x77, 0x6f, 0xfb, 0xbd, 0xff, 0xee, 0x6b, 0xf7, 0xee,
+	0xdd, 0xd7, 0x75, 0xfd, 0xad, 0x77, 0xdd, 0x55, 0x5d, 0xfb, 0x75, 0x77, 0xeb, 0x77, 0x57, 0xbd,
+	0xb7, 0xbf, 0xdd, 0x5e, 0x7b, 0xb7, 0x5f, 0xb7, 0xfa, 0xf5, 0xd7, 0xdd, 0xfe, 0xba, 0x6e, 0xef,
+	0xb7, 0xfd, 0x6f, 0xfb, 0xbe, 0x7b, 0xad, 0xdd, 0xb7, 0x6e, 0xd5, 0x75, 0x55, 0xdf, 0xd7, 0x5e,
+	0x5d, 0xfb, 0x56, 0xab, 0xbf, 0xdf, 0x7e, 0xeb, 0xbe, 0xdb, 0xfa, 0x6a, 0x6f, 0xdf, 0xb5, 0xfd,
+	0xef, 0xde, 0xab, 0xda, 0xba, 0xba, 0xfd, 0xba, 0x7b, 0xdf, 0xf6, 0xfe, 0xf5, 0xfb, 0xfb, 0xf6,
+	0x6d, 0xd7, 0xbe, 0xbb, 0xbd, 0xbd, 0x7a, 0x5f, 0xef, 0xdf, 0xfe, 0xb6, 0x5a, 0xfd, 0xdd, 0x76,
+	0xd7, 0xdb, 0xfb, 0xbe, 0xf7, 0x6d, 0xdf, 0x7b, 0xdf, 0xfa, 0x7f, 0xbb, 0x7d, 0xdb, 0xdd, 0xdb,
+	0xed, 0xaf, 0xbd, 0xae, 0xfe, 0xbd, 0xba, 0xb7, 0x6d, 0xdb, 0x6b, 0xdf, 0xbb, 0xb7, 0xaf, 0xde,
+	0xda, 0xea, 0xbd, 0x75, 0xaf, 0xad, 0xed, 0xfd, 0xdb, 0xff, 0xdf, 0x77, 0xb5, 0xdb, 0xdb, 0xbf,
+	0xbd, 0xdf, 0xea, 0xbe, 0xfb, 0xf7, 0xef, 0x7b, 0x7f, 0x57, 0xbb, 0xff, 0xff, 0xeb, 0xdf, 0xfe,
+	0x6b, 0xff, 0xee, 0xbd, 0xf6, 0xbd, 0xad, 0xff, 0xf5, 0xab, 0xf7, 0xf5, 0xed, 0x7e, 0xbb, 0xd7,
+	0xba, 0xef, 0xf5, 0xff, 0xdd, 0xbf, 0xdd, 0xbb, 0xf6, 0xf7, 0xdf, 0x76, 0x6d, 0x6d, 0xbb, 0xdb,
+	0xd5, 0xbb, 0xbf, 0xdd, 0xff, 0x6d, 0xdb, 0xee, 0xfa, 0x7f, 0xdd, 0xef, 0xfd, 0xbe, 0xef, 0xbf,
+	0xb6, 0xf7, 0xef, 0xfb, 0xea, 0xf5, 0xba, 0x77, 0xdf, 0xed, 0xfd, 0xeb, 0xb6, 0xff, 0xfb, 0xdb,
+	0xdd, 0x7b, 0xdb, 0xde, 0xed, 0xdb, 0xee, 0xed, 0xef, 0xff, 0xef, 0xef, 0xfe, 0xd5, 0xef, 0xed,
+	0xde, 0xf7, 0x76, 0x7f, 0xdf, 0xfe, 0xf7, 0x76, 0xef, 0xda, 0xfd, 0xfb, 0xfe, 0xf6, 0xf7, 0xdb,
+	0xdf, 0xae, 0x6f, 0x6d, 0xdb, 0xef, 0xbe, 0xee, 0x76, 0xaf, 0xfe, 0xea, 0xfb, 0xef, 0xae, 0xbb,
+	0xfe, 0xbd, 0x7b, 0xef, 0xde, 0xdf, 0xb5, 0xbd, 0xf7, 0xf6, 0xbd, 0xfe, 0xdb, 0xf7, 0x55, 0x7b,
+	0x6f, 0xdb, 0xdd, 0xeb, 0xfa, 0x6e, 0xef, 0xfb, 0xbe, 0xd7, 0xfd, 0x6e, 0xaf, 0xed, 0xeb, 0x7d,
+	0xda, 0x5e, 0xf7, 0x6e, 0xbf, 0x6e, 0xaf, 0x7b, 0xeb, 0xed, 0xde, 0x57, 0x6d, 0xf7, 0xde, 0xdb,
+	0xb7, 0x5b, 0xbb, 0xef, 0xdb, 0xef, 0xb6, 0xfd, 0xfd, 0xde, 0x7b, 0x7b, 0x5b, 0x5f, 0xeb, 0xde,
+	0xbe, 0x77, 0xdb, 0xb6, 0x7b, 0xbb, 0xd6, 0x75, 0xdf, 0x7f, 0x5f, 0xed, 0xfe, 0xef, 0xfe, 0xff,
+	0x6e, 0xfb, 0x7d, 0xbd, 0xb6, 0xf6, 0xd6, 0xae, 0xb7, 0xde, 0xba, 0xf6, 0x77, 0xdb, 0xd6, 0xfb,
+	0x76, 0xfb, 0xbe, 0xf7, 0xdd, 0xbf, 0x6e, 0xfd, 0xfa, 0xae, 0xdb, 0x5b, 0x57, 0xff, 0xd5, 0xd5,
+	0xdd, 0x7b, 0xff, 0xde, 0xdb, 0x7a, 0x6b, 0xfb, 0xef, 0xfb, 0xb7, 0xed, 0xdb, 0xef, 0xfb, 0x57,
+	0x7e, 0xeb, 0xba, 0xad, 0xed, 0xfd, 0xb5, 0x7b, 0xdf, 0xdf, 0xba, 0x7d, 0xdf, 0xbe, 0x7d, 0xdd,
+	0xbd, 0x77, 0x77, 0xbb, 0xff, 0xff, 0xea, 0xbb, 0xef, 0xf5, 0xfe, 0xeb, 0xde, 0xbb, 0xde, 0xba,
+	0xfe, 0xf7, 0x6d, 0xf7, 0x7b, 0xff, 0x7b, 0xff, 0xbf, 0x57, 0xf7, 0x5f, 0xd7, 0x5b, 0xef, 0xb5,
+	0xdf, 0xf7, 0xd6, 0xfb, 0xfd, 0xdd, 0xab, 0x7b, 0xeb, 0x7d, 0xb7, 0xdb, 0xfd, 0x7e, 0xdf, 0x5b,
+	0x7e, 0xbf, 0xfd, 0xaf, 0xff, 0xd5, 0xf7, 0xef, 0xfe, 0xbd, 0x77, 0xab, 0xf6, 0xfa, 0xb6, 0xf7,
+	0xdb, 0xaf, 0x76, 0xff, 0xf6, 0xbe, 0xdd, 0xfb, 0xdf, 0x7d, 0xf5, 0x7a, 0xfb, 0xfb, 0xdf, 0xbf,
+	0xea, 0x77, 0xef, 0x7e, 0xb7, 0x5f, 0xdb, 0xeb, 0xba, 0xbf, 0xf5, 0xfe, 0xfd, 0xbd, 0xb5, 0x5d,
+	0xdd, 0x6a, 0x7b, 0xef, 0xf6, 0xeb, 0xed, 0xee, 0xf5, 0xb7, 0xfb, 0x7b, 0xbd, 0xba, 0xf7, 0x7f,
+	0x6e, 0xf7, 0xfd, 0xef, 0x77, 0x55, 0x7d, 0xdf, 0xfa, 0xef, 0xbf, 0xde, 0xee, 0xb7, 0xfd, 0x7e,
+	0xeb, 0x6a, 0xfd, 0x5f, 0xef, 0xfb, 0xfd, 0xb7, 0xff, 0xf7, 0xd6, 0x57, 0x5d, 0xff, 0xde, 0xfe,
+	0xde, 0xbf, 0xea, 0xd7, 0xae, 0xbb, 0xaf, 0x6d, 0xbd, 0xdd, 0xde, 0xbf, 0x77, 0xef, 0x57, 0xfb,
+	0xee, 0xee, 0xd6, 0xb6, 0xbb, 0xdf, 0xbf, 0x7b, 0xbf, 0xb7, 0x77, 0x6b, 0xdf, 0xed, 0xdb, 0xdb,
+	0xaf, 0xbf, 0xbd, 0xeb, 0xf7, 0xae, 0xbd, 0xdd, 0xed, 0xba, 0x5f, 0xdd, 0xbe, 0xfa, 0xf7, 0x7d,
+	0xd7, 0x6d, 0x6b, 0xf7, 0xdf, 0x7f, 0xd7, 0xf5, 0x76, 0xf5, 0xd7, 0xed, 0xba, 0xfe, 0xd6, 0x5b,
+	0xda, 0xab, 0xff, 0xf7, 0x75, 0xbb, 0xfe, 0xd5, 0xeb, 0xfe, 0xfb, 0x6f, 0x6f, 0xdd, 0xff, 0xfb,
+	0xbd, 0x7f, 0xf7, 0xfd, 0xb5, 0xb6, 0xad, 0xbf, 0xfe, 0xbe, 0xff, 0xde, 0xaf, 0xfa, 0x6e, 0xfd,
+	0xf7, 0xbb, 0xd7, 0xb5, 0xee, 0xba, 0xdd, 0x5f, 0xad, 0x5e, 0xf5, 0xbe, 0xdf, 0xfd, 0xfe, 0xde,
+	0xff, 0x7a, 0xeb, 0xdd, 0xaa, 0xba, 0xdf, 0x57, 0xbb, 0xef, 0xbd, 0xf7, 0xef, 0xdd, 0xd6, 0xb6,
+	0xba, 0x7f, 0xef, 0x7b, 0x5f, 0xdf, 0xdb, 0x5f, 0x7b, 0xfb, 0xef, 0xfe, 0xb5, 0xbd, 0xfe, 0xf5,
+	0xbb, 0xf7, 0xfe, 0xf7, 0xff, 0x76, 0xeb, 0x6f, 0x6b, 0xab, 0xb7, 0xfd, 0xde, 0xaa, 0xfd, 0xad,
+	0x6d, 0x6f, 0xdf, 0x76, 0xed, 0x7f, 0xeb, 0xba, 0x7d, 0x7f, 0xfb, 0xfe, 0xf7, 0xeb, 0xdd, 0xf7,
+	0x5b, 0xbd, 0xf7, 0xbd, 0x7d, 0x77, 0x6f, 0xf7, 0xbe, 0xed, 0x7f, 0xfb, 0x6d, 0xb7, 0x7e, 0xb7,
+	0x5e, 0xed, 0xba, 0x6b, 0x7d, 0x5d, 0xeb, 0x55, 0xff, 0xda, 0x57, 0xad, 0xf5, 0x7e, 0xb7, 0x6a,
+	0xbd, 0xaf, 0xbd, 0xbe, 0xf7, 0xbf, 0xdb, 0xfd, 0xdb, 0xda, 0xeb, 0xb7, 0x7b, 0x77, 0xeb, 0x5e,
+	0xfd, 0xbe, 0x7e, 0xff, 0xea, 0xee, 0xff, 0xfd, 0xeb, 0xbf, 0xff, 0xdf, 0xdd, 0x57, 0xdf, 0xbf,
+	0xff, 0xfb, 0xb7, 0xfd, 0xb6, 0x77, 0xef, 0x7b, 0xbb, 0xb5, 0xff, 0xfa, 0xfd, 0xfd, 0x55, 0x6b,
+	0xf5, 0xaf, 0xbd, 0xde, 0xf7, 0xee, 0xef, 0xd7, 0x55, 0x7f, 0xfd, 0x7f, 0x77, 0x7d, 0xef, 0xfa,
+	0x6b, 0xfb, 0xee, 0x5f, 0x6f, 0x7f, 0xdf, 0xef, 0xde, 0xee, 0xd7, 0x7b, 0x6b, 0xdb, 0x56, 0xeb,
+	0xfe, 0xef, 0xfb, 0xef, 0xee, 0x6e, 0xf7, 0x6a, 0xfb, 0xfe, 0xb7, 0x77, 0xf7, 0xef, 0xed, 0x7b,
+	0xf7, 0xb5, 0x5e, 0xdd, 0xff, 0xbf, 0xef, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xef, 0xef, 0xff, 0xfd,
+	0xff, 0xfb, 0xfe, 0xbf, 0xff, 0xff, 0x7f, 0xf5, 0xb7, 0x5f, 0xbb, 0xf5, 0xf6, 0x77, 0xd7, 0x7a,
+	0x7b, 0x55, 0xdf, 0xf7, 0xba, 0xfa, 0xf5, 0xbb, 0xba, 0x57, 0xb7, 0xfd, 0x7b, 0x7b, 0xeb, 0xdb,
+	0x7b, 0xbf, 0xf5, 0xdb, 0xf5, 0x57, 0xeb, 0xad, 0x6e, 0xbf, 0x57, 0x75, 0xff, 0xf7, 0xef, 0xfa,
+	0xfd, 0xda, 0x6f, 0xbd, 0xb7, 0xef, 0xd6, 0xf6, 0x5f, 0x7f, 0xff, 0x7e, 0xbb, 0xbf, 0x5f, 0xb5,
+	0x76, 0xf7, 0x5f, 0x6d, 0xff, 0xdf, 0x76, 0x7b, 0x7f, 0x5d, 0x7b, 0xf7, 0xfb, 0x6a, 0xdb, 0xff,
+	0xf5, 0xf5, 0xfa, 0xbd, 0x6d, 0xf7, 0xef, 0xef, 0x6f, 0xb7, 0xfe, 0xf5, 0xed, 0xb5, 0xdf, 0x5f,
+	0xf7, 0xb7, 0xd5, 0xdf, 0xee, 0xbd, 0xfb, 0x6b, 0xdf, 0xea, 0xfe, 0xf7, 0x5e, 0xed, 0xdf, 0xf6,
+	0xd6, 0xed, 0xf6, 0xbb, 0x7a, 0xff, 0xdb, 0x6b, 0xdb, 0xfd, 0xbe, 0xdd, 0xfb, 0xee, 0xda, 0xea,
+	0xfe, 0xdb, 0xba, 0xde, 0xff, 0xbd, 0x7a, 0xd7, 0xed, 0xfa, 0xd7, 0xdf, 0xfb, 0xff, 0xfe, 0xbd,
+	0x7f, 0x77, 0x6f, 0x5d, 0xf5, 0xef, 0xdf, 0xb7, 0xbb, 0xd6, 0x5e, 0xbd, 0xbb, 0xf7, 0xf7, 0xbb,
+	0xda, 0xfe, 0xfa, 0xbd, 0xff, 0xdd, 0xbb, 0xbd, 0x7f, 0xfb, 0xf7, 0xde, 0x5b, 0xbb, 0xea, 0xf5,
+	0xf7, 0x5b, 0xdf, 0xda, 0xfb, 0xff, 0xd6, 0xb7, 0xdb, 0xaf, 0x6b, 0xbf, 0x6d, 0xdf, 0xfd, 0xbf,
+	0xfe, 0xdf, 0xdb, 0xf6, 0x6a, 0xbf, 0xff, 0xbf, 0x6b, 0x77, 0x6f, 0x7b, 0xd7, 0xb7, 0xd7, 0x6e,
+	0xbf, 0xd5, 0xda, 0xdf, 0x5e, 0xf7, 0xfd, 0xf6, 0xfb, 0xfb, 0xad, 0xbf, 0xbf, 0xf7, 0x5f, 0xef,
+	0xfe, 0xee, 0x7b, 0x77, 0xf7, 0xba, 0xff, 0xd5, 0xfe, 0xff, 0xbb, 0xd7, 0xf6, 0x5e, 0xfb, 0xff,
+	0xf7, 0xbf, 0xaf, 0xbf, 0xdf, 0xd7, 0x7b, 0xf7, 0xdd, 0xee, 0xdb, 0xeb, 0xde, 0x7b, 0xdf, 0x77,
+	0xed, 0xb7, 0xaf, 0x55, 0xaf, 0x7b, 0xdb, 0xee, 0xfe, 0x5b, 0xaf, 0xfa, 0x7d, 0x7f, 0x5d, 0x7d,
+	0xbf, 0xad, 0xef, 0xfe, 0xf6, 0xbd, 0xae, 0xaf, 0x5d, 0x6d, 0xef, 0xef, 0xad, 0xd7, 0x76, 0x6b,
+	0x6e, 0xf7, 0x6b, 0xef, 0xee, 0xff, 0x77, 0xdb, 0x7d, 0xb7, 0xdf, 0xaa, 0xbf, 0x5b, 0xf5, 0xfa,
+	0xb6, 0xad, 0x77, 0xdf, 0xd7, 0xaf, 0xfb, 0xde, 0x77, 0xf7, 0xb6, 0xbb, 0xbe, 0xfd, 0xdb, 0x7b,
+	0xf6, 0xf6, 0xed, 0xef, 0xbb, 0xef, 0x5d, 0xed, 0xdb, 0xfe, 0x7f, 0xff, 0x5d, 0xd7, 0xf6, 0xef,
+	0x6a, 0xef, 0x6e, 0xfd, 0x7b, 0xd7, 0xf6, 0xb6, 0xf7, 0xdf, 0x77, 0x57, 0x6f, 0xef, 0x5e, 0xfd,
+	0xef, 0x55, 0x6d, 0xad, 0xae, 0xb7, 0x5b, 0x77, 0x7b, 0x7d, 0xb5, 0x6d, 0x6f, 0x7b, 0xaf, 0xdb,
+	0xfe, 0xb6, 0xaf, 0x75, 0x7b, 0xdd, 0x75, 0xdb, 0xd6, 0xaa, 0xf6, 0x5e, 0xd7, 0x6e, 0xeb, 0x55,
+	0xb7, 0x76, 0xdd, 0xae, 0x7b, 0xbd, 0xef, 0x7b, 0xff, 0xfb, 0x7e, 0xd7, 0x7f, 0xdf, 0xdd, 0xbe,
+	0xfd, 0x77, 0x6f, 0x5f, 0xff, 0xef, 0xfd, 0xf7, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff,
+	0xff, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xdb, 0xbd, 0xf7, 0xf7, 0xef, 0xef, 0xf7,
+	0xb7, 0xd7, 0xdf, 0x7d, 0xf7, 0xdf, 0xdd, 0xbd, 0xbf, 0xf5, 0xaf, 0x57, 0xdf, 0xbe, 0xdf, 0x7f,
+	0xbe, 0xad, 0x7d, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7f, 0xdf, 0xae, 0xfd, 0xfe,
+	0xbb, 0xef, 0xbb, 0xfb, 0xee, 0xfd, 0xbf, 0xd5, 0x5e, 0xdf, 0xfa, 0xee, 0xde, 0xdd, 0xae, 0xaf,
+	0xbe, 0xd7, 0xdd, 0xff, 0xee, 0xd7, 0xba, 0xb7, 0xd7, 0xdf, 0xb7, 0xfb, 0x6f, 0xbb, 0x55, 0xd7,
+	0xba, 0xae, 0xdf, 0x57, 0x7b, 0xdf, 0xf6, 0xf7, 0xfd, 0x7f, 0xd7, 0xef, 0xde, 0xef, 0xf7, 0x5f,
+	0xae, 0xf6, 0xb7, 0xff, 0x7e, 0xf7, 0xee, 0xed, 0x76, 0x7b, 0xdf, 0xff, 0xd6, 0xfb, 0xff, 0xff,
+	0xfe, 0xef, 0xfb, 0xdf, 0x6e, 0xeb, 0x77, 0x7b, 0xb7, 0x7d, 0xbb, 0xfb, 0x76, 0x6f, 0xdd, 0xbb,
+	0x7f, 0xaf, 0xf7, 0xee, 0x6f, 0xff, 0x76, 0x5d, 0xd7, 0xee, 0xbf, 0x5d, 0xad, 0x7b, 0xb7, 0xb5,
+	0xdf, 0xed, 0xab, 0xaa, 0x6f, 0xd7, 0x7b, 0x6f, 0xbb, 0xf6, 0xeb, 0xbe, 0xf6, 0xad, 0xbe, 0x7d,
+	0x56, 0xfb, 0x57, 0x7b, 0xef, 0xbe, 0x57, 0xf7, 0x6f, 0xff, 0xf5, 0x76, 0xbf, 0xd7, 0xf7, 0xfb,
+	0xbe, 0xba, 0x77, 0xdf, 0xef, 0xff, 0xbe, 0xf7, 0xab, 0xfe, 0xbe, 0xbb, 0xdf, 0xfa, 0xbf, 0xf6,
+	0xdb, 0x7b, 0xbb, 0x7f, 0xef, 0x7e, 0xdd, 0xf7, 0xbd, 0xbb, 0xbb, 0x6e, 0x77, 0xbf, 0xdf, 0xed,
+	0xad, 0x7f, 0x6b, 0xd5, 0x6d, 0x5f, 0xfb, 0xda, 0xab, 0xdd, 0xf6, 0xbf, 0x7e, 0xf5, 0x7b, 0xdd,
+	0xfa, 0xfd, 0xb5, 0xef, 0x75, 0xed, 0x6e, 0x7d, 0xeb, 0xae, 0xdf, 0xed, 0xbf, 0xd7, 0x7d, 0x77,
+	0xd7, 0xf6, 0x7e, 0xfd, 0xef, 0x56, 0xad, 0xfd, 0xee, 0xb5, 0xfb, 0xfd, 0xd6, 0xfd, 0xbf, 0xfa,
+	0xee, 0xef, 0xdd, 0xbb, 0xfd, 0x7d, 0xaf, 0xf5, 0xde, 0xd7, 0xd7, 0xff, 0xad, 0xaf, 0xf5, 0xfa,
+	0xfe, 0xff, 0xbd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xf7, 0xfb, 0xbf, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0xdf, 0xf7, 0xf6, 0xdf, 0xfb, 0xfe, 0xbf, 0xef, 0xfe,
+	0x6d, 0xdb, 0xda, 0xfd, 0xbb, 0xbb, 0x77, 0xfb, 0x6e, 0xdd, 0x7d, 0x5f, 0xb7, 0xef, 0xff, 0x7f,
+	0x7f, 0xff, 0xf7, 0xb6, 0xf6, 0x77, 0x7f, 0xbf, 0xf5, 0xbb, 0xbd, 0xad, 0xde, 0xd7, 0xfd, 0xbd,
+	0x7f, 0xed, 0xbd, 0xdb, 0xff, 0xf5, 0x5b, 0x7b, 0xfb, 0xfa, 0x76, 0xdb, 0xed, 0xf7, 0xee, 0x6a,
+	0xdb, 0xfb, 0x6e, 0x5f, 0xff, 0xb6, 0xf5, 0x7b, 0xd7, 0xfd, 0x6f, 0x6f, 0xb7, 0xfb, 0x5f, 0xdf,
+	0xbf, 0xaf, 0xd6, 0xfd, 0x6d, 0xaf, 0xd6, 0xbf, 0x6f, 0xdb, 0xef, 0x5b, 0xff, 0xbe, 0x6f, 0xff,
+	0xee, 0xd5, 0xef, 0xdd, 0x5b, 0xbf, 0xfd, 0xad, 0x7f, 0x7f, 0xdf, 0x6b, 0xb7, 0xde, 0xfb, 0xff,
+	0xff, 0xb7, 0xdb, 0xfd, 0xf7, 0xfd, 0x6a, 0xdf, 0x5f, 0x7d, 0xaf, 0xef, 0xf5, 0xaf, 0xd6, 0x7f,
+	0xae, 0xb7, 0xef, 0x6d, 0xfb, 0x7d, 0xef, 0xde, 0xae, 0xdf, 0xb7, 0x5e, 0xaf, 0xff, 0xf7, 0xb6,
+	0xfb, 0xad, 0xff, 0xfb, 0xbf, 0x7d, 0xdb, 0xff, 0xfb, 0xff, 0xb7, 0xab, 0xf6, 0xbf, 0xfb, 0xff,
+	0xba, 0xff, 0x7e, 0xfb, 0xff, 0x6f, 0xfd, 0x7d, 0xbf, 0xb7, 0xbe, 0xee, 0xb6, 0xf7, 0xfb, 0xff,
+	0xf7, 0xdd, 0xef, 0xfd, 0xbf, 0xfd, 0xfb, 0xd5, 0xb7, 0xdf, 0x7e, 0xfd, 0x7a, 0xef, 0xfe, 0xeb,
+	0x6e, 0xbd, 0xee, 0xf7, 0xae, 0xfa, 0xf6, 0xdf, 0xbf, 0xfb, 0xda, 0xf5, 0xff, 0xff, 0xde, 0xfe,
+	0xeb, 0x7f, 0xf7, 0x77, 0xff, 0x6f, 0xff, 0xff, 0xfb, 0xf6, 0x5f, 0xaf, 0xd7, 0xed, 0xdd, 0xbf,
+	0xfe, 0xbb, 0xed, 0xff, 0xad, 0xbb, 0xaf, 0x6a, 0xbf, 0xfb, 0xd7, 0xbd, 0xfe, 0xbe, 0xff, 0xd5,
+	0xf6, 0x6d, 0xb7, 0xdf, 0xff, 0x6b, 0xff, 0xbd, 0xff, 0xfe, 0xfd, 0xfb, 0xb6, 0xdb, 0x5f, 0xff,
+	0xfe, 0xfa, 0xbf, 0xaf, 0x6e, 0xfd, 0xfd, 0xef, 0xf6, 0xff, 0xef, 0xbf, 0xfb, 0xd7, 0xf6, 0xff,
+	0xff, 0xfa, 0xef, 0xf5, 0xbf, 0xfb, 0xde, 0xdf, 0xd5, 0xff, 0xef, 0xf6, 0x7f, 0xff, 0xee, 0xf7,
+	0xfe, 0xdf, 0xbf, 0xef, 0x6f, 0xbf, 0xee, 0xf7, 0xfe, 0xdf, 0xba, 0x5d, 0xdf, 0xbf, 0xab, 0xf7,
+	0xf6, 0xed, 0xef, 0xbe, 0x7e, 0xfb, 0xbe, 0x6d, 0xdf, 0xfb, 0xda, 0xfd, 0xb5, 0xf7, 0xd6, 0xfa,
+	0xfe, 0x6b, 0xad, 0xfa, 0xf5, 0xdf, 0xfe, 0x6a, 0xdf, 0xef, 0xd7, 0xdb, 0x6b, 0xd7, 0xf7, 0xfe,
+	0xfd, 0xbf, 0xbd, 0xdf, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x01, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc0, 0x10, 0x00, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe7, 0xfc, 0x7f, 0x0e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00};
@@ -1,8478 +1,516 @@
 // WARNING: MACHINE GENERATED, DON'T CHANGE!
-static unicode_to_cid japanese[] = {
-	{0x20, 1},
-	{0x21, 2},
-	{0x22, 3},
-	{0x23, 4},
-	{0x24, 5},
-	{0x25, 6},
-	{0x26, 7},
-	{0x27, 8},
-	{0x28, 9},
-	{0x29, 10},
-	{0x2a, 11},
-	{0x2b, 12},
-	{0x2c, 13},
-	{0x2d, 14},
-	{0x2e, 15},
-	{0x2f, 16},
-	{0x30, 17},
-	{0x31, 18},
-	{0x32, 19},
-	{0x33, 20},
-	{0x34, 21},
-	{0x35, 22},
-	{0x36, 23},
-	{0x37, 24},
-	{0x38, 25},
-	{0x39, 26},
-	{0x3a, 27},
-	{0x3b, 28},
-	{0x3c, 29},
-	{0x3d, 30},
-	{0x3e, 31},
-	{0x3f, 32},
-	{0x40, 33},
-	{0x41, 34},
-	{0x42, 35},
-	{0x43, 36},
-	{0x44, 37},
-	{0x45, 38},
-	{0x46, 39},
-	{0x47, 40},
-	{0x48, 41},
-	{0x49, 42},
-	{0x4a, 43},
-	{0x4b, 44},
-	{0x4c, 45},
-	{0x4d, 46},
-	{0x4e, 47},
-	{0x4f, 48},
-	{0x50, 49},
-	{0x51, 50},
-	{0x52, 51},
-	{0x53, 52},
-	{0x54, 53},
-	{0x55, 54},
-	{0x56, 55},
-	{0x57, 56},
-	{0x58, 57},
-	{0x59, 58},
-	{0x5a, 59},
-	{0x5b, 60},
-	{0x5c, 97},
-	{0x5d, 62},
-	{0x5e, 63},
-	{0x5f, 64},
-	{0x60, 65},
-	{0x61, 66},
-	{0x62, 67},
-	{0x63, 68},
-	{0x64, 69},
-	{0x65, 70},
-	{0x66, 71},
-	{0x67, 72},
-	{0x68, 73},
-	{0x69, 74},
-	{0x6a, 75},
-	{0x6b, 76},
-	{0x6c, 77},
-	{0x6d, 78},
-	{0x6e, 79},
-	{0x6f, 80},
-	{0x70, 81},
-	{0x71, 82},
-	{0x72, 83},
-	{0x73, 84},
-	{0x74, 85},
-	{0x75, 86},
-	{0x76, 87},
-	{0x77, 88},
-	{0x78, 89},
-	{0x79, 90},
-	{0x7a, 91},
-	{0x7b, 92},
-	{0x7c, 93},
-	{0x7d, 94},
-	{0x7e, 95},
-	{0xa1, 101},
-	{0xa2, 102},
-	{0xa3, 103},
-	{0xa4, 107},
-	{0xa5, 61},
-	{0xa6, 99},
-	{0xa7, 720},
-	{0xa8, 647},
-	{0xa9, 152},
-	{0xaa, 140},
-	{0xab, 109},
-	{0xac, 153},
-	{0xad, 151},
-	{0xae, 154},
-	{0xaf, 129},
-	{0xb0, 707},
-	{0xb1, 694},
-	{0xb2, 157},
-	{0xb3, 158},
-	{0xb4, 645},
-	{0xb5, 159},
-	{0xb6, 778},
-	{0xb7, 117},
-	{0xb8, 134},
-	{0xb9, 160},
-	{0xba, 144},
-	{0xbb, 123},
-	{0xbc, 161},
-	{0xbd, 162},
-	{0xbe, 163},
-	{0xbf, 126},
-	{0xc0, 164},
-	{0xc1, 165},
-	{0xc2, 166},
-	{0xc3, 167},
-	{0xc4, 168},
-	{0xc5, 169},
-	{0xc6, 139},
-	{0xc7, 170},
-	{0xc8, 171},
-	{0xc9, 172},
-	{0xca, 173},
-	{0xcb, 174},
-	{0xcc, 175},
-	{0xcd, 176},
-	{0xce, 177},
-	{0xcf, 178},
-	{0xd0, 179},
-	{0xd1, 180},
-	{0xd2, 181},
-	{0xd3, 182},
-	{0xd4, 183},
-	{0xd5, 184},
-	{0xd6, 185},
-	{0xd7, 695},
-	{0xd8, 142},
-	{0xd9, 187},
-	{0xda, 188},
-	{0xdb, 189},
-	{0xdc, 190},
-	{0xdd, 191},
-	{0xde, 192},
-	{0xdf, 150},
-	{0xe0, 193},
-	{0xe1, 194},
-	{0xe2, 195},
-	{0xe3, 196},
-	{0xe4, 197},
-	{0xe5, 198},
-	{0xe6, 145},
-	{0xe7, 199},
-	{0xe8, 200},
-	{0xe9, 201},
-	{0xea, 202},
-	{0xeb, 203},
-	{0xec, 204},
-	{0xed, 205},
-	{0xee, 206},
-	{0xef, 207},
-	{0xf0, 208},
-	{0xf1, 209},
-	{0xf2, 210},
-	{0xf3, 211},
-	{0xf4, 212},
-	{0xf5, 213},
-	{0xf6, 214},
-	{0xf7, 696},
-	{0xf8, 148},
-	{0xf9, 216},
-	{0xfa, 217},
-	{0xfb, 218},
-	{0xfc, 219},
-	{0xfd, 220},
-	{0xfe, 221},
-	{0xff, 222},
-	{0x100, 9366},
-	{0x101, 9361},
-	{0x112, 9369},
-	{0x113, 9364},
-	{0x11a, 9395},
-	{0x11b, 9407},
-	{0x128, 9400},
-	{0x129, 9412},
-	{0x12a, 9367},
-	{0x12b, 9362},
-	{0x131, 146},
-	{0x141, 141},
-	{0x142, 147},
-	{0x14b, 9436},
-	{0x14c, 9370},
-	{0x14d, 9365},
-	{0x152, 143},
-	{0x153, 149},
-	{0x160, 223},
-	{0x161, 227},
-	{0x168, 9405},
-	{0x169, 9417},
-	{0x16a, 9368},
-	{0x16b, 9363},
-	{0x16e, 9404},
-	{0x16f, 9416},
-	{0x178, 224},
-	{0x17d, 225},
-	{0x17e, 229},
-	{0x1c0, 99},
-	{0x1cd, 9394},
-	{0x1ce, 9406},
-	{0x1cf, 9398},
-	{0x1d0, 9410},
-	{0x1d1, 9401},
-	{0x1d2, 9413},
-	{0x1d3, 9403},
-	{0x1d4, 9415},
-	{0x1fd, 9421},
-	{0x251, 9418},
-	{0x254, 9423},
-	{0x259, 9426},
-	{0x25a, 9429},
-	{0x25b, 9432},
-	{0x275, 9437},
-	{0x283, 9442},
-	{0x28c, 9438},
-	{0x292, 9441},
-	{0x2d0, 9443},
-	{0x300, 65},
-	{0x301, 127},
-	{0x302, 128},
-	{0x303, 95},
-	{0x304, 129},
-	{0x305, 226},
-	{0x306, 130},
-	{0x307, 131},
-	{0x308, 132},
-	{0x30a, 133},
-	{0x30b, 135},
-	{0x30c, 137},
-	{0x327, 134},
-	{0x328, 136},
-	{0x332, 64},
-	{0x336, 138},
-	{0x361, 758},
-	{0x391, 1011},
-	{0x392, 1012},
-	{0x393, 1013},
-	{0x394, 1014},
-	{0x395, 1015},
-	{0x396, 1016},
-	{0x397, 1017},
-	{0x398, 1018},
-	{0x399, 1019},
-	{0x39a, 1020},
-	{0x39b, 1021},
-	{0x39c, 1022},
-	{0x39d, 1023},
-	{0x39e, 1024},
-	{0x39f, 1025},
-	{0x3a0, 1026},
-	{0x3a1, 1027},
-	{0x3a3, 1028},
-	{0x3a4, 1029},
-	{0x3a5, 1030},
-	{0x3a6, 1031},
-	{0x3a7, 1032},
-	{0x3a8, 1033},
-	{0x3a9, 1034},
-	{0x3b1, 1035},
-	{0x3b2, 1036},
-	{0x3b3, 1037},
-	{0x3b4, 1038},
-	{0x3b5, 1039},
-	{0x3b6, 1040},
-	{0x3b7, 1041},
-	{0x3b8, 1042},
-	{0x3b9, 1043},
-	{0x3ba, 1044},
-	{0x3bb, 1045},
-	{0x3bc, 1046},
-	{0x3bd, 1047},
-	{0x3be, 1048},
-	{0x3bf, 1049},
-	{0x3c0, 1050},
-	{0x3c1, 1051},
-	{0x3c3, 1052},
-	{0x3c4, 1053},
-	{0x3c5, 1054},
-	{0x3c6, 1055},
-	{0x3c7, 1056},
-	{0x3c8, 1057},
-	{0x3c9, 1058},
-	{0x401, 1065},
-	{0x410, 1059},
-	{0x411, 1060},
-	{0x412, 1061},
-	{0x413, 1062},
-	{0x414, 1063},
-	{0x415, 1064},
-	{0x416, 1066},
-	{0x417, 1067},
-	{0x418, 1068},
-	{0x419, 1069},
-	{0x41a, 1070},
-	{0x41b, 1071},
-	{0x41c, 1072},
-	{0x41d, 1073},
-	{0x41e, 1074},
-	{0x41f, 1075},
-	{0x420, 1076},
-	{0x421, 1077},
-	{0x422, 1078},
-	{0x423, 1079},
-	{0x424, 1080},
-	{0x425, 1081},
-	{0x426, 1082},
-	{0x427, 1083},
-	{0x428, 1084},
-	{0x429, 1085},
-	{0x42a, 1086},
-	{0x42b, 1087},
-	{0x42c, 1088},
-	{0x42d, 1089},
-	{0x42e, 1090},
-	{0x42f, 1091},
-	{0x430, 1092},
-	{0x431, 1093},
-	{0x432, 1094},
-	{0x433, 1095},
-	{0x434, 1096},
-	{0x435, 1097},
-	{0x436, 1099},
-	{0x437, 1100},
-	{0x438, 1101},
-	{0x439, 1102},
-	{0x43a, 1103},
-	{0x43b, 1104},
-	{0x43c, 1105},
-	{0x43d, 1106},
-	{0x43e, 1107},
-	{0x43f, 1108},
-	{0x440, 1109},
-	{0x441, 1110},
-	{0x442, 1111},
-	{0x443, 1112},
-	{0x444, 1113},
-	{0x445, 1114},
-	{0x446, 1115},
-	{0x447, 1116},
-	{0x448, 1117},
-	{0x449, 1118},
-	{0x44a, 1119},
-	{0x44b, 1120},
-	{0x44c, 1121},
-	{0x44d, 1122},
-	{0x44e, 1123},
-	{0x44f, 1124},
-	{0x451, 1098},
-	{0x1ebc, 9397},
-	{0x1ebd, 9409},
-	{0x2002, 231},
-	{0x2003, 633},
-	{0x2010, 662},
-	{0x2011, 14},
-	{0x2012, 114},
-	{0x2013, 114},
-	{0x2014, 138},
-	{0x2015, 661},
-	{0x2016, 666},
-	{0x2018, 670},
-	{0x2019, 671},
-	{0x201a, 120},
-	{0x201c, 672},
-	{0x201d, 673},
-	{0x201e, 121},
-	{0x2020, 776},
-	{0x2021, 777},
-	{0x2022, 119},
-	{0x2025, 669},
-	{0x2026, 668},
-	{0x2030, 772},
-	{0x2032, 708},
-	{0x2033, 709},
-	{0x2039, 110},
-	{0x203a, 111},
-	{0x203b, 734},
-	{0x203e, 325},
-	{0x2044, 104},
-	{0x2070, 9377},
-	{0x2074, 9378},
-	{0x2075, 9379},
-	{0x2076, 9380},
-	{0x2077, 9381},
-	{0x2078, 9382},
-	{0x2079, 9383},
-	{0x2080, 9384},
-	{0x2081, 9385},
-	{0x2082, 9386},
-	{0x2083, 9387},
-	{0x2084, 9388},
-	{0x2085, 9389},
-	{0x2086, 9390},
-	{0x2087, 9391},
-	{0x2088, 9392},
-	{0x2089, 9393},
-	{0x20ac, 9354},
-	{0x20dd, 779},
-	{0x2103, 710},
-	{0x2109, 8305},
-	{0x210a, 8304},
-	{0x2113, 8025},
-	{0x2116, 7610},
-	{0x2121, 8055},
-	{0x2122, 228},
-	{0x2126, 9355},
-	{0x212b, 771},
-	{0x2153, 9375},
-	{0x2154, 9376},
-	{0x215b, 9371},
-	{0x215c, 9372},
-	{0x215d, 9373},
-	{0x215e, 9374},
-	{0x2160, 7575},
-	{0x2161, 7576},
-	{0x2162, 7577},
-	{0x2163, 7578},
-	{0x2164, 7579},
-	{0x2165, 7580},
-	{0x2166, 7581},
-	{0x2167, 7582},
-	{0x2168, 7583},
-	{0x2169, 7584},
-	{0x216a, 8225},
-	{0x216b, 8226},
-	{0x2170, 8092},
-	{0x2171, 8093},
-	{0x2172, 8094},
-	{0x2173, 8095},
-	{0x2174, 8096},
-	{0x2175, 8097},
-	{0x2176, 8098},
-	{0x2177, 8099},
-	{0x2178, 8100},
-	{0x2179, 8101},
-	{0x217a, 8298},
-	{0x217b, 8299},
-	{0x217f, 8303},
-	{0x2190, 737},
-	{0x2191, 738},
-	{0x2192, 736},
-	{0x2193, 739},
-	{0x2197, 0},
-	{0x2199, 0},
-	{0x21c4, 8310},
-	{0x21c5, 8311},
-	{0x21c6, 8309},
-	{0x21d2, 752},
-	{0x21d4, 753},
-	{0x21e6, 8013},
-	{0x21e7, 8012},
-	{0x21e8, 8014},
-	{0x21e9, 8011},
-	{0x2200, 754},
-	{0x2202, 759},
-	{0x2203, 755},
-	{0x2207, 760},
-	{0x2208, 741},
-	{0x220b, 742},
-	{0x2211, 7625},
-	{0x2212, 693},
-	{0x221a, 765},
-	{0x221d, 767},
-	{0x221e, 703},
-	{0x221f, 7629},
-	{0x2220, 756},
-	{0x2225, 666},
-	{0x2227, 749},
-	{0x2228, 750},
-	{0x2229, 748},
-	{0x222a, 747},
-	{0x222b, 769},
-	{0x222c, 770},
-	{0x222d, 8195},
-	{0x222e, 7624},
-	{0x2234, 704},
-	{0x2235, 768},
-	{0x223c, 665},
-	{0x223d, 766},
-	{0x2252, 762},
-	{0x2260, 698},
-	{0x2261, 761},
-	{0x2266, 701},
-	{0x2267, 702},
-	{0x226a, 763},
-	{0x226b, 764},
-	{0x2273, 0},
-	{0x2282, 745},
-	{0x2283, 746},
-	{0x2286, 743},
-	{0x2287, 744},
-	{0x22a5, 757},
-	{0x22bf, 7630},
-	{0x22ee, 7897},
-	{0x22ef, 668},
-	{0x2312, 758},
-	{0x2460, 7555},
-	{0x2461, 7556},
-	{0x2462, 7557},
-	{0x2463, 7558},
-	{0x2464, 7559},
-	{0x2465, 7560},
-	{0x2466, 7561},
-	{0x2467, 7562},
-	{0x2468, 7563},
-	{0x2469, 7564},
-	{0x246a, 7565},
-	{0x246b, 7566},
-	{0x246c, 7567},
-	{0x246d, 7568},
-	{0x246e, 7569},
-	{0x246f, 7570},
-	{0x2470, 7571},
-	{0x2471, 7572},
-	{0x2472, 7573},
-	{0x2473, 7574},
-	{0x2474, 8071},
-	{0x2475, 8072},
-	{0x2476, 8073},
-	{0x2477, 8074},
-	{0x2478, 8075},
-	{0x2479, 8076},
-	{0x247a, 8077},
-	{0x247b, 8078},
-	{0x247c, 8079},
-	{0x247d, 8080},
-	{0x247e, 8081},
-	{0x247f, 8082},
-	{0x2480, 8083},
-	{0x2481, 8084},
-	{0x2482, 8085},
-	{0x2483, 8086},
-	{0x2484, 8087},
-	{0x2485, 8088},
-	{0x2486, 8089},
-	{0x2487, 8090},
-	{0x2488, 8062},
-	{0x2489, 8063},
-	{0x248a, 8064},
-	{0x248b, 8065},
-	{0x248c, 8066},
-	{0x248d, 8067},
-	{0x248e, 8068},
-	{0x248f, 8069},
-	{0x2490, 8070},
-	{0x249c, 8112},
-	{0x249d, 8113},
-	{0x249e, 8114},
-	{0x249f, 8115},
-	{0x24a0, 8116},
-	{0x24a1, 8117},
-	{0x24a2, 8118},
-	{0x24a3, 8119},
-	{0x24a4, 8120},
-	{0x24a5, 8121},
-	{0x24a6, 8122},
-	{0x24a7, 8123},
-	{0x24a8, 8124},
-	{0x24a9, 8125},
-	{0x24aa, 8126},
-	{0x24ab, 8127},
-	{0x24ac, 8128},
-	{0x24ad, 8129},
-	{0x24ae, 8130},
-	{0x24af, 8131},
-	{0x24b0, 8132},
-	{0x24b1, 8133},
-	{0x24b2, 8134},
-	{0x24b3, 8135},
-	{0x24b4, 8136},
-	{0x24b5, 8137},
-	{0x24b7, 0},
-	{0x24b8, 1},
-	{0x24b9, 2},
-	{0x24ba, 3},
-	{0x24bb, 4},
-	{0x24bc, 5},
-	{0x24bd, 6},
-	{0x24be, 7},
-	{0x24bf, 8},
-	{0x24c0, 9},
-	{0x24c1, 10},
-	{0x24c2, 11},
-	{0x24c3, 12},
-	{0x24c4, 13},
-	{0x24c5, 14},
-	{0x24c6, 15},
-	{0x24c7, 16},
-	{0x24c8, 17},
-	{0x24c9, 18},
-	{0x24ca, 19},
-	{0x24cb, 20},
-	{0x24cc, 21},
-	{0x24cd, 22},
-	{0x24ce, 23},
-	{0x24cf, 24},
-	{0x24d1, 0},
-	{0x24d2, 1},
-	{0x24d3, 2},
-	{0x24d4, 3},
-	{0x24d5, 4},
-	{0x24d6, 5},
-	{0x24d7, 6},
-	{0x24d8, 7},
-	{0x24d9, 8},
-	{0x24da, 9},
-	{0x24db, 10},
-	{0x24dc, 11},
-	{0x24dd, 12},
-	{0x24de, 13},
-	{0x24df, 14},
-	{0x24e0, 15},
-	{0x24e1, 16},
-	{0x24e2, 17},
-	{0x24e3, 18},
-	{0x24e4, 19},
-	{0x24e5, 20},
-	{0x24e6, 21},
-	{0x24e7, 22},
-	{0x24e8, 23},
-	{0x24e9, 24},
-	{0x24ea, 8224},
-	{0x2500, 7479},
-	{0x2501, 7480},
-	{0x2502, 7481},
-	{0x2503, 7482},
-	{0x2504, 7483},
-	{0x2505, 7484},
-	{0x2506, 7485},
-	{0x2507, 7486},
-	{0x2508, 7487},
-	{0x2509, 7488},
-	{0x250a, 7489},
-	{0x250b, 7490},
-	{0x250c, 7491},
-	{0x250d, 7492},
-	{0x250e, 7493},
-	{0x250f, 7494},
-	{0x2510, 7495},
-	{0x2511, 7496},
-	{0x2512, 7497},
-	{0x2513, 7498},
-	{0x2514, 7499},
-	{0x2515, 7500},
-	{0x2516, 7501},
-	{0x2517, 7502},
-	{0x2518, 7503},
-	{0x2519, 7504},
-	{0x251a, 7505},
-	{0x251b, 7506},
-	{0x251c, 7507},
-	{0x251d, 7508},
-	{0x251e, 7509},
-	{0x251f, 7510},
-	{0x2520, 7511},
-	{0x2521, 7512},
-	{0x2522, 7513},
-	{0x2523, 7514},
-	{0x2524, 7515},
-	{0x2525, 7516},
-	{0x2526, 7517},
-	{0x2527, 7518},
-	{0x2528, 7519},
-	{0x2529, 7520},
-	{0x252a, 7521},
-	{0x252b, 7522},
-	{0x252c, 7523},
-	{0x252d, 7524},
-	{0x252e, 7525},
-	{0x252f, 7526},
-	{0x2530, 7527},
-	{0x2531, 7528},
-	{0x2532, 7529},
-	{0x2533, 7530},
-	{0x2534, 7531},
-	{0x2535, 7532},
-	{0x2536, 7533},
-	{0x2537, 7534},
-	{0x2538, 7535},
-	{0x2539, 7536},
-	{0x253a, 7537},
-	{0x253b, 7538},
-	{0x253c, 7539},
-	{0x253d, 7540},
-	{0x253e, 7541},
-	{0x253f, 7542},
-	{0x2540, 7543},
-	{0x2541, 7544},
-	{0x2542, 7545},
-	{0x2543, 7546},
-	{0x2544, 7547},
-	{0x2545, 7548},
-	{0x2546, 7549},
-	{0x2547, 7550},
-	{0x2548, 7551},
-	{0x2549, 7552},
-	{0x254a, 7553},
-	{0x254b, 7554},
-	{0x2550, 8251},
-	{0x255e, 8252},
-	{0x2561, 8254},
-	{0x256a, 8253},
-	{0x256d, 8247},
-	{0x256e, 8248},
-	{0x256f, 8250},
-	{0x2570, 8249},
-	{0x2571, 8261},
-	{0x2572, 8262},
-	{0x2573, 8263},
-	{0x2581, 8230},
-	{0x2582, 8231},
-	{0x2583, 8232},
-	{0x2584, 8233},
-	{0x2585, 8234},
-	{0x2586, 8235},
-	{0x2587, 8236},
-	{0x2588, 8237},
-	{0x2589, 8244},
-	{0x258a, 8243},
-	{0x258b, 8242},
-	{0x258c, 8241},
-	{0x258d, 8240},
-	{0x258e, 8239},
-	{0x258f, 8238},
-	{0x2594, 8245},
-	{0x2595, 8246},
-	{0x25a0, 729},
-	{0x25a1, 728},
-	{0x25a2, 8015},
-	{0x25b2, 731},
-	{0x25b3, 730},
-	{0x25b7, 8010},
-	{0x25bc, 733},
-	{0x25bd, 732},
-	{0x25c1, 8009},
-	{0x25c6, 727},
-	{0x25c7, 726},
-	{0x25c9, 8210},
-	{0x25cb, 723},
-	{0x25ce, 725},
-	{0x25cf, 724},
-	{0x25e2, 8255},
-	{0x25e3, 8256},
-	{0x25e4, 8258},
-	{0x25e5, 8257},
-	{0x25ef, 779},
-	{0x2600, 8215},
-	{0x2601, 8216},
-	{0x2602, 8217},
-	{0x2603, 8218},
-	{0x2605, 722},
-	{0x2606, 721},
-	{0x260e, 8056},
-	{0x261c, 8220},
-	{0x261d, 8221},
-	{0x261e, 8219},
-	{0x261f, 8222},
-	{0x2640, 706},
-	{0x2642, 705},
-	{0x2660, 8211},
-	{0x2661, 8017},
-	{0x2662, 8019},
-	{0x2663, 8213},
-	{0x2664, 8018},
-	{0x2665, 8212},
-	{0x2666, 8214},
-	{0x2667, 8016},
-	{0x2669, 0},
-	{0x266a, 775},
-	{0x266d, 774},
-	{0x266f, 773},
-	{0x2776, 8286},
-	{0x2777, 8287},
-	{0x2778, 8288},
-	{0x2779, 8289},
-	{0x277a, 8290},
-	{0x277b, 8291},
-	{0x277c, 8292},
-	{0x277d, 8293},
-	{0x277e, 8294},
-	{0x27a1, 8206},
-	{0x2e8d, 0},
-	{0x2e8e, 4209},
-	{0x2e90, 4646},
-	{0x2e92, 3762},
-	{0x2e93, 4739},
-	{0x2e94, 4779},
-	{0x2e99, 5059},
-	{0x2e9b, 5089},
-	{0x2e9f, 3644},
-	{0x2ea0, 3773},
-	{0x2ea2, 0},
-	{0x2eac, 2260},
-	{0x2ebf, 0},
-	{0x2ec0, 1},
-	{0x2ec1, 1931},
-	{0x2ec4, 2658},
-	{0x2ed1, 3029},
-	{0x2ed8, 2664},
-	{0x2ee4, 1614},
-	{0x2ee8, 3380},
-	{0x2ee9, 1323},
-	{0x2eeb, 2666},
-	{0x2eed, 2243},
-	{0x2eef, 3965},
-	{0x2ef2, 1615},
-	{0x2f00, 1200},
-	{0x2f01, 8371},
-	{0x2f02, 4095},
-	{0x2f03, 4097},
-	{0x2f04, 1333},
-	{0x2f05, 4102},
-	{0x2f06, 3275},
-	{0x2f07, 4110},
-	{0x2f08, 2579},
-	{0x2f09, 4208},
-	{0x2f0a, 3286},
-	{0x2f0b, 3392},
-	{0x2f0c, 4219},
-	{0x2f0d, 4227},
-	{0x2f0e, 4233},
-	{0x2f0f, 4243},
-	{0x2f10, 4248},
-	{0x2f11, 3163},
-	{0x2f12, 3991},
-	{0x2f13, 4294},
-	{0x2f14, 4301},
-	{0x2f15, 4302},
-	{0x2f16, 4307},
-	{0x2f17, 2375},
-	{0x2f18, 3708},
-	{0x2f19, 4316},
-	{0x2f1a, 4321},
-	{0x2f1b, 4328},
-	{0x2f1c, 3746},
-	{0x2f1d, 1969},
-	{0x2f1e, 4459},
-	{0x2f1f, 3156},
-	{0x2f20, 2204},
-	{0x2f21, 4538},
-	{0x2f22, 4539},
-	{0x2f23, 3878},
-	{0x2f24, 2887},
-	{0x2f25, 2433},
-	{0x2f26, 2208},
-	{0x2f27, 4622},
-	{0x2f28, 2631},
-	{0x2f29, 2454},
-	{0x2f2a, 4646},
-	{0x2f2b, 4648},
-	{0x2f2c, 4658},
-	{0x2f2d, 2177},
-	{0x2f2e, 4716},
-	{0x2f2f, 1979},
-	{0x2f30, 1918},
-	{0x2f31, 1738},
-	{0x2f32, 1519},
-	{0x2f33, 4739},
-	{0x2f34, 4741},
-	{0x2f35, 4761},
-	{0x2f36, 4763},
-	{0x2f37, 4768},
-	{0x2f38, 1655},
-	{0x2f3a, 4783},
-	{0x2f3b, 4785},
-	{0x2f3c, 2554},
-	{0x2f3d, 4930},
-	{0x2f3e, 1921},
-	{0x2f3f, 2326},
-	{0x2f40, 2215},
-	{0x2f41, 5058},
-	{0x2f42, 3592},
-	{0x2f43, 3143},
-	{0x2f44, 1740},
-	{0x2f45, 3661},
-	{0x2f46, 5088},
-	{0x2f47, 3284},
-	{0x2f48, 5132},
-	{0x2f49, 1860},
-	{0x2f4a, 3814},
-	{0x2f4b, 1853},
-	{0x2f4c, 2221},
-	{0x2f4d, 5349},
-	{0x2f4e, 5364},
-	{0x2f4f, 5368},
-	{0x2f50, 3450},
-	{0x2f51, 3807},
-	{0x2f52, 2223},
-	{0x2f53, 5378},
-	{0x2f54, 2603},
-	{0x2f55, 1360},
-	{0x2f56, 3066},
-	{0x2f57, 3541},
-	{0x2f58, 5604},
-	{0x2f59, 5606},
-	{0x2f5a, 3618},
-	{0x2f5b, 1383},
-	{0x2f5c, 1671},
-	{0x2f5d, 1880},
-	{0x2f5e, 1904},
-	{0x2f5f, 1732},
-	{0x2f60, 1245},
-	{0x2f61, 1504},
-	{0x2f62, 1537},
-	{0x2f63, 2652},
-	{0x2f64, 3899},
-	{0x2f65, 3134},
-	{0x2f66, 3479},
-	{0x2f68, 5783},
-	{0x2f69, 3368},
-	{0x2f6a, 3453},
-	{0x2f6b, 2172},
-	{0x2f6c, 3816},
-	{0x2f6d, 3779},
-	{0x2f6e, 3836},
-	{0x2f6f, 2676},
-	{0x2f70, 2260},
-	{0x2f72, 1363},
-	{0x2f73, 1856},
-	{0x2f74, 3953},
-	{0x2f75, 2971},
-	{0x2f76, 3606},
-	{0x2f77, 2227},
-	{0x2f78, 1544},
-	{0x2f79, 6163},
-	{0x2f7a, 3901},
-	{0x2f7b, 1227},
-	{0x2f7c, 4061},
-	{0x2f7d, 2261},
-	{0x2f7e, 6205},
-	{0x2f7f, 2262},
-	{0x2f80, 6227},
-	{0x2f81, 3281},
-	{0x2f82, 2569},
-	{0x2f83, 2263},
-	{0x2f84, 2232},
-	{0x2f85, 1235},
-	{0x2f86, 2697},
-	{0x2f87, 2726},
-	{0x2f88, 2360},
-	{0x2f89, 2081},
-	{0x2f8a, 2541},
-	{0x2f8b, 6322},
-	{0x2f8c, 6479},
-	{0x2f8d, 2988},
-	{0x2f8e, 1858},
-	{0x2f8f, 2022},
-	{0x2f90, 1189},
-	{0x2f91, 6635},
-	{0x2f92, 1887},
-	{0x2f93, 1455},
-	{0x2f94, 1908},
-	{0x2f95, 2921},
-	{0x2f96, 3198},
-	{0x2f97, 6742},
-	{0x2f98, 6745},
-	{0x2f99, 1419},
-	{0x2f9a, 2682},
-	{0x2f9b, 2808},
-	{0x2f9c, 2829},
-	{0x2f9d, 2574},
-	{0x2f9e, 2306},
-	{0x2f9f, 2575},
-	{0x2fa0, 2914},
-	{0x2fa2, 3874},
-	{0x2fa3, 3243},
-	{0x2fa4, 3428},
-	{0x2fa5, 3948},
-	{0x2fa6, 1754},
-	{0x2fa7, 3029},
-	{0x2fa8, 3827},
-	{0x2fa9, 3550},
-	{0x2faa, 7113},
-	{0x2fab, 7115},
-	{0x2fac, 1229},
-	{0x2fad, 8695},
-	{0x2fae, 3463},
-	{0x2faf, 3800},
-	{0x2fb0, 1461},
-	{0x2fb1, 7171},
-	{0x2fb2, 7173},
-	{0x2fb3, 1339},
-	{0x2fb4, 3607},
-	{0x2fb5, 3561},
-	{0x2fb6, 3464},
-	{0x2fb7, 2543},
-	{0x2fb8, 2335},
-	{0x2fb9, 2035},
-	{0x2fba, 3333},
-	{0x2fbb, 2062},
-	{0x2fbc, 2036},
-	{0x2fbd, 7276},
-	{0x2fbe, 7293},
-	{0x2fbf, 7299},
-	{0x2fc0, 7300},
-	{0x2fc1, 1614},
-	{0x2fc2, 1685},
-	{0x2fc3, 3031},
-	{0x2fc4, 7414},
-	{0x2fc5, 2267},
-	{0x2fc6, 7425},
-	{0x2fc7, 3729},
-	{0x2fc9, 1642},
-	{0x2fca, 2055},
-	{0x2fcb, 7446},
-	{0x2fcc, 7449},
-	{0x2fcd, 3102},
-	{0x2fce, 1937},
-	{0x2fcf, 2767},
-	{0x2fd0, 3475},
-	{0x2fd1, 7457},
-	{0x2fd2, 7458},
-	{0x2fd3, 3966},
-	{0x2fd4, 7472},
-	{0x2fd5, 7473},
-	{0x3000, 633},
-	{0x3001, 634},
-	{0x3002, 635},
-	{0x3003, 655},
-	{0x3004, 8308},
-	{0x3005, 657},
-	{0x3006, 658},
-	{0x3007, 659},
-	{0x3008, 682},
-	{0x3009, 683},
-	{0x300a, 684},
-	{0x300b, 685},
-	{0x300c, 686},
-	{0x300d, 687},
-	{0x300e, 688},
-	{0x300f, 689},
-	{0x3010, 690},
-	{0x3011, 691},
-	{0x3012, 735},
-	{0x3013, 740},
-	{0x3014, 676},
-	{0x3015, 677},
-	{0x301c, 665},
-	{0x301d, 7608},
-	{0x301f, 7609},
-	{0x3020, 8058},
-	{0x3034, 0},
-	{0x3035, 1},
-	{0x3036, 8057},
-	{0x3041, 842},
-	{0x3042, 843},
-	{0x3043, 844},
-	{0x3044, 845},
-	{0x3045, 846},
-	{0x3046, 847},
-	{0x3047, 848},
-	{0x3048, 849},
-	{0x3049, 850},
-	{0x304a, 851},
-	{0x304b, 852},
-	{0x304c, 853},
-	{0x304d, 854},
-	{0x304e, 855},
-	{0x304f, 856},
-	{0x3050, 857},
-	{0x3051, 858},
-	{0x3052, 859},
-	{0x3053, 860},
-	{0x3054, 861},
-	{0x3055, 862},
-	{0x3056, 863},
-	{0x3057, 864},
-	{0x3058, 865},
-	{0x3059, 866},
-	{0x305a, 867},
-	{0x305b, 868},
-	{0x305c, 869},
-	{0x305d, 870},
-	{0x305e, 871},
-	{0x305f, 872},
-	{0x3060, 873},
-	{0x3061, 874},
-	{0x3062, 875},
-	{0x3063, 876},
-	{0x3064, 877},
-	{0x3065, 878},
-	{0x3066, 879},
-	{0x3067, 880},
-	{0x3068, 881},
-	{0x3069, 882},
-	{0x306a, 883},
-	{0x306b, 884},
-	{0x306c, 885},
-	{0x306d, 886},
-	{0x306e, 887},
-	{0x306f, 888},
-	{0x3070, 889},
-	{0x3071, 890},
-	{0x3072, 891},
-	{0x3073, 892},
-	{0x3074, 893},
-	{0x3075, 894},
-	{0x3076, 895},
-	{0x3077, 896},
-	{0x3078, 897},
-	{0x3079, 898},
-	{0x307a, 899},
-	{0x307b, 900},
-	{0x307c, 901},
-	{0x307d, 902},
-	{0x307e, 903},
-	{0x307f, 904},
-	{0x3080, 905},
-	{0x3081, 906},
-	{0x3082, 907},
-	{0x3083, 908},
-	{0x3084, 909},
-	{0x3085, 910},
-	{0x3086, 911},
-	{0x3087, 912},
-	{0x3088, 913},
-	{0x3089, 914},
-	{0x308a, 915},
-	{0x308b, 916},
-	{0x308c, 917},
-	{0x308d, 918},
-	{0x308e, 919},
-	{0x308f, 920},
-	{0x3090, 921},
-	{0x3091, 922},
-	{0x3092, 923},
-	{0x3093, 924},
-	{0x3094, 7958},
-	{0x309b, 643},
-	{0x309c, 644},
-	{0x309d, 653},
-	{0x309e, 654},
-	{0x30a1, 925},
-	{0x30a2, 926},
-	{0x30a3, 927},
-	{0x30a4, 928},
-	{0x30a5, 929},
-	{0x30a6, 930},
-	{0x30a7, 931},
-	{0x30a8, 932},
-	{0x30a9, 933},
-	{0x30aa, 934},
-	{0x30ab, 935},
-	{0x30ac, 936},
-	{0x30ad, 937},
-	{0x30ae, 938},
-	{0x30af, 939},
-	{0x30b0, 940},
-	{0x30b1, 941},
-	{0x30b2, 942},
-	{0x30b3, 943},
-	{0x30b4, 944},
-	{0x30b5, 945},
-	{0x30b6, 946},
-	{0x30b7, 947},
-	{0x30b8, 948},
-	{0x30b9, 949},
-	{0x30ba, 950},
-	{0x30bb, 951},
-	{0x30bc, 952},
-	{0x30bd, 953},
-	{0x30be, 954},
-	{0x30bf, 955},
-	{0x30c0, 956},
-	{0x30c1, 957},
-	{0x30c2, 958},
-	{0x30c3, 959},
-	{0x30c4, 960},
-	{0x30c5, 961},
-	{0x30c6, 962},
-	{0x30c7, 963},
-	{0x30c8, 964},
-	{0x30c9, 965},
-	{0x30ca, 966},
-	{0x30cb, 967},
-	{0x30cc, 968},
-	{0x30cd, 969},
-	{0x30ce, 970},
-	{0x30cf, 971},
-	{0x30d0, 972},
-	{0x30d1, 973},
-	{0x30d2, 974},
-	{0x30d3, 975},
-	{0x30d4, 976},
-	{0x30d5, 977},
-	{0x30d6, 978},
-	{0x30d7, 979},
-	{0x30d8, 980},
-	{0x30d9, 981},
-	{0x30da, 982},
-	{0x30db, 983},
-	{0x30dc, 984},
-	{0x30dd, 985},
-	{0x30de, 986},
-	{0x30df, 987},
-	{0x30e0, 988},
-	{0x30e1, 989},
-	{0x30e2, 990},
-	{0x30e3, 991},
-	{0x30e4, 992},
-	{0x30e5, 993},
-	{0x30e6, 994},
-	{0x30e7, 995},
-	{0x30e8, 996},
-	{0x30e9, 997},
-	{0x30ea, 998},
-	{0x30eb, 999},
-	{0x30ec, 1000},
-	{0x30ed, 1001},
-	{0x30ee, 1002},
-	{0x30ef, 1003},
-	{0x30f0, 1004},
-	{0x30f1, 1005},
-	{0x30f2, 1006},
-	{0x30f3, 1007},
-	{0x30f4, 1008},
-	{0x30f5, 1009},
-	{0x30f6, 1010},
-	{0x30f7, 8313},
-	{0x30f8, 8314},
-	{0x30f9, 8315},
-	{0x30fa, 8316},
-	{0x30fb, 638},
-	{0x30fc, 660},
-	{0x30fd, 651},
-	{0x30fe, 652},
-	{0x3221, 0},
-	{0x3222, 1},
-	{0x3223, 2},
-	{0x3224, 3},
-	{0x3225, 4},
-	{0x3226, 5},
-	{0x3227, 6},
-	{0x3228, 7},
-	{0x3229, 8},
-	{0x322a, 8198},
-	{0x322b, 8199},
-	{0x322c, 8200},
-	{0x322d, 8201},
-	{0x322e, 8202},
-	{0x322f, 8203},
-	{0x3230, 8197},
-	{0x3231, 7618},
-	{0x3232, 7619},
-	{0x3233, 8143},
-	{0x3234, 8141},
-	{0x3235, 8148},
-	{0x3236, 8147},
-	{0x3237, 8204},
-	{0x3238, 8142},
-	{0x3239, 7620},
-	{0x323a, 8151},
-	{0x323b, 8149},
-	{0x323c, 8144},
-	{0x323d, 8139},
-	{0x323e, 8146},
-	{0x323f, 8140},
-	{0x3240, 8150},
-	{0x3241, 8205},
-	{0x3242, 8145},
-	{0x3243, 8138},
-	{0x3281, 0},
-	{0x3282, 1},
-	{0x3283, 2},
-	{0x3284, 3},
-	{0x3285, 4},
-	{0x3286, 5},
-	{0x3287, 6},
-	{0x3288, 7},
-	{0x3289, 8},
-	{0x328b, 0},
-	{0x328c, 1},
-	{0x328d, 2},
-	{0x328e, 3},
-	{0x328f, 4},
-	{0x3291, 8161},
-	{0x3292, 8160},
-	{0x3293, 8162},
-	{0x3294, 8156},
-	{0x3296, 8165},
-	{0x3298, 8158},
-	{0x3299, 8223},
-	{0x329d, 8319},
-	{0x329e, 8191},
-	{0x32a1, 0},
-	{0x32a4, 7613},
-	{0x32a5, 7614},
-	{0x32a6, 7615},
-	{0x32a7, 7616},
-	{0x32a8, 7617},
-	{0x32a9, 8154},
-	{0x32aa, 8157},
-	{0x32ab, 8159},
-	{0x32ac, 8163},
-	{0x32ad, 8153},
-	{0x32ae, 8164},
-	{0x32af, 8155},
-	{0x32b0, 8152},
-	{0x32d1, 0},
-	{0x32d2, 1},
-	{0x32d3, 2},
-	{0x32d4, 3},
-	{0x32d5, 4},
-	{0x32d6, 5},
-	{0x32d7, 6},
-	{0x32d8, 7},
-	{0x32d9, 8},
-	{0x32da, 9},
-	{0x32db, 10},
-	{0x32dc, 11},
-	{0x32dd, 12},
-	{0x32de, 13},
-	{0x32df, 14},
-	{0x32e0, 15},
-	{0x32e1, 16},
-	{0x32e2, 17},
-	{0x32e3, 18},
-	{0x32e4, 19},
-	{0x32e5, 20},
-	{0x32e6, 21},
-	{0x32e7, 22},
-	{0x32e8, 23},
-	{0x32e9, 24},
-	{0x32ea, 25},
-	{0x32eb, 26},
-	{0x32ec, 27},
-	{0x32ed, 28},
-	{0x32ee, 29},
-	{0x32ef, 30},
-	{0x32f0, 31},
-	{0x32f1, 32},
-	{0x32f2, 33},
-	{0x32f3, 34},
-	{0x32f4, 35},
-	{0x32f5, 36},
-	{0x32f6, 37},
-	{0x32f7, 38},
-	{0x32f8, 39},
-	{0x32f9, 40},
-	{0x32fa, 41},
-	{0x32fb, 42},
-	{0x32fc, 43},
-	{0x32fd, 44},
-	{0x32fe, 45},
-	{0x3300, 8048},
-	{0x3302, 0},
-	{0x3303, 8042},
-	{0x3305, 8183},
-	{0x330d, 7595},
-	{0x330f, 0},
-	{0x3310, 1},
-	{0x3311, 2},
-	{0x3312, 3},
-	{0x3313, 4},
-	{0x3314, 7586},
-	{0x3315, 8041},
-	{0x3316, 8039},
-	{0x3318, 8040},
-	{0x331b, 0},
-	{0x331c, 1},
-	{0x331d, 2},
-	{0x331e, 8051},
-	{0x3320, 0},
-	{0x3321, 1},
-	{0x3322, 8038},
-	{0x3323, 8043},
-	{0x3326, 7596},
-	{0x3327, 7590},
-	{0x3329, 0},
-	{0x332a, 8052},
-	{0x332b, 7598},
-	{0x332f, 0},
-	{0x3330, 1},
-	{0x3331, 8049},
-	{0x3333, 8327},
-	{0x3335, 0},
-	{0x3336, 7592},
-	{0x3339, 8046},
-	{0x333b, 8047},
-	{0x333f, 0},
-	{0x3340, 1},
-	{0x3342, 8045},
-	{0x3344, 0},
-	{0x3345, 1},
-	{0x3346, 2},
-	{0x3347, 8050},
-	{0x3349, 7585},
-	{0x334a, 7599},
-	{0x334c, 0},
-	{0x334d, 7588},
-	{0x334e, 8328},
-	{0x3350, 0},
-	{0x3351, 7593},
-	{0x3356, 0},
-	{0x3357, 8044},
-	{0x337b, 8323},
-	{0x337c, 7623},
-	{0x337d, 7622},
-	{0x337e, 7621},
-	{0x337f, 8054},
-	{0x3385, 8031},
-	{0x3386, 8032},
-	{0x3387, 8033},
-	{0x3388, 8192},
-	{0x3389, 8193},
-	{0x338e, 7604},
-	{0x338f, 7605},
-	{0x3390, 8035},
-	{0x3396, 8037},
-	{0x3397, 8024},
-	{0x3398, 8026},
-	{0x339c, 7601},
-	{0x339d, 7602},
-	{0x339e, 7603},
-	{0x339f, 8186},
-	{0x33a0, 8020},
-	{0x33a1, 7607},
-	{0x33a2, 8021},
-	{0x33a3, 8187},
-	{0x33a4, 8022},
-	{0x33a5, 8023},
-	{0x33a6, 8188},
-	{0x33b0, 8030},
-	{0x33b1, 8029},
-	{0x33b2, 8028},
-	{0x33b3, 8027},
-	{0x33c4, 7606},
-	{0x33c8, 8194},
-	{0x33cb, 8034},
-	{0x33cc, 8182},
-	{0x33cd, 7611},
-	{0x33d4, 8036},
-	{0x33d8, 0},
-	{0x4e00, 1200},
-	{0x4e01, 3000},
-	{0x4e03, 2275},
-	{0x4e05, 0},
-	{0x4e07, 3754},
-	{0x4e08, 2510},
-	{0x4e09, 2174},
-	{0x4e0a, 2509},
-	{0x4e0b, 1340},
-	{0x4e0d, 3526},
-	{0x4e0e, 3881},
-	{0x4e10, 4091},
-	{0x4e11, 1233},
-	{0x4e14, 1484},
-	{0x4e15, 4092},
-	{0x4e16, 2632},
-	{0x4e17, 4311},
-	{0x4e18, 1648},
-	{0x4e19, 3594},
-	{0x4e1e, 2511},
-	{0x4e21, 3974},
-	{0x4e26, 3602},
-	{0x4e28, 8371},
-	{0x4e2a, 4093},
-	{0x4e2d, 2980},
-	{0x4e30, 0},
-	{0x4e31, 4094},
-	{0x4e32, 1778},
-	{0x4e36, 4095},
-	{0x4e38, 1561},
-	{0x4e39, 2926},
-	{0x4e3b, 2323},
-	{0x4e3c, 4096},
-	{0x4e3f, 4097},
-	{0x4e41, 0},
-	{0x4e42, 4098},
-	{0x4e43, 3307},
-	{0x4e45, 1649},
-	{0x4e4b, 3309},
-	{0x4e4d, 3259},
-	{0x4e4e, 1911},
-	{0x4e4f, 3681},
-	{0x4e55, 6480},
-	{0x4e56, 4099},
-	{0x4e57, 2512},
-	{0x4e58, 4100},
-	{0x4e59, 1333},
-	{0x4e5d, 1757},
-	{0x4e5e, 1956},
-	{0x4e5f, 3829},
-	{0x4e62, 4659},
-	{0x4e71, 3930},
-	{0x4e73, 3285},
-	{0x4e7e, 1505},
-	{0x4e80, 1615},
-	{0x4e82, 4101},
-	{0x4e85, 4102},
-	{0x4e86, 3971},
-	{0x4e88, 3879},
-	{0x4e89, 2794},
-	{0x4e8a, 4104},
-	{0x4e8b, 2244},
-	{0x4e8c, 3275},
-	{0x4e8e, 4107},
-	{0x4e91, 1248},
-	{0x4e92, 1939},
-	{0x4e94, 1938},
-	{0x4e95, 1194},
-	{0x4e98, 4081},
-	{0x4e99, 4080},
-	{0x4e9b, 2083},
-	{0x4e9c, 1125},
-	{0x4e9e, 4108},
-	{0x4e9f, 4109},
-	{0x4ea0, 4110},
-	{0x4ea1, 3682},
-	{0x4ea2, 4111},
-	{0x4ea4, 1958},
-	{0x4ea5, 1195},
-	{0x4ea6, 3744},
-	{0x4ea8, 1686},
-	{0x4eab, 1687},
-	{0x4eac, 1688},
-	{0x4ead, 3070},
-	{0x4eae, 3972},
-	{0x4eb0, 4112},
-	{0x4eb3, 4113},
-	{0x4eb6, 4114},
-	{0x4eba, 2579},
-	{0x4ec0, 2372},
-	{0x4ec1, 2580},
-	{0x4ec2, 4119},
-	{0x4ec4, 4117},
-	{0x4ec6, 4118},
-	{0x4ec7, 1650},
-	{0x4eca, 2067},
-	{0x4ecb, 1392},
-	{0x4ecd, 4116},
-	{0x4ece, 4115},
-	{0x4ecf, 3577},
-	{0x4ed4, 2196},
-	{0x4ed5, 2195},
-	{0x4ed6, 2846},
-	{0x4ed7, 4120},
-	{0x4ed8, 3527},
-	{0x4ed9, 2699},
-	{0x4edd, 656},
-	{0x4ede, 4121},
-	{0x4edf, 4123},
-	{0x4ee1, 8372},
-	{0x4ee3, 2885},
-	{0x4ee4, 4009},
-	{0x4ee5, 1166},
-	{0x4eed, 4122},
-	{0x4eee, 1342},
-	{0x4ef0, 1724},
-	{0x4ef2, 2981},
-	{0x4ef6, 1861},
-	{0x4ef7, 4124},
-	{0x4efb, 3290},
-	{0x4efc, 8373},
-	{0x4f00, 8374},
-	{0x4f01, 1575},
-	{0x4f03, 8375},
-	{0x4f09, 4125},
-	{0x4f0a, 1167},
-	{0x4f0d, 1940},
-	{0x4f0e, 1576},
-	{0x4f0f, 3564},
-	{0x4f10, 3398},
-	{0x4f11, 1651},
-	{0x4f1a, 1393},
-	{0x4f1c, 4160},
-	{0x4f1d, 3131},
-	{0x4f2f, 3362},
-	{0x4f30, 4127},
-	{0x4f34, 3408},
-	{0x4f36, 4010},
-	{0x4f38, 2547},
-	{0x4f39, 8376},
-	{0x4f3a, 2197},
-	{0x4f3c, 2245},
-	{0x4f3d, 1344},
-	{0x4f43, 3053},
-	{0x4f46, 2912},
-	{0x4f47, 4131},
-	{0x4f4d, 1168},
-	{0x4f4e, 3071},
-	{0x4f4f, 2373},
-	{0x4f50, 2084},
-	{0x4f51, 3854},
-	{0x4f53, 2862},
-	{0x4f55, 1343},
-	{0x4f56, 8377},
-	{0x4f57, 4130},
-	{0x4f59, 3880},
-	{0x4f5a, 4126},
-	{0x4f5b, 4128},
-	{0x4f5c, 2142},
-	{0x4f5d, 4129},
-	{0x4f5e, 4563},
-	{0x4f69, 4137},
-	{0x4f6f, 4140},
-	{0x4f70, 4138},
-	{0x4f73, 1346},
-	{0x4f75, 3595},
-	{0x4f76, 4132},
-	{0x4f7b, 4136},
-	{0x4f7c, 1959},
-	{0x4f7e, 0},
-	{0x4f7f, 2198},
-	{0x4f83, 1506},
-	{0x4f86, 4141},
-	{0x4f88, 4133},
-	{0x4f8a, 8379},
-	{0x4f8b, 4011},
-	{0x4f8d, 2246},
-	{0x4f8f, 4134},
-	{0x4f91, 4139},
-	{0x4f92, 8378},
-	{0x4f94, 8381},
-	{0x4f96, 4142},
-	{0x4f98, 4135},
-	{0x4f9a, 8380},
-	{0x4f9b, 1689},
-	{0x4f9d, 1169},
-	{0x4fa0, 1690},
-	{0x4fa1, 1345},
-	{0x4fab, 4564},
-	{0x4fad, 3751},
-	{0x4fae, 3552},
-	{0x4faf, 1960},
-	{0x4fb5, 2549},
-	{0x4fb6, 3967},
-	{0x4fbf, 3624},
-	{0x4fc2, 1806},
-	{0x4fc3, 2821},
-	{0x4fc4, 1380},
-	{0x4fc9, 8364},
-	{0x4fca, 2397},
-	{0x4fcd, 8382},
-	{0x4fce, 4146},
-	{0x4fd0, 4151},
-	{0x4fd1, 4149},
-	{0x4fd4, 4144},
-	{0x4fd7, 2831},
-	{0x4fd8, 4147},
-	{0x4fda, 4150},
-	{0x4fdb, 4148},
-	{0x4fdd, 3629},
-	{0x4fdf, 4145},
-	{0x4fe0, 7660},
-	{0x4fe1, 2548},
-	{0x4fe3, 3745},
-	{0x4fe4, 4152},
-	{0x4fe5, 4153},
-	{0x4fee, 2350},
-	{0x4fef, 4166},
-	{0x4ff3, 3334},
-	{0x4ff5, 3496},
-	{0x4ff6, 4161},
-	{0x4ff8, 3648},
-	{0x4ffa, 1334},
-	{0x4ffe, 4165},
-	{0x4fff, 8385},
-	{0x5001, 0},
-	{0x5005, 4159},
-	{0x5006, 4168},
-	{0x5009, 2772},
-	{0x500b, 1912},
-	{0x500d, 3346},
-	{0x500f, 5632},
-	{0x5011, 4167},
-	{0x5012, 3159},
-	{0x5014, 4156},
-	{0x5016, 1962},
-	{0x5019, 1961},
-	{0x501a, 4154},
-	{0x501e, 8386},
-	{0x501f, 2310},
-	{0x5021, 4162},
-	{0x5022, 8384},
-	{0x5023, 3647},
-	{0x5024, 2955},
-	{0x5025, 4158},
-	{0x5026, 1863},
-	{0x5028, 4155},
-	{0x5029, 4163},
-	{0x502a, 4157},
-	{0x502b, 3993},
-	{0x502c, 4164},
-	{0x502d, 4071},
-	{0x5036, 1758},
-	{0x5039, 1862},
-	{0x5040, 8383},
-	{0x5042, 8389},
-	{0x5043, 4169},
-	{0x5046, 8387},
-	{0x5047, 4170},
-	{0x5048, 4174},
-	{0x5049, 1170},
-	{0x504f, 3616},
-	{0x5050, 4173},
-	{0x5055, 4172},
-	{0x5056, 4176},
-	{0x505a, 4175},
-	{0x505c, 3072},
-	{0x5065, 1864},
-	{0x506c, 4177},
-	{0x5070, 8388},
-	{0x5072, 2289},
-	{0x5074, 2822},
-	{0x5075, 3073},
-	{0x5076, 1774},
-	{0x5078, 4178},
-	{0x507d, 1616},
-	{0x5080, 4179},
-	{0x5085, 4181},
-	{0x508d, 3683},
-	{0x5091, 1852},
-	{0x5094, 8390},
-	{0x5098, 2175},
-	{0x5099, 3467},
-	{0x509a, 4180},
-	{0x50ac, 2101},
-	{0x50ad, 3885},
-	{0x50b2, 4183},
-	{0x50b3, 4186},
-	{0x50b4, 4182},
-	{0x50b5, 2100},
-	{0x50b7, 2439},
-	{0x50be, 1807},
-	{0x50c2, 4187},
-	{0x50c5, 1735},
-	{0x50c9, 4184},
-	{0x50ca, 4185},
-	{0x50cd, 3207},
-	{0x50cf, 2814},
-	{0x50d1, 1691},
-	{0x50d5, 3707},
-	{0x50d6, 4188},
-	{0x50d8, 8392},
-	{0x50da, 3973},
-	{0x50de, 4189},
-	{0x50e3, 4192},
-	{0x50e5, 4190},
-	{0x50e7, 2768},
-	{0x50ed, 4191},
-	{0x50ee, 4193},
-	{0x50f4, 8391},
-	{0x50f5, 4195},
-	{0x50f9, 4194},
-	{0x50fb, 3608},
-	{0x5100, 1617},
-	{0x5101, 4197},
-	{0x5102, 4198},
-	{0x5104, 1327},
-	{0x5109, 4196},
-	{0x5112, 2336},
-	{0x5114, 4201},
-	{0x5115, 4200},
-	{0x5116, 4199},
-	{0x5118, 4143},
-	{0x511a, 4202},
-	{0x511f, 2440},
-	{0x5121, 4203},
-	{0x512a, 3855},
-	{0x5132, 3813},
-	{0x5137, 4205},
-	{0x513a, 4204},
-	{0x513b, 4207},
-	{0x513c, 4206},
-	{0x513f, 4208},
-	{0x5140, 4209},
-	{0x5141, 1208},
-	{0x5143, 1897},
-	{0x5144, 1809},
-	{0x5145, 2374},
-	{0x5146, 3001},
-	{0x5147, 1692},
-	{0x5148, 2700},
-	{0x5149, 1963},
-	{0x514a, 8393},
-	{0x514b, 2048},
-	{0x514c, 4211},
-	{0x514d, 3796},
-	{0x514e, 3136},
-	{0x5150, 2247},
-	{0x5152, 4210},
-	{0x5154, 4212},
-	{0x515a, 3160},
-	{0x515c, 1491},
-	{0x5162, 4213},
-	{0x5164, 8394},
-	{0x5165, 3286},
-	{0x5168, 2742},
-	{0x5169, 4215},
-	{0x516a, 4216},
-	{0x516b, 3392},
-	{0x516c, 1964},
-	{0x516d, 4065},
-	{0x516e, 4217},
-	{0x5171, 1694},
-	{0x5175, 3596},
-	{0x5176, 2838},
-	{0x5177, 1769},
-	{0x5178, 3119},
-	{0x517c, 1865},
-	{0x5180, 4218},
-	{0x5182, 4219},
-	{0x5185, 3258},
-	{0x5186, 1281},
-	{0x5189, 4222},
-	{0x518a, 2157},
-	{0x518c, 4221},
-	{0x518d, 2102},
-	{0x518f, 4223},
-	{0x5190, 6235},
-	{0x5191, 4224},
-	{0x5192, 3695},
-	{0x5193, 4225},
-	{0x5195, 4226},
-	{0x5196, 4227},
-	{0x5197, 2513},
-	{0x5199, 2296},
-	{0x519d, 8395},
-	{0x51a0, 1507},
-	{0x51a2, 4230},
-	{0x51a4, 4228},
-	{0x51a5, 3785},
-	{0x51a6, 4229},
-	{0x51a8, 3532},
-	{0x51a9, 4231},
-	{0x51aa, 4232},
-	{0x51ab, 4233},
-	{0x51ac, 3161},
-	{0x51b0, 4237},
-	{0x51b1, 4235},
-	{0x51b2, 4236},
-	{0x51b3, 4234},
-	{0x51b4, 2131},
-	{0x51b5, 4238},
-	{0x51b6, 3830},
-	{0x51b7, 4012},
-	{0x51bd, 4239},
-	{0x51be, 8396},
-	{0x51c4, 2636},
-	{0x51c5, 4240},
-	{0x51c6, 2404},
-	{0x51c9, 4241},
-	{0x51cb, 3002},
-	{0x51cc, 3975},
-	{0x51cd, 3162},
-	{0x51d6, 4314},
-	{0x51db, 4242},
-	{0x51dc, 8284},
-	{0x51dd, 1725},
-	{0x51e0, 4243},
-	{0x51e1, 3724},
-	{0x51e6, 2418},
-	{0x51e7, 2908},
-	{0x51e9, 4245},
-	{0x51ea, 3260},
-	{0x51ec, 8397},
-	{0x51ed, 4246},
-	{0x51f0, 4247},
-	{0x51f1, 1420},
-	{0x51f5, 4248},
-	{0x51f6, 1695},
-	{0x51f8, 3236},
-	{0x51f9, 1308},
-	{0x51fa, 2394},
-	{0x51fd, 3381},
-	{0x51fe, 4249},
-	{0x5200, 3163},
-	{0x5202, 0},
-	{0x5203, 2581},
-	{0x5204, 4250},
-	{0x5206, 3580},
-	{0x5207, 2686},
-	{0x5208, 1502},
-	{0x520a, 1509},
-	{0x520b, 4251},
-	{0x520e, 4253},
-	{0x5211, 1808},
-	{0x5214, 4252},
-	{0x5215, 8398},
-	{0x5217, 4027},
-	{0x521d, 2419},
-	{0x5224, 3409},
-	{0x5225, 3612},
-	{0x5227, 4254},
-	{0x5229, 3938},
-	{0x522a, 4255},
-	{0x522e, 4256},
-	{0x5230, 3192},
-	{0x5233, 4257},
-	{0x5236, 2637},
-	{0x5237, 2158},
-	{0x5238, 1866},
-	{0x5239, 4258},
-	{0x523a, 2199},
-	{0x523b, 2049},
-	{0x5243, 3074},
-	{0x5244, 4260},
-	{0x5247, 2823},
-	{0x524a, 2143},
-	{0x524b, 4261},
-	{0x524c, 4262},
-	{0x524d, 2738},
-	{0x524f, 4259},
-	{0x5254, 4264},
-	{0x5256, 3684},
-	{0x525b, 2038},
-	{0x525d, 7774},
-	{0x525e, 4263},
-	{0x5263, 1867},
-	{0x5264, 2126},
-	{0x5265, 3363},
-	{0x5269, 4267},
-	{0x526a, 4265},
-	{0x526f, 3565},
-	{0x5270, 2514},
-	{0x5271, 4274},
-	{0x5272, 1474},
-	{0x5273, 4268},
-	{0x5274, 4266},
-	{0x5275, 2769},
-	{0x527d, 4270},
-	{0x527f, 4269},
-	{0x5283, 1442},
-	{0x5287, 1846},
-	{0x5288, 4275},
-	{0x5289, 3957},
-	{0x528d, 4271},
-	{0x5291, 4276},
-	{0x5292, 4273},
-	{0x5294, 4272},
-	{0x529b, 3991},
-	{0x529c, 8399},
-	{0x529f, 1965},
-	{0x52a0, 1347},
-	{0x52a3, 4028},
-	{0x52a6, 8400},
-	{0x52a9, 2431},
-	{0x52aa, 3154},
-	{0x52ab, 2039},
-	{0x52ac, 4279},
-	{0x52ad, 4280},
-	{0x52af, 8573},
-	{0x52b1, 4013},
-	{0x52b4, 4049},
-	{0x52b5, 4282},
-	{0x52b9, 1966},
-	{0x52bc, 4281},
-	{0x52be, 1421},
-	{0x52c0, 8401},
-	{0x52c1, 4283},
-	{0x52c3, 3716},
-	{0x52c5, 3032},
-	{0x52c7, 3856},
-	{0x52c9, 3625},
-	{0x52cd, 4284},
-	{0x52d2, 7150},
-	{0x52d5, 3208},
-	{0x52d7, 4285},
-	{0x52d8, 1510},
-	{0x52d9, 3775},
-	{0x52db, 8402},
-	{0x52dd, 2441},
-	{0x52de, 4286},
-	{0x52df, 3639},
-	{0x52e0, 4290},
-	{0x52e2, 2638},
-	{0x52e3, 4287},
-	{0x52e4, 1736},
-	{0x52e6, 4288},
-	{0x52e7, 1511},
-	{0x52f2, 1796},
-	{0x52f3, 4291},
-	{0x52f5, 4292},
-	{0x52f8, 4293},
-	{0x52f9, 4294},
-	{0x52fa, 2311},
-	{0x52fe, 1967},
-	{0x52ff, 3818},
-	{0x5300, 8403},
-	{0x5301, 3828},
-	{0x5302, 3279},
-	{0x5305, 3649},
-	{0x5306, 4295},
-	{0x5307, 8404},
-	{0x5308, 4296},
-	{0x530b, 0},
-	{0x530d, 4298},
-	{0x530f, 4300},
-	{0x5310, 4299},
-	{0x5315, 4301},
-	{0x5316, 1341},
-	{0x5317, 3706},
-	{0x5319, 2156},
-	{0x531a, 4302},
-	{0x531d, 2779},
-	{0x5320, 2442},
-	{0x5321, 1697},
-	{0x5323, 4303},
-	{0x5324, 8405},
-	{0x532a, 3439},
-	{0x532f, 4304},
-	{0x5331, 4305},
-	{0x5333, 4306},
-	{0x5338, 4307},
-	{0x5339, 3478},
-	{0x533a, 1760},
-	{0x533b, 1193},
-	{0x533f, 3223},
-	{0x5340, 4308},
-	{0x5341, 2375},
-	{0x5343, 2701},
-	{0x5345, 4310},
-	{0x5346, 4309},
-	{0x5347, 2443},
-	{0x5348, 1941},
-	{0x5349, 4312},
-	{0x534a, 3410},
-	{0x534d, 4313},
-	{0x5351, 3440},
-	{0x5352, 2836},
-	{0x5353, 2894},
-	{0x5354, 1696},
-	{0x5357, 3270},
-	{0x5358, 2927},
-	{0x535a, 3364},
-	{0x535c, 3708},
-	{0x535e, 4315},
-	{0x5360, 2702},
-	{0x5366, 1803},
-	{0x5369, 4316},
-	{0x536e, 4317},
-	{0x536f, 1230},
-	{0x5370, 1209},
-	{0x5371, 1577},
-	{0x5372, 8406},
-	{0x5373, 2824},
-	{0x5374, 1643},
-	{0x5375, 3931},
-	{0x5377, 4320},
-	{0x5378, 1335},
-	{0x537b, 4319},
-	{0x537f, 1698},
-	{0x5382, 4321},
-	{0x5384, 3837},
-	{0x5393, 8407},
-	{0x5396, 4322},
-	{0x5398, 3994},
-	{0x539a, 1968},
-	{0x539f, 1898},
-	{0x53a0, 4323},
-	{0x53a5, 4325},
-	{0x53a6, 4324},
-	{0x53a8, 2597},
-	{0x53a9, 1243},
-	{0x53ad, 1280},
-	{0x53ae, 4326},
-	{0x53b0, 4327},
-	{0x53b2, 8408},
-	{0x53b3, 1899},
-	{0x53b6, 4328},
-	{0x53bb, 1672},
-	{0x53c2, 2176},
-	{0x53c3, 4329},
-	{0x53c8, 3746},
-	{0x53c9, 2085},
-	{0x53ca, 1652},
-	{0x53cb, 3857},
-	{0x53cc, 2770},
-	{0x53cd, 3411},
-	{0x53ce, 2345},
-	{0x53d4, 2385},
-	{0x53d6, 2324},
-	{0x53d7, 2337},
-	{0x53d9, 2432},
-	{0x53db, 3412},
-	{0x53dd, 8409},
-	{0x53df, 4332},
-	{0x53e1, 1253},
-	{0x53e2, 2771},
-	{0x53e3, 1969},
-	{0x53e4, 1913},
-	{0x53e5, 1759},
-	{0x53e8, 4336},
-	{0x53e9, 2911},
-	{0x53ea, 2910},
-	{0x53eb, 1699},
-	{0x53ec, 2444},
-	{0x53ed, 4337},
-	{0x53ee, 4335},
-	{0x53ef, 1348},
-	{0x53f0, 2886},
-	{0x53f1, 2276},
-	{0x53f2, 2201},
-	{0x53f3, 1224},
-	{0x53f6, 1486},
-	{0x53f7, 2040},
-	{0x53f8, 2200},
-	{0x53fa, 4338},
-	{0x5401, 4339},
-	{0x5403, 1635},
-	{0x5404, 1444},
-	{0x5408, 2041},
-	{0x5409, 1634},
-	{0x540a, 3067},
-	{0x540b, 1223},
-	{0x540c, 3209},
-	{0x540d, 3786},
-	{0x540e, 1971},
-	{0x540f, 3939},
-	{0x5410, 3137},
-	{0x5411, 1970},
-	{0x541b, 1797},
-	{0x541d, 4348},
-	{0x541f, 1755},
-	{0x5420, 3704},
-	{0x5426, 3441},
-	{0x5429, 4347},
-	{0x542b, 1562},
-	{0x542c, 4342},
-	{0x542d, 4343},
-	{0x542e, 4345},
-	{0x5436, 4346},
-	{0x5438, 1653},
-	{0x5439, 2599},
-	{0x543b, 3581},
-	{0x543c, 4344},
-	{0x543d, 4340},
-	{0x543e, 1943},
-	{0x5440, 4341},
-	{0x5442, 4042},
-	{0x5446, 3650},
-	{0x5448, 3076},
-	{0x5449, 1942},
-	{0x544a, 2050},
-	{0x544e, 4349},
-	{0x5451, 3253},
-	{0x545f, 4353},
-	{0x5468, 2346},
-	{0x546a, 2338},
-	{0x5470, 4356},
-	{0x5471, 4354},
-	{0x5473, 3759},
-	{0x5475, 4351},
-	{0x5476, 4360},
-	{0x5477, 4355},
-	{0x547b, 4358},
-	{0x547c, 1914},
-	{0x547d, 3787},
-	{0x5480, 4359},
-	{0x5484, 4361},
-	{0x5486, 4363},
-	{0x548a, 8412},
-	{0x548b, 2144},
-	{0x548c, 4072},
-	{0x548e, 4352},
-	{0x548f, 4350},
-	{0x5490, 4362},
-	{0x5492, 4357},
-	{0x549c, 8411},
-	{0x54a2, 4365},
-	{0x54a4, 4374},
-	{0x54a5, 4367},
-	{0x54a8, 4371},
-	{0x54a9, 8413},
-	{0x54ab, 4372},
-	{0x54ac, 4368},
-	{0x54af, 4401},
-	{0x54b2, 2137},
-	{0x54b3, 1423},
-	{0x54b8, 4366},
-	{0x54bc, 4376},
-	{0x54bd, 1210},
-	{0x54be, 4375},
-	{0x54c0, 1129},
-	{0x54c1, 3516},
-	{0x54c2, 4373},
-	{0x54c4, 4369},
-	{0x54c7, 4364},
-	{0x54c8, 4370},
-	{0x54c9, 2104},
-	{0x54d8, 4377},
-	{0x54e1, 1211},
-	{0x54e2, 4386},
-	{0x54e5, 4378},
-	{0x54e6, 4379},
-	{0x54e8, 2445},
-	{0x54e9, 3735},
-	{0x54ed, 4384},
-	{0x54ee, 4383},
-	{0x54f2, 3113},
-	{0x54fa, 4385},
-	{0x54fd, 4382},
-	{0x54ff, 8414},
-	{0x5504, 1238},
-	{0x5506, 2086},
-	{0x5507, 2550},
-	{0x550f, 4380},
-	{0x5510, 3164},
-	{0x5514, 4381},
-	{0x5516, 1126},
-	{0x552e, 4391},
-	{0x552f, 3853},
-	{0x5531, 2447},
-	{0x5533, 4397},
-	{0x5538, 4396},
-	{0x5539, 4387},
-	{0x553e, 2851},
-	{0x5540, 4388},
-	{0x5544, 2895},
-	{0x5545, 4393},
-	{0x5546, 2446},
-	{0x554c, 4390},
-	{0x554f, 3824},
-	{0x5553, 1810},
-	{0x5556, 4394},
-	{0x5557, 4395},
-	{0x555c, 4392},
-	{0x555d, 4398},
-	{0x555e, 7633},
-	{0x5561, 0},
-	{0x5563, 4389},
-	{0x557b, 4404},
-	{0x557c, 4409},
-	{0x557e, 4405},
-	{0x5580, 4400},
-	{0x5583, 4410},
-	{0x5584, 2739},
-	{0x5586, 8415},
-	{0x5587, 4412},
-	{0x5589, 1972},
-	{0x558a, 4402},
-	{0x558b, 3003},
-	{0x5598, 4406},
-	{0x5599, 4399},
-	{0x559a, 1513},
-	{0x559c, 1578},
-	{0x559d, 1475},
-	{0x559e, 4407},
-	{0x559f, 4403},
-	{0x55a7, 1868},
-	{0x55a8, 4413},
-	{0x55a9, 4411},
-	{0x55aa, 2773},
-	{0x55ab, 1636},
-	{0x55ac, 1700},
-	{0x55ae, 4408},
-	{0x55b0, 1772},
-	{0x55b6, 1254},
-	{0x55c4, 4417},
-	{0x55c5, 4415},
-	{0x55c7, 4472},
-	{0x55d4, 4420},
-	{0x55da, 4414},
-	{0x55dc, 4418},
-	{0x55df, 4416},
-	{0x55e3, 2202},
-	{0x55e4, 4419},
-	{0x55f7, 4422},
-	{0x55f9, 4427},
-	{0x55fd, 4425},
-	{0x55fe, 4424},
-	{0x5606, 2928},
-	{0x5609, 1349},
-	{0x560f, 0},
-	{0x5614, 4421},
-	{0x5616, 4423},
-	{0x5617, 2448},
-	{0x5618, 1237},
-	{0x561b, 4426},
-	{0x5629, 1374},
-	{0x562f, 4437},
-	{0x5631, 2532},
-	{0x5632, 4433},
-	{0x5634, 4431},
-	{0x5636, 4432},
-	{0x5638, 4434},
-	{0x5642, 1247},
-	{0x564c, 2747},
-	{0x564e, 4428},
-	{0x5650, 4429},
-	{0x5653, 7963},
-	{0x565b, 1496},
-	{0x5664, 4436},
-	{0x5668, 1579},
-	{0x566a, 4439},
-	{0x566b, 4435},
-	{0x566c, 4438},
-	{0x5672, 0},
-	{0x5674, 3582},
-	{0x5678, 3245},
-	{0x567a, 3404},
-	{0x5680, 4441},
-	{0x5686, 4440},
-	{0x5687, 1443},
-	{0x568a, 4442},
-	{0x568f, 4445},
-	{0x5694, 4444},
-	{0x5699, 7654},
-	{0x56a0, 4443},
-	{0x56a2, 3311},
-	{0x56a5, 4446},
-	{0x56ad, 0},
-	{0x56ae, 4447},
-	{0x56b4, 4449},
-	{0x56b6, 4448},
-	{0x56bc, 4451},
-	{0x56c0, 4454},
-	{0x56c1, 4452},
-	{0x56c2, 4450},
-	{0x56c3, 4453},
-	{0x56c8, 4455},
-	{0x56ca, 7770},
-	{0x56ce, 4456},
-	{0x56d1, 4457},
-	{0x56d3, 4458},
-	{0x56d7, 4459},
-	{0x56d8, 4220},
-	{0x56da, 2344},
-	{0x56db, 2203},
-	{0x56de, 1395},
-	{0x56e0, 1212},
-	{0x56e3, 2946},
-	{0x56ee, 4460},
-	{0x56f0, 2068},
-	{0x56f2, 1171},
-	{0x56f3, 2596},
-	{0x56f9, 4461},
-	{0x56fa, 1915},
-	{0x56fd, 2051},
-	{0x56ff, 4463},
-	{0x5700, 4462},
-	{0x5703, 3632},
-	{0x5704, 4464},
-	{0x5708, 4466},
-	{0x5709, 4465},
-	{0x570b, 4467},
-	{0x570d, 4468},
-	{0x570f, 1869},
-	{0x5712, 1282},
-	{0x5713, 4469},
-	{0x5716, 4471},
-	{0x5718, 4470},
-	{0x571c, 4473},
-	{0x571f, 3156},
-	{0x5726, 4474},
-	{0x5727, 1145},
-	{0x5728, 2127},
-	{0x572d, 1811},
-	{0x5730, 2957},
-	{0x5734, 0},
-	{0x5737, 4475},
-	{0x5738, 4476},
-	{0x573b, 4478},
-	{0x5740, 4479},
-	{0x5742, 2132},
-	{0x5747, 1737},
-	{0x574a, 3685},
-	{0x574e, 4477},
-	{0x574f, 4480},
-	{0x5750, 2097},
-	{0x5751, 1973},
-	{0x5759, 8416},
-	{0x5761, 4484},
-	{0x5764, 2069},
-	{0x5765, 8417},
-	{0x5766, 2929},
-	{0x5769, 4481},
-	{0x576a, 3062},
-	{0x577f, 4485},
-	{0x5782, 2600},
-	{0x5788, 4483},
-	{0x5789, 4486},
-	{0x578b, 1813},
-	{0x5793, 4487},
-	{0x57a0, 4488},
-	{0x57a2, 1974},
-	{0x57a3, 1438},
-	{0x57a4, 4490},
-	{0x57aa, 4491},
-	{0x57ac, 8418},
-	{0x57b0, 4492},
-	{0x57b3, 4489},
-	{0x57c0, 4482},
-	{0x57c3, 4493},
-	{0x57c6, 4494},
-	{0x57c7, 8420},
-	{0x57c8, 8419},
-	{0x57cb, 3730},
-	{0x57ce, 2515},
-	{0x57d2, 4496},
-	{0x57d3, 4497},
-	{0x57d4, 4495},
-	{0x57d6, 4499},
-	{0x57dc, 3310},
-	{0x57df, 1196},
-	{0x57e0, 3528},
-	{0x57e3, 4500},
-	{0x57f4, 2533},
-	{0x57f6, 0},
-	{0x57f7, 2277},
-	{0x57f9, 3347},
-	{0x57fa, 1580},
-	{0x57fc, 2139},
-	{0x5800, 3719},
-	{0x5802, 3210},
-	{0x5805, 1870},
-	{0x5806, 2863},
-	{0x580a, 4498},
-	{0x580b, 4501},
-	{0x5815, 2852},
-	{0x5819, 4502},
-	{0x581d, 4503},
-	{0x5821, 4505},
-	{0x5824, 3077},
-	{0x582a, 1514},
-	{0x582f, 7474},
-	{0x5830, 1283},
-	{0x5831, 3651},
-	{0x5834, 2516},
-	{0x5835, 3138},
-	{0x583a, 2134},
-	{0x583d, 4511},
-	{0x5840, 3597},
-	{0x5841, 4005},
-	{0x584a, 1396},
-	{0x584b, 4507},
-	{0x5851, 2748},
-	{0x5852, 4510},
-	{0x5854, 3165},
-	{0x5857, 3139},
-	{0x5858, 3166},
-	{0x5859, 3405},
-	{0x585a, 3049},
-	{0x585e, 2105},
-	{0x5861, 7751},
-	{0x5862, 4506},
-	{0x5869, 1304},
-	{0x586b, 3120},
-	{0x5870, 4508},
-	{0x5872, 4504},
-	{0x5875, 2582},
-	{0x5879, 4512},
-	{0x587e, 2392},
-	{0x5883, 1701},
-	{0x5885, 4513},
-	{0x5893, 3640},
-	{0x5897, 2815},
-	{0x589c, 3042},
-	{0x589e, 8423},
-	{0x589f, 4515},
-	{0x58a8, 3709},
-	{0x58ab, 4516},
-	{0x58ae, 4521},
-	{0x58b2, 8424},
-	{0x58b3, 3583},
-	{0x58b8, 4520},
-	{0x58b9, 4514},
-	{0x58ba, 4517},
-	{0x58bb, 4519},
-	{0x58be, 2070},
-	{0x58c1, 3609},
-	{0x58c5, 4522},
-	{0x58c7, 2947},
-	{0x58ca, 1397},
-	{0x58cc, 2517},
-	{0x58d1, 4524},
-	{0x58d3, 4523},
-	{0x58d5, 2042},
-	{0x58d7, 4525},
-	{0x58d8, 4527},
-	{0x58d9, 4526},
-	{0x58dc, 4529},
-	{0x58de, 4518},
-	{0x58df, 4531},
-	{0x58e4, 4530},
-	{0x58e5, 4528},
-	{0x58eb, 2204},
-	{0x58ec, 2583},
-	{0x58ee, 2774},
-	{0x58ef, 4532},
-	{0x58f0, 2656},
-	{0x58f1, 1201},
-	{0x58f2, 3354},
-	{0x58f7, 3063},
-	{0x58f9, 4534},
-	{0x58fa, 4533},
-	{0x58fb, 4535},
-	{0x58fc, 4536},
-	{0x58fd, 4537},
-	{0x5902, 4538},
-	{0x5909, 3617},
-	{0x590a, 4539},
-	{0x590b, 8425},
-	{0x590f, 1350},
-	{0x5910, 4540},
-	{0x5915, 3878},
-	{0x5916, 1422},
-	{0x5918, 4318},
-	{0x5919, 2386},
-	{0x591a, 2847},
-	{0x591b, 4541},
-	{0x591c, 3831},
-	{0x5922, 3776},
-	{0x5925, 4543},
-	{0x5927, 2887},
-	{0x5929, 3121},
-	{0x592a, 2848},
-	{0x592b, 3529},
-	{0x592c, 4544},
-	{0x592d, 4545},
-	{0x592e, 1309},
-	{0x5931, 2278},
-	{0x5932, 4546},
-	{0x5937, 1172},
-	{0x5938, 4547},
-	{0x593e, 4548},
-	{0x5944, 1284},
-	{0x5947, 1581},
-	{0x5948, 3256},
-	{0x5949, 3652},
-	{0x594e, 4552},
-	{0x594f, 2775},
-	{0x5950, 4551},
-	{0x5951, 1814},
-	{0x5953, 8426},
-	{0x5954, 3721},
-	{0x5955, 4550},
-	{0x5957, 3167},
-	{0x5958, 4554},
-	{0x595a, 4553},
-	{0x595b, 8427},
-	{0x595d, 8428},
-	{0x5960, 4556},
-	{0x5962, 4555},
-	{0x5963, 8429},
-	{0x5965, 1310},
-	{0x5967, 4557},
-	{0x5968, 2449},
-	{0x5969, 4559},
-	{0x596a, 2915},
-	{0x596c, 4558},
-	{0x596e, 3587},
-	{0x5973, 2433},
-	{0x5974, 3157},
-	{0x5978, 4560},
-	{0x597d, 1975},
-	{0x5981, 4561},
-	{0x5982, 3287},
-	{0x5983, 3442},
-	{0x5984, 3805},
-	{0x598a, 3291},
-	{0x598d, 4570},
-	{0x5993, 1618},
-	{0x5996, 3887},
-	{0x5999, 3771},
-	{0x599b, 4665},
-	{0x599d, 4562},
-	{0x59a3, 4565},
-	{0x59a4, 8430},
-	{0x59a5, 2853},
-	{0x59a8, 3686},
-	{0x59ac, 3140},
-	{0x59b2, 4566},
-	{0x59b9, 3731},
-	{0x59ba, 8431},
-	{0x59bb, 2106},
-	{0x59be, 2450},
-	{0x59c6, 4567},
-	{0x59c9, 2206},
-	{0x59cb, 2205},
-	{0x59d0, 1149},
-	{0x59d1, 1916},
-	{0x59d3, 2639},
-	{0x59d4, 1173},
-	{0x59d9, 4571},
-	{0x59da, 4572},
-	{0x59dc, 4569},
-	{0x59e4, 0},
-	{0x59e5, 1242},
-	{0x59e6, 1515},
-	{0x59e8, 4568},
-	{0x59ea, 3793},
-	{0x59eb, 3491},
-	{0x59f6, 1132},
-	{0x59fb, 1213},
-	{0x59ff, 2207},
-	{0x5a01, 1174},
-	{0x5a03, 1127},
-	{0x5a09, 4577},
-	{0x5a11, 4575},
-	{0x5a18, 3784},
-	{0x5a1a, 4578},
-	{0x5a1c, 4576},
-	{0x5a1f, 4574},
-	{0x5a20, 2551},
-	{0x5a25, 4573},
-	{0x5a29, 3626},
-	{0x5a2f, 1944},
-	{0x5a35, 4582},
-	{0x5a36, 4583},
-	{0x5a3c, 2451},
-	{0x5a40, 4579},
-	{0x5a41, 4050},
-	{0x5a46, 3330},
-	{0x5a49, 4581},
-	{0x5a5a, 2071},
-	{0x5a62, 4584},
-	{0x5a66, 3530},
-	{0x5a6a, 4585},
-	{0x5a6c, 4580},
-	{0x5a7f, 3783},
-	{0x5a92, 3348},
-	{0x5a9a, 4586},
-	{0x5a9b, 3492},
-	{0x5abc, 4587},
-	{0x5abd, 4591},
-	{0x5abe, 4588},
-	{0x5ac1, 1351},
-	{0x5ac2, 4590},
-	{0x5ac9, 2279},
-	{0x5acb, 4589},
-	{0x5acc, 1871},
-	{0x5ad0, 4603},
-	{0x5ad6, 4596},
-	{0x5ad7, 4593},
-	{0x5ae1, 2978},
-	{0x5ae3, 4592},
-	{0x5ae6, 4594},
-	{0x5ae9, 4595},
-	{0x5afa, 4597},
-	{0x5afb, 4598},
-	{0x5b09, 1582},
-	{0x5b0b, 4600},
-	{0x5b0c, 4599},
-	{0x5b16, 4601},
-	{0x5b22, 2518},
-	{0x5b2a, 4604},
-	{0x5b2c, 3064},
-	{0x5b30, 1255},
-	{0x5b32, 4602},
-	{0x5b36, 4605},
-	{0x5b3e, 4606},
-	{0x5b40, 4609},
-	{0x5b43, 4607},
-	{0x5b45, 4608},
-	{0x5b50, 2208},
-	{0x5b51, 4610},
-	{0x5b54, 1976},
-	{0x5b55, 4611},
-	{0x5b56, 8432},
-	{0x5b57, 2248},
-	{0x5b58, 2840},
-	{0x5b5a, 4612},
-	{0x5b5b, 4613},
-	{0x5b5c, 2216},
-	{0x5b5d, 1977},
-	{0x5b5f, 3806},
-	{0x5b63, 1602},
-	{0x5b64, 1917},
-	{0x5b65, 4614},
-	{0x5b66, 1462},
-	{0x5b69, 4615},
-	{0x5b6b, 2841},
-	{0x5b70, 4616},
-	{0x5b71, 4656},
-	{0x5b73, 4617},
-	{0x5b75, 4618},
-	{0x5b78, 4619},
-	{0x5b7a, 4621},
-	{0x5b7f, 0},
-	{0x5b80, 4622},
-	{0x5b83, 4623},
-	{0x5b85, 2896},
-	{0x5b87, 1225},
-	{0x5b88, 2325},
-	{0x5b89, 1158},
-	{0x5b8b, 2777},
-	{0x5b8c, 1516},
-	{0x5b8d, 2273},
-	{0x5b8f, 1978},
-	{0x5b95, 3168},
-	{0x5b97, 2347},
-	{0x5b98, 1517},
-	{0x5b99, 2982},
-	{0x5b9a, 3078},
-	{0x5b9b, 1148},
-	{0x5b9c, 1619},
-	{0x5b9d, 3653},
-	{0x5b9f, 2286},
-	{0x5ba2, 1644},
-	{0x5ba3, 2703},
-	{0x5ba4, 2280},
-	{0x5ba5, 3858},
-	{0x5ba6, 4624},
-	{0x5bae, 1654},
-	{0x5bb0, 2107},
-	{0x5bb3, 1424},
-	{0x5bb4, 1285},
-	{0x5bb5, 2452},
-	{0x5bb6, 1352},
-	{0x5bb8, 4625},
-	{0x5bb9, 3888},
-	{0x5bbf, 2387},
-	{0x5bc0, 8433},
-	{0x5bc2, 2320},
-	{0x5bc3, 4626},
-	{0x5bc4, 1583},
-	{0x5bc5, 3242},
-	{0x5bc6, 3765},
-	{0x5bc7, 4627},
-	{0x5bc9, 4628},
-	{0x5bcc, 3531},
-	{0x5bd0, 4630},
-	{0x5bd2, 1508},
-	{0x5bd3, 1775},
-	{0x5bd4, 4629},
-	{0x5bd8, 8435},
-	{0x5bdb, 1518},
-	{0x5bdd, 2552},
-	{0x5bde, 4634},
-	{0x5bdf, 2159},
-	{0x5be1, 1353},
-	{0x5be2, 4633},
-	{0x5be4, 4631},
-	{0x5be5, 4635},
-	{0x5be6, 4632},
-	{0x5be7, 3297},
-	{0x5be8, 5262},
-	{0x5be9, 2553},
-	{0x5beb, 4636},
-	{0x5bec, 8436},
-	{0x5bee, 3976},
-	{0x5bf0, 4637},
-	{0x5bf3, 4639},
-	{0x5bf5, 3004},
-	{0x5bf6, 4638},
-	{0x5bf8, 2631},
-	{0x5bfa, 2249},
-	{0x5bfe, 2864},
-	{0x5bff, 2339},
-	{0x5c01, 3559},
-	{0x5c02, 2704},
-	{0x5c04, 2297},
-	{0x5c05, 4640},
-	{0x5c06, 2453},
-	{0x5c07, 4641},
-	{0x5c08, 4642},
-	{0x5c09, 1175},
-	{0x5c0a, 2842},
-	{0x5c0b, 2584},
-	{0x5c0d, 4643},
-	{0x5c0e, 3211},
-	{0x5c0f, 2454},
-	{0x5c11, 2455},
-	{0x5c13, 4644},
-	{0x5c16, 2705},
-	{0x5c1a, 2456},
-	{0x5c1e, 8437},
-	{0x5c20, 4645},
-	{0x5c22, 4646},
-	{0x5c24, 3820},
-	{0x5c28, 4647},
-	{0x5c2d, 1726},
-	{0x5c31, 2348},
-	{0x5c38, 4648},
-	{0x5c39, 4649},
-	{0x5c3a, 2312},
-	{0x5c3b, 2546},
-	{0x5c3c, 3276},
-	{0x5c3d, 2586},
-	{0x5c3e, 3468},
-	{0x5c3f, 3288},
-	{0x5c40, 1729},
-	{0x5c41, 4650},
-	{0x5c45, 1673},
-	{0x5c46, 4651},
-	{0x5c48, 1782},
-	{0x5c4a, 3239},
-	{0x5c4b, 1328},
-	{0x5c4d, 2209},
-	{0x5c4e, 4652},
-	{0x5c4f, 4655},
-	{0x5c50, 4654},
-	{0x5c51, 1781},
-	{0x5c53, 4653},
-	{0x5c55, 3122},
-	{0x5c5b, 7826},
-	{0x5c5e, 2832},
-	{0x5c60, 3141},
-	{0x5c61, 2292},
-	{0x5c62, 7693},
-	{0x5c64, 2778},
-	{0x5c65, 3940},
-	{0x5c6c, 4657},
-	{0x5c6e, 4658},
-	{0x5c6f, 3246},
-	{0x5c71, 2177},
-	{0x5c76, 4660},
-	{0x5c79, 4661},
-	{0x5c8c, 4662},
-	{0x5c90, 1584},
-	{0x5c91, 4663},
-	{0x5c94, 4664},
-	{0x5ca1, 1324},
-	{0x5ca6, 8438},
-	{0x5ca8, 2749},
-	{0x5ca9, 1568},
-	{0x5cab, 4666},
-	{0x5cac, 3764},
-	{0x5cb1, 2866},
-	{0x5cb3, 1463},
-	{0x5cb6, 4668},
-	{0x5cb7, 4670},
-	{0x5cb8, 1563},
-	{0x5cba, 8439},
-	{0x5cbb, 4667},
-	{0x5cbc, 4669},
-	{0x5cbe, 4672},
-	{0x5cc5, 4671},
-	{0x5cc7, 4673},
-	{0x5cd9, 4674},
-	{0x5ce0, 3221},
-	{0x5ce1, 1702},
-	{0x5ce8, 1381},
-	{0x5ce9, 4675},
-	{0x5cea, 4680},
-	{0x5ced, 4678},
-	{0x5cef, 3655},
-	{0x5cf0, 3654},
-	{0x5cf5, 8440},
-	{0x5cf6, 3169},
-	{0x5cfa, 4677},
-	{0x5cfb, 2398},
-	{0x5cfd, 4676},
-	{0x5d07, 2616},
-	{0x5d0b, 4681},
-	{0x5d0e, 2138},
-	{0x5d11, 4687},
-	{0x5d14, 4688},
-	{0x5d15, 4682},
-	{0x5d16, 1425},
-	{0x5d17, 4683},
-	{0x5d18, 4692},
-	{0x5d19, 4691},
-	{0x5d1a, 4690},
-	{0x5d1b, 4686},
-	{0x5d1f, 4685},
-	{0x5d22, 4689},
-	{0x5d27, 8441},
-	{0x5d29, 3656},
-	{0x5d42, 8444},
-	{0x5d4b, 4696},
-	{0x5d4c, 4693},
-	{0x5d4e, 4695},
-	{0x5d50, 3932},
-	{0x5d52, 4694},
-	{0x5d53, 8442},
-	{0x5d5c, 4684},
-	{0x5d69, 2617},
-	{0x5d6c, 4697},
-	{0x5d6d, 8445},
-	{0x5d6f, 2087},
-	{0x5d73, 4698},
-	{0x5d76, 4699},
-	{0x5d82, 4702},
-	{0x5d84, 4701},
-	{0x5d87, 4700},
-	{0x5d8b, 3170},
-	{0x5d8c, 4679},
-	{0x5d90, 4708},
-	{0x5d9d, 4704},
-	{0x5da2, 4703},
-	{0x5dac, 4705},
-	{0x5dae, 4706},
-	{0x5db7, 4709},
-	{0x5db8, 8446},
-	{0x5db9, 8447},
-	{0x5dba, 4014},
-	{0x5dbc, 4710},
-	{0x5dbd, 4707},
-	{0x5dc9, 4711},
-	{0x5dcc, 1564},
-	{0x5dcd, 4712},
-	{0x5dd0, 8448},
-	{0x5dd2, 4714},
-	{0x5dd3, 4713},
-	{0x5dd6, 4715},
-	{0x5ddb, 4716},
-	{0x5ddd, 2706},
-	{0x5dde, 2349},
-	{0x5de1, 2414},
-	{0x5de3, 2789},
-	{0x5de5, 1979},
-	{0x5de6, 2088},
-	{0x5de7, 1980},
-	{0x5de8, 1674},
-	{0x5deb, 4717},
-	{0x5dee, 2089},
-	{0x5df1, 1918},
-	{0x5df2, 4718},
-	{0x5df3, 3762},
-	{0x5df4, 3321},
-	{0x5df5, 4719},
-	{0x5df7, 1981},
-	{0x5dfb, 1512},
-	{0x5dfd, 2917},
-	{0x5dfe, 1738},
-	{0x5e02, 2210},
-	{0x5e03, 3533},
-	{0x5e06, 3413},
-	{0x5e0b, 4720},
-	{0x5e0c, 1585},
-	{0x5e11, 4723},
-	{0x5e15, 0},
-	{0x5e16, 3005},
-	{0x5e19, 4722},
-	{0x5e1a, 4721},
-	{0x5e1b, 4724},
-	{0x5e1d, 3079},
-	{0x5e25, 2601},
-	{0x5e2b, 2211},
-	{0x5e2d, 2670},
-	{0x5e2f, 2867},
-	{0x5e30, 1596},
-	{0x5e33, 3006},
-	{0x5e36, 4725},
-	{0x5e37, 4726},
-	{0x5e38, 2519},
-	{0x5e3d, 3687},
-	{0x5e40, 4729},
-	{0x5e43, 4728},
-	{0x5e44, 4727},
-	{0x5e45, 3567},
-	{0x5e47, 4736},
-	{0x5e4c, 3720},
-	{0x5e4e, 4730},
-	{0x5e54, 4732},
-	{0x5e55, 3737},
-	{0x5e57, 4731},
-	{0x5e5f, 4733},
-	{0x5e61, 3388},
-	{0x5e62, 4734},
-	{0x5e63, 3598},
-	{0x5e64, 4735},
-	{0x5e6c, 0},
-	{0x5e72, 1519},
-	{0x5e73, 3599},
-	{0x5e74, 3301},
-	{0x5e75, 4737},
-	{0x5e76, 4738},
-	{0x5e78, 1982},
-	{0x5e79, 1520},
-	{0x5e7a, 4739},
-	{0x5e7b, 1900},
-	{0x5e7c, 3886},
-	{0x5e7d, 3859},
-	{0x5e7e, 1586},
-	{0x5e7f, 4741},
-	{0x5e81, 3007},
-	{0x5e83, 1983},
-	{0x5e84, 2457},
-	{0x5e87, 3443},
-	{0x5e8a, 2458},
-	{0x5e8f, 2434},
-	{0x5e95, 3080},
-	{0x5e96, 3657},
-	{0x5e97, 3123},
-	{0x5e9a, 1984},
-	{0x5e9c, 3534},
-	{0x5ea0, 4742},
-	{0x5ea6, 3155},
-	{0x5ea7, 2098},
-	{0x5eab, 1919},
-	{0x5ead, 3081},
-	{0x5eb5, 1159},
-	{0x5eb6, 2424},
-	{0x5eb7, 1985},
-	{0x5eb8, 3889},
-	{0x5ebf, 0},
-	{0x5ec1, 4743},
-	{0x5ec2, 4744},
-	{0x5ec3, 3335},
-	{0x5ec8, 4745},
-	{0x5ec9, 4031},
-	{0x5eca, 4051},
-	{0x5ecf, 4747},
-	{0x5ed0, 4746},
-	{0x5ed3, 1445},
-	{0x5ed6, 4748},
-	{0x5eda, 4751},
-	{0x5edb, 4752},
-	{0x5edd, 4750},
-	{0x5edf, 3506},
-	{0x5ee0, 2459},
-	{0x5ee1, 4754},
-	{0x5ee2, 4753},
-	{0x5ee3, 4749},
-	{0x5ee8, 4755},
-	{0x5ee9, 4756},
-	{0x5eec, 4757},
-	{0x5ef0, 4760},
-	{0x5ef1, 4758},
-	{0x5ef3, 4759},
-	{0x5ef4, 4761},
-	{0x5ef6, 1286},
-	{0x5ef7, 3082},
-	{0x5ef8, 4762},
-	{0x5efa, 1872},
-	{0x5efb, 1398},
-	{0x5efc, 3308},
-	{0x5efe, 4763},
-	{0x5eff, 3283},
-	{0x5f01, 3627},
-	{0x5f03, 4764},
-	{0x5f04, 4052},
-	{0x5f09, 4765},
-	{0x5f0a, 3600},
-	{0x5f0b, 4768},
-	{0x5f0c, 4090},
-	{0x5f0d, 4106},
-	{0x5f0f, 2268},
-	{0x5f10, 3277},
-	{0x5f11, 4769},
-	{0x5f13, 1655},
-	{0x5f14, 3008},
-	{0x5f15, 1214},
-	{0x5f16, 4770},
-	{0x5f17, 3574},
-	{0x5f18, 1986},
-	{0x5f1b, 2958},
-	{0x5f1d, 0},
-	{0x5f1f, 3083},
-	{0x5f21, 8449},
-	{0x5f25, 3835},
-	{0x5f26, 1901},
-	{0x5f27, 1920},
-	{0x5f29, 4771},
-	{0x5f2d, 4772},
-	{0x5f2f, 4778},
-	{0x5f31, 2321},
-	{0x5f34, 8450},
-	{0x5f35, 3009},
-	{0x5f37, 1703},
-	{0x5f38, 4773},
-	{0x5f3c, 3485},
-	{0x5f3e, 2948},
-	{0x5f41, 4774},
-	{0x5f45, 8370},
-	{0x5f48, 4775},
-	{0x5f4a, 1704},
-	{0x5f4c, 4776},
-	{0x5f4e, 4777},
-	{0x5f51, 4779},
-	{0x5f53, 3184},
-	{0x5f56, 4780},
-	{0x5f57, 4781},
-	{0x5f59, 4782},
-	{0x5f5c, 4767},
-	{0x5f5d, 4766},
-	{0x5f61, 4783},
-	{0x5f62, 1815},
-	{0x5f66, 3481},
-	{0x5f67, 8451},
-	{0x5f69, 2108},
-	{0x5f6a, 3497},
-	{0x5f6b, 3010},
-	{0x5f6c, 3517},
-	{0x5f6d, 4784},
-	{0x5f70, 2460},
-	{0x5f71, 1256},
-	{0x5f73, 4785},
-	{0x5f77, 4786},
-	{0x5f79, 3838},
-	{0x5f7c, 3444},
-	{0x5f7f, 4789},
-	{0x5f80, 1311},
-	{0x5f81, 2640},
-	{0x5f82, 4788},
-	{0x5f83, 4787},
-	{0x5f84, 1816},
-	{0x5f85, 2868},
-	{0x5f87, 4793},
-	{0x5f88, 4791},
-	{0x5f8a, 4790},
-	{0x5f8b, 3951},
-	{0x5f8c, 1945},
-	{0x5f90, 2435},
-	{0x5f91, 4792},
-	{0x5f92, 3142},
-	{0x5f93, 2376},
-	{0x5f97, 3224},
-	{0x5f98, 4796},
-	{0x5f99, 4795},
-	{0x5f9e, 4794},
-	{0x5fa0, 4797},
-	{0x5fa1, 1946},
-	{0x5fa8, 4798},
-	{0x5fa9, 3566},
-	{0x5faa, 2405},
-	{0x5fad, 4799},
-	{0x5fae, 3469},
-	{0x5fb3, 3225},
-	{0x5fb4, 3011},
-	{0x5fb7, 8452},
-	{0x5fb9, 3114},
-	{0x5fbc, 4800},
-	{0x5fbd, 1605},
-	{0x5fc3, 2554},
-	{0x5fc5, 3486},
-	{0x5fcc, 1587},
-	{0x5fcd, 3292},
-	{0x5fd6, 4801},
-	{0x5fd7, 2212},
-	{0x5fd8, 3688},
-	{0x5fd9, 3689},
-	{0x5fdc, 1312},
-	{0x5fdd, 4806},
-	{0x5fde, 8453},
-	{0x5fe0, 2983},
-	{0x5fe4, 4803},
-	{0x5feb, 1399},
-	{0x5ff0, 4854},
-	{0x5ff1, 4805},
-	{0x5ff5, 3302},
-	{0x5ff8, 4804},
-	{0x5ffb, 4802},
-	{0x5ffd, 2060},
-	{0x5fff, 4808},
-	{0x600e, 4814},
-	{0x600f, 4820},
-	{0x6010, 4812},
-	{0x6012, 3158},
-	{0x6015, 4817},
-	{0x6016, 3535},
-	{0x6019, 4811},
-	{0x601b, 4816},
-	{0x601c, 4015},
-	{0x601d, 2213},
-	{0x6020, 2869},
-	{0x6021, 4809},
-	{0x6025, 1656},
-	{0x6026, 4819},
-	{0x6027, 2641},
-	{0x6028, 1287},
-	{0x6029, 4813},
-	{0x602a, 1400},
-	{0x602b, 4818},
-	{0x602f, 1705},
-	{0x6031, 4815},
-	{0x603a, 4821},
-	{0x6041, 4823},
-	{0x6042, 4833},
-	{0x6043, 4831},
-	{0x6046, 4828},
-	{0x604a, 4827},
-	{0x604b, 4032},
-	{0x604d, 4829},
-	{0x6050, 1706},
-	{0x6052, 1987},
-	{0x6055, 2436},
-	{0x6059, 4836},
-	{0x605a, 4822},
-	{0x605d, 8454},
-	{0x605f, 4826},
-	{0x6060, 4810},
-	{0x6062, 1402},
-	{0x6063, 4830},
-	{0x6064, 4832},
-	{0x6065, 2959},
-	{0x6068, 2072},
-	{0x6069, 1336},
-	{0x606a, 4824},
-	{0x606b, 4835},
-	{0x606c, 4834},
-	{0x606d, 1707},
-	{0x606f, 2825},
-	{0x6070, 1476},
-	{0x6075, 1817},
-	{0x6077, 4825},
-	{0x6081, 4837},
-	{0x6083, 4840},
-	{0x6084, 4842},
-	{0x6085, 8455},
-	{0x6089, 2281},
-	{0x608a, 8456},
-	{0x608b, 4848},
-	{0x608c, 3084},
-	{0x608d, 4838},
-	{0x6092, 4846},
-	{0x6094, 1401},
-	{0x6096, 4844},
-	{0x6097, 4845},
-	{0x609a, 4841},
-	{0x609b, 4843},
-	{0x609f, 1947},
-	{0x60a0, 3860},
-	{0x60a3, 1521},
-	{0x60a6, 1275},
-	{0x60a7, 4847},
-	{0x60a9, 3312},
-	{0x60aa, 1137},
-	{0x60b2, 3445},
-	{0x60b3, 4807},
-	{0x60b4, 4853},
-	{0x60b5, 4857},
-	{0x60b6, 3825},
-	{0x60b8, 4850},
-	{0x60bc, 3171},
-	{0x60bd, 4855},
-	{0x60c5, 2520},
-	{0x60c6, 4856},
-	{0x60c7, 3247},
-	{0x60d1, 4077},
-	{0x60d3, 4852},
-	{0x60d5, 8458},
-	{0x60d8, 4858},
-	{0x60da, 2061},
-	{0x60dc, 2671},
-	{0x60de, 8457},
-	{0x60df, 1176},
-	{0x60e0, 4851},
-	{0x60e1, 4849},
-	{0x60e3, 2780},
-	{0x60e7, 4839},
-	{0x60e8, 2178},
-	{0x60f0, 2854},
-	{0x60f1, 4870},
-	{0x60f2, 8460},
-	{0x60f3, 2781},
-	{0x60f4, 4865},
-	{0x60f6, 4862},
-	{0x60f7, 4863},
-	{0x60f9, 2322},
-	{0x60fa, 4866},
-	{0x60fb, 4869},
-	{0x6100, 4864},
-	{0x6101, 2351},
-	{0x6103, 4867},
-	{0x6106, 4861},
-	{0x6108, 3848},
-	{0x6109, 3847},
-	{0x610d, 4871},
-	{0x610e, 4872},
-	{0x610f, 1177},
-	{0x6111, 8461},
-	{0x6113, 0},
-	{0x6114, 1},
-	{0x6115, 4860},
-	{0x611a, 1770},
-	{0x611b, 1130},
-	{0x611f, 1522},
-	{0x6120, 8459},
-	{0x6121, 4868},
-	{0x6127, 4876},
-	{0x6128, 4875},
-	{0x612c, 4880},
-	{0x6130, 8463},
-	{0x6134, 4881},
-	{0x6137, 8462},
-	{0x613c, 4879},
-	{0x613d, 4882},
-	{0x613e, 4874},
-	{0x613f, 4878},
-	{0x6142, 4883},
-	{0x6144, 4884},
-	{0x6147, 4873},
-	{0x6148, 2250},
-	{0x614a, 4877},
-	{0x614b, 2870},
-	{0x614c, 1988},
-	{0x614d, 4859},
-	{0x614e, 2555},
-	{0x6153, 4897},
-	{0x6155, 3641},
-	{0x6158, 4887},
-	{0x6159, 4888},
-	{0x615a, 4889},
-	{0x615d, 4896},
-	{0x615f, 4895},
-	{0x6162, 3755},
-	{0x6163, 1523},
-	{0x6165, 4893},
-	{0x6167, 1819},
-	{0x6168, 1426},
-	{0x616b, 4890},
-	{0x616e, 3968},
-	{0x616f, 4892},
-	{0x6170, 1178},
-	{0x6171, 4894},
-	{0x6173, 4885},
-	{0x6174, 4891},
-	{0x6175, 4898},
-	{0x6176, 1818},
-	{0x6177, 4886},
-	{0x617e, 3911},
-	{0x6182, 3861},
-	{0x6187, 4901},
-	{0x618a, 4905},
-	{0x618e, 2816},
-	{0x6190, 4033},
-	{0x6191, 4906},
-	{0x6194, 4903},
-	{0x6196, 4900},
-	{0x6198, 8464},
-	{0x6199, 4899},
-	{0x619a, 4904},
-	{0x61a4, 3584},
-	{0x61a7, 3212},
-	{0x61a9, 1820},
-	{0x61ab, 4907},
-	{0x61ac, 4902},
-	{0x61ae, 4908},
-	{0x61b2, 1873},
-	{0x61b6, 1329},
-	{0x61ba, 4916},
-	{0x61be, 1524},
-	{0x61c3, 4914},
-	{0x61c6, 4915},
-	{0x61c7, 2073},
-	{0x61c8, 4913},
-	{0x61c9, 4911},
-	{0x61ca, 4910},
-	{0x61cb, 4917},
-	{0x61cc, 4909},
-	{0x61cd, 4919},
-	{0x61d0, 1403},
-	{0x61e3, 4921},
-	{0x61e6, 4920},
-	{0x61f2, 3012},
-	{0x61f4, 4924},
-	{0x61f6, 4922},
-	{0x61f7, 4912},
-	{0x61f8, 1874},
-	{0x61fa, 4923},
-	{0x61fc, 4927},
-	{0x61fd, 4926},
-	{0x61fe, 4928},
-	{0x61ff, 4925},
-	{0x6200, 4929},
-	{0x6208, 4930},
-	{0x6209, 4931},
-	{0x620a, 3642},
-	{0x620c, 4933},
-	{0x620d, 4932},
-	{0x620e, 2377},
-	{0x6210, 2642},
-	{0x6211, 1382},
-	{0x6212, 1404},
-	{0x6213, 8465},
-	{0x6214, 4934},
-	{0x6216, 1155},
-	{0x621a, 2672},
-	{0x621b, 4935},
-	{0x621d, 6756},
-	{0x621e, 4936},
-	{0x621f, 1847},
-	{0x6221, 4937},
-	{0x6226, 2707},
-	{0x622a, 4938},
-	{0x622e, 4939},
-	{0x622f, 1620},
-	{0x6230, 4940},
-	{0x6232, 4941},
-	{0x6233, 4942},
-	{0x6234, 2871},
-	{0x6238, 1921},
-	{0x623b, 3821},
-	{0x623f, 3690},
-	{0x6240, 2420},
-	{0x6241, 4943},
-	{0x6247, 2708},
-	{0x6248, 6938},
-	{0x6249, 3446},
-	{0x624b, 2326},
-	{0x624d, 2109},
-	{0x624e, 4944},
-	{0x6253, 2855},
-	{0x6255, 3575},
-	{0x6258, 2897},
-	{0x625b, 4947},
-	{0x625e, 4945},
-	{0x6260, 4948},
-	{0x6263, 4946},
-	{0x6268, 4949},
-	{0x626e, 3585},
-	{0x6271, 1147},
-	{0x6276, 3536},
-	{0x6279, 3447},
-	{0x627c, 4950},
-	{0x627e, 4953},
-	{0x627f, 2461},
-	{0x6280, 1621},
-	{0x6282, 4951},
-	{0x6283, 4958},
-	{0x6284, 2462},
-	{0x6289, 4952},
-	{0x628a, 3322},
-	{0x6291, 3912},
-	{0x6292, 4954},
-	{0x6293, 4955},
-	{0x6294, 4959},
-	{0x6295, 3172},
-	{0x6296, 4956},
-	{0x6297, 1989},
-	{0x6298, 2690},
-	{0x629b, 4973},
-	{0x629c, 3400},
-	{0x629e, 2898},
-	{0x62a6, 8466},
-	{0x62ab, 3448},
-	{0x62ac, 5042},
-	{0x62b1, 3658},
-	{0x62b5, 3085},
-	{0x62b9, 3747},
-	{0x62bb, 4962},
-	{0x62bc, 1313},
-	{0x62bd, 2984},
-	{0x62c2, 4971},
-	{0x62c5, 2930},
-	{0x62c6, 4965},
-	{0x62c7, 4972},
-	{0x62c8, 4967},
-	{0x62c9, 4974},
-	{0x62ca, 4970},
-	{0x62cc, 4969},
-	{0x62cd, 3365},
-	{0x62cf, 4963},
-	{0x62d0, 1405},
-	{0x62d1, 4961},
-	{0x62d2, 1675},
-	{0x62d3, 2899},
-	{0x62d4, 4957},
-	{0x62d7, 4960},
-	{0x62d8, 1990},
-	{0x62d9, 2687},
-	{0x62db, 2463},
-	{0x62dc, 4968},
-	{0x62dd, 3336},
-	{0x62e0, 1676},
-	{0x62e1, 1446},
-	{0x62ec, 1477},
-	{0x62ed, 2535},
-	{0x62ee, 4976},
-	{0x62ef, 4981},
-	{0x62f1, 4977},
-	{0x62f3, 1875},
-	{0x62f5, 4982},
-	{0x62f6, 2160},
-	{0x62f7, 2043},
-	{0x62fe, 2352},
-	{0x62ff, 4964},
-	{0x6301, 2251},
-	{0x6302, 4979},
-	{0x6307, 2214},
-	{0x6308, 4980},
-	{0x6309, 1160},
-	{0x630c, 4975},
-	{0x6311, 3013},
-	{0x6319, 1677},
-	{0x631f, 1708},
-	{0x6327, 4978},
-	{0x6328, 1131},
-	{0x632b, 2099},
-	{0x632f, 2556},
-	{0x633a, 3086},
-	{0x633d, 3432},
-	{0x633e, 4984},
-	{0x633f, 2784},
-	{0x6343, 0},
-	{0x6349, 2826},
-	{0x634c, 2169},
-	{0x634d, 4985},
-	{0x634f, 4987},
-	{0x6350, 4983},
-	{0x6355, 3633},
-	{0x6357, 3033},
-	{0x635c, 2782},
-	{0x6367, 3659},
-	{0x6368, 2298},
-	{0x6369, 4999},
-	{0x636b, 4998},
-	{0x636e, 2622},
-	{0x6372, 1876},
-	{0x6376, 4992},
-	{0x6377, 2465},
-	{0x637a, 3264},
-	{0x637b, 3303},
-	{0x6380, 4990},
-	{0x6383, 2783},
-	{0x6388, 2340},
-	{0x6389, 4995},
-	{0x638c, 2464},
-	{0x638e, 4989},
-	{0x638f, 4994},
-	{0x6392, 3337},
-	{0x6396, 4988},
-	{0x6398, 1783},
-	{0x639b, 1467},
-	{0x639f, 4996},
-	{0x63a0, 3955},
-	{0x63a1, 2110},
-	{0x63a2, 2931},
-	{0x63a3, 4993},
-	{0x63a5, 2688},
-	{0x63a7, 1991},
-	{0x63a8, 2602},
-	{0x63a9, 1288},
-	{0x63aa, 2750},
-	{0x63ab, 4991},
-	{0x63ac, 1631},
-	{0x63b2, 1821},
-	{0x63b4, 3051},
-	{0x63b5, 4997},
-	{0x63bb, 2785},
-	{0x63be, 5000},
-	{0x63c0, 5002},
-	{0x63c3, 2839},
-	{0x63c4, 5008},
-	{0x63c6, 5003},
-	{0x63c9, 5005},
-	{0x63cf, 3507},
-	{0x63d0, 3087},
-	{0x63d2, 5006},
-	{0x63d6, 3862},
-	{0x63da, 3890},
-	{0x63db, 1525},
-	{0x63e1, 1138},
-	{0x63e3, 5004},
-	{0x63e9, 5001},
-	{0x63ee, 1588},
-	{0x63f4, 1289},
-	{0x63f5, 8467},
-	{0x63f6, 5007},
-	{0x63fa, 3891},
-	{0x6406, 5011},
-	{0x640d, 2843},
-	{0x640f, 5018},
-	{0x6413, 5012},
-	{0x6414, 7724},
-	{0x6416, 5009},
-	{0x6417, 5016},
-	{0x641c, 4986},
-	{0x6426, 5013},
-	{0x6428, 5017},
-	{0x642c, 3414},
-	{0x642d, 3173},
-	{0x6434, 5010},
-	{0x6436, 5014},
-	{0x643a, 1822},
-	{0x643e, 2145},
-	{0x6442, 2689},
-	{0x644e, 5022},
-	{0x6451, 7747},
-	{0x6458, 3104},
-	{0x6460, 8468},
-	{0x6467, 5019},
-	{0x6469, 3726},
-	{0x646f, 5020},
-	{0x6476, 5021},
-	{0x6478, 3802},
-	{0x647a, 2630},
-	{0x6483, 1848},
-	{0x6488, 5028},
-	{0x6492, 2179},
-	{0x6493, 5025},
-	{0x6495, 5024},
-	{0x649a, 3304},
-	{0x649d, 8469},
-	{0x649e, 3213},
-	{0x64a4, 3115},
-	{0x64a5, 5026},
-	{0x64a9, 5027},
-	{0x64ab, 3553},
-	{0x64ad, 3323},
-	{0x64ae, 2161},
-	{0x64b0, 2709},
-	{0x64b2, 3710},
-	{0x64b9, 1447},
-	{0x64bb, 5034},
-	{0x64bc, 5029},
-	{0x64bf, 0},
-	{0x64c1, 3892},
-	{0x64c2, 5036},
-	{0x64c5, 5032},
-	{0x64c7, 5033},
-	{0x64cd, 2786},
-	{0x64ce, 8470},
-	{0x64d2, 5031},
-	{0x64d4, 4966},
-	{0x64d8, 5035},
-	{0x64da, 5030},
-	{0x64e0, 5040},
-	{0x64e1, 5041},
-	{0x64e2, 3105},
-	{0x64e3, 5043},
-	{0x64e6, 2162},
-	{0x64e7, 5038},
-	{0x64ec, 1622},
-	{0x64ef, 5044},
-	{0x64f1, 5037},
-	{0x64f2, 5048},
-	{0x64f4, 5047},
-	{0x64f6, 5046},
-	{0x64fa, 5049},
-	{0x64fd, 5051},
-	{0x64fe, 2521},
-	{0x6500, 5050},
-	{0x6505, 5054},
-	{0x6518, 5052},
-	{0x651c, 5053},
-	{0x651d, 5015},
-	{0x6522, 7831},
-	{0x6523, 5056},
-	{0x6524, 5055},
-	{0x652a, 5023},
-	{0x652b, 5057},
-	{0x652c, 5045},
-	{0x652f, 2215},
-	{0x6534, 5058},
-	{0x6535, 5059},
-	{0x6536, 5061},
-	{0x6537, 5060},
-	{0x6538, 5062},
-	{0x6539, 1406},
-	{0x653b, 1992},
-	{0x653e, 3660},
-	{0x653f, 2643},
-	{0x6545, 1922},
-	{0x6548, 5064},
-	{0x654d, 5067},
-	{0x654e, 8471},
-	{0x654f, 3524},
-	{0x6551, 1657},
-	{0x6555, 5066},
-	{0x6556, 5065},
-	{0x6557, 3338},
-	{0x6558, 5068},
-	{0x6559, 1709},
-	{0x655d, 5070},
-	{0x655e, 5069},
-	{0x6562, 1526},
-	{0x6563, 2180},
-	{0x6566, 3248},
-	{0x656c, 1823},
-	{0x6570, 2618},
-	{0x6572, 5071},
-	{0x6574, 2644},
-	{0x6575, 3106},
-	{0x6577, 3537},
-	{0x6578, 5072},
-	{0x6582, 5073},
-	{0x6583, 5074},
-	{0x6587, 3592},
-	{0x6588, 4620},
-	{0x6589, 2666},
-	{0x658c, 3518},
-	{0x658e, 2120},
-	{0x6590, 3449},
-	{0x6591, 3415},
-	{0x6597, 3143},
-	{0x6599, 3977},
-	{0x659b, 5076},
-	{0x659c, 2300},
-	{0x659f, 5077},
-	{0x65a1, 1146},
-	{0x65a4, 1740},
-	{0x65a5, 2673},
-	{0x65a7, 3538},
-	{0x65ab, 5078},
-	{0x65ac, 2192},
-	{0x65ad, 2949},
-	{0x65af, 2217},
-	{0x65b0, 2557},
-	{0x65b7, 5079},
-	{0x65b9, 3661},
-	{0x65bc, 1305},
-	{0x65bd, 2218},
-	{0x65c1, 5082},
-	{0x65c3, 5080},
-	{0x65c4, 5083},
-	{0x65c5, 3969},
-	{0x65c6, 5081},
-	{0x65cb, 2719},
-	{0x65cc, 5084},
-	{0x65cf, 2834},
-	{0x65d2, 5085},
-	{0x65d7, 1590},
-	{0x65d9, 5087},
-	{0x65db, 5086},
-	{0x65e0, 5088},
-	{0x65e1, 5089},
-	{0x65e2, 1591},
-	{0x65e5, 3284},
-	{0x65e6, 2932},
-	{0x65e7, 1670},
-	{0x65e8, 2219},
-	{0x65e9, 2787},
-	{0x65ec, 2406},
-	{0x65ed, 1140},
-	{0x65f1, 5090},
-	{0x65fa, 1314},
-	{0x65fb, 5094},
-	{0x6600, 8472},
-	{0x6602, 1993},
-	{0x6603, 5093},
-	{0x6606, 2075},
-	{0x6607, 2466},
-	{0x6609, 8474},
-	{0x660a, 5092},
-	{0x660c, 2467},
-	{0x660e, 3788},
-	{0x660f, 2074},
-	{0x6613, 1179},
-	{0x6614, 2674},
-	{0x6615, 8473},
-	{0x661c, 5099},
-	{0x661e, 8476},
-	{0x661f, 2645},
-	{0x6620, 1257},
-	{0x6624, 8477},
-	{0x6625, 2399},
-	{0x6627, 3732},
-	{0x6628, 2146},
-	{0x662d, 2468},
-	{0x662e, 8475},
-	{0x662f, 2635},
-	{0x6631, 8366},
-	{0x6634, 5098},
-	{0x6635, 5096},
-	{0x6636, 5097},
-	{0x663b, 7680},
-	{0x663c, 2985},
-	{0x663f, 5129},
-	{0x6641, 5103},
-	{0x6642, 2252},
-	{0x6643, 1994},
-	{0x6644, 5101},
-	{0x6649, 5102},
-	{0x664b, 2558},
-	{0x664f, 5100},
-	{0x6652, 2173},
-	{0x6657, 8479},
-	{0x6659, 8480},
-	{0x665c, 0},
-	{0x665d, 5105},
-	{0x665e, 5104},
-	{0x665f, 5109},
-	{0x6662, 5110},
-	{0x6664, 5106},
-	{0x6665, 8478},
-	{0x6666, 1408},
-	{0x6667, 5107},
-	{0x6668, 5108},
-	{0x6669, 3433},
-	{0x666e, 3539},
-	{0x666f, 1824},
-	{0x6670, 5111},
-	{0x6673, 8482},
-	{0x6674, 2646},
-	{0x6676, 2469},
-	{0x667a, 2960},
-	{0x6681, 1727},
-	{0x6683, 5112},
-	{0x6684, 5116},
-	{0x6687, 1355},
-	{0x6688, 5113},
-	{0x6689, 5115},
-	{0x668e, 5114},
-	{0x6691, 2421},
-	{0x6696, 2950},
-	{0x6697, 1161},
-	{0x6698, 5117},
-	{0x6699, 8483},
-	{0x669d, 5118},
-	{0x66a0, 8484},
-	{0x66a2, 3014},
-	{0x66a6, 4025},
-	{0x66ab, 2193},
-	{0x66ae, 3643},
-	{0x66b2, 8485},
-	{0x66b4, 3691},
-	{0x66b8, 5125},
-	{0x66b9, 5120},
-	{0x66bc, 5123},
-	{0x66be, 5122},
-	{0x66bf, 8486},
-	{0x66c1, 5119},
-	{0x66c4, 5124},
-	{0x66c7, 3254},
-	{0x66c9, 5121},
-	{0x66d6, 5126},
-	{0x66d9, 2422},
-	{0x66da, 5127},
-	{0x66dc, 3893},
-	{0x66dd, 3374},
-	{0x66e0, 5128},
-	{0x66e6, 5130},
-	{0x66e9, 5131},
-	{0x66f0, 5132},
-	{0x66f2, 1730},
-	{0x66f3, 1258},
-	{0x66f4, 1995},
-	{0x66f5, 5133},
-	{0x66f7, 5134},
-	{0x66f8, 2427},
-	{0x66f9, 2788},
-	{0x66fa, 8487},
-	{0x66fb, 8369},
-	{0x66fc, 4333},
-	{0x66fd, 2752},
-	{0x66fe, 2751},
-	{0x66ff, 2872},
-	{0x6700, 2103},
-	{0x6703, 4171},
-	{0x6708, 1860},
-	{0x6709, 3863},
-	{0x670b, 3662},
-	{0x670d, 3568},
-	{0x670e, 8488},
-	{0x670f, 5135},
-	{0x6714, 2147},
-	{0x6715, 3035},
-	{0x6716, 5136},
-	{0x6717, 4053},
-	{0x671b, 3692},
-	{0x671d, 3015},
-	{0x671e, 5137},
-	{0x671f, 1592},
-	{0x6726, 5138},
-	{0x6727, 5139},
-	{0x6728, 3814},
-	{0x672a, 3760},
-	{0x672b, 3748},
-	{0x672c, 3722},
-	{0x672d, 2163},
-	{0x672e, 5141},
-	{0x6731, 2327},
-	{0x6734, 3711},
-	{0x6736, 5143},
-	{0x6737, 5146},
-	{0x6738, 5145},
-	{0x673a, 1589},
-	{0x673d, 1658},
-	{0x673f, 5142},
-	{0x6741, 5144},
-	{0x6746, 5147},
-	{0x6749, 2623},
-	{0x674e, 3941},
-	{0x674f, 1165},
-	{0x6750, 2128},
-	{0x6751, 2844},
-	{0x6753, 2313},
-	{0x6756, 2523},
-	{0x6759, 5150},
-	{0x675c, 3144},
-	{0x675e, 5148},
-	{0x675f, 2827},
-	{0x6760, 5149},
-	{0x6761, 2522},
-	{0x6762, 3817},
-	{0x6763, 5151},
-	{0x6764, 5152},
-	{0x6765, 3922},
-	{0x6766, 8490},
-	{0x676a, 5157},
-	{0x676d, 1996},
-	{0x676f, 3339},
-	{0x6770, 5154},
-	{0x6771, 3174},
-	{0x6772, 5091},
-	{0x6773, 5095},
-	{0x6775, 1641},
-	{0x6777, 3325},
-	{0x677c, 5156},
-	{0x677e, 2470},
-	{0x677f, 3416},
-	{0x6785, 5162},
-	{0x6787, 3470},
-	{0x6789, 5153},
-	{0x678b, 5159},
-	{0x678c, 5158},
-	{0x6790, 2675},
-	{0x6795, 3739},
-	{0x6797, 3995},
-	{0x679a, 3733},
-	{0x679c, 1356},
-	{0x679d, 2220},
-	{0x67a0, 4078},
-	{0x67a1, 5161},
-	{0x67a2, 2619},
-	{0x67a6, 5160},
-	{0x67a9, 5155},
-	{0x67af, 1923},
-	{0x67b3, 5167},
-	{0x67b4, 5165},
-	{0x67b6, 1357},
-	{0x67b7, 5163},
-	{0x67b8, 5169},
-	{0x67b9, 5175},
-	{0x67bb, 8491},
-	{0x67c0, 8493},
-	{0x67c1, 2856},
-	{0x67c4, 3601},
-	{0x67c6, 5177},
-	{0x67ca, 3476},
-	{0x67ce, 5176},
-	{0x67cf, 3366},
-	{0x67d0, 3693},
-	{0x67d1, 1527},
-	{0x67d3, 2715},
-	{0x67d4, 2378},
-	{0x67d8, 3055},
-	{0x67da, 3864},
-	{0x67dd, 5172},
-	{0x67de, 5171},
-	{0x67e2, 5173},
-	{0x67e4, 5170},
-	{0x67e7, 5178},
-	{0x67e9, 5168},
-	{0x67ec, 5166},
-	{0x67ee, 5174},
-	{0x67ef, 5164},
-	{0x67f1, 2986},
-	{0x67f3, 3844},
-	{0x67f4, 2290},
-	{0x67f5, 2148},
-	{0x67fb, 2090},
-	{0x67fe, 3741},
-	{0x67ff, 1439},
-	{0x6801, 8494},
-	{0x6802, 3050},
-	{0x6803, 3234},
-	{0x6804, 1259},
-	{0x6805, 7687},
-	{0x6813, 2710},
-	{0x6816, 2648},
-	{0x6817, 1792},
-	{0x681e, 5180},
-	{0x6821, 1997},
-	{0x6822, 1498},
-	{0x6829, 5182},
-	{0x682a, 1490},
-	{0x682b, 5188},
-	{0x6831, 0},
-	{0x6832, 5185},
-	{0x6834, 2711},
-	{0x6838, 1449},
-	{0x6839, 2076},
-	{0x683c, 1448},
-	{0x683d, 2111},
-	{0x6840, 5183},
-	{0x6841, 1851},
-	{0x6842, 1825},
-	{0x6843, 3175},
-	{0x6844, 8495},
-	{0x6846, 5181},
-	{0x6848, 1162},
-	{0x684d, 5184},
-	{0x684e, 5186},
-	{0x6850, 1733},
-	{0x6851, 1794},
-	{0x6852, 8492},
-	{0x6853, 1528},
-	{0x6854, 1637},
-	{0x6859, 5189},
-	{0x685c, 2153},
-	{0x685d, 3743},
-	{0x685f, 2181},
-	{0x6863, 5190},
-	{0x6867, 3490},
-	{0x6874, 5202},
-	{0x6876, 1331},
-	{0x6877, 5191},
-	{0x687e, 5208},
-	{0x687f, 5192},
-	{0x6881, 3978},
-	{0x6883, 5199},
-	{0x6885, 3349},
-	{0x688d, 5207},
-	{0x688e, 7836},
-	{0x688f, 5194},
-	{0x6893, 1144},
-	{0x6894, 5196},
-	{0x6897, 1998},
-	{0x689b, 5198},
-	{0x689d, 5197},
-	{0x689f, 5193},
-	{0x68a0, 5204},
-	{0x68a2, 2471},
-	{0x68a6, 4542},
-	{0x68a7, 1948},
-	{0x68a8, 3942},
-	{0x68ad, 5195},
-	{0x68af, 3088},
-	{0x68b0, 1409},
-	{0x68b1, 2077},
-	{0x68b3, 5187},
-	{0x68b5, 5203},
-	{0x68b6, 1471},
-	{0x68b9, 5201},
-	{0x68ba, 5205},
-	{0x68bc, 3176},
-	{0x68c4, 1594},
-	{0x68c6, 5235},
-	{0x68c8, 8367},
-	{0x68c9, 3797},
-	{0x68ca, 5210},
-	{0x68cb, 1593},
-	{0x68cd, 5217},
-	{0x68cf, 8496},
-	{0x68d2, 3694},
-	{0x68d4, 5218},
-	{0x68d5, 5220},
-	{0x68d7, 5224},
-	{0x68d8, 5212},
-	{0x68da, 2920},
-	{0x68df, 3177},
-	{0x68e0, 5228},
-	{0x68e1, 5215},
-	{0x68e3, 5225},
-	{0x68e7, 5219},
-	{0x68ee, 2559},
-	{0x68ef, 5229},
-	{0x68f1, 0},
-	{0x68f2, 2647},
-	{0x68f9, 5227},
-	{0x68fa, 1529},
-	{0x6900, 4086},
-	{0x6901, 5209},
-	{0x6904, 5223},
-	{0x6905, 1180},
-	{0x6908, 5211},
-	{0x690b, 3782},
-	{0x690c, 5216},
-	{0x690d, 2536},
-	{0x690e, 3043},
-	{0x690f, 5206},
-	{0x6912, 5222},
-	{0x6919, 2624},
-	{0x691a, 5232},
-	{0x691b, 1487},
-	{0x691c, 1877},
-	{0x6921, 5234},
-	{0x6922, 5213},
-	{0x6923, 5233},
-	{0x6925, 5226},
-	{0x6926, 5214},
-	{0x6928, 5230},
-	{0x692a, 5231},
-	{0x6930, 5248},
-	{0x6934, 3238},
-	{0x6936, 5221},
-	{0x6939, 5244},
-	{0x693d, 5246},
-	{0x693f, 3060},
-	{0x694a, 3894},
-	{0x6953, 3560},
-	{0x6954, 5241},
-	{0x6955, 2858},
-	{0x6959, 5247},
-	{0x695a, 2753},
-	{0x695c, 5238},
-	{0x695d, 5251},
-	{0x695e, 5250},
-	{0x6960, 3271},
-	{0x6961, 5249},
-	{0x6962, 3266},
-	{0x6968, 8498},
-	{0x696a, 5253},
-	{0x696b, 5240},
-	{0x696d, 1728},
-	{0x696e, 5243},
-	{0x696f, 2407},
-	{0x6973, 3350},
-	{0x6974, 5245},
-	{0x6975, 1731},
-	{0x6977, 5237},
-	{0x6978, 5239},
-	{0x6979, 5236},
-	{0x697c, 4054},
-	{0x697d, 1464},
-	{0x697e, 5242},
-	{0x6980, 0},
-	{0x6981, 5252},
-	{0x6982, 1427},
-	{0x698a, 2135},
-	{0x698e, 1279},
-	{0x6991, 5269},
-	{0x6994, 4055},
-	{0x6995, 5272},
-	{0x6998, 8500},
-	{0x699b, 2560},
-	{0x699c, 5271},
-	{0x69a0, 5270},
-	{0x69a7, 5267},
-	{0x69ae, 5255},
-	{0x69b1, 5284},
-	{0x69b2, 5254},
-	{0x69b4, 5273},
-	{0x69bb, 5265},
-	{0x69be, 5260},
-	{0x69bf, 5257},
-	{0x69c1, 5258},
-	{0x69c3, 5266},
-	{0x69c7, 7475},
-	{0x69ca, 5263},
-	{0x69cb, 1999},
-	{0x69cc, 3044},
-	{0x69cd, 2790},
-	{0x69ce, 5261},
-	{0x69d0, 5256},
-	{0x69d3, 5259},
-	{0x69d7, 0},
-	{0x69d8, 3895},
-	{0x69d9, 3736},
-	{0x69dd, 5264},
-	{0x69de, 5274},
-	{0x69e2, 8501},
-	{0x69e7, 5282},
-	{0x69e8, 5275},
-	{0x69eb, 5288},
-	{0x69ed, 5286},
-	{0x69f2, 5281},
-	{0x69f9, 5280},
-	{0x69fb, 3052},
-	{0x69fd, 2791},
-	{0x69ff, 5278},
-	{0x6a02, 5276},
-	{0x6a05, 5283},
-	{0x6a0a, 5289},
-	{0x6a0b, 3465},
-	{0x6a0c, 5295},
-	{0x6a12, 5290},
-	{0x6a13, 5293},
-	{0x6a14, 5287},
-	{0x6a17, 2994},
-	{0x6a19, 3498},
-	{0x6a1b, 5277},
-	{0x6a1e, 5285},
-	{0x6a1f, 2472},
-	{0x6a21, 3803},
-	{0x6a22, 5305},
-	{0x6a23, 5292},
-	{0x6a29, 1878},
-	{0x6a2a, 1315},
-	{0x6a2b, 1469},
-	{0x6a2e, 5268},
-	{0x6a30, 8502},
-	{0x6a35, 2473},
-	{0x6a36, 5297},
-	{0x6a38, 5304},
-	{0x6a39, 2341},
-	{0x6a3a, 1488},
-	{0x6a3d, 2924},
-	{0x6a44, 5294},
-	{0x6a46, 8504},
-	{0x6a47, 5299},
-	{0x6a48, 5303},
-	{0x6a4b, 1710},
-	{0x6a51, 0},
-	{0x6a58, 1638},
-	{0x6a59, 5301},
-	{0x6a5f, 1595},
-	{0x6a61, 3235},
-	{0x6a62, 5300},
-	{0x6a66, 5302},
-	{0x6a6b, 8503},
-	{0x6a72, 5296},
-	{0x6a73, 8505},
-	{0x6a78, 5298},
-	{0x6a7e, 8506},
-	{0x6a7f, 1470},
-	{0x6a80, 2951},
-	{0x6a84, 5309},
-	{0x6a8d, 5307},
-	{0x6a8e, 1949},
-	{0x6a90, 5306},
-	{0x6a97, 5312},
-	{0x6a9c, 5179},
-	{0x6a9e, 0},
-	{0x6a9f, 1},
-	{0x6aa0, 5308},
-	{0x6aa2, 5310},
-	{0x6aa3, 5311},
-	{0x6aaa, 5323},
-	{0x6aac, 5319},
-	{0x6aae, 5200},
-	{0x6ab3, 5318},
-	{0x6ab8, 5317},
-	{0x6abb, 5314},
-	{0x6ac1, 5291},
-	{0x6ac2, 5316},
-	{0x6ac3, 5315},
-	{0x6ad1, 5321},
-	{0x6ad3, 4044},
-	{0x6ada, 5324},
-	{0x6adb, 1779},
-	{0x6ade, 5320},
-	{0x6adf, 5322},
-	{0x6ae2, 8507},
-	{0x6ae4, 8508},
-	{0x6ae8, 3387},
-	{0x6aea, 5325},
-	{0x6afa, 5329},
-	{0x6afb, 5326},
-	{0x6b04, 3933},
-	{0x6b05, 5327},
-	{0x6b0a, 5279},
-	{0x6b12, 5330},
-	{0x6b16, 5331},
-	{0x6b1d, 1239},
-	{0x6b1f, 5333},
-	{0x6b20, 1853},
-	{0x6b21, 2253},
-	{0x6b23, 1741},
-	{0x6b27, 1316},
-	{0x6b32, 3913},
-	{0x6b37, 5335},
-	{0x6b38, 5334},
-	{0x6b39, 5337},
-	{0x6b3a, 1623},
-	{0x6b3d, 1742},
-	{0x6b3e, 1530},
-	{0x6b43, 5340},
-	{0x6b47, 5339},
-	{0x6b49, 5341},
-	{0x6b4c, 1358},
-	{0x6b4e, 2933},
-	{0x6b50, 5342},
-	{0x6b53, 1531},
-	{0x6b54, 5344},
-	{0x6b59, 5343},
-	{0x6b5b, 5345},
-	{0x6b5f, 5346},
-	{0x6b61, 5347},
-	{0x6b62, 2221},
-	{0x6b63, 2649},
-	{0x6b64, 2065},
-	{0x6b66, 3554},
-	{0x6b69, 3634},
-	{0x6b6a, 4074},
-	{0x6b6f, 2243},
-	{0x6b73, 2112},
-	{0x6b74, 4026},
-	{0x6b78, 5348},
-	{0x6b79, 5349},
-	{0x6b7b, 2222},
-	{0x6b7f, 5350},
-	{0x6b80, 5351},
-	{0x6b83, 5353},
-	{0x6b84, 5352},
-	{0x6b86, 3718},
-	{0x6b89, 2408},
-	{0x6b8a, 2328},
-	{0x6b8b, 2194},
-	{0x6b8d, 5354},
-	{0x6b95, 5356},
-	{0x6b96, 2537},
-	{0x6b98, 5355},
-	{0x6b9e, 5357},
-	{0x6ba4, 5358},
-	{0x6baa, 5359},
-	{0x6bab, 5360},
-	{0x6baf, 5361},
-	{0x6bb1, 5363},
-	{0x6bb2, 5362},
-	{0x6bb3, 5364},
-	{0x6bb4, 1317},
-	{0x6bb5, 2952},
-	{0x6bb7, 5365},
-	{0x6bba, 2164},
-	{0x6bbb, 1450},
-	{0x6bbc, 5366},
-	{0x6bbf, 3132},
-	{0x6bc0, 4509},
-	{0x6bc5, 1597},
-	{0x6bc6, 5367},
-	{0x6bcb, 5368},
-	{0x6bcd, 3644},
-	{0x6bce, 3734},
-	{0x6bd2, 3231},
-	{0x6bd3, 5369},
-	{0x6bd4, 3450},
-	{0x6bd6, 8509},
-	{0x6bd8, 3471},
-	{0x6bdb, 3807},
-	{0x6bdf, 5370},
-	{0x6beb, 5372},
-	{0x6bec, 5371},
-	{0x6bef, 5374},
-	{0x6bf3, 5373},
-	{0x6c08, 5376},
-	{0x6c0f, 2223},
-	{0x6c11, 3773},
-	{0x6c13, 5377},
-	{0x6c14, 5378},
-	{0x6c17, 1598},
-	{0x6c1b, 5379},
-	{0x6c23, 5381},
-	{0x6c24, 5380},
-	{0x6c34, 2603},
-	{0x6c37, 3499},
-	{0x6c38, 1260},
-	{0x6c3e, 3417},
-	{0x6c3f, 8510},
-	{0x6c40, 3089},
-	{0x6c41, 2379},
-	{0x6c42, 1659},
-	{0x6c4e, 3418},
-	{0x6c50, 2266},
-	{0x6c55, 5383},
-	{0x6c57, 1532},
-	{0x6c5a, 1306},
-	{0x6c5c, 8511},
-	{0x6c5d, 3274},
-	{0x6c5e, 5382},
-	{0x6c5f, 2000},
-	{0x6c60, 2961},
-	{0x6c62, 5384},
-	{0x6c68, 5392},
-	{0x6c6a, 5385},
-	{0x6c6f, 8513},
-	{0x6c70, 2849},
-	{0x6c72, 1660},
-	{0x6c73, 5393},
-	{0x6c7a, 1854},
-	{0x6c7d, 1599},
-	{0x6c7e, 5391},
-	{0x6c81, 5389},
-	{0x6c82, 5386},
-	{0x6c83, 3914},
-	{0x6c86, 8512},
-	{0x6c88, 3036},
-	{0x6c8c, 3249},
-	{0x6c8d, 5387},
-	{0x6c90, 5395},
-	{0x6c92, 5394},
-	{0x6c93, 1785},
-	{0x6c96, 1325},
-	{0x6c99, 2091},
-	{0x6c9a, 5388},
-	{0x6c9b, 5390},
-	{0x6ca1, 3717},
-	{0x6ca2, 2900},
-	{0x6cab, 3749},
-	{0x6cae, 5403},
-	{0x6cb1, 5404},
-	{0x6cb3, 1359},
-	{0x6cb8, 3576},
-	{0x6cb9, 3849},
-	{0x6cba, 5406},
-	{0x6cbb, 2255},
-	{0x6cbc, 2474},
-	{0x6cbd, 5399},
-	{0x6cbe, 5405},
-	{0x6cbf, 1290},
-	{0x6cc1, 1711},
-	{0x6cc4, 5396},
-	{0x6cc5, 5401},
-	{0x6cc9, 2712},
-	{0x6cca, 3367},
-	{0x6ccc, 3451},
-	{0x6cd3, 5398},
-	{0x6cd5, 3663},
-	{0x6cd7, 5400},
-	{0x6cd9, 5409},
-	{0x6cda, 8514},
-	{0x6cdb, 5407},
-	{0x6cdd, 5402},
-	{0x6ce1, 3664},
-	{0x6ce2, 3326},
-	{0x6ce3, 1661},
-	{0x6ce5, 3103},
-	{0x6ce8, 2987},
-	{0x6cea, 5410},
-	{0x6cec, 0},
-	{0x6cef, 5408},
-	{0x6cf0, 2873},
-	{0x6cf1, 5397},
-	{0x6cf3, 1261},
-	{0x6d04, 8515},
-	{0x6d0b, 3896},
-	{0x6d0c, 5421},
-	{0x6d12, 5420},
-	{0x6d17, 2714},
-	{0x6d19, 5417},
-	{0x6d1b, 3926},
-	{0x6d1e, 3214},
-	{0x6d1f, 5411},
-	{0x6d25, 3041},
-	{0x6d29, 1262},
-	{0x6d2a, 2001},
-	{0x6d2b, 5414},
-	{0x6d32, 2353},
-	{0x6d33, 5419},
-	{0x6d35, 5418},
-	{0x6d36, 5413},
-	{0x6d38, 5416},
-	{0x6d3b, 1478},
-	{0x6d3d, 5415},
-	{0x6d3e, 3327},
-	{0x6d41, 3958},
-	{0x6d44, 2524},
-	{0x6d45, 2713},
-	{0x6d59, 5427},
-	{0x6d5a, 5425},
-	{0x6d5c, 3519},
-	{0x6d63, 5422},
-	{0x6d64, 5424},
-	{0x6d66, 1244},
-	{0x6d69, 2002},
-	{0x6d6a, 4056},
-	{0x6d6c, 1435},
-	{0x6d6e, 3540},
-	{0x6d6f, 8517},
-	{0x6d74, 3915},
-	{0x6d77, 1410},
-	{0x6d78, 2561},
-	{0x6d79, 5426},
-	{0x6d85, 5431},
-	{0x6d87, 8516},
-	{0x6d88, 2475},
-	{0x6d8c, 3866},
-	{0x6d8e, 5428},
-	{0x6d93, 5423},
-	{0x6d95, 5429},
-	{0x6d96, 8518},
-	{0x6d99, 4006},
-	{0x6d9b, 3181},
-	{0x6d9c, 3226},
-	{0x6dac, 8519},
-	{0x6daf, 1428},
-	{0x6db2, 1271},
-	{0x6db5, 5435},
-	{0x6db8, 5438},
-	{0x6dbc, 3979},
-	{0x6dc0, 3918},
-	{0x6dc5, 5445},
-	{0x6dc6, 5439},
-	{0x6dc7, 5436},
-	{0x6dcb, 3996},
-	{0x6dcc, 5442},
-	{0x6dcf, 8520},
-	{0x6dd1, 2388},
-	{0x6dd2, 5444},
-	{0x6dd5, 5449},
-	{0x6dd8, 3179},
-	{0x6dd9, 5447},
-	{0x6dde, 5441},
-	{0x6de1, 2934},
-	{0x6de4, 5448},
-	{0x6de6, 5437},
-	{0x6de8, 5443},
-	{0x6dea, 5450},
-	{0x6deb, 1216},
-	{0x6dec, 5440},
-	{0x6dee, 5451},
-	{0x6df1, 2562},
-	{0x6df2, 8522},
-	{0x6df3, 2409},
-	{0x6df5, 3573},
-	{0x6df7, 2078},
-	{0x6df8, 8521},
-	{0x6df9, 5432},
-	{0x6dfa, 5446},
-	{0x6dfb, 3124},
-	{0x6dfc, 8523},
-	{0x6e05, 2650},
-	{0x6e07, 1479},
-	{0x6e08, 2113},
-	{0x6e09, 2476},
-	{0x6e0a, 5434},
-	{0x6e0b, 2380},
-	{0x6e13, 1826},
-	{0x6e15, 5433},
-	{0x6e19, 5455},
-	{0x6e1a, 2423},
-	{0x6e1b, 1902},
-	{0x6e1d, 5470},
-	{0x6e1f, 5464},
-	{0x6e20, 1678},
-	{0x6e21, 3145},
-	{0x6e23, 5459},
-	{0x6e24, 5468},
-	{0x6e25, 1139},
-	{0x6e26, 1236},
-	{0x6e27, 8526},
-	{0x6e29, 1337},
-	{0x6e2b, 5461},
-	{0x6e2c, 2828},
-	{0x6e2d, 5452},
-	{0x6e2e, 5454},
-	{0x6e2f, 2003},
-	{0x6e38, 5471},
-	{0x6e39, 8524},
-	{0x6e3a, 5466},
-	{0x6e3c, 8527},
-	{0x6e3e, 5458},
-	{0x6e43, 5465},
-	{0x6e4a, 3767},
-	{0x6e4d, 5463},
-	{0x6e4e, 5467},
-	{0x6e56, 1924},
-	{0x6e58, 2477},
-	{0x6e5b, 2935},
-	{0x6e5c, 8525},
-	{0x6e5f, 5457},
-	{0x6e67, 3865},
-	{0x6e6b, 5460},
-	{0x6e6e, 5453},
-	{0x6e6f, 3180},
-	{0x6e72, 5456},
-	{0x6e76, 5462},
-	{0x6e7e, 4087},
-	{0x6e7f, 2282},
-	{0x6e80, 3756},
-	{0x6e82, 5472},
-	{0x6e8c, 3394},
-	{0x6e8f, 5484},
-	{0x6e90, 1903},
-	{0x6e96, 2410},
-	{0x6e98, 5474},
-	{0x6e9c, 3959},
-	{0x6e9d, 2004},
-	{0x6e9f, 5487},
-	{0x6ea2, 1202},
-	{0x6ea5, 5485},
-	{0x6eaa, 5473},
-	{0x6eaf, 5479},
-	{0x6eb2, 5481},
-	{0x6eb6, 3897},
-	{0x6eb7, 5476},
-	{0x6eba, 3112},
-	{0x6ebd, 5478},
-	{0x6ebf, 8528},
-	{0x6ec2, 5486},
-	{0x6ec4, 5480},
-	{0x6ec5, 3795},
-	{0x6ec9, 5475},
-	{0x6ecb, 2254},
-	{0x6ecc, 5499},
-	{0x6ed1, 1480},
-	{0x6ed3, 5477},
-	{0x6ed4, 5482},
-	{0x6ed5, 5483},
-	{0x6edd, 2892},
-	{0x6ede, 2874},
-	{0x6eec, 5491},
-	{0x6eef, 5497},
-	{0x6ef2, 5495},
-	{0x6ef4, 3107},
-	{0x6ef7, 5502},
-	{0x6ef8, 5492},
-	{0x6efe, 5493},
-	{0x6eff, 5469},
-	{0x6f01, 1683},
-	{0x6f02, 3500},
-	{0x6f06, 2283},
-	{0x6f09, 2057},
-	{0x6f0f, 4057},
-	{0x6f11, 5489},
-	{0x6f13, 5501},
-	{0x6f14, 1291},
-	{0x6f15, 2792},
-	{0x6f20, 3375},
-	{0x6f22, 1533},
-	{0x6f23, 4034},
-	{0x6f2b, 3757},
-	{0x6f2c, 3054},
-	{0x6f31, 5496},
-	{0x6f32, 5498},
-	{0x6f38, 2740},
-	{0x6f3e, 5500},
-	{0x6f3f, 5494},
-	{0x6f41, 5488},
-	{0x6f45, 1535},
-	{0x6f51, 7776},
-	{0x6f54, 1855},
-	{0x6f58, 5514},
-	{0x6f5b, 5509},
-	{0x6f5c, 2716},
-	{0x6f5f, 1473},
-	{0x6f64, 2411},
-	{0x6f66, 5518},
-	{0x6f6d, 5511},
-	{0x6f6e, 3016},
-	{0x6f6f, 5508},
-	{0x6f70, 3061},
-	{0x6f74, 5543},
-	{0x6f78, 5505},
-	{0x6f7a, 5504},
-	{0x6f7c, 5513},
-	{0x6f80, 5507},
-	{0x6f81, 5506},
-	{0x6f82, 5512},
-	{0x6f84, 2629},
-	{0x6f86, 5503},
-	{0x6f88, 8529},
-	{0x6f8e, 5515},
-	{0x6f91, 5516},
-	{0x6f97, 1534},
-	{0x6fa1, 5521},
-	{0x6fa3, 5520},
-	{0x6fa4, 5522},
-	{0x6fa8, 0},
-	{0x6faa, 5525},
-	{0x6fb1, 3133},
-	{0x6fb3, 5519},
-	{0x6fb5, 8530},
-	{0x6fb9, 5523},
-	{0x6fc0, 1849},
-	{0x6fc1, 2905},
-	{0x6fc2, 5517},
-	{0x6fc3, 3313},
-	{0x6fc6, 5524},
-	{0x6fd4, 5529},
-	{0x6fd5, 5527},
-	{0x6fd8, 5530},
-	{0x6fdb, 5533},
-	{0x6fdf, 5526},
-	{0x6fe0, 2044},
-	{0x6fe1, 3294},
-	{0x6fe4, 5430},
-	{0x6feb, 3934},
-	{0x6fec, 5528},
-	{0x6fee, 5532},
-	{0x6fef, 2901},
-	{0x6ff1, 5531},
-	{0x6ff3, 5510},
-	{0x6ff5, 8531},
-	{0x6ff6, 7076},
-	{0x6ffa, 5536},
-	{0x6ffe, 5540},
-	{0x7001, 5538},
-	{0x7005, 8532},
-	{0x7006, 7760},
-	{0x7007, 8533},
-	{0x7009, 5534},
-	{0x700b, 5535},
-	{0x700f, 5539},
-	{0x7011, 5537},
-	{0x7015, 3520},
-	{0x7018, 5545},
-	{0x701a, 5542},
-	{0x701b, 5541},
-	{0x701d, 5544},
-	{0x701e, 3244},
-	{0x701f, 5546},
-	{0x7026, 2995},
-	{0x7027, 2893},
-	{0x7028, 8534},
-	{0x702c, 2633},
-	{0x7030, 5547},
-	{0x7032, 5549},
-	{0x703e, 5548},
-	{0x704c, 5490},
-	{0x7051, 5550},
-	{0x7058, 3263},
-	{0x705e, 0},
-	{0x7063, 5551},
-	{0x706b, 1360},
-	{0x706f, 3182},
-	{0x7070, 1411},
-	{0x7078, 1662},
-	{0x707c, 2314},
-	{0x707d, 2114},
-	{0x7085, 8535},
-	{0x7089, 4045},
-	{0x708a, 2604},
-	{0x708e, 1292},
-	{0x7092, 5553},
-	{0x7099, 5552},
-	{0x70ab, 8536},
-	{0x70ac, 5556},
-	{0x70ad, 2936},
-	{0x70ae, 5559},
-	{0x70af, 5554},
-	{0x70b3, 5558},
-	{0x70b8, 5557},
-	{0x70b9, 3130},
-	{0x70ba, 1181},
-	{0x70bb, 8365},
-	{0x70c8, 4029},
-	{0x70cb, 5561},
-	{0x70cf, 1226},
-	{0x70d4, 0},
-	{0x70d9, 5563},
-	{0x70dd, 5562},
-	{0x70df, 5560},
-	{0x70f1, 5555},
-	{0x70f9, 3665},
-	{0x70fd, 5565},
-	{0x7104, 8538},
-	{0x7109, 5564},
-	{0x710f, 8537},
-	{0x7114, 1293},
-	{0x7119, 5567},
-	{0x711a, 3586},
-	{0x711c, 5566},
-	{0x7121, 3777},
-	{0x7126, 2479},
-	{0x7130, 7644},
-	{0x7136, 2741},
-	{0x713c, 2478},
-	{0x7146, 8540},
-	{0x7147, 8541},
-	{0x7149, 4035},
-	{0x714c, 5573},
-	{0x714e, 2717},
-	{0x7155, 5569},
-	{0x7156, 5574},
-	{0x7159, 1294},
-	{0x715c, 8539},
-	{0x7162, 5572},
-	{0x7164, 3351},
-	{0x7165, 5568},
-	{0x7166, 5571},
-	{0x7167, 2480},
-	{0x7169, 3429},
-	{0x716c, 5575},
-	{0x716e, 2301},
-	{0x717d, 2718},
-	{0x7184, 5578},
-	{0x7188, 5570},
-	{0x718a, 1789},
-	{0x718f, 5576},
-	{0x7194, 3898},
-	{0x7195, 5579},
-	{0x7199, 8285},
-	{0x719f, 2393},
-	{0x71a8, 5580},
-	{0x71ac, 5581},
-	{0x71b1, 3300},
-	{0x71b9, 5583},
-	{0x71be, 5584},
-	{0x71c1, 8543},
-	{0x71c3, 3305},
-	{0x71c8, 3183},
-	{0x71c9, 5586},
-	{0x71ce, 5588},
-	{0x71d0, 3997},
-	{0x71d2, 5585},
-	{0x71d4, 5587},
-	{0x71d5, 1295},
-	{0x71d7, 5582},
-	{0x71df, 4430},
-	{0x71e0, 5589},
-	{0x71e5, 2793},
-	{0x71e6, 2182},
-	{0x71e7, 5591},
-	{0x71ec, 5590},
-	{0x71ed, 2538},
-	{0x71ee, 4334},
-	{0x71f5, 5592},
-	{0x71f9, 5594},
-	{0x71fb, 5577},
-	{0x71fc, 5593},
-	{0x71fe, 8544},
-	{0x71ff, 5595},
-	{0x7206, 3376},
-	{0x720d, 5596},
-	{0x7210, 5597},
-	{0x721b, 5598},
-	{0x7228, 5599},
-	{0x722a, 3066},
-	{0x722c, 5601},
-	{0x722d, 5600},
-	{0x7230, 5602},
-	{0x7232, 5603},
-	{0x7235, 2315},
-	{0x7236, 3541},
-	{0x723a, 3832},
-	{0x723b, 5604},
-	{0x723c, 5605},
-	{0x723d, 2776},
-	{0x723e, 2256},
-	{0x723f, 5606},
-	{0x7240, 5607},
-	{0x7246, 5608},
-	{0x7247, 3618},
-	{0x7248, 3419},
-	{0x724b, 5609},
-	{0x724c, 3341},
-	{0x7252, 3017},
-	{0x7256, 0},
-	{0x7258, 5610},
-	{0x7259, 1383},
-	{0x725b, 1671},
-	{0x725d, 3794},
-	{0x725f, 3778},
-	{0x7261, 1332},
-	{0x7262, 4058},
-	{0x7267, 3712},
-	{0x7269, 3578},
-	{0x7272, 2651},
-	{0x7274, 5611},
-	{0x7279, 3227},
-	{0x727d, 1879},
-	{0x727e, 5612},
-	{0x7280, 2116},
-	{0x7281, 5614},
-	{0x7282, 5613},
-	{0x7287, 5615},
-	{0x7292, 5616},
-	{0x7296, 5617},
-	{0x72a0, 1624},
-	{0x72a2, 5618},
-	{0x72a7, 5619},
-	{0x72ac, 1880},
-	{0x72af, 3420},
-	{0x72b1, 8545},
-	{0x72b2, 5621},
-	{0x72b6, 2525},
-	{0x72b9, 5620},
-	{0x72be, 8546},
-	{0x72c2, 1712},
-	{0x72c3, 5622},
-	{0x72c4, 5624},
-	{0x72c6, 5623},
-	{0x72ce, 5625},
-	{0x72d0, 1925},
-	{0x72d2, 5626},
-	{0x72d7, 1761},
-	{0x72d9, 2754},
-	{0x72db, 2063},
-	{0x72e0, 5628},
-	{0x72e1, 5629},
-	{0x72e2, 5627},
-	{0x72e9, 2329},
-	{0x72ec, 3232},
-	{0x72ed, 1713},
-	{0x72f7, 5631},
-	{0x72f8, 2922},
-	{0x72f9, 5630},
-	{0x72fc, 4059},
-	{0x72fd, 3352},
-	{0x7305, 0},
-	{0x730a, 5634},
-	{0x7316, 5636},
-	{0x7317, 5633},
-	{0x731b, 3808},
-	{0x731c, 5635},
-	{0x731d, 5637},
-	{0x731f, 3980},
-	{0x7324, 8547},
-	{0x7325, 5641},
-	{0x7329, 5640},
-	{0x732a, 2996},
-	{0x732b, 3299},
-	{0x732e, 1881},
-	{0x732f, 5639},
-	{0x7334, 5638},
-	{0x7336, 3867},
-	{0x7337, 3868},
-	{0x733e, 5642},
-	{0x733f, 1296},
-	{0x7344, 2056},
-	{0x7345, 2224},
-	{0x734e, 5643},
-	{0x734f, 5644},
-	{0x7357, 5646},
-	{0x7363, 2381},
-	{0x7368, 5648},
-	{0x736a, 5647},
-	{0x7370, 5649},
-	{0x7372, 1451},
-	{0x7375, 5651},
-	{0x7377, 8549},
-	{0x7378, 5650},
-	{0x737a, 5653},
-	{0x737b, 5652},
-	{0x7384, 1904},
-	{0x7386, 0},
-	{0x7387, 3952},
-	{0x7389, 1732},
-	{0x738b, 1318},
-	{0x7396, 1762},
-	{0x739f, 0},
-	{0x73a0, 1},
-	{0x73a9, 1565},
-	{0x73b2, 4016},
-	{0x73b3, 5655},
-	{0x73bb, 5657},
-	{0x73bd, 8550},
-	{0x73c0, 5658},
-	{0x73c2, 1361},
-	{0x73c8, 5654},
-	{0x73c9, 8551},
-	{0x73ca, 2183},
-	{0x73cd, 3037},
-	{0x73ce, 5656},
-	{0x73d2, 8554},
-	{0x73d6, 8552},
-	{0x73de, 5661},
-	{0x73e0, 2330},
-	{0x73e3, 8553},
-	{0x73e5, 5659},
-	{0x73ea, 1812},
-	{0x73ed, 3421},
-	{0x73ee, 5660},
-	{0x73f1, 5687},
-	{0x73f5, 8556},
-	{0x73f8, 5666},
-	{0x73fe, 1905},
-	{0x7403, 1663},
-	{0x7405, 5663},
-	{0x7406, 3943},
-	{0x7407, 8555},
-	{0x7409, 3960},
-	{0x741b, 0},
-	{0x7422, 2902},
-	{0x7425, 5665},
-	{0x7426, 8557},
-	{0x7429, 8559},
-	{0x742a, 8558},
-	{0x742e, 8560},
-	{0x7430, 0},
-	{0x7431, 1},
-	{0x7432, 5667},
-	{0x7433, 3998},
-	{0x7434, 1743},
-	{0x7435, 3472},
-	{0x7436, 3328},
-	{0x743a, 5668},
-	{0x743f, 5670},
-	{0x7441, 5673},
-	{0x7455, 5669},
-	{0x7459, 5672},
-	{0x745a, 1950},
-	{0x745b, 1263},
-	{0x745c, 5674},
-	{0x745e, 2614},
-	{0x745f, 5671},
-	{0x7460, 4004},
-	{0x7462, 8561},
-	{0x7463, 5677},
-	{0x7464, 7477},
-	{0x7469, 5675},
-	{0x746a, 5678},
-	{0x746f, 5664},
-	{0x7470, 5676},
-	{0x7473, 2092},
-	{0x7476, 5679},
-	{0x747e, 5680},
-	{0x7483, 3944},
-	{0x7486, 0},
-	{0x7487, 1},
-	{0x7489, 8562},
-	{0x748b, 5681},
-	{0x749e, 5682},
-	{0x749f, 8563},
-	{0x74a2, 5662},
-	{0x74a7, 5683},
-	{0x74b0, 1536},
-	{0x74bd, 2257},
-	{0x74ca, 5684},
-	{0x74cf, 5685},
-	{0x74d4, 5686},
-	{0x74dc, 1245},
-	{0x74e0, 5688},
-	{0x74e2, 3501},
-	{0x74e3, 5689},
-	{0x74e6, 1504},
-	{0x74e7, 5690},
-	{0x74e9, 5691},
-	{0x74ee, 5692},
-	{0x74f0, 5694},
-	{0x74f1, 5695},
-	{0x74f2, 5693},
-	{0x74f6, 3525},
-	{0x74f7, 5697},
-	{0x74f8, 5696},
-	{0x7501, 8564},
-	{0x7503, 5699},
-	{0x7504, 5698},
-	{0x7505, 5700},
-	{0x750c, 5701},
-	{0x750d, 5703},
-	{0x750e, 5702},
-	{0x7511, 2059},
-	{0x7513, 5705},
-	{0x7515, 5704},
-	{0x7518, 1537},
-	{0x751a, 2585},
-	{0x751c, 3126},
-	{0x751e, 5706},
-	{0x751f, 2652},
-	{0x7523, 2184},
-	{0x7525, 1307},
-	{0x7526, 5707},
-	{0x7528, 3899},
-	{0x752b, 3635},
-	{0x752c, 5708},
-	{0x752f, 8434},
-	{0x7530, 3134},
-	{0x7531, 3869},
-	{0x7532, 2005},
-	{0x7533, 2563},
-	{0x7537, 2953},
-	{0x7538, 4297},
-	{0x753a, 3018},
-	{0x753b, 1384},
-	{0x753c, 5709},
-	{0x7544, 5710},
-	{0x7546, 5715},
-	{0x7549, 5713},
-	{0x754a, 5712},
-	{0x754b, 5063},
-	{0x754c, 1412},
-	{0x754d, 5711},
-	{0x754f, 1182},
-	{0x7551, 3390},
-	{0x7554, 3422},
-	{0x7559, 3961},
-	{0x755a, 5716},
-	{0x755b, 5714},
-	{0x755c, 2970},
-	{0x755d, 2634},
-	{0x7560, 3391},
-	{0x7562, 3487},
-	{0x7564, 5718},
-	{0x7565, 3956},
-	{0x7566, 1827},
-	{0x7567, 5719},
-	{0x7569, 5717},
-	{0x756a, 3434},
-	{0x756b, 5720},
-	{0x756d, 5721},
-	{0x756f, 8565},
-	{0x7570, 1183},
-	{0x7573, 2526},
-	{0x7574, 5726},
-	{0x7576, 5723},
-	{0x7577, 3269},
-	{0x7578, 5722},
-	{0x757f, 1600},
-	{0x7582, 5729},
-	{0x7586, 5724},
-	{0x7587, 5725},
-	{0x7589, 5728},
-	{0x758a, 5727},
-	{0x758b, 3479},
-	{0x758e, 2756},
-	{0x758f, 2755},
-	{0x7591, 1625},
-	{0x7593, 0},
-	{0x7594, 5730},
-	{0x759a, 5731},
-	{0x759d, 5732},
-	{0x75a3, 5734},
-	{0x75a5, 5733},
-	{0x75ab, 1272},
-	{0x75b1, 5742},
-	{0x75b2, 3452},
-	{0x75b3, 5736},
-	{0x75b5, 5738},
-	{0x75b8, 5740},
-	{0x75b9, 2564},
-	{0x75bc, 5741},
-	{0x75bd, 5739},
-	{0x75be, 2284},
-	{0x75c2, 5735},
-	{0x75c3, 5737},
-	{0x75c5, 3508},
-	{0x75c7, 2481},
-	{0x75ca, 5744},
-	{0x75cd, 5743},
-	{0x75d2, 5745},
-	{0x75d4, 2258},
-	{0x75d5, 2079},
-	{0x75d8, 3185},
-	{0x75d9, 5746},
-	{0x75db, 3047},
-	{0x75de, 5748},
-	{0x75e2, 3945},
-	{0x75e3, 5747},
-	{0x75e9, 2795},
-	{0x75f0, 5753},
-	{0x75f2, 5755},
-	{0x75f3, 5756},
-	{0x75f4, 2962},
-	{0x75fa, 5754},
-	{0x75fc, 5751},
-	{0x75fe, 5749},
-	{0x75ff, 5750},
-	{0x7601, 5752},
-	{0x7609, 5759},
-	{0x760b, 5757},
-	{0x760d, 5758},
-	{0x7616, 0},
-	{0x761f, 5760},
-	{0x7620, 5762},
-	{0x7621, 5763},
-	{0x7622, 5764},
-	{0x7624, 5765},
-	{0x7626, 7725},
-	{0x7627, 5761},
-	{0x7630, 5767},
-	{0x7634, 5766},
-	{0x763b, 5768},
-	{0x7642, 3981},
-	{0x7646, 5771},
-	{0x7647, 5769},
-	{0x7648, 5770},
-	{0x764c, 1566},
-	{0x7652, 3850},
-	{0x7656, 3610},
-	{0x7658, 5773},
-	{0x765c, 5772},
-	{0x7661, 5774},
-	{0x7662, 5775},
-	{0x7667, 5779},
-	{0x7668, 5776},
-	{0x7669, 5777},
-	{0x766a, 5778},
-	{0x766c, 5780},
-	{0x7670, 5781},
-	{0x7672, 5782},
-	{0x7676, 5783},
-	{0x7678, 5784},
-	{0x767a, 3395},
-	{0x767b, 3146},
-	{0x767c, 5785},
-	{0x767d, 3368},
-	{0x767e, 3494},
-	{0x7680, 5786},
-	{0x7682, 8566},
-	{0x7683, 5787},
-	{0x7684, 3108},
-	{0x7686, 1413},
-	{0x7687, 2006},
-	{0x7688, 5788},
-	{0x768b, 5789},
-	{0x768e, 5790},
-	{0x7690, 2167},
-	{0x7693, 5792},
-	{0x7696, 5791},
-	{0x7699, 5793},
-	{0x769a, 5794},
-	{0x769b, 8569},
-	{0x769c, 8567},
-	{0x769e, 8568},
-	{0x76a5, 0},
-	{0x76a6, 8570},
-	{0x76ae, 3453},
-	{0x76b0, 5795},
-	{0x76b4, 5796},
-	{0x76b7, 7452},
-	{0x76b8, 5797},
-	{0x76b9, 5798},
-	{0x76ba, 5799},
-	{0x76bf, 2172},
-	{0x76c2, 5800},
-	{0x76c3, 3340},
-	{0x76c6, 3725},
-	{0x76c8, 1264},
-	{0x76ca, 1273},
-	{0x76cd, 5801},
-	{0x76d2, 5803},
-	{0x76d6, 5802},
-	{0x76d7, 3178},
-	{0x76db, 2653},
-	{0x76dc, 5336},
-	{0x76de, 5804},
-	{0x76df, 3789},
-	{0x76e1, 5805},
-	{0x76e3, 1538},
-	{0x76e4, 3435},
-	{0x76e5, 5806},
-	{0x76e7, 5807},
-	{0x76ea, 5808},
-	{0x76ee, 3816},
-	{0x76f2, 3809},
-	{0x76f4, 3034},
-	{0x76f8, 2796},
-	{0x76fb, 5810},
-	{0x76fe, 2412},
-	{0x7701, 2482},
-	{0x7704, 5813},
-	{0x7707, 5812},
-	{0x7708, 5811},
-	{0x7709, 3473},
-	{0x770b, 1539},
-	{0x770c, 1885},
-	{0x771b, 5819},
-	{0x771e, 5816},
-	{0x771f, 2565},
-	{0x7720, 3774},
-	{0x7724, 5815},
-	{0x7725, 5817},
-	{0x7726, 5818},
-	{0x7729, 5814},
-	{0x7737, 5820},
-	{0x7738, 5821},
-	{0x773a, 3019},
-	{0x773c, 1567},
-	{0x7740, 2979},
-	{0x7746, 8572},
-	{0x7747, 5822},
-	{0x775a, 5823},
-	{0x775b, 5826},
-	{0x7760, 0},
-	{0x7761, 2605},
-	{0x7762, 7877},
-	{0x7763, 3228},
-	{0x7765, 5827},
-	{0x7766, 3713},
-	{0x7768, 5824},
-	{0x776b, 5825},
-	{0x7779, 5830},
-	{0x777e, 5829},
-	{0x777f, 5828},
-	{0x778b, 5832},
-	{0x778e, 5831},
-	{0x7791, 5833},
-	{0x779e, 5835},
-	{0x77a0, 5834},
-	{0x77a5, 3613},
-	{0x77ac, 2400},
-	{0x77ad, 3982},
-	{0x77b0, 5836},
-	{0x77b3, 3215},
-	{0x77b6, 5837},
-	{0x77b9, 5838},
-	{0x77bb, 5842},
-	{0x77bc, 5840},
-	{0x77bd, 5841},
-	{0x77bf, 5839},
-	{0x77c7, 5843},
-	{0x77cd, 5844},
-	{0x77d7, 5845},
-	{0x77da, 5846},
-	{0x77db, 3779},
-	{0x77dc, 5847},
-	{0x77e2, 3836},
-	{0x77e3, 5848},
-	{0x77e5, 2956},
-	{0x77e7, 3360},
-	{0x77e9, 1763},
-	{0x77ed, 2937},
-	{0x77ee, 5849},
-	{0x77ef, 1714},
-	{0x77f3, 2676},
-	{0x77fc, 5850},
-	{0x7802, 2093},
-	{0x780c, 5851},
-	{0x7812, 5852},
-	{0x7814, 1882},
-	{0x7815, 2117},
-	{0x7820, 5854},
-	{0x7821, 8574},
-	{0x7825, 3152},
-	{0x7826, 2118},
-	{0x7827, 1640},
-	{0x782e, 0},
-	{0x7832, 3666},
-	{0x7834, 3329},
-	{0x783a, 3153},
-	{0x783f, 2030},
-	{0x7845, 5856},
-	{0x784e, 8575},
-	{0x785d, 2483},
-	{0x7864, 8576},
-	{0x786b, 3962},
-	{0x786c, 2007},
-	{0x786f, 1883},
-	{0x7872, 3383},
-	{0x7874, 5858},
-	{0x787a, 8577},
-	{0x787c, 5860},
-	{0x7881, 1951},
-	{0x7886, 5859},
-	{0x7887, 3090},
-	{0x788c, 5862},
-	{0x788d, 1429},
-	{0x788e, 5857},
-	{0x7891, 3454},
-	{0x7893, 1234},
-	{0x7895, 2140},
-	{0x7897, 4088},
-	{0x789a, 5861},
-	{0x78a3, 5863},
-	{0x78a7, 3611},
-	{0x78a9, 2685},
-	{0x78aa, 5865},
-	{0x78af, 5866},
-	{0x78b5, 5864},
-	{0x78ba, 1452},
-	{0x78bc, 5872},
-	{0x78be, 5871},
-	{0x78c1, 2259},
-	{0x78c5, 5873},
-	{0x78c6, 5868},
-	{0x78ca, 5874},
-	{0x78cb, 5869},
-	{0x78d0, 3436},
-	{0x78d1, 5867},
-	{0x78d4, 5870},
-	{0x78da, 5877},
-	{0x78e1, 0},
-	{0x78e7, 5876},
-	{0x78e8, 3727},
-	{0x78ec, 5875},
-	{0x78ef, 1199},
-	{0x78f4, 5879},
-	{0x78fd, 5878},
-	{0x7901, 2484},
-	{0x7907, 5880},
-	{0x790e, 2757},
-	{0x7911, 5882},
-	{0x7912, 5881},
-	{0x7919, 5883},
-	{0x7926, 5853},
-	{0x792a, 5855},
-	{0x792b, 5885},
-	{0x792c, 5884},
-	{0x7930, 8578},
-	{0x793a, 2260},
-	{0x793c, 4017},
-	{0x793e, 2302},
-	{0x7940, 5886},
-	{0x7941, 1805},
-	{0x7947, 1626},
-	{0x7948, 1601},
-	{0x7949, 2225},
-	{0x7950, 3870},
-	{0x7953, 5892},
-	{0x7955, 5891},
-	{0x7956, 2758},
-	{0x7957, 5888},
-	{0x795a, 5890},
-	{0x795c, 0},
-	{0x795d, 2389},
-	{0x795e, 2566},
-	{0x795f, 5889},
-	{0x7960, 5887},
-	{0x7962, 3296},
-	{0x7965, 2485},
-	{0x7968, 3502},
-	{0x796d, 2119},
-	{0x7977, 3186},
-	{0x797a, 5893},
-	{0x797f, 5894},
-	{0x7980, 5916},
-	{0x7981, 1744},
-	{0x7984, 4067},
-	{0x7985, 2743},
-	{0x798a, 5895},
-	{0x798d, 1362},
-	{0x798e, 3091},
-	{0x798f, 3569},
-	{0x7994, 8582},
-	{0x799b, 8584},
-	{0x799d, 5896},
-	{0x79a6, 1684},
-	{0x79a7, 5897},
-	{0x79aa, 5899},
-	{0x79ae, 5900},
-	{0x79b0, 3295},
-	{0x79b1, 7758},
-	{0x79b3, 5901},
-	{0x79b9, 5902},
-	{0x79ba, 5903},
-	{0x79bd, 1745},
-	{0x79be, 1363},
-	{0x79bf, 3229},
-	{0x79c0, 2354},
-	{0x79c1, 2226},
-	{0x79c9, 5904},
-	{0x79cb, 2355},
-	{0x79d1, 1354},
-	{0x79d2, 3509},
-	{0x79d5, 5905},
-	{0x79d8, 3455},
-	{0x79df, 2759},
-	{0x79e1, 5908},
-	{0x79e3, 5909},
-	{0x79e4, 3359},
-	{0x79e6, 2567},
-	{0x79e7, 5906},
-	{0x79e9, 2975},
-	{0x79ec, 5907},
-	{0x79f0, 2486},
-	{0x79fb, 1184},
-	{0x7a00, 1603},
-	{0x7a08, 5910},
-	{0x7a0b, 3092},
-	{0x7a0d, 5911},
-	{0x7a0e, 2667},
-	{0x7a14, 3769},
-	{0x7a17, 3477},
-	{0x7a18, 5912},
-	{0x7a19, 5913},
-	{0x7a1a, 2963},
-	{0x7a1c, 3983},
-	{0x7a1f, 5915},
-	{0x7a20, 5914},
-	{0x7a2e, 2331},
-	{0x7a31, 5917},
-	{0x7a32, 1204},
-	{0x7a37, 5920},
-	{0x7a3b, 5918},
-	{0x7a3c, 1364},
-	{0x7a3d, 1828},
-	{0x7a3e, 5919},
-	{0x7a3f, 2008},
-	{0x7a40, 2052},
-	{0x7a42, 3638},
-	{0x7a43, 5921},
-	{0x7a46, 3714},
-	{0x7a49, 5923},
-	{0x7a4d, 2677},
-	{0x7a4e, 1265},
-	{0x7a4f, 1338},
-	{0x7a50, 1136},
-	{0x7a57, 5922},
-	{0x7a61, 5924},
-	{0x7a62, 5925},
-	{0x7a63, 2527},
-	{0x7a69, 5926},
-	{0x7a6b, 1453},
-	{0x7a70, 5928},
-	{0x7a74, 1856},
-	{0x7a76, 1664},
-	{0x7a79, 5929},
-	{0x7a7a, 1773},
-	{0x7a7d, 5930},
-	{0x7a7f, 2720},
-	{0x7a81, 3237},
-	{0x7a83, 2692},
-	{0x7a84, 2149},
-	{0x7a88, 5931},
-	{0x7a92, 2976},
-	{0x7a93, 2797},
-	{0x7a95, 5933},
-	{0x7a96, 5935},
-	{0x7a97, 5932},
-	{0x7a98, 5934},
-	{0x7a9f, 1784},
-	{0x7aa9, 5936},
-	{0x7aaa, 1788},
-	{0x7aae, 1665},
-	{0x7aaf, 3900},
-	{0x7ab0, 5938},
-	{0x7ab6, 5939},
-	{0x7aba, 1232},
-	{0x7abc, 0},
-	{0x7abf, 5942},
-	{0x7ac3, 1492},
-	{0x7ac4, 5941},
-	{0x7ac5, 5940},
-	{0x7ac7, 5944},
-	{0x7ac8, 5937},
-	{0x7aca, 5945},
-	{0x7acb, 3953},
-	{0x7acd, 5946},
-	{0x7acf, 5947},
-	{0x7ad1, 8585},
-	{0x7ad2, 4549},
-	{0x7ad3, 5949},
-	{0x7ad5, 5948},
-	{0x7ad9, 5950},
-	{0x7ada, 5951},
-	{0x7adc, 3965},
-	{0x7add, 5952},
-	{0x7adf, 7176},
-	{0x7ae0, 2487},
-	{0x7ae1, 5953},
-	{0x7ae2, 5954},
-	{0x7ae3, 2401},
-	{0x7ae5, 3216},
-	{0x7ae6, 5955},
-	{0x7ae7, 8586},
-	{0x7aea, 2918},
-	{0x7aeb, 8588},
-	{0x7aed, 5956},
-	{0x7aef, 2938},
-	{0x7af0, 5957},
-	{0x7af6, 1693},
-	{0x7af8, 4214},
-	{0x7af9, 2971},
-	{0x7afa, 2271},
-	{0x7aff, 1540},
-	{0x7b02, 5958},
-	{0x7b04, 5971},
-	{0x7b06, 5961},
-	{0x7b08, 1666},
-	{0x7b0a, 5960},
-	{0x7b0b, 5973},
-	{0x7b0f, 5959},
-	{0x7b11, 2488},
-	{0x7b18, 5963},
-	{0x7b19, 5964},
-	{0x7b1b, 3109},
-	{0x7b1e, 5965},
-	{0x7b20, 1468},
-	{0x7b25, 2592},
-	{0x7b26, 3542},
-	{0x7b28, 5967},
-	{0x7b2c, 2888},
-	{0x7b33, 5962},
-	{0x7b35, 5966},
-	{0x7b36, 5968},
-	{0x7b39, 2155},
-	{0x7b45, 5975},
-	{0x7b46, 3488},
-	{0x7b48, 3386},
-	{0x7b49, 3187},
-	{0x7b4b, 1746},
-	{0x7b4c, 5974},
-	{0x7b4d, 5972},
-	{0x7b4f, 3401},
-	{0x7b50, 5969},
-	{0x7b51, 2972},
-	{0x7b52, 3189},
-	{0x7b54, 3188},
-	{0x7b56, 2150},
-	{0x7b5d, 5993},
-	{0x7b65, 5977},
-	{0x7b67, 5979},
-	{0x7b6c, 5982},
-	{0x7b6e, 5983},
-	{0x7b70, 5980},
-	{0x7b71, 5981},
-	{0x7b74, 5978},
-	{0x7b75, 5976},
-	{0x7b7a, 5970},
-	{0x7b86, 3615},
-	{0x7b87, 1365},
-	{0x7b8b, 5990},
-	{0x7b8d, 5987},
-	{0x7b8f, 5992},
-	{0x7b92, 5991},
-	{0x7b94, 3369},
-	{0x7b95, 3763},
-	{0x7b97, 2185},
-	{0x7b98, 5985},
-	{0x7b99, 5994},
-	{0x7b9a, 5989},
-	{0x7b9c, 5988},
-	{0x7b9d, 5984},
-	{0x7b9e, 8589},
-	{0x7b9f, 5986},
-	{0x7ba1, 1541},
-	{0x7baa, 2939},
-	{0x7bad, 2721},
-	{0x7bb1, 3382},
-	{0x7bb4, 5999},
-	{0x7bb8, 3384},
-	{0x7bc0, 2693},
-	{0x7bc1, 5996},
-	{0x7bc4, 3427},
-	{0x7bc6, 6000},
-	{0x7bc7, 3619},
-	{0x7bc9, 2969},
-	{0x7bcb, 5995},
-	{0x7bcc, 5997},
-	{0x7bcf, 5998},
-	{0x7bdd, 6001},
-	{0x7be0, 2288},
-	{0x7be4, 3230},
-	{0x7be5, 6006},
-	{0x7be6, 6005},
-	{0x7be9, 6002},
-	{0x7bed, 4060},
-	{0x7bf3, 6011},
-	{0x7bf6, 6015},
-	{0x7bf7, 6012},
-	{0x7c00, 6008},
-	{0x7c07, 6009},
-	{0x7c0d, 6014},
-	{0x7c11, 6003},
-	{0x7c12, 4330},
-	{0x7c13, 6010},
-	{0x7c14, 6004},
-	{0x7c17, 6013},
-	{0x7c1e, 7739},
-	{0x7c1f, 6019},
-	{0x7c21, 1542},
-	{0x7c23, 6016},
-	{0x7c27, 6017},
-	{0x7c2a, 6018},
-	{0x7c2b, 6021},
-	{0x7c37, 6020},
-	{0x7c38, 3466},
-	{0x7c3d, 6022},
-	{0x7c3e, 4036},
-	{0x7c3f, 3645},
-	{0x7c40, 6027},
-	{0x7c43, 6024},
-	{0x7c4c, 6023},
-	{0x7c4d, 2678},
-	{0x7c4f, 6026},
-	{0x7c50, 6028},
-	{0x7c54, 6025},
-	{0x7c56, 6032},
-	{0x7c58, 6029},
-	{0x7c5f, 6030},
-	{0x7c60, 6007},
-	{0x7c64, 6031},
-	{0x7c65, 6033},
-	{0x7c6c, 6034},
-	{0x7c73, 3606},
-	{0x7c75, 6035},
-	{0x7c7e, 3822},
-	{0x7c81, 1734},
-	{0x7c82, 1791},
-	{0x7c83, 6036},
-	{0x7c89, 3588},
-	{0x7c8b, 2606},
-	{0x7c8d, 3772},
-	{0x7c90, 6037},
-	{0x7c92, 3963},
-	{0x7c95, 3370},
-	{0x7c97, 2760},
-	{0x7c98, 3306},
-	{0x7c9b, 2391},
-	{0x7c9f, 1156},
-	{0x7ca1, 6042},
-	{0x7ca2, 6040},
-	{0x7ca4, 6038},
-	{0x7ca5, 1501},
-	{0x7ca7, 2489},
-	{0x7ca8, 6043},
-	{0x7cab, 6041},
-	{0x7cad, 6039},
-	{0x7cae, 6047},
-	{0x7cb1, 6046},
-	{0x7cb2, 6045},
-	{0x7cb3, 6044},
-	{0x7cb9, 6048},
-	{0x7cbd, 6049},
-	{0x7cbe, 2654},
-	{0x7cc0, 6050},
-	{0x7cc2, 6052},
-	{0x7cc5, 6051},
-	{0x7cc9, 0},
-	{0x7cca, 1926},
-	{0x7cce, 2746},
-	{0x7cd2, 6054},
-	{0x7cd6, 3190},
-	{0x7cd8, 6053},
-	{0x7cdc, 6055},
-	{0x7cde, 3589},
-	{0x7cdf, 2798},
-	{0x7ce0, 2009},
-	{0x7ce2, 6056},
-	{0x7ce7, 3984},
-	{0x7cef, 6058},
-	{0x7cf2, 6059},
-	{0x7cf4, 6060},
-	{0x7cf6, 6061},
-	{0x7cf8, 2227},
-	{0x7cfa, 6062},
-	{0x7cfb, 1829},
-	{0x7cfe, 1668},
-	{0x7d00, 1604},
-	{0x7d02, 6064},
-	{0x7d04, 3839},
-	{0x7d05, 2010},
-	{0x7d06, 6063},
-	{0x7d08, 0},
-	{0x7d09, 1},
-	{0x7d0a, 6067},
-	{0x7d0b, 3826},
-	{0x7d0d, 3314},
-	{0x7d10, 3493},
-	{0x7d14, 2413},
-	{0x7d15, 6066},
-	{0x7d17, 2303},
-	{0x7d18, 2011},
-	{0x7d19, 2228},
-	{0x7d1a, 1667},
-	{0x7d1b, 3590},
-	{0x7d1c, 6065},
-	{0x7d20, 2761},
-	{0x7d21, 3696},
-	{0x7d22, 2151},
-	{0x7d2b, 2229},
-	{0x7d2c, 3065},
-	{0x7d2e, 6070},
-	{0x7d2f, 4007},
-	{0x7d30, 2121},
-	{0x7d32, 6071},
-	{0x7d33, 2568},
-	{0x7d35, 6073},
-	{0x7d39, 2490},
-	{0x7d3a, 2080},
-	{0x7d3f, 6072},
-	{0x7d42, 2356},
-	{0x7d43, 1906},
-	{0x7d44, 2762},
-	{0x7d45, 6068},
-	{0x7d46, 6074},
-	{0x7d48, 8591},
-	{0x7d4b, 6069},
-	{0x7d4c, 1830},
-	{0x7d4e, 6077},
-	{0x7d4f, 6081},
-	{0x7d50, 1857},
-	{0x7d56, 6076},
-	{0x7d5b, 6085},
-	{0x7d5c, 8592},
-	{0x7d5e, 2012},
-	{0x7d61, 3927},
-	{0x7d62, 1152},
-	{0x7d63, 6082},
-	{0x7d66, 1669},
-	{0x7d68, 6079},
-	{0x7d6e, 6080},
-	{0x7d71, 3191},
-	{0x7d72, 6078},
-	{0x7d73, 6075},
-	{0x7d75, 1414},
-	{0x7d76, 2696},
-	{0x7d79, 1884},
-	{0x7d7d, 6087},
-	{0x7d89, 6084},
-	{0x7d8c, 0},
-	{0x7d8f, 6086},
-	{0x7d93, 6083},
-	{0x7d99, 1831},
-	{0x7d9a, 2835},
-	{0x7d9b, 6088},
-	{0x7d9c, 2800},
-	{0x7d9f, 6101},
-	{0x7da0, 8594},
-	{0x7da2, 6097},
-	{0x7da3, 6091},
-	{0x7dab, 6095},
-	{0x7dac, 2342},
-	{0x7dad, 1185},
-	{0x7dae, 6090},
-	{0x7daf, 6098},
-	{0x7db0, 6102},
-	{0x7db1, 2013},
-	{0x7db2, 3810},
-	{0x7db4, 3058},
-	{0x7db5, 6092},
-	{0x7db7, 8593},
-	{0x7db8, 6100},
-	{0x7dba, 6089},
-	{0x7dbb, 2940},
-	{0x7dbd, 6094},
-	{0x7dbe, 1153},
-	{0x7dbf, 3798},
-	{0x7dc7, 6093},
-	{0x7dca, 1747},
-	{0x7dcb, 3456},
-	{0x7dcf, 2799},
-	{0x7dd1, 3992},
-	{0x7dd2, 2425},
-	{0x7dd5, 6141},
-	{0x7dd6, 8595},
-	{0x7dd8, 6103},
-	{0x7dda, 2722},
-	{0x7ddc, 6099},
-	{0x7ddd, 6104},
-	{0x7dde, 6106},
-	{0x7de0, 3093},
-	{0x7de1, 6109},
-	{0x7de4, 6105},
-	{0x7de8, 3620},
-	{0x7de9, 1543},
-	{0x7dec, 3799},
-	{0x7def, 1186},
-	{0x7df2, 6108},
-	{0x7df4, 4037},
-	{0x7dfb, 6107},
-	{0x7e01, 1297},
-	{0x7e04, 3268},
-	{0x7e05, 6110},
-	{0x7e09, 6117},
-	{0x7e0a, 6111},
-	{0x7e0b, 6118},
-	{0x7e12, 6114},
-	{0x7e1b, 3377},
-	{0x7e1e, 2294},
-	{0x7e1f, 6116},
-	{0x7e21, 6113},
-	{0x7e22, 6119},
-	{0x7e23, 6112},
-	{0x7e26, 2382},
-	{0x7e2b, 3667},
-	{0x7e2e, 2390},
-	{0x7e31, 6115},
-	{0x7e32, 6127},
-	{0x7e35, 6123},
-	{0x7e37, 6126},
-	{0x7e39, 6124},
-	{0x7e3a, 6128},
-	{0x7e3b, 6122},
-	{0x7e3d, 6096},
-	{0x7e3e, 2679},
-	{0x7e41, 3423},
-	{0x7e43, 6125},
-	{0x7e46, 6120},
-	{0x7e4a, 2723},
-	{0x7e4b, 1832},
-	{0x7e4d, 2357},
-	{0x7e52, 8596},
-	{0x7e54, 2539},
-	{0x7e55, 2744},
-	{0x7e56, 6131},
-	{0x7e59, 6133},
-	{0x7e5a, 6134},
-	{0x7e5d, 6130},
-	{0x7e5e, 6132},
-	{0x7e61, 7697},
-	{0x7e66, 6121},
-	{0x7e67, 6129},
-	{0x7e69, 6137},
-	{0x7e6a, 6136},
-	{0x7e6b, 7671},
-	{0x7e6d, 3752},
-	{0x7e70, 1793},
-	{0x7e79, 6135},
-	{0x7e7b, 6139},
-	{0x7e7c, 6138},
-	{0x7e7d, 6142},
-	{0x7e7f, 6144},
-	{0x7e82, 2186},
-	{0x7e83, 6140},
-	{0x7e88, 6145},
-	{0x7e89, 6146},
-	{0x7e8a, 8359},
-	{0x7e8c, 6147},
-	{0x7e8e, 6153},
-	{0x7e8f, 3125},
-	{0x7e90, 6149},
-	{0x7e92, 6148},
-	{0x7e93, 6150},
-	{0x7e94, 6151},
-	{0x7e96, 6152},
-	{0x7e9b, 6154},
-	{0x7e9c, 6155},
-	{0x7f36, 1544},
-	{0x7f38, 6156},
-	{0x7f3a, 6157},
-	{0x7f45, 6158},
-	{0x7f47, 8597},
-	{0x7f4c, 6159},
-	{0x7f4d, 6160},
-	{0x7f4e, 6161},
-	{0x7f50, 6162},
-	{0x7f51, 6163},
-	{0x7f53, 0},
-	{0x7f54, 6165},
-	{0x7f55, 6164},
-	{0x7f58, 6166},
-	{0x7f5f, 6167},
-	{0x7f60, 6168},
-	{0x7f67, 6171},
-	{0x7f68, 6169},
-	{0x7f69, 6170},
-	{0x7f6a, 2129},
-	{0x7f6b, 1833},
-	{0x7f6e, 2964},
-	{0x7f70, 3399},
-	{0x7f72, 2426},
-	{0x7f75, 3331},
-	{0x7f77, 3457},
-	{0x7f78, 6172},
-	{0x7f79, 4918},
-	{0x7f82, 6173},
-	{0x7f83, 6175},
-	{0x7f85, 3919},
-	{0x7f86, 6174},
-	{0x7f87, 6177},
-	{0x7f88, 6176},
-	{0x7f8a, 3901},
-	{0x7f8c, 6178},
-	{0x7f8e, 3474},
-	{0x7f94, 6179},
-	{0x7f9a, 6182},
-	{0x7f9d, 6181},
-	{0x7f9e, 6180},
-	{0x7fa1, 8598},
-	{0x7fa3, 6183},
-	{0x7fa4, 1800},
-	{0x7fa8, 2724},
-	{0x7fa9, 1627},
-	{0x7fae, 6187},
-	{0x7faf, 6184},
-	{0x7fb2, 6185},
-	{0x7fb6, 6188},
-	{0x7fb8, 6189},
-	{0x7fb9, 6186},
-	{0x7fbd, 1227},
-	{0x7fc1, 1319},
-	{0x7fc5, 6191},
-	{0x7fc6, 6192},
-	{0x7fca, 6193},
-	{0x7fcc, 3916},
-	{0x7fd2, 2358},
-	{0x7fd4, 6195},
-	{0x7fd5, 6194},
-	{0x7fe0, 2607},
-	{0x7fe1, 6196},
-	{0x7fe6, 6197},
-	{0x7fe9, 6198},
-	{0x7feb, 1569},
-	{0x7fef, 0},
-	{0x7ff0, 1545},
-	{0x7ff3, 6199},
-	{0x7ff9, 6200},
-	{0x7ffb, 3723},
-	{0x7ffc, 3917},
-	{0x8000, 3902},
-	{0x8001, 4061},
-	{0x8003, 2015},
-	{0x8004, 6203},
-	{0x8005, 2304},
-	{0x8006, 6202},
-	{0x800b, 6204},
-	{0x800c, 2261},
-	{0x8010, 2865},
-	{0x8012, 6205},
-	{0x8015, 2014},
-	{0x8017, 3811},
-	{0x8018, 6206},
-	{0x8019, 6207},
-	{0x801c, 6208},
-	{0x8021, 6209},
-	{0x8028, 6210},
-	{0x8033, 2262},
-	{0x8036, 3833},
-	{0x803b, 6212},
-	{0x803d, 2941},
-	{0x803f, 6211},
-	{0x8046, 6214},
-	{0x804a, 6213},
-	{0x8052, 6215},
-	{0x8056, 2655},
-	{0x8058, 6216},
-	{0x805a, 6217},
-	{0x805e, 3593},
-	{0x805f, 6218},
-	{0x8061, 2801},
-	{0x8062, 6219},
-	{0x8068, 6220},
-	{0x806f, 4038},
-	{0x8070, 6223},
-	{0x8072, 6222},
-	{0x8073, 6221},
-	{0x8074, 3020},
-	{0x8076, 6224},
-	{0x8077, 2540},
-	{0x8079, 6225},
-	{0x807d, 6226},
-	{0x807e, 4062},
-	{0x807f, 6227},
-	{0x8084, 6228},
-	{0x8085, 6230},
-	{0x8086, 6229},
-	{0x8087, 3385},
-	{0x8089, 3281},
-	{0x808b, 4068},
-	{0x808c, 3389},
-	{0x8093, 6232},
-	{0x8096, 2491},
-	{0x8098, 3484},
-	{0x809a, 6233},
-	{0x809b, 6231},
-	{0x809d, 1546},
-	{0x80a1, 1928},
-	{0x80a2, 2230},
-	{0x80a5, 3458},
-	{0x80a9, 1886},
-	{0x80aa, 3697},
-	{0x80ac, 6236},
-	{0x80ad, 6234},
-	{0x80af, 2016},
-	{0x80b1, 2017},
-	{0x80b2, 1197},
-	{0x80b4, 2136},
-	{0x80ba, 3343},
-	{0x80c3, 1187},
-	{0x80c4, 6241},
-	{0x80c6, 2942},
-	{0x80cc, 3342},
-	{0x80ce, 2875},
-	{0x80d6, 6243},
-	{0x80d8, 0},
-	{0x80d9, 6239},
-	{0x80da, 6242},
-	{0x80db, 6237},
-	{0x80dd, 6240},
-	{0x80de, 3668},
-	{0x80e1, 1929},
-	{0x80e4, 1217},
-	{0x80e5, 6238},
-	{0x80ef, 6245},
-	{0x80f1, 6246},
-	{0x80f4, 3217},
-	{0x80f8, 1715},
-	{0x80fc, 6257},
-	{0x80fd, 3315},
-	{0x8102, 2231},
-	{0x8105, 1716},
-	{0x8106, 2668},
-	{0x8107, 4076},
-	{0x8108, 3770},
-	{0x8109, 6244},
-	{0x810a, 2680},
-	{0x811a, 1645},
-	{0x811b, 6247},
-	{0x8123, 6249},
-	{0x8129, 6248},
-	{0x812f, 6250},
-	{0x8131, 2916},
-	{0x8133, 3316},
-	{0x8139, 3021},
-	{0x813e, 6254},
-	{0x8146, 6253},
-	{0x814b, 6251},
-	{0x814e, 2587},
-	{0x8150, 3543},
-	{0x8151, 6256},
-	{0x8153, 6255},
-	{0x8154, 2018},
-	{0x8155, 4089},
-	{0x815f, 6272},
-	{0x8165, 6260},
-	{0x8166, 6261},
-	{0x816b, 2332},
-	{0x816e, 6259},
-	{0x8170, 2058},
-	{0x8171, 6258},
-	{0x8174, 6262},
-	{0x8178, 3022},
-	{0x8179, 3570},
-	{0x817a, 2725},
-	{0x817f, 2876},
-	{0x8180, 6266},
-	{0x8182, 6267},
-	{0x8183, 6263},
-	{0x8188, 6264},
-	{0x818a, 6265},
-	{0x818f, 2019},
-	{0x8193, 6273},
-	{0x8195, 6269},
-	{0x819a, 3544},
-	{0x819c, 3738},
-	{0x819d, 3482},
-	{0x81a0, 6268},
-	{0x81a3, 6271},
-	{0x81a4, 6270},
-	{0x81a8, 3698},
-	{0x81a9, 6274},
-	{0x81b0, 6275},
-	{0x81b3, 2745},
-	{0x81b5, 6276},
-	{0x81b8, 6278},
-	{0x81ba, 6282},
-	{0x81bd, 6279},
-	{0x81be, 6277},
-	{0x81bf, 3317},
-	{0x81c0, 6280},
-	{0x81c2, 6281},
-	{0x81c6, 1330},
-	{0x81c8, 6288},
-	{0x81c9, 6283},
-	{0x81cd, 6284},
-	{0x81d1, 6285},
-	{0x81d3, 2817},
-	{0x81d8, 6287},
-	{0x81d9, 6286},
-	{0x81da, 6289},
-	{0x81df, 6290},
-	{0x81e0, 6291},
-	{0x81e3, 2569},
-	{0x81e5, 1385},
-	{0x81e7, 6292},
-	{0x81e8, 3999},
-	{0x81ea, 2263},
-	{0x81ed, 2359},
-	{0x81f3, 2232},
-	{0x81f4, 2965},
-	{0x81fa, 6293},
-	{0x81fb, 6294},
-	{0x81fc, 1235},
-	{0x81fe, 6295},
-	{0x8201, 6296},
-	{0x8202, 6297},
-	{0x8205, 6298},
-	{0x8207, 6299},
-	{0x8208, 1717},
-	{0x8209, 5039},
-	{0x820a, 6300},
-	{0x820c, 2697},
-	{0x820d, 6301},
-	{0x820e, 2295},
-	{0x8210, 6302},
-	{0x8212, 4105},
-	{0x8216, 6303},
-	{0x8217, 3630},
-	{0x8218, 1560},
-	{0x821b, 2726},
-	{0x821c, 2402},
-	{0x821e, 3555},
-	{0x821f, 2360},
-	{0x8229, 6304},
-	{0x822a, 2020},
-	{0x822b, 6305},
-	{0x822c, 3424},
-	{0x822e, 6319},
-	{0x8233, 6307},
-	{0x8235, 2857},
-	{0x8236, 3371},
-	{0x8237, 1907},
-	{0x8238, 6306},
-	{0x8239, 2727},
-	{0x8240, 6308},
-	{0x8247, 3094},
-	{0x8258, 6310},
-	{0x8259, 6309},
-	{0x825a, 6312},
-	{0x825d, 6311},
-	{0x825f, 6313},
-	{0x8262, 6315},
-	{0x8264, 6314},
-	{0x8266, 1547},
-	{0x8268, 6316},
-	{0x826a, 6317},
-	{0x826b, 6318},
-	{0x826e, 2081},
-	{0x826f, 3985},
-	{0x8271, 6320},
-	{0x8272, 2541},
-	{0x8276, 1298},
-	{0x8277, 6321},
-	{0x8278, 6322},
-	{0x827e, 6323},
-	{0x828b, 1206},
-	{0x828d, 6324},
-	{0x8292, 6325},
-	{0x8299, 3545},
-	{0x829d, 2291},
-	{0x829f, 6327},
-	{0x82a5, 1415},
-	{0x82a6, 1142},
-	{0x82ab, 6326},
-	{0x82ac, 6329},
-	{0x82ad, 3332},
-	{0x82af, 2570},
-	{0x82b1, 1366},
-	{0x82b3, 3669},
-	{0x82b8, 1843},
-	{0x82b9, 1748},
-	{0x82bb, 6328},
-	{0x82bd, 1386},
-	{0x82c5, 1503},
-	{0x82d1, 1299},
-	{0x82d2, 6333},
-	{0x82d3, 4018},
-	{0x82d4, 2877},
-	{0x82d7, 3510},
-	{0x82d9, 6345},
-	{0x82db, 1367},
-	{0x82dc, 6343},
-	{0x82de, 6341},
-	{0x82df, 6332},
-	{0x82e1, 6330},
-	{0x82e3, 6331},
-	{0x82e5, 2319},
-	{0x82e6, 1764},
-	{0x82e7, 2997},
-	{0x82eb, 3241},
-	{0x82f1, 1267},
-	{0x82f3, 6335},
-	{0x82f4, 6334},
-	{0x82f9, 6340},
-	{0x82fa, 6336},
-	{0x82fb, 6339},
-	{0x8301, 8600},
-	{0x8302, 3804},
-	{0x8303, 6338},
-	{0x8304, 1368},
-	{0x8305, 1499},
-	{0x8306, 6342},
-	{0x8309, 6344},
-	{0x830e, 1834},
-	{0x8316, 6348},
-	{0x8317, 6357},
-	{0x8318, 6358},
-	{0x831c, 1135},
-	{0x8323, 6365},
-	{0x8328, 1205},
-	{0x832b, 6356},
-	{0x832f, 6355},
-	{0x8331, 6350},
-	{0x8332, 6349},
-	{0x8334, 6347},
-	{0x8335, 6346},
-	{0x8336, 2977},
-	{0x8338, 2907},
-	{0x8339, 6352},
-	{0x8340, 6351},
-	{0x8345, 6354},
-	{0x8349, 2802},
-	{0x834a, 1835},
-	{0x834f, 1251},
-	{0x8350, 6353},
-	{0x8352, 2021},
-	{0x8358, 2803},
-	{0x8362, 8601},
-	{0x8373, 6371},
-	{0x8375, 6372},
-	{0x8377, 1369},
-	{0x837b, 1326},
-	{0x837c, 6369},
-	{0x837f, 8602},
-	{0x8385, 6359},
-	{0x8387, 6367},
-	{0x8389, 6374},
-	{0x838a, 6368},
-	{0x838e, 6366},
-	{0x8393, 6337},
-	{0x8396, 6364},
-	{0x839a, 6360},
-	{0x839e, 1548},
-	{0x839f, 6362},
-	{0x83a0, 6373},
-	{0x83a2, 6363},
-	{0x83a8, 6375},
-	{0x83aa, 6361},
-	{0x83ab, 3378},
-	{0x83b1, 3923},
-	{0x83b5, 6370},
-	{0x83bd, 6392},
-	{0x83c0, 0},
-	{0x83c1, 6384},
-	{0x83c5, 2625},
-	{0x83c7, 8603},
-	{0x83ca, 1632},
-	{0x83cc, 1749},
-	{0x83ce, 6379},
-	{0x83d3, 1371},
-	{0x83d6, 2492},
-	{0x83d8, 6382},
-	{0x83dc, 2122},
-	{0x83df, 3147},
-	{0x83e0, 6387},
-	{0x83e9, 3646},
-	{0x83eb, 6378},
-	{0x83ef, 1370},
-	{0x83f0, 1930},
-	{0x83f1, 3483},
-	{0x83f2, 6388},
-	{0x83f4, 6376},
-	{0x83f6, 8604},
-	{0x83f7, 6385},
-	{0x83fb, 6395},
-	{0x83fd, 6380},
-	{0x8403, 6381},
-	{0x8404, 3218},
-	{0x8407, 6386},
-	{0x840a, 7807},
-	{0x840b, 6383},
-	{0x840c, 3670},
-	{0x840d, 6389},
-	{0x840e, 1188},
-	{0x8413, 6377},
-	{0x8420, 6391},
-	{0x8422, 6390},
-	{0x8429, 3361},
-	{0x842a, 6397},
-	{0x842c, 6408},
-	{0x8431, 1500},
-	{0x8435, 6411},
-	{0x8438, 6393},
-	{0x843c, 6398},
-	{0x843d, 3928},
-	{0x8446, 6407},
-	{0x8448, 8605},
-	{0x8449, 3903},
-	{0x844e, 3954},
-	{0x8457, 2998},
-	{0x845b, 1481},
-	{0x8461, 3556},
-	{0x8462, 6413},
-	{0x8463, 3193},
-	{0x8466, 1141},
-	{0x8469, 6406},
-	{0x846b, 6402},
-	{0x846c, 2804},
-	{0x846d, 6396},
-	{0x846e, 6404},
-	{0x846f, 6409},
-	{0x8471, 3298},
-	{0x8475, 1134},
-	{0x8477, 6401},
-	{0x8479, 6410},
-	{0x847a, 3562},
-	{0x8482, 6405},
-	{0x8484, 6400},
-	{0x848b, 2493},
-	{0x8490, 2361},
-	{0x8494, 2264},
-	{0x8499, 3812},
-	{0x849c, 3513},
-	{0x849f, 6416},
-	{0x84a1, 6425},
-	{0x84ad, 6403},
-	{0x84b2, 1493},
-	{0x84b4, 8606},
-	{0x84b8, 2528},
-	{0x84b9, 6414},
-	{0x84bb, 6419},
-	{0x84bc, 2805},
-	{0x84bf, 6415},
-	{0x84c1, 6422},
-	{0x84c4, 2973},
-	{0x84c6, 6423},
-	{0x84c9, 3904},
-	{0x84ca, 6412},
-	{0x84cb, 1430},
-	{0x84cd, 6418},
-	{0x84d0, 6421},
-	{0x84d1, 3768},
-	{0x84d6, 6424},
-	{0x84d9, 6417},
-	{0x84da, 6420},
-	{0x84dc, 8363},
-	{0x84ec, 3671},
-	{0x84ee, 4039},
-	{0x84f4, 6428},
-	{0x84fc, 6435},
-	{0x84ff, 6427},
-	{0x8500, 2287},
-	{0x8506, 6394},
-	{0x8511, 3614},
-	{0x8513, 3758},
-	{0x8514, 6434},
-	{0x8515, 6433},
-	{0x8517, 6429},
-	{0x8518, 6430},
-	{0x851a, 1240},
-	{0x851f, 6432},
-	{0x8521, 6426},
-	{0x8523, 7706},
-	{0x8526, 3057},
-	{0x852c, 6431},
-	{0x852d, 1218},
-	{0x8535, 2818},
-	{0x853d, 3603},
-	{0x853e, 7861},
-	{0x8540, 6436},
-	{0x8541, 6440},
-	{0x8543, 3437},
-	{0x8548, 6439},
-	{0x8549, 2494},
-	{0x854a, 2293},
-	{0x854b, 6442},
-	{0x854e, 1718},
-	{0x8553, 8607},
-	{0x8555, 6443},
-	{0x8557, 3563},
-	{0x8558, 6438},
-	{0x8559, 8608},
-	{0x855a, 6399},
-	{0x8563, 6437},
-	{0x8568, 4085},
-	{0x8569, 3194},
-	{0x856a, 3557},
-	{0x856b, 8609},
-	{0x856d, 6450},
-	{0x8577, 6456},
-	{0x857e, 6457},
-	{0x8580, 6444},
-	{0x8584, 3372},
-	{0x8587, 6454},
-	{0x8588, 6446},
-	{0x858a, 6448},
-	{0x8590, 6458},
-	{0x8591, 6447},
-	{0x8594, 6451},
-	{0x8597, 1300},
-	{0x8599, 3261},
-	{0x859b, 6452},
-	{0x859c, 6455},
-	{0x85a4, 6445},
-	{0x85a6, 2728},
-	{0x85a8, 6449},
-	{0x85a9, 2165},
-	{0x85aa, 2571},
-	{0x85ab, 1798},
-	{0x85ac, 3840},
-	{0x85ae, 3845},
-	{0x85af, 2428},
-	{0x85b0, 8611},
-	{0x85b9, 6462},
-	{0x85ba, 6460},
-	{0x85c1, 4084},
-	{0x85c9, 6459},
-	{0x85cd, 3935},
-	{0x85cf, 6461},
-	{0x85d0, 6463},
-	{0x85d5, 6464},
-	{0x85dc, 6467},
-	{0x85dd, 6465},
-	{0x85e4, 3195},
-	{0x85e5, 6466},
-	{0x85e9, 3425},
-	{0x85ea, 6453},
-	{0x85f7, 2429},
-	{0x85f9, 6468},
-	{0x85fa, 6473},
-	{0x85fb, 2806},
-	{0x85fe, 6472},
-	{0x8602, 6441},
-	{0x8606, 6474},
-	{0x8607, 2763},
-	{0x860a, 6469},
-	{0x860b, 6471},
-	{0x8613, 6470},
-	{0x8616, 5328},
-	{0x8617, 5313},
-	{0x861a, 6476},
-	{0x8622, 6475},
-	{0x862d, 3936},
-	{0x862f, 5809},
-	{0x8630, 6477},
-	{0x863f, 6478},
-	{0x864d, 6479},
-	{0x864e, 1931},
-	{0x8650, 1646},
-	{0x8654, 6481},
-	{0x8655, 4244},
-	{0x865a, 1679},
-	{0x865c, 3970},
-	{0x865e, 1771},
-	{0x865f, 6482},
-	{0x8667, 6483},
-	{0x866b, 2988},
-	{0x8671, 6484},
-	{0x8679, 3282},
-	{0x867b, 1150},
-	{0x868a, 1379},
-	{0x868b, 6489},
-	{0x868c, 6490},
-	{0x8693, 6485},
-	{0x8695, 2187},
-	{0x86a3, 6486},
-	{0x86a4, 3320},
-	{0x86a8, 0},
-	{0x86a9, 6487},
-	{0x86aa, 6488},
-	{0x86ab, 6498},
-	{0x86af, 6492},
-	{0x86b0, 6495},
-	{0x86b6, 6491},
-	{0x86c4, 6493},
-	{0x86c6, 6494},
-	{0x86c7, 2308},
-	{0x86c9, 6496},
-	{0x86cb, 2943},
-	{0x86cd, 1836},
-	{0x86ce, 1440},
-	{0x86d4, 6499},
-	{0x86d9, 1437},
-	{0x86db, 6504},
-	{0x86de, 6500},
-	{0x86df, 6503},
-	{0x86e4, 3406},
-	{0x86e9, 6501},
-	{0x86ec, 6502},
-	{0x86ed, 3514},
-	{0x86ee, 3438},
-	{0x86ef, 6505},
-	{0x86f8, 2909},
-	{0x86f9, 6515},
-	{0x86fb, 6511},
-	{0x86fe, 1387},
-	{0x8700, 6509},
-	{0x8702, 3672},
-	{0x8703, 6510},
-	{0x8706, 6507},
-	{0x8708, 6508},
-	{0x8709, 6513},
-	{0x870a, 6516},
-	{0x870d, 6514},
-	{0x8711, 6512},
-	{0x8712, 6506},
-	{0x8718, 2966},
-	{0x871a, 6523},
-	{0x871c, 3766},
-	{0x8725, 6521},
-	{0x8729, 6522},
-	{0x8734, 6517},
-	{0x8737, 6519},
-	{0x873b, 6520},
-	{0x873f, 6518},
-	{0x8749, 2698},
-	{0x874b, 4063},
-	{0x874c, 6527},
-	{0x874e, 6528},
-	{0x8753, 6534},
-	{0x8755, 2544},
-	{0x8757, 6530},
-	{0x8759, 6533},
-	{0x875f, 6525},
-	{0x8760, 6524},
-	{0x8763, 6535},
-	{0x8766, 1372},
-	{0x8768, 6531},
-	{0x876a, 6536},
-	{0x876e, 6532},
-	{0x8774, 6529},
-	{0x8776, 3023},
-	{0x8778, 6526},
-	{0x877f, 3358},
-	{0x8782, 6540},
-	{0x878d, 3877},
-	{0x879f, 6539},
-	{0x87a2, 6538},
-	{0x87ab, 6547},
-	{0x87ad, 0},
-	{0x87af, 6541},
-	{0x87b3, 6549},
-	{0x87ba, 3920},
-	{0x87bb, 6552},
-	{0x87bd, 6543},
-	{0x87c0, 6544},
-	{0x87c4, 6548},
-	{0x87c6, 6551},
-	{0x87c7, 6550},
-	{0x87cb, 6542},
-	{0x87d0, 6545},
-	{0x87d2, 6562},
-	{0x87e0, 6555},
-	{0x87ec, 7715},
-	{0x87ef, 6553},
-	{0x87f2, 6554},
-	{0x87f6, 6559},
-	{0x87f7, 6560},
-	{0x87f9, 1416},
-	{0x87fb, 1628},
-	{0x87fe, 6558},
-	{0x8805, 6537},
-	{0x8807, 8614},
-	{0x880d, 6557},
-	{0x880e, 6561},
-	{0x880f, 6556},
-	{0x8811, 6563},
-	{0x8815, 6565},
-	{0x8816, 6564},
-	{0x881f, 7813},
-	{0x8821, 6567},
-	{0x8822, 6566},
-	{0x8823, 6497},
-	{0x8827, 6571},
-	{0x8831, 6568},
-	{0x8836, 6569},
-	{0x8839, 6570},
-	{0x883b, 6572},
-	{0x8840, 1858},
-	{0x8842, 6574},
-	{0x8844, 6573},
-	{0x8846, 2362},
-	{0x884c, 2022},
-	{0x884d, 5412},
-	{0x8852, 6575},
-	{0x8853, 2395},
-	{0x8857, 1431},
-	{0x8859, 6576},
-	{0x885b, 1268},
-	{0x885d, 2495},
-	{0x885e, 6577},
-	{0x8861, 2023},
-	{0x8862, 6578},
-	{0x8863, 1189},
-	{0x8868, 3503},
-	{0x886b, 6579},
-	{0x8870, 2608},
-	{0x8872, 6586},
-	{0x8875, 6583},
-	{0x8877, 2989},
-	{0x887d, 6584},
-	{0x887e, 6581},
-	{0x887f, 1750},
-	{0x8881, 6580},
-	{0x8882, 6587},
-	{0x8888, 1804},
-	{0x888b, 2878},
-	{0x888d, 6593},
-	{0x8892, 6589},
-	{0x8896, 2837},
-	{0x8897, 6588},
-	{0x8899, 6591},
-	{0x889e, 6582},
-	{0x88a2, 6592},
-	{0x88a4, 6594},
-	{0x88ab, 3459},
-	{0x88ae, 6590},
-	{0x88b0, 6595},
-	{0x88b1, 6597},
-	{0x88b4, 1927},
-	{0x88b5, 6585},
-	{0x88b7, 1157},
-	{0x88be, 0},
-	{0x88bf, 6596},
-	{0x88c1, 2123},
-	{0x88c2, 4030},
-	{0x88c3, 6598},
-	{0x88c4, 6599},
-	{0x88c5, 2807},
-	{0x88cf, 3946},
-	{0x88d4, 6600},
-	{0x88d5, 3871},
-	{0x88d8, 6601},
-	{0x88d9, 6602},
-	{0x88dc, 3636},
-	{0x88dd, 6603},
-	{0x88df, 2096},
-	{0x88e1, 3947},
-	{0x88e8, 6608},
-	{0x88f1, 0},
-	{0x88f2, 6609},
-	{0x88f3, 2496},
-	{0x88f4, 6607},
-	{0x88f5, 8615},
-	{0x88f8, 3921},
-	{0x88f9, 6604},
-	{0x88fc, 6606},
-	{0x88fd, 2657},
-	{0x88fe, 2628},
-	{0x8902, 6605},
-	{0x8904, 6610},
-	{0x8907, 3571},
-	{0x890a, 6612},
-	{0x890c, 6611},
-	{0x8910, 1482},
-	{0x8912, 3673},
-	{0x8913, 6613},
-	{0x8919, 0},
-	{0x891a, 1},
-	{0x891c, 8360},
-	{0x891d, 6625},
-	{0x891e, 6615},
-	{0x8925, 6616},
-	{0x892a, 6617},
-	{0x892b, 6618},
-	{0x8936, 6622},
-	{0x8938, 6623},
-	{0x893b, 6621},
-	{0x8941, 6619},
-	{0x8943, 6614},
-	{0x8944, 6620},
-	{0x894c, 6624},
-	{0x894d, 7120},
-	{0x8956, 1320},
-	{0x895e, 6627},
-	{0x895f, 1751},
-	{0x8960, 6626},
-	{0x8964, 6629},
-	{0x8966, 6628},
-	{0x896a, 6631},
-	{0x896d, 6630},
-	{0x896f, 6632},
-	{0x8972, 2363},
-	{0x8974, 6633},
-	{0x8977, 6634},
-	{0x897e, 6635},
-	{0x897f, 2658},
-	{0x8981, 3905},
-	{0x8983, 6636},
-	{0x8986, 3572},
-	{0x8987, 3324},
-	{0x8988, 6637},
-	{0x898a, 6638},
-	{0x898b, 1887},
-	{0x898f, 1606},
-	{0x8993, 6639},
-	{0x8996, 2233},
-	{0x8997, 3319},
-	{0x8998, 6640},
-	{0x899a, 1454},
-	{0x89a1, 6641},
-	{0x89a6, 6643},
-	{0x89a7, 3937},
-	{0x89a9, 6642},
-	{0x89aa, 2572},
-	{0x89ac, 6644},
-	{0x89af, 6645},
-	{0x89b2, 6646},
-	{0x89b3, 1549},
-	{0x89ba, 6647},
-	{0x89bd, 6648},
-	{0x89bf, 6649},
-	{0x89c0, 6650},
-	{0x89d2, 1455},
-	{0x89da, 6651},
-	{0x89dc, 6652},
-	{0x89dd, 6653},
-	{0x89e3, 1394},
-	{0x89e6, 2542},
-	{0x89e7, 6654},
-	{0x89f4, 6655},
-	{0x89f8, 6656},
-	{0x8a00, 1908},
-	{0x8a02, 3095},
-	{0x8a03, 6657},
-	{0x8a08, 1837},
-	{0x8a0a, 2588},
-	{0x8a0c, 6660},
-	{0x8a0e, 3196},
-	{0x8a10, 6659},
-	{0x8a12, 8616},
-	{0x8a13, 1799},
-	{0x8a16, 6658},
-	{0x8a17, 2903},
-	{0x8a18, 1607},
-	{0x8a1b, 6661},
-	{0x8a1d, 6662},
-	{0x8a1f, 2497},
-	{0x8a23, 1859},
-	{0x8a25, 6663},
-	{0x8a2a, 3674},
-	{0x8a2d, 2691},
-	{0x8a31, 1680},
-	{0x8a33, 3841},
-	{0x8a34, 2764},
-	{0x8a36, 6664},
-	{0x8a37, 8617},
-	{0x8a3a, 2573},
-	{0x8a3b, 2990},
-	{0x8a3c, 2498},
-	{0x8a41, 6665},
-	{0x8a46, 6668},
-	{0x8a48, 6669},
-	{0x8a50, 2094},
-	{0x8a51, 2850},
-	{0x8a52, 6667},
-	{0x8a54, 2499},
-	{0x8a55, 3504},
-	{0x8a5b, 6666},
-	{0x8a5e, 2234},
-	{0x8a60, 1269},
-	{0x8a62, 6673},
-	{0x8a63, 1838},
-	{0x8a66, 2236},
-	{0x8a69, 2235},
-	{0x8a6b, 4083},
-	{0x8a6c, 6672},
-	{0x8a6d, 6671},
-	{0x8a6e, 2729},
-	{0x8a70, 1639},
-	{0x8a71, 4073},
-	{0x8a72, 1432},
-	{0x8a73, 2500},
-	{0x8a79, 8618},
-	{0x8a7c, 6670},
-	{0x8a82, 6675},
-	{0x8a84, 6676},
-	{0x8a85, 6674},
-	{0x8a87, 1932},
-	{0x8a89, 3882},
-	{0x8a8c, 2237},
-	{0x8a8d, 3293},
-	{0x8a91, 6679},
-	{0x8a93, 2660},
-	{0x8a95, 2944},
-	{0x8a98, 3872},
-	{0x8a9a, 6682},
-	{0x8a9e, 1952},
-	{0x8aa0, 2659},
-	{0x8aa1, 6678},
-	{0x8aa3, 6683},
-	{0x8aa4, 1953},
-	{0x8aa5, 6680},
-	{0x8aa6, 6681},
-	{0x8aa7, 8619},
-	{0x8aa8, 6677},
-	{0x8aac, 2694},
-	{0x8aad, 3233},
-	{0x8ab0, 2925},
-	{0x8ab2, 1373},
-	{0x8ab9, 3460},
-	{0x8abc, 1629},
-	{0x8abe, 8620},
-	{0x8abf, 3024},
-	{0x8ac2, 6686},
-	{0x8ac4, 6684},
-	{0x8ac7, 2954},
-	{0x8acb, 2661},
-	{0x8acc, 1550},
-	{0x8acd, 6685},
-	{0x8acf, 2593},
-	{0x8ad2, 3986},
-	{0x8ad6, 4070},
-	{0x8ada, 6687},
-	{0x8adb, 6698},
-	{0x8adc, 3025},
-	{0x8ade, 6697},
-	{0x8adf, 8621},
-	{0x8ae0, 6694},
-	{0x8ae1, 6702},
-	{0x8ae2, 6695},
-	{0x8ae4, 6691},
-	{0x8ae6, 3096},
-	{0x8ae7, 6690},
-	{0x8aeb, 6688},
-	{0x8aed, 3851},
-	{0x8aee, 2238},
-	{0x8af1, 6692},
-	{0x8af3, 6689},
-	{0x8af6, 8623},
-	{0x8af7, 6696},
-	{0x8af8, 2430},
-	{0x8afa, 1909},
-	{0x8afe, 2906},
-	{0x8b00, 3699},
-	{0x8b01, 1276},
-	{0x8b02, 1190},
-	{0x8b04, 3197},
-	{0x8b07, 6700},
-	{0x8b0c, 6699},
-	{0x8b0e, 3262},
-	{0x8b10, 6704},
-	{0x8b14, 6693},
-	{0x8b16, 6703},
-	{0x8b17, 6705},
-	{0x8b19, 1888},
-	{0x8b1a, 6701},
-	{0x8b1b, 2024},
-	{0x8b1d, 2305},
-	{0x8b20, 6706},
-	{0x8b21, 3906},
-	{0x8b26, 6709},
-	{0x8b28, 6712},
-	{0x8b2b, 6710},
-	{0x8b2c, 3495},
-	{0x8b33, 6707},
-	{0x8b39, 1752},
-	{0x8b3e, 6711},
-	{0x8b41, 6713},
-	{0x8b44, 0},
-	{0x8b49, 6717},
-	{0x8b4c, 6714},
-	{0x8b4e, 6716},
-	{0x8b4f, 6715},
-	{0x8b53, 8624},
-	{0x8b56, 6718},
-	{0x8b58, 2269},
-	{0x8b5a, 6720},
-	{0x8b5b, 6719},
-	{0x8b5c, 3546},
-	{0x8b5f, 6722},
-	{0x8b66, 1839},
-	{0x8b6b, 6721},
-	{0x8b6c, 6723},
-	{0x8b6f, 6724},
-	{0x8b70, 1630},
-	{0x8b71, 6190},
-	{0x8b72, 2529},
-	{0x8b74, 6725},
-	{0x8b77, 1954},
-	{0x8b7d, 6726},
-	{0x8b7f, 8625},
-	{0x8b80, 6727},
-	{0x8b83, 2188},
-	{0x8b8a, 5075},
-	{0x8b8c, 6728},
-	{0x8b8e, 6729},
-	{0x8b90, 2364},
-	{0x8b92, 6730},
-	{0x8b93, 6731},
-	{0x8b96, 6732},
-	{0x8b99, 6733},
-	{0x8b9a, 6734},
-	{0x8c37, 2921},
-	{0x8c3a, 6735},
-	{0x8c3f, 6737},
-	{0x8c41, 6736},
-	{0x8c46, 3198},
-	{0x8c48, 6738},
-	{0x8c4a, 3675},
-	{0x8c4c, 6739},
-	{0x8c4e, 6740},
-	{0x8c50, 6741},
-	{0x8c55, 6742},
-	{0x8c5a, 3250},
-	{0x8c61, 2501},
-	{0x8c62, 6743},
-	{0x8c6a, 2045},
-	{0x8c6b, 4103},
-	{0x8c6c, 6744},
-	{0x8c78, 6745},
-	{0x8c79, 3505},
-	{0x8c7a, 6746},
-	{0x8c7c, 6754},
-	{0x8c82, 6747},
-	{0x8c85, 6749},
-	{0x8c89, 6748},
-	{0x8c8a, 6750},
-	{0x8c8c, 3700},
-	{0x8c8d, 6751},
-	{0x8c8e, 6752},
-	{0x8c94, 6753},
-	{0x8c98, 6755},
-	{0x8c9d, 1419},
-	{0x8c9e, 3075},
-	{0x8ca0, 3547},
-	{0x8ca1, 2130},
-	{0x8ca2, 2025},
-	{0x8ca7, 3521},
-	{0x8ca8, 1375},
-	{0x8ca9, 3426},
-	{0x8caa, 6758},
-	{0x8cab, 1551},
-	{0x8cac, 2681},
-	{0x8cad, 6757},
-	{0x8cae, 6762},
-	{0x8caf, 2999},
-	{0x8cb0, 3823},
-	{0x8cb2, 6760},
-	{0x8cb3, 6761},
-	{0x8cb4, 1608},
-	{0x8cb6, 6763},
-	{0x8cb7, 3353},
-	{0x8cb8, 2879},
-	{0x8cbb, 3461},
-	{0x8cbc, 3127},
-	{0x8cbd, 6759},
-	{0x8cbf, 3701},
-	{0x8cc0, 1388},
-	{0x8cc1, 6765},
-	{0x8cc2, 4046},
-	{0x8cc3, 3038},
-	{0x8cc4, 4075},
-	{0x8cc7, 2239},
-	{0x8cc8, 6764},
-	{0x8cca, 2833},
-	{0x8ccd, 6781},
-	{0x8cce, 2730},
-	{0x8cd1, 3280},
-	{0x8cd3, 3522},
-	{0x8cda, 6768},
-	{0x8cdb, 2189},
-	{0x8cdc, 2240},
-	{0x8cde, 2502},
-	{0x8ce0, 3355},
-	{0x8ce2, 1889},
-	{0x8ce3, 6767},
-	{0x8ce4, 6766},
-	{0x8ce6, 3548},
-	{0x8cea, 2285},
-	{0x8ced, 3148},
-	{0x8cf0, 8626},
-	{0x8cf4, 8627},
-	{0x8cfa, 6770},
-	{0x8cfb, 6771},
-	{0x8cfc, 2026},
-	{0x8cfd, 6769},
-	{0x8d04, 6772},
-	{0x8d05, 6773},
-	{0x8d07, 6775},
-	{0x8d08, 2819},
-	{0x8d0a, 6774},
-	{0x8d0b, 1570},
-	{0x8d0d, 6777},
-	{0x8d0f, 6776},
-	{0x8d10, 6778},
-	{0x8d12, 8628},
-	{0x8d13, 6780},
-	{0x8d14, 6782},
-	{0x8d16, 6783},
-	{0x8d64, 2682},
-	{0x8d66, 2299},
-	{0x8d67, 6784},
-	{0x8d6b, 1456},
-	{0x8d6d, 6785},
-	{0x8d70, 2808},
-	{0x8d71, 6786},
-	{0x8d73, 6787},
-	{0x8d74, 3549},
-	{0x8d76, 8629},
-	{0x8d77, 1609},
-	{0x8d81, 6788},
-	{0x8d85, 3026},
-	{0x8d8a, 1277},
-	{0x8d99, 6789},
-	{0x8da3, 2333},
-	{0x8da8, 2620},
-	{0x8db3, 2829},
-	{0x8dba, 6792},
-	{0x8dbe, 6791},
-	{0x8dc2, 6790},
-	{0x8dcb, 6798},
-	{0x8dcc, 6796},
-	{0x8dcf, 6793},
-	{0x8dd6, 6795},
-	{0x8dda, 6794},
-	{0x8ddb, 6797},
-	{0x8ddd, 1681},
-	{0x8ddf, 6801},
-	{0x8de1, 2683},
-	{0x8de3, 6802},
-	{0x8de8, 1933},
-	{0x8dea, 6799},
-	{0x8deb, 6800},
-	{0x8def, 4047},
-	{0x8df3, 3027},
-	{0x8df5, 2731},
-	{0x8dfc, 6803},
-	{0x8dff, 6806},
-	{0x8e08, 6804},
-	{0x8e09, 6805},
-	{0x8e0a, 3907},
-	{0x8e0f, 3199},
-	{0x8e10, 6809},
-	{0x8e1d, 6807},
-	{0x8e1e, 6808},
-	{0x8e1f, 6810},
-	{0x8e2a, 6824},
-	{0x8e30, 6813},
-	{0x8e34, 6814},
-	{0x8e35, 6812},
-	{0x8e42, 6811},
-	{0x8e44, 3097},
-	{0x8e47, 6816},
-	{0x8e48, 6820},
-	{0x8e49, 6817},
-	{0x8e4a, 6815},
-	{0x8e4c, 6818},
-	{0x8e50, 6819},
-	{0x8e55, 6826},
-	{0x8e59, 6821},
-	{0x8e5f, 2684},
-	{0x8e60, 6823},
-	{0x8e63, 6825},
-	{0x8e64, 6822},
-	{0x8e72, 6828},
-	{0x8e74, 2365},
-	{0x8e76, 6827},
-	{0x8e7c, 6829},
-	{0x8e81, 6830},
-	{0x8e84, 6833},
-	{0x8e85, 6832},
-	{0x8e87, 6831},
-	{0x8e8a, 6835},
-	{0x8e8b, 6834},
-	{0x8e8d, 3842},
-	{0x8e91, 6837},
-	{0x8e93, 6836},
-	{0x8e94, 6838},
-	{0x8e99, 6839},
-	{0x8ea1, 6841},
-	{0x8eaa, 6840},
-	{0x8eab, 2574},
-	{0x8eac, 6842},
-	{0x8eaf, 1765},
-	{0x8eb0, 6843},
-	{0x8eb1, 6845},
-	{0x8ebe, 6846},
-	{0x8ec0, 7663},
-	{0x8ec5, 6847},
-	{0x8ec6, 6844},
-	{0x8ec8, 6848},
-	{0x8eca, 2306},
-	{0x8ecb, 6849},
-	{0x8ecc, 1610},
-	{0x8ecd, 1801},
-	{0x8ecf, 8631},
-	{0x8ed2, 1890},
-	{0x8edb, 6850},
-	{0x8edf, 3272},
-	{0x8ee2, 3128},
-	{0x8ee3, 6851},
-	{0x8eeb, 6854},
-	{0x8ef8, 2272},
-	{0x8efb, 6853},
-	{0x8efc, 6852},
-	{0x8efd, 1840},
-	{0x8efe, 6855},
-	{0x8f03, 1457},
-	{0x8f05, 6857},
-	{0x8f09, 2124},
-	{0x8f0a, 6856},
-	{0x8f0c, 6865},
-	{0x8f12, 6859},
-	{0x8f13, 6861},
-	{0x8f14, 3637},
-	{0x8f15, 6858},
-	{0x8f19, 6860},
-	{0x8f1b, 6864},
-	{0x8f1c, 6862},
-	{0x8f1d, 1611},
-	{0x8f1f, 6863},
-	{0x8f26, 6866},
-	{0x8f29, 3344},
-	{0x8f2a, 4000},
-	{0x8f2f, 2366},
-	{0x8f33, 6867},
-	{0x8f38, 3852},
-	{0x8f39, 6869},
-	{0x8f3b, 6868},
-	{0x8f3e, 6872},
-	{0x8f3f, 3883},
-	{0x8f42, 6871},
-	{0x8f44, 1483},
-	{0x8f45, 6870},
-	{0x8f46, 6875},
-	{0x8f49, 6874},
-	{0x8f4c, 6873},
-	{0x8f4d, 3116},
-	{0x8f4e, 6876},
-	{0x8f57, 6877},
-	{0x8f5c, 6878},
-	{0x8f5f, 2046},
-	{0x8f61, 1787},
-	{0x8f62, 6879},
-	{0x8f63, 6880},
-	{0x8f64, 6881},
-	{0x8f9b, 2575},
-	{0x8f9c, 6882},
-	{0x8f9e, 2265},
-	{0x8f9f, 6883},
-	{0x8fa3, 6884},
-	{0x8fa7, 4278},
-	{0x8fa8, 4277},
-	{0x8fad, 6885},
-	{0x8fae, 6143},
-	{0x8faf, 6886},
-	{0x8fb0, 2914},
-	{0x8fb1, 2545},
-	{0x8fb2, 3318},
-	{0x8fb6, 0},
-	{0x8fb7, 6887},
-	{0x8fba, 3621},
-	{0x8fbb, 3056},
-	{0x8fbc, 2064},
-	{0x8fbf, 2919},
-	{0x8fc2, 1228},
-	{0x8fc4, 3750},
-	{0x8fc5, 2589},
-	{0x8fce, 1844},
-	{0x8fd1, 1753},
-	{0x8fd4, 3622},
-	{0x8fda, 6888},
-	{0x8fe2, 6890},
-	{0x8fe5, 6889},
-	{0x8fe6, 1376},
-	{0x8fe9, 3278},
-	{0x8fea, 6891},
-	{0x8feb, 3373},
-	{0x8fed, 3117},
-	{0x8fef, 6892},
-	{0x8ff0, 2396},
-	{0x8ff4, 6894},
-	{0x8ff7, 3790},
-	{0x8ff8, 6909},
-	{0x8ff9, 6896},
-	{0x8ffa, 6897},
-	{0x8ffd, 3045},
-	{0x9000, 2880},
-	{0x9001, 2809},
-	{0x9003, 3200},
-	{0x9005, 6895},
-	{0x9006, 1647},
-	{0x900b, 6904},
-	{0x900d, 6901},
-	{0x900e, 6914},
-	{0x900f, 3201},
-	{0x9010, 2974},
-	{0x9011, 6898},
-	{0x9013, 3098},
-	{0x9014, 3149},
-	{0x9015, 6899},
-	{0x9016, 6903},
-	{0x9017, 2598},
-	{0x9019, 3357},
-	{0x901a, 3048},
-	{0x901d, 2662},
-	{0x901e, 6902},
-	{0x901f, 2830},
-	{0x9020, 2820},
-	{0x9021, 6900},
-	{0x9022, 1133},
-	{0x9023, 4040},
-	{0x9027, 6905},
-	{0x902e, 2881},
-	{0x9031, 2367},
-	{0x9032, 2576},
-	{0x9035, 6907},
-	{0x9036, 6906},
-	{0x9038, 1203},
-	{0x9039, 6908},
-	{0x903c, 3489},
-	{0x903e, 6916},
-	{0x9041, 3251},
-	{0x9042, 2609},
-	{0x9045, 2967},
-	{0x9047, 1776},
-	{0x9049, 6915},
-	{0x904a, 3873},
-	{0x904b, 1249},
-	{0x904d, 3623},
-	{0x904e, 1377},
-	{0x904f, 6910},
-	{0x9050, 6911},
-	{0x9051, 6912},
-	{0x9052, 6913},
-	{0x9053, 3219},
-	{0x9054, 2913},
-	{0x9055, 1191},
-	{0x9056, 6917},
-	{0x9058, 6918},
-	{0x9059, 7476},
-	{0x905c, 2845},
-	{0x905e, 6919},
-	{0x9060, 1301},
-	{0x9061, 2766},
-	{0x9063, 1891},
-	{0x9065, 3908},
-	{0x9067, 8634},
-	{0x9068, 6920},
-	{0x9069, 3110},
-	{0x906d, 2810},
-	{0x906e, 2307},
-	{0x906f, 6921},
-	{0x9072, 6924},
-	{0x9075, 2415},
-	{0x9076, 6922},
-	{0x9077, 2733},
-	{0x9078, 2732},
-	{0x907a, 1192},
-	{0x907c, 3987},
-	{0x907d, 6926},
-	{0x907f, 3462},
-	{0x9080, 6928},
-	{0x9081, 6927},
-	{0x9082, 6925},
-	{0x9083, 5943},
-	{0x9084, 1552},
-	{0x9087, 6893},
-	{0x9089, 6930},
-	{0x908a, 6929},
-	{0x908f, 6931},
-	{0x9091, 3874},
-	{0x90a3, 3257},
-	{0x90a6, 3676},
-	{0x90a8, 6932},
-	{0x90aa, 2309},
-	{0x90af, 6933},
-	{0x90b1, 6934},
-	{0x90b5, 6935},
-	{0x90b8, 3099},
-	{0x90c1, 1198},
-	{0x90ca, 2027},
-	{0x90ce, 4064},
-	{0x90db, 6939},
-	{0x90de, 8635},
-	{0x90e1, 1802},
-	{0x90e2, 6936},
-	{0x90e4, 6937},
-	{0x90e8, 3558},
-	{0x90ed, 1458},
-	{0x90f5, 3875},
-	{0x90f7, 1719},
-	{0x90fd, 3150},
-	{0x9102, 6940},
-	{0x9112, 6941},
-	{0x9115, 8637},
-	{0x9119, 6942},
-	{0x9127, 8638},
-	{0x912d, 3100},
-	{0x9130, 6944},
-	{0x9132, 6943},
-	{0x9149, 3243},
-	{0x914a, 6945},
-	{0x914b, 2368},
-	{0x914c, 2316},
-	{0x914d, 3345},
-	{0x914e, 2991},
-	{0x9152, 2334},
-	{0x9154, 2610},
-	{0x9156, 6946},
-	{0x9158, 6947},
-	{0x9162, 2595},
-	{0x9163, 6948},
-	{0x9165, 6949},
-	{0x9169, 6950},
-	{0x916a, 3929},
-	{0x916c, 2369},
-	{0x9172, 6952},
-	{0x9173, 6951},
-	{0x9175, 2028},
-	{0x9177, 2053},
-	{0x9178, 2190},
-	{0x9182, 6955},
-	{0x9187, 2416},
-	{0x9189, 6954},
-	{0x918b, 6953},
-	{0x918d, 2889},
-	{0x9190, 1955},
-	{0x9192, 2663},
-	{0x9197, 3396},
-	{0x919c, 2371},
-	{0x91a2, 6956},
-	{0x91a4, 2503},
-	{0x91aa, 6959},
-	{0x91ab, 6957},
-	{0x91ac, 7707},
-	{0x91ae, 0},
-	{0x91af, 6958},
-	{0x91b1, 7777},
-	{0x91b4, 6961},
-	{0x91b5, 6960},
-	{0x91b8, 2530},
-	{0x91ba, 6962},
-	{0x91c0, 6963},
-	{0x91c1, 6964},
-	{0x91c6, 3428},
-	{0x91c7, 2115},
-	{0x91c8, 2317},
-	{0x91c9, 6965},
-	{0x91cb, 6966},
-	{0x91cc, 3948},
-	{0x91cd, 2383},
-	{0x91ce, 3834},
-	{0x91cf, 3988},
-	{0x91d0, 6967},
-	{0x91d1, 1754},
-	{0x91d6, 6968},
-	{0x91d7, 8640},
-	{0x91d8, 3101},
-	{0x91da, 8639},
-	{0x91db, 6971},
-	{0x91dc, 1494},
-	{0x91dd, 2577},
-	{0x91de, 8641},
-	{0x91df, 6969},
-	{0x91e1, 6970},
-	{0x91e3, 3068},
-	{0x91e4, 8644},
-	{0x91e5, 8645},
-	{0x91e6, 3715},
-	{0x91e7, 1780},
-	{0x91ed, 8642},
-	{0x91ee, 8643},
-	{0x91f5, 6973},
-	{0x91f6, 6974},
-	{0x91fc, 6972},
-	{0x91ff, 6976},
-	{0x9206, 8646},
-	{0x920a, 8648},
-	{0x920d, 3255},
-	{0x920e, 1441},
-	{0x9210, 8647},
-	{0x9211, 6980},
-	{0x9214, 6977},
-	{0x9215, 6979},
-	{0x921e, 6975},
-	{0x9229, 7050},
-	{0x922c, 6978},
-	{0x9234, 4019},
-	{0x9237, 1934},
-	{0x9239, 8655},
-	{0x923a, 8649},
-	{0x923c, 8651},
-	{0x923f, 6988},
-	{0x9240, 8650},
-	{0x9244, 3118},
-	{0x9245, 6983},
-	{0x9248, 6986},
-	{0x9249, 6984},
-	{0x924b, 6989},
-	{0x924e, 8652},
-	{0x9250, 6990},
-	{0x9251, 8654},
-	{0x9257, 6982},
-	{0x9259, 8653},
-	{0x925a, 6995},
-	{0x925b, 1302},
-	{0x925e, 6981},
-	{0x9262, 3393},
-	{0x9264, 6985},
-	{0x9266, 2504},
-	{0x9267, 8656},
-	{0x9271, 2029},
-	{0x9277, 8658},
-	{0x9278, 8659},
-	{0x927e, 3702},
-	{0x9280, 1756},
-	{0x9283, 2384},
-	{0x9285, 3220},
-	{0x9288, 8362},
-	{0x9291, 2735},
-	{0x9293, 6993},
-	{0x9295, 6987},
-	{0x9296, 6992},
-	{0x9298, 3791},
-	{0x929a, 3028},
-	{0x929b, 6994},
-	{0x929c, 6991},
-	{0x92a7, 8657},
-	{0x92ad, 2734},
-	{0x92b7, 6998},
-	{0x92b9, 6997},
-	{0x92cc, 0},
-	{0x92cf, 6996},
-	{0x92d0, 8663},
-	{0x92d2, 3677},
-	{0x92d3, 8667},
-	{0x92d5, 8665},
-	{0x92d7, 8661},
-	{0x92d9, 8662},
-	{0x92e0, 8666},
-	{0x92e4, 2437},
-	{0x92e7, 8660},
-	{0x92e9, 6999},
-	{0x92ea, 3631},
-	{0x92ed, 1270},
-	{0x92f2, 3512},
-	{0x92f3, 2992},
-	{0x92f8, 1682},
-	{0x92f9, 8368},
-	{0x92fa, 7001},
-	{0x92fb, 8670},
-	{0x92fc, 2031},
-	{0x92ff, 8673},
-	{0x9302, 8675},
-	{0x9306, 2170},
-	{0x930f, 7000},
-	{0x9310, 2611},
-	{0x9318, 2612},
-	{0x9319, 7004},
-	{0x931a, 7006},
-	{0x931d, 8674},
-	{0x931e, 8672},
-	{0x9320, 2531},
-	{0x9321, 8669},
-	{0x9322, 7005},
-	{0x9323, 7007},
-	{0x9325, 8668},
-	{0x9326, 1739},
-	{0x9328, 3511},
-	{0x932b, 2318},
-	{0x932c, 4041},
-	{0x932e, 7003},
-	{0x932f, 2152},
-	{0x9332, 4069},
-	{0x9335, 7009},
-	{0x933a, 7008},
-	{0x933b, 7010},
-	{0x9344, 7002},
-	{0x9348, 8361},
-	{0x934b, 3265},
-	{0x934d, 3151},
-	{0x9354, 3059},
-	{0x9356, 7015},
-	{0x9357, 8677},
-	{0x935b, 2945},
-	{0x935c, 7011},
-	{0x9360, 7012},
-	{0x936c, 1795},
-	{0x936e, 7014},
-	{0x9370, 8676},
-	{0x9375, 1892},
-	{0x937c, 7013},
-	{0x937e, 2505},
-	{0x938c, 1495},
-	{0x9394, 7019},
-	{0x9396, 2095},
-	{0x9397, 2811},
-	{0x939a, 3046},
-	{0x93a4, 8678},
-	{0x93a7, 1433},
-	{0x93ac, 7017},
-	{0x93ad, 7018},
-	{0x93ae, 3039},
-	{0x93b0, 7016},
-	{0x93b9, 7020},
-	{0x93c3, 7026},
-	{0x93c6, 8679},
-	{0x93c8, 7029},
-	{0x93d0, 7028},
-	{0x93d1, 3111},
-	{0x93d6, 7021},
-	{0x93d7, 7022},
-	{0x93d8, 7025},
-	{0x93dd, 7027},
-	{0x93de, 8680},
-	{0x93e1, 1720},
-	{0x93e4, 7030},
-	{0x93e5, 7024},
-	{0x93e8, 7023},
-	{0x93f8, 8681},
-	{0x9403, 7034},
-	{0x9407, 7035},
-	{0x9410, 7036},
-	{0x9413, 7033},
-	{0x9414, 7032},
-	{0x9418, 2506},
-	{0x9419, 3202},
-	{0x941a, 7031},
-	{0x9421, 7040},
-	{0x942b, 7038},
-	{0x9431, 8682},
-	{0x9435, 7039},
-	{0x9436, 7037},
-	{0x9438, 2904},
-	{0x943a, 7041},
-	{0x9441, 7042},
-	{0x9444, 7044},
-	{0x9445, 8683},
-	{0x9448, 8684},
-	{0x9451, 1553},
-	{0x9452, 7043},
-	{0x9453, 3846},
-	{0x945a, 7055},
-	{0x945b, 7045},
-	{0x945e, 7048},
-	{0x9460, 7046},
-	{0x9462, 7047},
-	{0x946a, 7049},
-	{0x9470, 7051},
-	{0x9475, 7052},
-	{0x9477, 7053},
-	{0x947c, 7056},
-	{0x947d, 7054},
-	{0x947e, 7057},
-	{0x947f, 7059},
-	{0x9481, 7058},
-	{0x9577, 3029},
-	{0x9580, 3827},
-	{0x9582, 7060},
-	{0x9583, 2736},
-	{0x9587, 7061},
-	{0x9589, 3604},
-	{0x958a, 7062},
-	{0x958b, 1417},
-	{0x958f, 1246},
-	{0x9591, 1555},
-	{0x9592, 8685},
-	{0x9593, 1554},
-	{0x9594, 7063},
-	{0x9596, 7064},
-	{0x9598, 7065},
-	{0x9599, 7066},
-	{0x95a0, 7067},
-	{0x95a2, 1556},
-	{0x95a3, 1459},
-	{0x95a4, 2032},
-	{0x95a5, 3402},
-	{0x95a7, 7069},
-	{0x95a8, 7068},
-	{0x95ad, 7070},
-	{0x95b2, 1278},
-	{0x95b9, 7073},
-	{0x95bb, 7072},
-	{0x95bc, 7071},
-	{0x95be, 7074},
-	{0x95c3, 7077},
-	{0x95c7, 1163},
-	{0x95ca, 7075},
-	{0x95cc, 7079},
-	{0x95cd, 7078},
-	{0x95d4, 7081},
-	{0x95d5, 7080},
-	{0x95d6, 7082},
-	{0x95d8, 3206},
-	{0x95dc, 7083},
-	{0x95e1, 7084},
-	{0x95e2, 7086},
-	{0x95e5, 7085},
-	{0x961c, 3550},
-	{0x9621, 7087},
-	{0x9628, 7088},
-	{0x962a, 2133},
-	{0x962e, 7089},
-	{0x962f, 7090},
-	{0x9632, 3703},
-	{0x963b, 2765},
-	{0x963f, 1128},
-	{0x9640, 2859},
-	{0x9642, 7091},
-	{0x9644, 3551},
-	{0x964b, 7094},
-	{0x964c, 7092},
-	{0x964d, 2033},
-	{0x964f, 7093},
-	{0x9650, 1910},
-	{0x965b, 3605},
-	{0x965c, 7096},
-	{0x965d, 7098},
-	{0x965e, 7097},
-	{0x965f, 7099},
-	{0x9662, 1219},
-	{0x9663, 2590},
-	{0x9664, 2438},
-	{0x9665, 1557},
-	{0x9666, 7100},
-	{0x966a, 3356},
-	{0x966c, 7102},
-	{0x9670, 1220},
-	{0x9672, 7101},
-	{0x9673, 3040},
-	{0x9675, 3989},
-	{0x9676, 3203},
-	{0x9677, 7095},
-	{0x9678, 3950},
-	{0x967a, 1893},
-	{0x967d, 3909},
-	{0x9685, 1777},
-	{0x9686, 3964},
-	{0x9688, 1790},
-	{0x968a, 2882},
-	{0x968b, 6252},
-	{0x968d, 7103},
-	{0x968e, 1418},
-	{0x968f, 2613},
-	{0x9694, 1460},
-	{0x9695, 7105},
-	{0x9697, 7106},
-	{0x9698, 7104},
-	{0x9699, 1850},
-	{0x969b, 2125},
-	{0x969c, 2507},
-	{0x969d, 8688},
-	{0x96a0, 1221},
-	{0x96a3, 4001},
-	{0x96a7, 7108},
-	{0x96a8, 6923},
-	{0x96aa, 7107},
-	{0x96af, 8689},
-	{0x96b0, 7111},
-	{0x96b1, 7109},
-	{0x96b2, 7110},
-	{0x96b4, 7112},
-	{0x96b6, 7113},
-	{0x96b7, 4020},
-	{0x96b8, 7114},
-	{0x96b9, 7115},
-	{0x96bb, 2669},
-	{0x96bc, 3407},
-	{0x96c0, 2627},
-	{0x96c1, 1571},
-	{0x96c4, 3876},
-	{0x96c5, 1389},
-	{0x96c6, 2370},
-	{0x96c7, 1935},
-	{0x96c9, 7118},
-	{0x96cb, 7117},
-	{0x96cc, 2241},
-	{0x96cd, 7119},
-	{0x96ce, 7116},
-	{0x96d1, 2166},
-	{0x96d5, 7123},
-	{0x96d6, 6546},
-	{0x96d9, 4331},
-	{0x96db, 2621},
-	{0x96dc, 7121},
-	{0x96e2, 3949},
-	{0x96e3, 3273},
-	{0x96e8, 1229},
-	{0x96ea, 2695},
-	{0x96eb, 2274},
-	{0x96f0, 3591},
-	{0x96f2, 1250},
-	{0x96f6, 4021},
-	{0x96f7, 3925},
-	{0x96f9, 7124},
-	{0x96fb, 3135},
-	{0x9700, 2343},
-	{0x9704, 7125},
-	{0x9706, 7126},
-	{0x9707, 2578},
-	{0x9708, 7127},
-	{0x970a, 4022},
-	{0x970d, 7122},
-	{0x970e, 7129},
-	{0x970f, 7131},
-	{0x9711, 7130},
-	{0x9713, 7128},
-	{0x9716, 7132},
-	{0x9719, 7133},
-	{0x971c, 2812},
-	{0x971e, 1378},
-	{0x9724, 7134},
-	{0x9727, 3780},
-	{0x972a, 7135},
-	{0x9730, 7136},
-	{0x9732, 4048},
-	{0x9733, 8690},
-	{0x9738, 5140},
-	{0x9739, 7137},
-	{0x973b, 8691},
-	{0x973d, 7138},
-	{0x973e, 7139},
-	{0x9742, 7143},
-	{0x9743, 8692},
-	{0x9744, 7140},
-	{0x9746, 7141},
-	{0x9748, 7142},
-	{0x9749, 7144},
-	{0x974d, 8693},
-	{0x974f, 8694},
-	{0x9751, 8695},
-	{0x9752, 2664},
-	{0x9755, 8696},
-	{0x9756, 3843},
-	{0x9759, 2665},
-	{0x975c, 7145},
-	{0x975e, 3463},
-	{0x9760, 7146},
-	{0x9761, 7430},
-	{0x9762, 3800},
-	{0x9764, 7147},
-	{0x9766, 7148},
-	{0x9768, 7149},
-	{0x9769, 1461},
-	{0x976b, 7151},
-	{0x976d, 2591},
-	{0x9771, 7152},
-	{0x9774, 1786},
-	{0x9779, 7153},
-	{0x977a, 7157},
-	{0x977c, 7155},
-	{0x9781, 7156},
-	{0x9784, 1489},
-	{0x9785, 7154},
-	{0x9786, 7158},
-	{0x978b, 7159},
-	{0x978d, 1164},
-	{0x978f, 7160},
-	{0x9790, 7161},
-	{0x9798, 2508},
-	{0x979c, 7162},
-	{0x97a0, 1633},
-	{0x97a3, 7165},
-	{0x97a6, 7164},
-	{0x97a8, 7163},
-	{0x97ab, 6708},
-	{0x97ad, 3628},
-	{0x97b3, 7166},
-	{0x97b4, 7167},
-	{0x97b6, 0},
-	{0x97c3, 7168},
-	{0x97c6, 7169},
-	{0x97c8, 7170},
-	{0x97cb, 7171},
-	{0x97d3, 1558},
-	{0x97dc, 7172},
-	{0x97ed, 7173},
-	{0x97ee, 3289},
-	{0x97f2, 7175},
-	{0x97f3, 1339},
-	{0x97f5, 7178},
-	{0x97f6, 7177},
-	{0x97fb, 1222},
-	{0x97ff, 1721},
-	{0x9801, 3607},
-	{0x9802, 3030},
-	{0x9803, 2066},
-	{0x9805, 2034},
-	{0x9806, 2417},
-	{0x9808, 2594},
-	{0x980c, 7180},
-	{0x980f, 7179},
-	{0x9810, 3884},
-	{0x9811, 1572},
-	{0x9812, 3430},
-	{0x9813, 3252},
-	{0x9817, 2626},
-	{0x9818, 3990},
-	{0x981a, 1841},
-	{0x9821, 7183},
-	{0x9824, 7182},
-	{0x982c, 3705},
-	{0x982d, 3204},
-	{0x9830, 7795},
-	{0x9834, 1266},
-	{0x9837, 7184},
-	{0x9838, 7181},
-	{0x983b, 3523},
-	{0x983c, 3924},
-	{0x983d, 7185},
-	{0x9846, 7186},
-	{0x984b, 7188},
-	{0x984c, 2890},
-	{0x984d, 1465},
-	{0x984e, 1466},
-	{0x984f, 7187},
-	{0x9853, 0},
-	{0x9854, 1573},
-	{0x9855, 1894},
-	{0x9857, 8697},
-	{0x9858, 1574},
-	{0x985a, 7752},
-	{0x985b, 3129},
-	{0x985e, 4008},
-	{0x9865, 8698},
-	{0x9867, 1936},
-	{0x986b, 7189},
-	{0x986f, 7190},
-	{0x9870, 7191},
-	{0x9871, 7192},
-	{0x9873, 7194},
-	{0x9874, 7193},
-	{0x98a8, 3561},
-	{0x98aa, 7195},
-	{0x98af, 7196},
-	{0x98b1, 7197},
-	{0x98b6, 7198},
-	{0x98c3, 7200},
-	{0x98c4, 7199},
-	{0x98c6, 7201},
-	{0x98db, 3464},
-	{0x98dc, 6201},
-	{0x98df, 2543},
-	{0x98e2, 1612},
-	{0x98e9, 7202},
-	{0x98eb, 7203},
-	{0x98ed, 4289},
-	{0x98ee, 5338},
-	{0x98ef, 3431},
-	{0x98f2, 1215},
-	{0x98f4, 1151},
-	{0x98fc, 2242},
-	{0x98fd, 3678},
-	{0x98fe, 2534},
-	{0x9903, 7204},
-	{0x9905, 3819},
-	{0x9909, 7205},
-	{0x990a, 3910},
-	{0x990c, 1252},
-	{0x9910, 2191},
-	{0x9912, 7206},
-	{0x9913, 1390},
-	{0x9914, 7207},
-	{0x9918, 7208},
-	{0x991d, 7210},
-	{0x991e, 7211},
-	{0x9920, 7213},
-	{0x9921, 7209},
-	{0x9924, 7212},
-	{0x9927, 8701},
-	{0x9928, 1559},
-	{0x992c, 7214},
-	{0x992e, 7215},
-	{0x9933, 0},
-	{0x993d, 7216},
-	{0x993e, 7217},
-	{0x9942, 7218},
-	{0x9945, 7220},
-	{0x9949, 7219},
-	{0x994b, 7222},
-	{0x994c, 7225},
-	{0x9950, 7221},
-	{0x9951, 7223},
-	{0x9952, 7224},
-	{0x9955, 7226},
-	{0x9957, 1722},
-	{0x9996, 2335},
-	{0x9997, 7227},
-	{0x9998, 7228},
-	{0x9999, 2035},
-	{0x999e, 8703},
-	{0x99a5, 7229},
-	{0x99a8, 1436},
-	{0x99ac, 3333},
-	{0x99ad, 7230},
-	{0x99ae, 7231},
-	{0x99b3, 2968},
-	{0x99b4, 3267},
-	{0x99ba, 0},
-	{0x99bc, 7232},
-	{0x99c1, 3379},
-	{0x99c4, 2860},
-	{0x99c5, 1274},
-	{0x99c6, 1766},
-	{0x99c8, 1767},
-	{0x99d0, 2993},
-	{0x99d1, 7237},
-	{0x99d2, 1768},
-	{0x99d5, 1391},
-	{0x99d8, 7236},
-	{0x99db, 7234},
-	{0x99dd, 7235},
-	{0x99df, 7233},
-	{0x99e2, 7247},
-	{0x99ed, 7238},
-	{0x99ee, 7239},
-	{0x99f1, 7240},
-	{0x99f2, 7241},
-	{0x99f8, 7243},
-	{0x99fb, 7242},
-	{0x99ff, 2403},
-	{0x9a01, 7244},
-	{0x9a05, 7246},
-	{0x9a0e, 1613},
-	{0x9a0f, 7245},
-	{0x9a12, 2813},
-	{0x9a13, 1895},
-	{0x9a19, 7248},
-	{0x9a28, 2861},
-	{0x9a2b, 7249},
-	{0x9a2e, 0},
-	{0x9a30, 3205},
-	{0x9a37, 7250},
-	{0x9a3e, 7255},
-	{0x9a40, 7253},
-	{0x9a42, 7252},
-	{0x9a43, 7254},
-	{0x9a45, 7251},
-	{0x9a4d, 7257},
-	{0x9a4e, 8704},
-	{0x9a52, 7727},
-	{0x9a55, 7256},
-	{0x9a57, 7259},
-	{0x9a5a, 1723},
-	{0x9a5b, 7258},
-	{0x9a5f, 7260},
-	{0x9a62, 7261},
-	{0x9a64, 7263},
-	{0x9a65, 7262},
-	{0x9a69, 7264},
-	{0x9a6a, 7266},
-	{0x9a6b, 7265},
-	{0x9aa8, 2062},
-	{0x9aad, 7267},
-	{0x9ab0, 7268},
-	{0x9ab6, 0},
-	{0x9ab8, 1434},
-	{0x9abc, 7269},
-	{0x9ac0, 7270},
-	{0x9ac4, 2615},
-	{0x9acf, 7271},
-	{0x9ad1, 7272},
-	{0x9ad3, 7273},
-	{0x9ad4, 7274},
-	{0x9ad8, 2036},
-	{0x9ad9, 8705},
-	{0x9adc, 8706},
-	{0x9ade, 7275},
-	{0x9adf, 7276},
-	{0x9ae2, 7277},
-	{0x9ae3, 7278},
-	{0x9ae6, 7279},
-	{0x9aea, 3397},
-	{0x9aeb, 7281},
-	{0x9aed, 3480},
-	{0x9aee, 7282},
-	{0x9aef, 7280},
-	{0x9af1, 7284},
-	{0x9af4, 7283},
-	{0x9af7, 7285},
-	{0x9afb, 7286},
-	{0x9b06, 7287},
-	{0x9b18, 7288},
-	{0x9b1a, 7289},
-	{0x9b1f, 7290},
-	{0x9b22, 7291},
-	{0x9b23, 7292},
-	{0x9b25, 7293},
-	{0x9b27, 7294},
-	{0x9b28, 7295},
-	{0x9b29, 7296},
-	{0x9b2a, 7297},
-	{0x9b2e, 7298},
-	{0x9b2f, 7299},
-	{0x9b31, 5332},
-	{0x9b32, 7300},
-	{0x9b34, 0},
-	{0x9b3b, 6057},
-	{0x9b3c, 1614},
-	{0x9b41, 1407},
-	{0x9b42, 2082},
-	{0x9b43, 7302},
-	{0x9b44, 7301},
-	{0x9b45, 3761},
-	{0x9b4d, 7304},
-	{0x9b4e, 7305},
-	{0x9b4f, 7303},
-	{0x9b51, 7306},
-	{0x9b54, 3728},
-	{0x9b58, 7307},
-	{0x9b5a, 1685},
-	{0x9b6f, 4043},
-	{0x9b72, 8708},
-	{0x9b74, 7308},
-	{0x9b75, 8707},
-	{0x9b83, 7310},
-	{0x9b8e, 1154},
-	{0x9b8f, 8709},
-	{0x9b91, 7311},
-	{0x9b92, 3579},
-	{0x9b93, 7309},
-	{0x9b96, 7312},
-	{0x9b97, 7313},
-	{0x9b9f, 7314},
-	{0x9ba0, 7315},
-	{0x9ba8, 7316},
-	{0x9baa, 3740},
-	{0x9bab, 2171},
-	{0x9bad, 2154},
-	{0x9bae, 2737},
-	{0x9bb1, 8710},
-	{0x9bb4, 7317},
-	{0x9bb9, 7320},
-	{0x9bbb, 8711},
-	{0x9bc0, 7318},
-	{0x9bc6, 7321},
-	{0x9bc9, 1957},
-	{0x9bca, 7319},
-	{0x9bcf, 7322},
-	{0x9bd1, 7323},
-	{0x9bd2, 7324},
-	{0x9bd4, 7328},
-	{0x9bd6, 2168},
-	{0x9bdb, 2884},
-	{0x9be1, 7329},
-	{0x9be2, 7326},
-	{0x9be3, 7325},
-	{0x9be4, 7327},
-	{0x9be8, 1845},
-	{0x9bf0, 7333},
-	{0x9bf1, 7332},
-	{0x9bf2, 7331},
-	{0x9bf5, 1143},
-	{0x9c00, 8712},
-	{0x9c04, 7343},
-	{0x9c06, 7339},
-	{0x9c08, 7340},
-	{0x9c09, 7336},
-	{0x9c0a, 7342},
-	{0x9c0c, 7338},
-	{0x9c0d, 1472},
-	{0x9c10, 4082},
-	{0x9c12, 7341},
-	{0x9c13, 7337},
-	{0x9c14, 7335},
-	{0x9c15, 7334},
-	{0x9c1b, 7345},
-	{0x9c21, 7348},
-	{0x9c24, 7347},
-	{0x9c25, 7346},
-	{0x9c2d, 3515},
-	{0x9c2e, 7344},
-	{0x9c2f, 1207},
-	{0x9c30, 7349},
-	{0x9c32, 7351},
-	{0x9c39, 1485},
-	{0x9c3a, 7330},
-	{0x9c3b, 1241},
-	{0x9c3e, 7353},
-	{0x9c46, 7352},
-	{0x9c47, 7350},
-	{0x9c48, 2923},
-	{0x9c52, 3742},
-	{0x9c57, 4002},
-	{0x9c5a, 7354},
-	{0x9c60, 7355},
-	{0x9c67, 7356},
-	{0x9c76, 7357},
-	{0x9c78, 7358},
-	{0x9ce5, 3031},
-	{0x9ce7, 7359},
-	{0x9ce9, 3403},
-	{0x9ceb, 7364},
-	{0x9cec, 7360},
-	{0x9cf0, 7361},
-	{0x9cf3, 3679},
-	{0x9cf4, 3792},
-	{0x9cf6, 3240},
-	{0x9d03, 7365},
-	{0x9d06, 7366},
-	{0x9d07, 3222},
-	{0x9d08, 7363},
-	{0x9d09, 7362},
-	{0x9d0e, 1322},
-	{0x9d12, 7374},
-	{0x9d15, 7373},
-	{0x9d1b, 1303},
-	{0x9d1f, 7371},
-	{0x9d23, 7370},
-	{0x9d26, 7368},
-	{0x9d28, 1497},
-	{0x9d2a, 7367},
-	{0x9d2b, 2270},
-	{0x9d2c, 1321},
-	{0x9d3b, 2037},
-	{0x9d3e, 7377},
-	{0x9d3f, 7376},
-	{0x9d41, 7375},
-	{0x9d44, 7372},
-	{0x9d46, 7378},
-	{0x9d48, 7379},
-	{0x9d50, 7384},
-	{0x9d51, 7383},
-	{0x9d59, 7385},
-	{0x9d5c, 1231},
-	{0x9d5d, 7380},
-	{0x9d5e, 7381},
-	{0x9d60, 2054},
-	{0x9d61, 3781},
-	{0x9d64, 7382},
-	{0x9d6b, 8714},
-	{0x9d6c, 3680},
-	{0x9d6f, 7390},
-	{0x9d70, 8713},
-	{0x9d72, 7386},
-	{0x9d7a, 7391},
-	{0x9d87, 7388},
-	{0x9d89, 7387},
-	{0x9d8f, 1842},
-	{0x9d9a, 7392},
-	{0x9da4, 7393},
-	{0x9da9, 7394},
-	{0x9dab, 7389},
-	{0x9daf, 7369},
-	{0x9db2, 7395},
-	{0x9db4, 3069},
-	{0x9db8, 7399},
-	{0x9dba, 7400},
-	{0x9dbb, 7398},
-	{0x9dc1, 7397},
-	{0x9dc2, 7403},
-	{0x9dc4, 7396},
-	{0x9dc6, 7401},
-	{0x9dcf, 7402},
-	{0x9dd3, 7405},
-	{0x9dd7, 7646},
-	{0x9dd9, 7404},
-	{0x9de6, 7407},
-	{0x9ded, 7408},
-	{0x9def, 7409},
-	{0x9df2, 4079},
-	{0x9df8, 7406},
-	{0x9df9, 2891},
-	{0x9dfa, 2141},
-	{0x9dfd, 7410},
-	{0x9e19, 8716},
-	{0x9e1a, 7411},
-	{0x9e1b, 7412},
-	{0x9e1e, 7413},
-	{0x9e75, 7414},
-	{0x9e78, 1896},
-	{0x9e79, 7415},
-	{0x9e7c, 7677},
-	{0x9e7d, 7416},
-	{0x9e7f, 2267},
-	{0x9e81, 7417},
-	{0x9e88, 7418},
-	{0x9e8b, 7419},
-	{0x9e8c, 7420},
-	{0x9e91, 7423},
-	{0x9e92, 7421},
-	{0x9e93, 4066},
-	{0x9e95, 7422},
-	{0x9e97, 4023},
-	{0x9e9d, 7424},
-	{0x9e9f, 4003},
-	{0x9ea5, 7425},
-	{0x9ea6, 3380},
-	{0x9ea9, 7426},
-	{0x9eaa, 7428},
-	{0x9ead, 7429},
-	{0x9eb4, 7682},
-	{0x9eb5, 7797},
-	{0x9eb8, 7427},
-	{0x9eb9, 2047},
-	{0x9eba, 3801},
-	{0x9ebb, 3729},
-	{0x9ebc, 4740},
-	{0x9ebe, 5375},
-	{0x9ebf, 3753},
-	{0x9ec4, 1323},
-	{0x9ecc, 7431},
-	{0x9ecd, 1642},
-	{0x9ece, 7432},
-	{0x9ecf, 7433},
-	{0x9ed0, 7434},
-	{0x9ed1, 8717},
-	{0x9ed2, 2055},
-	{0x9ed4, 7435},
-	{0x9ed8, 5645},
-	{0x9ed9, 3815},
-	{0x9edb, 2883},
-	{0x9edc, 7436},
-	{0x9edd, 7438},
-	{0x9ede, 7437},
-	{0x9ee0, 7439},
-	{0x9ee5, 7440},
-	{0x9ee8, 7441},
-	{0x9eef, 7442},
-	{0x9ef4, 7443},
-	{0x9ef6, 7444},
-	{0x9ef7, 7445},
-	{0x9ef9, 7446},
-	{0x9efb, 7447},
-	{0x9efc, 7448},
-	{0x9efd, 7449},
-	{0x9f07, 7450},
-	{0x9f08, 7451},
-	{0x9f0e, 3102},
-	{0x9f13, 1937},
-	{0x9f15, 7453},
-	{0x9f20, 2767},
-	{0x9f21, 7454},
-	{0x9f2c, 7455},
-	{0x9f3b, 3475},
-	{0x9f3e, 7456},
-	{0x9f4a, 7457},
-	{0x9f4b, 5898},
-	{0x9f4e, 6779},
-	{0x9f4f, 7174},
-	{0x9f52, 7458},
-	{0x9f54, 7459},
-	{0x9f5f, 7461},
-	{0x9f60, 7462},
-	{0x9f61, 7463},
-	{0x9f62, 4024},
-	{0x9f63, 7460},
-	{0x9f66, 7464},
-	{0x9f67, 7465},
-	{0x9f6a, 7467},
-	{0x9f6c, 7466},
-	{0x9f72, 7469},
-	{0x9f76, 7470},
-	{0x9f77, 7468},
-	{0x9f8d, 3966},
-	{0x9f95, 7471},
-	{0x9f9c, 7472},
-	{0x9f9d, 5927},
-	{0x9fa0, 7473},
-	{0xf929, 8489},
-	{0xf9dc, 8686},
-	{0xfa0e, 8410},
-	{0xfa0f, 8421},
-	{0xfa10, 8422},
-	{0xfa11, 8443},
-	{0xfa12, 8481},
-	{0xfa13, 8497},
-	{0xfa14, 8499},
-	{0xfa15, 8542},
-	{0xfa16, 8548},
-	{0xfa17, 8571},
-	{0xfa18, 8579},
-	{0xfa19, 8580},
-	{0xfa1a, 8581},
-	{0xfa1b, 8583},
-	{0xfa1c, 8587},
-	{0xfa1d, 8590},
-	{0xfa1e, 8599},
-	{0xfa1f, 8610},
-	{0xfa20, 8612},
-	{0xfa21, 8613},
-	{0xfa22, 8622},
-	{0xfa23, 8630},
-	{0xfa24, 8632},
-	{0xfa25, 8633},
-	{0xfa26, 8636},
-	{0xfa27, 8664},
-	{0xfa28, 8671},
-	{0xfa29, 8687},
-	{0xfa2a, 8699},
-	{0xfa2b, 8700},
-	{0xfa2c, 8702},
-	{0xfa2d, 8715},
-	{0xfb00, 9358},
-	{0xfb01, 112},
-	{0xfb02, 113},
-	{0xfb03, 9359},
-	{0xfb04, 9360},
-	{0xfe30, 7898},
-	{0xfe31, 7892},
-	{0xfe32, 7893},
-	{0xfe33, 7890},
-	{0xfe35, 7899},
-	{0xfe36, 7900},
-	{0xfe37, 7905},
-	{0xfe38, 7906},
-	{0xfe39, 7901},
-	{0xfe3a, 7902},
-	{0xfe3b, 7915},
-	{0xfe3c, 7916},
-	{0xfe3d, 7909},
-	{0xfe3e, 7910},
-	{0xfe3f, 7907},
-	{0xfe40, 7908},
-	{0xfe41, 7911},
-	{0xfe42, 7912},
-	{0xfe43, 7913},
-	{0xfe44, 7914},
-	{0xff01, 642},
-	{0xff02, 8007},
-	{0xff03, 716},
-	{0xff04, 712},
-	{0xff05, 715},
-	{0xff06, 717},
-	{0xff07, 8006},
-	{0xff08, 674},
-	{0xff09, 675},
-	{0xff0a, 718},
-	{0xff0b, 692},
-	{0xff0c, 636},
-	{0xff0d, 693},
-	{0xff0e, 637},
-	{0xff0f, 663},
-	{0xff10, 780},
-	{0xff11, 781},
-	{0xff12, 782},
-	{0xff13, 783},
-	{0xff14, 784},
-	{0xff15, 785},
-	{0xff16, 786},
-	{0xff17, 787},
-	{0xff18, 788},
-	{0xff19, 789},
-	{0xff1a, 639},
-	{0xff1b, 640},
-	{0xff1c, 699},
-	{0xff1d, 697},
-	{0xff1e, 700},
-	{0xff1f, 641},
-	{0xff20, 719},
-	{0xff21, 790},
-	{0xff22, 791},
-	{0xff23, 792},
-	{0xff24, 793},
-	{0xff25, 794},
-	{0xff26, 795},
-	{0xff27, 796},
-	{0xff28, 797},
-	{0xff29, 798},
-	{0xff2a, 799},
-	{0xff2b, 800},
-	{0xff2c, 801},
-	{0xff2d, 802},
-	{0xff2e, 803},
-	{0xff2f, 804},
-	{0xff30, 805},
-	{0xff31, 806},
-	{0xff32, 807},
-	{0xff33, 808},
-	{0xff34, 809},
-	{0xff35, 810},
-	{0xff36, 811},
-	{0xff37, 812},
-	{0xff38, 813},
-	{0xff39, 814},
-	{0xff3a, 815},
-	{0xff3b, 678},
-	{0xff3c, 664},
-	{0xff3d, 679},
-	{0xff3e, 648},
-	{0xff3f, 650},
-	{0xff40, 646},
-	{0xff41, 816},
-	{0xff42, 817},
-	{0xff43, 818},
-	{0xff44, 819},
-	{0xff45, 820},
-	{0xff46, 821},
-	{0xff47, 822},
-	{0xff48, 823},
-	{0xff49, 824},
-	{0xff4a, 825},
-	{0xff4b, 826},
-	{0xff4c, 827},
-	{0xff4d, 828},
-	{0xff4e, 829},
-	{0xff4f, 830},
-	{0xff50, 831},
-	{0xff51, 832},
-	{0xff52, 833},
-	{0xff53, 834},
-	{0xff54, 835},
-	{0xff55, 836},
-	{0xff56, 837},
-	{0xff57, 838},
-	{0xff58, 839},
-	{0xff59, 840},
-	{0xff5a, 841},
-	{0xff5b, 680},
-	{0xff5c, 667},
-	{0xff5d, 681},
-	{0xff5e, 665},
-	{0xff61, 327},
-	{0xff62, 328},
-	{0xff63, 329},
-	{0xff64, 330},
-	{0xff65, 331},
-	{0xff66, 332},
-	{0xff67, 333},
-	{0xff68, 334},
-	{0xff69, 335},
-	{0xff6a, 336},
-	{0xff6b, 337},
-	{0xff6c, 338},
-	{0xff6d, 339},
-	{0xff6e, 340},
-	{0xff6f, 341},
-	{0xff70, 342},
-	{0xff71, 343},
-	{0xff72, 344},
-	{0xff73, 345},
-	{0xff74, 346},
-	{0xff75, 347},
-	{0xff76, 348},
-	{0xff77, 349},
-	{0xff78, 350},
-	{0xff79, 351},
-	{0xff7a, 352},
-	{0xff7b, 353},
-	{0xff7c, 354},
-	{0xff7d, 355},
-	{0xff7e, 356},
-	{0xff7f, 357},
-	{0xff80, 358},
-	{0xff81, 359},
-	{0xff82, 360},
-	{0xff83, 361},
-	{0xff84, 362},
-	{0xff85, 363},
-	{0xff86, 364},
-	{0xff87, 365},
-	{0xff88, 366},
-	{0xff89, 367},
-	{0xff8a, 368},
-	{0xff8b, 369},
-	{0xff8c, 370},
-	{0xff8d, 371},
-	{0xff8e, 372},
-	{0xff8f, 373},
-	{0xff90, 374},
-	{0xff91, 375},
-	{0xff92, 376},
-	{0xff93, 377},
-	{0xff94, 378},
-	{0xff95, 379},
-	{0xff96, 380},
-	{0xff97, 381},
-	{0xff98, 382},
-	{0xff99, 383},
-	{0xff9a, 384},
-	{0xff9b, 385},
-	{0xff9c, 386},
-	{0xff9d, 387},
-	{0xff9e, 388},
-	{0xff9f, 389},
-	{0xffe0, 713},
-	{0xffe1, 714},
-	{0xffe2, 751},
-	{0xffe3, 649},
-	{0xffe4, 8005},
-	{0xffe5, 711},
-	{0xffe8, 323}};
-
+// Coverage of the japanese character collection: bit (u % 8) of byte
+// u / 8 is set if the Unicode code point u has a CID (8475 code points).
+static const uint8 japanese[8192] = {
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x03, 0x00, 0x0c, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x06, 0x38, 0x0c, 0x00, 0x03, 0xcf, 0x00, 0x61,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x00, 0x00, 0x20, 0x00,
+	0x08, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x1d, 0x00, 0x00, 0x80, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0xff, 0xfb, 0x03, 0xfe, 0xff, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x7f, 0x77, 0x67, 0x00, 0x0d, 0x4e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x03,
+	0xff, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x06, 0x48, 0x00, 0x46, 0x08, 0x00, 0x00, 0x00, 0x00, 0x18, 0x78, 0xff, 0x0f, 0xff, 0x8f,
+	0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x14, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0x8d, 0x09, 0x06, 0xe4, 0xa1, 0x7f, 0x30, 0x30, 0x00, 0x00, 0x04, 0x00, 0xc3, 0x0c, 0x08, 0x00,
+	0xcc, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x01, 0xf0, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x01, 0x40, 0x02, 0xe4, 0x0f, 0x00,
+	0xfe, 0xff, 0x30, 0x00, 0x07, 0x00, 0x8c, 0x30, 0xc2, 0xca, 0x00, 0x00, 0x3c, 0x80, 0x00, 0x00,
+	0x6f, 0x40, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xff, 0xa6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x60, 0x1d, 0x8a, 0x05, 0x10, 0x00, 0x80, 0x13, 0x00, 0x02, 0x01, 0x10, 0xab, 0x04, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0x3f, 0xb0, 0x01, 0x00, 0x70, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x1f, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xfb, 0x5e, 0x63, 0xf2, 0xff, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x2d, 0xa0, 0x7f, 0x79, 0xcf, 0x8e, 0x6b, 0x8a, 0xf5, 0x76, 0xc3, 0x00, 0x00, 0x00, 0x00, 0xf8,
+	0xe0, 0xc3, 0xc1, 0xf1, 0x7f, 0x00, 0x0f, 0x00, 0x10, 0x39, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xab, 0x6f, 0xf3, 0x43, 0x42, 0x25, 0x47, 0x9b, 0x2e, 0xe8, 0xe0, 0xe3, 0x04, 0x00, 0x0a, 0x40,
+	0x65, 0x5f, 0x36, 0xdb, 0x77, 0x79, 0x49, 0x04, 0xd7, 0xec, 0xf0, 0xe3, 0x3a, 0x60, 0xc5, 0x18,
+	0x0b, 0xe6, 0x03, 0x34, 0x00, 0x80, 0x51, 0x37, 0xc8, 0xe0, 0xeb, 0x7e, 0x00, 0x82, 0x69, 0xd8,
+	0x48, 0xad, 0x56, 0x2d, 0x03, 0xe8, 0x60, 0x80, 0x1c, 0x66, 0x93, 0xad, 0x3b, 0xc0, 0x68, 0xc5,
+	0x62, 0xaa, 0x56, 0xc6, 0x7e, 0x3f, 0x40, 0x02, 0xcd, 0x83, 0x61, 0x14, 0x20, 0x10, 0x75, 0x21,
+	0x21, 0x20, 0x12, 0x07, 0x00, 0x30, 0xbc, 0x40, 0x24, 0xa6, 0x62, 0x45, 0xa8, 0x60, 0x30, 0x0a,
+	0x17, 0x02, 0x74, 0x85, 0x02, 0x04, 0x84, 0x9c, 0xfb, 0x7f, 0x15, 0x14, 0x34, 0x7f, 0xe2, 0x11,
+	0x65, 0xb6, 0xef, 0x22, 0x75, 0x1f, 0xff, 0x60, 0x70, 0x3a, 0x40, 0x38, 0xc3, 0x36, 0x63, 0x67,
+	0xdd, 0x4d, 0xb2, 0x20, 0xb0, 0x46, 0xc9, 0x0f, 0x98, 0xbc, 0x50, 0x68, 0x38, 0x86, 0x3f, 0xa0,
+	0x88, 0x23, 0x16, 0x98, 0x49, 0xbe, 0x32, 0x52, 0xab, 0x22, 0xa4, 0xeb, 0xdd, 0x00, 0x2c, 0xc7,
+	0xe7, 0xa9, 0xe1, 0x26, 0x1b, 0x84, 0x0a, 0x8f, 0xeb, 0x27, 0x9e, 0x55, 0x41, 0xc2, 0xbf, 0x89,
+	0x14, 0x00, 0x48, 0x85, 0x61, 0x63, 0x4d, 0x08, 0x0c, 0x7f, 0xd0, 0xaa, 0x3e, 0xff, 0xcf, 0x05,
+	0x1a, 0xff, 0x03, 0xa8, 0x41, 0x7a, 0x40, 0x7b, 0x45, 0x47, 0x02, 0x80, 0x00, 0x05, 0xeb, 0x38,
+	0x51, 0xdc, 0x05, 0x10, 0x34, 0x9b, 0x0c, 0x71, 0x97, 0x03, 0x00, 0x01, 0x66, 0x63, 0x04, 0xa4,
+	0xd0, 0x80, 0x51, 0x00, 0x00, 0xc0, 0x0a, 0x43, 0x71, 0x90, 0xc8, 0x70, 0x0a, 0x00, 0x00, 0x58,
+	0xd9, 0x0e, 0x00, 0xf7, 0x80, 0x5f, 0x41, 0x00, 0xb0, 0x00, 0x10, 0x94, 0x18, 0x00, 0x80, 0x62,
+	0x40, 0x82, 0xd0, 0x09, 0x00, 0x82, 0x56, 0x01, 0x04, 0x50, 0x09, 0x08, 0x10, 0x1d, 0x14, 0x05,
+	0xc1, 0x84, 0x10, 0x02, 0x25, 0x60, 0x50, 0x10, 0x0f, 0x45, 0x8a, 0x4d, 0x09, 0x40, 0x0d, 0xa6,
+	0x19, 0xab, 0x4c, 0x91, 0xc0, 0x21, 0x91, 0x09, 0x85, 0xc4, 0x03, 0x02, 0x72, 0x06, 0x00, 0x80,
+	0x04, 0x0b, 0x08, 0x00, 0x1d, 0x14, 0x09, 0x00, 0xc9, 0x49, 0x5c, 0x90, 0x09, 0x00, 0xd0, 0x16,
+	0x65, 0x0c, 0x20, 0x22, 0x12, 0x84, 0x33, 0x24, 0x03, 0x0c, 0x96, 0x47, 0x06, 0x0a, 0x25, 0x42,
+	0x28, 0x00, 0x88, 0xd0, 0x00, 0x49, 0x0c, 0x4f, 0xa2, 0x14, 0xaa, 0xd3, 0x30, 0xd8, 0x87, 0x3e,
+	0x04, 0x8e, 0x61, 0x1f, 0xa4, 0x7e, 0x86, 0x41, 0x90, 0xc3, 0xbb, 0x2d, 0xad, 0x57, 0x18, 0x21,
+	0x1e, 0x24, 0x48, 0x2a, 0x38, 0x11, 0x04, 0x4e, 0x40, 0x0a, 0x1b, 0x16, 0x70, 0x0d, 0x40, 0x88,
+	0x0a, 0x02, 0x02, 0x95, 0x21, 0x82, 0x60, 0x10, 0x43, 0x02, 0x00, 0x04, 0x44, 0x14, 0x00, 0x80,
+	0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x70, 0x06, 0x1a, 0xc1, 0x00, 0x4a, 0x02, 0x00, 0x0c,
+	0x00, 0x1a, 0x40, 0x00, 0x04, 0x14, 0x45, 0x40, 0x29, 0x00, 0xf3, 0xbd, 0x78, 0x0a, 0x2b, 0x85,
+	0xa9, 0xbb, 0xa0, 0xbf, 0x7c, 0x40, 0x79, 0x83, 0xfd, 0x12, 0x1d, 0xe9, 0xf6, 0x5b, 0x69, 0xc5,
+	0xf6, 0xef, 0x4a, 0x44, 0x15, 0x21, 0x02, 0xff, 0x63, 0xed, 0x2b, 0x48, 0x37, 0xd0, 0x42, 0x02,
+	0x00, 0x10, 0x13, 0x00, 0x42, 0x1b, 0xca, 0x5d, 0xa0, 0x00, 0x00, 0x02, 0x03, 0xa7, 0x61, 0x2c,
+	0x80, 0x48, 0xf2, 0x8f, 0x84, 0x02, 0x00, 0x00, 0x04, 0x58, 0x0d, 0x10, 0x00, 0xb2, 0x48, 0x00,
+	0x94, 0x18, 0x01, 0x20, 0x04, 0x50, 0x80, 0x37, 0x00, 0x32, 0x4d, 0x68, 0xea, 0x49, 0xbe, 0x68,
+	0x4c, 0x18, 0x62, 0x2e, 0x20, 0xa8, 0xc9, 0x21, 0xb9, 0x50, 0xb0, 0x80, 0x1e, 0x10, 0x7c, 0xff,
+	0x9a, 0x84, 0xe0, 0x14, 0xc1, 0x28, 0xe0, 0x81, 0x0e, 0x87, 0x49, 0xac, 0x0f, 0x13, 0xdb, 0xdd,
+	0x1a, 0xbe, 0xfb, 0xa9, 0xe2, 0xa2, 0xb2, 0x51, 0x22, 0x55, 0xca, 0x32, 0xc6, 0x3e, 0x8b, 0x92,
+	0xbf, 0x1d, 0x8f, 0x43, 0x03, 0x67, 0x98, 0x32, 0x28, 0x30, 0xc0, 0x73, 0x11, 0x08, 0x23, 0xa9,
+	0x00, 0xc0, 0x65, 0x3a, 0xe3, 0x8f, 0x02, 0x04, 0x4e, 0x2c, 0x25, 0xa6, 0x3d, 0xbf, 0xa1, 0x00,
+	0x3a, 0x3e, 0xd4, 0x8c, 0xc9, 0x06, 0x7c, 0x31, 0xe0, 0x00, 0x2a, 0xd5, 0x8b, 0x01, 0xdf, 0x0e,
+	0x4b, 0xe3, 0x3a, 0x8c, 0x83, 0x11, 0x91, 0xf0, 0x94, 0x7d, 0x28, 0xa7, 0xac, 0xc9, 0xfb, 0x40,
+	0x84, 0x44, 0x53, 0x07, 0x90, 0x5a, 0x44, 0x44, 0xc8, 0x3f, 0x01, 0x00, 0x48, 0x00, 0xd4, 0xf5,
+	0x01, 0x77, 0x5f, 0xec, 0x42, 0xc4, 0x1d, 0x89, 0x83, 0x6b, 0x28, 0x49, 0x09, 0x41, 0x42, 0xd2,
+	0x1d, 0x06, 0xfe, 0x59, 0x40, 0x18, 0x22, 0x3a, 0xe4, 0xb7, 0x9f, 0x3b, 0x03, 0xf0, 0xea, 0xc0,
+	0x86, 0x13, 0x02, 0x82, 0x80, 0x89, 0x00, 0xe4, 0x08, 0xb2, 0xa1, 0x10, 0x80, 0x4b, 0xc4, 0x0c,
+	0x09, 0xd3, 0x44, 0x89, 0xaf, 0x1f, 0x34, 0x48, 0x59, 0x82, 0x45, 0x0c, 0x0a, 0x42, 0x70, 0x04,
+	0x40, 0xa0, 0xd8, 0x10, 0x40, 0x31, 0x50, 0x44, 0x04, 0x40, 0x02, 0x01, 0x81, 0x82, 0x40, 0x05,
+	0x08, 0x01, 0x2c, 0x64, 0x30, 0x6a, 0x05, 0x9a, 0xa6, 0x60, 0x14, 0x05, 0xcf, 0x90, 0x56, 0x64,
+	0x21, 0x00, 0x00, 0x31, 0x1c, 0x9c, 0xf0, 0xcb, 0x20, 0xe1, 0xe2, 0x63, 0x4c, 0x10, 0xb5, 0x01,
+	0x8c, 0x53, 0x83, 0x9a, 0xb2, 0xb8, 0x81, 0x32, 0x7a, 0x98, 0x84, 0x0a, 0xe7, 0x33, 0x02, 0x0c,
+	0xcd, 0xd6, 0x38, 0xd0, 0xb1, 0xe1, 0x72, 0x98, 0x1e, 0x8a, 0x84, 0xf2, 0xf4, 0xc3, 0x59, 0x04,
+	0x9a, 0x43, 0xc2, 0x23, 0x45, 0x48, 0x14, 0xd3, 0x92, 0x02, 0x40, 0x36, 0x41, 0x02, 0xbd, 0xff,
+	0x09, 0xeb, 0xf0, 0xe8, 0xc0, 0x7d, 0xd2, 0xa5, 0x42, 0xc2, 0x4b, 0xd2, 0x7f, 0xa4, 0xaf, 0xd0,
+	0xa0, 0x1a, 0xa1, 0x34, 0x47, 0x82, 0xd8, 0x0b, 0x53, 0xc4, 0x1b, 0x65, 0x94, 0xd2, 0x3a, 0xc8,
+	0x3e, 0x00, 0xc8, 0x40, 0x06, 0x0e, 0x16, 0x33, 0x5f, 0x61, 0x1f, 0xb2, 0x88, 0x00, 0xd0, 0xc0,
+	0x2a, 0xe0, 0x98, 0xa8, 0xc5, 0xa1, 0x6b, 0x16, 0x50, 0xaf, 0xb4, 0x85, 0x8b, 0xc0, 0x06, 0x06,
+	0x33, 0xf9, 0x04, 0x1e, 0x6e, 0x05, 0x51, 0xa2, 0x00, 0x04, 0x38, 0x76, 0x07, 0xed, 0xb8, 0x73,
+	0x07, 0x44, 0x32, 0x19, 0x81, 0x40, 0x16, 0xc8, 0x8a, 0x7c, 0x89, 0x63, 0x84, 0x29, 0x04, 0xaa,
+	0x24, 0x1c, 0x9c, 0xca, 0x0e, 0x4e, 0x61, 0x27, 0xd0, 0x09, 0x02, 0x83, 0x46, 0x08, 0x0c, 0xc1,
+	0x11, 0x60, 0x81, 0xd0, 0x0d, 0x54, 0x08, 0x09, 0x0e, 0x00, 0x0a, 0xcc, 0x14, 0x05, 0x00, 0x0c,
+	0x30, 0x04, 0x44, 0xa0, 0x8b, 0x00, 0x84, 0x67, 0x88, 0x52, 0x19, 0x8a, 0x5e, 0x86, 0x18, 0x8b,
+	0x59, 0x2e, 0x60, 0x41, 0x10, 0x8c, 0xbe, 0x9c, 0x61, 0x68, 0x5c, 0x89, 0x00, 0x98, 0x08, 0x00,
+	0x00, 0x81, 0x9a, 0x08, 0x18, 0x00, 0x90, 0xc1, 0x07, 0x40, 0xa1, 0xf4, 0x05, 0x85, 0x0d, 0x64,
+	0x4e, 0x31, 0x4d, 0x0e, 0x06, 0x48, 0x0a, 0xff, 0x32, 0x16, 0xa8, 0x2e, 0x2e, 0x95, 0x0b, 0x00,
+	0x10, 0x18, 0x84, 0xca, 0x20, 0x0e, 0x6c, 0x69, 0x32, 0x00, 0x00, 0x16, 0x58, 0xd6, 0x90, 0x03,
+	0xa0, 0x51, 0x68, 0x1a, 0x00, 0x90, 0x24, 0x11, 0xe1, 0x98, 0x26, 0x43, 0x52, 0x5d, 0xae, 0x1f,
+	0xa0, 0x0f, 0x28, 0xae, 0xfb, 0xfa, 0x00, 0x57, 0x08, 0x64, 0x40, 0x99, 0x80, 0xc8, 0x44, 0xc0,
+	0x05, 0x90, 0x41, 0xb1, 0x24, 0x84, 0xc4, 0xa4, 0x34, 0x1a, 0x3a, 0x60, 0x00, 0x90, 0x94, 0xc1,
+	0x46, 0x82, 0x3a, 0x00, 0x0d, 0x18, 0x06, 0xc1, 0x22, 0x00, 0x12, 0x99, 0x50, 0xe0, 0x11, 0x15,
+	0x57, 0x41, 0x82, 0x00, 0x1a, 0x05, 0x2a, 0x02, 0x4f, 0x00, 0x30, 0x89, 0x13, 0xd8, 0x6a, 0x44,
+	0xe2, 0x8a, 0x22, 0xed, 0xc0, 0x11, 0x05, 0x40, 0x00, 0x10, 0x02, 0x41, 0x08, 0x88, 0x01, 0x31,
+	0x20, 0x46, 0x04, 0x02, 0x00, 0xf8, 0x08, 0x0f, 0x00, 0x89, 0x10, 0xa2, 0x00, 0x00, 0x02, 0x22,
+	0x10, 0x82, 0x10, 0x16, 0x42, 0x00, 0x41, 0x10, 0xc0, 0x52, 0x60, 0x12, 0xf4, 0x52, 0x00, 0x20,
+	0x10, 0x85, 0x30, 0x82, 0x00, 0x11, 0x02, 0x42, 0x0a, 0x43, 0xb5, 0x80, 0xe1, 0x70, 0x20, 0xda,
+	0x40, 0x20, 0x01, 0x08, 0x00, 0x35, 0x65, 0xfc, 0xc1, 0x19, 0x44, 0xab, 0x86, 0x02, 0x14, 0x62,
+	0x87, 0x00, 0x44, 0x00, 0x85, 0x90, 0x46, 0x42, 0x5c, 0x40, 0x85, 0x0a, 0x07, 0x32, 0x80, 0x33,
+	0x20, 0x04, 0xc0, 0xb8, 0x30, 0xce, 0xd0, 0xc0, 0x30, 0xc0, 0x80, 0x00, 0x08, 0x05, 0xa5, 0x0d,
+	0xd0, 0x0a, 0x40, 0x80, 0x01, 0x02, 0x0c, 0x28, 0x05, 0x67, 0x44, 0x40, 0x29, 0x64, 0x22, 0x41,
+	0xe8, 0x02, 0x00, 0x08, 0x64, 0x46, 0x7f, 0x84, 0x02, 0x00, 0x20, 0xde, 0x1d, 0x86, 0x49, 0x40,
+	0xc8, 0x0a, 0x00, 0xc0, 0x84, 0x00, 0x01, 0x20, 0x00, 0x84, 0x10, 0x10, 0xcd, 0x42, 0xc7, 0x01,
+	0x3a, 0x70, 0x2a, 0xd5, 0x68, 0x99, 0x8f, 0x1d, 0x50, 0xbe, 0x12, 0x3e, 0xf5, 0xae, 0xd9, 0x81,
+	0xc4, 0xce, 0x1a, 0x24, 0x28, 0x08, 0x2e, 0x73, 0xac, 0x24, 0x34, 0x4b, 0x0c, 0x02, 0x1d, 0xd4,
+	0x02, 0x2a, 0x40, 0x80, 0xd7, 0x00, 0x11, 0x08, 0xc4, 0x11, 0x44, 0x11, 0x86, 0x17, 0x45, 0x7d,
+	0xdd, 0x49, 0x49, 0x5e, 0x60, 0x40, 0x91, 0x87, 0x4c, 0x25, 0xc4, 0xd8, 0xba, 0x44, 0x14, 0x49,
+	0x92, 0x1b, 0x00, 0xc8, 0x71, 0x02, 0x80, 0x15, 0xc1, 0x00, 0x00, 0x0c, 0x6f, 0x09, 0x00, 0xc2,
+	0x00, 0x48, 0x02, 0x40, 0x21, 0x30, 0x49, 0xba, 0x80, 0x20, 0x80, 0x1c, 0xac, 0xe2, 0x08, 0x10,
+	0x04, 0x10, 0x34, 0x00, 0xe3, 0x40, 0x14, 0x84, 0x20, 0x40, 0x00, 0x20, 0x10, 0x98, 0x14, 0x14,
+	0xc2, 0x70, 0xaa, 0x04, 0x88, 0x86, 0x20, 0x54, 0x62, 0x0c, 0x13, 0x04, 0x82, 0x91, 0x10, 0x20,
+	0x82, 0x40, 0x06, 0x02, 0x40, 0x1c, 0x01, 0x54, 0x83, 0x03, 0xe9, 0xf4, 0x25, 0x21, 0x80, 0x84,
+	0x33, 0xe4, 0x10, 0x28, 0xc0, 0x44, 0x0b, 0xe6, 0x03, 0x0a, 0x26, 0x81, 0xda, 0x12, 0x01, 0x08,
+	0x01, 0x69, 0x90, 0x97, 0x01, 0x40, 0x86, 0xf8, 0x4d, 0xe2, 0x81, 0x00, 0x0e, 0x0a, 0x51, 0xa6,
+	0x1a, 0x01, 0xec, 0x81, 0x00, 0xc6, 0x41, 0x94, 0xb8, 0xad, 0x2e, 0xb6, 0xef, 0xac, 0x41, 0x87,
+	0x54, 0x8d, 0x02, 0x4b, 0x61, 0x11, 0x68, 0x02, 0x60, 0xbb, 0x57, 0x20, 0xa0, 0x50, 0x33, 0x04,
+	0xc0, 0xa8, 0xb4, 0xf7, 0x02, 0x24, 0x12, 0x01, 0xd3, 0x9a, 0x00, 0x20, 0x71, 0x22, 0xc8, 0x00,
+	0x81, 0x20, 0x9e, 0xc0, 0x8a, 0x0c, 0x80, 0xe1, 0x09, 0xb0, 0x51, 0x81, 0x31, 0x10, 0x28, 0x40,
+	0x0e, 0x2a, 0xa5, 0x89, 0xb6, 0x69, 0x0e, 0x62, 0x25, 0x46, 0x44, 0xd1, 0x85, 0x80, 0x54, 0x4d,
+	0x75, 0x2f, 0xb1, 0x1f, 0x07, 0xd8, 0x2d, 0x86, 0x7c, 0xd9, 0x41, 0x58, 0x4e, 0x41, 0x6e, 0x22,
+	0x00, 0x92, 0x08, 0x9e, 0x0d, 0xf8, 0xb7, 0xed, 0x80, 0x8c, 0x66, 0x75, 0x13, 0x93, 0x14, 0x08,
+	0x32, 0x0e, 0x04, 0xc8, 0x4e, 0x48, 0xa6, 0x6e, 0x4a, 0x2c, 0x74, 0x66, 0xc2, 0x2e, 0x01, 0xba,
+	0x0c, 0xd7, 0x5d, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0xa0, 0x70, 0x3b, 0x81, 0x81, 0x4f, 0xa5, 0x03,
+	0xec, 0x55, 0x10, 0x64, 0x1a, 0xc3, 0x44, 0x23, 0x62, 0x14, 0x34, 0x00, 0x43, 0x8a, 0x09, 0x1a,
+	0x7b, 0x18, 0xa5, 0x13, 0x02, 0x01, 0x48, 0xa8, 0x40, 0x04, 0x44, 0xc5, 0x06, 0x81, 0xdd, 0xe2,
+	0xf0, 0x1a, 0x48, 0x2d, 0x26, 0xb6, 0x16, 0x04, 0x58, 0x50, 0x40, 0x6f, 0x32, 0x80, 0x12, 0x31,
+	0xe4, 0x07, 0x00, 0x0c, 0x08, 0x82, 0x0a, 0x42, 0x40, 0x48, 0x3b, 0x80, 0x60, 0x48, 0x13, 0x87,
+	0x0d, 0x85, 0x28, 0x34, 0x19, 0x03, 0x29, 0xe5, 0x45, 0x23, 0x0a, 0x87, 0xa9, 0x25, 0x18, 0x5c,
+	0xa6, 0x77, 0xc5, 0xd9, 0x00, 0x5e, 0xe8, 0x03, 0x81, 0x00, 0x00, 0xa7, 0x54, 0xcd, 0xc6, 0x41,
+	0x00, 0x28, 0x04, 0xa2, 0x60, 0xb8, 0x0a, 0x2b, 0x20, 0x00, 0x9e, 0xda, 0xea, 0x08, 0x1a, 0x0e,
+	0x7e, 0x42, 0xc0, 0x11, 0x08, 0x89, 0x76, 0x03, 0x21, 0x86, 0x05, 0x01, 0x04, 0x00, 0xa8, 0x98,
+	0xa0, 0x46, 0x48, 0xc4, 0x05, 0x0d, 0x22, 0x20, 0xa3, 0x54, 0x48, 0x91, 0x01, 0x8a, 0xd7, 0x28,
+	0x98, 0x7c, 0x08, 0x00, 0x05, 0x16, 0x22, 0x31, 0x40, 0x43, 0x80, 0x08, 0x4e, 0xfa, 0xa2, 0x06,
+	0x14, 0x08, 0x11, 0x92, 0x02, 0x20, 0x14, 0x9b, 0x52, 0x2e, 0x43, 0x16, 0x00, 0x50, 0x10, 0x90,
+	0x41, 0x00, 0xba, 0x85, 0x4a, 0x30, 0x20, 0x60, 0x0b, 0x4f, 0xa8, 0x07, 0x08, 0x2f, 0x80, 0x40,
+	0x91, 0x05, 0x93, 0x1a, 0x50, 0xdf, 0x01, 0x06, 0x02, 0xa2, 0x21, 0x30, 0x30, 0x06, 0x80, 0x4e,
+	0xc4, 0x0c, 0xc8, 0x04, 0x04, 0xa0, 0x01, 0x80, 0x00, 0x60, 0x31, 0xd4, 0x80, 0x08, 0x02, 0x0a,
+	0x00, 0x1c, 0x28, 0x00, 0x18, 0x8f, 0x41, 0x00, 0xd0, 0x6a, 0x10, 0xca, 0x10, 0xf2, 0x00, 0x4b,
+	0x4d, 0x27, 0x06, 0x15, 0x20, 0x02, 0x90, 0x88, 0x00, 0x5a, 0xa8, 0x82, 0x49, 0x45, 0x50, 0x81,
+	0x04, 0x20, 0x00, 0x80, 0x04, 0xa8, 0x08, 0x2c, 0xd1, 0x08, 0x05, 0x00, 0x01, 0x90, 0xc4, 0x4a,
+	0xa0, 0xe0, 0x62, 0x80, 0x8e, 0x00, 0x42, 0x0a, 0x55, 0x30, 0x8c, 0x6a, 0x0e, 0x09, 0xa5, 0xe0,
+	0x06, 0x29, 0xc4, 0x42, 0x14, 0x48, 0xb3, 0xc0, 0x3e, 0x80, 0x30, 0xb3, 0x02, 0x01, 0x3e, 0x73,
+	0x94, 0x14, 0x0d, 0x76, 0x20, 0x0c, 0x40, 0x09, 0x1a, 0x30, 0x40, 0xc0, 0x51, 0xa4, 0x94, 0xc0,
+	0xca, 0x8d, 0xc8, 0x05, 0xc2, 0x96, 0x0c, 0xa4, 0x01, 0x00, 0x04, 0x34, 0xc8, 0x00, 0x10, 0x01,
+	0x0d, 0x55, 0xcd, 0xa9, 0x28, 0x24, 0xda, 0x1c, 0x42, 0x01, 0x37, 0x48, 0x4d, 0x7a, 0x0f, 0x12,
+	0xb4, 0x32, 0x2a, 0x45, 0xfb, 0x31, 0x05, 0xd2, 0x94, 0xb8, 0x44, 0xdc, 0xd7, 0x68, 0xca, 0x45,
+	0x97, 0x50, 0xd1, 0x2e, 0x43, 0x19, 0x08, 0x42, 0x12, 0xd2, 0x48, 0x9d, 0x40, 0x98, 0x97, 0xa0,
+	0x09, 0x54, 0x4d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x84, 0x42, 0x55, 0x21, 0x04, 0x06, 0x1c, 0x00, 0x17,
+	0x24, 0x76, 0x10, 0x61, 0x87, 0xff, 0xdd, 0xb9, 0x9f, 0x65, 0x0a, 0x5c, 0x5d, 0x24, 0x11, 0x3c,
+	0xb0, 0xad, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x28, 0xdb, 0x00,
+	0x22, 0x04, 0x00, 0x02, 0x08, 0x01, 0x08, 0x44, 0x04, 0x98, 0x40, 0xac, 0x0a, 0x8d, 0x28, 0x90,
+	0x00, 0x87, 0x01, 0xe0, 0x00, 0x04, 0x31, 0x00, 0x94, 0x17, 0x21, 0x82, 0x19, 0x00, 0x54, 0x10,
+	0xb2, 0x2c, 0x1a, 0x02, 0x02, 0x9c, 0x03, 0x40, 0x61, 0xbd, 0x04, 0x88, 0x0c, 0x08, 0x00, 0x79,
+	0x28, 0x16, 0x3c, 0xba, 0x40, 0x86, 0x08, 0xcb, 0x74, 0x72, 0x80, 0x90, 0x1e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xd8, 0x88, 0xe1, 0xc7, 0x9c, 0x34, 0x40, 0x12, 0x04, 0x64, 0xae, 0x91, 0x27,
+	0x6b, 0xe8, 0xfb, 0xe6, 0x8f, 0x40, 0x66, 0x53, 0xa6, 0xee, 0x7f, 0x53, 0xab, 0xe3, 0xe4, 0xb5,
+	0x9f, 0x86, 0x02, 0x00, 0x48, 0x85, 0x22, 0x01, 0x02, 0x44, 0x00, 0x48, 0x16, 0x21, 0xa0, 0x20,
+	0x04, 0x00, 0x24, 0x02, 0x80, 0x20, 0x05, 0x00, 0x00, 0x7e, 0x54, 0x01, 0x2c, 0x16, 0xac, 0x01,
+	0x84, 0x2a, 0x85, 0x10, 0x14, 0xdc, 0x32, 0x05, 0xc3, 0xfb, 0xc3, 0xfd, 0xfa, 0x60, 0x60, 0x90,
+	0x40, 0x64, 0x33, 0x40, 0x00, 0x12, 0x90, 0x96, 0x31, 0x4b, 0x83, 0x4e, 0xd4, 0x00, 0x82, 0x41,
+	0x29, 0x01, 0x6a, 0x1d, 0x80, 0x20, 0x80, 0x02, 0x00, 0x90, 0xad, 0x02, 0x91, 0x26, 0x0c, 0x9f,
+	0x44, 0x80, 0x01, 0x67, 0x6f, 0xd9, 0x24, 0x0c, 0x10, 0x29, 0xd0, 0x18, 0x01, 0x50, 0x21, 0x50,
+	0x00, 0x10, 0xd0, 0x04, 0x90, 0x70, 0x01, 0x02, 0x48, 0x01, 0xc3, 0x61, 0x32, 0x01, 0x00, 0x01,
+	0x88, 0x00, 0x19, 0x07, 0x02, 0x08, 0x62, 0x05, 0x32, 0x01, 0x0e, 0x4c, 0x05, 0x04, 0xa1, 0xf0,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+	0x8d, 0x8e, 0x5e, 0x03, 0xbd, 0x21, 0x04, 0x5a, 0x88, 0x34, 0x70, 0x11, 0x26, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x02, 0xc5, 0x04, 0x88, 0x15, 0xb8, 0x01, 0xf8, 0x7c, 0x14, 0xed, 0x25,
+	0x60, 0xed, 0xb0, 0x3b, 0x89, 0x85, 0xd7, 0x1b, 0xf3, 0x7a, 0x62, 0x1a, 0x0c, 0x0d, 0xc5, 0x0a,
+	0xd1, 0xe5, 0x4a, 0x52, 0x90, 0x04, 0x0d, 0x6b, 0x5c, 0xa3, 0x66, 0x52, 0x57, 0x2b, 0x12, 0x16,
+	0x72, 0xa8, 0x01, 0x11, 0x49, 0x29, 0x58, 0x00, 0x48, 0x09, 0x08, 0x10, 0x00, 0x60, 0x6c, 0x88,
+	0x6e, 0x91, 0x8f, 0x05, 0x12, 0x30, 0x91, 0x39, 0x40, 0xf8, 0xb8, 0x4d, 0xa0, 0x88, 0x1b, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x42, 0x00, 0x58, 0x00, 0x00, 0x98, 0x04, 0xea, 0x14, 0x70,
+	0x28, 0x16, 0x1d, 0x61, 0x93, 0x51, 0x08, 0x60, 0x24, 0x1a, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xc0, 0x43, 0x20, 0x71, 0x18, 0x14, 0x72, 0x01, 0x27, 0xa9, 0x04, 0x60, 0x06, 0x89,
+	0x22, 0xc0, 0x0c, 0x02, 0x00, 0x49, 0x81, 0x40, 0x2d, 0x60, 0xa4, 0x8c, 0x34, 0x0e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x41, 0x11, 0x11, 0x80, 0x1a, 0xd3, 0x4c, 0xec, 0x92, 0x08,
+	0x40, 0x00, 0x00, 0x85, 0xac, 0xc7, 0x16, 0x18, 0x3e, 0xe0, 0x12, 0x05, 0x00, 0x80, 0x34, 0x00,
+	0x08, 0xc0, 0xce, 0x80, 0x01, 0x6d, 0x12, 0x0a, 0x41, 0x86, 0x56, 0x08, 0x1e, 0x01, 0x27, 0x00,
+	0x51, 0x37, 0x3d, 0x08, 0x32, 0xe0, 0x05, 0x4e, 0xc0, 0x01, 0x84, 0x04, 0x81, 0x00, 0x40, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x1a, 0x59, 0x00,
+	0xc8, 0x43, 0x24, 0x88, 0x48, 0x1d, 0x00, 0xc8, 0x52, 0x01, 0x03, 0x72, 0x13, 0x98, 0x05, 0x04,
+	0x80, 0x82, 0x00, 0x04, 0x10, 0x8a, 0x14, 0x0d, 0x56, 0x80, 0x88, 0x02, 0x40, 0xa0, 0x04, 0x27,
+	0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb3,
+	0x02, 0x19, 0xae, 0xa0, 0x60, 0x26, 0x30, 0xdf, 0x10, 0xf0, 0x17, 0x7b, 0x21, 0x81, 0xd0, 0x3a,
+	0x80, 0x41, 0x28, 0x00, 0x03, 0x10, 0x00, 0x48, 0x00, 0xcc, 0x14, 0x80, 0xcf, 0x14, 0xc4, 0x00,
+	0x00, 0x20, 0x20, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00};
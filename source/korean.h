@@ -1,15848 +1,516 @@
 // WARNING: MACHINE GENERATED, DON'T CHANGE!
-static unicode_to_cid korean[] = {
-	{0x20, 1},
-	{0x21, 2},
-	{0x22, 3},
-	{0x23, 4},
-	{0x24, 5},
-	{0x25, 6},
-	{0x26, 7},
-	{0x27, 8},
-	{0x28, 9},
-	{0x29, 10},
-	{0x2a, 11},
-	{0x2b, 12},
-	{0x2c, 13},
-	{0x2d, 14},
-	{0x2e, 15},
-	{0x2f, 16},
-	{0x30, 17},
-	{0x31, 18},
-	{0x32, 19},
-	{0x33, 20},
-	{0x34, 21},
-	{0x35, 22},
-	{0x36, 23},
-	{0x37, 24},
-	{0x38, 25},
-	{0x39, 26},
-	{0x3a, 27},
-	{0x3b, 28},
-	{0x3c, 29},
-	{0x3d, 30},
-	{0x3e, 31},
-	{0x3f, 32},
-	{0x40, 33},
-	{0x41, 34},
-	{0x42, 35},
-	{0x43, 36},
-	{0x44, 37},
-	{0x45, 38},
-	{0x46, 39},
-	{0x47, 40},
-	{0x48, 41},
-	{0x49, 42},
-	{0x4a, 43},
-	{0x4b, 44},
-	{0x4c, 45},
-	{0x4d, 46},
-	{0x4e, 47},
-	{0x4f, 48},
-	{0x50, 49},
-	{0x51, 50},
-	{0x52, 51},
-	{0x53, 52},
-	{0x54, 53},
-	{0x55, 54},
-	{0x56, 55},
-	{0x57, 56},
-	{0x58, 57},
-	{0x59, 58},
-	{0x5a, 59},
-	{0x5b, 60},
-	{0x5c, 61},
-	{0x5d, 62},
-	{0x5e, 63},
-	{0x5f, 64},
-	{0x60, 65},
-	{0x61, 66},
-	{0x62, 67},
-	{0x63, 68},
-	{0x64, 69},
-	{0x65, 70},
-	{0x66, 71},
-	{0x67, 72},
-	{0x68, 73},
-	{0x69, 74},
-	{0x6a, 75},
-	{0x6b, 76},
-	{0x6c, 77},
-	{0x6d, 78},
-	{0x6e, 79},
-	{0x6f, 80},
-	{0x70, 81},
-	{0x71, 82},
-	{0x72, 83},
-	{0x73, 84},
-	{0x74, 85},
-	{0x75, 86},
-	{0x76, 87},
-	{0x77, 88},
-	{0x78, 89},
-	{0x79, 90},
-	{0x7a, 91},
-	{0x7b, 92},
-	{0x7c, 93},
-	{0x7d, 94},
-	{0x7e, 95},
-	{0xa1, 208},
-	{0xa4, 214},
-	{0xa7, 155},
-	{0xa8, 107},
-	{0xaa, 668},
-	{0xab, 176},
-	{0xb0, 138},
-	{0xb1, 130},
-	{0xb2, 843},
-	{0xb3, 844},
-	{0xb4, 199},
-	{0xb6, 244},
-	{0xb8, 206},
-	{0xb9, 842},
-	{0xba, 675},
-	{0xbb, 177},
-	{0xbc, 751},
-	{0xbd, 748},
-	{0xbe, 752},
-	{0xbf, 209},
-	{0xc6, 666},
-	{0xd0, 667},
-	{0xd7, 131},
-	{0xd8, 673},
-	{0xde, 676},
-	{0xdf, 768},
-	{0xe6, 757},
-	{0xf0, 759},
-	{0xf7, 132},
-	{0xf8, 766},
-	{0xfe, 769},
-	{0x111, 758},
-	{0x126, 669},
-	{0x127, 760},
-	{0x131, 761},
-	{0x132, 670},
-	{0x133, 762},
-	{0x138, 763},
-	{0x13f, 671},
-	{0x140, 764},
-	{0x141, 672},
-	{0x142, 765},
-	{0x149, 772},
-	{0x14a, 678},
-	{0x14b, 771},
-	{0x152, 674},
-	{0x153, 767},
-	{0x166, 677},
-	{0x167, 770},
-	{0x2bc, 8275},
-	{0x2c7, 201},
-	{0x2d8, 202},
-	{0x2d9, 205},
-	{0x2da, 204},
-	{0x2db, 207},
-	{0x2dc, 200},
-	{0x2dd, 203},
-	{0x391, 471},
-	{0x392, 472},
-	{0x393, 473},
-	{0x394, 474},
-	{0x395, 475},
-	{0x396, 476},
-	{0x397, 477},
-	{0x398, 478},
-	{0x399, 479},
-	{0x39a, 480},
-	{0x39b, 481},
-	{0x39c, 482},
-	{0x39d, 483},
-	{0x39e, 484},
-	{0x39f, 485},
-	{0x3a0, 486},
-	{0x3a1, 487},
-	{0x3a3, 488},
-	{0x3a4, 489},
-	{0x3a5, 490},
-	{0x3a6, 491},
-	{0x3a7, 492},
-	{0x3a8, 493},
-	{0x3a9, 494},
-	{0x3b1, 495},
-	{0x3b2, 496},
-	{0x3b3, 497},
-	{0x3b4, 498},
-	{0x3b5, 499},
-	{0x3b6, 500},
-	{0x3b7, 501},
-	{0x3b8, 502},
-	{0x3b9, 503},
-	{0x3ba, 504},
-	{0x3bb, 505},
-	{0x3bc, 506},
-	{0x3bd, 507},
-	{0x3be, 508},
-	{0x3bf, 509},
-	{0x3c0, 510},
-	{0x3c1, 511},
-	{0x3c3, 512},
-	{0x3c4, 513},
-	{0x3c5, 514},
-	{0x3c6, 515},
-	{0x3c7, 516},
-	{0x3c8, 517},
-	{0x3c9, 518},
-	{0x401, 1026},
-	{0x410, 1020},
-	{0x411, 1021},
-	{0x412, 1022},
-	{0x413, 1023},
-	{0x414, 1024},
-	{0x415, 1025},
-	{0x416, 1027},
-	{0x417, 1028},
-	{0x418, 1029},
-	{0x419, 1030},
-	{0x41a, 1031},
-	{0x41b, 1032},
-	{0x41c, 1033},
-	{0x41d, 1034},
-	{0x41e, 1035},
-	{0x41f, 1036},
-	{0x420, 1037},
-	{0x421, 1038},
-	{0x422, 1039},
-	{0x423, 1040},
-	{0x424, 1041},
-	{0x425, 1042},
-	{0x426, 1043},
-	{0x427, 1044},
-	{0x428, 1045},
-	{0x429, 1046},
-	{0x42a, 1047},
-	{0x42b, 1048},
-	{0x42c, 1049},
-	{0x42d, 1050},
-	{0x42e, 1051},
-	{0x42f, 1052},
-	{0x430, 1053},
-	{0x431, 1054},
-	{0x432, 1055},
-	{0x433, 1056},
-	{0x434, 1057},
-	{0x435, 1058},
-	{0x436, 1060},
-	{0x437, 1061},
-	{0x438, 1062},
-	{0x439, 1063},
-	{0x43a, 1064},
-	{0x43b, 1065},
-	{0x43c, 1066},
-	{0x43d, 1067},
-	{0x43e, 1068},
-	{0x43f, 1069},
-	{0x440, 1070},
-	{0x441, 1071},
-	{0x442, 1072},
-	{0x443, 1073},
-	{0x444, 1074},
-	{0x445, 1075},
-	{0x446, 1076},
-	{0x447, 1077},
-	{0x448, 1078},
-	{0x449, 1079},
-	{0x44a, 1080},
-	{0x44b, 1081},
-	{0x44c, 1082},
-	{0x44d, 1083},
-	{0x44e, 1084},
-	{0x44f, 1085},
-	{0x451, 1059},
-	{0x2013, 109},
-	{0x2014, 110},
-	{0x2016, 111},
-	{0x2018, 114},
-	{0x2019, 115},
-	{0x201b, 8238},
-	{0x201c, 116},
-	{0x201d, 117},
-	{0x201f, 8237},
-	{0x2020, 245},
-	{0x2021, 246},
-	{0x2022, 8607},
-	{0x2025, 105},
-	{0x2026, 106},
-	{0x2030, 216},
-	{0x2032, 139},
-	{0x2033, 140},
-	{0x2034, 8582},
-	{0x2035, 9326},
-	{0x2036, 9324},
-	{0x2039, 8612},
-	{0x203a, 8613},
-	{0x203b, 156},
-	{0x203c, 8763},
-	{0x2042, 8599},
-	{0x2074, 845},
-	{0x207a, 8239},
-	{0x207b, 8240},
-	{0x207c, 8248},
-	{0x207d, 8250},
-	{0x207e, 8251},
-	{0x207f, 846},
-	{0x2081, 847},
-	{0x2082, 848},
-	{0x2083, 849},
-	{0x2084, 850},
-	{0x2103, 141},
-	{0x2109, 215},
-	{0x2113, 590},
-	{0x2116, 258},
-	{0x2121, 263},
-	{0x2122, 260},
-	{0x2126, 643},
-	{0x212b, 142},
-	{0x2153, 749},
-	{0x2154, 750},
-	{0x215b, 753},
-	{0x215c, 754},
-	{0x215d, 755},
-	{0x215e, 756},
-	{0x2160, 461},
-	{0x2161, 462},
-	{0x2162, 463},
-	{0x2163, 464},
-	{0x2164, 465},
-	{0x2165, 466},
-	{0x2166, 467},
-	{0x2167, 468},
-	{0x2168, 469},
-	{0x2169, 470},
-	{0x2170, 451},
-	{0x2171, 452},
-	{0x2172, 453},
-	{0x2173, 454},
-	{0x2174, 455},
-	{0x2175, 456},
-	{0x2176, 457},
-	{0x2177, 458},
-	{0x2178, 459},
-	{0x2179, 460},
-	{0x2190, 171},
-	{0x2191, 172},
-	{0x2192, 170},
-	{0x2193, 173},
-	{0x2194, 174},
-	{0x2195, 247},
-	{0x2196, 250},
-	{0x2197, 248},
-	{0x2198, 251},
-	{0x2199, 249},
-	{0x21b0, 8868},
-	{0x21b1, 8865},
-	{0x21b2, 8864},
-	{0x21b3, 8869},
-	{0x21b4, 8867},
-	{0x21bc, 8884},
-	{0x21c0, 8885},
-	{0x21c4, 8896},
-	{0x21c5, 8897},
-	{0x21cd, 8816},
-	{0x21cf, 8815},
-	{0x21d0, 8814},
-	{0x21d1, 8854},
-	{0x21d2, 195},
-	{0x21d3, 8855},
-	{0x21d4, 196},
-	{0x21e0, 9190},
-	{0x21e1, 9192},
-	{0x21e2, 9191},
-	{0x21e3, 9193},
-	{0x21e6, 9198},
-	{0x21e7, 9200},
-	{0x21e8, 9199},
-	{0x21e9, 9201},
-	{0x2200, 197},
-	{0x2202, 151},
-	{0x2203, 198},
-	{0x2206, 8715},
-	{0x2207, 152},
-	{0x2208, 184},
-	{0x2209, 8749},
-	{0x220b, 185},
-	{0x220c, 8750},
-	{0x220f, 213},
-	{0x2211, 212},
-	{0x2213, 8726},
-	{0x221a, 178},
-	{0x221d, 180},
-	{0x221e, 136},
-	{0x221f, 8717},
-	{0x2220, 148},
-	{0x2222, 8738},
-	{0x2225, 8719},
-	{0x2226, 8720},
-	{0x2227, 192},
-	{0x2228, 193},
-	{0x2229, 191},
-	{0x222a, 190},
-	{0x222b, 182},
-	{0x222c, 183},
-	{0x222e, 211},
-	{0x2234, 137},
-	{0x2235, 181},
-	{0x2236, 210},
-	{0x2237, 8321},
-	{0x223d, 179},
-	{0x2243, 8500},
-	{0x2245, 8499},
-	{0x2248, 8501},
-	{0x2250, 8739},
-	{0x2251, 8723},
-	{0x2252, 154},
-	{0x2253, 8722},
-	{0x225a, 8753},
-	{0x2260, 133},
-	{0x2261, 153},
-	{0x2262, 8734},
-	{0x2264, 134},
-	{0x2265, 135},
-	{0x2266, 8724},
-	{0x2267, 8725},
-	{0x226e, 8745},
-	{0x226f, 8746},
-	{0x2270, 8481},
-	{0x2271, 8482},
-	{0x2272, 8483},
-	{0x2273, 8484},
-	{0x2276, 8489},
-	{0x2277, 8490},
-	{0x2279, 8491},
-	{0x227a, 8475},
-	{0x227b, 8476},
-	{0x2280, 8479},
-	{0x2281, 8480},
-	{0x2282, 188},
-	{0x2283, 189},
-	{0x2284, 8748},
-	{0x2285, 8747},
-	{0x2286, 186},
-	{0x2287, 187},
-	{0x228a, 8486},
-	{0x228b, 8488},
-	{0x2295, 8727},
-	{0x2296, 8728},
-	{0x2297, 8729},
-	{0x22a3, 8742},
-	{0x22a4, 8503},
-	{0x22a5, 149},
-	{0x22bb, 8751},
-	{0x22bc, 8752},
-	{0x22ce, 8477},
-	{0x22cf, 8478},
-	{0x22da, 8492},
-	{0x22db, 8493},
-	{0x22ee, 8320},
-	{0x22ef, 106},
-	{0x2306, 8754},
-	{0x2312, 150},
-	{0x2314, 8731},
-	{0x2460, 733},
-	{0x2461, 734},
-	{0x2462, 735},
-	{0x2463, 736},
-	{0x2464, 737},
-	{0x2465, 738},
-	{0x2466, 739},
-	{0x2467, 740},
-	{0x2468, 741},
-	{0x2469, 742},
-	{0x246a, 743},
-	{0x246b, 744},
-	{0x246c, 745},
-	{0x246d, 746},
-	{0x246e, 747},
-	{0x246f, 8791},
-	{0x2470, 8792},
-	{0x2471, 8793},
-	{0x2472, 8794},
-	{0x2473, 8795},
-	{0x2474, 827},
-	{0x2475, 828},
-	{0x2476, 829},
-	{0x2477, 830},
-	{0x2478, 831},
-	{0x2479, 832},
-	{0x247a, 833},
-	{0x247b, 834},
-	{0x247c, 835},
-	{0x247d, 836},
-	{0x247e, 837},
-	{0x247f, 838},
-	{0x2480, 839},
-	{0x2481, 840},
-	{0x2482, 841},
-	{0x2483, 9042},
-	{0x2484, 9043},
-	{0x2485, 9044},
-	{0x2486, 9045},
-	{0x2487, 9046},
-	{0x249c, 801},
-	{0x249d, 802},
-	{0x249e, 803},
-	{0x249f, 804},
-	{0x24a0, 805},
-	{0x24a1, 806},
-	{0x24a2, 807},
-	{0x24a3, 808},
-	{0x24a4, 809},
-	{0x24a5, 810},
-	{0x24a6, 811},
-	{0x24a7, 812},
-	{0x24a8, 813},
-	{0x24a9, 814},
-	{0x24aa, 815},
-	{0x24ab, 816},
-	{0x24ac, 817},
-	{0x24ad, 818},
-	{0x24ae, 819},
-	{0x24af, 820},
-	{0x24b0, 821},
-	{0x24b1, 822},
-	{0x24b2, 823},
-	{0x24b3, 824},
-	{0x24b4, 825},
-	{0x24b5, 826},
-	{0x24b6, 8388},
-	{0x24b7, 8389},
-	{0x24b8, 8390},
-	{0x24b9, 8391},
-	{0x24ba, 8392},
-	{0x24bb, 8393},
-	{0x24bc, 8394},
-	{0x24bd, 8395},
-	{0x24be, 8396},
-	{0x24bf, 8397},
-	{0x24c0, 8398},
-	{0x24c1, 8399},
-	{0x24c2, 8400},
-	{0x24c3, 8401},
-	{0x24c4, 8402},
-	{0x24c5, 8403},
-	{0x24c6, 8404},
-	{0x24c7, 8405},
-	{0x24c8, 8406},
-	{0x24c9, 8407},
-	{0x24ca, 8408},
-	{0x24cb, 8409},
-	{0x24cc, 8410},
-	{0x24cd, 8411},
-	{0x24ce, 8412},
-	{0x24cf, 8413},
-	{0x24d0, 707},
-	{0x24d1, 708},
-	{0x24d2, 709},
-	{0x24d3, 710},
-	{0x24d4, 711},
-	{0x24d5, 712},
-	{0x24d6, 713},
-	{0x24d7, 714},
-	{0x24d8, 715},
-	{0x24d9, 716},
-	{0x24da, 717},
-	{0x24db, 718},
-	{0x24dc, 719},
-	{0x24dd, 720},
-	{0x24de, 721},
-	{0x24df, 722},
-	{0x24e0, 723},
-	{0x24e1, 724},
-	{0x24e2, 725},
-	{0x24e3, 726},
-	{0x24e4, 727},
-	{0x24e5, 728},
-	{0x24e6, 729},
-	{0x24e7, 730},
-	{0x24e8, 731},
-	{0x24e9, 732},
-	{0x2500, 519},
-	{0x2501, 530},
-	{0x2502, 520},
-	{0x2503, 531},
-	{0x250c, 521},
-	{0x250d, 558},
-	{0x250e, 557},
-	{0x250f, 532},
-	{0x2510, 522},
-	{0x2511, 552},
-	{0x2512, 551},
-	{0x2513, 533},
-	{0x2514, 524},
-	{0x2515, 556},
-	{0x2516, 555},
-	{0x2517, 535},
-	{0x2518, 523},
-	{0x2519, 554},
-	{0x251a, 553},
-	{0x251b, 534},
-	{0x251c, 525},
-	{0x251d, 546},
-	{0x251e, 559},
-	{0x251f, 560},
-	{0x2520, 541},
-	{0x2521, 561},
-	{0x2522, 562},
-	{0x2523, 536},
-	{0x2524, 527},
-	{0x2525, 548},
-	{0x2526, 563},
-	{0x2527, 564},
-	{0x2528, 543},
-	{0x2529, 565},
-	{0x252a, 566},
-	{0x252b, 538},
-	{0x252c, 526},
-	{0x252d, 567},
-	{0x252e, 568},
-	{0x252f, 542},
-	{0x2530, 547},
-	{0x2531, 569},
-	{0x2532, 570},
-	{0x2533, 537},
-	{0x2534, 528},
-	{0x2535, 571},
-	{0x2536, 572},
-	{0x2537, 544},
-	{0x2538, 549},
-	{0x2539, 573},
-	{0x253a, 574},
-	{0x253b, 539},
-	{0x253c, 529},
-	{0x253d, 575},
-	{0x253e, 576},
-	{0x253f, 545},
-	{0x2540, 577},
-	{0x2541, 578},
-	{0x2542, 550},
-	{0x2543, 579},
-	{0x2544, 580},
-	{0x2545, 581},
-	{0x2546, 582},
-	{0x2547, 583},
-	{0x2548, 584},
-	{0x2549, 585},
-	{0x254a, 586},
-	{0x254b, 540},
-	{0x2592, 232},
-	{0x25a0, 165},
-	{0x25a1, 164},
-	{0x25a3, 229},
-	{0x25a4, 233},
-	{0x25a5, 234},
-	{0x25a6, 237},
-	{0x25a7, 236},
-	{0x25a8, 235},
-	{0x25a9, 238},
-	{0x25b1, 8736},
-	{0x25b2, 167},
-	{0x25b3, 166},
-	{0x25b5, 8780},
-	{0x25b6, 220},
-	{0x25b7, 219},
-	{0x25b9, 8781},
-	{0x25bc, 169},
-	{0x25bd, 168},
-	{0x25bf, 8779},
-	{0x25c0, 218},
-	{0x25c1, 217},
-	{0x25c3, 8782},
-	{0x25c6, 163},
-	{0x25c7, 162},
-	{0x25c8, 228},
-	{0x25c9, 227},
-	{0x25ca, 8787},
-	{0x25cb, 159},
-	{0x25cc, 8639},
-	{0x25ce, 161},
-	{0x25cf, 160},
-	{0x25d0, 230},
-	{0x25d1, 231},
-	{0x25e6, 8775},
-	{0x25ef, 8633},
-	{0x2605, 158},
-	{0x2606, 157},
-	{0x260e, 241},
-	{0x260f, 240},
-	{0x261c, 242},
-	{0x261d, 9222},
-	{0x261e, 243},
-	{0x261f, 9223},
-	{0x262f, 8664},
-	{0x2640, 147},
-	{0x2642, 146},
-	{0x2660, 222},
-	{0x2661, 223},
-	{0x2663, 226},
-	{0x2664, 221},
-	{0x2665, 224},
-	{0x2667, 225},
-	{0x2668, 239},
-	{0x2669, 253},
-	{0x266a, 254},
-	{0x266c, 255},
-	{0x266d, 252},
-	{0x266f, 8594},
-	{0x2716, 8631},
-	{0x271a, 8630},
-	{0x273d, 8604},
-	{0x2756, 8637},
-	{0x2776, 8673},
-	{0x2777, 8674},
-	{0x2778, 8675},
-	{0x2779, 8676},
-	{0x277a, 8677},
-	{0x277b, 8678},
-	{0x277c, 8679},
-	{0x277d, 8680},
-	{0x277e, 8681},
-	{0x277f, 8682},
-	{0x278a, 8342},
-	{0x278b, 8343},
-	{0x278c, 8344},
-	{0x278d, 8345},
-	{0x278e, 8346},
-	{0x278f, 8347},
-	{0x2790, 8348},
-	{0x2791, 8349},
-	{0x2792, 8350},
-	{0x2793, 8351},
-	{0x3000, 101},
-	{0x3001, 102},
-	{0x3002, 103},
-	{0x3003, 108},
-	{0x3008, 120},
-	{0x3009, 121},
-	{0x300a, 122},
-	{0x300b, 123},
-	{0x300c, 124},
-	{0x300d, 125},
-	{0x300e, 126},
-	{0x300f, 127},
-	{0x3010, 128},
-	{0x3011, 129},
-	{0x3012, 8700},
-	{0x3013, 175},
-	{0x3014, 118},
-	{0x3015, 119},
-	{0x3016, 8219},
-	{0x3017, 8220},
-	{0x3018, 8221},
-	{0x3019, 8222},
-	{0x301e, 9322},
-	{0x301f, 9323},
-	{0x3020, 8671},
-	{0x3036, 8701},
-	{0x3041, 851},
-	{0x3042, 852},
-	{0x3043, 853},
-	{0x3044, 854},
-	{0x3045, 855},
-	{0x3046, 856},
-	{0x3047, 857},
-	{0x3048, 858},
-	{0x3049, 859},
-	{0x304a, 860},
-	{0x304b, 861},
-	{0x304c, 862},
-	{0x304d, 863},
-	{0x304e, 864},
-	{0x304f, 865},
-	{0x3050, 866},
-	{0x3051, 867},
-	{0x3052, 868},
-	{0x3053, 869},
-	{0x3054, 870},
-	{0x3055, 871},
-	{0x3056, 872},
-	{0x3057, 873},
-	{0x3058, 874},
-	{0x3059, 875},
-	{0x305a, 876},
-	{0x305b, 877},
-	{0x305c, 878},
-	{0x305d, 879},
-	{0x305e, 880},
-	{0x305f, 881},
-	{0x3060, 882},
-	{0x3061, 883},
-	{0x3062, 884},
-	{0x3063, 885},
-	{0x3064, 886},
-	{0x3065, 887},
-	{0x3066, 888},
-	{0x3067, 889},
-	{0x3068, 890},
-	{0x3069, 891},
-	{0x306a, 892},
-	{0x306b, 893},
-	{0x306c, 894},
-	{0x306d, 895},
-	{0x306e, 896},
-	{0x306f, 897},
-	{0x3070, 898},
-	{0x3071, 899},
-	{0x3072, 900},
-	{0x3073, 901},
-	{0x3074, 902},
-	{0x3075, 903},
-	{0x3076, 904},
-	{0x3077, 905},
-	{0x3078, 906},
-	{0x3079, 907},
-	{0x307a, 908},
-	{0x307b, 909},
-	{0x307c, 910},
-	{0x307d, 911},
-	{0x307e, 912},
-	{0x307f, 913},
-	{0x3080, 914},
-	{0x3081, 915},
-	{0x3082, 916},
-	{0x3083, 917},
-	{0x3084, 918},
-	{0x3085, 919},
-	{0x3086, 920},
-	{0x3087, 921},
-	{0x3088, 922},
-	{0x3089, 923},
-	{0x308a, 924},
-	{0x308b, 925},
-	{0x308c, 926},
-	{0x308d, 927},
-	{0x308e, 928},
-	{0x308f, 929},
-	{0x3090, 930},
-	{0x3091, 931},
-	{0x3092, 932},
-	{0x3093, 933},
-	{0x30a1, 934},
-	{0x30a2, 935},
-	{0x30a3, 936},
-	{0x30a4, 937},
-	{0x30a5, 938},
-	{0x30a6, 939},
-	{0x30a7, 940},
-	{0x30a8, 941},
-	{0x30a9, 942},
-	{0x30aa, 943},
-	{0x30ab, 944},
-	{0x30ac, 945},
-	{0x30ad, 946},
-	{0x30ae, 947},
-	{0x30af, 948},
-	{0x30b0, 949},
-	{0x30b1, 950},
-	{0x30b2, 951},
-	{0x30b3, 952},
-	{0x30b4, 953},
-	{0x30b5, 954},
-	{0x30b6, 955},
-	{0x30b7, 956},
-	{0x30b8, 957},
-	{0x30b9, 958},
-	{0x30ba, 959},
-	{0x30bb, 960},
-	{0x30bc, 961},
-	{0x30bd, 962},
-	{0x30be, 963},
-	{0x30bf, 964},
-	{0x30c0, 965},
-	{0x30c1, 966},
-	{0x30c2, 967},
-	{0x30c3, 968},
-	{0x30c4, 969},
-	{0x30c5, 970},
-	{0x30c6, 971},
-	{0x30c7, 972},
-	{0x30c8, 973},
-	{0x30c9, 974},
-	{0x30ca, 975},
-	{0x30cb, 976},
-	{0x30cc, 977},
-	{0x30cd, 978},
-	{0x30ce, 979},
-	{0x30cf, 980},
-	{0x30d0, 981},
-	{0x30d1, 982},
-	{0x30d2, 983},
-	{0x30d3, 984},
-	{0x30d4, 985},
-	{0x30d5, 986},
-	{0x30d6, 987},
-	{0x30d7, 988},
-	{0x30d8, 989},
-	{0x30d9, 990},
-	{0x30da, 991},
-	{0x30db, 992},
-	{0x30dc, 993},
-	{0x30dd, 994},
-	{0x30de, 995},
-	{0x30df, 996},
-	{0x30e0, 997},
-	{0x30e1, 998},
-	{0x30e2, 999},
-	{0x30e3, 1000},
-	{0x30e4, 1001},
-	{0x30e5, 1002},
-	{0x30e6, 1003},
-	{0x30e7, 1004},
-	{0x30e8, 1005},
-	{0x30e9, 1006},
-	{0x30ea, 1007},
-	{0x30eb, 1008},
-	{0x30ec, 1009},
-	{0x30ed, 1010},
-	{0x30ee, 1011},
-	{0x30ef, 1012},
-	{0x30f0, 1013},
-	{0x30f1, 1014},
-	{0x30f2, 1015},
-	{0x30f3, 1016},
-	{0x30f4, 1017},
-	{0x30f5, 1018},
-	{0x30f6, 1019},
-	{0x30fb, 104},
-	{0x30fc, 9330},
-	{0x3131, 358},
-	{0x3132, 359},
-	{0x3133, 360},
-	{0x3134, 361},
-	{0x3135, 362},
-	{0x3136, 363},
-	{0x3137, 364},
-	{0x3138, 365},
-	{0x3139, 366},
-	{0x313a, 367},
-	{0x313b, 368},
-	{0x313c, 369},
-	{0x313d, 370},
-	{0x313e, 371},
-	{0x313f, 372},
-	{0x3140, 373},
-	{0x3141, 374},
-	{0x3142, 375},
-	{0x3143, 376},
-	{0x3144, 377},
-	{0x3145, 378},
-	{0x3146, 379},
-	{0x3147, 380},
-	{0x3148, 381},
-	{0x3149, 382},
-	{0x314a, 383},
-	{0x314b, 384},
-	{0x314c, 385},
-	{0x314d, 386},
-	{0x314e, 387},
-	{0x314f, 388},
-	{0x3150, 389},
-	{0x3151, 390},
-	{0x3152, 391},
-	{0x3153, 392},
-	{0x3154, 393},
-	{0x3155, 394},
-	{0x3156, 395},
-	{0x3157, 396},
-	{0x3158, 397},
-	{0x3159, 398},
-	{0x315a, 399},
-	{0x315b, 400},
-	{0x315c, 401},
-	{0x315d, 402},
-	{0x315e, 403},
-	{0x315f, 404},
-	{0x3160, 405},
-	{0x3161, 406},
-	{0x3162, 407},
-	{0x3163, 408},
-	{0x3164, 101},
-	{0x3165, 409},
-	{0x3166, 410},
-	{0x3167, 411},
-	{0x3168, 412},
-	{0x3169, 413},
-	{0x316a, 414},
-	{0x316b, 415},
-	{0x316c, 416},
-	{0x316d, 417},
-	{0x316e, 418},
-	{0x316f, 419},
-	{0x3170, 420},
-	{0x3171, 421},
-	{0x3172, 422},
-	{0x3173, 423},
-	{0x3174, 424},
-	{0x3175, 425},
-	{0x3176, 426},
-	{0x3177, 427},
-	{0x3178, 428},
-	{0x3179, 429},
-	{0x317a, 430},
-	{0x317b, 431},
-	{0x317c, 432},
-	{0x317d, 433},
-	{0x317e, 434},
-	{0x317f, 435},
-	{0x3180, 436},
-	{0x3181, 437},
-	{0x3182, 438},
-	{0x3183, 439},
-	{0x3184, 440},
-	{0x3185, 441},
-	{0x3186, 442},
-	{0x3187, 443},
-	{0x3188, 444},
-	{0x3189, 445},
-	{0x318a, 446},
-	{0x318b, 447},
-	{0x318c, 448},
-	{0x318d, 449},
-	{0x318e, 450},
-	{0x3200, 773},
-	{0x3201, 774},
-	{0x3202, 775},
-	{0x3203, 776},
-	{0x3204, 777},
-	{0x3205, 778},
-	{0x3206, 779},
-	{0x3207, 780},
-	{0x3208, 781},
-	{0x3209, 782},
-	{0x320a, 783},
-	{0x320b, 784},
-	{0x320c, 785},
-	{0x320d, 786},
-	{0x320e, 787},
-	{0x320f, 788},
-	{0x3210, 789},
-	{0x3211, 790},
-	{0x3212, 791},
-	{0x3213, 792},
-	{0x3214, 793},
-	{0x3215, 794},
-	{0x3216, 795},
-	{0x3217, 796},
-	{0x3218, 797},
-	{0x3219, 798},
-	{0x321a, 799},
-	{0x321b, 800},
-	{0x321c, 257},
-	{0x3231, 8788},
-	{0x3239, 8789},
-	{0x3260, 679},
-	{0x3261, 680},
-	{0x3262, 681},
-	{0x3263, 682},
-	{0x3264, 683},
-	{0x3265, 684},
-	{0x3266, 685},
-	{0x3267, 686},
-	{0x3268, 687},
-	{0x3269, 688},
-	{0x326a, 689},
-	{0x326b, 690},
-	{0x326c, 691},
-	{0x326d, 692},
-	{0x326e, 693},
-	{0x326f, 694},
-	{0x3270, 695},
-	{0x3271, 696},
-	{0x3272, 697},
-	{0x3273, 698},
-	{0x3274, 699},
-	{0x3275, 700},
-	{0x3276, 701},
-	{0x3277, 702},
-	{0x3278, 703},
-	{0x3279, 704},
-	{0x327a, 705},
-	{0x327b, 706},
-	{0x327f, 256},
-	{0x328a, 9301},
-	{0x328b, 9302},
-	{0x328c, 9303},
-	{0x328d, 9304},
-	{0x328e, 9305},
-	{0x328f, 9306},
-	{0x3290, 9300},
-	{0x3294, 9080},
-	{0x329e, 8761},
-	{0x32a5, 9096},
-	{0x3380, 627},
-	{0x3381, 628},
-	{0x3382, 629},
-	{0x3383, 630},
-	{0x3384, 631},
-	{0x3388, 612},
-	{0x3389, 613},
-	{0x338a, 646},
-	{0x338b, 647},
-	{0x338c, 648},
-	{0x338d, 608},
-	{0x338e, 609},
-	{0x338f, 610},
-	{0x3390, 638},
-	{0x3391, 639},
-	{0x3392, 640},
-	{0x3393, 641},
-	{0x3394, 642},
-	{0x3395, 587},
-	{0x3396, 588},
-	{0x3397, 589},
-	{0x3398, 591},
-	{0x3399, 597},
-	{0x339a, 598},
-	{0x339b, 599},
-	{0x339c, 600},
-	{0x339d, 601},
-	{0x339e, 602},
-	{0x339f, 603},
-	{0x33a0, 604},
-	{0x33a1, 605},
-	{0x33a2, 606},
-	{0x33a3, 593},
-	{0x33a4, 594},
-	{0x33a5, 595},
-	{0x33a6, 596},
-	{0x33a7, 615},
-	{0x33a8, 616},
-	{0x33a9, 655},
-	{0x33aa, 656},
-	{0x33ab, 657},
-	{0x33ac, 658},
-	{0x33ad, 651},
-	{0x33ae, 652},
-	{0x33af, 653},
-	{0x33b0, 617},
-	{0x33b1, 618},
-	{0x33b2, 619},
-	{0x33b3, 620},
-	{0x33b4, 621},
-	{0x33b5, 622},
-	{0x33b6, 623},
-	{0x33b7, 624},
-	{0x33b8, 625},
-	{0x33b9, 626},
-	{0x33ba, 632},
-	{0x33bb, 633},
-	{0x33bc, 634},
-	{0x33bd, 635},
-	{0x33be, 636},
-	{0x33bf, 637},
-	{0x33c0, 644},
-	{0x33c1, 645},
-	{0x33c2, 261},
-	{0x33c3, 662},
-	{0x33c4, 592},
-	{0x33c5, 650},
-	{0x33c6, 665},
-	{0x33c7, 259},
-	{0x33c8, 614},
-	{0x33c9, 663},
-	{0x33ca, 607},
-	{0x33cb, 8790},
-	{0x33cf, 611},
-	{0x33d0, 660},
-	{0x33d3, 661},
-	{0x33d6, 649},
-	{0x33d8, 262},
-	{0x33db, 654},
-	{0x33dc, 664},
-	{0x33dd, 659},
-	{0x4e00, 6460},
-	{0x4e01, 6704},
-	{0x4e03, 7364},
-	{0x4e07, 4670},
-	{0x4e08, 6534},
-	{0x4e09, 5320},
-	{0x4e0a, 5331},
-	{0x4e0b, 7616},
-	{0x4e0d, 5109},
-	{0x4e11, 7288},
-	{0x4e14, 7041},
-	{0x4e15, 5181},
-	{0x4e16, 5492},
-	{0x4e18, 3893},
-	{0x4e19, 5041},
-	{0x4e1e, 5682},
-	{0x4e2d, 6922},
-	{0x4e32, 3802},
-	{0x4e38, 7882},
-	{0x4e39, 4192},
-	{0x4e3b, 6860},
-	{0x4e42, 6029},
-	{0x4e43, 4154},
-	{0x4e45, 3894},
-	{0x4e4b, 6942},
-	{0x4e4d, 5241},
-	{0x4e4e, 7800},
-	{0x4e4f, 7614},
-	{0x4e56, 3855},
-	{0x4e58, 5683},
-	{0x4e59, 6380},
-	{0x4e5d, 3895},
-	{0x4e5e, 3613},
-	{0x4e5f, 5862},
-	{0x4e6b, 3500},
-	{0x4e6d, 4329},
-	{0x4e73, 6309},
-	{0x4e76, 5092},
-	{0x4e77, 5315},
-	{0x4e7e, 3601},
-	{0x4e82, 4389},
-	{0x4e86, 4551},
-	{0x4e88, 5934},
-	{0x4e8b, 5242},
-	{0x4e8c, 6413},
-	{0x4e8e, 6197},
-	{0x4e90, 6252},
-	{0x4e91, 6238},
-	{0x4e92, 7801},
-	{0x4e94, 6049},
-	{0x4e95, 6705},
-	{0x4e98, 4058},
-	{0x4e9b, 5243},
-	{0x4e9e, 5775},
-	{0x4ea1, 4696},
-	{0x4ea2, 7670},
-	{0x4ea4, 3868},
-	{0x4ea5, 7685},
-	{0x4ea6, 5947},
-	{0x4ea8, 7771},
-	{0x4eab, 7710},
-	{0x4eac, 3660},
-	{0x4ead, 6706},
-	{0x4eae, 4427},
-	{0x4eb6, 4193},
-	{0x4eba, 6443},
-	{0x4ec0, 5771},
-	{0x4ec1, 6444},
-	{0x4ec4, 7331},
-	{0x4ec7, 3896},
-	{0x4eca, 4038},
-	{0x4ecb, 3560},
-	{0x4ecd, 6479},
-	{0x4ed4, 6483},
-	{0x4ed5, 5244},
-	{0x4ed6, 7380},
-	{0x4ed7, 6535},
-	{0x4ed8, 5110},
-	{0x4ed9, 5418},
-	{0x4edd, 4331},
-	{0x4edf, 7148},
-	{0x4ee3, 4250},
-	{0x4ee4, 4489},
-	{0x4ee5, 6414},
-	{0x4ef0, 5833},
-	{0x4ef2, 6923},
-	{0x4ef6, 3602},
-	{0x4ef7, 3561},
-	{0x4efb, 6469},
-	{0x4f01, 4062},
-	{0x4f09, 7671},
-	{0x4f0a, 6415},
-	{0x4f0b, 4051},
-	{0x4f0d, 6050},
-	{0x4f0e, 4063},
-	{0x4f0f, 5074},
-	{0x4f10, 5005},
-	{0x4f11, 8005},
-	{0x4f2f, 4988},
-	{0x4f34, 4905},
-	{0x4f36, 4490},
-	{0x4f38, 5735},
-	{0x4f3a, 5245},
-	{0x4f3c, 5246},
-	{0x4f3d, 3436},
-	{0x4f43, 6643},
-	{0x4f46, 4194},
-	{0x4f47, 6591},
-	{0x4f48, 7544},
-	{0x4f4d, 6284},
-	{0x4f4e, 6592},
-	{0x4f4f, 6861},
-	{0x4f50, 6854},
-	{0x4f51, 6198},
-	{0x4f55, 7617},
-	{0x4f59, 5935},
-	{0x4f5a, 6461},
-	{0x4f5b, 5171},
-	{0x4f5c, 6509},
-	{0x4f69, 7502},
-	{0x4f6f, 5879},
-	{0x4f70, 4989},
-	{0x4f73, 3437},
-	{0x4f76, 4127},
-	{0x4f7a, 6644},
-	{0x4f7e, 6462},
-	{0x4f7f, 5247},
-	{0x4f81, 5736},
-	{0x4f83, 3476},
-	{0x4f84, 7015},
-	{0x4f86, 4420},
-	{0x4f88, 7336},
-	{0x4f8a, 3839},
-	{0x4f8b, 4506},
-	{0x4f8d, 5692},
-	{0x4f8f, 6862},
-	{0x4f91, 6310},
-	{0x4f96, 4594},
-	{0x4f98, 7042},
-	{0x4f9b, 3786},
-	{0x4f9d, 6394},
-	{0x4fae, 4764},
-	{0x4faf, 7966},
-	{0x4fb5, 7367},
-	{0x4fb6, 4440},
-	{0x4fbf, 7518},
-	{0x4fc2, 3705},
-	{0x4fc3, 7241},
-	{0x4fc4, 5776},
-	{0x4fc9, 6051},
-	{0x4fca, 6902},
-	{0x4fce, 6782},
-	{0x4fd1, 6174},
-	{0x4fd3, 3661},
-	{0x4fd4, 7734},
-	{0x4fd7, 5537},
-	{0x4fda, 4613},
-	{0x4fdd, 5058},
-	{0x4fdf, 5248},
-	{0x4fe0, 7759},
-	{0x4fe1, 5737},
-	{0x4fee, 5567},
-	{0x4fef, 5111},
-	{0x4ff1, 3897},
-	{0x4ff3, 4970},
-	{0x4ff5, 7576},
-	{0x4ff8, 5093},
-	{0x4ffa, 5925},
-	{0x5002, 5042},
-	{0x5006, 4428},
-	{0x5009, 7092},
-	{0x500b, 3562},
-	{0x500d, 4969},
-	{0x5011, 4836},
-	{0x5012, 4269},
-	{0x5016, 7705},
-	{0x5019, 7967},
-	{0x501a, 6395},
-	{0x501c, 7134},
-	{0x501e, 3662},
-	{0x501f, 7043},
-	{0x5021, 7093},
-	{0x5023, 4941},
-	{0x5024, 7337},
-	{0x5026, 3969},
-	{0x5027, 6837},
-	{0x5028, 3585},
-	{0x502a, 6030},
-	{0x502b, 4595},
-	{0x502c, 7394},
-	{0x502d, 6131},
-	{0x503b, 5863},
-	{0x5043, 5917},
-	{0x5047, 3438},
-	{0x5048, 3627},
-	{0x5049, 6285},
-	{0x504f, 7519},
-	{0x5055, 7686},
-	{0x505a, 6863},
-	{0x505c, 6707},
-	{0x5065, 3603},
-	{0x5074, 7330},
-	{0x5075, 6708},
-	{0x5076, 6199},
-	{0x5078, 7465},
-	{0x5080, 3856},
-	{0x5085, 5112},
-	{0x508d, 4942},
-	{0x5091, 3614},
-	{0x5098, 5303},
-	{0x5099, 5182},
-	{0x50ac, 7262},
-	{0x50ad, 6175},
-	{0x50b2, 6052},
-	{0x50b3, 6645},
-	{0x50b5, 7114},
-	{0x50b7, 5332},
-	{0x50be, 3663},
-	{0x50c5, 4023},
-	{0x50c9, 7177},
-	{0x50ca, 5419},
-	{0x50cf, 5333},
-	{0x50d1, 3869},
-	{0x50d5, 5075},
-	{0x50d6, 8035},
-	{0x50da, 4552},
-	{0x50de, 6286},
-	{0x50e5, 6140},
-	{0x50e7, 5684},
-	{0x50ed, 7082},
-	{0x50f9, 3439},
-	{0x50fb, 5020},
-	{0x50ff, 5249},
-	{0x5100, 6396},
-	{0x5101, 6903},
-	{0x5104, 5912},
-	{0x5106, 3664},
-	{0x5109, 3617},
-	{0x5112, 6311},
-	{0x511f, 5334},
-	{0x5121, 4543},
-	{0x512a, 6200},
-	{0x5132, 6593},
-	{0x5137, 4441},
-	{0x513a, 4133},
-	{0x513c, 5926},
-	{0x5140, 6089},
-	{0x5141, 6359},
-	{0x5143, 6255},
-	{0x5144, 7772},
-	{0x5145, 7306},
-	{0x5146, 6783},
-	{0x5147, 8013},
-	{0x5148, 5420},
-	{0x5149, 3840},
-	{0x514b, 4016},
-	{0x514c, 7431},
-	{0x514d, 4735},
-	{0x514e, 7449},
-	{0x5152, 5777},
-	{0x515c, 4348},
-	{0x5162, 4059},
-	{0x5165, 6477},
-	{0x5167, 4155},
-	{0x5168, 6646},
-	{0x5169, 4429},
-	{0x516a, 6312},
-	{0x516b, 7499},
-	{0x516c, 3787},
-	{0x516d, 4591},
-	{0x516e, 7791},
-	{0x5171, 3788},
-	{0x5175, 5043},
-	{0x5176, 4064},
-	{0x5177, 3898},
-	{0x5178, 6647},
-	{0x517c, 3654},
-	{0x5180, 4065},
-	{0x5186, 5933},
-	{0x518a, 7126},
-	{0x518d, 6570},
-	{0x5192, 4765},
-	{0x5195, 4736},
-	{0x5197, 6176},
-	{0x51a0, 3819},
-	{0x51a5, 4748},
-	{0x51aa, 4733},
-	{0x51ac, 4332},
-	{0x51b6, 5864},
-	{0x51b7, 4424},
-	{0x51bd, 4477},
-	{0x51c4, 7130},
-	{0x51c6, 6904},
-	{0x51c9, 4430},
-	{0x51cb, 6784},
-	{0x51cc, 4607},
-	{0x51cd, 4333},
-	{0x51dc, 4606},
-	{0x51dd, 6390},
-	{0x51de, 8036},
-	{0x51e1, 5009},
-	{0x51f0, 7904},
-	{0x51f1, 3563},
-	{0x51f6, 8014},
-	{0x51f8, 7167},
-	{0x51f9, 6141},
-	{0x51fa, 7303},
-	{0x51fd, 7651},
-	{0x5200, 4270},
-	{0x5203, 6445},
-	{0x5206, 5152},
-	{0x5207, 6684},
-	{0x5208, 6031},
-	{0x520a, 3477},
-	{0x520e, 4837},
-	{0x5211, 7773},
-	{0x5217, 4478},
-	{0x521d, 7214},
-	{0x5224, 7490},
-	{0x5225, 5037},
-	{0x5229, 4614},
-	{0x522a, 5304},
-	{0x522e, 3835},
-	{0x5230, 4271},
-	{0x5236, 6759},
-	{0x5237, 5561},
-	{0x5238, 3970},
-	{0x5239, 7077},
-	{0x523a, 6484},
-	{0x523b, 3465},
-	{0x5243, 7205},
-	{0x5247, 7360},
-	{0x524a, 5301},
-	{0x524b, 4017},
-	{0x524c, 4397},
-	{0x524d, 6648},
-	{0x5254, 7135},
-	{0x5256, 5113},
-	{0x525b, 3536},
-	{0x525d, 4886},
-	{0x5261, 5463},
-	{0x5269, 6480},
-	{0x526a, 6649},
-	{0x526f, 5114},
-	{0x5272, 7649},
-	{0x5275, 7094},
-	{0x527d, 7577},
-	{0x527f, 7215},
-	{0x5283, 7948},
-	{0x5287, 4018},
-	{0x5288, 5021},
-	{0x5289, 4577},
-	{0x528d, 3618},
-	{0x5291, 6760},
-	{0x5292, 3619},
-	{0x529b, 4458},
-	{0x529f, 3789},
-	{0x52a0, 3440},
-	{0x52a3, 4479},
-	{0x52a4, 4024},
-	{0x52a9, 6785},
-	{0x52aa, 4169},
-	{0x52ab, 3624},
-	{0x52be, 7703},
-	{0x52c1, 3665},
-	{0x52c3, 4930},
-	{0x52c5, 7361},
-	{0x52c7, 6177},
-	{0x52c9, 4737},
-	{0x52cd, 3666},
-	{0x52d2, 4604},
-	{0x52d5, 4334},
-	{0x52d6, 6229},
-	{0x52d8, 3510},
-	{0x52d9, 4812},
-	{0x52db, 7979},
-	{0x52dd, 5685},
-	{0x52de, 4511},
-	{0x52df, 4766},
-	{0x52e2, 5493},
-	{0x52e3, 6619},
-	{0x52e4, 4025},
-	{0x52f3, 7980},
-	{0x52f5, 4442},
-	{0x52f8, 3971},
-	{0x52fa, 6510},
-	{0x52fb, 4009},
-	{0x52fe, 3899},
-	{0x52ff, 4848},
-	{0x5305, 7545},
-	{0x5308, 8015},
-	{0x530d, 7546},
-	{0x530f, 7547},
-	{0x5310, 5076},
-	{0x5315, 5183},
-	{0x5316, 7863},
-	{0x5317, 5151},
-	{0x5319, 5693},
-	{0x5320, 6536},
-	{0x5321, 3841},
-	{0x5323, 3530},
-	{0x532a, 5184},
-	{0x532f, 7928},
-	{0x5339, 7604},
-	{0x533f, 4188},
-	{0x5340, 3900},
-	{0x5341, 5772},
-	{0x5343, 7149},
-	{0x5344, 6478},
-	{0x5347, 5686},
-	{0x5348, 6053},
-	{0x5349, 7994},
-	{0x534a, 4906},
-	{0x534d, 4671},
-	{0x5351, 5185},
-	{0x5352, 6834},
-	{0x5353, 7395},
-	{0x5354, 7760},
-	{0x5357, 4145},
-	{0x535a, 4887},
-	{0x535c, 5077},
-	{0x535e, 5031},
-	{0x5360, 6692},
-	{0x5366, 3852},
-	{0x5368, 5450},
-	{0x536f, 4800},
-	{0x5370, 6446},
-	{0x5371, 6287},
-	{0x5374, 3466},
-	{0x5375, 4390},
-	{0x5377, 3972},
-	{0x537d, 6926},
-	{0x537f, 3667},
-	{0x5384, 5851},
-	{0x5393, 5840},
-	{0x5398, 4615},
-	{0x539a, 7968},
-	{0x539f, 6256},
-	{0x53a0, 7332},
-	{0x53a5, 3979},
-	{0x53a6, 7618},
-	{0x53ad, 5989},
-	{0x53bb, 3586},
-	{0x53c3, 7083},
-	{0x53c8, 6201},
-	{0x53c9, 7044},
-	{0x53ca, 4052},
-	{0x53cb, 6202},
-	{0x53cd, 4907},
-	{0x53d4, 5628},
-	{0x53d6, 7316},
-	{0x53d7, 5568},
-	{0x53db, 4908},
-	{0x53e1, 6032},
-	{0x53e2, 7251},
-	{0x53e3, 3901},
-	{0x53e4, 3729},
-	{0x53e5, 3902},
-	{0x53e9, 3730},
-	{0x53ea, 6943},
-	{0x53eb, 3994},
-	{0x53ec, 5500},
-	{0x53ed, 7500},
-	{0x53ef, 3441},
-	{0x53f0, 7432},
-	{0x53f1, 7016},
-	{0x53f2, 5250},
-	{0x53f3, 6203},
-	{0x53f8, 5251},
-	{0x5403, 8023},
-	{0x5404, 3467},
-	{0x5408, 7663},
-	{0x5409, 4128},
-	{0x540a, 6620},
-	{0x540c, 4335},
-	{0x540d, 4749},
-	{0x540e, 7969},
-	{0x540f, 4616},
-	{0x5410, 7450},
-	{0x5411, 7711},
-	{0x541b, 3953},
-	{0x541d, 4638},
-	{0x541f, 6381},
-	{0x5420, 7534},
-	{0x5426, 5115},
-	{0x5429, 5153},
-	{0x542b, 7652},
-	{0x5433, 6055},
-	{0x5438, 8030},
-	{0x5439, 7317},
-	{0x543b, 4838},
-	{0x543c, 7970},
-	{0x543e, 6054},
-	{0x5442, 4443},
-	{0x5448, 6709},
-	{0x544a, 3731},
-	{0x5451, 7408},
-	{0x5468, 6867},
-	{0x546a, 6866},
-	{0x5471, 3732},
-	{0x5473, 4851},
-	{0x5475, 3442},
-	{0x547b, 5738},
-	{0x547c, 7802},
-	{0x547d, 4750},
-	{0x5480, 6594},
-	{0x5486, 7548},
-	{0x548c, 7864},
-	{0x548e, 3903},
-	{0x5490, 5116},
-	{0x54a4, 7381},
-	{0x54a8, 6485},
-	{0x54ab, 6944},
-	{0x54ac, 3870},
-	{0x54b3, 7687},
-	{0x54b8, 7653},
-	{0x54bd, 6447},
-	{0x54c0, 5841},
-	{0x54c1, 7590},
-	{0x54c4, 7853},
-	{0x54c8, 7664},
-	{0x54c9, 6571},
-	{0x54e1, 6257},
-	{0x54e5, 3443},
-	{0x54e8, 7216},
-	{0x54ed, 3767},
-	{0x54ee, 7953},
-	{0x54f2, 7168},
-	{0x54fa, 7549},
-	{0x5504, 7503},
-	{0x5506, 5252},
-	{0x5507, 6980},
-	{0x550e, 4617},
-	{0x5510, 4239},
-	{0x551c, 4689},
-	{0x552f, 6313},
-	{0x5531, 7095},
-	{0x5535, 5821},
-	{0x553e, 7382},
-	{0x5544, 7396},
-	{0x5546, 5335},
-	{0x554f, 4839},
-	{0x5553, 3706},
-	{0x5556, 4217},
-	{0x555e, 5778},
-	{0x5563, 7654},
-	{0x557c, 6761},
-	{0x5580, 3579},
-	{0x5584, 5421},
-	{0x5586, 7169},
-	{0x5587, 4374},
-	{0x5589, 7971},
-	{0x558a, 7655},
-	{0x5598, 7150},
-	{0x5599, 7995},
-	{0x559a, 7883},
-	{0x559c, 8037},
-	{0x559d, 3501},
-	{0x55a7, 7990},
-	{0x55a9, 6314},
-	{0x55aa, 5336},
-	{0x55ab, 4132},
-	{0x55ac, 3871},
-	{0x55ae, 4195},
-	{0x55c5, 7972},
-	{0x55c7, 5365},
-	{0x55d4, 6981},
-	{0x55da, 6056},
-	{0x55dc, 4066},
-	{0x55df, 7045},
-	{0x55e3, 5253},
-	{0x55e4, 7338},
-	{0x55fd, 5569},
-	{0x55fe, 6868},
-	{0x5606, 7409},
-	{0x5609, 3444},
-	{0x5614, 3904},
-	{0x5617, 5337},
-	{0x562f, 5501},
-	{0x5632, 6786},
-	{0x5634, 7318},
-	{0x5636, 5694},
-	{0x5653, 7719},
-	{0x5668, 4067},
-	{0x566b, 8038},
-	{0x5674, 5154},
-	{0x5686, 7954},
-	{0x56a5, 5956},
-	{0x56ac, 5223},
-	{0x56ae, 7712},
-	{0x56b4, 5927},
-	{0x56bc, 6511},
-	{0x56ca, 4152},
-	{0x56cd, 8039},
-	{0x56d1, 7242},
-	{0x56da, 5570},
-	{0x56db, 5254},
-	{0x56de, 7929},
-	{0x56e0, 6448},
-	{0x56f0, 3774},
-	{0x56f9, 4491},
-	{0x56fa, 3733},
-	{0x5703, 7550},
-	{0x5704, 5902},
-	{0x5708, 3973},
-	{0x570b, 3947},
-	{0x570d, 6288},
-	{0x5712, 6259},
-	{0x5713, 6258},
-	{0x5716, 4272},
-	{0x5718, 4196},
-	{0x571f, 7451},
-	{0x5728, 6572},
-	{0x572d, 3995},
-	{0x5730, 6945},
-	{0x573b, 4068},
-	{0x5740, 6946},
-	{0x5742, 7491},
-	{0x5747, 4010},
-	{0x574a, 4943},
-	{0x574d, 4218},
-	{0x574e, 3511},
-	{0x5750, 6855},
-	{0x5751, 3581},
-	{0x5761, 7474},
-	{0x5764, 3775},
-	{0x5766, 7410},
-	{0x576a, 7529},
-	{0x576e, 4252},
-	{0x5770, 3668},
-	{0x5775, 3905},
-	{0x577c, 7397},
-	{0x5782, 5571},
-	{0x5788, 4251},
-	{0x578b, 7774},
-	{0x5793, 7688},
-	{0x57a0, 6373},
-	{0x57a2, 3906},
-	{0x57a3, 6260},
-	{0x57c3, 5842},
-	{0x57c7, 6178},
-	{0x57c8, 6905},
-	{0x57cb, 4708},
-	{0x57ce, 5474},
-	{0x57df, 5948},
-	{0x57e0, 5117},
-	{0x57f0, 7115},
-	{0x57f4, 5720},
-	{0x57f7, 7032},
-	{0x57f9, 4971},
-	{0x57fa, 4069},
-	{0x57fc, 4070},
-	{0x5800, 3959},
-	{0x5802, 4240},
-	{0x5805, 3637},
-	{0x5806, 7459},
-	{0x5808, 3537},
-	{0x5809, 6355},
-	{0x580a, 5793},
-	{0x581e, 7187},
-	{0x5821, 5059},
-	{0x5824, 6762},
-	{0x5827, 5957},
-	{0x582a, 3512},
-	{0x582f, 6142},
-	{0x5830, 5918},
-	{0x5831, 5060},
-	{0x5834, 6537},
-	{0x5835, 4273},
-	{0x583a, 3707},
-	{0x584a, 3857},
-	{0x584b, 6002},
-	{0x584f, 3564},
-	{0x5851, 5502},
-	{0x5854, 7424},
-	{0x5857, 4274},
-	{0x5858, 4241},
-	{0x585a, 7252},
-	{0x585e, 5362},
-	{0x5861, 6650},
-	{0x5862, 6057},
-	{0x5864, 7981},
-	{0x5875, 6982},
-	{0x5879, 7084},
-	{0x587c, 6651},
-	{0x587e, 5629},
-	{0x5883, 3669},
-	{0x5885, 5373},
-	{0x5889, 6179},
-	{0x5893, 4801},
-	{0x589c, 7265},
-	{0x589e, 6931},
-	{0x589f, 7720},
-	{0x58a8, 4834},
-	{0x58a9, 4319},
-	{0x58ae, 7383},
-	{0x58b3, 5155},
-	{0x58ba, 6058},
-	{0x58bb, 6538},
-	{0x58be, 3478},
-	{0x58c1, 5022},
-	{0x58c5, 6090},
-	{0x58c7, 4197},
-	{0x58ce, 7982},
-	{0x58d1, 7630},
-	{0x58d3, 5829},
-	{0x58d5, 7803},
-	{0x58d8, 4564},
-	{0x58d9, 3842},
-	{0x58de, 3858},
-	{0x58df, 4536},
-	{0x58e4, 5880},
-	{0x58eb, 5255},
-	{0x58ec, 6470},
-	{0x58ef, 6539},
-	{0x58f9, 6463},
-	{0x58fa, 7804},
-	{0x58fb, 5374},
-	{0x58fd, 5572},
-	{0x590f, 7619},
-	{0x5914, 4071},
-	{0x5915, 5403},
-	{0x5916, 6135},
-	{0x5919, 5630},
-	{0x591a, 4190},
-	{0x591c, 5865},
-	{0x5922, 4797},
-	{0x5927, 4253},
-	{0x5929, 7151},
-	{0x592a, 7433},
-	{0x592b, 5118},
-	{0x592d, 6143},
-	{0x592e, 5834},
-	{0x5931, 5758},
-	{0x5937, 6416},
-	{0x593e, 7761},
-	{0x5944, 5928},
-	{0x5947, 4072},
-	{0x5948, 4156},
-	{0x5949, 5094},
-	{0x594e, 3996},
-	{0x594f, 6869},
-	{0x5950, 7884},
-	{0x5951, 3708},
-	{0x5954, 5156},
-	{0x5955, 7730},
-	{0x5957, 7466},
-	{0x595a, 7689},
-	{0x5960, 6652},
-	{0x5962, 5256},
-	{0x5967, 6059},
-	{0x596a, 7418},
-	{0x596b, 6360},
-	{0x596c, 6540},
-	{0x596d, 5404},
-	{0x596e, 5157},
-	{0x5973, 4159},
-	{0x5974, 4170},
-	{0x5978, 3479},
-	{0x597d, 7805},
-	{0x5982, 5936},
-	{0x5983, 5186},
-	{0x5984, 4697},
-	{0x598a, 6471},
-	{0x5993, 4073},
-	{0x5996, 6144},
-	{0x5997, 4039},
-	{0x5999, 4802},
-	{0x59a5, 7384},
-	{0x59a8, 4944},
-	{0x59ac, 7467},
-	{0x59b9, 4709},
-	{0x59bb, 7131},
-	{0x59be, 7188},
-	{0x59c3, 6710},
-	{0x59c6, 4767},
-	{0x59c9, 6486},
-	{0x59cb, 5695},
-	{0x59d0, 6595},
-	{0x59d1, 3734},
-	{0x59d3, 5475},
-	{0x59d4, 6289},
-	{0x59d9, 6472},
-	{0x59da, 6145},
-	{0x59dc, 3538},
-	{0x59dd, 6864},
-	{0x59e6, 3480},
-	{0x59e8, 6417},
-	{0x59ea, 7017},
-	{0x59ec, 8040},
-	{0x59ee, 7672},
-	{0x59f8, 5958},
-	{0x59fb, 6449},
-	{0x59ff, 6487},
-	{0x5a01, 6290},
-	{0x5a03, 6132},
-	{0x5a11, 5257},
-	{0x5a18, 4153},
-	{0x5a1b, 6060},
-	{0x5a1c, 4134},
-	{0x5a1f, 5959},
-	{0x5a20, 5739},
-	{0x5a25, 5779},
-	{0x5a29, 4672},
-	{0x5a36, 7319},
-	{0x5a3c, 7096},
-	{0x5a41, 4565},
-	{0x5a46, 7475},
-	{0x5a49, 6107},
-	{0x5a5a, 7844},
-	{0x5a62, 5187},
-	{0x5a66, 5119},
-	{0x5a92, 4710},
-	{0x5a9a, 4852},
-	{0x5a9b, 6261},
-	{0x5aa4, 5696},
-	{0x5ac1, 3445},
-	{0x5ac2, 5573},
-	{0x5ac4, 6262},
-	{0x5ac9, 7018},
-	{0x5acc, 7758},
-	{0x5ae1, 6621},
-	{0x5ae6, 7673},
-	{0x5ae9, 4181},
-	{0x5b05, 7865},
-	{0x5b09, 8041},
-	{0x5b0b, 5422},
-	{0x5b0c, 3872},
-	{0x5b16, 7535},
-	{0x5b2a, 5224},
-	{0x5b40, 5338},
-	{0x5b43, 5881},
-	{0x5b50, 6488},
-	{0x5b51, 7754},
-	{0x5b54, 3790},
-	{0x5b55, 6481},
-	{0x5b57, 6489},
-	{0x5b58, 6832},
-	{0x5b5a, 5120},
-	{0x5b5c, 6490},
-	{0x5b5d, 7955},
-	{0x5b5f, 4727},
-	{0x5b63, 3709},
-	{0x5b64, 3735},
-	{0x5b69, 7690},
-	{0x5b6b, 5546},
-	{0x5b70, 5631},
-	{0x5b71, 6522},
-	{0x5b75, 5121},
-	{0x5b78, 7631},
-	{0x5b7a, 6315},
-	{0x5b7c, 5923},
-	{0x5b85, 4266},
-	{0x5b87, 6204},
-	{0x5b88, 5574},
-	{0x5b89, 5807},
-	{0x5b8b, 5553},
-	{0x5b8c, 6108},
-	{0x5b8f, 3864},
-	{0x5b93, 5078},
-	{0x5b95, 7427},
-	{0x5b96, 7950},
-	{0x5b97, 6838},
-	{0x5b98, 3820},
-	{0x5b99, 6870},
-	{0x5b9a, 6711},
-	{0x5b9b, 6109},
-	{0x5b9c, 6397},
-	{0x5ba2, 3580},
-	{0x5ba3, 5423},
-	{0x5ba4, 5759},
-	{0x5ba5, 6316},
-	{0x5ba6, 7885},
-	{0x5bac, 5476},
-	{0x5bae, 3963},
-	{0x5bb0, 6573},
-	{0x5bb3, 7691},
-	{0x5bb4, 5960},
-	{0x5bb5, 5503},
-	{0x5bb6, 3446},
-	{0x5bb8, 5740},
-	{0x5bb9, 6180},
-	{0x5bbf, 5632},
-	{0x5bc0, 7116},
-	{0x5bc2, 6622},
-	{0x5bc3, 6263},
-	{0x5bc4, 4074},
-	{0x5bc5, 6450},
-	{0x5bc6, 4883},
-	{0x5bc7, 3907},
-	{0x5bcc, 5122},
-	{0x5bd0, 4711},
-	{0x5bd2, 7635},
-	{0x5bd3, 6205},
-	{0x5bd4, 5721},
-	{0x5bd7, 4168},
-	{0x5bde, 4664},
-	{0x5bdf, 7078},
-	{0x5be1, 3803},
-	{0x5be2, 7368},
-	{0x5be4, 6061},
-	{0x5be5, 6146},
-	{0x5be6, 5760},
-	{0x5be7, 4167},
-	{0x5be8, 7117},
-	{0x5be9, 5762},
-	{0x5beb, 5258},
-	{0x5bec, 3821},
-	{0x5bee, 4553},
-	{0x5bef, 6906},
-	{0x5bf5, 7253},
-	{0x5bf6, 5061},
-	{0x5bf8, 7247},
-	{0x5bfa, 5259},
-	{0x5c01, 5095},
-	{0x5c04, 5260},
-	{0x5c07, 6541},
-	{0x5c08, 6653},
-	{0x5c09, 6291},
-	{0x5c0a, 6833},
-	{0x5c0b, 5763},
-	{0x5c0d, 4254},
-	{0x5c0e, 4275},
-	{0x5c0f, 5504},
-	{0x5c11, 5505},
-	{0x5c16, 7178},
-	{0x5c19, 5339},
-	{0x5c24, 6206},
-	{0x5c28, 4945},
-	{0x5c31, 7320},
-	{0x5c38, 5697},
-	{0x5c39, 6361},
-	{0x5c3a, 7136},
-	{0x5c3b, 3736},
-	{0x5c3c, 4186},
-	{0x5c3e, 4853},
-	{0x5c3f, 4180},
-	{0x5c40, 3948},
-	{0x5c45, 3587},
-	{0x5c46, 3710},
-	{0x5c48, 3960},
-	{0x5c4b, 6078},
-	{0x5c4d, 5699},
-	{0x5c4e, 5698},
-	{0x5c51, 5451},
-	{0x5c55, 6654},
-	{0x5c5b, 5044},
-	{0x5c60, 4276},
-	{0x5c62, 4566},
-	{0x5c64, 7335},
-	{0x5c65, 4618},
-	{0x5c6c, 5538},
-	{0x5c6f, 4358},
-	{0x5c71, 5305},
-	{0x5c79, 8024},
-	{0x5c90, 4075},
-	{0x5c91, 6527},
-	{0x5ca1, 3539},
-	{0x5ca9, 5822},
-	{0x5cab, 5575},
-	{0x5cac, 3531},
-	{0x5cb1, 4255},
-	{0x5cb3, 5794},
-	{0x5cb5, 7806},
-	{0x5cb7, 4870},
-	{0x5cb8, 5808},
-	{0x5cba, 4492},
-	{0x5cbe, 6693},
-	{0x5cc0, 5576},
-	{0x5cd9, 7339},
-	{0x5ce0, 5340},
-	{0x5ce8, 5780},
-	{0x5cef, 5096},
-	{0x5cf0, 5097},
-	{0x5cf4, 7735},
-	{0x5cf6, 4277},
-	{0x5cfb, 6907},
-	{0x5cfd, 7762},
-	{0x5d07, 5671},
-	{0x5d0d, 4421},
-	{0x5d0e, 4076},
-	{0x5d11, 3776},
-	{0x5d14, 7263},
-	{0x5d16, 5843},
-	{0x5d17, 3540},
-	{0x5d19, 4596},
-	{0x5d27, 5672},
-	{0x5d29, 5175},
-	{0x5d4b, 4854},
-	{0x5d4c, 3513},
-	{0x5d50, 4399},
-	{0x5d69, 5673},
-	{0x5d6c, 6136},
-	{0x5d6f, 7046},
-	{0x5d87, 3908},
-	{0x5d8b, 4278},
-	{0x5d9d, 4365},
-	{0x5da0, 3873},
-	{0x5da2, 6147},
-	{0x5daa, 5931},
-	{0x5db8, 6003},
-	{0x5dba, 4493},
-	{0x5dbc, 5375},
-	{0x5dbd, 5795},
-	{0x5dcd, 6137},
-	{0x5dd2, 4673},
-	{0x5dd6, 5823},
-	{0x5ddd, 7152},
-	{0x5dde, 6871},
-	{0x5de1, 5640},
-	{0x5de2, 5506},
-	{0x5de5, 3791},
-	{0x5de6, 6856},
-	{0x5de7, 3874},
-	{0x5de8, 3588},
-	{0x5deb, 4813},
-	{0x5dee, 7047},
-	{0x5df1, 4077},
-	{0x5df2, 6418},
-	{0x5df3, 5261},
-	{0x5df4, 7476},
-	{0x5df7, 7674},
-	{0x5dfd, 5547},
-	{0x5dfe, 3604},
-	{0x5e02, 5700},
-	{0x5e03, 7551},
-	{0x5e06, 5010},
-	{0x5e0c, 8042},
-	{0x5e11, 7428},
-	{0x5e16, 7189},
-	{0x5e19, 7019},
-	{0x5e1b, 4990},
-	{0x5e1d, 6763},
-	{0x5e25, 5577},
-	{0x5e2b, 5262},
-	{0x5e2d, 5405},
-	{0x5e33, 6542},
-	{0x5e36, 4256},
-	{0x5e38, 5341},
-	{0x5e3d, 4768},
-	{0x5e3f, 7973},
-	{0x5e40, 6712},
-	{0x5e44, 5796},
-	{0x5e45, 7571},
-	{0x5e47, 4946},
-	{0x5e4c, 7905},
-	{0x5e55, 4665},
-	{0x5e5f, 7340},
-	{0x5e61, 4996},
-	{0x5e62, 4242},
-	{0x5e63, 7536},
-	{0x5e72, 3481},
-	{0x5e73, 7530},
-	{0x5e74, 4160},
-	{0x5e77, 5045},
-	{0x5e78, 7706},
-	{0x5e79, 3482},
-	{0x5e7b, 7886},
-	{0x5e7c, 6317},
-	{0x5e7d, 6318},
-	{0x5e7e, 4078},
-	{0x5e84, 6543},
-	{0x5e87, 5188},
-	{0x5e8a, 5342},
-	{0x5e8f, 5376},
-	{0x5e95, 6596},
-	{0x5e97, 6694},
-	{0x5e9a, 3670},
-	{0x5e9c, 5123},
-	{0x5ea0, 5343},
-	{0x5ea6, 4279},
-	{0x5ea7, 6857},
-	{0x5eab, 3737},
-	{0x5ead, 6713},
-	{0x5eb5, 5824},
-	{0x5eb6, 5377},
-	{0x5eb7, 3541},
-	{0x5eb8, 6181},
-	{0x5ebe, 6319},
-	{0x5ec2, 5344},
-	{0x5ec8, 7620},
-	{0x5ec9, 4483},
-	{0x5eca, 4412},
-	{0x5ed0, 3909},
-	{0x5ed3, 3815},
-	{0x5ed6, 4554},
-	{0x5eda, 6872},
-	{0x5edb, 6655},
-	{0x5edf, 4803},
-	{0x5ee0, 7097},
-	{0x5ee2, 7537},
-	{0x5ee3, 3843},
-	{0x5eec, 4444},
-	{0x5ef3, 7197},
-	{0x5ef6, 5961},
-	{0x5ef7, 6714},
-	{0x5efa, 3605},
-	{0x5efb, 7930},
-	{0x5f01, 5032},
-	{0x5f04, 4537},
-	{0x5f0a, 7538},
-	{0x5f0f, 5722},
-	{0x5f11, 5701},
-	{0x5f13, 3964},
-	{0x5f14, 6787},
-	{0x5f15, 6451},
-	{0x5f17, 5172},
-	{0x5f18, 7854},
-	{0x5f1b, 6419},
-	{0x5f1f, 6764},
-	{0x5f26, 7736},
-	{0x5f27, 7807},
-	{0x5f29, 4171},
-	{0x5f31, 5872},
-	{0x5f35, 6544},
-	{0x5f3a, 3542},
-	{0x5f3c, 7605},
-	{0x5f48, 7411},
-	{0x5f4a, 3543},
-	{0x5f4c, 4855},
-	{0x5f4e, 4674},
-	{0x5f56, 4198},
-	{0x5f57, 7792},
-	{0x5f59, 7997},
-	{0x5f5b, 6420},
-	{0x5f62, 7775},
-	{0x5f66, 5919},
-	{0x5f67, 6230},
-	{0x5f69, 7118},
-	{0x5f6a, 7578},
-	{0x5f6b, 6788},
-	{0x5f6c, 5225},
-	{0x5f6d, 7513},
-	{0x5f70, 7098},
-	{0x5f71, 6004},
-	{0x5f77, 4947},
-	{0x5f79, 5949},
-	{0x5f7c, 7597},
-	{0x5f7f, 5173},
-	{0x5f80, 6126},
-	{0x5f81, 6715},
-	{0x5f85, 4257},
-	{0x5f87, 5641},
-	{0x5f8a, 7931},
-	{0x5f8b, 4600},
-	{0x5f8c, 7974},
-	{0x5f90, 5378},
-	{0x5f91, 3671},
-	{0x5f92, 4280},
-	{0x5f97, 4364},
-	{0x5f98, 4972},
-	{0x5f99, 5263},
-	{0x5f9e, 6839},
-	{0x5fa0, 4422},
-	{0x5fa1, 5903},
-	{0x5fa8, 7906},
-	{0x5fa9, 5079},
-	{0x5faa, 5642},
-	{0x5fae, 4856},
-	{0x5fb5, 7038},
-	{0x5fb7, 4267},
-	{0x5fb9, 7170},
-	{0x5fbd, 7998},
-	{0x5fc3, 5764},
-	{0x5fc5, 7606},
-	{0x5fcc, 4079},
-	{0x5fcd, 6452},
-	{0x5fd6, 7248},
-	{0x5fd7, 6947},
-	{0x5fd8, 4698},
-	{0x5fd9, 4699},
-	{0x5fe0, 7307},
-	{0x5feb, 7379},
-	{0x5ff5, 4163},
-	{0x5ffd, 7850},
-	{0x5fff, 5158},
-	{0x600f, 5835},
-	{0x6012, 4172},
-	{0x6016, 7552},
-	{0x601c, 4494},
-	{0x601d, 5264},
-	{0x6020, 7434},
-	{0x6021, 6421},
-	{0x6025, 4053},
-	{0x6027, 5477},
-	{0x6028, 6264},
-	{0x602a, 3859},
-	{0x602f, 3625},
-	{0x6041, 6473},
-	{0x6042, 5643},
-	{0x6043, 5702},
-	{0x604d, 7907},
-	{0x6050, 3792},
-	{0x6052, 7675},
-	{0x6055, 5379},
-	{0x6059, 5882},
-	{0x605d, 3836},
-	{0x6062, 7932},
-	{0x6063, 6491},
-	{0x6064, 8010},
-	{0x6065, 7341},
-	{0x6068, 7636},
-	{0x6069, 6374},
-	{0x606a, 3468},
-	{0x606c, 4164},
-	{0x606d, 3793},
-	{0x606f, 5723},
-	{0x6070, 8031},
-	{0x6085, 5985},
-	{0x6089, 5761},
-	{0x608c, 6765},
-	{0x608d, 7637},
-	{0x6094, 7933},
-	{0x6096, 7504},
-	{0x609a, 5554},
-	{0x609b, 6656},
-	{0x609f, 6062},
-	{0x60a0, 6320},
-	{0x60a3, 7887},
-	{0x60a4, 7254},
-	{0x60a7, 4619},
-	{0x60b0, 6840},
-	{0x60b2, 5189},
-	{0x60b3, 4268},
-	{0x60b4, 7312},
-	{0x60b6, 4871},
-	{0x60b8, 3711},
-	{0x60bc, 4281},
-	{0x60bd, 7132},
-	{0x60c5, 6716},
-	{0x60c7, 4320},
-	{0x60d1, 7841},
-	{0x60da, 7851},
-	{0x60dc, 5406},
-	{0x60df, 6321},
-	{0x60e0, 7793},
-	{0x60e1, 5797},
-	{0x60f0, 7385},
-	{0x60f1, 4178},
-	{0x60f3, 5345},
-	{0x60f6, 7908},
-	{0x60f9, 5866},
-	{0x60fa, 5478},
-	{0x60fb, 7333},
-	{0x6101, 5578},
-	{0x6106, 3606},
-	{0x6108, 6322},
-	{0x6109, 6323},
-	{0x610d, 4872},
-	{0x610e, 7517},
-	{0x610f, 6398},
-	{0x6115, 5798},
-	{0x611a, 6207},
-	{0x611b, 5844},
-	{0x611f, 3514},
-	{0x6127, 3860},
-	{0x6130, 7909},
-	{0x6134, 7099},
-	{0x6137, 3565},
-	{0x613c, 5741},
-	{0x613e, 3566},
-	{0x613f, 6265},
-	{0x6142, 6182},
-	{0x6144, 4601},
-	{0x6147, 6375},
-	{0x6148, 6492},
-	{0x614a, 3655},
-	{0x614b, 7435},
-	{0x614c, 7910},
-	{0x6153, 7579},
-	{0x6155, 4769},
-	{0x6158, 7085},
-	{0x6159, 7086},
-	{0x615d, 7471},
-	{0x615f, 7453},
-	{0x6162, 4675},
-	{0x6163, 3822},
-	{0x6164, 3469},
-	{0x6167, 7794},
-	{0x6168, 3567},
-	{0x616b, 6841},
-	{0x616e, 4445},
-	{0x6170, 6292},
-	{0x6176, 3672},
-	{0x6177, 3544},
-	{0x617d, 7137},
-	{0x617e, 6168},
-	{0x6181, 7255},
-	{0x6182, 6208},
-	{0x618a, 5190},
-	{0x618e, 6932},
-	{0x6190, 4465},
-	{0x6191, 5237},
-	{0x6194, 7217},
-	{0x6198, 8044},
-	{0x6199, 8043},
-	{0x619a, 7412},
-	{0x61a4, 5159},
-	{0x61a7, 4336},
-	{0x61a9, 3628},
-	{0x61ab, 4873},
-	{0x61ac, 3673},
-	{0x61ae, 4814},
-	{0x61b2, 7723},
-	{0x61b6, 5913},
-	{0x61ba, 4219},
-	{0x61be, 3515},
-	{0x61c3, 4026},
-	{0x61c7, 3483},
-	{0x61c8, 7692},
-	{0x61c9, 6391},
-	{0x61ca, 6063},
-	{0x61cb, 4815},
-	{0x61e6, 4135},
-	{0x61f2, 7039},
-	{0x61f6, 4375},
-	{0x61f7, 7934},
-	{0x61f8, 7737},
-	{0x61fa, 7087},
-	{0x61fc, 3910},
-	{0x61ff, 6399},
-	{0x6200, 4466},
-	{0x6207, 4243},
-	{0x6208, 3804},
-	{0x620a, 4816},
-	{0x620c, 5667},
-	{0x620d, 5579},
-	{0x620e, 6369},
-	{0x6210, 5479},
-	{0x6211, 5781},
-	{0x6212, 3712},
-	{0x6216, 7842},
-	{0x621a, 7138},
-	{0x621f, 4019},
-	{0x6221, 3516},
-	{0x622a, 6685},
-	{0x622e, 4592},
-	{0x6230, 6657},
-	{0x6231, 8045},
-	{0x6234, 4258},
-	{0x6236, 7808},
-	{0x623e, 4446},
-	{0x623f, 4948},
-	{0x6240, 5507},
-	{0x6241, 7520},
-	{0x6247, 5424},
-	{0x6248, 7809},
-	{0x6249, 5191},
-	{0x624b, 5580},
-	{0x624d, 6574},
-	{0x6253, 7386},
-	{0x6258, 7398},
-	{0x626e, 5160},
-	{0x6271, 4054},
-	{0x6276, 5124},
-	{0x6279, 5192},
-	{0x627c, 5852},
-	{0x627f, 5687},
-	{0x6280, 4080},
-	{0x6284, 7218},
-	{0x6289, 3648},
-	{0x628a, 7477},
-	{0x6291, 5914},
-	{0x6292, 5380},
-	{0x6295, 7468},
-	{0x6297, 7676},
-	{0x6298, 6686},
-	{0x629b, 7553},
-	{0x62ab, 7598},
-	{0x62b1, 7554},
-	{0x62b5, 6597},
-	{0x62b9, 4690},
-	{0x62bc, 5830},
-	{0x62bd, 7266},
-	{0x62c2, 5174},
-	{0x62c7, 4817},
-	{0x62c8, 4165},
-	{0x62c9, 4409},
-	{0x62cc, 4909},
-	{0x62cd, 4888},
-	{0x62cf, 4136},
-	{0x62d0, 3861},
-	{0x62d2, 3589},
-	{0x62d3, 7139},
-	{0x62d4, 4931},
-	{0x62d6, 7387},
-	{0x62d7, 6148},
-	{0x62d8, 3911},
-	{0x62d9, 6835},
-	{0x62db, 7219},
-	{0x62dc, 4973},
-	{0x62ec, 3837},
-	{0x62ed, 5724},
-	{0x62ee, 4129},
-	{0x62ef, 6934},
-	{0x62f1, 3794},
-	{0x62f3, 3974},
-	{0x62f7, 3738},
-	{0x62fe, 5678},
-	{0x62ff, 4137},
-	{0x6301, 6948},
-	{0x6307, 6949},
-	{0x6309, 5809},
-	{0x6311, 4282},
-	{0x632b, 6858},
-	{0x632f, 6983},
-	{0x633a, 6717},
-	{0x633b, 5963},
-	{0x633d, 4676},
-	{0x633e, 7763},
-	{0x6349, 7055},
-	{0x634c, 7501},
-	{0x634f, 4143},
-	{0x6350, 5962},
-	{0x6355, 7555},
-	{0x6367, 5098},
-	{0x6368, 5265},
-	{0x636e, 3590},
-	{0x6372, 3975},
-	{0x6377, 7190},
-	{0x637a, 4144},
-	{0x637b, 4166},
-	{0x637f, 5381},
-	{0x6383, 5508},
-	{0x6388, 5581},
-	{0x6389, 4283},
-	{0x638c, 6545},
-	{0x6392, 4974},
-	{0x6396, 5853},
-	{0x6398, 3961},
-	{0x639b, 3853},
-	{0x63a0, 4425},
-	{0x63a1, 7119},
-	{0x63a2, 7420},
-	{0x63a5, 6701},
-	{0x63a7, 3795},
-	{0x63a8, 7267},
-	{0x63a9, 5929},
-	{0x63aa, 6789},
-	{0x63c0, 3484},
-	{0x63c4, 6324},
-	{0x63c6, 3997},
-	{0x63cf, 4804},
-	{0x63d0, 6766},
-	{0x63d6, 6387},
-	{0x63da, 5883},
-	{0x63db, 7888},
-	{0x63e1, 5799},
-	{0x63ed, 3629},
-	{0x63ee, 7999},
-	{0x63f4, 6266},
-	{0x63f6, 5867},
-	{0x63f7, 5327},
-	{0x640d, 5548},
-	{0x640f, 4889},
-	{0x6414, 5509},
-	{0x6416, 6149},
-	{0x6417, 4284},
-	{0x641c, 5582},
-	{0x6422, 6984},
-	{0x642c, 4910},
-	{0x642d, 7425},
-	{0x643a, 8006},
-	{0x643e, 7056},
-	{0x6458, 6623},
-	{0x6460, 7256},
-	{0x6469, 4656},
-	{0x646f, 6950},
-	{0x6478, 4770},
-	{0x6479, 4771},
-	{0x647a, 6702},
-	{0x6488, 4512},
-	{0x6491, 7447},
-	{0x6492, 5316},
-	{0x6493, 6150},
-	{0x649a, 4161},
-	{0x649e, 4244},
-	{0x64a4, 7171},
-	{0x64a5, 4932},
-	{0x64ab, 4818},
-	{0x64ad, 7478},
-	{0x64ae, 7261},
-	{0x64b0, 7062},
-	{0x64b2, 4890},
-	{0x64bb, 4212},
-	{0x64c1, 6091},
-	{0x64c4, 4513},
-	{0x64c5, 7153},
-	{0x64c7, 7445},
-	{0x64ca, 3630},
-	{0x64cd, 6790},
-	{0x64ce, 3674},
-	{0x64d2, 4040},
-	{0x64d4, 4220},
-	{0x64d8, 5023},
-	{0x64da, 3591},
-	{0x64e1, 4259},
-	{0x64e2, 7399},
-	{0x64e5, 4400},
-	{0x64e6, 7079},
-	{0x64e7, 3592},
-	{0x64ec, 6400},
-	{0x64f2, 7140},
-	{0x64f4, 7877},
-	{0x64fa, 7479},
-	{0x64fe, 6151},
-	{0x6500, 4911},
-	{0x6504, 7448},
-	{0x6518, 5884},
-	{0x651d, 5471},
-	{0x6523, 4467},
-	{0x652a, 3875},
-	{0x652b, 7878},
-	{0x652c, 4401},
-	{0x652f, 6951},
-	{0x6536, 5583},
-	{0x6537, 3739},
-	{0x6538, 6325},
-	{0x6539, 3568},
-	{0x653b, 3796},
-	{0x653e, 4949},
-	{0x653f, 6718},
-	{0x6545, 3740},
-	{0x6548, 7956},
-	{0x654d, 5382},
-	{0x654e, 3876},
-	{0x654f, 4874},
-	{0x6551, 3912},
-	{0x6556, 6064},
-	{0x6557, 7505},
-	{0x655e, 7100},
-	{0x6562, 3517},
-	{0x6563, 5306},
-	{0x6566, 4321},
-	{0x656c, 3675},
-	{0x656d, 5885},
-	{0x6572, 3741},
-	{0x6574, 6719},
-	{0x6575, 6624},
-	{0x6577, 5125},
-	{0x6578, 5584},
-	{0x657e, 5425},
-	{0x6582, 4484},
-	{0x6583, 7539},
-	{0x6585, 7957},
-	{0x6587, 4840},
-	{0x658c, 5226},
-	{0x6590, 5193},
-	{0x6591, 4912},
-	{0x6597, 4349},
-	{0x6599, 4555},
-	{0x659b, 3768},
-	{0x659c, 5266},
-	{0x659f, 7030},
-	{0x65a1, 5817},
-	{0x65a4, 4027},
-	{0x65a5, 7141},
-	{0x65a7, 5126},
-	{0x65ab, 6512},
-	{0x65ac, 7088},
-	{0x65af, 5267},
-	{0x65b0, 5742},
-	{0x65b7, 4199},
-	{0x65b9, 4950},
-	{0x65bc, 5904},
-	{0x65bd, 5703},
-	{0x65c1, 4951},
-	{0x65c5, 4447},
-	{0x65cb, 5426},
-	{0x65cc, 6720},
-	{0x65cf, 6828},
-	{0x65d2, 4578},
-	{0x65d7, 4081},
-	{0x65e0, 4819},
-	{0x65e3, 4082},
-	{0x65e5, 6464},
-	{0x65e6, 4200},
-	{0x65e8, 6952},
-	{0x65e9, 6791},
-	{0x65ec, 5644},
-	{0x65ed, 6231},
-	{0x65f1, 7638},
-	{0x65f4, 6209},
-	{0x65fa, 6127},
-	{0x65fb, 4875},
-	{0x65fc, 4876},
-	{0x65fd, 4322},
-	{0x65ff, 6065},
-	{0x6606, 3777},
-	{0x6607, 5688},
-	{0x6609, 4952},
-	{0x660a, 7810},
-	{0x660c, 7101},
-	{0x660e, 4751},
-	{0x660f, 7845},
-	{0x6610, 5161},
-	{0x6611, 4041},
-	{0x6613, 5950},
-	{0x6614, 5407},
-	{0x6615, 8019},
-	{0x661e, 5046},
-	{0x661f, 5480},
-	{0x6620, 6005},
-	{0x6625, 7300},
-	{0x6627, 4712},
-	{0x6628, 6513},
-	{0x662d, 5510},
-	{0x662f, 5704},
-	{0x6630, 7621},
-	{0x6631, 6232},
-	{0x6634, 4805},
-	{0x6636, 7102},
-	{0x663a, 5047},
-	{0x663b, 5836},
-	{0x6641, 6792},
-	{0x6642, 5705},
-	{0x6643, 7911},
-	{0x6644, 7912},
-	{0x6649, 6985},
-	{0x664b, 6986},
-	{0x664f, 5810},
-	{0x6659, 6908},
-	{0x665b, 7738},
-	{0x665d, 6873},
-	{0x665e, 8046},
-	{0x665f, 5481},
-	{0x6664, 6066},
-	{0x6665, 7890},
-	{0x6666, 7935},
-	{0x6667, 7811},
-	{0x6668, 5743},
-	{0x6669, 4677},
-	{0x666b, 7400},
-	{0x666e, 5062},
-	{0x666f, 3676},
-	{0x6673, 5408},
-	{0x6674, 7198},
-	{0x6676, 6721},
-	{0x6677, 3990},
-	{0x6678, 6722},
-	{0x667a, 6953},
-	{0x6684, 7991},
-	{0x6687, 3447},
-	{0x6688, 7988},
-	{0x6689, 8000},
-	{0x668e, 6006},
-	{0x6690, 6293},
-	{0x6691, 5383},
-	{0x6696, 4140},
-	{0x6697, 5825},
-	{0x6698, 5886},
-	{0x669d, 4752},
-	{0x66a0, 3742},
-	{0x66a2, 7103},
-	{0x66ab, 6528},
-	{0x66ae, 4772},
-	{0x66b2, 6546},
-	{0x66b3, 7795},
-	{0x66b4, 7572},
-	{0x66b9, 5464},
-	{0x66bb, 3677},
-	{0x66be, 4323},
-	{0x66c4, 5999},
-	{0x66c6, 4459},
-	{0x66c7, 4221},
-	{0x66c9, 7958},
-	{0x66d6, 5845},
-	{0x66d9, 5384},
-	{0x66dc, 6152},
-	{0x66dd, 7573},
-	{0x66e0, 3844},
-	{0x66e6, 8047},
-	{0x66f0, 6125},
-	{0x66f2, 3769},
-	{0x66f3, 6033},
-	{0x66f4, 3678},
-	{0x66f7, 3502},
-	{0x66f8, 5385},
-	{0x66f9, 6794},
-	{0x66fa, 6793},
-	{0x66fc, 4678},
-	{0x66fe, 6933},
-	{0x66ff, 7206},
-	{0x6700, 7264},
-	{0x6703, 7936},
-	{0x6708, 6281},
-	{0x6709, 6326},
-	{0x670b, 5176},
-	{0x670d, 5080},
-	{0x6714, 5302},
-	{0x6715, 7031},
-	{0x6717, 4413},
-	{0x671b, 4700},
-	{0x671d, 6795},
-	{0x671e, 4083},
-	{0x671f, 4084},
-	{0x6726, 4798},
-	{0x6727, 4538},
-	{0x6728, 4788},
-	{0x672a, 4857},
-	{0x672b, 4691},
-	{0x672c, 5091},
-	{0x672d, 7080},
-	{0x672e, 7304},
-	{0x6731, 6874},
-	{0x6734, 4891},
-	{0x6736, 7388},
-	{0x673a, 3984},
-	{0x673d, 7975},
-	{0x6746, 3485},
-	{0x6749, 5321},
-	{0x674e, 4620},
-	{0x674f, 7707},
-	{0x6750, 6575},
-	{0x6751, 7249},
-	{0x6753, 7580},
-	{0x6756, 6547},
-	{0x675c, 4350},
-	{0x675e, 4085},
-	{0x675f, 5539},
-	{0x676d, 7677},
-	{0x676f, 4975},
-	{0x6770, 3615},
-	{0x6771, 4337},
-	{0x6773, 4806},
-	{0x6775, 6598},
-	{0x6777, 7480},
-	{0x677b, 4183},
-	{0x677e, 5555},
-	{0x677f, 7492},
-	{0x6787, 5194},
-	{0x6789, 6128},
-	{0x678b, 4953},
-	{0x678f, 4146},
-	{0x6790, 5409},
-	{0x6793, 4351},
-	{0x6795, 7369},
-	{0x6797, 4647},
-	{0x679a, 4713},
-	{0x679c, 3805},
-	{0x679d, 6954},
-	{0x67af, 3743},
-	{0x67b0, 7531},
-	{0x67b3, 6955},
-	{0x67b6, 3448},
-	{0x67b7, 3449},
-	{0x67b8, 3913},
-	{0x67be, 5706},
-	{0x67c4, 5048},
-	{0x67cf, 4991},
-	{0x67d0, 4773},
-	{0x67d1, 3518},
-	{0x67d2, 7365},
-	{0x67d3, 5990},
-	{0x67d4, 6327},
-	{0x67da, 6328},
-	{0x67dd, 7401},
-	{0x67e9, 3914},
-	{0x67ec, 3486},
-	{0x67ef, 3450},
-	{0x67f0, 4157},
-	{0x67f1, 6875},
-	{0x67f3, 4579},
-	{0x67f4, 5707},
-	{0x67f5, 7127},
-	{0x67f6, 5268},
-	{0x67fb, 5269},
-	{0x67fe, 6723},
-	{0x6812, 5645},
-	{0x6813, 6658},
-	{0x6816, 5386},
-	{0x6817, 4602},
-	{0x6821, 3877},
-	{0x6822, 4992},
-	{0x682a, 6876},
-	{0x682f, 6233},
-	{0x6838, 7704},
-	{0x6839, 4028},
-	{0x683c, 3631},
-	{0x683d, 6576},
-	{0x6840, 3616},
-	{0x6841, 7678},
-	{0x6842, 3713},
-	{0x6843, 4285},
-	{0x6848, 5811},
-	{0x684e, 7020},
-	{0x6850, 4338},
-	{0x6851, 5346},
-	{0x6853, 7891},
-	{0x6854, 4130},
-	{0x686d, 6987},
-	{0x6876, 7454},
-	{0x687f, 3487},
-	{0x6881, 4431},
-	{0x6885, 4714},
-	{0x688f, 3770},
-	{0x6893, 6577},
-	{0x6894, 7342},
-	{0x6897, 3679},
-	{0x689d, 6796},
-	{0x689f, 7959},
-	{0x68a1, 6110},
-	{0x68a2, 7220},
-	{0x68a7, 6067},
-	{0x68a8, 4621},
-	{0x68ad, 5270},
-	{0x68af, 6767},
-	{0x68b0, 3714},
-	{0x68b1, 3778},
-	{0x68b3, 5511},
-	{0x68b5, 5011},
-	{0x68b6, 4858},
-	{0x68c4, 4087},
-	{0x68c5, 5049},
-	{0x68c9, 4738},
-	{0x68cb, 4086},
-	{0x68cd, 3779},
-	{0x68d2, 5099},
-	{0x68d5, 6842},
-	{0x68d7, 6797},
-	{0x68d8, 4020},
-	{0x68da, 5177},
-	{0x68df, 4339},
-	{0x68e0, 4245},
-	{0x68e7, 6523},
-	{0x68e8, 3715},
-	{0x68ee, 5322},
-	{0x68f2, 5387},
-	{0x68f9, 4286},
-	{0x68fa, 3823},
-	{0x6900, 6111},
-	{0x6905, 6401},
-	{0x690d, 5725},
-	{0x690e, 7268},
-	{0x6912, 7221},
-	{0x6927, 4753},
-	{0x6930, 5868},
-	{0x693d, 5964},
-	{0x693f, 7301},
-	{0x694a, 5887},
-	{0x6953, 7592},
-	{0x6954, 5452},
-	{0x6955, 7389},
-	{0x6957, 3607},
-	{0x6959, 4820},
-	{0x695a, 7222},
-	{0x695e, 4608},
-	{0x6960, 4147},
-	{0x6961, 6329},
-	{0x6962, 6330},
-	{0x6963, 4859},
-	{0x6968, 6724},
-	{0x696b, 6928},
-	{0x696d, 5932},
-	{0x696e, 6599},
-	{0x696f, 5646},
-	{0x6975, 4021},
-	{0x6977, 7693},
-	{0x6978, 7269},
-	{0x6979, 6007},
-	{0x6995, 6183},
-	{0x699b, 6988},
-	{0x699c, 4954},
-	{0x69a5, 7913},
-	{0x69a7, 5195},
-	{0x69ae, 6008},
-	{0x69b4, 4580},
-	{0x69bb, 7426},
-	{0x69c1, 3744},
-	{0x69c3, 4913},
-	{0x69cb, 3915},
-	{0x69cc, 7460},
-	{0x69cd, 7104},
-	{0x69d0, 3862},
-	{0x69e8, 3816},
-	{0x69ea, 3569},
-	{0x69fb, 3998},
-	{0x69fd, 6798},
-	{0x69ff, 4029},
-	{0x6a02, 5800},
-	{0x6a0a, 4997},
-	{0x6a11, 4432},
-	{0x6a13, 4567},
-	{0x6a17, 6600},
-	{0x6a19, 7581},
-	{0x6a1e, 7270},
-	{0x6a1f, 6548},
-	{0x6a21, 4774},
-	{0x6a23, 5888},
-	{0x6a35, 7223},
-	{0x6a38, 4892},
-	{0x6a39, 5585},
-	{0x6a3a, 7866},
-	{0x6a3d, 6909},
-	{0x6a44, 3519},
-	{0x6a48, 6153},
-	{0x6a4b, 3878},
-	{0x6a52, 6239},
-	{0x6a53, 5647},
-	{0x6a58, 4015},
-	{0x6a59, 4366},
-	{0x6a5f, 4088},
-	{0x6a61, 5347},
-	{0x6a6b, 7951},
-	{0x6a80, 4201},
-	{0x6a84, 3632},
-	{0x6a89, 6725},
-	{0x6a8d, 5915},
-	{0x6a8e, 4042},
-	{0x6a97, 5024},
-	{0x6a9c, 7937},
-	{0x6aa2, 3620},
-	{0x6aa3, 6549},
-	{0x6ab3, 5227},
-	{0x6abb, 7656},
-	{0x6ac2, 4287},
-	{0x6ac3, 3985},
-	{0x6ad3, 4514},
-	{0x6ada, 4448},
-	{0x6adb, 6927},
-	{0x6af6, 7724},
-	{0x6afb, 5858},
-	{0x6b04, 4391},
-	{0x6b0a, 3976},
-	{0x6b0c, 6550},
-	{0x6b12, 4392},
-	{0x6b16, 4402},
-	{0x6b20, 8027},
-	{0x6b21, 7048},
-	{0x6b23, 8020},
-	{0x6b32, 6169},
-	{0x6b3a, 4089},
-	{0x6b3d, 8028},
-	{0x6b3e, 3824},
-	{0x6b46, 8029},
-	{0x6b47, 7727},
-	{0x6b4c, 3451},
-	{0x6b4e, 7413},
-	{0x6b50, 3916},
-	{0x6b5f, 5937},
-	{0x6b61, 7889},
-	{0x6b62, 6956},
-	{0x6b63, 6726},
-	{0x6b64, 7049},
-	{0x6b65, 5063},
-	{0x6b66, 4821},
-	{0x6b6a, 6133},
-	{0x6b72, 5494},
-	{0x6b77, 4460},
-	{0x6b78, 3991},
-	{0x6b7b, 5271},
-	{0x6b7f, 4795},
-	{0x6b83, 5837},
-	{0x6b84, 6989},
-	{0x6b86, 7436},
-	{0x6b89, 5648},
-	{0x6b8a, 5586},
-	{0x6b96, 5726},
-	{0x6b98, 6524},
-	{0x6b9e, 6240},
-	{0x6bae, 4485},
-	{0x6baf, 5228},
-	{0x6bb2, 5465},
-	{0x6bb5, 4202},
-	{0x6bb7, 6376},
-	{0x6bba, 5317},
-	{0x6bbc, 3470},
-	{0x6bbf, 6659},
-	{0x6bc1, 7996},
-	{0x6bc5, 6402},
-	{0x6bc6, 3917},
-	{0x6bcb, 4822},
-	{0x6bcd, 4775},
-	{0x6bcf, 4715},
-	{0x6bd2, 4309},
-	{0x6bd3, 6356},
-	{0x6bd4, 5196},
-	{0x6bd6, 5197},
-	{0x6bd7, 5198},
-	{0x6bd8, 5199},
-	{0x6bdb, 4776},
-	{0x6beb, 7812},
-	{0x6bec, 3918},
-	{0x6c08, 6660},
-	{0x6c0f, 5774},
-	{0x6c11, 4877},
-	{0x6c13, 4728},
-	{0x6c23, 4090},
-	{0x6c34, 5587},
-	{0x6c37, 5238},
-	{0x6c38, 6009},
-	{0x6c3e, 5012},
-	{0x6c40, 6727},
-	{0x6c41, 6929},
-	{0x6c42, 3919},
-	{0x6c4e, 5013},
-	{0x6c50, 5410},
-	{0x6c55, 5307},
-	{0x6c57, 7639},
-	{0x6c5a, 6068},
-	{0x6c5d, 5938},
-	{0x6c5e, 7855},
-	{0x6c5f, 3545},
-	{0x6c60, 6957},
-	{0x6c68, 3784},
-	{0x6c6a, 6129},
-	{0x6c6d, 6034},
-	{0x6c70, 7437},
-	{0x6c72, 4055},
-	{0x6c76, 4841},
-	{0x6c7a, 3649},
-	{0x6c7d, 4091},
-	{0x6c7e, 5162},
-	{0x6c81, 5765},
-	{0x6c82, 4092},
-	{0x6c83, 6079},
-	{0x6c85, 6267},
-	{0x6c86, 7679},
-	{0x6c87, 5965},
-	{0x6c88, 7370},
-	{0x6c8c, 4324},
-	{0x6c90, 4789},
-	{0x6c92, 4796},
-	{0x6c93, 4234},
-	{0x6c94, 4739},
-	{0x6c95, 4849},
-	{0x6c96, 7308},
-	{0x6c99, 5272},
-	{0x6c9a, 6958},
-	{0x6c9b, 7506},
-	{0x6cab, 4692},
-	{0x6cae, 6601},
-	{0x6cb3, 7622},
-	{0x6cb8, 5200},
-	{0x6cb9, 6331},
-	{0x6cbb, 7343},
-	{0x6cbc, 5512},
-	{0x6cbd, 3745},
-	{0x6cbe, 7179},
-	{0x6cbf, 5966},
-	{0x6cc1, 7914},
-	{0x6cc2, 7776},
-	{0x6cc4, 5453},
-	{0x6cc9, 7154},
-	{0x6cca, 4893},
-	{0x6ccc, 7607},
-	{0x6cd3, 7856},
-	{0x6cd5, 5018},
-	{0x6cd7, 5273},
-	{0x6cdb, 5014},
-	{0x6ce1, 7556},
-	{0x6ce2, 7481},
-	{0x6ce3, 6388},
-	{0x6ce5, 4187},
-	{0x6ce8, 6877},
-	{0x6ceb, 7739},
-	{0x6cee, 4914},
-	{0x6cef, 4878},
-	{0x6cf0, 7438},
-	{0x6cf3, 6010},
-	{0x6d0b, 5889},
-	{0x6d0c, 4480},
-	{0x6d11, 5064},
-	{0x6d17, 5495},
-	{0x6d19, 5588},
-	{0x6d1b, 4382},
-	{0x6d1e, 4340},
-	{0x6d25, 6990},
-	{0x6d27, 6332},
-	{0x6d29, 5454},
-	{0x6d2a, 7857},
-	{0x6d32, 6878},
-	{0x6d35, 5649},
-	{0x6d36, 8016},
-	{0x6d38, 3845},
-	{0x6d39, 6268},
-	{0x6d3b, 7899},
-	{0x6d3d, 8032},
-	{0x6d3e, 7482},
-	{0x6d41, 4581},
-	{0x6d59, 6687},
-	{0x6d5a, 6910},
-	{0x6d5c, 5229},
-	{0x6d63, 6112},
-	{0x6d66, 7557},
-	{0x6d69, 7813},
-	{0x6d6a, 4414},
-	{0x6d6c, 4622},
-	{0x6d6e, 5127},
-	{0x6d74, 6170},
-	{0x6d77, 7694},
-	{0x6d78, 7371},
-	{0x6d79, 7764},
-	{0x6d7f, 7507},
-	{0x6d85, 5986},
-	{0x6d87, 3680},
-	{0x6d88, 5513},
-	{0x6d89, 5472},
-	{0x6d8c, 6184},
-	{0x6d8d, 7960},
-	{0x6d8e, 5967},
-	{0x6d91, 5540},
-	{0x6d93, 5968},
-	{0x6d95, 7207},
-	{0x6daf, 5846},
-	{0x6db2, 5854},
-	{0x6db5, 7657},
-	{0x6dc0, 6728},
-	{0x6dc3, 3977},
-	{0x6dc4, 7344},
-	{0x6dc5, 5411},
-	{0x6dc6, 7961},
-	{0x6dc7, 4093},
-	{0x6dcb, 4648},
-	{0x6dcf, 7814},
-	{0x6dd1, 5633},
-	{0x6dd8, 4288},
-	{0x6dd9, 6843},
-	{0x6dda, 4568},
-	{0x6dde, 5556},
-	{0x6de1, 4222},
-	{0x6de8, 6729},
-	{0x6dea, 4597},
-	{0x6deb, 6382},
-	{0x6dee, 7938},
-	{0x6df1, 5766},
-	{0x6df3, 5650},
-	{0x6df5, 5969},
-	{0x6df7, 7846},
-	{0x6df8, 7199},
-	{0x6df9, 5930},
-	{0x6dfa, 7155},
-	{0x6dfb, 7180},
-	{0x6e17, 5323},
-	{0x6e19, 7892},
-	{0x6e1a, 6602},
-	{0x6e1b, 3520},
-	{0x6e1f, 6730},
-	{0x6e20, 3593},
-	{0x6e21, 4289},
-	{0x6e23, 5274},
-	{0x6e24, 4933},
-	{0x6e25, 5801},
-	{0x6e26, 6099},
-	{0x6e2b, 5455},
-	{0x6e2c, 7334},
-	{0x6e2d, 6294},
-	{0x6e2f, 7680},
-	{0x6e32, 5427},
-	{0x6e34, 3503},
-	{0x6e36, 6011},
-	{0x6e38, 6333},
-	{0x6e3a, 4807},
-	{0x6e3c, 4860},
-	{0x6e3d, 6578},
-	{0x6e3e, 7847},
-	{0x6e43, 4976},
-	{0x6e44, 4861},
-	{0x6e4a, 6879},
-	{0x6e4d, 4203},
-	{0x6e56, 7815},
-	{0x6e58, 5348},
-	{0x6e5b, 4223},
-	{0x6e5c, 5727},
-	{0x6e5e, 6731},
-	{0x6e5f, 7915},
-	{0x6e67, 6185},
-	{0x6e6b, 7271},
-	{0x6e6e, 6453},
-	{0x6e6f, 7429},
-	{0x6e72, 6269},
-	{0x6e73, 4148},
-	{0x6e7a, 5065},
-	{0x6e90, 6270},
-	{0x6e96, 6911},
-	{0x6e9c, 4582},
-	{0x6e9d, 3920},
-	{0x6e9f, 4754},
-	{0x6ea2, 6465},
-	{0x6ea5, 5128},
-	{0x6eaa, 3716},
-	{0x6eab, 6083},
-	{0x6eaf, 5514},
-	{0x6eb1, 6991},
-	{0x6eb6, 6186},
-	{0x6eba, 4189},
-	{0x6ec2, 4955},
-	{0x6ec4, 7105},
-	{0x6ec5, 4746},
-	{0x6ec9, 7916},
-	{0x6ecb, 6493},
-	{0x6ecc, 7142},
-	{0x6ece, 7777},
-	{0x6ed1, 7900},
-	{0x6ed3, 6579},
-	{0x6ed4, 4290},
-	{0x6eef, 7208},
-	{0x6ef4, 6625},
-	{0x6ef8, 7816},
-	{0x6efe, 3780},
-	{0x6eff, 4679},
-	{0x6f01, 5905},
-	{0x6f02, 7582},
-	{0x6f06, 7366},
-	{0x6f0f, 4569},
-	{0x6f11, 3570},
-	{0x6f14, 5970},
-	{0x6f15, 6799},
-	{0x6f20, 4666},
-	{0x6f22, 7640},
-	{0x6f23, 4468},
-	{0x6f2b, 4680},
-	{0x6f2c, 6959},
-	{0x6f31, 5589},
-	{0x6f32, 7106},
-	{0x6f38, 6695},
-	{0x6f3f, 6551},
-	{0x6f41, 6012},
-	{0x6f51, 4934},
-	{0x6f54, 3650},
-	{0x6f57, 7033},
-	{0x6f58, 4915},
-	{0x6f5a, 5634},
-	{0x6f5b, 6529},
-	{0x6f5e, 4515},
-	{0x6f5f, 5412},
-	{0x6f62, 7917},
-	{0x6f64, 6362},
-	{0x6f6d, 4224},
-	{0x6f6e, 6800},
-	{0x6f70, 3986},
-	{0x6f7a, 6525},
-	{0x6f7c, 4341},
-	{0x6f7d, 5066},
-	{0x6f7e, 4639},
-	{0x6f81, 5328},
-	{0x6f84, 7040},
-	{0x6f88, 7172},
-	{0x6f8d, 6880},
-	{0x6f8e, 7514},
-	{0x6f90, 6241},
-	{0x6f94, 7817},
-	{0x6f97, 3488},
-	{0x6fa3, 7641},
-	{0x6fa4, 7446},
-	{0x6fa7, 4507},
-	{0x6fae, 7939},
-	{0x6faf, 7063},
-	{0x6fb1, 6661},
-	{0x6fb3, 6069},
-	{0x6fb9, 4225},
-	{0x6fbe, 4213},
-	{0x6fc0, 3633},
-	{0x6fc1, 7402},
-	{0x6fc2, 4486},
-	{0x6fc3, 4175},
-	{0x6fca, 6035},
-	{0x6fd5, 5677},
-	{0x6fda, 6013},
-	{0x6fdf, 6768},
-	{0x6fe0, 7818},
-	{0x6fe1, 6334},
-	{0x6fe4, 4291},
-	{0x6fe9, 7819},
-	{0x6feb, 4403},
-	{0x6fec, 6912},
-	{0x6fef, 7403},
-	{0x6ff1, 5230},
-	{0x6ffe, 4449},
-	{0x7001, 5890},
-	{0x7005, 7778},
-	{0x7006, 4310},
-	{0x7009, 5275},
-	{0x700b, 5767},
-	{0x700f, 4583},
-	{0x7011, 7574},
-	{0x7015, 5231},
-	{0x7018, 4516},
-	{0x701a, 7642},
-	{0x701b, 6014},
-	{0x701c, 6370},
-	{0x701d, 4461},
-	{0x701e, 6732},
-	{0x701f, 5515},
-	{0x7023, 7695},
-	{0x7027, 4539},
-	{0x7028, 4544},
-	{0x702f, 6015},
-	{0x7037, 6437},
-	{0x703e, 4393},
-	{0x704c, 3825},
-	{0x7050, 7779},
-	{0x7051, 5562},
-	{0x7058, 7414},
-	{0x705d, 7820},
-	{0x7063, 4681},
-	{0x706b, 7867},
-	{0x7070, 7940},
-	{0x7078, 3921},
-	{0x707c, 6514},
-	{0x707d, 6580},
-	{0x7085, 3681},
-	{0x708a, 7321},
-	{0x708e, 5991},
-	{0x7092, 7224},
-	{0x7098, 8021},
-	{0x7099, 6494},
-	{0x709a, 3846},
-	{0x70a1, 6733},
-	{0x70a4, 5516},
-	{0x70ab, 7740},
-	{0x70ac, 3594},
-	{0x70ad, 7415},
-	{0x70af, 7780},
-	{0x70b3, 5050},
-	{0x70b7, 6881},
-	{0x70b8, 6515},
-	{0x70b9, 6696},
-	{0x70c8, 4481},
-	{0x70cb, 8007},
-	{0x70cf, 6070},
-	{0x70d8, 7858},
-	{0x70d9, 4383},
-	{0x70dd, 6935},
-	{0x70df, 5971},
-	{0x70f1, 3682},
-	{0x70f9, 7515},
-	{0x70fd, 5100},
-	{0x7104, 7983},
-	{0x7109, 5920},
-	{0x710c, 6913},
-	{0x7119, 4977},
-	{0x711a, 5163},
-	{0x711e, 4325},
-	{0x7121, 4823},
-	{0x7126, 7225},
-	{0x7130, 5992},
-	{0x7136, 5972},
-	{0x7147, 8001},
-	{0x7149, 4469},
-	{0x714a, 7992},
-	{0x714c, 7918},
-	{0x714e, 6662},
-	{0x7150, 6016},
-	{0x7156, 4141},
-	{0x7159, 5973},
-	{0x715c, 6234},
-	{0x715e, 5318},
-	{0x7164, 4716},
-	{0x7165, 7893},
-	{0x7166, 7976},
-	{0x7167, 6801},
-	{0x7169, 4998},
-	{0x716c, 5891},
-	{0x716e, 6495},
-	{0x717d, 5428},
-	{0x7184, 5728},
-	{0x7189, 6242},
-	{0x718a, 6253},
-	{0x718f, 7984},
-	{0x7192, 7781},
-	{0x7194, 6187},
-	{0x7199, 8048},
-	{0x719f, 5635},
-	{0x71a2, 5101},
-	{0x71ac, 6071},
-	{0x71b1, 5987},
-	{0x71b9, 8049},
-	{0x71ba, 8050},
-	{0x71be, 7345},
-	{0x71c1, 6000},
-	{0x71c3, 5974},
-	{0x71c8, 4367},
-	{0x71c9, 4326},
-	{0x71ce, 4556},
-	{0x71d0, 4640},
-	{0x71d2, 5517},
-	{0x71d4, 4999},
-	{0x71d5, 5975},
-	{0x71df, 6017},
-	{0x71e5, 6802},
-	{0x71e6, 7064},
-	{0x71e7, 5590},
-	{0x71ed, 7243},
-	{0x71ee, 5473},
-	{0x71fb, 7985},
-	{0x71fc, 5744},
-	{0x71fe, 4292},
-	{0x71ff, 6154},
-	{0x7200, 7731},
-	{0x7206, 7575},
-	{0x7210, 4517},
-	{0x721b, 4394},
-	{0x722a, 6803},
-	{0x722c, 7483},
-	{0x722d, 6587},
-	{0x7230, 6271},
-	{0x7232, 6295},
-	{0x7235, 6516},
-	{0x7236, 5129},
-	{0x723a, 5869},
-	{0x723b, 7962},
-	{0x723d, 5349},
-	{0x723e, 6422},
-	{0x7240, 5350},
-	{0x7246, 6552},
-	{0x7247, 7521},
-	{0x7248, 7493},
-	{0x724c, 7508},
-	{0x7252, 7191},
-	{0x7258, 4311},
-	{0x7259, 5782},
-	{0x725b, 6210},
-	{0x725d, 5232},
-	{0x725f, 4777},
-	{0x7261, 4778},
-	{0x7262, 4545},
-	{0x7267, 4790},
-	{0x7269, 4850},
-	{0x7272, 5369},
-	{0x7279, 7472},
-	{0x727d, 3638},
-	{0x7280, 5388},
-	{0x7281, 4623},
-	{0x72a2, 4312},
-	{0x72a7, 8051},
-	{0x72ac, 3639},
-	{0x72af, 5015},
-	{0x72c0, 5351},
-	{0x72c2, 3847},
-	{0x72c4, 6626},
-	{0x72ce, 5831},
-	{0x72d0, 7821},
-	{0x72d7, 3922},
-	{0x72d9, 6603},
-	{0x72e1, 3879},
-	{0x72e9, 5591},
-	{0x72f8, 4624},
-	{0x72f9, 7765},
-	{0x72fc, 4415},
-	{0x72fd, 7509},
-	{0x730a, 6036},
-	{0x7316, 7107},
-	{0x731b, 4729},
-	{0x731c, 5708},
-	{0x731d, 6836},
-	{0x7325, 6138},
-	{0x7329, 5482},
-	{0x732a, 6604},
-	{0x732b, 4808},
-	{0x7336, 6335},
-	{0x7337, 6336},
-	{0x733e, 7901},
-	{0x733f, 6272},
-	{0x7344, 6080},
-	{0x7345, 5276},
-	{0x7350, 6553},
-	{0x7352, 6072},
-	{0x7357, 3980},
-	{0x7368, 4313},
-	{0x736a, 7941},
-	{0x7370, 6018},
-	{0x7372, 7949},
-	{0x7375, 4488},
-	{0x7378, 5592},
-	{0x737a, 4214},
-	{0x737b, 7725},
-	{0x7384, 7741},
-	{0x7386, 6496},
-	{0x7387, 5552},
-	{0x7389, 6081},
-	{0x738b, 6130},
-	{0x738e, 6734},
-	{0x7394, 7156},
-	{0x7396, 3923},
-	{0x7397, 6211},
-	{0x7398, 4094},
-	{0x739f, 4879},
-	{0x73a7, 6363},
-	{0x73a9, 6113},
-	{0x73ad, 5233},
-	{0x73b2, 4495},
-	{0x73b3, 4260},
-	{0x73b9, 7742},
-	{0x73c0, 4894},
-	{0x73c2, 3452},
-	{0x73c9, 4880},
-	{0x73ca, 5308},
-	{0x73cc, 7608},
-	{0x73cd, 6992},
-	{0x73cf, 3471},
-	{0x73d6, 3848},
-	{0x73d9, 3797},
-	{0x73dd, 7977},
-	{0x73de, 4384},
-	{0x73e0, 6882},
-	{0x73e3, 5651},
-	{0x73e4, 5067},
-	{0x73e5, 6423},
-	{0x73e6, 7713},
-	{0x73e9, 7782},
-	{0x73ea, 3999},
-	{0x73ed, 4916},
-	{0x73f7, 4824},
-	{0x73f9, 5483},
-	{0x73fd, 6735},
-	{0x73fe, 7743},
-	{0x7401, 5429},
-	{0x7403, 3924},
-	{0x7405, 4416},
-	{0x7406, 4625},
-	{0x7407, 5593},
-	{0x7409, 4584},
-	{0x7413, 6114},
-	{0x741b, 7372},
-	{0x7420, 6663},
-	{0x7421, 5636},
-	{0x7422, 7404},
-	{0x7425, 7822},
-	{0x7426, 4095},
-	{0x7428, 3781},
-	{0x742a, 4096},
-	{0x742b, 5102},
-	{0x742c, 6115},
-	{0x742e, 6844},
-	{0x742f, 3826},
-	{0x7430, 5993},
-	{0x7433, 4649},
-	{0x7434, 4043},
-	{0x7435, 5201},
-	{0x7436, 7484},
-	{0x7438, 7405},
-	{0x743a, 5019},
-	{0x743f, 7848},
-	{0x7440, 6212},
-	{0x7441, 4779},
-	{0x7443, 7302},
-	{0x7444, 5430},
-	{0x744b, 6296},
-	{0x7455, 7623},
-	{0x7457, 6273},
-	{0x7459, 4173},
-	{0x745a, 7823},
-	{0x745b, 6019},
-	{0x745c, 6337},
-	{0x745e, 5389},
-	{0x745f, 5674},
-	{0x7460, 4585},
-	{0x7462, 6188},
-	{0x7464, 6155},
-	{0x7465, 6084},
-	{0x7468, 6993},
-	{0x7469, 7783},
-	{0x746a, 4657},
-	{0x746f, 4417},
-	{0x747e, 4030},
-	{0x7482, 4097},
-	{0x7483, 4626},
-	{0x7487, 5431},
-	{0x7489, 4470},
-	{0x748b, 6554},
-	{0x7498, 4641},
-	{0x749c, 7919},
-	{0x749e, 4895},
-	{0x749f, 3683},
-	{0x74a1, 6994},
-	{0x74a3, 4098},
-	{0x74a5, 3684},
-	{0x74a7, 5025},
-	{0x74a8, 7065},
-	{0x74aa, 6804},
-	{0x74b0, 7894},
-	{0x74b2, 5594},
-	{0x74b5, 5939},
-	{0x74b9, 5637},
-	{0x74bd, 5363},
-	{0x74bf, 5432},
-	{0x74c6, 7021},
-	{0x74ca, 3685},
-	{0x74cf, 4540},
-	{0x74d4, 6020},
-	{0x74d8, 3827},
-	{0x74da, 7066},
-	{0x74dc, 3806},
-	{0x74e0, 7824},
-	{0x74e2, 7583},
-	{0x74e3, 7494},
-	{0x74e6, 6100},
-	{0x74ee, 6092},
-	{0x74f7, 6497},
-	{0x7501, 5051},
-	{0x7504, 3640},
-	{0x7511, 6936},
-	{0x7515, 6093},
-	{0x7518, 3521},
-	{0x751a, 5768},
-	{0x751b, 7181},
-	{0x751f, 5370},
-	{0x7523, 5309},
-	{0x7525, 5371},
-	{0x7526, 5518},
-	{0x7528, 6189},
-	{0x752b, 5068},
-	{0x752c, 6190},
-	{0x7530, 6664},
-	{0x7531, 6338},
-	{0x7532, 3532},
-	{0x7533, 5745},
-	{0x7537, 4149},
-	{0x7538, 6665},
-	{0x753a, 6736},
-	{0x7547, 4011},
-	{0x754c, 3717},
-	{0x754f, 6139},
-	{0x7551, 6666},
-	{0x7553, 4235},
-	{0x7554, 4917},
-	{0x7559, 4586},
-	{0x755b, 6995},
-	{0x755c, 7289},
-	{0x755d, 4825},
-	{0x7562, 7609},
-	{0x7565, 4426},
-	{0x7566, 8008},
-	{0x756a, 5000},
-	{0x756f, 6914},
-	{0x7570, 6424},
-	{0x7575, 7868},
-	{0x7576, 4246},
-	{0x7578, 4099},
-	{0x757a, 3546},
-	{0x757f, 4100},
-	{0x7586, 3547},
-	{0x7587, 6883},
-	{0x758a, 7192},
-	{0x758b, 7610},
-	{0x758e, 5520},
-	{0x758f, 5519},
-	{0x7591, 6403},
-	{0x759d, 5310},
-	{0x75a5, 3571},
-	{0x75ab, 5951},
-	{0x75b1, 7558},
-	{0x75b2, 7599},
-	{0x75b3, 3522},
-	{0x75b5, 6498},
-	{0x75b8, 4215},
-	{0x75b9, 6996},
-	{0x75bc, 4342},
-	{0x75bd, 6605},
-	{0x75be, 7022},
-	{0x75c2, 3453},
-	{0x75c5, 5052},
-	{0x75c7, 6937},
-	{0x75cd, 6425},
-	{0x75d2, 5892},
-	{0x75d4, 7346},
-	{0x75d5, 8022},
-	{0x75d8, 4352},
-	{0x75d9, 3686},
-	{0x75db, 7455},
-	{0x75e2, 4627},
-	{0x75f0, 4226},
-	{0x75f2, 4658},
-	{0x75f4, 7347},
-	{0x75fa, 5202},
-	{0x75fc, 3746},
-	{0x7600, 5906},
-	{0x760d, 5893},
-	{0x7619, 5521},
-	{0x761f, 6085},
-	{0x7620, 7143},
-	{0x7621, 7108},
-	{0x7622, 4918},
-	{0x7624, 4587},
-	{0x7626, 5595},
-	{0x763b, 4570},
-	{0x7642, 4557},
-	{0x764c, 5826},
-	{0x764e, 3489},
-	{0x7652, 6339},
-	{0x7656, 5026},
-	{0x7661, 7348},
-	{0x7664, 6688},
-	{0x7669, 4376},
-	{0x766c, 5433},
-	{0x7670, 6094},
-	{0x7672, 6667},
-	{0x7678, 3718},
-	{0x767b, 4368},
-	{0x767c, 4935},
-	{0x767d, 4993},
-	{0x767e, 4994},
-	{0x7684, 6627},
-	{0x7686, 3572},
-	{0x7687, 7920},
-	{0x768e, 3880},
-	{0x7690, 3747},
-	{0x7693, 7825},
-	{0x76ae, 7600},
-	{0x76ba, 7272},
-	{0x76bf, 4755},
-	{0x76c2, 6213},
-	{0x76c3, 4978},
-	{0x76c6, 5164},
-	{0x76c8, 6021},
-	{0x76ca, 6438},
-	{0x76d2, 7665},
-	{0x76d6, 3573},
-	{0x76db, 5484},
-	{0x76dc, 4293},
-	{0x76de, 6526},
-	{0x76df, 4731},
-	{0x76e1, 6997},
-	{0x76e3, 3523},
-	{0x76e4, 4919},
-	{0x76e7, 4518},
-	{0x76ee, 4791},
-	{0x76f2, 4730},
-	{0x76f4, 6975},
-	{0x76f8, 5352},
-	{0x76fc, 4920},
-	{0x76fe, 5652},
-	{0x7701, 5485},
-	{0x7704, 4740},
-	{0x7708, 7421},
-	{0x7709, 4862},
-	{0x770b, 3490},
-	{0x771e, 6998},
-	{0x7720, 4741},
-	{0x7729, 7744},
-	{0x7737, 3978},
-	{0x7738, 4780},
-	{0x773a, 6805},
-	{0x773c, 5812},
-	{0x7740, 7057},
-	{0x774d, 7745},
-	{0x775b, 6737},
-	{0x7761, 5596},
-	{0x7763, 4314},
-	{0x7766, 4792},
-	{0x776b, 7193},
-	{0x7779, 4294},
-	{0x777e, 3748},
-	{0x777f, 6037},
-	{0x778b, 6999},
-	{0x7791, 4756},
-	{0x779e, 4682},
-	{0x77a5, 5038},
-	{0x77ac, 5653},
-	{0x77ad, 4558},
-	{0x77b0, 3524},
-	{0x77b3, 4343},
-	{0x77bb, 7182},
-	{0x77bc, 3621},
-	{0x77bf, 3925},
-	{0x77d7, 7244},
-	{0x77db, 4781},
-	{0x77dc, 4060},
-	{0x77e2, 5709},
-	{0x77e3, 6404},
-	{0x77e5, 6960},
-	{0x77e9, 3926},
-	{0x77ed, 4204},
-	{0x77ee, 6134},
-	{0x77ef, 3881},
-	{0x77f3, 5413},
-	{0x7802, 5277},
-	{0x7812, 5203},
-	{0x7825, 6961},
-	{0x7826, 7120},
-	{0x7827, 7373},
-	{0x782c, 4652},
-	{0x7832, 7559},
-	{0x7834, 7485},
-	{0x7845, 4000},
-	{0x784f, 5976},
-	{0x785d, 7226},
-	{0x786b, 4588},
-	{0x786c, 3687},
-	{0x786f, 5977},
-	{0x787c, 5178},
-	{0x7881, 4101},
-	{0x7887, 6738},
-	{0x788c, 4528},
-	{0x788d, 5847},
-	{0x788e, 5563},
-	{0x7891, 5204},
-	{0x7897, 6116},
-	{0x78a3, 3504},
-	{0x78a7, 5027},
-	{0x78a9, 5414},
-	{0x78ba, 7879},
-	{0x78bb, 7880},
-	{0x78bc, 4659},
-	{0x78c1, 6499},
-	{0x78c5, 4956},
-	{0x78ca, 4546},
-	{0x78cb, 7050},
-	{0x78ce, 3719},
-	{0x78d0, 4921},
-	{0x78e8, 4660},
-	{0x78ec, 3688},
-	{0x78ef, 4102},
-	{0x78f5, 3491},
-	{0x78fb, 4922},
-	{0x7901, 7227},
-	{0x790e, 7228},
-	{0x7916, 5940},
-	{0x792a, 4450},
-	{0x792b, 4462},
-	{0x792c, 4923},
-	{0x793a, 5710},
-	{0x793e, 5278},
-	{0x7940, 5279},
-	{0x7941, 4103},
-	{0x7947, 4104},
-	{0x7948, 4105},
-	{0x7949, 6962},
-	{0x7950, 6214},
-	{0x7956, 6806},
-	{0x7957, 6963},
-	{0x795a, 6807},
-	{0x795b, 3595},
-	{0x795c, 7826},
-	{0x795d, 7290},
-	{0x795e, 5746},
-	{0x7960, 5280},
-	{0x7965, 5353},
-	{0x7968, 7584},
-	{0x796d, 6769},
-	{0x797a, 4106},
-	{0x797f, 4529},
-	{0x7981, 4044},
-	{0x798d, 7869},
-	{0x798e, 6739},
-	{0x798f, 5081},
-	{0x7991, 6215},
-	{0x79a6, 5907},
-	{0x79a7, 8052},
-	{0x79aa, 5434},
-	{0x79ae, 4508},
-	{0x79b1, 4295},
-	{0x79b3, 5894},
-	{0x79b9, 6216},
-	{0x79bd, 4045},
-	{0x79be, 7870},
-	{0x79bf, 4315},
-	{0x79c0, 5597},
-	{0x79c1, 5281},
-	{0x79c9, 5053},
-	{0x79ca, 4162},
-	{0x79cb, 7273},
-	{0x79d1, 3807},
-	{0x79d2, 7229},
-	{0x79d5, 5205},
-	{0x79d8, 5206},
-	{0x79df, 6808},
-	{0x79e4, 7377},
-	{0x79e6, 7000},
-	{0x79e7, 5838},
-	{0x79e9, 7023},
-	{0x79fb, 6426},
-	{0x7a00, 8053},
-	{0x7a05, 5496},
-	{0x7a08, 3492},
-	{0x7a0b, 6740},
-	{0x7a0d, 7230},
-	{0x7a14, 6474},
-	{0x7a17, 7510},
-	{0x7a19, 6976},
-	{0x7a1a, 7349},
-	{0x7a1c, 4609},
-	{0x7a1f, 7591},
-	{0x7a20, 6809},
-	{0x7a2e, 6845},
-	{0x7a31, 7378},
-	{0x7a36, 6235},
-	{0x7a37, 6977},
-	{0x7a3b, 4296},
-	{0x7a3c, 3454},
-	{0x7a3d, 3720},
-	{0x7a3f, 3749},
-	{0x7a40, 3771},
-	{0x7a46, 4793},
-	{0x7a49, 7350},
-	{0x7a4d, 6628},
-	{0x7a4e, 6022},
-	{0x7a57, 5598},
-	{0x7a61, 5366},
-	{0x7a62, 6038},
-	{0x7a69, 6086},
-	{0x7a6b, 7881},
-	{0x7a70, 5895},
-	{0x7a74, 7755},
-	{0x7a76, 3927},
-	{0x7a79, 3965},
-	{0x7a7a, 3798},
-	{0x7a7d, 6741},
-	{0x7a7f, 7157},
-	{0x7a81, 4330},
-	{0x7a84, 7058},
-	{0x7a88, 6156},
-	{0x7a92, 7024},
-	{0x7a93, 7109},
-	{0x7a95, 6810},
-	{0x7a98, 3954},
-	{0x7a9f, 3962},
-	{0x7aa9, 6101},
-	{0x7aaa, 6102},
-	{0x7aae, 3966},
-	{0x7aaf, 6157},
-	{0x7aba, 4001},
-	{0x7ac4, 7067},
-	{0x7ac5, 4002},
-	{0x7ac7, 4353},
-	{0x7aca, 6689},
-	{0x7acb, 4653},
-	{0x7ad7, 4809},
-	{0x7ad9, 7089},
-	{0x7add, 5054},
-	{0x7adf, 3689},
-	{0x7ae0, 6555},
-	{0x7ae3, 6915},
-	{0x7ae5, 4344},
-	{0x7aea, 5599},
-	{0x7aed, 3505},
-	{0x7aef, 4205},
-	{0x7af6, 3690},
-	{0x7af9, 6900},
-	{0x7afa, 7291},
-	{0x7aff, 3493},
-	{0x7b0f, 7852},
-	{0x7b11, 5522},
-	{0x7b19, 5372},
-	{0x7b1b, 6629},
-	{0x7b1e, 7439},
-	{0x7b20, 4654},
-	{0x7b26, 5130},
-	{0x7b2c, 6770},
-	{0x7b2d, 4496},
-	{0x7b39, 5497},
-	{0x7b46, 7611},
-	{0x7b49, 4369},
-	{0x7b4b, 4031},
-	{0x7b4c, 6668},
-	{0x7b4d, 5654},
-	{0x7b4f, 5006},
-	{0x7b50, 3849},
-	{0x7b51, 7292},
-	{0x7b52, 7456},
-	{0x7b54, 4236},
-	{0x7b56, 7128},
-	{0x7b60, 4012},
-	{0x7b6c, 5486},
-	{0x7b6e, 5390},
-	{0x7b75, 5978},
-	{0x7b7d, 6073},
-	{0x7b87, 3574},
-	{0x7b8b, 6669},
-	{0x7b8f, 6588},
-	{0x7b94, 4896},
-	{0x7b95, 4107},
-	{0x7b97, 5311},
-	{0x7b9a, 7051},
-	{0x7b9d, 3656},
-	{0x7ba1, 3828},
-	{0x7bad, 6670},
-	{0x7bb1, 5354},
-	{0x7bb4, 6530},
-	{0x7bb8, 6606},
-	{0x7bc0, 6690},
-	{0x7bc1, 7921},
-	{0x7bc4, 5016},
-	{0x7bc6, 6671},
-	{0x7bc7, 7522},
-	{0x7bc9, 7293},
-	{0x7bd2, 5729},
-	{0x7be0, 5523},
-	{0x7be4, 4316},
-	{0x7be9, 5282},
-	{0x7c07, 6829},
-	{0x7c12, 7068},
-	{0x7c1e, 4206},
-	{0x7c21, 3494},
-	{0x7c27, 7922},
-	{0x7c2a, 6531},
-	{0x7c2b, 5524},
-	{0x7c3d, 7183},
-	{0x7c3e, 4487},
-	{0x7c3f, 5131},
-	{0x7c43, 4404},
-	{0x7c4c, 6884},
-	{0x7c4d, 6630},
-	{0x7c60, 4541},
-	{0x7c64, 7184},
-	{0x7c6c, 4628},
-	{0x7c73, 4863},
-	{0x7c83, 5207},
-	{0x7c89, 5165},
-	{0x7c92, 4655},
-	{0x7c95, 4897},
-	{0x7c97, 6811},
-	{0x7c98, 6697},
-	{0x7c9f, 5541},
-	{0x7ca5, 6901},
-	{0x7ca7, 6556},
-	{0x7cae, 4433},
-	{0x7cb1, 4434},
-	{0x7cb2, 7070},
-	{0x7cb3, 3582},
-	{0x7cb9, 5600},
-	{0x7cbe, 6742},
-	{0x7cca, 7827},
-	{0x7cd6, 4247},
-	{0x7cde, 5166},
-	{0x7cdf, 6812},
-	{0x7ce0, 3548},
-	{0x7ce7, 4435},
-	{0x7cfb, 3721},
-	{0x7cfe, 4003},
-	{0x7d00, 4108},
-	{0x7d02, 6885},
-	{0x7d04, 5873},
-	{0x7d05, 7859},
-	{0x7d06, 6217},
-	{0x7d07, 8025},
-	{0x7d08, 7895},
-	{0x7d0a, 4842},
-	{0x7d0b, 4843},
-	{0x7d0d, 4150},
-	{0x7d10, 4184},
-	{0x7d14, 5655},
-	{0x7d17, 5283},
-	{0x7d18, 3865},
-	{0x7d19, 6964},
-	{0x7d1a, 4056},
-	{0x7d1b, 5167},
-	{0x7d20, 5525},
-	{0x7d21, 4957},
-	{0x7d22, 5367},
-	{0x7d2b, 6500},
-	{0x7d2c, 6886},
-	{0x7d2e, 7081},
-	{0x7d2f, 4571},
-	{0x7d30, 5498},
-	{0x7d33, 5747},
-	{0x7d35, 6607},
-	{0x7d39, 5526},
-	{0x7d3a, 3525},
-	{0x7d42, 6846},
-	{0x7d43, 7746},
-	{0x7d44, 6813},
-	{0x7d45, 3691},
-	{0x7d46, 4924},
-	{0x7d50, 3651},
-	{0x7d5e, 3882},
-	{0x7d61, 4385},
-	{0x7d62, 7747},
-	{0x7d66, 4057},
-	{0x7d68, 6371},
-	{0x7d6a, 6454},
-	{0x7d6e, 5391},
-	{0x7d71, 7457},
-	{0x7d72, 5284},
-	{0x7d73, 3549},
-	{0x7d76, 6691},
-	{0x7d79, 3641},
-	{0x7d7f, 3928},
-	{0x7d8e, 6743},
-	{0x7d8f, 5601},
-	{0x7d93, 3692},
-	{0x7d9c, 6847},
-	{0x7da0, 4530},
-	{0x7da2, 6887},
-	{0x7dac, 5602},
-	{0x7dad, 6340},
-	{0x7db1, 3550},
-	{0x7db2, 4701},
-	{0x7db4, 7173},
-	{0x7db5, 7121},
-	{0x7db8, 4598},
-	{0x7dba, 4109},
-	{0x7dbb, 7416},
-	{0x7dbd, 6517},
-	{0x7dbe, 4610},
-	{0x7dbf, 4742},
-	{0x7dc7, 7351},
-	{0x7dca, 4126},
-	{0x7dcb, 5208},
-	{0x7dd6, 5392},
-	{0x7dd8, 7658},
-	{0x7dda, 5435},
-	{0x7ddd, 7034},
-	{0x7dde, 4207},
-	{0x7de0, 7209},
-	{0x7de1, 4881},
-	{0x7de3, 5979},
-	{0x7de8, 7523},
-	{0x7de9, 6117},
-	{0x7dec, 4743},
-	{0x7def, 6297},
-	{0x7df4, 4471},
-	{0x7dfb, 7352},
-	{0x7e09, 7001},
-	{0x7e0a, 5855},
-	{0x7e15, 6087},
-	{0x7e1b, 4898},
-	{0x7e1d, 7002},
-	{0x7e1e, 7828},
-	{0x7e1f, 6171},
-	{0x7e21, 6581},
-	{0x7e23, 7748},
-	{0x7e2b, 5103},
-	{0x7e2e, 7294},
-	{0x7e2f, 5980},
-	{0x7e31, 6848},
-	{0x7e37, 4572},
-	{0x7e3d, 7257},
-	{0x7e3e, 6631},
-	{0x7e41, 5001},
-	{0x7e43, 5179},
-	{0x7e46, 4826},
-	{0x7e47, 6158},
-	{0x7e52, 6938},
-	{0x7e54, 6978},
-	{0x7e55, 5436},
-	{0x7e5e, 6159},
-	{0x7e61, 5603},
-	{0x7e69, 5689},
-	{0x7e6a, 7942},
-	{0x7e6b, 3722},
-	{0x7e6d, 3642},
-	{0x7e70, 6814},
-	{0x7e79, 5952},
-	{0x7e7c, 3723},
-	{0x7e82, 7069},
-	{0x7e8c, 5542},
-	{0x7e8f, 6672},
-	{0x7e93, 6023},
-	{0x7e96, 5466},
-	{0x7e98, 7071},
-	{0x7e9b, 4317},
-	{0x7e9c, 4405},
-	{0x7f36, 5132},
-	{0x7f38, 7681},
-	{0x7f3a, 3652},
-	{0x7f4c, 5859},
-	{0x7f50, 3829},
-	{0x7f54, 4702},
-	{0x7f55, 7643},
-	{0x7f6a, 6859},
-	{0x7f6b, 3854},
-	{0x7f6e, 7353},
-	{0x7f70, 5007},
-	{0x7f72, 5393},
-	{0x7f75, 4717},
-	{0x7f77, 7486},
-	{0x7f79, 4629},
-	{0x7f85, 4377},
-	{0x7f88, 4110},
-	{0x7f8a, 5896},
-	{0x7f8c, 3551},
-	{0x7f8e, 4864},
-	{0x7f94, 3750},
-	{0x7f9a, 4497},
-	{0x7f9e, 5604},
-	{0x7fa4, 3955},
-	{0x7fa8, 5437},
-	{0x7fa9, 6405},
-	{0x7fb2, 8054},
-	{0x7fb8, 4630},
-	{0x7fb9, 3583},
-	{0x7fbd, 6218},
-	{0x7fc1, 6095},
-	{0x7fc5, 5711},
-	{0x7fca, 6439},
-	{0x7fcc, 6440},
-	{0x7fce, 4498},
-	{0x7fd2, 5679},
-	{0x7fd4, 5355},
-	{0x7fd5, 8033},
-	{0x7fdf, 6632},
-	{0x7fe0, 7322},
-	{0x7fe1, 5209},
-	{0x7fe9, 7524},
-	{0x7feb, 6118},
-	{0x7ff0, 7644},
-	{0x7ff9, 3883},
-	{0x7ffc, 6441},
-	{0x8000, 6160},
-	{0x8001, 4519},
-	{0x8003, 3751},
-	{0x8005, 6501},
-	{0x8006, 4111},
-	{0x8009, 3929},
-	{0x800c, 6427},
-	{0x8010, 4158},
-	{0x8015, 3693},
-	{0x8017, 4782},
-	{0x8018, 6243},
-	{0x802d, 4112},
-	{0x8033, 6428},
-	{0x8036, 5870},
-	{0x803d, 7422},
-	{0x803f, 3694},
-	{0x8043, 4227},
-	{0x8046, 4499},
-	{0x804a, 4559},
-	{0x8056, 5487},
-	{0x8058, 5239},
-	{0x805a, 7323},
-	{0x805e, 4844},
-	{0x806f, 4472},
-	{0x8070, 7258},
-	{0x8072, 5488},
-	{0x8073, 6191},
-	{0x8077, 6979},
-	{0x807d, 7200},
-	{0x807e, 4542},
-	{0x807f, 6368},
-	{0x8084, 6429},
-	{0x8085, 5638},
-	{0x8086, 5285},
-	{0x8087, 6815},
-	{0x8089, 6357},
-	{0x808b, 4605},
-	{0x808c, 4113},
-	{0x8096, 7231},
-	{0x809b, 7682},
-	{0x809d, 3495},
-	{0x80a1, 3752},
-	{0x80a2, 6965},
-	{0x80a5, 5210},
-	{0x80a9, 3643},
-	{0x80aa, 4958},
-	{0x80af, 4061},
-	{0x80b1, 3866},
-	{0x80b2, 6358},
-	{0x80b4, 7963},
-	{0x80ba, 7540},
-	{0x80c3, 6298},
-	{0x80c4, 6865},
-	{0x80cc, 4979},
-	{0x80ce, 7440},
-	{0x80da, 4980},
-	{0x80db, 3533},
-	{0x80de, 7560},
-	{0x80e1, 7829},
-	{0x80e4, 6364},
-	{0x80e5, 5394},
-	{0x80f1, 3850},
-	{0x80f4, 4345},
-	{0x80f8, 8017},
-	{0x80fd, 4185},
-	{0x8102, 6966},
-	{0x8105, 7766},
-	{0x8106, 7324},
-	{0x8107, 7767},
-	{0x8108, 4722},
-	{0x810a, 7144},
-	{0x8118, 6119},
-	{0x811a, 3472},
-	{0x811b, 3695},
-	{0x8123, 5656},
-	{0x8129, 5605},
-	{0x812b, 7419},
-	{0x812f, 7561},
-	{0x8139, 7110},
-	{0x813e, 5211},
-	{0x814b, 5856},
-	{0x814e, 5748},
-	{0x8150, 5133},
-	{0x8151, 5134},
-	{0x8154, 3552},
-	{0x8155, 6120},
-	{0x8165, 5489},
-	{0x8166, 4179},
-	{0x816b, 6849},
-	{0x8170, 6161},
-	{0x8171, 3608},
-	{0x8178, 6557},
-	{0x8179, 5082},
-	{0x817a, 5438},
-	{0x817f, 7461},
-	{0x8180, 4959},
-	{0x8188, 3634},
-	{0x818a, 4899},
-	{0x818f, 3753},
-	{0x819a, 5135},
-	{0x819c, 4667},
-	{0x819d, 5675},
-	{0x81a0, 3884},
-	{0x81a3, 7025},
-	{0x81a8, 7516},
-	{0x81b3, 5439},
-	{0x81b5, 7313},
-	{0x81ba, 6392},
-	{0x81bd, 4228},
-	{0x81be, 7943},
-	{0x81bf, 4176},
-	{0x81c0, 4359},
-	{0x81c2, 5212},
-	{0x81c6, 5916},
-	{0x81cd, 6771},
-	{0x81d8, 4410},
-	{0x81df, 6558},
-	{0x81e3, 5749},
-	{0x81e5, 6103},
-	{0x81e7, 6559},
-	{0x81e8, 4650},
-	{0x81ea, 6502},
-	{0x81ed, 7325},
-	{0x81f3, 6967},
-	{0x81f4, 7354},
-	{0x81fa, 4261},
-	{0x81fb, 7003},
-	{0x81fc, 3930},
-	{0x81fe, 6341},
-	{0x8205, 3931},
-	{0x8207, 5941},
-	{0x8208, 8034},
-	{0x820a, 3932},
-	{0x820c, 5456},
-	{0x820d, 5286},
-	{0x8212, 5395},
-	{0x821b, 7158},
-	{0x821c, 5657},
-	{0x821e, 4827},
-	{0x821f, 6888},
-	{0x8221, 3553},
-	{0x822a, 7683},
-	{0x822b, 4960},
-	{0x822c, 4925},
-	{0x8235, 7390},
-	{0x8236, 4900},
-	{0x8237, 7749},
-	{0x8239, 5440},
-	{0x8240, 5136},
-	{0x8245, 5942},
-	{0x8247, 6744},
-	{0x8259, 7111},
-	{0x8264, 6406},
-	{0x8266, 7659},
-	{0x826e, 3496},
-	{0x826f, 4436},
-	{0x8271, 3497},
-	{0x8272, 5368},
-	{0x8276, 5994},
-	{0x8278, 7232},
-	{0x827e, 5848},
-	{0x828b, 6219},
-	{0x828d, 6518},
-	{0x828e, 3967},
-	{0x8292, 4703},
-	{0x8299, 5137},
-	{0x829a, 4360},
-	{0x829d, 6968},
-	{0x829f, 5324},
-	{0x82a5, 3575},
-	{0x82a6, 7830},
-	{0x82a9, 4046},
-	{0x82ac, 5168},
-	{0x82ad, 7487},
-	{0x82ae, 6039},
-	{0x82af, 5769},
-	{0x82b1, 7871},
-	{0x82b3, 4961},
-	{0x82b7, 6969},
-	{0x82b8, 6244},
-	{0x82b9, 4032},
-	{0x82bb, 7274},
-	{0x82bc, 4783},
-	{0x82bd, 5783},
-	{0x82bf, 6482},
-	{0x82d1, 6274},
-	{0x82d2, 5995},
-	{0x82d4, 7441},
-	{0x82d5, 7233},
-	{0x82d7, 4810},
-	{0x82db, 3455},
-	{0x82de, 7562},
-	{0x82df, 3933},
-	{0x82e1, 6430},
-	{0x82e5, 5874},
-	{0x82e6, 3754},
-	{0x82e7, 6608},
-	{0x82f1, 6024},
-	{0x82fd, 3755},
-	{0x82fe, 7612},
-	{0x8301, 6921},
-	{0x8302, 4828},
-	{0x8303, 5017},
-	{0x8304, 3456},
-	{0x8305, 4784},
-	{0x8309, 4693},
-	{0x8317, 4757},
-	{0x8328, 6503},
-	{0x832b, 4704},
-	{0x832f, 5083},
-	{0x8331, 5606},
-	{0x8334, 7944},
-	{0x8335, 6455},
-	{0x8336, 4191},
-	{0x8338, 6192},
-	{0x8339, 5943},
-	{0x8340, 5658},
-	{0x8347, 7708},
-	{0x8349, 7234},
-	{0x834a, 7784},
-	{0x834f, 6475},
-	{0x8351, 6431},
-	{0x8352, 7923},
-	{0x8373, 4354},
-	{0x8377, 7624},
-	{0x837b, 6633},
-	{0x8389, 4631},
-	{0x838a, 6560},
-	{0x838e, 5287},
-	{0x8396, 3696},
-	{0x8398, 5750},
-	{0x839e, 6121},
-	{0x83a2, 7768},
-	{0x83a9, 5138},
-	{0x83aa, 5784},
-	{0x83ab, 4668},
-	{0x83bd, 4705},
-	{0x83c1, 7201},
-	{0x83c5, 3830},
-	{0x83c9, 4531},
-	{0x83ca, 3949},
-	{0x83cc, 4013},
-	{0x83d3, 3808},
-	{0x83d6, 7112},
-	{0x83dc, 7122},
-	{0x83e9, 5069},
-	{0x83eb, 4033},
-	{0x83ef, 7872},
-	{0x83f0, 3756},
-	{0x83f1, 4611},
-	{0x83f2, 5213},
-	{0x83f4, 5827},
-	{0x83f9, 6609},
-	{0x83fd, 5639},
-	{0x8403, 7314},
-	{0x8404, 4297},
-	{0x840a, 4423},
-	{0x840c, 4732},
-	{0x840d, 7532},
-	{0x840e, 6299},
-	{0x8429, 7275},
-	{0x842c, 4683},
-	{0x8431, 7993},
-	{0x8438, 6342},
-	{0x843d, 4386},
-	{0x8449, 6001},
-	{0x8457, 6610},
-	{0x845b, 3506},
-	{0x8461, 7563},
-	{0x8463, 4346},
-	{0x8466, 6300},
-	{0x846b, 7831},
-	{0x846c, 6561},
-	{0x846f, 5875},
-	{0x8475, 4004},
-	{0x847a, 6930},
-	{0x8490, 5607},
-	{0x8494, 5712},
-	{0x8499, 4799},
-	{0x849c, 5312},
-	{0x84a1, 4962},
-	{0x84b2, 7564},
-	{0x84b8, 6939},
-	{0x84bb, 5876},
-	{0x84bc, 7113},
-	{0x84bf, 7832},
-	{0x84c0, 5549},
-	{0x84c2, 4758},
-	{0x84c4, 7295},
-	{0x84c6, 5415},
-	{0x84c9, 6193},
-	{0x84cb, 3576},
-	{0x84cd, 5713},
-	{0x84d1, 5288},
-	{0x84da, 5608},
-	{0x84ec, 5104},
-	{0x84ee, 4473},
-	{0x84f4, 5659},
-	{0x84fc, 4560},
-	{0x8511, 4747},
-	{0x8513, 4684},
-	{0x8514, 5084},
-	{0x8517, 6504},
-	{0x8518, 5325},
-	{0x851a, 6250},
-	{0x851e, 4573},
-	{0x8521, 7123},
-	{0x8523, 6562},
-	{0x8525, 7259},
-	{0x852c, 5527},
-	{0x852d, 6383},
-	{0x852f, 7004},
-	{0x853d, 7541},
-	{0x853f, 6301},
-	{0x8541, 4229},
-	{0x8543, 5002},
-	{0x8549, 7235},
-	{0x854e, 3885},
-	{0x8553, 6245},
-	{0x8559, 7796},
-	{0x8563, 5660},
-	{0x8568, 3981},
-	{0x8569, 7430},
-	{0x856a, 4829},
-	{0x856d, 5528},
-	{0x8584, 4901},
-	{0x8587, 4865},
-	{0x858f, 6407},
-	{0x8591, 3554},
-	{0x8594, 6563},
-	{0x859b, 5457},
-	{0x85a6, 7159},
-	{0x85a8, 7989},
-	{0x85a9, 5319},
-	{0x85aa, 5751},
-	{0x85af, 5396},
-	{0x85b0, 7986},
-	{0x85ba, 6772},
-	{0x85c1, 3757},
-	{0x85c9, 6505},
-	{0x85cd, 4406},
-	{0x85ce, 5752},
-	{0x85cf, 6564},
-	{0x85d5, 6220},
-	{0x85dc, 4451},
-	{0x85dd, 6040},
-	{0x85e4, 4370},
-	{0x85e5, 5877},
-	{0x85e9, 5003},
-	{0x85ea, 5609},
-	{0x85f7, 6611},
-	{0x85fa, 4642},
-	{0x85fb, 6816},
-	{0x85ff, 3817},
-	{0x8602, 6041},
-	{0x8606, 4520},
-	{0x8607, 5529},
-	{0x860a, 6088},
-	{0x8616, 5924},
-	{0x8617, 5028},
-	{0x861a, 5441},
-	{0x862d, 4395},
-	{0x863f, 4378},
-	{0x864e, 7833},
-	{0x8650, 7632},
-	{0x8654, 3609},
-	{0x8655, 7133},
-	{0x865b, 7721},
-	{0x865c, 4521},
-	{0x865e, 6221},
-	{0x865f, 7834},
-	{0x8667, 8009},
-	{0x8679, 7860},
-	{0x868a, 4845},
-	{0x868c, 4963},
-	{0x8693, 6456},
-	{0x86a3, 3799},
-	{0x86a4, 6817},
-	{0x86a9, 7355},
-	{0x86c7, 5289},
-	{0x86cb, 4208},
-	{0x86d4, 7945},
-	{0x86d9, 6104},
-	{0x86db, 6889},
-	{0x86df, 3886},
-	{0x86e4, 7666},
-	{0x86ed, 7026},
-	{0x86fe, 5785},
-	{0x8700, 7245},
-	{0x8702, 5105},
-	{0x8703, 5753},
-	{0x8708, 6074},
-	{0x8718, 6970},
-	{0x871a, 5214},
-	{0x871c, 4884},
-	{0x874e, 3508},
-	{0x8755, 5730},
-	{0x8757, 7924},
-	{0x875f, 6302},
-	{0x8766, 7625},
-	{0x8768, 5676},
-	{0x8774, 7835},
-	{0x8776, 6703},
-	{0x8778, 6105},
-	{0x8782, 4418},
-	{0x878d, 6372},
-	{0x879f, 4759},
-	{0x87a2, 7785},
-	{0x87b3, 4248},
-	{0x87ba, 4379},
-	{0x87c4, 7376},
-	{0x87e0, 4926},
-	{0x87ec, 5442},
-	{0x87ef, 6162},
-	{0x87f2, 7309},
-	{0x87f9, 7696},
-	{0x87fb, 6408},
-	{0x87fe, 5467},
-	{0x8805, 5690},
-	{0x881f, 4411},
-	{0x8822, 6916},
-	{0x8823, 4452},
-	{0x8831, 3758},
-	{0x8836, 6532},
-	{0x883b, 4685},
-	{0x8840, 7756},
-	{0x8846, 6924},
-	{0x884c, 7709},
-	{0x884d, 5981},
-	{0x8852, 7750},
-	{0x8853, 5668},
-	{0x8857, 3457},
-	{0x8859, 5786},
-	{0x885b, 6303},
-	{0x885d, 7310},
-	{0x8861, 7786},
-	{0x8862, 3934},
-	{0x8863, 6409},
-	{0x8868, 7585},
-	{0x886b, 5326},
-	{0x8870, 5565},
-	{0x8872, 4151},
-	{0x8877, 7311},
-	{0x887e, 4047},
-	{0x887f, 4048},
-	{0x8881, 6275},
-	{0x8882, 4763},
-	{0x8888, 3458},
-	{0x888b, 4262},
-	{0x888d, 7565},
-	{0x8892, 4209},
-	{0x8896, 5610},
-	{0x8897, 7005},
-	{0x889e, 3782},
-	{0x88ab, 7601},
-	{0x88b4, 3759},
-	{0x88c1, 6582},
-	{0x88c2, 4482},
-	{0x88cf, 4632},
-	{0x88d4, 6042},
-	{0x88d5, 6343},
-	{0x88d9, 3956},
-	{0x88dc, 5070},
-	{0x88dd, 6565},
-	{0x88df, 5290},
-	{0x88e1, 4633},
-	{0x88e8, 5215},
-	{0x88f3, 5356},
-	{0x88f4, 4981},
-	{0x88f5, 4982},
-	{0x88f8, 4380},
-	{0x88fd, 6773},
-	{0x8907, 5085},
-	{0x8910, 3507},
-	{0x8912, 7566},
-	{0x8913, 5071},
-	{0x8918, 6304},
-	{0x8919, 4983},
-	{0x8925, 6172},
-	{0x892a, 7462},
-	{0x8936, 5680},
-	{0x8938, 4574},
-	{0x893b, 5458},
-	{0x8941, 3555},
-	{0x8944, 5897},
-	{0x895f, 4049},
-	{0x8964, 4407},
-	{0x896a, 4694},
-	{0x8972, 5681},
-	{0x897f, 5397},
-	{0x8981, 6163},
-	{0x8983, 4230},
-	{0x8986, 5086},
-	{0x8987, 7511},
-	{0x898b, 3644},
-	{0x898f, 4005},
-	{0x8993, 4734},
-	{0x8996, 5714},
-	{0x89a1, 3635},
-	{0x89a9, 4298},
-	{0x89aa, 7363},
-	{0x89b2, 4034},
-	{0x89ba, 3473},
-	{0x89bd, 4408},
-	{0x89c0, 3831},
-	{0x89d2, 3474},
-	{0x89e3, 7697},
-	{0x89f4, 5357},
-	{0x89f8, 7246},
-	{0x8a00, 5921},
-	{0x8a02, 6745},
-	{0x8a03, 5139},
-	{0x8a08, 3724},
-	{0x8a0a, 5754},
-	{0x8a0c, 7861},
-	{0x8a0e, 7452},
-	{0x8a13, 7987},
-	{0x8a16, 8026},
-	{0x8a17, 7406},
-	{0x8a18, 4114},
-	{0x8a1b, 6106},
-	{0x8a1d, 5787},
-	{0x8a1f, 5557},
-	{0x8a23, 3653},
-	{0x8a25, 4182},
-	{0x8a2a, 4964},
-	{0x8a2d, 5459},
-	{0x8a31, 7722},
-	{0x8a34, 5530},
-	{0x8a36, 3459},
-	{0x8a3a, 7006},
-	{0x8a3b, 6890},
-	{0x8a50, 5291},
-	{0x8a54, 6818},
-	{0x8a55, 7533},
-	{0x8a5b, 6612},
-	{0x8a5e, 5292},
-	{0x8a60, 6025},
-	{0x8a62, 5661},
-	{0x8a63, 6043},
-	{0x8a66, 5715},
-	{0x8a69, 5716},
-	{0x8a6d, 3987},
-	{0x8a6e, 6673},
-	{0x8a70, 8055},
-	{0x8a71, 7873},
-	{0x8a72, 7698},
-	{0x8a73, 5358},
-	{0x8a75, 5443},
-	{0x8a79, 7185},
-	{0x8a85, 6891},
-	{0x8a87, 3809},
-	{0x8a8c, 6971},
-	{0x8a8d, 6457},
-	{0x8a93, 5398},
-	{0x8a95, 7417},
-	{0x8a98, 6344},
-	{0x8a9e, 5908},
-	{0x8aa0, 5490},
-	{0x8aa1, 3725},
-	{0x8aa3, 4830},
-	{0x8aa4, 6075},
-	{0x8aa5, 3760},
-	{0x8aa6, 5558},
-	{0x8aa8, 7946},
-	{0x8aaa, 5460},
-	{0x8ab0, 5611},
-	{0x8ab2, 3810},
-	{0x8ab9, 5216},
-	{0x8abc, 6410},
-	{0x8abe, 6377},
-	{0x8abf, 6819},
-	{0x8ac2, 7186},
-	{0x8ac4, 5662},
-	{0x8ac7, 4231},
-	{0x8acb, 7202},
-	{0x8acd, 6589},
-	{0x8acf, 7276},
-	{0x8ad2, 4437},
-	{0x8ad6, 4535},
-	{0x8adb, 6345},
-	{0x8adc, 7194},
-	{0x8ae1, 5717},
-	{0x8ae6, 7210},
-	{0x8ae7, 7699},
-	{0x8aea, 6746},
-	{0x8aeb, 3498},
-	{0x8aed, 6346},
-	{0x8aee, 6506},
-	{0x8af1, 8002},
-	{0x8af6, 5770},
-	{0x8af7, 7593},
-	{0x8af8, 6774},
-	{0x8afa, 5922},
-	{0x8afe, 4139},
-	{0x8b00, 4785},
-	{0x8b01, 5818},
-	{0x8b02, 6305},
-	{0x8b04, 4371},
-	{0x8b0e, 4866},
-	{0x8b10, 4885},
-	{0x8b14, 7633},
-	{0x8b16, 5543},
-	{0x8b17, 4965},
-	{0x8b19, 3657},
-	{0x8b1a, 6442},
-	{0x8b1b, 3556},
-	{0x8b1d, 5293},
-	{0x8b20, 6164},
-	{0x8b28, 4786},
-	{0x8b2b, 6634},
-	{0x8b2c, 4589},
-	{0x8b33, 3935},
-	{0x8b39, 4035},
-	{0x8b41, 7874},
-	{0x8b49, 6940},
-	{0x8b4e, 8011},
-	{0x8b4f, 4115},
-	{0x8b58, 5731},
-	{0x8b5a, 4232},
-	{0x8b5c, 5072},
-	{0x8b66, 3697},
-	{0x8b6c, 5217},
-	{0x8b6f, 5953},
-	{0x8b70, 6411},
-	{0x8b74, 3645},
-	{0x8b77, 7836},
-	{0x8b7d, 6044},
-	{0x8b80, 4318},
-	{0x8b8a, 5033},
-	{0x8b90, 5612},
-	{0x8b92, 7090},
-	{0x8b93, 5898},
-	{0x8b96, 7091},
-	{0x8b9a, 7072},
-	{0x8c37, 3772},
-	{0x8c3f, 3726},
-	{0x8c41, 7902},
-	{0x8c46, 4355},
-	{0x8c48, 4116},
-	{0x8c4a, 7594},
-	{0x8c4c, 6122},
-	{0x8c55, 5718},
-	{0x8c5a, 4327},
-	{0x8c61, 5359},
-	{0x8c6a, 7837},
-	{0x8c6b, 6045},
-	{0x8c79, 7586},
-	{0x8c7a, 5719},
-	{0x8c82, 7236},
-	{0x8c8a, 4723},
-	{0x8c8c, 4787},
-	{0x8c9d, 7512},
-	{0x8c9e, 6747},
-	{0x8ca0, 5140},
-	{0x8ca1, 6583},
-	{0x8ca2, 3800},
-	{0x8ca7, 5234},
-	{0x8ca8, 7875},
-	{0x8ca9, 7495},
-	{0x8caa, 7423},
-	{0x8cab, 3832},
-	{0x8cac, 7129},
-	{0x8caf, 6613},
-	{0x8cb0, 5499},
-	{0x8cb3, 6433},
-	{0x8cb4, 3992},
-	{0x8cb6, 7528},
-	{0x8cb7, 4718},
-	{0x8cb8, 4263},
-	{0x8cbb, 5218},
-	{0x8cbc, 7195},
-	{0x8cbd, 6432},
-	{0x8cbf, 4831},
-	{0x8cc0, 7626},
-	{0x8cc1, 5169},
-	{0x8cc2, 4547},
-	{0x8cc3, 6476},
-	{0x8cc4, 7947},
-	{0x8cc7, 6507},
-	{0x8cc8, 3460},
-	{0x8cca, 6635},
-	{0x8cd1, 7007},
-	{0x8cd3, 5235},
-	{0x8cda, 4548},
-	{0x8cdc, 5294},
-	{0x8cde, 5360},
-	{0x8ce0, 4984},
-	{0x8ce2, 7751},
-	{0x8ce3, 4719},
-	{0x8ce4, 7160},
-	{0x8ce6, 5141},
-	{0x8cea, 7027},
-	{0x8ced, 4299},
-	{0x8cf4, 4549},
-	{0x8cfb, 5142},
-	{0x8cfc, 3936},
-	{0x8cfd, 5364},
-	{0x8d04, 6972},
-	{0x8d05, 7315},
-	{0x8d07, 6365},
-	{0x8d08, 6941},
-	{0x8d0a, 7073},
-	{0x8d0d, 5468},
-	{0x8d13, 6566},
-	{0x8d16, 5544},
-	{0x8d64, 6636},
-	{0x8d66, 5295},
-	{0x8d6b, 7732},
-	{0x8d70, 6892},
-	{0x8d73, 4006},
-	{0x8d74, 5143},
-	{0x8d77, 4117},
-	{0x8d85, 7237},
-	{0x8d8a, 6282},
-	{0x8d99, 6820},
-	{0x8da3, 7326},
-	{0x8da8, 7277},
-	{0x8db3, 6830},
-	{0x8dba, 5144},
-	{0x8dbe, 6973},
-	{0x8dc6, 7442},
-	{0x8dcb, 4936},
-	{0x8dcc, 7028},
-	{0x8dcf, 3461},
-	{0x8ddb, 7488},
-	{0x8ddd, 3596},
-	{0x8de1, 6637},
-	{0x8de3, 5444},
-	{0x8de8, 3811},
-	{0x8def, 4522},
-	{0x8df3, 4300},
-	{0x8e0a, 6194},
-	{0x8e0f, 4237},
-	{0x8e10, 7161},
-	{0x8e1e, 3597},
-	{0x8e2a, 6850},
-	{0x8e30, 6347},
-	{0x8e35, 6851},
-	{0x8e42, 6348},
-	{0x8e44, 6775},
-	{0x8e47, 3610},
-	{0x8e48, 4301},
-	{0x8e49, 7052},
-	{0x8e4a, 7797},
-	{0x8e59, 7296},
-	{0x8e5f, 6638},
-	{0x8e60, 7145},
-	{0x8e74, 7297},
-	{0x8e76, 3982},
-	{0x8e81, 6821},
-	{0x8e87, 6614},
-	{0x8e8a, 6893},
-	{0x8e8d, 5878},
-	{0x8eaa, 4643},
-	{0x8eab, 5755},
-	{0x8eac, 3968},
-	{0x8ec0, 3937},
-	{0x8eca, 7053},
-	{0x8ecb, 5819},
-	{0x8ecc, 3988},
-	{0x8ecd, 3957},
-	{0x8ed2, 7726},
-	{0x8edf, 5982},
-	{0x8eeb, 7008},
-	{0x8ef8, 7298},
-	{0x8efb, 3462},
-	{0x8efe, 5732},
-	{0x8f03, 3887},
-	{0x8f05, 4523},
-	{0x8f09, 6584},
-	{0x8f12, 7196},
-	{0x8f13, 4686},
-	{0x8f14, 5073},
-	{0x8f15, 3698},
-	{0x8f1b, 4438},
-	{0x8f1c, 7356},
-	{0x8f1d, 8003},
-	{0x8f1e, 4706},
-	{0x8f1f, 7174},
-	{0x8f26, 4474},
-	{0x8f27, 5055},
-	{0x8f29, 4985},
-	{0x8f2a, 4599},
-	{0x8f2f, 7035},
-	{0x8f33, 6894},
-	{0x8f38, 5613},
-	{0x8f39, 5087},
-	{0x8f3b, 5088},
-	{0x8f3e, 6674},
-	{0x8f3f, 5944},
-	{0x8f44, 7650},
-	{0x8f45, 6276},
-	{0x8f49, 6675},
-	{0x8f4d, 7175},
-	{0x8f4e, 3888},
-	{0x8f5d, 5945},
-	{0x8f5f, 3867},
-	{0x8f62, 4463},
-	{0x8f9b, 5756},
-	{0x8f9c, 3761},
-	{0x8fa3, 4398},
-	{0x8fa6, 7496},
-	{0x8fa8, 5034},
-	{0x8fad, 5296},
-	{0x8faf, 5035},
-	{0x8fb0, 7009},
-	{0x8fb1, 6173},
-	{0x8fb2, 4177},
-	{0x8fc2, 6222},
-	{0x8fc5, 5757},
-	{0x8fce, 6026},
-	{0x8fd1, 4036},
-	{0x8fd4, 4927},
-	{0x8fe6, 3463},
-	{0x8fea, 6639},
-	{0x8feb, 4902},
-	{0x8fed, 7029},
-	{0x8ff0, 5669},
-	{0x8ff2, 3626},
-	{0x8ff7, 4867},
-	{0x8ff9, 6640},
-	{0x8ffd, 7278},
-	{0x9000, 7463},
-	{0x9001, 5559},
-	{0x9002, 3838},
-	{0x9003, 4302},
-	{0x9005, 7978},
-	{0x9006, 5954},
-	{0x9008, 7787},
-	{0x900b, 7567},
-	{0x900d, 5531},
-	{0x900f, 7469},
-	{0x9010, 7299},
-	{0x9011, 3938},
-	{0x9014, 4303},
-	{0x9015, 3699},
-	{0x9017, 4356},
-	{0x9019, 6615},
-	{0x901a, 7458},
-	{0x901d, 5399},
-	{0x901e, 4500},
-	{0x901f, 5545},
-	{0x9020, 6822},
-	{0x9021, 6917},
-	{0x9022, 5106},
-	{0x9023, 4475},
-	{0x902e, 7211},
-	{0x9031, 6895},
-	{0x9032, 7010},
-	{0x9035, 4007},
-	{0x9038, 6466},
-	{0x903c, 7615},
-	{0x903e, 6350},
-	{0x9041, 4361},
-	{0x9042, 5614},
-	{0x9047, 6223},
-	{0x904a, 6349},
-	{0x904b, 6246},
-	{0x904d, 7525},
-	{0x904e, 3812},
-	{0x9050, 7627},
-	{0x9051, 7925},
-	{0x9053, 4304},
-	{0x9054, 4216},
-	{0x9055, 6306},
-	{0x9059, 6165},
-	{0x905c, 5550},
-	{0x905d, 4238},
-	{0x905e, 7212},
-	{0x9060, 6277},
-	{0x9061, 5532},
-	{0x9063, 3646},
-	{0x9069, 6641},
-	{0x906d, 6823},
-	{0x906e, 7054},
-	{0x906f, 4362},
-	{0x9072, 6974},
-	{0x9075, 6918},
-	{0x9077, 7162},
-	{0x9078, 5445},
-	{0x907a, 6351},
-	{0x907c, 4561},
-	{0x907d, 3598},
-	{0x907f, 7602},
-	{0x9080, 6166},
-	{0x9081, 4720},
-	{0x9082, 7700},
-	{0x9083, 5615},
-	{0x9084, 7896},
-	{0x9087, 6434},
-	{0x9088, 4669},
-	{0x908a, 5036},
-	{0x908f, 4381},
-	{0x9091, 6389},
-	{0x9095, 6096},
-	{0x9099, 4707},
-	{0x90a2, 7788},
-	{0x90a3, 4138},
-	{0x90a6, 4966},
-	{0x90a8, 7250},
-	{0x90aa, 5297},
-	{0x90af, 3526},
-	{0x90b0, 7443},
-	{0x90b1, 3939},
-	{0x90b5, 5533},
-	{0x90b8, 6616},
-	{0x90c1, 6236},
-	{0x90ca, 3889},
-	{0x90de, 4419},
-	{0x90e1, 3958},
-	{0x90e8, 5145},
-	{0x90ed, 3818},
-	{0x90f5, 6224},
-	{0x90fd, 4305},
-	{0x9102, 5802},
-	{0x9112, 7279},
-	{0x9115, 7714},
-	{0x9119, 5219},
-	{0x9127, 4372},
-	{0x912d, 6748},
-	{0x9132, 4210},
-	{0x9149, 6352},
-	{0x914a, 6749},
-	{0x914b, 7280},
-	{0x914c, 6519},
-	{0x914d, 4986},
-	{0x914e, 6896},
-	{0x9152, 6897},
-	{0x9162, 7238},
-	{0x9169, 4760},
-	{0x916a, 4387},
-	{0x916c, 5616},
-	{0x9175, 7964},
-	{0x9177, 7843},
-	{0x9178, 5313},
-	{0x9187, 5663},
-	{0x9189, 7327},
-	{0x918b, 7239},
-	{0x918d, 6776},
-	{0x9192, 5491},
-	{0x919c, 7281},
-	{0x91ab, 6412},
-	{0x91ac, 6567},
-	{0x91ae, 7240},
-	{0x91af, 7798},
-	{0x91b1, 4937},
-	{0x91b4, 4509},
-	{0x91b5, 3584},
-	{0x91c0, 5899},
-	{0x91c7, 7124},
-	{0x91c9, 6353},
-	{0x91cb, 5416},
-	{0x91cc, 4634},
-	{0x91cd, 6925},
-	{0x91ce, 5871},
-	{0x91cf, 4439},
-	{0x91d0, 4635},
-	{0x91d1, 4131},
-	{0x91d7, 5566},
-	{0x91d8, 6750},
-	{0x91dc, 5146},
-	{0x91dd, 7374},
-	{0x91e3, 6824},
-	{0x91e7, 7163},
-	{0x91ea, 6225},
-	{0x91f5, 7125},
-	{0x920d, 4363},
-	{0x9210, 3622},
-	{0x9211, 7497},
-	{0x9212, 5329},
-	{0x9217, 6366},
-	{0x921e, 4014},
-	{0x9234, 4501},
-	{0x923a, 6082},
-	{0x923f, 6676},
-	{0x9240, 3534},
-	{0x9245, 3599},
-	{0x9249, 7752},
-	{0x9257, 3658},
-	{0x925b, 5983},
-	{0x925e, 6283},
-	{0x9262, 4938},
-	{0x9264, 3940},
-	{0x9265, 5670},
-	{0x9266, 6751},
-	{0x9280, 6378},
-	{0x9283, 7260},
-	{0x9285, 4347},
-	{0x9291, 5446},
-	{0x9293, 6677},
-	{0x9296, 5617},
-	{0x9298, 4761},
-	{0x929c, 7660},
-	{0x92b3, 6046},
-	{0x92b6, 3941},
-	{0x92b7, 5534},
-	{0x92b9, 5618},
-	{0x92cc, 6752},
-	{0x92cf, 7769},
-	{0x92d2, 5107},
-	{0x92e4, 5400},
-	{0x92ea, 7568},
-	{0x92f8, 3600},
-	{0x92fc, 3557},
-	{0x9304, 4532},
-	{0x9310, 7282},
-	{0x9318, 7283},
-	{0x931a, 6590},
-	{0x931e, 5664},
-	{0x931f, 4233},
-	{0x9320, 6753},
-	{0x9321, 4118},
-	{0x9322, 6678},
-	{0x9324, 4119},
-	{0x9326, 4050},
-	{0x9328, 4811},
-	{0x932b, 5417},
-	{0x932e, 3762},
-	{0x932f, 7059},
-	{0x9348, 6027},
-	{0x934a, 4476},
-	{0x934b, 3813},
-	{0x934d, 4306},
-	{0x9354, 5803},
-	{0x935b, 4211},
-	{0x936e, 6354},
-	{0x9375, 3611},
-	{0x937c, 7375},
-	{0x937e, 6852},
-	{0x938c, 3659},
-	{0x9394, 6195},
-	{0x9396, 5564},
-	{0x939a, 7284},
-	{0x93a3, 7789},
-	{0x93a7, 3577},
-	{0x93ac, 7838},
-	{0x93ad, 7011},
-	{0x93b0, 6467},
-	{0x93c3, 6831},
-	{0x93d1, 6642},
-	{0x93de, 6196},
-	{0x93e1, 3700},
-	{0x93e4, 4575},
-	{0x93f6, 7036},
-	{0x9404, 7952},
-	{0x9418, 6853},
-	{0x9425, 5447},
-	{0x942b, 6679},
-	{0x9435, 7176},
-	{0x9438, 7407},
-	{0x9444, 6898},
-	{0x9451, 3527},
-	{0x9452, 3528},
-	{0x945b, 3851},
-	{0x947d, 7074},
-	{0x947f, 7060},
-	{0x9577, 6568},
-	{0x9580, 4846},
-	{0x9583, 5469},
-	{0x9589, 7542},
-	{0x958b, 3578},
-	{0x958f, 6367},
-	{0x9591, 7645},
-	{0x9592, 7646},
-	{0x9593, 3499},
-	{0x9594, 4882},
-	{0x9598, 3535},
-	{0x95a3, 3475},
-	{0x95a4, 7667},
-	{0x95a5, 5008},
-	{0x95a8, 4008},
-	{0x95ad, 4453},
-	{0x95b1, 5988},
-	{0x95bb, 5996},
-	{0x95bc, 5820},
-	{0x95c7, 5828},
-	{0x95ca, 7903},
-	{0x95d4, 7668},
-	{0x95d5, 3983},
-	{0x95d6, 7473},
-	{0x95dc, 3833},
-	{0x95e1, 7164},
-	{0x95e2, 5029},
-	{0x961c, 5147},
-	{0x9621, 7165},
-	{0x962a, 7498},
-	{0x962e, 6123},
-	{0x9632, 4967},
-	{0x963b, 6825},
-	{0x963f, 5788},
-	{0x9640, 7391},
-	{0x9642, 7603},
-	{0x9644, 5148},
-	{0x964b, 4576},
-	{0x964c, 4724},
-	{0x964d, 3558},
-	{0x9650, 7647},
-	{0x965b, 7543},
-	{0x965c, 7669},
-	{0x965d, 5470},
-	{0x965e, 5691},
-	{0x965f, 7146},
-	{0x9662, 6278},
-	{0x9663, 7012},
-	{0x9664, 6777},
-	{0x966a, 4987},
-	{0x9670, 6384},
-	{0x9673, 7013},
-	{0x9675, 4612},
-	{0x9676, 4307},
-	{0x9677, 7661},
-	{0x9678, 4593},
-	{0x967d, 5900},
-	{0x9685, 6226},
-	{0x9686, 4603},
-	{0x968a, 4264},
-	{0x968b, 5619},
-	{0x968d, 7926},
-	{0x968e, 3727},
-	{0x9694, 3636},
-	{0x9695, 6247},
-	{0x9698, 5849},
-	{0x9699, 4022},
-	{0x969b, 6778},
-	{0x969c, 6569},
-	{0x96a3, 4644},
-	{0x96a7, 5620},
-	{0x96a8, 5621},
-	{0x96aa, 7728},
-	{0x96b1, 6379},
-	{0x96b7, 4510},
-	{0x96bb, 7147},
-	{0x96c0, 6520},
-	{0x96c1, 5813},
-	{0x96c4, 6254},
-	{0x96c5, 5789},
-	{0x96c6, 7037},
-	{0x96c7, 3763},
-	{0x96c9, 7357},
-	{0x96cb, 6919},
-	{0x96cc, 6508},
-	{0x96cd, 6097},
-	{0x96ce, 6617},
-	{0x96d5, 6826},
-	{0x96d6, 5622},
-	{0x96d9, 5773},
-	{0x96db, 7285},
-	{0x96dc, 6533},
-	{0x96e2, 4636},
-	{0x96e3, 4142},
-	{0x96e8, 6227},
-	{0x96e9, 6228},
-	{0x96ea, 5461},
-	{0x96ef, 4847},
-	{0x96f0, 5170},
-	{0x96f2, 6248},
-	{0x96f6, 4502},
-	{0x96f7, 4550},
-	{0x96f9, 4903},
-	{0x96fb, 6680},
-	{0x9700, 5623},
-	{0x9706, 6754},
-	{0x9707, 7014},
-	{0x9711, 6698},
-	{0x9713, 6047},
-	{0x9716, 4651},
-	{0x9719, 6028},
-	{0x971c, 5361},
-	{0x971e, 7628},
-	{0x9727, 4832},
-	{0x9730, 5314},
-	{0x9732, 4524},
-	{0x9739, 5030},
-	{0x973d, 6779},
-	{0x9742, 4464},
-	{0x9744, 5850},
-	{0x9748, 4503},
-	{0x9751, 7203},
-	{0x9756, 6755},
-	{0x975c, 6756},
-	{0x975e, 5220},
-	{0x9761, 4868},
-	{0x9762, 4744},
-	{0x9769, 7733},
-	{0x976d, 6458},
-	{0x9774, 7876},
-	{0x9777, 6459},
-	{0x977a, 4695},
-	{0x978b, 7799},
-	{0x978d, 5814},
-	{0x978f, 3801},
-	{0x97a0, 3950},
-	{0x97a8, 3509},
-	{0x97ab, 3951},
-	{0x97ad, 7526},
-	{0x97c6, 7166},
-	{0x97cb, 6307},
-	{0x97d3, 7648},
-	{0x97dc, 4308},
-	{0x97f3, 6385},
-	{0x97f6, 5535},
-	{0x97fb, 6249},
-	{0x97ff, 7715},
-	{0x9800, 7839},
-	{0x9801, 7757},
-	{0x9802, 6757},
-	{0x9803, 3701},
-	{0x9805, 7684},
-	{0x9806, 5665},
-	{0x9808, 5624},
-	{0x980a, 6237},
-	{0x980c, 5560},
-	{0x9810, 6048},
-	{0x9811, 6124},
-	{0x9812, 4928},
-	{0x9813, 4328},
-	{0x9817, 7489},
-	{0x9818, 4504},
-	{0x982d, 4357},
-	{0x9830, 7770},
-	{0x9838, 3702},
-	{0x9839, 7464},
-	{0x983b, 5236},
-	{0x9846, 3814},
-	{0x984c, 6780},
-	{0x984d, 5857},
-	{0x984e, 5804},
-	{0x9854, 5815},
-	{0x9858, 6279},
-	{0x985a, 6681},
-	{0x985e, 4590},
-	{0x9865, 7840},
-	{0x9867, 3764},
-	{0x986b, 6682},
-	{0x986f, 7753},
-	{0x98a8, 7595},
-	{0x98af, 5330},
-	{0x98b1, 7444},
-	{0x98c4, 7588},
-	{0x98c7, 7587},
-	{0x98db, 5221},
-	{0x98dc, 5004},
-	{0x98df, 5733},
-	{0x98e1, 5551},
-	{0x98e2, 4120},
-	{0x98ed, 7362},
-	{0x98ee, 6386},
-	{0x98ef, 4929},
-	{0x98f4, 6435},
-	{0x98fc, 5298},
-	{0x98fd, 7569},
-	{0x98fe, 5734},
-	{0x9903, 3890},
-	{0x9909, 7716},
-	{0x990a, 5901},
-	{0x990c, 6436},
-	{0x9910, 7075},
-	{0x9913, 5790},
-	{0x9918, 5946},
-	{0x991e, 6683},
-	{0x9920, 5056},
-	{0x9928, 3834},
-	{0x9945, 4687},
-	{0x9949, 4037},
-	{0x994b, 3989},
-	{0x994c, 7076},
-	{0x994d, 5448},
-	{0x9951, 4121},
-	{0x9952, 6167},
-	{0x9954, 6098},
-	{0x9957, 7717},
-	{0x9996, 5625},
-	{0x9999, 7718},
-	{0x999d, 7613},
-	{0x99a5, 5089},
-	{0x99a8, 7790},
-	{0x99ac, 4661},
-	{0x99ad, 5909},
-	{0x99ae, 7596},
-	{0x99b1, 7392},
-	{0x99b3, 7358},
-	{0x99b4, 5666},
-	{0x99b9, 6468},
-	{0x99c1, 4904},
-	{0x99d0, 6899},
-	{0x99d1, 4174},
-	{0x99d2, 3942},
-	{0x99d5, 3464},
-	{0x99d9, 5149},
-	{0x99dd, 7393},
-	{0x99df, 5299},
-	{0x99ed, 7701},
-	{0x99f1, 4388},
-	{0x99ff, 6920},
-	{0x9a01, 5240},
-	{0x9a08, 5057},
-	{0x9a0e, 4122},
-	{0x9a0f, 4123},
-	{0x9a19, 7527},
-	{0x9a2b, 3612},
-	{0x9a30, 4373},
-	{0x9a36, 7286},
-	{0x9a37, 5536},
-	{0x9a40, 4725},
-	{0x9a43, 7589},
-	{0x9a45, 3943},
-	{0x9a4d, 7965},
-	{0x9a55, 3891},
-	{0x9a57, 7729},
-	{0x9a5a, 3703},
-	{0x9a5b, 5955},
-	{0x9a5f, 7328},
-	{0x9a62, 4454},
-	{0x9a65, 4124},
-	{0x9a69, 7897},
-	{0x9a6a, 4455},
-	{0x9aa8, 3785},
-	{0x9ab8, 7702},
-	{0x9ad3, 5626},
-	{0x9ad4, 7213},
-	{0x9ad8, 3765},
-	{0x9ae5, 5997},
-	{0x9aee, 4939},
-	{0x9b1a, 5627},
-	{0x9b27, 4562},
-	{0x9b2a, 7470},
-	{0x9b31, 6251},
-	{0x9b3c, 3993},
-	{0x9b41, 3863},
-	{0x9b42, 7849},
-	{0x9b43, 4940},
-	{0x9b44, 4995},
-	{0x9b45, 4721},
-	{0x9b4f, 6308},
-	{0x9b54, 4662},
-	{0x9b5a, 5910},
-	{0x9b6f, 4525},
-	{0x9b8e, 6699},
-	{0x9b91, 7570},
-	{0x9b9f, 5816},
-	{0x9bab, 3892},
-	{0x9bae, 5449},
-	{0x9bc9, 4637},
-	{0x9bd6, 7204},
-	{0x9be4, 3783},
-	{0x9be8, 3704},
-	{0x9c0d, 7287},
-	{0x9c10, 5805},
-	{0x9c12, 5090},
-	{0x9c15, 7629},
-	{0x9c25, 7898},
-	{0x9c32, 6076},
-	{0x9c3b, 4688},
-	{0x9c47, 3559},
-	{0x9c49, 5039},
-	{0x9c57, 4645},
-	{0x9ce5, 6827},
-	{0x9ce7, 5150},
-	{0x9ce9, 3944},
-	{0x9cf3, 5108},
-	{0x9cf4, 4762},
-	{0x9cf6, 5984},
-	{0x9d09, 5791},
-	{0x9d1b, 6280},
-	{0x9d26, 5839},
-	{0x9d28, 5832},
-	{0x9d3b, 7862},
-	{0x9d51, 3647},
-	{0x9d5d, 5792},
-	{0x9d60, 3773},
-	{0x9d61, 4833},
-	{0x9d6c, 5180},
-	{0x9d72, 6521},
-	{0x9da9, 4794},
-	{0x9daf, 5860},
-	{0x9db4, 7634},
-	{0x9dc4, 3728},
-	{0x9dd7, 3945},
-	{0x9df2, 7329},
-	{0x9df8, 8012},
-	{0x9df9, 6393},
-	{0x9dfa, 4526},
-	{0x9e1a, 5861},
-	{0x9e1e, 4396},
-	{0x9e75, 4527},
-	{0x9e79, 7662},
-	{0x9e7d, 5998},
-	{0x9e7f, 4533},
-	{0x9e92, 4125},
-	{0x9e93, 4534},
-	{0x9e97, 4456},
-	{0x9e9d, 5300},
-	{0x9e9f, 4646},
-	{0x9ea5, 4726},
-	{0x9eb4, 3952},
-	{0x9eb5, 4745},
-	{0x9ebb, 4663},
-	{0x9ebe, 8004},
-	{0x9ec3, 7927},
-	{0x9ecd, 5401},
-	{0x9ece, 4457},
-	{0x9ed1, 8018},
-	{0x9ed4, 3623},
-	{0x9ed8, 4835},
-	{0x9edb, 4265},
-	{0x9edc, 7305},
-	{0x9ede, 6700},
-	{0x9ee8, 4249},
-	{0x9ef4, 4869},
-	{0x9f07, 6077},
-	{0x9f08, 5040},
-	{0x9f0e, 6758},
-	{0x9f13, 3766},
-	{0x9f20, 5402},
-	{0x9f3b, 5222},
-	{0x9f4a, 6781},
-	{0x9f4b, 6585},
-	{0x9f4e, 6586},
-	{0x9f52, 7359},
-	{0x9f5f, 6618},
-	{0x9f61, 4505},
-	{0x9f67, 5462},
-	{0x9f6a, 7061},
-	{0x9f6c, 5911},
-	{0x9f77, 5806},
-	{0x9f8d, 4563},
-	{0x9f90, 4968},
-	{0x9f95, 3529},
-	{0x9f9c, 3946},
-	{0xac00, 1086},
-	{0xac01, 1087},
-	{0xac02, 9333},
-	{0xac03, 9334},
-	{0xac04, 1088},
-	{0xac05, 9335},
-	{0xac06, 9336},
-	{0xac07, 1089},
-	{0xac08, 1090},
-	{0xac09, 1091},
-	{0xac0a, 1092},
-	{0xac0b, 9337},
-	{0xac0c, 9338},
-	{0xac0d, 9339},
-	{0xac0e, 9340},
-	{0xac0f, 9341},
-	{0xac10, 1093},
-	{0xac11, 1094},
-	{0xac12, 1095},
-	{0xac13, 1096},
-	{0xac14, 1097},
-	{0xac15, 1098},
-	{0xac16, 1099},
-	{0xac17, 1100},
-	{0xac18, 9342},
-	{0xac19, 1101},
-	{0xac1a, 1102},
-	{0xac1b, 1103},
-	{0xac1c, 1104},
-	{0xac1d, 1105},
-	{0xac1e, 9343},
-	{0xac1f, 9344},
-	{0xac20, 1106},
-	{0xac21, 9345},
-	{0xac22, 9346},
-	{0xac23, 9347},
-	{0xac24, 1107},
-	{0xac25, 9348},
-	{0xac26, 9349},
-	{0xac27, 9350},
-	{0xac28, 9351},
-	{0xac29, 9352},
-	{0xac2a, 9353},
-	{0xac2b, 9354},
-	{0xac2c, 1108},
-	{0xac2d, 1109},
-	{0xac2e, 9355},
-	{0xac2f, 1110},
-	{0xac30, 1111},
-	{0xac31, 1112},
-	{0xac32, 9356},
-	{0xac33, 9357},
-	{0xac34, 9358},
-	{0xac35, 9359},
-	{0xac36, 9360},
-	{0xac37, 9361},
-	{0xac38, 1113},
-	{0xac39, 1114},
-	{0xac3a, 9362},
-	{0xac3b, 9363},
-	{0xac3c, 1115},
-	{0xac3d, 9364},
-	{0xac3e, 9365},
-	{0xac3f, 9366},
-	{0xac40, 1116},
-	{0xac41, 9367},
-	{0xac42, 9368},
-	{0xac43, 9369},
-	{0xac44, 9370},
-	{0xac45, 9371},
-	{0xac46, 9372},
-	{0xac47, 9373},
-	{0xac48, 9374},
-	{0xac49, 9375},
-	{0xac4a, 9376},
-	{0xac4b, 1117},
-	{0xac4c, 9377},
-	{0xac4d, 1118},
-	{0xac4e, 9378},
-	{0xac4f, 9379},
-	{0xac50, 9380},
-	{0xac51, 9381},
-	{0xac52, 9382},
-	{0xac53, 9383},
-	{0xac54, 1119},
-	{0xac55, 9384},
-	{0xac56, 9385},
-	{0xac57, 9386},
-	{0xac58, 1120},
-	{0xac59, 9387},
-	{0xac5a, 9388},
-	{0xac5b, 9389},
-	{0xac5c, 1121},
-	{0xac5d, 9390},
-	{0xac5e, 9391},
-	{0xac5f, 9392},
-	{0xac60, 9393},
-	{0xac61, 9394},
-	{0xac62, 9395},
-	{0xac63, 9396},
-	{0xac64, 9397},
-	{0xac65, 9398},
-	{0xac66, 9399},
-	{0xac67, 9400},
-	{0xac68, 9401},
-	{0xac69, 9402},
-	{0xac6a, 9403},
-	{0xac6b, 9404},
-	{0xac6c, 9405},
-	{0xac6d, 9406},
-	{0xac6e, 9407},
-	{0xac6f, 9408},
-	{0xac70, 1122},
-	{0xac71, 1123},
-	{0xac72, 9409},
-	{0xac73, 9410},
-	{0xac74, 1124},
-	{0xac75, 9411},
-	{0xac76, 9412},
-	{0xac77, 1125},
-	{0xac78, 1126},
-	{0xac79, 9413},
-	{0xac7a, 1127},
-	{0xac7b, 9414},
-	{0xac7c, 9415},
-	{0xac7d, 9416},
-	{0xac7e, 9417},
-	{0xac7f, 9418},
-	{0xac80, 1128},
-	{0xac81, 1129},
-	{0xac82, 9419},
-	{0xac83, 1130},
-	{0xac84, 1131},
-	{0xac85, 1132},
-	{0xac86, 1133},
-	{0xac87, 9420},
-	{0xac88, 9421},
-	{0xac89, 1134},
-	{0xac8a, 1135},
-	{0xac8b, 1136},
-	{0xac8c, 1137},
-	{0xac8d, 9422},
-	{0xac8e, 9423},
-	{0xac8f, 9424},
-	{0xac90, 1138},
-	{0xac91, 9425},
-	{0xac92, 9426},
-	{0xac93, 9427},
-	{0xac94, 1139},
-	{0xac95, 9428},
-	{0xac96, 9429},
-	{0xac97, 9430},
-	{0xac98, 9431},
-	{0xac99, 9432},
-	{0xac9a, 9433},
-	{0xac9b, 9434},
-	{0xac9c, 1140},
-	{0xac9d, 1141},
-	{0xac9e, 9435},
-	{0xac9f, 1142},
-	{0xaca0, 1143},
-	{0xaca1, 1144},
-	{0xaca2, 9436},
-	{0xaca3, 9437},
-	{0xaca4, 9438},
-	{0xaca5, 9439},
-	{0xaca6, 9440},
-	{0xaca7, 9441},
-	{0xaca8, 1145},
-	{0xaca9, 1146},
-	{0xacaa, 1147},
-	{0xacab, 9442},
-	{0xacac, 1148},
-	{0xacad, 9443},
-	{0xacae, 9444},
-	{0xacaf, 1149},
-	{0xacb0, 1150},
-	{0xacb1, 9445},
-	{0xacb2, 9446},
-	{0xacb3, 9447},
-	{0xacb4, 9448},
-	{0xacb5, 9449},
-	{0xacb6, 9450},
-	{0xacb7, 9451},
-	{0xacb8, 1151},
-	{0xacb9, 1152},
-	{0xacba, 9452},
-	{0xacbb, 1153},
-	{0xacbc, 1154},
-	{0xacbd, 1155},
-	{0xacbe, 9453},
-	{0xacbf, 9454},
-	{0xacc0, 9455},
-	{0xacc1, 1156},
-	{0xacc2, 9456},
-	{0xacc3, 9457},
-	{0xacc4, 1157},
-	{0xacc5, 9458},
-	{0xacc6, 9459},
-	{0xacc7, 9460},
-	{0xacc8, 1158},
-	{0xacc9, 9461},
-	{0xacca, 9462},
-	{0xaccb, 9463},
-	{0xaccc, 1159},
-	{0xaccd, 9464},
-	{0xacce, 9465},
-	{0xaccf, 9466},
-	{0xacd0, 9467},
-	{0xacd1, 9468},
-	{0xacd2, 9469},
-	{0xacd3, 9470},
-	{0xacd4, 9471},
-	{0xacd5, 1160},
-	{0xacd6, 9472},
-	{0xacd7, 1161},
-	{0xacd8, 9473},
-	{0xacd9, 9474},
-	{0xacda, 9475},
-	{0xacdb, 9476},
-	{0xacdc, 9477},
-	{0xacdd, 9478},
-	{0xacde, 9479},
-	{0xacdf, 9480},
-	{0xace0, 1162},
-	{0xace1, 1163},
-	{0xace2, 9481},
-	{0xace3, 9482},
-	{0xace4, 1164},
-	{0xace5, 9483},
-	{0xace6, 9484},
-	{0xace7, 1165},
-	{0xace8, 1166},
-	{0xace9, 9485},
-	{0xacea, 1167},
-	{0xaceb, 9486},
-	{0xacec, 1168},
-	{0xaced, 9487},
-	{0xacee, 9488},
-	{0xacef, 1169},
-	{0xacf0, 1170},
-	{0xacf1, 1171},
-	{0xacf2, 9489},
-	{0xacf3, 1172},
-	{0xacf4, 9490},
-	{0xacf5, 1173},
-	{0xacf6, 1174},
-	{0xacf7, 9491},
-	{0xacf8, 9492},
-	{0xacf9, 9493},
-	{0xacfa, 9494},
-	{0xacfb, 9495},
-	{0xacfc, 1175},
-	{0xacfd, 1176},
-	{0xacfe, 9496},
-	{0xacff, 9497},
-	{0xad00, 1177},
-	{0xad01, 9498},
-	{0xad02, 9499},
-	{0xad03, 9500},
-	{0xad04, 1178},
-	{0xad05, 9501},
-	{0xad06, 1179},
-	{0xad07, 9502},
-	{0xad08, 9503},
-	{0xad09, 9504},
-	{0xad0a, 9505},
-	{0xad0b, 9506},
-	{0xad0c, 1180},
-	{0xad0d, 1181},
-	{0xad0e, 9507},
-	{0xad0f, 1182},
-	{0xad10, 9508},
-	{0xad11, 1183},
-	{0xad12, 9509},
-	{0xad13, 9510},
-	{0xad14, 9511},
-	{0xad15, 9512},
-	{0xad16, 9513},
-	{0xad17, 9514},
-	{0xad18, 1184},
-	{0xad19, 9515},
-	{0xad1a, 9516},
-	{0xad1b, 9517},
-	{0xad1c, 1185},
-	{0xad1d, 9518},
-	{0xad1e, 9519},
-	{0xad1f, 9520},
-	{0xad20, 1186},
-	{0xad21, 9521},
-	{0xad22, 9522},
-	{0xad23, 9523},
-	{0xad24, 9524},
-	{0xad25, 9525},
-	{0xad26, 9526},
-	{0xad27, 9527},
-	{0xad28, 9528},
-	{0xad29, 1187},
-	{0xad2a, 9529},
-	{0xad2b, 9530},
-	{0xad2c, 1188},
-	{0xad2d, 1189},
-	{0xad2e, 9531},
-	{0xad2f, 9532},
-	{0xad30, 9533},
-	{0xad31, 9534},
-	{0xad32, 9535},
-	{0xad33, 9536},
-	{0xad34, 1190},
-	{0xad35, 1191},
-	{0xad36, 9537},
-	{0xad37, 9538},
-	{0xad38, 1192},
-	{0xad39, 9539},
-	{0xad3a, 9540},
-	{0xad3b, 9541},
-	{0xad3c, 1193},
-	{0xad3d, 9542},
-	{0xad3e, 9543},
-	{0xad3f, 9544},
-	{0xad40, 9545},
-	{0xad41, 9546},
-	{0xad42, 9547},
-	{0xad43, 9548},
-	{0xad44, 1194},
-	{0xad45, 1195},
-	{0xad46, 9549},
-	{0xad47, 1196},
-	{0xad48, 9550},
-	{0xad49, 1197},
-	{0xad4a, 9551},
-	{0xad4b, 9552},
-	{0xad4c, 9553},
-	{0xad4d, 9554},
-	{0xad4e, 9555},
-	{0xad4f, 9556},
-	{0xad50, 1198},
-	{0xad51, 9557},
-	{0xad52, 9558},
-	{0xad53, 9559},
-	{0xad54, 1199},
-	{0xad55, 9560},
-	{0xad56, 9561},
-	{0xad57, 9562},
-	{0xad58, 1200},
-	{0xad59, 9563},
-	{0xad5a, 9564},
-	{0xad5b, 9565},
-	{0xad5c, 9566},
-	{0xad5d, 9567},
-	{0xad5e, 9568},
-	{0xad5f, 9569},
-	{0xad60, 9570},
-	{0xad61, 1201},
-	{0xad62, 9571},
-	{0xad63, 1202},
-	{0xad64, 9572},
-	{0xad65, 9573},
-	{0xad66, 9574},
-	{0xad67, 9575},
-	{0xad68, 9576},
-	{0xad69, 9577},
-	{0xad6a, 9578},
-	{0xad6b, 9579},
-	{0xad6c, 1203},
-	{0xad6d, 1204},
-	{0xad6e, 9580},
-	{0xad6f, 9581},
-	{0xad70, 1205},
-	{0xad71, 9582},
-	{0xad72, 9583},
-	{0xad73, 1206},
-	{0xad74, 1207},
-	{0xad75, 1208},
-	{0xad76, 1209},
-	{0xad77, 9584},
-	{0xad78, 9585},
-	{0xad79, 9586},
-	{0xad7a, 9587},
-	{0xad7b, 1210},
-	{0xad7c, 1211},
-	{0xad7d, 1212},
-	{0xad7e, 9588},
-	{0xad7f, 1213},
-	{0xad80, 9589},
-	{0xad81, 1214},
-	{0xad82, 1215},
-	{0xad83, 9590},
-	{0xad84, 9591},
-	{0xad85, 9592},
-	{0xad86, 9593},
-	{0xad87, 9594},
-	{0xad88, 1216},
-	{0xad89, 1217},
-	{0xad8a, 9595},
-	{0xad8b, 9596},
-	{0xad8c, 1218},
-	{0xad8d, 9597},
-	{0xad8e, 9598},
-	{0xad8f, 9599},
-	{0xad90, 1219},
-	{0xad91, 9600},
-	{0xad92, 9601},
-	{0xad93, 9602},
-	{0xad94, 9603},
-	{0xad95, 9604},
-	{0xad96, 9605},
-	{0xad97, 9606},
-	{0xad98, 9607},
-	{0xad99, 9608},
-	{0xad9a, 9609},
-	{0xad9b, 9610},
-	{0xad9c, 1220},
-	{0xad9d, 1221},
-	{0xad9e, 9611},
-	{0xad9f, 9612},
-	{0xada0, 9613},
-	{0xada1, 9614},
-	{0xada2, 9615},
-	{0xada3, 9616},
-	{0xada4, 1222},
-	{0xada5, 9617},
-	{0xada6, 9618},
-	{0xada7, 9619},
-	{0xada8, 9620},
-	{0xada9, 9621},
-	{0xadaa, 9622},
-	{0xadab, 9623},
-	{0xadac, 9624},
-	{0xadad, 9625},
-	{0xadae, 9626},
-	{0xadaf, 9627},
-	{0xadb0, 9628},
-	{0xadb1, 9629},
-	{0xadb2, 9630},
-	{0xadb3, 9631},
-	{0xadb4, 9632},
-	{0xadb5, 9633},
-	{0xadb6, 9634},
-	{0xadb7, 1223},
-	{0xadb8, 9635},
-	{0xadb9, 9636},
-	{0xadba, 9637},
-	{0xadbb, 9638},
-	{0xadbc, 9639},
-	{0xadbd, 9640},
-	{0xadbe, 9641},
-	{0xadbf, 9642},
-	{0xadc0, 1224},
-	{0xadc1, 1225},
-	{0xadc2, 9643},
-	{0xadc3, 9644},
-	{0xadc4, 1226},
-	{0xadc5, 9645},
-	{0xadc6, 9646},
-	{0xadc7, 9647},
-	{0xadc8, 1227},
-	{0xadc9, 9648},
-	{0xadca, 9649},
-	{0xadcb, 9650},
-	{0xadcc, 9651},
-	{0xadcd, 9652},
-	{0xadce, 9653},
-	{0xadcf, 9654},
-	{0xadd0, 1228},
-	{0xadd1, 1229},
-	{0xadd2, 9655},
-	{0xadd3, 1230},
-	{0xadd4, 9656},
-	{0xadd5, 9657},
-	{0xadd6, 9658},
-	{0xadd7, 9659},
-	{0xadd8, 9660},
-	{0xadd9, 9661},
-	{0xadda, 9662},
-	{0xaddb, 9663},
-	{0xaddc, 1231},
-	{0xaddd, 9664},
-	{0xadde, 9665},
-	{0xaddf, 9666},
-	{0xade0, 1232},
-	{0xade1, 9667},
-	{0xade2, 9668},
-	{0xade3, 9669},
-	{0xade4, 1233},
-	{0xade5, 9670},
-	{0xade6, 9671},
-	{0xade7, 9672},
-	{0xade8, 9673},
-	{0xade9, 9674},
-	{0xadea, 9675},
-	{0xadeb, 9676},
-	{0xadec, 9677},
-	{0xaded, 9678},
-	{0xadee, 9679},
-	{0xadef, 9680},
-	{0xadf0, 9681},
-	{0xadf1, 9682},
-	{0xadf2, 9683},
-	{0xadf3, 9684},
-	{0xadf4, 9685},
-	{0xadf5, 9686},
-	{0xadf6, 9687},
-	{0xadf7, 9688},
-	{0xadf8, 1234},
-	{0xadf9, 1235},
-	{0xadfa, 9689},
-	{0xadfb, 9690},
-	{0xadfc, 1236},
-	{0xadfd, 9691},
-	{0xadfe, 9692},
-	{0xadff, 1237},
-	{0xae00, 1238},
-	{0xae01, 1239},
-	{0xae02, 9693},
-	{0xae03, 9694},
-	{0xae04, 9695},
-	{0xae05, 9696},
-	{0xae06, 9697},
-	{0xae07, 9698},
-	{0xae08, 1240},
-	{0xae09, 1241},
-	{0xae0a, 9699},
-	{0xae0b, 1242},
-	{0xae0c, 9700},
-	{0xae0d, 1243},
-	{0xae0e, 9701},
-	{0xae0f, 9702},
-	{0xae10, 9703},
-	{0xae11, 9704},
-	{0xae12, 9705},
-	{0xae13, 9706},
-	{0xae14, 1244},
-	{0xae15, 9707},
-	{0xae16, 9708},
-	{0xae17, 9709},
-	{0xae18, 9710},
-	{0xae19, 9711},
-	{0xae1a, 9712},
-	{0xae1b, 9713},
-	{0xae1c, 9714},
-	{0xae1d, 9715},
-	{0xae1e, 9716},
-	{0xae1f, 9717},
-	{0xae20, 9718},
-	{0xae21, 9719},
-	{0xae22, 9720},
-	{0xae23, 9721},
-	{0xae24, 9722},
-	{0xae25, 9723},
-	{0xae26, 9724},
-	{0xae27, 9725},
-	{0xae28, 9726},
-	{0xae29, 9727},
-	{0xae2a, 9728},
-	{0xae2b, 9729},
-	{0xae2c, 9730},
-	{0xae2d, 9731},
-	{0xae2e, 9732},
-	{0xae2f, 9733},
-	{0xae30, 1245},
-	{0xae31, 1246},
-	{0xae32, 9734},
-	{0xae33, 9735},
-	{0xae34, 1247},
-	{0xae35, 9736},
-	{0xae36, 9737},
-	{0xae37, 1248},
-	{0xae38, 1249},
-	{0xae39, 9738},
-	{0xae3a, 1250},
-	{0xae3b, 9739},
-	{0xae3c, 9740},
-	{0xae3d, 9741},
-	{0xae3e, 9742},
-	{0xae3f, 9743},
-	{0xae40, 1251},
-	{0xae41, 1252},
-	{0xae42, 9744},
-	{0xae43, 1253},
-	{0xae44, 9745},
-	{0xae45, 1254},
-	{0xae46, 1255},
-	{0xae47, 9746},
-	{0xae48, 9747},
-	{0xae49, 9748},
-	{0xae4a, 1256},
-	{0xae4b, 9749},
-	{0xae4c, 1257},
-	{0xae4d, 1258},
-	{0xae4e, 1259},
-	{0xae4f, 9750},
-	{0xae50, 1260},
-	{0xae51, 9751},
-	{0xae52, 9752},
-	{0xae53, 9753},
-	{0xae54, 1261},
-	{0xae55, 9754},
-	{0xae56, 1262},
-	{0xae57, 9755},
-	{0xae58, 9756},
-	{0xae59, 9757},
-	{0xae5a, 9758},
-	{0xae5b, 9759},
-	{0xae5c, 1263},
-	{0xae5d, 1264},
-	{0xae5e, 9760},
-	{0xae5f, 1265},
-	{0xae60, 1266},
-	{0xae61, 1267},
-	{0xae62, 9761},
-	{0xae63, 9762},
-	{0xae64, 9763},
-	{0xae65, 1268},
-	{0xae66, 9764},
-	{0xae67, 9765},
-	{0xae68, 1269},
-	{0xae69, 1270},
-	{0xae6a, 9766},
-	{0xae6b, 9767},
-	{0xae6c, 1271},
-	{0xae6d, 9768},
-	{0xae6e, 9769},
-	{0xae6f, 9770},
-	{0xae70, 1272},
-	{0xae71, 9771},
-	{0xae72, 9772},
-	{0xae73, 9773},
-	{0xae74, 9774},
-	{0xae75, 9775},
-	{0xae76, 9776},
-	{0xae77, 9777},
-	{0xae78, 1273},
-	{0xae79, 1274},
-	{0xae7a, 9778},
-	{0xae7b, 1275},
-	{0xae7c, 1276},
-	{0xae7d, 1277},
-	{0xae7e, 9779},
-	{0xae7f, 9780},
-	{0xae80, 9781},
-	{0xae81, 9782},
-	{0xae82, 9783},
-	{0xae83, 9784},
-	{0xae84, 1278},
-	{0xae85, 1279},
-	{0xae86, 9785},
-	{0xae87, 9786},
-	{0xae88, 9787},
-	{0xae89, 9788},
-	{0xae8a, 9789},
-	{0xae8b, 9790},
-	{0xae8c, 1280},
-	{0xae8d, 9791},
-	{0xae8e, 9792},
-	{0xae8f, 9793},
-	{0xae90, 9794},
-	{0xae91, 9795},
-	{0xae92, 9796},
-	{0xae93, 9797},
-	{0xae94, 9798},
-	{0xae95, 9799},
-	{0xae96, 9800},
-	{0xae97, 9801},
-	{0xae98, 9802},
-	{0xae99, 9803},
-	{0xae9a, 9804},
-	{0xae9b, 9805},
-	{0xae9c, 9806},
-	{0xae9d, 9807},
-	{0xae9e, 9808},
-	{0xae9f, 9809},
-	{0xaea0, 9810},
-	{0xaea1, 9811},
-	{0xaea2, 9812},
-	{0xaea3, 9813},
-	{0xaea4, 9814},
-	{0xaea5, 9815},
-	{0xaea6, 9816},
-	{0xaea7, 9817},
-	{0xaea8, 9818},
-	{0xaea9, 9819},
-	{0xaeaa, 9820},
-	{0xaeab, 9821},
-	{0xaeac, 9822},
-	{0xaead, 9823},
-	{0xaeae, 9824},
-	{0xaeaf, 9825},
-	{0xaeb0, 9826},
-	{0xaeb1, 9827},
-	{0xaeb2, 9828},
-	{0xaeb3, 9829},
-	{0xaeb4, 9830},
-	{0xaeb5, 9831},
-	{0xaeb6, 9832},
-	{0xaeb7, 9833},
-	{0xaeb8, 9834},
-	{0xaeb9, 9835},
-	{0xaeba, 9836},
-	{0xaebb, 9837},
-	{0xaebc, 1281},
-	{0xaebd, 1282},
-	{0xaebe, 1283},
-	{0xaebf, 9838},
-	{0xaec0, 1284},
-	{0xaec1, 9839},
-	{0xaec2, 9840},
-	{0xaec3, 9841},
-	{0xaec4, 1285},
-	{0xaec5, 9842},
-	{0xaec6, 9843},
-	{0xaec7, 9844},
-	{0xaec8, 9845},
-	{0xaec9, 9846},
-	{0xaeca, 9847},
-	{0xaecb, 9848},
-	{0xaecc, 1286},
-	{0xaecd, 1287},
-	{0xaece, 9849},
-	{0xaecf, 1288},
-	{0xaed0, 1289},
-	{0xaed1, 1290},
-	{0xaed2, 9850},
-	{0xaed3, 9851},
-	{0xaed4, 9852},
-	{0xaed5, 9853},
-	{0xaed6, 9854},
-	{0xaed7, 9855},
-	{0xaed8, 1291},
-	{0xaed9, 1292},
-	{0xaeda, 9856},
-	{0xaedb, 9857},
-	{0xaedc, 1293},
-	{0xaedd, 9858},
-	{0xaede, 9859},
-	{0xaedf, 9860},
-	{0xaee0, 9861},
-	{0xaee1, 9862},
-	{0xaee2, 9863},
-	{0xaee3, 9864},
-	{0xaee4, 9865},
-	{0xaee5, 9866},
-	{0xaee6, 9867},
-	{0xaee7, 9868},
-	{0xaee8, 1294},
-	{0xaee9, 9869},
-	{0xaeea, 9870},
-	{0xaeeb, 1295},
-	{0xaeec, 9871},
-	{0xaeed, 1296},
-	{0xaeee, 9872},
-	{0xaeef, 9873},
-	{0xaef0, 9874},
-	{0xaef1, 9875},
-	{0xaef2, 9876},
-	{0xaef3, 9877},
-	{0xaef4, 1297},
-	{0xaef5, 9878},
-	{0xaef6, 9879},
-	{0xaef7, 9880},
-	{0xaef8, 1298},
-	{0xaef9, 9881},
-	{0xaefa, 9882},
-	{0xaefb, 9883},
-	{0xaefc, 1299},
-	{0xaefd, 9884},
-	{0xaefe, 9885},
-	{0xaeff, 9886},
-	{0xaf00, 9887},
-	{0xaf01, 9888},
-	{0xaf02, 9889},
-	{0xaf03, 9890},
-	{0xaf04, 9891},
-	{0xaf05, 9892},
-	{0xaf06, 9893},
-	{0xaf07, 1300},
-	{0xaf08, 1301},
-	{0xaf09, 9894},
-	{0xaf0a, 9895},
-	{0xaf0b, 9896},
-	{0xaf0c, 9897},
-	{0xaf0d, 1302},
-	{0xaf0e, 9898},
-	{0xaf0f, 9899},
-	{0xaf10, 1303},
-	{0xaf11, 9900},
-	{0xaf12, 9901},
-	{0xaf13, 9902},
-	{0xaf14, 9903},
-	{0xaf15, 9904},
-	{0xaf16, 9905},
-	{0xaf17, 9906},
-	{0xaf18, 9907},
-	{0xaf19, 9908},
-	{0xaf1a, 9909},
-	{0xaf1b, 9910},
-	{0xaf1c, 9911},
-	{0xaf1d, 9912},
-	{0xaf1e, 9913},
-	{0xaf1f, 9914},
-	{0xaf20, 9915},
-	{0xaf21, 9916},
-	{0xaf22, 9917},
-	{0xaf23, 9918},
-	{0xaf24, 9919},
-	{0xaf25, 9920},
-	{0xaf26, 9921},
-	{0xaf27, 9922},
-	{0xaf28, 9923},
-	{0xaf29, 9924},
-	{0xaf2a, 9925},
-	{0xaf2b, 9926},
-	{0xaf2c, 1304},
-	{0xaf2d, 1305},
-	{0xaf2e, 9927},
-	{0xaf2f, 9928},
-	{0xaf30, 1306},
-	{0xaf31, 9929},
-	{0xaf32, 1307},
-	{0xaf33, 9930},
-	{0xaf34, 1308},
-	{0xaf35, 9931},
-	{0xaf36, 9932},
-	{0xaf37, 9933},
-	{0xaf38, 9934},
-	{0xaf39, 9935},
-	{0xaf3a, 9936},
-	{0xaf3b, 9937},
-	{0xaf3c, 1309},
-	{0xaf3d, 1310},
-	{0xaf3e, 9938},
-	{0xaf3f, 1311},
-	{0xaf40, 9939},
-	{0xaf41, 1312},
-	{0xaf42, 1313},
-	{0xaf43, 1314},
-	{0xaf44, 9940},
-	{0xaf45, 9941},
-	{0xaf46, 9942},
-	{0xaf47, 9943},
-	{0xaf48, 1315},
-	{0xaf49, 1316},
-	{0xaf4a, 9944},
-	{0xaf4b, 9945},
-	{0xaf4c, 9946},
-	{0xaf4d, 9947},
-	{0xaf4e, 9948},
-	{0xaf4f, 9949},
-	{0xaf50, 1317},
-	{0xaf51, 9950},
-	{0xaf52, 9951},
-	{0xaf53, 9952},
-	{0xaf54, 9953},
-	{0xaf55, 9954},
-	{0xaf56, 9955},
-	{0xaf57, 9956},
-	{0xaf58, 9957},
-	{0xaf59, 9958},
-	{0xaf5a, 9959},
-	{0xaf5b, 9960},
-	{0xaf5c, 1318},
-	{0xaf5d, 1319},
-	{0xaf5e, 9961},
-	{0xaf5f, 9962},
-	{0xaf60, 9963},
-	{0xaf61, 9964},
-	{0xaf62, 9965},
-	{0xaf63, 9966},
-	{0xaf64, 1320},
-	{0xaf65, 1321},
-	{0xaf66, 9967},
-	{0xaf67, 9968},
-	{0xaf68, 9969},
-	{0xaf69, 9970},
-	{0xaf6a, 9971},
-	{0xaf6b, 9972},
-	{0xaf6c, 9973},
-	{0xaf6d, 9974},
-	{0xaf6e, 9975},
-	{0xaf6f, 9976},
-	{0xaf70, 9977},
-	{0xaf71, 9978},
-	{0xaf72, 9979},
-	{0xaf73, 9980},
-	{0xaf74, 9981},
-	{0xaf75, 9982},
-	{0xaf76, 9983},
-	{0xaf77, 9984},
-	{0xaf78, 9985},
-	{0xaf79, 1322},
-	{0xaf7a, 9986},
-	{0xaf7b, 9987},
-	{0xaf7c, 9988},
-	{0xaf7d, 9989},
-	{0xaf7e, 9990},
-	{0xaf7f, 9991},
-	{0xaf80, 1323},
-	{0xaf81, 9992},
-	{0xaf82, 9993},
-	{0xaf83, 9994},
-	{0xaf84, 1324},
-	{0xaf85, 9995},
-	{0xaf86, 9996},
-	{0xaf87, 9997},
-	{0xaf88, 1325},
-	{0xaf89, 9998},
-	{0xaf8a, 9999},
-	{0xaf8b, 10000},
-	{0xaf8c, 10001},
-	{0xaf8d, 10002},
-	{0xaf8e, 10003},
-	{0xaf8f, 10004},
-	{0xaf90, 1326},
-	{0xaf91, 1327},
-	{0xaf93, 0},
-	{0xaf94, 1},
-	{0xaf95, 1328},
-	{0xaf97, 0},
-	{0xaf98, 1},
-	{0xaf99, 2},
-	{0xaf9a, 3},
-	{0xaf9b, 4},
-	{0xaf9c, 1329},
-	{0xaf9e, 0},
-	{0xaf9f, 1},
-	{0xafa0, 2},
-	{0xafa1, 3},
-	{0xafa2, 4},
-	{0xafa3, 5},
-	{0xafa4, 6},
-	{0xafa5, 7},
-	{0xafa6, 8},
-	{0xafa7, 9},
-	{0xafa8, 10},
-	{0xafa9, 11},
-	{0xafaa, 12},
-	{0xafab, 13},
-	{0xafac, 14},
-	{0xafad, 15},
-	{0xafae, 16},
-	{0xafaf, 17},
-	{0xafb0, 18},
-	{0xafb1, 19},
-	{0xafb2, 20},
-	{0xafb3, 21},
-	{0xafb4, 22},
-	{0xafb5, 23},
-	{0xafb6, 24},
-	{0xafb7, 25},
-	{0xafb8, 1330},
-	{0xafb9, 1331},
-	{0xafbb, 0},
-	{0xafbc, 1332},
-	{0xafbe, 0},
-	{0xafbf, 1},
-	{0xafc0, 1333},
-	{0xafc2, 0},
-	{0xafc3, 1},
-	{0xafc4, 2},
-	{0xafc5, 3},
-	{0xafc6, 4},
-	{0xafc7, 1334},
-	{0xafc8, 1335},
-	{0xafc9, 1336},
-	{0xafcb, 1337},
-	{0xafcd, 1338},
-	{0xafce, 1339},
-	{0xafd0, 0},
-	{0xafd1, 1},
-	{0xafd2, 2},
-	{0xafd3, 3},
-	{0xafd4, 1340},
-	{0xafd6, 0},
-	{0xafd7, 1},
-	{0xafd8, 2},
-	{0xafd9, 3},
-	{0xafda, 4},
-	{0xafdb, 5},
-	{0xafdc, 1341},
-	{0xafde, 0},
-	{0xafdf, 1},
-	{0xafe0, 2},
-	{0xafe1, 3},
-	{0xafe2, 4},
-	{0xafe3, 5},
-	{0xafe4, 6},
-	{0xafe5, 7},
-	{0xafe6, 8},
-	{0xafe7, 9},
-	{0xafe8, 1342},
-	{0xafe9, 1343},
-	{0xafeb, 0},
-	{0xafec, 1},
-	{0xafed, 2},
-	{0xafee, 3},
-	{0xafef, 4},
-	{0xaff0, 1344},
-	{0xaff1, 1345},
-	{0xaff3, 0},
-	{0xaff4, 1346},
-	{0xaff6, 0},
-	{0xaff7, 1},
-	{0xaff8, 1347},
-	{0xaffa, 0},
-	{0xaffb, 1},
-	{0xaffc, 2},
-	{0xaffd, 3},
-	{0xaffe, 4},
-	{0xafff, 5},
-	{0xb000, 1348},
-	{0xb001, 1349},
-	{0xb003, 0},
-	{0xb004, 1350},
-	{0xb006, 0},
-	{0xb007, 1},
-	{0xb008, 2},
-	{0xb009, 3},
-	{0xb00a, 4},
-	{0xb00b, 5},
-	{0xb00c, 1351},
-	{0xb00e, 0},
-	{0xb00f, 1},
-	{0xb010, 1352},
-	{0xb012, 0},
-	{0xb013, 1},
-	{0xb014, 1353},
-	{0xb016, 0},
-	{0xb017, 1},
-	{0xb018, 2},
-	{0xb019, 3},
-	{0xb01a, 4},
-	{0xb01b, 5},
-	{0xb01c, 1354},
-	{0xb01d, 1355},
-	{0xb01f, 0},
-	{0xb020, 1},
-	{0xb021, 2},
-	{0xb022, 3},
-	{0xb023, 4},
-	{0xb024, 5},
-	{0xb025, 6},
-	{0xb026, 7},
-	{0xb027, 8},
-	{0xb028, 1356},
-	{0xb02a, 0},
-	{0xb02b, 1},
-	{0xb02c, 2},
-	{0xb02d, 3},
-	{0xb02e, 4},
-	{0xb02f, 5},
-	{0xb030, 6},
-	{0xb031, 7},
-	{0xb032, 8},
-	{0xb033, 9},
-	{0xb034, 10},
-	{0xb035, 11},
-	{0xb036, 12},
-	{0xb037, 13},
-	{0xb038, 14},
-	{0xb039, 15},
-	{0xb03a, 16},
-	{0xb03b, 17},
-	{0xb03c, 18},
-	{0xb03d, 19},
-	{0xb03e, 20},
-	{0xb03f, 21},
-	{0xb040, 22},
-	{0xb041, 23},
-	{0xb042, 24},
-	{0xb043, 25},
-	{0xb044, 1357},
-	{0xb045, 1358},
-	{0xb047, 0},
-	{0xb048, 1359},
-	{0xb04a, 1360},
-	{0xb04c, 1361},
-	{0xb04e, 1362},
-	{0xb050, 0},
-	{0xb051, 1},
-	{0xb052, 2},
-	{0xb053, 1363},
-	{0xb054, 1364},
-	{0xb055, 1365},
-	{0xb057, 1366},
-	{0xb059, 1367},
-	{0xb05b, 0},
-	{0xb05c, 1},
-	{0xb05d, 1368},
-	{0xb05f, 0},
-	{0xb060, 1},
-	{0xb061, 2},
-	{0xb062, 3},
-	{0xb063, 4},
-	{0xb064, 5},
-	{0xb065, 6},
-	{0xb066, 7},
-	{0xb067, 8},
-	{0xb068, 9},
-	{0xb069, 10},
-	{0xb06a, 11},
-	{0xb06b, 12},
-	{0xb06c, 13},
-	{0xb06d, 14},
-	{0xb06e, 15},
-	{0xb06f, 16},
-	{0xb070, 17},
-	{0xb071, 18},
-	{0xb072, 19},
-	{0xb073, 20},
-	{0xb074, 21},
-	{0xb075, 22},
-	{0xb076, 23},
-	{0xb077, 24},
-	{0xb078, 25},
-	{0xb079, 26},
-	{0xb07a, 27},
-	{0xb07b, 28},
-	{0xb07c, 1369},
-	{0xb07d, 1370},
-	{0xb07f, 0},
-	{0xb080, 1371},
-	{0xb082, 0},
-	{0xb083, 1},
-	{0xb084, 1372},
-	{0xb086, 0},
-	{0xb087, 1},
-	{0xb088, 2},
-	{0xb089, 3},
-	{0xb08a, 4},
-	{0xb08b, 5},
-	{0xb08c, 1373},
-	{0xb08d, 1374},
-	{0xb08f, 1375},
-	{0xb091, 1376},
-	{0xb093, 0},
-	{0xb094, 1},
-	{0xb095, 2},
-	{0xb096, 3},
-	{0xb097, 4},
-	{0xb098, 1377},
-	{0xb099, 1378},
-	{0xb09a, 1379},
-	{0xb09c, 1380},
-	{0xb09e, 0},
-	{0xb09f, 1381},
-	{0xb0a0, 1382},
-	{0xb0a1, 1383},
-	{0xb0a2, 1384},
-	{0xb0a4, 0},
-	{0xb0a5, 1},
-	{0xb0a6, 2},
-	{0xb0a7, 3},
-	{0xb0a8, 1385},
-	{0xb0a9, 1386},
-	{0xb0ab, 1387},
-	{0xb0ac, 1388},
-	{0xb0ad, 1389},
-	{0xb0ae, 1390},
-	{0xb0af, 1391},
-	{0xb0b1, 1392},
-	{0xb0b3, 1393},
-	{0xb0b4, 1394},
-	{0xb0b5, 1395},
-	{0xb0b7, 0},
-	{0xb0b8, 1396},
-	{0xb0ba, 0},
-	{0xb0bb, 1},
-	{0xb0bc, 1397},
-	{0xb0be, 0},
-	{0xb0bf, 1},
-	{0xb0c0, 2},
-	{0xb0c1, 3},
-	{0xb0c2, 4},
-	{0xb0c3, 5},
-	{0xb0c4, 1398},
-	{0xb0c5, 1399},
-	{0xb0c7, 1400},
-	{0xb0c8, 1401},
-	{0xb0c9, 1402},
-	{0xb0cb, 0},
-	{0xb0cc, 1},
-	{0xb0cd, 2},
-	{0xb0ce, 3},
-	{0xb0cf, 4},
-	{0xb0d0, 1403},
-	{0xb0d1, 1404},
-	{0xb0d3, 0},
-	{0xb0d4, 1405},
-	{0xb0d6, 0},
-	{0xb0d7, 1},
-	{0xb0d8, 1406},
-	{0xb0da, 0},
-	{0xb0db, 1},
-	{0xb0dc, 2},
-	{0xb0dd, 3},
-	{0xb0de, 4},
-	{0xb0df, 5},
-	{0xb0e0, 1407},
-	{0xb0e2, 0},
-	{0xb0e3, 1},
-	{0xb0e4, 2},
-	{0xb0e5, 1408},
-	{0xb0e7, 0},
-	{0xb0e8, 1},
-	{0xb0e9, 2},
-	{0xb0ea, 3},
-	{0xb0eb, 4},
-	{0xb0ec, 5},
-	{0xb0ed, 6},
-	{0xb0ee, 7},
-	{0xb0ef, 8},
-	{0xb0f0, 9},
-	{0xb0f1, 10},
-	{0xb0f2, 11},
-	{0xb0f3, 12},
-	{0xb0f4, 13},
-	{0xb0f5, 14},
-	{0xb0f6, 15},
-	{0xb0f7, 16},
-	{0xb0f8, 17},
-	{0xb0f9, 18},
-	{0xb0fa, 19},
-	{0xb0fb, 20},
-	{0xb0fc, 21},
-	{0xb0fd, 22},
-	{0xb0fe, 23},
-	{0xb0ff, 24},
-	{0xb101, 0},
-	{0xb102, 1},
-	{0xb103, 2},
-	{0xb104, 3},
-	{0xb105, 4},
-	{0xb106, 5},
-	{0xb107, 6},
-	{0xb108, 1409},
-	{0xb109, 1410},
-	{0xb10b, 1411},
-	{0xb10c, 1412},
-	{0xb10e, 0},
-	{0xb10f, 1},
-	{0xb110, 1413},
-	{0xb112, 1414},
-	{0xb113, 1415},
-	{0xb115, 0},
-	{0xb116, 1},
-	{0xb117, 2},
-	{0xb118, 1416},
-	{0xb119, 1417},
-	{0xb11b, 1418},
-	{0xb11c, 1419},
-	{0xb11d, 1420},
-	{0xb11f, 0},
-	{0xb120, 1},
-	{0xb121, 2},
-	{0xb122, 3},
-	{0xb123, 1421},
-	{0xb124, 1422},
-	{0xb125, 1423},
-	{0xb127, 0},
-	{0xb128, 1424},
-	{0xb12a, 0},
-	{0xb12b, 1},
-	{0xb12c, 1425},
-	{0xb12e, 0},
-	{0xb12f, 1},
-	{0xb130, 2},
-	{0xb131, 3},
-	{0xb132, 4},
-	{0xb133, 5},
-	{0xb134, 1426},
-	{0xb135, 1427},
-	{0xb137, 1428},
-	{0xb138, 1429},
-	{0xb139, 1430},
-	{0xb13b, 0},
-	{0xb13c, 1},
-	{0xb13d, 2},
-	{0xb13e, 3},
-	{0xb13f, 4},
-	{0xb140, 1431},
-	{0xb141, 1432},
-	{0xb143, 0},
-	{0xb144, 1433},
-	{0xb146, 0},
-	{0xb147, 1},
-	{0xb148, 1434},
-	{0xb14a, 0},
-	{0xb14b, 1},
-	{0xb14c, 2},
-	{0xb14d, 3},
-	{0xb14e, 4},
-	{0xb14f, 5},
-	{0xb150, 1435},
-	{0xb151, 1436},
-	{0xb153, 0},
-	{0xb154, 1437},
-	{0xb155, 1438},
-	{0xb157, 0},
-	{0xb158, 1439},
-	{0xb15a, 0},
-	{0xb15b, 1},
-	{0xb15c, 1440},
-	{0xb15e, 0},
-	{0xb15f, 1},
-	{0xb160, 1441},
-	{0xb162, 0},
-	{0xb163, 1},
-	{0xb164, 2},
-	{0xb165, 3},
-	{0xb166, 4},
-	{0xb167, 5},
-	{0xb168, 6},
-	{0xb169, 7},
-	{0xb16a, 8},
-	{0xb16b, 9},
-	{0xb16c, 10},
-	{0xb16d, 11},
-	{0xb16e, 12},
-	{0xb16f, 13},
-	{0xb170, 14},
-	{0xb171, 15},
-	{0xb172, 16},
-	{0xb173, 17},
-	{0xb174, 18},
-	{0xb175, 19},
-	{0xb176, 20},
-	{0xb177, 21},
-	{0xb178, 1442},
-	{0xb179, 1443},
-	{0xb17b, 0},
-	{0xb17c, 1444},
-	{0xb17e, 0},
-	{0xb17f, 1},
-	{0xb180, 1445},
-	{0xb182, 1446},
-	{0xb184, 0},
-	{0xb185, 1},
-	{0xb186, 2},
-	{0xb187, 3},
-	{0xb188, 1447},
-	{0xb189, 1448},
-	{0xb18b, 1449},
-	{0xb18d, 1450},
-	{0xb18f, 0},
-	{0xb190, 1},
-	{0xb191, 2},
-	{0xb192, 1451},
-	{0xb193, 1452},
-	{0xb194, 1453},
-	{0xb196, 0},
-	{0xb197, 1},
-	{0xb198, 1454},
-	{0xb19a, 0},
-	{0xb19b, 1},
-	{0xb19c, 1455},
-	{0xb19e, 0},
-	{0xb19f, 1},
-	{0xb1a0, 2},
-	{0xb1a1, 3},
-	{0xb1a2, 4},
-	{0xb1a3, 5},
-	{0xb1a4, 6},
-	{0xb1a5, 7},
-	{0xb1a6, 8},
-	{0xb1a7, 9},
-	{0xb1a8, 1456},
-	{0xb1aa, 0},
-	{0xb1ab, 1},
-	{0xb1ac, 2},
-	{0xb1ad, 3},
-	{0xb1ae, 4},
-	{0xb1af, 5},
-	{0xb1b0, 6},
-	{0xb1b1, 7},
-	{0xb1b2, 8},
-	{0xb1b3, 9},
-	{0xb1b4, 10},
-	{0xb1b5, 11},
-	{0xb1b6, 12},
-	{0xb1b7, 13},
-	{0xb1b8, 14},
-	{0xb1b9, 15},
-	{0xb1ba, 16},
-	{0xb1bb, 17},
-	{0xb1bc, 18},
-	{0xb1bd, 19},
-	{0xb1be, 20},
-	{0xb1bf, 21},
-	{0xb1c0, 22},
-	{0xb1c1, 23},
-	{0xb1c2, 24},
-	{0xb1c3, 25},
-	{0xb1c4, 26},
-	{0xb1c5, 27},
-	{0xb1c6, 28},
-	{0xb1c7, 29},
-	{0xb1c8, 30},
-	{0xb1c9, 31},
-	{0xb1ca, 32},
-	{0xb1cb, 33},
-	{0xb1cc, 1457},
-	{0xb1ce, 0},
-	{0xb1cf, 1},
-	{0xb1d0, 1458},
-	{0xb1d2, 0},
-	{0xb1d3, 1},
-	{0xb1d4, 1459},
-	{0xb1d6, 0},
-	{0xb1d7, 1},
-	{0xb1d8, 2},
-	{0xb1d9, 3},
-	{0xb1da, 4},
-	{0xb1db, 5},
-	{0xb1dc, 1460},
-	{0xb1dd, 1461},
-	{0xb1df, 1462},
-	{0xb1e1, 0},
-	{0xb1e2, 1},
-	{0xb1e3, 2},
-	{0xb1e4, 3},
-	{0xb1e5, 4},
-	{0xb1e6, 5},
-	{0xb1e7, 6},
-	{0xb1e8, 1463},
-	{0xb1e9, 1464},
-	{0xb1eb, 0},
-	{0xb1ec, 1465},
-	{0xb1ee, 0},
-	{0xb1ef, 1},
-	{0xb1f0, 1466},
-	{0xb1f2, 0},
-	{0xb1f3, 1},
-	{0xb1f4, 2},
-	{0xb1f5, 3},
-	{0xb1f6, 4},
-	{0xb1f7, 5},
-	{0xb1f8, 6},
-	{0xb1f9, 1467},
-	{0xb1fb, 1468},
-	{0xb1fd, 1469},
-	{0xb1ff, 0},
-	{0xb201, 0},
-	{0xb202, 1},
-	{0xb203, 2},
-	{0xb204, 1470},
-	{0xb205, 1471},
-	{0xb207, 0},
-	{0xb208, 1472},
-	{0xb20a, 0},
-	{0xb20b, 1473},
-	{0xb20c, 1474},
-	{0xb20e, 0},
-	{0xb20f, 1},
-	{0xb210, 2},
-	{0xb211, 3},
-	{0xb212, 4},
-	{0xb213, 5},
-	{0xb214, 1475},
-	{0xb215, 1476},
-	{0xb217, 1477},
-	{0xb219, 1478},
-	{0xb21b, 0},
-	{0xb21c, 1},
-	{0xb21d, 2},
-	{0xb21e, 3},
-	{0xb21f, 4},
-	{0xb220, 1479},
-	{0xb222, 0},
-	{0xb223, 1},
-	{0xb224, 2},
-	{0xb225, 3},
-	{0xb226, 4},
-	{0xb227, 5},
-	{0xb228, 6},
-	{0xb229, 7},
-	{0xb22a, 8},
-	{0xb22b, 9},
-	{0xb22c, 10},
-	{0xb22d, 11},
-	{0xb22e, 12},
-	{0xb22f, 13},
-	{0xb230, 14},
-	{0xb231, 15},
-	{0xb232, 16},
-	{0xb233, 17},
-	{0xb234, 1480},
-	{0xb236, 0},
-	{0xb237, 1},
-	{0xb238, 2},
-	{0xb239, 3},
-	{0xb23a, 4},
-	{0xb23b, 5},
-	{0xb23c, 1481},
-	{0xb23e, 0},
-	{0xb23f, 1},
-	{0xb240, 2},
-	{0xb241, 3},
-	{0xb242, 4},
-	{0xb243, 5},
-	{0xb244, 6},
-	{0xb245, 7},
-	{0xb246, 8},
-	{0xb247, 9},
-	{0xb248, 10},
-	{0xb249, 11},
-	{0xb24a, 12},
-	{0xb24b, 13},
-	{0xb24c, 14},
-	{0xb24d, 15},
-	{0xb24e, 16},
-	{0xb24f, 17},
-	{0xb250, 18},
-	{0xb251, 19},
-	{0xb252, 20},
-	{0xb253, 21},
-	{0xb254, 22},
-	{0xb255, 23},
-	{0xb256, 24},
-	{0xb257, 25},
-	{0xb258, 1482},
-	{0xb25a, 0},
-	{0xb25b, 1},
-	{0xb25c, 1483},
-	{0xb25e, 0},
-	{0xb25f, 1},
-	{0xb260, 1484},
-	{0xb262, 0},
-	{0xb263, 1},
-	{0xb264, 2},
-	{0xb265, 3},
-	{0xb266, 4},
-	{0xb267, 5},
-	{0xb268, 1485},
-	{0xb269, 1486},
-	{0xb26b, 0},
-	{0xb26c, 1},
-	{0xb26d, 2},
-	{0xb26e, 3},
-	{0xb26f, 4},
-	{0xb270, 5},
-	{0xb271, 6},
-	{0xb272, 7},
-	{0xb273, 8},
-	{0xb274, 1487},
-	{0xb275, 1488},
-	{0xb277, 0},
-	{0xb278, 1},
-	{0xb279, 2},
-	{0xb27a, 3},
-	{0xb27b, 4},
-	{0xb27c, 1489},
-	{0xb27e, 0},
-	{0xb27f, 1},
-	{0xb280, 2},
-	{0xb281, 3},
-	{0xb282, 4},
-	{0xb283, 5},
-	{0xb284, 1490},
-	{0xb285, 1491},
-	{0xb287, 0},
-	{0xb288, 1},
-	{0xb289, 1492},
-	{0xb28b, 0},
-	{0xb28c, 1},
-	{0xb28d, 2},
-	{0xb28e, 3},
-	{0xb28f, 4},
-	{0xb290, 1493},
-	{0xb291, 1494},
-	{0xb293, 0},
-	{0xb294, 1495},
-	{0xb296, 0},
-	{0xb297, 1},
-	{0xb298, 1496},
-	{0xb299, 1497},
-	{0xb29a, 1498},
-	{0xb29c, 0},
-	{0xb29d, 1},
-	{0xb29e, 2},
-	{0xb29f, 3},
-	{0xb2a0, 1499},
-	{0xb2a1, 1500},
-	{0xb2a3, 1501},
-	{0xb2a5, 1502},
-	{0xb2a6, 1503},
-	{0xb2a8, 0},
-	{0xb2a9, 1},
-	{0xb2aa, 1504},
-	{0xb2ac, 1505},
-	{0xb2ae, 0},
-	{0xb2af, 1},
-	{0xb2b0, 1506},
-	{0xb2b2, 0},
-	{0xb2b3, 1},
-	{0xb2b4, 1507},
-	{0xb2b6, 0},
-	{0xb2b7, 1},
-	{0xb2b8, 2},
-	{0xb2b9, 3},
-	{0xb2ba, 4},
-	{0xb2bb, 5},
-	{0xb2bc, 6},
-	{0xb2bd, 7},
-	{0xb2be, 8},
-	{0xb2bf, 9},
-	{0xb2c0, 10},
-	{0xb2c1, 11},
-	{0xb2c2, 12},
-	{0xb2c3, 13},
-	{0xb2c4, 14},
-	{0xb2c5, 15},
-	{0xb2c6, 16},
-	{0xb2c7, 17},
-	{0xb2c8, 1508},
-	{0xb2c9, 1509},
-	{0xb2cb, 0},
-	{0xb2cc, 1510},
-	{0xb2ce, 0},
-	{0xb2cf, 1},
-	{0xb2d0, 1511},
-	{0xb2d2, 1512},
-	{0xb2d4, 0},
-	{0xb2d5, 1},
-	{0xb2d6, 2},
-	{0xb2d7, 3},
-	{0xb2d8, 1513},
-	{0xb2d9, 1514},
-	{0xb2db, 1515},
-	{0xb2dd, 1516},
-	{0xb2df, 0},
-	{0xb2e0, 1},
-	{0xb2e1, 2},
-	{0xb2e2, 1517},
-	{0xb2e4, 1518},
-	{0xb2e5, 1519},
-	{0xb2e6, 1520},
-	{0xb2e8, 1521},
-	{0xb2ea, 0},
-	{0xb2eb, 1522},
-	{0xb2ec, 1523},
-	{0xb2ed, 1524},
-	{0xb2ee, 1525},
-	{0xb2ef, 1526},
-	{0xb2f1, 0},
-	{0xb2f2, 1},
-	{0xb2f3, 1527},
-	{0xb2f4, 1528},
-	{0xb2f5, 1529},
-	{0xb2f7, 1530},
-	{0xb2f8, 1531},
-	{0xb2f9, 1532},
-	{0xb2fa, 1533},
-	{0xb2fb, 1534},
-	{0xb2fd, 0},
-	{0xb2fe, 1},
-	{0xb2ff, 1535},
-	{0xb300, 1536},
-	{0xb301, 1537},
-	{0xb303, 0},
-	{0xb304, 1538},
-	{0xb306, 0},
-	{0xb307, 1},
-	{0xb308, 1539},
-	{0xb30a, 0},
-	{0xb30b, 1},
-	{0xb30c, 2},
-	{0xb30d, 3},
-	{0xb30e, 4},
-	{0xb30f, 5},
-	{0xb310, 1540},
-	{0xb311, 1541},
-	{0xb313, 1542},
-	{0xb314, 1543},
-	{0xb315, 1544},
-	{0xb317, 0},
-	{0xb318, 1},
-	{0xb319, 2},
-	{0xb31a, 3},
-	{0xb31b, 4},
-	{0xb31c, 1545},
-	{0xb31e, 0},
-	{0xb31f, 1},
-	{0xb320, 2},
-	{0xb321, 3},
-	{0xb322, 4},
-	{0xb323, 5},
-	{0xb324, 6},
-	{0xb325, 7},
-	{0xb326, 8},
-	{0xb327, 9},
-	{0xb328, 10},
-	{0xb329, 11},
-	{0xb32a, 12},
-	{0xb32b, 13},
-	{0xb32c, 14},
-	{0xb32d, 15},
-	{0xb32e, 16},
-	{0xb32f, 17},
-	{0xb330, 18},
-	{0xb331, 19},
-	{0xb332, 20},
-	{0xb333, 21},
-	{0xb334, 22},
-	{0xb335, 23},
-	{0xb336, 24},
-	{0xb337, 25},
-	{0xb338, 26},
-	{0xb339, 27},
-	{0xb33a, 28},
-	{0xb33b, 29},
-	{0xb33c, 30},
-	{0xb33d, 31},
-	{0xb33e, 32},
-	{0xb33f, 33},
-	{0xb340, 34},
-	{0xb341, 35},
-	{0xb342, 36},
-	{0xb343, 37},
-	{0xb344, 38},
-	{0xb345, 39},
-	{0xb346, 40},
-	{0xb347, 41},
-	{0xb348, 42},
-	{0xb349, 43},
-	{0xb34a, 44},
-	{0xb34b, 45},
-	{0xb34c, 46},
-	{0xb34d, 47},
-	{0xb34e, 48},
-	{0xb34f, 49},
-	{0xb350, 50},
-	{0xb351, 51},
-	{0xb352, 52},
-	{0xb353, 53},
-	{0xb354, 1546},
-	{0xb355, 1547},
-	{0xb356, 1548},
-	{0xb358, 1549},
-	{0xb35a, 0},
-	{0xb35b, 1550},
-	{0xb35c, 1551},
-	{0xb35e, 1552},
-	{0xb35f, 1553},
-	{0xb361, 0},
-	{0xb362, 1},
-	{0xb363, 2},
-	{0xb364, 1554},
-	{0xb365, 1555},
-	{0xb367, 1556},
-	{0xb369, 1557},
-	{0xb36b, 1558},
-	{0xb36d, 0},
-	{0xb36e, 1559},
-	{0xb370, 1560},
-	{0xb371, 1561},
-	{0xb373, 0},
-	{0xb374, 1562},
-	{0xb376, 0},
-	{0xb377, 1},
-	{0xb378, 1563},
-	{0xb37a, 0},
-	{0xb37b, 1},
-	{0xb37c, 2},
-	{0xb37d, 3},
-	{0xb37e, 4},
-	{0xb37f, 5},
-	{0xb380, 1564},
-	{0xb381, 1565},
-	{0xb383, 1566},
-	{0xb384, 1567},
-	{0xb385, 1568},
-	{0xb387, 0},
-	{0xb388, 1},
-	{0xb389, 2},
-	{0xb38a, 3},
-	{0xb38b, 4},
-	{0xb38c, 1569},
-	{0xb38e, 0},
-	{0xb38f, 1},
-	{0xb390, 1570},
-	{0xb392, 0},
-	{0xb393, 1},
-	{0xb394, 1571},
-	{0xb396, 0},
-	{0xb397, 1},
-	{0xb398, 2},
-	{0xb399, 3},
-	{0xb39a, 4},
-	{0xb39b, 5},
-	{0xb39c, 6},
-	{0xb39d, 7},
-	{0xb39e, 8},
-	{0xb39f, 9},
-	{0xb3a0, 1572},
-	{0xb3a1, 1573},
-	{0xb3a3, 0},
-	{0xb3a4, 1},
-	{0xb3a5, 2},
-	{0xb3a6, 3},
-	{0xb3a7, 4},
-	{0xb3a8, 1574},
-	{0xb3aa, 0},
-	{0xb3ab, 1},
-	{0xb3ac, 1575},
-	{0xb3ae, 0},
-	{0xb3af, 1},
-	{0xb3b0, 2},
-	{0xb3b1, 3},
-	{0xb3b2, 4},
-	{0xb3b3, 5},
-	{0xb3b4, 6},
-	{0xb3b5, 7},
-	{0xb3b6, 8},
-	{0xb3b7, 9},
-	{0xb3b8, 10},
-	{0xb3b9, 11},
-	{0xb3ba, 12},
-	{0xb3bb, 13},
-	{0xb3bc, 14},
-	{0xb3bd, 15},
-	{0xb3be, 16},
-	{0xb3bf, 17},
-	{0xb3c0, 18},
-	{0xb3c1, 19},
-	{0xb3c2, 20},
-	{0xb3c3, 21},
-	{0xb3c4, 1576},
-	{0xb3c5, 1577},
-	{0xb3c7, 0},
-	{0xb3c8, 1578},
-	{0xb3ca, 0},
-	{0xb3cb, 1579},
-	{0xb3cc, 1580},
-	{0xb3ce, 1581},
-	{0xb3d0, 1582},
-	{0xb3d2, 0},
-	{0xb3d3, 1},
-	{0xb3d4, 1583},
-	{0xb3d5, 1584},
-	{0xb3d7, 1585},
-	{0xb3d9, 1586},
-	{0xb3db, 1587},
-	{0xb3dd, 1588},
-	{0xb3df, 0},
-	{0xb3e0, 1589},
-	{0xb3e2, 0},
-	{0xb3e3, 1},
-	{0xb3e4, 1590},
-	{0xb3e6, 0},
-	{0xb3e7, 1},
-	{0xb3e8, 1591},
-	{0xb3ea, 0},
-	{0xb3eb, 1},
-	{0xb3ec, 2},
-	{0xb3ed, 3},
-	{0xb3ee, 4},
-	{0xb3ef, 5},
-	{0xb3f0, 6},
-	{0xb3f1, 7},
-	{0xb3f2, 8},
-	{0xb3f3, 9},
-	{0xb3f4, 10},
-	{0xb3f5, 11},
-	{0xb3f6, 12},
-	{0xb3f7, 13},
-	{0xb3f8, 14},
-	{0xb3f9, 15},
-	{0xb3fa, 16},
-	{0xb3fb, 17},
-	{0xb3fc, 1592},
-	{0xb3fe, 0},
-	{0xb3ff, 1},
-	{0xb401, 0},
-	{0xb402, 1},
-	{0xb403, 2},
-	{0xb404, 3},
-	{0xb405, 4},
-	{0xb406, 5},
-	{0xb407, 6},
-	{0xb408, 7},
-	{0xb409, 8},
-	{0xb40a, 9},
-	{0xb40b, 10},
-	{0xb40c, 11},
-	{0xb40d, 12},
-	{0xb40e, 13},
-	{0xb40f, 14},
-	{0xb410, 1593},
-	{0xb412, 0},
-	{0xb413, 1},
-	{0xb414, 2},
-	{0xb415, 3},
-	{0xb416, 4},
-	{0xb417, 5},
-	{0xb418, 1594},
-	{0xb41a, 0},
-	{0xb41b, 1},
-	{0xb41c, 1595},
-	{0xb41e, 0},
-	{0xb41f, 1},
-	{0xb420, 1596},
-	{0xb422, 0},
-	{0xb423, 1},
-	{0xb424, 2},
-	{0xb425, 3},
-	{0xb426, 4},
-	{0xb427, 5},
-	{0xb428, 1597},
-	{0xb429, 1598},
-	{0xb42b, 1599},
-	{0xb42d, 0},
-	{0xb42e, 1},
-	{0xb42f, 2},
-	{0xb430, 3},
-	{0xb431, 4},
-	{0xb432, 5},
-	{0xb433, 6},
-	{0xb434, 1600},
-	{0xb436, 0},
-	{0xb437, 1},
-	{0xb438, 2},
-	{0xb439, 3},
-	{0xb43a, 4},
-	{0xb43b, 5},
-	{0xb43c, 6},
-	{0xb43d, 7},
-	{0xb43e, 8},
-	{0xb43f, 9},
-	{0xb440, 10},
-	{0xb441, 11},
-	{0xb442, 12},
-	{0xb443, 13},
-	{0xb444, 14},
-	{0xb445, 15},
-	{0xb446, 16},
-	{0xb447, 17},
-	{0xb448, 18},
-	{0xb449, 19},
-	{0xb44a, 20},
-	{0xb44b, 21},
-	{0xb44c, 22},
-	{0xb44d, 23},
-	{0xb44e, 24},
-	{0xb44f, 25},
-	{0xb450, 1601},
-	{0xb451, 1602},
-	{0xb453, 0},
-	{0xb454, 1603},
-	{0xb456, 0},
-	{0xb457, 1},
-	{0xb458, 1604},
-	{0xb45a, 0},
-	{0xb45b, 1},
-	{0xb45c, 2},
-	{0xb45d, 3},
-	{0xb45e, 4},
-	{0xb45f, 5},
-	{0xb460, 1605},
-	{0xb461, 1606},
-	{0xb463, 1607},
-	{0xb465, 1608},
-	{0xb467, 0},
-	{0xb468, 1},
-	{0xb469, 2},
-	{0xb46a, 3},
-	{0xb46b, 4},
-	{0xb46c, 1609},
-	{0xb46e, 0},
-	{0xb46f, 1},
-	{0xb470, 2},
-	{0xb471, 3},
-	{0xb472, 4},
-	{0xb473, 5},
-	{0xb474, 6},
-	{0xb475, 7},
-	{0xb476, 8},
-	{0xb477, 9},
-	{0xb478, 10},
-	{0xb479, 11},
-	{0xb47a, 12},
-	{0xb47b, 13},
-	{0xb47c, 14},
-	{0xb47d, 15},
-	{0xb47e, 16},
-	{0xb47f, 17},
-	{0xb480, 1610},
-	{0xb482, 0},
-	{0xb483, 1},
-	{0xb484, 2},
-	{0xb485, 3},
-	{0xb486, 4},
-	{0xb487, 5},
-	{0xb488, 1611},
-	{0xb48a, 0},
-	{0xb48b, 1},
-	{0xb48c, 2},
-	{0xb48d, 3},
-	{0xb48e, 4},
-	{0xb48f, 5},
-	{0xb490, 6},
-	{0xb491, 7},
-	{0xb492, 8},
-	{0xb493, 9},
-	{0xb494, 10},
-	{0xb495, 11},
-	{0xb496, 12},
-	{0xb497, 13},
-	{0xb498, 14},
-	{0xb499, 15},
-	{0xb49a, 16},
-	{0xb49b, 17},
-	{0xb49c, 18},
-	{0xb49d, 1612},
-	{0xb49f, 0},
-	{0xb4a0, 1},
-	{0xb4a1, 2},
-	{0xb4a2, 3},
-	{0xb4a3, 4},
-	{0xb4a4, 1613},
-	{0xb4a6, 0},
-	{0xb4a7, 1},
-	{0xb4a8, 1614},
-	{0xb4aa, 0},
-	{0xb4ab, 1},
-	{0xb4ac, 1615},
-	{0xb4ae, 0},
-	{0xb4af, 1},
-	{0xb4b0, 2},
-	{0xb4b1, 3},
-	{0xb4b2, 4},
-	{0xb4b3, 5},
-	{0xb4b4, 6},
-	{0xb4b5, 1616},
-	{0xb4b7, 1617},
-	{0xb4b9, 1618},
-	{0xb4bb, 0},
-	{0xb4bc, 1},
-	{0xb4bd, 2},
-	{0xb4be, 3},
-	{0xb4bf, 4},
-	{0xb4c0, 1619},
-	{0xb4c2, 0},
-	{0xb4c3, 1},
-	{0xb4c4, 1620},
-	{0xb4c6, 0},
-	{0xb4c7, 1},
-	{0xb4c8, 1621},
-	{0xb4ca, 0},
-	{0xb4cb, 1},
-	{0xb4cc, 2},
-	{0xb4cd, 3},
-	{0xb4ce, 4},
-	{0xb4cf, 5},
-	{0xb4d0, 1622},
-	{0xb4d2, 0},
-	{0xb4d3, 1},
-	{0xb4d4, 2},
-	{0xb4d5, 1623},
-	{0xb4d7, 0},
-	{0xb4d8, 1},
-	{0xb4d9, 2},
-	{0xb4da, 3},
-	{0xb4db, 4},
-	{0xb4dc, 1624},
-	{0xb4dd, 1625},
-	{0xb4df, 0},
-	{0xb4e0, 1626},
-	{0xb4e2, 0},
-	{0xb4e3, 1627},
-	{0xb4e4, 1628},
-	{0xb4e6, 1629},
-	{0xb4e8, 0},
-	{0xb4e9, 1},
-	{0xb4ea, 2},
-	{0xb4eb, 3},
-	{0xb4ec, 1630},
-	{0xb4ed, 1631},
-	{0xb4ef, 1632},
-	{0xb4f1, 1633},
-	{0xb4f3, 0},
-	{0xb4f4, 1},
-	{0xb4f5, 2},
-	{0xb4f6, 3},
-	{0xb4f7, 4},
-	{0xb4f8, 1634},
-	{0xb4fa, 0},
-	{0xb4fb, 1},
-	{0xb4fc, 2},
-	{0xb4fd, 3},
-	{0xb4fe, 4},
-	{0xb4ff, 5},
-	{0xb501, 0},
-	{0xb502, 1},
-	{0xb503, 2},
-	{0xb504, 3},
-	{0xb505, 4},
-	{0xb506, 5},
-	{0xb507, 6},
-	{0xb508, 7},
-	{0xb509, 8},
-	{0xb50a, 9},
-	{0xb50b, 10},
-	{0xb50c, 11},
-	{0xb50d, 12},
-	{0xb50e, 13},
-	{0xb50f, 14},
-	{0xb510, 15},
-	{0xb511, 16},
-	{0xb512, 17},
-	{0xb513, 18},
-	{0xb514, 1635},
-	{0xb515, 1636},
-	{0xb517, 0},
-	{0xb518, 1637},
-	{0xb51a, 0},
-	{0xb51b, 1638},
-	{0xb51c, 1639},
-	{0xb51e, 0},
-	{0xb51f, 1},
-	{0xb520, 2},
-	{0xb521, 3},
-	{0xb522, 4},
-	{0xb523, 5},
-	{0xb524, 1640},
-	{0xb525, 1641},
-	{0xb527, 1642},
-	{0xb528, 1643},
-	{0xb529, 1644},
-	{0xb52a, 1645},
-	{0xb52c, 0},
-	{0xb52d, 1},
-	{0xb52e, 2},
-	{0xb52f, 3},
-	{0xb530, 1646},
-	{0xb531, 1647},
-	{0xb533, 0},
-	{0xb534, 1648},
-	{0xb536, 0},
-	{0xb537, 1},
-	{0xb538, 1649},
-	{0xb53a, 0},
-	{0xb53b, 1},
-	{0xb53c, 2},
-	{0xb53d, 3},
-	{0xb53e, 4},
-	{0xb53f, 5},
-	{0xb540, 1650},
-	{0xb541, 1651},
-	{0xb543, 1652},
-	{0xb544, 1653},
-	{0xb545, 1654},
-	{0xb547, 0},
-	{0xb548, 1},
-	{0xb549, 2},
-	{0xb54a, 3},
-	{0xb54b, 1655},
-	{0xb54c, 1656},
-	{0xb54d, 1657},
-	{0xb54f, 0},
-	{0xb550, 1658},
-	{0xb552, 0},
-	{0xb553, 1},
-	{0xb554, 1659},
-	{0xb556, 0},
-	{0xb557, 1},
-	{0xb558, 2},
-	{0xb559, 3},
-	{0xb55a, 4},
-	{0xb55b, 5},
-	{0xb55c, 1660},
-	{0xb55d, 1661},
-	{0xb55f, 1662},
-	{0xb560, 1663},
-	{0xb561, 1664},
-	{0xb563, 0},
-	{0xb564, 1},
-	{0xb565, 2},
-	{0xb566, 3},
-	{0xb567, 4},
-	{0xb568, 5},
-	{0xb569, 6},
-	{0xb56a, 7},
-	{0xb56b, 8},
-	{0xb56c, 9},
-	{0xb56d, 10},
-	{0xb56e, 11},
-	{0xb56f, 12},
-	{0xb570, 13},
-	{0xb571, 14},
-	{0xb572, 15},
-	{0xb573, 16},
-	{0xb574, 17},
-	{0xb575, 18},
-	{0xb576, 19},
-	{0xb577, 20},
-	{0xb578, 21},
-	{0xb579, 22},
-	{0xb57a, 23},
-	{0xb57b, 24},
-	{0xb57c, 25},
-	{0xb57d, 26},
-	{0xb57e, 27},
-	{0xb57f, 28},
-	{0xb580, 29},
-	{0xb581, 30},
-	{0xb582, 31},
-	{0xb583, 32},
-	{0xb584, 33},
-	{0xb585, 34},
-	{0xb586, 35},
-	{0xb587, 36},
-	{0xb588, 37},
-	{0xb589, 38},
-	{0xb58a, 39},
-	{0xb58b, 40},
-	{0xb58c, 41},
-	{0xb58d, 42},
-	{0xb58e, 43},
-	{0xb58f, 44},
-	{0xb590, 45},
-	{0xb591, 46},
-	{0xb592, 47},
-	{0xb593, 48},
-	{0xb594, 49},
-	{0xb595, 50},
-	{0xb596, 51},
-	{0xb597, 52},
-	{0xb598, 53},
-	{0xb599, 54},
-	{0xb59a, 55},
-	{0xb59b, 56},
-	{0xb59c, 57},
-	{0xb59d, 58},
-	{0xb59e, 59},
-	{0xb59f, 60},
-	{0xb5a0, 1665},
-	{0xb5a1, 1666},
-	{0xb5a3, 0},
-	{0xb5a4, 1667},
-	{0xb5a6, 0},
-	{0xb5a7, 1},
-	{0xb5a8, 1668},
-	{0xb5aa, 1669},
-	{0xb5ab, 1670},
-	{0xb5ad, 0},
-	{0xb5ae, 1},
-	{0xb5af, 2},
-	{0xb5b0, 1671},
-	{0xb5b1, 1672},
-	{0xb5b3, 1673},
-	{0xb5b4, 1674},
-	{0xb5b5, 1675},
-	{0xb5b7, 0},
-	{0xb5b8, 1},
-	{0xb5b9, 2},
-	{0xb5ba, 3},
-	{0xb5bb, 1676},
-	{0xb5bc, 1677},
-	{0xb5bd, 1678},
-	{0xb5bf, 0},
-	{0xb5c0, 1679},
-	{0xb5c2, 0},
-	{0xb5c3, 1},
-	{0xb5c4, 1680},
-	{0xb5c6, 0},
-	{0xb5c7, 1},
-	{0xb5c8, 2},
-	{0xb5c9, 3},
-	{0xb5ca, 4},
-	{0xb5cb, 5},
-	{0xb5cc, 1681},
-	{0xb5cd, 1682},
-	{0xb5cf, 1683},
-	{0xb5d0, 1684},
-	{0xb5d1, 1685},
-	{0xb5d3, 0},
-	{0xb5d4, 1},
-	{0xb5d5, 2},
-	{0xb5d6, 3},
-	{0xb5d7, 4},
-	{0xb5d8, 1686},
-	{0xb5da, 0},
-	{0xb5db, 1},
-	{0xb5dc, 2},
-	{0xb5dd, 3},
-	{0xb5de, 4},
-	{0xb5df, 5},
-	{0xb5e0, 6},
-	{0xb5e1, 7},
-	{0xb5e2, 8},
-	{0xb5e3, 9},
-	{0xb5e4, 10},
-	{0xb5e5, 11},
-	{0xb5e6, 12},
-	{0xb5e7, 13},
-	{0xb5e8, 14},
-	{0xb5e9, 15},
-	{0xb5ea, 16},
-	{0xb5eb, 17},
-	{0xb5ec, 1687},
-	{0xb5ee, 0},
-	{0xb5ef, 1},
-	{0xb5f0, 2},
-	{0xb5f1, 3},
-	{0xb5f2, 4},
-	{0xb5f3, 5},
-	{0xb5f4, 6},
-	{0xb5f5, 7},
-	{0xb5f6, 8},
-	{0xb5f7, 9},
-	{0xb5f8, 10},
-	{0xb5f9, 11},
-	{0xb5fa, 12},
-	{0xb5fb, 13},
-	{0xb5fc, 14},
-	{0xb5fd, 15},
-	{0xb5fe, 16},
-	{0xb5ff, 17},
-	{0xb601, 0},
-	{0xb602, 1},
-	{0xb603, 2},
-	{0xb604, 3},
-	{0xb605, 4},
-	{0xb606, 5},
-	{0xb607, 6},
-	{0xb608, 7},
-	{0xb609, 8},
-	{0xb60a, 9},
-	{0xb60b, 10},
-	{0xb60c, 11},
-	{0xb60d, 12},
-	{0xb60e, 13},
-	{0xb60f, 14},
-	{0xb610, 1688},
-	{0xb611, 1689},
-	{0xb613, 0},
-	{0xb614, 1690},
-	{0xb616, 0},
-	{0xb617, 1},
-	{0xb618, 1691},
-	{0xb61a, 0},
-	{0xb61b, 1},
-	{0xb61c, 2},
-	{0xb61d, 3},
-	{0xb61e, 4},
-	{0xb61f, 5},
-	{0xb620, 6},
-	{0xb621, 7},
-	{0xb622, 8},
-	{0xb623, 9},
-	{0xb624, 10},
-	{0xb625, 1692},
-	{0xb627, 0},
-	{0xb628, 1},
-	{0xb629, 2},
-	{0xb62a, 3},
-	{0xb62b, 4},
-	{0xb62c, 1693},
-	{0xb62e, 0},
-	{0xb62f, 1},
-	{0xb630, 2},
-	{0xb631, 3},
-	{0xb632, 4},
-	{0xb633, 5},
-	{0xb634, 1694},
-	{0xb636, 0},
-	{0xb637, 1},
-	{0xb638, 2},
-	{0xb639, 3},
-	{0xb63a, 4},
-	{0xb63b, 5},
-	{0xb63c, 6},
-	{0xb63d, 7},
-	{0xb63e, 8},
-	{0xb63f, 9},
-	{0xb640, 10},
-	{0xb641, 11},
-	{0xb642, 12},
-	{0xb643, 13},
-	{0xb644, 14},
-	{0xb645, 15},
-	{0xb646, 16},
-	{0xb647, 17},
-	{0xb648, 1695},
-	{0xb64a, 0},
-	{0xb64b, 1},
-	{0xb64c, 2},
-	{0xb64d, 3},
-	{0xb64e, 4},
-	{0xb64f, 5},
-	{0xb650, 6},
-	{0xb651, 7},
-	{0xb652, 8},
-	{0xb653, 9},
-	{0xb654, 10},
-	{0xb655, 11},
-	{0xb656, 12},
-	{0xb657, 13},
-	{0xb658, 14},
-	{0xb659, 15},
-	{0xb65a, 16},
-	{0xb65b, 17},
-	{0xb65c, 18},
-	{0xb65d, 19},
-	{0xb65e, 20},
-	{0xb65f, 21},
-	{0xb660, 22},
-	{0xb661, 23},
-	{0xb662, 24},
-	{0xb663, 25},
-	{0xb664, 1696},
-	{0xb666, 0},
-	{0xb667, 1},
-	{0xb668, 1697},
-	{0xb66a, 0},
-	{0xb66b, 1},
-	{0xb66c, 2},
-	{0xb66d, 3},
-	{0xb66e, 4},
-	{0xb66f, 5},
-	{0xb670, 6},
-	{0xb671, 7},
-	{0xb672, 8},
-	{0xb673, 9},
-	{0xb674, 10},
-	{0xb675, 11},
-	{0xb676, 12},
-	{0xb677, 13},
-	{0xb678, 14},
-	{0xb679, 15},
-	{0xb67a, 16},
-	{0xb67b, 17},
-	{0xb67c, 18},
-	{0xb67d, 19},
-	{0xb67e, 20},
-	{0xb67f, 21},
-	{0xb680, 22},
-	{0xb681, 23},
-	{0xb682, 24},
-	{0xb683, 25},
-	{0xb684, 26},
-	{0xb685, 27},
-	{0xb686, 28},
-	{0xb687, 29},
-	{0xb688, 30},
-	{0xb689, 31},
-	{0xb68a, 32},
-	{0xb68b, 33},
-	{0xb68c, 34},
-	{0xb68d, 35},
-	{0xb68e, 36},
-	{0xb68f, 37},
-	{0xb690, 38},
-	{0xb691, 39},
-	{0xb692, 40},
-	{0xb693, 41},
-	{0xb694, 42},
-	{0xb695, 43},
-	{0xb696, 44},
-	{0xb697, 45},
-	{0xb698, 46},
-	{0xb699, 47},
-	{0xb69a, 48},
-	{0xb69b, 49},
-	{0xb69c, 1698},
-	{0xb69d, 1699},
-	{0xb69f, 0},
-	{0xb6a0, 1700},
-	{0xb6a2, 0},
-	{0xb6a3, 1},
-	{0xb6a4, 1701},
-	{0xb6a6, 0},
-	{0xb6a7, 1},
-	{0xb6a8, 2},
-	{0xb6a9, 3},
-	{0xb6aa, 4},
-	{0xb6ab, 1702},
-	{0xb6ac, 1703},
-	{0xb6ae, 0},
-	{0xb6af, 1},
-	{0xb6b0, 2},
-	{0xb6b1, 1704},
-	{0xb6b3, 0},
-	{0xb6b4, 1},
-	{0xb6b5, 2},
-	{0xb6b6, 3},
-	{0xb6b7, 4},
-	{0xb6b8, 5},
-	{0xb6b9, 6},
-	{0xb6ba, 7},
-	{0xb6bb, 8},
-	{0xb6bc, 9},
-	{0xb6bd, 10},
-	{0xb6be, 11},
-	{0xb6bf, 12},
-	{0xb6c0, 13},
-	{0xb6c1, 14},
-	{0xb6c2, 15},
-	{0xb6c3, 16},
-	{0xb6c4, 17},
-	{0xb6c5, 18},
-	{0xb6c6, 19},
-	{0xb6c7, 20},
-	{0xb6c8, 21},
-	{0xb6c9, 22},
-	{0xb6ca, 23},
-	{0xb6cb, 24},
-	{0xb6cc, 25},
-	{0xb6cd, 26},
-	{0xb6ce, 27},
-	{0xb6cf, 28},
-	{0xb6d0, 29},
-	{0xb6d1, 30},
-	{0xb6d2, 31},
-	{0xb6d3, 32},
-	{0xb6d4, 1705},
-	{0xb6d6, 0},
-	{0xb6d7, 1},
-	{0xb6d8, 2},
-	{0xb6d9, 3},
-	{0xb6da, 4},
-	{0xb6db, 5},
-	{0xb6dc, 6},
-	{0xb6dd, 7},
-	{0xb6de, 8},
-	{0xb6df, 9},
-	{0xb6e0, 10},
-	{0xb6e1, 11},
-	{0xb6e2, 12},
-	{0xb6e3, 13},
-	{0xb6e4, 14},
-	{0xb6e5, 15},
-	{0xb6e6, 16},
-	{0xb6e7, 17},
-	{0xb6e8, 18},
-	{0xb6e9, 19},
-	{0xb6ea, 20},
-	{0xb6eb, 21},
-	{0xb6ec, 22},
-	{0xb6ed, 23},
-	{0xb6ee, 24},
-	{0xb6ef, 25},
-	{0xb6f0, 1706},
-	{0xb6f2, 0},
-	{0xb6f3, 1},
-	{0xb6f4, 1707},
-	{0xb6f6, 0},
-	{0xb6f7, 1},
-	{0xb6f8, 1708},
-	{0xb6fa, 0},
-	{0xb6fb, 1},
-	{0xb6fc, 2},
-	{0xb6fd, 3},
-	{0xb6fe, 4},
-	{0xb6ff, 5},
-	{0xb700, 1709},
-	{0xb701, 1710},
-	{0xb703, 0},
-	{0xb704, 1},
-	{0xb705, 1711},
-	{0xb707, 0},
-	{0xb708, 1},
-	{0xb709, 2},
-	{0xb70a, 3},
-	{0xb70b, 4},
-	{0xb70c, 5},
-	{0xb70d, 6},
-	{0xb70e, 7},
-	{0xb70f, 8},
-	{0xb710, 9},
-	{0xb711, 10},
-	{0xb712, 11},
-	{0xb713, 12},
-	{0xb714, 13},
-	{0xb715, 14},
-	{0xb716, 15},
-	{0xb717, 16},
-	{0xb718, 17},
-	{0xb719, 18},
-	{0xb71a, 19},
-	{0xb71b, 20},
-	{0xb71c, 21},
-	{0xb71d, 22},
-	{0xb71e, 23},
-	{0xb71f, 24},
-	{0xb720, 25},
-	{0xb721, 26},
-	{0xb722, 27},
-	{0xb723, 28},
-	{0xb724, 29},
-	{0xb725, 30},
-	{0xb726, 31},
-	{0xb727, 32},
-	{0xb728, 1712},
-	{0xb729, 1713},
-	{0xb72b, 0},
-	{0xb72c, 1714},
-	{0xb72e, 0},
-	{0xb72f, 1715},
-	{0xb730, 1716},
-	{0xb732, 0},
-	{0xb733, 1},
-	{0xb734, 2},
-	{0xb735, 3},
-	{0xb736, 4},
-	{0xb737, 5},
-	{0xb738, 1717},
-	{0xb739, 1718},
-	{0xb73b, 1719},
-	{0xb73d, 0},
-	{0xb73e, 1},
-	{0xb73f, 2},
-	{0xb740, 3},
-	{0xb741, 4},
-	{0xb742, 5},
-	{0xb743, 6},
-	{0xb744, 1720},
-	{0xb746, 0},
-	{0xb747, 1},
-	{0xb748, 1721},
-	{0xb74a, 0},
-	{0xb74b, 1},
-	{0xb74c, 1722},
-	{0xb74e, 0},
-	{0xb74f, 1},
-	{0xb750, 2},
-	{0xb751, 3},
-	{0xb752, 4},
-	{0xb753, 5},
-	{0xb754, 1723},
-	{0xb755, 1724},
-	{0xb757, 0},
-	{0xb758, 1},
-	{0xb759, 2},
-	{0xb75a, 3},
-	{0xb75b, 4},
-	{0xb75c, 5},
-	{0xb75d, 6},
-	{0xb75e, 7},
-	{0xb75f, 8},
-	{0xb760, 1725},
-	{0xb762, 0},
-	{0xb763, 1},
-	{0xb764, 1726},
-	{0xb766, 0},
-	{0xb767, 1},
-	{0xb768, 1727},
-	{0xb76a, 0},
-	{0xb76b, 1},
-	{0xb76c, 2},
-	{0xb76d, 3},
-	{0xb76e, 4},
-	{0xb76f, 5},
-	{0xb770, 1728},
-	{0xb771, 1729},
-	{0xb773, 1730},
-	{0xb775, 1731},
-	{0xb777, 0},
-	{0xb778, 1},
-	{0xb779, 2},
-	{0xb77a, 3},
-	{0xb77b, 4},
-	{0xb77c, 1732},
-	{0xb77d, 1733},
-	{0xb77f, 0},
-	{0xb780, 1734},
-	{0xb782, 0},
-	{0xb783, 1},
-	{0xb784, 1735},
-	{0xb786, 0},
-	{0xb787, 1},
-	{0xb788, 2},
-	{0xb789, 3},
-	{0xb78a, 4},
-	{0xb78b, 5},
-	{0xb78c, 1736},
-	{0xb78d, 1737},
-	{0xb78f, 1738},
-	{0xb790, 1739},
-	{0xb791, 1740},
-	{0xb792, 1741},
-	{0xb794, 0},
-	{0xb795, 1},
-	{0xb796, 1742},
-	{0xb797, 1743},
-	{0xb798, 1744},
-	{0xb799, 1745},
-	{0xb79b, 0},
-	{0xb79c, 1746},
-	{0xb79e, 0},
-	{0xb79f, 1},
-	{0xb7a0, 1747},
-	{0xb7a2, 0},
-	{0xb7a3, 1},
-	{0xb7a4, 2},
-	{0xb7a5, 3},
-	{0xb7a6, 4},
-	{0xb7a7, 5},
-	{0xb7a8, 1748},
-	{0xb7a9, 1749},
-	{0xb7ab, 1750},
-	{0xb7ac, 1751},
-	{0xb7ad, 1752},
-	{0xb7af, 0},
-	{0xb7b0, 1},
-	{0xb7b1, 2},
-	{0xb7b2, 3},
-	{0xb7b3, 4},
-	{0xb7b4, 1753},
-	{0xb7b5, 1754},
-	{0xb7b7, 0},
-	{0xb7b8, 1755},
-	{0xb7ba, 0},
-	{0xb7bb, 1},
-	{0xb7bc, 2},
-	{0xb7bd, 3},
-	{0xb7be, 4},
-	{0xb7bf, 5},
-	{0xb7c0, 6},
-	{0xb7c1, 7},
-	{0xb7c2, 8},
-	{0xb7c3, 9},
-	{0xb7c4, 10},
-	{0xb7c5, 11},
-	{0xb7c6, 12},
-	{0xb7c7, 1756},
-	{0xb7c9, 1757},
-	{0xb7cb, 0},
-	{0xb7cc, 1},
-	{0xb7cd, 2},
-	{0xb7ce, 3},
-	{0xb7cf, 4},
-	{0xb7d0, 5},
-	{0xb7d1, 6},
-	{0xb7d2, 7},
-	{0xb7d3, 8},
-	{0xb7d4, 9},
-	{0xb7d5, 10},
-	{0xb7d6, 11},
-	{0xb7d7, 12},
-	{0xb7d8, 13},
-	{0xb7d9, 14},
-	{0xb7da, 15},
-	{0xb7db, 16},
-	{0xb7dc, 17},
-	{0xb7dd, 18},
-	{0xb7de, 19},
-	{0xb7df, 20},
-	{0xb7e0, 21},
-	{0xb7e1, 22},
-	{0xb7e2, 23},
-	{0xb7e3, 24},
-	{0xb7e4, 25},
-	{0xb7e5, 26},
-	{0xb7e6, 27},
-	{0xb7e7, 28},
-	{0xb7e8, 29},
-	{0xb7e9, 30},
-	{0xb7ea, 31},
-	{0xb7eb, 32},
-	{0xb7ec, 1758},
-	{0xb7ed, 1759},
-	{0xb7ef, 0},
-	{0xb7f0, 1760},
-	{0xb7f2, 0},
-	{0xb7f3, 1},
-	{0xb7f4, 1761},
-	{0xb7f6, 0},
-	{0xb7f7, 1},
-	{0xb7f8, 2},
-	{0xb7f9, 3},
-	{0xb7fa, 4},
-	{0xb7fb, 5},
-	{0xb7fc, 1762},
-	{0xb7fd, 1763},
-	{0xb7ff, 1764},
-	{0xb800, 1765},
-	{0xb801, 1766},
-	{0xb803, 0},
-	{0xb804, 1},
-	{0xb805, 2},
-	{0xb806, 3},
-	{0xb807, 1767},
-	{0xb808, 1768},
-	{0xb809, 1769},
-	{0xb80b, 0},
-	{0xb80c, 1770},
-	{0xb80e, 0},
-	{0xb80f, 1},
-	{0xb810, 1771},
-	{0xb812, 0},
-	{0xb813, 1},
-	{0xb814, 2},
-	{0xb815, 3},
-	{0xb816, 4},
-	{0xb817, 5},
-	{0xb818, 1772},
-	{0xb819, 1773},
-	{0xb81b, 1774},
-	{0xb81d, 1775},
-	{0xb81f, 0},
-	{0xb820, 1},
-	{0xb821, 2},
-	{0xb822, 3},
-	{0xb823, 4},
-	{0xb824, 1776},
-	{0xb825, 1777},
-	{0xb827, 0},
-	{0xb828, 1778},
-	{0xb82a, 0},
-	{0xb82b, 1},
-	{0xb82c, 1779},
-	{0xb82e, 0},
-	{0xb82f, 1},
-	{0xb830, 2},
-	{0xb831, 3},
-	{0xb832, 4},
-	{0xb833, 5},
-	{0xb834, 1780},
-	{0xb835, 1781},
-	{0xb837, 1782},
-	{0xb838, 1783},
-	{0xb839, 1784},
-	{0xb83b, 0},
-	{0xb83c, 1},
-	{0xb83d, 2},
-	{0xb83e, 3},
-	{0xb83f, 4},
-	{0xb840, 1785},
-	{0xb842, 0},
-	{0xb843, 1},
-	{0xb844, 1786},
-	{0xb846, 0},
-	{0xb847, 1},
-	{0xb848, 2},
-	{0xb849, 3},
-	{0xb84a, 4},
-	{0xb84b, 5},
-	{0xb84c, 6},
-	{0xb84d, 7},
-	{0xb84e, 8},
-	{0xb84f, 9},
-	{0xb850, 10},
-	{0xb851, 1787},
-	{0xb853, 1788},
-	{0xb855, 0},
-	{0xb856, 1},
-	{0xb857, 2},
-	{0xb858, 3},
-	{0xb859, 4},
-	{0xb85a, 5},
-	{0xb85b, 6},
-	{0xb85c, 1789},
-	{0xb85d, 1790},
-	{0xb85f, 0},
-	{0xb860, 1791},
-	{0xb862, 0},
-	{0xb863, 1},
-	{0xb864, 1792},
-	{0xb866, 0},
-	{0xb867, 1},
-	{0xb868, 2},
-	{0xb869, 3},
-	{0xb86a, 4},
-	{0xb86b, 5},
-	{0xb86c, 1793},
-	{0xb86d, 1794},
-	{0xb86f, 1795},
-	{0xb871, 1796},
-	{0xb873, 0},
-	{0xb874, 1},
-	{0xb875, 2},
-	{0xb876, 3},
-	{0xb877, 4},
-	{0xb878, 1797},
-	{0xb87a, 0},
-	{0xb87b, 1},
-	{0xb87c, 1798},
-	{0xb87e, 0},
-	{0xb87f, 1},
-	{0xb880, 2},
-	{0xb881, 3},
-	{0xb882, 4},
-	{0xb883, 5},
-	{0xb884, 6},
-	{0xb885, 7},
-	{0xb886, 8},
-	{0xb887, 9},
-	{0xb888, 10},
-	{0xb889, 11},
-	{0xb88a, 12},
-	{0xb88b, 13},
-	{0xb88c, 14},
-	{0xb88d, 1799},
-	{0xb88f, 0},
-	{0xb890, 1},
-	{0xb891, 2},
-	{0xb892, 3},
-	{0xb893, 4},
-	{0xb894, 5},
-	{0xb895, 6},
-	{0xb896, 7},
-	{0xb897, 8},
-	{0xb898, 9},
-	{0xb899, 10},
-	{0xb89a, 11},
-	{0xb89b, 12},
-	{0xb89c, 13},
-	{0xb89d, 14},
-	{0xb89e, 15},
-	{0xb89f, 16},
-	{0xb8a0, 17},
-	{0xb8a1, 18},
-	{0xb8a2, 19},
-	{0xb8a3, 20},
-	{0xb8a4, 21},
-	{0xb8a5, 22},
-	{0xb8a6, 23},
-	{0xb8a7, 24},
-	{0xb8a8, 1800},
-	{0xb8aa, 0},
-	{0xb8ab, 1},
-	{0xb8ac, 2},
-	{0xb8ad, 3},
-	{0xb8ae, 4},
-	{0xb8af, 5},
-	{0xb8b0, 1801},
-	{0xb8b2, 0},
-	{0xb8b3, 1},
-	{0xb8b4, 1802},
-	{0xb8b6, 0},
-	{0xb8b7, 1},
-	{0xb8b8, 1803},
-	{0xb8ba, 0},
-	{0xb8bb, 1},
-	{0xb8bc, 2},
-	{0xb8bd, 3},
-	{0xb8be, 4},
-	{0xb8bf, 5},
-	{0xb8c0, 1804},
-	{0xb8c1, 1805},
-	{0xb8c3, 1806},
-	{0xb8c5, 1807},
-	{0xb8c7, 0},
-	{0xb8c8, 1},
-	{0xb8c9, 2},
-	{0xb8ca, 3},
-	{0xb8cb, 4},
-	{0xb8cc, 1808},
-	{0xb8ce, 0},
-	{0xb8cf, 1},
-	{0xb8d0, 1809},
-	{0xb8d2, 0},
-	{0xb8d3, 1},
-	{0xb8d4, 1810},
-	{0xb8d6, 0},
-	{0xb8d7, 1},
-	{0xb8d8, 2},
-	{0xb8d9, 3},
-	{0xb8da, 4},
-	{0xb8db, 5},
-	{0xb8dc, 6},
-	{0xb8dd, 1811},
-	{0xb8df, 1812},
-	{0xb8e1, 1813},
-	{0xb8e3, 0},
-	{0xb8e4, 1},
-	{0xb8e5, 2},
-	{0xb8e6, 3},
-	{0xb8e7, 4},
-	{0xb8e8, 1814},
-	{0xb8e9, 1815},
-	{0xb8eb, 0},
-	{0xb8ec, 1816},
-	{0xb8ee, 0},
-	{0xb8ef, 1},
-	{0xb8f0, 1817},
-	{0xb8f2, 0},
-	{0xb8f3, 1},
-	{0xb8f4, 2},
-	{0xb8f5, 3},
-	{0xb8f6, 4},
-	{0xb8f7, 5},
-	{0xb8f8, 1818},
-	{0xb8f9, 1819},
-	{0xb8fb, 1820},
-	{0xb8fd, 1821},
-	{0xb8ff, 0},
-	{0xb901, 0},
-	{0xb902, 1},
-	{0xb903, 2},
-	{0xb904, 1822},
-	{0xb906, 0},
-	{0xb907, 1},
-	{0xb908, 2},
-	{0xb909, 3},
-	{0xb90a, 4},
-	{0xb90b, 5},
-	{0xb90c, 6},
-	{0xb90d, 7},
-	{0xb90e, 8},
-	{0xb90f, 9},
-	{0xb910, 10},
-	{0xb911, 11},
-	{0xb912, 12},
-	{0xb913, 13},
-	{0xb914, 14},
-	{0xb915, 15},
-	{0xb916, 16},
-	{0xb917, 17},
-	{0xb918, 1823},
-	{0xb91a, 0},
-	{0xb91b, 1},
-	{0xb91c, 2},
-	{0xb91d, 3},
-	{0xb91e, 4},
-	{0xb91f, 5},
-	{0xb920, 1824},
-	{0xb922, 0},
-	{0xb923, 1},
-	{0xb924, 2},
-	{0xb925, 3},
-	{0xb926, 4},
-	{0xb927, 5},
-	{0xb928, 6},
-	{0xb929, 7},
-	{0xb92a, 8},
-	{0xb92b, 9},
-	{0xb92c, 10},
-	{0xb92d, 11},
-	{0xb92e, 12},
-	{0xb92f, 13},
-	{0xb930, 14},
-	{0xb931, 15},
-	{0xb932, 16},
-	{0xb933, 17},
-	{0xb934, 18},
-	{0xb935, 19},
-	{0xb936, 20},
-	{0xb937, 21},
-	{0xb938, 22},
-	{0xb939, 23},
-	{0xb93a, 24},
-	{0xb93b, 25},
-	{0xb93c, 1825},
-	{0xb93d, 1826},
-	{0xb93f, 0},
-	{0xb940, 1827},
-	{0xb942, 0},
-	{0xb943, 1},
-	{0xb944, 1828},
-	{0xb946, 0},
-	{0xb947, 1},
-	{0xb948, 2},
-	{0xb949, 3},
-	{0xb94a, 4},
-	{0xb94b, 5},
-	{0xb94c, 1829},
-	{0xb94e, 0},
-	{0xb94f, 1830},
-	{0xb951, 1831},
-	{0xb953, 0},
-	{0xb954, 1},
-	{0xb955, 2},
-	{0xb956, 3},
-	{0xb957, 4},
-	{0xb958, 1832},
-	{0xb959, 1833},
-	{0xb95b, 0},
-	{0xb95c, 1834},
-	{0xb95e, 0},
-	{0xb95f, 1},
-	{0xb960, 1835},
-	{0xb962, 0},
-	{0xb963, 1},
-	{0xb964, 2},
-	{0xb965, 3},
-	{0xb966, 4},
-	{0xb967, 5},
-	{0xb968, 1836},
-	{0xb969, 1837},
-	{0xb96b, 1838},
-	{0xb96d, 1839},
-	{0xb96f, 0},
-	{0xb970, 1},
-	{0xb971, 2},
-	{0xb972, 3},
-	{0xb973, 4},
-	{0xb974, 1840},
-	{0xb975, 1841},
-	{0xb977, 0},
-	{0xb978, 1842},
-	{0xb97a, 0},
-	{0xb97b, 1},
-	{0xb97c, 1843},
-	{0xb97e, 0},
-	{0xb97f, 1},
-	{0xb980, 2},
-	{0xb981, 3},
-	{0xb982, 4},
-	{0xb983, 5},
-	{0xb984, 1844},
-	{0xb985, 1845},
-	{0xb987, 1846},
-	{0xb989, 1847},
-	{0xb98a, 1848},
-	{0xb98c, 0},
-	{0xb98d, 1849},
-	{0xb98e, 1850},
-	{0xb990, 0},
-	{0xb991, 1},
-	{0xb992, 2},
-	{0xb993, 3},
-	{0xb994, 4},
-	{0xb995, 5},
-	{0xb996, 6},
-	{0xb997, 7},
-	{0xb998, 8},
-	{0xb999, 9},
-	{0xb99a, 10},
-	{0xb99b, 11},
-	{0xb99c, 12},
-	{0xb99d, 13},
-	{0xb99e, 14},
-	{0xb99f, 15},
-	{0xb9a0, 16},
-	{0xb9a1, 17},
-	{0xb9a2, 18},
-	{0xb9a3, 19},
-	{0xb9a4, 20},
-	{0xb9a5, 21},
-	{0xb9a6, 22},
-	{0xb9a7, 23},
-	{0xb9a8, 24},
-	{0xb9a9, 25},
-	{0xb9aa, 26},
-	{0xb9ab, 27},
-	{0xb9ac, 1851},
-	{0xb9ad, 1852},
-	{0xb9af, 0},
-	{0xb9b0, 1853},
-	{0xb9b2, 0},
-	{0xb9b3, 1},
-	{0xb9b4, 1854},
-	{0xb9b6, 0},
-	{0xb9b7, 1},
-	{0xb9b8, 2},
-	{0xb9b9, 3},
-	{0xb9ba, 4},
-	{0xb9bb, 5},
-	{0xb9bc, 1855},
-	{0xb9bd, 1856},
-	{0xb9bf, 1857},
-	{0xb9c1, 1858},
-	{0xb9c3, 0},
-	{0xb9c4, 1},
-	{0xb9c5, 2},
-	{0xb9c6, 3},
-	{0xb9c7, 4},
-	{0xb9c8, 1859},
-	{0xb9c9, 1860},
-	{0xb9cb, 0},
-	{0xb9cc, 1861},
-	{0xb9ce, 1862},
-	{0xb9cf, 1863},
-	{0xb9d0, 1864},
-	{0xb9d1, 1865},
-	{0xb9d2, 1866},
-	{0xb9d4, 0},
-	{0xb9d5, 1},
-	{0xb9d6, 2},
-	{0xb9d7, 3},
-	{0xb9d8, 1867},
-	{0xb9d9, 1868},
-	{0xb9db, 1869},
-	{0xb9dd, 1870},
-	{0xb9de, 1871},
-	{0xb9e0, 0},
-	{0xb9e1, 1872},
-	{0xb9e3, 1873},
-	{0xb9e4, 1874},
-	{0xb9e5, 1875},
-	{0xb9e7, 0},
-	{0xb9e8, 1876},
-	{0xb9ea, 0},
-	{0xb9eb, 1},
-	{0xb9ec, 1877},
-	{0xb9ee, 0},
-	{0xb9ef, 1},
-	{0xb9f0, 2},
-	{0xb9f1, 3},
-	{0xb9f2, 4},
-	{0xb9f3, 5},
-	{0xb9f4, 1878},
-	{0xb9f5, 1879},
-	{0xb9f7, 1880},
-	{0xb9f8, 1881},
-	{0xb9f9, 1882},
-	{0xb9fa, 1883},
-	{0xb9fc, 0},
-	{0xb9fd, 1},
-	{0xb9fe, 2},
-	{0xb9ff, 3},
-	{0xba00, 1884},
-	{0xba01, 1885},
-	{0xba03, 0},
-	{0xba04, 1},
-	{0xba05, 2},
-	{0xba06, 3},
-	{0xba07, 4},
-	{0xba08, 1886},
-	{0xba0a, 0},
-	{0xba0b, 1},
-	{0xba0c, 2},
-	{0xba0d, 3},
-	{0xba0e, 4},
-	{0xba0f, 5},
-	{0xba10, 6},
-	{0xba11, 7},
-	{0xba12, 8},
-	{0xba13, 9},
-	{0xba14, 10},
-	{0xba15, 1887},
-	{0xba17, 0},
-	{0xba18, 1},
-	{0xba19, 2},
-	{0xba1a, 3},
-	{0xba1b, 4},
-	{0xba1c, 5},
-	{0xba1d, 6},
-	{0xba1e, 7},
-	{0xba1f, 8},
-	{0xba20, 9},
-	{0xba21, 10},
-	{0xba22, 11},
-	{0xba23, 12},
-	{0xba24, 13},
-	{0xba25, 14},
-	{0xba26, 15},
-	{0xba27, 16},
-	{0xba28, 17},
-	{0xba29, 18},
-	{0xba2a, 19},
-	{0xba2b, 20},
-	{0xba2c, 21},
-	{0xba2d, 22},
-	{0xba2e, 23},
-	{0xba2f, 24},
-	{0xba30, 25},
-	{0xba31, 26},
-	{0xba32, 27},
-	{0xba33, 28},
-	{0xba34, 29},
-	{0xba35, 30},
-	{0xba36, 31},
-	{0xba37, 32},
-	{0xba38, 1888},
-	{0xba39, 1889},
-	{0xba3b, 0},
-	{0xba3c, 1890},
-	{0xba3e, 0},
-	{0xba3f, 1},
-	{0xba40, 1891},
-	{0xba42, 1892},
-	{0xba44, 0},
-	{0xba45, 1},
-	{0xba46, 2},
-	{0xba47, 3},
-	{0xba48, 1893},
-	{0xba49, 1894},
-	{0xba4b, 1895},
-	{0xba4d, 1896},
-	{0xba4e, 1897},
-	{0xba50, 0},
-	{0xba51, 1},
-	{0xba52, 2},
-	{0xba53, 1898},
-	{0xba54, 1899},
-	{0xba55, 1900},
-	{0xba57, 0},
-	{0xba58, 1901},
-	{0xba5a, 0},
-	{0xba5b, 1},
-	{0xba5c, 1902},
-	{0xba5e, 0},
-	{0xba5f, 1},
-	{0xba60, 2},
-	{0xba61, 3},
-	{0xba62, 4},
-	{0xba63, 5},
-	{0xba64, 1903},
-	{0xba65, 1904},
-	{0xba67, 1905},
-	{0xba68, 1906},
-	{0xba69, 1907},
-	{0xba6b, 0},
-	{0xba6c, 1},
-	{0xba6d, 2},
-	{0xba6e, 3},
-	{0xba6f, 4},
-	{0xba70, 1908},
-	{0xba71, 1909},
-	{0xba73, 0},
-	{0xba74, 1910},
-	{0xba76, 0},
-	{0xba77, 1},
-	{0xba78, 1911},
-	{0xba7a, 0},
-	{0xba7b, 1},
-	{0xba7c, 2},
-	{0xba7d, 3},
-	{0xba7e, 4},
-	{0xba7f, 5},
-	{0xba80, 6},
-	{0xba81, 7},
-	{0xba82, 8},
-	{0xba83, 1912},
-	{0xba84, 1913},
-	{0xba85, 1914},
-	{0xba87, 1915},
-	{0xba89, 0},
-	{0xba8a, 1},
-	{0xba8b, 2},
-	{0xba8c, 1916},
-	{0xba8e, 0},
-	{0xba8f, 1},
-	{0xba90, 2},
-	{0xba91, 3},
-	{0xba92, 4},
-	{0xba93, 5},
-	{0xba94, 6},
-	{0xba95, 7},
-	{0xba96, 8},
-	{0xba97, 9},
-	{0xba98, 10},
-	{0xba99, 11},
-	{0xba9a, 12},
-	{0xba9b, 13},
-	{0xba9c, 14},
-	{0xba9d, 15},
-	{0xba9e, 16},
-	{0xba9f, 17},
-	{0xbaa0, 18},
-	{0xbaa1, 19},
-	{0xbaa2, 20},
-	{0xbaa3, 21},
-	{0xbaa4, 22},
-	{0xbaa5, 23},
-	{0xbaa6, 24},
-	{0xbaa7, 25},
-	{0xbaa8, 1917},
-	{0xbaa9, 1918},
-	{0xbaab, 1919},
-	{0xbaac, 1920},
-	{0xbaae, 0},
-	{0xbaaf, 1},
-	{0xbab0, 1921},
-	{0xbab2, 1922},
-	{0xbab4, 0},
-	{0xbab5, 1},
-	{0xbab6, 2},
-	{0xbab7, 3},
-	{0xbab8, 1923},
-	{0xbab9, 1924},
-	{0xbabb, 1925},
-	{0xbabd, 1926},
-	{0xbabf, 0},
-	{0xbac0, 1},
-	{0xbac1, 2},
-	{0xbac2, 3},
-	{0xbac3, 4},
-	{0xbac4, 1927},
-	{0xbac6, 0},
-	{0xbac7, 1},
-	{0xbac8, 1928},
-	{0xbaca, 0},
-	{0xbacb, 1},
-	{0xbacc, 2},
-	{0xbacd, 3},
-	{0xbace, 4},
-	{0xbacf, 5},
-	{0xbad0, 6},
-	{0xbad1, 7},
-	{0xbad2, 8},
-	{0xbad3, 9},
-	{0xbad4, 10},
-	{0xbad5, 11},
-	{0xbad6, 12},
-	{0xbad7, 13},
-	{0xbad8, 1929},
-	{0xbad9, 1930},
-	{0xbadb, 0},
-	{0xbadc, 1},
-	{0xbadd, 2},
-	{0xbade, 3},
-	{0xbadf, 4},
-	{0xbae0, 5},
-	{0xbae1, 6},
-	{0xbae2, 7},
-	{0xbae3, 8},
-	{0xbae4, 9},
-	{0xbae5, 10},
-	{0xbae6, 11},
-	{0xbae7, 12},
-	{0xbae8, 13},
-	{0xbae9, 14},
-	{0xbaea, 15},
-	{0xbaeb, 16},
-	{0xbaec, 17},
-	{0xbaed, 18},
-	{0xbaee, 19},
-	{0xbaef, 20},
-	{0xbaf0, 21},
-	{0xbaf1, 22},
-	{0xbaf2, 23},
-	{0xbaf3, 24},
-	{0xbaf4, 25},
-	{0xbaf5, 26},
-	{0xbaf6, 27},
-	{0xbaf7, 28},
-	{0xbaf8, 29},
-	{0xbaf9, 30},
-	{0xbafa, 31},
-	{0xbafb, 32},
-	{0xbafc, 1931},
-	{0xbafe, 0},
-	{0xbaff, 1},
-	{0xbb00, 1932},
-	{0xbb02, 0},
-	{0xbb03, 1},
-	{0xbb04, 1933},
-	{0xbb06, 0},
-	{0xbb07, 1},
-	{0xbb08, 2},
-	{0xbb09, 3},
-	{0xbb0a, 4},
-	{0xbb0b, 5},
-	{0xbb0c, 6},
-	{0xbb0d, 1934},
-	{0xbb0f, 1935},
-	{0xbb11, 1936},
-	{0xbb13, 0},
-	{0xbb14, 1},
-	{0xbb15, 2},
-	{0xbb16, 3},
-	{0xbb17, 4},
-	{0xbb18, 1937},
-	{0xbb1a, 0},
-	{0xbb1b, 1},
-	{0xbb1c, 1938},
-	{0xbb1e, 0},
-	{0xbb1f, 1},
-	{0xbb20, 1939},
-	{0xbb22, 0},
-	{0xbb23, 1},
-	{0xbb24, 2},
-	{0xbb25, 3},
-	{0xbb26, 4},
-	{0xbb27, 5},
-	{0xbb28, 6},
-	{0xbb29, 1940},
-	{0xbb2b, 1941},
-	{0xbb2d, 0},
-	{0xbb2e, 1},
-	{0xbb2f, 2},
-	{0xbb30, 3},
-	{0xbb31, 4},
-	{0xbb32, 5},
-	{0xbb33, 6},
-	{0xbb34, 1942},
-	{0xbb35, 1943},
-	{0xbb36, 1944},
-	{0xbb38, 1945},
-	{0xbb3a, 0},
-	{0xbb3b, 1946},
-	{0xbb3c, 1947},
-	{0xbb3d, 1948},
-	{0xbb3e, 1949},
-	{0xbb40, 0},
-	{0xbb41, 1},
-	{0xbb42, 2},
-	{0xbb43, 3},
-	{0xbb44, 1950},
-	{0xbb45, 1951},
-	{0xbb47, 1952},
-	{0xbb49, 1953},
-	{0xbb4b, 0},
-	{0xbb4c, 1},
-	{0xbb4d, 1954},
-	{0xbb4f, 1955},
-	{0xbb50, 1956},
-	{0xbb52, 0},
-	{0xbb53, 1},
-	{0xbb54, 1957},
-	{0xbb56, 0},
-	{0xbb57, 1},
-	{0xbb58, 1958},
-	{0xbb5a, 0},
-	{0xbb5b, 1},
-	{0xbb5c, 2},
-	{0xbb5d, 3},
-	{0xbb5e, 4},
-	{0xbb5f, 5},
-	{0xbb60, 6},
-	{0xbb61, 1959},
-	{0xbb63, 1960},
-	{0xbb65, 0},
-	{0xbb66, 1},
-	{0xbb67, 2},
-	{0xbb68, 3},
-	{0xbb69, 4},
-	{0xbb6a, 5},
-	{0xbb6b, 6},
-	{0xbb6c, 1961},
-	{0xbb6e, 0},
-	{0xbb6f, 1},
-	{0xbb70, 2},
-	{0xbb71, 3},
-	{0xbb72, 4},
-	{0xbb73, 5},
-	{0xbb74, 6},
-	{0xbb75, 7},
-	{0xbb76, 8},
-	{0xbb77, 9},
-	{0xbb78, 10},
-	{0xbb79, 11},
-	{0xbb7a, 12},
-	{0xbb7b, 13},
-	{0xbb7c, 14},
-	{0xbb7d, 15},
-	{0xbb7e, 16},
-	{0xbb7f, 17},
-	{0xbb80, 18},
-	{0xbb81, 19},
-	{0xbb82, 20},
-	{0xbb83, 21},
-	{0xbb84, 22},
-	{0xbb85, 23},
-	{0xbb86, 24},
-	{0xbb87, 25},
-	{0xbb88, 1962},
-	{0xbb8a, 0},
-	{0xbb8b, 1},
-	{0xbb8c, 1963},
-	{0xbb8e, 0},
-	{0xbb8f, 1},
-	{0xbb90, 1964},
-	{0xbb92, 0},
-	{0xbb93, 1},
-	{0xbb94, 2},
-	{0xbb95, 3},
-	{0xbb96, 4},
-	{0xbb97, 5},
-	{0xbb98, 6},
-	{0xbb99, 7},
-	{0xbb9a, 8},
-	{0xbb9b, 9},
-	{0xbb9c, 10},
-	{0xbb9d, 11},
-	{0xbb9e, 12},
-	{0xbb9f, 13},
-	{0xbba0, 14},
-	{0xbba1, 15},
-	{0xbba2, 16},
-	{0xbba3, 17},
-	{0xbba4, 1965},
-	{0xbba6, 0},
-	{0xbba7, 1},
-	{0xbba8, 1966},
-	{0xbbaa, 0},
-	{0xbbab, 1},
-	{0xbbac, 1967},
-	{0xbbae, 0},
-	{0xbbaf, 1},
-	{0xbbb0, 2},
-	{0xbbb1, 3},
-	{0xbbb2, 4},
-	{0xbbb3, 5},
-	{0xbbb4, 1968},
-	{0xbbb6, 0},
-	{0xbbb7, 1969},
-	{0xbbb9, 0},
-	{0xbbba, 1},
-	{0xbbbb, 2},
-	{0xbbbc, 3},
-	{0xbbbd, 4},
-	{0xbbbe, 5},
-	{0xbbbf, 6},
-	{0xbbc0, 1970},
-	{0xbbc2, 0},
-	{0xbbc3, 1},
-	{0xbbc4, 1971},
-	{0xbbc6, 0},
-	{0xbbc7, 1},
-	{0xbbc8, 1972},
-	{0xbbca, 0},
-	{0xbbcb, 1},
-	{0xbbcc, 2},
-	{0xbbcd, 3},
-	{0xbbce, 4},
-	{0xbbcf, 5},
-	{0xbbd0, 1973},
-	{0xbbd2, 0},
-	{0xbbd3, 1974},
-	{0xbbd5, 0},
-	{0xbbd6, 1},
-	{0xbbd7, 2},
-	{0xbbd8, 3},
-	{0xbbd9, 4},
-	{0xbbda, 5},
-	{0xbbdb, 6},
-	{0xbbdc, 7},
-	{0xbbdd, 8},
-	{0xbbde, 9},
-	{0xbbdf, 10},
-	{0xbbe0, 11},
-	{0xbbe1, 12},
-	{0xbbe2, 13},
-	{0xbbe3, 14},
-	{0xbbe4, 15},
-	{0xbbe5, 16},
-	{0xbbe6, 17},
-	{0xbbe7, 18},
-	{0xbbe8, 19},
-	{0xbbe9, 20},
-	{0xbbea, 21},
-	{0xbbeb, 22},
-	{0xbbec, 23},
-	{0xbbed, 24},
-	{0xbbee, 25},
-	{0xbbef, 26},
-	{0xbbf0, 27},
-	{0xbbf1, 28},
-	{0xbbf2, 29},
-	{0xbbf3, 30},
-	{0xbbf4, 31},
-	{0xbbf5, 32},
-	{0xbbf6, 33},
-	{0xbbf7, 34},
-	{0xbbf8, 1975},
-	{0xbbf9, 1976},
-	{0xbbfb, 0},
-	{0xbbfc, 1977},
-	{0xbbfe, 0},
-	{0xbbff, 1978},
-	{0xbc00, 1979},
-	{0xbc02, 1980},
-	{0xbc04, 0},
-	{0xbc05, 1},
-	{0xbc06, 2},
-	{0xbc07, 3},
-	{0xbc08, 1981},
-	{0xbc09, 1982},
-	{0xbc0b, 1983},
-	{0xbc0c, 1984},
-	{0xbc0d, 1985},
-	{0xbc0f, 1986},
-	{0xbc11, 1987},
-	{0xbc13, 0},
-	{0xbc14, 1988},
-	{0xbc15, 1989},
-	{0xbc16, 1990},
-	{0xbc17, 1991},
-	{0xbc18, 1992},
-	{0xbc1a, 0},
-	{0xbc1b, 1993},
-	{0xbc1c, 1994},
-	{0xbc1d, 1995},
-	{0xbc1e, 1996},
-	{0xbc1f, 1997},
-	{0xbc21, 0},
-	{0xbc22, 1},
-	{0xbc23, 2},
-	{0xbc24, 1998},
-	{0xbc25, 1999},
-	{0xbc27, 2000},
-	{0xbc29, 2001},
-	{0xbc2b, 0},
-	{0xbc2c, 1},
-	{0xbc2d, 2002},
-	{0xbc2f, 0},
-	{0xbc30, 2003},
-	{0xbc31, 2004},
-	{0xbc33, 0},
-	{0xbc34, 2005},
-	{0xbc36, 0},
-	{0xbc37, 1},
-	{0xbc38, 2006},
-	{0xbc3a, 0},
-	{0xbc3b, 1},
-	{0xbc3c, 2},
-	{0xbc3d, 3},
-	{0xbc3e, 4},
-	{0xbc3f, 5},
-	{0xbc40, 2007},
-	{0xbc41, 2008},
-	{0xbc43, 2009},
-	{0xbc44, 2010},
-	{0xbc45, 2011},
-	{0xbc47, 0},
-	{0xbc48, 1},
-	{0xbc49, 2012},
-	{0xbc4b, 0},
-	{0xbc4c, 2013},
-	{0xbc4d, 2014},
-	{0xbc4f, 0},
-	{0xbc50, 2015},
-	{0xbc52, 0},
-	{0xbc53, 1},
-	{0xbc54, 2},
-	{0xbc55, 3},
-	{0xbc56, 4},
-	{0xbc57, 5},
-	{0xbc58, 6},
-	{0xbc59, 7},
-	{0xbc5a, 8},
-	{0xbc5b, 9},
-	{0xbc5c, 10},
-	{0xbc5d, 2016},
-	{0xbc5f, 0},
-	{0xbc60, 1},
-	{0xbc61, 2},
-	{0xbc62, 3},
-	{0xbc63, 4},
-	{0xbc64, 5},
-	{0xbc65, 6},
-	{0xbc66, 7},
-	{0xbc67, 8},
-	{0xbc68, 9},
-	{0xbc69, 10},
-	{0xbc6a, 11},
-	{0xbc6b, 12},
-	{0xbc6c, 13},
-	{0xbc6d, 14},
-	{0xbc6e, 15},
-	{0xbc6f, 16},
-	{0xbc70, 17},
-	{0xbc71, 18},
-	{0xbc72, 19},
-	{0xbc73, 20},
-	{0xbc74, 21},
-	{0xbc75, 22},
-	{0xbc76, 23},
-	{0xbc77, 24},
-	{0xbc78, 25},
-	{0xbc79, 26},
-	{0xbc7a, 27},
-	{0xbc7b, 28},
-	{0xbc7c, 29},
-	{0xbc7d, 30},
-	{0xbc7e, 31},
-	{0xbc7f, 32},
-	{0xbc80, 33},
-	{0xbc81, 34},
-	{0xbc82, 35},
-	{0xbc83, 36},
-	{0xbc84, 2017},
-	{0xbc85, 2018},
-	{0xbc87, 0},
-	{0xbc88, 2019},
-	{0xbc8a, 0},
-	{0xbc8b, 2020},
-	{0xbc8c, 2021},
-	{0xbc8e, 2022},
-	{0xbc90, 0},
-	{0xbc91, 1},
-	{0xbc92, 2},
-	{0xbc93, 3},
-	{0xbc94, 2023},
-	{0xbc95, 2024},
-	{0xbc97, 2025},
-	{0xbc99, 2026},
-	{0xbc9a, 2027},
-	{0xbc9c, 0},
-	{0xbc9d, 1},
-	{0xbc9e, 2},
-	{0xbc9f, 3},
-	{0xbca0, 2028},
-	{0xbca1, 2029},
-	{0xbca3, 0},
-	{0xbca4, 2030},
-	{0xbca6, 0},
-	{0xbca7, 2031},
-	{0xbca8, 2032},
-	{0xbcaa, 0},
-	{0xbcab, 1},
-	{0xbcac, 2},
-	{0xbcad, 3},
-	{0xbcae, 4},
-	{0xbcaf, 5},
-	{0xbcb0, 2033},
-	{0xbcb1, 2034},
-	{0xbcb3, 2035},
-	{0xbcb4, 2036},
-	{0xbcb5, 2037},
-	{0xbcb7, 0},
-	{0xbcb8, 1},
-	{0xbcb9, 2},
-	{0xbcba, 3},
-	{0xbcbb, 4},
-	{0xbcbc, 2038},
-	{0xbcbd, 2039},
-	{0xbcbf, 0},
-	{0xbcc0, 2040},
-	{0xbcc2, 0},
-	{0xbcc3, 1},
-	{0xbcc4, 2041},
-	{0xbcc6, 0},
-	{0xbcc7, 1},
-	{0xbcc8, 2},
-	{0xbcc9, 3},
-	{0xbcca, 4},
-	{0xbccb, 5},
-	{0xbccc, 6},
-	{0xbccd, 2042},
-	{0xbccf, 2043},
-	{0xbcd0, 2044},
-	{0xbcd1, 2045},
-	{0xbcd3, 0},
-	{0xbcd4, 1},
-	{0xbcd5, 2046},
-	{0xbcd7, 0},
-	{0xbcd8, 2047},
-	{0xbcda, 0},
-	{0xbcdb, 1},
-	{0xbcdc, 2048},
-	{0xbcde, 0},
-	{0xbcdf, 1},
-	{0xbce0, 2},
-	{0xbce1, 3},
-	{0xbce2, 4},
-	{0xbce3, 5},
-	{0xbce4, 6},
-	{0xbce5, 7},
-	{0xbce6, 8},
-	{0xbce7, 9},
-	{0xbce8, 10},
-	{0xbce9, 11},
-	{0xbcea, 12},
-	{0xbceb, 13},
-	{0xbcec, 14},
-	{0xbced, 15},
-	{0xbcee, 16},
-	{0xbcef, 17},
-	{0xbcf0, 18},
-	{0xbcf1, 19},
-	{0xbcf2, 20},
-	{0xbcf3, 21},
-	{0xbcf4, 2049},
-	{0xbcf5, 2050},
-	{0xbcf6, 2051},
-	{0xbcf8, 2052},
-	{0xbcfa, 0},
-	{0xbcfb, 1},
-	{0xbcfc, 2053},
-	{0xbcfe, 0},
-	{0xbcff, 1},
-	{0xbd01, 0},
-	{0xbd02, 1},
-	{0xbd03, 2},
-	{0xbd04, 2054},
-	{0xbd05, 2055},
-	{0xbd07, 2056},
-	{0xbd09, 2057},
-	{0xbd0b, 0},
-	{0xbd0c, 1},
-	{0xbd0d, 2},
-	{0xbd0e, 3},
-	{0xbd0f, 4},
-	{0xbd10, 2058},
-	{0xbd12, 0},
-	{0xbd13, 1},
-	{0xbd14, 2059},
-	{0xbd16, 0},
-	{0xbd17, 1},
-	{0xbd18, 2},
-	{0xbd19, 3},
-	{0xbd1a, 4},
-	{0xbd1b, 5},
-	{0xbd1c, 6},
-	{0xbd1d, 7},
-	{0xbd1e, 8},
-	{0xbd1f, 9},
-	{0xbd20, 10},
-	{0xbd21, 11},
-	{0xbd22, 12},
-	{0xbd23, 13},
-	{0xbd24, 2060},
-	{0xbd26, 0},
-	{0xbd27, 1},
-	{0xbd28, 2},
-	{0xbd29, 3},
-	{0xbd2a, 4},
-	{0xbd2b, 5},
-	{0xbd2c, 2061},
-	{0xbd2e, 0},
-	{0xbd2f, 1},
-	{0xbd30, 2},
-	{0xbd31, 3},
-	{0xbd32, 4},
-	{0xbd33, 5},
-	{0xbd34, 6},
-	{0xbd35, 7},
-	{0xbd36, 8},
-	{0xbd37, 9},
-	{0xbd38, 10},
-	{0xbd39, 11},
-	{0xbd3a, 12},
-	{0xbd3b, 13},
-	{0xbd3c, 14},
-	{0xbd3d, 15},
-	{0xbd3e, 16},
-	{0xbd3f, 17},
-	{0xbd40, 2062},
-	{0xbd42, 0},
-	{0xbd43, 1},
-	{0xbd44, 2},
-	{0xbd45, 3},
-	{0xbd46, 4},
-	{0xbd47, 5},
-	{0xbd48, 2063},
-	{0xbd49, 2064},
-	{0xbd4b, 0},
-	{0xbd4c, 2065},
-	{0xbd4e, 0},
-	{0xbd4f, 1},
-	{0xbd50, 2066},
-	{0xbd52, 0},
-	{0xbd53, 1},
-	{0xbd54, 2},
-	{0xbd55, 3},
-	{0xbd56, 4},
-	{0xbd57, 5},
-	{0xbd58, 2067},
-	{0xbd59, 2068},
-	{0xbd5b, 0},
-	{0xbd5c, 1},
-	{0xbd5d, 2},
-	{0xbd5e, 3},
-	{0xbd5f, 4},
-	{0xbd60, 5},
-	{0xbd61, 6},
-	{0xbd62, 7},
-	{0xbd63, 8},
-	{0xbd64, 2069},
-	{0xbd66, 0},
-	{0xbd67, 1},
-	{0xbd68, 2070},
-	{0xbd6a, 0},
-	{0xbd6b, 1},
-	{0xbd6c, 2},
-	{0xbd6d, 3},
-	{0xbd6e, 4},
-	{0xbd6f, 5},
-	{0xbd70, 6},
-	{0xbd71, 7},
-	{0xbd72, 8},
-	{0xbd73, 9},
-	{0xbd74, 10},
-	{0xbd75, 11},
-	{0xbd76, 12},
-	{0xbd77, 13},
-	{0xbd78, 14},
-	{0xbd79, 15},
-	{0xbd7a, 16},
-	{0xbd7b, 17},
-	{0xbd7c, 18},
-	{0xbd7d, 19},
-	{0xbd7e, 20},
-	{0xbd7f, 21},
-	{0xbd80, 2071},
-	{0xbd81, 2072},
-	{0xbd83, 0},
-	{0xbd84, 2073},
-	{0xbd86, 0},
-	{0xbd87, 2074},
-	{0xbd88, 2075},
-	{0xbd89, 2076},
-	{0xbd8a, 2077},
-	{0xbd8c, 0},
-	{0xbd8d, 1},
-	{0xbd8e, 2},
-	{0xbd8f, 3},
-	{0xbd90, 2078},
-	{0xbd91, 2079},
-	{0xbd93, 2080},
-	{0xbd95, 2081},
-	{0xbd97, 0},
-	{0xbd98, 1},
-	{0xbd99, 2082},
-	{0xbd9a, 2083},
-	{0xbd9c, 2084},
-	{0xbd9e, 0},
-	{0xbd9f, 1},
-	{0xbda0, 2},
-	{0xbda1, 3},
-	{0xbda2, 4},
-	{0xbda3, 5},
-	{0xbda4, 2085},
-	{0xbda6, 0},
-	{0xbda7, 1},
-	{0xbda8, 2},
-	{0xbda9, 3},
-	{0xbdaa, 4},
-	{0xbdab, 5},
-	{0xbdac, 6},
-	{0xbdad, 7},
-	{0xbdae, 8},
-	{0xbdaf, 9},
-	{0xbdb0, 2086},
-	{0xbdb2, 0},
-	{0xbdb3, 1},
-	{0xbdb4, 2},
-	{0xbdb5, 3},
-	{0xbdb6, 4},
-	{0xbdb7, 5},
-	{0xbdb8, 2087},
-	{0xbdba, 0},
-	{0xbdbb, 1},
-	{0xbdbc, 2},
-	{0xbdbd, 3},
-	{0xbdbe, 4},
-	{0xbdbf, 5},
-	{0xbdc0, 6},
-	{0xbdc1, 7},
-	{0xbdc2, 8},
-	{0xbdc3, 9},
-	{0xbdc4, 10},
-	{0xbdc5, 11},
-	{0xbdc6, 12},
-	{0xbdc7, 13},
-	{0xbdc8, 14},
-	{0xbdc9, 15},
-	{0xbdca, 16},
-	{0xbdcb, 17},
-	{0xbdcc, 18},
-	{0xbdcd, 19},
-	{0xbdce, 20},
-	{0xbdcf, 21},
-	{0xbdd0, 22},
-	{0xbdd1, 23},
-	{0xbdd2, 24},
-	{0xbdd3, 25},
-	{0xbdd4, 2088},
-	{0xbdd5, 2089},
-	{0xbdd7, 0},
-	{0xbdd8, 2090},
-	{0xbdda, 0},
-	{0xbddb, 1},
-	{0xbddc, 2091},
-	{0xbdde, 0},
-	{0xbddf, 1},
-	{0xbde0, 2},
-	{0xbde1, 3},
-	{0xbde2, 4},
-	{0xbde3, 5},
-	{0xbde4, 6},
-	{0xbde5, 7},
-	{0xbde6, 8},
-	{0xbde7, 9},
-	{0xbde8, 10},
-	{0xbde9, 2092},
-	{0xbdeb, 0},
-	{0xbdec, 1},
-	{0xbded, 2},
-	{0xbdee, 3},
-	{0xbdef, 4},
-	{0xbdf0, 2093},
-	{0xbdf2, 0},
-	{0xbdf3, 1},
-	{0xbdf4, 2094},
-	{0xbdf6, 0},
-	{0xbdf7, 1},
-	{0xbdf8, 2095},
-	{0xbdfa, 0},
-	{0xbdfb, 1},
-	{0xbdfc, 2},
-	{0xbdfd, 3},
-	{0xbdfe, 4},
-	{0xbdff, 5},
-	{0xbe00, 2096},
-	{0xbe02, 0},
-	{0xbe03, 2097},
-	{0xbe05, 2098},
-	{0xbe07, 0},
-	{0xbe08, 1},
-	{0xbe09, 2},
-	{0xbe0a, 3},
-	{0xbe0b, 4},
-	{0xbe0c, 2099},
-	{0xbe0d, 2100},
-	{0xbe0f, 0},
-	{0xbe10, 2101},
-	{0xbe12, 0},
-	{0xbe13, 1},
-	{0xbe14, 2102},
-	{0xbe16, 0},
-	{0xbe17, 1},
-	{0xbe18, 2},
-	{0xbe19, 3},
-	{0xbe1a, 4},
-	{0xbe1b, 5},
-	{0xbe1c, 2103},
-	{0xbe1d, 2104},
-	{0xbe1f, 2105},
-	{0xbe21, 0},
-	{0xbe22, 1},
-	{0xbe23, 2},
-	{0xbe24, 3},
-	{0xbe25, 4},
-	{0xbe26, 5},
-	{0xbe27, 6},
-	{0xbe28, 7},
-	{0xbe29, 8},
-	{0xbe2a, 9},
-	{0xbe2b, 10},
-	{0xbe2c, 11},
-	{0xbe2d, 12},
-	{0xbe2e, 13},
-	{0xbe2f, 14},
-	{0xbe30, 15},
-	{0xbe31, 16},
-	{0xbe32, 17},
-	{0xbe33, 18},
-	{0xbe34, 19},
-	{0xbe35, 20},
-	{0xbe36, 21},
-	{0xbe37, 22},
-	{0xbe38, 23},
-	{0xbe39, 24},
-	{0xbe3a, 25},
-	{0xbe3b, 26},
-	{0xbe3c, 27},
-	{0xbe3d, 28},
-	{0xbe3e, 29},
-	{0xbe3f, 30},
-	{0xbe40, 31},
-	{0xbe41, 32},
-	{0xbe42, 33},
-	{0xbe43, 34},
-	{0xbe44, 2106},
-	{0xbe45, 2107},
-	{0xbe47, 0},
-	{0xbe48, 2108},
-	{0xbe4a, 0},
-	{0xbe4b, 1},
-	{0xbe4c, 2109},
-	{0xbe4e, 2110},
-	{0xbe50, 0},
-	{0xbe51, 1},
-	{0xbe52, 2},
-	{0xbe53, 3},
-	{0xbe54, 2111},
-	{0xbe55, 2112},
-	{0xbe57, 2113},
-	{0xbe59, 2114},
-	{0xbe5a, 2115},
-	{0xbe5b, 2116},
-	{0xbe5d, 0},
-	{0xbe5e, 1},
-	{0xbe5f, 2},
-	{0xbe60, 2117},
-	{0xbe61, 2118},
-	{0xbe63, 0},
-	{0xbe64, 2119},
-	{0xbe66, 0},
-	{0xbe67, 1},
-	{0xbe68, 2120},
-	{0xbe6a, 2121},
-	{0xbe6c, 0},
-	{0xbe6d, 1},
-	{0xbe6e, 2},
-	{0xbe6f, 3},
-	{0xbe70, 2122},
-	{0xbe71, 2123},
-	{0xbe73, 2124},
-	{0xbe74, 2125},
-	{0xbe75, 2126},
-	{0xbe77, 0},
-	{0xbe78, 1},
-	{0xbe79, 2},
-	{0xbe7a, 3},
-	{0xbe7b, 2127},
-	{0xbe7c, 2128},
-	{0xbe7d, 2129},
-	{0xbe7f, 0},
-	{0xbe80, 2130},
-	{0xbe82, 0},
-	{0xbe83, 1},
-	{0xbe84, 2131},
-	{0xbe86, 0},
-	{0xbe87, 1},
-	{0xbe88, 2},
-	{0xbe89, 3},
-	{0xbe8a, 4},
-	{0xbe8b, 5},
-	{0xbe8c, 2132},
-	{0xbe8d, 2133},
-	{0xbe8f, 2134},
-	{0xbe90, 2135},
-	{0xbe91, 2136},
-	{0xbe93, 0},
-	{0xbe94, 1},
-	{0xbe95, 2},
-	{0xbe96, 3},
-	{0xbe97, 4},
-	{0xbe98, 2137},
-	{0xbe99, 2138},
-	{0xbe9b, 0},
-	{0xbe9c, 1},
-	{0xbe9d, 2},
-	{0xbe9e, 3},
-	{0xbe9f, 4},
-	{0xbea0, 5},
-	{0xbea1, 6},
-	{0xbea2, 7},
-	{0xbea3, 8},
-	{0xbea4, 9},
-	{0xbea5, 10},
-	{0xbea6, 11},
-	{0xbea7, 12},
-	{0xbea8, 2139},
-	{0xbeaa, 0},
-	{0xbeab, 1},
-	{0xbeac, 2},
-	{0xbead, 3},
-	{0xbeae, 4},
-	{0xbeaf, 5},
-	{0xbeb0, 6},
-	{0xbeb1, 7},
-	{0xbeb2, 8},
-	{0xbeb3, 9},
-	{0xbeb4, 10},
-	{0xbeb5, 11},
-	{0xbeb6, 12},
-	{0xbeb7, 13},
-	{0xbeb8, 14},
-	{0xbeb9, 15},
-	{0xbeba, 16},
-	{0xbebb, 17},
-	{0xbebc, 18},
-	{0xbebd, 19},
-	{0xbebe, 20},
-	{0xbebf, 21},
-	{0xbec0, 22},
-	{0xbec1, 23},
-	{0xbec2, 24},
-	{0xbec3, 25},
-	{0xbec4, 26},
-	{0xbec5, 27},
-	{0xbec6, 28},
-	{0xbec7, 29},
-	{0xbec8, 30},
-	{0xbec9, 31},
-	{0xbeca, 32},
-	{0xbecb, 33},
-	{0xbecc, 34},
-	{0xbecd, 35},
-	{0xbece, 36},
-	{0xbecf, 37},
-	{0xbed0, 2140},
-	{0xbed1, 2141},
-	{0xbed3, 0},
-	{0xbed4, 2142},
-	{0xbed6, 0},
-	{0xbed7, 2143},
-	{0xbed8, 2144},
-	{0xbeda, 0},
-	{0xbedb, 1},
-	{0xbedc, 2},
-	{0xbedd, 3},
-	{0xbede, 4},
-	{0xbedf, 5},
-	{0xbee0, 2145},
-	{0xbee2, 0},
-	{0xbee3, 2146},
-	{0xbee4, 2147},
-	{0xbee5, 2148},
-	{0xbee7, 0},
-	{0xbee8, 1},
-	{0xbee9, 2},
-	{0xbeea, 3},
-	{0xbeeb, 4},
-	{0xbeec, 2149},
-	{0xbeee, 0},
-	{0xbeef, 1},
-	{0xbef0, 2},
-	{0xbef1, 3},
-	{0xbef2, 4},
-	{0xbef3, 5},
-	{0xbef4, 6},
-	{0xbef5, 7},
-	{0xbef6, 8},
-	{0xbef7, 9},
-	{0xbef8, 10},
-	{0xbef9, 11},
-	{0xbefa, 12},
-	{0xbefb, 13},
-	{0xbefc, 14},
-	{0xbefd, 15},
-	{0xbefe, 16},
-	{0xbeff, 17},
-	{0xbf01, 2150},
-	{0xbf03, 0},
-	{0xbf04, 1},
-	{0xbf05, 2},
-	{0xbf06, 3},
-	{0xbf07, 4},
-	{0xbf08, 2151},
-	{0xbf09, 2152},
-	{0xbf0b, 0},
-	{0xbf0c, 1},
-	{0xbf0d, 2},
-	{0xbf0e, 3},
-	{0xbf0f, 4},
-	{0xbf10, 5},
-	{0xbf11, 6},
-	{0xbf12, 7},
-	{0xbf13, 8},
-	{0xbf14, 9},
-	{0xbf15, 10},
-	{0xbf16, 11},
-	{0xbf17, 12},
-	{0xbf18, 2153},
-	{0xbf19, 2154},
-	{0xbf1b, 2155},
-	{0xbf1c, 2156},
-	{0xbf1d, 2157},
-	{0xbf1f, 0},
-	{0xbf20, 1},
-	{0xbf21, 2},
-	{0xbf22, 3},
-	{0xbf23, 4},
-	{0xbf24, 5},
-	{0xbf25, 6},
-	{0xbf26, 7},
-	{0xbf27, 8},
-	{0xbf28, 9},
-	{0xbf29, 10},
-	{0xbf2a, 11},
-	{0xbf2b, 12},
-	{0xbf2c, 13},
-	{0xbf2d, 14},
-	{0xbf2e, 15},
-	{0xbf2f, 16},
-	{0xbf30, 17},
-	{0xbf31, 18},
-	{0xbf32, 19},
-	{0xbf33, 20},
-	{0xbf34, 21},
-	{0xbf35, 22},
-	{0xbf36, 23},
-	{0xbf37, 24},
-	{0xbf38, 25},
-	{0xbf39, 26},
-	{0xbf3a, 27},
-	{0xbf3b, 28},
-	{0xbf3c, 29},
-	{0xbf3d, 30},
-	{0xbf3e, 31},
-	{0xbf3f, 32},
-	{0xbf40, 2158},
-	{0xbf41, 2159},
-	{0xbf43, 0},
-	{0xbf44, 2160},
-	{0xbf46, 0},
-	{0xbf47, 1},
-	{0xbf48, 2161},
-	{0xbf4a, 0},
-	{0xbf4b, 1},
-	{0xbf4c, 2},
-	{0xbf4d, 3},
-	{0xbf4e, 4},
-	{0xbf4f, 5},
-	{0xbf50, 2162},
-	{0xbf51, 2163},
-	{0xbf53, 0},
-	{0xbf54, 1},
-	{0xbf55, 2164},
-	{0xbf57, 0},
-	{0xbf58, 1},
-	{0xbf59, 2},
-	{0xbf5a, 3},
-	{0xbf5b, 4},
-	{0xbf5c, 5},
-	{0xbf5d, 6},
-	{0xbf5e, 7},
-	{0xbf5f, 8},
-	{0xbf60, 9},
-	{0xbf61, 10},
-	{0xbf62, 11},
-	{0xbf63, 12},
-	{0xbf64, 13},
-	{0xbf65, 14},
-	{0xbf66, 15},
-	{0xbf67, 16},
-	{0xbf68, 17},
-	{0xbf69, 18},
-	{0xbf6a, 19},
-	{0xbf6b, 20},
-	{0xbf6c, 21},
-	{0xbf6d, 22},
-	{0xbf6e, 23},
-	{0xbf6f, 24},
-	{0xbf70, 25},
-	{0xbf71, 26},
-	{0xbf72, 27},
-	{0xbf73, 28},
-	{0xbf74, 29},
-	{0xbf75, 30},
-	{0xbf76, 31},
-	{0xbf77, 32},
-	{0xbf78, 33},
-	{0xbf79, 34},
-	{0xbf7a, 35},
-	{0xbf7b, 36},
-	{0xbf7c, 37},
-	{0xbf7d, 38},
-	{0xbf7e, 39},
-	{0xbf7f, 40},
-	{0xbf80, 41},
-	{0xbf81, 42},
-	{0xbf82, 43},
-	{0xbf83, 44},
-	{0xbf84, 45},
-	{0xbf85, 46},
-	{0xbf86, 47},
-	{0xbf87, 48},
-	{0xbf88, 49},
-	{0xbf89, 50},
-	{0xbf8a, 51},
-	{0xbf8b, 52},
-	{0xbf8c, 53},
-	{0xbf8d, 54},
-	{0xbf8e, 55},
-	{0xbf8f, 56},
-	{0xbf90, 57},
-	{0xbf91, 58},
-	{0xbf92, 59},
-	{0xbf93, 60},
-	{0xbf94, 2165},
-	{0xbf96, 0},
-	{0xbf97, 1},
-	{0xbf98, 2},
-	{0xbf99, 3},
-	{0xbf9a, 4},
-	{0xbf9b, 5},
-	{0xbf9c, 6},
-	{0xbf9d, 7},
-	{0xbf9e, 8},
-	{0xbf9f, 9},
-	{0xbfa0, 10},
-	{0xbfa1, 11},
-	{0xbfa2, 12},
-	{0xbfa3, 13},
-	{0xbfa4, 14},
-	{0xbfa5, 15},
-	{0xbfa6, 16},
-	{0xbfa7, 17},
-	{0xbfa8, 18},
-	{0xbfa9, 19},
-	{0xbfaa, 20},
-	{0xbfab, 21},
-	{0xbfac, 22},
-	{0xbfad, 23},
-	{0xbfae, 24},
-	{0xbfaf, 25},
-	{0xbfb0, 2166},
-	{0xbfb2, 0},
-	{0xbfb3, 1},
-	{0xbfb4, 2},
-	{0xbfb5, 3},
-	{0xbfb6, 4},
-	{0xbfb7, 5},
-	{0xbfb8, 6},
-	{0xbfb9, 7},
-	{0xbfba, 8},
-	{0xbfbb, 9},
-	{0xbfbc, 10},
-	{0xbfbd, 11},
-	{0xbfbe, 12},
-	{0xbfbf, 13},
-	{0xbfc0, 14},
-	{0xbfc1, 15},
-	{0xbfc2, 16},
-	{0xbfc3, 17},
-	{0xbfc4, 18},
-	{0xbfc5, 2167},
-	{0xbfc7, 0},
-	{0xbfc8, 1},
-	{0xbfc9, 2},
-	{0xbfca, 3},
-	{0xbfcb, 4},
-	{0xbfcc, 2168},
-	{0xbfcd, 2169},
-	{0xbfcf, 0},
-	{0xbfd0, 2170},
-	{0xbfd2, 0},
-	{0xbfd3, 1},
-	{0xbfd4, 2171},
-	{0xbfd6, 0},
-	{0xbfd7, 1},
-	{0xbfd8, 2},
-	{0xbfd9, 3},
-	{0xbfda, 4},
-	{0xbfdb, 5},
-	{0xbfdc, 2172},
-	{0xbfde, 0},
-	{0xbfdf, 2173},
-	{0xbfe1, 2174},
-	{0xbfe3, 0},
-	{0xbfe4, 1},
-	{0xbfe5, 2},
-	{0xbfe6, 3},
-	{0xbfe7, 4},
-	{0xbfe8, 5},
-	{0xbfe9, 6},
-	{0xbfea, 7},
-	{0xbfeb, 8},
-	{0xbfec, 9},
-	{0xbfed, 10},
-	{0xbfee, 11},
-	{0xbfef, 12},
-	{0xbff0, 13},
-	{0xbff1, 14},
-	{0xbff2, 15},
-	{0xbff3, 16},
-	{0xbff4, 17},
-	{0xbff5, 18},
-	{0xbff6, 19},
-	{0xbff7, 20},
-	{0xbff8, 21},
-	{0xbff9, 22},
-	{0xbffa, 23},
-	{0xbffb, 24},
-	{0xbffc, 25},
-	{0xbffd, 26},
-	{0xbffe, 27},
-	{0xbfff, 28},
-	{0xc001, 0},
-	{0xc002, 1},
-	{0xc003, 2},
-	{0xc004, 3},
-	{0xc005, 4},
-	{0xc006, 5},
-	{0xc007, 6},
-	{0xc008, 7},
-	{0xc009, 8},
-	{0xc00a, 9},
-	{0xc00b, 10},
-	{0xc00c, 11},
-	{0xc00d, 12},
-	{0xc00e, 13},
-	{0xc00f, 14},
-	{0xc010, 15},
-	{0xc011, 16},
-	{0xc012, 17},
-	{0xc013, 18},
-	{0xc014, 19},
-	{0xc015, 20},
-	{0xc016, 21},
-	{0xc017, 22},
-	{0xc018, 23},
-	{0xc019, 24},
-	{0xc01a, 25},
-	{0xc01b, 26},
-	{0xc01c, 27},
-	{0xc01d, 28},
-	{0xc01e, 29},
-	{0xc01f, 30},
-	{0xc020, 31},
-	{0xc021, 32},
-	{0xc022, 33},
-	{0xc023, 34},
-	{0xc024, 35},
-	{0xc025, 36},
-	{0xc026, 37},
-	{0xc027, 38},
-	{0xc028, 39},
-	{0xc029, 40},
-	{0xc02a, 41},
-	{0xc02b, 42},
-	{0xc02c, 43},
-	{0xc02d, 44},
-	{0xc02e, 45},
-	{0xc02f, 46},
-	{0xc030, 47},
-	{0xc031, 48},
-	{0xc032, 49},
-	{0xc033, 50},
-	{0xc034, 51},
-	{0xc035, 52},
-	{0xc036, 53},
-	{0xc037, 54},
-	{0xc038, 55},
-	{0xc039, 56},
-	{0xc03a, 57},
-	{0xc03b, 58},
-	{0xc03c, 2175},
-	{0xc03e, 0},
-	{0xc03f, 1},
-	{0xc040, 2},
-	{0xc041, 3},
-	{0xc042, 4},
-	{0xc043, 5},
-	{0xc044, 6},
-	{0xc045, 7},
-	{0xc046, 8},
-	{0xc047, 9},
-	{0xc048, 10},
-	{0xc049, 11},
-	{0xc04a, 12},
-	{0xc04b, 13},
-	{0xc04c, 14},
-	{0xc04d, 15},
-	{0xc04e, 16},
-	{0xc04f, 17},
-	{0xc050, 18},
-	{0xc051, 2176},
-	{0xc053, 0},
-	{0xc054, 1},
-	{0xc055, 2},
-	{0xc056, 3},
-	{0xc057, 4},
-	{0xc058, 2177},
-	{0xc05a, 0},
-	{0xc05b, 1},
-	{0xc05c, 2178},
-	{0xc05e, 0},
-	{0xc05f, 1},
-	{0xc060, 2179},
-	{0xc062, 0},
-	{0xc063, 1},
-	{0xc064, 2},
-	{0xc065, 3},
-	{0xc066, 4},
-	{0xc067, 5},
-	{0xc068, 2180},
-	{0xc069, 2181},
-	{0xc06b, 0},
-	{0xc06c, 1},
-	{0xc06d, 2},
-	{0xc06e, 3},
-	{0xc06f, 4},
-	{0xc070, 5},
-	{0xc071, 6},
-	{0xc072, 7},
-	{0xc073, 8},
-	{0xc074, 9},
-	{0xc075, 10},
-	{0xc076, 11},
-	{0xc077, 12},
-	{0xc078, 13},
-	{0xc079, 14},
-	{0xc07a, 15},
-	{0xc07b, 16},
-	{0xc07c, 17},
-	{0xc07d, 18},
-	{0xc07e, 19},
-	{0xc07f, 20},
-	{0xc080, 21},
-	{0xc081, 22},
-	{0xc082, 23},
-	{0xc083, 24},
-	{0xc084, 25},
-	{0xc085, 26},
-	{0xc086, 27},
-	{0xc087, 28},
-	{0xc088, 29},
-	{0xc089, 30},
-	{0xc08a, 31},
-	{0xc08b, 32},
-	{0xc08c, 33},
-	{0xc08d, 34},
-	{0xc08e, 35},
-	{0xc08f, 36},
-	{0xc090, 2182},
-	{0xc091, 2183},
-	{0xc093, 0},
-	{0xc094, 2184},
-	{0xc096, 0},
-	{0xc097, 1},
-	{0xc098, 2185},
-	{0xc09a, 0},
-	{0xc09b, 1},
-	{0xc09c, 2},
-	{0xc09d, 3},
-	{0xc09e, 4},
-	{0xc09f, 5},
-	{0xc0a0, 2186},
-	{0xc0a1, 2187},
-	{0xc0a3, 2188},
-	{0xc0a5, 2189},
-	{0xc0a7, 0},
-	{0xc0a8, 1},
-	{0xc0a9, 2},
-	{0xc0aa, 3},
-	{0xc0ab, 4},
-	{0xc0ac, 2190},
-	{0xc0ad, 2191},
-	{0xc0af, 2192},
-	{0xc0b0, 2193},
-	{0xc0b2, 0},
-	{0xc0b3, 2194},
-	{0xc0b4, 2195},
-	{0xc0b5, 2196},
-	{0xc0b6, 2197},
-	{0xc0b8, 0},
-	{0xc0b9, 1},
-	{0xc0ba, 2},
-	{0xc0bb, 3},
-	{0xc0bc, 2198},
-	{0xc0bd, 2199},
-	{0xc0bf, 2200},
-	{0xc0c0, 2201},
-	{0xc0c1, 2202},
-	{0xc0c3, 0},
-	{0xc0c4, 1},
-	{0xc0c5, 2203},
-	{0xc0c7, 0},
-	{0xc0c8, 2204},
-	{0xc0c9, 2205},
-	{0xc0cb, 0},
-	{0xc0cc, 2206},
-	{0xc0ce, 0},
-	{0xc0cf, 1},
-	{0xc0d0, 2207},
-	{0xc0d2, 0},
-	{0xc0d3, 1},
-	{0xc0d4, 2},
-	{0xc0d5, 3},
-	{0xc0d6, 4},
-	{0xc0d7, 5},
-	{0xc0d8, 2208},
-	{0xc0d9, 2209},
-	{0xc0db, 2210},
-	{0xc0dc, 2211},
-	{0xc0dd, 2212},
-	{0xc0df, 0},
-	{0xc0e0, 1},
-	{0xc0e1, 2},
-	{0xc0e2, 3},
-	{0xc0e3, 4},
-	{0xc0e4, 2213},
-	{0xc0e5, 2214},
-	{0xc0e7, 0},
-	{0xc0e8, 2215},
-	{0xc0ea, 0},
-	{0xc0eb, 1},
-	{0xc0ec, 2216},
-	{0xc0ee, 0},
-	{0xc0ef, 1},
-	{0xc0f0, 2},
-	{0xc0f1, 3},
-	{0xc0f2, 4},
-	{0xc0f3, 5},
-	{0xc0f4, 2217},
-	{0xc0f5, 2218},
-	{0xc0f7, 2219},
-	{0xc0f9, 2220},
-	{0xc0fb, 0},
-	{0xc0fc, 1},
-	{0xc0fd, 2},
-	{0xc0fe, 3},
-	{0xc0ff, 4},
-	{0xc100, 2221},
-	{0xc102, 0},
-	{0xc103, 1},
-	{0xc104, 2222},
-	{0xc106, 0},
-	{0xc107, 1},
-	{0xc108, 2223},
-	{0xc10a, 0},
-	{0xc10b, 1},
-	{0xc10c, 2},
-	{0xc10d, 3},
-	{0xc10e, 4},
-	{0xc10f, 5},
-	{0xc110, 2224},
-	{0xc112, 0},
-	{0xc113, 1},
-	{0xc114, 2},
-	{0xc115, 2225},
-	{0xc117, 0},
-	{0xc118, 1},
-	{0xc119, 2},
-	{0xc11a, 3},
-	{0xc11b, 4},
-	{0xc11c, 2226},
-	{0xc11d, 2227},
-	{0xc11e, 2228},
-	{0xc11f, 2229},
-	{0xc120, 2230},
-	{0xc122, 0},
-	{0xc123, 2231},
-	{0xc124, 2232},
-	{0xc126, 2233},
-	{0xc127, 2234},
-	{0xc129, 0},
-	{0xc12a, 1},
-	{0xc12b, 2},
-	{0xc12c, 2235},
-	{0xc12d, 2236},
-	{0xc12f, 2237},
-	{0xc130, 2238},
-	{0xc131, 2239},
-	{0xc133, 0},
-	{0xc134, 1},
-	{0xc135, 2},
-	{0xc136, 2240},
-	{0xc138, 2241},
-	{0xc139, 2242},
-	{0xc13b, 0},
-	{0xc13c, 2243},
-	{0xc13e, 0},
-	{0xc13f, 1},
-	{0xc140, 2244},
-	{0xc142, 0},
-	{0xc143, 1},
-	{0xc144, 2},
-	{0xc145, 3},
-	{0xc146, 4},
-	{0xc147, 5},
-	{0xc148, 2245},
-	{0xc149, 2246},
-	{0xc14b, 2247},
-	{0xc14c, 2248},
-	{0xc14d, 2249},
-	{0xc14f, 0},
-	{0xc150, 1},
-	{0xc151, 2},
-	{0xc152, 3},
-	{0xc153, 4},
-	{0xc154, 2250},
-	{0xc155, 2251},
-	{0xc157, 0},
-	{0xc158, 2252},
-	{0xc15a, 0},
-	{0xc15b, 1},
-	{0xc15c, 2253},
-	{0xc15e, 0},
-	{0xc15f, 1},
-	{0xc160, 2},
-	{0xc161, 3},
-	{0xc162, 4},
-	{0xc163, 5},
-	{0xc164, 2254},
-	{0xc165, 2255},
-	{0xc167, 2256},
-	{0xc168, 2257},
-	{0xc169, 2258},
-	{0xc16b, 0},
-	{0xc16c, 1},
-	{0xc16d, 2},
-	{0xc16e, 3},
-	{0xc16f, 4},
-	{0xc170, 2259},
-	{0xc172, 0},
-	{0xc173, 1},
-	{0xc174, 2260},
-	{0xc176, 0},
-	{0xc177, 1},
-	{0xc178, 2261},
-	{0xc17a, 0},
-	{0xc17b, 1},
-	{0xc17c, 2},
-	{0xc17d, 3},
-	{0xc17e, 4},
-	{0xc17f, 5},
-	{0xc180, 6},
-	{0xc181, 7},
-	{0xc182, 8},
-	{0xc183, 9},
-	{0xc184, 10},
-	{0xc185, 2262},
-	{0xc187, 0},
-	{0xc188, 1},
-	{0xc189, 2},
-	{0xc18a, 3},
-	{0xc18b, 4},
-	{0xc18c, 2263},
-	{0xc18d, 2264},
-	{0xc18e, 2265},
-	{0xc190, 2266},
-	{0xc192, 0},
-	{0xc193, 1},
-	{0xc194, 2267},
-	{0xc196, 2268},
-	{0xc198, 0},
-	{0xc199, 1},
-	{0xc19a, 2},
-	{0xc19b, 3},
-	{0xc19c, 2269},
-	{0xc19d, 2270},
-	{0xc19f, 2271},
-	{0xc1a1, 2272},
-	{0xc1a3, 0},
-	{0xc1a4, 1},
-	{0xc1a5, 2273},
-	{0xc1a7, 0},
-	{0xc1a8, 2274},
-	{0xc1a9, 2275},
-	{0xc1ab, 0},
-	{0xc1ac, 2276},
-	{0xc1ae, 0},
-	{0xc1af, 1},
-	{0xc1b0, 2277},
-	{0xc1b2, 0},
-	{0xc1b3, 1},
-	{0xc1b4, 2},
-	{0xc1b5, 3},
-	{0xc1b6, 4},
-	{0xc1b7, 5},
-	{0xc1b8, 6},
-	{0xc1b9, 7},
-	{0xc1ba, 8},
-	{0xc1bb, 9},
-	{0xc1bc, 10},
-	{0xc1bd, 2278},
-	{0xc1bf, 0},
-	{0xc1c0, 1},
-	{0xc1c1, 2},
-	{0xc1c2, 3},
-	{0xc1c3, 4},
-	{0xc1c4, 2279},
-	{0xc1c6, 0},
-	{0xc1c7, 1},
-	{0xc1c8, 2280},
-	{0xc1ca, 0},
-	{0xc1cb, 1},
-	{0xc1cc, 2281},
-	{0xc1ce, 0},
-	{0xc1cf, 1},
-	{0xc1d0, 2},
-	{0xc1d1, 3},
-	{0xc1d2, 4},
-	{0xc1d3, 5},
-	{0xc1d4, 2282},
-	{0xc1d6, 0},
-	{0xc1d7, 2283},
-	{0xc1d8, 2284},
-	{0xc1da, 0},
-	{0xc1db, 1},
-	{0xc1dc, 2},
-	{0xc1dd, 3},
-	{0xc1de, 4},
-	{0xc1df, 5},
-	{0xc1e0, 2285},
-	{0xc1e2, 0},
-	{0xc1e3, 1},
-	{0xc1e4, 2286},
-	{0xc1e6, 0},
-	{0xc1e7, 1},
-	{0xc1e8, 2287},
-	{0xc1ea, 0},
-	{0xc1eb, 1},
-	{0xc1ec, 2},
-	{0xc1ed, 3},
-	{0xc1ee, 4},
-	{0xc1ef, 5},
-	{0xc1f0, 2288},
-	{0xc1f1, 2289},
-	{0xc1f3, 2290},
-	{0xc1f5, 0},
-	{0xc1f6, 1},
-	{0xc1f7, 2},
-	{0xc1f8, 3},
-	{0xc1f9, 4},
-	{0xc1fa, 5},
-	{0xc1fb, 6},
-	{0xc1fc, 2291},
-	{0xc1fd, 2292},
-	{0xc1ff, 0},
-	{0xc200, 2293},
-	{0xc202, 0},
-	{0xc203, 1},
-	{0xc204, 2294},
-	{0xc206, 0},
-	{0xc207, 1},
-	{0xc208, 2},
-	{0xc209, 3},
-	{0xc20a, 4},
-	{0xc20b, 5},
-	{0xc20c, 2295},
-	{0xc20d, 2296},
-	{0xc20f, 2297},
-	{0xc211, 2298},
-	{0xc213, 0},
-	{0xc214, 1},
-	{0xc215, 2},
-	{0xc216, 3},
-	{0xc217, 4},
-	{0xc218, 2299},
-	{0xc219, 2300},
-	{0xc21b, 0},
-	{0xc21c, 2301},
-	{0xc21e, 0},
-	{0xc21f, 2302},
-	{0xc220, 2303},
-	{0xc222, 0},
-	{0xc223, 1},
-	{0xc224, 2},
-	{0xc225, 3},
-	{0xc226, 4},
-	{0xc227, 5},
-	{0xc228, 2304},
-	{0xc229, 2305},
-	{0xc22b, 2306},
-	{0xc22d, 2307},
-	{0xc22f, 2308},
-	{0xc231, 2309},
-	{0xc232, 2310},
-	{0xc234, 2311},
-	{0xc236, 0},
-	{0xc237, 1},
-	{0xc238, 2},
-	{0xc239, 3},
-	{0xc23a, 4},
-	{0xc23b, 5},
-	{0xc23c, 6},
-	{0xc23d, 7},
-	{0xc23e, 8},
-	{0xc23f, 9},
-	{0xc240, 10},
-	{0xc241, 11},
-	{0xc242, 12},
-	{0xc243, 13},
-	{0xc244, 14},
-	{0xc245, 15},
-	{0xc246, 16},
-	{0xc247, 17},
-	{0xc248, 2312},
-	{0xc24a, 0},
-	{0xc24b, 1},
-	{0xc24c, 2},
-	{0xc24d, 3},
-	{0xc24e, 4},
-	{0xc24f, 5},
-	{0xc250, 2313},
-	{0xc251, 2314},
-	{0xc253, 0},
-	{0xc254, 2315},
-	{0xc256, 0},
-	{0xc257, 1},
-	{0xc258, 2316},
-	{0xc25a, 0},
-	{0xc25b, 1},
-	{0xc25c, 2},
-	{0xc25d, 3},
-	{0xc25e, 4},
-	{0xc25f, 5},
-	{0xc260, 2317},
-	{0xc262, 0},
-	{0xc263, 1},
-	{0xc264, 2},
-	{0xc265, 2318},
-	{0xc267, 0},
-	{0xc268, 1},
-	{0xc269, 2},
-	{0xc26a, 3},
-	{0xc26b, 4},
-	{0xc26c, 2319},
-	{0xc26d, 2320},
-	{0xc26f, 0},
-	{0xc270, 2321},
-	{0xc272, 0},
-	{0xc273, 1},
-	{0xc274, 2322},
-	{0xc276, 0},
-	{0xc277, 1},
-	{0xc278, 2},
-	{0xc279, 3},
-	{0xc27a, 4},
-	{0xc27b, 5},
-	{0xc27c, 2323},
-	{0xc27d, 2324},
-	{0xc27f, 2325},
-	{0xc281, 2326},
-	{0xc283, 0},
-	{0xc284, 1},
-	{0xc285, 2},
-	{0xc286, 3},
-	{0xc287, 4},
-	{0xc288, 2327},
-	{0xc289, 2328},
-	{0xc28b, 0},
-	{0xc28c, 1},
-	{0xc28d, 2},
-	{0xc28e, 3},
-	{0xc28f, 4},
-	{0xc290, 2329},
-	{0xc292, 0},
-	{0xc293, 1},
-	{0xc294, 2},
-	{0xc295, 3},
-	{0xc296, 4},
-	{0xc297, 5},
-	{0xc298, 2330},
-	{0xc29a, 0},
-	{0xc29b, 2331},
-	{0xc29d, 2332},
-	{0xc29f, 0},
-	{0xc2a0, 1},
-	{0xc2a1, 2},
-	{0xc2a2, 3},
-	{0xc2a3, 4},
-	{0xc2a4, 2333},
-	{0xc2a5, 2334},
-	{0xc2a7, 0},
-	{0xc2a8, 2335},
-	{0xc2aa, 0},
-	{0xc2ab, 1},
-	{0xc2ac, 2336},
-	{0xc2ad, 2337},
-	{0xc2af, 0},
-	{0xc2b0, 1},
-	{0xc2b1, 2},
-	{0xc2b2, 3},
-	{0xc2b3, 4},
-	{0xc2b4, 2338},
-	{0xc2b5, 2339},
-	{0xc2b7, 2340},
-	{0xc2b9, 2341},
-	{0xc2bb, 0},
-	{0xc2bc, 1},
-	{0xc2bd, 2},
-	{0xc2be, 3},
-	{0xc2bf, 4},
-	{0xc2c0, 5},
-	{0xc2c1, 6},
-	{0xc2c2, 7},
-	{0xc2c3, 8},
-	{0xc2c4, 9},
-	{0xc2c5, 10},
-	{0xc2c6, 11},
-	{0xc2c7, 12},
-	{0xc2c8, 13},
-	{0xc2c9, 14},
-	{0xc2ca, 15},
-	{0xc2cb, 16},
-	{0xc2cc, 17},
-	{0xc2cd, 18},
-	{0xc2ce, 19},
-	{0xc2cf, 20},
-	{0xc2d0, 21},
-	{0xc2d1, 22},
-	{0xc2d2, 23},
-	{0xc2d3, 24},
-	{0xc2d4, 25},
-	{0xc2d5, 26},
-	{0xc2d6, 27},
-	{0xc2d7, 28},
-	{0xc2d8, 29},
-	{0xc2d9, 30},
-	{0xc2da, 31},
-	{0xc2db, 32},
-	{0xc2dc, 2342},
-	{0xc2dd, 2343},
-	{0xc2df, 0},
-	{0xc2e0, 2344},
-	{0xc2e2, 0},
-	{0xc2e3, 2345},
-	{0xc2e4, 2346},
-	{0xc2e6, 0},
-	{0xc2e7, 1},
-	{0xc2e8, 2},
-	{0xc2e9, 3},
-	{0xc2ea, 4},
-	{0xc2eb, 2347},
-	{0xc2ec, 2348},
-	{0xc2ed, 2349},
-	{0xc2ef, 2350},
-	{0xc2f1, 2351},
-	{0xc2f3, 0},
-	{0xc2f4, 1},
-	{0xc2f5, 2},
-	{0xc2f6, 2352},
-	{0xc2f8, 2353},
-	{0xc2f9, 2354},
-	{0xc2fb, 2355},
-	{0xc2fc, 2356},
-	{0xc2fe, 0},
-	{0xc2ff, 1},
-	{0xc300, 2357},
-	{0xc302, 0},
-	{0xc303, 1},
-	{0xc304, 2},
-	{0xc305, 3},
-	{0xc306, 4},
-	{0xc307, 5},
-	{0xc308, 2358},
-	{0xc309, 2359},
-	{0xc30b, 0},
-	{0xc30c, 2360},
-	{0xc30d, 2361},
-	{0xc30f, 0},
-	{0xc310, 1},
-	{0xc311, 2},
-	{0xc312, 3},
-	{0xc313, 2362},
-	{0xc314, 2363},
-	{0xc315, 2364},
-	{0xc317, 0},
-	{0xc318, 2365},
-	{0xc31a, 0},
-	{0xc31b, 1},
-	{0xc31c, 2366},
-	{0xc31e, 0},
-	{0xc31f, 1},
-	{0xc320, 2},
-	{0xc321, 3},
-	{0xc322, 4},
-	{0xc323, 5},
-	{0xc324, 2367},
-	{0xc325, 2368},
-	{0xc327, 0},
-	{0xc328, 2369},
-	{0xc329, 2370},
-	{0xc32b, 0},
-	{0xc32c, 1},
-	{0xc32d, 2},
-	{0xc32e, 3},
-	{0xc32f, 4},
-	{0xc330, 5},
-	{0xc331, 6},
-	{0xc332, 7},
-	{0xc333, 8},
-	{0xc334, 9},
-	{0xc335, 10},
-	{0xc336, 11},
-	{0xc337, 12},
-	{0xc338, 13},
-	{0xc339, 14},
-	{0xc33a, 15},
-	{0xc33b, 16},
-	{0xc33c, 17},
-	{0xc33d, 18},
-	{0xc33e, 19},
-	{0xc33f, 20},
-	{0xc340, 21},
-	{0xc341, 22},
-	{0xc342, 23},
-	{0xc343, 24},
-	{0xc344, 25},
-	{0xc345, 2371},
-	{0xc347, 0},
-	{0xc348, 1},
-	{0xc349, 2},
-	{0xc34a, 3},
-	{0xc34b, 4},
-	{0xc34c, 5},
-	{0xc34d, 6},
-	{0xc34e, 7},
-	{0xc34f, 8},
-	{0xc350, 9},
-	{0xc351, 10},
-	{0xc352, 11},
-	{0xc353, 12},
-	{0xc354, 13},
-	{0xc355, 14},
-	{0xc356, 15},
-	{0xc357, 16},
-	{0xc358, 17},
-	{0xc359, 18},
-	{0xc35a, 19},
-	{0xc35b, 20},
-	{0xc35c, 21},
-	{0xc35d, 22},
-	{0xc35e, 23},
-	{0xc35f, 24},
-	{0xc360, 25},
-	{0xc361, 26},
-	{0xc362, 27},
-	{0xc363, 28},
-	{0xc364, 29},
-	{0xc365, 30},
-	{0xc366, 31},
-	{0xc367, 32},
-	{0xc368, 2372},
-	{0xc369, 2373},
-	{0xc36b, 0},
-	{0xc36c, 2374},
-	{0xc36e, 0},
-	{0xc36f, 1},
-	{0xc370, 2375},
-	{0xc372, 2376},
-	{0xc374, 0},
-	{0xc375, 1},
-	{0xc376, 2},
-	{0xc377, 3},
-	{0xc378, 2377},
-	{0xc379, 2378},
-	{0xc37b, 0},
-	{0xc37c, 2379},
-	{0xc37d, 2380},
-	{0xc37f, 0},
-	{0xc380, 1},
-	{0xc381, 2},
-	{0xc382, 3},
-	{0xc383, 4},
-	{0xc384, 2381},
-	{0xc386, 0},
-	{0xc387, 1},
-	{0xc388, 2382},
-	{0xc38a, 0},
-	{0xc38b, 1},
-	{0xc38c, 2383},
-	{0xc38e, 0},
-	{0xc38f, 1},
-	{0xc390, 2},
-	{0xc391, 3},
-	{0xc392, 4},
-	{0xc393, 5},
-	{0xc394, 6},
-	{0xc395, 7},
-	{0xc396, 8},
-	{0xc397, 9},
-	{0xc398, 10},
-	{0xc399, 11},
-	{0xc39a, 12},
-	{0xc39b, 13},
-	{0xc39c, 14},
-	{0xc39d, 15},
-	{0xc39e, 16},
-	{0xc39f, 17},
-	{0xc3a0, 18},
-	{0xc3a1, 19},
-	{0xc3a2, 20},
-	{0xc3a3, 21},
-	{0xc3a4, 22},
-	{0xc3a5, 23},
-	{0xc3a6, 24},
-	{0xc3a7, 25},
-	{0xc3a8, 26},
-	{0xc3a9, 27},
-	{0xc3aa, 28},
-	{0xc3ab, 29},
-	{0xc3ac, 30},
-	{0xc3ad, 31},
-	{0xc3ae, 32},
-	{0xc3af, 33},
-	{0xc3b0, 34},
-	{0xc3b1, 35},
-	{0xc3b2, 36},
-	{0xc3b3, 37},
-	{0xc3b4, 38},
-	{0xc3b5, 39},
-	{0xc3b6, 40},
-	{0xc3b7, 41},
-	{0xc3b8, 42},
-	{0xc3b9, 43},
-	{0xc3ba, 44},
-	{0xc3bb, 45},
-	{0xc3bc, 46},
-	{0xc3bd, 47},
-	{0xc3be, 48},
-	{0xc3bf, 49},
-	{0xc3c0, 2384},
-	{0xc3c2, 0},
-	{0xc3c3, 1},
-	{0xc3c4, 2},
-	{0xc3c5, 3},
-	{0xc3c6, 4},
-	{0xc3c7, 5},
-	{0xc3c8, 6},
-	{0xc3c9, 7},
-	{0xc3ca, 8},
-	{0xc3cb, 9},
-	{0xc3cc, 10},
-	{0xc3cd, 11},
-	{0xc3ce, 12},
-	{0xc3cf, 13},
-	{0xc3d0, 14},
-	{0xc3d1, 15},
-	{0xc3d2, 16},
-	{0xc3d3, 17},
-	{0xc3d4, 18},
-	{0xc3d5, 19},
-	{0xc3d6, 20},
-	{0xc3d7, 21},
-	{0xc3d8, 2385},
-	{0xc3d9, 2386},
-	{0xc3db, 0},
-	{0xc3dc, 2387},
-	{0xc3de, 0},
-	{0xc3df, 2388},
-	{0xc3e0, 2389},
-	{0xc3e2, 2390},
-	{0xc3e4, 0},
-	{0xc3e5, 1},
-	{0xc3e6, 2},
-	{0xc3e7, 3},
-	{0xc3e8, 2391},
-	{0xc3e9, 2392},
-	{0xc3eb, 0},
-	{0xc3ec, 1},
-	{0xc3ed, 2393},
-	{0xc3ef, 0},
-	{0xc3f0, 1},
-	{0xc3f1, 2},
-	{0xc3f2, 3},
-	{0xc3f3, 4},
-	{0xc3f4, 2394},
-	{0xc3f5, 2395},
-	{0xc3f7, 0},
-	{0xc3f8, 2396},
-	{0xc3fa, 0},
-	{0xc3fb, 1},
-	{0xc3fc, 2},
-	{0xc3fd, 3},
-	{0xc3fe, 4},
-	{0xc3ff, 5},
-	{0xc401, 0},
-	{0xc402, 1},
-	{0xc403, 2},
-	{0xc404, 3},
-	{0xc405, 4},
-	{0xc406, 5},
-	{0xc407, 6},
-	{0xc408, 2397},
-	{0xc40a, 0},
-	{0xc40b, 1},
-	{0xc40c, 2},
-	{0xc40d, 3},
-	{0xc40e, 4},
-	{0xc40f, 5},
-	{0xc410, 2398},
-	{0xc412, 0},
-	{0xc413, 1},
-	{0xc414, 2},
-	{0xc415, 3},
-	{0xc416, 4},
-	{0xc417, 5},
-	{0xc418, 6},
-	{0xc419, 7},
-	{0xc41a, 8},
-	{0xc41b, 9},
-	{0xc41c, 10},
-	{0xc41d, 11},
-	{0xc41e, 12},
-	{0xc41f, 13},
-	{0xc420, 14},
-	{0xc421, 15},
-	{0xc422, 16},
-	{0xc423, 17},
-	{0xc424, 2399},
-	{0xc426, 0},
-	{0xc427, 1},
-	{0xc428, 2},
-	{0xc429, 3},
-	{0xc42a, 4},
-	{0xc42b, 5},
-	{0xc42c, 2400},
-	{0xc42e, 0},
-	{0xc42f, 1},
-	{0xc430, 2401},
-	{0xc432, 0},
-	{0xc433, 1},
-	{0xc434, 2402},
-	{0xc436, 0},
-	{0xc437, 1},
-	{0xc438, 2},
-	{0xc439, 3},
-	{0xc43a, 4},
-	{0xc43b, 5},
-	{0xc43c, 2403},
-	{0xc43d, 2404},
-	{0xc43f, 0},
-	{0xc440, 1},
-	{0xc441, 2},
-	{0xc442, 3},
-	{0xc443, 4},
-	{0xc444, 5},
-	{0xc445, 6},
-	{0xc446, 7},
-	{0xc447, 8},
-	{0xc448, 2405},
-	{0xc44a, 0},
-	{0xc44b, 1},
-	{0xc44c, 2},
-	{0xc44d, 3},
-	{0xc44e, 4},
-	{0xc44f, 5},
-	{0xc450, 6},
-	{0xc451, 7},
-	{0xc452, 8},
-	{0xc453, 9},
-	{0xc454, 10},
-	{0xc455, 11},
-	{0xc456, 12},
-	{0xc457, 13},
-	{0xc458, 14},
-	{0xc459, 15},
-	{0xc45a, 16},
-	{0xc45b, 17},
-	{0xc45c, 18},
-	{0xc45d, 19},
-	{0xc45e, 20},
-	{0xc45f, 21},
-	{0xc460, 22},
-	{0xc461, 23},
-	{0xc462, 24},
-	{0xc463, 25},
-	{0xc464, 2406},
-	{0xc465, 2407},
-	{0xc467, 0},
-	{0xc468, 2408},
-	{0xc46a, 0},
-	{0xc46b, 1},
-	{0xc46c, 2409},
-	{0xc46e, 0},
-	{0xc46f, 1},
-	{0xc470, 2},
-	{0xc471, 3},
-	{0xc472, 4},
-	{0xc473, 5},
-	{0xc474, 2410},
-	{0xc475, 2411},
-	{0xc477, 0},
-	{0xc478, 1},
-	{0xc479, 2412},
-	{0xc47b, 0},
-	{0xc47c, 1},
-	{0xc47d, 2},
-	{0xc47e, 3},
-	{0xc47f, 4},
-	{0xc480, 2413},
-	{0xc482, 0},
-	{0xc483, 1},
-	{0xc484, 2},
-	{0xc485, 3},
-	{0xc486, 4},
-	{0xc487, 5},
-	{0xc488, 6},
-	{0xc489, 7},
-	{0xc48a, 8},
-	{0xc48b, 9},
-	{0xc48c, 10},
-	{0xc48d, 11},
-	{0xc48e, 12},
-	{0xc48f, 13},
-	{0xc490, 14},
-	{0xc491, 15},
-	{0xc492, 16},
-	{0xc493, 17},
-	{0xc494, 2414},
-	{0xc496, 0},
-	{0xc497, 1},
-	{0xc498, 2},
-	{0xc499, 3},
-	{0xc49a, 4},
-	{0xc49b, 5},
-	{0xc49c, 2415},
-	{0xc49e, 0},
-	{0xc49f, 1},
-	{0xc4a0, 2},
-	{0xc4a1, 3},
-	{0xc4a2, 4},
-	{0xc4a3, 5},
-	{0xc4a4, 6},
-	{0xc4a5, 7},
-	{0xc4a6, 8},
-	{0xc4a7, 9},
-	{0xc4a8, 10},
-	{0xc4a9, 11},
-	{0xc4aa, 12},
-	{0xc4ab, 13},
-	{0xc4ac, 14},
-	{0xc4ad, 15},
-	{0xc4ae, 16},
-	{0xc4af, 17},
-	{0xc4b0, 18},
-	{0xc4b1, 19},
-	{0xc4b2, 20},
-	{0xc4b3, 21},
-	{0xc4b4, 22},
-	{0xc4b5, 23},
-	{0xc4b6, 24},
-	{0xc4b7, 25},
-	{0xc4b8, 2416},
-	{0xc4ba, 0},
-	{0xc4bb, 1},
-	{0xc4bc, 2417},
-	{0xc4be, 0},
-	{0xc4bf, 1},
-	{0xc4c0, 2},
-	{0xc4c1, 3},
-	{0xc4c2, 4},
-	{0xc4c3, 5},
-	{0xc4c4, 6},
-	{0xc4c5, 7},
-	{0xc4c6, 8},
-	{0xc4c7, 9},
-	{0xc4c8, 10},
-	{0xc4c9, 11},
-	{0xc4ca, 12},
-	{0xc4cb, 13},
-	{0xc4cc, 14},
-	{0xc4cd, 15},
-	{0xc4ce, 16},
-	{0xc4cf, 17},
-	{0xc4d0, 18},
-	{0xc4d1, 19},
-	{0xc4d2, 20},
-	{0xc4d3, 21},
-	{0xc4d4, 22},
-	{0xc4d5, 23},
-	{0xc4d6, 24},
-	{0xc4d7, 25},
-	{0xc4d8, 26},
-	{0xc4d9, 27},
-	{0xc4da, 28},
-	{0xc4db, 29},
-	{0xc4dc, 30},
-	{0xc4dd, 31},
-	{0xc4de, 32},
-	{0xc4df, 33},
-	{0xc4e0, 34},
-	{0xc4e1, 35},
-	{0xc4e2, 36},
-	{0xc4e3, 37},
-	{0xc4e4, 38},
-	{0xc4e5, 39},
-	{0xc4e6, 40},
-	{0xc4e7, 41},
-	{0xc4e8, 42},
-	{0xc4e9, 2418},
-	{0xc4eb, 0},
-	{0xc4ec, 1},
-	{0xc4ed, 2},
-	{0xc4ee, 3},
-	{0xc4ef, 4},
-	{0xc4f0, 2419},
-	{0xc4f1, 2420},
-	{0xc4f3, 0},
-	{0xc4f4, 2421},
-	{0xc4f6, 0},
-	{0xc4f7, 1},
-	{0xc4f8, 2422},
-	{0xc4fa, 2423},
-	{0xc4fc, 0},
-	{0xc4fd, 1},
-	{0xc4fe, 2},
-	{0xc4ff, 2424},
-	{0xc500, 2425},
-	{0xc501, 2426},
-	{0xc503, 0},
-	{0xc504, 1},
-	{0xc505, 2},
-	{0xc506, 3},
-	{0xc507, 4},
-	{0xc508, 5},
-	{0xc509, 6},
-	{0xc50a, 7},
-	{0xc50b, 8},
-	{0xc50c, 2427},
-	{0xc50e, 0},
-	{0xc50f, 1},
-	{0xc510, 2428},
-	{0xc512, 0},
-	{0xc513, 1},
-	{0xc514, 2429},
-	{0xc516, 0},
-	{0xc517, 1},
-	{0xc518, 2},
-	{0xc519, 3},
-	{0xc51a, 4},
-	{0xc51b, 5},
-	{0xc51c, 2430},
-	{0xc51e, 0},
-	{0xc51f, 1},
-	{0xc520, 2},
-	{0xc521, 3},
-	{0xc522, 4},
-	{0xc523, 5},
-	{0xc524, 6},
-	{0xc525, 7},
-	{0xc526, 8},
-	{0xc527, 9},
-	{0xc528, 2431},
-	{0xc529, 2432},
-	{0xc52b, 0},
-	{0xc52c, 2433},
-	{0xc52e, 0},
-	{0xc52f, 1},
-	{0xc530, 2434},
-	{0xc532, 0},
-	{0xc533, 1},
-	{0xc534, 2},
-	{0xc535, 3},
-	{0xc536, 4},
-	{0xc537, 5},
-	{0xc538, 2435},
-	{0xc539, 2436},
-	{0xc53b, 2437},
-	{0xc53d, 2438},
-	{0xc53f, 0},
-	{0xc540, 1},
-	{0xc541, 2},
-	{0xc542, 3},
-	{0xc543, 4},
-	{0xc544, 2439},
-	{0xc545, 2440},
-	{0xc547, 0},
-	{0xc548, 2441},
-	{0xc549, 2442},
-	{0xc54a, 2443},
-	{0xc54c, 2444},
-	{0xc54d, 2445},
-	{0xc54e, 2446},
-	{0xc550, 0},
-	{0xc551, 1},
-	{0xc552, 2},
-	{0xc553, 2447},
-	{0xc554, 2448},
-	{0xc555, 2449},
-	{0xc557, 2450},
-	{0xc558, 2451},
-	{0xc559, 2452},
-	{0xc55b, 0},
-	{0xc55c, 1},
-	{0xc55d, 2453},
-	{0xc55e, 2454},
-	{0xc560, 2455},
-	{0xc561, 2456},
-	{0xc563, 0},
-	{0xc564, 2457},
-	{0xc566, 0},
-	{0xc567, 1},
-	{0xc568, 2458},
-	{0xc56a, 0},
-	{0xc56b, 1},
-	{0xc56c, 2},
-	{0xc56d, 3},
-	{0xc56e, 4},
-	{0xc56f, 5},
-	{0xc570, 2459},
-	{0xc571, 2460},
-	{0xc573, 2461},
-	{0xc574, 2462},
-	{0xc575, 2463},
-	{0xc577, 0},
-	{0xc578, 1},
-	{0xc579, 2},
-	{0xc57a, 3},
-	{0xc57b, 4},
-	{0xc57c, 2464},
-	{0xc57d, 2465},
-	{0xc57f, 0},
-	{0xc580, 2466},
-	{0xc582, 0},
-	{0xc583, 1},
-	{0xc584, 2467},
-	{0xc586, 0},
-	{0xc587, 2468},
-	{0xc589, 0},
-	{0xc58a, 1},
-	{0xc58b, 2},
-	{0xc58c, 2469},
-	{0xc58d, 2470},
-	{0xc58f, 2471},
-	{0xc591, 2472},
-	{0xc593, 0},
-	{0xc594, 1},
-	{0xc595, 2473},
-	{0xc597, 2474},
-	{0xc598, 2475},
-	{0xc59a, 0},
-	{0xc59b, 1},
-	{0xc59c, 2476},
-	{0xc59e, 0},
-	{0xc59f, 1},
-	{0xc5a0, 2477},
-	{0xc5a2, 0},
-	{0xc5a3, 1},
-	{0xc5a4, 2},
-	{0xc5a5, 3},
-	{0xc5a6, 4},
-	{0xc5a7, 5},
-	{0xc5a8, 6},
-	{0xc5a9, 2478},
-	{0xc5ab, 0},
-	{0xc5ac, 1},
-	{0xc5ad, 2},
-	{0xc5ae, 3},
-	{0xc5af, 4},
-	{0xc5b0, 5},
-	{0xc5b1, 6},
-	{0xc5b2, 7},
-	{0xc5b3, 8},
-	{0xc5b4, 2479},
-	{0xc5b5, 2480},
-	{0xc5b7, 0},
-	{0xc5b8, 2481},
-	{0xc5b9, 2482},
-	{0xc5bb, 2483},
-	{0xc5bc, 2484},
-	{0xc5bd, 2485},
-	{0xc5be, 2486},
-	{0xc5c0, 0},
-	{0xc5c1, 1},
-	{0xc5c2, 2},
-	{0xc5c3, 3},
-	{0xc5c4, 2487},
-	{0xc5c5, 2488},
-	{0xc5c6, 2489},
-	{0xc5c7, 2490},
-	{0xc5c8, 2491},
-	{0xc5c9, 2492},
-	{0xc5ca, 2493},
-	{0xc5cc, 2494},
-	{0xc5ce, 2495},
-	{0xc5d0, 2496},
-	{0xc5d1, 2497},
-	{0xc5d3, 0},
-	{0xc5d4, 2498},
-	{0xc5d6, 0},
-	{0xc5d7, 1},
-	{0xc5d8, 2499},
-	{0xc5da, 0},
-	{0xc5db, 1},
-	{0xc5dc, 2},
-	{0xc5dd, 3},
-	{0xc5de, 4},
-	{0xc5df, 5},
-	{0xc5e0, 2500},
-	{0xc5e1, 2501},
-	{0xc5e3, 2502},
-	{0xc5e5, 2503},
-	{0xc5e7, 0},
-	{0xc5e8, 1},
-	{0xc5e9, 2},
-	{0xc5ea, 3},
-	{0xc5eb, 4},
-	{0xc5ec, 2504},
-	{0xc5ed, 2505},
-	{0xc5ee, 2506},
-	{0xc5f0, 2507},
-	{0xc5f2, 0},
-	{0xc5f3, 1},
-	{0xc5f4, 2508},
-	{0xc5f6, 2509},
-	{0xc5f7, 2510},
-	{0xc5f9, 0},
-	{0xc5fa, 1},
-	{0xc5fb, 2},
-	{0xc5fc, 2511},
-	{0xc5fd, 2512},
-	{0xc5fe, 2513},
-	{0xc5ff, 2514},
-	{0xc600, 2515},
-	{0xc601, 2516},
-	{0xc603, 0},
-	{0xc604, 1},
-	{0xc605, 2517},
-	{0xc606, 2518},
-	{0xc607, 2519},
-	{0xc608, 2520},
-	{0xc60a, 0},
-	{0xc60b, 1},
-	{0xc60c, 2521},
-	{0xc60e, 0},
-	{0xc60f, 1},
-	{0xc610, 2522},
-	{0xc612, 0},
-	{0xc613, 1},
-	{0xc614, 2},
-	{0xc615, 3},
-	{0xc616, 4},
-	{0xc617, 5},
-	{0xc618, 2523},
-	{0xc619, 2524},
-	{0xc61b, 2525},
-	{0xc61c, 2526},
-	{0xc61e, 0},
-	{0xc61f, 1},
-	{0xc620, 2},
-	{0xc621, 3},
-	{0xc622, 4},
-	{0xc623, 5},
-	{0xc624, 2527},
-	{0xc625, 2528},
-	{0xc627, 0},
-	{0xc628, 2529},
-	{0xc62a, 0},
-	{0xc62b, 1},
-	{0xc62c, 2530},
-	{0xc62d, 2531},
-	{0xc62e, 2532},
-	{0xc630, 2533},
-	{0xc632, 0},
-	{0xc633, 2534},
-	{0xc634, 2535},
-	{0xc635, 2536},
-	{0xc637, 2537},
-	{0xc639, 2538},
-	{0xc63b, 2539},
-	{0xc63d, 0},
-	{0xc63e, 1},
-	{0xc63f, 2},
-	{0xc640, 2540},
-	{0xc641, 2541},
-	{0xc643, 0},
-	{0xc644, 2542},
-	{0xc646, 0},
-	{0xc647, 1},
-	{0xc648, 2543},
-	{0xc64a, 0},
-	{0xc64b, 1},
-	{0xc64c, 2},
-	{0xc64d, 3},
-	{0xc64e, 4},
-	{0xc64f, 5},
-	{0xc650, 2544},
-	{0xc651, 2545},
-	{0xc653, 2546},
-	{0xc654, 2547},
-	{0xc655, 2548},
-	{0xc657, 0},
-	{0xc658, 1},
-	{0xc659, 2},
-	{0xc65a, 3},
-	{0xc65b, 4},
-	{0xc65c, 2549},
-	{0xc65d, 2550},
-	{0xc65f, 0},
-	{0xc660, 2551},
-	{0xc662, 0},
-	{0xc663, 1},
-	{0xc664, 2},
-	{0xc665, 3},
-	{0xc666, 4},
-	{0xc667, 5},
-	{0xc668, 6},
-	{0xc669, 7},
-	{0xc66a, 8},
-	{0xc66b, 9},
-	{0xc66c, 2552},
-	{0xc66e, 0},
-	{0xc66f, 2553},
-	{0xc671, 2554},
-	{0xc673, 0},
-	{0xc674, 1},
-	{0xc675, 2},
-	{0xc676, 3},
-	{0xc677, 4},
-	{0xc678, 2555},
-	{0xc679, 2556},
-	{0xc67b, 0},
-	{0xc67c, 2557},
-	{0xc67e, 0},
-	{0xc67f, 1},
-	{0xc680, 2558},
-	{0xc682, 0},
-	{0xc683, 1},
-	{0xc684, 2},
-	{0xc685, 3},
-	{0xc686, 4},
-	{0xc687, 5},
-	{0xc688, 2559},
-	{0xc689, 2560},
-	{0xc68b, 2561},
-	{0xc68d, 2562},
-	{0xc68f, 0},
-	{0xc690, 1},
-	{0xc691, 2},
-	{0xc692, 3},
-	{0xc693, 4},
-	{0xc694, 2563},
-	{0xc695, 2564},
-	{0xc697, 0},
-	{0xc698, 2565},
-	{0xc69a, 0},
-	{0xc69b, 1},
-	{0xc69c, 2566},
-	{0xc69e, 0},
-	{0xc69f, 1},
-	{0xc6a0, 2},
-	{0xc6a1, 3},
-	{0xc6a2, 4},
-	{0xc6a3, 5},
-	{0xc6a4, 2567},
-	{0xc6a5, 2568},
-	{0xc6a7, 2569},
-	{0xc6a9, 2570},
-	{0xc6ab, 0},
-	{0xc6ac, 1},
-	{0xc6ad, 2},
-	{0xc6ae, 3},
-	{0xc6af, 4},
-	{0xc6b0, 2571},
-	{0xc6b1, 2572},
-	{0xc6b3, 0},
-	{0xc6b4, 2573},
-	{0xc6b6, 0},
-	{0xc6b7, 1},
-	{0xc6b8, 2574},
-	{0xc6b9, 2575},
-	{0xc6ba, 2576},
-	{0xc6bc, 0},
-	{0xc6bd, 1},
-	{0xc6be, 2},
-	{0xc6bf, 3},
-	{0xc6c0, 2577},
-	{0xc6c1, 2578},
-	{0xc6c3, 2579},
-	{0xc6c5, 2580},
-	{0xc6c7, 0},
-	{0xc6c8, 1},
-	{0xc6c9, 2},
-	{0xc6ca, 3},
-	{0xc6cb, 4},
-	{0xc6cc, 2581},
-	{0xc6cd, 2582},
-	{0xc6cf, 0},
-	{0xc6d0, 2583},
-	{0xc6d2, 0},
-	{0xc6d3, 1},
-	{0xc6d4, 2584},
-	{0xc6d6, 0},
-	{0xc6d7, 1},
-	{0xc6d8, 2},
-	{0xc6d9, 3},
-	{0xc6da, 4},
-	{0xc6db, 5},
-	{0xc6dc, 2585},
-	{0xc6dd, 2586},
-	{0xc6df, 0},
-	{0xc6e0, 2587},
-	{0xc6e1, 2588},
-	{0xc6e3, 0},
-	{0xc6e4, 1},
-	{0xc6e5, 2},
-	{0xc6e6, 3},
-	{0xc6e7, 4},
-	{0xc6e8, 2589},
-	{0xc6e9, 2590},
-	{0xc6eb, 0},
-	{0xc6ec, 2591},
-	{0xc6ee, 0},
-	{0xc6ef, 1},
-	{0xc6f0, 2592},
-	{0xc6f2, 0},
-	{0xc6f3, 1},
-	{0xc6f4, 2},
-	{0xc6f5, 3},
-	{0xc6f6, 4},
-	{0xc6f7, 5},
-	{0xc6f8, 2593},
-	{0xc6f9, 2594},
-	{0xc6fb, 0},
-	{0xc6fc, 1},
-	{0xc6fd, 2595},
-	{0xc6ff, 0},
-	{0xc701, 0},
-	{0xc702, 1},
-	{0xc703, 2},
-	{0xc704, 2596},
-	{0xc705, 2597},
-	{0xc707, 0},
-	{0xc708, 2598},
-	{0xc70a, 0},
-	{0xc70b, 1},
-	{0xc70c, 2599},
-	{0xc70e, 0},
-	{0xc70f, 1},
-	{0xc710, 2},
-	{0xc711, 3},
-	{0xc712, 4},
-	{0xc713, 5},
-	{0xc714, 2600},
-	{0xc715, 2601},
-	{0xc717, 2602},
-	{0xc719, 2603},
-	{0xc71b, 0},
-	{0xc71c, 1},
-	{0xc71d, 2},
-	{0xc71e, 3},
-	{0xc71f, 4},
-	{0xc720, 2604},
-	{0xc721, 2605},
-	{0xc723, 0},
-	{0xc724, 2606},
-	{0xc726, 0},
-	{0xc727, 1},
-	{0xc728, 2607},
-	{0xc72a, 0},
-	{0xc72b, 1},
-	{0xc72c, 2},
-	{0xc72d, 3},
-	{0xc72e, 4},
-	{0xc72f, 5},
-	{0xc730, 2608},
-	{0xc731, 2609},
-	{0xc733, 2610},
-	{0xc735, 2611},
-	{0xc737, 2612},
-	{0xc739, 0},
-	{0xc73a, 1},
-	{0xc73b, 2},
-	{0xc73c, 2613},
-	{0xc73d, 2614},
-	{0xc73f, 0},
-	{0xc740, 2615},
-	{0xc742, 0},
-	{0xc743, 1},
-	{0xc744, 2616},
-	{0xc746, 0},
-	{0xc747, 1},
-	{0xc748, 2},
-	{0xc749, 3},
-	{0xc74a, 2617},
-	{0xc74c, 2618},
-	{0xc74d, 2619},
-	{0xc74f, 2620},
-	{0xc751, 2621},
-	{0xc752, 2622},
-	{0xc753, 2623},
-	{0xc754, 2624},
-	{0xc755, 2625},
-	{0xc756, 2626},
-	{0xc757, 2627},
-	{0xc758, 2628},
-	{0xc75a, 0},
-	{0xc75b, 1},
-	{0xc75c, 2629},
-	{0xc75e, 0},
-	{0xc75f, 1},
-	{0xc760, 2630},
-	{0xc762, 0},
-	{0xc763, 1},
-	{0xc764, 2},
-	{0xc765, 3},
-	{0xc766, 4},
-	{0xc767, 5},
-	{0xc768, 2631},
-	{0xc76a, 0},
-	{0xc76b, 2632},
-	{0xc76d, 0},
-	{0xc76e, 1},
-	{0xc76f, 2},
-	{0xc770, 3},
-	{0xc771, 4},
-	{0xc772, 5},
-	{0xc773, 6},
-	{0xc774, 2633},
-	{0xc775, 2634},
-	{0xc777, 0},
-	{0xc778, 2635},
-	{0xc77a, 0},
-	{0xc77b, 1},
-	{0xc77c, 2636},
-	{0xc77d, 2637},
-	{0xc77e, 2638},
-	{0xc780, 0},
-	{0xc781, 1},
-	{0xc782, 2},
-	{0xc783, 2639},
-	{0xc784, 2640},
-	{0xc785, 2641},
-	{0xc787, 2642},
-	{0xc788, 2643},
-	{0xc789, 2644},
-	{0xc78a, 2645},
-	{0xc78c, 0},
-	{0xc78d, 1},
-	{0xc78e, 2646},
-	{0xc790, 2647},
-	{0xc791, 2648},
-	{0xc793, 0},
-	{0xc794, 2649},
-	{0xc796, 2650},
-	{0xc797, 2651},
-	{0xc798, 2652},
-	{0xc79a, 2653},
-	{0xc79c, 0},
-	{0xc79d, 1},
-	{0xc79e, 2},
-	{0xc79f, 3},
-	{0xc7a0, 2654},
-	{0xc7a1, 2655},
-	{0xc7a3, 2656},
-	{0xc7a4, 2657},
-	{0xc7a5, 2658},
-	{0xc7a6, 2659},
-	{0xc7a8, 0},
-	{0xc7a9, 1},
-	{0xc7aa, 2},
-	{0xc7ab, 3},
-	{0xc7ac, 2660},
-	{0xc7ad, 2661},
-	{0xc7af, 0},
-	{0xc7b0, 2662},
-	{0xc7b2, 0},
-	{0xc7b3, 1},
-	{0xc7b4, 2663},
-	{0xc7b6, 0},
-	{0xc7b7, 1},
-	{0xc7b8, 2},
-	{0xc7b9, 3},
-	{0xc7ba, 4},
-	{0xc7bb, 5},
-	{0xc7bc, 2664},
-	{0xc7bd, 2665},
-	{0xc7bf, 2666},
-	{0xc7c0, 2667},
-	{0xc7c1, 2668},
-	{0xc7c3, 0},
-	{0xc7c4, 1},
-	{0xc7c5, 2},
-	{0xc7c6, 3},
-	{0xc7c7, 4},
-	{0xc7c8, 2669},
-	{0xc7c9, 2670},
-	{0xc7cb, 0},
-	{0xc7cc, 2671},
-	{0xc7ce, 2672},
-	{0xc7d0, 2673},
-	{0xc7d2, 0},
-	{0xc7d3, 1},
-	{0xc7d4, 2},
-	{0xc7d5, 3},
-	{0xc7d6, 4},
-	{0xc7d7, 5},
-	{0xc7d8, 2674},
-	{0xc7da, 0},
-	{0xc7db, 1},
-	{0xc7dc, 2},
-	{0xc7dd, 2675},
-	{0xc7df, 0},
-	{0xc7e0, 1},
-	{0xc7e1, 2},
-	{0xc7e2, 3},
-	{0xc7e3, 4},
-	{0xc7e4, 2676},
-	{0xc7e6, 0},
-	{0xc7e7, 1},
-	{0xc7e8, 2677},
-	{0xc7ea, 0},
-	{0xc7eb, 1},
-	{0xc7ec, 2678},
-	{0xc7ee, 0},
-	{0xc7ef, 1},
-	{0xc7f0, 2},
-	{0xc7f1, 3},
-	{0xc7f2, 4},
-	{0xc7f3, 5},
-	{0xc7f4, 6},
-	{0xc7f5, 7},
-	{0xc7f6, 8},
-	{0xc7f7, 9},
-	{0xc7f8, 10},
-	{0xc7f9, 11},
-	{0xc7fa, 12},
-	{0xc7fb, 13},
-	{0xc7fc, 14},
-	{0xc7fd, 15},
-	{0xc7fe, 16},
-	{0xc7ff, 17},
-	{0xc800, 2679},
-	{0xc801, 2680},
-	{0xc803, 0},
-	{0xc804, 2681},
-	{0xc806, 0},
-	{0xc807, 1},
-	{0xc808, 2682},
-	{0xc80a, 2683},
-	{0xc80c, 0},
-	{0xc80d, 1},
-	{0xc80e, 2},
-	{0xc80f, 3},
-	{0xc810, 2684},
-	{0xc811, 2685},
-	{0xc813, 2686},
-	{0xc815, 2687},
-	{0xc816, 2688},
-	{0xc818, 0},
-	{0xc819, 1},
-	{0xc81a, 2},
-	{0xc81b, 3},
-	{0xc81c, 2689},
-	{0xc81d, 2690},
-	{0xc81f, 0},
-	{0xc820, 2691},
-	{0xc822, 0},
-	{0xc823, 1},
-	{0xc824, 2692},
-	{0xc826, 0},
-	{0xc827, 1},
-	{0xc828, 2},
-	{0xc829, 3},
-	{0xc82a, 4},
-	{0xc82b, 5},
-	{0xc82c, 2693},
-	{0xc82d, 2694},
-	{0xc82f, 2695},
-	{0xc831, 2696},
-	{0xc833, 0},
-	{0xc834, 1},
-	{0xc835, 2},
-	{0xc836, 3},
-	{0xc837, 4},
-	{0xc838, 2697},
-	{0xc83a, 0},
-	{0xc83b, 1},
-	{0xc83c, 2698},
-	{0xc83e, 0},
-	{0xc83f, 1},
-	{0xc840, 2699},
-	{0xc842, 0},
-	{0xc843, 1},
-	{0xc844, 2},
-	{0xc845, 3},
-	{0xc846, 4},
-	{0xc847, 5},
-	{0xc848, 2700},
-	{0xc849, 2701},
-	{0xc84b, 0},
-	{0xc84c, 2702},
-	{0xc84d, 2703},
-	{0xc84f, 0},
-	{0xc850, 1},
-	{0xc851, 2},
-	{0xc852, 3},
-	{0xc853, 4},
-	{0xc854, 2704},
-	{0xc856, 0},
-	{0xc857, 1},
-	{0xc858, 2},
-	{0xc859, 3},
-	{0xc85a, 4},
-	{0xc85b, 5},
-	{0xc85c, 6},
-	{0xc85d, 7},
-	{0xc85e, 8},
-	{0xc85f, 9},
-	{0xc860, 10},
-	{0xc861, 11},
-	{0xc862, 12},
-	{0xc863, 13},
-	{0xc864, 14},
-	{0xc865, 15},
-	{0xc866, 16},
-	{0xc867, 17},
-	{0xc868, 18},
-	{0xc869, 19},
-	{0xc86a, 20},
-	{0xc86b, 21},
-	{0xc86c, 22},
-	{0xc86d, 23},
-	{0xc86e, 24},
-	{0xc86f, 25},
-	{0xc870, 2705},
-	{0xc871, 2706},
-	{0xc873, 0},
-	{0xc874, 2707},
-	{0xc876, 0},
-	{0xc877, 1},
-	{0xc878, 2708},
-	{0xc87a, 2709},
-	{0xc87c, 0},
-	{0xc87d, 1},
-	{0xc87e, 2},
-	{0xc87f, 3},
-	{0xc880, 2710},
-	{0xc881, 2711},
-	{0xc883, 2712},
-	{0xc885, 2713},
-	{0xc886, 2714},
-	{0xc887, 2715},
-	{0xc889, 0},
-	{0xc88a, 1},
-	{0xc88b, 2716},
-	{0xc88c, 2717},
-	{0xc88d, 2718},
-	{0xc88f, 0},
-	{0xc890, 1},
-	{0xc891, 2},
-	{0xc892, 3},
-	{0xc893, 4},
-	{0xc894, 2719},
-	{0xc896, 0},
-	{0xc897, 1},
-	{0xc898, 2},
-	{0xc899, 3},
-	{0xc89a, 4},
-	{0xc89b, 5},
-	{0xc89c, 6},
-	{0xc89d, 2720},
-	{0xc89f, 2721},
-	{0xc8a1, 2722},
-	{0xc8a3, 0},
-	{0xc8a4, 1},
-	{0xc8a5, 2},
-	{0xc8a6, 3},
-	{0xc8a7, 4},
-	{0xc8a8, 2723},
-	{0xc8aa, 0},
-	{0xc8ab, 1},
-	{0xc8ac, 2},
-	{0xc8ad, 3},
-	{0xc8ae, 4},
-	{0xc8af, 5},
-	{0xc8b0, 6},
-	{0xc8b1, 7},
-	{0xc8b2, 8},
-	{0xc8b3, 9},
-	{0xc8b4, 10},
-	{0xc8b5, 11},
-	{0xc8b6, 12},
-	{0xc8b7, 13},
-	{0xc8b8, 14},
-	{0xc8b9, 15},
-	{0xc8ba, 16},
-	{0xc8bb, 17},
-	{0xc8bc, 2724},
-	{0xc8bd, 2725},
-	{0xc8bf, 0},
-	{0xc8c0, 1},
-	{0xc8c1, 2},
-	{0xc8c2, 3},
-	{0xc8c3, 4},
-	{0xc8c4, 2726},
-	{0xc8c6, 0},
-	{0xc8c7, 1},
-	{0xc8c8, 2727},
-	{0xc8ca, 0},
-	{0xc8cb, 1},
-	{0xc8cc, 2728},
-	{0xc8ce, 0},
-	{0xc8cf, 1},
-	{0xc8d0, 2},
-	{0xc8d1, 3},
-	{0xc8d2, 4},
-	{0xc8d3, 5},
-	{0xc8d4, 2729},
-	{0xc8d5, 2730},
-	{0xc8d7, 2731},
-	{0xc8d9, 2732},
-	{0xc8db, 0},
-	{0xc8dc, 1},
-	{0xc8dd, 2},
-	{0xc8de, 3},
-	{0xc8df, 4},
-	{0xc8e0, 2733},
-	{0xc8e1, 2734},
-	{0xc8e3, 0},
-	{0xc8e4, 2735},
-	{0xc8e6, 0},
-	{0xc8e7, 1},
-	{0xc8e8, 2},
-	{0xc8e9, 3},
-	{0xc8ea, 4},
-	{0xc8eb, 5},
-	{0xc8ec, 6},
-	{0xc8ed, 7},
-	{0xc8ee, 8},
-	{0xc8ef, 9},
-	{0xc8f0, 10},
-	{0xc8f1, 11},
-	{0xc8f2, 12},
-	{0xc8f3, 13},
-	{0xc8f4, 14},
-	{0xc8f5, 2736},
-	{0xc8f7, 0},
-	{0xc8f8, 1},
-	{0xc8f9, 2},
-	{0xc8fa, 3},
-	{0xc8fb, 4},
-	{0xc8fc, 2737},
-	{0xc8fd, 2738},
-	{0xc8ff, 0},
-	{0xc900, 2739},
-	{0xc902, 0},
-	{0xc903, 1},
-	{0xc904, 2740},
-	{0xc905, 2741},
-	{0xc906, 2742},
-	{0xc908, 0},
-	{0xc909, 1},
-	{0xc90a, 2},
-	{0xc90b, 3},
-	{0xc90c, 2743},
-	{0xc90d, 2744},
-	{0xc90f, 2745},
-	{0xc911, 2746},
-	{0xc913, 0},
-	{0xc914, 1},
-	{0xc915, 2},
-	{0xc916, 3},
-	{0xc917, 4},
-	{0xc918, 2747},
-	{0xc91a, 0},
-	{0xc91b, 1},
-	{0xc91c, 2},
-	{0xc91d, 3},
-	{0xc91e, 4},
-	{0xc91f, 5},
-	{0xc920, 6},
-	{0xc921, 7},
-	{0xc922, 8},
-	{0xc923, 9},
-	{0xc924, 10},
-	{0xc925, 11},
-	{0xc926, 12},
-	{0xc927, 13},
-	{0xc928, 14},
-	{0xc929, 15},
-	{0xc92a, 16},
-	{0xc92b, 17},
-	{0xc92c, 2748},
-	{0xc92e, 0},
-	{0xc92f, 1},
-	{0xc930, 2},
-	{0xc931, 3},
-	{0xc932, 4},
-	{0xc933, 5},
-	{0xc934, 2749},
-	{0xc936, 0},
-	{0xc937, 1},
-	{0xc938, 2},
-	{0xc939, 3},
-	{0xc93a, 4},
-	{0xc93b, 5},
-	{0xc93c, 6},
-	{0xc93d, 7},
-	{0xc93e, 8},
-	{0xc93f, 9},
-	{0xc940, 10},
-	{0xc941, 11},
-	{0xc942, 12},
-	{0xc943, 13},
-	{0xc944, 14},
-	{0xc945, 15},
-	{0xc946, 16},
-	{0xc947, 17},
-	{0xc948, 18},
-	{0xc949, 19},
-	{0xc94a, 20},
-	{0xc94b, 21},
-	{0xc94c, 22},
-	{0xc94d, 23},
-	{0xc94e, 24},
-	{0xc94f, 25},
-	{0xc950, 2750},
-	{0xc951, 2751},
-	{0xc953, 0},
-	{0xc954, 2752},
-	{0xc956, 0},
-	{0xc957, 1},
-	{0xc958, 2753},
-	{0xc95a, 0},
-	{0xc95b, 1},
-	{0xc95c, 2},
-	{0xc95d, 3},
-	{0xc95e, 4},
-	{0xc95f, 5},
-	{0xc960, 2754},
-	{0xc961, 2755},
-	{0xc963, 2756},
-	{0xc965, 0},
-	{0xc966, 1},
-	{0xc967, 2},
-	{0xc968, 3},
-	{0xc969, 4},
-	{0xc96a, 5},
-	{0xc96b, 6},
-	{0xc96c, 2757},
-	{0xc96e, 0},
-	{0xc96f, 1},
-	{0xc970, 2758},
-	{0xc972, 0},
-	{0xc973, 1},
-	{0xc974, 2759},
-	{0xc976, 0},
-	{0xc977, 1},
-	{0xc978, 2},
-	{0xc979, 3},
-	{0xc97a, 4},
-	{0xc97b, 5},
-	{0xc97c, 2760},
-	{0xc97e, 0},
-	{0xc97f, 1},
-	{0xc980, 2},
-	{0xc981, 3},
-	{0xc982, 4},
-	{0xc983, 5},
-	{0xc984, 6},
-	{0xc985, 7},
-	{0xc986, 8},
-	{0xc987, 9},
-	{0xc988, 2761},
-	{0xc989, 2762},
-	{0xc98b, 0},
-	{0xc98c, 2763},
-	{0xc98e, 0},
-	{0xc98f, 1},
-	{0xc990, 2764},
-	{0xc992, 0},
-	{0xc993, 1},
-	{0xc994, 2},
-	{0xc995, 3},
-	{0xc996, 4},
-	{0xc997, 5},
-	{0xc998, 2765},
-	{0xc999, 2766},
-	{0xc99b, 2767},
-	{0xc99d, 2768},
-	{0xc99f, 0},
-	{0xc9a0, 1},
-	{0xc9a1, 2},
-	{0xc9a2, 3},
-	{0xc9a3, 4},
-	{0xc9a4, 5},
-	{0xc9a5, 6},
-	{0xc9a6, 7},
-	{0xc9a7, 8},
-	{0xc9a8, 9},
-	{0xc9a9, 10},
-	{0xc9aa, 11},
-	{0xc9ab, 12},
-	{0xc9ac, 13},
-	{0xc9ad, 14},
-	{0xc9ae, 15},
-	{0xc9af, 16},
-	{0xc9b0, 17},
-	{0xc9b1, 18},
-	{0xc9b2, 19},
-	{0xc9b3, 20},
-	{0xc9b4, 21},
-	{0xc9b5, 22},
-	{0xc9b6, 23},
-	{0xc9b7, 24},
-	{0xc9b8, 25},
-	{0xc9b9, 26},
-	{0xc9ba, 27},
-	{0xc9bb, 28},
-	{0xc9bc, 29},
-	{0xc9bd, 30},
-	{0xc9be, 31},
-	{0xc9bf, 32},
-	{0xc9c0, 2769},
-	{0xc9c1, 2770},
-	{0xc9c3, 0},
-	{0xc9c4, 2771},
-	{0xc9c6, 0},
-	{0xc9c7, 2772},
-	{0xc9c8, 2773},
-	{0xc9ca, 2774},
-	{0xc9cc, 0},
-	{0xc9cd, 1},
-	{0xc9ce, 2},
-	{0xc9cf, 3},
-	{0xc9d0, 2775},
-	{0xc9d1, 2776},
-	{0xc9d3, 2777},
-	{0xc9d5, 2778},
-	{0xc9d6, 2779},
-	{0xc9d8, 0},
-	{0xc9d9, 2780},
-	{0xc9da, 2781},
-	{0xc9dc, 2782},
-	{0xc9dd, 2783},
-	{0xc9df, 0},
-	{0xc9e0, 2784},
-	{0xc9e2, 2785},
-	{0xc9e4, 2786},
-	{0xc9e6, 0},
-	{0xc9e7, 2787},
-	{0xc9e9, 0},
-	{0xc9ea, 1},
-	{0xc9eb, 2},
-	{0xc9ec, 2788},
-	{0xc9ed, 2789},
-	{0xc9ef, 2790},
-	{0xc9f0, 2791},
-	{0xc9f1, 2792},
-	{0xc9f3, 0},
-	{0xc9f4, 1},
-	{0xc9f5, 2},
-	{0xc9f6, 3},
-	{0xc9f7, 4},
-	{0xc9f8, 2793},
-	{0xc9f9, 2794},
-	{0xc9fb, 0},
-	{0xc9fc, 2795},
-	{0xc9fe, 0},
-	{0xc9ff, 1},
-	{0xca00, 2796},
-	{0xca02, 0},
-	{0xca03, 1},
-	{0xca04, 2},
-	{0xca05, 3},
-	{0xca06, 4},
-	{0xca07, 5},
-	{0xca08, 2797},
-	{0xca09, 2798},
-	{0xca0b, 2799},
-	{0xca0c, 2800},
-	{0xca0d, 2801},
-	{0xca0f, 0},
-	{0xca10, 1},
-	{0xca11, 2},
-	{0xca12, 3},
-	{0xca13, 4},
-	{0xca14, 2802},
-	{0xca16, 0},
-	{0xca17, 1},
-	{0xca18, 2803},
-	{0xca1a, 0},
-	{0xca1b, 1},
-	{0xca1c, 2},
-	{0xca1d, 3},
-	{0xca1e, 4},
-	{0xca1f, 5},
-	{0xca20, 6},
-	{0xca21, 7},
-	{0xca22, 8},
-	{0xca23, 9},
-	{0xca24, 10},
-	{0xca25, 11},
-	{0xca26, 12},
-	{0xca27, 13},
-	{0xca28, 14},
-	{0xca29, 2804},
-	{0xca2b, 0},
-	{0xca2c, 1},
-	{0xca2d, 2},
-	{0xca2e, 3},
-	{0xca2f, 4},
-	{0xca30, 5},
-	{0xca31, 6},
-	{0xca32, 7},
-	{0xca33, 8},
-	{0xca34, 9},
-	{0xca35, 10},
-	{0xca36, 11},
-	{0xca37, 12},
-	{0xca38, 13},
-	{0xca39, 14},
-	{0xca3a, 15},
-	{0xca3b, 16},
-	{0xca3c, 17},
-	{0xca3d, 18},
-	{0xca3e, 19},
-	{0xca3f, 20},
-	{0xca40, 21},
-	{0xca41, 22},
-	{0xca42, 23},
-	{0xca43, 24},
-	{0xca44, 25},
-	{0xca45, 26},
-	{0xca46, 27},
-	{0xca47, 28},
-	{0xca48, 29},
-	{0xca49, 30},
-	{0xca4a, 31},
-	{0xca4b, 32},
-	{0xca4c, 2805},
-	{0xca4d, 2806},
-	{0xca4f, 0},
-	{0xca50, 2807},
-	{0xca52, 0},
-	{0xca53, 1},
-	{0xca54, 2808},
-	{0xca56, 0},
-	{0xca57, 1},
-	{0xca58, 2},
-	{0xca59, 3},
-	{0xca5a, 4},
-	{0xca5b, 5},
-	{0xca5c, 2809},
-	{0xca5d, 2810},
-	{0xca5f, 2811},
-	{0xca60, 2812},
-	{0xca61, 2813},
-	{0xca63, 0},
-	{0xca64, 1},
-	{0xca65, 2},
-	{0xca66, 3},
-	{0xca67, 4},
-	{0xca68, 2814},
-	{0xca6a, 0},
-	{0xca6b, 1},
-	{0xca6c, 2},
-	{0xca6d, 3},
-	{0xca6e, 4},
-	{0xca6f, 5},
-	{0xca70, 6},
-	{0xca71, 7},
-	{0xca72, 8},
-	{0xca73, 9},
-	{0xca74, 10},
-	{0xca75, 11},
-	{0xca76, 12},
-	{0xca77, 13},
-	{0xca78, 14},
-	{0xca79, 15},
-	{0xca7a, 16},
-	{0xca7b, 17},
-	{0xca7c, 18},
-	{0xca7d, 2815},
-	{0xca7f, 0},
-	{0xca80, 1},
-	{0xca81, 2},
-	{0xca82, 3},
-	{0xca83, 4},
-	{0xca84, 2816},
-	{0xca86, 0},
-	{0xca87, 1},
-	{0xca88, 2},
-	{0xca89, 3},
-	{0xca8a, 4},
-	{0xca8b, 5},
-	{0xca8c, 6},
-	{0xca8d, 7},
-	{0xca8e, 8},
-	{0xca8f, 9},
-	{0xca90, 10},
-	{0xca91, 11},
-	{0xca92, 12},
-	{0xca93, 13},
-	{0xca94, 14},
-	{0xca95, 15},
-	{0xca96, 16},
-	{0xca97, 17},
-	{0xca98, 2817},
-	{0xca9a, 0},
-	{0xca9b, 1},
-	{0xca9c, 2},
-	{0xca9d, 3},
-	{0xca9e, 4},
-	{0xca9f, 5},
-	{0xcaa0, 6},
-	{0xcaa1, 7},
-	{0xcaa2, 8},
-	{0xcaa3, 9},
-	{0xcaa4, 10},
-	{0xcaa5, 11},
-	{0xcaa6, 12},
-	{0xcaa7, 13},
-	{0xcaa8, 14},
-	{0xcaa9, 15},
-	{0xcaaa, 16},
-	{0xcaab, 17},
-	{0xcaac, 18},
-	{0xcaad, 19},
-	{0xcaae, 20},
-	{0xcaaf, 21},
-	{0xcab0, 22},
-	{0xcab1, 23},
-	{0xcab2, 24},
-	{0xcab3, 25},
-	{0xcab4, 26},
-	{0xcab5, 27},
-	{0xcab6, 28},
-	{0xcab7, 29},
-	{0xcab8, 30},
-	{0xcab9, 31},
-	{0xcaba, 32},
-	{0xcabb, 33},
-	{0xcabc, 2818},
-	{0xcabd, 2819},
-	{0xcabf, 0},
-	{0xcac0, 2820},
-	{0xcac2, 0},
-	{0xcac3, 1},
-	{0xcac4, 2821},
-	{0xcac6, 0},
-	{0xcac7, 1},
-	{0xcac8, 2},
-	{0xcac9, 3},
-	{0xcaca, 4},
-	{0xcacb, 5},
-	{0xcacc, 2822},
-	{0xcacd, 2823},
-	{0xcacf, 2824},
-	{0xcad1, 2825},
-	{0xcad3, 2826},
-	{0xcad5, 0},
-	{0xcad6, 1},
-	{0xcad7, 2},
-	{0xcad8, 2827},
-	{0xcad9, 2828},
-	{0xcadb, 0},
-	{0xcadc, 1},
-	{0xcadd, 2},
-	{0xcade, 3},
-	{0xcadf, 4},
-	{0xcae0, 2829},
-	{0xcae2, 0},
-	{0xcae3, 1},
-	{0xcae4, 2},
-	{0xcae5, 3},
-	{0xcae6, 4},
-	{0xcae7, 5},
-	{0xcae8, 6},
-	{0xcae9, 7},
-	{0xcaea, 8},
-	{0xcaeb, 9},
-	{0xcaec, 2830},
-	{0xcaee, 0},
-	{0xcaef, 1},
-	{0xcaf0, 2},
-	{0xcaf1, 3},
-	{0xcaf2, 4},
-	{0xcaf3, 5},
-	{0xcaf4, 2831},
-	{0xcaf6, 0},
-	{0xcaf7, 1},
-	{0xcaf8, 2},
-	{0xcaf9, 3},
-	{0xcafa, 4},
-	{0xcafb, 5},
-	{0xcafc, 6},
-	{0xcafd, 7},
-	{0xcafe, 8},
-	{0xcaff, 9},
-	{0xcb01, 0},
-	{0xcb02, 1},
-	{0xcb03, 2},
-	{0xcb04, 3},
-	{0xcb05, 4},
-	{0xcb06, 5},
-	{0xcb07, 6},
-	{0xcb08, 2832},
-	{0xcb0a, 0},
-	{0xcb0b, 1},
-	{0xcb0c, 2},
-	{0xcb0d, 3},
-	{0xcb0e, 4},
-	{0xcb0f, 5},
-	{0xcb10, 2833},
-	{0xcb12, 0},
-	{0xcb13, 1},
-	{0xcb14, 2834},
-	{0xcb16, 0},
-	{0xcb17, 1},
-	{0xcb18, 2835},
-	{0xcb1a, 0},
-	{0xcb1b, 1},
-	{0xcb1c, 2},
-	{0xcb1d, 3},
-	{0xcb1e, 4},
-	{0xcb1f, 5},
-	{0xcb20, 2836},
-	{0xcb21, 2837},
-	{0xcb23, 0},
-	{0xcb24, 1},
-	{0xcb25, 2},
-	{0xcb26, 3},
-	{0xcb27, 4},
-	{0xcb28, 5},
-	{0xcb29, 6},
-	{0xcb2a, 7},
-	{0xcb2b, 8},
-	{0xcb2c, 9},
-	{0xcb2d, 10},
-	{0xcb2e, 11},
-	{0xcb2f, 12},
-	{0xcb30, 13},
-	{0xcb31, 14},
-	{0xcb32, 15},
-	{0xcb33, 16},
-	{0xcb34, 17},
-	{0xcb35, 18},
-	{0xcb36, 19},
-	{0xcb37, 20},
-	{0xcb38, 21},
-	{0xcb39, 22},
-	{0xcb3a, 23},
-	{0xcb3b, 24},
-	{0xcb3c, 25},
-	{0xcb3d, 26},
-	{0xcb3e, 27},
-	{0xcb3f, 28},
-	{0xcb40, 29},
-	{0xcb41, 2838},
-	{0xcb43, 0},
-	{0xcb44, 1},
-	{0xcb45, 2},
-	{0xcb46, 3},
-	{0xcb47, 4},
-	{0xcb48, 2839},
-	{0xcb49, 2840},
-	{0xcb4b, 0},
-	{0xcb4c, 2841},
-	{0xcb4e, 0},
-	{0xcb4f, 1},
-	{0xcb50, 2842},
-	{0xcb52, 0},
-	{0xcb53, 1},
-	{0xcb54, 2},
-	{0xcb55, 3},
-	{0xcb56, 4},
-	{0xcb57, 5},
-	{0xcb58, 2843},
-	{0xcb59, 2844},
-	{0xcb5b, 0},
-	{0xcb5c, 1},
-	{0xcb5d, 2845},
-	{0xcb5f, 0},
-	{0xcb60, 1},
-	{0xcb61, 2},
-	{0xcb62, 3},
-	{0xcb63, 4},
-	{0xcb64, 2846},
-	{0xcb66, 0},
-	{0xcb67, 1},
-	{0xcb68, 2},
-	{0xcb69, 3},
-	{0xcb6a, 4},
-	{0xcb6b, 5},
-	{0xcb6c, 6},
-	{0xcb6d, 7},
-	{0xcb6e, 8},
-	{0xcb6f, 9},
-	{0xcb70, 10},
-	{0xcb71, 11},
-	{0xcb72, 12},
-	{0xcb73, 13},
-	{0xcb74, 14},
-	{0xcb75, 15},
-	{0xcb76, 16},
-	{0xcb77, 17},
-	{0xcb78, 2847},
-	{0xcb79, 2848},
-	{0xcb7b, 0},
-	{0xcb7c, 1},
-	{0xcb7d, 2},
-	{0xcb7e, 3},
-	{0xcb7f, 4},
-	{0xcb80, 5},
-	{0xcb81, 6},
-	{0xcb82, 7},
-	{0xcb83, 8},
-	{0xcb84, 9},
-	{0xcb85, 10},
-	{0xcb86, 11},
-	{0xcb87, 12},
-	{0xcb88, 13},
-	{0xcb89, 14},
-	{0xcb8a, 15},
-	{0xcb8b, 16},
-	{0xcb8c, 17},
-	{0xcb8d, 18},
-	{0xcb8e, 19},
-	{0xcb8f, 20},
-	{0xcb90, 21},
-	{0xcb91, 22},
-	{0xcb92, 23},
-	{0xcb93, 24},
-	{0xcb94, 25},
-	{0xcb95, 26},
-	{0xcb96, 27},
-	{0xcb97, 28},
-	{0xcb98, 29},
-	{0xcb99, 30},
-	{0xcb9a, 31},
-	{0xcb9b, 32},
-	{0xcb9c, 2849},
-	{0xcb9e, 0},
-	{0xcb9f, 1},
-	{0xcba0, 2},
-	{0xcba1, 3},
-	{0xcba2, 4},
-	{0xcba3, 5},
-	{0xcba4, 6},
-	{0xcba5, 7},
-	{0xcba6, 8},
-	{0xcba7, 9},
-	{0xcba8, 10},
-	{0xcba9, 11},
-	{0xcbaa, 12},
-	{0xcbab, 13},
-	{0xcbac, 14},
-	{0xcbad, 15},
-	{0xcbae, 16},
-	{0xcbaf, 17},
-	{0xcbb0, 18},
-	{0xcbb1, 19},
-	{0xcbb2, 20},
-	{0xcbb3, 21},
-	{0xcbb4, 22},
-	{0xcbb5, 23},
-	{0xcbb6, 24},
-	{0xcbb7, 25},
-	{0xcbb8, 2850},
-	{0xcbba, 0},
-	{0xcbbb, 1},
-	{0xcbbc, 2},
-	{0xcbbd, 3},
-	{0xcbbe, 4},
-	{0xcbbf, 5},
-	{0xcbc0, 6},
-	{0xcbc1, 7},
-	{0xcbc2, 8},
-	{0xcbc3, 9},
-	{0xcbc4, 10},
-	{0xcbc5, 11},
-	{0xcbc6, 12},
-	{0xcbc7, 13},
-	{0xcbc8, 14},
-	{0xcbc9, 15},
-	{0xcbca, 16},
-	{0xcbcb, 17},
-	{0xcbcc, 18},
-	{0xcbcd, 19},
-	{0xcbce, 20},
-	{0xcbcf, 21},
-	{0xcbd0, 22},
-	{0xcbd1, 23},
-	{0xcbd2, 24},
-	{0xcbd3, 25},
-	{0xcbd4, 2851},
-	{0xcbd6, 0},
-	{0xcbd7, 1},
-	{0xcbd8, 2},
-	{0xcbd9, 3},
-	{0xcbda, 4},
-	{0xcbdb, 5},
-	{0xcbdc, 6},
-	{0xcbdd, 7},
-	{0xcbde, 8},
-	{0xcbdf, 9},
-	{0xcbe0, 10},
-	{0xcbe1, 11},
-	{0xcbe2, 12},
-	{0xcbe3, 13},
-	{0xcbe4, 2852},
-	{0xcbe6, 0},
-	{0xcbe7, 2853},
-	{0xcbe9, 2854},
-	{0xcbeb, 0},
-	{0xcbec, 1},
-	{0xcbed, 2},
-	{0xcbee, 3},
-	{0xcbef, 4},
-	{0xcbf0, 5},
-	{0xcbf1, 6},
-	{0xcbf2, 7},
-	{0xcbf3, 8},
-	{0xcbf4, 9},
-	{0xcbf5, 10},
-	{0xcbf6, 11},
-	{0xcbf7, 12},
-	{0xcbf8, 13},
-	{0xcbf9, 14},
-	{0xcbfa, 15},
-	{0xcbfb, 16},
-	{0xcbfc, 17},
-	{0xcbfd, 18},
-	{0xcbfe, 19},
-	{0xcbff, 20},
-	{0xcc01, 0},
-	{0xcc02, 1},
-	{0xcc03, 2},
-	{0xcc04, 3},
-	{0xcc05, 4},
-	{0xcc06, 5},
-	{0xcc07, 6},
-	{0xcc08, 7},
-	{0xcc09, 8},
-	{0xcc0a, 9},
-	{0xcc0b, 10},
-	{0xcc0c, 2855},
-	{0xcc0d, 2856},
-	{0xcc0f, 0},
-	{0xcc10, 2857},
-	{0xcc12, 0},
-	{0xcc13, 1},
-	{0xcc14, 2858},
-	{0xcc16, 0},
-	{0xcc17, 1},
-	{0xcc18, 2},
-	{0xcc19, 3},
-	{0xcc1a, 4},
-	{0xcc1b, 5},
-	{0xcc1c, 2859},
-	{0xcc1d, 2860},
-	{0xcc1f, 0},
-	{0xcc20, 1},
-	{0xcc21, 2861},
-	{0xcc22, 2862},
-	{0xcc24, 0},
-	{0xcc25, 1},
-	{0xcc26, 2},
-	{0xcc27, 2863},
-	{0xcc28, 2864},
-	{0xcc29, 2865},
-	{0xcc2b, 0},
-	{0xcc2c, 2866},
-	{0xcc2e, 2867},
-	{0xcc30, 2868},
-	{0xcc32, 0},
-	{0xcc33, 1},
-	{0xcc34, 2},
-	{0xcc35, 3},
-	{0xcc36, 4},
-	{0xcc37, 5},
-	{0xcc38, 2869},
-	{0xcc39, 2870},
-	{0xcc3b, 2871},
-	{0xcc3c, 2872},
-	{0xcc3d, 2873},
-	{0xcc3e, 2874},
-	{0xcc40, 0},
-	{0xcc41, 1},
-	{0xcc42, 2},
-	{0xcc43, 3},
-	{0xcc44, 2875},
-	{0xcc45, 2876},
-	{0xcc47, 0},
-	{0xcc48, 2877},
-	{0xcc4a, 0},
-	{0xcc4b, 1},
-	{0xcc4c, 2878},
-	{0xcc4e, 0},
-	{0xcc4f, 1},
-	{0xcc50, 2},
-	{0xcc51, 3},
-	{0xcc52, 4},
-	{0xcc53, 5},
-	{0xcc54, 2879},
-	{0xcc55, 2880},
-	{0xcc57, 2881},
-	{0xcc58, 2882},
-	{0xcc59, 2883},
-	{0xcc5b, 0},
-	{0xcc5c, 1},
-	{0xcc5d, 2},
-	{0xcc5e, 3},
-	{0xcc5f, 4},
-	{0xcc60, 2884},
-	{0xcc62, 0},
-	{0xcc63, 1},
-	{0xcc64, 2885},
-	{0xcc66, 2886},
-	{0xcc68, 2887},
-	{0xcc6a, 0},
-	{0xcc6b, 1},
-	{0xcc6c, 2},
-	{0xcc6d, 3},
-	{0xcc6e, 4},
-	{0xcc6f, 5},
-	{0xcc70, 2888},
-	{0xcc72, 0},
-	{0xcc73, 1},
-	{0xcc74, 2},
-	{0xcc75, 2889},
-	{0xcc77, 0},
-	{0xcc78, 1},
-	{0xcc79, 2},
-	{0xcc7a, 3},
-	{0xcc7b, 4},
-	{0xcc7c, 5},
-	{0xcc7d, 6},
-	{0xcc7e, 7},
-	{0xcc7f, 8},
-	{0xcc80, 9},
-	{0xcc81, 10},
-	{0xcc82, 11},
-	{0xcc83, 12},
-	{0xcc84, 13},
-	{0xcc85, 14},
-	{0xcc86, 15},
-	{0xcc87, 16},
-	{0xcc88, 17},
-	{0xcc89, 18},
-	{0xcc8a, 19},
-	{0xcc8b, 20},
-	{0xcc8c, 21},
-	{0xcc8d, 22},
-	{0xcc8e, 23},
-	{0xcc8f, 24},
-	{0xcc90, 25},
-	{0xcc91, 26},
-	{0xcc92, 27},
-	{0xcc93, 28},
-	{0xcc94, 29},
-	{0xcc95, 30},
-	{0xcc96, 31},
-	{0xcc97, 32},
-	{0xcc98, 2890},
-	{0xcc99, 2891},
-	{0xcc9b, 0},
-	{0xcc9c, 2892},
-	{0xcc9e, 0},
-	{0xcc9f, 1},
-	{0xcca0, 2893},
-	{0xcca2, 0},
-	{0xcca3, 1},
-	{0xcca4, 2},
-	{0xcca5, 3},
-	{0xcca6, 4},
-	{0xcca7, 5},
-	{0xcca8, 2894},
-	{0xcca9, 2895},
-	{0xccab, 2896},
-	{0xccac, 2897},
-	{0xccad, 2898},
-	{0xccaf, 0},
-	{0xccb0, 1},
-	{0xccb1, 2},
-	{0xccb2, 3},
-	{0xccb3, 4},
-	{0xccb4, 2899},
-	{0xccb5, 2900},
-	{0xccb7, 0},
-	{0xccb8, 2901},
-	{0xccba, 0},
-	{0xccbb, 1},
-	{0xccbc, 2902},
-	{0xccbe, 0},
-	{0xccbf, 1},
-	{0xccc0, 2},
-	{0xccc1, 3},
-	{0xccc2, 4},
-	{0xccc3, 5},
-	{0xccc4, 2903},
-	{0xccc5, 2904},
-	{0xccc7, 2905},
-	{0xccc9, 2906},
-	{0xcccb, 0},
-	{0xcccc, 1},
-	{0xcccd, 2},
-	{0xccce, 3},
-	{0xcccf, 4},
-	{0xccd0, 2907},
-	{0xccd2, 0},
-	{0xccd3, 1},
-	{0xccd4, 2908},
-	{0xccd6, 0},
-	{0xccd7, 1},
-	{0xccd8, 2},
-	{0xccd9, 3},
-	{0xccda, 4},
-	{0xccdb, 5},
-	{0xccdc, 6},
-	{0xccdd, 7},
-	{0xccde, 8},
-	{0xccdf, 9},
-	{0xcce0, 10},
-	{0xcce1, 11},
-	{0xcce2, 12},
-	{0xcce3, 13},
-	{0xcce4, 2909},
-	{0xcce6, 0},
-	{0xcce7, 1},
-	{0xcce8, 2},
-	{0xcce9, 3},
-	{0xccea, 4},
-	{0xcceb, 5},
-	{0xccec, 2910},
-	{0xccee, 0},
-	{0xccef, 1},
-	{0xccf0, 2911},
-	{0xccf2, 0},
-	{0xccf3, 1},
-	{0xccf4, 2},
-	{0xccf5, 3},
-	{0xccf6, 4},
-	{0xccf7, 5},
-	{0xccf8, 6},
-	{0xccf9, 7},
-	{0xccfa, 8},
-	{0xccfb, 9},
-	{0xccfc, 10},
-	{0xccfd, 11},
-	{0xccfe, 12},
-	{0xccff, 13},
-	{0xcd01, 2912},
-	{0xcd03, 0},
-	{0xcd04, 1},
-	{0xcd05, 2},
-	{0xcd06, 3},
-	{0xcd07, 4},
-	{0xcd08, 2913},
-	{0xcd09, 2914},
-	{0xcd0b, 0},
-	{0xcd0c, 2915},
-	{0xcd0e, 0},
-	{0xcd0f, 1},
-	{0xcd10, 2916},
-	{0xcd12, 0},
-	{0xcd13, 1},
-	{0xcd14, 2},
-	{0xcd15, 3},
-	{0xcd16, 4},
-	{0xcd17, 5},
-	{0xcd18, 2917},
-	{0xcd19, 2918},
-	{0xcd1b, 2919},
-	{0xcd1d, 2920},
-	{0xcd1f, 0},
-	{0xcd20, 1},
-	{0xcd21, 2},
-	{0xcd22, 3},
-	{0xcd23, 4},
-	{0xcd24, 2921},
-	{0xcd26, 0},
-	{0xcd27, 1},
-	{0xcd28, 2922},
-	{0xcd2a, 0},
-	{0xcd2b, 1},
-	{0xcd2c, 2923},
-	{0xcd2e, 0},
-	{0xcd2f, 1},
-	{0xcd30, 2},
-	{0xcd31, 3},
-	{0xcd32, 4},
-	{0xcd33, 5},
-	{0xcd34, 6},
-	{0xcd35, 7},
-	{0xcd36, 8},
-	{0xcd37, 9},
-	{0xcd38, 10},
-	{0xcd39, 2924},
-	{0xcd3b, 0},
-	{0xcd3c, 1},
-	{0xcd3d, 2},
-	{0xcd3e, 3},
-	{0xcd3f, 4},
-	{0xcd40, 5},
-	{0xcd41, 6},
-	{0xcd42, 7},
-	{0xcd43, 8},
-	{0xcd44, 9},
-	{0xcd45, 10},
-	{0xcd46, 11},
-	{0xcd47, 12},
-	{0xcd48, 13},
-	{0xcd49, 14},
-	{0xcd4a, 15},
-	{0xcd4b, 16},
-	{0xcd4c, 17},
-	{0xcd4d, 18},
-	{0xcd4e, 19},
-	{0xcd4f, 20},
-	{0xcd50, 21},
-	{0xcd51, 22},
-	{0xcd52, 23},
-	{0xcd53, 24},
-	{0xcd54, 25},
-	{0xcd55, 26},
-	{0xcd56, 27},
-	{0xcd57, 28},
-	{0xcd58, 29},
-	{0xcd59, 30},
-	{0xcd5a, 31},
-	{0xcd5b, 32},
-	{0xcd5c, 2925},
-	{0xcd5e, 0},
-	{0xcd5f, 1},
-	{0xcd60, 2926},
-	{0xcd62, 0},
-	{0xcd63, 1},
-	{0xcd64, 2927},
-	{0xcd66, 0},
-	{0xcd67, 1},
-	{0xcd68, 2},
-	{0xcd69, 3},
-	{0xcd6a, 4},
-	{0xcd6b, 5},
-	{0xcd6c, 2928},
-	{0xcd6d, 2929},
-	{0xcd6f, 2930},
-	{0xcd71, 2931},
-	{0xcd73, 0},
-	{0xcd74, 1},
-	{0xcd75, 2},
-	{0xcd76, 3},
-	{0xcd77, 4},
-	{0xcd78, 2932},
-	{0xcd7a, 0},
-	{0xcd7b, 1},
-	{0xcd7c, 2},
-	{0xcd7d, 3},
-	{0xcd7e, 4},
-	{0xcd7f, 5},
-	{0xcd80, 6},
-	{0xcd81, 7},
-	{0xcd82, 8},
-	{0xcd83, 9},
-	{0xcd84, 10},
-	{0xcd85, 11},
-	{0xcd86, 12},
-	{0xcd87, 13},
-	{0xcd88, 2933},
-	{0xcd8a, 0},
-	{0xcd8b, 1},
-	{0xcd8c, 2},
-	{0xcd8d, 3},
-	{0xcd8e, 4},
-	{0xcd8f, 5},
-	{0xcd90, 6},
-	{0xcd91, 7},
-	{0xcd92, 8},
-	{0xcd93, 9},
-	{0xcd94, 2934},
-	{0xcd95, 2935},
-	{0xcd97, 0},
-	{0xcd98, 2936},
-	{0xcd9a, 0},
-	{0xcd9b, 1},
-	{0xcd9c, 2937},
-	{0xcd9e, 0},
-	{0xcd9f, 1},
-	{0xcda0, 2},
-	{0xcda1, 3},
-	{0xcda2, 4},
-	{0xcda3, 5},
-	{0xcda4, 2938},
-	{0xcda5, 2939},
-	{0xcda7, 2940},
-	{0xcda9, 2941},
-	{0xcdab, 0},
-	{0xcdac, 1},
-	{0xcdad, 2},
-	{0xcdae, 3},
-	{0xcdaf, 4},
-	{0xcdb0, 2942},
-	{0xcdb2, 0},
-	{0xcdb3, 1},
-	{0xcdb4, 2},
-	{0xcdb5, 3},
-	{0xcdb6, 4},
-	{0xcdb7, 5},
-	{0xcdb8, 6},
-	{0xcdb9, 7},
-	{0xcdba, 8},
-	{0xcdbb, 9},
-	{0xcdbc, 10},
-	{0xcdbd, 11},
-	{0xcdbe, 12},
-	{0xcdbf, 13},
-	{0xcdc0, 14},
-	{0xcdc1, 15},
-	{0xcdc2, 16},
-	{0xcdc3, 17},
-	{0xcdc4, 2943},
-	{0xcdc6, 0},
-	{0xcdc7, 1},
-	{0xcdc8, 2},
-	{0xcdc9, 3},
-	{0xcdca, 4},
-	{0xcdcb, 5},
-	{0xcdcc, 2944},
-	{0xcdce, 0},
-	{0xcdcf, 1},
-	{0xcdd0, 2945},
-	{0xcdd2, 0},
-	{0xcdd3, 1},
-	{0xcdd4, 2},
-	{0xcdd5, 3},
-	{0xcdd6, 4},
-	{0xcdd7, 5},
-	{0xcdd8, 6},
-	{0xcdd9, 7},
-	{0xcdda, 8},
-	{0xcddb, 9},
-	{0xcddc, 10},
-	{0xcddd, 11},
-	{0xcdde, 12},
-	{0xcddf, 13},
-	{0xcde0, 14},
-	{0xcde1, 15},
-	{0xcde2, 16},
-	{0xcde3, 17},
-	{0xcde4, 18},
-	{0xcde5, 19},
-	{0xcde6, 20},
-	{0xcde7, 21},
-	{0xcde8, 2946},
-	{0xcdea, 0},
-	{0xcdeb, 1},
-	{0xcdec, 2947},
-	{0xcdee, 0},
-	{0xcdef, 1},
-	{0xcdf0, 2948},
-	{0xcdf2, 0},
-	{0xcdf3, 1},
-	{0xcdf4, 2},
-	{0xcdf5, 3},
-	{0xcdf6, 4},
-	{0xcdf7, 5},
-	{0xcdf8, 2949},
-	{0xcdf9, 2950},
-	{0xcdfb, 2951},
-	{0xcdfd, 2952},
-	{0xcdff, 0},
-	{0xce01, 0},
-	{0xce02, 1},
-	{0xce03, 2},
-	{0xce04, 2953},
-	{0xce06, 0},
-	{0xce07, 1},
-	{0xce08, 2954},
-	{0xce0a, 0},
-	{0xce0b, 1},
-	{0xce0c, 2955},
-	{0xce0e, 0},
-	{0xce0f, 1},
-	{0xce10, 2},
-	{0xce11, 3},
-	{0xce12, 4},
-	{0xce13, 5},
-	{0xce14, 2956},
-	{0xce16, 0},
-	{0xce17, 1},
-	{0xce18, 2},
-	{0xce19, 2957},
-	{0xce1b, 0},
-	{0xce1c, 1},
-	{0xce1d, 2},
-	{0xce1e, 3},
-	{0xce1f, 4},
-	{0xce20, 2958},
-	{0xce21, 2959},
-	{0xce23, 0},
-	{0xce24, 2960},
-	{0xce26, 0},
-	{0xce27, 1},
-	{0xce28, 2961},
-	{0xce2a, 0},
-	{0xce2b, 1},
-	{0xce2c, 2},
-	{0xce2d, 3},
-	{0xce2e, 4},
-	{0xce2f, 5},
-	{0xce30, 2962},
-	{0xce31, 2963},
-	{0xce33, 2964},
-	{0xce35, 2965},
-	{0xce37, 0},
-	{0xce38, 1},
-	{0xce39, 2},
-	{0xce3a, 3},
-	{0xce3b, 4},
-	{0xce3c, 5},
-	{0xce3d, 6},
-	{0xce3e, 7},
-	{0xce3f, 8},
-	{0xce40, 9},
-	{0xce41, 10},
-	{0xce42, 11},
-	{0xce43, 12},
-	{0xce44, 13},
-	{0xce45, 14},
-	{0xce46, 15},
-	{0xce47, 16},
-	{0xce48, 17},
-	{0xce49, 18},
-	{0xce4a, 19},
-	{0xce4b, 20},
-	{0xce4c, 21},
-	{0xce4d, 22},
-	{0xce4e, 23},
-	{0xce4f, 24},
-	{0xce50, 25},
-	{0xce51, 26},
-	{0xce52, 27},
-	{0xce53, 28},
-	{0xce54, 29},
-	{0xce55, 30},
-	{0xce56, 31},
-	{0xce57, 32},
-	{0xce58, 2966},
-	{0xce59, 2967},
-	{0xce5b, 0},
-	{0xce5c, 2968},
-	{0xce5e, 0},
-	{0xce5f, 2969},
-	{0xce60, 2970},
-	{0xce61, 2971},
-	{0xce63, 0},
-	{0xce64, 1},
-	{0xce65, 2},
-	{0xce66, 3},
-	{0xce67, 4},
-	{0xce68, 2972},
-	{0xce69, 2973},
-	{0xce6b, 2974},
-	{0xce6d, 2975},
-	{0xce6f, 0},
-	{0xce70, 1},
-	{0xce71, 2},
-	{0xce72, 3},
-	{0xce73, 4},
-	{0xce74, 2976},
-	{0xce75, 2977},
-	{0xce77, 0},
-	{0xce78, 2978},
-	{0xce7a, 0},
-	{0xce7b, 1},
-	{0xce7c, 2979},
-	{0xce7e, 0},
-	{0xce7f, 1},
-	{0xce80, 2},
-	{0xce81, 3},
-	{0xce82, 4},
-	{0xce83, 5},
-	{0xce84, 2980},
-	{0xce85, 2981},
-	{0xce87, 2982},
-	{0xce89, 2983},
-	{0xce8b, 0},
-	{0xce8c, 1},
-	{0xce8d, 2},
-	{0xce8e, 3},
-	{0xce8f, 4},
-	{0xce90, 2984},
-	{0xce91, 2985},
-	{0xce93, 0},
-	{0xce94, 2986},
-	{0xce96, 0},
-	{0xce97, 1},
-	{0xce98, 2987},
-	{0xce9a, 0},
-	{0xce9b, 1},
-	{0xce9c, 2},
-	{0xce9d, 3},
-	{0xce9e, 4},
-	{0xce9f, 5},
-	{0xcea0, 2988},
-	{0xcea1, 2989},
-	{0xcea3, 2990},
-	{0xcea4, 2991},
-	{0xcea5, 2992},
-	{0xcea7, 0},
-	{0xcea8, 1},
-	{0xcea9, 2},
-	{0xceaa, 3},
-	{0xceab, 4},
-	{0xceac, 2993},
-	{0xcead, 2994},
-	{0xceaf, 0},
-	{0xceb0, 1},
-	{0xceb1, 2},
-	{0xceb2, 3},
-	{0xceb3, 4},
-	{0xceb4, 5},
-	{0xceb5, 6},
-	{0xceb6, 7},
-	{0xceb7, 8},
-	{0xceb8, 9},
-	{0xceb9, 10},
-	{0xceba, 11},
-	{0xcebb, 12},
-	{0xcebc, 13},
-	{0xcebd, 14},
-	{0xcebe, 15},
-	{0xcebf, 16},
-	{0xcec0, 17},
-	{0xcec1, 2995},
-	{0xcec3, 0},
-	{0xcec4, 1},
-	{0xcec5, 2},
-	{0xcec6, 3},
-	{0xcec7, 4},
-	{0xcec8, 5},
-	{0xcec9, 6},
-	{0xceca, 7},
-	{0xcecb, 8},
-	{0xcecc, 9},
-	{0xcecd, 10},
-	{0xcece, 11},
-	{0xcecf, 12},
-	{0xced0, 13},
-	{0xced1, 14},
-	{0xced2, 15},
-	{0xced3, 16},
-	{0xced4, 17},
-	{0xced5, 18},
-	{0xced6, 19},
-	{0xced7, 20},
-	{0xced8, 21},
-	{0xced9, 22},
-	{0xceda, 23},
-	{0xcedb, 24},
-	{0xcedc, 25},
-	{0xcedd, 26},
-	{0xcede, 27},
-	{0xcedf, 28},
-	{0xcee0, 29},
-	{0xcee1, 30},
-	{0xcee2, 31},
-	{0xcee3, 32},
-	{0xcee4, 2996},
-	{0xcee5, 2997},
-	{0xcee7, 0},
-	{0xcee8, 2998},
-	{0xceea, 0},
-	{0xceeb, 2999},
-	{0xceec, 3000},
-	{0xceee, 0},
-	{0xceef, 1},
-	{0xcef0, 2},
-	{0xcef1, 3},
-	{0xcef2, 4},
-	{0xcef3, 5},
-	{0xcef4, 3001},
-	{0xcef5, 3002},
-	{0xcef7, 3003},
-	{0xcef8, 3004},
-	{0xcef9, 3005},
-	{0xcefb, 0},
-	{0xcefc, 1},
-	{0xcefd, 2},
-	{0xcefe, 3},
-	{0xceff, 4},
-	{0xcf00, 3006},
-	{0xcf01, 3007},
-	{0xcf03, 0},
-	{0xcf04, 3008},
-	{0xcf06, 0},
-	{0xcf07, 1},
-	{0xcf08, 3009},
-	{0xcf0a, 0},
-	{0xcf0b, 1},
-	{0xcf0c, 2},
-	{0xcf0d, 3},
-	{0xcf0e, 4},
-	{0xcf0f, 5},
-	{0xcf10, 3010},
-	{0xcf11, 3011},
-	{0xcf13, 3012},
-	{0xcf15, 3013},
-	{0xcf17, 0},
-	{0xcf18, 1},
-	{0xcf19, 2},
-	{0xcf1a, 3},
-	{0xcf1b, 4},
-	{0xcf1c, 3014},
-	{0xcf1e, 0},
-	{0xcf1f, 1},
-	{0xcf20, 3015},
-	{0xcf22, 0},
-	{0xcf23, 1},
-	{0xcf24, 3016},
-	{0xcf26, 0},
-	{0xcf27, 1},
-	{0xcf28, 2},
-	{0xcf29, 3},
-	{0xcf2a, 4},
-	{0xcf2b, 5},
-	{0xcf2c, 3017},
-	{0xcf2d, 3018},
-	{0xcf2f, 3019},
-	{0xcf30, 3020},
-	{0xcf31, 3021},
-	{0xcf33, 0},
-	{0xcf34, 1},
-	{0xcf35, 2},
-	{0xcf36, 3},
-	{0xcf37, 4},
-	{0xcf38, 3022},
-	{0xcf3a, 0},
-	{0xcf3b, 1},
-	{0xcf3c, 2},
-	{0xcf3d, 3},
-	{0xcf3e, 4},
-	{0xcf3f, 5},
-	{0xcf40, 6},
-	{0xcf41, 7},
-	{0xcf42, 8},
-	{0xcf43, 9},
-	{0xcf44, 10},
-	{0xcf45, 11},
-	{0xcf46, 12},
-	{0xcf47, 13},
-	{0xcf48, 14},
-	{0xcf49, 15},
-	{0xcf4a, 16},
-	{0xcf4b, 17},
-	{0xcf4c, 18},
-	{0xcf4d, 19},
-	{0xcf4e, 20},
-	{0xcf4f, 21},
-	{0xcf50, 22},
-	{0xcf51, 23},
-	{0xcf52, 24},
-	{0xcf53, 25},
-	{0xcf54, 3023},
-	{0xcf55, 3024},
-	{0xcf57, 0},
-	{0xcf58, 3025},
-	{0xcf5a, 0},
-	{0xcf5b, 1},
-	{0xcf5c, 3026},
-	{0xcf5e, 0},
-	{0xcf5f, 1},
-	{0xcf60, 2},
-	{0xcf61, 3},
-	{0xcf62, 4},
-	{0xcf63, 5},
-	{0xcf64, 3027},
-	{0xcf65, 3028},
-	{0xcf67, 3029},
-	{0xcf69, 3030},
-	{0xcf6b, 0},
-	{0xcf6c, 1},
-	{0xcf6d, 2},
-	{0xcf6e, 3},
-	{0xcf6f, 4},
-	{0xcf70, 3031},
-	{0xcf71, 3032},
-	{0xcf73, 0},
-	{0xcf74, 3033},
-	{0xcf76, 0},
-	{0xcf77, 1},
-	{0xcf78, 3034},
-	{0xcf7a, 0},
-	{0xcf7b, 1},
-	{0xcf7c, 2},
-	{0xcf7d, 3},
-	{0xcf7e, 4},
-	{0xcf7f, 5},
-	{0xcf80, 3035},
-	{0xcf82, 0},
-	{0xcf83, 1},
-	{0xcf84, 2},
-	{0xcf85, 3036},
-	{0xcf87, 0},
-	{0xcf88, 1},
-	{0xcf89, 2},
-	{0xcf8a, 3},
-	{0xcf8b, 4},
-	{0xcf8c, 3037},
-	{0xcf8e, 0},
-	{0xcf8f, 1},
-	{0xcf90, 2},
-	{0xcf91, 3},
-	{0xcf92, 4},
-	{0xcf93, 5},
-	{0xcf94, 6},
-	{0xcf95, 7},
-	{0xcf96, 8},
-	{0xcf97, 9},
-	{0xcf98, 10},
-	{0xcf99, 11},
-	{0xcf9a, 12},
-	{0xcf9b, 13},
-	{0xcf9c, 14},
-	{0xcf9d, 15},
-	{0xcf9e, 16},
-	{0xcf9f, 17},
-	{0xcfa0, 18},
-	{0xcfa1, 3038},
-	{0xcfa3, 0},
-	{0xcfa4, 1},
-	{0xcfa5, 2},
-	{0xcfa6, 3},
-	{0xcfa7, 4},
-	{0xcfa8, 3039},
-	{0xcfaa, 0},
-	{0xcfab, 1},
-	{0xcfac, 2},
-	{0xcfad, 3},
-	{0xcfae, 4},
-	{0xcfaf, 5},
-	{0xcfb0, 3040},
-	{0xcfb2, 0},
-	{0xcfb3, 1},
-	{0xcfb4, 2},
-	{0xcfb5, 3},
-	{0xcfb6, 4},
-	{0xcfb7, 5},
-	{0xcfb8, 6},
-	{0xcfb9, 7},
-	{0xcfba, 8},
-	{0xcfbb, 9},
-	{0xcfbc, 10},
-	{0xcfbd, 11},
-	{0xcfbe, 12},
-	{0xcfbf, 13},
-	{0xcfc0, 14},
-	{0xcfc1, 15},
-	{0xcfc2, 16},
-	{0xcfc3, 17},
-	{0xcfc4, 3041},
-	{0xcfc6, 0},
-	{0xcfc7, 1},
-	{0xcfc8, 2},
-	{0xcfc9, 3},
-	{0xcfca, 4},
-	{0xcfcb, 5},
-	{0xcfcc, 6},
-	{0xcfcd, 7},
-	{0xcfce, 8},
-	{0xcfcf, 9},
-	{0xcfd0, 10},
-	{0xcfd1, 11},
-	{0xcfd2, 12},
-	{0xcfd3, 13},
-	{0xcfd4, 14},
-	{0xcfd5, 15},
-	{0xcfd6, 16},
-	{0xcfd7, 17},
-	{0xcfd8, 18},
-	{0xcfd9, 19},
-	{0xcfda, 20},
-	{0xcfdb, 21},
-	{0xcfdc, 22},
-	{0xcfdd, 23},
-	{0xcfde, 24},
-	{0xcfdf, 25},
-	{0xcfe0, 3042},
-	{0xcfe1, 3043},
-	{0xcfe3, 0},
-	{0xcfe4, 3044},
-	{0xcfe6, 0},
-	{0xcfe7, 1},
-	{0xcfe8, 3045},
-	{0xcfea, 0},
-	{0xcfeb, 1},
-	{0xcfec, 2},
-	{0xcfed, 3},
-	{0xcfee, 4},
-	{0xcfef, 5},
-	{0xcff0, 3046},
-	{0xcff1, 3047},
-	{0xcff3, 3048},
-	{0xcff5, 3049},
-	{0xcff7, 0},
-	{0xcff8, 1},
-	{0xcff9, 2},
-	{0xcffa, 3},
-	{0xcffb, 4},
-	{0xcffc, 3050},
-	{0xcffe, 0},
-	{0xcfff, 1},
-	{0xd000, 3051},
-	{0xd002, 0},
-	{0xd003, 1},
-	{0xd004, 3052},
-	{0xd006, 0},
-	{0xd007, 1},
-	{0xd008, 2},
-	{0xd009, 3},
-	{0xd00a, 4},
-	{0xd00b, 5},
-	{0xd00c, 6},
-	{0xd00d, 7},
-	{0xd00e, 8},
-	{0xd00f, 9},
-	{0xd010, 10},
-	{0xd011, 3053},
-	{0xd013, 0},
-	{0xd014, 1},
-	{0xd015, 2},
-	{0xd016, 3},
-	{0xd017, 4},
-	{0xd018, 3054},
-	{0xd01a, 0},
-	{0xd01b, 1},
-	{0xd01c, 2},
-	{0xd01d, 3},
-	{0xd01e, 4},
-	{0xd01f, 5},
-	{0xd020, 6},
-	{0xd021, 7},
-	{0xd022, 8},
-	{0xd023, 9},
-	{0xd024, 10},
-	{0xd025, 11},
-	{0xd026, 12},
-	{0xd027, 13},
-	{0xd028, 14},
-	{0xd029, 15},
-	{0xd02a, 16},
-	{0xd02b, 17},
-	{0xd02c, 18},
-	{0xd02d, 3055},
-	{0xd02f, 0},
-	{0xd030, 1},
-	{0xd031, 2},
-	{0xd032, 3},
-	{0xd033, 4},
-	{0xd034, 3056},
-	{0xd035, 3057},
-	{0xd037, 0},
-	{0xd038, 3058},
-	{0xd03a, 0},
-	{0xd03b, 1},
-	{0xd03c, 3059},
-	{0xd03e, 0},
-	{0xd03f, 1},
-	{0xd040, 2},
-	{0xd041, 3},
-	{0xd042, 4},
-	{0xd043, 5},
-	{0xd044, 3060},
-	{0xd045, 3061},
-	{0xd047, 3062},
-	{0xd049, 3063},
-	{0xd04b, 0},
-	{0xd04c, 1},
-	{0xd04d, 2},
-	{0xd04e, 3},
-	{0xd04f, 4},
-	{0xd050, 3064},
-	{0xd052, 0},
-	{0xd053, 1},
-	{0xd054, 3065},
-	{0xd056, 0},
-	{0xd057, 1},
-	{0xd058, 3066},
-	{0xd05a, 0},
-	{0xd05b, 1},
-	{0xd05c, 2},
-	{0xd05d, 3},
-	{0xd05e, 4},
-	{0xd05f, 5},
-	{0xd060, 3067},
-	{0xd062, 0},
-	{0xd063, 1},
-	{0xd064, 2},
-	{0xd065, 3},
-	{0xd066, 4},
-	{0xd067, 5},
-	{0xd068, 6},
-	{0xd069, 7},
-	{0xd06a, 8},
-	{0xd06b, 9},
-	{0xd06c, 3068},
-	{0xd06d, 3069},
-	{0xd06f, 0},
-	{0xd070, 3070},
-	{0xd072, 0},
-	{0xd073, 1},
-	{0xd074, 3071},
-	{0xd076, 0},
-	{0xd077, 1},
-	{0xd078, 2},
-	{0xd079, 3},
-	{0xd07a, 4},
-	{0xd07b, 5},
-	{0xd07c, 3072},
-	{0xd07d, 3073},
-	{0xd07f, 0},
-	{0xd080, 1},
-	{0xd081, 3074},
-	{0xd083, 0},
-	{0xd084, 1},
-	{0xd085, 2},
-	{0xd086, 3},
-	{0xd087, 4},
-	{0xd088, 5},
-	{0xd089, 6},
-	{0xd08a, 7},
-	{0xd08b, 8},
-	{0xd08c, 9},
-	{0xd08d, 10},
-	{0xd08e, 11},
-	{0xd08f, 12},
-	{0xd090, 13},
-	{0xd091, 14},
-	{0xd092, 15},
-	{0xd093, 16},
-	{0xd094, 17},
-	{0xd095, 18},
-	{0xd096, 19},
-	{0xd097, 20},
-	{0xd098, 21},
-	{0xd099, 22},
-	{0xd09a, 23},
-	{0xd09b, 24},
-	{0xd09c, 25},
-	{0xd09d, 26},
-	{0xd09e, 27},
-	{0xd09f, 28},
-	{0xd0a0, 29},
-	{0xd0a1, 30},
-	{0xd0a2, 31},
-	{0xd0a3, 32},
-	{0xd0a4, 3075},
-	{0xd0a5, 3076},
-	{0xd0a7, 0},
-	{0xd0a8, 3077},
-	{0xd0aa, 0},
-	{0xd0ab, 1},
-	{0xd0ac, 3078},
-	{0xd0ae, 0},
-	{0xd0af, 1},
-	{0xd0b0, 2},
-	{0xd0b1, 3},
-	{0xd0b2, 4},
-	{0xd0b3, 5},
-	{0xd0b4, 3079},
-	{0xd0b5, 3080},
-	{0xd0b7, 3081},
-	{0xd0b9, 3082},
-	{0xd0bb, 0},
-	{0xd0bc, 1},
-	{0xd0bd, 2},
-	{0xd0be, 3},
-	{0xd0bf, 4},
-	{0xd0c0, 3083},
-	{0xd0c1, 3084},
-	{0xd0c3, 0},
-	{0xd0c4, 3085},
-	{0xd0c6, 0},
-	{0xd0c7, 1},
-	{0xd0c8, 3086},
-	{0xd0c9, 3087},
-	{0xd0cb, 0},
-	{0xd0cc, 1},
-	{0xd0cd, 2},
-	{0xd0ce, 3},
-	{0xd0cf, 4},
-	{0xd0d0, 3088},
-	{0xd0d1, 3089},
-	{0xd0d3, 3090},
-	{0xd0d4, 3091},
-	{0xd0d5, 3092},
-	{0xd0d7, 0},
-	{0xd0d8, 1},
-	{0xd0d9, 2},
-	{0xd0da, 3},
-	{0xd0db, 4},
-	{0xd0dc, 3093},
-	{0xd0dd, 3094},
-	{0xd0df, 0},
-	{0xd0e0, 3095},
-	{0xd0e2, 0},
-	{0xd0e3, 1},
-	{0xd0e4, 3096},
-	{0xd0e6, 0},
-	{0xd0e7, 1},
-	{0xd0e8, 2},
-	{0xd0e9, 3},
-	{0xd0ea, 4},
-	{0xd0eb, 5},
-	{0xd0ec, 3097},
-	{0xd0ed, 3098},
-	{0xd0ef, 3099},
-	{0xd0f0, 3100},
-	{0xd0f1, 3101},
-	{0xd0f3, 0},
-	{0xd0f4, 1},
-	{0xd0f5, 2},
-	{0xd0f6, 3},
-	{0xd0f7, 4},
-	{0xd0f8, 3102},
-	{0xd0fa, 0},
-	{0xd0fb, 1},
-	{0xd0fc, 2},
-	{0xd0fd, 3},
-	{0xd0fe, 4},
-	{0xd0ff, 5},
-	{0xd101, 0},
-	{0xd102, 1},
-	{0xd103, 2},
-	{0xd104, 3},
-	{0xd105, 4},
-	{0xd106, 5},
-	{0xd107, 6},
-	{0xd108, 7},
-	{0xd109, 8},
-	{0xd10a, 9},
-	{0xd10b, 10},
-	{0xd10c, 11},
-	{0xd10d, 3103},
-	{0xd10f, 0},
-	{0xd110, 1},
-	{0xd111, 2},
-	{0xd112, 3},
-	{0xd113, 4},
-	{0xd114, 5},
-	{0xd115, 6},
-	{0xd116, 7},
-	{0xd117, 8},
-	{0xd118, 9},
-	{0xd119, 10},
-	{0xd11a, 11},
-	{0xd11b, 12},
-	{0xd11c, 13},
-	{0xd11d, 14},
-	{0xd11e, 15},
-	{0xd11f, 16},
-	{0xd120, 17},
-	{0xd121, 18},
-	{0xd122, 19},
-	{0xd123, 20},
-	{0xd124, 21},
-	{0xd125, 22},
-	{0xd126, 23},
-	{0xd127, 24},
-	{0xd128, 25},
-	{0xd129, 26},
-	{0xd12a, 27},
-	{0xd12b, 28},
-	{0xd12c, 29},
-	{0xd12d, 30},
-	{0xd12e, 31},
-	{0xd12f, 32},
-	{0xd130, 3104},
-	{0xd131, 3105},
-	{0xd133, 0},
-	{0xd134, 3106},
-	{0xd136, 0},
-	{0xd137, 1},
-	{0xd138, 3107},
-	{0xd13a, 3108},
-	{0xd13c, 0},
-	{0xd13d, 1},
-	{0xd13e, 2},
-	{0xd13f, 3},
-	{0xd140, 3109},
-	{0xd141, 3110},
-	{0xd143, 3111},
-	{0xd144, 3112},
-	{0xd145, 3113},
-	{0xd147, 0},
-	{0xd148, 1},
-	{0xd149, 2},
-	{0xd14a, 3},
-	{0xd14b, 4},
-	{0xd14c, 3114},
-	{0xd14d, 3115},
-	{0xd14f, 0},
-	{0xd150, 3116},
-	{0xd152, 0},
-	{0xd153, 1},
-	{0xd154, 3117},
-	{0xd156, 0},
-	{0xd157, 1},
-	{0xd158, 2},
-	{0xd159, 3},
-	{0xd15a, 4},
-	{0xd15b, 5},
-	{0xd15c, 3118},
-	{0xd15d, 3119},
-	{0xd15f, 3120},
-	{0xd161, 3121},
-	{0xd163, 0},
-	{0xd164, 1},
-	{0xd165, 2},
-	{0xd166, 3},
-	{0xd167, 4},
-	{0xd168, 3122},
-	{0xd16a, 0},
-	{0xd16b, 1},
-	{0xd16c, 3123},
-	{0xd16e, 0},
-	{0xd16f, 1},
-	{0xd170, 2},
-	{0xd171, 3},
-	{0xd172, 4},
-	{0xd173, 5},
-	{0xd174, 6},
-	{0xd175, 7},
-	{0xd176, 8},
-	{0xd177, 9},
-	{0xd178, 10},
-	{0xd179, 11},
-	{0xd17a, 12},
-	{0xd17b, 13},
-	{0xd17c, 3124},
-	{0xd17e, 0},
-	{0xd17f, 1},
-	{0xd180, 2},
-	{0xd181, 3},
-	{0xd182, 4},
-	{0xd183, 5},
-	{0xd184, 3125},
-	{0xd186, 0},
-	{0xd187, 1},
-	{0xd188, 3126},
-	{0xd18a, 0},
-	{0xd18b, 1},
-	{0xd18c, 2},
-	{0xd18d, 3},
-	{0xd18e, 4},
-	{0xd18f, 5},
-	{0xd190, 6},
-	{0xd191, 7},
-	{0xd192, 8},
-	{0xd193, 9},
-	{0xd194, 10},
-	{0xd195, 11},
-	{0xd196, 12},
-	{0xd197, 13},
-	{0xd198, 14},
-	{0xd199, 15},
-	{0xd19a, 16},
-	{0xd19b, 17},
-	{0xd19c, 18},
-	{0xd19d, 19},
-	{0xd19e, 20},
-	{0xd19f, 21},
-	{0xd1a0, 3127},
-	{0xd1a1, 3128},
-	{0xd1a3, 0},
-	{0xd1a4, 3129},
-	{0xd1a6, 0},
-	{0xd1a7, 1},
-	{0xd1a8, 3130},
-	{0xd1aa, 0},
-	{0xd1ab, 1},
-	{0xd1ac, 2},
-	{0xd1ad, 3},
-	{0xd1ae, 4},
-	{0xd1af, 5},
-	{0xd1b0, 3131},
-	{0xd1b1, 3132},
-	{0xd1b3, 3133},
-	{0xd1b5, 3134},
-	{0xd1b7, 0},
-	{0xd1b8, 1},
-	{0xd1b9, 2},
-	{0xd1ba, 3135},
-	{0xd1bc, 3136},
-	{0xd1be, 0},
-	{0xd1bf, 1},
-	{0xd1c0, 3137},
-	{0xd1c2, 0},
-	{0xd1c3, 1},
-	{0xd1c4, 2},
-	{0xd1c5, 3},
-	{0xd1c6, 4},
-	{0xd1c7, 5},
-	{0xd1c8, 6},
-	{0xd1c9, 7},
-	{0xd1ca, 8},
-	{0xd1cb, 9},
-	{0xd1cc, 10},
-	{0xd1cd, 11},
-	{0xd1ce, 12},
-	{0xd1cf, 13},
-	{0xd1d0, 14},
-	{0xd1d1, 15},
-	{0xd1d2, 16},
-	{0xd1d3, 17},
-	{0xd1d4, 18},
-	{0xd1d5, 19},
-	{0xd1d6, 20},
-	{0xd1d7, 21},
-	{0xd1d8, 3138},
-	{0xd1da, 0},
-	{0xd1db, 1},
-	{0xd1dc, 2},
-	{0xd1dd, 3},
-	{0xd1de, 4},
-	{0xd1df, 5},
-	{0xd1e0, 6},
-	{0xd1e1, 7},
-	{0xd1e2, 8},
-	{0xd1e3, 9},
-	{0xd1e4, 10},
-	{0xd1e5, 11},
-	{0xd1e6, 12},
-	{0xd1e7, 13},
-	{0xd1e8, 14},
-	{0xd1e9, 15},
-	{0xd1ea, 16},
-	{0xd1eb, 17},
-	{0xd1ec, 18},
-	{0xd1ed, 19},
-	{0xd1ee, 20},
-	{0xd1ef, 21},
-	{0xd1f0, 22},
-	{0xd1f1, 23},
-	{0xd1f2, 24},
-	{0xd1f3, 25},
-	{0xd1f4, 3139},
-	{0xd1f6, 0},
-	{0xd1f7, 1},
-	{0xd1f8, 3140},
-	{0xd1fa, 0},
-	{0xd1fb, 1},
-	{0xd1fc, 2},
-	{0xd1fd, 3},
-	{0xd1fe, 4},
-	{0xd1ff, 5},
-	{0xd201, 0},
-	{0xd202, 1},
-	{0xd203, 2},
-	{0xd204, 3},
-	{0xd205, 4},
-	{0xd206, 5},
-	{0xd207, 3141},
-	{0xd209, 3142},
-	{0xd20b, 0},
-	{0xd20c, 1},
-	{0xd20d, 2},
-	{0xd20e, 3},
-	{0xd20f, 4},
-	{0xd210, 3143},
-	{0xd212, 0},
-	{0xd213, 1},
-	{0xd214, 2},
-	{0xd215, 3},
-	{0xd216, 4},
-	{0xd217, 5},
-	{0xd218, 6},
-	{0xd219, 7},
-	{0xd21a, 8},
-	{0xd21b, 9},
-	{0xd21c, 10},
-	{0xd21d, 11},
-	{0xd21e, 12},
-	{0xd21f, 13},
-	{0xd220, 14},
-	{0xd221, 15},
-	{0xd222, 16},
-	{0xd223, 17},
-	{0xd224, 18},
-	{0xd225, 19},
-	{0xd226, 20},
-	{0xd227, 21},
-	{0xd228, 22},
-	{0xd229, 23},
-	{0xd22a, 24},
-	{0xd22b, 25},
-	{0xd22c, 3144},
-	{0xd22d, 3145},
-	{0xd22f, 0},
-	{0xd230, 3146},
-	{0xd232, 0},
-	{0xd233, 1},
-	{0xd234, 3147},
-	{0xd236, 0},
-	{0xd237, 1},
-	{0xd238, 2},
-	{0xd239, 3},
-	{0xd23a, 4},
-	{0xd23b, 5},
-	{0xd23c, 3148},
-	{0xd23d, 3149},
-	{0xd23f, 3150},
-	{0xd241, 3151},
-	{0xd243, 0},
-	{0xd244, 1},
-	{0xd245, 2},
-	{0xd246, 3},
-	{0xd247, 4},
-	{0xd248, 3152},
-	{0xd24a, 0},
-	{0xd24b, 1},
-	{0xd24c, 2},
-	{0xd24d, 3},
-	{0xd24e, 4},
-	{0xd24f, 5},
-	{0xd250, 6},
-	{0xd251, 7},
-	{0xd252, 8},
-	{0xd253, 9},
-	{0xd254, 10},
-	{0xd255, 11},
-	{0xd256, 12},
-	{0xd257, 13},
-	{0xd258, 14},
-	{0xd259, 15},
-	{0xd25a, 16},
-	{0xd25b, 17},
-	{0xd25c, 3153},
-	{0xd25e, 0},
-	{0xd25f, 1},
-	{0xd260, 2},
-	{0xd261, 3},
-	{0xd262, 4},
-	{0xd263, 5},
-	{0xd264, 3154},
-	{0xd266, 0},
-	{0xd267, 1},
-	{0xd268, 2},
-	{0xd269, 3},
-	{0xd26a, 4},
-	{0xd26b, 5},
-	{0xd26c, 6},
-	{0xd26d, 7},
-	{0xd26e, 8},
-	{0xd26f, 9},
-	{0xd270, 10},
-	{0xd271, 11},
-	{0xd272, 12},
-	{0xd273, 13},
-	{0xd274, 14},
-	{0xd275, 15},
-	{0xd276, 16},
-	{0xd277, 17},
-	{0xd278, 18},
-	{0xd279, 19},
-	{0xd27a, 20},
-	{0xd27b, 21},
-	{0xd27c, 22},
-	{0xd27d, 23},
-	{0xd27e, 24},
-	{0xd27f, 25},
-	{0xd280, 3155},
-	{0xd281, 3156},
-	{0xd283, 0},
-	{0xd284, 3157},
-	{0xd286, 0},
-	{0xd287, 1},
-	{0xd288, 3158},
-	{0xd28a, 0},
-	{0xd28b, 1},
-	{0xd28c, 2},
-	{0xd28d, 3},
-	{0xd28e, 4},
-	{0xd28f, 5},
-	{0xd290, 3159},
-	{0xd291, 3160},
-	{0xd293, 0},
-	{0xd294, 1},
-	{0xd295, 3161},
-	{0xd297, 0},
-	{0xd298, 1},
-	{0xd299, 2},
-	{0xd29a, 3},
-	{0xd29b, 4},
-	{0xd29c, 3162},
-	{0xd29e, 0},
-	{0xd29f, 1},
-	{0xd2a0, 3163},
-	{0xd2a2, 0},
-	{0xd2a3, 1},
-	{0xd2a4, 3164},
-	{0xd2a6, 0},
-	{0xd2a7, 1},
-	{0xd2a8, 2},
-	{0xd2a9, 3},
-	{0xd2aa, 4},
-	{0xd2ab, 5},
-	{0xd2ac, 3165},
-	{0xd2ae, 0},
-	{0xd2af, 1},
-	{0xd2b0, 2},
-	{0xd2b1, 3166},
-	{0xd2b3, 0},
-	{0xd2b4, 1},
-	{0xd2b5, 2},
-	{0xd2b6, 3},
-	{0xd2b7, 4},
-	{0xd2b8, 3167},
-	{0xd2b9, 3168},
-	{0xd2bb, 0},
-	{0xd2bc, 3169},
-	{0xd2be, 0},
-	{0xd2bf, 3170},
-	{0xd2c0, 3171},
-	{0xd2c2, 3172},
-	{0xd2c4, 0},
-	{0xd2c5, 1},
-	{0xd2c6, 2},
-	{0xd2c7, 3},
-	{0xd2c8, 3173},
-	{0xd2c9, 3174},
-	{0xd2cb, 3175},
-	{0xd2cd, 0},
-	{0xd2ce, 1},
-	{0xd2cf, 2},
-	{0xd2d0, 3},
-	{0xd2d1, 4},
-	{0xd2d2, 5},
-	{0xd2d3, 6},
-	{0xd2d4, 3176},
-	{0xd2d6, 0},
-	{0xd2d7, 1},
-	{0xd2d8, 3177},
-	{0xd2da, 0},
-	{0xd2db, 1},
-	{0xd2dc, 3178},
-	{0xd2de, 0},
-	{0xd2df, 1},
-	{0xd2e0, 2},
-	{0xd2e1, 3},
-	{0xd2e2, 4},
-	{0xd2e3, 5},
-	{0xd2e4, 3179},
-	{0xd2e5, 3180},
-	{0xd2e7, 0},
-	{0xd2e8, 1},
-	{0xd2e9, 2},
-	{0xd2ea, 3},
-	{0xd2eb, 4},
-	{0xd2ec, 5},
-	{0xd2ed, 6},
-	{0xd2ee, 7},
-	{0xd2ef, 8},
-	{0xd2f0, 3181},
-	{0xd2f1, 3182},
-	{0xd2f3, 0},
-	{0xd2f4, 3183},
-	{0xd2f6, 0},
-	{0xd2f7, 1},
-	{0xd2f8, 3184},
-	{0xd2fa, 0},
-	{0xd2fb, 1},
-	{0xd2fc, 2},
-	{0xd2fd, 3},
-	{0xd2fe, 4},
-	{0xd2ff, 5},
-	{0xd300, 3185},
-	{0xd301, 3186},
-	{0xd303, 3187},
-	{0xd305, 3188},
-	{0xd307, 0},
-	{0xd308, 1},
-	{0xd309, 2},
-	{0xd30a, 3},
-	{0xd30b, 4},
-	{0xd30c, 3189},
-	{0xd30d, 3190},
-	{0xd30e, 3191},
-	{0xd310, 3192},
-	{0xd312, 0},
-	{0xd313, 1},
-	{0xd314, 3193},
-	{0xd316, 3194},
-	{0xd318, 0},
-	{0xd319, 1},
-	{0xd31a, 2},
-	{0xd31b, 3},
-	{0xd31c, 3195},
-	{0xd31d, 3196},
-	{0xd31f, 3197},
-	{0xd320, 3198},
-	{0xd321, 3199},
-	{0xd323, 0},
-	{0xd324, 1},
-	{0xd325, 3200},
-	{0xd327, 0},
-	{0xd328, 3201},
-	{0xd329, 3202},
-	{0xd32b, 0},
-	{0xd32c, 3203},
-	{0xd32e, 0},
-	{0xd32f, 1},
-	{0xd330, 3204},
-	{0xd332, 0},
-	{0xd333, 1},
-	{0xd334, 2},
-	{0xd335, 3},
-	{0xd336, 4},
-	{0xd337, 5},
-	{0xd338, 3205},
-	{0xd339, 3206},
-	{0xd33b, 3207},
-	{0xd33c, 3208},
-	{0xd33d, 3209},
-	{0xd33f, 0},
-	{0xd340, 1},
-	{0xd341, 2},
-	{0xd342, 3},
-	{0xd343, 4},
-	{0xd344, 3210},
-	{0xd345, 3211},
-	{0xd347, 0},
-	{0xd348, 1},
-	{0xd349, 2},
-	{0xd34a, 3},
-	{0xd34b, 4},
-	{0xd34c, 5},
-	{0xd34d, 6},
-	{0xd34e, 7},
-	{0xd34f, 8},
-	{0xd350, 9},
-	{0xd351, 10},
-	{0xd352, 11},
-	{0xd353, 12},
-	{0xd354, 13},
-	{0xd355, 14},
-	{0xd356, 15},
-	{0xd357, 16},
-	{0xd358, 17},
-	{0xd359, 18},
-	{0xd35a, 19},
-	{0xd35b, 20},
-	{0xd35c, 21},
-	{0xd35d, 22},
-	{0xd35e, 23},
-	{0xd35f, 24},
-	{0xd360, 25},
-	{0xd361, 26},
-	{0xd362, 27},
-	{0xd363, 28},
-	{0xd364, 29},
-	{0xd365, 30},
-	{0xd366, 31},
-	{0xd367, 32},
-	{0xd368, 33},
-	{0xd369, 34},
-	{0xd36a, 35},
-	{0xd36b, 36},
-	{0xd36c, 37},
-	{0xd36d, 38},
-	{0xd36e, 39},
-	{0xd36f, 40},
-	{0xd370, 41},
-	{0xd371, 42},
-	{0xd372, 43},
-	{0xd373, 44},
-	{0xd374, 45},
-	{0xd375, 46},
-	{0xd376, 47},
-	{0xd377, 48},
-	{0xd378, 49},
-	{0xd379, 50},
-	{0xd37a, 51},
-	{0xd37b, 52},
-	{0xd37c, 3212},
-	{0xd37d, 3213},
-	{0xd37f, 0},
-	{0xd380, 3214},
-	{0xd382, 0},
-	{0xd383, 1},
-	{0xd384, 3215},
-	{0xd386, 0},
-	{0xd387, 1},
-	{0xd388, 2},
-	{0xd389, 3},
-	{0xd38a, 4},
-	{0xd38b, 5},
-	{0xd38c, 3216},
-	{0xd38d, 3217},
-	{0xd38f, 3218},
-	{0xd390, 3219},
-	{0xd391, 3220},
-	{0xd393, 0},
-	{0xd394, 1},
-	{0xd395, 2},
-	{0xd396, 3},
-	{0xd397, 4},
-	{0xd398, 3221},
-	{0xd399, 3222},
-	{0xd39b, 0},
-	{0xd39c, 3223},
-	{0xd39e, 0},
-	{0xd39f, 1},
-	{0xd3a0, 3224},
-	{0xd3a2, 0},
-	{0xd3a3, 1},
-	{0xd3a4, 2},
-	{0xd3a5, 3},
-	{0xd3a6, 4},
-	{0xd3a7, 5},
-	{0xd3a8, 3225},
-	{0xd3a9, 3226},
-	{0xd3ab, 3227},
-	{0xd3ad, 3228},
-	{0xd3af, 0},
-	{0xd3b0, 1},
-	{0xd3b1, 2},
-	{0xd3b2, 3},
-	{0xd3b3, 4},
-	{0xd3b4, 3229},
-	{0xd3b6, 0},
-	{0xd3b7, 1},
-	{0xd3b8, 3230},
-	{0xd3ba, 0},
-	{0xd3bb, 1},
-	{0xd3bc, 3231},
-	{0xd3be, 0},
-	{0xd3bf, 1},
-	{0xd3c0, 2},
-	{0xd3c1, 3},
-	{0xd3c2, 4},
-	{0xd3c3, 5},
-	{0xd3c4, 3232},
-	{0xd3c5, 3233},
-	{0xd3c7, 0},
-	{0xd3c8, 3234},
-	{0xd3c9, 3235},
-	{0xd3cb, 0},
-	{0xd3cc, 1},
-	{0xd3cd, 2},
-	{0xd3ce, 3},
-	{0xd3cf, 4},
-	{0xd3d0, 3236},
-	{0xd3d2, 0},
-	{0xd3d3, 1},
-	{0xd3d4, 2},
-	{0xd3d5, 3},
-	{0xd3d6, 4},
-	{0xd3d7, 5},
-	{0xd3d8, 3237},
-	{0xd3da, 0},
-	{0xd3db, 1},
-	{0xd3dc, 2},
-	{0xd3dd, 3},
-	{0xd3de, 4},
-	{0xd3df, 5},
-	{0xd3e0, 6},
-	{0xd3e1, 3238},
-	{0xd3e3, 3239},
-	{0xd3e5, 0},
-	{0xd3e6, 1},
-	{0xd3e7, 2},
-	{0xd3e8, 3},
-	{0xd3e9, 4},
-	{0xd3ea, 5},
-	{0xd3eb, 6},
-	{0xd3ec, 3240},
-	{0xd3ed, 3241},
-	{0xd3ef, 0},
-	{0xd3f0, 3242},
-	{0xd3f2, 0},
-	{0xd3f3, 1},
-	{0xd3f4, 3243},
-	{0xd3f6, 0},
-	{0xd3f7, 1},
-	{0xd3f8, 2},
-	{0xd3f9, 3},
-	{0xd3fa, 4},
-	{0xd3fb, 5},
-	{0xd3fc, 3244},
-	{0xd3fd, 3245},
-	{0xd3ff, 3246},
-	{0xd401, 3247},
-	{0xd403, 0},
-	{0xd404, 1},
-	{0xd405, 2},
-	{0xd406, 3},
-	{0xd407, 4},
-	{0xd408, 3248},
-	{0xd40a, 0},
-	{0xd40b, 1},
-	{0xd40c, 2},
-	{0xd40d, 3},
-	{0xd40e, 4},
-	{0xd40f, 5},
-	{0xd410, 6},
-	{0xd411, 7},
-	{0xd412, 8},
-	{0xd413, 9},
-	{0xd414, 10},
-	{0xd415, 11},
-	{0xd416, 12},
-	{0xd417, 13},
-	{0xd418, 14},
-	{0xd419, 15},
-	{0xd41a, 16},
-	{0xd41b, 17},
-	{0xd41c, 18},
-	{0xd41d, 3249},
-	{0xd41f, 0},
-	{0xd420, 1},
-	{0xd421, 2},
-	{0xd422, 3},
-	{0xd423, 4},
-	{0xd424, 5},
-	{0xd425, 6},
-	{0xd426, 7},
-	{0xd427, 8},
-	{0xd428, 9},
-	{0xd429, 10},
-	{0xd42a, 11},
-	{0xd42b, 12},
-	{0xd42c, 13},
-	{0xd42d, 14},
-	{0xd42e, 15},
-	{0xd42f, 16},
-	{0xd430, 17},
-	{0xd431, 18},
-	{0xd432, 19},
-	{0xd433, 20},
-	{0xd434, 21},
-	{0xd435, 22},
-	{0xd436, 23},
-	{0xd437, 24},
-	{0xd438, 25},
-	{0xd439, 26},
-	{0xd43a, 27},
-	{0xd43b, 28},
-	{0xd43c, 29},
-	{0xd43d, 30},
-	{0xd43e, 31},
-	{0xd43f, 32},
-	{0xd440, 3250},
-	{0xd442, 0},
-	{0xd443, 1},
-	{0xd444, 3251},
-	{0xd446, 0},
-	{0xd447, 1},
-	{0xd448, 2},
-	{0xd449, 3},
-	{0xd44a, 4},
-	{0xd44b, 5},
-	{0xd44c, 6},
-	{0xd44d, 7},
-	{0xd44e, 8},
-	{0xd44f, 9},
-	{0xd450, 10},
-	{0xd451, 11},
-	{0xd452, 12},
-	{0xd453, 13},
-	{0xd454, 14},
-	{0xd455, 15},
-	{0xd456, 16},
-	{0xd457, 17},
-	{0xd458, 18},
-	{0xd459, 19},
-	{0xd45a, 20},
-	{0xd45b, 21},
-	{0xd45c, 3252},
-	{0xd45e, 0},
-	{0xd45f, 1},
-	{0xd460, 3253},
-	{0xd462, 0},
-	{0xd463, 1},
-	{0xd464, 3254},
-	{0xd466, 0},
-	{0xd467, 1},
-	{0xd468, 2},
-	{0xd469, 3},
-	{0xd46a, 4},
-	{0xd46b, 5},
-	{0xd46c, 6},
-	{0xd46d, 3255},
-	{0xd46f, 3256},
-	{0xd471, 0},
-	{0xd472, 1},
-	{0xd473, 2},
-	{0xd474, 3},
-	{0xd475, 4},
-	{0xd476, 5},
-	{0xd477, 6},
-	{0xd478, 3257},
-	{0xd479, 3258},
-	{0xd47b, 0},
-	{0xd47c, 3259},
-	{0xd47e, 0},
-	{0xd47f, 3260},
-	{0xd480, 3261},
-	{0xd482, 3262},
-	{0xd484, 0},
-	{0xd485, 1},
-	{0xd486, 2},
-	{0xd487, 3},
-	{0xd488, 3263},
-	{0xd489, 3264},
-	{0xd48b, 3265},
-	{0xd48d, 3266},
-	{0xd48f, 0},
-	{0xd490, 1},
-	{0xd491, 2},
-	{0xd492, 3},
-	{0xd493, 4},
-	{0xd494, 3267},
-	{0xd496, 0},
-	{0xd497, 1},
-	{0xd498, 2},
-	{0xd499, 3},
-	{0xd49a, 4},
-	{0xd49b, 5},
-	{0xd49c, 6},
-	{0xd49d, 7},
-	{0xd49e, 8},
-	{0xd49f, 9},
-	{0xd4a0, 10},
-	{0xd4a1, 11},
-	{0xd4a2, 12},
-	{0xd4a3, 13},
-	{0xd4a4, 14},
-	{0xd4a5, 15},
-	{0xd4a6, 16},
-	{0xd4a7, 17},
-	{0xd4a8, 18},
-	{0xd4a9, 3268},
-	{0xd4ab, 0},
-	{0xd4ac, 1},
-	{0xd4ad, 2},
-	{0xd4ae, 3},
-	{0xd4af, 4},
-	{0xd4b0, 5},
-	{0xd4b1, 6},
-	{0xd4b2, 7},
-	{0xd4b3, 8},
-	{0xd4b4, 9},
-	{0xd4b5, 10},
-	{0xd4b6, 11},
-	{0xd4b7, 12},
-	{0xd4b8, 13},
-	{0xd4b9, 14},
-	{0xd4ba, 15},
-	{0xd4bb, 16},
-	{0xd4bc, 17},
-	{0xd4bd, 18},
-	{0xd4be, 19},
-	{0xd4bf, 20},
-	{0xd4c0, 21},
-	{0xd4c1, 22},
-	{0xd4c2, 23},
-	{0xd4c3, 24},
-	{0xd4c4, 25},
-	{0xd4c5, 26},
-	{0xd4c6, 27},
-	{0xd4c7, 28},
-	{0xd4c8, 29},
-	{0xd4c9, 30},
-	{0xd4ca, 31},
-	{0xd4cb, 32},
-	{0xd4cc, 3269},
-	{0xd4ce, 0},
-	{0xd4cf, 1},
-	{0xd4d0, 3270},
-	{0xd4d2, 0},
-	{0xd4d3, 1},
-	{0xd4d4, 3271},
-	{0xd4d6, 0},
-	{0xd4d7, 1},
-	{0xd4d8, 2},
-	{0xd4d9, 3},
-	{0xd4da, 4},
-	{0xd4db, 5},
-	{0xd4dc, 3272},
-	{0xd4de, 0},
-	{0xd4df, 3273},
-	{0xd4e1, 0},
-	{0xd4e2, 1},
-	{0xd4e3, 2},
-	{0xd4e4, 3},
-	{0xd4e5, 4},
-	{0xd4e6, 5},
-	{0xd4e7, 6},
-	{0xd4e8, 3274},
-	{0xd4ea, 0},
-	{0xd4eb, 1},
-	{0xd4ec, 3275},
-	{0xd4ee, 0},
-	{0xd4ef, 1},
-	{0xd4f0, 3276},
-	{0xd4f2, 0},
-	{0xd4f3, 1},
-	{0xd4f4, 2},
-	{0xd4f5, 3},
-	{0xd4f6, 4},
-	{0xd4f7, 5},
-	{0xd4f8, 3277},
-	{0xd4fa, 0},
-	{0xd4fb, 3278},
-	{0xd4fd, 3279},
-	{0xd4ff, 0},
-	{0xd501, 0},
-	{0xd502, 1},
-	{0xd503, 2},
-	{0xd504, 3280},
-	{0xd506, 0},
-	{0xd507, 1},
-	{0xd508, 3281},
-	{0xd50a, 0},
-	{0xd50b, 1},
-	{0xd50c, 3282},
-	{0xd50e, 0},
-	{0xd50f, 1},
-	{0xd510, 2},
-	{0xd511, 3},
-	{0xd512, 4},
-	{0xd513, 5},
-	{0xd514, 3283},
-	{0xd515, 3284},
-	{0xd517, 3285},
-	{0xd519, 0},
-	{0xd51a, 1},
-	{0xd51b, 2},
-	{0xd51c, 3},
-	{0xd51d, 4},
-	{0xd51e, 5},
-	{0xd51f, 6},
-	{0xd520, 7},
-	{0xd521, 8},
-	{0xd522, 9},
-	{0xd523, 10},
-	{0xd524, 11},
-	{0xd525, 12},
-	{0xd526, 13},
-	{0xd527, 14},
-	{0xd528, 15},
-	{0xd529, 16},
-	{0xd52a, 17},
-	{0xd52b, 18},
-	{0xd52c, 19},
-	{0xd52d, 20},
-	{0xd52e, 21},
-	{0xd52f, 22},
-	{0xd530, 23},
-	{0xd531, 24},
-	{0xd532, 25},
-	{0xd533, 26},
-	{0xd534, 27},
-	{0xd535, 28},
-	{0xd536, 29},
-	{0xd537, 30},
-	{0xd538, 31},
-	{0xd539, 32},
-	{0xd53a, 33},
-	{0xd53b, 34},
-	{0xd53c, 3286},
-	{0xd53d, 3287},
-	{0xd53f, 0},
-	{0xd540, 3288},
-	{0xd542, 0},
-	{0xd543, 1},
-	{0xd544, 3289},
-	{0xd546, 0},
-	{0xd547, 1},
-	{0xd548, 2},
-	{0xd549, 3},
-	{0xd54a, 4},
-	{0xd54b, 5},
-	{0xd54c, 3290},
-	{0xd54d, 3291},
-	{0xd54f, 3292},
-	{0xd551, 3293},
-	{0xd553, 0},
-	{0xd554, 1},
-	{0xd555, 2},
-	{0xd556, 3},
-	{0xd557, 4},
-	{0xd558, 3294},
-	{0xd559, 3295},
-	{0xd55b, 0},
-	{0xd55c, 3296},
-	{0xd55e, 0},
-	{0xd55f, 1},
-	{0xd560, 3297},
-	{0xd562, 0},
-	{0xd563, 1},
-	{0xd564, 2},
-	{0xd565, 3298},
-	{0xd567, 0},
-	{0xd568, 3299},
-	{0xd569, 3300},
-	{0xd56b, 3301},
-	{0xd56d, 3302},
-	{0xd56f, 0},
-	{0xd570, 1},
-	{0xd571, 2},
-	{0xd572, 3},
-	{0xd573, 4},
-	{0xd574, 3303},
-	{0xd575, 3304},
-	{0xd577, 0},
-	{0xd578, 3305},
-	{0xd57a, 0},
-	{0xd57b, 1},
-	{0xd57c, 3306},
-	{0xd57e, 0},
-	{0xd57f, 1},
-	{0xd580, 2},
-	{0xd581, 3},
-	{0xd582, 4},
-	{0xd583, 5},
-	{0xd584, 3307},
-	{0xd585, 3308},
-	{0xd587, 3309},
-	{0xd588, 3310},
-	{0xd589, 3311},
-	{0xd58b, 0},
-	{0xd58c, 1},
-	{0xd58d, 2},
-	{0xd58e, 3},
-	{0xd58f, 4},
-	{0xd590, 3312},
-	{0xd592, 0},
-	{0xd593, 1},
-	{0xd594, 2},
-	{0xd595, 3},
-	{0xd596, 4},
-	{0xd597, 5},
-	{0xd598, 6},
-	{0xd599, 7},
-	{0xd59a, 8},
-	{0xd59b, 9},
-	{0xd59c, 10},
-	{0xd59d, 11},
-	{0xd59e, 12},
-	{0xd59f, 13},
-	{0xd5a0, 14},
-	{0xd5a1, 15},
-	{0xd5a2, 16},
-	{0xd5a3, 17},
-	{0xd5a4, 18},
-	{0xd5a5, 3313},
-	{0xd5a7, 0},
-	{0xd5a8, 1},
-	{0xd5a9, 2},
-	{0xd5aa, 3},
-	{0xd5ab, 4},
-	{0xd5ac, 5},
-	{0xd5ad, 6},
-	{0xd5ae, 7},
-	{0xd5af, 8},
-	{0xd5b0, 9},
-	{0xd5b1, 10},
-	{0xd5b2, 11},
-	{0xd5b3, 12},
-	{0xd5b4, 13},
-	{0xd5b5, 14},
-	{0xd5b6, 15},
-	{0xd5b7, 16},
-	{0xd5b8, 17},
-	{0xd5b9, 18},
-	{0xd5ba, 19},
-	{0xd5bb, 20},
-	{0xd5bc, 21},
-	{0xd5bd, 22},
-	{0xd5be, 23},
-	{0xd5bf, 24},
-	{0xd5c0, 25},
-	{0xd5c1, 26},
-	{0xd5c2, 27},
-	{0xd5c3, 28},
-	{0xd5c4, 29},
-	{0xd5c5, 30},
-	{0xd5c6, 31},
-	{0xd5c7, 32},
-	{0xd5c8, 3314},
-	{0xd5c9, 3315},
-	{0xd5cb, 0},
-	{0xd5cc, 3316},
-	{0xd5ce, 0},
-	{0xd5cf, 1},
-	{0xd5d0, 3317},
-	{0xd5d2, 3318},
-	{0xd5d4, 0},
-	{0xd5d5, 1},
-	{0xd5d6, 2},
-	{0xd5d7, 3},
-	{0xd5d8, 3319},
-	{0xd5d9, 3320},
-	{0xd5db, 3321},
-	{0xd5dd, 3322},
-	{0xd5df, 0},
-	{0xd5e0, 1},
-	{0xd5e1, 2},
-	{0xd5e2, 3},
-	{0xd5e3, 4},
-	{0xd5e4, 3323},
-	{0xd5e5, 3324},
-	{0xd5e7, 0},
-	{0xd5e8, 3325},
-	{0xd5ea, 0},
-	{0xd5eb, 1},
-	{0xd5ec, 3326},
-	{0xd5ee, 0},
-	{0xd5ef, 1},
-	{0xd5f0, 2},
-	{0xd5f1, 3},
-	{0xd5f2, 4},
-	{0xd5f3, 5},
-	{0xd5f4, 3327},
-	{0xd5f5, 3328},
-	{0xd5f7, 3329},
-	{0xd5f9, 3330},
-	{0xd5fb, 0},
-	{0xd5fc, 1},
-	{0xd5fd, 2},
-	{0xd5fe, 3},
-	{0xd5ff, 4},
-	{0xd600, 3331},
-	{0xd601, 3332},
-	{0xd603, 0},
-	{0xd604, 3333},
-	{0xd606, 0},
-	{0xd607, 1},
-	{0xd608, 3334},
-	{0xd60a, 0},
-	{0xd60b, 1},
-	{0xd60c, 2},
-	{0xd60d, 3},
-	{0xd60e, 4},
-	{0xd60f, 5},
-	{0xd610, 3335},
-	{0xd611, 3336},
-	{0xd613, 3337},
-	{0xd614, 3338},
-	{0xd615, 3339},
-	{0xd617, 0},
-	{0xd618, 1},
-	{0xd619, 2},
-	{0xd61a, 3},
-	{0xd61b, 4},
-	{0xd61c, 3340},
-	{0xd61e, 0},
-	{0xd61f, 1},
-	{0xd620, 3341},
-	{0xd622, 0},
-	{0xd623, 1},
-	{0xd624, 3342},
-	{0xd626, 0},
-	{0xd627, 1},
-	{0xd628, 2},
-	{0xd629, 3},
-	{0xd62a, 4},
-	{0xd62b, 5},
-	{0xd62c, 6},
-	{0xd62d, 3343},
-	{0xd62f, 0},
-	{0xd630, 1},
-	{0xd631, 2},
-	{0xd632, 3},
-	{0xd633, 4},
-	{0xd634, 5},
-	{0xd635, 6},
-	{0xd636, 7},
-	{0xd637, 8},
-	{0xd638, 3344},
-	{0xd639, 3345},
-	{0xd63b, 0},
-	{0xd63c, 3346},
-	{0xd63e, 0},
-	{0xd63f, 1},
-	{0xd640, 3347},
-	{0xd642, 0},
-	{0xd643, 1},
-	{0xd644, 2},
-	{0xd645, 3348},
-	{0xd647, 0},
-	{0xd648, 3349},
-	{0xd649, 3350},
-	{0xd64b, 3351},
-	{0xd64d, 3352},
-	{0xd64f, 0},
-	{0xd650, 1},
-	{0xd651, 3353},
-	{0xd653, 0},
-	{0xd654, 3354},
-	{0xd655, 3355},
-	{0xd657, 0},
-	{0xd658, 3356},
-	{0xd65a, 0},
-	{0xd65b, 1},
-	{0xd65c, 3357},
-	{0xd65e, 0},
-	{0xd65f, 1},
-	{0xd660, 2},
-	{0xd661, 3},
-	{0xd662, 4},
-	{0xd663, 5},
-	{0xd664, 6},
-	{0xd665, 7},
-	{0xd666, 8},
-	{0xd667, 3358},
-	{0xd669, 3359},
-	{0xd66b, 0},
-	{0xd66c, 1},
-	{0xd66d, 2},
-	{0xd66e, 3},
-	{0xd66f, 4},
-	{0xd670, 3360},
-	{0xd671, 3361},
-	{0xd673, 0},
-	{0xd674, 3362},
-	{0xd676, 0},
-	{0xd677, 1},
-	{0xd678, 2},
-	{0xd679, 3},
-	{0xd67a, 4},
-	{0xd67b, 5},
-	{0xd67c, 6},
-	{0xd67d, 7},
-	{0xd67e, 8},
-	{0xd67f, 9},
-	{0xd680, 10},
-	{0xd681, 11},
-	{0xd682, 12},
-	{0xd683, 3363},
-	{0xd685, 3364},
-	{0xd687, 0},
-	{0xd688, 1},
-	{0xd689, 2},
-	{0xd68a, 3},
-	{0xd68b, 4},
-	{0xd68c, 3365},
-	{0xd68d, 3366},
-	{0xd68f, 0},
-	{0xd690, 3367},
-	{0xd692, 0},
-	{0xd693, 1},
-	{0xd694, 3368},
-	{0xd696, 0},
-	{0xd697, 1},
-	{0xd698, 2},
-	{0xd699, 3},
-	{0xd69a, 4},
-	{0xd69b, 5},
-	{0xd69c, 6},
-	{0xd69d, 3369},
-	{0xd69f, 3370},
-	{0xd6a1, 3371},
-	{0xd6a3, 0},
-	{0xd6a4, 1},
-	{0xd6a5, 2},
-	{0xd6a6, 3},
-	{0xd6a7, 4},
-	{0xd6a8, 3372},
-	{0xd6aa, 0},
-	{0xd6ab, 1},
-	{0xd6ac, 3373},
-	{0xd6ae, 0},
-	{0xd6af, 1},
-	{0xd6b0, 3374},
-	{0xd6b2, 0},
-	{0xd6b3, 1},
-	{0xd6b4, 2},
-	{0xd6b5, 3},
-	{0xd6b6, 4},
-	{0xd6b7, 5},
-	{0xd6b8, 6},
-	{0xd6b9, 3375},
-	{0xd6bb, 3376},
-	{0xd6bd, 0},
-	{0xd6be, 1},
-	{0xd6bf, 2},
-	{0xd6c0, 3},
-	{0xd6c1, 4},
-	{0xd6c2, 5},
-	{0xd6c3, 6},
-	{0xd6c4, 3377},
-	{0xd6c5, 3378},
-	{0xd6c7, 0},
-	{0xd6c8, 3379},
-	{0xd6ca, 0},
-	{0xd6cb, 1},
-	{0xd6cc, 3380},
-	{0xd6ce, 0},
-	{0xd6cf, 1},
-	{0xd6d0, 2},
-	{0xd6d1, 3381},
-	{0xd6d3, 0},
-	{0xd6d4, 3382},
-	{0xd6d6, 0},
-	{0xd6d7, 3383},
-	{0xd6d9, 3384},
-	{0xd6db, 0},
-	{0xd6dc, 1},
-	{0xd6dd, 2},
-	{0xd6de, 3},
-	{0xd6df, 4},
-	{0xd6e0, 3385},
-	{0xd6e2, 0},
-	{0xd6e3, 1},
-	{0xd6e4, 3386},
-	{0xd6e6, 0},
-	{0xd6e7, 1},
-	{0xd6e8, 3387},
-	{0xd6ea, 0},
-	{0xd6eb, 1},
-	{0xd6ec, 2},
-	{0xd6ed, 3},
-	{0xd6ee, 4},
-	{0xd6ef, 5},
-	{0xd6f0, 3388},
-	{0xd6f2, 0},
-	{0xd6f3, 1},
-	{0xd6f4, 2},
-	{0xd6f5, 3389},
-	{0xd6f7, 0},
-	{0xd6f8, 1},
-	{0xd6f9, 2},
-	{0xd6fa, 3},
-	{0xd6fb, 4},
-	{0xd6fc, 3390},
-	{0xd6fd, 3391},
-	{0xd6ff, 0},
-	{0xd700, 3392},
-	{0xd702, 0},
-	{0xd703, 1},
-	{0xd704, 3393},
-	{0xd706, 0},
-	{0xd707, 1},
-	{0xd708, 2},
-	{0xd709, 3},
-	{0xd70a, 4},
-	{0xd70b, 5},
-	{0xd70c, 6},
-	{0xd70d, 7},
-	{0xd70e, 8},
-	{0xd70f, 9},
-	{0xd710, 10},
-	{0xd711, 3394},
-	{0xd713, 0},
-	{0xd714, 1},
-	{0xd715, 2},
-	{0xd716, 3},
-	{0xd717, 4},
-	{0xd718, 3395},
-	{0xd719, 3396},
-	{0xd71b, 0},
-	{0xd71c, 3397},
-	{0xd71e, 0},
-	{0xd71f, 1},
-	{0xd720, 3398},
-	{0xd722, 0},
-	{0xd723, 1},
-	{0xd724, 2},
-	{0xd725, 3},
-	{0xd726, 4},
-	{0xd727, 5},
-	{0xd728, 3399},
-	{0xd729, 3400},
-	{0xd72b, 3401},
-	{0xd72d, 3402},
-	{0xd72f, 0},
-	{0xd730, 1},
-	{0xd731, 2},
-	{0xd732, 3},
-	{0xd733, 4},
-	{0xd734, 3403},
-	{0xd735, 3404},
-	{0xd737, 0},
-	{0xd738, 3405},
-	{0xd73a, 0},
-	{0xd73b, 1},
-	{0xd73c, 3406},
-	{0xd73e, 0},
-	{0xd73f, 1},
-	{0xd740, 2},
-	{0xd741, 3},
-	{0xd742, 4},
-	{0xd743, 5},
-	{0xd744, 3407},
-	{0xd746, 0},
-	{0xd747, 3408},
-	{0xd749, 3409},
-	{0xd74b, 0},
-	{0xd74c, 1},
-	{0xd74d, 2},
-	{0xd74e, 3},
-	{0xd74f, 4},
-	{0xd750, 3410},
-	{0xd751, 3411},
-	{0xd753, 0},
-	{0xd754, 3412},
-	{0xd756, 3413},
-	{0xd757, 3414},
-	{0xd758, 3415},
-	{0xd759, 3416},
-	{0xd75b, 0},
-	{0xd75c, 1},
-	{0xd75d, 2},
-	{0xd75e, 3},
-	{0xd75f, 4},
-	{0xd760, 3417},
-	{0xd761, 3418},
-	{0xd763, 3419},
-	{0xd765, 3420},
-	{0xd767, 0},
-	{0xd768, 1},
-	{0xd769, 3421},
-	{0xd76b, 0},
-	{0xd76c, 3422},
-	{0xd76e, 0},
-	{0xd76f, 1},
-	{0xd770, 3423},
-	{0xd772, 0},
-	{0xd773, 1},
-	{0xd774, 3424},
-	{0xd776, 0},
-	{0xd777, 1},
-	{0xd778, 2},
-	{0xd779, 3},
-	{0xd77a, 4},
-	{0xd77b, 5},
-	{0xd77c, 3425},
-	{0xd77d, 3426},
-	{0xd77f, 0},
-	{0xd780, 1},
-	{0xd781, 3427},
-	{0xd783, 0},
-	{0xd784, 1},
-	{0xd785, 2},
-	{0xd786, 3},
-	{0xd787, 4},
-	{0xd788, 3428},
-	{0xd789, 3429},
-	{0xd78b, 0},
-	{0xd78c, 3430},
-	{0xd78e, 0},
-	{0xd78f, 1},
-	{0xd790, 3431},
-	{0xd792, 0},
-	{0xd793, 1},
-	{0xd794, 2},
-	{0xd795, 3},
-	{0xd796, 4},
-	{0xd797, 5},
-	{0xd798, 3432},
-	{0xd799, 3433},
-	{0xd79b, 3434},
-	{0xd79d, 3435},
-	{0xd79f, 0},
-	{0xd7a0, 1},
-	{0xd7a1, 2},
-	{0xd7a2, 3},
-	{0xd7a3, 4},
-	{0xf900, 4116},
-	{0xf901, 3678},
-	{0xf902, 7053},
-	{0xf903, 3460},
-	{0xf904, 7900},
-	{0xf905, 3802},
-	{0xf906, 3902},
-	{0xf907, 3946},
-	{0xf908, 3946},
-	{0xf909, 3708},
-	{0xf90a, 4131},
-	{0xf90b, 4374},
-	{0xf90c, 4156},
-	{0xf90d, 4375},
-	{0xf90e, 4376},
-	{0xf90f, 4377},
-	{0xf910, 4378},
-	{0xf911, 4379},
-	{0xf912, 4380},
-	{0xf913, 4381},
-	{0xf914, 5800},
-	{0xf915, 4382},
-	{0xf916, 4383},
-	{0xf917, 4384},
-	{0xf918, 4386},
-	{0xf919, 4387},
-	{0xf91a, 4388},
-	{0xf91b, 4389},
-	{0xf91c, 4390},
-	{0xf91d, 4391},
-	{0xf91e, 4394},
-	{0xf91f, 4395},
-	{0xf920, 4396},
-	{0xf921, 4399},
-	{0xf922, 4403},
-	{0xf923, 4406},
-	{0xf924, 4407},
-	{0xf925, 4409},
-	{0xf926, 4410},
-	{0xf927, 4411},
-	{0xf928, 4412},
-	{0xf929, 4413},
-	{0xf92a, 4414},
-	{0xf92b, 4415},
-	{0xf92c, 4419},
-	{0xf92d, 4420},
-	{0xf92e, 4424},
-	{0xf92f, 4511},
-	{0xf930, 4513},
-	{0xf931, 4514},
-	{0xf932, 4517},
-	{0xf933, 4518},
-	{0xf934, 4519},
-	{0xf935, 4520},
-	{0xf936, 4521},
-	{0xf937, 4522},
-	{0xf938, 4524},
-	{0xf939, 4525},
-	{0xf93a, 4526},
-	{0xf93b, 4528},
-	{0xf93c, 4529},
-	{0xf93d, 4530},
-	{0xf93e, 4531},
-	{0xf93f, 4532},
-	{0xf940, 4533},
-	{0xf941, 4535},
-	{0xf942, 4536},
-	{0xf943, 4537},
-	{0xf944, 4541},
-	{0xf945, 4542},
-	{0xf946, 4545},
-	{0xf947, 4546},
-	{0xf948, 4547},
-	{0xf949, 4550},
-	{0xf94a, 4564},
-	{0xf94b, 4566},
-	{0xf94c, 4567},
-	{0xf94d, 4568},
-	{0xf94e, 4569},
-	{0xf94f, 4571},
-	{0xf950, 4572},
-	{0xf951, 4576},
-	{0xf952, 4604},
-	{0xf953, 4605},
-	{0xf954, 4606},
-	{0xf955, 4607},
-	{0xf956, 4609},
-	{0xf957, 4610},
-	{0xf958, 4611},
-	{0xf959, 4612},
-	{0xf95a, 4318},
-	{0xf95b, 4136},
-	{0xf95c, 5800},
-	{0xf95d, 4139},
-	{0xf95e, 4192},
-	{0xf95f, 4167},
-	{0xf960, 4172},
-	{0xf961, 5552},
-	{0xf962, 6424},
-	{0xf963, 5151},
-	{0xf964, 4922},
-	{0xf965, 7518},
-	{0xf966, 5079},
-	{0xf967, 5109},
-	{0xf968, 7607},
-	{0xf969, 5584},
-	{0xf96a, 5367},
-	{0xf96b, 7083},
-	{0xf96c, 5362},
-	{0xf96d, 5485},
-	{0xf96e, 6001},
-	{0xf96f, 5460},
-	{0xf970, 5317},
-	{0xf971, 7009},
-	{0xf972, 7370},
-	{0xf973, 5678},
-	{0xf974, 5874},
-	{0xf975, 4425},
-	{0xf976, 4426},
-	{0xf977, 4427},
-	{0xf978, 4429},
-	{0xf979, 4430},
-	{0xf97a, 4431},
-	{0xf97b, 4435},
-	{0xf97c, 4436},
-	{0xf97d, 4437},
-	{0xf97e, 4439},
-	{0xf97f, 4442},
-	{0xf980, 4443},
-	{0xf981, 4159},
-	{0xf982, 4444},
-	{0xf983, 4447},
-	{0xf984, 4449},
-	{0xf985, 4450},
-	{0xf986, 4453},
-	{0xf987, 4455},
-	{0xf988, 4456},
-	{0xf989, 4457},
-	{0xf98a, 4458},
-	{0xf98b, 4459},
-	{0xf98c, 4460},
-	{0xf98d, 4463},
-	{0xf98e, 4160},
-	{0xf98f, 4465},
-	{0xf990, 4466},
-	{0xf991, 4161},
-	{0xf992, 4468},
-	{0xf993, 4469},
-	{0xf994, 4470},
-	{0xf995, 4162},
-	{0xf996, 4471},
-	{0xf997, 4472},
-	{0xf998, 4474},
-	{0xf999, 4473},
-	{0xf99a, 4475},
-	{0xf99b, 4476},
-	{0xf99c, 4478},
-	{0xf99d, 4479},
-	{0xf99e, 6447},
-	{0xf99f, 4481},
-	{0xf9a0, 4482},
-	{0xf9a1, 5460},
-	{0xf9a2, 4483},
-	{0xf9a3, 4163},
-	{0xf9a4, 4166},
-	{0xf9a5, 4485},
-	{0xf9a6, 4487},
-	{0xf9a7, 4488},
-	{0xf9a8, 4489},
-	{0xf9a9, 4491},
-	{0xf9aa, 4167},
-	{0xf9ab, 4493},
-	{0xf9ac, 4494},
-	{0xf9ad, 4495},
-	{0xf9ae, 7783},
-	{0xf9af, 4497},
-	{0xf9b0, 4499},
-	{0xf9b1, 4501},
-	{0xf9b2, 4502},
-	{0xf9b3, 4503},
-	{0xf9b4, 4504},
-	{0xf9b5, 4506},
-	{0xf9b6, 4508},
-	{0xf9b7, 4509},
-	{0xf9b8, 4510},
-	{0xf9b9, 5797},
-	{0xf9ba, 4551},
-	{0xf9bb, 4552},
-	{0xf9bc, 4553},
-	{0xf9bd, 4180},
-	{0xf9be, 4555},
-	{0xf9bf, 5800},
-	{0xf9c0, 4556},
-	{0xf9c1, 4557},
-	{0xf9c2, 4560},
-	{0xf9c3, 4561},
-	{0xf9c4, 4563},
-	{0xf9c5, 7988},
-	{0xf9c6, 6123},
-	{0xf9c7, 4577},
-	{0xf9c8, 4183},
-	{0xf9c9, 4579},
-	{0xf9ca, 4581},
-	{0xf9cb, 4582},
-	{0xf9cc, 4584},
-	{0xf9cd, 4586},
-	{0xf9ce, 4588},
-	{0xf9cf, 4184},
-	{0xf9d0, 4590},
-	{0xf9d1, 4591},
-	{0xf9d2, 4592},
-	{0xf9d3, 4593},
-	{0xf9d4, 4595},
-	{0xf9d5, 4596},
-	{0xf9d6, 4597},
-	{0xf9d7, 4599},
-	{0xf9d8, 4600},
-	{0xf9d9, 4601},
-	{0xf9da, 4602},
-	{0xf9db, 5552},
-	{0xf9dc, 4603},
-	{0xf9dd, 4614},
-	{0xf9de, 4616},
-	{0xf9df, 4618},
-	{0xf9e0, 5950},
-	{0xf9e1, 4620},
-	{0xf9e2, 4621},
-	{0xf9e3, 4187},
-	{0xf9e4, 4625},
-	{0xf9e5, 4627},
-	{0xf9e6, 4629},
-	{0xf9e7, 4632},
-	{0xf9e8, 4633},
-	{0xf9e9, 4634},
-	{0xf9ea, 4636},
-	{0xf9eb, 4188},
-	{0xf9ec, 4189},
-	{0xf9ed, 4638},
-	{0xf9ee, 4640},
-	{0xf9ef, 4641},
-	{0xf9f0, 4642},
-	{0xf9f1, 4644},
-	{0xf9f2, 4645},
-	{0xf9f3, 4646},
-	{0xf9f4, 4647},
-	{0xf9f5, 4648},
-	{0xf9f6, 4650},
-	{0xf9f7, 4653},
-	{0xf9f8, 4654},
-	{0xf9f9, 4655},
-	{0xf9fa, 5351},
-	{0xf9fb, 6494},
-	{0xf9fc, 5731},
-	{0xf9fd, 5771},
-	{0xf9fe, 4191},
-	{0xf9ff, 6484},
-	{0xfa00, 6684},
-	{0xfa01, 4279},
-	{0xfa02, 7139},
-	{0xfa03, 4247},
-	{0xfa04, 4266},
-	{0xfa05, 4340},
-	{0xfa06, 7572},
-	{0xfa07, 5088},
-	{0xfa08, 7709},
-	{0xfa09, 3558},
-	{0xfa0a, 3644},
-	{0xfa0b, 3815},
-	{0xff01, 264},
-	{0xff02, 265},
-	{0xff03, 266},
-	{0xff04, 267},
-	{0xff05, 268},
-	{0xff06, 269},
-	{0xff07, 270},
-	{0xff08, 271},
-	{0xff09, 272},
-	{0xff0a, 273},
-	{0xff0b, 274},
-	{0xff0c, 275},
-	{0xff0d, 276},
-	{0xff0e, 277},
-	{0xff0f, 278},
-	{0xff10, 279},
-	{0xff11, 280},
-	{0xff12, 281},
-	{0xff13, 282},
-	{0xff14, 283},
-	{0xff15, 284},
-	{0xff16, 285},
-	{0xff17, 286},
-	{0xff18, 287},
-	{0xff19, 288},
-	{0xff1a, 289},
-	{0xff1b, 290},
-	{0xff1c, 291},
-	{0xff1d, 292},
-	{0xff1e, 293},
-	{0xff1f, 294},
-	{0xff20, 295},
-	{0xff21, 296},
-	{0xff22, 297},
-	{0xff23, 298},
-	{0xff24, 299},
-	{0xff25, 300},
-	{0xff26, 301},
-	{0xff27, 302},
-	{0xff28, 303},
-	{0xff29, 304},
-	{0xff2a, 305},
-	{0xff2b, 306},
-	{0xff2c, 307},
-	{0xff2d, 308},
-	{0xff2e, 309},
-	{0xff2f, 310},
-	{0xff30, 311},
-	{0xff31, 312},
-	{0xff32, 313},
-	{0xff33, 314},
-	{0xff34, 315},
-	{0xff35, 316},
-	{0xff36, 317},
-	{0xff37, 318},
-	{0xff38, 319},
-	{0xff39, 320},
-	{0xff3a, 321},
-	{0xff3b, 322},
-	{0xff3c, 112},
-	{0xff3d, 324},
-	{0xff3e, 325},
-	{0xff3f, 326},
-	{0xff40, 327},
-	{0xff41, 328},
-	{0xff42, 329},
-	{0xff43, 330},
-	{0xff44, 331},
-	{0xff45, 332},
-	{0xff46, 333},
-	{0xff47, 334},
-	{0xff48, 335},
-	{0xff49, 336},
-	{0xff4a, 337},
-	{0xff4b, 338},
-	{0xff4c, 339},
-	{0xff4d, 340},
-	{0xff4e, 341},
-	{0xff4f, 342},
-	{0xff50, 343},
-	{0xff51, 344},
-	{0xff52, 345},
-	{0xff53, 346},
-	{0xff54, 347},
-	{0xff55, 348},
-	{0xff56, 349},
-	{0xff57, 350},
-	{0xff58, 351},
-	{0xff59, 352},
-	{0xff5a, 353},
-	{0xff5b, 354},
-	{0xff5c, 355},
-	{0xff5d, 356},
-	{0xff5e, 113},
-	{0xffe0, 143},
-	{0xffe1, 144},
-	{0xffe2, 194},
-	{0xffe3, 357},
-	{0xffe5, 145},
-	{0xffe6, 323}};
-
+// Coverage of the korean character collection: bit (u % 8) of byte
+// u / 8 is set if the Unicode code point u has a CID (15845 code points).
+static const uint8 korean[8192] = {
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	0x00, 0x00, 0x00, 0x00, 0x92, 0x0d, 0x5f, 0xff, 0x40, 0x00, 0x81, 0xc1, 0x40, 0x00, 0x81, 0x41,
+	0x00, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x0e, 0x81, 0x07, 0x0e, 0x0c, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfe, 0xff, 0xfb, 0x03, 0xfe, 0xff, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x58, 0xbb, 0x67, 0x00, 0x7d, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x02, 0x48, 0x00, 0x46, 0x08, 0x00, 0x00, 0x00, 0x00, 0x18, 0x78, 0xff, 0x03, 0xff, 0x03,
+	0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x1f, 0x10, 0x31, 0xa0, 0x1f, 0x00, 0xcf, 0x03, 0x00, 0x00,
+	0xcd, 0x9b, 0x0a, 0xe4, 0xe5, 0x5f, 0xf0, 0x20, 0x28, 0x01, 0x0f, 0x04, 0xf7, 0xc0, 0xcf, 0x0e,
+	0xff, 0x0c, 0xe0, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xc0, 0x00, 0x0c, 0x00, 0xc0, 0x00, 0x00,
+	0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00,
+	0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0xfb, 0x03, 0xee, 0xb2, 0xcb, 0xdf, 0x03, 0x00, 0x40, 0x80, 0x00, 0x00,
+	0x60, 0xc0, 0x00, 0xf0, 0x00, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xbb, 0xb7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0xff,
+	0x00, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0xff, 0xff, 0xc3, 0x01, 0x00, 0x40, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x0f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8f,
+	0x00, 0xfc, 0x11, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x49, 0x39, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8b, 0x2f, 0x72, 0x43, 0x00, 0x20, 0x04, 0x0b, 0x2c, 0xe8, 0x40, 0xe3, 0x00, 0x28, 0xc8, 0x40,
+	0x44, 0x59, 0x37, 0x49, 0x76, 0x79, 0x40, 0x04, 0x93, 0x2c, 0xf0, 0xa3, 0x38, 0x00, 0xc5, 0x08,
+	0x02, 0xee, 0x03, 0x00, 0x00, 0x80, 0x50, 0x35, 0xc8, 0xe1, 0x23, 0x1e, 0x00, 0x82, 0x49, 0xc4,
+	0x5a, 0xad, 0x42, 0x29, 0x00, 0xc0, 0x60, 0x80, 0x1c, 0x46, 0x9a, 0xa4, 0x03, 0xc0, 0x2a, 0x05,
+	0x44, 0x2a, 0x46, 0xd6, 0xda, 0x3d, 0x00, 0x08, 0x88, 0x83, 0x20, 0x14, 0x20, 0x00, 0x70, 0x01,
+	0x21, 0x20, 0x02, 0x03, 0x00, 0x30, 0xac, 0x40, 0x20, 0x86, 0x62, 0x44, 0xa0, 0x20, 0x00, 0x8a,
+	0x53, 0x02, 0x04, 0x80, 0x02, 0x04, 0x84, 0x14, 0xfb, 0x7b, 0x04, 0x10, 0xa4, 0x7f, 0xe2, 0x11,
+	0x41, 0x24, 0xa4, 0x00, 0x21, 0x14, 0xc0, 0x20, 0x50, 0x3a, 0x00, 0x70, 0x02, 0x00, 0x43, 0x27,
+	0xc9, 0x45, 0x82, 0x20, 0x30, 0x46, 0xc1, 0x0f, 0x88, 0x3c, 0x50, 0x28, 0x02, 0x86, 0x24, 0xa0,
+	0x88, 0x23, 0x06, 0x88, 0x19, 0x0e, 0x00, 0x40, 0xaa, 0x22, 0x64, 0xeb, 0x1c, 0x00, 0x28, 0xcd,
+	0x20, 0xa1, 0xe1, 0x02, 0x0b, 0x84, 0x00, 0x82, 0x9b, 0x27, 0x9e, 0x54, 0x41, 0x81, 0xb3, 0xa0,
+	0x10, 0x00, 0x08, 0x85, 0x61, 0x20, 0x00, 0x08, 0x08, 0x2f, 0xd0, 0x08, 0x3e, 0xbe, 0x0f, 0x01,
+	0x18, 0xf7, 0x03, 0xa8, 0x41, 0x0a, 0x08, 0x5b, 0x04, 0x05, 0x02, 0x00, 0x00, 0x05, 0x2a, 0x38,
+	0x41, 0x50, 0x01, 0x00, 0x10, 0x19, 0x08, 0x21, 0x13, 0x03, 0x00, 0x00, 0x22, 0x61, 0x04, 0x04,
+	0xd0, 0x40, 0x01, 0x10, 0x00, 0x80, 0x22, 0x40, 0x50, 0x80, 0x48, 0x40, 0x08, 0x00, 0x00, 0x10,
+	0xd1, 0x06, 0x00, 0x37, 0x80, 0x5e, 0x00, 0x00, 0xa0, 0x00, 0x10, 0x94, 0x18, 0x00, 0x00, 0x60,
+	0x40, 0x02, 0x90, 0x00, 0x00, 0x80, 0x54, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x09, 0x10, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x20, 0x50, 0x10, 0x10, 0x00, 0x24, 0x02, 0x4c, 0x01, 0x00, 0x01, 0x06,
+	0x18, 0x29, 0x4c, 0x81, 0x00, 0x21, 0x01, 0x08, 0x85, 0x64, 0x03, 0x00, 0x52, 0x44, 0x21, 0x10,
+	0x04, 0x09, 0x08, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x88, 0x49, 0x00, 0x80, 0x01, 0x00, 0x91, 0x16,
+	0x65, 0x07, 0x00, 0x40, 0x92, 0x84, 0x33, 0x04, 0x00, 0x8c, 0x92, 0x45, 0x16, 0x00, 0x20, 0x52,
+	0x28, 0x02, 0x08, 0xd0, 0x00, 0x43, 0x08, 0x4c, 0xa2, 0x40, 0x2a, 0xc3, 0x10, 0x98, 0x00, 0x2e,
+	0x00, 0x80, 0x70, 0x16, 0x84, 0x6e, 0x82, 0x40, 0x90, 0xc3, 0xb3, 0x04, 0x85, 0x7c, 0x18, 0x21,
+	0x1c, 0x04, 0xc8, 0x02, 0x20, 0x11, 0x00, 0x4a, 0x48, 0x0a, 0x1b, 0x36, 0x40, 0x55, 0x00, 0x89,
+	0x0a, 0x00, 0x02, 0x99, 0x21, 0x02, 0x40, 0x10, 0x42, 0x02, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x16, 0x12, 0x00, 0x00, 0x42, 0x02, 0x00, 0x00,
+	0x20, 0x1a, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x09, 0x00, 0xb3, 0xb5, 0x18, 0x0a, 0x23, 0x15,
+	0xa0, 0x9b, 0xe8, 0x1f, 0x7c, 0x50, 0x79, 0x83, 0xfd, 0x10, 0x9d, 0xc0, 0xf6, 0xdb, 0x60, 0x05,
+	0x92, 0xef, 0x42, 0x02, 0x10, 0x01, 0x02, 0xdf, 0x61, 0x69, 0x22, 0x08, 0x35, 0x90, 0x02, 0x02,
+	0x00, 0x00, 0x03, 0x00, 0x02, 0x1a, 0xaa, 0x45, 0x01, 0x00, 0x00, 0x02, 0x01, 0x81, 0x51, 0x28,
+	0x80, 0x60, 0xd2, 0x02, 0x80, 0x02, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x92, 0x00, 0x00,
+	0x80, 0x08, 0x00, 0x20, 0x05, 0x04, 0x00, 0x35, 0x00, 0x20, 0x44, 0x60, 0xe6, 0x49, 0x9e, 0x60,
+	0x4c, 0x10, 0x42, 0x2a, 0x20, 0x28, 0x48, 0xa1, 0xb1, 0x10, 0x20, 0x80, 0x0e, 0x00, 0x9c, 0x7b,
+	0x90, 0x84, 0xa0, 0x14, 0xc1, 0x28, 0xe0, 0x41, 0x04, 0x07, 0x49, 0x8c, 0x0d, 0x10, 0xc8, 0x0c,
+	0x12, 0x84, 0xba, 0x89, 0xc0, 0x02, 0x22, 0x14, 0x00, 0x55, 0xc0, 0x0a, 0xc4, 0x3e, 0x83, 0x92,
+	0xa3, 0x1c, 0x87, 0x43, 0x03, 0x47, 0xa0, 0x22, 0x28, 0x30, 0xc0, 0x03, 0x01, 0x08, 0x20, 0xa0,
+	0x00, 0x80, 0x44, 0x30, 0xa3, 0x85, 0x00, 0x00, 0x0e, 0x20, 0x25, 0x22, 0x3c, 0xb7, 0x01, 0x00,
+	0x20, 0x32, 0x50, 0x8c, 0x99, 0x00, 0x5d, 0x31, 0xa0, 0x00, 0x02, 0x94, 0x03, 0x00, 0x4b, 0x0e,
+	0x42, 0xe3, 0x20, 0x8c, 0x80, 0x00, 0x91, 0xd0, 0x94, 0x1d, 0x28, 0xa3, 0x9c, 0x49, 0xc1, 0x60,
+	0x06, 0x44, 0x13, 0x07, 0x90, 0x5a, 0x44, 0x44, 0x88, 0x0f, 0x00, 0x00, 0x40, 0x00, 0xc4, 0x95,
+	0x81, 0x75, 0x47, 0x84, 0x02, 0x44, 0x53, 0xc0, 0x83, 0x2b, 0x08, 0x01, 0x00, 0x40, 0x42, 0x92,
+	0x11, 0x06, 0xa6, 0x09, 0x00, 0x08, 0x22, 0x32, 0x84, 0xb3, 0xdd, 0x1b, 0x00, 0xf0, 0x8a, 0xc0,
+	0x82, 0x02, 0x02, 0x00, 0x00, 0x88, 0x00, 0x6c, 0x00, 0x92, 0x21, 0x00, 0x80, 0x41, 0x84, 0x8c,
+	0x08, 0x13, 0x44, 0x09, 0xa7, 0x07, 0x00, 0x00, 0x51, 0x80, 0x41, 0x0c, 0x02, 0x60, 0xd0, 0x00,
+	0x00, 0xa0, 0xd0, 0x10, 0x04, 0x30, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x01, 0x82, 0x00, 0x07,
+	0x00, 0x01, 0x0e, 0x44, 0x30, 0x68, 0x05, 0x08, 0xb2, 0x64, 0x14, 0x05, 0xe6, 0x10, 0x14, 0x44,
+	0x11, 0x00, 0x00, 0x21, 0x08, 0x9c, 0xc0, 0xcb, 0x20, 0xe1, 0xc2, 0x40, 0x4c, 0x30, 0xb4, 0x41,
+	0xac, 0x10, 0x83, 0x9a, 0xb2, 0x98, 0x81, 0x32, 0x22, 0x98, 0x84, 0x00, 0x69, 0x33, 0x12, 0xbc,
+	0xc0, 0xd6, 0x3b, 0xc0, 0xa1, 0xa1, 0x53, 0x0c, 0x1e, 0x8a, 0x00, 0xea, 0xf0, 0xcb, 0xd8, 0x05,
+	0x90, 0x43, 0xc3, 0x21, 0x05, 0x48, 0x1c, 0x4a, 0xd0, 0x02, 0x40, 0x32, 0x41, 0x00, 0x9d, 0xd7,
+	0x09, 0x2b, 0xb0, 0xe8, 0xc0, 0x7d, 0x52, 0x24, 0x40, 0xc2, 0x4b, 0xd0, 0x00, 0xa0, 0xab, 0xc8,
+	0x80, 0x8a, 0xa9, 0x34, 0x00, 0x80, 0xc9, 0x41, 0x10, 0x80, 0x1f, 0x24, 0x00, 0x92, 0x7b, 0x48,
+	0x00, 0x00, 0xcc, 0x00, 0x06, 0x84, 0x00, 0x33, 0x0f, 0x41, 0x1b, 0x00, 0x00, 0x20, 0x40, 0x80,
+	0x22, 0x80, 0x98, 0xa0, 0x86, 0xa1, 0x6b, 0x00, 0x30, 0x2a, 0xa4, 0x85, 0x81, 0x41, 0x04, 0x06,
+	0x21, 0x60, 0x04, 0x00, 0x80, 0x00, 0x01, 0xa0, 0x00, 0x04, 0xb8, 0x46, 0x0f, 0xe9, 0xa0, 0x03,
+	0x00, 0x00, 0x20, 0x18, 0xa0, 0x40, 0x10, 0x08, 0x0a, 0x38, 0x01, 0x00, 0x00, 0x05, 0x00, 0xa8,
+	0x04, 0x04, 0x8a, 0xc2, 0x0a, 0x00, 0x20, 0x27, 0x10, 0x09, 0x0c, 0x83, 0x02, 0x08, 0x00, 0x00,
+	0x11, 0x62, 0x80, 0x10, 0x0c, 0x00, 0x08, 0x08, 0x0c, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x40, 0x08,
+	0x10, 0x14, 0x44, 0x00, 0x0b, 0x00, 0x04, 0x64, 0xc0, 0x50, 0x01, 0x80, 0x7e, 0x04, 0x84, 0x89,
+	0x58, 0x06, 0x40, 0x41, 0x00, 0xc0, 0xa4, 0x94, 0x62, 0xa8, 0xdc, 0x09, 0x00, 0x18, 0x00, 0x00,
+	0x00, 0x81, 0x0a, 0x00, 0x08, 0x00, 0x90, 0x41, 0x07, 0x40, 0xa1, 0xe4, 0x01, 0x25, 0x45, 0x64,
+	0xee, 0x11, 0x7d, 0x0e, 0x00, 0x48, 0x08, 0xfb, 0x16, 0x16, 0xa8, 0x08, 0x2e, 0xc9, 0x09, 0x00,
+	0x00, 0x18, 0x82, 0x4a, 0xa0, 0x06, 0x64, 0x6b, 0x02, 0x00, 0x00, 0x16, 0x48, 0x56, 0x90, 0x83,
+	0xa0, 0x73, 0x2a, 0x00, 0x00, 0x80, 0x24, 0x00, 0xf9, 0x88, 0x02, 0x47, 0x02, 0x4d, 0xaa, 0x0f,
+	0x00, 0x00, 0x80, 0x8e, 0x7b, 0xb8, 0x54, 0x75, 0x18, 0x24, 0x40, 0xd9, 0x80, 0xc8, 0x0c, 0x04,
+	0x00, 0x00, 0x41, 0xb0, 0x24, 0x8c, 0x42, 0x04, 0x34, 0x5a, 0x1a, 0x00, 0x00, 0x80, 0x10, 0xc1,
+	0x46, 0x80, 0x32, 0x00, 0x0d, 0x18, 0x06, 0x81, 0x02, 0x00, 0x92, 0xcd, 0x14, 0x60, 0x01, 0x74,
+	0x12, 0x61, 0x91, 0x00, 0x98, 0xc0, 0x0a, 0x42, 0x0f, 0x04, 0x20, 0x84, 0x13, 0x9a, 0x02, 0x40,
+	0x62, 0x8a, 0x22, 0xfd, 0x88, 0x81, 0x80, 0x40, 0x00, 0x10, 0x03, 0x21, 0x08, 0x08, 0x01, 0x31,
+	0x20, 0x44, 0x04, 0x07, 0x12, 0xb8, 0x88, 0x03, 0x00, 0x89, 0x00, 0xa3, 0x00, 0x00, 0x02, 0x22,
+	0x10, 0x12, 0x00, 0x46, 0x42, 0x00, 0x41, 0x00, 0x80, 0x56, 0x41, 0x52, 0xf0, 0x52, 0x00, 0x20,
+	0x10, 0x86, 0x14, 0x82, 0x04, 0x10, 0x02, 0x46, 0x0a, 0x43, 0x35, 0x80, 0xe0, 0x60, 0x00, 0xd8,
+	0x41, 0x00, 0x01, 0x08, 0x00, 0x34, 0x65, 0x6c, 0xc1, 0x11, 0x04, 0xab, 0x86, 0x02, 0x04, 0x22,
+	0x03, 0x00, 0x00, 0x00, 0x84, 0x90, 0x00, 0x00, 0x15, 0x40, 0x81, 0x02, 0x02, 0x02, 0x00, 0x33,
+	0x00, 0x04, 0x40, 0x38, 0x20, 0x0e, 0xc0, 0xc0, 0x30, 0x00, 0x85, 0x00, 0x00, 0x05, 0x25, 0x0d,
+	0xd0, 0x4a, 0xd0, 0x81, 0x80, 0x22, 0x0c, 0x02, 0x05, 0xb6, 0x40, 0x62, 0x79, 0x26, 0x80, 0x62,
+	0xea, 0x02, 0x08, 0x08, 0x67, 0xdd, 0x79, 0x85, 0x1b, 0x08, 0xa0, 0xde, 0x35, 0x87, 0x00, 0x40,
+	0x8c, 0x0a, 0x00, 0xd1, 0xaa, 0x05, 0x25, 0xa2, 0x40, 0x84, 0x10, 0x15, 0x4d, 0x40, 0x80, 0x00,
+	0x12, 0x00, 0x22, 0x8d, 0x68, 0x19, 0x8f, 0x05, 0x80, 0x90, 0x1a, 0x3a, 0x64, 0x84, 0x61, 0x85,
+	0xc0, 0xcc, 0x02, 0x20, 0x20, 0x08, 0x2e, 0x73, 0xa4, 0x20, 0x34, 0x0b, 0x04, 0x00, 0x15, 0x14,
+	0x01, 0x20, 0x00, 0x82, 0x57, 0x00, 0x00, 0x08, 0x04, 0x50, 0x44, 0x00, 0x12, 0x12, 0x05, 0x79,
+	0xd0, 0x40, 0x09, 0x00, 0x00, 0x40, 0x00, 0x84, 0x4c, 0x05, 0x44, 0xd8, 0x9a, 0x40, 0x14, 0x51,
+	0x12, 0x0b, 0x00, 0x40, 0x01, 0x02, 0x80, 0x15, 0x01, 0x20, 0x00, 0x08, 0x4a, 0x08, 0x00, 0xc2,
+	0x00, 0x08, 0x02, 0x40, 0x20, 0x30, 0x09, 0x98, 0x00, 0x00, 0x80, 0x18, 0x2c, 0xe2, 0x08, 0x00,
+	0x04, 0x00, 0x04, 0x00, 0xe0, 0x10, 0x14, 0x00, 0x20, 0x80, 0x00, 0x20, 0x00, 0x98, 0x00, 0x10,
+	0x82, 0x70, 0x82, 0x00, 0x88, 0x02, 0x00, 0x1c, 0x22, 0x4c, 0x01, 0x00, 0x00, 0x91, 0x20, 0x08,
+	0x02, 0x40, 0x40, 0x00, 0x00, 0x1c, 0x00, 0x44, 0x83, 0x03, 0xc1, 0x7c, 0x21, 0x21, 0x00, 0x84,
+	0x02, 0xe0, 0x02, 0x00, 0xc0, 0x44, 0x0a, 0xe2, 0x03, 0x0e, 0x26, 0x81, 0xd0, 0x02, 0x00, 0x08,
+	0x21, 0x29, 0x90, 0x96, 0x01, 0x40, 0xc2, 0xb8, 0x41, 0x62, 0x80, 0x00, 0x06, 0x0a, 0x51, 0xa6,
+	0x12, 0x01, 0x2c, 0x81, 0x00, 0xc6, 0x00, 0x04, 0xb0, 0x0c, 0x80, 0xa2, 0x29, 0xa4, 0x40, 0x86,
+	0x00, 0x80, 0x02, 0x4a, 0x41, 0x30, 0x00, 0x02, 0x40, 0xba, 0x57, 0x00, 0x01, 0x50, 0x20, 0x20,
+	0x80, 0x88, 0xb0, 0x24, 0x02, 0x20, 0x12, 0x01, 0xd3, 0x02, 0x04, 0x00, 0x11, 0x02, 0x00, 0x00,
+	0x80, 0x00, 0x04, 0x40, 0x82, 0x0c, 0x00, 0xe0, 0x08, 0x30, 0x00, 0x00, 0x11, 0x10, 0x08, 0x00,
+	0x08, 0x02, 0xa4, 0x81, 0xa0, 0x40, 0x0e, 0x42, 0x00, 0x04, 0x40, 0xc0, 0x81, 0x00, 0x00, 0x48,
+	0xf5, 0x2d, 0x91, 0x0f, 0x07, 0xd8, 0x29, 0x06, 0x7c, 0x00, 0x01, 0x40, 0x46, 0x45, 0x4e, 0x82,
+	0x00, 0xc0, 0x08, 0x10, 0x05, 0x30, 0x36, 0xed, 0x80, 0x0c, 0x40, 0x65, 0x0b, 0x93, 0x10, 0x08,
+	0x00, 0x06, 0x20, 0xe8, 0x0a, 0xc8, 0x82, 0x60, 0xca, 0x00, 0x34, 0x40, 0x02, 0x2e, 0x01, 0x12,
+	0x04, 0x90, 0x48, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x10, 0x31, 0x00, 0x00, 0x4c, 0xa5, 0x02,
+	0x20, 0x55, 0x10, 0x44, 0x10, 0x03, 0x04, 0x23, 0x22, 0x54, 0x34, 0x80, 0x03, 0x0a, 0x01, 0x12,
+	0x6b, 0x12, 0xa1, 0x01, 0x00, 0x20, 0x48, 0xa0, 0x48, 0x04, 0x40, 0x45, 0x00, 0x80, 0x8d, 0xe0,
+	0xf0, 0x1a, 0x40, 0x28, 0x26, 0x86, 0x16, 0x04, 0x18, 0x50, 0x00, 0x4c, 0x32, 0x00, 0x12, 0x21,
+	0xe4, 0x05, 0x00, 0x0d, 0x08, 0x8a, 0x00, 0x42, 0x00, 0x48, 0x33, 0x00, 0x60, 0x08, 0x03, 0x87,
+	0x01, 0x85, 0x00, 0x34, 0x09, 0x01, 0x28, 0xe4, 0x45, 0x20, 0x00, 0x81, 0xa8, 0x25, 0x18, 0x5c,
+	0xa0, 0x35, 0x04, 0xd8, 0x02, 0x1c, 0xe0, 0x02, 0xa1, 0x00, 0x00, 0x02, 0x50, 0xc0, 0x46, 0x41,
+	0x00, 0x68, 0x04, 0xa6, 0x60, 0xf2, 0x8a, 0xbb, 0x00, 0x00, 0xb6, 0xc8, 0xe2, 0x00, 0x02, 0x60,
+	0x3e, 0x02, 0x80, 0x00, 0x00, 0x89, 0x72, 0x03, 0x81, 0x86, 0x06, 0x00, 0x00, 0x00, 0x88, 0x08,
+	0x00, 0x46, 0x40, 0x41, 0x04, 0x0e, 0x00, 0x20, 0x22, 0x16, 0x48, 0x10, 0x00, 0x8a, 0x17, 0x22,
+	0x18, 0x74, 0x00, 0x00, 0x00, 0x12, 0x02, 0x21, 0x00, 0x02, 0x80, 0x08, 0x4a, 0x98, 0x20, 0x04,
+	0x00, 0x00, 0x11, 0x12, 0x02, 0x00, 0x04, 0x99, 0x55, 0x2a, 0x02, 0x04, 0x00, 0x50, 0x10, 0x10,
+	0x00, 0x00, 0x9a, 0x45, 0x2a, 0xb0, 0x00, 0xa0, 0x0a, 0x42, 0x08, 0x02, 0x08, 0x27, 0x00, 0x00,
+	0x90, 0x80, 0x12, 0x08, 0x40, 0x87, 0x01, 0x04, 0x02, 0xe2, 0x20, 0x30, 0x30, 0x06, 0x80, 0x8c,
+	0xc4, 0x04, 0xc0, 0x04, 0x00, 0x20, 0x00, 0x80, 0x00, 0x40, 0x31, 0xd8, 0x80, 0x00, 0x00, 0x02,
+	0x00, 0x14, 0x08, 0x00, 0x18, 0x02, 0x00, 0x00, 0x80, 0x08, 0x10, 0x8a, 0x10, 0x20, 0x00, 0x40,
+	0x0d, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa0, 0x80, 0x40, 0x01, 0x50, 0x01,
+	0x04, 0x20, 0x00, 0x80, 0x04, 0x00, 0x08, 0x04, 0x10, 0x00, 0x00, 0x00, 0x01, 0x90, 0x04, 0x4a,
+	0x20, 0x00, 0x00, 0x80, 0x0c, 0x00, 0x42, 0x08, 0x41, 0x30, 0x8c, 0x2a, 0x0e, 0x09, 0x85, 0xc0,
+	0x06, 0x29, 0xc4, 0x40, 0x00, 0x08, 0x10, 0x00, 0x06, 0x80, 0x30, 0xb2, 0x02, 0x01, 0x38, 0x21,
+	0x80, 0x00, 0x0d, 0x03, 0x20, 0x04, 0x40, 0x09, 0x12, 0x00, 0x00, 0x80, 0x10, 0x04, 0x04, 0x80,
+	0xca, 0x88, 0x48, 0x00, 0x02, 0x06, 0x04, 0x24, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x01,
+	0x0d, 0x55, 0xc8, 0xa9, 0x28, 0x24, 0x52, 0x0c, 0x00, 0x00, 0x31, 0x48, 0x4d, 0x62, 0x2f, 0x02,
+	0xa0, 0x30, 0x28, 0x41, 0x7b, 0x05, 0x05, 0xd2, 0x94, 0xa8, 0x44, 0x18, 0xc2, 0x6c, 0xc2, 0x45,
+	0x17, 0x40, 0xd1, 0x2e, 0x01, 0x19, 0x08, 0x02, 0x02, 0xc2, 0x00, 0x15, 0x40, 0x90, 0x91, 0x20,
+	0x01, 0x04, 0x4d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x42, 0x15, 0x20, 0x04, 0x02, 0x0c, 0x00, 0x06,
+	0x04, 0x14, 0x00, 0x60, 0x87, 0x9f, 0xd9, 0xb9, 0x9f, 0x05, 0x0a, 0x54, 0x5d, 0x24, 0x10, 0x38,
+	0xb0, 0x25, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x08, 0x99, 0x00,
+	0x20, 0x04, 0x00, 0x02, 0x08, 0x01, 0x08, 0x44, 0x40, 0x98, 0x00, 0x28, 0x0a, 0x81, 0x08, 0x00,
+	0x00, 0x84, 0x01, 0x40, 0x00, 0x04, 0x21, 0x00, 0x94, 0x07, 0x00, 0x82, 0x01, 0x00, 0x50, 0x00,
+	0x82, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x3c, 0x04, 0x80, 0x00, 0x08, 0x00, 0x49,
+	0x28, 0x02, 0x3c, 0xf8, 0xc0, 0x86, 0x08, 0xcb, 0x30, 0x62, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x48, 0xa1, 0x07, 0x00, 0x24, 0x40, 0x12, 0x00, 0x40, 0x2c, 0x85, 0x22,
+	0x6f, 0xa9, 0xb3, 0xe6, 0x0f, 0x40, 0x26, 0x51, 0x86, 0x6c, 0x3b, 0x72, 0x0b, 0xe2, 0xa4, 0xb5,
+	0x9f, 0x85, 0x22, 0x02, 0x4c, 0x85, 0x23, 0x01, 0x02, 0x04, 0x00, 0x40, 0x02, 0x21, 0x20, 0x20,
+	0x04, 0x00, 0x24, 0x02, 0x80, 0x20, 0x04, 0x00, 0x00, 0x7e, 0x04, 0x00, 0x04, 0x16, 0xa0, 0x01,
+	0x80, 0x2a, 0x04, 0x10, 0x00, 0xd8, 0x32, 0x00, 0x81, 0xfa, 0x83, 0x31, 0x88, 0x04, 0x20, 0x00,
+	0x00, 0x20, 0x87, 0x40, 0x00, 0x00, 0x10, 0x84, 0x21, 0x02, 0x80, 0x48, 0x74, 0x00, 0x00, 0x00,
+	0x29, 0x00, 0x4a, 0x11, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x90, 0x04, 0x00, 0x10, 0x04, 0x00, 0x11,
+	0x10, 0x00, 0x01, 0xc5, 0x57, 0xc9, 0x00, 0x00, 0x00, 0x2d, 0x10, 0x08, 0x00, 0x40, 0x20, 0x50,
+	0x00, 0x10, 0x50, 0x04, 0x88, 0x30, 0x01, 0x00, 0x08, 0x00, 0x02, 0x40, 0x12, 0x00, 0x40, 0x00,
+	0x10, 0x00, 0x00, 0x01, 0x20, 0x08, 0x20, 0x01, 0x10, 0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0xa0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+	0x09, 0x8a, 0x1e, 0x01, 0x38, 0x21, 0x02, 0x18, 0x80, 0x04, 0x70, 0x10, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x02, 0x44, 0x04, 0x88, 0x15, 0x38, 0x01, 0xf8, 0x1c, 0x04, 0xe9, 0x21,
+	0x60, 0x6c, 0x30, 0x1b, 0x88, 0x05, 0x82, 0x08, 0xf3, 0x7a, 0x60, 0x1a, 0x0c, 0x87, 0xc5, 0x0a,
+	0xc1, 0x00, 0x4a, 0x52, 0x80, 0x00, 0x05, 0x22, 0x14, 0x01, 0x42, 0x50, 0x06, 0x22, 0x90, 0x04,
+	0x00, 0xa8, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x40, 0x08, 0x08, 0x10, 0x00, 0x00, 0x48, 0x88,
+	0x6f, 0x15, 0x8f, 0x01, 0x00, 0x20, 0x01, 0x0b, 0x40, 0x70, 0x10, 0x45, 0xa0, 0x88, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x02, 0x00, 0x90, 0x00, 0x00, 0x98, 0x06, 0xe0, 0x10, 0x70,
+	0x08, 0x16, 0x09, 0x41, 0x01, 0x01, 0x00, 0x00, 0x20, 0x3a, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x22, 0x20, 0x71, 0x1a, 0x02, 0x02, 0x00, 0x27, 0xa2, 0x00, 0x20, 0x02, 0x80,
+	0x02, 0xc1, 0x00, 0x02, 0x00, 0x08, 0xc1, 0x00, 0x29, 0x20, 0xa0, 0x8c, 0x24, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x18, 0x01, 0x20, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x80, 0x04, 0x02, 0x10, 0x3e, 0x80, 0x10, 0x04, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0x40, 0x02, 0x80, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x10, 0x01, 0x00, 0x00,
+	0x00, 0x20, 0x25, 0x00, 0x20, 0x00, 0x04, 0x08, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x58, 0x00,
+	0x00, 0x02, 0x00, 0x08, 0x40, 0x01, 0x00, 0x08, 0x00, 0x00, 0x02, 0x20, 0x03, 0x10, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x07,
+	0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xa2,
+	0x00, 0x00, 0x8c, 0xa0, 0x20, 0x00, 0x30, 0x48, 0x08, 0x60, 0x12, 0x59, 0x00, 0x01, 0x10, 0x00,
+	0x80, 0x41, 0x08, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x4c, 0x04, 0x80, 0x82, 0x14, 0x80, 0x00,
+	0x00, 0x20, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0x6b, 0xdf, 0xdf, 0xff, 0xfb, 0xdb, 0xfd,
+	0xdb, 0xdf, 0xdd, 0xbf, 0xff, 0xfd, 0xff, 0xff, 0xbf, 0x55, 0xbf, 0xba, 0xff, 0xff, 0xff, 0xbf,
+	0xdd, 0xbf, 0xfa, 0xd7, 0xf7, 0xfb, 0xba, 0xdd, 0xbf, 0xfb, 0xdb, 0xfd, 0xbd, 0xff, 0xff, 0xff,
+	0xfe, 0xdb, 0xed, 0xbb, 0xbf, 0xdd, 0xbf, 0xfb, 0xdb, 0xfd, 0xbb, 0xdd, 0xfd, 0xff, 0xff, 0xdb,
+	0xf5, 0xab, 0xdf, 0xdd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0xdd, 0xbf, 0xfe, 0xdb, 0xfd, 0xab,
+	0xbe, 0xdd, 0xbf, 0xfa, 0xfd, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xdd, 0xfd, 0xfb, 0xbf, 0xdf,
+	0xbf, 0xfb, 0xdb, 0xf7, 0x6b, 0xd7, 0xdd, 0xff, 0xff, 0xdb, 0xf5, 0xab, 0x77, 0xfd, 0xbe, 0xef,
+	0xdb, 0xfd, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdd, 0xbe, 0x6a, 0xdb, 0xfd,
+	0xbb, 0xdf, 0xdd, 0xff, 0xfb, 0xdd, 0xff, 0xff, 0xbf, 0x5d, 0xbd, 0xaa, 0xdd, 0xfd, 0xff, 0xdf,
+	0xfe, 0xff, 0xfd, 0xdd, 0xfd, 0xeb, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xab, 0xdf, 0xff, 0xff,
+	0xfd, 0xfd, 0xff, 0xbf, 0xdf, 0xdd, 0xbf, 0xfa, 0xdd, 0xfd, 0xbd, 0xbf, 0x5d, 0xbf, 0xfa, 0xfd,
+	0xfe, 0xff, 0xbf, 0xdd, 0xbf, 0xf7, 0xdb, 0xfd, 0xbb, 0xbf, 0xdd, 0xbf, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xdb, 0xed, 0xbb, 0xbf, 0xdd, 0xbf, 0xfb, 0xfd, 0xff, 0xdf, 0xff, 0xff,
+	0xfe, 0xff, 0xdb, 0xfd, 0xbf, 0xdf, 0xdf, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xbf, 0xdd, 0xdf, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdd, 0xfd,
+	0xbb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xeb, 0xdf, 0xdd, 0xbf, 0xff, 0xdd, 0xfd, 0xab, 0xbf,
+	0xdd, 0xbf, 0xf7, 0xdb, 0xfd, 0xbb, 0xbf, 0xfd, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf,
+	0xfb, 0xdb, 0xfd, 0xab, 0xbf, 0xdd, 0xbf, 0xfb, 0xdd, 0xff, 0xeb, 0xbf, 0xdd, 0xbf, 0xfa, 0xdd,
+	0xff, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0xfd, 0xab, 0xdf, 0xdd, 0xbf, 0xfa, 0xdb, 0xfd, 0xab,
+	0xde, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xbf, 0xdd, 0xdf, 0xfa, 0xdb, 0xfd, 0xab, 0xbf, 0xdd,
+	0xbf, 0x76, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfa, 0xdb, 0xf7, 0x6b, 0xbb, 0xdd, 0xbf, 0xf7,
+	0xfb, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf5, 0x6b, 0xbf, 0xdd, 0xbf, 0xfb, 0xdb, 0xfd,
+	0xbf, 0xde, 0xff, 0xff, 0xff, 0xdb, 0xf5, 0xab, 0xdf, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdf,
+	0xdd, 0xbf, 0xfa, 0xdd, 0xfd, 0xeb, 0x7f, 0x7d, 0xbf, 0xba, 0xdd, 0xfd, 0xeb, 0xdf, 0xff, 0xff,
+	0xff, 0xdd, 0xfd, 0xff, 0xdf, 0xdd, 0xdf, 0xfe, 0xdd, 0xfd, 0xed, 0xff, 0xff, 0xff, 0xff, 0xdb,
+	0xf5, 0xbb, 0xfa, 0xfd, 0xbe, 0xba, 0xdb, 0xfd, 0xbb, 0xbb, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff,
+	0xbf, 0x5d, 0xbf, 0xf6, 0xdb, 0xfd, 0xbb, 0xbf, 0xdd, 0xbf, 0xbb, 0xdd, 0xff, 0xff, 0x7f, 0xdd,
+	0xbe, 0xfa, 0xdd, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xfd, 0xdb, 0xfd, 0xfb, 0xdf, 0xfd, 0xff, 0xff,
+	0xdb, 0xf7, 0xab, 0xd7, 0xdf, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xbf, 0xdd, 0xff, 0xfb, 0xdd, 0xfd,
+	0xad, 0xbf, 0xdd, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xbf, 0x5d, 0xbf, 0xee, 0xdb, 0xf5, 0xbb, 0xbf,
+	0xdd, 0xbf, 0xfb, 0xfb, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xbd, 0xdf, 0xff, 0xff,
+	0xfa, 0xfb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xbf, 0xbf, 0xdd, 0xdf, 0xfa, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xdd, 0xfd, 0xfb, 0xff, 0xff,
+	0xff, 0xff, 0xdb, 0xfd, 0xab, 0xbf, 0x7d, 0xbf, 0xbb, 0xdb, 0xfd, 0xbb, 0xbf, 0xdd, 0xbf, 0xfa,
+	0xdd, 0xfd, 0xbd, 0xff, 0xdd, 0xbe, 0x7b, 0xdb, 0xfd, 0xbb, 0xbf, 0xdd, 0xbf, 0xfb, 0xdd, 0xfd,
+	0xbf, 0x7f, 0x5d, 0xbf, 0xba, 0xdb, 0xfd, 0xbf, 0xdf, 0xdd, 0xdf, 0xfd, 0xdd, 0xfd, 0xeb, 0xbf,
+	0xdd, 0xbf, 0xfa, 0xdb, 0xfd, 0xab, 0xd6, 0xff, 0xff, 0xfd, 0xdb, 0xfd, 0xbd, 0xbf, 0xdd, 0xbf,
+	0xfa, 0xfb, 0xfd, 0xad, 0xbf, 0xbd, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0x7a, 0xdb,
+	0xfd, 0xbb, 0xbf, 0xdd, 0xbf, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf5, 0xbb,
+	0xdf, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xdb, 0xf5, 0xbb, 0xbf, 0xfd,
+	0xfe, 0xfd, 0xfd, 0xff, 0xdf, 0xdf, 0xdd, 0xbf, 0xff, 0xfd, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfb,
+	0xfd, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0xf5,
+	0xfb, 0xdf, 0xdd, 0xdf, 0xff, 0xdb, 0xfd, 0xab, 0xbf, 0x77, 0xbf, 0x7b, 0xdb, 0xfd, 0xbb, 0xbf,
+	0xdd, 0xbe, 0xba, 0xdd, 0xfd, 0xfb, 0xbf, 0x7b, 0xff, 0x57, 0xdb, 0xfd, 0xab, 0x7f, 0xdd, 0xfe,
+	0xfb, 0xdd, 0xfd, 0xdb, 0xbf, 0x7d, 0xbd, 0xea, 0xdb, 0xfd, 0xbb, 0xbf, 0xfd, 0xdf, 0xfa, 0xdb,
+	0xfd, 0xab, 0xbf, 0xdd, 0xbf, 0xfa, 0xdb, 0xf7, 0xab, 0xbf, 0xdd, 0xbf, 0xfb, 0xdb, 0xfd, 0xbb,
+	0xbe, 0xdd, 0xbf, 0xfa, 0xdb, 0xfd, 0xab, 0xbe, 0xdd, 0xb7, 0xfe, 0xdd, 0xfd, 0xed, 0xbf, 0x7d,
+	0xbf, 0x77, 0xdb, 0xf5, 0x7b, 0xbf, 0xdd, 0xbf, 0xfb, 0x5b, 0xfd, 0xbd, 0xdf, 0xdd, 0xff, 0xff,
+	0xdb, 0xf5, 0x6b, 0xbf, 0xdd, 0xbf, 0xfa, 0xdd, 0xfd, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xf5,
+	0xeb, 0xbe, 0xdf, 0xbf, 0xfa, 0xfd, 0xff, 0xbf, 0xdf, 0xdd, 0xbf, 0xfa, 0xdb, 0xff, 0xbf, 0xbf,
+	0x7d, 0xbf, 0xfa, 0xfd, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xeb, 0xdf, 0xdd, 0xdf,
+	0xff, 0xdb, 0xfd, 0xab, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf5, 0x6b, 0xb7, 0xd5, 0xbe, 0xfb, 0xdb,
+	0xfd, 0xbb, 0xdf, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfb, 0xfd, 0xff, 0xbf,
+	0xdf, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xea, 0xfb, 0xfd, 0xdf, 0xdf, 0xff,
+	0xfe, 0xfd, 0xdd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0xfd, 0xbb, 0xdf, 0xff, 0xff, 0xfb,
+	0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xfa, 0xff, 0xff,
+	0xfe, 0xbf, 0xdd, 0xbf, 0xf7, 0x5b, 0xfd, 0x7b, 0xbf, 0xdd, 0xbf, 0xfb, 0x5d, 0xfd, 0xbd, 0xff,
+	0xff, 0xff, 0xff, 0xdb, 0xfd, 0xbb, 0xbf, 0xdd, 0xbf, 0xfa, 0xdd, 0xff, 0xdf, 0xdf, 0xfd, 0xff,
+	0xfa, 0xdb, 0xfd, 0xab, 0xdf, 0xdd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xdd, 0xbf, 0xfa, 0xfd,
+	0xff, 0xfd, 0xbf, 0xdd, 0xbf, 0xfa, 0xfd, 0xff, 0xdf, 0xdf, 0xfd, 0xff, 0xff, 0xdd, 0xfd, 0xab,
+	0xde, 0xdd, 0xdf, 0xfb, 0xdb, 0xfd, 0xab, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfb, 0xab, 0xbf, 0xdd,
+	0xbf, 0xfa, 0xdb, 0xfd, 0xbb, 0xbf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfb,
+	0xdb, 0xfd, 0xab, 0xdf, 0xdd, 0xbf, 0xfb, 0xfd, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfa, 0xdb, 0xfd,
+	0xbd, 0xdf, 0xff, 0xff, 0xfb, 0xfd, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xfd, 0xab, 0xdf,
+	0xdd, 0xff, 0xfb, 0xfd, 0xff, 0xbf, 0xbf, 0xdd, 0xbf, 0xfa, 0xdd, 0xfd, 0xfd, 0xbf, 0xdd, 0xbf,
+	0xfb, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfa, 0xdb, 0xfb, 0xbb, 0xbf, 0xdd, 0xbf, 0xfb, 0xfd,
+	0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf5, 0xbb, 0xbf, 0xdd, 0xbf, 0xfa, 0xdd, 0xff, 0xdf,
+	0xdf, 0xfd, 0xff, 0xff, 0xdb, 0xfd, 0xab, 0xd7, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xdf, 0xfd,
+	0xfe, 0xfa, 0xfd, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfa, 0xfd, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff,
+	0xdb, 0xfd, 0xbb, 0xdf, 0xdd, 0xdf, 0xfb, 0xdb, 0xf5, 0xeb, 0xdf, 0xdd, 0xbf, 0xff, 0xdb, 0xfd,
+	0xab, 0x7f, 0x5d, 0xbf, 0xbb, 0xdb, 0xfd, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+	0xdd, 0xbf, 0xfb, 0xdb, 0xfd, 0xab, 0xdf, 0xdd, 0xbf, 0xfb, 0xfd, 0xfd, 0xeb, 0xbf, 0xdd, 0xbf,
+	0xfa, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xdf, 0xdd, 0xbf, 0xfe, 0xdb,
+	0xf5, 0xab, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xdd, 0xdf, 0xfe, 0xdd, 0xfd, 0xad,
+	0xde, 0xdd, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xbf, 0xdd, 0xbf, 0xfa, 0xdb, 0xbd, 0xab, 0xbf, 0xdd,
+	0xbf, 0xfb, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf5, 0xab, 0xbf, 0xdd, 0xbf, 0xfa,
+	0xdb, 0xfd, 0xbb, 0xdf, 0xdd, 0xbf, 0xff, 0xdb, 0xbd, 0xab, 0xbb, 0xdd, 0xff, 0xfa, 0xdb, 0xff,
+	0xaf, 0xbf, 0xdd, 0xbf, 0xfa, 0xdd, 0xfd, 0xeb, 0xbf, 0xdd, 0xdb, 0xfa, 0xdd, 0xfd, 0xbd, 0xbf,
+	0xdd, 0xff, 0xfb, 0xdb, 0xfd, 0xab, 0xbf, 0xdd, 0xdf, 0xfa, 0xdb, 0xfb, 0xab, 0xdb, 0xdd, 0xbf,
+	0xfb, 0xdb, 0xfd, 0xab, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00};